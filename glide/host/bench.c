@@ -0,0 +1,248 @@
+#include "scene.h"
+#include "glide_helpers.h"
+#include "glide_host.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Host benchmark: run the demo frame loop on the CPU for a number of frames at a fixed camera,
+// with draw calls recorded by the Glide stand-in, and report geometry throughput.
+// Usage: dragon_bench [frame count] [--ppm path/to/frame.ppm] [--check] [--tmu size in KB]
+// --check compares the vertex kernel selected at build time to the reference path, and fails if they differ.
+
+// Tolerances for the kernel check: relative for clip positions, absolute in 0-255 units for colors.
+#define CHECK_POSITION_TOLERANCE 1e-4f
+#define CHECK_COLOR_TOLERANCE 2.0f
+#define CHECK_UV_TOLERANCE 1e-3f
+
+static void printUsage(const char* name){
+	printf("Usage: %s [frame count] [--ppm path/to/frame.ppm] [--check] [--tmu size in KB]\n", name);
+}
+
+// Parse a whole argument as a strictly positive integer.
+static int parsePositive(const char* str, int* value){
+	char* end = NULL;
+	const long parsed = strtol(str, &end, 10);
+	if(end == str || *end != '\0' || parsed < 1 || parsed > 0x7FFFFFFF){
+		return 0;
+	}
+	*value = (int)parsed;
+	return 1;
+}
+
+static double elapsedSeconds(const struct timespec* start, const struct timespec* end){
+	return (double)(end->tv_sec - start->tv_sec) + 1e-9 * (double)(end->tv_nsec - start->tv_nsec);
+}
+
+static int checkKernel(Scene* scene, float aspect){
+	GrVertex* reference = (GrVertex*)calloc(scene->maxVertexCount, sizeof(GrVertex));
+	GrVertex* result = (GrVertex*)calloc(scene->maxVertexCount, sizeof(GrVertex));
+	unsigned char* referenceCodes = (unsigned char*)calloc(scene->maxVertexCount, 1);
+	unsigned char* resultCodes = (unsigned char*)calloc(scene->maxVertexCount, 1);
+
+	Matrix proj;
+	createProjection(aspect, -1.00f, 1.00f, -1.00f, 1.00f, 1.0f, 1000.00f, &proj);
+
+	float maxPosition = 0.0f;
+	float maxColor = 0.0f;
+	float maxUV = 0.0f;
+	unsigned long codeMismatches = 0;
+	unsigned long vertexCount = 0;
+
+	// Cameras all around the scene, close and far, with objects at various orientations.
+	const int stepCount = 32;
+	for(int step = 0; step < stepCount; ++step){
+		const float radius = (step % 2) ? 15.0f : 40.0f;
+		const float horizontalAngle = 2.0f * 3.14159f * (float)step / (float)stepCount;
+		const float verticalAngle = -0.3f + 1.2f * (float)(step % 4) / 3.0f;
+		Vec4 cameraPos;
+		cameraPos[0] = radius * cosf(horizontalAngle) * cosf(verticalAngle);
+		cameraPos[1] = radius * sinf(verticalAngle);
+		cameraPos[2] = radius * sinf(horizontalAngle) * cosf(verticalAngle);
+		cameraPos[3] = 1.f;
+		Matrix view, viewProj;
+		createLookAtCenter(&view, cameraPos);
+		mulMat(proj, view, &viewProj);
+
+		for(unsigned int oid = 0; oid < scene->count; ++oid){
+			Object* obj = &(scene->objects[oid]);
+			const float angle = obj->angle;
+			obj->angle = 0.37f * (float)step;
+			sceneTransformAndShadeObjectReference(obj, &viewProj, &cameraPos, &scene->light, reference, referenceCodes);
+			sceneTransformAndShadeObject(obj, &viewProj, &cameraPos, &scene->light, result, resultCodes);
+			obj->angle = angle;
+
+			for(unsigned int vid = 0; vid < obj->vCount; ++vid){
+				const GrVertex* a = &reference[vid];
+				const GrVertex* b = &result[vid];
+				for(int i = 0; i < 4; ++i){
+					const float error = fabsf(a->xyzw[i] - b->xyzw[i]) / MAX(fabsf(a->xyzw[i]), 1.0f);
+					maxPosition = MAX(maxPosition, error);
+				}
+				maxColor = MAX(maxColor, fabsf(a->r - b->r));
+				maxColor = MAX(maxColor, fabsf(a->g - b->g));
+				maxColor = MAX(maxColor, fabsf(a->b - b->b));
+				maxColor = MAX(maxColor, fabsf(a->a - b->a));
+				maxUV = MAX(maxUV, fabsf(a->sow - b->sow));
+				maxUV = MAX(maxUV, fabsf(a->tow - b->tow));
+				// Vertices lying on a plane can legitimately flip.
+				codeMismatches += referenceCodes[vid] != resultCodes[vid];
+			}
+			vertexCount += obj->vCount;
+		}
+	}
+
+	const int success = maxPosition <= CHECK_POSITION_TOLERANCE && maxColor <= CHECK_COLOR_TOLERANCE && maxUV <= CHECK_UV_TOLERANCE;
+	printf("Kernel %d against reference, %lu vertices: position %g (relative), color %g, uv %g, %lu outcodes differ. %s\n",
+		TRANSFORM_KERNEL, vertexCount, maxPosition, maxColor, maxUV, codeMismatches, success ? "Passed." : "Failed.");
+
+	free(reference);
+	free(result);
+	free(referenceCodes);
+	free(resultCodes);
+	return success;
+}
+
+static void drawFrame(Scene* scene, Matrix* viewProj, Vec4* cameraPos, GrVertex* vertices, FxI32 viewport[4], FxI32 drange[2]){
+	sceneUpdate(scene);
+
+	// Clear depth buffer.
+	grRenderBuffer( GR_BUFFER_BACKBUFFER );
+	grColorMask(FXFALSE, FXFALSE);
+	grBufferClear( 0x000000, 0, drange[1] );
+	grColorMask(FXTRUE, FXFALSE);
+
+	sceneDraw(scene, viewProj, cameraPos, vertices, viewport[2], viewport[3]);
+
+	grBufferSwap(1);
+}
+
+int main(int argc, char** argv){
+	int frameCount = 500;
+	const char* ppmPath = NULL;
+	int check = 0;
+	int tmuSize = 0;
+	for(int i = 1; i < argc; ++i){
+		if(strcmp(argv[i], "--ppm") == 0 && i + 1 < argc){
+			ppmPath = argv[++i];
+		} else if(strcmp(argv[i], "--check") == 0){
+			check = 1;
+		} else if(strcmp(argv[i], "--tmu") == 0 && i + 1 < argc){
+			int tmuKB = 0;
+			if(!parsePositive(argv[++i], &tmuKB) || tmuKB > 0x7FFFFFFF / 1024){
+				printf("Invalid texture memory size: %s\n", argv[i]);
+				printUsage(argv[0]);
+				return 1;
+			}
+			tmuSize = tmuKB * 1024;
+		} else if(!parsePositive(argv[i], &frameCount)){
+			printf("Unknown argument: %s\n", argv[i]);
+			printUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	grGlideInit();
+	grSstSelect(0);
+	GrResolution screen;
+	screen.resolution = GR_QUERY_ANY;
+	screen.refresh = GR_QUERY_ANY;
+	screen.numColorBuffers = GR_QUERY_ANY;
+	screen.numAuxBuffers = 1;
+	if(!findResolution(&screen)){
+		printf("Unable to find valid resolution.\n");
+		return 0;
+	}
+	GrContext_t context = grSstWinOpen((FxU32)0, screen.resolution, screen.refresh,
+		GR_COLORFORMAT_ABGR, GR_ORIGIN_UPPER_LEFT, screen.numColorBuffers, screen.numAuxBuffers );
+	grErrorSetCallback(errorCallback);
+
+	FxI32 viewport[4];
+	grGet(GR_VIEWPORT, 16, viewport);
+	FxI32 drange[2];
+	grGet(GR_WDEPTH_MIN_MAX, 8, drange);
+	resetState(viewport[2], viewport[3]);
+	setVertexLayout();
+
+	// Fixed camera, same as the demo initial position.
+	const float radius = 40.0f;
+	const float horizontalAngle = 3.14159f/2.0f;
+	const float verticalAngle = 0.15f;
+	Vec4 cameraPos;
+	cameraPos[0] = radius * cosf(horizontalAngle) * cosf(verticalAngle);
+	cameraPos[1] = radius * sinf(verticalAngle);
+	cameraPos[2] = radius * sinf(horizontalAngle) * cosf(verticalAngle);
+	cameraPos[3] = 1.f;
+
+	Matrix view, proj, viewProj;
+	createProjection((float)viewport[2]/(float)viewport[3], -1.00f, 1.00f, -1.00f, 1.00f, 1.0f, 1000.00f, &proj);
+	createLookAtCenter(&view, cameraPos);
+	mulMat(proj, view, &viewProj);
+
+	Scene scene;
+	sceneInit(&scene);
+	// Smaller texture memory, to exercise the texture cache.
+	if(tmuSize > 0){
+		hostSetTextureMemory(tmuSize);
+	}
+	sceneUploadTextures(&scene, grTexMinAddress(GR_TMU0), grTexMaxAddress(GR_TMU0));
+	GrVertex* vertices = (GrVertex*)calloc(scene.maxVertexCount, sizeof(GrVertex));
+
+	if(check && !checkKernel(&scene, (float)viewport[2]/(float)viewport[3])){
+		grSstWinClose(context);
+		grGlideShutdown();
+		free(vertices);
+		sceneCleanup(&scene);
+		return 1;
+	}
+
+	unsigned long inputVertices = 0;
+	unsigned long inputTriangles = 0;
+	for(unsigned int i = 0; i < scene.count; ++i){
+		inputVertices += scene.objects[i].vCount;
+		inputTriangles += scene.objects[i].iCount / 3;
+	}
+
+	// Geometry only, no rasterization.
+	hostSetRasterize(0);
+	hostResetStats();
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(int frame = 0; frame < frameCount; ++frame){
+		drawFrame(&scene, &viewProj, &cameraPos, vertices, viewport, drange);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	HostStats stats;
+	hostGetStats(&stats);
+	const TextureCacheStats textureStats = scene.textures.stats;
+
+	const double seconds = elapsedSeconds(&start, &end);
+	printf("Frames: %d in %.3f s, %.3f ms per frame.\n", frameCount, seconds, 1000.0 * seconds / (double)frameCount);
+	printf("Input: %lu vertices, %lu triangles per frame.\n", inputVertices, inputTriangles);
+	printf("Vertices transformed: %.0f per second.\n", (double)inputVertices * frameCount / seconds);
+	printf("Triangles processed: %.0f per second.\n", (double)inputTriangles * frameCount / seconds);
+	printf("Submitted per frame: %lu draw calls, %lu vertices, %lu triangles (%lu culled by the hardware).\n",
+		stats.drawCalls / frameCount, stats.vertices / frameCount, stats.triangles / frameCount, stats.culled / frameCount);
+	printf("Textures: %lu hits, %lu fallbacks, %lu downloads (%lu KB), %lu evictions.\n",
+		textureStats.hits, textureStats.fallbacks, textureStats.downloads, textureStats.downloadedBytes / 1024, textureStats.evictions);
+
+	// Rasterize one more frame for comparisons.
+	if(ppmPath){
+		hostSetRasterize(1);
+		grColorMask(FXTRUE, FXFALSE);
+		grBufferClear( 0x000000, 0, drange[1] );
+		drawFrame(&scene, &viewProj, &cameraPos, vertices, viewport, drange);
+		if(hostWriteFramePPM(ppmPath)){
+			printf("Frame written to %s.\n", ppmPath);
+		}
+	}
+
+	grSstWinClose(context);
+	grGlideShutdown();
+	free(vertices);
+	sceneCleanup(&scene);
+	return 0;
+}
@@ -0,0 +1,482 @@
+#include "glide_host.h"
+#include "geometry.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define HOST_WIDTH 640
+#define HOST_HEIGHT 480
+#define HOST_DEFAULT_TMU_SIZE (2 * 1024 * 1024)
+
+typedef struct {
+	// Frame.
+	unsigned char* color;
+	float* depth;
+	int width;
+	int height;
+	int rasterize;
+	// State.
+	FxBool colorMask;
+	FxBool depthMask;
+	GrCullMode_t cullMode;
+	// Vertex layout, byte offsets (-1 if disabled).
+	int offsetXY;
+	int offsetQ;
+	int offsetRGB;
+	int offsetA;
+	int offsetST0;
+	// Texture memory.
+	unsigned char* tmu;
+	FxU32 tmuSize;
+	FxU32 texAddress;
+	GrTexInfo texInfo;
+	HostStats stats;
+	GrErrorCallbackFnc_t errorCallback;
+} HostState;
+
+static HostState host = {
+	NULL, NULL, HOST_WIDTH, HOST_HEIGHT, 0,
+	FXTRUE, FXTRUE, GR_CULL_DISABLE,
+	-1, -1, -1, -1, -1,
+	NULL, HOST_DEFAULT_TMU_SIZE, 0, { 0 }, { 0 }, NULL
+};
+
+static void hostError(const char* message){
+	if(host.errorCallback){
+		host.errorCallback(message, FXFALSE);
+	} else {
+		printf("Glide host: %s", message);
+	}
+}
+
+/// Host controls.
+
+void hostSetRasterize(int enable){
+	host.rasterize = enable;
+}
+
+void hostSetTextureMemory(FxU32 size){
+	host.tmuSize = size;
+	free(host.tmu);
+	host.tmu = calloc(host.tmuSize, 1);
+}
+
+void hostGetStats(HostStats* stats){
+	*stats = host.stats;
+}
+
+void hostResetStats(){
+	memset(&host.stats, 0, sizeof(HostStats));
+}
+
+int hostWriteFramePPM(const char* path){
+	if(!host.color){
+		return 0;
+	}
+	FILE* file = fopen(path, "wb");
+	if(!file){
+		printf("Unable to write frame to %s.\n", path);
+		return 0;
+	}
+	fprintf(file, "P6\n%d %d\n255\n", host.width, host.height);
+	fwrite(host.color, 3, host.width * host.height, file);
+	fclose(file);
+	return 1;
+}
+
+/// Setup.
+
+void grGlideInit(void){
+	if(!host.tmu){
+		host.tmu = calloc(host.tmuSize, 1);
+	}
+}
+
+void grGlideShutdown(void){
+	free(host.tmu);
+	host.tmu = NULL;
+}
+
+void grSstSelect(int which_sst){
+	(void)which_sst;
+}
+
+FxU32 grGet(FxU32 pname, FxU32 plength, FxI32* params){
+	switch(pname){
+		case GR_NUM_BOARDS:
+			params[0] = 1;
+			break;
+		case GR_VIEWPORT:
+			params[0] = 0;
+			params[1] = 0;
+			params[2] = host.width;
+			params[3] = host.height;
+			break;
+		case GR_WDEPTH_MIN_MAX:
+			params[0] = 0;
+			params[1] = 0xFFFF;
+			break;
+		default:
+			return 0;
+	}
+	return plength;
+}
+
+const char* grGetString(FxU32 pname){
+	if(pname == GR_HARDWARE){
+		return "Host software stand-in";
+	}
+	if(pname == GR_VERSION){
+		return "3.0 (host)";
+	}
+	return "";
+}
+
+FxI32 grQueryResolutions(const GrResolution* resTemplate, GrResolution* output){
+	// The demo parses up to 16 entries, all of them valid here.
+	const int count = 16;
+	if(output){
+		for(int i = 0; i < count; ++i){
+			output[i].resolution = GR_RESOLUTION_640x480;
+			output[i].refresh = GR_REFRESH_60Hz;
+			output[i].numColorBuffers = 2;
+			output[i].numAuxBuffers = resTemplate->numAuxBuffers;
+		}
+	}
+	return count * sizeof(GrResolution);
+}
+
+GrContext_t grSstWinOpen(FxU32 hWnd, GrScreenResolution_t screen_resolution, GrScreenRefresh_t refresh_rate,
+	GrColorFormat_t color_format, GrOriginLocation_t origin_location, int nColBuffers, int nAuxBuffers){
+	(void)hWnd; (void)screen_resolution; (void)refresh_rate; (void)color_format; (void)origin_location; (void)nColBuffers; (void)nAuxBuffers;
+	host.color = calloc(host.width * host.height, 3);
+	host.depth = calloc(host.width * host.height, sizeof(float));
+	return 1;
+}
+
+FxBool grSstWinClose(GrContext_t context){
+	(void)context;
+	free(host.color);
+	free(host.depth);
+	host.color = NULL;
+	host.depth = NULL;
+	return FXTRUE;
+}
+
+void grErrorSetCallback(GrErrorCallbackFnc_t fnc){
+	host.errorCallback = fnc;
+}
+
+/// State, mostly ignored: the rasterizer only implements the combine modes used by the demo.
+
+void grCoordinateSpace(GrCoordinateSpaceMode_t mode){ (void)mode; }
+void grViewport(FxI32 x, FxI32 y, FxI32 width, FxI32 height){ (void)x; (void)y; (void)width; (void)height; }
+void grClipWindow(FxU32 minx, FxU32 miny, FxU32 maxx, FxU32 maxy){ (void)minx; (void)miny; (void)maxx; (void)maxy; }
+void grDepthRange(FxFloat n, FxFloat f){ (void)n; (void)f; }
+void grDepthBufferMode(GrDepthBufferMode_t mode){ (void)mode; }
+void grDepthBufferFunction(GrCmpFnc_t function){ (void)function; }
+void grDepthMask(FxBool mask){ host.depthMask = mask; }
+void grColorMask(FxBool rgb, FxBool a){ (void)a; host.colorMask = rgb; }
+void grCullMode(GrCullMode_t mode){ host.cullMode = mode; }
+void grRenderBuffer(GrBuffer_t buffer){ (void)buffer; }
+void grTexFilterMode(GrChipID_t tmu, GrTextureFilterMode_t minfilter_mode, GrTextureFilterMode_t magfilter_mode){ (void)tmu; (void)minfilter_mode; (void)magfilter_mode; }
+void grTexClampMode(GrChipID_t tmu, GrTextureClampMode_t s_clampmode, GrTextureClampMode_t t_clampmode){ (void)tmu; (void)s_clampmode; (void)t_clampmode; }
+void grTexMipMapMode(GrChipID_t tmu, GrMipMapMode_t mode, FxBool lodBlend){ (void)tmu; (void)mode; (void)lodBlend; }
+void grColorCombine(GrCombineFunction_t function, GrCombineFactor_t factor, GrCombineLocal_t local, GrCombineOther_t other, FxBool invert){
+	(void)function; (void)factor; (void)local; (void)other; (void)invert;
+}
+void grAlphaCombine(GrCombineFunction_t function, GrCombineFactor_t factor, GrCombineLocal_t local, GrCombineOther_t other, FxBool invert){
+	(void)function; (void)factor; (void)local; (void)other; (void)invert;
+}
+void grTexCombine(GrChipID_t tmu, GrCombineFunction_t rgb_function, GrCombineFactor_t rgb_factor,
+	GrCombineFunction_t alpha_function, GrCombineFactor_t alpha_factor, FxBool rgb_invert, FxBool alpha_invert){
+	(void)tmu; (void)rgb_function; (void)rgb_factor; (void)alpha_function; (void)alpha_factor; (void)rgb_invert; (void)alpha_invert;
+}
+
+void grVertexLayout(FxU32 param, FxI32 offset, FxU32 mode){
+	const int value = mode == GR_PARAM_ENABLE ? offset : -1;
+	switch(param){
+		case GR_PARAM_XY: host.offsetXY = value; break;
+		case GR_PARAM_Q: host.offsetQ = value; break;
+		case GR_PARAM_RGB: host.offsetRGB = value; break;
+		case GR_PARAM_A: host.offsetA = value; break;
+		case GR_PARAM_ST0: host.offsetST0 = value; break;
+		default: break;
+	}
+}
+
+/// Textures.
+
+static void lodSize(GrLOD_t lod, GrAspectRatio_t aspect, FxU32* w, FxU32* h){
+	const FxU32 side = 1u << lod;
+	*w = aspect >= 0 ? side : (side >> -aspect);
+	*h = aspect >= 0 ? (side >> aspect) : side;
+	*w = MAX(*w, 1u);
+	*h = MAX(*h, 1u);
+}
+
+static FxU32 texelSize(GrTextureFormat_t format){
+	return format >= GR_TEXFMT_16BIT ? 2 : 1;
+}
+
+FxU32 grTexMinAddress(GrChipID_t tmu){
+	(void)tmu;
+	return 0;
+}
+
+FxU32 grTexMaxAddress(GrChipID_t tmu){
+	(void)tmu;
+	// Last address where the largest texture fits.
+	return host.tmuSize - 256 * 256 * 2;
+}
+
+FxU32 grTexCalcMemRequired(GrLOD_t lodmin, GrLOD_t lodmax, GrAspectRatio_t aspect, GrTextureFormat_t fmt){
+	FxU32 size = 0;
+	for(GrLOD_t lod = lodmin; lod <= lodmax; ++lod){
+		FxU32 w, h;
+		lodSize(lod, aspect, &w, &h);
+		size += w * h * texelSize(fmt);
+	}
+	// Textures are aligned on 8 bytes.
+	return (size + 7u) & ~7u;
+}
+
+FxU32 grTexTextureMemRequired(FxU32 evenOdd, GrTexInfo* info){
+	(void)evenOdd;
+	return grTexCalcMemRequired(info->smallLodLog2, info->largeLodLog2, info->aspectRatioLog2, info->format);
+}
+
+void grTexDownloadMipMap(GrChipID_t tmu, FxU32 startAddress, FxU32 evenOdd, GrTexInfo* info){
+	(void)tmu;
+	const FxU32 size = grTexTextureMemRequired(evenOdd, info);
+	if(!host.tmu || startAddress + size > host.tmuSize){
+		hostError("texture download out of texture memory.\n");
+		return;
+	}
+	// As on the Voodoo, textures can't straddle the 2MB boundary.
+	if(startAddress < 0x200000 && startAddress + size > 0x200000){
+		hostError("texture download across the 2MB boundary.\n");
+		return;
+	}
+	memcpy(host.tmu + startAddress, info->data, size);
+	host.stats.textureDownloads += 1;
+	host.stats.textureBytes += size;
+}
+
+void grTexSource(GrChipID_t tmu, FxU32 startAddress, FxU32 evenOdd, GrTexInfo* info){
+	(void)tmu; (void)evenOdd;
+	host.texAddress = startAddress;
+	host.texInfo = *info;
+}
+
+/// Buffers.
+
+void grBufferClear(GrColor_t color, GrAlpha_t alpha, FxU32 depth){
+	(void)alpha;
+	if(!host.color){
+		return;
+	}
+	const int count = host.width * host.height;
+	if(host.colorMask){
+		for(int i = 0; i < count; ++i){
+			host.color[3 * i + 0] = (color >> 0) & 0xFF;
+			host.color[3 * i + 1] = (color >> 8) & 0xFF;
+			host.color[3 * i + 2] = (color >> 16) & 0xFF;
+		}
+	}
+	if(host.depthMask){
+		// W-buffer, the clear value is the farthest W.
+		const float far = depth >= 0xFFFF ? 1e30f : (float)depth;
+		for(int i = 0; i < count; ++i){
+			host.depth[i] = far;
+		}
+	}
+}
+
+void grBufferSwap(FxU32 swap_interval){
+	(void)swap_interval;
+}
+
+/// Rasterization.
+
+typedef struct {
+	float x, y, oow;
+	float r, g, b, a;
+	float sow, tow;
+} HostVertex;
+
+static float readParam(const void* vertex, int offset, int index, float fallback){
+	if(offset < 0){
+		return fallback;
+	}
+	return ((const float*)((const unsigned char*)vertex + offset))[index];
+}
+
+static void fetchVertex(const void* vertex, HostVertex* v){
+	v->x = readParam(vertex, host.offsetXY, 0, 0.0f);
+	v->y = readParam(vertex, host.offsetXY, 1, 0.0f);
+	v->oow = readParam(vertex, host.offsetQ, 0, 1.0f);
+	v->r = readParam(vertex, host.offsetRGB, 0, 255.0f);
+	v->g = readParam(vertex, host.offsetRGB, 1, 255.0f);
+	v->b = readParam(vertex, host.offsetRGB, 2, 255.0f);
+	v->a = readParam(vertex, host.offsetA, 0, 0.0f);
+	v->sow = readParam(vertex, host.offsetST0, 0, 0.0f);
+	v->tow = readParam(vertex, host.offsetST0, 1, 0.0f);
+}
+
+static void sampleTexture(float s, float t, float rgb[3]){
+	FxU32 w, h;
+	lodSize(host.texInfo.largeLodLog2, host.texInfo.aspectRatioLog2, &w, &h);
+	// Texture coordinates are in [0, 256] for the largest side.
+	const FxU32 side = MAX(w, h);
+	int x = (int)floorf(s * (float)side / 256.0f);
+	int y = (int)floorf(t * (float)side / 256.0f);
+	x = ((x % (int)w) + (int)w) % (int)w;
+	y = ((y % (int)h) + (int)h) % (int)h;
+	const FxU32 texel = y * w + x;
+	const FxU32 address = host.texAddress + texel * texelSize(host.texInfo.format);
+	if(!host.tmu || address + 2 > host.tmuSize){
+		rgb[0] = rgb[1] = rgb[2] = 0.0f;
+		return;
+	}
+	if(texelSize(host.texInfo.format) == 2){
+		const FxU16 value = (FxU16)(host.tmu[address] | (host.tmu[address + 1] << 8));
+		// RGB565, other 16 bits formats are approximated.
+		rgb[0] = (float)((value >> 11) & 0x1F) * (255.0f / 31.0f);
+		rgb[1] = (float)((value >> 5) & 0x3F) * (255.0f / 63.0f);
+		rgb[2] = (float)(value & 0x1F) * (255.0f / 31.0f);
+	} else {
+		rgb[0] = rgb[1] = rgb[2] = (float)host.tmu[address];
+	}
+}
+
+static void rasterizeTriangle(const HostVertex* a, const HostVertex* b, const HostVertex* c){
+	const float area = (b->x - a->x) * (c->y - a->y) - (c->x - a->x) * (b->y - a->y);
+	// Culling, on the sign of the area.
+	if(area == 0.0f || (host.cullMode == GR_CULL_POSITIVE && area > 0.0f) || (host.cullMode == GR_CULL_NEGATIVE && area < 0.0f)){
+		host.stats.culled += 1;
+		return;
+	}
+	if(!host.rasterize || !host.color){
+		return;
+	}
+	const int minX = MAX((int)floorf(MIN(a->x, MIN(b->x, c->x))), 0);
+	const int maxX = MIN((int)ceilf(MAX(a->x, MAX(b->x, c->x))), host.width - 1);
+	const int minY = MAX((int)floorf(MIN(a->y, MIN(b->y, c->y))), 0);
+	const int maxY = MIN((int)ceilf(MAX(a->y, MAX(b->y, c->y))), host.height - 1);
+	const float invArea = 1.0f / area;
+
+	for(int y = minY; y <= maxY; ++y){
+		const float py = (float)y + 0.5f;
+		for(int x = minX; x <= maxX; ++x){
+			const float px = (float)x + 0.5f;
+			// Barycentric coordinates.
+			const float wa = ((b->x - px) * (c->y - py) - (c->x - px) * (b->y - py)) * invArea;
+			const float wb = ((c->x - px) * (a->y - py) - (a->x - px) * (c->y - py)) * invArea;
+			const float wc = 1.0f - wa - wb;
+			if(wa < 0.0f || wb < 0.0f || wc < 0.0f){
+				continue;
+			}
+			const float oow = wa * a->oow + wb * b->oow + wc * c->oow;
+			if(oow <= 0.0f){
+				continue;
+			}
+			const float w = 1.0f / oow;
+			const int index = y * host.width + x;
+			if(w >= host.depth[index]){
+				continue;
+			}
+			if(host.depthMask){
+				host.depth[index] = w;
+			}
+			if(!host.colorMask){
+				continue;
+			}
+			// Perspective-correct texture coordinates.
+			const float s = (wa * a->sow + wb * b->sow + wc * c->sow) * w;
+			const float t = (wa * a->tow + wb * b->tow + wc * c->tow) * w;
+			float texel[3];
+			sampleTexture(s, t, texel);
+			// Demo combine: iterated rgb * texture + iterated alpha.
+			const float iterated[3] = {
+				wa * a->r + wb * b->r + wc * c->r,
+				wa * a->g + wb * b->g + wc * c->g,
+				wa * a->b + wb * b->b + wc * c->b
+			};
+			const float specular = wa * a->a + wb * b->a + wc * c->a;
+			for(int i = 0; i < 3; ++i){
+				const float value = iterated[i] * texel[i] / 255.0f + specular;
+				host.color[3 * index + i] = (unsigned char)CLAMP(value, 0.0f, 255.0f);
+			}
+			host.stats.pixels += 1;
+		}
+	}
+}
+
+static void drawVertices(FxU32 mode, FxU32 count, const void* (*fetch)(const void* data, FxU32 i, FxU32 stride), const void* data, FxU32 stride){
+	host.stats.drawCalls += 1;
+	host.stats.vertices += count;
+	if(count < 3){
+		return;
+	}
+	HostVertex v0, v1, v2;
+	switch(mode){
+		case GR_POLYGON:
+		case GR_TRIANGLE_FAN:
+			fetchVertex(fetch(data, 0, stride), &v0);
+			fetchVertex(fetch(data, 1, stride), &v1);
+			for(FxU32 i = 2; i < count; ++i){
+				fetchVertex(fetch(data, i, stride), &v2);
+				host.stats.triangles += 1;
+				rasterizeTriangle(&v0, &v1, &v2);
+				v1 = v2;
+			}
+			break;
+		case GR_TRIANGLE_STRIP:
+			for(FxU32 i = 2; i < count; ++i){
+				// Keep a consistent winding.
+				fetchVertex(fetch(data, (i % 2) ? i - 1 : i - 2, stride), &v0);
+				fetchVertex(fetch(data, (i % 2) ? i - 2 : i - 1, stride), &v1);
+				fetchVertex(fetch(data, i, stride), &v2);
+				host.stats.triangles += 1;
+				rasterizeTriangle(&v0, &v1, &v2);
+			}
+			break;
+		case GR_TRIANGLES:
+			for(FxU32 i = 0; i + 2 < count; i += 3){
+				fetchVertex(fetch(data, i, stride), &v0);
+				fetchVertex(fetch(data, i + 1, stride), &v1);
+				fetchVertex(fetch(data, i + 2, stride), &v2);
+				host.stats.triangles += 1;
+				rasterizeTriangle(&v0, &v1, &v2);
+			}
+			break;
+		default:
+			hostError("unsupported primitive mode.\n");
+			break;
+	}
+}
+
+static const void* fetchContiguous(const void* data, FxU32 i, FxU32 stride){
+	return (const unsigned char*)data + i * stride;
+}
+
+static const void* fetchPointer(const void* data, FxU32 i, FxU32 stride){
+	(void)stride;
+	return ((const void* const*)data)[i];
+}
+
+void grDrawVertexArrayContiguous(FxU32 mode, FxU32 Count, void* pointers, FxU32 stride){
+	drawVertices(mode, Count, fetchContiguous, pointers, stride);
+}
+
+void grDrawVertexArray(FxU32 mode, FxU32 Count, void* pointers){
+	drawVertices(mode, Count, fetchPointer, pointers, 0);
+}
+
+void grDrawTriangle(const void* a, const void* b, const void* c){
+	const void* pointers[3] = { a, b, c };
+	drawVertices(GR_TRIANGLES, 3, fetchPointer, pointers, 0);
+}
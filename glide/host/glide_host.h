@@ -0,0 +1,30 @@
+#ifndef GLIDEHOST_H
+#define GLIDEHOST_H
+
+#include <glide.h>
+
+// Software stand-in for the subset of Glide used by the demo, for host builds.
+// Draw calls are counted, and optionally rasterized (textured, gouraud shaded, W-buffered)
+// so that frames can be saved and compared.
+
+typedef struct {
+	unsigned long drawCalls;
+	unsigned long vertices;
+	unsigned long triangles;
+	unsigned long culled;
+	unsigned long pixels;
+	unsigned long textureDownloads;
+	unsigned long textureBytes;
+} HostStats;
+
+void hostSetRasterize(int enable);
+
+void hostSetTextureMemory(FxU32 size);
+
+void hostGetStats(HostStats* stats);
+
+void hostResetStats();
+
+int hostWriteFramePPM(const char* path);
+
+#endif
@@ -42,6 +42,73 @@ void printResolution(const GrResolution* screen){
 	printf("Resolution: %s, freq: %s, #buffers: %d, #aux: %d\n", glideResNames[screen->resolution], glideFreqNames[screen->refresh], screen->numColorBuffers, screen->numAuxBuffers);
 }
 
+void resetState(FxU32 w, FxU32 h){
+	grCoordinateSpace(GR_WINDOW_COORDS);
+	grViewport((FxU32)0, (FxU32)0, (FxU32)w, (FxU32)h);
+	grClipWindow((FxU32)0, (FxU32)0, (FxU32)w, (FxU32)h);
+	grDepthRange(0.0f, 1.0f);
+	grDepthBufferMode(GR_DEPTHBUFFER_WBUFFER);
+	grDepthBufferFunction(GR_CMP_LESS);
+	grDepthMask(FXTRUE);
+	grColorMask(FXTRUE, FXFALSE);
+	grCullMode(GR_CULL_POSITIVE);
+	// Texture filtering.
+	grTexFilterMode(GR_TMU0, GR_TEXTUREFILTER_BILINEAR, GR_TEXTUREFILTER_BILINEAR);
+	grTexClampMode(GR_TMU0, GR_TEXTURECLAMP_WRAP, GR_TEXTURECLAMP_WRAP);
+	grTexMipMapMode(GR_TMU0, GR_MIPMAP_DISABLE, FXFALSE);
+	// Combining:	diffus * texture + specular
+	//				rgb vertex * texture0 + alpha vertex
+	grColorCombine(GR_COMBINE_FUNCTION_SCALE_OTHER_ADD_LOCAL_ALPHA, 
+		GR_COMBINE_FACTOR_LOCAL, GR_COMBINE_LOCAL_ITERATED, GR_COMBINE_OTHER_TEXTURE, FXFALSE);
+	grAlphaCombine(GR_COMBINE_FUNCTION_LOCAL, 
+		GR_COMBINE_FACTOR_NONE, GR_COMBINE_LOCAL_ITERATED, GR_COMBINE_OTHER_NONE, FXFALSE);
+	grTexCombine(GR_TMU0, GR_COMBINE_FUNCTION_LOCAL, 
+		GR_COMBINE_FACTOR_NONE, GR_COMBINE_FUNCTION_LOCAL, GR_COMBINE_FACTOR_NONE, FXFALSE, FXFALSE);
+}
+
+void setVertexLayout(){
+	grVertexLayout(GR_PARAM_XY, GR_VERTEX_X_OFFSET << 2, GR_PARAM_ENABLE);
+	grVertexLayout(GR_PARAM_Z, GR_VERTEX_OOZ_OFFSET << 2, GR_PARAM_ENABLE);
+	grVertexLayout(GR_PARAM_Q, GR_VERTEX_OOW_OFFSET << 2, GR_PARAM_ENABLE);
+	grVertexLayout(GR_PARAM_RGB, GR_VERTEX_RGB_OFFSET << 2, GR_PARAM_ENABLE);
+	grVertexLayout(GR_PARAM_A, GR_VERTEX_A_OFFSET << 2, GR_PARAM_ENABLE);
+	grVertexLayout(GR_PARAM_ST0, GR_VERTEX_STOW_OFFSET << 2, GR_PARAM_ENABLE);
+}
+
+unsigned char computeOutcode(const Vec4 p){
+	// Same planes as the clippers below: z >= 1 for the near plane, and the viewport [0, w) x [0, h),
+	// which is -w <= x < w and -w <= y < w in clip space (w is always positive in front of the near plane).
+	unsigned char code = 0;
+	if(p[2] < 1.f){
+		code |= CLIP_NEAR;
+	}
+	if(p[0] < -p[3]){
+		code |= CLIP_XMIN;
+	}
+	if(p[0] >= p[3]){
+		code |= CLIP_XMAX;
+	}
+	if(p[1] < -p[3]){
+		code |= CLIP_YMIN;
+	}
+	if(p[1] >= p[3]){
+		code |= CLIP_YMAX;
+	}
+	return code;
+}
+
+float homogeneousOrientation(const GrVertex *a, const GrVertex *b, const GrVertex *c){
+	// Determinant of the (x, y, w) clip coordinates. It has the sign of the screen-space area 
+	// when all vertices are in front of the camera, and gives the facing of the triangle otherwise,
+	// so it can be evaluated before clipping.
+	const float* pa = a->xyzw;
+	const float* pb = b->xyzw;
+	const float* pc = c->xyzw;
+	return pa[0] * (pb[1] * pc[3] - pc[1] * pb[3])
+		 - pb[0] * (pa[1] * pc[3] - pc[1] * pa[3])
+		 + pc[0] * (pa[1] * pb[3] - pb[1] * pa[3]);
+}
+
 void transformClipToViewport(GrVertex* a, float w, float h){
 	float oow = 1.f / a->xyzw[3];
 	a->xyzw[3] = oow,
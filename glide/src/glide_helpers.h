@@ -28,6 +28,22 @@ int findResolution(GrResolution* screen);
 
 void printResolution(const GrResolution* screen);
 
+void resetState(FxU32 w, FxU32 h);
+
+void setVertexLayout();
+
+// Clip-space outcodes, one bit per plane the vertex is outside of.
+#define CLIP_NEAR	0x01
+#define CLIP_XMIN	0x02
+#define CLIP_XMAX	0x04
+#define CLIP_YMIN	0x08
+#define CLIP_YMAX	0x10
+#define CLIP_XY		(CLIP_XMIN | CLIP_XMAX | CLIP_YMIN | CLIP_YMAX)
+
+unsigned char computeOutcode(const Vec4 p);
+
+float homogeneousOrientation(const GrVertex *a, const GrVertex *b, const GrVertex *c);
+
 void transformClipToViewport(GrVertex* a, float w, float h);
 
 int clipTriangleZ(const GrVertex *a, const GrVertex *b, const GrVertex *c, GrVertex outVerts[]);
@@ -15,30 +15,6 @@
 #define RADIUS_SPEED 3.0f
 
 
-void resetState(FxU32 w, FxU32 h){
-	grCoordinateSpace(GR_WINDOW_COORDS);
-	grViewport((FxU32)0, (FxU32)0, (FxU32)w, (FxU32)h);
-	grClipWindow((FxU32)0, (FxU32)0, (FxU32)w, (FxU32)h);
-	grDepthRange(0.0f, 1.0f);
-	grDepthBufferMode(GR_DEPTHBUFFER_WBUFFER);
-	grDepthBufferFunction(GR_CMP_LESS);
-	grDepthMask(FXTRUE);
-	grColorMask(FXTRUE, FXFALSE);
-	grCullMode(GR_CULL_POSITIVE);
-	// Texture filtering.
-	grTexFilterMode(GR_TMU0, GR_TEXTUREFILTER_BILINEAR, GR_TEXTUREFILTER_BILINEAR);
-	grTexClampMode(GR_TMU0, GR_TEXTURECLAMP_WRAP, GR_TEXTURECLAMP_WRAP);
-	grTexMipMapMode(GR_TMU0, GR_MIPMAP_DISABLE, FXFALSE);
-	// Combining:	diffus * texture + specular
-	//				rgb vertex * texture0 + alpha vertex
-	grColorCombine(GR_COMBINE_FUNCTION_SCALE_OTHER_ADD_LOCAL_ALPHA, 
-		GR_COMBINE_FACTOR_LOCAL, GR_COMBINE_LOCAL_ITERATED, GR_COMBINE_OTHER_TEXTURE, FXFALSE);
-	grAlphaCombine(GR_COMBINE_FUNCTION_LOCAL, 
-		GR_COMBINE_FACTOR_NONE, GR_COMBINE_LOCAL_ITERATED, GR_COMBINE_OTHER_NONE, FXFALSE);
-	grTexCombine(GR_TMU0, GR_COMBINE_FUNCTION_LOCAL, 
-		GR_COMBINE_FACTOR_NONE, GR_COMBINE_FUNCTION_LOCAL, GR_COMBINE_FACTOR_NONE, FXFALSE, FXFALSE);
-}
-
 void resetCamera(float* radius, float* horizontalAngle, float* verticalAngle){
 	*radius = 40.0f;
 	*horizontalAngle = 3.14159f/2.0f;
@@ -99,12 +75,7 @@ int main( int argc, char **argv){
 	resetState(viewport[2], viewport[3]);
 
 	// Define vertex layout.
-	grVertexLayout(GR_PARAM_XY, GR_VERTEX_X_OFFSET << 2, GR_PARAM_ENABLE);
-	grVertexLayout(GR_PARAM_Z, GR_VERTEX_OOZ_OFFSET << 2, GR_PARAM_ENABLE);
-	grVertexLayout(GR_PARAM_Q, GR_VERTEX_OOW_OFFSET << 2, GR_PARAM_ENABLE);
-	grVertexLayout(GR_PARAM_RGB, GR_VERTEX_RGB_OFFSET << 2, GR_PARAM_ENABLE);
-	grVertexLayout(GR_PARAM_A, GR_VERTEX_A_OFFSET << 2, GR_PARAM_ENABLE);
-	grVertexLayout(GR_PARAM_ST0, GR_VERTEX_STOW_OFFSET << 2, GR_PARAM_ENABLE);
+	setVertexLayout();
 
 	// Camera:
 	Matrix view;
@@ -207,47 +178,7 @@ int main( int argc, char **argv){
 		grColorMask(FXTRUE, FXFALSE);
 
 		// Draw each object.
-		for(int oid = 0; oid < scene.count; ++oid){
-
-			Object* obj = &(scene.objects[oid]);
-
-			// Attach the right texture.
-			grTexSource(GR_TMU0, obj->texAdress, GR_MIPMAPLEVELMASK_BOTH, &(obj->tex));
-
-			// Transform each vertex and compute its shading.
-			sceneTransformAndShadeObject(obj, &viewProj, &cameraPos, &scene.light, vertices);
-
-			GrVertex clipVerts[8];
-			GrVertex vpVerts[8];
-			for(unsigned int tid = 0; tid < obj->iCount; tid += 3){
-
-				// Clip into multiple triangles based on Z planes if needed.
-				int clipCount = clipTriangleZ(&vertices[obj->indices[tid]],
-					&vertices[obj->indices[tid+1]],
-					&vertices[obj->indices[tid+2]], clipVerts);
-				
-				if(clipCount < 3){
-					continue;
-				}
-
-				// Perspective divide and convert from NDC to viewport.
-				for(int cid = 0; cid < clipCount; ++cid){
-					transformClipToViewport(&clipVerts[cid], viewport[2], viewport[3]);
-				}
-
-				// Clip to viewoprt and draw.
-				for(int cid = 0; cid < clipCount-1; ++cid){
-
-					int subCount = clipTriangleXY(&clipVerts[0], &clipVerts[cid], &clipVerts[cid+1], 
-						vpVerts, viewport[2], viewport[3]);
-					if(subCount < 3){
-						continue;
-					}
-
-					grDrawVertexArrayContiguous( GR_POLYGON, subCount, vpVerts, sizeof(GrVertex) );
-				}
-			}
-		}
+		sceneDraw(&scene, &viewProj, &cameraPos, vertices, viewport[2], viewport[3]);
 		
 		grBufferSwap(1);
 	}
@@ -1,6 +1,7 @@
 #include "scene.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "resources/plane_split_data.h"
 #include "resources/monkey_data.h"
@@ -86,33 +87,31 @@ void sceneInit(Scene* scene){
 	for(unsigned int i = 0; i < scene->count; ++i){
 		scene->maxVertexCount = MAX(scene->maxVertexCount, scene->objects[i].vCount);
 	}
+	scene->outcodes = (unsigned char*)calloc(scene->maxVertexCount, sizeof(unsigned char));
+	scene->screenVertices = (GrVertex*)calloc(scene->maxVertexCount, sizeof(GrVertex));
+	scene->projected = (unsigned char*)calloc(scene->maxVertexCount, sizeof(unsigned char));
+	scene->batch = (const GrVertex**)calloc(SCENE_BATCH_SIZE, sizeof(GrVertex*));
+
+	// Input streams for the vertex kernel.
+	for(unsigned int i = 0; i < scene->count; ++i){
+		Object* obj = &(scene->objects[i]);
+		createStreams(&obj->streams, obj->vertices, obj->normals, obj->uvs, obj->vCount, obj->shininess, obj->type != UNLIT);
+	}
 }
 
-#define TEX_2MB_LIMIT 2097152
+// Texture downloads allowed per frame, two 256x256 textures.
+#define TEXTURE_BUDGET (256 * 1024)
 
 void sceneUploadTextures(Scene* scene, FxU32 minAdress, FxU32 maxAdress){
-	FxU32 currentAdress = minAdress;
+	textureCacheInit(&scene->textures, GR_TMU0, minAdress, maxAdress, TEXTURE_BUDGET);
 
-	// Transfer texture data.
-	for(unsigned int i = 0; i < 4; ++i){
+	// Register textures, they are downloaded while there is space.
+	for(unsigned int i = 0; i < scene->count; ++i){
 		scene->objects[i].tex.smallLodLog2 = GR_LOD_LOG2_256;
 		scene->objects[i].tex.largeLodLog2 = GR_LOD_LOG2_256;
 		scene->objects[i].tex.aspectRatioLog2 = GR_ASPECT_LOG2_1x1;
 		scene->objects[i].tex.format = GR_TEXFMT_RGB_565;
-
-		if(currentAdress > maxAdress){
-			break;
-		}
-		FxU32 textureSize = grTexTextureMemRequired(GR_MIPMAPLEVELMASK_BOTH, &(scene->objects[i].tex));
-		// No texture over the 2MB boundary, move forward.
-		if(currentAdress < TEX_2MB_LIMIT && (currentAdress + textureSize) > TEX_2MB_LIMIT){
-			currentAdress = TEX_2MB_LIMIT + 1;
-		} 
-		scene->objects[i].texAdress = currentAdress;
-
-		grTexDownloadMipMap(GR_TMU0, scene->objects[i].texAdress, GR_MIPMAPLEVELMASK_BOTH, &(scene->objects[i].tex));
-
-		currentAdress += textureSize;
+		scene->objects[i].texture = textureCacheAdd(&scene->textures, &(scene->objects[i].tex));
 	}
 }
 
@@ -121,24 +120,41 @@ void sceneUpdate(Scene* scene){
 	scene->objects[0].angle -= 0.020f;
 }
 
-void sceneTransformAndShadeObject(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[]){
+static void computeObjectConstants(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, Matrix* mvp, Vec3* localLightDir, Vec4* localCamPos){
 	Matrix model;
 	createModel(&model, obj->position, obj->angle);
-	Matrix mvp;
-	mulMat(*viewProj, model, &mvp);
+	mulMat(*viewProj, model, mvp);
 
 	// Compute local light dir.
 	Matrix invModel;
 	createInvModel(&invModel, obj->position, obj->angle);
+	mulDir(invModel, *lightDir, localLightDir);
+	normalize3(localLightDir);
+
+	mulVec4(invModel, *cameraPos, localCamPos);
+}
+
+void sceneTransformAndShadeObject(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[], unsigned char outcodes[]){
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_REFERENCE
+	sceneTransformAndShadeObjectReference(obj, viewProj, cameraPos, lightDir, vertices, outcodes);
+#else
+	Matrix mvp;
 	Vec3 localLightDir;
-	mulDir(invModel, *lightDir, &localLightDir);
-	normalize3(&localLightDir);
+	Vec4 localCamPos;
+	computeObjectConstants(obj, viewProj, cameraPos, lightDir, &mvp, &localLightDir, &localCamPos);
+	transformAndShade(&obj->streams, mvp, localLightDir, localCamPos, vertices, outcodes);
+#endif
+}
 
+void sceneTransformAndShadeObjectReference(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[], unsigned char outcodes[]){
+	Matrix mvp;
+	Vec3 localLightDir;
 	Vec4 localCamPos;
-	mulVec4(invModel, *cameraPos, &localCamPos);
+	computeObjectConstants(obj, viewProj, cameraPos, lightDir, &mvp, &localLightDir, &localCamPos);
 
 	for(unsigned int vid = 0; vid < obj->vCount; ++vid){
 		mulVec3(mvp, obj->vertices[vid], &vertices[vid].xyzw);
+		outcodes[vid] = computeOutcode(vertices[vid].xyzw);
 
 		float diffuse = 1.f;
 		float specular = 0.f;
@@ -173,8 +189,122 @@ void sceneTransformAndShadeObject(Object* obj, Matrix* viewProj, Vec4* cameraPos
 	}
 }
 
+static const GrVertex* projectVertex(Scene* scene, GrVertex vertices[], int vid, float w, float h){
+	// Each vertex is projected at most once per frame, shared by all triangles using it.
+	GrVertex* screen = &(scene->screenVertices[vid]);
+	if(!scene->projected[vid]){
+		*screen = vertices[vid];
+		transformClipToViewport(screen, w, h);
+		scene->projected[vid] = 1;
+	}
+	return screen;
+}
+
+void sceneDraw(Scene* scene, Matrix* viewProj, Vec4* cameraPos, GrVertex vertices[], float w, float h){
+	textureCacheBeginFrame(&scene->textures);
+
+	for(unsigned int oid = 0; oid < scene->count; ++oid){
+
+		Object* obj = &(scene->objects[oid]);
+
+		// Attach the right texture, or skip the object if it could not be registered.
+		if(obj->texture < 0){
+			continue;
+		}
+		textureCacheBind(&scene->textures, obj->texture);
+
+		// Transform each vertex and compute its shading.
+		sceneTransformAndShadeObject(obj, viewProj, cameraPos, &scene->light, vertices, scene->outcodes);
+		memset(scene->projected, 0, obj->vCount);
+		unsigned int batchCount = 0;
+
+		GrVertex clipVerts[8];
+		GrVertex vpVerts[8];
+		for(unsigned int tid = 0; tid < obj->iCount; tid += 3){
+			const int ia = obj->indices[tid];
+			const int ib = obj->indices[tid+1];
+			const int ic = obj->indices[tid+2];
+
+			// Trivial reject: all vertices outside of the same plane.
+			const unsigned char codeA = scene->outcodes[ia];
+			const unsigned char codeB = scene->outcodes[ib];
+			const unsigned char codeC = scene->outcodes[ic];
+			if(codeA & codeB & codeC){
+				continue;
+			}
+
+			// Backface culling, same convention as GR_CULL_POSITIVE.
+			if(homogeneousOrientation(&vertices[ia], &vertices[ib], &vertices[ic]) >= 0.0f){
+				continue;
+			}
+
+			// Trivial accept: reference the cached screen-space vertices in the batch.
+			const unsigned char codes = codeA | codeB | codeC;
+			if(!codes){
+				scene->batch[batchCount++] = projectVertex(scene, vertices, ia, w, h);
+				scene->batch[batchCount++] = projectVertex(scene, vertices, ib, w, h);
+				scene->batch[batchCount++] = projectVertex(scene, vertices, ic, w, h);
+				if(batchCount == SCENE_BATCH_SIZE){
+					grDrawVertexArray(GR_TRIANGLES, batchCount, (void*)scene->batch);
+					batchCount = 0;
+				}
+				continue;
+			}
+
+			// Clip into multiple triangles based on Z planes if needed.
+			int clipCount = 3;
+			if(codes & CLIP_NEAR){
+				clipCount = clipTriangleZ(&vertices[ia], &vertices[ib], &vertices[ic], clipVerts);
+				if(clipCount < 3){
+					continue;
+				}
+			} else {
+				clipVerts[0] = vertices[ia];
+				clipVerts[1] = vertices[ib];
+				clipVerts[2] = vertices[ic];
+			}
+
+			// Perspective divide and convert from NDC to viewport.
+			for(int cid = 0; cid < clipCount; ++cid){
+				transformClipToViewport(&clipVerts[cid], w, h);
+			}
+
+			// The clipped polygon is inside the viewport.
+			if(!(codes & CLIP_XY)){
+				grDrawVertexArrayContiguous( GR_POLYGON, clipCount, clipVerts, sizeof(GrVertex) );
+				continue;
+			}
+
+			// Clip to viewport and draw.
+			for(int cid = 1; cid < clipCount-1; ++cid){
+
+				int subCount = clipTriangleXY(&clipVerts[0], &clipVerts[cid], &clipVerts[cid+1], 
+					vpVerts, w, h);
+				if(subCount < 3){
+					continue;
+				}
+
+				grDrawVertexArrayContiguous( GR_POLYGON, subCount, vpVerts, sizeof(GrVertex) );
+			}
+		}
+
+		// Submit the remaining triangles before changing texture.
+		if(batchCount > 0){
+			grDrawVertexArray(GR_TRIANGLES, batchCount, (void*)scene->batch);
+		}
+	}
+}
+
 void sceneCleanup(Scene* scene){
+	for(unsigned int i = 0; i < scene->count; ++i){
+		freeStreams(&scene->objects[i].streams);
+	}
+	textureCacheCleanup(&scene->textures);
 	free(scene->objects);
+	free(scene->outcodes);
+	free(scene->screenVertices);
+	free(scene->projected);
+	free(scene->batch);
 	scene->count = 0;
 	scene->maxVertexCount = 0;
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "geometry.h"
 #include "glide_helpers.h"
+#include "transform.h"
+#include "texture_cache.h"
 #include <glide.h>
 
 enum Type {
@@ -11,6 +13,7 @@ enum Type {
 
 typedef struct {
 	GrTexInfo tex;
+	VertexStreams streams;
 	Vec3 position;
 	float (*vertices)[3];
 	float (*normals)[3];
@@ -19,13 +22,22 @@ typedef struct {
 	enum Type type;
 	unsigned int vCount;
 	unsigned int iCount;
-	unsigned int texAdress;
+	int texture;
 	float angle;
 	float shininess;
 } Object;
 
+// Unclipped triangles are submitted in batches of this many vertices.
+#define SCENE_BATCH_SIZE 768
+
 typedef struct {
 	Object* objects;
+	TextureCache textures;
+	// Per-frame scratch: clip-space outcodes, and screen-space vertices projected on first use.
+	unsigned char* outcodes;
+	GrVertex* screenVertices;
+	unsigned char* projected;
+	const GrVertex** batch;
 	Vec3 light;
 	unsigned int count;
 	unsigned int maxVertexCount;
@@ -37,7 +49,11 @@ void sceneUploadTextures(Scene* scene, FxU32 minAdress, FxU32 maxAdress);
 
 void sceneUpdate(Scene* scene);
 
-void sceneTransformAndShadeObject(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[]);
+void sceneTransformAndShadeObject(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[], unsigned char outcodes[]);
+
+void sceneTransformAndShadeObjectReference(Object* obj, Matrix* viewProj, Vec4* cameraPos, Vec3* lightDir, GrVertex vertices[], unsigned char outcodes[]);
+
+void sceneDraw(Scene* scene, Matrix* viewProj, Vec4* cameraPos, GrVertex vertices[], float w, float h);
 
 void sceneCleanup(Scene* scene);
 
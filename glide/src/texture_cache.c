@@ -0,0 +1,231 @@
+#include "texture_cache.h"
+#include "geometry.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void textureSize(GrLOD_t lod, GrAspectRatio_t aspect, FxU32* w, FxU32* h){
+	const FxU32 side = 1u << lod;
+	*w = aspect >= 0 ? side : (side >> -aspect);
+	*h = aspect >= 0 ? (side >> aspect) : side;
+	*w = MAX(*w, 1u);
+	*h = MAX(*h, 1u);
+}
+
+/// Free blocks management.
+
+static void insertBlock(TextureCache* cache, unsigned int index, FxU32 start, FxU32 size){
+	memmove(&cache->freeBlocks[index + 1], &cache->freeBlocks[index], (cache->freeCount - index) * sizeof(TextureBlock));
+	cache->freeBlocks[index].start = start;
+	cache->freeBlocks[index].size = size;
+	++cache->freeCount;
+}
+
+static void removeBlock(TextureCache* cache, unsigned int index){
+	--cache->freeCount;
+	memmove(&cache->freeBlocks[index], &cache->freeBlocks[index + 1], (cache->freeCount - index) * sizeof(TextureBlock));
+}
+
+static int allocate(TextureCache* cache, FxU32 size, FxU32* address){
+	// Best fit: smallest free block large enough.
+	int best = -1;
+	for(unsigned int bid = 0; bid < cache->freeCount; ++bid){
+		const FxU32 blockSize = cache->freeBlocks[bid].size;
+		if(blockSize >= size && (best < 0 || blockSize < cache->freeBlocks[best].size)){
+			best = bid;
+		}
+	}
+	if(best < 0){
+		return 0;
+	}
+	*address = cache->freeBlocks[best].start;
+	cache->freeBlocks[best].start += size;
+	cache->freeBlocks[best].size -= size;
+	if(cache->freeBlocks[best].size == 0){
+		removeBlock(cache, best);
+	}
+	return 1;
+}
+
+static void release(TextureCache* cache, FxU32 start, FxU32 size){
+	unsigned int index = 0;
+	while(index < cache->freeCount && cache->freeBlocks[index].start < start){
+		++index;
+	}
+	insertBlock(cache, index, start, size);
+	// Merge with the next and previous blocks, but never across the 2MB boundary.
+	if(index + 1 < cache->freeCount){
+		TextureBlock* block = &cache->freeBlocks[index];
+		const FxU32 end = block->start + block->size;
+		if(end == cache->freeBlocks[index + 1].start && end != TEX_2MB_LIMIT){
+			block->size += cache->freeBlocks[index + 1].size;
+			removeBlock(cache, index + 1);
+		}
+	}
+	if(index > 0){
+		TextureBlock* previous = &cache->freeBlocks[index - 1];
+		const FxU32 end = previous->start + previous->size;
+		if(end == cache->freeBlocks[index].start && end != TEX_2MB_LIMIT){
+			previous->size += cache->freeBlocks[index].size;
+			removeBlock(cache, index);
+		}
+	}
+}
+
+/// Textures.
+
+static void download(TextureCache* cache, CachedTexture* texture){
+	grTexDownloadMipMap(cache->tmu, texture->address, GR_MIPMAPLEVELMASK_BOTH, &(texture->info));
+	texture->resident = 1;
+	cache->stats.downloads += 1;
+	cache->stats.downloadedBytes += texture->size;
+}
+
+static int evictLeastRecentlyUsed(TextureCache* cache, int keepCurrentFrame){
+	// Textures already used this frame are usually kept, to avoid thrashing.
+	int oldest = -1;
+	for(unsigned int tid = 0; tid < cache->count; ++tid){
+		const CachedTexture* texture = &cache->textures[tid];
+		if(!texture->resident || (keepCurrentFrame && texture->lastUse == cache->frame)){
+			continue;
+		}
+		if(oldest < 0 || texture->lastUse < cache->textures[oldest].lastUse){
+			oldest = tid;
+		}
+	}
+	if(oldest < 0){
+		return 0;
+	}
+	CachedTexture* texture = &cache->textures[oldest];
+	release(cache, texture->address, texture->size);
+	texture->resident = 0;
+	cache->stats.evictions += 1;
+	return 1;
+}
+
+static void createFallback(const GrTexInfo* info, GrTexInfo* fallback){
+	*fallback = *info;
+	fallback->largeLodLog2 = MIN(info->largeLodLog2, TEXTURE_CACHE_FALLBACK_LOD);
+	fallback->smallLodLog2 = fallback->largeLodLog2;
+
+	FxU32 w, h, fw, fh;
+	textureSize(info->largeLodLog2, info->aspectRatioLog2, &w, &h);
+	textureSize(fallback->largeLodLog2, fallback->aspectRatioLog2, &fw, &fh);
+	const FxU32 factor = w / fw;
+	const int texelSize = info->format >= GR_TEXFMT_16BIT ? 2 : 1;
+	unsigned char* data = (unsigned char*)malloc(fw * fh * texelSize);
+	fallback->data = data;
+
+	for(FxU32 y = 0; y < fh; ++y){
+		for(FxU32 x = 0; x < fw; ++x){
+			if(info->format == GR_TEXFMT_RGB_565){
+				// Box filter.
+				const FxU16* src = (const FxU16*)info->data;
+				FxU32 r = 0, g = 0, b = 0;
+				for(FxU32 dy = 0; dy < factor; ++dy){
+					for(FxU32 dx = 0; dx < factor; ++dx){
+						const FxU16 texel = src[(y * factor + dy) * w + x * factor + dx];
+						r += (texel >> 11) & 0x1F;
+						g += (texel >> 5) & 0x3F;
+						b += texel & 0x1F;
+					}
+				}
+				const FxU32 count = factor * factor;
+				((FxU16*)data)[y * fw + x] = (FxU16)(((r / count) << 11) | ((g / count) << 5) | (b / count));
+			} else {
+				// Other formats are point sampled.
+				const unsigned char* src = (const unsigned char*)info->data + ((y * factor) * w + x * factor) * texelSize;
+				memcpy(data + (y * fw + x) * texelSize, src, texelSize);
+			}
+		}
+	}
+}
+
+void textureCacheInit(TextureCache* cache, GrChipID_t tmu, FxU32 minAddress, FxU32 maxAddress, FxU32 budget){
+	memset(cache, 0, sizeof(TextureCache));
+	cache->tmu = tmu;
+	cache->budget = budget;
+	// The max address is the last one where a 256x256 16 bits texture still fits.
+	const FxU32 start = (minAddress + 7u) & ~7u;
+	const FxU32 end = maxAddress + grTexCalcMemRequired(GR_LOD_LOG2_256, GR_LOD_LOG2_256, GR_ASPECT_LOG2_1x1, GR_TEXFMT_16BIT);
+	// Split at the 2MB boundary, no texture can straddle it.
+	if(start < TEX_2MB_LIMIT && end > TEX_2MB_LIMIT){
+		insertBlock(cache, 0, start, TEX_2MB_LIMIT - start);
+		insertBlock(cache, 1, TEX_2MB_LIMIT, end - TEX_2MB_LIMIT);
+	} else if(end > start){
+		insertBlock(cache, 0, start, end - start);
+	}
+}
+
+int textureCacheAdd(TextureCache* cache, GrTexInfo* info){
+	if(cache->count == TEXTURE_CACHE_MAX_TEXTURES){
+		printf("Texture cache: too many textures.\n");
+		return -1;
+	}
+	CachedTexture* texture = &cache->textures[cache->count];
+	memset(texture, 0, sizeof(CachedTexture));
+	texture->info = *info;
+	texture->size = (grTexTextureMemRequired(GR_MIPMAPLEVELMASK_BOTH, info) + 7u) & ~7u;
+
+	// The fallback is downloaded once and stays resident, preloaded textures are evicted to make space.
+	createFallback(info, &texture->fallbackInfo);
+	const FxU32 fallbackSize = (grTexTextureMemRequired(GR_MIPMAPLEVELMASK_BOTH, &texture->fallbackInfo) + 7u) & ~7u;
+	int allocated = allocate(cache, fallbackSize, &texture->fallbackAddress);
+	while(!allocated && evictLeastRecentlyUsed(cache, 0)){
+		allocated = allocate(cache, fallbackSize, &texture->fallbackAddress);
+	}
+	if(!allocated){
+		printf("Texture cache: no space left for fallback.\n");
+		free(texture->fallbackInfo.data);
+		return -1;
+	}
+	grTexDownloadMipMap(cache->tmu, texture->fallbackAddress, GR_MIPMAPLEVELMASK_BOTH, &(texture->fallbackInfo));
+	free(texture->fallbackInfo.data);
+	texture->fallbackInfo.data = NULL;
+
+	// Preload if there is space, outside of the frame budget.
+	if(allocate(cache, texture->size, &texture->address)){
+		download(cache, texture);
+	}
+	return cache->count++;
+}
+
+void textureCacheBeginFrame(TextureCache* cache){
+	++cache->frame;
+	cache->downloaded = 0;
+}
+
+void textureCacheBind(TextureCache* cache, int handle){
+	CachedTexture* texture = &cache->textures[handle];
+	texture->lastUse = cache->frame;
+
+	if(texture->resident){
+		cache->stats.hits += 1;
+		grTexSource(cache->tmu, texture->address, GR_MIPMAPLEVELMASK_BOTH, &(texture->info));
+		return;
+	}
+
+	// Download if the budget allows it, always allowing one download per frame.
+	const int withinBudget = cache->budget == 0 || cache->downloaded == 0 || cache->downloaded + texture->size <= cache->budget;
+	if(withinBudget){
+		int allocated = allocate(cache, texture->size, &texture->address);
+		while(!allocated && evictLeastRecentlyUsed(cache, 1)){
+			allocated = allocate(cache, texture->size, &texture->address);
+		}
+		if(allocated){
+			download(cache, texture);
+			cache->downloaded += texture->size;
+			grTexSource(cache->tmu, texture->address, GR_MIPMAPLEVELMASK_BOTH, &(texture->info));
+			return;
+		}
+	}
+
+	cache->stats.fallbacks += 1;
+	grTexSource(cache->tmu, texture->fallbackAddress, GR_MIPMAPLEVELMASK_BOTH, &(texture->fallbackInfo));
+}
+
+void textureCacheCleanup(TextureCache* cache){
+	cache->count = 0;
+	cache->freeCount = 0;
+}
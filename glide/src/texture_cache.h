@@ -0,0 +1,65 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <glide.h>
+
+// Texture residency manager for a TMU. Textures are allocated best-fit in texture memory,
+// never across the 2MB boundary, and evicted in least recently used order when space is needed.
+// Each texture also has a reduced LOD copy that always stays resident, used when the full texture
+// cannot be downloaded this frame (no space left or per-frame download budget exhausted).
+
+#define TEX_2MB_LIMIT 2097152
+#define TEXTURE_CACHE_MAX_TEXTURES 64
+// Fallbacks are 64x64.
+#define TEXTURE_CACHE_FALLBACK_LOD GR_LOD_LOG2_64
+
+typedef struct {
+	FxU32 start;
+	FxU32 size;
+} TextureBlock;
+
+typedef struct {
+	GrTexInfo info;
+	GrTexInfo fallbackInfo;
+	FxU32 size;
+	FxU32 address;
+	FxU32 fallbackAddress;
+	unsigned int lastUse;
+	int resident;
+} CachedTexture;
+
+typedef struct {
+	unsigned long hits;
+	unsigned long downloads;
+	unsigned long downloadedBytes;
+	unsigned long evictions;
+	unsigned long fallbacks;
+} TextureCacheStats;
+
+typedef struct {
+	CachedTexture textures[TEXTURE_CACHE_MAX_TEXTURES];
+	// Free blocks, sorted by address.
+	TextureBlock freeBlocks[2 * TEXTURE_CACHE_MAX_TEXTURES + 2];
+	TextureCacheStats stats;
+	GrChipID_t tmu;
+	unsigned int count;
+	unsigned int freeCount;
+	unsigned int frame;
+	// Download budget in bytes per frame, 0 for unlimited.
+	FxU32 budget;
+	FxU32 downloaded;
+} TextureCache;
+
+void textureCacheInit(TextureCache* cache, GrChipID_t tmu, FxU32 minAddress, FxU32 maxAddress, FxU32 budget);
+
+// Register a texture, download it if there is space, and return its handle (or -1 if the fallback does not fit).
+int textureCacheAdd(TextureCache* cache, GrTexInfo* info);
+
+void textureCacheBeginFrame(TextureCache* cache);
+
+// Make the texture current on the TMU, downloading it if needed and possible, or using its fallback.
+void textureCacheBind(TextureCache* cache, int handle);
+
+void textureCacheCleanup(TextureCache* cache);
+
+#endif
@@ -0,0 +1,280 @@
+#include "transform.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_SSE
+#include <xmmintrin.h>
+#endif
+
+#define FIXED_SHIFT 14
+#define FIXED_ONE (1 << FIXED_SHIFT)
+
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_FIXED
+// Drop fractional bits, rounding to nearest.
+#define FIXED_ROUND(x, bits) (((x) + (1 << ((bits) - 1))) >> (bits))
+
+static inline int toFixed(float x){
+	return (int)floorf(x * (float)FIXED_ONE + 0.5f);
+}
+#endif
+
+void createStreams(VertexStreams* streams, float (*vertices)[3], float (*normals)[3], float (*uvs)[2], unsigned int count, float shininess, int lit){
+	memset(streams, 0, sizeof(VertexStreams));
+	streams->count = count;
+	streams->lit = lit;
+
+	// All streams in one block, each aligned on 16 bytes and padded with zeros.
+	const unsigned int padded = (count + 3) & ~3u;
+	size_t size = 8 * padded * sizeof(float) + 16;
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_FIXED
+	size += 3 * padded * sizeof(short);
+#endif
+	streams->memory = calloc(size, 1);
+	float* base = (float*)(((uintptr_t)streams->memory + 15) & ~(uintptr_t)15);
+	streams->x = base;
+	streams->y = base + padded;
+	streams->z = base + 2 * padded;
+	streams->nx = base + 3 * padded;
+	streams->ny = base + 4 * padded;
+	streams->nz = base + 5 * padded;
+	streams->s = base + 6 * padded;
+	streams->t = base + 7 * padded;
+
+	for(unsigned int vid = 0; vid < count; ++vid){
+		streams->x[vid] = vertices[vid][0];
+		streams->y[vid] = vertices[vid][1];
+		streams->z[vid] = vertices[vid][2];
+		// Unit normals keep the reflected direction normalized, the specular lobe is steep.
+		Vec3 normal = { normals[vid][0], normals[vid][1], normals[vid][2] };
+		normalize3(&normal);
+		streams->nx[vid] = normal[0];
+		streams->ny[vid] = normal[1];
+		streams->nz[vid] = normal[2];
+		streams->s[vid] = uvs[vid][0] * 255.0f;
+		streams->t[vid] = uvs[vid][1] * 255.0f;
+	}
+
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_FIXED
+	streams->nxq = (short*)(base + 8 * padded);
+	streams->nyq = streams->nxq + padded;
+	streams->nzq = streams->nxq + 2 * padded;
+	for(unsigned int vid = 0; vid < count; ++vid){
+		streams->nxq[vid] = (short)toFixed(streams->nx[vid]);
+		streams->nyq[vid] = (short)toFixed(streams->ny[vid]);
+		streams->nzq[vid] = (short)toFixed(streams->nz[vid]);
+	}
+#endif
+
+	// Specular lobe, replaces the per-vertex pow().
+	for(unsigned int i = 0; i <= SPECULAR_LUT_SIZE; ++i){
+		streams->specular[i] = 255.0f * powf((float)i / (float)SPECULAR_LUT_SIZE, shininess);
+	}
+	streams->specular[SPECULAR_LUT_SIZE + 1] = streams->specular[SPECULAR_LUT_SIZE];
+}
+
+static inline float lookupSpecular(const float* lut, float c){
+	const float f = MIN(c, 1.f) * (float)SPECULAR_LUT_SIZE;
+	const int i = (int)f;
+	return lut[i] + (f - (float)i) * (lut[i+1] - lut[i]);
+}
+
+static void shadeUnlit(const VertexStreams* streams, GrVertex vertices[]){
+	for(unsigned int vid = 0; vid < streams->count; ++vid){
+		vertices[vid].r = 255.0f;
+		vertices[vid].g = 255.0f;
+		vertices[vid].b = 255.0f;
+		vertices[vid].a = 0.0f;
+	}
+}
+
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_SSE
+
+// The DOS stack is only 4-bytes aligned, realign it for SSE spills.
+__attribute__((force_align_arg_pointer))
+void transformAndShade(const VertexStreams* streams, const Matrix mvp, const Vec3 localLightDir, const Vec4 localCamPos, GrVertex vertices[], unsigned char outcodes[]){
+	const unsigned int count = streams->count;
+	float lanes[4][4];
+
+	// Positions and texture coordinates.
+	for(unsigned int vid = 0; vid < count; vid += 4){
+		const __m128 x = _mm_load_ps(&streams->x[vid]);
+		const __m128 y = _mm_load_ps(&streams->y[vid]);
+		const __m128 z = _mm_load_ps(&streams->z[vid]);
+		for(int r = 0; r < 4; ++r){
+			__m128 res = _mm_mul_ps(x, _mm_set1_ps(mvp[r][0]));
+			res = _mm_add_ps(res, _mm_mul_ps(y, _mm_set1_ps(mvp[r][1])));
+			res = _mm_add_ps(res, _mm_mul_ps(z, _mm_set1_ps(mvp[r][2])));
+			res = _mm_add_ps(res, _mm_set1_ps(mvp[r][3]));
+			_mm_storeu_ps(lanes[r], res);
+		}
+		const unsigned int laneCount = MIN(4u, count - vid);
+		for(unsigned int l = 0; l < laneCount; ++l){
+			GrVertex* v = &vertices[vid + l];
+			v->xyzw[0] = lanes[0][l];
+			v->xyzw[1] = lanes[1][l];
+			v->xyzw[2] = lanes[2][l];
+			v->xyzw[3] = lanes[3][l];
+			v->sow = streams->s[vid + l];
+			v->tow = streams->t[vid + l];
+			outcodes[vid + l] = computeOutcode(v->xyzw);
+		}
+	}
+
+	if(!streams->lit){
+		shadeUnlit(streams, vertices);
+		return;
+	}
+
+	// Lighting.
+	const __m128 lx = _mm_set1_ps(localLightDir[0]);
+	const __m128 ly = _mm_set1_ps(localLightDir[1]);
+	const __m128 lz = _mm_set1_ps(localLightDir[2]);
+	const __m128 cx = _mm_set1_ps(localCamPos[0]);
+	const __m128 cy = _mm_set1_ps(localCamPos[1]);
+	const __m128 cz = _mm_set1_ps(localCamPos[2]);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 threeHalves = _mm_set1_ps(1.5f);
+	for(unsigned int vid = 0; vid < count; vid += 4){
+		const __m128 nx = _mm_load_ps(&streams->nx[vid]);
+		const __m128 ny = _mm_load_ps(&streams->ny[vid]);
+		const __m128 nz = _mm_load_ps(&streams->nz[vid]);
+		const __m128 ndotl = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, lx), _mm_mul_ps(ny, ly)), _mm_mul_ps(nz, lz));
+		// Lambertian and ambient.
+		const __m128 diffuse = _mm_mul_ps(_mm_add_ps(_mm_max_ps(_mm_sub_ps(zero, ndotl), zero), _mm_set1_ps(0.1f)), _mm_set1_ps(255.0f));
+		// Reflected light direction and view direction.
+		const __m128 twoNdotl = _mm_add_ps(ndotl, ndotl);
+		const __m128 rx = _mm_sub_ps(lx, _mm_mul_ps(twoNdotl, nx));
+		const __m128 ry = _mm_sub_ps(ly, _mm_mul_ps(twoNdotl, ny));
+		const __m128 rz = _mm_sub_ps(lz, _mm_mul_ps(twoNdotl, nz));
+		const __m128 vx = _mm_sub_ps(cx, _mm_load_ps(&streams->x[vid]));
+		const __m128 vy = _mm_sub_ps(cy, _mm_load_ps(&streams->y[vid]));
+		const __m128 vz = _mm_sub_ps(cz, _mm_load_ps(&streams->z[vid]));
+		const __m128 rdotv = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, vx), _mm_mul_ps(ry, vy)), _mm_mul_ps(rz, vz));
+		const __m128 vdotv = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+		// Approximate reciprocal square root, refined with one Newton-Raphson step.
+		__m128 invLength = _mm_rsqrt_ps(vdotv);
+		invLength = _mm_mul_ps(invLength, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, vdotv), _mm_mul_ps(invLength, invLength))));
+		const __m128 cosine = _mm_max_ps(_mm_mul_ps(rdotv, invLength), zero);
+		_mm_storeu_ps(lanes[0], diffuse);
+		_mm_storeu_ps(lanes[1], cosine);
+
+		const unsigned int laneCount = MIN(4u, count - vid);
+		for(unsigned int l = 0; l < laneCount; ++l){
+			GrVertex* v = &vertices[vid + l];
+			v->r = lanes[0][l];
+			v->g = lanes[0][l];
+			v->b = lanes[0][l];
+			v->a = lookupSpecular(streams->specular, lanes[1][l]);
+		}
+	}
+}
+
+#else
+
+void transformAndShade(const VertexStreams* streams, const Matrix mvp, const Vec3 localLightDir, const Vec4 localCamPos, GrVertex vertices[], unsigned char outcodes[]){
+	const unsigned int count = streams->count;
+
+	// Positions and texture coordinates.
+	for(unsigned int vid = 0; vid < count; ++vid){
+		const float x = streams->x[vid];
+		const float y = streams->y[vid];
+		const float z = streams->z[vid];
+		GrVertex* v = &vertices[vid];
+		v->xyzw[0] = mvp[0][0] * x + mvp[0][1] * y + mvp[0][2] * z + mvp[0][3];
+		v->xyzw[1] = mvp[1][0] * x + mvp[1][1] * y + mvp[1][2] * z + mvp[1][3];
+		v->xyzw[2] = mvp[2][0] * x + mvp[2][1] * y + mvp[2][2] * z + mvp[2][3];
+		v->xyzw[3] = mvp[3][0] * x + mvp[3][1] * y + mvp[3][2] * z + mvp[3][3];
+		v->sow = streams->s[vid];
+		v->tow = streams->t[vid];
+		outcodes[vid] = computeOutcode(v->xyzw);
+	}
+
+	if(!streams->lit){
+		shadeUnlit(streams, vertices);
+		return;
+	}
+
+	// Lighting.
+	const float cx = localCamPos[0];
+	const float cy = localCamPos[1];
+	const float cz = localCamPos[2];
+
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_FIXED
+	const int lx = toFixed(localLightDir[0]);
+	const int ly = toFixed(localLightDir[1]);
+	const int lz = toFixed(localLightDir[2]);
+	for(unsigned int vid = 0; vid < count; ++vid){
+		const int nx = streams->nxq[vid];
+		const int ny = streams->nyq[vid];
+		const int nz = streams->nzq[vid];
+		// 2.14 * 2.14 products, in 28 fractional bits.
+		const int ndotl = nx * lx + ny * ly + nz * lz;
+		// Lambertian and ambient, diffuse in 8 fractional bits.
+		const int diffuse = (FIXED_ROUND(MAX(-ndotl, 0), FIXED_SHIFT) * 255) >> (FIXED_SHIFT - 8);
+		// Reflected light direction, 2 * ndotl is kept in 15 fractional bits.
+		const int twoNdotl = FIXED_ROUND(ndotl, 2 * FIXED_SHIFT - 16);
+		const int rx = lx - FIXED_ROUND(twoNdotl * nx, 15);
+		const int ry = ly - FIXED_ROUND(twoNdotl * ny, 15);
+		const int rz = lz - FIXED_ROUND(twoNdotl * nz, 15);
+		// The view direction needs a square root, normalize it in floating point.
+		const float vx = cx - streams->x[vid];
+		const float vy = cy - streams->y[vid];
+		const float vz = cz - streams->z[vid];
+		const float invLength = 1.0f / sqrtf(vx * vx + vy * vy + vz * vz);
+		const int rdotv = rx * toFixed(vx * invLength) + ry * toFixed(vy * invLength) + rz * toFixed(vz * invLength);
+
+		GrVertex* v = &vertices[vid];
+		v->r = (float)diffuse * (1.0f / 256.0f) + 25.5f;
+		v->g = v->r;
+		v->b = v->r;
+		v->a = 0.0f;
+		if(rdotv > 0){
+			// Cosine in 16 fractional bits, the top ones index the table.
+			const int cosine = MIN(FIXED_ROUND(rdotv, 2 * FIXED_SHIFT - 16), 1 << 16);
+			const int i = cosine >> 8;
+			const float* lut = streams->specular;
+			v->a = lut[i] + (float)(cosine & 0xFF) * (1.0f / 256.0f) * (lut[i+1] - lut[i]);
+		}
+	}
+#else
+	const float lx = localLightDir[0];
+	const float ly = localLightDir[1];
+	const float lz = localLightDir[2];
+	for(unsigned int vid = 0; vid < count; ++vid){
+		const float nx = streams->nx[vid];
+		const float ny = streams->ny[vid];
+		const float nz = streams->nz[vid];
+		const float ndotl = nx * lx + ny * ly + nz * lz;
+		// Lambertian and ambient.
+		const float diffuse = (MAX(-ndotl, 0.0f) + 0.1f) * 255.0f;
+		// Reflected light direction, already normalized for unit normals.
+		const float rx = lx - 2.f * ndotl * nx;
+		const float ry = ly - 2.f * ndotl * ny;
+		const float rz = lz - 2.f * ndotl * nz;
+		const float vx = cx - streams->x[vid];
+		const float vy = cy - streams->y[vid];
+		const float vz = cz - streams->z[vid];
+		const float rdotv = rx * vx + ry * vy + rz * vz;
+
+		GrVertex* v = &vertices[vid];
+		v->r = diffuse;
+		v->g = diffuse;
+		v->b = diffuse;
+		v->a = 0.0f;
+		if(rdotv > 0.0f){
+			v->a = lookupSpecular(streams->specular, rdotv / sqrtf(vx * vx + vy * vy + vz * vz));
+		}
+	}
+#endif
+}
+
+#endif
+
+void freeStreams(VertexStreams* streams){
+	free(streams->memory);
+	memset(streams, 0, sizeof(VertexStreams));
+}
@@ -0,0 +1,47 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include "geometry.h"
+#include "glide_helpers.h"
+
+// Vertex transformation and shading kernels, selected at build time with TRANSFORM_KERNEL.
+#define TRANSFORM_KERNEL_REFERENCE	0	// Original per-vertex evaluation on the mesh arrays.
+#define TRANSFORM_KERNEL_FLOAT		1	// Structure-of-arrays streams, specular lookup table.
+#define TRANSFORM_KERNEL_SSE		2	// Same, four vertices at a time (Pentium III and later).
+#define TRANSFORM_KERNEL_FIXED		3	// Same, with lighting in 2.14 fixed point.
+
+#ifndef TRANSFORM_KERNEL
+#define TRANSFORM_KERNEL TRANSFORM_KERNEL_FLOAT
+#endif
+
+#define SPECULAR_LUT_SIZE 256
+
+typedef struct {
+	// Positions, normals and texture coordinates (scaled by 255), padded to a multiple of 4 vertices.
+	float* x;
+	float* y;
+	float* z;
+	float* nx;
+	float* ny;
+	float* nz;
+	float* s;
+	float* t;
+#if TRANSFORM_KERNEL == TRANSFORM_KERNEL_FIXED
+	short* nxq;
+	short* nyq;
+	short* nzq;
+#endif
+	void* memory;
+	// 255 * pow(c, shininess) for c in [0, 1], with an extra entry for interpolation.
+	float specular[SPECULAR_LUT_SIZE + 2];
+	unsigned int count;
+	int lit;
+} VertexStreams;
+
+void createStreams(VertexStreams* streams, float (*vertices)[3], float (*normals)[3], float (*uvs)[2], unsigned int count, float shininess, int lit);
+
+void transformAndShade(const VertexStreams* streams, const Matrix mvp, const Vec3 localLightDir, const Vec4 localCamPos, GrVertex vertices[], unsigned char outcodes[]);
+
+void freeStreams(VertexStreams* streams);
+
+#endif
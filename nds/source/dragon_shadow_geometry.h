@@ -1,3875 +1,849 @@
+// Generated by tools/obj2displaylist from ressources/dragon_geometry.obj, do not edit.
+// Shadow volume of a closed hull of 300 triangles (source: 2156), along (-0.57, -0.57, -0.57).
+// 560 triangles in 84 strips, 1756 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define DRAGON_SHADOW_POLYGONS 560
+#define DRAGON_SHADOW_VERTICES 780
+#define DRAGON_SHADOW_CYCLES 6999
+
 const u32 dragon_shadow_commands[] = {
-	5420,
-	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_NOP, FIFO_NOP, FIFO_NOP),
-	GL_TRIANGLES,
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.797945),floattov16(-1.15022)), VERTEX_PACK(floattov16(-0.687963),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.794423),floattov16(-1.15056)), VERTEX_PACK(floattov16(-0.580997),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.16212),floattov16(-1.15152)), VERTEX_PACK(floattov16(-0.004571),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.78911),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.00474),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57236),floattov16(-1.14522)), VERTEX_PACK(floattov16(-1.03513),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.933674),floattov16(-1.14814)), VERTEX_PACK(floattov16(-1.2663),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.632202),floattov16(-1.15071)), VERTEX_PACK(floattov16(-0.646502),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.0425975),floattov16(-1.14992)), VERTEX_PACK(floattov16(-1.32895),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.61606),floattov16(-1.14678)), VERTEX_PACK(floattov16(-1.21609),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.75188),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.43211),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.6645),floattov16(-1.14373)), VERTEX_PACK(floattov16(-1.45249),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.280747),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.661058),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.92187),floattov16(-1.14149)), VERTEX_PACK(floattov16(-1.99573),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94015),floattov16(-1.14034)), VERTEX_PACK(floattov16(-2.3548),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.78911),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.00474),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96371),floattov16(-1.14289)), VERTEX_PACK(floattov16(-2.22964),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36686),floattov16(-1.14359)), VERTEX_PACK(floattov16(-2.42902),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.733271),floattov16(-1.15135)), VERTEX_PACK(floattov16(-0.367761),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.00973),floattov16(-1.14298)), VERTEX_PACK(floattov16(-1.4473),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.29412),floattov16(-1.14274)), VERTEX_PACK(floattov16(-2.04077),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.16768),floattov16(-1.1417)), VERTEX_PACK(floattov16(-1.75072),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.28329),floattov16(-1.14187)), VERTEX_PACK(floattov16(-1.61056),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.16768),floattov16(-1.1417)), VERTEX_PACK(floattov16(-1.75072),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4958),floattov16(-1.14317)), VERTEX_PACK(floattov16(-2.47326),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.92187),floattov16(-1.14149)), VERTEX_PACK(floattov16(-1.99573),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.770671),floattov16(-1.14489)), VERTEX_PACK(floattov16(-2.43519),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.753787),floattov16(-1.14537)), VERTEX_PACK(floattov16(-2.2924),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.691228),floattov16(-1.14547)), VERTEX_PACK(floattov16(-2.30438),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.507756),floattov16(-1.15139)), VERTEX_PACK(floattov16(-0.515567),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.99288),floattov16(-1.14336)), VERTEX_PACK(floattov16(-2.05698),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94015),floattov16(-1.14034)), VERTEX_PACK(floattov16(-2.3548),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.93152),floattov16(-1.14003)), VERTEX_PACK(floattov16(-2.46252),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.61606),floattov16(-1.14678)), VERTEX_PACK(floattov16(-1.21609),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.586922),floattov16(-1.15119)), VERTEX_PACK(floattov16(-0.525208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.507756),floattov16(-1.15139)), VERTEX_PACK(floattov16(-0.515567),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.733271),floattov16(-1.15135)), VERTEX_PACK(floattov16(-0.367761),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.746396),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.268887),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.794423),floattov16(-1.15056)), VERTEX_PACK(floattov16(-0.580997),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(0.014212),floattov16(-1.15154)), VERTEX_PACK(floattov16(-0.842237),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.136797),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.764788),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.00392),floattov16(-1.15141)), VERTEX_PACK(floattov16(-0.152593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.995746),floattov16(-1.1516)), VERTEX_PACK(floattov16(-0.0983895),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.34614),floattov16(-1.14477)), VERTEX_PACK(floattov16(-1.34374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.753787),floattov16(-1.14537)), VERTEX_PACK(floattov16(-2.2924),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94494),floattov16(-1.14384)), VERTEX_PACK(floattov16(-1.21654),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.03335),floattov16(-1.14352)), VERTEX_PACK(floattov16(-1.25507),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94494),floattov16(-1.14384)), VERTEX_PACK(floattov16(-1.21654),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.70146),floattov16(-1.14273)), VERTEX_PACK(floattov16(-2.47016),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.852),floattov16(-1.14879)), VERTEX_PACK(floattov16(-0.394469),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.11985),floattov16(-1.14712)), VERTEX_PACK(floattov16(-0.744343),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.933674),floattov16(-1.14814)), VERTEX_PACK(floattov16(-1.2663),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.75188),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.43211),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.10513),floattov16(-1.1441)), VERTEX_PACK(floattov16(-2.452),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.852),floattov16(-1.14879)), VERTEX_PACK(floattov16(-0.394469),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.280747),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.661058),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.19489),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.663669),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.727002),floattov16(-1.14947)), VERTEX_PACK(floattov16(-0.983398),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.17535),floattov16(-1.14318)), VERTEX_PACK(floattov16(-1.98386),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(0.034348),floattov16(-0.52992)), VERTEX_PACK(floattov16(0.096061),0),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(-0.586922),floattov16(-1.15119)), VERTEX_PACK(floattov16(-0.525208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(-0.507756),floattov16(-1.15139)), VERTEX_PACK(floattov16(-0.515567),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.55606),floattov16(-1.1402)), VERTEX_PACK(floattov16(-2.67621),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.58602),floattov16(-1.14006)), VERTEX_PACK(floattov16(-2.69821),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.53658),floattov16(-1.14162)), VERTEX_PACK(floattov16(-2.23025),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.11985),floattov16(-1.14712)), VERTEX_PACK(floattov16(-0.744343),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.32318),floattov16(-1.14207)), VERTEX_PACK(floattov16(-2.23685),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.0425975),floattov16(-1.14992)), VERTEX_PACK(floattov16(-1.32895),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.136797),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.764788),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.00392),floattov16(-1.15141)), VERTEX_PACK(floattov16(-0.152593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.45796),floattov16(-1.15047)), VERTEX_PACK(floattov16(-0.134203),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.92187),floattov16(-1.14149)), VERTEX_PACK(floattov16(-1.99573),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.96698),floattov16(-1.14391)), VERTEX_PACK(floattov16(-1.8946),0),
-	NORMAL_PACK(floattov10(0.4217),floattov10(0.3181),floattov10(-0.8491)),
-	VERTEX_PACK(floattov16(-0.157065),floattov16(0.669169)), VERTEX_PACK(floattov16(-1.02434),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4217),floattov10(0.3181),floattov10(-0.8491)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	NORMAL_PACK(floattov10(0.4217),floattov10(0.3181),floattov10(-0.8491)),
-	VERTEX_PACK(floattov16(-1.70146),floattov16(-1.14273)), VERTEX_PACK(floattov16(-2.47016),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.797945),floattov16(-1.15022)), VERTEX_PACK(floattov16(-0.687963),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.6645),floattov16(-1.14373)), VERTEX_PACK(floattov16(-1.45249),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.00973),floattov16(-1.14298)), VERTEX_PACK(floattov16(-1.4473),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-3.02056),floattov16(-1.14175)), VERTEX_PACK(floattov16(-1.83966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0021),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.634035),floattov16(-1.14785)), VERTEX_PACK(floattov16(-1.5754),0),
-	NORMAL_PACK(floattov10(-0.0021),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0021),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.40605),floattov16(-1.1507)), VERTEX_PACK(floattov16(-0.0956575),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.55606),floattov16(-1.1402)), VERTEX_PACK(floattov16(-2.67621),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	NORMAL_PACK(floattov10(-0.0022),floattov10(-1),floattov10(-0.0031)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3458),floattov10(0.386),floattov10(-0.8552)),
-	VERTEX_PACK(floattov16(-0.157065),floattov16(0.669169)), VERTEX_PACK(floattov16(-1.02434),0),
-	NORMAL_PACK(floattov10(0.3458),floattov10(0.386),floattov10(-0.8552)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3458),floattov10(0.386),floattov10(-0.8552)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(0.034348),floattov16(-0.52992)), VERTEX_PACK(floattov16(0.096061),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(-0.507756),floattov16(-1.15139)), VERTEX_PACK(floattov16(-0.515567),0),
-	NORMAL_PACK(floattov10(-0.0929),floattov10(-0.6561),floattov10(0.749)),
-	VERTEX_PACK(floattov16(0.077134),floattov16(-0.566504)), VERTEX_PACK(floattov16(0.069324),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5996),floattov10(0.1801),floattov10(-0.7798)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(0.5996),floattov10(0.1801),floattov10(-0.7798)),
-	VERTEX_PACK(floattov16(0.337027),floattov16(-0.619712)), VERTEX_PACK(floattov16(-0.131751),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5996),floattov10(0.1801),floattov10(-0.7798)),
-	VERTEX_PACK(floattov16(-0.19489),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.663669),0),
-	NORMAL_PACK(floattov10(-0.5307),floattov10(0.7564),floattov10(-0.3824)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5307),floattov10(0.7564),floattov10(-0.3824)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	NORMAL_PACK(floattov10(-0.5307),floattov10(0.7564),floattov10(-0.3824)),
-	VERTEX_PACK(floattov16(-1.96371),floattov16(-1.14289)), VERTEX_PACK(floattov16(-2.22964),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3573),floattov10(0.7494),floattov10(-0.5575)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	NORMAL_PACK(floattov10(-0.3573),floattov10(0.7494),floattov10(-0.5575)),
-	VERTEX_PACK(floattov16(-0.157065),floattov16(0.669169)), VERTEX_PACK(floattov16(-1.02434),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3573),floattov10(0.7494),floattov10(-0.5575)),
-	VERTEX_PACK(floattov16(-1.70146),floattov16(-1.14273)), VERTEX_PACK(floattov16(-2.47016),0),
-	NORMAL_PACK(floattov10(0.7537),floattov10(-0.6571),floattov10(0.0155)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7537),floattov10(-0.6571),floattov10(0.0155)),
-	VERTEX_PACK(floattov16(-1.30534),floattov16(0.336006)), VERTEX_PACK(floattov16(0.149475),0),
-	NORMAL_PACK(floattov10(0.7537),floattov10(-0.6571),floattov10(0.0155)),
-	VERTEX_PACK(floattov16(-2.57236),floattov16(-1.14522)), VERTEX_PACK(floattov16(-1.03513),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0466),floattov10(-0.6826),floattov10(0.7293)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(-0.0466),floattov10(-0.6826),floattov10(0.7293)),
-	VERTEX_PACK(floattov16(-0.136797),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.764788),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0466),floattov10(-0.6826),floattov10(0.7293)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	NORMAL_PACK(floattov10(0.1516),floattov10(-0.6932),floattov10(0.7046)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1516),floattov10(-0.6932),floattov10(0.7046)),
-	VERTEX_PACK(floattov16(-2.57236),floattov16(-1.14522)), VERTEX_PACK(floattov16(-1.03513),0),
-	NORMAL_PACK(floattov10(0.1516),floattov10(-0.6932),floattov10(0.7046)),
-	VERTEX_PACK(floattov16(-1.30534),floattov16(0.336006)), VERTEX_PACK(floattov16(0.149475),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.583),floattov10(-0.1443),floattov10(0.7996)),
-	VERTEX_PACK(floattov16(-1.46877),floattov16(0.478679)), VERTEX_PACK(floattov16(0.250927),0),
-	NORMAL_PACK(floattov10(-0.583),floattov10(-0.1443),floattov10(0.7996)),
-	VERTEX_PACK(floattov16(-2.78911),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.00474),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.583),floattov10(-0.1443),floattov10(0.7996)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(-0.136797),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.764788),0),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(0.014212),floattov16(-1.15154)), VERTEX_PACK(floattov16(-0.842237),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3329),floattov10(-0.4039),floattov10(0.8521)),
-	VERTEX_PACK(floattov16(-1.50676),floattov16(0.789305)), VERTEX_PACK(floattov16(0.0556225),0),
-	NORMAL_PACK(floattov10(-0.3329),floattov10(-0.4039),floattov10(0.8521)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3329),floattov10(-0.4039),floattov10(0.8521)),
-	VERTEX_PACK(floattov16(-3.00973),floattov16(-1.14298)), VERTEX_PACK(floattov16(-1.4473),0),
-	NORMAL_PACK(floattov10(-0.6387),floattov10(-0.0707),floattov10(0.7662)),
-	VERTEX_PACK(floattov16(-1.5251),floattov16(0.883819)), VERTEX_PACK(floattov16(0.049055),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6387),floattov10(-0.0707),floattov10(0.7662)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	NORMAL_PACK(floattov10(-0.6387),floattov10(-0.0707),floattov10(0.7662)),
-	VERTEX_PACK(floattov16(-1.50676),floattov16(0.789305)), VERTEX_PACK(floattov16(0.0556225),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4966),floattov10(0.7658),floattov10(-0.4086)),
-	VERTEX_PACK(floattov16(-1.5251),floattov16(0.883819)), VERTEX_PACK(floattov16(0.049055),0),
-	NORMAL_PACK(floattov10(-0.4966),floattov10(0.7658),floattov10(-0.4086)),
-	VERTEX_PACK(floattov16(-3.16768),floattov16(-1.1417)), VERTEX_PACK(floattov16(-1.75072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4966),floattov10(0.7658),floattov10(-0.4086)),
-	VERTEX_PACK(floattov16(-3.28329),floattov16(-1.14187)), VERTEX_PACK(floattov16(-1.61056),0),
-	NORMAL_PACK(floattov10(0.4386),floattov10(-0.7622),floattov10(0.4762)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4386),floattov10(-0.7622),floattov10(0.4762)),
-	VERTEX_PACK(floattov16(-2.34614),floattov16(-1.14477)), VERTEX_PACK(floattov16(-1.34374),0),
-	NORMAL_PACK(floattov10(0.4386),floattov10(-0.7622),floattov10(0.4762)),
-	VERTEX_PACK(floattov16(-1.01916),floattov16(0.396426)), VERTEX_PACK(floattov16(-0.099168),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.489),floattov10(-0.7616),floattov10(0.4252)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	NORMAL_PACK(floattov10(0.489),floattov10(-0.7616),floattov10(0.4252)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.489),floattov10(-0.7616),floattov10(0.4252)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	NORMAL_PACK(floattov10(-0.3192),floattov10(-0.4911),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-0.723201),floattov16(-0.292118)), VERTEX_PACK(floattov16(0.67522),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3192),floattov10(-0.4911),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	NORMAL_PACK(floattov10(-0.3192),floattov10(-0.4911),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-1.45796),floattov16(-1.15047)), VERTEX_PACK(floattov16(-0.134203),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8224),floattov10(0.5107),floattov10(0.2507)),
-	VERTEX_PACK(floattov16(-1.03619),floattov16(0.16238)), VERTEX_PACK(floattov16(0.143073),0),
-	NORMAL_PACK(floattov10(-0.8224),floattov10(0.5107),floattov10(0.2507)),
-	VERTEX_PACK(floattov16(-2.11985),floattov16(-1.14712)), VERTEX_PACK(floattov16(-0.744343),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8224),floattov10(0.5107),floattov10(0.2507)),
-	VERTEX_PACK(floattov16(-1.09262),floattov16(0.034406)), VERTEX_PACK(floattov16(0.218651),0),
-	NORMAL_PACK(floattov10(-0.8211),floattov10(0.5288),floattov10(0.2149)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8211),floattov10(0.5288),floattov10(0.2149)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	NORMAL_PACK(floattov10(-0.8211),floattov10(0.5288),floattov10(0.2149)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(-0.586922),floattov16(-1.15119)), VERTEX_PACK(floattov16(-0.525208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(0.034348),floattov16(-0.52992)), VERTEX_PACK(floattov16(0.096061),0),
-	NORMAL_PACK(floattov10(0.7196),floattov10(-0.6939),floattov10(-0.0259)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7196),floattov10(-0.6939),floattov10(-0.0259)),
-	VERTEX_PACK(floattov16(-0.794423),floattov16(-1.15056)), VERTEX_PACK(floattov16(-0.580997),0),
-	NORMAL_PACK(floattov10(0.7196),floattov10(-0.6939),floattov10(-0.0259)),
-	VERTEX_PACK(floattov16(-0.797945),floattov16(-1.15022)), VERTEX_PACK(floattov16(-0.687963),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7696),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.0568895),floattov16(-0.413175)), VERTEX_PACK(floattov16(0.156194),0),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7696),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7696),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	NORMAL_PACK(floattov10(0.1192),floattov10(0.5633),floattov10(-0.8176)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1192),floattov10(0.5633),floattov10(-0.8176)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(0.1192),floattov10(0.5633),floattov10(-0.8176)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3515),floattov10(0.7551),floattov10(-0.5534)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(-0.3515),floattov10(0.7551),floattov10(-0.5534)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3515),floattov10(0.7551),floattov10(-0.5534)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	NORMAL_PACK(floattov10(0.7063),floattov10(-0.7003),floattov10(0.1034)),
-	VERTEX_PACK(floattov16(-0.569227),floattov16(1.11414)), VERTEX_PACK(floattov16(-0.787953),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7063),floattov10(-0.7003),floattov10(0.1034)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	NORMAL_PACK(floattov10(0.7063),floattov10(-0.7003),floattov10(0.1034)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5471),floattov10(0.1989),floattov10(-0.8131)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	NORMAL_PACK(floattov10(0.5471),floattov10(0.1989),floattov10(-0.8131)),
-	VERTEX_PACK(floattov16(-0.569227),floattov16(1.11414)), VERTEX_PACK(floattov16(-0.787953),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5471),floattov10(0.1989),floattov10(-0.8131)),
-	VERTEX_PACK(floattov16(-2.55606),floattov16(-1.1402)), VERTEX_PACK(floattov16(-2.67621),0),
-	NORMAL_PACK(floattov10(0.8209),floattov10(-0.5289),floattov10(-0.2155)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8209),floattov10(-0.5289),floattov10(-0.2155)),
-	VERTEX_PACK(floattov16(-0.721956),floattov16(0.696926)), VERTEX_PACK(floattov16(-0.567187),0),
-	NORMAL_PACK(floattov10(0.8209),floattov10(-0.5289),floattov10(-0.2155)),
-	VERTEX_PACK(floattov16(-2.29412),floattov16(-1.14274)), VERTEX_PACK(floattov16(-2.04077),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0473),floattov10(0.648),floattov10(-0.7602)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	NORMAL_PACK(floattov10(-0.0473),floattov10(0.648),floattov10(-0.7602)),
-	VERTEX_PACK(floattov16(-2.17535),floattov16(-1.14318)), VERTEX_PACK(floattov16(-1.98386),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0473),floattov10(0.648),floattov10(-0.7602)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	NORMAL_PACK(floattov10(0.8276),floattov10(-0.4636),floattov10(-0.3165)),
-	VERTEX_PACK(floattov16(-0.66),floattov16(0.204109)), VERTEX_PACK(floattov16(-0.349867),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8276),floattov10(-0.4636),floattov10(-0.3165)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	NORMAL_PACK(floattov10(0.8276),floattov10(-0.4636),floattov10(-0.3165)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8279),floattov10(0.3965),floattov10(0.3967)),
-	VERTEX_PACK(floattov16(-1.44038),floattov16(0.574934)), VERTEX_PACK(floattov16(0.205612),0),
-	NORMAL_PACK(floattov10(-0.8279),floattov10(0.3965),floattov10(0.3967)),
-	VERTEX_PACK(floattov16(-2.94494),floattov16(-1.14384)), VERTEX_PACK(floattov16(-1.21654),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8279),floattov10(0.3965),floattov10(0.3967)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	NORMAL_PACK(floattov10(-0.1985),floattov10(-0.5038),floattov10(0.8407)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1985),floattov10(-0.5038),floattov10(0.8407)),
-	VERTEX_PACK(floattov16(-2.29412),floattov16(-1.14274)), VERTEX_PACK(floattov16(-2.04077),0),
-	NORMAL_PACK(floattov10(-0.1985),floattov10(-0.5038),floattov10(0.8407)),
-	VERTEX_PACK(floattov16(-0.721956),floattov16(0.696926)), VERTEX_PACK(floattov16(-0.567187),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3153),floattov10(-0.7467),floattov10(0.5857)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	NORMAL_PACK(floattov10(0.3153),floattov10(-0.7467),floattov10(0.5857)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3153),floattov10(-0.7467),floattov10(0.5857)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	NORMAL_PACK(floattov10(0.3427),floattov10(0.3905),floattov10(-0.8544)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3427),floattov10(0.3905),floattov10(-0.8544)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	NORMAL_PACK(floattov10(0.3427),floattov10(0.3905),floattov10(-0.8544)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1956),floattov10(0.7212),floattov10(-0.6646)),
-	VERTEX_PACK(floattov16(-1.47462),floattov16(0.629416)), VERTEX_PACK(floattov16(0.221244),0),
-	NORMAL_PACK(floattov10(-0.1956),floattov10(0.7212),floattov10(-0.6646)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1956),floattov10(0.7212),floattov10(-0.6646)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	NORMAL_PACK(floattov10(-0.3046),floattov10(-0.4346),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-1.47462),floattov16(0.629416)), VERTEX_PACK(floattov16(0.221244),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3046),floattov10(-0.4346),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-2.94494),floattov16(-1.14384)), VERTEX_PACK(floattov16(-1.21654),0),
-	NORMAL_PACK(floattov10(-0.3046),floattov10(-0.4346),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-1.44038),floattov16(0.574934)), VERTEX_PACK(floattov16(0.205612),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4971),floattov10(0.2325),floattov10(-0.8359)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	NORMAL_PACK(floattov10(0.4971),floattov10(0.2325),floattov10(-0.8359)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4971),floattov10(0.2325),floattov10(-0.8359)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	NORMAL_PACK(floattov10(-0.4437),floattov10(-0.2877),floattov10(0.8487)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4437),floattov10(-0.2877),floattov10(0.8487)),
-	VERTEX_PACK(floattov16(-0.636176),floattov16(-1.14784)), VERTEX_PACK(floattov16(-1.57652),0),
-	NORMAL_PACK(floattov10(-0.4437),floattov10(-0.2877),floattov10(0.8487)),
-	VERTEX_PACK(floattov16(-0.634035),floattov16(-1.14785)), VERTEX_PACK(floattov16(-1.5754),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8282),floattov10(0.3858),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(-1.25579),floattov16(0.89053)), VERTEX_PACK(floattov16(-0.17346),0),
-	NORMAL_PACK(floattov10(-0.8282),floattov10(0.3858),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(-3.02056),floattov16(-1.14175)), VERTEX_PACK(floattov16(-1.83966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8282),floattov10(0.3858),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(-0.4741),floattov10(0.7667),floattov10(-0.4329)),
-	VERTEX_PACK(floattov16(-1.25579),floattov16(0.89053)), VERTEX_PACK(floattov16(-0.17346),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4741),floattov10(0.7667),floattov10(-0.4329)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	NORMAL_PACK(floattov10(-0.4741),floattov10(0.7667),floattov10(-0.4329)),
-	VERTEX_PACK(floattov16(-3.02056),floattov16(-1.14175)), VERTEX_PACK(floattov16(-1.83966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6399),floattov10(0.7368),floattov10(-0.2183)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(-0.6399),floattov10(0.7368),floattov10(-0.2183)),
-	VERTEX_PACK(floattov16(-2.92187),floattov16(-1.14149)), VERTEX_PACK(floattov16(-1.99573),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6399),floattov10(0.7368),floattov10(-0.2183)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	NORMAL_PACK(floattov10(0.8138),floattov10(-0.4638),floattov10(-0.3503)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8138),floattov10(-0.4638),floattov10(-0.3503)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	NORMAL_PACK(floattov10(0.8138),floattov10(-0.4638),floattov10(-0.3503)),
-	VERTEX_PACK(floattov16(-0.797945),floattov16(-1.15022)), VERTEX_PACK(floattov16(-0.687963),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8137),floattov10(-0.3193),floattov10(-0.4858)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.8137),floattov10(-0.3193),floattov10(-0.4858)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8137),floattov10(-0.3193),floattov10(-0.4858)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	NORMAL_PACK(floattov10(-0.8097),floattov10(0.2747),floattov10(0.5186)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8097),floattov10(0.2747),floattov10(0.5186)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	NORMAL_PACK(floattov10(-0.8097),floattov10(0.2747),floattov10(0.5186)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.0199),floattov10(0.725)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.0199),floattov10(0.725)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.0199),floattov10(0.725)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	NORMAL_PACK(floattov10(-0.7576),floattov10(0.1605),floattov10(0.6327)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7576),floattov10(0.1605),floattov10(0.6327)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	NORMAL_PACK(floattov10(-0.7576),floattov10(0.1605),floattov10(0.6327)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0667),floattov10(0.5594),floattov10(-0.8262)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	NORMAL_PACK(floattov10(0.0667),floattov10(0.5594),floattov10(-0.8262)),
-	VERTEX_PACK(floattov16(0.384223),floattov16(0.277504)), VERTEX_PACK(floattov16(-1.37888),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0667),floattov10(0.5594),floattov10(-0.8262)),
-	VERTEX_PACK(floattov16(-0.770671),floattov16(-1.14489)), VERTEX_PACK(floattov16(-2.43519),0),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-1.16212),floattov16(-1.15152)), VERTEX_PACK(floattov16(-0.004571),0),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.649611),floattov16(-0.485417)), VERTEX_PACK(floattov16(0.647081),0),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-1.16212),floattov16(-1.15152)), VERTEX_PACK(floattov16(-0.004571),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.564568),floattov16(-0.553965)), VERTEX_PACK(floattov16(0.592984),0),
-	NORMAL_PACK(floattov10(-0.5782),floattov10(0.7576),floattov10(-0.3028)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5782),floattov10(0.7576),floattov10(-0.3028)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	NORMAL_PACK(floattov10(-0.5782),floattov10(0.7576),floattov10(-0.3028)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7962),floattov10(0.2316),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	NORMAL_PACK(floattov10(-0.7962),floattov10(0.2316),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7962),floattov10(0.2316),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	NORMAL_PACK(floattov10(-0.8139),floattov10(0.5659),floattov10(0.1314)),
-	VERTEX_PACK(floattov16(0.191792),floattov16(0.42032)), VERTEX_PACK(floattov16(-1.25365),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8139),floattov10(0.5659),floattov10(0.1314)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	NORMAL_PACK(floattov10(-0.8139),floattov10(0.5659),floattov10(0.1314)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2912),floattov10(0.7209),floattov10(-0.6288)),
-	VERTEX_PACK(floattov16(0.191792),floattov16(0.42032)), VERTEX_PACK(floattov16(-1.25365),0),
-	NORMAL_PACK(floattov10(-0.2912),floattov10(0.7209),floattov10(-0.6288)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2912),floattov10(0.7209),floattov10(-0.6288)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	NORMAL_PACK(floattov10(-0.7979),floattov10(0.2446),floattov10(0.551)),
-	VERTEX_PACK(floattov16(-1.09262),floattov16(0.034406)), VERTEX_PACK(floattov16(0.218651),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7979),floattov10(0.2446),floattov10(0.551)),
-	VERTEX_PACK(floattov16(-2.11985),floattov16(-1.14712)), VERTEX_PACK(floattov16(-0.744343),0),
-	NORMAL_PACK(floattov10(-0.7979),floattov10(0.2446),floattov10(0.551)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7309),floattov10(0.086),floattov10(0.6771)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	NORMAL_PACK(floattov10(-0.7309),floattov10(0.086),floattov10(0.6771)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7309),floattov10(0.086),floattov10(0.6771)),
-	VERTEX_PACK(floattov16(-1.852),floattov16(-1.14879)), VERTEX_PACK(floattov16(-0.394469),0),
-	NORMAL_PACK(floattov10(-0.6978),floattov10(-0.018),floattov10(0.7161)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6978),floattov10(-0.018),floattov10(0.7161)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	NORMAL_PACK(floattov10(-0.6978),floattov10(-0.018),floattov10(0.7161)),
-	VERTEX_PACK(floattov16(-0.723201),floattov16(-0.292118)), VERTEX_PACK(floattov16(0.67522),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.4921),floattov10(-0.274)),
-	VERTEX_PACK(floattov16(-0.775005),floattov16(0.887465)), VERTEX_PACK(floattov16(-0.567251),0),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.4921),floattov10(-0.274)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.4921),floattov10(-0.274)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	NORMAL_PACK(floattov10(0.7047),floattov10(-0.03),floattov10(-0.7089)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7047),floattov10(-0.03),floattov10(-0.7089)),
-	VERTEX_PACK(floattov16(-2.53658),floattov16(-1.14162)), VERTEX_PACK(floattov16(-2.23025),0),
-	NORMAL_PACK(floattov10(0.7047),floattov10(-0.03),floattov10(-0.7089)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7433),floattov10(0.6673),floattov10(-0.0477)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	NORMAL_PACK(floattov10(-0.7433),floattov10(0.6673),floattov10(-0.0477)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7433),floattov10(0.6673),floattov10(-0.0477)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	NORMAL_PACK(floattov10(0.7857),floattov10(-0.5851),floattov10(-0.2009)),
-	VERTEX_PACK(floattov16(0.693223),floattov16(-0.366939)), VERTEX_PACK(floattov16(-0.607826),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7857),floattov10(-0.5851),floattov10(-0.2009)),
-	VERTEX_PACK(floattov16(0.693951),floattov16(-0.417064)), VERTEX_PACK(floattov16(-0.458995),0),
-	NORMAL_PACK(floattov10(0.7857),floattov10(-0.5851),floattov10(-0.2009)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5009),floattov10(-0.3081)),
-	VERTEX_PACK(floattov16(0.693951),floattov16(-0.417064)), VERTEX_PACK(floattov16(-0.458995),0),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5009),floattov10(-0.3081)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5009),floattov10(-0.3081)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	NORMAL_PACK(floattov10(0.6776),floattov10(-0.7334),floattov10(0.0556)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6776),floattov10(-0.7334),floattov10(0.0556)),
-	VERTEX_PACK(floattov16(0.014212),floattov16(-1.15154)), VERTEX_PACK(floattov16(-0.842237),0),
-	NORMAL_PACK(floattov10(0.6776),floattov10(-0.7334),floattov10(0.0556)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8156),floattov10(-0.5027),floattov10(-0.2864)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.8156),floattov10(-0.5027),floattov10(-0.2864)),
-	VERTEX_PACK(floattov16(0.693223),floattov16(-0.366939)), VERTEX_PACK(floattov16(-0.607826),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8156),floattov10(-0.5027),floattov10(-0.2864)),
-	VERTEX_PACK(floattov16(-0.0425975),floattov16(-1.14992)), VERTEX_PACK(floattov16(-1.32895),0),
-	NORMAL_PACK(floattov10(-0.5487),floattov10(-0.249),floattov10(0.7981)),
-	VERTEX_PACK(floattov16(0.0723625),floattov16(-0.446302)), VERTEX_PACK(floattov16(0.057719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5487),floattov10(-0.249),floattov10(0.7981)),
-	VERTEX_PACK(floattov16(-0.632202),floattov16(-1.15071)), VERTEX_PACK(floattov16(-0.646502),0),
-	NORMAL_PACK(floattov10(-0.5487),floattov10(-0.249),floattov10(0.7981)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8288),floattov10(0.4412),floattov10(0.3441)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	NORMAL_PACK(floattov10(-0.8288),floattov10(0.4412),floattov10(0.3441)),
-	VERTEX_PACK(floattov16(-1.61606),floattov16(-1.14678)), VERTEX_PACK(floattov16(-1.21609),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8288),floattov10(0.4412),floattov10(0.3441)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	NORMAL_PACK(floattov10(0.5692),floattov10(-0.7477),floattov10(0.3419)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5692),floattov10(-0.7477),floattov10(0.3419)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	NORMAL_PACK(floattov10(0.5692),floattov10(-0.7477),floattov10(0.3419)),
-	VERTEX_PACK(floattov16(-0.753787),floattov16(-1.14537)), VERTEX_PACK(floattov16(-2.2924),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3186),floattov10(0.75),floattov10(-0.5797)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	NORMAL_PACK(floattov10(-0.3186),floattov10(0.75),floattov10(-0.5797)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3186),floattov10(0.75),floattov10(-0.5797)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	NORMAL_PACK(floattov10(0.4485),floattov10(0.299),floattov10(-0.8423)),
-	VERTEX_PACK(floattov16(-0.664702),floattov16(0.845528)), VERTEX_PACK(floattov16(-0.648162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4485),floattov10(0.299),floattov10(-0.8423)),
-	VERTEX_PACK(floattov16(-2.32318),floattov16(-1.14207)), VERTEX_PACK(floattov16(-2.23685),0),
-	NORMAL_PACK(floattov10(0.4485),floattov10(0.299),floattov10(-0.8423)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.692),floattov10(-0.7082),floattov10(0.1396)),
-	VERTEX_PACK(floattov16(-0.643779),floattov16(0.804839)), VERTEX_PACK(floattov16(-0.656021),0),
-	NORMAL_PACK(floattov10(0.692),floattov10(-0.7082),floattov10(0.1396)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.692),floattov10(-0.7082),floattov10(0.1396)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	NORMAL_PACK(floattov10(0.8234),floattov10(-0.331),floattov10(-0.4609)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8234),floattov10(-0.331),floattov10(-0.4609)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	NORMAL_PACK(floattov10(0.8234),floattov10(-0.331),floattov10(-0.4609)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6445),floattov10(0.0485),floattov10(-0.7631)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	NORMAL_PACK(floattov10(0.6445),floattov10(0.0485),floattov10(-0.7631)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6445),floattov10(0.0485),floattov10(-0.7631)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	NORMAL_PACK(floattov10(0.726),floattov10(-0.0848),floattov10(-0.6825)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.726),floattov10(-0.0848),floattov10(-0.6825)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.726),floattov10(-0.0848),floattov10(-0.6825)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2456),floattov10(-0.4845),floattov10(0.8396)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	NORMAL_PACK(floattov10(-0.2456),floattov10(-0.4845),floattov10(0.8396)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2456),floattov10(-0.4845),floattov10(0.8396)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	NORMAL_PACK(floattov10(-0.4769),floattov10(0.7523),floattov10(-0.4546)),
-	VERTEX_PACK(floattov16(-0.597001),floattov16(0.493572)), VERTEX_PACK(floattov16(-0.623194),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4769),floattov10(0.7523),floattov10(-0.4546)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	NORMAL_PACK(floattov10(-0.4769),floattov10(0.7523),floattov10(-0.4546)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8259),floattov10(0.5176),floattov10(0.2236)),
-	VERTEX_PACK(floattov16(-0.533355),floattov16(0.583673)), VERTEX_PACK(floattov16(-0.696029),0),
-	NORMAL_PACK(floattov10(-0.8259),floattov10(0.5176),floattov10(0.2236)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8259),floattov10(0.5176),floattov10(0.2236)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	NORMAL_PACK(floattov10(-0.5965),floattov10(0.7431),floattov10(-0.3033)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5965),floattov10(0.7431),floattov10(-0.3033)),
-	VERTEX_PACK(floattov16(-1.99288),floattov16(-1.14336)), VERTEX_PACK(floattov16(-2.05698),0),
-	NORMAL_PACK(floattov10(-0.5965),floattov10(0.7431),floattov10(-0.3033)),
-	VERTEX_PACK(floattov16(-0.533355),floattov16(0.583673)), VERTEX_PACK(floattov16(-0.696029),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3597),floattov10(0.3668),floattov10(-0.8579)),
-	VERTEX_PACK(floattov16(0.0235875),floattov16(0.514356)), VERTEX_PACK(floattov16(-1.13715),0),
-	NORMAL_PACK(floattov10(0.3597),floattov10(0.3668),floattov10(-0.8579)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3597),floattov10(0.3668),floattov10(-0.8579)),
-	VERTEX_PACK(floattov16(-1.36686),floattov16(-1.14359)), VERTEX_PACK(floattov16(-2.42902),0),
-	NORMAL_PACK(floattov10(0.7437),floattov10(-0.1109),floattov10(-0.6593)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7437),floattov10(-0.1109),floattov10(-0.6593)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	NORMAL_PACK(floattov10(0.7437),floattov10(-0.1109),floattov10(-0.6593)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8076),floattov10(-0.276),floattov10(-0.5211)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	NORMAL_PACK(floattov10(0.8076),floattov10(-0.276),floattov10(-0.5211)),
-	VERTEX_PACK(floattov16(0.209937),floattov16(-0.149734)), VERTEX_PACK(floattov16(-0.796013),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8076),floattov10(-0.276),floattov10(-0.5211)),
-	VERTEX_PACK(floattov16(-0.634035),floattov16(-1.14785)), VERTEX_PACK(floattov16(-1.5754),0),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(0.077134),floattov16(-0.566504)), VERTEX_PACK(floattov16(0.069324),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(-0.280747),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.661058),0),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(0.284253),floattov16(-0.586448)), VERTEX_PACK(floattov16(-0.0960585),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(-0.19489),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.663669),0),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(0.337027),floattov16(-0.619712)), VERTEX_PACK(floattov16(-0.131751),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8033),floattov10(0.3321),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	NORMAL_PACK(floattov10(-0.8033),floattov10(0.3321),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.933674),floattov16(-1.14814)), VERTEX_PACK(floattov16(-1.2663),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8033),floattov10(0.3321),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(0.111474),floattov16(-0.0984235)), VERTEX_PACK(floattov16(-0.273264),0),
-	NORMAL_PACK(floattov10(-0.745),floattov10(0.1213),floattov10(0.6559)),
-	VERTEX_PACK(floattov16(0.111474),floattov16(-0.0984235)), VERTEX_PACK(floattov16(-0.273264),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.745),floattov10(0.1213),floattov10(0.6559)),
-	VERTEX_PACK(floattov16(-0.933674),floattov16(-1.14814)), VERTEX_PACK(floattov16(-1.2663),0),
-	NORMAL_PACK(floattov10(-0.745),floattov10(0.1213),floattov10(0.6559)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5586),floattov10(0.7903),floattov10(-0.2517)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	NORMAL_PACK(floattov10(-0.5586),floattov10(0.7903),floattov10(-0.2517)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5586),floattov10(0.7903),floattov10(-0.2517)),
-	VERTEX_PACK(floattov16(-0.727002),floattov16(-1.14947)), VERTEX_PACK(floattov16(-0.983398),0),
-	NORMAL_PACK(floattov10(-0.7867),floattov10(0.2044),floattov10(0.5825)),
-	VERTEX_PACK(floattov16(0.097495),floattov16(-0.320404)), VERTEX_PACK(floattov16(-0.211011),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7867),floattov10(0.2044),floattov10(0.5825)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	NORMAL_PACK(floattov10(-0.7867),floattov10(0.2044),floattov10(0.5825)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(-0.632202),floattov16(-1.15071)), VERTEX_PACK(floattov16(-0.646502),0),
-	NORMAL_PACK(floattov10(-0.6884),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(0.0723625),floattov16(-0.446302)), VERTEX_PACK(floattov16(0.057719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8113),floattov10(0.2835),floattov10(0.5113)),
-	VERTEX_PACK(floattov16(-0.619591),floattov16(0.200683)), VERTEX_PACK(floattov16(-0.382239),0),
-	NORMAL_PACK(floattov10(-0.8113),floattov10(0.2835),floattov10(0.5113)),
-	VERTEX_PACK(floattov16(-1.75188),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.43211),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8113),floattov10(0.2835),floattov10(0.5113)),
-	VERTEX_PACK(floattov16(-1.61606),floattov16(-1.14678)), VERTEX_PACK(floattov16(-1.21609),0),
-	NORMAL_PACK(floattov10(-0.8309),floattov10(0.4819),floattov10(0.2781)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8309),floattov10(0.4819),floattov10(0.2781)),
-	VERTEX_PACK(floattov16(-1.75188),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.43211),0),
-	NORMAL_PACK(floattov10(-0.8309),floattov10(0.4819),floattov10(0.2781)),
-	VERTEX_PACK(floattov16(-0.619591),floattov16(0.200683)), VERTEX_PACK(floattov16(-0.382239),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8312),floattov10(0.3811),floattov10(0.4049)),
-	VERTEX_PACK(floattov16(-0.597001),floattov16(0.493572)), VERTEX_PACK(floattov16(-0.623194),0),
-	NORMAL_PACK(floattov10(-0.8312),floattov10(0.3811),floattov10(0.4049)),
-	VERTEX_PACK(floattov16(-1.96698),floattov16(-1.14391)), VERTEX_PACK(floattov16(-1.8946),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8312),floattov10(0.3811),floattov10(0.4049)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-0.666475),floattov16(-0.411121)), VERTEX_PACK(floattov16(0.643921),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-0.649611),floattov16(-0.485417)), VERTEX_PACK(floattov16(0.647081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7278),floattov10(0.6845),floattov10(0.0433)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(-0.7278),floattov10(0.6845),floattov10(0.0433)),
-	VERTEX_PACK(floattov16(-1.40605),floattov16(-1.1507)), VERTEX_PACK(floattov16(-0.0956575),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7278),floattov10(0.6845),floattov10(0.0433)),
-	VERTEX_PACK(floattov16(-0.666475),floattov16(-0.411121)), VERTEX_PACK(floattov16(0.643921),0),
-	NORMAL_PACK(floattov10(0.2874),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-0.672782),floattov16(-0.365445)), VERTEX_PACK(floattov16(0.650626),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2874),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	NORMAL_PACK(floattov10(0.2874),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1368),floattov10(-0.6796),floattov10(0.7207)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	NORMAL_PACK(floattov10(0.1368),floattov10(-0.6796),floattov10(0.7207)),
-	VERTEX_PACK(floattov16(-0.753787),floattov16(-1.14537)), VERTEX_PACK(floattov16(-2.2924),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1368),floattov10(-0.6796),floattov10(0.7207)),
-	VERTEX_PACK(floattov16(-0.691228),floattov16(-1.14547)), VERTEX_PACK(floattov16(-2.30438),0),
-	NORMAL_PACK(floattov10(0.4805),floattov10(0.2512),floattov10(-0.8403)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4805),floattov10(0.2512),floattov10(-0.8403)),
-	VERTEX_PACK(floattov16(0.441986),floattov16(0.20195)), VERTEX_PACK(floattov16(-1.25357),0),
-	NORMAL_PACK(floattov10(0.4805),floattov10(0.2512),floattov10(-0.8403)),
-	VERTEX_PACK(floattov16(-0.691228),floattov16(-1.14547)), VERTEX_PACK(floattov16(-2.30438),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.77),floattov10(-0.6378),floattov10(0.0171)),
-	VERTEX_PACK(floattov16(0.384223),floattov16(0.277504)), VERTEX_PACK(floattov16(-1.37888),0),
-	NORMAL_PACK(floattov10(0.77),floattov10(-0.6378),floattov10(0.0171)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.77),floattov10(-0.6378),floattov10(0.0171)),
-	VERTEX_PACK(floattov16(-0.770671),floattov16(-1.14489)), VERTEX_PACK(floattov16(-2.43519),0),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1652),floattov10(-0.6098),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	NORMAL_PACK(floattov10(-0.1652),floattov10(-0.6098),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1652),floattov10(-0.6098),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.746396),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.268887),0),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.186304),floattov16(-0.591533)), VERTEX_PACK(floattov16(0.291206),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.130216),floattov16(-0.548295)), VERTEX_PACK(floattov16(0.235293),0),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.186304),floattov16(-0.591533)), VERTEX_PACK(floattov16(0.291206),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.746396),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.268887),0),
-	NORMAL_PACK(floattov10(0.8162),floattov10(-0.3931),floattov10(-0.4234)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8162),floattov10(-0.3931),floattov10(-0.4234)),
-	VERTEX_PACK(floattov16(-0.733271),floattov16(-1.15135)), VERTEX_PACK(floattov16(-0.367761),0),
-	NORMAL_PACK(floattov10(0.8162),floattov10(-0.3931),floattov10(-0.4234)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8202),floattov10(-0.3338),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	NORMAL_PACK(floattov10(0.8202),floattov10(-0.3338),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8202),floattov10(-0.3338),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	NORMAL_PACK(floattov10(0.5278),floattov10(0.2092),floattov10(-0.8232)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5278),floattov10(0.2092),floattov10(-0.8232)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	NORMAL_PACK(floattov10(0.5278),floattov10(0.2092),floattov10(-0.8232)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7004),floattov10(0.7026),floattov10(-0.1256)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(-0.7004),floattov10(0.7026),floattov10(-0.1256)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7004),floattov10(0.7026),floattov10(-0.1256)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	NORMAL_PACK(floattov10(-0.0324),floattov10(0.6311),floattov10(-0.775)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0324),floattov10(0.6311),floattov10(-0.775)),
-	VERTEX_PACK(floattov16(0.0235875),floattov16(0.514356)), VERTEX_PACK(floattov16(-1.13715),0),
-	NORMAL_PACK(floattov10(-0.0324),floattov10(0.6311),floattov10(-0.775)),
-	VERTEX_PACK(floattov16(-1.36686),floattov16(-1.14359)), VERTEX_PACK(floattov16(-2.42902),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6536),floattov10(0.0421),floattov10(-0.7557)),
-	VERTEX_PACK(floattov16(-0.032187),floattov16(0.587946)), VERTEX_PACK(floattov16(-1.10822),0),
-	NORMAL_PACK(floattov10(0.6536),floattov10(0.0421),floattov10(-0.7557)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6536),floattov10(0.0421),floattov10(-0.7557)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	NORMAL_PACK(floattov10(-0.0912),floattov10(0.6662),floattov10(-0.7402)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0912),floattov10(0.6662),floattov10(-0.7402)),
-	VERTEX_PACK(floattov16(-1.4958),floattov16(-1.14317)), VERTEX_PACK(floattov16(-2.47326),0),
-	NORMAL_PACK(floattov10(-0.0912),floattov10(0.6662),floattov10(-0.7402)),
-	VERTEX_PACK(floattov16(-1.66507),floattov16(-1.14286)), VERTEX_PACK(floattov16(-2.45214),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6679),floattov10(0.0229),floattov10(-0.7439)),
-	VERTEX_PACK(floattov16(-0.678464),floattov16(0.621215)), VERTEX_PACK(floattov16(-0.585553),0),
-	NORMAL_PACK(floattov10(0.6679),floattov10(0.0229),floattov10(-0.7439)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6679),floattov10(0.0229),floattov10(-0.7439)),
-	VERTEX_PACK(floattov16(-2.17535),floattov16(-1.14318)), VERTEX_PACK(floattov16(-1.98386),0),
-	NORMAL_PACK(floattov10(0.8323),floattov10(-0.3989),floattov10(-0.385)),
-	VERTEX_PACK(floattov16(-0.663798),floattov16(0.544982)), VERTEX_PACK(floattov16(-0.580146),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8323),floattov10(-0.3989),floattov10(-0.385)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	NORMAL_PACK(floattov10(0.8323),floattov10(-0.3989),floattov10(-0.385)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7806),floattov10(-0.1929),floattov10(-0.5945)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	NORMAL_PACK(floattov10(0.7806),floattov10(-0.1929),floattov10(-0.5945)),
-	VERTEX_PACK(floattov16(-0.66),floattov16(0.204109)), VERTEX_PACK(floattov16(-0.349867),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7806),floattov10(-0.1929),floattov10(-0.5945)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	NORMAL_PACK(floattov10(0.2876),floattov10(-0.7489),floattov10(0.597)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2876),floattov10(-0.7489),floattov10(0.597)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	NORMAL_PACK(floattov10(0.2876),floattov10(-0.7489),floattov10(0.597)),
-	VERTEX_PACK(floattov16(-1.10971),floattov16(0.614443)), VERTEX_PACK(floattov16(-0.074743),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6947),floattov10(-0.7093),floattov10(0.1193)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.6947),floattov10(-0.7093),floattov10(0.1193)),
-	VERTEX_PACK(floattov16(-1.10971),floattov16(0.614443)), VERTEX_PACK(floattov16(-0.074743),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6947),floattov10(-0.7093),floattov10(0.1193)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	NORMAL_PACK(floattov10(0.4121),floattov10(0.3413),floattov10(-0.8448)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4121),floattov10(0.3413),floattov10(-0.8448)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	NORMAL_PACK(floattov10(0.4121),floattov10(0.3413),floattov10(-0.8448)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8019),floattov10(-0.2533),floattov10(-0.5411)),
-	VERTEX_PACK(floattov16(-0.89865),floattov16(1.16035)), VERTEX_PACK(floattov16(-0.528226),0),
-	NORMAL_PACK(floattov10(0.8019),floattov10(-0.2533),floattov10(-0.5411)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8019),floattov10(-0.2533),floattov10(-0.5411)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	NORMAL_PACK(floattov10(-0.2015),floattov10(0.7231),floattov10(-0.6607)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2015),floattov10(0.7231),floattov10(-0.6607)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	NORMAL_PACK(floattov10(-0.2015),floattov10(0.7231),floattov10(-0.6607)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-0.995746),floattov16(-1.1516)), VERTEX_PACK(floattov16(-0.0983895),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-0.419017),floattov16(-0.574871)), VERTEX_PACK(floattov16(0.478339),0),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-0.397491),floattov16(-0.544982)), VERTEX_PACK(floattov16(0.453839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-0.419017),floattov16(-0.574871)), VERTEX_PACK(floattov16(0.478339),0),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-0.995746),floattov16(-1.1516)), VERTEX_PACK(floattov16(-0.0983895),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6237),floattov10(0.1443),floattov10(-0.7683)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	NORMAL_PACK(floattov10(0.6237),floattov10(0.1443),floattov10(-0.7683)),
-	VERTEX_PACK(floattov16(-1.00392),floattov16(-1.15141)), VERTEX_PACK(floattov16(-0.152593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6237),floattov10(0.1443),floattov10(-0.7683)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	NORMAL_PACK(floattov10(-0.6965),floattov10(0.704),floattov10(-0.1388)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6965),floattov10(0.704),floattov10(-0.1388)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	NORMAL_PACK(floattov10(-0.6965),floattov10(0.704),floattov10(-0.1388)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7036),floattov10(0.7036),floattov10(-0.0998)),
-	VERTEX_PACK(floattov16(-0.89865),floattov16(1.16035)), VERTEX_PACK(floattov16(-0.528226),0),
-	NORMAL_PACK(floattov10(-0.7036),floattov10(0.7036),floattov10(-0.0998)),
-	VERTEX_PACK(floattov16(-2.94015),floattov16(-1.14034)), VERTEX_PACK(floattov16(-2.3548),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7036),floattov10(0.7036),floattov10(-0.0998)),
-	VERTEX_PACK(floattov16(-0.956352),floattov16(1.11096)), VERTEX_PACK(floattov16(-0.469582),0),
-	NORMAL_PACK(floattov10(-0.8272),floattov10(0.3907),floattov10(0.4038)),
-	VERTEX_PACK(floattov16(-0.956352),floattov16(1.11096)), VERTEX_PACK(floattov16(-0.469582),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8272),floattov10(0.3907),floattov10(0.4038)),
-	VERTEX_PACK(floattov16(-2.94015),floattov16(-1.14034)), VERTEX_PACK(floattov16(-2.3548),0),
-	NORMAL_PACK(floattov10(-0.8272),floattov10(0.3907),floattov10(0.4038)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.499),floattov10(0.7668),floattov10(-0.4038)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(-0.499),floattov10(0.7668),floattov10(-0.4038)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.499),floattov10(0.7668),floattov10(-0.4038)),
-	VERTEX_PACK(floattov16(-2.92187),floattov16(-1.14149)), VERTEX_PACK(floattov16(-1.99573),0),
-	NORMAL_PACK(floattov10(-0.4408),floattov10(-0.2915),floattov10(0.849)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4408),floattov10(-0.2915),floattov10(0.849)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	NORMAL_PACK(floattov10(-0.4408),floattov10(-0.2915),floattov10(0.849)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2033),floattov10(-0.7028),floattov10(0.6817)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	NORMAL_PACK(floattov10(0.2033),floattov10(-0.7028),floattov10(0.6817)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2033),floattov10(-0.7028),floattov10(0.6817)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	NORMAL_PACK(floattov10(0.8314),floattov10(-0.3887),floattov10(-0.3971)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8314),floattov10(-0.3887),floattov10(-0.3971)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.8314),floattov10(-0.3887),floattov10(-0.3971)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7974),floattov10(0.595),floattov10(0.1007)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(-0.7974),floattov10(0.595),floattov10(0.1007)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7974),floattov10(0.595),floattov10(0.1007)),
-	VERTEX_PACK(floattov16(-1.08266),floattov16(0.591237)), VERTEX_PACK(floattov16(-0.247041),0),
-	NORMAL_PACK(floattov10(-0.6736),floattov10(0.7156),floattov10(-0.1849)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6736),floattov10(0.7156),floattov10(-0.1849)),
-	VERTEX_PACK(floattov16(-1.08266),floattov16(0.591237)), VERTEX_PACK(floattov16(-0.247041),0),
-	NORMAL_PACK(floattov10(-0.6736),floattov10(0.7156),floattov10(-0.1849)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.735),floattov10(0.6768),floattov10(-0.0402)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	NORMAL_PACK(floattov10(-0.735),floattov10(0.6768),floattov10(-0.0402)),
-	VERTEX_PACK(floattov16(-2.6645),floattov16(-1.14373)), VERTEX_PACK(floattov16(-1.45249),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.735),floattov10(0.6768),floattov10(-0.0402)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	NORMAL_PACK(floattov10(-0.7582),floattov10(0.1386),floattov10(0.6371)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7582),floattov10(0.1386),floattov10(0.6371)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	NORMAL_PACK(floattov10(-0.7582),floattov10(0.1386),floattov10(0.6371)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4833),floattov10(-0.7659),floattov10(0.424)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	NORMAL_PACK(floattov10(0.4833),floattov10(-0.7659),floattov10(0.424)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4833),floattov10(-0.7659),floattov10(0.424)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	NORMAL_PACK(floattov10(0.8133),floattov10(-0.2957),floattov10(-0.501)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8133),floattov10(-0.2957),floattov10(-0.501)),
-	VERTEX_PACK(floattov16(-1.01916),floattov16(0.396426)), VERTEX_PACK(floattov16(-0.099168),0),
-	NORMAL_PACK(floattov10(0.8133),floattov10(-0.2957),floattov10(-0.501)),
-	VERTEX_PACK(floattov16(-2.34614),floattov16(-1.14477)), VERTEX_PACK(floattov16(-1.34374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5984),floattov10(0.1815),floattov10(-0.7803)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(0.5984),floattov10(0.1815),floattov10(-0.7803)),
-	VERTEX_PACK(floattov16(-0.19489),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.663669),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5984),floattov10(0.1815),floattov10(-0.7803)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	NORMAL_PACK(floattov10(-0.5134),floattov10(0.7588),floattov10(-0.4007)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5134),floattov10(0.7588),floattov10(-0.4007)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	NORMAL_PACK(floattov10(-0.5134),floattov10(0.7588),floattov10(-0.4007)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3458),floattov10(0.7481),floattov10(-0.5663)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	NORMAL_PACK(floattov10(-0.3458),floattov10(0.7481),floattov10(-0.5663)),
-	VERTEX_PACK(floattov16(-1.70146),floattov16(-1.14273)), VERTEX_PACK(floattov16(-2.47016),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3458),floattov10(0.7481),floattov10(-0.5663)),
-	VERTEX_PACK(floattov16(-1.85986),floattov16(-1.14267)), VERTEX_PACK(floattov16(-2.37337),0),
-	NORMAL_PACK(floattov10(0.7747),floattov10(-0.6309),floattov10(-0.0425)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7747),floattov10(-0.6309),floattov10(-0.0425)),
-	VERTEX_PACK(floattov16(-2.57236),floattov16(-1.14522)), VERTEX_PACK(floattov16(-1.03513),0),
-	NORMAL_PACK(floattov10(0.7747),floattov10(-0.6309),floattov10(-0.0425)),
-	VERTEX_PACK(floattov16(-2.57567),floattov16(-1.14502)), VERTEX_PACK(floattov16(-1.09837),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0459),floattov10(-0.6829),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(-0.0459),floattov10(-0.6829),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(-0.343301),floattov16(-1.15095)), VERTEX_PACK(floattov16(-0.77733),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0459),floattov10(-0.6829),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(-0.136797),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.764788),0),
-	NORMAL_PACK(floattov10(0.101),floattov10(-0.6769),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.101),floattov10(-0.6769),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(-2.78911),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.00474),0),
-	NORMAL_PACK(floattov10(0.101),floattov10(-0.6769),floattov10(0.7291)),
-	VERTEX_PACK(floattov16(-2.57236),floattov16(-1.14522)), VERTEX_PACK(floattov16(-1.03513),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.622),floattov10(-0.0953),floattov10(0.7772)),
-	VERTEX_PACK(floattov16(-1.46877),floattov16(0.478679)), VERTEX_PACK(floattov16(0.250927),0),
-	NORMAL_PACK(floattov10(-0.622),floattov10(-0.0953),floattov10(0.7772)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.622),floattov10(-0.0953),floattov10(0.7772)),
-	VERTEX_PACK(floattov16(-2.78911),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.00474),0),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(0.014212),floattov16(-1.15154)), VERTEX_PACK(floattov16(-0.842237),0),
-	NORMAL_PACK(floattov10(0.2718),floattov10(-0.8027),floattov10(0.5309)),
-	VERTEX_PACK(floattov16(0.549534),floattov16(-0.616221)), VERTEX_PACK(floattov16(-0.306915),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2539),floattov10(-0.463),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-1.50676),floattov16(0.789305)), VERTEX_PACK(floattov16(0.0556225),0),
-	NORMAL_PACK(floattov10(-0.2539),floattov10(-0.463),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-3.00973),floattov16(-1.14298)), VERTEX_PACK(floattov16(-1.4473),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2539),floattov10(-0.463),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	NORMAL_PACK(floattov10(-0.6667),floattov10(-0.0314),floattov10(0.7447)),
-	VERTEX_PACK(floattov16(-1.5251),floattov16(0.883819)), VERTEX_PACK(floattov16(0.049055),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6667),floattov10(-0.0314),floattov10(0.7447)),
-	VERTEX_PACK(floattov16(-3.28329),floattov16(-1.14187)), VERTEX_PACK(floattov16(-1.61056),0),
-	NORMAL_PACK(floattov10(-0.6667),floattov10(-0.0314),floattov10(0.7447)),
-	VERTEX_PACK(floattov16(-3.17099),floattov16(-1.14243)), VERTEX_PACK(floattov16(-1.51003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4847),floattov10(0.7669),floattov10(-0.4207)),
-	VERTEX_PACK(floattov16(-1.5251),floattov16(0.883819)), VERTEX_PACK(floattov16(0.049055),0),
-	NORMAL_PACK(floattov10(-0.4847),floattov10(0.7669),floattov10(-0.4207)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4847),floattov10(0.7669),floattov10(-0.4207)),
-	VERTEX_PACK(floattov16(-3.16768),floattov16(-1.1417)), VERTEX_PACK(floattov16(-1.75072),0),
-	NORMAL_PACK(floattov10(0.4433),floattov10(-0.7622),floattov10(0.4718)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4433),floattov10(-0.7622),floattov10(0.4718)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	NORMAL_PACK(floattov10(0.4433),floattov10(-0.7622),floattov10(0.4718)),
-	VERTEX_PACK(floattov16(-2.34614),floattov16(-1.14477)), VERTEX_PACK(floattov16(-1.34374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4774),floattov10(-0.7628),floattov10(0.4361)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	NORMAL_PACK(floattov10(0.4774),floattov10(-0.7628),floattov10(0.4361)),
-	VERTEX_PACK(floattov16(-2.43226),floattov16(-1.14483)), VERTEX_PACK(floattov16(-1.26293),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4774),floattov10(-0.7628),floattov10(0.4361)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	NORMAL_PACK(floattov10(-0.319),floattov10(-0.4912),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-0.723201),floattov16(-0.292118)), VERTEX_PACK(floattov16(0.67522),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.319),floattov10(-0.4912),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-1.45796),floattov16(-1.15047)), VERTEX_PACK(floattov16(-0.134203),0),
-	NORMAL_PACK(floattov10(-0.319),floattov10(-0.4912),floattov10(0.8105)),
-	VERTEX_PACK(floattov16(-0.672782),floattov16(-0.365445)), VERTEX_PACK(floattov16(0.650626),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8245),floattov10(0.4861),floattov10(0.2896)),
-	VERTEX_PACK(floattov16(-1.03619),floattov16(0.16238)), VERTEX_PACK(floattov16(0.143073),0),
-	NORMAL_PACK(floattov10(-0.8245),floattov10(0.4861),floattov10(0.2896)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8245),floattov10(0.4861),floattov10(0.2896)),
-	VERTEX_PACK(floattov16(-2.11985),floattov16(-1.14712)), VERTEX_PACK(floattov16(-0.744343),0),
-	NORMAL_PACK(floattov10(-0.8243),floattov10(0.4879),floattov10(0.2872)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8243),floattov10(0.4879),floattov10(0.2872)),
-	VERTEX_PACK(floattov16(-2.19061),floattov16(-1.14634)), VERTEX_PACK(floattov16(-0.947112),0),
-	NORMAL_PACK(floattov10(-0.8243),floattov10(0.4879),floattov10(0.2872)),
-	VERTEX_PACK(floattov16(-1.03619),floattov16(0.16238)), VERTEX_PACK(floattov16(0.143073),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6287),floattov10(0.7655),floattov10(-0.1368)),
-	VERTEX_PACK(floattov16(-0.586922),floattov16(-1.15119)), VERTEX_PACK(floattov16(-0.525208),0),
-	NORMAL_PACK(floattov10(0.7197),floattov10(-0.6938),floattov10(-0.026)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7197),floattov10(-0.6938),floattov10(-0.026)),
-	VERTEX_PACK(floattov16(-0.0568895),floattov16(-0.413175)), VERTEX_PACK(floattov16(0.156194),0),
-	NORMAL_PACK(floattov10(0.7197),floattov10(-0.6938),floattov10(-0.026)),
-	VERTEX_PACK(floattov16(-0.794423),floattov16(-1.15056)), VERTEX_PACK(floattov16(-0.580997),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7697),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.0568895),floattov16(-0.413175)), VERTEX_PACK(floattov16(0.156194),0),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7697),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.810085),floattov16(-1.15072)), VERTEX_PACK(floattov16(-0.516423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6209),floattov10(-0.7697),floattov10(0.1486)),
-	VERTEX_PACK(floattov16(-0.794423),floattov16(-1.15056)), VERTEX_PACK(floattov16(-0.580997),0),
-	NORMAL_PACK(floattov10(0.1918),floattov10(0.5179),floattov10(-0.8337)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1918),floattov10(0.5179),floattov10(-0.8337)),
-	VERTEX_PACK(floattov16(-3.03696),floattov16(-1.14208)), VERTEX_PACK(floattov16(-1.72088),0),
-	NORMAL_PACK(floattov10(0.1918),floattov10(0.5179),floattov10(-0.8337)),
-	VERTEX_PACK(floattov16(-3.16768),floattov16(-1.1417)), VERTEX_PACK(floattov16(-1.75072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3603),floattov10(0.7564),floattov10(-0.546)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(-0.3603),floattov10(0.7564),floattov10(-0.546)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3603),floattov10(0.7564),floattov10(-0.546)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	NORMAL_PACK(floattov10(0.7257),floattov10(-0.6858),floattov10(0.0551)),
-	VERTEX_PACK(floattov16(-0.569227),floattov16(1.11414)), VERTEX_PACK(floattov16(-0.787953),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7257),floattov10(-0.6858),floattov10(0.0551)),
-	VERTEX_PACK(floattov16(-2.58719),floattov16(-1.14135)), VERTEX_PACK(floattov16(-2.28057),0),
-	NORMAL_PACK(floattov10(0.7257),floattov10(-0.6858),floattov10(0.0551)),
-	VERTEX_PACK(floattov16(-2.55606),floattov16(-1.1402)), VERTEX_PACK(floattov16(-2.67621),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5855),floattov10(0.1516),floattov10(-0.7964)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	NORMAL_PACK(floattov10(0.5855),floattov10(0.1516),floattov10(-0.7964)),
-	VERTEX_PACK(floattov16(-2.55606),floattov16(-1.1402)), VERTEX_PACK(floattov16(-2.67621),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5855),floattov10(0.1516),floattov10(-0.7964)),
-	VERTEX_PACK(floattov16(-2.58602),floattov16(-1.14006)), VERTEX_PACK(floattov16(-2.69821),0),
-	NORMAL_PACK(floattov10(0.8264),floattov10(-0.4973),floattov10(-0.2641)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8264),floattov10(-0.4973),floattov10(-0.2641)),
-	VERTEX_PACK(floattov16(-2.29412),floattov16(-1.14274)), VERTEX_PACK(floattov16(-2.04077),0),
-	NORMAL_PACK(floattov10(0.8264),floattov10(-0.4973),floattov10(-0.2641)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1076),floattov10(0.672),floattov10(-0.7327)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	NORMAL_PACK(floattov10(-0.1076),floattov10(0.672),floattov10(-0.7327)),
-	VERTEX_PACK(floattov16(-0.678464),floattov16(0.621215)), VERTEX_PACK(floattov16(-0.585553),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1076),floattov10(0.672),floattov10(-0.7327)),
-	VERTEX_PACK(floattov16(-2.17535),floattov16(-1.14318)), VERTEX_PACK(floattov16(-1.98386),0),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.5118),floattov10(-0.2351)),
-	VERTEX_PACK(floattov16(-0.66),floattov16(0.204109)), VERTEX_PACK(floattov16(-0.349867),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.5118),floattov10(-0.2351)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	NORMAL_PACK(floattov10(0.8263),floattov10(-0.5118),floattov10(-0.2351)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8298),floattov10(0.4185),floattov10(0.3692)),
-	VERTEX_PACK(floattov16(-1.44038),floattov16(0.574934)), VERTEX_PACK(floattov16(0.205612),0),
-	NORMAL_PACK(floattov10(-0.8298),floattov10(0.4185),floattov10(0.3692)),
-	VERTEX_PACK(floattov16(-2.87766),floattov16(-1.14442)), VERTEX_PACK(floattov16(-1.07555),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8298),floattov10(0.4185),floattov10(0.3692)),
-	VERTEX_PACK(floattov16(-1.46877),floattov16(0.478679)), VERTEX_PACK(floattov16(0.250927),0),
-	NORMAL_PACK(floattov10(-0.2785),floattov10(-0.4487),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2785),floattov10(-0.4487),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	NORMAL_PACK(floattov10(-0.2785),floattov10(-0.4487),floattov10(0.8492)),
-	VERTEX_PACK(floattov16(-2.29412),floattov16(-1.14274)), VERTEX_PACK(floattov16(-2.04077),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2977),floattov10(-0.7432),floattov10(0.5992)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	NORMAL_PACK(floattov10(0.2977),floattov10(-0.7432),floattov10(0.5992)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2977),floattov10(-0.7432),floattov10(0.5992)),
-	VERTEX_PACK(floattov16(-2.46727),floattov16(-1.14218)), VERTEX_PACK(floattov16(-2.09726),0),
-	NORMAL_PACK(floattov10(0.4165),floattov10(0.3288),floattov10(-0.8476)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4165),floattov10(0.3288),floattov10(-0.8476)),
-	VERTEX_PACK(floattov16(-2.33784),floattov16(-1.14285)), VERTEX_PACK(floattov16(-1.97347),0),
-	NORMAL_PACK(floattov10(0.4165),floattov10(0.3288),floattov10(-0.8476)),
-	VERTEX_PACK(floattov16(-2.52838),floattov16(-1.14214)), VERTEX_PACK(floattov16(-2.06684),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1607),floattov10(0.7112),floattov10(-0.6844)),
-	VERTEX_PACK(floattov16(-1.47462),floattov16(0.629416)), VERTEX_PACK(floattov16(0.221244),0),
-	NORMAL_PACK(floattov10(-0.1607),floattov10(0.7112),floattov10(-0.6844)),
-	VERTEX_PACK(floattov16(-2.84658),floattov16(-1.1438)), VERTEX_PACK(floattov16(-1.29922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1607),floattov10(0.7112),floattov10(-0.6844)),
-	VERTEX_PACK(floattov16(-3.03335),floattov16(-1.14352)), VERTEX_PACK(floattov16(-1.25507),0),
-	NORMAL_PACK(floattov10(-0.3708),floattov10(-0.3798),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-1.47462),floattov16(0.629416)), VERTEX_PACK(floattov16(0.221244),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3708),floattov10(-0.3798),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-3.03335),floattov16(-1.14352)), VERTEX_PACK(floattov16(-1.25507),0),
-	NORMAL_PACK(floattov10(-0.3708),floattov10(-0.3798),floattov10(0.8475)),
-	VERTEX_PACK(floattov16(-2.94494),floattov16(-1.14384)), VERTEX_PACK(floattov16(-1.21654),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.601),floattov10(0.1398),floattov10(-0.7869)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	NORMAL_PACK(floattov10(0.601),floattov10(0.1398),floattov10(-0.7869)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.601),floattov10(0.1398),floattov10(-0.7869)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	NORMAL_PACK(floattov10(-0.3626),floattov10(-0.3636),floattov10(0.8581)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3626),floattov10(-0.3636),floattov10(0.8581)),
-	VERTEX_PACK(floattov16(-0.634035),floattov16(-1.14785)), VERTEX_PACK(floattov16(-1.5754),0),
-	NORMAL_PACK(floattov10(-0.3626),floattov10(-0.3636),floattov10(0.8581)),
-	VERTEX_PACK(floattov16(0.209937),floattov16(-0.149734)), VERTEX_PACK(floattov16(-0.796013),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8301),floattov10(0.4091),floattov10(0.3788)),
-	VERTEX_PACK(floattov16(-1.25579),floattov16(0.89053)), VERTEX_PACK(floattov16(-0.17346),0),
-	NORMAL_PACK(floattov10(-0.8301),floattov10(0.4091),floattov10(0.3788)),
-	VERTEX_PACK(floattov16(-2.98014),floattov16(-1.14209)), VERTEX_PACK(floattov16(-1.757),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8301),floattov10(0.4091),floattov10(0.3788)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	NORMAL_PACK(floattov10(-0.4653),floattov10(0.767),floattov10(-0.4419)),
-	VERTEX_PACK(floattov16(-1.25579),floattov16(0.89053)), VERTEX_PACK(floattov16(-0.17346),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4653),floattov10(0.767),floattov10(-0.4419)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	NORMAL_PACK(floattov10(-0.4653),floattov10(0.767),floattov10(-0.4419)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6167),floattov10(0.7449),floattov10(-0.2546)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(-0.6167),floattov10(0.7449),floattov10(-0.2546)),
-	VERTEX_PACK(floattov16(-2.94842),floattov16(-1.14167)), VERTEX_PACK(floattov16(-1.91852),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6167),floattov10(0.7449),floattov10(-0.2546)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	NORMAL_PACK(floattov10(0.8148),floattov10(-0.4996),floattov10(-0.2941)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8148),floattov10(-0.4996),floattov10(-0.2941)),
-	VERTEX_PACK(floattov16(-0.797945),floattov16(-1.15022)), VERTEX_PACK(floattov16(-0.687963),0),
-	NORMAL_PACK(floattov10(0.8148),floattov10(-0.4996),floattov10(-0.2941)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8221),floattov10(-0.3279),floattov10(-0.4654)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.8221),floattov10(-0.3279),floattov10(-0.4654)),
-	VERTEX_PACK(floattov16(-0.905251),floattov16(-1.14906)), VERTEX_PACK(floattov16(-0.98718),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8221),floattov10(-0.3279),floattov10(-0.4654)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	NORMAL_PACK(floattov10(-0.8064),floattov10(0.2652),floattov10(0.5286)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8064),floattov10(0.2652),floattov10(0.5286)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	NORMAL_PACK(floattov10(-0.8064),floattov10(0.2652),floattov10(0.5286)),
-	VERTEX_PACK(floattov16(-0.808214),floattov16(-1.14646)), VERTEX_PACK(floattov16(-1.89976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7),floattov10(0.0338),floattov10(0.7133)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	NORMAL_PACK(floattov10(-0.7),floattov10(0.0338),floattov10(0.7133)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7),floattov10(0.0338),floattov10(0.7133)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(0.1987),floattov10(0.5914)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(0.1987),floattov10(0.5914)),
-	VERTEX_PACK(floattov16(-0.574077),floattov16(-1.14767)), VERTEX_PACK(floattov16(-1.67742),0),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(0.1987),floattov10(0.5914)),
-	VERTEX_PACK(floattov16(-0.385405),floattov16(-1.14885)), VERTEX_PACK(floattov16(-1.42766),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1701),floattov10(0.5052),floattov10(-0.8461)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	NORMAL_PACK(floattov10(0.1701),floattov10(0.5052),floattov10(-0.8461)),
-	VERTEX_PACK(floattov16(-0.770671),floattov16(-1.14489)), VERTEX_PACK(floattov16(-2.43519),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1701),floattov10(0.5052),floattov10(-0.8461)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-0.564568),floattov16(-0.553965)), VERTEX_PACK(floattov16(0.592984),0),
-	NORMAL_PACK(floattov10(0.5553),floattov10(-0.7961),floattov10(0.2408)),
-	VERTEX_PACK(floattov16(-1.16212),floattov16(-1.15152)), VERTEX_PACK(floattov16(-0.004571),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.649611),floattov16(-0.485417)), VERTEX_PACK(floattov16(0.647081),0),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0696),floattov10(-0.6698),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-1.16212),floattov16(-1.15152)), VERTEX_PACK(floattov16(-0.004571),0),
-	NORMAL_PACK(floattov10(-0.5957),floattov10(0.7552),floattov10(-0.2735)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5957),floattov10(0.7552),floattov10(-0.2735)),
-	VERTEX_PACK(floattov16(-2.58602),floattov16(-1.14006)), VERTEX_PACK(floattov16(-2.69821),0),
-	NORMAL_PACK(floattov10(-0.5957),floattov10(0.7552),floattov10(-0.2735)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7928),floattov10(0.225),floattov10(0.5664)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	NORMAL_PACK(floattov10(-0.7928),floattov10(0.225),floattov10(0.5664)),
-	VERTEX_PACK(floattov16(-0.873303),floattov16(-1.14601)), VERTEX_PACK(floattov16(-1.99928),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7928),floattov10(0.225),floattov10(0.5664)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	NORMAL_PACK(floattov10(-0.8244),floattov10(0.5287),floattov10(0.202)),
-	VERTEX_PACK(floattov16(0.191792),floattov16(0.42032)), VERTEX_PACK(floattov16(-1.25365),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8244),floattov10(0.5287),floattov10(0.202)),
-	VERTEX_PACK(floattov16(-1.10513),floattov16(-1.1441)), VERTEX_PACK(floattov16(-2.452),0),
-	NORMAL_PACK(floattov10(-0.8244),floattov10(0.5287),floattov10(0.202)),
-	VERTEX_PACK(floattov16(-1.05989),floattov16(-1.14478)), VERTEX_PACK(floattov16(-2.26562),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2592),floattov10(0.7135),floattov10(-0.651)),
-	VERTEX_PACK(floattov16(0.191792),floattov16(0.42032)), VERTEX_PACK(floattov16(-1.25365),0),
-	NORMAL_PACK(floattov10(-0.2592),floattov10(0.7135),floattov10(-0.651)),
-	VERTEX_PACK(floattov16(-1.02182),floattov16(-1.14418)), VERTEX_PACK(floattov16(-2.48525),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2592),floattov10(0.7135),floattov10(-0.651)),
-	VERTEX_PACK(floattov16(-1.10513),floattov16(-1.1441)), VERTEX_PACK(floattov16(-2.452),0),
-	NORMAL_PACK(floattov10(-0.7693),floattov10(0.1869),floattov10(0.611)),
-	VERTEX_PACK(floattov16(-1.09262),floattov16(0.034406)), VERTEX_PACK(floattov16(0.218651),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7693),floattov10(0.1869),floattov10(0.611)),
-	VERTEX_PACK(floattov16(-1.95655),floattov16(-1.14821)), VERTEX_PACK(floattov16(-0.507395),0),
-	NORMAL_PACK(floattov10(-0.7693),floattov10(0.1869),floattov10(0.611)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7167),floattov10(0.0581),floattov10(0.695)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	NORMAL_PACK(floattov10(-0.7167),floattov10(0.0581),floattov10(0.695)),
-	VERTEX_PACK(floattov16(-1.852),floattov16(-1.14879)), VERTEX_PACK(floattov16(-0.394469),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7167),floattov10(0.0581),floattov10(0.695)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	NORMAL_PACK(floattov10(-0.6118),floattov10(-0.1271),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6118),floattov10(-0.1271),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-1.852),floattov16(-1.14879)), VERTEX_PACK(floattov16(-0.394469),0),
-	NORMAL_PACK(floattov10(-0.6118),floattov10(-0.1271),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-1.58128),floattov16(-1.15004)), VERTEX_PACK(floattov16(-0.182515),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8291),floattov10(-0.463),floattov10(-0.3134)),
-	VERTEX_PACK(floattov16(-0.775005),floattov16(0.887465)), VERTEX_PACK(floattov16(-0.567251),0),
-	NORMAL_PACK(floattov10(0.8291),floattov10(-0.463),floattov10(-0.3134)),
-	VERTEX_PACK(floattov16(-2.52273),floattov16(-1.14176)), VERTEX_PACK(floattov16(-2.1934),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8291),floattov10(-0.463),floattov10(-0.3134)),
-	VERTEX_PACK(floattov16(-2.53658),floattov16(-1.14162)), VERTEX_PACK(floattov16(-2.23025),0),
-	NORMAL_PACK(floattov10(0.6868),floattov10(-0.0005),floattov10(-0.7269)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6868),floattov10(-0.0005),floattov10(-0.7269)),
-	VERTEX_PACK(floattov16(-0.775005),floattov16(0.887465)), VERTEX_PACK(floattov16(-0.567251),0),
-	NORMAL_PACK(floattov10(0.6868),floattov10(-0.0005),floattov10(-0.7269)),
-	VERTEX_PACK(floattov16(-2.53658),floattov16(-1.14162)), VERTEX_PACK(floattov16(-2.23025),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7667),floattov10(0.6419),floattov10(0.0136)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	NORMAL_PACK(floattov10(-0.7667),floattov10(0.6419),floattov10(0.0136)),
-	VERTEX_PACK(floattov16(-1.96371),floattov16(-1.14289)), VERTEX_PACK(floattov16(-2.22964),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7667),floattov10(0.6419),floattov10(0.0136)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	NORMAL_PACK(floattov10(0.7372),floattov10(-0.6754),floattov10(-0.0189)),
-	VERTEX_PACK(floattov16(0.693223),floattov16(-0.366939)), VERTEX_PACK(floattov16(-0.607826),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7372),floattov10(-0.6754),floattov10(-0.0189)),
-	VERTEX_PACK(floattov16(-0.039483),floattov16(-1.15035)), VERTEX_PACK(floattov16(-1.19209),0),
-	NORMAL_PACK(floattov10(0.7372),floattov10(-0.6754),floattov10(-0.0189)),
-	VERTEX_PACK(floattov16(-0.0425975),floattov16(-1.14992)), VERTEX_PACK(floattov16(-1.32895),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5008),floattov10(-0.3083)),
-	VERTEX_PACK(floattov16(0.693951),floattov16(-0.417064)), VERTEX_PACK(floattov16(-0.458995),0),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5008),floattov10(-0.3083)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8088),floattov10(-0.5008),floattov10(-0.3083)),
-	VERTEX_PACK(floattov16(0.028683),floattov16(-1.15105)), VERTEX_PACK(floattov16(-1.012),0),
-	NORMAL_PACK(floattov10(0.6774),floattov10(-0.7335),floattov10(0.0562)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6774),floattov10(-0.7335),floattov10(0.0562)),
-	VERTEX_PACK(floattov16(0.549534),floattov16(-0.616221)), VERTEX_PACK(floattov16(-0.306915),0),
-	NORMAL_PACK(floattov10(0.6774),floattov10(-0.7335),floattov10(0.0562)),
-	VERTEX_PACK(floattov16(0.014212),floattov16(-1.15154)), VERTEX_PACK(floattov16(-0.842237),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8051),floattov10(-0.3617),floattov10(-0.4702)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.8051),floattov10(-0.3617),floattov10(-0.4702)),
-	VERTEX_PACK(floattov16(-0.0425975),floattov16(-1.14992)), VERTEX_PACK(floattov16(-1.32895),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8051),floattov10(-0.3617),floattov10(-0.4702)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	NORMAL_PACK(floattov10(-0.5518),floattov10(-0.2453),floattov10(0.7971)),
-	VERTEX_PACK(floattov16(0.0723625),floattov16(-0.446302)), VERTEX_PACK(floattov16(0.057719),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5518),floattov10(-0.2453),floattov10(0.7971)),
-	VERTEX_PACK(floattov16(-0.56963),floattov16(-1.15099)), VERTEX_PACK(floattov16(-0.603565),0),
-	NORMAL_PACK(floattov10(-0.5518),floattov10(-0.2453),floattov10(0.7971)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8287),floattov10(0.4662),floattov10(0.3097)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	NORMAL_PACK(floattov10(-0.8287),floattov10(0.4662),floattov10(0.3097)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8287),floattov10(0.4662),floattov10(0.3097)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(0.5479),floattov10(-0.7499),floattov10(0.3707)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5479),floattov10(-0.7499),floattov10(0.3707)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	NORMAL_PACK(floattov10(0.5479),floattov10(-0.7499),floattov10(0.3707)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3325),floattov10(0.752),floattov10(-0.5691)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	NORMAL_PACK(floattov10(-0.3325),floattov10(0.752),floattov10(-0.5691)),
-	VERTEX_PACK(floattov16(-0.664702),floattov16(0.845528)), VERTEX_PACK(floattov16(-0.648162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3325),floattov10(0.752),floattov10(-0.5691)),
-	VERTEX_PACK(floattov16(-2.38456),floattov16(-1.14183)), VERTEX_PACK(floattov16(-2.26944),0),
-	NORMAL_PACK(floattov10(0.3823),floattov10(0.3609),floattov10(-0.8506)),
-	VERTEX_PACK(floattov16(-0.664702),floattov16(0.845528)), VERTEX_PACK(floattov16(-0.648162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3823),floattov10(0.3609),floattov10(-0.8506)),
-	VERTEX_PACK(floattov16(-0.643779),floattov16(0.804839)), VERTEX_PACK(floattov16(-0.656021),0),
-	NORMAL_PACK(floattov10(0.3823),floattov10(0.3609),floattov10(-0.8506)),
-	VERTEX_PACK(floattov16(-2.32318),floattov16(-1.14207)), VERTEX_PACK(floattov16(-2.23685),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7174),floattov10(-0.691),floattov10(0.0889)),
-	VERTEX_PACK(floattov16(-0.643779),floattov16(0.804839)), VERTEX_PACK(floattov16(-0.656021),0),
-	NORMAL_PACK(floattov10(0.7174),floattov10(-0.691),floattov10(0.0889)),
-	VERTEX_PACK(floattov16(-2.33264),floattov16(-1.14228)), VERTEX_PACK(floattov16(-2.16218),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7174),floattov10(-0.691),floattov10(0.0889)),
-	VERTEX_PACK(floattov16(-2.32318),floattov16(-1.14207)), VERTEX_PACK(floattov16(-2.23685),0),
-	NORMAL_PACK(floattov10(0.8188),floattov10(-0.3136),floattov10(-0.4808)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8188),floattov10(-0.3136),floattov10(-0.4808)),
-	VERTEX_PACK(floattov16(-0.72836),floattov16(-1.14605)), VERTEX_PACK(floattov16(-2.09068),0),
-	NORMAL_PACK(floattov10(0.8188),floattov10(-0.3136),floattov10(-0.4808)),
-	VERTEX_PACK(floattov16(-0.800816),floattov16(-1.14551)), VERTEX_PACK(floattov16(-2.21441),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6682),floattov10(0.0212),floattov10(-0.7437)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	NORMAL_PACK(floattov10(0.6682),floattov10(0.0212),floattov10(-0.7437)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6682),floattov10(0.0212),floattov10(-0.7437)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	NORMAL_PACK(floattov10(0.7358),floattov10(-0.0955),floattov10(-0.6704)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7358),floattov10(-0.0955),floattov10(-0.6704)),
-	VERTEX_PACK(floattov16(-0.150186),floattov16(-1.14911)), VERTEX_PACK(floattov16(-1.51379),0),
-	NORMAL_PACK(floattov10(0.7358),floattov10(-0.0955),floattov10(-0.6704)),
-	VERTEX_PACK(floattov16(-0.499474),floattov16(-1.14715)), VERTEX_PACK(floattov16(-1.89745),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0082),floattov10(-0.6293),floattov10(0.7771)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	NORMAL_PACK(floattov10(0.0082),floattov10(-0.6293),floattov10(0.7771)),
-	VERTEX_PACK(floattov16(-3.00973),floattov16(-1.14298)), VERTEX_PACK(floattov16(-1.4473),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0082),floattov10(-0.6293),floattov10(0.7771)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(0.7521),floattov10(-0.4426)),
-	VERTEX_PACK(floattov16(-0.597001),floattov16(0.493572)), VERTEX_PACK(floattov16(-0.623194),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(0.7521),floattov10(-0.4426)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(0.7521),floattov10(-0.4426)),
-	VERTEX_PACK(floattov16(-1.96698),floattov16(-1.14391)), VERTEX_PACK(floattov16(-1.8946),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8304),floattov10(0.4831),floattov10(0.2775)),
-	VERTEX_PACK(floattov16(-0.533355),floattov16(0.583673)), VERTEX_PACK(floattov16(-0.696029),0),
-	NORMAL_PACK(floattov10(-0.8304),floattov10(0.4831),floattov10(0.2775)),
-	VERTEX_PACK(floattov16(-1.99288),floattov16(-1.14336)), VERTEX_PACK(floattov16(-2.05698),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8304),floattov10(0.4831),floattov10(0.2775)),
-	VERTEX_PACK(floattov16(-1.94647),floattov16(-1.14389)), VERTEX_PACK(floattov16(-1.91719),0),
-	NORMAL_PACK(floattov10(-0.6224),floattov10(0.7366),floattov10(-0.2648)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6224),floattov10(0.7366),floattov10(-0.2648)),
-	VERTEX_PACK(floattov16(-1.96218),floattov16(-1.1432)), VERTEX_PACK(floattov16(-2.12872),0),
-	NORMAL_PACK(floattov10(-0.6224),floattov10(0.7366),floattov10(-0.2648)),
-	VERTEX_PACK(floattov16(-1.99288),floattov16(-1.14336)), VERTEX_PACK(floattov16(-2.05698),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2684),floattov10(0.4379),floattov10(-0.858)),
-	VERTEX_PACK(floattov16(0.0235875),floattov16(0.514356)), VERTEX_PACK(floattov16(-1.13715),0),
-	NORMAL_PACK(floattov10(0.2684),floattov10(0.4379),floattov10(-0.858)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2684),floattov10(0.4379),floattov10(-0.858)),
-	VERTEX_PACK(floattov16(-1.26602),floattov16(-1.14395)), VERTEX_PACK(floattov16(-2.38689),0),
-	NORMAL_PACK(floattov10(0.7384),floattov10(-0.1047),floattov10(-0.6662)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7384),floattov10(-0.1047),floattov10(-0.6662)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	NORMAL_PACK(floattov10(0.7384),floattov10(-0.1047),floattov10(-0.6662)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8129),floattov10(-0.2862),floattov10(-0.5072)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	NORMAL_PACK(floattov10(0.8129),floattov10(-0.2862),floattov10(-0.5072)),
-	VERTEX_PACK(floattov16(-0.634035),floattov16(-1.14785)), VERTEX_PACK(floattov16(-1.5754),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8129),floattov10(-0.2862),floattov10(-0.5072)),
-	VERTEX_PACK(floattov16(-0.839188),floattov16(-1.14638)), VERTEX_PACK(floattov16(-1.90503),0),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(0.077134),floattov16(-0.566504)), VERTEX_PACK(floattov16(0.069324),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(-0.507756),floattov16(-1.15139)), VERTEX_PACK(floattov16(-0.515567),0),
-	NORMAL_PACK(floattov10(0.4163),floattov10(-0.8164),floattov10(0.4001)),
-	VERTEX_PACK(floattov16(-0.444331),floattov16(-1.15133)), VERTEX_PACK(floattov16(-0.581423),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(-0.280747),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.661058),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2618),floattov10(-0.8007),floattov10(0.5389)),
-	VERTEX_PACK(floattov16(0.284253),floattov16(-0.586448)), VERTEX_PACK(floattov16(-0.0960585),0),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(0.284253),floattov16(-0.586448)), VERTEX_PACK(floattov16(-0.0960585),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(-0.280747),floattov16(-1.15145)), VERTEX_PACK(floattov16(-0.661058),0),
-	NORMAL_PACK(floattov10(0.0197),floattov10(-0.7167),floattov10(0.6971)),
-	VERTEX_PACK(floattov16(-0.19489),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.663669),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.831),floattov10(0.3824),floattov10(0.4039)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	NORMAL_PACK(floattov10(-0.831),floattov10(0.3824),floattov10(0.4039)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.831),floattov10(0.3824),floattov10(0.4039)),
-	VERTEX_PACK(floattov16(-0.933674),floattov16(-1.14814)), VERTEX_PACK(floattov16(-1.2663),0),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0941),floattov10(0.6773)),
-	VERTEX_PACK(floattov16(0.111474),floattov16(-0.0984235)), VERTEX_PACK(floattov16(-0.273264),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0941),floattov10(0.6773)),
-	VERTEX_PACK(floattov16(-0.712658),floattov16(-1.1494)), VERTEX_PACK(floattov16(-1.01503),0),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0941),floattov10(0.6773)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5553),floattov10(0.7911),floattov10(-0.2565)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	NORMAL_PACK(floattov10(-0.5553),floattov10(0.7911),floattov10(-0.2565)),
-	VERTEX_PACK(floattov16(-0.727002),floattov16(-1.14947)), VERTEX_PACK(floattov16(-0.983398),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5553),floattov10(0.7911),floattov10(-0.2565)),
-	VERTEX_PACK(floattov16(0.097495),floattov16(-0.320404)), VERTEX_PACK(floattov16(-0.211011),0),
-	NORMAL_PACK(floattov10(-0.7046),floattov10(0.0408),floattov10(0.7084)),
-	VERTEX_PACK(floattov16(0.097495),floattov16(-0.320404)), VERTEX_PACK(floattov16(-0.211011),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7046),floattov10(0.0408),floattov10(0.7084)),
-	VERTEX_PACK(floattov16(-0.727002),floattov16(-1.14947)), VERTEX_PACK(floattov16(-0.983398),0),
-	NORMAL_PACK(floattov10(-0.7046),floattov10(0.0408),floattov10(0.7084)),
-	VERTEX_PACK(floattov16(-0.586828),floattov16(-1.15021)), VERTEX_PACK(floattov16(-0.843929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5768),floattov10(0.7889),floattov10(-0.2121)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	NORMAL_PACK(floattov10(-0.6883),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6883),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(-0.627308),floattov16(-1.15045)), VERTEX_PACK(floattov16(-0.734753),0),
-	NORMAL_PACK(floattov10(-0.6883),floattov10(0.7245),floattov10(-0.036)),
-	VERTEX_PACK(floattov16(-0.632202),floattov16(-1.15071)), VERTEX_PACK(floattov16(-0.646502),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8038),floattov10(0.2646),floattov10(0.5329)),
-	VERTEX_PACK(floattov16(-0.619591),floattov16(0.200683)), VERTEX_PACK(floattov16(-0.382239),0),
-	NORMAL_PACK(floattov10(-0.8038),floattov10(0.2646),floattov10(0.5329)),
-	VERTEX_PACK(floattov16(-1.61606),floattov16(-1.14678)), VERTEX_PACK(floattov16(-1.21609),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8038),floattov10(0.2646),floattov10(0.5329)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	NORMAL_PACK(floattov10(-0.8323),floattov10(0.4498),floattov10(0.324)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8323),floattov10(0.4498),floattov10(0.324)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	NORMAL_PACK(floattov10(-0.8323),floattov10(0.4498),floattov10(0.324)),
-	VERTEX_PACK(floattov16(-1.75188),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.43211),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8283),floattov10(0.3703),floattov10(0.4206)),
-	VERTEX_PACK(floattov16(-0.597001),floattov16(0.493572)), VERTEX_PACK(floattov16(-0.623194),0),
-	NORMAL_PACK(floattov10(-0.8283),floattov10(0.3703),floattov10(0.4206)),
-	VERTEX_PACK(floattov16(-1.78855),floattov16(-1.14544)), VERTEX_PACK(floattov16(-1.52682),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8283),floattov10(0.3703),floattov10(0.4206)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-0.666475),floattov16(-0.411121)), VERTEX_PACK(floattov16(0.643921),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-1.40605),floattov16(-1.1507)), VERTEX_PACK(floattov16(-0.0956575),0),
-	NORMAL_PACK(floattov10(-0.6433),floattov10(-0.1138),floattov10(0.7571)),
-	VERTEX_PACK(floattov16(-1.31533),floattov16(-1.15114)), VERTEX_PACK(floattov16(-0.0186385),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7285),floattov10(0.6835),floattov10(0.0452)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(-0.7285),floattov10(0.6835),floattov10(0.0452)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7285),floattov10(0.6835),floattov10(0.0452)),
-	VERTEX_PACK(floattov16(-1.40605),floattov16(-1.1507)), VERTEX_PACK(floattov16(-0.0956575),0),
-	NORMAL_PACK(floattov10(0.2873),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-0.672782),floattov16(-0.365445)), VERTEX_PACK(floattov16(0.650626),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2873),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-1.45796),floattov16(-1.15047)), VERTEX_PACK(floattov16(-0.134203),0),
-	NORMAL_PACK(floattov10(0.2873),floattov10(-0.8055),floattov10(0.5182)),
-	VERTEX_PACK(floattov16(-1.4099),floattov16(-1.15049)), VERTEX_PACK(floattov16(-0.160885),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1872),floattov10(-0.6971),floattov10(0.6921)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	NORMAL_PACK(floattov10(0.1872),floattov10(-0.6971),floattov10(0.6921)),
-	VERTEX_PACK(floattov16(-0.691228),floattov16(-1.14547)), VERTEX_PACK(floattov16(-2.30438),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1872),floattov10(-0.6971),floattov10(0.6921)),
-	VERTEX_PACK(floattov16(0.441986),floattov16(0.20195)), VERTEX_PACK(floattov16(-1.25357),0),
-	NORMAL_PACK(floattov10(0.5443),floattov10(0.1844),floattov10(-0.8184)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5443),floattov10(0.1844),floattov10(-0.8184)),
-	VERTEX_PACK(floattov16(-0.691228),floattov16(-1.14547)), VERTEX_PACK(floattov16(-2.30438),0),
-	NORMAL_PACK(floattov10(0.5443),floattov10(0.1844),floattov10(-0.8184)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8303),floattov10(-0.4787),floattov10(-0.2853)),
-	VERTEX_PACK(floattov16(0.384223),floattov16(0.277504)), VERTEX_PACK(floattov16(-1.37888),0),
-	NORMAL_PACK(floattov10(0.8303),floattov10(-0.4787),floattov10(-0.2853)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8303),floattov10(-0.4787),floattov10(-0.2853)),
-	VERTEX_PACK(floattov16(-0.772566),floattov16(-1.14513)), VERTEX_PACK(floattov16(-2.35839),0),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-1.15991),floattov16(-1.15068)), VERTEX_PACK(floattov16(-0.279082),0),
-	NORMAL_PACK(floattov10(0.6555),floattov10(-0.7493),floattov10(0.0937)),
-	VERTEX_PACK(floattov16(-1.15397),floattov16(-1.15057)), VERTEX_PACK(floattov16(-0.31973),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1657),floattov10(-0.6095),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	NORMAL_PACK(floattov10(-0.1657),floattov10(-0.6095),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1657),floattov10(-0.6095),floattov10(0.7752)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.80989),floattov16(-1.15155)), VERTEX_PACK(floattov16(-0.247181),0),
-	NORMAL_PACK(floattov10(0.1994),floattov10(-0.7854),floattov10(0.586)),
-	VERTEX_PACK(floattov16(-0.746396),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.268887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.130216),floattov16(-0.548295)), VERTEX_PACK(floattov16(0.235293),0),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.746396),floattov16(-1.15163)), VERTEX_PACK(floattov16(-0.268887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6604),floattov10(-0.746),floattov10(0.0856)),
-	VERTEX_PACK(floattov16(-0.733271),floattov16(-1.15135)), VERTEX_PACK(floattov16(-0.367761),0),
-	NORMAL_PACK(floattov10(0.8163),floattov10(-0.3942),floattov10(-0.4221)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8163),floattov10(-0.3942),floattov10(-0.4221)),
-	VERTEX_PACK(floattov16(-0.130216),floattov16(-0.548295)), VERTEX_PACK(floattov16(0.235293),0),
-	NORMAL_PACK(floattov10(0.8163),floattov10(-0.3942),floattov10(-0.4221)),
-	VERTEX_PACK(floattov16(-0.733271),floattov16(-1.15135)), VERTEX_PACK(floattov16(-0.367761),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8172),floattov10(-0.3212),floattov10(-0.4785)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	NORMAL_PACK(floattov10(0.8172),floattov10(-0.3212),floattov10(-0.4785)),
-	VERTEX_PACK(floattov16(-1.6569),floattov16(-1.14722)), VERTEX_PACK(floattov16(-1.04312),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8172),floattov10(-0.3212),floattov10(-0.4785)),
-	VERTEX_PACK(floattov16(-1.72892),floattov16(-1.14668)), VERTEX_PACK(floattov16(-1.16648),0),
-	NORMAL_PACK(floattov10(0.4719),floattov10(0.2671),floattov10(-0.8402)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4719),floattov10(0.2671),floattov10(-0.8402)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	NORMAL_PACK(floattov10(0.4719),floattov10(0.2671),floattov10(-0.8402)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7208),floattov10(0.6885),floattov10(-0.0806)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(-0.7208),floattov10(0.6885),floattov10(-0.0806)),
-	VERTEX_PACK(floattov16(-1.5723),floattov16(-1.1472)), VERTEX_PACK(floattov16(-1.11015),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7208),floattov10(0.6885),floattov10(-0.0806)),
-	VERTEX_PACK(floattov16(-1.58523),floattov16(-1.14752)), VERTEX_PACK(floattov16(-0.997245),0),
-	NORMAL_PACK(floattov10(0.0442),floattov10(0.5931),floattov10(-0.8039)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0442),floattov10(0.5931),floattov10(-0.8039)),
-	VERTEX_PACK(floattov16(-1.36686),floattov16(-1.14359)), VERTEX_PACK(floattov16(-2.42902),0),
-	NORMAL_PACK(floattov10(0.0442),floattov10(0.5931),floattov10(-0.8039)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.682),floattov10(0.0001),floattov10(-0.7314)),
-	VERTEX_PACK(floattov16(-0.032187),floattov16(0.587946)), VERTEX_PACK(floattov16(-1.10822),0),
-	NORMAL_PACK(floattov10(0.682),floattov10(0.0001),floattov10(-0.7314)),
-	VERTEX_PACK(floattov16(-1.45329),floattov16(-1.14339)), VERTEX_PACK(floattov16(-2.43362),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.682),floattov10(0.0001),floattov10(-0.7314)),
-	VERTEX_PACK(floattov16(-1.4958),floattov16(-1.14317)), VERTEX_PACK(floattov16(-2.47326),0),
-	NORMAL_PACK(floattov10(-0.1465),floattov10(0.6859),floattov10(-0.7128)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1465),floattov10(0.6859),floattov10(-0.7128)),
-	VERTEX_PACK(floattov16(-0.032187),floattov16(0.587946)), VERTEX_PACK(floattov16(-1.10822),0),
-	NORMAL_PACK(floattov10(-0.1465),floattov10(0.6859),floattov10(-0.7128)),
-	VERTEX_PACK(floattov16(-1.4958),floattov16(-1.14317)), VERTEX_PACK(floattov16(-2.47326),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6354),floattov10(0.0677),floattov10(-0.7692)),
-	VERTEX_PACK(floattov16(-0.678464),floattov16(0.621215)), VERTEX_PACK(floattov16(-0.585553),0),
-	NORMAL_PACK(floattov10(0.6354),floattov10(0.0677),floattov10(-0.7692)),
-	VERTEX_PACK(floattov16(-0.663798),floattov16(0.544982)), VERTEX_PACK(floattov16(-0.580146),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6354),floattov10(0.0677),floattov10(-0.7692)),
-	VERTEX_PACK(floattov16(-2.0849),floattov16(-1.14363)), VERTEX_PACK(floattov16(-1.90267),0),
-	NORMAL_PACK(floattov10(0.8282),floattov10(-0.3788),floattov10(-0.413)),
-	VERTEX_PACK(floattov16(-0.663798),floattov16(0.544982)), VERTEX_PACK(floattov16(-0.580146),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8282),floattov10(-0.3788),floattov10(-0.413)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	NORMAL_PACK(floattov10(0.8282),floattov10(-0.3788),floattov10(-0.413)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7825),floattov10(-0.1969),floattov10(-0.5906)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	NORMAL_PACK(floattov10(0.7825),floattov10(-0.1969),floattov10(-0.5906)),
-	VERTEX_PACK(floattov16(-1.7957),floattov16(-1.14581)), VERTEX_PACK(floattov16(-1.40316),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7825),floattov10(-0.1969),floattov10(-0.5906)),
-	VERTEX_PACK(floattov16(-1.94773),floattov16(-1.14485)), VERTEX_PACK(floattov16(-1.60491),0),
-	NORMAL_PACK(floattov10(0.2682),floattov10(-0.7455),floattov10(0.6101)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2682),floattov10(-0.7455),floattov10(0.6101)),
-	VERTEX_PACK(floattov16(-2.85039),floattov16(-1.14333)), VERTEX_PACK(floattov16(-1.44927),0),
-	NORMAL_PACK(floattov10(0.2682),floattov10(-0.7455),floattov10(0.6101)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5731),floattov10(-0.7496),floattov10(0.331)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.5731),floattov10(-0.7496),floattov10(0.331)),
-	VERTEX_PACK(floattov16(-2.65344),floattov16(-1.1435)), VERTEX_PACK(floattov16(-1.53606),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5731),floattov10(-0.7496),floattov10(0.331)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	NORMAL_PACK(floattov10(0.3497),floattov10(0.3977),floattov10(-0.8483)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3497),floattov10(0.3977),floattov10(-0.8483)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	NORMAL_PACK(floattov10(0.3497),floattov10(0.3977),floattov10(-0.8483)),
-	VERTEX_PACK(floattov16(-2.77848),floattov16(-1.14092)), VERTEX_PACK(floattov16(-2.28138),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8003),floattov10(-0.2484),floattov10(-0.5457)),
-	VERTEX_PACK(floattov16(-0.89865),floattov16(1.16035)), VERTEX_PACK(floattov16(-0.528226),0),
-	NORMAL_PACK(floattov10(0.8003),floattov10(-0.2484),floattov10(-0.5457)),
-	VERTEX_PACK(floattov16(-2.823),floattov16(-1.14076)), VERTEX_PACK(floattov16(-2.30303),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8003),floattov10(-0.2484),floattov10(-0.5457)),
-	VERTEX_PACK(floattov16(-2.93152),floattov16(-1.14003)), VERTEX_PACK(floattov16(-2.46252),0),
-	NORMAL_PACK(floattov10(-0.2318),floattov10(0.7307),floattov10(-0.6422)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.2318),floattov10(0.7307),floattov10(-0.6422)),
-	VERTEX_PACK(floattov16(-1.20889),floattov16(0.531483)), VERTEX_PACK(floattov16(0.0256155),0),
-	NORMAL_PACK(floattov10(-0.2318),floattov10(0.7307),floattov10(-0.6422)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-1.11112),floattov16(-1.15127)), VERTEX_PACK(floattov16(-0.121374),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.1555),floattov10(-0.6164),floattov10(0.7719)),
-	VERTEX_PACK(floattov16(-0.995746),floattov16(-1.1516)), VERTEX_PACK(floattov16(-0.0983895),0),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-0.397491),floattov16(-0.544982)), VERTEX_PACK(floattov16(0.453839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-0.995746),floattov16(-1.1516)), VERTEX_PACK(floattov16(-0.0983895),0),
-	NORMAL_PACK(floattov10(0.7581),floattov10(-0.6416),floattov10(-0.1166)),
-	VERTEX_PACK(floattov16(-1.00392),floattov16(-1.15141)), VERTEX_PACK(floattov16(-0.152593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6247),floattov10(0.1429),floattov10(-0.7677)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	NORMAL_PACK(floattov10(0.6247),floattov10(0.1429),floattov10(-0.7677)),
-	VERTEX_PACK(floattov16(-0.397491),floattov16(-0.544982)), VERTEX_PACK(floattov16(0.453839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6247),floattov10(0.1429),floattov10(-0.7677)),
-	VERTEX_PACK(floattov16(-1.00392),floattov16(-1.15141)), VERTEX_PACK(floattov16(-0.152593),0),
-	NORMAL_PACK(floattov10(-0.7215),floattov10(0.6873),floattov10(-0.0841)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7215),floattov10(0.6873),floattov10(-0.0841)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	NORMAL_PACK(floattov10(-0.7215),floattov10(0.6873),floattov10(-0.0841)),
-	VERTEX_PACK(floattov16(-2.26299),floattov16(-1.14532)), VERTEX_PACK(floattov16(-1.22613),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7243),floattov10(0.6872),floattov10(-0.056)),
-	VERTEX_PACK(floattov16(-0.89865),floattov16(1.16035)), VERTEX_PACK(floattov16(-0.528226),0),
-	NORMAL_PACK(floattov10(-0.7243),floattov10(0.6872),floattov10(-0.056)),
-	VERTEX_PACK(floattov16(-2.93152),floattov16(-1.14003)), VERTEX_PACK(floattov16(-2.46252),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7243),floattov10(0.6872),floattov10(-0.056)),
-	VERTEX_PACK(floattov16(-2.94015),floattov16(-1.14034)), VERTEX_PACK(floattov16(-2.3548),0),
-	NORMAL_PACK(floattov10(-0.8294),floattov10(0.4117),floattov10(0.3777)),
-	VERTEX_PACK(floattov16(-0.956352),floattov16(1.11096)), VERTEX_PACK(floattov16(-0.469582),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8294),floattov10(0.4117),floattov10(0.3777)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	NORMAL_PACK(floattov10(-0.8294),floattov10(0.4117),floattov10(0.3777)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.487),floattov10(0.7679),floattov10(-0.4162)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(-0.487),floattov10(0.7679),floattov10(-0.4162)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.487),floattov10(0.7679),floattov10(-0.4162)),
-	VERTEX_PACK(floattov16(-2.82413),floattov16(-1.14133)), VERTEX_PACK(floattov16(-2.1162),0),
-	NORMAL_PACK(floattov10(-0.3571),floattov10(-0.3655),floattov10(0.8596)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.3571),floattov10(-0.3655),floattov10(0.8596)),
-	VERTEX_PACK(floattov16(-1.19257),floattov16(-1.14592)), VERTEX_PACK(floattov16(-1.80103),0),
-	NORMAL_PACK(floattov10(-0.3571),floattov10(-0.3655),floattov10(0.8596)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1561),floattov10(-0.6881),floattov10(0.7087)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	NORMAL_PACK(floattov10(0.1561),floattov10(-0.6881),floattov10(0.7087)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1561),floattov10(-0.6881),floattov10(0.7087)),
-	VERTEX_PACK(floattov16(-1.26289),floattov16(-1.14565)), VERTEX_PACK(floattov16(-1.83744),0),
-	NORMAL_PACK(floattov10(0.8278),floattov10(-0.3642),floattov10(-0.4267)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8278),floattov10(-0.3642),floattov10(-0.4267)),
-	VERTEX_PACK(floattov16(-1.32584),floattov16(-1.14583)), VERTEX_PACK(floattov16(-1.73242),0),
-	NORMAL_PACK(floattov10(0.8278),floattov10(-0.3642),floattov10(-0.4267)),
-	VERTEX_PACK(floattov16(-1.36783),floattov16(-1.14549)), VERTEX_PACK(floattov16(-1.81417),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(0.5616),floattov10(0.1609)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(0.5616),floattov10(0.1609)),
-	VERTEX_PACK(floattov16(-2.56437),floattov16(-1.14322)), VERTEX_PACK(floattov16(-1.68966),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(0.5616),floattov10(0.1609)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	NORMAL_PACK(floattov10(-0.5265),floattov10(0.7661),floattov10(-0.3686)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.5265),floattov10(0.7661),floattov10(-0.3686)),
-	VERTEX_PACK(floattov16(-2.54988),floattov16(-1.14348)), VERTEX_PACK(floattov16(-1.61568),0),
-	NORMAL_PACK(floattov10(-0.5265),floattov10(0.7661),floattov10(-0.3686)),
-	VERTEX_PACK(floattov16(-2.6645),floattov16(-1.14373)), VERTEX_PACK(floattov16(-1.45249),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7134),floattov10(0.6951),floattov10(-0.0885)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	NORMAL_PACK(floattov10(-0.7134),floattov10(0.6951),floattov10(-0.0885)),
-	VERTEX_PACK(floattov16(-2.67019),floattov16(-1.14402)), VERTEX_PACK(floattov16(-1.35327),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7134),floattov10(0.6951),floattov10(-0.0885)),
-	VERTEX_PACK(floattov16(-1.20889),floattov16(0.531483)), VERTEX_PACK(floattov16(0.0256155),0),
-	NORMAL_PACK(floattov10(-0.7639),floattov10(0.1502),floattov10(0.6276)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.7639),floattov10(0.1502),floattov10(0.6276)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	NORMAL_PACK(floattov10(-0.7639),floattov10(0.1502),floattov10(0.6276)),
-	VERTEX_PACK(floattov16(-2.24485),floattov16(-1.14489)), VERTEX_PACK(floattov16(-1.37833),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4949),floattov10(-0.7652),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	NORMAL_PACK(floattov10(0.4949),floattov10(-0.7652),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4949),floattov10(-0.7652),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(-2.35019),floattov16(-1.14426)), VERTEX_PACK(floattov16(-1.50672),0),
-	NORMAL_PACK(floattov10(0.8105),floattov10(-0.2854),floattov10(-0.5115)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8105),floattov10(-0.2854),floattov10(-0.5115)),
-	VERTEX_PACK(floattov16(-2.34614),floattov16(-1.14477)), VERTEX_PACK(floattov16(-1.34374),0),
-	NORMAL_PACK(floattov10(0.8105),floattov10(-0.2854),floattov10(-0.5115)),
-	VERTEX_PACK(floattov16(-2.40635),floattov16(-1.14434)), VERTEX_PACK(floattov16(-1.43939),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8217),floattov10(0.485),floattov10(0.2994)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	NORMAL_PACK(floattov10(0.8217),floattov10(0.485),floattov10(0.2994)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8217),floattov10(0.485),floattov10(0.2994)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.47462),floattov16(0.629416)), VERTEX_PACK(floattov16(0.221244),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.44038),floattov16(0.574934)), VERTEX_PACK(floattov16(0.205612),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.44038),floattov16(0.574934)), VERTEX_PACK(floattov16(0.205612),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.46877),floattov16(0.478679)), VERTEX_PACK(floattov16(0.250927),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.30534),floattov16(0.336006)), VERTEX_PACK(floattov16(0.149475),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.01916),floattov16(0.396426)), VERTEX_PACK(floattov16(-0.099168),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.46877),floattov16(0.478679)), VERTEX_PACK(floattov16(0.250927),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.45018),floattov16(0.408305)), VERTEX_PACK(floattov16(0.251776),0),
-	NORMAL_PACK(floattov10(0.6817),floattov10(0.679),floattov10(0.2724)),
-	VERTEX_PACK(floattov16(-1.08266),floattov16(0.591237)), VERTEX_PACK(floattov16(-0.247041),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6817),floattov10(0.679),floattov10(0.2724)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	NORMAL_PACK(floattov10(0.6817),floattov10(0.679),floattov10(0.2724)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.20889),floattov16(0.531483)), VERTEX_PACK(floattov16(0.0256155),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.34105),floattov16(0.575933)), VERTEX_PACK(floattov16(0.123887),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.27649),floattov16(0.368369)), VERTEX_PACK(floattov16(0.118397),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.20889),floattov16(0.531483)), VERTEX_PACK(floattov16(0.0256155),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.20889),floattov16(0.531483)), VERTEX_PACK(floattov16(0.0256155),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.15709),floattov16(0.577883)), VERTEX_PACK(floattov16(-0.027501),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.11022),floattov16(0.39142)), VERTEX_PACK(floattov16(-0.0233035),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5238),floattov10(0.6252),floattov10(0.5786)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	NORMAL_PACK(floattov10(0.5238),floattov10(0.6252),floattov10(0.5786)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5238),floattov10(0.6252),floattov10(0.5786)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(0.352),floattov10(0.7575),floattov10(0.5498)),
-	VERTEX_PACK(floattov16(-1.08266),floattov16(0.591237)), VERTEX_PACK(floattov16(-0.247041),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.352),floattov10(0.7575),floattov10(0.5498)),
-	VERTEX_PACK(floattov16(-1.00864),floattov16(0.467585)), VERTEX_PACK(floattov16(-0.124081),0),
-	NORMAL_PACK(floattov10(0.352),floattov10(0.7575),floattov10(0.5498)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0469),floattov10(0.6428),floattov10(0.7646)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	NORMAL_PACK(floattov10(0.0469),floattov10(0.6428),floattov10(0.7646)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0469),floattov10(0.6428),floattov10(0.7646)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(0.0774),floattov10(0.572),floattov10(0.8166)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0774),floattov10(0.572),floattov10(0.8166)),
-	VERTEX_PACK(floattov16(-1.08266),floattov16(0.591237)), VERTEX_PACK(floattov16(-0.247041),0),
-	NORMAL_PACK(floattov10(0.0774),floattov10(0.572),floattov10(0.8166)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4441),floattov10(0.784)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4441),floattov10(0.784)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4441),floattov10(0.784)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	NORMAL_PACK(floattov10(0.6181),floattov10(0.642),floattov10(0.4536)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6181),floattov10(0.642),floattov10(0.4536)),
-	VERTEX_PACK(floattov16(-1.03619),floattov16(0.16238)), VERTEX_PACK(floattov16(0.143073),0),
-	NORMAL_PACK(floattov10(0.6181),floattov10(0.642),floattov10(0.4536)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2076),floattov10(0.9672),floattov10(0.1464)),
-	VERTEX_PACK(floattov16(-1.09262),floattov16(0.034406)), VERTEX_PACK(floattov16(0.218651),0),
-	NORMAL_PACK(floattov10(0.2076),floattov10(0.9672),floattov10(0.1464)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2076),floattov10(0.9672),floattov10(0.1464)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	NORMAL_PACK(floattov10(0.6684),floattov10(0.7424),floattov10(0.045)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6684),floattov10(0.7424),floattov10(0.045)),
-	VERTEX_PACK(floattov16(-0.723201),floattov16(-0.292118)), VERTEX_PACK(floattov16(0.67522),0),
-	NORMAL_PACK(floattov10(0.6684),floattov10(0.7424),floattov10(0.045)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4776),floattov10(0.1453),floattov10(0.8665)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.4776),floattov10(0.1453),floattov10(0.8665)),
-	VERTEX_PACK(floattov16(-0.666475),floattov16(-0.411121)), VERTEX_PACK(floattov16(0.643921),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4776),floattov10(0.1453),floattov10(0.8665)),
-	VERTEX_PACK(floattov16(-0.649611),floattov16(-0.485417)), VERTEX_PACK(floattov16(0.647081),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.723201),floattov16(-0.292118)), VERTEX_PACK(floattov16(0.67522),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.672782),floattov16(-0.365445)), VERTEX_PACK(floattov16(0.650626),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.03619),floattov16(0.16238)), VERTEX_PACK(floattov16(0.143073),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.09262),floattov16(0.034406)), VERTEX_PACK(floattov16(0.218651),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	NORMAL_PACK(floattov10(0.9336),floattov10(0.1282),floattov10(0.3345)),
-	VERTEX_PACK(floattov16(-0.872167),floattov16(-0.059267)), VERTEX_PACK(floattov16(0.524873),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.9336),floattov10(0.1282),floattov10(0.3345)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	NORMAL_PACK(floattov10(0.9336),floattov10(0.1282),floattov10(0.3345)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5942),floattov10(0.1082),floattov10(0.797)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.5942),floattov10(0.1082),floattov10(0.797)),
-	VERTEX_PACK(floattov16(-0.649611),floattov16(-0.485417)), VERTEX_PACK(floattov16(0.647081),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5942),floattov10(0.1082),floattov10(0.797)),
-	VERTEX_PACK(floattov16(-0.564568),floattov16(-0.553965)), VERTEX_PACK(floattov16(0.592984),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.419017),floattov16(-0.574871)), VERTEX_PACK(floattov16(0.478339),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.397491),floattov16(-0.544982)), VERTEX_PACK(floattov16(0.453839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6397),floattov10(0.1301),floattov10(0.7575)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.6397),floattov10(0.1301),floattov10(0.7575)),
-	VERTEX_PACK(floattov16(-0.564568),floattov16(-0.553965)), VERTEX_PACK(floattov16(0.592984),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6397),floattov10(0.1301),floattov10(0.7575)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	NORMAL_PACK(floattov10(0.4843),floattov10(0.7094),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4843),floattov10(0.7094),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.4843),floattov10(0.7094),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6148),floattov10(0.1019),floattov10(0.7821)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	NORMAL_PACK(floattov10(0.6148),floattov10(0.1019),floattov10(0.7821)),
-	VERTEX_PACK(floattov16(-0.397491),floattov16(-0.544982)), VERTEX_PACK(floattov16(0.453839),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6148),floattov10(0.1019),floattov10(0.7821)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	NORMAL_PACK(floattov10(0.625),floattov10(0.1177),floattov10(0.7717)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.625),floattov10(0.1177),floattov10(0.7717)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	NORMAL_PACK(floattov10(0.625),floattov10(0.1177),floattov10(0.7717)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6213),floattov10(0.0961),floattov10(0.7777)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.6213),floattov10(0.0961),floattov10(0.7777)),
-	VERTEX_PACK(floattov16(-0.477017),floattov16(-0.51717)), VERTEX_PACK(floattov16(0.51273),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6213),floattov10(0.0961),floattov10(0.7777)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.186304),floattov16(-0.591533)), VERTEX_PACK(floattov16(0.291206),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.130216),floattov16(-0.548295)), VERTEX_PACK(floattov16(0.235293),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.630946),floattov16(-0.371686)), VERTEX_PACK(floattov16(0.617727),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.423349),floattov16(-0.414273)), VERTEX_PACK(floattov16(0.457132),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0835),floattov10(0.7583)),
-	VERTEX_PACK(floattov16(-0.234976),floattov16(-0.576638)), VERTEX_PACK(floattov16(0.327734),0),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0835),floattov10(0.7583)),
-	VERTEX_PACK(floattov16(-0.130216),floattov16(-0.548295)), VERTEX_PACK(floattov16(0.235293),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0835),floattov10(0.7583)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	NORMAL_PACK(floattov10(0.1583),floattov10(0.7467),floattov10(0.6461)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1583),floattov10(0.7467),floattov10(0.6461)),
-	VERTEX_PACK(floattov16(-0.0568895),floattov16(-0.413175)), VERTEX_PACK(floattov16(0.156194),0),
-	NORMAL_PACK(floattov10(0.1583),floattov10(0.7467),floattov10(0.6461)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1102),floattov10(0.7333),floattov10(0.6709)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	NORMAL_PACK(floattov10(0.1102),floattov10(0.7333),floattov10(0.6709)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1102),floattov10(0.7333),floattov10(0.6709)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(0.2844),floattov10(0.8682),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2844),floattov10(0.8682),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.2844),floattov10(0.8682),floattov10(0.4066)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3973),floattov10(0.8462),floattov10(0.3551)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	NORMAL_PACK(floattov10(0.3973),floattov10(0.8462),floattov10(0.3551)),
-	VERTEX_PACK(floattov16(-0.097772),floattov16(-0.438561)), VERTEX_PACK(floattov16(0.195546),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3973),floattov10(0.8462),floattov10(0.3551)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	NORMAL_PACK(floattov10(0.0671),floattov10(0.67),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.0568895),floattov16(-0.413175)), VERTEX_PACK(floattov16(0.156194),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0671),floattov10(0.67),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	NORMAL_PACK(floattov10(0.0671),floattov10(0.67),floattov10(0.7393)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.50676),floattov16(0.789305)), VERTEX_PACK(floattov16(0.0556225),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.5251),floattov16(0.883819)), VERTEX_PACK(floattov16(0.049055),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.50676),floattov16(0.789305)), VERTEX_PACK(floattov16(0.0556225),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.32355),floattov16(0.838844)), VERTEX_PACK(floattov16(-0.106038),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.38741),floattov16(0.90608)), VERTEX_PACK(floattov16(-0.0690235),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.44061),floattov16(0.693636)), VERTEX_PACK(floattov16(0.0232355),0),
-	NORMAL_PACK(floattov10(0.5675),floattov10(0.6046),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(-1.27018),floattov16(0.651098)), VERTEX_PACK(floattov16(0.048536),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5675),floattov10(0.6046),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(-1.10971),floattov16(0.614443)), VERTEX_PACK(floattov16(-0.074743),0),
-	NORMAL_PACK(floattov10(0.5675),floattov10(0.6046),floattov10(0.5589)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.25579),floattov16(0.89053)), VERTEX_PACK(floattov16(-0.17346),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	NORMAL_PACK(floattov10(0.3789),floattov10(0.5309),floattov10(0.758)),
-	VERTEX_PACK(floattov16(-1.27185),floattov16(0.833703)), VERTEX_PACK(floattov16(-0.14728),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3789),floattov10(0.5309),floattov10(0.758)),
-	VERTEX_PACK(floattov16(-1.10971),floattov16(0.614443)), VERTEX_PACK(floattov16(-0.074743),0),
-	NORMAL_PACK(floattov10(0.3789),floattov10(0.5309),floattov10(0.758)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8926),floattov10(0.3603),floattov10(0.2711)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	NORMAL_PACK(floattov10(0.8926),floattov10(0.3603),floattov10(0.2711)),
-	VERTEX_PACK(floattov16(-1.10971),floattov16(0.614443)), VERTEX_PACK(floattov16(-0.074743),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8926),floattov10(0.3603),floattov10(0.2711)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.89865),floattov16(1.16035)), VERTEX_PACK(floattov16(-0.528226),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.956352),floattov16(1.11096)), VERTEX_PACK(floattov16(-0.469582),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.956352),floattov16(1.11096)), VERTEX_PACK(floattov16(-0.469582),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.12048),floattov16(0.927405)), VERTEX_PACK(floattov16(-0.292917),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.17406),floattov16(0.900201)), VERTEX_PACK(floattov16(-0.242736),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.911327),floattov16(1.03842)), VERTEX_PACK(floattov16(-0.489932),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.569227),floattov16(1.11414)), VERTEX_PACK(floattov16(-0.787953),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.775005),floattov16(0.887465)), VERTEX_PACK(floattov16(-0.567251),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.576469),floattov16(1.13699)), VERTEX_PACK(floattov16(-0.787238),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.00311),floattov16(0.947197)), VERTEX_PACK(floattov16(-0.393752),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	NORMAL_PACK(floattov10(0.6962),floattov10(0.7152),floattov10(0.0619)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6962),floattov10(0.7152),floattov10(0.0619)),
-	VERTEX_PACK(floattov16(0.111474),floattov16(-0.0984235)), VERTEX_PACK(floattov16(-0.273264),0),
-	NORMAL_PACK(floattov10(0.6962),floattov10(0.7152),floattov10(0.0619)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0684),floattov10(0.9374),floattov10(0.3416)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	NORMAL_PACK(floattov10(-0.0684),floattov10(0.9374),floattov10(0.3416)),
-	VERTEX_PACK(floattov16(0.097495),floattov16(-0.320404)), VERTEX_PACK(floattov16(-0.211011),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0684),floattov10(0.9374),floattov10(0.3416)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	NORMAL_PACK(floattov10(0.6451),floattov10(0.1191),floattov10(0.7548)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6451),floattov10(0.1191),floattov10(0.7548)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	NORMAL_PACK(floattov10(0.6451),floattov10(0.1191),floattov10(0.7548)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.034348),floattov16(-0.52992)), VERTEX_PACK(floattov16(0.096061),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.077134),floattov16(-0.566504)), VERTEX_PACK(floattov16(0.069324),0),
-	NORMAL_PACK(floattov10(0.7052),floattov10(0.0244),floattov10(0.7086)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7052),floattov10(0.0244),floattov10(0.7086)),
-	VERTEX_PACK(floattov16(0.0723625),floattov16(-0.446302)), VERTEX_PACK(floattov16(0.057719),0),
-	NORMAL_PACK(floattov10(0.7052),floattov10(0.0244),floattov10(0.7086)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.9812),floattov10(0.0799),floattov10(0.1759)),
-	VERTEX_PACK(floattov16(0.111474),floattov16(-0.0984235)), VERTEX_PACK(floattov16(-0.273264),0),
-	NORMAL_PACK(floattov10(0.9812),floattov10(0.0799),floattov10(0.1759)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.9812),floattov10(0.0799),floattov10(0.1759)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	NORMAL_PACK(floattov10(0.5866),floattov10(0.108),floattov10(0.8026)),
-	VERTEX_PACK(floattov16(0.118332),floattov16(-0.404965)), VERTEX_PACK(floattov16(0.0105435),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5866),floattov10(0.108),floattov10(0.8026)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	NORMAL_PACK(floattov10(0.5866),floattov10(0.108),floattov10(0.8026)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.082929),floattov16(-0.498427)), VERTEX_PACK(floattov16(0.0489945),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.077134),floattov16(-0.566504)), VERTEX_PACK(floattov16(0.069324),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	NORMAL_PACK(floattov10(0.6014),floattov10(0.1419),floattov10(0.7862)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6014),floattov10(0.1419),floattov10(0.7862)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	NORMAL_PACK(floattov10(0.6014),floattov10(0.1419),floattov10(0.7862)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5965),floattov10(0.0906),floattov10(0.7975)),
-	VERTEX_PACK(floattov16(0.284253),floattov16(-0.586448)), VERTEX_PACK(floattov16(-0.0960585),0),
-	NORMAL_PACK(floattov10(0.5965),floattov10(0.0906),floattov10(0.7975)),
-	VERTEX_PACK(floattov16(0.337027),floattov16(-0.619712)), VERTEX_PACK(floattov16(-0.131751),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5965),floattov10(0.0906),floattov10(0.7975)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(0.7352),floattov10(0.3809),floattov10(0.5607)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7352),floattov10(0.3809),floattov10(0.5607)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	NORMAL_PACK(floattov10(0.7352),floattov10(0.3809),floattov10(0.5607)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6221),floattov10(0.0854),floattov10(0.7782)),
-	VERTEX_PACK(floattov16(0.549534),floattov16(-0.616221)), VERTEX_PACK(floattov16(-0.306915),0),
-	NORMAL_PACK(floattov10(0.6221),floattov10(0.0854),floattov10(0.7782)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6221),floattov10(0.0854),floattov10(0.7782)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	NORMAL_PACK(floattov10(0.6006),floattov10(0.7586),floattov10(0.2525)),
-	VERTEX_PACK(floattov16(0.693951),floattov16(-0.417064)), VERTEX_PACK(floattov16(-0.458995),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6006),floattov10(0.7586),floattov10(0.2525)),
-	VERTEX_PACK(floattov16(0.693223),floattov16(-0.366939)), VERTEX_PACK(floattov16(-0.607826),0),
-	NORMAL_PACK(floattov10(0.6006),floattov10(0.7586),floattov10(0.2525)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3347),floattov10(0.9382),floattov10(0.0878)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.3347),floattov10(0.9382),floattov10(0.0878)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3347),floattov10(0.9382),floattov10(0.0878)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	NORMAL_PACK(floattov10(0.5679),floattov10(0.6489),floattov10(0.5063)),
-	VERTEX_PACK(floattov16(0.693223),floattov16(-0.366939)), VERTEX_PACK(floattov16(-0.607826),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5679),floattov10(0.6489),floattov10(0.5063)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.5679),floattov10(0.6489),floattov10(0.5063)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4072),floattov10(0.6026),floattov10(0.6864)),
-	VERTEX_PACK(floattov16(0.421183),floattov16(-0.593467)), VERTEX_PACK(floattov16(-0.206807),0),
-	NORMAL_PACK(floattov10(0.4072),floattov10(0.6026),floattov10(0.6864)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4072),floattov10(0.6026),floattov10(0.6864)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	NORMAL_PACK(floattov10(0.6206),floattov10(0.078),floattov10(0.7802)),
-	VERTEX_PACK(floattov16(0.147293),floattov16(-0.559707)), VERTEX_PACK(floattov16(0.010202),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6206),floattov10(0.078),floattov10(0.7802)),
-	VERTEX_PACK(floattov16(0.284253),floattov16(-0.586448)), VERTEX_PACK(floattov16(-0.0960585),0),
-	NORMAL_PACK(floattov10(0.6206),floattov10(0.078),floattov10(0.7802)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0775),floattov10(0.9547),floattov10(0.2874)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	NORMAL_PACK(floattov10(0.0775),floattov10(0.9547),floattov10(0.2874)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.0775),floattov10(0.9547),floattov10(0.2874)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.441986),floattov16(0.20195)), VERTEX_PACK(floattov16(-1.25357),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6747),floattov10(0.7324),floattov10(-0.0912)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	NORMAL_PACK(floattov10(0.6747),floattov10(0.7324),floattov10(-0.0912)),
-	VERTEX_PACK(floattov16(0.384223),floattov16(0.277504)), VERTEX_PACK(floattov16(-1.37888),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6747),floattov10(0.7324),floattov10(-0.0912)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.191792),floattov16(0.42032)), VERTEX_PACK(floattov16(-1.25365),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	NORMAL_PACK(floattov10(0.283),floattov10(0.617),floattov10(0.7343)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.283),floattov10(0.617),floattov10(0.7343)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	NORMAL_PACK(floattov10(0.283),floattov10(0.617),floattov10(0.7343)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.398621),floattov16(0.221246)), VERTEX_PACK(floattov16(-1.22241),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	NORMAL_PACK(floattov10(0.2926),floattov10(0.6176),floattov10(0.7301)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.2926),floattov10(0.6176),floattov10(0.7301)),
-	VERTEX_PACK(floattov16(0.419535),floattov16(0.261184)), VERTEX_PACK(floattov16(-1.2487),0),
-	NORMAL_PACK(floattov10(0.2926),floattov10(0.6176),floattov10(0.7301)),
-	VERTEX_PACK(floattov16(0.257977),floattov16(0.403121)), VERTEX_PACK(floattov16(-1.30403),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3073),floattov10(0.6573),floattov10(0.6882)),
-	VERTEX_PACK(floattov16(0.128045),floattov16(0.310665)), VERTEX_PACK(floattov16(-1.17626),0),
-	NORMAL_PACK(floattov10(0.3073),floattov10(0.6573),floattov10(0.6882)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3073),floattov10(0.6573),floattov10(0.6882)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	NORMAL_PACK(floattov10(0.3127),floattov10(0.6806),floattov10(0.6626)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3127),floattov10(0.6806),floattov10(0.6626)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	NORMAL_PACK(floattov10(0.3127),floattov10(0.6806),floattov10(0.6626)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.315506),floattov16(0.112026)), VERTEX_PACK(floattov16(-1.12922),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.33238),floattov16(0.201898)), VERTEX_PACK(floattov16(-1.16363),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.183993),floattov16(0.125494)), VERTEX_PACK(floattov16(-1.02439),0),
-	NORMAL_PACK(floattov10(0.7294),floattov10(0.6781),floattov10(-0.0907)),
-	VERTEX_PACK(floattov16(0.195852),floattov16(-0.36768)), VERTEX_PACK(floattov16(-0.061593),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7294),floattov10(0.6781),floattov10(-0.0907)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	NORMAL_PACK(floattov10(0.7294),floattov10(0.6781),floattov10(-0.0907)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3063),floattov10(0.659),floattov10(0.6869)),
-	VERTEX_PACK(floattov16(0.174511),floattov16(0.050473)), VERTEX_PACK(floattov16(-0.999451),0),
-	NORMAL_PACK(floattov10(0.3063),floattov10(0.659),floattov10(0.6869)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3063),floattov10(0.659),floattov10(0.6869)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	NORMAL_PACK(floattov10(0.8802),floattov10(0.416),floattov10(0.2285)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.8802),floattov10(0.416),floattov10(0.2285)),
-	VERTEX_PACK(floattov16(0.209937),floattov16(-0.149734)), VERTEX_PACK(floattov16(-0.796013),0),
-	NORMAL_PACK(floattov10(0.8802),floattov10(0.416),floattov10(0.2285)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1018),floattov10(0.8232),floattov10(0.5586)),
-	VERTEX_PACK(floattov16(0.441662),floattov16(-0.0517235)), VERTEX_PACK(floattov16(-1.02055),0),
-	NORMAL_PACK(floattov10(0.1018),floattov10(0.8232),floattov10(0.5586)),
-	VERTEX_PACK(floattov16(0.289618),floattov16(-0.129678)), VERTEX_PACK(floattov16(-0.877961),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1018),floattov10(0.8232),floattov10(0.5586)),
-	VERTEX_PACK(floattov16(0.702137),floattov16(-0.29222)), VERTEX_PACK(floattov16(-0.713579),0),
-	NORMAL_PACK(floattov10(0.5968),floattov10(0.6121),floattov10(0.5187)),
-	VERTEX_PACK(floattov16(0.209197),floattov16(-0.148325)), VERTEX_PACK(floattov16(-0.795729),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5968),floattov10(0.6121),floattov10(0.5187)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	NORMAL_PACK(floattov10(0.5968),floattov10(0.6121),floattov10(0.5187)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0588),floattov10(0.5066),floattov10(0.8602)),
-	VERTEX_PACK(floattov16(0.693951),floattov16(-0.417064)), VERTEX_PACK(floattov16(-0.458995),0),
-	NORMAL_PACK(floattov10(-0.0588),floattov10(0.5066),floattov10(0.8602)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0588),floattov10(0.5066),floattov10(0.8602)),
-	VERTEX_PACK(floattov16(0.647028),floattov16(-0.532858)), VERTEX_PACK(floattov16(-0.394003),0),
-	NORMAL_PACK(floattov10(0.3778),floattov10(0.7161),floattov10(0.5868)),
-	VERTEX_PACK(floattov16(0.309457),floattov16(-0.498345)), VERTEX_PACK(floattov16(-0.124915),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3778),floattov10(0.7161),floattov10(0.5868)),
-	VERTEX_PACK(floattov16(0.519041),floattov16(-0.239842)), VERTEX_PACK(floattov16(-0.575328),0),
-	NORMAL_PACK(floattov10(0.3778),floattov10(0.7161),floattov10(0.5868)),
-	VERTEX_PACK(floattov16(0.121522),floattov16(-0.310656)), VERTEX_PACK(floattov16(-0.232956),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.629),floattov10(0.4314),floattov10(0.6467)),
-	VERTEX_PACK(floattov16(0.158499),floattov16(0.06552)), VERTEX_PACK(floattov16(-0.989756),0),
-	NORMAL_PACK(floattov10(0.629),floattov10(0.4314),floattov10(0.6467)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.629),floattov10(0.4314),floattov10(0.6467)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.032187),floattov16(0.587946)), VERTEX_PACK(floattov16(-1.10822),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7195),floattov10(0.342),floattov10(0.6044)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	NORMAL_PACK(floattov10(0.7195),floattov10(0.342),floattov10(0.6044)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7195),floattov10(0.342),floattov10(0.6044)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	NORMAL_PACK(floattov10(0.7603),floattov10(0.2821),floattov10(0.5851)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7603),floattov10(0.2821),floattov10(0.5851)),
-	VERTEX_PACK(floattov16(-0.104195),floattov16(0.15667)), VERTEX_PACK(floattov16(-0.795062),0),
-	NORMAL_PACK(floattov10(0.7603),floattov10(0.2821),floattov10(0.5851)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.0635315),floattov16(0.45311)), VERTEX_PACK(floattov16(-1.15592),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(0.0235875),floattov16(0.514356)), VERTEX_PACK(floattov16(-1.13715),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.157065),floattov16(0.669169)), VERTEX_PACK(floattov16(-1.02434),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6907),floattov10(0.3673),floattov10(0.6229)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	NORMAL_PACK(floattov10(0.6907),floattov10(0.3673),floattov10(0.6229)),
-	VERTEX_PACK(floattov16(-0.0260175),floattov16(0.551392)), VERTEX_PACK(floattov16(-1.10492),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6907),floattov10(0.3673),floattov10(0.6229)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	NORMAL_PACK(floattov10(0.6413),floattov10(0.3874),floattov10(0.6624)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6413),floattov10(0.3874),floattov10(0.6624)),
-	VERTEX_PACK(floattov16(-0.128618),floattov16(0.202832)), VERTEX_PACK(floattov16(-0.785583),0),
-	NORMAL_PACK(floattov10(0.6413),floattov10(0.3874),floattov10(0.6624)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6179),floattov10(0.4008),floattov10(0.6764)),
-	VERTEX_PACK(floattov16(-0.144027),floattov16(0.645688)), VERTEX_PACK(floattov16(-1.02967),0),
-	NORMAL_PACK(floattov10(0.6179),floattov10(0.4008),floattov10(0.6764)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6179),floattov10(0.4008),floattov10(0.6764)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.533355),floattov16(0.583673)), VERTEX_PACK(floattov16(-0.696029),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5475),floattov10(0.4075),floattov10(0.7309)),
-	VERTEX_PACK(floattov16(-0.29928),floattov16(0.685407)), VERTEX_PACK(floattov16(-0.911367),0),
-	NORMAL_PACK(floattov10(0.5475),floattov10(0.4075),floattov10(0.7309)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5475),floattov10(0.4075),floattov10(0.7309)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	NORMAL_PACK(floattov10(0.4407),floattov10(0.7519),floattov10(0.4904)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4407),floattov10(0.7519),floattov10(0.4904)),
-	VERTEX_PACK(floattov16(-0.619591),floattov16(0.200683)), VERTEX_PACK(floattov16(-0.382239),0),
-	NORMAL_PACK(floattov10(0.4407),floattov10(0.7519),floattov10(0.4904)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.780825),floattov16(0.932521)), VERTEX_PACK(floattov16(-0.572782),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.643779),floattov16(0.804839)), VERTEX_PACK(floattov16(-0.656021),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.664702),floattov16(0.845528)), VERTEX_PACK(floattov16(-0.648162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.721956),floattov16(0.696926)), VERTEX_PACK(floattov16(-0.567187),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.664702),floattov16(0.845528)), VERTEX_PACK(floattov16(-0.648162),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	NORMAL_PACK(floattov10(0.4632),floattov10(0.3731),floattov10(0.8039)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4632),floattov10(0.3731),floattov10(0.8039)),
-	VERTEX_PACK(floattov16(-0.43166),floattov16(0.656667)), VERTEX_PACK(floattov16(-0.796171),0),
-	NORMAL_PACK(floattov10(0.4632),floattov10(0.3731),floattov10(0.8039)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4817),floattov10(0.5859),floattov10(0.6517)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	NORMAL_PACK(floattov10(0.4817),floattov10(0.5859),floattov10(0.6517)),
-	VERTEX_PACK(floattov16(-0.597001),floattov16(0.493572)), VERTEX_PACK(floattov16(-0.623194),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4817),floattov10(0.5859),floattov10(0.6517)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	NORMAL_PACK(floattov10(0.454),floattov10(0.3665),floattov10(0.8121)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.454),floattov10(0.3665),floattov10(0.8121)),
-	VERTEX_PACK(floattov16(-0.479955),floattov16(0.606525)), VERTEX_PACK(floattov16(-0.745072),0),
-	NORMAL_PACK(floattov10(0.454),floattov10(0.3665),floattov10(0.8121)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.685865),floattov16(0.772002)), VERTEX_PACK(floattov16(-0.613977),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.798277),floattov16(0.794315)), VERTEX_PACK(floattov16(-0.526845),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.619591),floattov16(0.200683)), VERTEX_PACK(floattov16(-0.382239),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.4057),floattov10(0.2786),floattov10(0.8705)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4057),floattov10(0.2786),floattov10(0.8705)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	NORMAL_PACK(floattov10(0.4057),floattov10(0.2786),floattov10(0.8705)),
-	VERTEX_PACK(floattov16(-0.202918),floattov16(0.233641)), VERTEX_PACK(floattov16(-0.731667),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.849771),floattov16(0.803979)), VERTEX_PACK(floattov16(-0.486804),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.784669),floattov16(0.863809)), VERTEX_PACK(floattov16(-0.553909),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.895177),floattov16(1.00988)), VERTEX_PACK(floattov16(-0.496653),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.663798),floattov16(0.544982)), VERTEX_PACK(floattov16(-0.580146),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.678464),floattov16(0.621215)), VERTEX_PACK(floattov16(-0.585553),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4056),floattov10(0.6807),floattov10(0.61)),
-	VERTEX_PACK(floattov16(-1.05528),floattov16(0.633372)), VERTEX_PACK(floattov16(-0.279151),0),
-	NORMAL_PACK(floattov10(0.4056),floattov10(0.6807),floattov10(0.61)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4056),floattov10(0.6807),floattov10(0.61)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	NORMAL_PACK(floattov10(0.7792),floattov10(0.4737),floattov10(0.4104)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.7792),floattov10(0.4737),floattov10(0.4104)),
-	VERTEX_PACK(floattov16(-0.663798),floattov16(0.544982)), VERTEX_PACK(floattov16(-0.580146),0),
-	NORMAL_PACK(floattov10(0.7792),floattov10(0.4737),floattov10(0.4104)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6318),floattov10(0.4883),floattov10(0.602)),
-	VERTEX_PACK(floattov16(-0.781003),floattov16(0.681498)), VERTEX_PACK(floattov16(-0.515208),0),
-	NORMAL_PACK(floattov10(0.6318),floattov10(0.4883),floattov10(0.602)),
-	VERTEX_PACK(floattov16(-0.942113),floattov16(0.478027)), VERTEX_PACK(floattov16(-0.181054),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6318),floattov10(0.4883),floattov10(0.602)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	NORMAL_PACK(floattov10(0.5879),floattov10(0.5337),floattov10(0.6079)),
-	VERTEX_PACK(floattov16(-0.573681),floattov16(0.496403)), VERTEX_PACK(floattov16(-0.642976),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.5879),floattov10(0.5337),floattov10(0.6079)),
-	VERTEX_PACK(floattov16(-0.595407),floattov16(0.261909)), VERTEX_PACK(floattov16(-0.416089),0),
-	NORMAL_PACK(floattov10(0.5879),floattov10(0.5337),floattov10(0.6079)),
-	VERTEX_PACK(floattov16(-0.217592),floattov16(0.176628)), VERTEX_PACK(floattov16(-0.706584),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0062),floattov10(0.4689),floattov10(0.8832)),
-	VERTEX_PACK(floattov16(0.0090965),floattov16(-0.187555)), VERTEX_PACK(floattov16(-0.087526),0),
-	NORMAL_PACK(floattov10(-0.0062),floattov10(0.4689),floattov10(0.8832)),
-	VERTEX_PACK(floattov16(-0.56038),floattov16(0.0631945)), VERTEX_PACK(floattov16(-0.224645),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(-0.0062),floattov10(0.4689),floattov10(0.8832)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.66),floattov16(0.204109)), VERTEX_PACK(floattov16(-0.349867),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.652816),floattov16(0.364279)), VERTEX_PACK(floattov16(-0.392404),0),
-	NORMAL_PACK(floattov10(0.6246),floattov10(0.1742),floattov10(0.7613)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6517),floattov10(0.6581),floattov10(0.3771)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	NORMAL_PACK(floattov10(0.6517),floattov10(0.6581),floattov10(0.3771)),
-	VERTEX_PACK(floattov16(-0.66),floattov16(0.204109)), VERTEX_PACK(floattov16(-0.349867),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.6517),floattov10(0.6581),floattov10(0.3771)),
-	VERTEX_PACK(floattov16(-0.941526),floattov16(0.372642)), VERTEX_PACK(floattov16(-0.157426),0),
-	NORMAL_PACK(floattov10(0.1548),floattov10(0.767),floattov10(0.6227)),
-	VERTEX_PACK(floattov16(-0.006842),floattov16(-0.359268)), VERTEX_PACK(floattov16(0.102797),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.1548),floattov10(0.767),floattov10(0.6227)),
-	VERTEX_PACK(floattov16(-0.585788),floattov16(-0.0063955)), VERTEX_PACK(floattov16(-0.187877),0),
-	NORMAL_PACK(floattov10(0.1548),floattov10(0.767),floattov10(0.6227)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3576),floattov10(0.2751),floattov10(0.8924)),
-	VERTEX_PACK(floattov16(-0.669222),floattov16(-0.0052535)), VERTEX_PACK(floattov16(-0.119679),0),
-	NORMAL_PACK(floattov10(0.3576),floattov10(0.2751),floattov10(0.8924)),
-	VERTEX_PACK(floattov16(-0.652268),floattov16(0.0842605)), VERTEX_PACK(floattov16(-0.154069),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.3576),floattov10(0.2751),floattov10(0.8924)),
-	VERTEX_PACK(floattov16(-1.02663),floattov16(0.305256)), VERTEX_PACK(floattov16(-0.0721805),0),
-	NORMAL_PACK(floattov10(0.4913),floattov10(0.8189),floattov10(0.2967)),
-	VERTEX_PACK(floattov16(-0.399965),floattov16(-0.396717)), VERTEX_PACK(floattov16(0.433929),0),
-	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_NORMAL, FIFO_VERTEX16),
-	NORMAL_PACK(floattov10(0.4913),floattov10(0.8189),floattov10(0.2967)),
-	VERTEX_PACK(floattov16(-0.64257),floattov16(-0.0507215)), VERTEX_PACK(floattov16(-0.119166),0),
-	NORMAL_PACK(floattov10(0.4913),floattov10(0.8189),floattov10(0.2967)),
-	VERTEX_PACK(floattov16(-0.864522),floattov16(-0.156745)), VERTEX_PACK(floattov16(0.540901),0)
+	1756,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x00000002, 0x1518fcb9, 0x0000fa7e, 0x12eff779, 0x00000092, 0x376909a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xee20d2ab, 0x0000dbc4, 0x376909a8, 0xf04ad7eb, 0x0000d5b0, 0x1518fcb9, 0x0000fa7e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x12eff779, 0x00000092, 0x00000002, 0x1518fcb9, 0x0000fa7e, 0x1131f921, 0x00000008,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xec62d453, 0x0000db3a, 0xea2dd55c, 0x0000d9ad, 0xe6f6d3ea, 0x0000d8c7, 0xe3d9d5ff, 0x0000d91c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe353d365, 0x0000d97c, 0xdde1d3f1, 0x0000dcf2, 0xdb55cf66, 0x0000ddd0, 0xdb99d41a, 0x0000dd92,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x366d5f4b, 0xda19d528, 0x0000d714, 0xd3ead3c4, 0x0000d5be, 0xd564d5f1, 0x0000d74e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xd1bdd24c, 0x0000d69f, 0x368d274e, 0x36fd4f38, 0xd362ce93, 0x0000dfca,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd34ecb90, 0x0000dc2b, 0xd355cb60, 0x0000de74, 0xf823f02f, 0x00000342, 0xf831f361, 0x00000498,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xf81df05f, 0x000000fa, 0xf98ef2c5, 0x00000091, 0x0f050c44, 0xf8b8f893, 0x0000fa8c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xfe67f302, 0x00000088, 0xd3ead3c4, 0x0000d5be, 0xd998ce34, 0x0000dbb9, 0x373d6339,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd9b3cd52, 0x0000df90, 0xd54acd7f, 0x0000e056, 0xd9eaccbd, 0x0000e291, 0xd59dcf30, 0x0000e5e8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xdaa3cefd, 0x0000e677, 0xfa6cf3fe, 0x00000ab6, 0x02dffbcf, 0xfeb8f18b, 0x0000075f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x041cf4f6, 0x000009a4, 0xd9eaccbd, 0x0000e291, 0xdf4ed028, 0x0000e4d6, 0xdaa3cefd, 0x0000e677,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x02dffbcf, 0x00000002, 0xd1bdd24c, 0x0000d69f, 0x36fd4f38,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX10),
+	0xd3ead3c4, 0x0000d5be, 0x373d6339, 0x00000002, 0x36fd4f38,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd34ecb90, 0x0000dc2b, 0x373d6339, 0xd54acd7f, 0x0000e056, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf823f02f, 0x00000342, 0xf81df05f, 0x000000fa, 0xd34ecb90, 0x0000dc2b, 0xd54acd7f, 0x0000e056,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0xd3ead3c4, 0x0000d5be, 0xf8b8f893, 0x0000fa8c, 0x366d5f4b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfa9af796, 0x0000fe5d, 0xdb55cf66, 0x0000ddd0, 0x0024f435, 0x0000029e, 0xd998ce34, 0x0000dbb9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfe67f302, 0x00000088, 0x00000002, 0xd998ce34, 0x0000dbb9, 0xd9b3cd52, 0x0000df90,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xdb55cf66, 0x0000ddd0, 0xe353d365, 0x0000d97c, 0x00000002, 0xd355cb60, 0x0000de74,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xd362ce93, 0x0000dfca, 0xf831f361, 0x00000498, 0x08c79eec, 0xf77df59d, 0x000008bf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfa6cf3fe, 0x00000ab6, 0xd59dcf30, 0x0000e5e8, 0x00000002, 0xfa6cf3fe, 0x00000ab6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfa18f24d, 0x00000524, 0xfeb8f18b, 0x0000075f, 0xfe81f220, 0x0000045e, 0x040df2ea, 0x000006dc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a6af641, 0x000002b2, 0xe59cd173, 0x0000dde3, 0xe5ecd2ba, 0x0000e032, 0xe4e1cd21, 0x0000e361,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x38ae6b4c, 0xe694ce12, 0x0000eada, 0x01d0b7df, 0x0b63f2e0, 0x00000fa9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0x0b51efb4, 0x00000c68, 0x0c58f2ac, 0x00000a39, 0xe789cdde, 0x0000e56b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xe80cd059, 0x0000dbcb, 0xe4e1cd21, 0x0000e361, 0x368e5746, 0xe59cd173, 0x0000dde3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe353d365, 0x0000d97c, 0xd9b3cd52, 0x0000df90, 0x00000002, 0xe353d365, 0x0000d97c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x07b7da13, 0xe6f6d3ea, 0x0000d8c7, 0xe87cd29b, 0x0000d6ba, 0x2915d945,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xebced1ca, 0x0000d85b, 0x109cf698, 0x0000fd2a, 0x12eff779, 0x00000092, 0x1157f533, 0x00000164,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01b123d0, 0x0ddff30f, 0x000003c3, 0x11acf3d9, 0x000008d7, 0x1284f0e4, 0x00000b9e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xecdecf0b, 0x0000e409, 0xedb6cc16, 0x0000e6d0, 0xe911ce40, 0x0000def5, 0xea07cc9e, 0x0000e428,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xe80cd059, 0x0000dbcb, 0x381e9f46, 0x330a7390, 0x0d2ef5da, 0x0000043e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0cdaf527, 0x00000099, 0x0e93f64a, 0x0000050f, 0x0ed5f16c, 0x000008f6, 0x1231f363, 0x00000e0d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x1284f0e4, 0x00000b9e, 0xedb6cc16, 0x0000e6d0, 0x00000002, 0x1284f0e4, 0x00000b9e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0ed5f16c, 0x000008f6, 0x0ddff30f, 0x000003c3, 0x0cdaf527, 0x00000099, 0x1157f533, 0x00000164,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x109cf698, 0x0000fd2a, 0x00000002, 0x368e5746, 0xe80cd059, 0x0000dbcb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe87cd29b, 0x0000d6ba, 0xebced1ca, 0x0000d85b, 0x00000002, 0x0d2ef5da, 0x0000043e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0d159470, 0x381e9f46, 0xe946d4e5, 0x0000e0a8, 0xea63d077, 0x0000e6f9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0e14f9b3, 0x00000577, 0x02f0f7d5, 0x0e93f64a, 0x0000050f, 0x1231f363, 0x00000e0d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe860d10c, 0x0000df70, 0xe80cd059, 0x0000dbcb, 0x0cdaf527, 0x00000099,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0c58f2ac, 0x00000a39, 0x09aff1f0, 0x00000830, 0x00000002, 0xf77df59d, 0x000008bf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6fdf7b4, 0x0000079f, 0xf831f361, 0x00000498, 0xf714f84e, 0x0000fed5, 0xf98ef2c5, 0x00000091,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf68cf71a, 0x0000fb6e, 0xf8b8f893, 0x0000fa8c, 0xfa33fabf, 0x0000fc1d, 0xfee7f9f6, 0x0000fbe3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x06a8ff81, 0x0000f794, 0x0a5100b8, 0x0000f636, 0x3da05c0a, 0x07a605bb, 0x0000f3af,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02de030e, 0x0000f4cc, 0xfdcf02eb, 0x0000f4db, 0xfb560152, 0x0000f5c4, 0xfa6d03da, 0x0000f471,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf68a01a2, 0x0000f234, 0xf82b03e7, 0x0000f43a, 0xf816003c, 0x0000f3e7, 0xfc10ffc8, 0x0000f821,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfb560152, 0x0000f5c4, 0x02de030e, 0x0000f4cc, 0x00000002, 0xf8b8f893, 0x0000fa8c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfee7f9f6, 0x0000fbe3, 0xfa9af796, 0x0000fe5d, 0x0067f8e8, 0x00000260, 0x0024f435, 0x0000029e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02aff8bf, 0x000001c0, 0x0822f833, 0x0000fe4a, 0x08a7facd, 0x0000fdea, 0x0bc4f8b9, 0x0000fd95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0efcfa2a, 0x0000fe7b, 0x1131f921, 0x00000008, 0xea2dd55c, 0x0000d9ad, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf68cf71a, 0x0000fb6e, 0xf714f84e, 0x0000fed5, 0xfa33fabf, 0x0000fc1d, 0xf722fb16, 0x0000fe41,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3e8023fd, 0xfab6fee9, 0x0000ffd0, 0x04f5016b, 0x0000face, 0xd5e8da1b, 0x0000db02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xe027dc9d, 0x0000d5ff, 0xdd28da63, 0x0000d540, 0x3e8023fd, 0x04ac0343, 0x0000f968,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16),
+	0x06a8ff81, 0x0000f794, 0x3da05c0a, 0x00000002, 0xf714f84e, 0x0000fed5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6fdf7b4, 0x0000079f, 0xf722fb16, 0x0000fe41, 0xf78cfc7d, 0x00000499, 0xfab6fee9, 0x0000ffd0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd2bed7af, 0x0000dfca, 0xd5e8da1b, 0x0000db02, 0xd253d648, 0x0000d973, 0xdd28da63, 0x0000d540,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd564d5f1, 0x0000d74e, 0xe1dadab3, 0x0000d2c5, 0xda19d528, 0x0000d714, 0xe582dbe9, 0x0000d168,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe550d8e5, 0x0000d4df, 0xe7b1d9ca, 0x0000d6e3, 0xda19d528, 0x0000d714, 0xdc5ad4f0, 0x0000dc5b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x137cff2a, 0x0067f8e8, 0x00000260, 0x02aff8bf, 0x000001c0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xd564d5f1, 0x0000d74e, 0xd253d648, 0x0000d973, 0x368d274e, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd362ce93, 0x0000dfca, 0xd2afd0cf, 0x0000e3f1, 0xd54acd7f, 0x0000e056, 0xd59dcf30, 0x0000e5e8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd253d648, 0x0000d973, 0xd2bed7af, 0x0000dfca, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX10),
+	0xf78cfc7d, 0x00000499, 0xf6fdf7b4, 0x0000079f, 0x00000002, 0x3da05c0a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x04ac0343, 0x0000f968, 0x02de030e, 0x0000f4cc, 0xfc10ffc8, 0x0000f821, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd362ce93, 0x0000dfca, 0x08c7a2ec, 0xfa18f24d, 0x00000524, 0xf81df05f, 0x000000fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfad1f309, 0x00000181, 0x00000002, 0xfa18f24d, 0x00000524, 0xfad1f309, 0x00000181,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xfe81f220, 0x0000045e, 0xfe67f302, 0x00000088, 0x0024f435, 0x0000029e, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0024f435, 0x0000029e, 0x0822f833, 0x0000fe4a, 0xfe81f220, 0x0000045e, 0x0a6af641, 0x000002b2,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xea2dd55c, 0x0000d9ad, 0x0efcfa2a, 0x0000fe7b, 0xe3d9d5ff, 0x0000d91c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x08a7facd, 0x0000fdea, 0xdde1d3f1, 0x0000dcf2, 0x02aff8bf, 0x000001c0, 0xdb99d41a, 0x0000dd92,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd59dcf30, 0x0000e5e8, 0xd2afd0cf, 0x0000e3f1, 0xf77df59d, 0x000008bf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6fdf7b4, 0x0000079f, 0x00000002, 0x1131f921, 0x00000008, 0xec62d453, 0x0000db3a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0bc4f8b9, 0x0000fd95, 0xe6f6d3ea, 0x0000d8c7, 0x0ec0f8ae, 0x0000fa19, 0xe9f2d3e0, 0x0000d54b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x109cf698, 0x0000fd2a, 0x00000002, 0xfa6d03da, 0x0000f471, 0xf82b03e7, 0x0000f43a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6510870, 0x0000f463, 0xf6070342, 0x0000f82f, 0xf69b0a4b, 0x0000f801, 0xf65d0321, 0x0000fc54,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6990a6f, 0x0000fd0f, 0x3f9f7814, 0xd2b6e024, 0x0000d975, 0xd659e241, 0x0000d950,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xd3dee242, 0x0000db68, 0xfb27070f, 0x0000fe1e, 0xf8ac0710, 0x00000036, 0x3f9f7814,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xf73f055f, 0x0000014f, 0xf8180253, 0x0000fe71, 0x010f7c0f, 0xf983026d, 0x000001e0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xd4b5dd9f, 0x0000dd11, 0xd34add85, 0x0000d9a3, 0xd2f8deee, 0x0000df3b, 0x372d2b82,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0xf73f055f, 0x0000014f, 0x2e75b5b1, 0x00000002, 0xd4b5dd9f, 0x0000dd11,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd2f8deee, 0x0000df3b, 0x010f7c0f, 0xf73f055f, 0x0000014f, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf983026d, 0x000001e0, 0xf8180253, 0x0000fe71, 0xd34add85, 0x0000d9a3, 0xd643deb7, 0x0000dae6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd499dbc8, 0x0000d6dd, 0xd7fdddda, 0x0000d824, 0xfccb02a8, 0x0000fcf2, 0xfc920506, 0x0000fcb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfec10687, 0x0000fe66, 0xd7c4e037, 0x0000d7e9, 0xd9f3e1b9, 0x0000d997, 0xd7fdddda, 0x0000d824,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfccb02a8, 0x0000fcf2, 0xfb110385, 0x0000ffb4, 0xf9670096, 0x0000fbac, 0xf8180253, 0x0000fe71,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX_DIFF),
+	0x3f9f7814, 0x00000002, 0x3f9f7814, 0x211b662f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xf9670096, 0x0000fbac, 0xf6070342, 0x0000f82f, 0xf82b03e7, 0x0000f43a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf82b03e7, 0x0000f43a, 0xfc10ffc8, 0x0000f821, 0xf9670096, 0x0000fbac, 0xfe0d00ac, 0x0000fb58,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xd93fdbdd, 0x0000d68a, 0xdfdede74, 0x0000d49a, 0xd742dafa, 0x0000d353, 0x340de379,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x344d6b72, 0xd901de1d, 0x0000d00c, 0xd59edf0c, 0x0000cfa2, 0xd321e45c, 0x0000d071,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x32498b46, 0xf7ef092b, 0x0000f53f, 0x32498b45, 0xfa6d03da, 0x0000f471,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xfa6d03da, 0x0000f471, 0xf7ef092b, 0x0000f53f, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd321e45c, 0x0000d071, 0xd901de1d, 0x0000d00c, 0x00000002, 0xfc10ffc8, 0x0000f821,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x04ac0343, 0x0000f968, 0xfe0d00ac, 0x0000fb58, 0xdfdede74, 0x0000d49a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xf8ac0710, 0x00000036, 0x372d2b82, 0x2e75b5b2, 0xd2b6e024, 0x0000d975,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x372d2b82, 0xd34add85, 0x0000d9a3, 0xd2b6e024, 0x0000d975,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xd499dbc8, 0x0000d6dd, 0xd18fde53, 0x0000d786, 0xd138de73, 0x0000d361, 0x34dd1f96,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd183e3a2, 0x0000cf95, 0xf6510870, 0x0000f463, 0x00000002, 0xf6510870, 0x0000f463,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf69b0a4b, 0x0000f801, 0x34dd1f96, 0xd1cae5a1, 0x0000d841, 0xd18fde53, 0x0000d786,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x1ef49dd1, 0x00000002, 0xf8180253, 0x0000fe71, 0xfb110385, 0x0000ffb4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd643deb7, 0x0000dae6, 0xd7fdddda, 0x0000d824, 0x00000002, 0xfccb02a8, 0x0000fcf2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf9670096, 0x0000fbac, 0xd499dbc8, 0x0000d6dd, 0xd93fdbdd, 0x0000d68a, 0xd742dafa, 0x0000d353,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd183e3a2, 0x0000cf95, 0xd35cdf18, 0x0000cf6c, 0xd59edf0c, 0x0000cfa2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd1bcdcd4, 0x0000cd66, 0x344d6b72, 0xd347db6e, 0x0000cf18, 0xd742dafa, 0x0000d353,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd35cdf18, 0x0000cf6c, 0xd499dbc8, 0x0000d6dd, 0xd138de73, 0x0000d361, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xebced1ca, 0x0000d85b, 0xe80cd059, 0x0000dbcb, 0xec89d065, 0x0000dc95, 0xe911ce40, 0x0000def5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x388ed73d, 0xecdecf0b, 0x0000e409, 0x11acf3d9, 0x000008d7, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x11acf3d9, 0x000008d7, 0x01b123d0, 0x388ed73d, 0xee20d2ab, 0x0000dbc4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xec89d065, 0x0000dc95, 0xebced1ca, 0x0000d85b, 0x00000002, 0x0ec0f8ae, 0x0000fa19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x109cf698, 0x0000fd2a, 0x0d4bf769, 0x0000fb88, 0x0cdaf527, 0x00000099, 0x0a17f647, 0x0000fec6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0x0a6af641, 0x000002b2, 0x0140afde, 0xe5ecd2ba, 0x0000e032,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX10),
+	0xe536d4f3, 0x0000dfae, 0x38ae6b4c, 0x0120a3e7, 0x01d0b7df,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0140afde, 0x09aff1f0, 0x00000830, 0x00000002, 0x0a6af641, 0x000002b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0822f833, 0x0000fe4a, 0x07c7d614, 0x0bc4f8b9, 0x0000fd95, 0x0d4bf769, 0x0000fb88,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x2915d545, 0x00000002, 0xe59cd173, 0x0000dde3, 0xd9b3cd52, 0x0000df90,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xdf3ece1b, 0x0000e20e, 0xd9eaccbd, 0x0000e291, 0xfeb8f18b, 0x0000075f, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe59cd173, 0x0000dde3, 0xdf3ece1b, 0x0000e20e, 0x040df2ea, 0x000006dc, 0xfeb8f18b, 0x0000075f,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe1dadab3, 0x0000d2c5, 0xe582dbe9, 0x0000d168, 0xe0ffddb3, 0x0000d1a9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe2d8e0ed, 0x0000cee0, 0x340de379, 0xd901de1d, 0x0000d00c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x340de379, 0xdfdede74, 0x0000d49a, 0xe0ffddb3, 0x0000d1a9, 0xe1dadab3, 0x0000d2c5,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe1dadab3, 0x0000d2c5, 0xdfdede74, 0x0000d49a, 0xdd28da63, 0x0000d540,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x04ac0343, 0x0000f968, 0x00000002, 0xfdcf02eb, 0x0000f4db, 0x02f10668, 0x0000f3d8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x07a605bb, 0x0000f3af, 0x02f80893, 0x0000f5ac, 0x081208c0, 0x0000f4e4, 0x283b54ad,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09ad0af0, 0x0000f619, 0x08220e37, 0x0000f36b, 0xe354e968, 0x0000ce9d, 0xe0e7e60e, 0x0000d01a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x27f4ca90, 0xd8ace6fc, 0x0000d1b0, 0xde2ae3c4, 0x0000d0de, 0xd81fe4a8, 0x0000d4d4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xd881e66f, 0x0000d7e3, 0xfced0977, 0x0000f9a2, 0x3f3fd42d, 0x02f80893, 0x0000f5ac,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x081208c0, 0x0000f4e4, 0xde2ae3c4, 0x0000d0de, 0xe344e3f2, 0x0000d016, 0xd881e66f, 0x0000d7e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3f3fd42d, 0x00000002, 0x02f10668, 0x0000f3d8, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02f80893, 0x0000f5ac, 0xfcb606a3, 0x0000f913, 0xd7e8e1d5, 0x0000d445, 0xd901de1d, 0x0000d00c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xde2ae3c4, 0x0000d0de, 0xde23e19a, 0x0000cf09, 0xe2d8e0ed, 0x0000cee0, 0xd901de1d, 0x0000d00c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0xd8ace6fc, 0x0000d1b0, 0xe0e7e60e, 0x0000d01a, 0x34bdb7a3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x05b60adc, 0x0000f4e8, 0xffff0d8d, 0x0000f79b, 0x3dafd82f, 0xfb0b0dc5, 0x0000f963,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf9ec0b1d, 0x0000f73e, 0xf6990a6f, 0x0000fd0f, 0xd51de64e, 0x0000d270, 0xd1cae5a1, 0x0000d841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd63ce8f7, 0x0000d495, 0xfb0b0dc5, 0x0000f963, 0xffff0d8d, 0x0000f79b, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xffff0d8d, 0x0000f79b, 0xd63ce8f7, 0x0000d495, 0x34bdb7a3, 0xd8ace6fc, 0x0000d1b0,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd63ce8f7, 0x0000d495, 0xd51de64e, 0x0000d270, 0xd8ace6fc, 0x0000d1b0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd81fe4a8, 0x0000d4d4, 0x00000002, 0xd51de64e, 0x0000d270, 0xf9ec0b1d, 0x0000f73e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd81fe4a8, 0x0000d4d4, 0xfced0977, 0x0000f9a2, 0x00000002, 0xf9ec0b1d, 0x0000f73e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x3dafd82f, 0xfced0977, 0x0000f9a2, 0x02f80893, 0x0000f5ac, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x02f80893, 0x0000f5ac, 0x3dafd82f, 0x06e7096d, 0x0000f367, 0x181b3d6f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x08220e37, 0x0000f36b, 0xe0e7e60e, 0x0000d01a, 0x00000002, 0xde2ae3c4, 0x0000d0de,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe2d8e0ed, 0x0000cee0, 0xe344e3f2, 0x0000d016, 0xe724e17b, 0x0000d186, 0x0bf2064a, 0x0000f654,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0ddf00a4, 0x0000fa0f, 0x0a5100b8, 0x0000f636, 0x0c7ffe98, 0x0000fbb1, 0x0a1efdb4, 0x0000f9ad,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfee7f9f6, 0x0000fbe3, 0x0a5100b8, 0x0000f636, 0x00000002, 0xde2ae3c4, 0x0000d0de,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe344e3f2, 0x0000d016, 0x283b54ac, 0xe4dfe621, 0x0000d14a, 0xe354e968, 0x0000ce9d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09ad0af0, 0x0000f619, 0x00000002, 0x0a5100b8, 0x0000f636, 0x07a605bb, 0x0000f3af,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0bf2064a, 0x0000f654, 0x081208c0, 0x0000f4e4, 0xe344e3f2, 0x0000d016, 0xe4dfe621, 0x0000d14a,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe2d8e0ed, 0x0000cee0, 0xe582dbe9, 0x0000d168, 0xe724e17b, 0x0000d186,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe911dbd6, 0x0000d540, 0x0ddf00a4, 0x0000fa0f, 0x0c7ffe98, 0x0000fbb1, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe582dbe9, 0x0000d168, 0xe7b1d9ca, 0x0000d6e3, 0xe911dbd6, 0x0000d540, 0x0c7ffe98, 0x0000fbb1,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xedb6cc16, 0x0000e6d0, 0xea07cc9e, 0x0000e428, 0xed62ce95, 0x0000e93f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x381e9f46, 0xea63d077, 0x0000e6f9, 0x00000002, 0xea63d077, 0x0000e6f9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02f0f7d5, 0xed62ce95, 0x0000e93f, 0x1231f363, 0x00000e0d, 0xedb6cc16, 0x0000e6d0,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xfee7f9f6, 0x0000fbe3, 0x0c7ffe98, 0x0000fbb1, 0x0128f9be, 0x00000129,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe7b1d9ca, 0x0000d6e3, 0xdc5ad4f0, 0x0000dc5b, 0x00000002, 0xfee7f9f6, 0x0000fbe3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0128f9be, 0x00000129, 0x137cff2a, 0xdc5ad4f0, 0x0000dc5b, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe789cdde, 0x0000e56b, 0xe4e1cd21, 0x0000e361, 0xe683cae5, 0x0000e79a, 0xe694ce12, 0x0000eada,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0b63f2e0, 0x00000fa9, 0x00000002, 0x0b63f2e0, 0x00000fa9, 0x0b51efb4, 0x00000c68,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe683cae5, 0x0000e79a, 0xe789cdde, 0x0000e56b, 0x00000002, 0x0e93f64a, 0x0000050f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x0e14f9b3, 0x00000577, 0xe946d4e5, 0x0000e0a8, 0xe65fd69c, 0x0000dc1f, 0x11b388b4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0b2dfb6b, 0x000000ed, 0x11b38cb3, 0x0e14f9b3, 0x00000577, 0xe946d4e5, 0x0000e0a8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd2afd0cf, 0x0000e3f1, 0xd22fd2e6, 0x0000e2d0, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02bf9fdc, 0xf771f8ad, 0x00000d65, 0xfc98f6c6, 0x00000b23, 0xfb8efa30, 0x00000f5a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7cad1f8, 0x0000e654, 0xd6c0d562, 0x0000ea8b, 0xd2a3d3df, 0x0000e897, 0xf771f8ad, 0x00000d65,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf751fb1b, 0x00000b9c, 0xf6fdf7b4, 0x0000079f, 0xfa4afbde, 0x000009a8, 0xd57cd710, 0x0000e4d9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd2bed7af, 0x0000dfca, 0xd24cda62, 0x0000e27d, 0xd1fdd995, 0x0000deee, 0xf6ccfe63, 0x000003bc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf930005d, 0x0000047c, 0xfc0afee3, 0x00000252, 0xd462db8e, 0x0000dfad, 0xd73cda15, 0x0000dd83,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd1fdd995, 0x0000deee, 0x0dc3061a, 0x00000002, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xd57cd710, 0x0000e4d9, 0xd22fd2e6, 0x0000e2d0, 0x39bd2b59, 0xd2a3d3df, 0x0000e897,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xf751fb1b, 0x00000b9c, 0x00000002, 0xf751fb1b, 0x00000b9c, 0x39bd2b59,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfa4afbde, 0x000009a8, 0xd57cd710, 0x0000e4d9, 0xf71bff31, 0x0000074b, 0xd24cda62, 0x0000e27d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6ccfe63, 0x000003bc, 0x00000002, 0xf71bff31, 0x0000074b, 0xf6ccfe63, 0x000003bc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0dd3021a, 0xfc0afee3, 0x00000252, 0xd73cda15, 0x0000dd83, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf71bff31, 0x0000074b, 0xf78cfc7d, 0x00000499, 0xfa4afbde, 0x000009a8, 0xd2bed7af, 0x0000dfca,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd22fd2e6, 0x0000e2d0, 0xd2a3d3df, 0x0000e897, 0xd4e8d23f, 0x0000e5f1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd7cad1f8, 0x0000e654, 0xfc98f6c6, 0x00000b23, 0x00000002, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd4e8d23f, 0x0000e5f1, 0x02bf9fdc, 0xfc98f6c6, 0x00000b23, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xebced1ca, 0x0000d85b, 0xee20d2ab, 0x0000dbc4, 0x12eff779, 0x00000092, 0x01b123d0,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x0e14f9b3, 0x00000577, 0x0b2dfb6b, 0x000000ed, 0xe65fd69c, 0x0000dc1f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xec8ed5d7, 0x0000de42, 0xeaafd721, 0x0000db7d, 0x115cfaa5, 0x00000311, 0x0f7dfbef, 0x0000004c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0b2dfb6b, 0x000000ed, 0xe65fd69c, 0x0000dc1f, 0x00000002, 0xfb0b0dc5, 0x0000f963,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xf6990a6f, 0x0000fd0f, 0xd1cae5a1, 0x0000d841, 0xd2b6e024, 0x0000d975, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3f9f7814, 0xfb27070f, 0x0000fe1e, 0xd659e241, 0x0000d950, 0xd9f3e1b9, 0x0000d997,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb1fe461, 0x0000d96d, 0xdcd2e1c6, 0x0000d9fb, 0xe0e3e152, 0x0000d7f8, 0x01a10695, 0x0000fec9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x05b10620, 0x0000fcc6, 0xffee0930, 0x0000fe3b, 0xdb1fe461, 0x0000d96d, 0xd659e241, 0x0000d950,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd659e241, 0x0000d950, 0xffee0930, 0x0000fe3b, 0xfb27070f, 0x0000fe1e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xfec10687, 0x0000fe66, 0xd9f3e1b9, 0x0000d997, 0xd9c8e3d2, 0x0000dd0d, 0x36fdd38f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfe9708a1, 0x000001db, 0x01bf088a, 0x0000009e, 0xfec10687, 0x0000fe66, 0x01a10695, 0x0000fec9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xffee0930, 0x0000fe3b, 0x00000002, 0xd9f3e1b9, 0x0000d997, 0x36fdd38f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x22cf860b, 0x01bf088a, 0x0000009e, 0x22bf8a0b, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfec10687, 0x0000fe66, 0xfe9708a1, 0x000001db, 0xd9c8e3d2, 0x0000dd0d, 0xd485e07e, 0x0000da2f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x372d2b82, 0xf953054c, 0x0000fefd, 0xf73f055f, 0x0000014f, 0xfe9708a1, 0x000001db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd9c8e3d2, 0x0000dd0d, 0x00000002, 0x04ac0343, 0x0000f968, 0x08af0351, 0x0000fcd6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x05eb0591, 0x0000fb17, 0xe3e1de82, 0x0000d808, 0xe11de0c2, 0x0000d648, 0xdfdede74, 0x0000d49a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX10),
+	0x04ac0343, 0x0000f968, 0x08af0351, 0x0000fcd6, 0x00000000, 0x02dffbcf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x041cf4f6, 0x000009a4, 0xdf4ed028, 0x0000e4d6, 0xf816003c, 0x0000f3e7, 0x24d9d166,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfb560152, 0x0000f5c4, 0x3e8023fd, 0x06a8ff81, 0x0000f794, 0xfa33fabf, 0x0000fc1d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3e8023fd, 0x04f5016b, 0x0000face, 0xe027dc9d, 0x0000d5ff, 0xfc920506, 0x0000fcb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7fdddda, 0x0000d824, 0xd7c4e037, 0x0000d7e9, 0xd35cdf18, 0x0000cf6c, 0xd347db6e, 0x0000cf18,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x24e9d566, 0xd183e3a2, 0x0000cf95, 0xd138de73, 0x0000d361, 0xd35cdf18, 0x0000cf6c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0140afde, 0x0120a3e7, 0xe536d4f3, 0x0000dfae, 0xfcb606a3, 0x0000f913,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfdcf02eb, 0x0000f4db, 0xd901de1d, 0x0000d00c, 0x02f80893, 0x0000f5ac, 0xd7e8e1d5, 0x0000d445,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xde2ae3c4, 0x0000d0de, 0x3f3fd42d, 0x081208c0, 0x0000f4e4, 0xe344e3f2, 0x0000d016,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x081208c0, 0x0000f4e4, 0x09ad0af0, 0x0000f619, 0xe4dfe621, 0x0000d14a, 0x0c10fc1e, 0x00000208,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe946d4e5, 0x0000e0a8, 0x375e775d, 0xf930005d, 0x0000047c, 0xd1fdd995, 0x0000deee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd462db8e, 0x0000dfad, 0xf771f8ad, 0x00000d65, 0xfb8efa30, 0x00000f5a, 0xd6c0d562, 0x0000ea8b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf78cfc7d, 0x00000499, 0xd73cda15, 0x0000dd83, 0xd2bed7af, 0x0000dfca, 0x12eff779, 0x00000092,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf04ad7eb, 0x0000d5b0, 0xee20d2ab, 0x0000dbc4, 0x0b2dfb6b, 0x000000ed, 0x115cfaa5, 0x00000311,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xec8ed5d7, 0x0000de42, 0x0f7dfbef, 0x0000004c, 0xe65fd69c, 0x0000dc1f, 0xeaafd721, 0x0000db7d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf69b0a4b, 0x0000f801, 0xf6990a6f, 0x0000fd0f, 0xd1cae5a1, 0x0000d841, 0x05b10620, 0x0000fcc6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb1fe461, 0x0000d96d, 0xe0e3e152, 0x0000d7f8, 0xfccb02a8, 0x0000fcf2, 0xfec10687, 0x0000fe66,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd9f3e1b9, 0x0000d997, 0xfe9708a1, 0x000001db, 0xf953054c, 0x0000fefd, 0xd485e07e, 0x0000da2f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xf73f055f, 0x0000014f, 0xd9c8e3d2, 0x0000dd0d, 0x372d2b82, 0x08af0351, 0x0000fcd6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdfdede74, 0x0000d49a, 0xe3e1de82, 0x0000d808, 0x04ac0343, 0x0000f968, 0x05eb0591, 0x0000fb17,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_NOP, FIFO_NOP, FIFO_NOP),
+	0xe11de0c2, 0x0000d648,
+};
+// Generated by tools/obj2displaylist from ressources/dragon_geometry.obj, do not edit.
+// Shadow volume of a closed hull of 150 triangles (source: 2156), along (-0.57, -0.57, -0.57).
+// 292 triangles in 33 strips, 909 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define DRAGON_SHADOW_LOD1_POLYGONS 292
+#define DRAGON_SHADOW_LOD1_VERTICES 400
+#define DRAGON_SHADOW_LOD1_CYCLES 3600
+
+const u32 dragon_shadow_lod1_commands[] = {
+	909,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x06e7096d, 0x0000f367, 0xff660d68, 0x0000fa4e, 0x05b60adc, 0x0000f4e8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xda98e89a, 0x0000d57f, 0xe0e7e60e, 0x0000d01a, 0x27f4ca90, 0x06e7096d, 0x0000f367,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff660d68, 0x0000fa4e, 0x00000002, 0xf831f361, 0x00000498, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf722fb16, 0x0000fe41, 0xf6ccfe63, 0x000003bc, 0x04f5016b, 0x0000face, 0xd1fdd995, 0x0000deee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe027dc9d, 0x0000d5ff, 0xd253d648, 0x0000d973, 0xe582dbe9, 0x0000d168, 0xda19d528, 0x0000d714,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe7b1d9ca, 0x0000d6e3, 0xdb99d41a, 0x0000dd92, 0x0067f8e8, 0x00000260, 0x08a7facd, 0x0000fdea,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0822f833, 0x0000fe4a, 0x0d4bf769, 0x0000fb88, 0x0cdaf527, 0x00000099, 0x109cf698, 0x0000fd2a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0ed5f16c, 0x000008f6, 0x11acf3d9, 0x000008d7, 0x1284f0e4, 0x00000b9e, 0xecdecf0b, 0x0000e409,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xedb6cc16, 0x0000e6d0, 0xea07cc9e, 0x0000e428, 0x0ed5f16c, 0x000008f6, 0x0d2ef5da, 0x0000043e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0cdaf527, 0x00000099, 0xe860d10c, 0x0000df70, 0xe80cd059, 0x0000dbcb, 0xea07cc9e, 0x0000e428,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xebced1ca, 0x0000d85b, 0xecdecf0b, 0x0000e409, 0x11acf3d9, 0x000008d7, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x11acf3d9, 0x000008d7, 0x109cf698, 0x0000fd2a, 0xebced1ca, 0x0000d85b, 0xe87cd29b, 0x0000d6ba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe80cd059, 0x0000dbcb, 0xe353d365, 0x0000d97c, 0xe4e1cd21, 0x0000e361, 0x0822f833, 0x0000fe4a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0x0cdaf527, 0x00000099, 0x0c58f2ac, 0x00000a39, 0xe80cd059, 0x0000dbcb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xe789cdde, 0x0000e56b, 0xe4e1cd21, 0x0000e361, 0xe880cdab, 0x0000e902, 0x1d885067,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x0b63f2e0, 0x00000fa9, 0x01d0b7df, 0x09aff1f0, 0x00000830, 0x38ae6b4c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe4e1cd21, 0x0000e361, 0xe694ce12, 0x0000eada, 0x00000002, 0x109cf698, 0x0000fd2a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0d4bf769, 0x0000fb88, 0xe87cd29b, 0x0000d6ba, 0xe3d9d5ff, 0x0000d91c, 0xe353d365, 0x0000d97c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xdb99d41a, 0x0000dd92, 0xdb55cf66, 0x0000ddd0, 0xd3ead3c4, 0x0000d5be, 0x36fd4f38,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd1bdd24c, 0x0000d69f, 0xd253d648, 0x0000d973, 0xd3ead3c4, 0x0000d5be, 0xf8b8f893, 0x0000fa8c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfee7f9f6, 0x0000fbe3, 0x0067f8e8, 0x00000260, 0x0c7ffe98, 0x0000fbb1, 0xe7b1d9ca, 0x0000d6e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe582dbe9, 0x0000d168, 0x00000002, 0xdb99d41a, 0x0000dd92, 0xda19d528, 0x0000d714,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd3ead3c4, 0x0000d5be, 0xfee7f9f6, 0x0000fbe3, 0x00000002, 0x0d4bf769, 0x0000fb88,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x08a7facd, 0x0000fdea, 0xe3d9d5ff, 0x0000d91c, 0xdb99d41a, 0x0000dd92, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb55cf66, 0x0000ddd0, 0x36fd4f38, 0xd9eaccbd, 0x0000e291, 0xd362ce93, 0x0000dfca,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd59dcf30, 0x0000e5e8, 0xd22fd2e6, 0x0000e2d0, 0xf6fdf7b4, 0x0000079f, 0xf6ccfe63, 0x000003bc,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x36fd4f38, 0xd253d648, 0x0000d973, 0xd362ce93, 0x0000dfca,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd22fd2e6, 0x0000e2d0, 0x00000002, 0xdb55cf66, 0x0000ddd0, 0xd9eaccbd, 0x0000e291,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe353d365, 0x0000d97c, 0xe59cd173, 0x0000dde3, 0x0a6af641, 0x000002b2, 0x09aff1f0, 0x00000830,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0120a3e7, 0xe4e1cd21, 0x0000e361, 0xe536d4f3, 0x0000dfae, 0xe59cd173, 0x0000dde3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a6af641, 0x000002b2, 0xfeb8f18b, 0x0000075f, 0x0822f833, 0x0000fe4a, 0x0024f435, 0x0000029e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0067f8e8, 0x00000260, 0xf8b8f893, 0x0000fa8c, 0x00000002, 0xd253d648, 0x0000d973,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd1fdd995, 0x0000deee, 0xd22fd2e6, 0x0000e2d0, 0xf6ccfe63, 0x000003bc, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xe59cd173, 0x0000dde3, 0xd9eaccbd, 0x0000e291, 0xfeb8f18b, 0x0000075f, 0x02dffbcf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfa6cf3fe, 0x00000ab6, 0xdaa3cefd, 0x0000e677, 0xd59dcf30, 0x0000e5e8, 0xd9eaccbd, 0x0000e291,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd59dcf30, 0x0000e5e8, 0xf6fdf7b4, 0x0000079f, 0xfa6cf3fe, 0x00000ab6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf831f361, 0x00000498, 0xfeb8f18b, 0x0000075f, 0xf98ef2c5, 0x00000091, 0x0024f435, 0x0000029e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf8b8f893, 0x0000fa8c, 0x00000002, 0xf831f361, 0x00000498, 0xf722fb16, 0x0000fe41,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf98ef2c5, 0x00000091, 0xf68cf71a, 0x0000fb6e, 0xf8b8f893, 0x0000fa8c, 0xf722fb16, 0x0000fe41,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd253d648, 0x0000d973, 0xda19d528, 0x0000d714, 0x00000002, 0xda19d528, 0x0000d714,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf722fb16, 0x0000fe41, 0xfee7f9f6, 0x0000fbe3, 0x0a5100b8, 0x0000f636, 0x0c7ffe98, 0x0000fbb1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe582dbe9, 0x0000d168, 0x00000002, 0xf722fb16, 0x0000fe41, 0x04f5016b, 0x0000face,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0a5100b8, 0x0000f636, 0x04ac0343, 0x0000f968, 0x3da05c0a, 0xfc10ffc8, 0x0000f821,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfdcf02eb, 0x0000f4db, 0xf82b03e7, 0x0000f43a, 0xf6510870, 0x0000f463, 0xf6070342, 0x0000f82f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6990a6f, 0x0000fd0f, 0xf8180253, 0x0000fe71, 0xf8ac0710, 0x00000036, 0xd34add85, 0x0000d9a3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd3dee242, 0x0000db68, 0xd1cae5a1, 0x0000d841, 0xf6990a6f, 0x0000fd0f, 0xfb0b0dc5, 0x0000f963,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6510870, 0x0000f463, 0xd63ce8f7, 0x0000d495, 0xd183e3a2, 0x0000cf95, 0xd1cae5a1, 0x0000d841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd138de73, 0x0000d361, 0xd34add85, 0x0000d9a3, 0xd499dbc8, 0x0000d6dd, 0xf8180253, 0x0000fe71,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xf9670096, 0x0000fbac, 0xf6070342, 0x0000f82f, 0xf82b03e7, 0x0000f43a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf82b03e7, 0x0000f43a, 0xfc10ffc8, 0x0000f821, 0xf9670096, 0x0000fbac, 0x04ac0343, 0x0000f968,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN),
+	0xdfdede74, 0x0000d49a, 0x16512629, 0xe582dbe9, 0x0000d168, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0x0c58f2ac, 0x00000a39, 0x0d4ef279, 0x00000dd1, 0x0d2ef5da, 0x0000043e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe860d10c, 0x0000df70, 0xea07cc9e, 0x0000e428, 0x00000002, 0x09aff1f0, 0x00000830,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0d4ef279, 0x00000dd1, 0x1d885467, 0xe880cdab, 0x0000e902, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0d4ef279, 0x00000dd1, 0xe860d10c, 0x0000df70, 0xe880cdab, 0x0000e902, 0xe789cdde, 0x0000e56b,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x0c58f2ac, 0x00000a39, 0xe789cdde, 0x0000e56b, 0x0d2ef5da, 0x0000043e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe860d10c, 0x0000df70, 0x1284f0e4, 0x00000b9e, 0xedb6cc16, 0x0000e6d0, 0x0ed5f16c, 0x000008f6,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0x0d2ef5da, 0x0000043e, 0x1284f0e4, 0x00000b9e, 0x02f0f7d5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xedb6cc16, 0x0000e6d0, 0xea63d077, 0x0000e6f9, 0xe860d10c, 0x0000df70, 0x375e775d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0d2ef5da, 0x0000043e, 0x0c10fc1e, 0x00000208, 0x02f0f7d5, 0xea63d077, 0x0000e6f9,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x00000002, 0x0a5100b8, 0x0000f636, 0x3da05c0a, 0x07a605bb, 0x0000f3af,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfdcf02eb, 0x0000f4db, 0x02f80893, 0x0000f5ac, 0xfcb606a3, 0x0000f913, 0xd7e8e1d5, 0x0000d445,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd901de1d, 0x0000d00c, 0xde2ae3c4, 0x0000d0de, 0xe2d8e0ed, 0x0000cee0, 0xe344e3f2, 0x0000d016,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x07a605bb, 0x0000f3af, 0x081208c0, 0x0000f4e4, 0x02f80893, 0x0000f5ac, 0x06e7096d, 0x0000f367,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfced0977, 0x0000f9a2, 0xfb0b0dc5, 0x0000f963, 0xd81fe4a8, 0x0000d4d4, 0xd63ce8f7, 0x0000d495,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe219e49e, 0x0000ce99, 0x06e7096d, 0x0000f367, 0x09ad0af0, 0x0000f619, 0x081208c0, 0x0000f4e4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xe4dfe621, 0x0000d14a, 0xe344e3f2, 0x0000d016, 0x283b54ac, 0xde2ae3c4, 0x0000d0de,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xd81fe4a8, 0x0000d4d4, 0xd881e66f, 0x0000d7e3, 0xfced0977, 0x0000f9a2, 0x3f3fd42d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02f80893, 0x0000f5ac, 0x081208c0, 0x0000f4e4, 0xde2ae3c4, 0x0000d0de, 0xe344e3f2, 0x0000d016,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd881e66f, 0x0000d7e3, 0x3f3fd42d, 0x00000002, 0x07a605bb, 0x0000f3af,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe2d8e0ed, 0x0000cee0, 0x0a5100b8, 0x0000f636, 0xe582dbe9, 0x0000d168, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfcb606a3, 0x0000f913, 0xfdcf02eb, 0x0000f4db, 0xd901de1d, 0x0000d00c, 0xd183e3a2, 0x0000cf95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xd35cdf18, 0x0000cf6c, 0xd138de73, 0x0000d361, 0xd499dbc8, 0x0000d6dd, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x06e7096d, 0x0000f367, 0xfb0b0dc5, 0x0000f963, 0xd63ce8f7, 0x0000d495, 0xd1cae5a1, 0x0000d841,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xd35cdf18, 0x0000cf6c, 0xd742dafa, 0x0000d353, 0xd901de1d, 0x0000d00c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe0ffddb3, 0x0000d1a9, 0xe2d8e0ed, 0x0000cee0, 0xe582dbe9, 0x0000d168, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd35cdf18, 0x0000cf6c, 0xd499dbc8, 0x0000d6dd, 0xd742dafa, 0x0000d353, 0xdfdede74, 0x0000d49a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xe0ffddb3, 0x0000d1a9, 0xe582dbe9, 0x0000d168, 0x00000002, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6510870, 0x0000f463, 0xd183e3a2, 0x0000cf95, 0xd7e8e1d5, 0x0000d445, 0xd81fe4a8, 0x0000d4d4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfcb606a3, 0x0000f913, 0xfced0977, 0x0000f9a2, 0xf6510870, 0x0000f463, 0xd183e3a2, 0x0000cf95,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xf6990a6f, 0x0000fd0f, 0xf8ac0710, 0x00000036, 0xd3dee242, 0x0000db68,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7fdddda, 0x0000d824, 0xdb1fe461, 0x0000d96d, 0xfccb02a8, 0x0000fcf2, 0xffee0930, 0x0000fe3b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xf8ac0710, 0x00000036, 0xd3dee242, 0x0000db68, 0x00000002, 0xf8ac0710, 0x00000036,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xfccb02a8, 0x0000fcf2, 0xd7fdddda, 0x0000d824, 0x355dfb8b, 0xd499dbc8, 0x0000d6dd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3e80441e, 0xf9670096, 0x0000fbac, 0xfccb02a8, 0x0000fcf2, 0xd7fdddda, 0x0000d824,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xf751fb1b, 0x00000b9c, 0xf6fdf7b4, 0x0000079f, 0xf771f8ad, 0x00000d65,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfc98f6c6, 0x00000b23, 0xd7cad1f8, 0x0000e654, 0xd22fd2e6, 0x0000e2d0, 0xd2a3d3df, 0x0000e897,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x39bd2b59, 0xf751fb1b, 0x00000b9c, 0xfa4afbde, 0x000009a8, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN),
+	0xd57cd710, 0x0000e4d9, 0xd22fd2e6, 0x0000e2d0, 0x39bd2b59, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7cad1f8, 0x0000e654, 0xd2a3d3df, 0x0000e897, 0xf771f8ad, 0x00000d65, 0xf751fb1b, 0x00000b9c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x39bd2b59, 0xd57cd710, 0x0000e4d9, 0xfa4afbde, 0x000009a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf71bff31, 0x0000074b, 0xf6ccfe63, 0x000003bc, 0xd24cda62, 0x0000e27d, 0xd1fdd995, 0x0000deee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd57cd710, 0x0000e4d9, 0xfa4afbde, 0x000009a8, 0x00000000, 0xff660d68, 0x0000fa4e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xe219e49e, 0x0000ce99, 0xda98e89a, 0x0000d57f, 0x06e7096d, 0x0000f367, 0x181b3d6f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xe0e7e60e, 0x0000d01a, 0x01d0b7df, 0xe694ce12, 0x0000eada, 0x38ae6b4c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0xe59cd173, 0x0000dde3, 0xe4e1cd21, 0x0000e361, 0x0a6af641, 0x000002b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x0822f833, 0x0000fe4a, 0xe353d365, 0x0000d97c, 0x0a6af641, 0x000002b2, 0x0120a3e7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe536d4f3, 0x0000dfae, 0x02dffbcf, 0xd9eaccbd, 0x0000e291, 0xdaa3cefd, 0x0000e677,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x04ac0343, 0x0000f968, 0x16612628, 0xe027dc9d, 0x0000d5ff, 0x0c10fc1e, 0x00000208,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xea63d077, 0x0000e6f9, 0x375e775d, 0x02f80893, 0x0000f5ac, 0xd7e8e1d5, 0x0000d445,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xde2ae3c4, 0x0000d0de, 0x3f3fd42d, 0x081208c0, 0x0000f4e4, 0xe344e3f2, 0x0000d016,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x09ad0af0, 0x0000f619, 0xe219e49e, 0x0000ce99, 0xe4dfe621, 0x0000d14a, 0xf6510870, 0x0000f463,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfcb606a3, 0x0000f913, 0xd7e8e1d5, 0x0000d445, 0xfced0977, 0x0000f9a2, 0xd183e3a2, 0x0000cf95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd81fe4a8, 0x0000d4d4, 0xffee0930, 0x0000fe3b, 0xd3dee242, 0x0000db68, 0xdb1fe461, 0x0000d96d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xfccb02a8, 0x0000fcf2, 0x3e80441e, 0x355dfb8b, 0xf9670096, 0x0000fbac,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdfdede74, 0x0000d49a, 0xd499dbc8, 0x0000d6dd, 0xf9670096, 0x0000fbac, 0xd7fdddda, 0x0000d824,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd499dbc8, 0x0000d6dd, 0xfc98f6c6, 0x00000b23, 0xf6fdf7b4, 0x0000079f, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf71bff31, 0x0000074b, 0xd57cd710, 0x0000e4d9, 0xd24cda62, 0x0000e27d, 0xfa4afbde, 0x000009a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_NOP, FIFO_NOP),
+	0xf6ccfe63, 0x000003bc, 0xd1fdd995, 0x0000deee,
+};
+// Generated by tools/obj2displaylist from ressources/dragon_geometry.obj, do not edit.
+// Shadow volume of a closed hull of 100 triangles (source: 2156), along (-0.57, -0.57, -0.57).
+// 212 triangles in 28 strips, 678 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define DRAGON_SHADOW_LOD2_POLYGONS 212
+#define DRAGON_SHADOW_LOD2_VERTICES 296
+#define DRAGON_SHADOW_LOD2_CYCLES 2668
+
+const u32 dragon_shadow_lod2_commands[] = {
+	678,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xf98ef2c5, 0x00000091, 0xf6fdf7b4, 0x0000079f, 0xf722fb16, 0x0000fe41,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6ccfe63, 0x000003bc, 0x04f5016b, 0x0000face, 0xd1fdd995, 0x0000deee, 0xe027dc9d, 0x0000d5ff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd253d648, 0x0000d973, 0xe582dbe9, 0x0000d168, 0xda19d528, 0x0000d714, 0xe7b1d9ca, 0x0000d6e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb99d41a, 0x0000dd92, 0x0067f8e8, 0x00000260, 0x0822f833, 0x0000fe4a, 0x0024f435, 0x0000029e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xfeb8f18b, 0x0000075f, 0xf98ef2c5, 0x00000091, 0x02dffbcf, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfc98f6c6, 0x00000b23, 0xf771f8ad, 0x00000d65, 0xd7cad1f8, 0x0000e654, 0xd2a3d3df, 0x0000e897,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd22fd2e6, 0x0000e2d0, 0xd57cd710, 0x0000e4d9, 0xf6fdf7b4, 0x0000079f, 0xfa4afbde, 0x000009a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xf771f8ad, 0x00000d65, 0xd2a3d3df, 0x0000e897, 0x00000002, 0xf6fdf7b4, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd22fd2e6, 0x0000e2d0, 0xf6ccfe63, 0x000003bc, 0xd1fdd995, 0x0000deee, 0xfa4afbde, 0x000009a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd57cd710, 0x0000e4d9, 0xf71bff31, 0x0000074b, 0xd24cda62, 0x0000e27d, 0xf6ccfe63, 0x000003bc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd1fdd995, 0x0000deee, 0x00000002, 0xd1fdd995, 0x0000deee, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd253d648, 0x0000d973, 0x36fd4f38, 0xd1bdd24c, 0x0000d69f, 0xdb55cf66, 0x0000ddd0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb99d41a, 0x0000dd92, 0xe353d365, 0x0000d97c, 0x0822f833, 0x0000fe4a, 0x0d4bf769, 0x0000fb88,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0cdaf527, 0x00000099, 0x109cf698, 0x0000fd2a, 0x1284f0e4, 0x00000b9e, 0xebced1ca, 0x0000d85b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xedb6cc16, 0x0000e6d0, 0xe80cd059, 0x0000dbcb, 0xea63d077, 0x0000e6f9, 0x375e775d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0c10fc1e, 0x00000208, 0x0cdaf527, 0x00000099, 0x02f0f7d5, 0x1284f0e4, 0x00000b9e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xedb6cc16, 0x0000e6d0, 0x00000002, 0xdb99d41a, 0x0000dd92, 0xda19d528, 0x0000d714,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd1bdd24c, 0x0000d69f, 0xd253d648, 0x0000d973, 0x00000002, 0x0c10fc1e, 0x00000208,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x02f0f7d5, 0xea63d077, 0x0000e6f9, 0xedb6cc16, 0x0000e6d0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x375e775d, 0xe80cd059, 0x0000dbcb, 0x0cdaf527, 0x00000099, 0x0c58f2ac, 0x00000a39,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x09aff1f0, 0x00000830, 0x0b63f2e0, 0x00000fa9, 0x0120a3e7, 0xe694ce12, 0x0000eada,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe536d4f3, 0x0000dfae, 0xe4e1cd21, 0x0000e361, 0xe59cd173, 0x0000dde3, 0x09aff1f0, 0x00000830,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0a6af641, 0x000002b2, 0x0120a3e7, 0xe536d4f3, 0x0000dfae, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0cdaf527, 0x00000099, 0x09aff1f0, 0x00000830, 0x0822f833, 0x0000fe4a, 0xe4e1cd21, 0x0000e361,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe353d365, 0x0000d97c, 0xe80cd059, 0x0000dbcb, 0xe87cd29b, 0x0000d6ba, 0xebced1ca, 0x0000d85b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x109cf698, 0x0000fd2a, 0x00000002, 0xe353d365, 0x0000d97c, 0xe87cd29b, 0x0000d6ba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0d4bf769, 0x0000fb88, 0x109cf698, 0x0000fd2a, 0x00000002, 0xdb55cf66, 0x0000ddd0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x36fd4f38, 0xd9eaccbd, 0x0000e291, 0xdaa3cefd, 0x0000e677, 0x02dffbcf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xfc98f6c6, 0x00000b23, 0x00000002, 0x36fd4f38, 0xd22fd2e6, 0x0000e2d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xdaa3cefd, 0x0000e677, 0xd7cad1f8, 0x0000e654, 0xfc98f6c6, 0x00000b23, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xdb55cf66, 0x0000ddd0, 0xd9eaccbd, 0x0000e291, 0xe353d365, 0x0000d97c, 0xe59cd173, 0x0000dde3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0a6af641, 0x000002b2, 0xfeb8f18b, 0x0000075f, 0x0822f833, 0x0000fe4a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xe59cd173, 0x0000dde3, 0xd9eaccbd, 0x0000e291, 0xfeb8f18b, 0x0000075f, 0x02dffbcf,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x0024f435, 0x0000029e, 0xf68cf71a, 0x0000fb6e, 0x0067f8e8, 0x00000260,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfee7f9f6, 0x0000fbe3, 0x0c7ffe98, 0x0000fbb1, 0x0a5100b8, 0x0000f636, 0xe582dbe9, 0x0000d168,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe219e49e, 0x0000ce99, 0xe0ffddb3, 0x0000d1a9, 0xd901de1d, 0x0000d00c, 0xd34add85, 0x0000d9a3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd35cdf18, 0x0000cf6c, 0xd138de73, 0x0000d361, 0xd183e3a2, 0x0000cf95, 0xd1cae5a1, 0x0000d841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd63ce8f7, 0x0000d495, 0xfb0b0dc5, 0x0000f963, 0xf6510870, 0x0000f463, 0xf6990a6f, 0x0000fd0f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6070342, 0x0000f82f, 0xf8180253, 0x0000fe71, 0xf82b03e7, 0x0000f43a, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xf6510870, 0x0000f463, 0xd183e3a2, 0x0000cf95, 0xd63ce8f7, 0x0000d495, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd138de73, 0x0000d361, 0xd1cae5a1, 0x0000d841, 0xd34add85, 0x0000d9a3, 0xd3dee242, 0x0000db68,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf8ac0710, 0x00000036, 0xfe9708a1, 0x000001db, 0xfccb02a8, 0x0000fcf2, 0xd9c8e3d2, 0x0000dd0d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7fdddda, 0x0000d824, 0xd3dee242, 0x0000db68, 0xf8ac0710, 0x00000036, 0xf6990a6f, 0x0000fd0f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf8180253, 0x0000fe71, 0x00000002, 0xd35cdf18, 0x0000cf6c, 0xd901de1d, 0x0000d00c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xd183e3a2, 0x0000cf95, 0xfdcf02eb, 0x0000f4db, 0x00000002, 0x0024f435, 0x0000029e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf98ef2c5, 0x00000091, 0xf68cf71a, 0x0000fb6e, 0xf722fb16, 0x0000fe41, 0xfee7f9f6, 0x0000fbe3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a5100b8, 0x0000f636, 0x00000002, 0xf722fb16, 0x0000fe41, 0x04f5016b, 0x0000face,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a5100b8, 0x0000f636, 0x3da05c0a, 0x06e7096d, 0x0000f367, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfcb606a3, 0x0000f913, 0xd901de1d, 0x0000d00c, 0xd7e8e1d5, 0x0000d445, 0xe219e49e, 0x0000ce99,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x06e7096d, 0x0000f367, 0x0a5100b8, 0x0000f636, 0x00000002, 0xfdcf02eb, 0x0000f4db,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3da05c0a, 0xf8180253, 0x0000fe71, 0xe0ffddb3, 0x0000d1a9, 0xd34add85, 0x0000d9a3,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe582dbe9, 0x0000d168, 0xe0ffddb3, 0x0000d1a9, 0xe027dc9d, 0x0000d5ff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x3da05c0a, 0x04f5016b, 0x0000face, 0x00000002, 0xe582dbe9, 0x0000d168,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe7b1d9ca, 0x0000d6e3, 0x0c7ffe98, 0x0000fbb1, 0x0067f8e8, 0x00000260, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd3dee242, 0x0000db68, 0xd1cae5a1, 0x0000d841, 0xf6990a6f, 0x0000fd0f, 0xfb0b0dc5, 0x0000f963,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xe4e1cd21, 0x0000e361, 0xe694ce12, 0x0000eada, 0xe789cdde, 0x0000e56b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0b63f2e0, 0x00000fa9, 0x0c58f2ac, 0x00000a39, 0x00000002, 0xe4e1cd21, 0x0000e361,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xe789cdde, 0x0000e56b, 0xe80cd059, 0x0000dbcb, 0x0c58f2ac, 0x00000a39, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a6af641, 0x000002b2, 0x0822f833, 0x0000fe4a, 0xe353d365, 0x0000d97c, 0xec62d453, 0x0000db3a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x375e775d, 0x1131f921, 0x00000008, 0x0c10fc1e, 0x00000208, 0x0822f833, 0x0000fe4a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x0228f8b0, 0x0000079e, 0xe353d365, 0x0000d97c, 0xdd5ad3e1, 0x0000e2cf, 0x375e775d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0c10fc1e, 0x00000208, 0x00000002, 0xf8ac0710, 0x00000036, 0xf8180253, 0x0000fe71,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd34add85, 0x0000d9a3, 0xd7fdddda, 0x0000d824, 0xd7e8e1d5, 0x0000d445, 0xfccb02a8, 0x0000fcf2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xfcb606a3, 0x0000f913, 0xf8180253, 0x0000fe71, 0xd34add85, 0x0000d9a3, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x3f3fd42d, 0x06e7096d, 0x0000f367, 0x17d4af53, 0xe219e49e, 0x0000ce99,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x17d4af54, 0xd881e66f, 0x0000d7e3, 0x3f3fd42d, 0xfb0b0dc5, 0x0000f963,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x06e7096d, 0x0000f367, 0xd63ce8f7, 0x0000d495, 0xe219e49e, 0x0000ce99, 0xd881e66f, 0x0000d7e3,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x3da05c0a, 0x0ba50381, 0x0000fc46, 0xfcb606a3, 0x0000f913,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xe6d6deb3, 0x0000d778, 0xd7e8e1d5, 0x0000d445, 0xe0ffddb3, 0x0000d1a9, 0x3da05c0a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0ba50381, 0x0000fc46, 0x00000002, 0xd34add85, 0x0000d9a3, 0xd7e8e1d5, 0x0000d445,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfcb606a3, 0x0000f913, 0x3da05c0a, 0x00000000, 0xfa4afbde, 0x000009a8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf71bff31, 0x0000074b, 0xf6ccfe63, 0x000003bc, 0xd57cd710, 0x0000e4d9, 0xd1fdd995, 0x0000deee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd24cda62, 0x0000e27d, 0xfa4afbde, 0x000009a8, 0xd2a3d3df, 0x0000e897, 0xd57cd710, 0x0000e4d9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a6af641, 0x000002b2, 0xe536d4f3, 0x0000dfae, 0xe59cd173, 0x0000dde3, 0xf6510870, 0x0000f463,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf82b03e7, 0x0000f43a, 0xf6070342, 0x0000f82f, 0xfe9708a1, 0x000001db, 0xd3dee242, 0x0000db68,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd9c8e3d2, 0x0000dd0d, 0x0822f833, 0x0000fe4a, 0x1131f921, 0x00000008, 0xec62d453, 0x0000db3a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0c10fc1e, 0x00000208, 0x0228f8b0, 0x0000079e, 0xdd5ad3e1, 0x0000e2cf, 0xf8ac0710, 0x00000036,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfccb02a8, 0x0000fcf2, 0xd7fdddda, 0x0000d824, 0xf8180253, 0x0000fe71, 0xfccb02a8, 0x0000fcf2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xd7fdddda, 0x0000d824, 0xfb0b0dc5, 0x0000f963, 0xd881e66f, 0x0000d7e3, 0xd63ce8f7, 0x0000d495,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3f3fd42d, 0x081208c0, 0x0000f4e4, 0xe344e3f2, 0x0000d016, 0x0ba50381, 0x0000fc46,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xe0ffddb3, 0x0000d1a9, 0xe6d6deb3, 0x0000d778, 0x06e7096d, 0x0000f367, 0xfcb606a3, 0x0000f913,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_NOP, FIFO_NOP, FIFO_NOP),
+	0xd7e8e1d5, 0x0000d445,
 };
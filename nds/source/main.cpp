@@ -15,6 +15,69 @@
 #include "dragon_shadow_geometry.h"
 #include "suzanne_geometry.h"
 #include "suzanne_color.h"
+#include "suzanne_shadow_geometry.h"
+
+// Polygon RAM size, per frame, and polygons of the skybox and the plane.
+#define POLYGON_LIMIT 2048
+#define SCENERY_POLYGONS 7
+#define LOD_COUNT 3
+
+// Display lists of an object, from the most to the least detailed.
+struct LevelsOfDetail {
+	const u32* commands[LOD_COUNT];
+	int polygons[LOD_COUNT];
+	// Draws counted in halves: a mesh with back faces culled is one, a shadow volume drawn without then with
+	// culling is three.
+	int halfPasses;
+	int level;
+};
+
+static LevelsOfDetail dragonLods = {
+	{ dragon_commands, dragon_lod1_commands, dragon_lod2_commands },
+	{ DRAGON_POLYGONS, DRAGON_LOD1_POLYGONS, DRAGON_LOD2_POLYGONS }, 1, 0 };
+static LevelsOfDetail suzanneLods = {
+	{ suzanne_commands, suzanne_lod1_commands, suzanne_lod2_commands },
+	{ SUZANNE_POLYGONS, SUZANNE_LOD1_POLYGONS, SUZANNE_LOD2_POLYGONS }, 1, 0 };
+static LevelsOfDetail dragonShadowLods = {
+	{ dragon_shadow_commands, dragon_shadow_lod1_commands, dragon_shadow_lod2_commands },
+	{ DRAGON_SHADOW_POLYGONS, DRAGON_SHADOW_LOD1_POLYGONS, DRAGON_SHADOW_LOD2_POLYGONS }, 3, 0 };
+static LevelsOfDetail suzanneShadowLods = {
+	{ suzanne_shadow_commands, suzanne_shadow_lod1_commands, suzanne_shadow_lod2_commands },
+	{ SUZANNE_SHADOW_POLYGONS, SUZANNE_SHADOW_LOD1_POLYGONS, SUZANNE_SHADOW_LOD2_POLYGONS }, 3, 0 };
+
+// The least detailed levels always fit.
+static_assert(SCENERY_POLYGONS + (DRAGON_LOD2_POLYGONS + SUZANNE_LOD2_POLYGONS
+	+ 3 * (DRAGON_SHADOW_LOD2_POLYGONS + SUZANNE_SHADOW_LOD2_POLYGONS)) / 2 <= POLYGON_LIMIT, "Scene too large.");
+
+// Camera distances (in tenths of units) from which the next level is used.
+static const int lodDistances[LOD_COUNT - 1] = { 45, 80 };
+
+// Only polygons that are not culled are stored, about half of the faces for a closed mesh.
+static int estimatedPolygons(const LevelsOfDetail& lods, int level){
+	return lods.polygons[level] * lods.halfPasses / 2;
+}
+
+// Pick the level of each object from the camera distance, then coarsen the objects in order until the scene
+// fits in the polygon RAM. The objects are close to the center of the scene, compared to the camera.
+static void selectLevels(LevelsOfDetail** objects, int count, int distance){
+	int level = 0;
+	while(level < LOD_COUNT - 1 && distance >= lodDistances[level]){
+		++level;
+	}
+	int total = SCENERY_POLYGONS;
+	for(int i = 0; i < count; ++i){
+		objects[i]->level = level;
+		total += estimatedPolygons(*objects[i], level);
+	}
+	for(int i = 0; i < count && total > POLYGON_LIMIT; ++i){
+		LevelsOfDetail& lods = *objects[i];
+		while(lods.level < LOD_COUNT - 1 && total > POLYGON_LIMIT){
+			total -= estimatedPolygons(lods, lods.level);
+			++lods.level;
+			total += estimatedPolygons(lods, lods.level);
+		}
+	}
+}
 
 static void getKeysDelta( int *dx, int *dy, int *du ) {
 	
@@ -116,6 +179,8 @@ int main(void) {
 	int rotateY = 0;
 	int translate = -30;
 	int timer = 0;
+	// Simplified shadows are less noticeable, coarsen them first.
+	LevelsOfDetail* objects[] = { &dragonShadowLods, &suzanneShadowLods, &suzanneLods, &dragonLods };
 	while(1) {
 		
 		// Inputs.
@@ -126,6 +191,7 @@ int main(void) {
 		rotateY -= 2*pen_delta[0];
 		rotateX -= 2*pen_delta[1];
 		translate += du;
+		selectLevels(objects, 4, translate < 0 ? -translate : translate);
 		
 		glPolyFmt(POLY_ALPHA(31) | POLY_CULL_BACK |  POLY_FORMAT_LIGHT0);
 		
@@ -157,7 +223,7 @@ int main(void) {
 		// Dragon.
 		glTranslatef(-0.2f,0.55f,-0.2f);
 		glBindTexture(0, textureIDDragon);
-		glCallList((u32*)dragon_commands);
+		glCallList((u32*)dragonLods.commands[dragonLods.level]);
 		glPopMatrix(1);
 		glPushMatrix();
 		// Suzanne (animated).
@@ -167,7 +233,7 @@ int main(void) {
 		glPushMatrix();
 		glRotateYi(timer);
 		glBindTexture(0, textureIDSuzanne);
-		glCallList((u32*)suzanne_commands);
+		glCallList((u32*)suzanneLods.commands[suzanneLods.level]);
 		
 		//glPopMatrix(1);
 		glBindTexture(0, 0);
@@ -180,21 +246,20 @@ int main(void) {
 		glScalef(1.5,2.0,1.5);
 		
 		glPolyFmt(POLY_ALPHA(1) | POLY_CULL_NONE | POLY_ID(0) | POLY_SHADOW);
-		glCallList((u32*)suzanne_commands);
+		glCallList((u32*)suzanneShadowLods.commands[suzanneShadowLods.level]);
 		glPolyFmt(POLY_ALPHA(15) | POLY_CULL_BACK | POLY_ID(61) | POLY_SHADOW);
-		glCallList((u32*)suzanne_commands);
+		glCallList((u32*)suzanneShadowLods.commands[suzanneShadowLods.level]);
 		
 		//glPolyFmt(POLY_ALPHA(31) | POLY_CULL_BACK |  POLY_FORMAT_LIGHT0);
 
 		glPopMatrix(1);
 		glPushMatrix();
-		glTranslatef(-0.70f,0.0f,-0.70f);
-		//glPolyFmt(POLY_ALPHA(31) | POLY_CULL_FRONT |  POLY_FORMAT_LIGHT0);
-		//glCallList((u32*)dragon_shadow_commands);
+		// The volume is extruded from the dragon, in the same frame.
+		glTranslatef(-0.2f,0.05f,-0.2f);
 		glPolyFmt(POLY_ALPHA(15) | POLY_CULL_NONE | POLY_ID(0) | POLY_SHADOW);
-		glCallList((u32*)dragon_shadow_commands);
+		glCallList((u32*)dragonShadowLods.commands[dragonShadowLods.level]);
 		glPolyFmt(POLY_ALPHA(15) | POLY_CULL_BACK | POLY_ID(61) | POLY_SHADOW);
-		glCallList((u32*)dragon_shadow_commands);
+		glCallList((u32*)dragonShadowLods.commands[dragonShadowLods.level]);
 		glPopMatrix(1);
 		
 		glFlush(GL_TRANS_MANUALSORT | GL_WBUFFERING);
@@ -1,9198 +1,3142 @@
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// 766 triangles in 142 strips, 4662 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_POLYGONS 766
+#define SUZANNE_VERTICES 1088
+#define SUZANNE_CYCLES 20032
+
 const u32 suzanne_commands[] = {
-	11493,
-	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_NOP, FIFO_NOP, FIFO_NOP),
-	GL_TRIANGLES,
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(360)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.6047),floattov10(-0.7895),floattov10(0.1051)),
-	VERTEX_PACK(floattov16(-0.216649),floattov16(-0.654763)), VERTEX_PACK(floattov16(0.365356),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(0),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(360)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(7),inttot16(351)),
-	NORMAL_PACK(floattov10(0.8739),floattov10(-0.4782),floattov10(0.0871)),
-	VERTEX_PACK(floattov16(0.23706),floattov16(-0.631812)), VERTEX_PACK(floattov16(0.36422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(7),inttot16(351)),
-	NORMAL_PACK(floattov10(0.8739),floattov10(-0.4782),floattov10(0.0871)),
-	VERTEX_PACK(floattov16(0.23706),floattov16(-0.631812)), VERTEX_PACK(floattov16(0.36422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(346)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(13),inttot16(419)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(0.177516),floattov16(-0.360302)), VERTEX_PACK(floattov16(0.466022),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(346)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(-0.177518),floattov16(-0.360298)), VERTEX_PACK(floattov16(0.466021),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(349)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(321)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(349)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(418)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(446)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(446)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(467)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(301)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(288)),
-	NORMAL_PACK(floattov10(0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(288)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(480)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(479)),
-	NORMAL_PACK(floattov10(-0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(-0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(467)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(288)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(480)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(475)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(292)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(317)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(344)),
-	NORMAL_PACK(floattov10(0.4273),floattov10(0.5498),floattov10(0.7177)),
-	VERTEX_PACK(floattov16(0.22605),floattov16(0.471675)), VERTEX_PACK(floattov16(0.547777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(344)),
-	NORMAL_PACK(floattov10(0.4273),floattov10(0.5498),floattov10(0.7177)),
-	VERTEX_PACK(floattov16(0.22605),floattov16(0.471675)), VERTEX_PACK(floattov16(0.547777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(317)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(347)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(359)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(163),inttot16(386)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.0374),floattov10(-0.0569),floattov10(0.9977)),
-	VERTEX_PACK(floattov16(-0.0057463),floattov16(0.248136)), VERTEX_PACK(floattov16(0.566927),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(-0.406146),floattov16(0.263362)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(318)),
-	NORMAL_PACK(floattov10(0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(0.406156),floattov16(0.26336)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(-0.406146),floattov16(0.263362)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.1535),floattov10(-0.1529),floattov10(0.9762)),
-	VERTEX_PACK(floattov16(-0.1669),floattov16(0.0372701)), VERTEX_PACK(floattov16(0.52305),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.0374),floattov10(-0.0569),floattov10(0.9977)),
-	VERTEX_PACK(floattov16(-0.0057463),floattov16(0.248136)), VERTEX_PACK(floattov16(0.566927),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.0374),floattov10(-0.0569),floattov10(0.9977)),
-	VERTEX_PACK(floattov16(-0.0057463),floattov16(0.248136)), VERTEX_PACK(floattov16(0.566927),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.0374),floattov10(-0.0569),floattov10(0.9977)),
-	VERTEX_PACK(floattov16(-0.0057463),floattov16(0.248136)), VERTEX_PACK(floattov16(0.566927),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.3083),floattov10(-0.0935),floattov10(0.9467)),
-	VERTEX_PACK(floattov16(0.0637798),floattov16(-0.587122)), VERTEX_PACK(floattov16(0.495222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(392)),
-	NORMAL_PACK(floattov10(0.2925),floattov10(-0.3033),floattov10(0.9069)),
-	VERTEX_PACK(floattov16(-0.0723597),floattov16(-0.555815)), VERTEX_PACK(floattov16(0.50188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(388)),
-	NORMAL_PACK(floattov10(-0.1328),floattov10(-0.387),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.0236964),floattov16(-0.224597)), VERTEX_PACK(floattov16(0.525471),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(388)),
-	NORMAL_PACK(floattov10(-0.1328),floattov10(-0.387),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.0236964),floattov16(-0.224597)), VERTEX_PACK(floattov16(0.525471),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(375)),
-	NORMAL_PACK(floattov10(0.2008),floattov10(0.3221),floattov10(0.9252)),
-	VERTEX_PACK(floattov16(0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(87),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2814),floattov10(0.7842),floattov10(0.553)),
-	VERTEX_PACK(floattov16(0.0541058),floattov16(-0.0962423)), VERTEX_PACK(floattov16(0.56191),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(90),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.3965),floattov10(0.7322),floattov10(0.5538)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.116992)), VERTEX_PACK(floattov16(0.536231),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(388)),
-	NORMAL_PACK(floattov10(-0.1328),floattov10(-0.387),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.0236964),floattov16(-0.224597)), VERTEX_PACK(floattov16(0.525471),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(76),inttot16(384)),
-	NORMAL_PACK(floattov10(0.0129),floattov10(-0.6017),floattov10(0.7986)),
-	VERTEX_PACK(floattov16(6.3e-05),floattov16(-0.200567)), VERTEX_PACK(floattov16(0.560617),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(388)),
-	NORMAL_PACK(floattov10(-0.1328),floattov10(-0.387),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.0236964),floattov16(-0.224597)), VERTEX_PACK(floattov16(0.525471),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(76),inttot16(384)),
-	NORMAL_PACK(floattov10(0.0129),floattov10(-0.6017),floattov10(0.7986)),
-	VERTEX_PACK(floattov16(6.3e-05),floattov16(-0.200567)), VERTEX_PACK(floattov16(0.560617),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(87),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2814),floattov10(0.7842),floattov10(0.553)),
-	VERTEX_PACK(floattov16(0.0541058),floattov16(-0.0962423)), VERTEX_PACK(floattov16(0.56191),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(87),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2814),floattov10(0.7842),floattov10(0.553)),
-	VERTEX_PACK(floattov16(0.0541058),floattov16(-0.0962423)), VERTEX_PACK(floattov16(0.56191),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(76),inttot16(384)),
-	NORMAL_PACK(floattov10(0.0129),floattov10(-0.6017),floattov10(0.7986)),
-	VERTEX_PACK(floattov16(6.3e-05),floattov16(-0.200567)), VERTEX_PACK(floattov16(0.560617),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(76),inttot16(384)),
-	NORMAL_PACK(floattov10(0.0129),floattov10(-0.6017),floattov10(0.7986)),
-	VERTEX_PACK(floattov16(6.3e-05),floattov16(-0.200567)), VERTEX_PACK(floattov16(0.560617),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(393)),
-	NORMAL_PACK(floattov10(-0.2648),floattov10(0.2938),floattov10(0.9184)),
-	VERTEX_PACK(floattov16(-0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(0.177516),floattov16(-0.360302)), VERTEX_PACK(floattov16(0.466022),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(0.128007),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(-0.128006),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(-0.177518),floattov16(-0.360298)), VERTEX_PACK(floattov16(0.466021),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(0.128007),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(0.177516),floattov16(-0.360302)), VERTEX_PACK(floattov16(0.466022),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(346)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(346)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(347)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(0.128007),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(-0.128006),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(347)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(349)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(349)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(418)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(18),inttot16(382)),
-	NORMAL_PACK(floattov10(-0.1736),floattov10(0.5349),floattov10(0.8269)),
-	VERTEX_PACK(floattov16(0.0200466),floattov16(-0.597738)), VERTEX_PACK(floattov16(0.451473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(18),inttot16(382)),
-	NORMAL_PACK(floattov10(-0.1736),floattov10(0.5349),floattov10(0.8269)),
-	VERTEX_PACK(floattov16(0.0200466),floattov16(-0.597738)), VERTEX_PACK(floattov16(0.451473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.3083),floattov10(-0.0935),floattov10(0.9467)),
-	VERTEX_PACK(floattov16(0.0637798),floattov16(-0.587122)), VERTEX_PACK(floattov16(0.495222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(388)),
-	NORMAL_PACK(floattov10(0.6677),floattov10(-0.1717),floattov10(0.7244)),
-	VERTEX_PACK(floattov16(-0.0614922),floattov16(-0.556408)), VERTEX_PACK(floattov16(0.455361),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(392)),
-	NORMAL_PACK(floattov10(0.2925),floattov10(-0.3033),floattov10(0.9069)),
-	VERTEX_PACK(floattov16(-0.0723597),floattov16(-0.555815)), VERTEX_PACK(floattov16(0.50188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(388)),
-	NORMAL_PACK(floattov10(0.3885),floattov10(-0.7776),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.0533323),floattov16(-0.538639)), VERTEX_PACK(floattov16(0.468847),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(392)),
-	NORMAL_PACK(floattov10(0.2925),floattov10(-0.3033),floattov10(0.9069)),
-	VERTEX_PACK(floattov16(-0.0723597),floattov16(-0.555815)), VERTEX_PACK(floattov16(0.50188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.395),floattov10(-0.7234),floattov10(0.5663)),
-	VERTEX_PACK(floattov16(0.0551796),floattov16(-0.535963)), VERTEX_PACK(floattov16(0.469127),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.395),floattov10(-0.7234),floattov10(0.5663)),
-	VERTEX_PACK(floattov16(0.0551796),floattov16(-0.535963)), VERTEX_PACK(floattov16(0.469127),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(388)),
-	NORMAL_PACK(floattov10(0.3885),floattov10(-0.7776),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.0533323),floattov16(-0.538639)), VERTEX_PACK(floattov16(0.468847),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(386)),
-	NORMAL_PACK(floattov10(0.3634),floattov10(0.4377),floattov10(0.8224)),
-	VERTEX_PACK(floattov16(-0.0389116),floattov16(-0.589841)), VERTEX_PACK(floattov16(0.451038),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(18),inttot16(382)),
-	NORMAL_PACK(floattov10(-0.1736),floattov10(0.5349),floattov10(0.8269)),
-	VERTEX_PACK(floattov16(0.0200466),floattov16(-0.597738)), VERTEX_PACK(floattov16(0.451473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(388)),
-	NORMAL_PACK(floattov10(0.6677),floattov10(-0.1717),floattov10(0.7244)),
-	VERTEX_PACK(floattov16(-0.0614922),floattov16(-0.556408)), VERTEX_PACK(floattov16(0.455361),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(388)),
-	NORMAL_PACK(floattov10(0.3885),floattov10(-0.7776),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.0533323),floattov16(-0.538639)), VERTEX_PACK(floattov16(0.468847),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(362)),
-	NORMAL_PACK(floattov10(0.2738),floattov10(0.0046),floattov10(0.9618)),
-	VERTEX_PACK(floattov16(0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(415)),
-	NORMAL_PACK(floattov10(-0.1332),floattov10(-0.0733),floattov10(0.9884)),
-	VERTEX_PACK(floattov16(-0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.1535),floattov10(-0.1529),floattov10(0.9762)),
-	VERTEX_PACK(floattov16(-0.1669),floattov16(0.0372701)), VERTEX_PACK(floattov16(0.52305),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(318)),
-	NORMAL_PACK(floattov10(0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(0.406156),floattov16(0.26336)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(318)),
-	NORMAL_PACK(floattov10(0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(0.406156),floattov16(0.26336)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(415)),
-	NORMAL_PACK(floattov10(-0.1332),floattov10(-0.0733),floattov10(0.9884)),
-	VERTEX_PACK(floattov16(-0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(353)),
-	NORMAL_PACK(floattov10(0.1227),floattov10(-0.0732),floattov10(0.9897)),
-	VERTEX_PACK(floattov16(0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(349)),
-	NORMAL_PACK(floattov10(0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(349)),
-	NORMAL_PACK(floattov10(0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.0194),floattov10(-0.9533),floattov10(0.3015)),
-	VERTEX_PACK(floattov16(-0.2625),floattov16(0.278907)), VERTEX_PACK(floattov16(0.525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(419)),
-	NORMAL_PACK(floattov10(-0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(334)),
-	NORMAL_PACK(floattov10(-0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(142),inttot16(323)),
-	NORMAL_PACK(floattov10(-0.0386),floattov10(-0.3275),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.377077),floattov16(0.219551)), VERTEX_PACK(floattov16(0.476325),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(433)),
-	NORMAL_PACK(floattov10(0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(-0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(142),inttot16(323)),
-	NORMAL_PACK(floattov10(-0.0386),floattov10(-0.3275),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.377077),floattov16(0.219551)), VERTEX_PACK(floattov16(0.476325),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(321)),
-	NORMAL_PACK(floattov10(-0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(446)),
-	NORMAL_PACK(floattov10(0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(-0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(142),inttot16(445)),
-	NORMAL_PACK(floattov10(0.0386),floattov10(-0.3275),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(-0.377077),floattov16(0.219551)), VERTEX_PACK(floattov16(0.476325),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(321)),
-	NORMAL_PACK(floattov10(-0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(323)),
-	NORMAL_PACK(floattov10(0.0094),floattov10(0.1735),floattov10(0.9848)),
-	VERTEX_PACK(floattov16(0.375976),floattov16(0.145606)), VERTEX_PACK(floattov16(0.473047),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.0094),floattov10(0.1735),floattov10(0.9848)),
-	VERTEX_PACK(floattov16(-0.375976),floattov16(0.145606)), VERTEX_PACK(floattov16(0.473047),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(446)),
-	NORMAL_PACK(floattov10(0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(-0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(-0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.0094),floattov10(0.1735),floattov10(0.9848)),
-	VERTEX_PACK(floattov16(-0.375976),floattov16(0.145606)), VERTEX_PACK(floattov16(0.473047),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(330)),
-	NORMAL_PACK(floattov10(-0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(336)),
-	NORMAL_PACK(floattov10(0.1731),floattov10(0.4415),floattov10(0.8804)),
-	VERTEX_PACK(floattov16(0.292578),floattov16(0.0710934)), VERTEX_PACK(floattov16(0.500391),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(336)),
-	NORMAL_PACK(floattov10(0.1731),floattov10(0.4415),floattov10(0.8804)),
-	VERTEX_PACK(floattov16(0.292578),floattov16(0.0710934)), VERTEX_PACK(floattov16(0.500391),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(344)),
-	NORMAL_PACK(floattov10(0.2821),floattov10(0.6012),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516358),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.1731),floattov10(0.4415),floattov10(0.8804)),
-	VERTEX_PACK(floattov16(-0.292578),floattov16(0.0710934)), VERTEX_PACK(floattov16(0.500391),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(-0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(344)),
-	NORMAL_PACK(floattov10(0.2821),floattov10(0.6012),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516358),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(354)),
-	NORMAL_PACK(floattov10(0.3155),floattov10(0.5021),floattov10(0.8052)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.0881839)), VERTEX_PACK(floattov16(0.527051),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(354)),
-	NORMAL_PACK(floattov10(0.3155),floattov10(0.5021),floattov10(0.8052)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.0881839)), VERTEX_PACK(floattov16(0.527051),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(358)),
-	NORMAL_PACK(floattov10(0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(-0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.3155),floattov10(0.5021),floattov10(0.8052)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.0881839)), VERTEX_PACK(floattov16(0.527051),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(362)),
-	NORMAL_PACK(floattov10(0.2738),floattov10(0.0046),floattov10(0.9618)),
-	VERTEX_PACK(floattov16(0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(358)),
-	NORMAL_PACK(floattov10(0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(358)),
-	NORMAL_PACK(floattov10(0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(141),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8661),floattov10(-0.4994),floattov10(-0.0228)),
-	VERTEX_PACK(floattov16(0.136562),floattov16(0.206445)), VERTEX_PACK(floattov16(0.528855),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(362)),
-	NORMAL_PACK(floattov10(0.2738),floattov10(0.0046),floattov10(0.9618)),
-	VERTEX_PACK(floattov16(0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(-0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(141),inttot16(409)),
-	NORMAL_PACK(floattov10(-0.8661),floattov10(-0.4994),floattov10(-0.0228)),
-	VERTEX_PACK(floattov16(-0.136562),floattov16(0.206445)), VERTEX_PACK(floattov16(0.528855),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(127),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.7724),floattov10(0.3461),floattov10(0.5326)),
-	VERTEX_PACK(floattov16(-0.151262),floattov16(0.110043)), VERTEX_PACK(floattov16(0.528473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(268),inttot16(303)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(287)),
-	NORMAL_PACK(floattov10(0.624),floattov10(0.6714),floattov10(0.3998)),
-	VERTEX_PACK(floattov16(-0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(275),inttot16(290)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(312),inttot16(297)),
-	NORMAL_PACK(floattov10(-0.4178),floattov10(0.7335),floattov10(-0.5361)),
-	VERTEX_PACK(floattov16(0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(287)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(291)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(242),inttot16(297)),
-	NORMAL_PACK(floattov10(0.4162),floattov10(0.7338),floattov10(-0.537)),
-	VERTEX_PACK(floattov16(-0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458014),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(-0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(291)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(291)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(287)),
-	NORMAL_PACK(floattov10(0.624),floattov10(0.6714),floattov10(0.3998)),
-	VERTEX_PACK(floattov16(-0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(242),inttot16(297)),
-	NORMAL_PACK(floattov10(0.4162),floattov10(0.7338),floattov10(-0.537)),
-	VERTEX_PACK(floattov16(-0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458014),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(302)),
-	NORMAL_PACK(floattov10(0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(291)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(341),inttot16(318)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(-0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(224),inttot16(322)),
-	NORMAL_PACK(floattov10(-0.2882),floattov10(0.873),floattov10(-0.3934)),
-	VERTEX_PACK(floattov16(-0.347457),floattov16(0.394643)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(213),inttot16(318)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(224),inttot16(322)),
-	NORMAL_PACK(floattov10(-0.2882),floattov10(0.873),floattov10(-0.3934)),
-	VERTEX_PACK(floattov16(-0.347457),floattov16(0.394643)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(197),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(213),inttot16(318)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(374),inttot16(28)),
-	NORMAL_PACK(floattov10(0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(354),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(361),inttot16(358)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(352),inttot16(365)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(342),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(115),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(-0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(358)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(197),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(209),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(27)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(431),inttot16(463)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(478)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(480)),
-	NORMAL_PACK(floattov10(0.5484),floattov10(-0.2003),floattov10(-0.8119)),
-	VERTEX_PACK(floattov16(0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(437)),
-	NORMAL_PACK(floattov10(-0.5512),floattov10(-0.2013),floattov10(-0.8097)),
-	VERTEX_PACK(floattov16(-0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(439)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(430),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(430),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(437)),
-	NORMAL_PACK(floattov10(-0.5512),floattov10(-0.2013),floattov10(-0.8097)),
-	VERTEX_PACK(floattov16(-0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(480)),
-	NORMAL_PACK(floattov10(0.5484),floattov10(-0.2003),floattov10(-0.8119)),
-	VERTEX_PACK(floattov16(0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(392),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0026),floattov10(-0.3613),floattov10(-0.9325)),
-	VERTEX_PACK(floattov16(0.0064589),floattov16(-0.576509)), VERTEX_PACK(floattov16(0.257914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(369),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0313),floattov10(-0.7668),floattov10(-0.6412)),
-	VERTEX_PACK(floattov16(-0.0191184),floattov16(-0.661867)), VERTEX_PACK(floattov16(0.316584),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(385),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(381),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.4164),floattov10(-0.68),floattov10(-0.6035)),
-	VERTEX_PACK(floattov16(-0.204667),floattov16(-0.64538)), VERTEX_PACK(floattov16(0.314649),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(503)),
-	NORMAL_PACK(floattov10(0.9886),floattov10(0.1189),floattov10(-0.092)),
-	VERTEX_PACK(floattov16(0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(508)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(385),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0313),floattov10(-0.7668),floattov10(-0.6412)),
-	VERTEX_PACK(floattov16(-0.0191184),floattov16(-0.661867)), VERTEX_PACK(floattov16(0.316584),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(381),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.4164),floattov10(-0.68),floattov10(-0.6035)),
-	VERTEX_PACK(floattov16(-0.204667),floattov16(-0.64538)), VERTEX_PACK(floattov16(0.314649),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(480)),
-	NORMAL_PACK(floattov10(0.5484),floattov10(-0.2003),floattov10(-0.8119)),
-	VERTEX_PACK(floattov16(0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(478)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(493)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(39)),
-	NORMAL_PACK(floattov10(-0.9886),floattov10(0.1186),floattov10(-0.0923)),
-	VERTEX_PACK(floattov16(-0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(50)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(38)),
-	NORMAL_PACK(floattov10(0.9886),floattov10(0.1189),floattov10(-0.092)),
-	VERTEX_PACK(floattov16(0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(39)),
-	NORMAL_PACK(floattov10(-0.9886),floattov10(0.1186),floattov10(-0.0923)),
-	VERTEX_PACK(floattov16(-0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(10),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(413)),
-	NORMAL_PACK(floattov10(-0.9886),floattov10(0.1186),floattov10(-0.0923)),
-	VERTEX_PACK(floattov16(-0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(442),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(464),inttot16(32)),
-	NORMAL_PACK(floattov10(0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(0.165936),floattov16(-0.124784)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(21)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(471),inttot16(26)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(471),inttot16(26)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(464),inttot16(32)),
-	NORMAL_PACK(floattov10(0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(0.165936),floattov16(-0.124784)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(26),inttot16(33)),
-	NORMAL_PACK(floattov10(-0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(-0.165936),floattov16(-0.124785)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(23)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(26),inttot16(33)),
-	NORMAL_PACK(floattov10(-0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(-0.165936),floattov16(-0.124785)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(26),inttot16(33)),
-	NORMAL_PACK(floattov10(-0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(-0.165936),floattov16(-0.124785)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(61),inttot16(26)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(26),inttot16(33)),
-	NORMAL_PACK(floattov10(-0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(-0.165936),floattov16(-0.124785)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(23)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(61),inttot16(26)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(262),inttot16(196)),
-	NORMAL_PACK(floattov10(0.2844),floattov10(-0.7757),floattov10(-0.5634)),
-	VERTEX_PACK(floattov16(0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(261),inttot16(175)),
-	NORMAL_PACK(floattov10(0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(0.117127),floattov16(-0.0080619)), VERTEX_PACK(floattov16(-0.49256),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(262),inttot16(196)),
-	NORMAL_PACK(floattov10(0.2844),floattov10(-0.7757),floattov10(-0.5634)),
-	VERTEX_PACK(floattov16(0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(218),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.4924),floattov10(-0.736),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.231352),floattov16(-0.117893)), VERTEX_PACK(floattov16(-0.33385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(235),inttot16(176)),
-	NORMAL_PACK(floattov10(-0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(-0.117125),floattov16(-0.0080612)), VERTEX_PACK(floattov16(-0.492559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(273),inttot16(282)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(283)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(283)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(284)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(283)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(283)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(73)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(10),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(391),inttot16(94)),
-	NORMAL_PACK(floattov10(0.7653),floattov10(-0.6371),floattov10(0.0916)),
-	VERTEX_PACK(floattov16(0.503486),floattov16(-0.0159068)), VERTEX_PACK(floattov16(0.0106575),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(112),inttot16(93)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(94),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.6769),floattov10(-0.7214),floattov10(0.1462)),
-	VERTEX_PACK(floattov16(-0.488146),floattov16(-0.0268065)), VERTEX_PACK(floattov16(0.0421008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(112),inttot16(93)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(261),inttot16(175)),
-	NORMAL_PACK(floattov10(0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(0.117127),floattov16(-0.0080619)), VERTEX_PACK(floattov16(-0.49256),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(261),inttot16(175)),
-	NORMAL_PACK(floattov10(0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(0.117127),floattov16(-0.0080619)), VERTEX_PACK(floattov16(-0.49256),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(235),inttot16(176)),
-	NORMAL_PACK(floattov10(-0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(-0.117125),floattov16(-0.0080612)), VERTEX_PACK(floattov16(-0.492559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(152)),
-	NORMAL_PACK(floattov10(-0.0074),floattov10(-0.0211),floattov10(-0.9997)),
-	VERTEX_PACK(floattov16(0),floattov16(0.20918)), VERTEX_PACK(floattov16(-0.560547),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(152)),
-	NORMAL_PACK(floattov10(-0.0074),floattov10(-0.0211),floattov10(-0.9997)),
-	VERTEX_PACK(floattov16(0),floattov16(0.20918)), VERTEX_PACK(floattov16(-0.560547),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(67)),
-	NORMAL_PACK(floattov10(0.0685),floattov10(0.9572),floattov10(0.2811)),
-	VERTEX_PACK(floattov16(0.0945063),floattov16(0.649421)), VERTEX_PACK(floattov16(0.0735315),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(67)),
-	NORMAL_PACK(floattov10(0.0685),floattov10(0.9572),floattov10(0.2811)),
-	VERTEX_PACK(floattov16(0.0945063),floattov16(0.649421)), VERTEX_PACK(floattov16(0.0735315),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(267),inttot16(107)),
-	NORMAL_PACK(floattov10(0.2543),floattov10(0.8194),floattov10(-0.5137)),
-	VERTEX_PACK(floattov16(0.216117),floattov16(0.587917)), VERTEX_PACK(floattov16(-0.299727),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(109)),
-	NORMAL_PACK(floattov10(0.0283),floattov10(0.8546),floattov10(-0.5185)),
-	VERTEX_PACK(floattov16(0),floattov16(0.598999)), VERTEX_PACK(floattov16(-0.343506),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(109)),
-	NORMAL_PACK(floattov10(0.0283),floattov10(0.8546),floattov10(-0.5185)),
-	VERTEX_PACK(floattov16(0),floattov16(0.598999)), VERTEX_PACK(floattov16(-0.343506),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(226),inttot16(108)),
-	NORMAL_PACK(floattov10(-0.2754),floattov10(0.8032),floattov10(-0.5283)),
-	VERTEX_PACK(floattov16(-0.216113),floattov16(0.587916)), VERTEX_PACK(floattov16(-0.299723),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(109)),
-	NORMAL_PACK(floattov10(0.0283),floattov10(0.8546),floattov10(-0.5185)),
-	VERTEX_PACK(floattov16(0),floattov16(0.598999)), VERTEX_PACK(floattov16(-0.343506),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(226),inttot16(108)),
-	NORMAL_PACK(floattov10(-0.2754),floattov10(0.8032),floattov10(-0.5283)),
-	VERTEX_PACK(floattov16(-0.216113),floattov16(0.587916)), VERTEX_PACK(floattov16(-0.299723),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(109)),
-	NORMAL_PACK(floattov10(0.0283),floattov10(0.8546),floattov10(-0.5185)),
-	VERTEX_PACK(floattov16(0),floattov16(0.598999)), VERTEX_PACK(floattov16(-0.343506),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(335),inttot16(50)),
-	NORMAL_PACK(floattov10(0.7583),floattov10(0.5902),floattov10(0.277)),
-	VERTEX_PACK(floattov16(0.51175),floattov16(0.300337)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(340),inttot16(38)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(37)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(50)),
-	NORMAL_PACK(floattov10(-0.7731),floattov10(0.5788),floattov10(0.2595)),
-	VERTEX_PACK(floattov16(-0.51175),floattov16(0.300338)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(75)),
-	NORMAL_PACK(floattov10(0.7879),floattov10(0.4929),floattov10(0.3691)),
-	VERTEX_PACK(floattov16(0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(170),inttot16(75)),
-	NORMAL_PACK(floattov10(-0.803),floattov10(0.4774),floattov10(0.3568)),
-	VERTEX_PACK(floattov16(-0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(170),inttot16(75)),
-	NORMAL_PACK(floattov10(-0.803),floattov10(0.4774),floattov10(0.3568)),
-	VERTEX_PACK(floattov16(-0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(101)),
-	NORMAL_PACK(floattov10(0.7678),floattov10(0.6218),floattov10(-0.1545)),
-	VERTEX_PACK(floattov16(0.505553),floattov16(0.461539)), VERTEX_PACK(floattov16(-0.166163),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(101)),
-	NORMAL_PACK(floattov10(0.7678),floattov10(0.6218),floattov10(-0.1545)),
-	VERTEX_PACK(floattov16(0.505553),floattov16(0.461539)), VERTEX_PACK(floattov16(-0.166163),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(102)),
-	NORMAL_PACK(floattov10(-0.7626),floattov10(0.6219),floattov10(-0.1779)),
-	VERTEX_PACK(floattov16(-0.505554),floattov16(0.461542)), VERTEX_PACK(floattov16(-0.16616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(102)),
-	NORMAL_PACK(floattov10(-0.7626),floattov10(0.6219),floattov10(-0.1779)),
-	VERTEX_PACK(floattov16(-0.505554),floattov16(0.461542)), VERTEX_PACK(floattov16(-0.16616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(298),inttot16(127)),
-	NORMAL_PACK(floattov10(0.6232),floattov10(0.34),floattov10(-0.7042)),
-	VERTEX_PACK(floattov16(0.467617),floattov16(0.363704)), VERTEX_PACK(floattov16(-0.333693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(320),inttot16(141)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(298),inttot16(127)),
-	NORMAL_PACK(floattov10(0.6232),floattov10(0.34),floattov10(-0.7042)),
-	VERTEX_PACK(floattov16(0.467617),floattov16(0.363704)), VERTEX_PACK(floattov16(-0.333693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(191),inttot16(129)),
-	NORMAL_PACK(floattov10(-0.6546),floattov10(0.2806),floattov10(-0.7019)),
-	VERTEX_PACK(floattov16(-0.481704),floattov16(0.339748)), VERTEX_PACK(floattov16(-0.326675),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(191),inttot16(129)),
-	NORMAL_PACK(floattov10(-0.6546),floattov10(0.2806),floattov10(-0.7019)),
-	VERTEX_PACK(floattov16(-0.481704),floattov16(0.339748)), VERTEX_PACK(floattov16(-0.326675),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(144)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(267),inttot16(107)),
-	NORMAL_PACK(floattov10(0.2543),floattov10(0.8194),floattov10(-0.5137)),
-	VERTEX_PACK(floattov16(0.216117),floattov16(0.587917)), VERTEX_PACK(floattov16(-0.299727),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(101)),
-	NORMAL_PACK(floattov10(0.7678),floattov10(0.6218),floattov10(-0.1545)),
-	VERTEX_PACK(floattov16(0.505553),floattov16(0.461539)), VERTEX_PACK(floattov16(-0.166163),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(82)),
-	NORMAL_PACK(floattov10(-0.594),floattov10(0.7938),floattov10(0.1303)),
-	VERTEX_PACK(floattov16(-0.38523),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354326),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(101)),
-	NORMAL_PACK(floattov10(0.7678),floattov10(0.6218),floattov10(-0.1545)),
-	VERTEX_PACK(floattov16(0.505553),floattov16(0.461539)), VERTEX_PACK(floattov16(-0.166163),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(82)),
-	NORMAL_PACK(floattov10(-0.594),floattov10(0.7938),floattov10(0.1303)),
-	VERTEX_PACK(floattov16(-0.38523),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354326),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(210),inttot16(59)),
-	NORMAL_PACK(floattov10(-0.4415),floattov10(0.726),floattov10(0.5272)),
-	VERTEX_PACK(floattov16(-0.293345),floattov16(0.563979)), VERTEX_PACK(floattov16(0.148068),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(82)),
-	NORMAL_PACK(floattov10(-0.594),floattov10(0.7938),floattov10(0.1303)),
-	VERTEX_PACK(floattov16(-0.38523),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354326),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(102)),
-	NORMAL_PACK(floattov10(-0.7626),floattov10(0.6219),floattov10(-0.1779)),
-	VERTEX_PACK(floattov16(-0.505554),floattov16(0.461542)), VERTEX_PACK(floattov16(-0.16616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(286),inttot16(20)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(20)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(210),inttot16(59)),
-	NORMAL_PACK(floattov10(-0.4415),floattov10(0.726),floattov10(0.5272)),
-	VERTEX_PACK(floattov16(-0.293345),floattov16(0.563979)), VERTEX_PACK(floattov16(0.148068),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(307),inttot16(23)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(286),inttot16(20)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(333)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(209),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(197),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(210),inttot16(59)),
-	NORMAL_PACK(floattov10(-0.4415),floattov10(0.726),floattov10(0.5272)),
-	VERTEX_PACK(floattov16(-0.293345),floattov16(0.563979)), VERTEX_PACK(floattov16(0.148068),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(20)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(301)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(312),inttot16(297)),
-	NORMAL_PACK(floattov10(-0.4178),floattov10(0.7335),floattov10(-0.5361)),
-	VERTEX_PACK(floattov16(0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(312),inttot16(297)),
-	NORMAL_PACK(floattov10(-0.4178),floattov10(0.7335),floattov10(-0.5361)),
-	VERTEX_PACK(floattov16(0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(302)),
-	NORMAL_PACK(floattov10(0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(302)),
-	NORMAL_PACK(floattov10(0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(330),inttot16(322)),
-	NORMAL_PACK(floattov10(0.2882),floattov10(0.873),floattov10(-0.3935)),
-	VERTEX_PACK(floattov16(0.347457),floattov16(0.394642)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(242),inttot16(297)),
-	NORMAL_PACK(floattov10(0.4162),floattov10(0.7338),floattov10(-0.537)),
-	VERTEX_PACK(floattov16(-0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458014),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(268),inttot16(303)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(224),inttot16(322)),
-	NORMAL_PACK(floattov10(-0.2882),floattov10(0.873),floattov10(-0.3934)),
-	VERTEX_PACK(floattov16(-0.347457),floattov16(0.394643)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(-0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(330),inttot16(322)),
-	NORMAL_PACK(floattov10(0.2882),floattov10(0.873),floattov10(-0.3935)),
-	VERTEX_PACK(floattov16(0.347457),floattov16(0.394642)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(325),inttot16(333)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(286),inttot16(20)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(4)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(333)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(224),inttot16(322)),
-	NORMAL_PACK(floattov10(-0.2882),floattov10(0.873),floattov10(-0.3934)),
-	VERTEX_PACK(floattov16(-0.347457),floattov16(0.394643)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(250),inttot16(316)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(268),inttot16(303)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(4)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(20)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(0)),
-	NORMAL_PACK(floattov10(-0.1152),floattov10(0.855),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.0154651),floattov16(0.306116)), VERTEX_PACK(floattov16(0.432917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(4)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(354),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(37)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(50)),
-	NORMAL_PACK(floattov10(-0.7731),floattov10(0.5788),floattov10(0.2595)),
-	VERTEX_PACK(floattov16(-0.51175),floattov16(0.300338)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(354),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(337),inttot16(111)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(50)),
-	NORMAL_PACK(floattov10(-0.7731),floattov10(0.5788),floattov10(0.2595)),
-	VERTEX_PACK(floattov16(-0.51175),floattov16(0.300338)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(170),inttot16(75)),
-	NORMAL_PACK(floattov10(-0.803),floattov10(0.4774),floattov10(0.3568)),
-	VERTEX_PACK(floattov16(-0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(75)),
-	NORMAL_PACK(floattov10(0.7879),floattov10(0.4929),floattov10(0.3691)),
-	VERTEX_PACK(floattov16(0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(117)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(107)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(170),inttot16(75)),
-	NORMAL_PACK(floattov10(-0.803),floattov10(0.4774),floattov10(0.3568)),
-	VERTEX_PACK(floattov16(-0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(328),inttot16(125)),
-	NORMAL_PACK(floattov10(0.489),floattov10(0.8101),floattov10(-0.3236)),
-	VERTEX_PACK(floattov16(0.570602),floattov16(0.239544)), VERTEX_PACK(floattov16(-0.212448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(320),inttot16(141)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(337),inttot16(111)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(177),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.8556),floattov10(0.5104),floattov10(0.0863)),
-	VERTEX_PACK(floattov16(-0.541404),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(144)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(166),inttot16(128)),
-	NORMAL_PACK(floattov10(-0.4801),floattov10(0.8118),floattov10(-0.3324)),
-	VERTEX_PACK(floattov16(-0.570678),floattov16(0.239484)), VERTEX_PACK(floattov16(-0.225053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(166),inttot16(128)),
-	NORMAL_PACK(floattov10(-0.4801),floattov10(0.8118),floattov10(-0.3324)),
-	VERTEX_PACK(floattov16(-0.570678),floattov16(0.239484)), VERTEX_PACK(floattov16(-0.225053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(117)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(300),inttot16(247)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(273),inttot16(282)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(284)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(201),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(437),inttot16(95)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(125)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(401),inttot16(114)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(401),inttot16(114)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(391),inttot16(94)),
-	NORMAL_PACK(floattov10(0.7653),floattov10(-0.6371),floattov10(0.0916)),
-	VERTEX_PACK(floattov16(0.503486),floattov16(-0.0159068)), VERTEX_PACK(floattov16(0.0106575),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(94),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.6769),floattov10(-0.7214),floattov10(0.1462)),
-	VERTEX_PACK(floattov16(-0.488146),floattov16(-0.0268065)), VERTEX_PACK(floattov16(0.0421008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(94)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(437),inttot16(95)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(26),inttot16(33)),
-	NORMAL_PACK(floattov10(-0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(-0.165936),floattov16(-0.124785)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(94)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(73)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.8579),floattov10(-0.402),floattov10(0.32)),
-	VERTEX_PACK(floattov16(-0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(94)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(320),inttot16(141)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(317),inttot16(161)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(180),inttot16(182)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(163)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(163)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(144)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(158)),
-	NORMAL_PACK(floattov10(0.5189),floattov10(-0.2586),floattov10(-0.8148)),
-	VERTEX_PACK(floattov16(0.357867),floattov16(0.131015)), VERTEX_PACK(floattov16(-0.41806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(301),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(159)),
-	NORMAL_PACK(floattov10(-0.5053),floattov10(-0.2503),floattov10(-0.8258)),
-	VERTEX_PACK(floattov16(-0.357867),floattov16(0.131018)), VERTEX_PACK(floattov16(-0.418055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(317),inttot16(196)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(212)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(206)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(176),inttot16(214)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(180),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(180),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(180),inttot16(182)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(206)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(301),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(206)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(218),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.4924),floattov10(-0.736),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.231352),floattov16(-0.117893)), VERTEX_PACK(floattov16(-0.33385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(218),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.4924),floattov10(-0.736),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.231352),floattov16(-0.117893)), VERTEX_PACK(floattov16(-0.33385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(218),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.4924),floattov10(-0.736),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.231352),floattov16(-0.117893)), VERTEX_PACK(floattov16(-0.33385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(446)),
-	NORMAL_PACK(floattov10(0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.286597),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(446)),
-	NORMAL_PACK(floattov10(0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.286597),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(-0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.330694),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(434),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.1868),floattov10(-0.6517),floattov10(0.7351)),
-	VERTEX_PACK(floattov16(-0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.122938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.304818),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(-0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.317323),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(446)),
-	NORMAL_PACK(floattov10(0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.28787),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(-0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.300376),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(387),inttot16(352)),
-	NORMAL_PACK(floattov10(-0.5177),floattov10(-0.1161),floattov10(0.8477)),
-	VERTEX_PACK(floattov16(-0.654877),floattov16(0.25003)), VERTEX_PACK(floattov16(-0.183056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(214),inttot16(392)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(202),inttot16(421)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(121)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(94),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.6769),floattov10(-0.7214),floattov10(0.1462)),
-	VERTEX_PACK(floattov16(-0.488146),floattov16(-0.0268065)), VERTEX_PACK(floattov16(0.0421008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(112),inttot16(93)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(121)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(112),inttot16(93)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(107),inttot16(109)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(413)),
-	NORMAL_PACK(floattov10(0.1737),floattov10(-0.635),floattov10(0.7527)),
-	VERTEX_PACK(floattov16(0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.110433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(434),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.1868),floattov10(-0.6517),floattov10(0.7351)),
-	VERTEX_PACK(floattov16(-0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.122938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(434),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.1868),floattov10(-0.6517),floattov10(0.7351)),
-	VERTEX_PACK(floattov16(-0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.122938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(459),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(391),inttot16(94)),
-	NORMAL_PACK(floattov10(0.7653),floattov10(-0.6371),floattov10(0.0916)),
-	VERTEX_PACK(floattov16(0.503486),floattov16(-0.0159068)), VERTEX_PACK(floattov16(0.0106575),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(384),inttot16(106)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(107)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(112),inttot16(93)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(227),inttot16(430)),
-	NORMAL_PACK(floattov10(0.5192),floattov10(0.6571),floattov10(0.5464)),
-	VERTEX_PACK(floattov16(0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.174985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(355)),
-	NORMAL_PACK(floattov10(-0.5237),floattov10(0.6641),floattov10(0.5337)),
-	VERTEX_PACK(floattov16(-0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.187491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(413),inttot16(356)),
-	NORMAL_PACK(floattov10(-0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(-0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.230956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(342),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(337),inttot16(111)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(202),inttot16(421)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(202),inttot16(421)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(228),inttot16(442)),
-	NORMAL_PACK(floattov10(0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.217534),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(241),inttot16(450)),
-	NORMAL_PACK(floattov10(0.495),floattov10(-0.2734),floattov10(0.8248)),
-	VERTEX_PACK(floattov16(0.64302),floattov16(0.166408)), VERTEX_PACK(floattov16(-0.229753),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.4948),floattov10(-0.2732),floattov10(0.8249)),
-	VERTEX_PACK(floattov16(-0.643021),floattov16(0.166409)), VERTEX_PACK(floattov16(-0.242259),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(-0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.23004),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(228),inttot16(442)),
-	NORMAL_PACK(floattov10(0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.217534),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(228),inttot16(442)),
-	NORMAL_PACK(floattov10(0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.217534),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.21845),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(413),inttot16(356)),
-	NORMAL_PACK(floattov10(-0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(-0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.230956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(353)),
-	NORMAL_PACK(floattov10(-0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(-0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.226111),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(355)),
-	NORMAL_PACK(floattov10(-0.5237),floattov10(0.6641),floattov10(0.5337)),
-	VERTEX_PACK(floattov16(-0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.187491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(433)),
-	NORMAL_PACK(floattov10(0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.213606),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(227),inttot16(430)),
-	NORMAL_PACK(floattov10(0.5192),floattov10(0.6571),floattov10(0.5464)),
-	VERTEX_PACK(floattov16(0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.174985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(346)),
-	NORMAL_PACK(floattov10(-0.4844),floattov10(-0.3873),floattov10(0.7845)),
-	VERTEX_PACK(floattov16(-0.738185),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.29664),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.4948),floattov10(-0.2732),floattov10(0.8249)),
-	VERTEX_PACK(floattov16(-0.643021),floattov16(0.166409)), VERTEX_PACK(floattov16(-0.242259),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(447)),
-	NORMAL_PACK(floattov10(0.4844),floattov10(-0.3874),floattov10(0.7844)),
-	VERTEX_PACK(floattov16(0.738186),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.284136),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(446)),
-	NORMAL_PACK(floattov10(0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.28787),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(446)),
-	NORMAL_PACK(floattov10(0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.28787),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(447)),
-	NORMAL_PACK(floattov10(0.4844),floattov10(-0.3874),floattov10(0.7844)),
-	VERTEX_PACK(floattov16(0.738186),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.284136),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(346)),
-	NORMAL_PACK(floattov10(-0.4844),floattov10(-0.3873),floattov10(0.7845)),
-	VERTEX_PACK(floattov16(-0.738185),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.29664),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(-0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.300376),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.330331),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.304818),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(446)),
-	NORMAL_PACK(floattov10(0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.28787),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(-0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.300376),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(-0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.317323),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.304818),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(-0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.317323),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(241),inttot16(450)),
-	NORMAL_PACK(floattov10(0.495),floattov10(-0.2734),floattov10(0.8248)),
-	VERTEX_PACK(floattov16(0.64302),floattov16(0.166408)), VERTEX_PACK(floattov16(-0.229753),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.4948),floattov10(-0.2732),floattov10(0.8249)),
-	VERTEX_PACK(floattov16(-0.643021),floattov16(0.166409)), VERTEX_PACK(floattov16(-0.242259),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(-0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.23004),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(413),inttot16(356)),
-	NORMAL_PACK(floattov10(-0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(-0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.230956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(433)),
-	NORMAL_PACK(floattov10(0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.213606),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(353)),
-	NORMAL_PACK(floattov10(-0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(-0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.226111),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(-0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.342837),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.330331),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(-0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.342837),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(346)),
-	NORMAL_PACK(floattov10(-0.4844),floattov10(-0.3873),floattov10(0.7845)),
-	VERTEX_PACK(floattov16(-0.738185),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.29664),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(413)),
-	NORMAL_PACK(floattov10(0.1737),floattov10(-0.635),floattov10(0.7527)),
-	VERTEX_PACK(floattov16(0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.110433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(388)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(388)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(260),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(-0.5547),floattov10(-0.825)),
-	VERTEX_PACK(floattov16(0.549378),floattov16(-0.0323393)), VERTEX_PACK(floattov16(-0.234448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(260),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(-0.5547),floattov10(-0.825)),
-	VERTEX_PACK(floattov16(0.549378),floattov16(-0.0323393)), VERTEX_PACK(floattov16(-0.234448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(445),inttot16(320)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(434),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.1868),floattov10(-0.6517),floattov10(0.7351)),
-	VERTEX_PACK(floattov16(-0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.122938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(314)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(438)),
-	NORMAL_PACK(floattov10(0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(0.86966),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.32641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(438)),
-	NORMAL_PACK(floattov10(0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(0.86966),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.32641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(338)),
-	NORMAL_PACK(floattov10(-0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(-0.869658),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.338915),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(441)),
-	NORMAL_PACK(floattov10(0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.318188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(441)),
-	NORMAL_PACK(floattov10(0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.318188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(438)),
-	NORMAL_PACK(floattov10(0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(0.86966),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.32641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(441)),
-	NORMAL_PACK(floattov10(0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.318188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(438)),
-	NORMAL_PACK(floattov10(0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(0.86966),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.32641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(441)),
-	NORMAL_PACK(floattov10(0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.318188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(338)),
-	NORMAL_PACK(floattov10(-0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(-0.869658),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.338915),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(-0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.330694),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(-0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.330694),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(445)),
-	NORMAL_PACK(floattov10(0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.327733),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(446)),
-	NORMAL_PACK(floattov10(0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.286597),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(-0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.299103),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(-0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.340238),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(-0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.340238),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(-0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.375124),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(446)),
-	NORMAL_PACK(floattov10(0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.286597),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(445)),
-	NORMAL_PACK(floattov10(0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.327733),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(443)),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.362619),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(-0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.375124),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(-0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.340238),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(-0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.299103),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(-0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.340238),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(468)),
-	NORMAL_PACK(floattov10(0.489),floattov10(0.8101),floattov10(-0.3236)),
-	VERTEX_PACK(floattov16(0.570602),floattov16(0.239544)), VERTEX_PACK(floattov16(-0.212448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(477)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(281),inttot16(451)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(377),inttot16(323)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(373),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(367),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.4801),floattov10(0.8118),floattov10(-0.3324)),
-	VERTEX_PACK(floattov16(-0.570678),floattov16(0.239484)), VERTEX_PACK(floattov16(-0.225053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(426)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(310)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(314)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(443)),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.362619),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(256),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.371053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(338)),
-	NORMAL_PACK(floattov10(0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(-0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.383558),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(338)),
-	NORMAL_PACK(floattov10(0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(-0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.383558),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(-0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.375124),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(443)),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.362619),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(426)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(260),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(-0.5547),floattov10(-0.825)),
-	VERTEX_PACK(floattov16(0.549378),floattov16(-0.0323393)), VERTEX_PACK(floattov16(-0.234448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(282),inttot16(387)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(388)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(282),inttot16(387)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(260),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(-0.5547),floattov10(-0.825)),
-	VERTEX_PACK(floattov16(0.549378),floattov16(-0.0323393)), VERTEX_PACK(floattov16(-0.234448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(445),inttot16(320)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(459),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(434),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.1868),floattov10(-0.6517),floattov10(0.7351)),
-	VERTEX_PACK(floattov16(-0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.122938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(0),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(360)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(0),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(4),inttot16(360)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.6047),floattov10(-0.7895),floattov10(0.1051)),
-	VERTEX_PACK(floattov16(-0.216649),floattov16(-0.654763)), VERTEX_PACK(floattov16(0.365356),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(13),inttot16(419)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(8),inttot16(405)),
-	NORMAL_PACK(floattov10(-0.3256),floattov10(-0.7528),floattov10(0.5721)),
-	VERTEX_PACK(floattov16(-0.164352),floattov16(-0.651376)), VERTEX_PACK(floattov16(0.421984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.6047),floattov10(-0.7895),floattov10(0.1051)),
-	VERTEX_PACK(floattov16(-0.216649),floattov16(-0.654763)), VERTEX_PACK(floattov16(0.365356),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(355)),
-	NORMAL_PACK(floattov10(0.7799),floattov10(-0.2457),floattov10(0.5757)),
-	VERTEX_PACK(floattov16(0.219697),floattov16(-0.595512)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(0.177516),floattov16(-0.360302)), VERTEX_PACK(floattov16(0.466022),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(14),inttot16(412)),
-	NORMAL_PACK(floattov10(-0.7816),floattov10(-0.2426),floattov10(0.5746)),
-	VERTEX_PACK(floattov16(-0.219696),floattov16(-0.595511)), VERTEX_PACK(floattov16(0.421284),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(-0.177518),floattov16(-0.360298)), VERTEX_PACK(floattov16(0.466021),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(446)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(418)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(430)),
-	NORMAL_PACK(floattov10(-0.3831),floattov10(-0.5275),floattov10(0.7582)),
-	VERTEX_PACK(floattov16(-0.293987),floattov16(-0.0086898)), VERTEX_PACK(floattov16(0.472914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(321)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(301)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(321)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(301)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(288)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(480)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(467)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(288)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(292)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(288)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(480)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(480)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(457)),
-	NORMAL_PACK(floattov10(-0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(-0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(475)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(344)),
-	NORMAL_PACK(floattov10(0.4273),floattov10(0.5498),floattov10(0.7177)),
-	VERTEX_PACK(floattov16(0.22605),floattov16(0.471675)), VERTEX_PACK(floattov16(0.547777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(317)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(299)),
-	NORMAL_PACK(floattov10(0.6852),floattov10(0.2404),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(344)),
-	NORMAL_PACK(floattov10(0.4273),floattov10(0.5498),floattov10(0.7177)),
-	VERTEX_PACK(floattov16(0.22605),floattov16(0.471675)), VERTEX_PACK(floattov16(0.547777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(172),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(153),inttot16(468)),
-	NORMAL_PACK(floattov10(-0.6852),floattov10(0.2405),floattov10(0.6875)),
-	VERTEX_PACK(floattov16(-0.533896),floattov16(0.292245)), VERTEX_PACK(floattov16(0.451072),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(347)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(359)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(347)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(344)),
-	NORMAL_PACK(floattov10(0.4273),floattov10(0.5498),floattov10(0.7177)),
-	VERTEX_PACK(floattov16(0.22605),floattov16(0.471675)), VERTEX_PACK(floattov16(0.547777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(408)),
-	NORMAL_PACK(floattov10(0.624),floattov10(0.6714),floattov10(0.3998)),
-	VERTEX_PACK(floattov16(-0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(186),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(181),inttot16(423)),
-	NORMAL_PACK(floattov10(-0.3714),floattov10(0.5622),floattov10(0.7389)),
-	VERTEX_PACK(floattov16(-0.226049),floattov16(0.471674)), VERTEX_PACK(floattov16(0.547779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(359)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(164),inttot16(378)),
-	NORMAL_PACK(floattov10(-0.52),floattov10(0.7642),floattov10(0.3817)),
-	VERTEX_PACK(floattov16(0.0309274),floattov16(0.311531)), VERTEX_PACK(floattov16(0.540832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(408)),
-	NORMAL_PACK(floattov10(0.624),floattov10(0.6714),floattov10(0.3998)),
-	VERTEX_PACK(floattov16(-0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(163),inttot16(386)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(164),inttot16(378)),
-	NORMAL_PACK(floattov10(-0.52),floattov10(0.7642),floattov10(0.3817)),
-	VERTEX_PACK(floattov16(0.0309274),floattov16(0.311531)), VERTEX_PACK(floattov16(0.540832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(163),inttot16(386)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.0374),floattov10(-0.0569),floattov10(0.9977)),
-	VERTEX_PACK(floattov16(-0.0057463),floattov16(0.248136)), VERTEX_PACK(floattov16(0.566927),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(163),inttot16(386)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(412)),
-	NORMAL_PACK(floattov10(0.1051),floattov10(0.1734),floattov10(0.9792)),
-	VERTEX_PACK(floattov16(-0.147932),floattov16(0.420958)), VERTEX_PACK(floattov16(0.580565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(350)),
-	NORMAL_PACK(floattov10(0.0686),floattov10(0.2148),floattov10(0.9742)),
-	VERTEX_PACK(floattov16(0.18824),floattov16(0.44204)), VERTEX_PACK(floattov16(0.576564),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.1433),floattov10(-0.1763),floattov10(0.9738)),
-	VERTEX_PACK(floattov16(-0.085169),floattov16(0.231381)), VERTEX_PACK(floattov16(0.546102),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(318)),
-	NORMAL_PACK(floattov10(0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(0.406156),floattov16(0.26336)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(173),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.1431),floattov10(0.2403),floattov10(0.9601)),
-	VERTEX_PACK(floattov16(-0.200619),floattov16(0.438234)), VERTEX_PACK(floattov16(0.573203),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(312)),
-	NORMAL_PACK(floattov10(0.3345),floattov10(-0.0808),floattov10(0.9389)),
-	VERTEX_PACK(floattov16(0.447051),floattov16(0.304343)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(318)),
-	NORMAL_PACK(floattov10(0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(0.406156),floattov16(0.26336)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(463)),
-	NORMAL_PACK(floattov10(-0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(-0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(-0.406146),floattov16(0.263362)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(155),inttot16(455)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0809),floattov10(0.939)),
-	VERTEX_PACK(floattov16(-0.447054),floattov16(0.30434)), VERTEX_PACK(floattov16(0.500966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(305)),
-	NORMAL_PACK(floattov10(0.4567),floattov10(-0.2434),floattov10(0.8557)),
-	VERTEX_PACK(floattov16(0.502086),floattov16(0.265703)), VERTEX_PACK(floattov16(0.466646),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(311)),
-	NORMAL_PACK(floattov10(0.5493),floattov10(-0.4711),floattov10(0.6901)),
-	VERTEX_PACK(floattov16(0.444826),floattov16(0.0387156)), VERTEX_PACK(floattov16(0.419565),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.1535),floattov10(-0.1529),floattov10(0.9762)),
-	VERTEX_PACK(floattov16(-0.1669),floattov16(0.0372701)), VERTEX_PACK(floattov16(0.52305),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(159),inttot16(373)),
-	NORMAL_PACK(floattov10(-0.0682),floattov10(0.042),floattov10(0.9968)),
-	VERTEX_PACK(floattov16(0.0648676),floattov16(0.296407)), VERTEX_PACK(floattov16(0.572406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(120),inttot16(385)),
-	NORMAL_PACK(floattov10(0.0064),floattov10(-0.0357),floattov10(0.9993)),
-	VERTEX_PACK(floattov16(0.0004872),floattov16(0.0675227)), VERTEX_PACK(floattov16(0.516013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(5),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0034),floattov10(-0.8727),floattov10(0.4883)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.670671)), VERTEX_PACK(floattov16(0.431233),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.3083),floattov10(-0.0935),floattov10(0.9467)),
-	VERTEX_PACK(floattov16(0.0637798),floattov16(-0.587122)), VERTEX_PACK(floattov16(0.495222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(15),inttot16(381)),
-	NORMAL_PACK(floattov10(-0.1284),floattov10(-0.0829),floattov10(0.9883)),
-	VERTEX_PACK(floattov16(0.0285264),floattov16(-0.616756)), VERTEX_PACK(floattov16(0.485527),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(11),inttot16(367)),
-	NORMAL_PACK(floattov10(0.2974),floattov10(-0.6217),floattov10(0.7246)),
-	VERTEX_PACK(floattov16(0.135792),floattov16(-0.634883)), VERTEX_PACK(floattov16(0.45018),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.3083),floattov10(-0.0935),floattov10(0.9467)),
-	VERTEX_PACK(floattov16(0.0637798),floattov16(-0.587122)), VERTEX_PACK(floattov16(0.495222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(392)),
-	NORMAL_PACK(floattov10(0.2925),floattov10(-0.3033),floattov10(0.9069)),
-	VERTEX_PACK(floattov16(-0.0723597),floattov16(-0.555815)), VERTEX_PACK(floattov16(0.50188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(363)),
-	NORMAL_PACK(floattov10(0.4973),floattov10(-0.1558),floattov10(0.8535)),
-	VERTEX_PACK(floattov16(0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(0.177516),floattov16(-0.360302)), VERTEX_PACK(floattov16(0.466022),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(-0.177518),floattov16(-0.360298)), VERTEX_PACK(floattov16(0.466021),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(404)),
-	NORMAL_PACK(floattov10(-0.488),floattov10(-0.1762),floattov10(0.8549)),
-	VERTEX_PACK(floattov16(-0.166259),floattov16(-0.54434)), VERTEX_PACK(floattov16(0.475362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2255),floattov10(-0.3885),floattov10(0.8934)),
-	VERTEX_PACK(floattov16(0.0422814),floattov16(-0.216588)), VERTEX_PACK(floattov16(0.523949),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(375)),
-	NORMAL_PACK(floattov10(0.6759),floattov10(-0.1227),floattov10(0.7267)),
-	VERTEX_PACK(floattov16(0.0823158),floattov16(-0.154662)), VERTEX_PACK(floattov16(0.571142),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(87),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2814),floattov10(0.7842),floattov10(0.553)),
-	VERTEX_PACK(floattov16(0.0541058),floattov16(-0.0962423)), VERTEX_PACK(floattov16(0.56191),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(393)),
-	NORMAL_PACK(floattov10(-0.2648),floattov10(0.2938),floattov10(0.9184)),
-	VERTEX_PACK(floattov16(-0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(87),inttot16(377)),
-	NORMAL_PACK(floattov10(0.2814),floattov10(0.7842),floattov10(0.553)),
-	VERTEX_PACK(floattov16(0.0541058),floattov16(-0.0962423)), VERTEX_PACK(floattov16(0.56191),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(375)),
-	NORMAL_PACK(floattov10(0.2008),floattov10(0.3221),floattov10(0.9252)),
-	VERTEX_PACK(floattov16(0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(393)),
-	NORMAL_PACK(floattov10(-0.2648),floattov10(0.2938),floattov10(0.9184)),
-	VERTEX_PACK(floattov16(-0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(90),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.3965),floattov10(0.7322),floattov10(0.5538)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.116992)), VERTEX_PACK(floattov16(0.536231),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(385)),
-	NORMAL_PACK(floattov10(-0.012),floattov10(0.2983),floattov10(0.9544)),
-	VERTEX_PACK(floattov16(-0.0015253),floattov16(-0.132577)), VERTEX_PACK(floattov16(0.574616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(90),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.3965),floattov10(0.7322),floattov10(0.5538)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.116992)), VERTEX_PACK(floattov16(0.536231),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(390)),
-	NORMAL_PACK(floattov10(-0.2117),floattov10(0.8583),floattov10(0.4675)),
-	VERTEX_PACK(floattov16(-0.0497399),floattov16(-0.0914354)), VERTEX_PACK(floattov16(0.555762),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(388)),
-	NORMAL_PACK(floattov10(-0.1328),floattov10(-0.387),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.0236964),floattov16(-0.224597)), VERTEX_PACK(floattov16(0.525471),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(76),inttot16(384)),
-	NORMAL_PACK(floattov10(0.0129),floattov10(-0.6017),floattov10(0.7986)),
-	VERTEX_PACK(floattov16(6.3e-05),floattov16(-0.200567)), VERTEX_PACK(floattov16(0.560617),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(82),inttot16(392)),
-	NORMAL_PACK(floattov10(-0.6717),floattov10(-0.1043),floattov10(0.7334)),
-	VERTEX_PACK(floattov16(-0.0820421),floattov16(-0.154822)), VERTEX_PACK(floattov16(0.571556),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(375)),
-	NORMAL_PACK(floattov10(0.2008),floattov10(0.3221),floattov10(0.9252)),
-	VERTEX_PACK(floattov16(0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(393)),
-	NORMAL_PACK(floattov10(-0.2648),floattov10(0.2938),floattov10(0.9184)),
-	VERTEX_PACK(floattov16(-0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(384)),
-	NORMAL_PACK(floattov10(-0.0321),floattov10(0.4909),floattov10(0.8706)),
-	VERTEX_PACK(floattov16(0.0013328),floattov16(-0.100594)), VERTEX_PACK(floattov16(0.524366),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(400)),
-	NORMAL_PACK(floattov10(-0.2016),floattov10(-0.1922),floattov10(0.9604)),
-	VERTEX_PACK(floattov16(-0.0990325),floattov16(-0.0659043)), VERTEX_PACK(floattov16(0.544208),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(91),inttot16(375)),
-	NORMAL_PACK(floattov10(0.2008),floattov10(0.3221),floattov10(0.9252)),
-	VERTEX_PACK(floattov16(0.0584248),floattov16(-0.0970809)), VERTEX_PACK(floattov16(0.530228),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(97),inttot16(367)),
-	NORMAL_PACK(floattov10(0.197),floattov10(-0.1775),floattov10(0.9642)),
-	VERTEX_PACK(floattov16(0.0978999),floattov16(-0.0647514)), VERTEX_PACK(floattov16(0.543717),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(371)),
-	NORMAL_PACK(floattov10(0.6469),floattov10(-0.3173),floattov10(0.6935)),
-	VERTEX_PACK(floattov16(0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519353),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(0.128007),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(-0.128006),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(75),inttot16(396)),
-	NORMAL_PACK(floattov10(-0.621),floattov10(-0.3251),floattov10(0.7132)),
-	VERTEX_PACK(floattov16(-0.0769867),floattov16(-0.189183)), VERTEX_PACK(floattov16(0.519354),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(49),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.7296),floattov10(0.0823),floattov10(0.6789)),
-	VERTEX_PACK(floattov16(-0.177518),floattov16(-0.360298)), VERTEX_PACK(floattov16(0.466021),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(-0.128006),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(369)),
-	NORMAL_PACK(floattov10(0.8634),floattov10(-0.0565),floattov10(0.5013)),
-	VERTEX_PACK(floattov16(0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(0.128007),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(347)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(418)),
-	NORMAL_PACK(floattov10(-0.5811),floattov10(-0.7183),floattov10(0.3824)),
-	VERTEX_PACK(floattov16(-0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(398)),
-	NORMAL_PACK(floattov10(-0.857),floattov10(-0.0576),floattov10(0.5121)),
-	VERTEX_PACK(floattov16(-0.0907683),floattov16(-0.142737)), VERTEX_PACK(floattov16(0.525339),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(77),inttot16(421)),
-	NORMAL_PACK(floattov10(-0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(-0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(72),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.8126),floattov10(0.2131),floattov10(0.5424)),
-	VERTEX_PACK(floattov16(-0.128006),floattov16(-0.190739)), VERTEX_PACK(floattov16(0.477967),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(386)),
-	NORMAL_PACK(floattov10(0.3634),floattov10(0.4377),floattov10(0.8224)),
-	VERTEX_PACK(floattov16(-0.0389116),floattov16(-0.589841)), VERTEX_PACK(floattov16(0.451038),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(18),inttot16(382)),
-	NORMAL_PACK(floattov10(-0.1736),floattov10(0.5349),floattov10(0.8269)),
-	VERTEX_PACK(floattov16(0.0200466),floattov16(-0.597738)), VERTEX_PACK(floattov16(0.451473),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(386)),
-	NORMAL_PACK(floattov10(0.3634),floattov10(0.4377),floattov10(0.8224)),
-	VERTEX_PACK(floattov16(-0.0389116),floattov16(-0.589841)), VERTEX_PACK(floattov16(0.451038),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(388)),
-	NORMAL_PACK(floattov10(0.6677),floattov10(-0.1717),floattov10(0.7244)),
-	VERTEX_PACK(floattov16(-0.0614922),floattov16(-0.556408)), VERTEX_PACK(floattov16(0.455361),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(16),inttot16(389)),
-	NORMAL_PACK(floattov10(0.1447),floattov10(-0.1288),floattov10(0.9811)),
-	VERTEX_PACK(floattov16(-0.0423899),floattov16(-0.612205)), VERTEX_PACK(floattov16(0.488693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.3083),floattov10(-0.0935),floattov10(0.9467)),
-	VERTEX_PACK(floattov16(0.0637798),floattov16(-0.587122)), VERTEX_PACK(floattov16(0.495222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(376)),
-	NORMAL_PACK(floattov10(-0.0078),floattov10(-0.3423),floattov10(0.9395)),
-	VERTEX_PACK(floattov16(0.066136),floattov16(-0.524049)), VERTEX_PACK(floattov16(0.510517),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.395),floattov10(-0.7234),floattov10(0.5663)),
-	VERTEX_PACK(floattov16(0.0551796),floattov16(-0.535963)), VERTEX_PACK(floattov16(0.469127),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(388)),
-	NORMAL_PACK(floattov10(0.6677),floattov10(-0.1717),floattov10(0.7244)),
-	VERTEX_PACK(floattov16(-0.0614922),floattov16(-0.556408)), VERTEX_PACK(floattov16(0.455361),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(388)),
-	NORMAL_PACK(floattov10(0.3885),floattov10(-0.7776),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.0533323),floattov16(-0.538639)), VERTEX_PACK(floattov16(0.468847),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(22),inttot16(392)),
-	NORMAL_PACK(floattov10(0.2925),floattov10(-0.3033),floattov10(0.9069)),
-	VERTEX_PACK(floattov16(-0.0723597),floattov16(-0.555815)), VERTEX_PACK(floattov16(0.50188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(388)),
-	NORMAL_PACK(floattov10(0.3885),floattov10(-0.7776),floattov10(0.4944)),
-	VERTEX_PACK(floattov16(-0.0533323),floattov16(-0.538639)), VERTEX_PACK(floattov16(0.468847),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.395),floattov10(-0.7234),floattov10(0.5663)),
-	VERTEX_PACK(floattov16(0.0551796),floattov16(-0.535963)), VERTEX_PACK(floattov16(0.469127),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(27),inttot16(390)),
-	NORMAL_PACK(floattov10(0.0311),floattov10(-0.4314),floattov10(0.9016)),
-	VERTEX_PACK(floattov16(-0.0574028),floattov16(-0.526407)), VERTEX_PACK(floattov16(0.511622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(388)),
-	NORMAL_PACK(floattov10(0.6677),floattov10(-0.1717),floattov10(0.7244)),
-	VERTEX_PACK(floattov16(-0.0614922),floattov16(-0.556408)), VERTEX_PACK(floattov16(0.455361),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(19),inttot16(386)),
-	NORMAL_PACK(floattov10(0.3634),floattov10(0.4377),floattov10(0.8224)),
-	VERTEX_PACK(floattov16(-0.0389116),floattov16(-0.589841)), VERTEX_PACK(floattov16(0.451038),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(21),inttot16(379)),
-	NORMAL_PACK(floattov10(-0.6461),floattov10(-0.0275),floattov10(0.7627)),
-	VERTEX_PACK(floattov16(0.0605549),floattov16(-0.562382)), VERTEX_PACK(floattov16(0.453244),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(353)),
-	NORMAL_PACK(floattov10(0.1227),floattov10(-0.0732),floattov10(0.9897)),
-	VERTEX_PACK(floattov16(0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(362)),
-	NORMAL_PACK(floattov10(0.2738),floattov10(0.0046),floattov10(0.9618)),
-	VERTEX_PACK(floattov16(0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(400)),
-	NORMAL_PACK(floattov10(0.1038),floattov10(-0.0686),floattov10(0.9922)),
-	VERTEX_PACK(floattov16(-0.0888622),floattov16(0.0929236)), VERTEX_PACK(floattov16(0.524168),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.1535),floattov10(-0.1529),floattov10(0.9762)),
-	VERTEX_PACK(floattov16(-0.1669),floattov16(0.0372701)), VERTEX_PACK(floattov16(0.52305),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(361)),
-	NORMAL_PACK(floattov10(0.0813),floattov10(-0.1266),floattov10(0.9886)),
-	VERTEX_PACK(floattov16(0.152814),floattov16(0.0441812)), VERTEX_PACK(floattov16(0.527053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(116),inttot16(410)),
-	NORMAL_PACK(floattov10(-0.1535),floattov10(-0.1529),floattov10(0.9762)),
-	VERTEX_PACK(floattov16(-0.1669),floattov16(0.0372701)), VERTEX_PACK(floattov16(0.52305),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(110),inttot16(337)),
-	NORMAL_PACK(floattov10(0.3796),floattov10(-0.5264),floattov10(0.7607)),
-	VERTEX_PACK(floattov16(0.293991),floattov16(-0.0086884)), VERTEX_PACK(floattov16(0.472912),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(-0.406146),floattov16(0.263362)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(149),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.1825),floattov10(-0.2359),floattov10(0.9545)),
-	VERTEX_PACK(floattov16(-0.406146),floattov16(0.263362)), VERTEX_PACK(floattov16(0.477414),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.1691),floattov10(-0.0782),floattov10(0.9825)),
-	VERTEX_PACK(floattov16(-0.258854),floattov16(0.324832)), VERTEX_PACK(floattov16(0.520406),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(341)),
-	NORMAL_PACK(floattov10(0.1668),floattov10(-0.0806),floattov10(0.9827)),
-	VERTEX_PACK(floattov16(0.258854),floattov16(0.324831)), VERTEX_PACK(floattov16(0.520405),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(354)),
-	NORMAL_PACK(floattov10(0.2216),floattov10(-0.1822),floattov10(0.958)),
-	VERTEX_PACK(floattov16(0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(143),inttot16(365)),
-	NORMAL_PACK(floattov10(0.146),floattov10(-0.1714),floattov10(0.9743)),
-	VERTEX_PACK(floattov16(0.0871395),floattov16(0.2206)), VERTEX_PACK(floattov16(0.543977),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(353)),
-	NORMAL_PACK(floattov10(0.1227),floattov10(-0.0732),floattov10(0.9897)),
-	VERTEX_PACK(floattov16(0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(419)),
-	NORMAL_PACK(floattov10(-0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(415)),
-	NORMAL_PACK(floattov10(-0.1332),floattov10(-0.0733),floattov10(0.9884)),
-	VERTEX_PACK(floattov16(-0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(340)),
-	NORMAL_PACK(floattov10(0.0194),floattov10(-0.9533),floattov10(0.3015)),
-	VERTEX_PACK(floattov16(0.2625),floattov16(0.278907)), VERTEX_PACK(floattov16(0.525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(349)),
-	NORMAL_PACK(floattov10(0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(340)),
-	NORMAL_PACK(floattov10(0.0194),floattov10(-0.9533),floattov10(0.3015)),
-	VERTEX_PACK(floattov16(0.2625),floattov16(0.278907)), VERTEX_PACK(floattov16(0.525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(334)),
-	NORMAL_PACK(floattov10(-0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.2531),floattov10(-0.2004),floattov10(0.9465)),
-	VERTEX_PACK(floattov16(-0.166872),floattov16(0.310048)), VERTEX_PACK(floattov16(0.538219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(419)),
-	NORMAL_PACK(floattov10(-0.046),floattov10(-0.0812),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.20641),floattov16(0.279398)), VERTEX_PACK(floattov16(0.53491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3016),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(-0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(433)),
-	NORMAL_PACK(floattov10(0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(-0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.0194),floattov10(-0.9533),floattov10(0.3015)),
-	VERTEX_PACK(floattov16(-0.2625),floattov16(0.278907)), VERTEX_PACK(floattov16(0.525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(334)),
-	NORMAL_PACK(floattov10(-0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3017),floattov10(-0.1016),floattov10(0.948)),
-	VERTEX_PACK(floattov16(0.294073),floattov16(0.281168)), VERTEX_PACK(floattov16(0.530123),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(433)),
-	NORMAL_PACK(floattov10(0.0155),floattov10(-0.7288),floattov10(0.6846)),
-	VERTEX_PACK(floattov16(-0.301923),floattov16(0.268043)), VERTEX_PACK(floattov16(0.515832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(142),inttot16(445)),
-	NORMAL_PACK(floattov10(0.0386),floattov10(-0.3275),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(-0.377077),floattov16(0.219551)), VERTEX_PACK(floattov16(0.476325),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(321)),
-	NORMAL_PACK(floattov10(-0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(321)),
-	NORMAL_PACK(floattov10(0.3145),floattov10(-0.0993),floattov10(0.9441)),
-	VERTEX_PACK(floattov16(0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(446)),
-	NORMAL_PACK(floattov10(0.0364),floattov10(-0.1116),floattov10(0.9931)),
-	VERTEX_PACK(floattov16(-0.386589),floattov16(0.180678)), VERTEX_PACK(floattov16(0.471701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(144),inttot16(447)),
-	NORMAL_PACK(floattov10(-0.3146),floattov10(-0.0992),floattov10(0.944)),
-	VERTEX_PACK(floattov16(-0.397622),floattov16(0.235962)), VERTEX_PACK(floattov16(0.482858),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(330)),
-	NORMAL_PACK(floattov10(-0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(323)),
-	NORMAL_PACK(floattov10(0.0094),floattov10(0.1735),floattov10(0.9848)),
-	VERTEX_PACK(floattov16(0.375976),floattov16(0.145606)), VERTEX_PACK(floattov16(0.473047),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(317)),
-	NORMAL_PACK(floattov10(0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(0.417118),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(330)),
-	NORMAL_PACK(floattov10(-0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(451)),
-	NORMAL_PACK(floattov10(-0.2448),floattov10(-0.1616),floattov10(0.956)),
-	VERTEX_PACK(floattov16(-0.417117),floattov16(0.16032)), VERTEX_PACK(floattov16(0.470063),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(125),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4558),floattov10(0.7127),floattov10(0.5332)),
-	VERTEX_PACK(floattov16(-0.336103),floattov16(0.0945182)), VERTEX_PACK(floattov16(0.484586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.1731),floattov10(0.4415),floattov10(0.8804)),
-	VERTEX_PACK(floattov16(-0.292578),floattov16(0.0710934)), VERTEX_PACK(floattov16(0.500391),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.2821),floattov10(0.6011),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(-0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(357)),
-	NORMAL_PACK(floattov10(0.0465),floattov10(-0.0119),floattov10(0.9988)),
-	VERTEX_PACK(floattov16(0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(336)),
-	NORMAL_PACK(floattov10(0.3407),floattov10(-0.111),floattov10(0.9336)),
-	VERTEX_PACK(floattov16(0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(344)),
-	NORMAL_PACK(floattov10(0.2821),floattov10(0.6012),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516358),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.2821),floattov10(0.6011),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(-0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(119),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.3444),floattov10(-0.1082),floattov10(0.9326)),
-	VERTEX_PACK(floattov16(-0.297812),floattov16(0.0539)), VERTEX_PACK(floattov16(0.507984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(121),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.2821),floattov10(0.6011),floattov10(0.7477)),
-	VERTEX_PACK(floattov16(-0.243265),floattov16(0.0690081)), VERTEX_PACK(floattov16(0.516359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(411)),
-	NORMAL_PACK(floattov10(-0.0867),floattov10(-0.0344),floattov10(0.9956)),
-	VERTEX_PACK(floattov16(-0.158245),floattov16(0.0811762)), VERTEX_PACK(floattov16(0.539057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(123),inttot16(414)),
-	NORMAL_PACK(floattov10(-0.3155),floattov10(0.5021),floattov10(0.8052)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.0881839)), VERTEX_PACK(floattov16(0.527051),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(362)),
-	NORMAL_PACK(floattov10(0.2738),floattov10(0.0046),floattov10(0.9618)),
-	VERTEX_PACK(floattov16(0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(141),inttot16(359)),
-	NORMAL_PACK(floattov10(0.8661),floattov10(-0.4994),floattov10(-0.0228)),
-	VERTEX_PACK(floattov16(0.136562),floattov16(0.206445)), VERTEX_PACK(floattov16(0.528855),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(353)),
-	NORMAL_PACK(floattov10(0.1227),floattov10(-0.0732),floattov10(0.9897)),
-	VERTEX_PACK(floattov16(0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(406)),
-	NORMAL_PACK(floattov10(-0.1865),floattov10(-0.0673),floattov10(0.9802)),
-	VERTEX_PACK(floattov16(-0.119391),floattov16(0.176063)), VERTEX_PACK(floattov16(0.542059),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(150),inttot16(415)),
-	NORMAL_PACK(floattov10(-0.1332),floattov10(-0.0733),floattov10(0.9884)),
-	VERTEX_PACK(floattov16(-0.177957),floattov16(0.262248)), VERTEX_PACK(floattov16(0.53433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(141),inttot16(409)),
-	NORMAL_PACK(floattov10(-0.8661),floattov10(-0.4994),floattov10(-0.0228)),
-	VERTEX_PACK(floattov16(-0.136562),floattov16(0.206445)), VERTEX_PACK(floattov16(0.528855),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(283),inttot16(290)),
-	NORMAL_PACK(floattov10(-0.52),floattov10(0.7642),floattov10(0.3817)),
-	VERTEX_PACK(floattov16(0.0309274),floattov16(0.311531)), VERTEX_PACK(floattov16(0.540832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(279),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.1152),floattov10(0.855),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.0154651),floattov16(0.306116)), VERTEX_PACK(floattov16(0.432917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(275),inttot16(290)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(279),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.1152),floattov10(0.855),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.0154651),floattov16(0.306116)), VERTEX_PACK(floattov16(0.432917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(283),inttot16(290)),
-	NORMAL_PACK(floattov10(-0.52),floattov10(0.7642),floattov10(0.3817)),
-	VERTEX_PACK(floattov16(0.0309274),floattov16(0.311531)), VERTEX_PACK(floattov16(0.540832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(301)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(279),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.1152),floattov10(0.855),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.0154651),floattov16(0.306116)), VERTEX_PACK(floattov16(0.432917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(268),inttot16(303)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(275),inttot16(290)),
-	NORMAL_PACK(floattov10(0.34),floattov10(0.806),floattov10(0.4845)),
-	VERTEX_PACK(floattov16(-0.0170674),floattov16(0.297975)), VERTEX_PACK(floattov16(0.53857),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(287)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(301)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(283),inttot16(290)),
-	NORMAL_PACK(floattov10(-0.52),floattov10(0.7642),floattov10(0.3817)),
-	VERTEX_PACK(floattov16(0.0309274),floattov16(0.311531)), VERTEX_PACK(floattov16(0.540832),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(301)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(287)),
-	NORMAL_PACK(floattov10(-0.6358),floattov10(0.6406),floattov10(0.4306)),
-	VERTEX_PACK(floattov16(0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(312),inttot16(297)),
-	NORMAL_PACK(floattov10(-0.4178),floattov10(0.7335),floattov10(-0.5361)),
-	VERTEX_PACK(floattov16(0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(268),inttot16(303)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(242),inttot16(297)),
-	NORMAL_PACK(floattov10(0.4162),floattov10(0.7338),floattov10(-0.537)),
-	VERTEX_PACK(floattov16(-0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458014),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(287)),
-	NORMAL_PACK(floattov10(0.624),floattov10(0.6714),floattov10(0.3998)),
-	VERTEX_PACK(floattov16(-0.118108),floattov16(0.462873)), VERTEX_PACK(floattov16(0.546505),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(302)),
-	NORMAL_PACK(floattov10(0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(312),inttot16(297)),
-	NORMAL_PACK(floattov10(-0.4178),floattov10(0.7335),floattov10(-0.5361)),
-	VERTEX_PACK(floattov16(0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458013),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(291)),
-	NORMAL_PACK(floattov10(0.0705),floattov10(0.9506),floattov10(0.3023)),
-	VERTEX_PACK(floattov16(0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(330),inttot16(322)),
-	NORMAL_PACK(floattov10(0.2882),floattov10(0.873),floattov10(-0.3935)),
-	VERTEX_PACK(floattov16(0.347457),floattov16(0.394642)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(321),inttot16(302)),
-	NORMAL_PACK(floattov10(0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(341),inttot16(318)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(291)),
-	NORMAL_PACK(floattov10(-0.0677),floattov10(0.9434),floattov10(0.3248)),
-	VERTEX_PACK(floattov16(-0.200906),floattov16(0.508515)), VERTEX_PACK(floattov16(0.527128),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(-0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(213),inttot16(318)),
-	NORMAL_PACK(floattov10(-0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(-0.385645),floattov16(0.386175)), VERTEX_PACK(floattov16(0.466819),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(357),inttot16(343)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(330),inttot16(322)),
-	NORMAL_PACK(floattov10(0.2882),floattov10(0.873),floattov10(-0.3935)),
-	VERTEX_PACK(floattov16(0.347457),floattov16(0.394642)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(341),inttot16(318)),
-	NORMAL_PACK(floattov10(0.5135),floattov10(0.8571),floattov10(0.0416)),
-	VERTEX_PACK(floattov16(0.385643),floattov16(0.386179)), VERTEX_PACK(floattov16(0.46682),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(330),inttot16(322)),
-	NORMAL_PACK(floattov10(0.2882),floattov10(0.873),floattov10(-0.3935)),
-	VERTEX_PACK(floattov16(0.347457),floattov16(0.394642)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(357),inttot16(343)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(325),inttot16(333)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(224),inttot16(322)),
-	NORMAL_PACK(floattov10(-0.2882),floattov10(0.873),floattov10(-0.3934)),
-	VERTEX_PACK(floattov16(-0.347457),floattov16(0.394643)), VERTEX_PACK(floattov16(0.40917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(333)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(197),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(-0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(361),inttot16(358)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(365),inttot16(371)),
-	NORMAL_PACK(floattov10(0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(352),inttot16(365)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(357),inttot16(343)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(361),inttot16(358)),
-	NORMAL_PACK(floattov10(0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(0.578576),floattov16(0.202086)), VERTEX_PACK(floattov16(0.369369),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(342),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(27)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(115),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(-0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(132),inttot16(27)),
-	NORMAL_PACK(floattov10(-0.9703),floattov10(-0.1122),floattov10(0.2144)),
-	VERTEX_PACK(floattov16(-0.578576),floattov16(0.202087)), VERTEX_PACK(floattov16(0.36937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(37)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(27)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(27)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(374),inttot16(28)),
-	NORMAL_PACK(floattov10(0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(27)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(115),inttot16(28)),
-	NORMAL_PACK(floattov10(-0.8943),floattov10(-0.4293),floattov10(0.1259)),
-	VERTEX_PACK(floattov16(-0.553721),floattov16(0.118205)), VERTEX_PACK(floattov16(0.334848),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(429),inttot16(25)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(27)),
-	NORMAL_PACK(floattov10(0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(0.480771),floattov16(0.0235718)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(61),inttot16(26)),
-	NORMAL_PACK(floattov10(-0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(-0.357096),floattov16(-0.059143)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(92),inttot16(27)),
-	NORMAL_PACK(floattov10(-0.7119),floattov10(-0.6756),floattov10(0.1917)),
-	VERTEX_PACK(floattov16(-0.480771),floattov16(0.0235732)), VERTEX_PACK(floattov16(0.357052),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(431),inttot16(463)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(480)),
-	NORMAL_PACK(floattov10(0.5484),floattov10(-0.2003),floattov10(-0.8119)),
-	VERTEX_PACK(floattov16(0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(430),inttot16(449)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(431),inttot16(463)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(392),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0026),floattov10(-0.3613),floattov10(-0.9325)),
-	VERTEX_PACK(floattov16(0.0064589),floattov16(-0.576509)), VERTEX_PACK(floattov16(0.257914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(392),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0026),floattov10(-0.3613),floattov10(-0.9325)),
-	VERTEX_PACK(floattov16(0.0064589),floattov16(-0.576509)), VERTEX_PACK(floattov16(0.257914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(437)),
-	NORMAL_PACK(floattov10(-0.5512),floattov10(-0.2013),floattov10(-0.8097)),
-	VERTEX_PACK(floattov16(-0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(421),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0019),floattov10(-0.3528),floattov10(-0.9357)),
-	VERTEX_PACK(floattov16(-0),floattov16(-0.384665)), VERTEX_PACK(floattov16(0.222064),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0313),floattov10(-0.7668),floattov10(-0.6412)),
-	VERTEX_PACK(floattov16(-0.0191184),floattov16(-0.661867)), VERTEX_PACK(floattov16(0.316584),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(392),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0026),floattov10(-0.3613),floattov10(-0.9325)),
-	VERTEX_PACK(floattov16(0.0064589),floattov16(-0.576509)), VERTEX_PACK(floattov16(0.257914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(392),inttot16(458)),
-	NORMAL_PACK(floattov10(-0.0026),floattov10(-0.3613),floattov10(-0.9325)),
-	VERTEX_PACK(floattov16(0.0064589),floattov16(-0.576509)), VERTEX_PACK(floattov16(0.257914),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0313),floattov10(-0.7668),floattov10(-0.6412)),
-	VERTEX_PACK(floattov16(-0.0191184),floattov16(-0.661867)), VERTEX_PACK(floattov16(0.316584),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(369),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(371),inttot16(483)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(371),inttot16(483)),
-	NORMAL_PACK(floattov10(0.3619),floattov10(-0.8772),floattov10(0.3156)),
-	VERTEX_PACK(floattov16(0.177258),floattov16(-0.661391)), VERTEX_PACK(floattov16(0.394622),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(492)),
-	NORMAL_PACK(floattov10(0.8739),floattov10(-0.4782),floattov10(0.0871)),
-	VERTEX_PACK(floattov16(0.23706),floattov16(-0.631812)), VERTEX_PACK(floattov16(0.36422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(369),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(381),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.4164),floattov10(-0.68),floattov10(-0.6035)),
-	VERTEX_PACK(floattov16(-0.204667),floattov16(-0.64538)), VERTEX_PACK(floattov16(0.314649),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0313),floattov10(-0.7668),floattov10(-0.6412)),
-	VERTEX_PACK(floattov16(-0.0191184),floattov16(-0.661867)), VERTEX_PACK(floattov16(0.316584),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(381),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.4164),floattov10(-0.68),floattov10(-0.6035)),
-	VERTEX_PACK(floattov16(-0.204667),floattov16(-0.64538)), VERTEX_PACK(floattov16(0.314649),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(369),inttot16(456)),
-	NORMAL_PACK(floattov10(-0.0139),floattov10(-0.9982),floattov10(-0.0575)),
-	VERTEX_PACK(floattov16(-0.0062853),floattov16(-0.687026)), VERTEX_PACK(floattov16(0.372385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.6047),floattov10(-0.7895),floattov10(0.1051)),
-	VERTEX_PACK(floattov16(-0.216649),floattov16(-0.654763)), VERTEX_PACK(floattov16(0.365356),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(492)),
-	NORMAL_PACK(floattov10(0.8739),floattov10(-0.4782),floattov10(0.0871)),
-	VERTEX_PACK(floattov16(0.23706),floattov16(-0.631812)), VERTEX_PACK(floattov16(0.36422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(380),inttot16(484)),
-	NORMAL_PACK(floattov10(0.406),floattov10(-0.7419),floattov10(-0.5335)),
-	VERTEX_PACK(floattov16(0.199632),floattov16(-0.65069)), VERTEX_PACK(floattov16(0.314509),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(385),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(381),inttot16(432)),
-	NORMAL_PACK(floattov10(-0.4164),floattov10(-0.68),floattov10(-0.6035)),
-	VERTEX_PACK(floattov16(-0.204667),floattov16(-0.64538)), VERTEX_PACK(floattov16(0.314649),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(427)),
-	NORMAL_PACK(floattov10(-0.6047),floattov10(-0.7895),floattov10(0.1051)),
-	VERTEX_PACK(floattov16(-0.216649),floattov16(-0.654763)), VERTEX_PACK(floattov16(0.365356),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(378),inttot16(492)),
-	NORMAL_PACK(floattov10(0.8739),floattov10(-0.4782),floattov10(0.0871)),
-	VERTEX_PACK(floattov16(0.23706),floattov16(-0.631812)), VERTEX_PACK(floattov16(0.36422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(508)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(493)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(386),inttot16(490)),
-	NORMAL_PACK(floattov10(0.9054),floattov10(-0.1053),floattov10(-0.4112)),
-	VERTEX_PACK(floattov16(0.231339),floattov16(-0.596058)), VERTEX_PACK(floattov16(0.319155),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(493)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(503)),
-	NORMAL_PACK(floattov10(0.9886),floattov10(0.1189),floattov10(-0.092)),
-	VERTEX_PACK(floattov16(0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(413)),
-	NORMAL_PACK(floattov10(-0.9886),floattov10(0.1186),floattov10(-0.0923)),
-	VERTEX_PACK(floattov16(-0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(385),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.9694),floattov10(0.1931),floattov10(0.1517)),
-	VERTEX_PACK(floattov16(-0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(385),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.9685),floattov10(-0.1922),floattov10(-0.158)),
-	VERTEX_PACK(floattov16(-0.241644),floattov16(-0.608929)), VERTEX_PACK(floattov16(0.344512),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(413)),
-	NORMAL_PACK(floattov10(-0.9886),floattov10(0.1186),floattov10(-0.0923)),
-	VERTEX_PACK(floattov16(-0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(480)),
-	NORMAL_PACK(floattov10(0.5484),floattov10(-0.2003),floattov10(-0.8119)),
-	VERTEX_PACK(floattov16(0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(493)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(485)),
-	NORMAL_PACK(floattov10(0.5021),floattov10(-0.1702),floattov10(-0.8479)),
-	VERTEX_PACK(floattov16(0.204168),floattov16(-0.583433)), VERTEX_PACK(floattov16(0.285099),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(437)),
-	NORMAL_PACK(floattov10(-0.5512),floattov10(-0.2013),floattov10(-0.8097)),
-	VERTEX_PACK(floattov16(-0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(431)),
-	NORMAL_PACK(floattov10(-0.5197),floattov10(-0.1827),floattov10(-0.8346)),
-	VERTEX_PACK(floattov16(-0.202145),floattov16(-0.583399)), VERTEX_PACK(floattov16(0.284459),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(439)),
-	NORMAL_PACK(floattov10(-0.7233),floattov10(-0.6687),floattov10(-0.1725)),
-	VERTEX_PACK(floattov16(-0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(424),inttot16(437)),
-	NORMAL_PACK(floattov10(-0.5512),floattov10(-0.2013),floattov10(-0.8097)),
-	VERTEX_PACK(floattov16(-0.128337),floattov16(-0.350213)), VERTEX_PACK(floattov16(0.251265),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(424)),
-	NORMAL_PACK(floattov10(-0.92),floattov10(0.0004),floattov10(-0.392)),
-	VERTEX_PACK(floattov16(-0.161288),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283153),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(471),inttot16(26)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(38)),
-	NORMAL_PACK(floattov10(0.9886),floattov10(0.1189),floattov10(-0.092)),
-	VERTEX_PACK(floattov16(0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(508)),
-	NORMAL_PACK(floattov10(0.9706),floattov10(0.1905),floattov10(0.1474)),
-	VERTEX_PACK(floattov16(0.206763),floattov16(-0.323674)), VERTEX_PACK(floattov16(0.398882),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(439),inttot16(503)),
-	NORMAL_PACK(floattov10(0.9886),floattov10(0.1189),floattov10(-0.092)),
-	VERTEX_PACK(floattov16(0.173567),floattov16(-0.222784)), VERTEX_PACK(floattov16(0.327643),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(442),inttot16(511)),
-	NORMAL_PACK(floattov10(0.9519),floattov10(-0.1217),floattov10(0.2813)),
-	VERTEX_PACK(floattov16(0.148555),floattov16(-0.146858)), VERTEX_PACK(floattov16(0.379292),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(429),inttot16(25)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(464),inttot16(32)),
-	NORMAL_PACK(floattov10(0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(0.165936),floattov16(-0.124784)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(21)),
-	NORMAL_PACK(floattov10(0.581),floattov10(-0.7165),floattov10(0.3861)),
-	VERTEX_PACK(floattov16(0.15407),floattov16(-0.117823)), VERTEX_PACK(floattov16(0.433758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(464),inttot16(32)),
-	NORMAL_PACK(floattov10(0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(0.165936),floattov16(-0.124784)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(429),inttot16(25)),
-	NORMAL_PACK(floattov10(0.4474),floattov10(-0.8481),floattov10(0.2839)),
-	VERTEX_PACK(floattov16(0.357097),floattov16(-0.0591423)), VERTEX_PACK(floattov16(0.383767),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(261),inttot16(175)),
-	NORMAL_PACK(floattov10(0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(0.117127),floattov16(-0.0080619)), VERTEX_PACK(floattov16(-0.49256),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(262),inttot16(196)),
-	NORMAL_PACK(floattov10(0.2844),floattov10(-0.7757),floattov10(-0.5634)),
-	VERTEX_PACK(floattov16(0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(261),inttot16(175)),
-	NORMAL_PACK(floattov10(0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(0.117127),floattov16(-0.0080619)), VERTEX_PACK(floattov16(-0.49256),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(235),inttot16(176)),
-	NORMAL_PACK(floattov10(-0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(-0.117125),floattov16(-0.0080612)), VERTEX_PACK(floattov16(-0.492559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(235),inttot16(176)),
-	NORMAL_PACK(floattov10(-0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(-0.117125),floattov16(-0.0080612)), VERTEX_PACK(floattov16(-0.492559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(262),inttot16(196)),
-	NORMAL_PACK(floattov10(0.2844),floattov10(-0.7757),floattov10(-0.5634)),
-	VERTEX_PACK(floattov16(0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.0049),floattov10(-0.7721),floattov10(-0.6354)),
-	VERTEX_PACK(floattov16(0),floattov16(-0.15393)), VERTEX_PACK(floattov16(-0.401554),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(262),inttot16(196)),
-	NORMAL_PACK(floattov10(0.2844),floattov10(-0.7757),floattov10(-0.5634)),
-	VERTEX_PACK(floattov16(0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(218),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.4924),floattov10(-0.736),floattov10(-0.4645)),
-	VERTEX_PACK(floattov16(-0.231352),floattov16(-0.117893)), VERTEX_PACK(floattov16(-0.33385),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.2722),floattov10(-0.7839),floattov10(-0.5581)),
-	VERTEX_PACK(floattov16(-0.116829),floattov16(-0.151229)), VERTEX_PACK(floattov16(-0.372009),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(283)),
-	NORMAL_PACK(floattov10(0.1897),floattov10(-0.8341),floattov10(-0.5179)),
-	VERTEX_PACK(floattov16(0.0326788),floattov16(-0.324454)), VERTEX_PACK(floattov16(0.183277),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(225)),
-	NORMAL_PACK(floattov10(0.0918),floattov10(-0.9502),floattov10(-0.2979)),
-	VERTEX_PACK(floattov16(0.0398839),floattov16(-0.25867)), VERTEX_PACK(floattov16(-0.181766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(283)),
-	NORMAL_PACK(floattov10(-0.2923),floattov10(-0.8149),floattov10(-0.5004)),
-	VERTEX_PACK(floattov16(-0.0596876),floattov16(-0.316869)), VERTEX_PACK(floattov16(0.188049),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(50)),
-	NORMAL_PACK(floattov10(0.9188),floattov10(0.0029),floattov10(-0.3947)),
-	VERTEX_PACK(floattov16(0.161287),floattov16(-0.264651)), VERTEX_PACK(floattov16(0.283152),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(72)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(363),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(376),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9108),floattov10(-0.4126),floattov10(0.0156)),
-	VERTEX_PACK(floattov16(0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(391),inttot16(94)),
-	NORMAL_PACK(floattov10(0.7653),floattov10(-0.6371),floattov10(0.0916)),
-	VERTEX_PACK(floattov16(0.503486),floattov16(-0.0159068)), VERTEX_PACK(floattov16(0.0106575),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(74),inttot16(44)),
-	NORMAL_PACK(floattov10(-0.5716),floattov10(-0.8171),floattov10(0.0745)),
-	VERTEX_PACK(floattov16(-0.395242),floattov16(-0.0297045)), VERTEX_PACK(floattov16(0.268526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(114),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9131),floattov10(-0.4076),floattov10(0.01)),
-	VERTEX_PACK(floattov16(-0.535179),floattov16(0.111607)), VERTEX_PACK(floattov16(0.2417),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(94),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.6769),floattov10(-0.7214),floattov10(0.1462)),
-	VERTEX_PACK(floattov16(-0.488146),floattov16(-0.0268065)), VERTEX_PACK(floattov16(0.0421008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(152)),
-	NORMAL_PACK(floattov10(-0.0074),floattov10(-0.0211),floattov10(-0.9997)),
-	VERTEX_PACK(floattov16(0),floattov16(0.20918)), VERTEX_PACK(floattov16(-0.560547),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(152)),
-	NORMAL_PACK(floattov10(-0.0074),floattov10(-0.0211),floattov10(-0.9997)),
-	VERTEX_PACK(floattov16(0),floattov16(0.20918)), VERTEX_PACK(floattov16(-0.560547),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(152)),
-	NORMAL_PACK(floattov10(-0.0074),floattov10(-0.0211),floattov10(-0.9997)),
-	VERTEX_PACK(floattov16(0),floattov16(0.20918)), VERTEX_PACK(floattov16(-0.560547),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(235),inttot16(176)),
-	NORMAL_PACK(floattov10(-0.2885),floattov10(-0.4382),floattov10(-0.8513)),
-	VERTEX_PACK(floattov16(-0.117125),floattov16(-0.0080612)), VERTEX_PACK(floattov16(-0.492559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(173)),
-	NORMAL_PACK(floattov10(-0),floattov10(-0.392),floattov10(-0.92)),
-	VERTEX_PACK(floattov16(-0),floattov16(0.0048286)), VERTEX_PACK(floattov16(-0.52455),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(67)),
-	NORMAL_PACK(floattov10(0.0685),floattov10(0.9572),floattov10(0.2811)),
-	VERTEX_PACK(floattov16(0.0945063),floattov16(0.649421)), VERTEX_PACK(floattov16(0.0735315),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(210),inttot16(59)),
-	NORMAL_PACK(floattov10(-0.4415),floattov10(0.726),floattov10(0.5272)),
-	VERTEX_PACK(floattov16(-0.293345),floattov16(0.563979)), VERTEX_PACK(floattov16(0.148068),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(67)),
-	NORMAL_PACK(floattov10(0.0685),floattov10(0.9572),floattov10(0.2811)),
-	VERTEX_PACK(floattov16(0.0945063),floattov16(0.649421)), VERTEX_PACK(floattov16(0.0735315),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(257),inttot16(67)),
-	NORMAL_PACK(floattov10(0.0685),floattov10(0.9572),floattov10(0.2811)),
-	VERTEX_PACK(floattov16(0.0945063),floattov16(0.649421)), VERTEX_PACK(floattov16(0.0735315),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(267),inttot16(107)),
-	NORMAL_PACK(floattov10(0.2543),floattov10(0.8194),floattov10(-0.5137)),
-	VERTEX_PACK(floattov16(0.216117),floattov16(0.587917)), VERTEX_PACK(floattov16(-0.299727),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(226),inttot16(108)),
-	NORMAL_PACK(floattov10(-0.2754),floattov10(0.8032),floattov10(-0.5283)),
-	VERTEX_PACK(floattov16(-0.216113),floattov16(0.587916)), VERTEX_PACK(floattov16(-0.299723),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(239),inttot16(95)),
-	NORMAL_PACK(floattov10(-0.0692),floattov10(0.9676),floattov10(-0.2429)),
-	VERTEX_PACK(floattov16(-0.0820036),floattov16(0.65043)), VERTEX_PACK(floattov16(-0.208725),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(81)),
-	NORMAL_PACK(floattov10(-0.0842),floattov10(0.9963),floattov10(0.0186)),
-	VERTEX_PACK(floattov16(-0.103741),floattov16(0.664723)), VERTEX_PACK(floattov16(-0.0618863),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(267),inttot16(107)),
-	NORMAL_PACK(floattov10(0.2543),floattov10(0.8194),floattov10(-0.5137)),
-	VERTEX_PACK(floattov16(0.216117),floattov16(0.587917)), VERTEX_PACK(floattov16(-0.299727),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(109)),
-	NORMAL_PACK(floattov10(0.0283),floattov10(0.8546),floattov10(-0.5185)),
-	VERTEX_PACK(floattov16(0),floattov16(0.598999)), VERTEX_PACK(floattov16(-0.343506),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(138)),
-	NORMAL_PACK(floattov10(0.1242),floattov10(0.3136),floattov10(-0.9414)),
-	VERTEX_PACK(floattov16(0.0505932),floattov16(0.362111)), VERTEX_PACK(floattov16(-0.540545),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(138)),
-	NORMAL_PACK(floattov10(-0.3017),floattov10(0.2995),floattov10(-0.9052)),
-	VERTEX_PACK(floattov16(-0.155518),floattov16(0.345215)), VERTEX_PACK(floattov16(-0.514062),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(243),inttot16(123)),
-	NORMAL_PACK(floattov10(-0.0875),floattov10(0.623),floattov10(-0.7773)),
-	VERTEX_PACK(floattov16(-0.0390243),floattov16(0.493527)), VERTEX_PACK(floattov16(-0.466341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(226),inttot16(108)),
-	NORMAL_PACK(floattov10(-0.2754),floattov10(0.8032),floattov10(-0.5283)),
-	VERTEX_PACK(floattov16(-0.216113),floattov16(0.587916)), VERTEX_PACK(floattov16(-0.299723),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(335),inttot16(50)),
-	NORMAL_PACK(floattov10(0.7583),floattov10(0.5902),floattov10(0.277)),
-	VERTEX_PACK(floattov16(0.51175),floattov16(0.300337)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(75)),
-	NORMAL_PACK(floattov10(0.7879),floattov10(0.4929),floattov10(0.3691)),
-	VERTEX_PACK(floattov16(0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(50)),
-	NORMAL_PACK(floattov10(-0.7731),floattov10(0.5788),floattov10(0.2595)),
-	VERTEX_PACK(floattov16(-0.51175),floattov16(0.300338)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(170),inttot16(75)),
-	NORMAL_PACK(floattov10(-0.803),floattov10(0.4774),floattov10(0.3568)),
-	VERTEX_PACK(floattov16(-0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(75)),
-	NORMAL_PACK(floattov10(0.7879),floattov10(0.4929),floattov10(0.3691)),
-	VERTEX_PACK(floattov16(0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(102)),
-	NORMAL_PACK(floattov10(-0.7626),floattov10(0.6219),floattov10(-0.1779)),
-	VERTEX_PACK(floattov16(-0.505554),floattov16(0.461542)), VERTEX_PACK(floattov16(-0.16616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(298),inttot16(127)),
-	NORMAL_PACK(floattov10(0.6232),floattov10(0.34),floattov10(-0.7042)),
-	VERTEX_PACK(floattov16(0.467617),floattov16(0.363704)), VERTEX_PACK(floattov16(-0.333693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(320),inttot16(141)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(191),inttot16(129)),
-	NORMAL_PACK(floattov10(-0.6546),floattov10(0.2806),floattov10(-0.7019)),
-	VERTEX_PACK(floattov16(-0.481704),floattov16(0.339748)), VERTEX_PACK(floattov16(-0.326675),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(144)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(298),inttot16(127)),
-	NORMAL_PACK(floattov10(0.6232),floattov10(0.34),floattov10(-0.7042)),
-	VERTEX_PACK(floattov16(0.467617),floattov16(0.363704)), VERTEX_PACK(floattov16(-0.333693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(298),inttot16(127)),
-	NORMAL_PACK(floattov10(0.6232),floattov10(0.34),floattov10(-0.7042)),
-	VERTEX_PACK(floattov16(0.467617),floattov16(0.363704)), VERTEX_PACK(floattov16(-0.333693),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(264),inttot16(123)),
-	NORMAL_PACK(floattov10(0.3119),floattov10(0.5593),floattov10(-0.768)),
-	VERTEX_PACK(floattov16(0.181441),floattov16(0.473645)), VERTEX_PACK(floattov16(-0.434937),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(191),inttot16(129)),
-	NORMAL_PACK(floattov10(-0.6546),floattov10(0.2806),floattov10(-0.7019)),
-	VERTEX_PACK(floattov16(-0.481704),floattov16(0.339748)), VERTEX_PACK(floattov16(-0.326675),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(267),inttot16(107)),
-	NORMAL_PACK(floattov10(0.2543),floattov10(0.8194),floattov10(-0.5137)),
-	VERTEX_PACK(floattov16(0.216117),floattov16(0.587917)), VERTEX_PACK(floattov16(-0.299727),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(107)),
-	NORMAL_PACK(floattov10(0.556),floattov10(0.6999),floattov10(-0.4484)),
-	VERTEX_PACK(floattov16(0.418957),floattov16(0.513246)), VERTEX_PACK(floattov16(-0.256537),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(94)),
-	NORMAL_PACK(floattov10(0.2812),floattov10(0.9381),floattov10(-0.2023)),
-	VERTEX_PACK(floattov16(0.253686),floattov16(0.6336)), VERTEX_PACK(floattov16(-0.167548),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(82)),
-	NORMAL_PACK(floattov10(-0.594),floattov10(0.7938),floattov10(0.1303)),
-	VERTEX_PACK(floattov16(-0.38523),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354326),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(102)),
-	NORMAL_PACK(floattov10(-0.7626),floattov10(0.6219),floattov10(-0.1779)),
-	VERTEX_PACK(floattov16(-0.505554),floattov16(0.461542)), VERTEX_PACK(floattov16(-0.16616),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(205),inttot16(115)),
-	NORMAL_PACK(floattov10(-0.5391),floattov10(0.5648),floattov10(-0.6248)),
-	VERTEX_PACK(floattov16(-0.416882),floattov16(0.461454)), VERTEX_PACK(floattov16(-0.315928),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(211),inttot16(97)),
-	NORMAL_PACK(floattov10(-0.4589),floattov10(0.851),floattov10(-0.2552)),
-	VERTEX_PACK(floattov16(-0.351987),floattov16(0.592019)), VERTEX_PACK(floattov16(-0.188065),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(226),inttot16(108)),
-	NORMAL_PACK(floattov10(-0.2754),floattov10(0.8032),floattov10(-0.5283)),
-	VERTEX_PACK(floattov16(-0.216113),floattov16(0.587916)), VERTEX_PACK(floattov16(-0.299723),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(276),inttot16(76)),
-	NORMAL_PACK(floattov10(0.3461),floattov10(0.9257),floattov10(0.1522)),
-	VERTEX_PACK(floattov16(0.277448),floattov16(0.634839)), VERTEX_PACK(floattov16(-0.0013475),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(315),inttot16(88)),
-	NORMAL_PACK(floattov10(0.8454),floattov10(0.5276),floattov10(0.0831)),
-	VERTEX_PACK(floattov16(0.541403),floattov16(0.421502)), VERTEX_PACK(floattov16(-0.0298214),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(289),inttot16(82)),
-	NORMAL_PACK(floattov10(0.5863),floattov10(0.8029),floattov10(0.1082)),
-	VERTEX_PACK(floattov16(0.385232),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354298),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(299),inttot16(69)),
-	NORMAL_PACK(floattov10(0.6081),floattov10(0.6735),floattov10(0.4202)),
-	VERTEX_PACK(floattov16(0.416898),floattov16(0.500273)), VERTEX_PACK(floattov16(0.0706188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(82)),
-	NORMAL_PACK(floattov10(-0.594),floattov10(0.7938),floattov10(0.1303)),
-	VERTEX_PACK(floattov16(-0.38523),floattov16(0.574955)), VERTEX_PACK(floattov16(-0.0354326),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(217),inttot16(74)),
-	NORMAL_PACK(floattov10(-0.3392),floattov10(0.9177),floattov10(0.2066)),
-	VERTEX_PACK(floattov16(-0.276226),floattov16(0.629971)), VERTEX_PACK(floattov16(0.0279657),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(69)),
-	NORMAL_PACK(floattov10(-0.6258),floattov10(0.6644),floattov10(0.4085)),
-	VERTEX_PACK(floattov16(-0.416909),floattov16(0.50027)), VERTEX_PACK(floattov16(0.0706209),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(210),inttot16(59)),
-	NORMAL_PACK(floattov10(-0.4415),floattov10(0.726),floattov10(0.5272)),
-	VERTEX_PACK(floattov16(-0.293345),floattov16(0.563979)), VERTEX_PACK(floattov16(0.148068),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(342),inttot16(356)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(325),inttot16(333)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(357),inttot16(343)),
-	NORMAL_PACK(floattov10(0.8423),floattov10(0.5213),floattov10(0.1371)),
-	VERTEX_PACK(floattov16(0.564307),floattov16(0.297548)), VERTEX_PACK(floattov16(0.404056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(307),inttot16(23)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(340),inttot16(38)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(318),inttot16(43)),
-	NORMAL_PACK(floattov10(0.5183),floattov10(0.7435),floattov10(0.4226)),
-	VERTEX_PACK(floattov16(0.427605),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(185),inttot16(23)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(152),inttot16(37)),
-	NORMAL_PACK(floattov10(-0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(-0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(174),inttot16(43)),
-	NORMAL_PACK(floattov10(-0.5227),floattov10(0.7393),floattov10(0.4245)),
-	VERTEX_PACK(floattov16(-0.427604),floattov16(0.349912)), VERTEX_PACK(floattov16(0.217779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(185),inttot16(23)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(20)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(286),inttot16(20)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(56)),
-	NORMAL_PACK(floattov10(0.3445),floattov10(0.7615),floattov10(0.5491)),
-	VERTEX_PACK(floattov16(0.251019),floattov16(0.577776)), VERTEX_PACK(floattov16(0.164461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(52)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(0.8118),floattov10(0.5738)),
-	VERTEX_PACK(floattov16(-0.113911),floattov16(0.588496)), VERTEX_PACK(floattov16(0.196299),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(20)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(242),inttot16(297)),
-	NORMAL_PACK(floattov10(0.4162),floattov10(0.7338),floattov10(-0.537)),
-	VERTEX_PACK(floattov16(-0.159907),floattov16(0.483827)), VERTEX_PACK(floattov16(0.458014),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(302)),
-	NORMAL_PACK(floattov10(-0.2157),floattov10(0.7984),floattov10(-0.5622)),
-	VERTEX_PACK(floattov16(-0.234611),floattov16(0.482339)), VERTEX_PACK(floattov16(0.44777),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(305),inttot16(316)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(301)),
-	NORMAL_PACK(floattov10(-0.4998),floattov10(0.8347),floattov10(0.2314)),
-	VERTEX_PACK(floattov16(0.0650825),floattov16(0.332085)), VERTEX_PACK(floattov16(0.437328),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(305),inttot16(316)),
-	NORMAL_PACK(floattov10(0.2387),floattov10(0.8407),floattov10(0.4861)),
-	VERTEX_PACK(floattov16(0.245782),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(308),inttot16(314)),
-	NORMAL_PACK(floattov10(-0.2233),floattov10(0.8062),floattov10(-0.5478)),
-	VERTEX_PACK(floattov16(0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(325),inttot16(333)),
-	NORMAL_PACK(floattov10(0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(0.352285),floattov16(0.362496)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(250),inttot16(316)),
-	NORMAL_PACK(floattov10(-0.2394),floattov10(0.8379),floattov10(0.4906)),
-	VERTEX_PACK(floattov16(-0.24578),floattov16(0.383499)), VERTEX_PACK(floattov16(0.339109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(333)),
-	NORMAL_PACK(floattov10(-0.242),floattov10(0.9635),floattov10(-0.1145)),
-	VERTEX_PACK(floattov16(-0.352286),floattov16(0.362495)), VERTEX_PACK(floattov16(0.330422),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(314)),
-	NORMAL_PACK(floattov10(0.2349),floattov10(0.798),floattov10(-0.555)),
-	VERTEX_PACK(floattov16(-0.202009),floattov16(0.374006)), VERTEX_PACK(floattov16(0.400881),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(234),inttot16(4)),
-	NORMAL_PACK(floattov10(0.4478),floattov10(0.8604),floattov10(0.2434)),
-	VERTEX_PACK(floattov16(-0.0587419),floattov16(0.327012)), VERTEX_PACK(floattov16(0.439337),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(0)),
-	NORMAL_PACK(floattov10(-0.1152),floattov10(0.855),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.0154651),floattov16(0.306116)), VERTEX_PACK(floattov16(0.432917),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(246),inttot16(13)),
-	NORMAL_PACK(floattov10(0.0036),floattov10(0.6628),floattov10(0.7488)),
-	VERTEX_PACK(floattov16(0),floattov16(0.408878)), VERTEX_PACK(floattov16(0.373341),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(340),inttot16(38)),
-	NORMAL_PACK(floattov10(0.7497),floattov10(0.6546),floattov10(-0.0973)),
-	VERTEX_PACK(floattov16(0.521348),floattov16(0.283957)), VERTEX_PACK(floattov16(0.269457),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(354),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(335),inttot16(50)),
-	NORMAL_PACK(floattov10(0.7583),floattov10(0.5902),floattov10(0.277)),
-	VERTEX_PACK(floattov16(0.51175),floattov16(0.300337)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(335),inttot16(50)),
-	NORMAL_PACK(floattov10(0.7583),floattov10(0.5902),floattov10(0.277)),
-	VERTEX_PACK(floattov16(0.51175),floattov16(0.300337)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(322),inttot16(75)),
-	NORMAL_PACK(floattov10(0.7879),floattov10(0.4929),floattov10(0.3691)),
-	VERTEX_PACK(floattov16(0.536153),floattov16(0.385686)), VERTEX_PACK(floattov16(0.0722771),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(333),inttot16(86)),
-	NORMAL_PACK(floattov10(0.9766),floattov10(0.191),floattov10(0.0993)),
-	VERTEX_PACK(floattov16(0.577828),floattov16(0.309721)), VERTEX_PACK(floattov16(0.0029701),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(335),inttot16(50)),
-	NORMAL_PACK(floattov10(0.7583),floattov10(0.5902),floattov10(0.277)),
-	VERTEX_PACK(floattov16(0.51175),floattov16(0.300337)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(354),inttot16(48)),
-	NORMAL_PACK(floattov10(0.9917),floattov10(0.1271),floattov10(0.0172)),
-	VERTEX_PACK(floattov16(0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(137),inttot16(47)),
-	NORMAL_PACK(floattov10(-0.9909),floattov10(0.1344),floattov10(0.0111)),
-	VERTEX_PACK(floattov16(-0.545221),floattov16(0.207859)), VERTEX_PACK(floattov16(0.226642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(157),inttot16(50)),
-	NORMAL_PACK(floattov10(-0.7731),floattov10(0.5788),floattov10(0.2595)),
-	VERTEX_PACK(floattov16(-0.51175),floattov16(0.300338)), VERTEX_PACK(floattov16(0.203235),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(328),inttot16(125)),
-	NORMAL_PACK(floattov10(0.489),floattov10(0.8101),floattov10(-0.3236)),
-	VERTEX_PACK(floattov16(0.570602),floattov16(0.239544)), VERTEX_PACK(floattov16(-0.212448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(309),inttot16(114)),
-	NORMAL_PACK(floattov10(0.8469),floattov10(0.3836),floattov10(-0.3682)),
-	VERTEX_PACK(floattov16(0.532609),floattov16(0.383107)), VERTEX_PACK(floattov16(-0.23931),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(337),inttot16(111)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(148),inttot16(86)),
-	NORMAL_PACK(floattov10(-0.9949),floattov10(0.0527),floattov10(0.086)),
-	VERTEX_PACK(floattov16(-0.590601),floattov16(0.243762)), VERTEX_PACK(floattov16(-0.0077805),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(184),inttot16(114)),
-	NORMAL_PACK(floattov10(-0.8377),floattov10(0.4133),floattov10(-0.357)),
-	VERTEX_PACK(floattov16(-0.530226),floattov16(0.389714)), VERTEX_PACK(floattov16(-0.236955),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(158),inttot16(117)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(277),inttot16(230)),
-	NORMAL_PACK(floattov10(0.4938),floattov10(-0.8546),floattov10(-0.1608)),
-	VERTEX_PACK(floattov16(0.192198),floattov16(-0.217646)), VERTEX_PACK(floattov16(-0.114714),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(206)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(300),inttot16(247)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(225),inttot16(230)),
-	NORMAL_PACK(floattov10(-0.4102),floattov10(-0.8912),floattov10(-0.1935)),
-	VERTEX_PACK(floattov16(-0.161292),floattov16(-0.236841)), VERTEX_PACK(floattov16(-0.124586),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(201),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(121)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(125)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(94)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(88),inttot16(121)),
-	NORMAL_PACK(floattov10(-0.3287),floattov10(-0.9218),floattov10(0.2056)),
-	VERTEX_PACK(floattov16(-0.459398),floattov16(-0.0677908)), VERTEX_PACK(floattov16(-0.122735),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(94)),
-	NORMAL_PACK(floattov10(-0.5634),floattov10(-0.8238),floattov10(0.0632)),
-	VERTEX_PACK(floattov16(-0.287356),floattov16(-0.140699)), VERTEX_PACK(floattov16(0.0278999),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(94),inttot16(88)),
-	NORMAL_PACK(floattov10(-0.6769),floattov10(-0.7214),floattov10(0.1462)),
-	VERTEX_PACK(floattov16(-0.488146),floattov16(-0.0268065)), VERTEX_PACK(floattov16(0.0421008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(401),inttot16(114)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(437),inttot16(95)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(464),inttot16(32)),
-	NORMAL_PACK(floattov10(0.6689),floattov10(-0.6441),floattov10(0.3711)),
-	VERTEX_PACK(floattov16(0.165936),floattov16(-0.124784)), VERTEX_PACK(floattov16(0.352219),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(44)),
-	NORMAL_PACK(floattov10(0.5727),floattov10(-0.817),floattov10(0.067)),
-	VERTEX_PACK(floattov16(0.395241),floattov16(-0.0297052)), VERTEX_PACK(floattov16(0.268525),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(469),inttot16(42)),
-	NORMAL_PACK(floattov10(0.858),floattov10(-0.4012),floattov10(0.3206)),
-	VERTEX_PACK(floattov16(0.175317),floattov16(-0.164926)), VERTEX_PACK(floattov16(0.312972),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(72)),
-	NORMAL_PACK(floattov10(0.7027),floattov10(-0.6859),floattov10(-0.1891)),
-	VERTEX_PACK(floattov16(0.126027),floattov16(-0.276688)), VERTEX_PACK(floattov16(0.183966),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(437),inttot16(95)),
-	NORMAL_PACK(floattov10(0.5593),floattov10(-0.8258),floattov10(0.0717)),
-	VERTEX_PACK(floattov16(0.301279),floattov16(-0.129776)), VERTEX_PACK(floattov16(0.0245756),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(317),inttot16(161)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(301),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(158)),
-	NORMAL_PACK(floattov10(0.5189),floattov10(-0.2586),floattov10(-0.8148)),
-	VERTEX_PACK(floattov16(0.357867),floattov16(0.131015)), VERTEX_PACK(floattov16(-0.41806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(317),inttot16(161)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(158)),
-	NORMAL_PACK(floattov10(0.5189),floattov10(-0.2586),floattov10(-0.8148)),
-	VERTEX_PACK(floattov16(0.357867),floattov16(0.131015)), VERTEX_PACK(floattov16(-0.41806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(163)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(159)),
-	NORMAL_PACK(floattov10(-0.5053),floattov10(-0.2503),floattov10(-0.8258)),
-	VERTEX_PACK(floattov16(-0.357867),floattov16(0.131018)), VERTEX_PACK(floattov16(-0.418055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(182),inttot16(163)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(159)),
-	NORMAL_PACK(floattov10(-0.5053),floattov10(-0.2503),floattov10(-0.8258)),
-	VERTEX_PACK(floattov16(-0.357867),floattov16(0.131018)), VERTEX_PACK(floattov16(-0.418055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(158)),
-	NORMAL_PACK(floattov10(0.5189),floattov10(-0.2586),floattov10(-0.8148)),
-	VERTEX_PACK(floattov16(0.357867),floattov16(0.131015)), VERTEX_PACK(floattov16(-0.41806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(141)),
-	NORMAL_PACK(floattov10(0.5197),floattov10(0.1114),floattov10(-0.847)),
-	VERTEX_PACK(floattov16(0.382691),floattov16(0.266327)), VERTEX_PACK(floattov16(-0.424126),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(290),inttot16(158)),
-	NORMAL_PACK(floattov10(0.5189),floattov10(-0.2586),floattov10(-0.8148)),
-	VERTEX_PACK(floattov16(0.357867),floattov16(0.131015)), VERTEX_PACK(floattov16(-0.41806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(266),inttot16(153)),
-	NORMAL_PACK(floattov10(0.3398),floattov10(-0.0752),floattov10(-0.9375)),
-	VERTEX_PACK(floattov16(0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(159)),
-	NORMAL_PACK(floattov10(-0.5053),floattov10(-0.2503),floattov10(-0.8258)),
-	VERTEX_PACK(floattov16(-0.357867),floattov16(0.131018)), VERTEX_PACK(floattov16(-0.418055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(206),inttot16(142)),
-	NORMAL_PACK(floattov10(-0.5098),floattov10(0.1312),floattov10(-0.8502)),
-	VERTEX_PACK(floattov16(-0.367178),floattov16(0.275416)), VERTEX_PACK(floattov16(-0.430453),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(204),inttot16(159)),
-	NORMAL_PACK(floattov10(-0.5053),floattov10(-0.2503),floattov10(-0.8258)),
-	VERTEX_PACK(floattov16(-0.357867),floattov16(0.131018)), VERTEX_PACK(floattov16(-0.418055),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(229),inttot16(154)),
-	NORMAL_PACK(floattov10(-0.3344),floattov10(-0.0931),floattov10(-0.9378)),
-	VERTEX_PACK(floattov16(-0.175475),floattov16(0.177657)), VERTEX_PACK(floattov16(-0.521806),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(216),inttot16(178)),
-	NORMAL_PACK(floattov10(-0.4883),floattov10(-0.4791),floattov10(-0.7294)),
-	VERTEX_PACK(floattov16(-0.263571),floattov16(-0.0101311)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(317),inttot16(196)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(303),inttot16(206)),
-	NORMAL_PACK(floattov10(0.4437),floattov10(-0.8519),floattov10(-0.2782)),
-	VERTEX_PACK(floattov16(0.340254),floattov16(-0.090811)), VERTEX_PACK(floattov16(-0.192559),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(301),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(195),inttot16(180)),
-	NORMAL_PACK(floattov10(-0.4638),floattov10(-0.5888),floattov10(-0.6619)),
-	VERTEX_PACK(floattov16(-0.376853),floattov16(0.0185654)), VERTEX_PACK(floattov16(-0.332511),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(193),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.4111),floattov10(-0.8689),floattov10(-0.2757)),
-	VERTEX_PACK(floattov16(-0.344134),floattov16(-0.0886046)), VERTEX_PACK(floattov16(-0.191223),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(180),inttot16(182)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(278),inttot16(195)),
-	NORMAL_PACK(floattov10(0.4874),floattov10(-0.7423),floattov10(-0.4597)),
-	VERTEX_PACK(floattov16(0.231354),floattov16(-0.117885)), VERTEX_PACK(floattov16(-0.333842),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4859),floattov10(-0.4792),floattov10(-0.7309)),
-	VERTEX_PACK(floattov16(0.263571),floattov16(-0.0101388)), VERTEX_PACK(floattov16(-0.419348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(301),inttot16(177)),
-	NORMAL_PACK(floattov10(0.4846),floattov10(-0.5771),floattov10(-0.6574)),
-	VERTEX_PACK(floattov16(0.383591),floattov16(0.0217301)), VERTEX_PACK(floattov16(-0.330477),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(477)),
-	NORMAL_PACK(floattov10(0.8353),floattov10(0.4193),floattov10(0.3556)),
-	VERTEX_PACK(floattov16(0.585554),floattov16(0.237092)), VERTEX_PACK(floattov16(-0.14362),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(387),inttot16(352)),
-	NORMAL_PACK(floattov10(-0.5177),floattov10(-0.1161),floattov10(0.8477)),
-	VERTEX_PACK(floattov16(-0.654877),floattov16(0.25003)), VERTEX_PACK(floattov16(-0.183056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(373),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(387),inttot16(352)),
-	NORMAL_PACK(floattov10(-0.5177),floattov10(-0.1161),floattov10(0.8477)),
-	VERTEX_PACK(floattov16(-0.654877),floattov16(0.25003)), VERTEX_PACK(floattov16(-0.183056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(-0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.299103),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(342)),
-	NORMAL_PACK(floattov10(0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(-0.854698),floattov16(0.226558)), VERTEX_PACK(floattov16(-0.303902),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(-0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.299103),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(441)),
-	NORMAL_PACK(floattov10(0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.318188),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(443)),
-	NORMAL_PACK(floattov10(0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.294435),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.6045),floattov10(0.043),floattov10(0.7954)),
-	VERTEX_PACK(floattov16(-0.918849),floattov16(0.20902)), VERTEX_PACK(floattov16(-0.306941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.290695),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(413)),
-	NORMAL_PACK(floattov10(0.1737),floattov10(-0.635),floattov10(0.7527)),
-	VERTEX_PACK(floattov16(0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.110433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(446)),
-	NORMAL_PACK(floattov10(0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.28787),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(-0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.300376),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(342)),
-	NORMAL_PACK(floattov10(-0.4211),floattov10(0.2443),floattov10(0.8735)),
-	VERTEX_PACK(floattov16(-0.813392),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.27728),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(446)),
-	NORMAL_PACK(floattov10(0.4205),floattov10(0.2442),floattov10(0.8738)),
-	VERTEX_PACK(floattov16(0.813393),floattov16(0.319948)), VERTEX_PACK(floattov16(-0.264774),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(391),inttot16(94)),
-	NORMAL_PACK(floattov10(0.7653),floattov10(-0.6371),floattov10(0.0916)),
-	VERTEX_PACK(floattov16(0.503486),floattov16(-0.0159068)), VERTEX_PACK(floattov16(0.0106575),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(401),inttot16(114)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(384),inttot16(106)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(214),inttot16(392)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(413)),
-	NORMAL_PACK(floattov10(0.1737),floattov10(-0.635),floattov10(0.7527)),
-	VERTEX_PACK(floattov16(0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.110433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(383),inttot16(371)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(373),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.8153),floattov10(0.4655),floattov10(0.3444)),
-	VERTEX_PACK(floattov16(-0.58666),floattov16(0.23871)), VERTEX_PACK(floattov16(-0.157526),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(387),inttot16(352)),
-	NORMAL_PACK(floattov10(-0.5177),floattov10(-0.1161),floattov10(0.8477)),
-	VERTEX_PACK(floattov16(-0.654877),floattov16(0.25003)), VERTEX_PACK(floattov16(-0.183056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(227),inttot16(430)),
-	NORMAL_PACK(floattov10(0.5192),floattov10(0.6571),floattov10(0.5464)),
-	VERTEX_PACK(floattov16(0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.174985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(215),inttot16(420)),
-	NORMAL_PACK(floattov10(0.6465),floattov10(0.0235),floattov10(0.7625)),
-	VERTEX_PACK(floattov16(0.509221),floattov16(-0.0190316)), VERTEX_PACK(floattov16(-0.118057),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(355)),
-	NORMAL_PACK(floattov10(-0.5237),floattov10(0.6641),floattov10(0.5337)),
-	VERTEX_PACK(floattov16(-0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.187491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(355)),
-	NORMAL_PACK(floattov10(-0.5237),floattov10(0.6641),floattov10(0.5337)),
-	VERTEX_PACK(floattov16(-0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.187491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(227),inttot16(430)),
-	NORMAL_PACK(floattov10(0.5192),floattov10(0.6571),floattov10(0.5464)),
-	VERTEX_PACK(floattov16(0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.174985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.21845),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(222),inttot16(440)),
-	NORMAL_PACK(floattov10(0.9025),floattov10(-0.1261),floattov10(0.4118)),
-	VERTEX_PACK(floattov16(0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.174839),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(383),inttot16(371)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(387),inttot16(352)),
-	NORMAL_PACK(floattov10(-0.5177),floattov10(-0.1161),floattov10(0.8477)),
-	VERTEX_PACK(floattov16(-0.654877),floattov16(0.25003)), VERTEX_PACK(floattov16(-0.183056),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(383),inttot16(371)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(202),inttot16(421)),
-	NORMAL_PACK(floattov10(0.9029),floattov10(-0.423),floattov10(0.0761)),
-	VERTEX_PACK(floattov16(0.50254),floattov16(-0.002156)), VERTEX_PACK(floattov16(-0.0858844),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(236),inttot16(471)),
-	NORMAL_PACK(floattov10(0.8812),floattov10(-0.1946),floattov10(0.4307)),
-	VERTEX_PACK(floattov16(0.588263),floattov16(0.202962)), VERTEX_PACK(floattov16(-0.137985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(189),inttot16(459)),
-	NORMAL_PACK(floattov10(0.9667),floattov10(-0.2444),floattov10(0.0764)),
-	VERTEX_PACK(floattov16(0.571389),floattov16(0.127497)), VERTEX_PACK(floattov16(0.0535458),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(416),inttot16(402)),
-	NORMAL_PACK(floattov10(-0.8993),floattov10(-0.4337),floattov10(0.0555)),
-	VERTEX_PACK(floattov16(-0.537917),floattov16(0.0394429)), VERTEX_PACK(floattov16(0.0192514),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(383),inttot16(371)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(438),inttot16(363)),
-	NORMAL_PACK(floattov10(-0.8116),floattov10(-0.1801),floattov10(0.5558)),
-	VERTEX_PACK(floattov16(-0.499652),floattov16(-0.0146251)), VERTEX_PACK(floattov16(-0.124069),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(383),inttot16(371)),
-	NORMAL_PACK(floattov10(-0.8858),floattov10(-0.2555),floattov10(0.3873)),
-	VERTEX_PACK(floattov16(-0.586872),floattov16(0.202166)), VERTEX_PACK(floattov16(-0.15134),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(394),inttot16(349)),
-	NORMAL_PACK(floattov10(-0.6096),floattov10(-0.5503),floattov10(0.5706)),
-	VERTEX_PACK(floattov16(-0.689784),floattov16(0.239681)), VERTEX_PACK(floattov16(-0.230109),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(-0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.23004),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(365)),
-	NORMAL_PACK(floattov10(-0.9026),floattov10(-0.1276),floattov10(0.4111)),
-	VERTEX_PACK(floattov16(-0.533792),floattov16(0.0674541)), VERTEX_PACK(floattov16(-0.187344),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(-0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.23004),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(413),inttot16(356)),
-	NORMAL_PACK(floattov10(-0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(-0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.230956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(433)),
-	NORMAL_PACK(floattov10(0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.213606),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.21845),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(227),inttot16(430)),
-	NORMAL_PACK(floattov10(0.5192),floattov10(0.6571),floattov10(0.5464)),
-	VERTEX_PACK(floattov16(0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.174985),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(422),inttot16(355)),
-	NORMAL_PACK(floattov10(-0.5237),floattov10(0.6641),floattov10(0.5337)),
-	VERTEX_PACK(floattov16(-0.5655),floattov16(-0.0056182)), VERTEX_PACK(floattov16(-0.187491),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(353)),
-	NORMAL_PACK(floattov10(-0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(-0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.226111),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(447)),
-	NORMAL_PACK(floattov10(0.4844),floattov10(-0.3874),floattov10(0.7844)),
-	VERTEX_PACK(floattov16(0.738186),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.284136),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(451)),
-	NORMAL_PACK(floattov10(0.6127),floattov10(-0.5902),floattov10(0.5257)),
-	VERTEX_PACK(floattov16(0.689758),floattov16(0.239653)), VERTEX_PACK(floattov16(-0.217578),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(241),inttot16(450)),
-	NORMAL_PACK(floattov10(0.495),floattov10(-0.2734),floattov10(0.8248)),
-	VERTEX_PACK(floattov16(0.64302),floattov16(0.166408)), VERTEX_PACK(floattov16(-0.229753),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(346)),
-	NORMAL_PACK(floattov10(-0.4844),floattov10(-0.3873),floattov10(0.7845)),
-	VERTEX_PACK(floattov16(-0.738185),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.29664),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(343)),
-	NORMAL_PACK(floattov10(-0.1501),floattov10(-0.547),floattov10(0.8236)),
-	VERTEX_PACK(floattov16(-0.805864),floattov16(0.258455)), VERTEX_PACK(floattov16(-0.300376),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.351),floattov10(-0.3566),floattov10(0.8658)),
-	VERTEX_PACK(floattov16(0.854698),floattov16(0.226557)), VERTEX_PACK(floattov16(-0.291397),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.304818),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(-0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.342837),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(343)),
-	NORMAL_PACK(floattov10(0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(-0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.340779),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(-0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.317323),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.330331),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(252),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.304818),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(-0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.342837),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(400),inttot16(342)),
-	NORMAL_PACK(floattov10(0.9655),floattov10(0.0478),floattov10(-0.256)),
-	VERTEX_PACK(floattov16(-0.861599),floattov16(0.151282)), VERTEX_PACK(floattov16(-0.317323),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(435)),
-	NORMAL_PACK(floattov10(0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.244956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(341)),
-	NORMAL_PACK(floattov10(0.5282),floattov10(0.3593),floattov10(0.7694)),
-	VERTEX_PACK(floattov16(-0.842267),floattov16(0.0817173)), VERTEX_PACK(floattov16(-0.3032),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(433)),
-	NORMAL_PACK(floattov10(0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.213606),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(233),inttot16(423)),
-	NORMAL_PACK(floattov10(0.4084),floattov10(0.463),floattov10(0.7867)),
-	VERTEX_PACK(floattov16(0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.132413),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(408),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.0916),floattov10(0.7261),floattov10(0.6815)),
-	VERTEX_PACK(floattov16(-0.749856),floattov16(0.0016114)), VERTEX_PACK(floattov16(-0.257461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(347)),
-	NORMAL_PACK(floattov10(-0.424),floattov10(0.4591),floattov10(0.7807)),
-	VERTEX_PACK(floattov16(-0.605818),floattov16(-0.0308483)), VERTEX_PACK(floattov16(-0.144919),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(353)),
-	NORMAL_PACK(floattov10(-0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(-0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.226111),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.21845),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(232),inttot16(433)),
-	NORMAL_PACK(floattov10(0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.213606),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(353)),
-	NORMAL_PACK(floattov10(-0.496),floattov10(0.5505),floattov10(0.6715)),
-	VERTEX_PACK(floattov16(-0.588664),floattov16(-0.0012215)), VERTEX_PACK(floattov16(-0.226111),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(413),inttot16(356)),
-	NORMAL_PACK(floattov10(-0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(-0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.230956),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(241),inttot16(450)),
-	NORMAL_PACK(floattov10(0.495),floattov10(-0.2734),floattov10(0.8248)),
-	VERTEX_PACK(floattov16(0.64302),floattov16(0.166408)), VERTEX_PACK(floattov16(-0.229753),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(447)),
-	NORMAL_PACK(floattov10(0.4844),floattov10(-0.3874),floattov10(0.7844)),
-	VERTEX_PACK(floattov16(0.738186),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.284136),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.4948),floattov10(-0.2732),floattov10(0.8249)),
-	VERTEX_PACK(floattov16(-0.643021),floattov16(0.166409)), VERTEX_PACK(floattov16(-0.242259),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(346)),
-	NORMAL_PACK(floattov10(-0.4844),floattov10(-0.3873),floattov10(0.7845)),
-	VERTEX_PACK(floattov16(-0.738185),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.29664),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(228),inttot16(442)),
-	NORMAL_PACK(floattov10(0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.217534),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(438)),
-	NORMAL_PACK(floattov10(0.4471),floattov10(0.316),floattov10(0.8368)),
-	VERTEX_PACK(floattov16(0.587103),floattov16(0.0487788)), VERTEX_PACK(floattov16(-0.21845),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(228),inttot16(442)),
-	NORMAL_PACK(floattov10(0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.217534),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(238),inttot16(438)),
-	NORMAL_PACK(floattov10(0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(0.651221),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.235716),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(241),inttot16(450)),
-	NORMAL_PACK(floattov10(0.495),floattov10(-0.2734),floattov10(0.8248)),
-	VERTEX_PACK(floattov16(0.64302),floattov16(0.166408)), VERTEX_PACK(floattov16(-0.229753),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(361)),
-	NORMAL_PACK(floattov10(-0.7412),floattov10(0.0792),floattov10(0.6666)),
-	VERTEX_PACK(floattov16(-0.551545),floattov16(0.0726628)), VERTEX_PACK(floattov16(-0.23004),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(354)),
-	NORMAL_PACK(floattov10(-0.4948),floattov10(-0.2732),floattov10(0.8249)),
-	VERTEX_PACK(floattov16(-0.643021),floattov16(0.166409)), VERTEX_PACK(floattov16(-0.242259),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(410),inttot16(350)),
-	NORMAL_PACK(floattov10(-0.3379),floattov10(-0.0395),floattov10(0.9403)),
-	VERTEX_PACK(floattov16(-0.651222),floattov16(0.0470512)), VERTEX_PACK(floattov16(-0.248222),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(245),inttot16(437)),
-	NORMAL_PACK(floattov10(0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(0.726008),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.27375),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(342)),
-	NORMAL_PACK(floattov10(0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(-0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.332205),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(407),inttot16(344)),
-	NORMAL_PACK(floattov10(-0.195),floattov10(0.5981),floattov10(0.7774)),
-	VERTEX_PACK(floattov16(-0.726007),floattov16(0.0090167)), VERTEX_PACK(floattov16(-0.286254),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(-0.770635),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.292195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.6194),floattov10(0.1227),floattov10(0.7754)),
-	VERTEX_PACK(floattov16(0.8613),floattov16(0.145055)), VERTEX_PACK(floattov16(-0.330331),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(440)),
-	NORMAL_PACK(floattov10(-0.2449),floattov10(0.5317),floattov10(0.8108)),
-	VERTEX_PACK(floattov16(0.813808),floattov16(0.0547057)), VERTEX_PACK(floattov16(-0.319699),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.2232),floattov10(-0.3382),floattov10(0.9142)),
-	VERTEX_PACK(floattov16(0.835571),floattov16(0.220154)), VERTEX_PACK(floattov16(-0.328273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(249),inttot16(447)),
-	NORMAL_PACK(floattov10(0.4844),floattov10(-0.3874),floattov10(0.7844)),
-	VERTEX_PACK(floattov16(0.738186),floattov16(0.231056)), VERTEX_PACK(floattov16(-0.284136),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(248),inttot16(444)),
-	NORMAL_PACK(floattov10(0.4348),floattov10(0.0832),floattov10(0.8967)),
-	VERTEX_PACK(floattov16(0.770636),floattov16(0.167166)), VERTEX_PACK(floattov16(-0.27969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(244),inttot16(425)),
-	NORMAL_PACK(floattov10(0.4646),floattov10(-0.7085),floattov10(0.5312)),
-	VERTEX_PACK(floattov16(0.667121),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.180984),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(388)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(445),inttot16(320)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(425),inttot16(314)),
-	NORMAL_PACK(floattov10(0.0697),floattov10(-0.5735),floattov10(-0.8162)),
-	VERTEX_PACK(floattov16(-0.535055),floattov16(-0.0291319)), VERTEX_PACK(floattov16(-0.244569),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(445),inttot16(320)),
-	NORMAL_PACK(floattov10(-0.0197),floattov10(-0.97),floattov10(-0.2423)),
-	VERTEX_PACK(floattov16(-0.484187),floattov16(-0.0730737)), VERTEX_PACK(floattov16(-0.184729),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(417),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4666),floattov10(-0.7066),floattov10(0.532)),
-	VERTEX_PACK(floattov16(-0.66712),floattov16(-0.0680939)), VERTEX_PACK(floattov16(-0.193489),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(253),inttot16(438)),
-	NORMAL_PACK(floattov10(0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(0.86966),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.32641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(438)),
-	NORMAL_PACK(floattov10(0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(0.836251),floattov16(0.012579)), VERTEX_PACK(floattov16(-0.27781),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(251),inttot16(428)),
-	NORMAL_PACK(floattov10(0.1262),floattov10(-0.9259),floattov10(-0.356)),
-	VERTEX_PACK(floattov16(0.700724),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.261399),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(338)),
-	NORMAL_PACK(floattov10(-0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(-0.869658),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.338915),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(338)),
-	NORMAL_PACK(floattov10(-0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(-0.869658),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.338915),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(412),inttot16(335)),
-	NORMAL_PACK(floattov10(-0.1267),floattov10(-0.9259),floattov10(-0.3559)),
-	VERTEX_PACK(floattov16(-0.700723),floattov16(-0.0668913)), VERTEX_PACK(floattov16(-0.273904),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.5642),floattov10(-0.4376),floattov10(0.7001)),
-	VERTEX_PACK(floattov16(-0.836252),floattov16(0.0125783)), VERTEX_PACK(floattov16(-0.290316),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(402),inttot16(338)),
-	NORMAL_PACK(floattov10(-0.6386),floattov10(-0.7016),floattov10(-0.3161)),
-	VERTEX_PACK(floattov16(-0.869658),floattov16(0.0210133)), VERTEX_PACK(floattov16(-0.338915),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(-0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.330694),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.9023),floattov10(-0.2589),floattov10(0.3447)),
-	VERTEX_PACK(floattov16(-0.928094),floattov16(0.126579)), VERTEX_PACK(floattov16(-0.330694),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(445)),
-	NORMAL_PACK(floattov10(0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.327733),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(443)),
-	NORMAL_PACK(floattov10(0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.326371),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(443)),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.362619),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(445)),
-	NORMAL_PACK(floattov10(0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.327733),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(446)),
-	NORMAL_PACK(floattov10(0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.286597),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(445)),
-	NORMAL_PACK(floattov10(0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.327733),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(396),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.2099),floattov10(0.8558),floattov10(-0.4728)),
-	VERTEX_PACK(floattov16(-0.846421),floattov16(0.330671)), VERTEX_PACK(floattov16(-0.340238),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(341)),
-	NORMAL_PACK(floattov10(-0.2997),floattov10(0.8981),floattov10(0.322)),
-	VERTEX_PACK(floattov16(-0.830792),floattov16(0.336329)), VERTEX_PACK(floattov16(-0.299103),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(468)),
-	NORMAL_PACK(floattov10(0.489),floattov10(0.8101),floattov10(-0.3236)),
-	VERTEX_PACK(floattov16(0.570602),floattov16(0.239544)), VERTEX_PACK(floattov16(-0.212448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(453)),
-	NORMAL_PACK(floattov10(0.0211),floattov10(0.7564),floattov10(0.6538)),
-	VERTEX_PACK(floattov16(0.693863),floattov16(0.30732)), VERTEX_PACK(floattov16(-0.202381),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(450)),
-	NORMAL_PACK(floattov10(-0.4216),floattov10(0.8373),floattov10(-0.3481)),
-	VERTEX_PACK(floattov16(0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.263783),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(281),inttot16(451)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(272),inttot16(468)),
-	NORMAL_PACK(floattov10(0.489),floattov10(0.8101),floattov10(-0.3236)),
-	VERTEX_PACK(floattov16(0.570602),floattov16(0.239544)), VERTEX_PACK(floattov16(-0.212448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(389),inttot16(345)),
-	NORMAL_PACK(floattov10(-0.0027),floattov10(0.7867),floattov10(0.6174)),
-	VERTEX_PACK(floattov16(-0.693862),floattov16(0.307319)), VERTEX_PACK(floattov16(-0.214885),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(367),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.4801),floattov10(0.8118),floattov10(-0.3324)),
-	VERTEX_PACK(floattov16(-0.570678),floattov16(0.239484)), VERTEX_PACK(floattov16(-0.225053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(390),inttot16(341)),
-	NORMAL_PACK(floattov10(0.4222),floattov10(0.8369),floattov10(-0.3483)),
-	VERTEX_PACK(floattov16(-0.694424),floattov16(0.310471)), VERTEX_PACK(floattov16(-0.276289),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(367),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.4801),floattov10(0.8118),floattov10(-0.3324)),
-	VERTEX_PACK(floattov16(-0.570678),floattov16(0.239484)), VERTEX_PACK(floattov16(-0.225053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(377),inttot16(323)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(426)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(281),inttot16(451)),
-	NORMAL_PACK(floattov10(0.1826),floattov10(0.2702),floattov10(-0.9453)),
-	VERTEX_PACK(floattov16(0.573473),floattov16(0.201209)), VERTEX_PACK(floattov16(-0.256766),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(260),inttot16(408)),
-	NORMAL_PACK(floattov10(-0.1082),floattov10(-0.5547),floattov10(-0.825)),
-	VERTEX_PACK(floattov16(0.549378),floattov16(-0.0323393)), VERTEX_PACK(floattov16(-0.234448),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(280),inttot16(426)),
-	NORMAL_PACK(floattov10(0.0771),floattov10(-0.1497),floattov10(-0.9857)),
-	VERTEX_PACK(floattov16(0.564168),floattov16(0.0900228)), VERTEX_PACK(floattov16(-0.259941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(310)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(310)),
-	NORMAL_PACK(floattov10(-0.0303),floattov10(-0.1589),floattov10(-0.9868)),
-	VERTEX_PACK(floattov16(-0.566767),floattov16(0.0845901)), VERTEX_PACK(floattov16(-0.273382),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(377),inttot16(323)),
-	NORMAL_PACK(floattov10(-0.1522),floattov10(0.2728),floattov10(-0.95)),
-	VERTEX_PACK(floattov16(-0.574439),floattov16(0.200236)), VERTEX_PACK(floattov16(-0.270286),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(256),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.371053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(256),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.371053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(435)),
-	NORMAL_PACK(floattov10(-0.0747),floattov10(-0.4715),floattov10(-0.8787)),
-	VERTEX_PACK(floattov16(0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.337938),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(258),inttot16(444)),
-	NORMAL_PACK(floattov10(-0.3335),floattov10(0.2997),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(0.764046),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.346758),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(338)),
-	NORMAL_PACK(floattov10(0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(-0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.383558),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(395),inttot16(338)),
-	NORMAL_PACK(floattov10(0.3336),floattov10(0.2998),floattov10(-0.8938)),
-	VERTEX_PACK(floattov16(-0.764049),floattov16(0.258969)), VERTEX_PACK(floattov16(-0.359264),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(403),inttot16(335)),
-	NORMAL_PACK(floattov10(0.0732),floattov10(-0.4715),floattov10(-0.8788)),
-	VERTEX_PACK(floattov16(-0.774967),floattov16(0.0058646)), VERTEX_PACK(floattov16(-0.350444),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(254),inttot16(441)),
-	NORMAL_PACK(floattov10(0.6861),floattov10(-0.2199),floattov10(-0.6935)),
-	VERTEX_PACK(floattov16(0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.36349),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(256),inttot16(442)),
-	NORMAL_PACK(floattov10(-0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.371053),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(255),inttot16(443)),
-	NORMAL_PACK(floattov10(0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.362619),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(-0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.375124),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.911),floattov10(0.4041),floattov10(0.0823)),
-	VERTEX_PACK(floattov16(-0.930306),floattov16(0.25502)), VERTEX_PACK(floattov16(-0.338877),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(399),inttot16(339)),
-	NORMAL_PACK(floattov10(-0.6861),floattov10(-0.2199),floattov10(-0.6934)),
-	VERTEX_PACK(floattov16(-0.925089),floattov16(0.133118)), VERTEX_PACK(floattov16(-0.375995),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(397),inttot16(340)),
-	NORMAL_PACK(floattov10(-0.4337),floattov10(0.4038),floattov10(-0.8055)),
-	VERTEX_PACK(floattov16(-0.904586),floattov16(0.261905)), VERTEX_PACK(floattov16(-0.375124),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(398),inttot16(338)),
-	NORMAL_PACK(floattov10(0.0678),floattov10(-0.0152),floattov10(-0.9976)),
-	VERTEX_PACK(floattov16(-0.862187),floattov16(0.176467)), VERTEX_PACK(floattov16(-0.383558),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(214),inttot16(392)),
-	NORMAL_PACK(floattov10(0.3413),floattov10(-0.9162),floattov10(0.2099)),
-	VERTEX_PACK(floattov16(0.460564),floattov16(-0.0690228)), VERTEX_PACK(floattov16(-0.110195),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(247),inttot16(388)),
-	NORMAL_PACK(floattov10(0.0378),floattov10(-0.9679),floattov10(-0.2484)),
-	VERTEX_PACK(floattov16(0.473067),floattov16(-0.0723471)), VERTEX_PACK(floattov16(-0.171133),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(231),inttot16(413)),
-	NORMAL_PACK(floattov10(0.1737),floattov10(-0.635),floattov10(0.7527)),
-	VERTEX_PACK(floattov16(0.555721),floattov16(-0.0767452)), VERTEX_PACK(floattov16(-0.110433),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(102),inttot16(238)),
-	NORMAL_PACK(floattov10(0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(426),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.8205),floattov10(-0.2694),floattov10(0.5042)),
-	VERTEX_PACK(floattov16(-0.410157),floattov16(0.103907)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(184)),
-	NORMAL_PACK(floattov10(-0.6506),floattov10(-0.583),floattov10(0.4867)),
-	VERTEX_PACK(floattov16(-0.372559),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(199)),
-	NORMAL_PACK(floattov10(0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(96),inttot16(209)),
-	NORMAL_PACK(floattov10(0.6506),floattov10(-0.583),floattov10(0.4867)),
-	VERTEX_PACK(floattov16(0.372559),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(179)),
-	NORMAL_PACK(floattov10(-0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(-0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(467),inttot16(179)),
-	NORMAL_PACK(floattov10(-0.07),floattov10(-0.8731),floattov10(0.4824)),
-	VERTEX_PACK(floattov16(-0.246093),floattov16(-0.0027342)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(184)),
-	NORMAL_PACK(floattov10(-0.6506),floattov10(-0.583),floattov10(0.4867)),
-	VERTEX_PACK(floattov16(-0.372559),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(179)),
-	NORMAL_PACK(floattov10(-0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(-0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(63),inttot16(221)),
-	NORMAL_PACK(floattov10(0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(63),inttot16(221)),
-	NORMAL_PACK(floattov10(0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(63),inttot16(221)),
-	NORMAL_PACK(floattov10(0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(463),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(-0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(192)),
-	NORMAL_PACK(floattov10(0.07),floattov10(-0.8731),floattov10(0.4824)),
-	VERTEX_PACK(floattov16(0.246093),floattov16(-0.0027342)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(185)),
-	NORMAL_PACK(floattov10(0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(493),inttot16(195)),
-	NORMAL_PACK(floattov10(0.5675),floattov10(-0.6151),floattov10(0.5474)),
-	VERTEX_PACK(floattov16(-0.119629),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(467),inttot16(179)),
-	NORMAL_PACK(floattov10(-0.07),floattov10(-0.8731),floattov10(0.4824)),
-	VERTEX_PACK(floattov16(-0.246093),floattov16(-0.0027342)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(185)),
-	NORMAL_PACK(floattov10(0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(222)),
-	NORMAL_PACK(floattov10(-0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(40),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.5675),floattov10(-0.6151),floattov10(0.5474)),
-	VERTEX_PACK(floattov16(0.119629),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(209)),
-	NORMAL_PACK(floattov10(0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(-0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(225)),
-	NORMAL_PACK(floattov10(0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(-0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(493),inttot16(195)),
-	NORMAL_PACK(floattov10(0.5675),floattov10(-0.6151),floattov10(0.5474)),
-	VERTEX_PACK(floattov16(-0.119629),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(209)),
-	NORMAL_PACK(floattov10(0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(-0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(228)),
-	NORMAL_PACK(floattov10(-0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(472),inttot16(220)),
-	NORMAL_PACK(floattov10(0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(-0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(238)),
-	NORMAL_PACK(floattov10(-0.749),floattov10(0.3002),floattov10(0.5907)),
-	VERTEX_PACK(floattov16(0.0820316),floattov16(0.237891)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(238)),
-	NORMAL_PACK(floattov10(-0.749),floattov10(0.3002),floattov10(0.5907)),
-	VERTEX_PACK(floattov16(0.0820316),floattov16(0.237891)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(222)),
-	NORMAL_PACK(floattov10(-0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(492),inttot16(239)),
-	NORMAL_PACK(floattov10(0.749),floattov10(0.3002),floattov10(0.5907)),
-	VERTEX_PACK(floattov16(-0.0820316),floattov16(0.237891)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(250)),
-	NORMAL_PACK(floattov10(0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(-0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(225)),
-	NORMAL_PACK(floattov10(0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(-0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(268)),
-	NORMAL_PACK(floattov10(0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(41),inttot16(263)),
-	NORMAL_PACK(floattov10(-0.2577),floattov10(0.7935),floattov10(0.5514)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.333593)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(41),inttot16(263)),
-	NORMAL_PACK(floattov10(-0.2577),floattov10(0.7935),floattov10(0.5514)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.333593)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(467),inttot16(255)),
-	NORMAL_PACK(floattov10(0.2577),floattov10(0.7935),floattov10(0.5514)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.333593)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(255)),
-	NORMAL_PACK(floattov10(-0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(-0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(250)),
-	NORMAL_PACK(floattov10(0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(-0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(57),inttot16(239)),
-	NORMAL_PACK(floattov10(0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(227)),
-	NORMAL_PACK(floattov10(-0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(-0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(226)),
-	NORMAL_PACK(floattov10(0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(-0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(240)),
-	NORMAL_PACK(floattov10(0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(263)),
-	NORMAL_PACK(floattov10(0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(268)),
-	NORMAL_PACK(floattov10(0.3938),floattov10(0.7582),floattov10(0.5196)),
-	VERTEX_PACK(floattov16(0.314453),floattov16(0.333593)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(268)),
-	NORMAL_PACK(floattov10(0.3938),floattov10(0.7582),floattov10(0.5196)),
-	VERTEX_PACK(floattov16(0.314453),floattov16(0.333593)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(268)),
-	NORMAL_PACK(floattov10(0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(249)),
-	NORMAL_PACK(floattov10(-0.3938),floattov10(0.7582),floattov10(0.5196)),
-	VERTEX_PACK(floattov16(-0.314453),floattov16(0.333593)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(426),inttot16(238)),
-	NORMAL_PACK(floattov10(-0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(-0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(255)),
-	NORMAL_PACK(floattov10(-0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(-0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(96),inttot16(252)),
-	NORMAL_PACK(floattov10(0.8047),floattov10(0.3111),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.410157),floattov16(0.237891)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(263)),
-	NORMAL_PACK(floattov10(0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(426),inttot16(238)),
-	NORMAL_PACK(floattov10(-0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(-0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(69),inttot16(235)),
-	NORMAL_PACK(floattov10(0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(219)),
-	NORMAL_PACK(floattov10(-0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(-0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(63),inttot16(221)),
-	NORMAL_PACK(floattov10(0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(69),inttot16(235)),
-	NORMAL_PACK(floattov10(0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(63),inttot16(221)),
-	NORMAL_PACK(floattov10(0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(463),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(-0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(52),inttot16(236)),
-	NORMAL_PACK(floattov10(-0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(226)),
-	NORMAL_PACK(floattov10(0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(-0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(472),inttot16(220)),
-	NORMAL_PACK(floattov10(0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(-0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(226)),
-	NORMAL_PACK(floattov10(0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(-0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(52),inttot16(236)),
-	NORMAL_PACK(floattov10(-0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(57),inttot16(239)),
-	NORMAL_PACK(floattov10(0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(227)),
-	NORMAL_PACK(floattov10(-0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(-0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(226)),
-	NORMAL_PACK(floattov10(0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(-0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(57),inttot16(239)),
-	NORMAL_PACK(floattov10(0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(240)),
-	NORMAL_PACK(floattov10(0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(230)),
-	NORMAL_PACK(floattov10(0.2632),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(0.264241),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(69),inttot16(235)),
-	NORMAL_PACK(floattov10(0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(240)),
-	NORMAL_PACK(floattov10(0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(102),inttot16(223)),
-	NORMAL_PACK(floattov10(0.8205),floattov10(-0.2694),floattov10(0.5042)),
-	VERTEX_PACK(floattov16(0.410157),floattov16(0.103907)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(96),inttot16(209)),
-	NORMAL_PACK(floattov10(0.6506),floattov10(-0.583),floattov10(0.4867)),
-	VERTEX_PACK(floattov16(0.372559),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(102),inttot16(223)),
-	NORMAL_PACK(floattov10(0.8205),floattov10(-0.2694),floattov10(0.5042)),
-	VERTEX_PACK(floattov16(0.410157),floattov16(0.103907)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(102),inttot16(238)),
-	NORMAL_PACK(floattov10(0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(-0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(-0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(426),inttot16(195)),
-	NORMAL_PACK(floattov10(-0.8205),floattov10(-0.2694),floattov10(0.5042)),
-	VERTEX_PACK(floattov16(-0.410157),floattov16(0.103907)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(199)),
-	NORMAL_PACK(floattov10(0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(71),inttot16(192)),
-	NORMAL_PACK(floattov10(0.07),floattov10(-0.8731),floattov10(0.4824)),
-	VERTEX_PACK(floattov16(0.246093),floattov16(-0.0027342)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(199)),
-	NORMAL_PACK(floattov10(0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(220)),
-	NORMAL_PACK(floattov10(0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(0.359486),floattov16(0.0893284)), VERTEX_PACK(floattov16(0.473892),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(198)),
-	NORMAL_PACK(floattov10(-0.6966),floattov10(-0.4208),floattov10(0.5811)),
-	VERTEX_PACK(floattov16(-0.359484),floattov16(0.0893263)), VERTEX_PACK(floattov16(0.473889),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(179)),
-	NORMAL_PACK(floattov10(-0.447),floattov10(-0.7459),floattov10(0.4937)),
-	VERTEX_PACK(floattov16(-0.314453),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(463),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(-0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(463),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(-0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(40),inttot16(197)),
-	NORMAL_PACK(floattov10(-0.5675),floattov10(-0.6151),floattov10(0.5474)),
-	VERTEX_PACK(floattov16(0.119629),floattov16(0.0478513)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(207)),
-	NORMAL_PACK(floattov10(0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(0.268901),floattov16(0.0326249)), VERTEX_PACK(floattov16(0.492034),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(462),inttot16(192)),
-	NORMAL_PACK(floattov10(-0.2285),floattov10(-0.7674),floattov10(0.5991)),
-	VERTEX_PACK(floattov16(-0.268901),floattov16(0.0326256)), VERTEX_PACK(floattov16(0.492033),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(185)),
-	NORMAL_PACK(floattov10(0.2091),floattov10(-0.83),floattov10(0.5171)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.0109375)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(207)),
-	NORMAL_PACK(floattov10(-0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(200)),
-	NORMAL_PACK(floattov10(0.3671),floattov10(-0.6706),floattov10(0.6446)),
-	VERTEX_PACK(floattov16(-0.166811),floattov16(0.0564928)), VERTEX_PACK(floattov16(0.510483),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(209)),
-	NORMAL_PACK(floattov10(0.7269),floattov10(-0.365),floattov10(0.5817)),
-	VERTEX_PACK(floattov16(-0.0820316),floattov16(0.103907)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(228)),
-	NORMAL_PACK(floattov10(-0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(472),inttot16(220)),
-	NORMAL_PACK(floattov10(0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(-0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(470),inttot16(213)),
-	NORMAL_PACK(floattov10(0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(-0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(486),inttot16(217)),
-	NORMAL_PACK(floattov10(0.7176),floattov10(-0.1585),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(-0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515642),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(52),inttot16(236)),
-	NORMAL_PACK(floattov10(-0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(228)),
-	NORMAL_PACK(floattov10(-0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(466),inttot16(226)),
-	NORMAL_PACK(floattov10(0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(-0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(472),inttot16(220)),
-	NORMAL_PACK(floattov10(0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(-0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(220)),
-	NORMAL_PACK(floattov10(-0.7176),floattov10(-0.1586),floattov10(0.6782)),
-	VERTEX_PACK(floattov16(0.110953),floattov16(0.141828)), VERTEX_PACK(floattov16(0.515644),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(23),inttot16(222)),
-	NORMAL_PACK(floattov10(-0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(492),inttot16(239)),
-	NORMAL_PACK(floattov10(0.749),floattov10(0.3002),floattov10(0.5907)),
-	VERTEX_PACK(floattov16(-0.0820316),floattov16(0.237891)), VERTEX_PACK(floattov16(0.456641),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(499),inttot16(225)),
-	NORMAL_PACK(floattov10(0.7991),floattov10(0.0317),floattov10(0.6004)),
-	VERTEX_PACK(floattov16(-0.0683592),floattov16(0.170215)), VERTEX_PACK(floattov16(0.458008),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(29),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(467),inttot16(255)),
-	NORMAL_PACK(floattov10(0.2577),floattov10(0.7935),floattov10(0.5514)),
-	VERTEX_PACK(floattov16(-0.177734),floattov16(0.333593)), VERTEX_PACK(floattov16(0.442968),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(481),inttot16(250)),
-	NORMAL_PACK(floattov10(0.5039),floattov10(0.6393),floattov10(0.5809)),
-	VERTEX_PACK(floattov16(-0.119629),floattov16(0.295996)), VERTEX_PACK(floattov16(0.451856),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(57),inttot16(239)),
-	NORMAL_PACK(floattov10(0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(240)),
-	NORMAL_PACK(floattov10(0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(52),inttot16(236)),
-	NORMAL_PACK(floattov10(-0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(57),inttot16(239)),
-	NORMAL_PACK(floattov10(0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(38),inttot16(239)),
-	NORMAL_PACK(floattov10(-0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(0.132866),floattov16(0.247009)), VERTEX_PACK(floattov16(0.516462),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(227)),
-	NORMAL_PACK(floattov10(-0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(-0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(456),inttot16(226)),
-	NORMAL_PACK(floattov10(-0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(-0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(227)),
-	NORMAL_PACK(floattov10(-0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(-0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(479),inttot16(234)),
-	NORMAL_PACK(floattov10(0.5813),floattov10(0.4438),floattov10(0.682)),
-	VERTEX_PACK(floattov16(-0.132868),floattov16(0.247008)), VERTEX_PACK(floattov16(0.516461),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(62),inttot16(240)),
-	NORMAL_PACK(floattov10(0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(69),inttot16(235)),
-	NORMAL_PACK(floattov10(0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(456),inttot16(226)),
-	NORMAL_PACK(floattov10(-0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(-0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(219)),
-	NORMAL_PACK(floattov10(-0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(-0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(456),inttot16(226)),
-	NORMAL_PACK(floattov10(-0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(-0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(241)),
-	NORMAL_PACK(floattov10(0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(-0.218891),floattov16(0.304702)), VERTEX_PACK(floattov16(0.503778),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(51),inttot16(252)),
-	NORMAL_PACK(floattov10(-0.0624),floattov10(0.7649),floattov10(0.6412)),
-	VERTEX_PACK(floattov16(0.218889),floattov16(0.304702)), VERTEX_PACK(floattov16(0.50378),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(55),inttot16(268)),
-	NORMAL_PACK(floattov10(0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(249)),
-	NORMAL_PACK(floattov10(-0.3938),floattov10(0.7582),floattov10(0.5196)),
-	VERTEX_PACK(floattov16(-0.314453),floattov16(0.333593)), VERTEX_PACK(floattov16(0.418359),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(255)),
-	NORMAL_PACK(floattov10(-0.1413),floattov10(0.8302),floattov10(0.5393)),
-	VERTEX_PACK(floattov16(-0.246093),floattov16(0.347266)), VERTEX_PACK(floattov16(0.431348),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(102),inttot16(238)),
-	NORMAL_PACK(floattov10(0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(96),inttot16(252)),
-	NORMAL_PACK(floattov10(0.8047),floattov10(0.3111),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(0.410157),floattov16(0.237891)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(253)),
-	NORMAL_PACK(floattov10(0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(0.321783),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483862),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(85),inttot16(263)),
-	NORMAL_PACK(floattov10(0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.8047),floattov10(0.3111),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(-0.410157),floattov16(0.237891)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.8566),floattov10(-0.0252),floattov10(0.5154)),
-	VERTEX_PACK(floattov16(-0.424544),floattov16(0.170208)), VERTEX_PACK(floattov16(0.39685),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(420),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.8047),floattov10(0.3111),floattov10(0.5057)),
-	VERTEX_PACK(floattov16(-0.410157),floattov16(0.237891)), VERTEX_PACK(floattov16(0.399218),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(426),inttot16(238)),
-	NORMAL_PACK(floattov10(-0.6779),floattov10(0.5224),floattov10(0.5172)),
-	VERTEX_PACK(floattov16(-0.372559),floattov16(0.295996)), VERTEX_PACK(floattov16(0.406738),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(84),inttot16(239)),
-	NORMAL_PACK(floattov10(0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(0.379606),floattov16(0.198712)), VERTEX_PACK(floattov16(0.471936),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(69),inttot16(235)),
-	NORMAL_PACK(floattov10(0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(70),inttot16(225)),
-	NORMAL_PACK(floattov10(0.5829),floattov10(-0.2862),floattov10(0.7605)),
-	VERTEX_PACK(floattov16(0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(436),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.8009),floattov10(0.1384),floattov10(0.5826)),
-	VERTEX_PACK(floattov16(-0.379606),floattov16(0.198713)), VERTEX_PACK(floattov16(0.471941),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(219)),
-	NORMAL_PACK(floattov10(-0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(-0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(443),inttot16(234)),
-	NORMAL_PACK(floattov10(-0.5148),floattov10(0.6187),floattov10(0.5934)),
-	VERTEX_PACK(floattov16(-0.321777),floattov16(0.284899)), VERTEX_PACK(floattov16(0.483864),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(219)),
-	NORMAL_PACK(floattov10(-0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(-0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(463),inttot16(208)),
-	NORMAL_PACK(floattov10(-0.2129),floattov10(-0.4876),floattov10(0.8467)),
-	VERTEX_PACK(floattov16(-0.255667),floattov16(0.0994728)), VERTEX_PACK(floattov16(0.561562),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(455),inttot16(209)),
-	NORMAL_PACK(floattov10(-0.5829),floattov10(-0.2862),floattov10(0.7604)),
-	VERTEX_PACK(floattov16(-0.310696),floattov16(0.125182)), VERTEX_PACK(floattov16(0.543429),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(54),inttot16(223)),
-	NORMAL_PACK(floattov10(-0.2409),floattov10(-0.3307),floattov10(0.9125)),
-	VERTEX_PACK(floattov16(0.194865),floattov16(0.119583)), VERTEX_PACK(floattov16(0.572814),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(52),inttot16(236)),
-	NORMAL_PACK(floattov10(-0.2215),floattov10(0.4353),floattov10(0.8726)),
-	VERTEX_PACK(floattov16(0.200605),floattov16(0.229142)), VERTEX_PACK(floattov16(0.57071),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(50),inttot16(228)),
-	NORMAL_PACK(floattov10(-0.4798),floattov10(0.0441),floattov10(0.8763)),
-	VERTEX_PACK(floattov16(0.170165),floattov16(0.175005)), VERTEX_PACK(floattov16(0.566431),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(461),inttot16(227)),
-	NORMAL_PACK(floattov10(-0.1219),floattov10(0.5095),floattov10(0.8518)),
-	VERTEX_PACK(floattov16(-0.245155),floattov16(0.244877)), VERTEX_PACK(floattov16(0.563686),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(456),inttot16(226)),
-	NORMAL_PACK(floattov10(-0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(-0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(451),inttot16(219)),
-	NORMAL_PACK(floattov10(-0.6268),floattov10(0.16),floattov10(0.7626)),
-	VERTEX_PACK(floattov16(-0.318864),floattov16(0.199195)), VERTEX_PACK(floattov16(0.542273),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(460),inttot16(217)),
-	NORMAL_PACK(floattov10(-0.2633),floattov10(0.0011),floattov10(0.9647)),
-	VERTEX_PACK(floattov16(-0.264244),floattov16(0.170479)), VERTEX_PACK(floattov16(0.571969),0),
-	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
-	TEXTURE_PACK(inttot16(456),inttot16(226)),
-	NORMAL_PACK(floattov10(-0.4181),floattov10(0.468),floattov10(0.7786)),
-	VERTEX_PACK(floattov16(-0.280921),floattov16(0.241486)), VERTEX_PACK(floattov16(0.550538),0),
-	FIFO_COMMAND_PACK(FIFO_END,FIFO_NOP,FIFO_NOP,FIFO_NOP)
+	4662,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x121007ba, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x12010893, 0x06ef1df1, 0x08d56066, 0x12d406e3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x062a996c, 0x006107b1, 0x000005b6, 0x13730743, 0x161c3d19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x1010fb6d, 0x14200613, 0x091938e5, 0x36d9be99,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x151806e9, 0x185bc8c2, 0x16d33afd, 0x15d90547,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0c6a4529, 0xfe1d0277, 0x000006f1, 0x16fb0618, 0x1eee9465,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x1c236b1a, 0x17190545, 0x101f8dba, 0x3b5b03e3,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x177105b6, 0x1da29467, 0x0142ef7b, 0x1799057f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x11b64890, 0x082013ef, 0x180205ca, 0x1be3eff0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x366fbb27, 0x18100558, 0x1e9267fa, 0x0cedf7f5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x180205a2, 0x11c5df35, 0x36210006, 0x186a0587,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0ef6df94, 0x0501a334, 0x180205ca, 0x1be3eff0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x380f6cd1, 0x189705b6, 0x1d625b78, 0x01803b0c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x190e0614, 0x1ece7b99, 0x03920359, 0x18ee0545,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x106f8e49, 0x3b3b1422, 0x1a2e0547, 0x0c4a42d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x28919afd, 0x1a5604dc, 0x090f0a19, 0x321e2417,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1df807ba, 0x040c9236, 0x01e4f724, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1d3306e3, 0x062a9a94, 0x05a9f52b, 0x1e070894,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x1c940744, 0x161c3ee7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x009ff8e2, 0x000006b7, 0x1cf40956, 0x1b6e0f16, 0x01e047e0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1c31084e, 0x1e9eb783, 0x00e9455c, 0x1c1f0956,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e9e1fa3, 0x01e6982d, 0x1bf40907, 0x1e3f375f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x017e4023, 0x1ab709eb, 0x1f7f63a9, 0x0533fbdc, 0x00000854,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b00098e, 0x1e5f3366, 0x027d376f, 0x19e209db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e5e677e, 0x04f6fd54, 0x0000089d, 0x1a37098d, 0x1fef5be8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f2e0b5f, 0x19f00968, 0x1faf6bbc, 0x3feee874,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1d3306e3, 0x062a9a94, 0x0061f84f, 0x000005b6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1be70614, 0x09193b1b, 0x06eab5fa, 0x1c940744,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x161c3ee7, 0x09364699, 0x1aef06e9, 0x184bcb3c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xffdcfb4c, 0x00000791, 0x1c31084e, 0x1e9eb783, 0x0291f953, 0x00000785,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b03077a, 0x1ddf2750, 0x09c931e9, 0x1b6407d7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1115b4e9, 0x3a029b63, 0x1afd0799, 0x1c338ba7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x041e80b3, 0x00000002, 0x15d90547, 0x0c6a4529,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfe1d0277, 0x000006f1, 0x17190545, 0x101f8dba, 0x177e6afd,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15b104db, 0x090f09e7, 0xfda60260, 0x00000612, 0x1680048c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1161b5a0, 0x194d37ac, 0x15a80334, 0x04b189f1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfad2034f, 0x00000662, 0x164c0315, 0x15c0a976, 0x113dab88,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x163a00ea, 0x127e098f, 0x01bf680e, 0x16be016c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b5ec0ff, 0x0dd34725, 0x16f300b8, 0x173b0898,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x399a3b83, 0x17830132, 0x1e5f4362, 0x0b830ed9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x17d200fa, 0x1faf5bbe, 0x3d9e1f70, 0x17be0155,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x187fcab5, 0x37b37883, 0x17e70127, 0x1a744ba7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f9dc35a, 0x18300135, 0x1a5380ba, 0x3fe0830f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x18540102, 0x1f6ef84a, 0x09be93f1, 0x184b015a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x173ea156, 0x377397b2, 0x188d016f, 0x1d0d9496,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0bf00bd4, 0x184b0175, 0x0fd9c8c7, 0x37811c4e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x186e01b5, 0x1cec8c10, 0x0b00cbef, 0x17ba0175,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x122a3b36, 0x352f65cd, 0x178e01b3, 0x1e1d47fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0a90c02d, 0x17be0155, 0x187fcab5, 0x315d8fe9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x17830132, 0x1e5f4362, 0x0ace6c0d, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15a80334, 0x04b189f1, 0xfad2034f, 0x00000662, 0x163a00ea,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x127e098f, 0x01bf680e, 0x15f70078, 0x02dc2dbf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x316dac47, 0x168a004e, 0x0a28fcb9, 0x07ce1f0b,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x17830132, 0x1e5f4362, 0xf69b0105, 0x000007ec,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16be016c, 0x1b5ec0ff, 0x3af2bda4, 0x178e01b3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1d47fc, 0x09014e66, 0x173d04b8, 0x163d794b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x021fd005, 0x17910472, 0x1c9ce473, 0x013e4372,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x17770522, 0x174f055a, 0x0c13f8a4, 0x180504c4,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x199b3007, 0x3d5d0eaf, 0x18100558, 0x1e9267fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x03a45ffa, 0x18860528, 0x178f2ea8, 0x3f3e96b6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x186a0587, 0x0ef6df94, 0x3bf40c84, 0x18ee0545,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x106f8e49, 0x384cbb58, 0x189705b6, 0x1d625b78,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0142ec85, 0x00000002, 0x18100558, 0x1e9267fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfde1fffa, 0x00000932, 0x17770522, 0x174f055a, 0x3f1e9957,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1799057f, 0x11b64890, 0x3db3bf8d, 0x17190545,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x101f8dba, 0x36ad0496, 0x00000002, 0x17e70127,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a744ba7, 0xf6700052, 0x00000739, 0x18540102, 0x1f6ef84a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x099f1300, 0x17d200fa, 0x1faf5bbe, 0x3f3fb923,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x18040054, 0x0fa907fe, 0x321c8f8b, 0x16f300b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x173b0898, 0xf5d8022c, 0x00000734, 0x168a004e, 0x0a28fcb9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x31ce4caa, 0x163a00ea, 0x127e098f, 0x06e438ae,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x17ba0175, 0x122a3b36, 0xf76d00e2, 0x00000782,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x184b0175, 0x0fd9c8c7, 0x3fefd644, 0x17be0155,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x187fcab5, 0x3c0e79d2, 0x184b015a, 0x173ea156,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0090660c, 0x18300135, 0x1a5380ba, 0x3eeddc5d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x1a37098d, 0x1fef5be8, 0x02204bf3,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b00098e, 0x1e5f3366, 0x3ec02298, 0x1ac00983,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09a863f6, 0x3ebfd882, 0x1b190961, 0x15fa2c08,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3dbf535e, 0x00000002, 0x1b00098e, 0x1e5f3366,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02204bed, 0x1bf40907, 0x1e3f375f, 0x33fd1e58,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b190961, 0x15fa2c08, 0x08720d88, 0x1bd408ed,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x1e3d6014, 0x35ece6cc, 0x00000002, 0x0383f9f7, 0x0000079f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bf40907, 0x1e3f375f, 0x01b113ac, 0x1be70895,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fcf1c13, 0x3d2c742e, 0x1c31084e, 0x1e9eb783,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f9eb782, 0x1bce0845, 0x1f8167fb, 0x00df0ca9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x1b6407d7, 0x1115b4e9, 0x02fcbca3, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16690c17, 0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x157d0c5d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x08e61c3b, 0x16260d17, 0x3ce53e80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x048bf7a9, 0x00000450, 0x14d70e5d, 0x3c57b784, 0x05cdfa5d, 0x00000549,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x195f1ba1, 0x090f0a19, 0xfda6fda0, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19dc1b7a, 0x3d10f606, 0x32cb2799, 0x198d1a6e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04e18e10, 0x12498f78, 0x1a881819, 0x3afe7a10,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xf642fc22, 0x00000583, 0x00000002, 0x07d71a49, 0x372930e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfe8c0572, 0x0000fceb, 0x0729191c, 0x06b8acaf, 0x152165ec,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05f01b5e, 0x0259651e, 0xfdec04d2, 0x00000065, 0x02c31a00,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02297925, 0xff860653, 0x0000044c, 0x02a51d56, 0x0a4ccdb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfd5c02ce, 0x00000502, 0x02011d0e, 0x0bead956, 0x0a1297da,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x01b01d72, 0x090f09e7, 0x06fe97b8, 0x015f1d2f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0c6a4529, 0x0df1dc17, 0x00000002, 0x0d40142b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06b8acaf, 0xfee5075e, 0x0000fe3d, 0x0ce612f6, 0x372930e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x2aee9e14, 0x0c4713d1, 0x38184013, 0xfed80792, 0x0000fd43,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0b1a12d7, 0x2afb64f8, 0x00590623, 0x0000fab6, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d6e0b05, 0x0698a358, 0xfeeaf8a6, 0x0000fe09, 0x0c6f0b49,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x38483ff6, 0x302faf9b, 0x0d150c18, 0x37390f2e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfe95fa7e, 0x0000fcf1, 0x0b630b4d, 0x25eb6824, 0xff89f770, 0x0000fc16,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0b400c39, 0x2adb4f13, 0x004cf9f8, 0x0000faae, 0x0a3f0b6b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x207ebff0, 0x015af6ef, 0x0000fba0, 0x09fe0cc4, 0x259e02fd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0219fa46, 0x0000f950, 0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x09aa0e53, 0x220f4355, 0x02d8fd31, 0x0000f7a7, 0x08af0e87,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23126766, 0x3df05bf6, 0x098c0f7a, 0x200fd7fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x03590000, 0x0000f708, 0x08a50fc2, 0x21e28440, 0x05cb00cf, 0x0000f75a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x099f10a1, 0x220f64ae, 0x02d802cf, 0x0000f7a7, 0x08dc1226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24e0e50a, 0x04430620, 0x0000f937, 0x09e2122e, 0x25fdf10a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x021905ba, 0x0000f950, 0x0a1b13d8, 0x207ecc27, 0x01710907, 0x0000fbd7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0b1a12d7, 0x2afb64f8, 0x00590623, 0x0000fab6, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0a1b13d8, 0x207ecc27, 0x01710907, 0x0000fbd7, 0x08dc1226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24e0e50a, 0x04430620, 0x0000f937, 0x08d7140b, 0x21c2285d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0338092d, 0x0000fbe4, 0x07f512af, 0x2972b93f, 0x05d2077b, 0x0000faa9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x07261355, 0x343311b2, 0x18313d0b, 0x06b71214,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x31a5991d, 0x083606b4, 0x0000fbe5, 0x065812ff, 0x3b14f989,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x172cb163, 0x05241213, 0x03766d2c, 0x0933062a, 0x0000ff6f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x058213b7, 0x02b439b1, 0x06be08aa, 0x0000ff86, 0x045b12be,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d756537, 0x19b50e02, 0x04b31423, 0x0bd3f193,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0078ade8, 0x02be13e9, 0x0d85f509, 0x059906d7, 0x0000037c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x032514f7, 0x08e4b984, 0x3c4cd559, 0x026f1547,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ce53d80, 0x110ef427, 0x03041627, 0x009105fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x350b2062, 0x00000002, 0x065812ff, 0x3b14f989,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x07620817, 0x0000fd57, 0x058213b7, 0x02b439b1, 0x06be08aa, 0x0000ff86,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07261355, 0x343311b2, 0x06210886, 0x0000fc2c, 0x056c14d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x033189f4, 0x00005025, 0x06f61513, 0x0b635dac,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x03cb095e, 0x0000fdb4, 0x056316b6, 0x027e0def, 0x020a0924, 0x000000db,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x07251560, 0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x058213b7, 0x02b439b1, 0x06be08aa, 0x0000ff86, 0x04b31423,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0bd3f193, 0x1a2dbbea, 0x056c14d8, 0x033189f4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x2e4b24ab, 0x032514f7, 0x08e4b984, 0x00d04c21,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x03041627, 0x009105fc, 0x060a1489, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x056c14d8, 0x033189f4, 0x00005025, 0x03041627,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x009105fc, 0x035308b9, 0x000003a0, 0x056316b6, 0x027e0def,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x020a0924, 0x000000db, 0x03001787, 0x008cb5d2, 0x01c90890, 0x000003de,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05e8187f, 0x02fae988, 0xffbf080e, 0x0000002c, 0x02c31a00,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02297925, 0xff860653, 0x0000044c, 0x0729191c, 0x06b8acaf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfee5075e, 0x0000fe3d, 0x00000002, 0x03041627, 0x009105fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x035308b9, 0x000003a0, 0x01ce1766, 0x040c91ca, 0x1bca4423,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x03001787, 0x008cb5d2, 0x282f97b4, 0x01b518d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x062a996c, 0x1d8a6321, 0x02c31a00, 0x02297925,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x296c96a2, 0x01981ad6, 0x091938e5, 0x1d8e2364,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02011d0e, 0x0bead956, 0xfe0102a8, 0x000005a3, 0x015f1d2f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0c6a4529, 0x14e073cf, 0x00000002, 0x08d7140b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21c2285d, 0x0338092d, 0x0000fbe4, 0x07261355, 0x343311b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x06210886, 0x0000fc2c, 0x07da1489, 0x35a67cfa, 0x03d50921, 0x0000fc9a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x06f61513, 0x0b635dac, 0x11afd83d, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0a3f0b6b, 0x207ebff0, 0x015af6ef, 0x0000fba0, 0x09050ae7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21a233b2, 0x00d76be0, 0x08eb0ce7, 0x24d10efb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0468fa20, 0x0000f91d, 0x08170bf9, 0x299242b1, 0x1a94222b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x07360cd7, 0x2c0486ec, 0x02c7c909, 0x072e0b8d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x34935253, 0x143b6a30, 0x06660bd7, 0x3a54fa7a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x12249865, 0x058d0b19, 0x02c4164a, 0x06bef756, 0x0000ff86,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x052a0cc5, 0x04365ad0, 0x0933f9d6, 0x0000ff6f, 0x04600c15,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d1552c0, 0x1b2b3b7e, 0x04ab0d97, 0x06a75b52,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0a14fb95, 0x00000073, 0x03b40d29, 0x10e5d31e, 0x1ebbcbb9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x03440e92, 0x126683c9, 0x096afe2d, 0x00000324, 0x01430ce6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0fb6b785, 0x0623fc11, 0x0000056d, 0x00df0f6b, 0x17f54c02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x01806800, 0x00470ea8, 0x07d6e4e5, 0x10fac30f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x00030f68, 0x1036dbc5, 0x3e5ead30, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d, 0x07360cd7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2c0486ec, 0x0762f954, 0x0000faf2, 0x08af0e87, 0x23126766,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3df05bf6, 0x07bf0f3b, 0x2724ffd3, 0x07e5ff60, 0x0000f88a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x08a50fc2, 0x21e28440, 0x05cb00cf, 0x0000f75a, 0x07b11086,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x277478a0, 0x079402e7, 0x0000f90a, 0x08dc1226, 0x24e0e50a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04430620, 0x0000f937, 0x07f512af, 0x2972b93f, 0x17263d5b,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x00030f68, 0x1036dbc5, 0x04e6003f, 0x000006ed,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0047102f, 0x0766af00, 0x0121a8cc, 0x00df0f6b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x17f54c02, 0x2fa4eef5, 0x014411f0, 0x0f96b87a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x062303ef, 0x0000056d, 0x038b1152, 0x119618b0, 0x093f0404, 0x000002a2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02be13e9, 0x0d85f509, 0x059906d7, 0x0000037c, 0x045b12be,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0d756537, 0x080106ac, 0x00000121, 0x00000002, 0x014411f0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f96b87a, 0x062303ef, 0x0000056d, 0x01721339, 0x3c57b47c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3dcea9b4, 0x02be13e9, 0x0d85f509, 0x233f3134,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x026f1547, 0x3ce53d80, 0x0d4bc980, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x06d706b7, 0x11de9260, 0x3f8fffe0, 0x07990589,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0698a358, 0x005c98a5, 0x05d50703, 0x01cc8a34,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x00a2f765, 0x0000004f, 0x058a05e6, 0x04ba3ea5, 0x05dbc0cc,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02fd072b, 0x005cbe2c, 0x01c9f770, 0x000003de, 0x02cd04ae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02697adb, 0xff86f9ad, 0x0000044c, 0x01ba05cd, 0x062a9a94,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x16a36ea2, 0x01a803d3, 0x09193b1b, 0x06eab5fa,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x056316b6, 0x027e0def, 0x020a0924, 0x000000db,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05e8187f, 0x02fae988, 0xffbf080e, 0x0000002c, 0x06ac1801,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x027c9dce, 0x2740e3fc, 0x0729191c, 0x06b8acaf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39dbbb54, 0x00000002, 0x168a004e, 0x0a28fcb9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf56b02d6, 0x00000650, 0x18040054, 0x0fa907fe, 0xf5450000, 0x000006e6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x18040002, 0x3e3807f9, 0x30fef7e6, 0x195b0084,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1259ff59, 0xf594fd5f, 0x000006c0, 0x19ed0051, 0x0369b2ca,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x318fcb2a, 0x19cd00ea, 0x126e1270, 0x0e63cff3,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1a4000df, 0x3afe7a10, 0x2c5f27a6, 0x1a5f0334,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x04e18e10, 0xfad2fcb1, 0x00000662, 0x00000002, 0x18040054,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0fa907fe, 0xf5450000, 0x000006e6, 0x18540102, 0x1f6ef84a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0ec3bf52, 0x195b0084, 0x1259ff59, 0x2eed820d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x194a016c, 0x1b6e9b06, 0x0db6dbf8, 0x19cd00ea,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x126e1270, 0x323cbf25, 0x19bb0315, 0x15c0aa8a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfa3cfd29, 0x00000775, 0x1a5f0334, 0x04e18e10, 0x2ed25b88,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1988048c, 0x1161b660, 0xfcf3fdf4, 0x000007a6, 0x1a5604dc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f0a19, 0x26c2cfac, 0x18ee0545, 0x106f8e49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfdb7fe8c, 0x00000868, 0x00000002, 0x1be70614, 0x09193b1b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0x1a2e0547, 0x0c4a42d6, 0xfe1dfd89, 0x000006f1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1aef06e9, 0x184bcb3c, 0xffdcfb4c, 0x00000791, 0x190e0614,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ece7b99, 0xfef2fe6a, 0x000008b5, 0x19ab0745, 0x1f4ecbb1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3a969eea, 0x190f07d4, 0x1fcf7435, 0x00539140,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19b307b1, 0x1fefbbd4, 0x03df3ee4, 0x19610898,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f6f7ba1, 0x00c6149f, 0x19a707f7, 0x1112c675,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3c9bcb7d, 0x199208e0, 0x3f4c0245, 0x00162c3d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1aef06e9, 0x184bcb3c, 0xffdcfb4c, 0x00000791,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19ab0745, 0x1f4ecbb1, 0x0099fd54, 0x0000085e, 0x1b03077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ddf2750, 0x00ddfb3c, 0x00000821, 0x19b307b1, 0x1fefbbd4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x014cfd78, 0x000008a0, 0x1a830792, 0x17f4d370, 0x3a3f3ea4,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x19e307bf, 0x19c4075e, 0x02c1390c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x18540102, 0x1f6ef84a, 0xf634ff52, 0x000007d2, 0x188d016f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d0d9496, 0x03639f86, 0x194a016c, 0x1b6e9b06,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3930be7f, 0x186e01b5, 0x1cec8c10, 0x095129be,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x18cb04b8, 0x16dd6ac2, 0x021fd3fb, 0x1846046f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d3cebbc, 0x019dbcda, 0x18860528, 0x178f2ea8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0bd47b11, 0x180504c4, 0x199b3007, 0x3d3d1150,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x18860528, 0x178f2ea8, 0xfd86feb0, 0x00000925,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x18ee0545, 0x106f8e49, 0x3430c7dc, 0x18cb04b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x16dd6ac2, 0x3e7d0839, 0x1988048c, 0x1161b660,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x357feb2f, 0x19bb0315, 0x15c0aa8a, 0xfa3cfd29, 0x00000775,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x180504c4, 0x199b3007, 0x024fcc00,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1846046f, 0x1d3cebbc, 0x370e7b9f, 0x17910472,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1c9ce473, 0x3fa0850e, 0x186e01b5, 0x1cec8c10,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xf794ff15, 0x00000830, 0x178e01b3, 0x1e1d47fc, 0x3fb025fa,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x16be016c, 0x1b5ec0ff, 0xf74a02a9, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x164c0315, 0x15c0a976, 0xfa3c02d7, 0x00000775, 0x173d04b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x163d794b, 0x021fd005, 0x1680048c, 0x1161b5a0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x357fe8d1, 0x17190545, 0x101f8dba, 0x0c231368,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x177105b6, 0x1da29467, 0xfe7200ef, 0x0000087c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16fb0618, 0x1eee9465, 0x037214a2, 0x180205ca,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1be3eff0, 0x3b1db674, 0x181f0786, 0x1fffb803,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01150002, 0x00000842, 0x190e0614, 0x1ece7b99, 0xfef2fe6a, 0x000008b5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x190f07d4, 0x1fcf7435, 0x017dfe94, 0x00000863, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x199208e0, 0x3f4c0245, 0x034efdd1, 0x00000876, 0x19610898,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f6f7ba1, 0x036e0c46, 0x19f00968, 0x1faf6bbc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3e158710, 0x18e6094e, 0x1f3e9bb7, 0x030e097c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19e209db, 0x1e5e677e, 0x3e050ab1, 0x1a5f0ad9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ec1efb7, 0x0703fcca, 0x0000092c, 0x1ab709eb, 0x1f7f63a9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3288c312, 0x1c7d09bc, 0x1e1f5f55, 0x04dff8d9, 0x00000804,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1c1f0956, 0x1e9e1fa3, 0x39fd60a7, 0x1cf40956,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1b6e0f16, 0x3d402677, 0x00000002, 0x19610898,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f6f7ba1, 0x02d1fe17, 0x000008ac, 0x190f07d4, 0x1fcf7435,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3b7ab07d, 0x18e6094e, 0x1f3e9bb7, 0x03b4fea3, 0x000008bd,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x181f0786, 0x1fffb803, 0x01150002, 0x00000842, 0x18110988,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fff8fed, 0x03f8ffe8, 0x00000912, 0x175709fd, 0x1fe05bdd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x01731922, 0x18300a3a, 0x0f8674ae, 0x37501eb0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x17a40a4b, 0x0c361ef6, 0x0090dcc5, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04fc007f, 0x000008a7, 0x175709fd, 0x1fe05bdd, 0x082f088b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16790b63, 0x0dc522ba, 0x076801e4, 0x000008be, 0x15ea0aec,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f31b823, 0x07cead1f, 0x15b40bae, 0x09b79c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x33544034, 0x158e0b5b, 0x16f464db, 0x055da467,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x13d50ac6, 0x0156dd07, 0x062e062c, 0x00000778, 0x12b80992,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1601ed5f, 0x04ad088b, 0x00000738, 0x12490993, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x33f0587c, 0x12010893, 0x06ef1df1, 0x3729e43b,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x173616dc, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16d71604, 0x009105fc, 0x2445bfdd, 0x166916a0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06ef1df1, 0x033c0942, 0x000005e9, 0x164e1565, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x26753f15, 0x157d165b, 0x04642daf, 0x01a04c24,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14d71459, 0x3c57b47c, 0x05cd05a3, 0x00000549, 0x142b14af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3376fc94, 0x14320fec, 0x13a21347, 0x2e86778e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x05fc033b, 0x0000066a, 0x12e51417, 0x2e06646e, 0x0c06f086,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x129a1390, 0x2ee5e32a, 0x02a01ace, 0x123d1414,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09b79c24, 0x11b194a8, 0x11f5134a, 0x0dc522ba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04fd16ad, 0x00000002, 0x123d1414, 0x09b79c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x08230337, 0x0000086f, 0x13e71559, 0x0156dd07, 0x062e062c, 0x00000778,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x12e51417, 0x2e06646e, 0x07b803c1, 0x0000072a, 0x142b14af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3376fc94, 0x362a61ce, 0x00000002, 0x01ba05cd,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x062a9a94, 0x0061f84f, 0x000005b6, 0x01c5073f, 0x040c9236,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3a660ed5, 0x02fd072b, 0x005cbe2c, 0x282f944c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x02f80896, 0x00611605, 0x3c262bd7, 0x0564094c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02c06e03, 0x03e6f68d, 0x0000ffe0, 0x032009d3, 0x0854a274,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00d04fdf, 0x04ba0aa9, 0x0b73d265, 0x062cf76c, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02bc0ae8, 0x0d95eef4, 0x0599f929, 0x0000037c, 0x04600c15,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d1552c0, 0x0801f954, 0x00000121, 0x03b40d29, 0x10e5d31e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x13d415fa, 0x00000002, 0x02fd072b, 0x005cbe2c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01c9f770, 0x000003de, 0x0564094c, 0x02c06e03, 0x03e6f68d, 0x0000ffe0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05d50703, 0x01cc8a34, 0x00a2f765, 0x0000004f, 0x06b80996,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0c6df63a, 0x033cf69c, 0x0000fd94, 0x00000002, 0x04600c15,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d1552c0, 0x0801f954, 0x00000121, 0x058d0b19, 0x02c4164a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x265af602, 0x04ba0aa9, 0x0b73d265, 0x1a2db816,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0564094c, 0x02c06e03, 0x03e6f68d, 0x0000ffe0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x03b40d29, 0x10e5d31e, 0x0906fb4e, 0x0000025e, 0x02bc0ae8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d95eef4, 0x0599f929, 0x0000037c, 0x01430ce6, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0623fc11, 0x0000056d, 0x01710b9c, 0x3c57b784, 0x3dceaa4c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x06b80996, 0x0c6df63a, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0564094c, 0x02c06e03, 0x03e6f68d, 0x0000ffe0, 0x075809e1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0b03ba5f, 0x03d2f69d, 0x0000fd7b, 0x072e0b8d, 0x34935253,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3f1067de, 0x080f0a64, 0x3566830a, 0x03d5f6df, 0x0000fc66,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x09050ae7, 0x21a233b2, 0x347d7ff0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01c5073f, 0x040c9236, 0x01e4f724, 0x0000055c, 0x01b50847,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06ef1e0f, 0x08d5639a, 0x02f80896, 0x00611605,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0353f747, 0x000003a0, 0x02500982, 0x3ce53e80, 0x0b04e062,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x032009d3, 0x0854a274, 0x2f010c27, 0x02bc0ae8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0d95eef4, 0x03c32d59, 0x00000002, 0x19dc1b7a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3d10f606, 0xfc6ffd39, 0x0000053e, 0x1a811b40, 0x33700229,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x34ad5432, 0x1a881819, 0x3afe7a10, 0xf642fc22, 0x00000583,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1afe1863, 0x255e8af6, 0x30a1a0a2, 0x1b0017db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2cba932b, 0x07cc0ff6, 0x1c8417aa, 0x2b89dff0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xf569ffb2, 0x00000511, 0x1c8e1716, 0x3e3807f9, 0x0e4e6434,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1e4317d0, 0x2efa10d0, 0xf5970332, 0x00000508, 0x1e38173f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a28fcb9, 0x148f53a4, 0x1ece17ac, 0x02dc2dbf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3841e4f5, 0x00000002, 0x1c8e1716, 0x3e3807f9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf502ffe6, 0x000005f5, 0x1aba1783, 0x0369b2ca, 0xf586fc89, 0x000005d8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b0017db, 0x2cba932b, 0x33109c31, 0x1a881819,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3afe7a10, 0x07a25768, 0x00000002, 0x01b01d72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f09e7, 0xfda60260, 0x00000612, 0x02631dfb, 0x3d10f5fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x32cb2467, 0x02a51d56, 0x0a4ccdb7, 0x3c43b407,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x032d1e10, 0x336005d6, 0x3869a3c7, 0x04881e6f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x39fa8568, 0x26af3f6f, 0x00000002, 0x1ffa1ba1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f09e7, 0xfda60260, 0x00000612, 0x1fcc1a6e, 0x04b189f1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfad2034f, 0x00000662, 0x1f7e1b7a, 0x3d10f5fa, 0x2dc67778,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1ea41821, 0x32df29d0, 0xf67703b4, 0x0000051b, 0x1ed81b40,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x336005d6, 0xfbc40295, 0x00000488, 0x1e531854, 0x24eea501,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf6aa0344, 0x00000490, 0x1e081a8f, 0x260e6519, 0xfa66020e, 0x00000405,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1caa1a53, 0x221d2fff, 0xf9d80000, 0x0000038e, 0x1cfb1af1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2f795461, 0x3613dc86, 0x1c1d1aea, 0x30097f6a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01307e86, 0x00000002, 0x1cfb1af1, 0x2f795461,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfacf0086, 0x000002ef, 0x1de51b4e, 0x39fa8568, 0x0033117e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1e081a8f, 0x260e6519, 0x113b4c0a, 0x1ed81b40,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x336005d6, 0x08357887, 0x00000002, 0x1fcc1a6e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04b189f1, 0xfad2034f, 0x00000662, 0x1ece17ac, 0x02dc2dbf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xf5e403cb, 0x000005d4, 0x1ea41821, 0x32df29d0, 0x34724fe9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1e4317d0, 0x2efa10d0, 0x3edc837e, 0x1e531854,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24eea501, 0x38844c12, 0x1ca51886, 0x223d1fff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf6c7001a, 0x00000420, 0x1caa1a53, 0x221d2fff, 0xf9d80000, 0x0000038e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1afe1863, 0x255e8af6, 0xf6aafcc4, 0x0000048d, 0x1b521a8f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x261e66e6, 0xfa66fdf2, 0x00000405, 0x1a811b40, 0x33700229,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x08357b79, 0x1b761b4e, 0x3a8aaa8e, 0x26af3c91,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0xfb93fdfc, 0x000002f2, 0x1c1d1aea, 0x30097f6a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x010d6d10, 0x1b521a8f, 0x261e66e6, 0x103de2e6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x1caa1a53, 0x221d2fff, 0xf9d80000, 0x0000038e, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1e4317d0, 0x2efa10d0, 0xf5970332, 0x00000508, 0x1c8417aa,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2b89dff0, 0xf569ffb2, 0x00000511, 0x1ca51886, 0x223d1fff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x30f57868, 0x1afe1863, 0x255e8af6, 0xf6aafcc4, 0x0000048d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x07f512af, 0x2972b93f, 0x05d2077b, 0x0000faa9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07b11086, 0x277478a0, 0x079402e7, 0x0000f90a, 0x06b71214,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x31a5991d, 0x083606b4, 0x0000fbe5, 0x06bc10bd, 0x2f969082,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x09680375, 0x0000fb34, 0x05ec1100, 0x39878090, 0x0a23040f, 0x0000fd52,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05f50ef0, 0x3847bfdd, 0x0a68feb0, 0x0000fca9, 0x05160ec1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00a7fbd5, 0x0aa3fe57, 0x0000ff03, 0x061f0d37, 0x37d6d315,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x04ab0d97, 0x06a75b52, 0x0a14fb95, 0x00000073,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x052a0cc5, 0x04365ad0, 0x2fcc7e41, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06b71214, 0x31a5991d, 0x083606b4, 0x0000fbe5, 0x05ec1100,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39878090, 0x0a23040f, 0x0000fd52, 0x05241213, 0x03766d2c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0933062a, 0x0000ff6f, 0x04cc1144, 0x04e768b1, 0x08b3d646,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x045b12be, 0x0d756537, 0x080106ac, 0x00000121, 0x038b1152,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x119618b0, 0x093f0404, 0x000002a2, 0x00000002, 0x05ec1100,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39878090, 0x0a23040f, 0x0000fd52, 0x05160ec1, 0x00a7fbd5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0aa3fe57, 0x0000ff03, 0x04cc1144, 0x04e768b1, 0x0a280470, 0x0000fffa,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x043a1014, 0x0907a823, 0x0a640183, 0x0000012d, 0x038b1152,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x119618b0, 0x093f0404, 0x000002a2, 0x03440e92, 0x126683c9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x096afe2d, 0x00000324, 0x00df0f6b, 0x17f54c02, 0x01806800,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x03440e92, 0x126683c9, 0x096afe2d, 0x00000324,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x043a1014, 0x0907a823, 0x0a640183, 0x0000012d, 0x04ab0d97,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06a75b52, 0x0a14fb95, 0x00000073, 0x05160ec1, 0x00a7fbd5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0aa3fe57, 0x0000ff03, 0x00000002, 0x052a0cc5, 0x04365ad0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0933f9d6, 0x0000ff6f, 0x061f0d37, 0x37d6d315, 0x0979fa5e, 0x0000fcfe,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06660bd7, 0x3a54fa7a, 0x0762f7e9, 0x0000fd57, 0x07360cd7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_XZ, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x2c0486ec, 0xfaf2f954, 0x00000002, 0x14d71459,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3c57b47c, 0x05cd05a3, 0x00000549, 0x13ce1314, 0x0f96b87a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02415a4c, 0x13a21347, 0x2e86778e, 0x0fdf674c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12e01226, 0x0766af00, 0x01c05404, 0x129a1390,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2ee5e32a, 0x07be028f, 0x00000754, 0x11f5134a, 0x0dc522ba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16aeab55, 0x00000002, 0x076801e4, 0x000008be, 0x12e01226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0766af00, 0x01c05404, 0x122311b6, 0x0c361ef6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x1a8eb374, 0x12e6117a, 0x1036dbc5, 0x246fabc0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x12261132, 0x0f8674ae, 0x1b1f7f7b, 0x12f410ce,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x07d6e4e5, 0x26a1db55, 0x11f50f6d, 0x0cd5613f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0768fe1c, 0x000008be, 0x129a0f27, 0x2ed5e0d5, 0x29615b55,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x123d0ea3, 0x0a678fdd, 0x11b19758, 0x12e50ea0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2e066792, 0x2bbe5776, 0x13e70d5e, 0x0156def9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x062ef9d4, 0x00000778, 0x142b0e07, 0x3376ff6c, 0x3140889d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x157d0c5d, 0x04642e51, 0x01a04fdc, 0x14d70e5d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3c57b784, 0x05cdfa5d, 0x00000549, 0x00000002, 0x07db0471,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x05e1032c, 0x02096ae0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdc0fb67, 0x00000072, 0x07990589, 0x0698a358, 0xfeeaf8a6, 0x0000fe09,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x058a05e6, 0x04ba3ea5, 0xff92f831, 0x000000ac, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff92f831, 0x000000ac, 0x05e1032c, 0x02096ae0, 0xfdc0fb67, 0x00000072,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02cd04ae, 0x02697adb, 0xff86f9ad, 0x0000044c, 0x02bc015b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a4cca49, 0xfd5cfd32, 0x00000502, 0x021801a2, 0x0beadaaa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0a129426, 0x01c8013c, 0x090f0a19, 0x06fe9448,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0177017e, 0x0c4a42d6, 0x0df1dfe9, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01c8013c, 0x090f0a19, 0xfda6fda0, 0x00000612, 0x02bc015b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a4cca49, 0x2f0edb92, 0x027d00b8, 0x3d10f606,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x03cc4c07, 0x034600a5, 0x33700229, 0x34ad5432,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x02cd04ae, 0x02697adb, 0xff86f9ad, 0x0000044c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x021801a2, 0x0beadaaa, 0xfe01fd58, 0x000005a3, 0x01a803d3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09193b1b, 0xff0efa49, 0x00000624, 0x0177017e, 0x0c4a42d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfe1dfd89, 0x000006f1, 0x00000002, 0x034600a5, 0x33700229,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfbc4fd6b, 0x00000488, 0x02bc015b, 0x0a4cca49, 0x07a663c7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x049e004b, 0x3a8aaa8e, 0xfb93fdfc, 0x000002f2, 0x05e1032c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x02096ae0, 0xfdc0fb67, 0x00000072, 0x00000002, 0x1cb00bd0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x027e0def, 0x020a0924, 0x000000db, 0x1a550ca9, 0x027c9dce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfff7080a, 0x0000fea0, 0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b850de3, 0x0d3efdce, 0x0114088a, 0x0000fd34, 0x1c380f8d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10db493a, 0x03d60b09, 0x0000fc85, 0x1bab0e46, 0x1550a57b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_XY, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x012a08d3, 0x1c230f15, 0x1a6dd0fd, 0x3ce60177,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b680eec, 0x1e1fb0ad, 0x3e885c21, 0x1bcf0f8e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1cb0acdf, 0x34b7b1ea, 0x1b560f5c, 0x18e4c864,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x00250b9e, 0x0000fb9f, 0x1b880f9b, 0x19f44383, 0x3442ed67,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b370f7b, 0x15d5d02f, 0x132c9efa, 0x1b8a0fb5,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18a2e2f2, 0x3445217b, 0x1b650fba, 0x166c8121,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x035b97e7, 0x1bb50fde, 0x19705936, 0x03580eb4, 0x0000fb4a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b9f0fde, 0x0b0dedce, 0x39fab825, 0x1bbd0fe8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02a33dd2, 0x04150ee3, 0x0000fac7, 0x1b9e0fea, 0x29de3d5f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x368833ea, 0x1bbd0ff3, 0x26433cde, 0x3e90443a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1ba31001, 0x201fe3dd, 0x3dda8b53, 0x1bc81023,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23626755, 0x06454a6e, 0x1b3c0ff8, 0x23ec3fda,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00180c66, 0x0000fa98, 0x1aa3118e, 0x207ecc27, 0x01710907, 0x0000fbd7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19881041, 0x25ab93c9, 0x06982fc3, 0x183111a2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2afb64f8, 0x00590623, 0x0000fab6, 0x18460f71, 0x38184013,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfed80792, 0x0000fd43, 0x00000002, 0x192e1a0d, 0x01cc8a34,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00a2f765, 0x0000004f, 0x173417f8, 0x0c6df63a, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x16b81b6f, 0x11de9260, 0x3f8fffe0, 0x16d31a14,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d2efe32, 0x2fd54375, 0x163d1a6a, 0x111552f4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3ffb577e, 0x164b19df, 0x1ac28b1b, 0x34e37fa7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16171a1a, 0x15846b02, 0x014ccffa, 0x15ec19a5,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1fb353, 0x3a531b00, 0x1588197a, 0x18e4cb9c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x365d92cd, 0x159f18ff, 0x1cb0af21, 0x02adf3ab, 0x0000fb53,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x156e1932, 0x19f4407d, 0x35c8cf50, 0x156d1904,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18d0fd3d, 0x3d55cb3d, 0x15641900, 0x37d061ee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x06806bff, 0x157618e9, 0x1d4d4c72, 0x3a04686b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x156818e2, 0x1bbd24b4, 0x09706bb1, 0x157918cf,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6ba3b3, 0x00f20cc8, 0x156918b8, 0x1bf1f728,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x05e3f3e1, 0x15d618aa, 0x124b9ac8, 0x0c1addfb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16021834, 0x1b2f16f7, 0x0c10a88f, 0x173417f8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0c6df63a, 0x082cf116, 0x16931756, 0x0b03ba5f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3e725801, 0x00000002, 0x156d1904, 0x18d0fd3d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0252f238, 0x0000fa84, 0x159f18ff, 0x1cb0af21, 0x0cf16d73,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x157618e9, 0x1d4d4c72, 0x339366f7, 0x15a918d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x192ceb08, 0x0b50b18e, 0x157918cf, 0x1a6ba3b3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f11c6eb, 0x15d618aa, 0x124b9ac8, 0x11fecddc,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x173417f8, 0x0c6df63a, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x15d618aa, 0x124b9ac8, 0x2bd26a5b, 0x16d31a14,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0d2efe32, 0x0114f776, 0x0000fd01, 0x169519c3, 0x1550a685,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x35105bb7, 0x164b19df, 0x1ac28b1b, 0x3fce7b6e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x15ec19a5, 0x1e1fb353, 0x3b9fe6fa, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1aa3118e, 0x207ecc27, 0x01710907, 0x0000fbd7, 0x1c3b1193,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21c2285d, 0x00d71c26, 0x1bc81023, 0x23626755,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04250c3a, 0x0000fa74, 0x1c291027, 0x34e6b728, 0x15434ee2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x1bd50ff8, 0x30e6d86b, 0x3eb05436, 0x1be30ff1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a573099, 0x0a8063c0, 0x1bbd0fe8, 0x02a33dd2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x35dacd98, 0x1bef0fe4, 0x1bf1f4d7, 0x0fc42a21,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bb50fde, 0x19705936, 0x3878e5b0, 0x1bc90fce,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bbd274c, 0x00c122f9, 0x1b8a0fb5, 0x18a2e2f2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x014f0d7a, 0x0000fb59, 0x1bac0fc0, 0x37d06212, 0x3c64744f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b880f9b, 0x19f44383, 0x3c49d33c, 0x1baf0fb6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18d0fec3, 0x3d45c8c3, 0x1bcf0f8e, 0x1cb0acdf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0cf16e8d, 0x1bcb0fbc, 0x1d4d4f8e, 0x33936509,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bf60f9a, 0x192ce8f8, 0x0b50b272, 0x1be30fc9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6ba04d, 0x3f11c515, 0x1c380f8d, 0x10db493a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x120ece24, 0x1bef0fe4, 0x1bf1f4d7, 0x33e525fb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x1c580ff6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x14f60c0b, 0x2f86b1b0, 0x1dd10fb6, 0x0b635dac,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0f1b8244, 0x1d481108, 0x35a67cfa, 0x2e602bc3,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1bef0fe4, 0x1bf1f4d7, 0x051f0d04, 0x0000fbc3,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1be30ff1, 0x0a573099, 0x3a710c47, 0x1c580ff6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x14f60c0b, 0x04eb0b1a, 0x0000fcc3, 0x1c291027, 0x34e6b728,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x30503402, 0x1d481108, 0x35a67cfa, 0x0d2b7605,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x1c3b1193, 0x21c2285d, 0x34ad8c0c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1bef0fe4, 0x1bf1f4d7, 0x051f0d04, 0x0000fbc3, 0x1be30fc9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6ba04d, 0x3a2c13e1, 0x1bc90fce, 0x1bbd274c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f1df4c8, 0x1bcb0fbc, 0x1d4d4f8e, 0x369f9bb1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bac0fc0, 0x37d06212, 0x060b986b, 0x1baf0fb6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x18d0fec3, 0x398f9bff, 0x00000002, 0x1bc81023,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23626755, 0x04250c3a, 0x0000fa74, 0x1bd50ff8, 0x30e6d86b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04e49551, 0x1bbd0ff3, 0x26433cde, 0x371b9cee,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x1bbd0fe8, 0x02a33dd2, 0x094f906a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1c380f8d, 0x10db493a, 0x03d60b09, 0x0000fc85, 0x1c230f15,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6dd0fd, 0x3ceb5341, 0x1bf60f9a, 0x192ce8f8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x32142186, 0x1bcf0f8e, 0x1cb0acdf, 0x012bec85,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1ba31001, 0x201fe3dd, 0x02d30dcc, 0x0000fa10,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b9e0fea, 0x29de3d5f, 0x01fd3901, 0x1b3c0ff8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1b700fd9, 0x35ea6547,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02f0f984, 0x1ac90fb3, 0x34a89841, 0xfeee0b36, 0x0000fbd1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b650fba, 0x166c8121, 0x00340d61, 0x0000fb8e, 0x1a9f0f40,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x110a54ee, 0xfee90aad, 0x0000fd1b, 0x1b370f7b, 0x15d5d02f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x2fa47952, 0x1a770e9f, 0x1933b4d1, 0xff8209b1, 0x0000fde2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b560f5c, 0x18e4c864, 0x00250b9e, 0x0000fb9f, 0x1b180e86,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x158468fe, 0xfffb096b, 0x0000fc95, 0x1b680eec, 0x1e1fb0ad,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3a631900, 0x1b680e79, 0x1ac288e5, 0x04601efa,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bab0e46, 0x1550a57b, 0x00418b6e, 0x1b850de3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0d3efdce, 0x0affabb7, 0x00000002, 0x1b3c0ff8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1ac90fb3, 0x34a89841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x139b5ad0, 0x19881041, 0x25ab93c9, 0x3f1ff823,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x18460f71, 0x38184013, 0x103d72c8, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b650fba, 0x166c8121, 0x00340d61, 0x0000fb8e, 0x1b700fd9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x35ea6547, 0x33908889, 0x1b9f0fde, 0x0b0dedce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0226c0ef, 0x1b9e0fea, 0x29de3d5f, 0x34606ff4,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1ac90fb3, 0x34a89841, 0xfeee0b36, 0x0000fbd1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1a9f0f40, 0x110a54ee, 0x14afef77, 0x18460f71,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x38184013, 0xfed80792, 0x0000fd43, 0x19db0e78, 0x181aec59,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0f9fb952, 0x188e0d68, 0x06b8acaf, 0x00107e7a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1a410d73, 0x1860314b, 0x3df334c8, 0x1a550ca9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x027c9dce, 0x084117e4, 0x1b850de3, 0x0d3efdce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x29447480, 0x00000002, 0x1a9f0f40, 0x110a54ee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfee90aad, 0x0000fd1b, 0x1a770e9f, 0x1933b4d1, 0x0c726704,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19db0e78, 0x181aec59, 0x05ad1333, 0x1a410d73,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1860314b, 0x3e03b342, 0x00000002, 0x12010893,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06ef1df1, 0x033c0942, 0x000005e9, 0x13130955, 0x1b6e0cea,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x18e412c7, 0x13730743, 0x161c3d19, 0x009f071e, 0x000006b7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x13d6084d, 0x1e9eb47d, 0x0ce7cb8f, 0x151806e9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x185bc8c2, 0xffdc04b4, 0x00000791, 0x1505077a, 0x1def1cae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x09040410, 0x1691074d, 0x1faefc2a, 0x00b50272, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x165407b1, 0x1fffe818, 0x03125c16, 0x16d708fb,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f3ea04b, 0x03880165, 0x000008b4, 0x16a60898, 0x1ec0088c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f8d2484, 0x16170968, 0x1fbf6c3f, 0x3e1584f0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x167408e0, 0x3f4c01bb, 0x3e9c7356, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x151806e9, 0x185bc8c2, 0xffdc04b4, 0x00000791, 0x1691074d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1faefc2a, 0x00b50272, 0x0000086f, 0x16fb0618, 0x1eee9465,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04490b1f, 0x181f0786, 0x1fffb803, 0x01150002, 0x00000842,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x167408e0, 0x3f4c01bb, 0x034e022f, 0x00000876,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16a60898, 0x1ec0088c, 0x036e0fba, 0x166107f7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1112c58b, 0x3c9bc883, 0x165407b1, 0x1fffe818,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02be241c, 0x162407bf, 0x19c404a2, 0x3cf07450,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x15840792, 0x17f4d090, 0x3d4ec90c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x12010893, 0x06ef1df1, 0x033c0942, 0x000005e9, 0x12b80992,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1601ed5f, 0x14f5c749, 0x13130955, 0x1b6e0cea,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x03fe4f7e, 0x138b09bc, 0x1e1f5cab, 0x08d27f1e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x13e80956, 0x1e9e1c5d, 0x39fd6359, 0x155109eb,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f7f5c55, 0x05330424, 0x00000854, 0x14140907, 0x1e3f34a1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x03c7065d, 0x000007ba, 0x1507098e, 0x1e5f309a, 0x0c12e658,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x14ee0961, 0x15fa2ff8, 0x3c6f2820, 0x15480983,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x09a8600a, 0x0250b35e, 0x00000002, 0x13130955,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b6e0cea, 0x01e04420, 0x13e80956, 0x1e9e1c5d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02cfde77, 0x13d6084d, 0x1e9eb47d, 0x3e29682d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x14140907, 0x1e3f34a1, 0x0354dbb0, 0x14200895,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fcf1fed, 0x3d2c77d2, 0x143408ed, 0x1e3d63ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01327fda, 0x00000002, 0x14200895, 0x1fcf1fed,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02e4062f, 0x0000078c, 0x14390845, 0x1f816405, 0x006dc3d5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x13d6084d, 0x1e9eb47d, 0x3f30f4a9, 0x14a407d7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1115b717, 0x03cbcab4, 0x1505077a, 0x1def1cae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x060d6b63, 0x150a0799, 0x1c338859, 0x3e111bea,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x15840792, 0x17f4d090, 0x041fe336, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x12b80992, 0x1601ed5f, 0x04ad088b, 0x00000738, 0x158e0b5b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x16f464db, 0x078c039e, 0x000008c4, 0x138b09bc, 0x1e1f5cab,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04df0727, 0x00000804, 0x15ea0aec, 0x1f31b823, 0x07130303, 0x0000093a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x155109eb, 0x1f7f5c55, 0x31a88121, 0x162609db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1eae8c71, 0x049f0e88, 0x1507098e, 0x1e5f309a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02204813, 0x15d0098d, 0x1fef5818, 0x014fe298,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x15480983, 0x09a8600a, 0x3d7ff8e6, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x15d0098d, 0x1fef5818, 0x0220480d, 0x162609db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1eae8c71, 0x00e1fb5f, 0x16170968, 0x1fbf6c3f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f0cf02d, 0x16d708fb, 0x1f3ea04b, 0x027d5a8c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x15ea0aec, 0x1f31b823, 0x07130303, 0x0000093a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x175709fd, 0x1fe05bdd, 0x04be010a, 0x00000929, 0x162609db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1eae8c71, 0x3740e1a2, 0x16d708fb, 0x1f3ea04b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x017a4ab9, 0x00000002, 0x175709fd, 0x1fe05bdd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04be010a, 0x00000929, 0x181f0786, 0x1fffb803, 0x01150002, 0x00000842,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16d708fb, 0x1f3ea04b, 0x03880165, 0x000008b4, 0x1691074d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1faefc2a, 0x00b50272, 0x0000086f, 0x00000002, 0x1dbe0994,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x01a04fdc, 0x1e070894, 0x06ef1e0f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3729e7c5, 0x1d500992, 0x1601eea1, 0x14f5c4b7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1cf40956, 0x1b6e0f16, 0x03fe4c82, 0x1c7d09bc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1e1f5f55, 0x08d27ce2, 0x00000002, 0x1dbe0994,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x01a04fdc, 0x1d500992, 0x1601eea1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0c1fa87c, 0x1c320ac7, 0x0156def9, 0x062ef9d4, 0x00000778,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a790b5b, 0x17a48342, 0x078cfc62, 0x000008c4, 0x1a540bae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a678fdd, 0x3ab25c67, 0x19cb0ae2, 0x1f516436,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0dba64d9, 0x198e0b63, 0x0cd5613f, 0x3742b07a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x18300a3a, 0x0f8674ae, 0x04c5ffba, 0x0000089e, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1d500992, 0x1601eea1, 0x04adf775, 0x00000738, 0x1c7d09bc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1f5f55, 0x0cc0c964, 0x1a790b5b, 0x17a48342,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x078cfc62, 0x000008c4, 0x1a5f0ad9, 0x1ec1efb7, 0x068ddc68,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19cb0ae2, 0x1f516436, 0x01eee4d8, 0x18e6094e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f3e9bb7, 0x03b4fea3, 0x000008bd, 0x18110988, 0x1fff8fed,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x05511145, 0x00000002, 0x11aa1117, 0x39fa8568,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfb930204, 0x000002f2, 0x11bb1019, 0x2f795461, 0x3fdcf282,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e67115b, 0x3ae928fd, 0xfc850313, 0x0000fe2a, 0x0e190ff0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3678642f, 0xfbdc00a3, 0x0000fd17, 0x0c36116c, 0x315a10fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfe1d03b4, 0x0000faa9, 0x0c4d1069, 0x2e09cc92, 0x363de22b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0b141183, 0x28ac2cf9, 0xffd60438, 0x0000f94a, 0x0af81054,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24cc8094, 0xffdf01e0, 0x0000f81e, 0x099f10a1, 0x220f64ae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02d802cf, 0x0000f7a7, 0x0ad70f82, 0x229cdc00, 0x00140000, 0x0000f79b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_YZ, FIFO_TEX_COORD),
+	0x098c0f7a, 0x200fd7fc, 0xf7080359, 0x09aa0e53,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x220f4355, 0x02d8fd31, 0x0000f7a7, 0x00000002, 0x11bb1019,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2f795461, 0xfacf0086, 0x000002ef, 0x11bf0efd, 0x30097f6a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01307e86, 0x0e190ff0, 0x3678642f, 0xfbdc00a3, 0x0000fd17,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e630e1f, 0x39d8e32e, 0xfc36fd6b, 0x0000fe02, 0x0c590eae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2e29bf75, 0xfd95fe21, 0x0000fa0c, 0x0c510da8, 0x312a1f04,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x09d2222b, 0x0b2e0d80, 0x28bc2f06, 0x2a16eb7c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0b400c39, 0x2adb4f13, 0x1641d630, 0x09fe0cc4,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x259e02fd, 0x2a27344e, 0x00000002, 0x11bf0efd,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x30097f6a, 0xfaeeff0c, 0x00000302, 0x11c00e54, 0x3a8aaa8e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3f0296f0, 0x0e630e1f, 0x39d8e32e, 0xfc36fd6b, 0x0000fe02,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0fcc0c93, 0x02096ae0, 0xfdc0fb67, 0x00000072, 0x0d150c18,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x00000002, 0x11aa1117,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39fa8568, 0xfb930204, 0x000002f2, 0x0e67115b, 0x3ae928fd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfc850313, 0x0000fe2a, 0x0f7f12c5, 0x0259651e, 0xfdec04d2, 0x00000065,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0ce612f6, 0x372930e3, 0xfe8c0572, 0x0000fceb, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e67115b, 0x3ae928fd, 0xfc850313, 0x0000fe2a, 0x0c36116c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x315a10fa, 0xfe1d03b4, 0x0000faa9, 0x0ce612f6, 0x372930e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfe8c0572, 0x0000fceb, 0x0b1a12d7, 0x2afb64f8, 0x00590623, 0x0000fab6,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x0b400c39, 0x2adb4f13, 0x004cf9f8, 0x0000faae,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c510da8, 0x312a1f04, 0xfe1dfc4c, 0x0000faa9, 0x0d150c18,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x0e630e1f, 0x39d8e32e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfc36fd6b, 0x0000fe02, 0x00000002, 0x099f10a1, 0x220f64ae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02d802cf, 0x0000f7a7, 0x09e2122e, 0x25fdf10a, 0x021905ba, 0x0000f950,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0b141183, 0x28ac2cf9, 0xffd60438, 0x0000f94a, 0x0b1a12d7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2afb64f8, 0x16c20deb, 0x0c36116c, 0x315a10fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfe1d03b4, 0x0000faa9, 0x00000002, 0x09fe0cc4, 0x259e02fd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0219fa46, 0x0000f950, 0x09aa0e53, 0x220f4355, 0x02d8fd31, 0x0000f7a7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0b2e0d80, 0x28bc2f06, 0xffd7fbc8, 0x0000f94a, 0x0b030eb2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24cc836c, 0xffdffe20, 0x0000f81e, 0x0c590eae, 0x2e29bf75,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfd95fe21, 0x0000fa0c, 0x0c330f8b, 0x2bb9d7fd, 0x387fd5df,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e190ff0, 0x3678642f, 0xfbdc00a3, 0x0000fd17, 0x0c4d1069,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x2e09cc92, 0xfd9501df, 0x0000fa0c, 0x00000002, 0xfd9501df, 0x0000fa0c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0c330f8b, 0x2bb9d7fd, 0x387fd621, 0x0af81054,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24cc8094, 0xffdf01e0, 0x0000f81e, 0x0ad70f82, 0x229cdc00,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37d0d620, 0x00000002, 0x0c330f8b, 0x2bb9d7fd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfd8a0000, 0x0000f993, 0x0b030eb2, 0x24cc836c, 0xffdffe20, 0x0000f81e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0ad70f82, 0x229cdc00, 0x37d0d5e0, 0x09aa0e53,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x220f4355, 0x02d8fd31, 0x0000f7a7, 0x00000002, 0x06bc10bd,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2f969082, 0x09680375, 0x0000fb34, 0x06dd0f71, 0x2f76d80e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x09960000, 0x0000fa81, 0x05f50ef0, 0x3847bfdd, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06c20e22, 0x2f266f73, 0x0968fc8b, 0x0000fb34, 0x061f0d37,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37d6d315, 0x0979fa5e, 0x0000fcfe, 0x07360cd7, 0x2c0486ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0762f954, 0x0000faf2, 0x00000002, 0x06bc10bd, 0x2f969082,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x09680375, 0x0000fb34, 0x07b11086, 0x277478a0, 0x079402e7, 0x0000f90a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06dd0f71, 0x2f76d80e, 0x09960000, 0x0000fa81, 0x07bf0f3b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2724ffd3, 0x20993f60, 0x06c20e22, 0x2f266f73,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0968fc8b, 0x0000fb34, 0x07360cd7, 0x2c0486ec, 0x0762f954, 0x0000faf2,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x129a0f27, 0x2ed5e0d5, 0x07befd71, 0x00000754,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12f410ce, 0x07d6e4e5, 0x01c057fc, 0x13a20f70,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2e466478, 0x05fcfcc5, 0x0000066a, 0x13ce0fa3, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x30309f4c, 0x14d70e5d, 0x3c57b784, 0x3dceaa4c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x05cdfa5d, 0x00000549, 0x142b0e07, 0x3376ff6c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x14320c14, 0x13a20f70, 0x2e466478, 0x05fcfcc5, 0x0000066a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x12e50ea0, 0x2e066792, 0x0c06f37a, 0x129a0f27,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x2ed5e0d5, 0x02a01932, 0x00000002, 0x15641900,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37d061ee, 0x026cf237, 0x0000faec, 0x156818e2, 0x1bbd24b4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0374d01c, 0x155a1922, 0x18a2e10e, 0x014ff286, 0x0000fb26,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x155118e9, 0x19705aca, 0x0358f14c, 0x0000fb17, 0x1544193e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x166c82df, 0x0034f29f, 0x0000fb5b, 0x154418fb, 0x0b0dee32,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x35a74a88, 0x15301924, 0x35ea66b9, 0x3df940ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x153a18f7, 0x29de3ea1, 0x36872f1d, 0x14fb193f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23ec3c25, 0x0018f39a, 0x0000fa65, 0x152a18e5, 0x201fe023,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02d3f234, 0x0000f9dd, 0x152218b5, 0x236264ab, 0x06354992,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x154318d8, 0x26433f22, 0x3e8047c6, 0x154c18c1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x30e6db95, 0x08f464ee, 0x154c18de, 0x02a33e2e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x006b2ea8, 0x155818ba, 0x0a573367, 0x0a353598,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x156918b8, 0x1bf1f728, 0x059ef447, 0x15931858,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x13c64fff, 0x100f31ea, 0x16021834, 0x1b2f16f7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x082c54a0, 0x16931756, 0x0b03ba5f, 0x069f4917,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x15641900, 0x37d061ee, 0x026cf237, 0x0000faec,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x155a1922, 0x18a2e10e, 0x03ab8c4f, 0x156e1932,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19f4407d, 0x389e4475, 0x155f1983, 0x15d5d3d1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x132c9d06, 0x1588197a, 0x18e4cb9c, 0x38b07861,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15b11a92, 0x1903af27, 0xff82f64f, 0x0000fdae, 0x16171a1a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15846b02, 0x2b41e446, 0x163d1a6a, 0x111552f4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09efb85f, 0x00000002, 0x155a1922, 0x18a2e10e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x014ff286, 0x0000fb26, 0x1544193e, 0x166c82df, 0x035b9419,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x155f1983, 0x15d5d3d1, 0x086f4d62, 0x15401a1e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x110a5b11, 0x106b8952, 0x15b11a92, 0x1903af27,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0c7264fc, 0x15821b26, 0x178acba0, 0x05ad10cd,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16b81b6f, 0x11de9260, 0x3fc3f8e5, 0x15b91cbc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0698a358, 0x005c98a5, 0x00000002, 0x16931756,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0b03ba5f, 0x03d2f69d, 0x0000fd7b, 0x153816ff, 0x3566830a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2eb00c42, 0x15931858, 0x13c64fff, 0x02a45a07,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x15521864, 0x34e6b0d8, 0x304037fe, 0x155818ba,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a573367, 0x0562f2b5, 0x0000fb37, 0x154c18c1, 0x30e6db95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x357fa3c0, 0x00000002, 0x3ea057ca, 0x15521864,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x34e6b0d8, 0x04f8f4e4, 0x0000fb94, 0x152218b5, 0x236264ab,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x2accb6e2, 0x14321791, 0x21a233b2, 0x0334f6cf, 0x0000fbad,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x136018e5, 0x207ebff0, 0x3f389820, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15b91cbc, 0x0698a358, 0xfeeaf8a6, 0x0000fe09, 0x15821b26,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x178acba0, 0x3fff7276, 0x14041bdd, 0x38483ff6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x30303d25, 0x15401a1e, 0x110a5b11, 0xfee9f553, 0x0000fce7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x14f819c1, 0x34a89bbf, 0x2b701777, 0x1544193e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x166c82df, 0x0034f29f, 0x0000fb5b, 0x15301924, 0x35ea66b9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x33908b77, 0x00000002, 0x156818e2, 0x1bbd24b4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x03a0f253, 0x0000fb23, 0x156918b8, 0x1bf1f728, 0x06d5fca9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x155118e9, 0x19705aca, 0x3878e650, 0x154c18de,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02a33e2e, 0x37d2f7d1, 0x154418fb, 0x0b0dee32,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0206f127, 0x0000fab5, 0x153a18f7, 0x29de3ea1, 0x34706c0c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x14041bdd, 0x38483ff6, 0xfed5f841, 0x0000fd0b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14f819c1, 0x34a89bbf, 0xfeeef4ca, 0x0000fb9e, 0x13a31a91,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x25eb6824, 0xff89f770, 0x0000fc16, 0x14fb193f, 0x23ec3c25,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0018f39a, 0x0000fa65, 0x136018e5, 0x207ebff0, 0x015af6ef, 0x0000fba0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x152218b5, 0x236264ab, 0x0425f3c6, 0x0000fa40, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x154c18de, 0x02a33e2e, 0x0415f11d, 0x0000fa94, 0x154318d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x26433f22, 0x36b0706a, 0x153a18f7, 0x29de3ea1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0221f133, 0x0000f9fc, 0x152a18e5, 0x201fe023, 0x3e12c901,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1b850de3, 0x0d3efdce, 0x0114088a, 0x0000fd34,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1a410d73, 0x1860314b, 0x0e8a7b9c, 0x1ae70e39,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1185410a, 0x3170dce6, 0x1a770e9f, 0x1933b4d1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0afe64a5, 0x1b180e86, 0x158468fe, 0x2b31e7ba,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1b850de3, 0x0d3efdce, 0x0114088a, 0x0000fd34,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1ae70e39, 0x1185410a, 0x3ffb5482, 0x1b680e79,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ac288e5, 0x34e37c59, 0x1b180e86, 0x158468fe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x014ccc06, 0x00000002, 0x169519c3, 0x1550a685,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x012af72d, 0x0000fc52, 0x15d618aa, 0x124b9ac8, 0x03d6f4f7, 0x0000fc51,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x162b18fa, 0x1a6dd303, 0x3cfb50bf, 0x15a918d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x192ceb08, 0x3214227a, 0x159f18ff, 0x1cb0af21,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x012bef7b, 0x00000002, 0x02adf3ab, 0x0000fb53, 0x15ec19a5,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1fb353, 0x0b4851ea, 0x162b18fa, 0x1a6dd303,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0197a421, 0x169519c3, 0x1550a685, 0x032a0177,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x0c381aa8, 0x102dda5c, 0x01aaf970, 0x00000663,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0b8f1b50, 0x0f9b5ab3, 0x01fc689a, 0x0c6f1bbd,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12aca69b, 0x1132a836, 0x0b341c36, 0x0fda0b1b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x31dafcb8, 0x0c0e1ce5, 0x1339df8b, 0x12d164bb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0b341d32, 0x0f7907dc, 0x308dbc5d, 0x0b911e1b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x10995c6b, 0x02f0e118, 0x00000002, 0x0c381aa8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x102dda5c, 0x01aaf970, 0x00000663, 0x0c6f1bbd, 0x12aca69b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x132f10d0, 0x0d0f1a4e, 0x108fce49, 0x2c452ef5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0d971b4c, 0x12a11e66, 0x1341d4b8, 0x0dfe1a4a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10327e64, 0x2d628383, 0x0ee11aa1, 0x10942ea5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01f3b89a, 0x00000002, 0x0d1f060b, 0x0f9b594d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x01a00c18, 0x0dc1054f, 0x12aca565, 0x1132abca,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0c70055b, 0x0fda08e5, 0x31daff48, 0x0cf30466,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1339dc75, 0x12d16745, 0x0c0d0474, 0x0f790424,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x308dbfa3, 0x0c070379, 0x10995f95, 0x02f0e2e8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x0d1f060b, 0x0f9b594d, 0x01a00c18,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0dfd0663, 0x102dd9a4, 0x3e13989a, 0x0dc1054f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12aca565, 0x132f1330, 0x0ee60661, 0x108fcdb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2c452d0b, 0x0eff0542, 0x12a11d9a, 0x1341d748,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0fc20607, 0x10327d9c, 0x2d62807d, 0x1071055d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x10942d5b, 0x01f3bb66, 0x00000002, 0x0cf30466,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1339dc75, 0x0086044d, 0x000007df, 0x0dc1054f, 0x12aca565,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3b63a173, 0x0e1c0463, 0x185db52a, 0x11d24f39,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0eff0542, 0x12a11d9a, 0x2db4b51a, 0x0ebc0457,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18614941, 0x12000b07, 0x0fd5046f, 0x1304f508,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x31157c0c, 0x0f0103ec, 0x18f3c0d6, 0x111d3b59,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0fc7033c, 0x148623e0, 0x34040f02, 0x0ef5039c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b44143e, 0x0f6c2c6b, 0x0ef7026a, 0x15d38ed6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x33e02634, 0x0ec1034d, 0x1bf37f8f, 0x0dfedd16,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0e450327, 0x1c105f0a, 0x3eec8b83, 0x0df2036e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d3d5f85, 0x01ac7465, 0x0dc70268, 0x15bebe91,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x31616ea8, 0x0cfe033a, 0x14aaa744, 0x3eba88e5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0d0301d8, 0x12ad168c, 0x32330ea5, 0x0c5b028f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x118b16dd, 0x3edc689a, 0x00000002, 0x0d0301d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12ad168c, 0x01aa0150, 0x0000074e, 0x0dc70268, 0x15bebe91,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0f226c76, 0x0de90176, 0x13304267, 0x3141d352,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0ef7026a, 0x15d38ed6, 0x0ef4ed08, 0x0ee1017b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12e26a81, 0x30bf6b30, 0x0fc501de, 0x12951efe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ed3b89a, 0x00000002, 0x0c5b028f, 0x118b16dd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x00c401ea, 0x0000073b, 0x0c070379, 0x10995f95, 0x3dbda4ee,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0cfe033a, 0x14aaa744, 0x1152ebd3, 0x0cf30466,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1339dc75, 0x3b4e7da2, 0x0dd203f3, 0x1b2c186d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x11d447ca, 0x0e1c0463, 0x185db52a, 0x3b61a8e2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0e6a03e1, 0x1ee00487, 0x0752e741, 0x0ebc0457,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18614941, 0x3861d8e0, 0x0f0103ec, 0x18f3c0d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0222b765, 0x00000002, 0x0cfe033a, 0x14aaa744,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x00e702ab, 0x0000082b, 0x0dd203f3, 0x1b2c186d, 0x0d12c16c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0df2036e, 0x1d3d5f85, 0x02e14f07, 0x0e6a03e1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ee00487, 0x3fd3411c, 0x0ec1034d, 0x1bf37f8f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3fb3c6fc, 0x0ef5039c, 0x1b44143e, 0x3e3100b6,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x0ef7026a, 0x15d38ed6, 0x03f40220, 0x00000843,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0fc7033c, 0x148623e0, 0x3cc3b161, 0x0fc501de,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12951efe, 0x32cf7269, 0x10700292, 0x11a65b7c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x3db268ee, 0x00000002, 0x055602d8, 0x00000716, 0x0fc7033c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x148623e0, 0x0f9e28a9, 0x10ce037b, 0x1146a448,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2d82b86f, 0x0fd5046f, 0x1304f508, 0x0d7c0536,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x10ce0477, 0x10a610ca, 0x2f431fe2, 0x1071055d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x10942d5b, 0x3d0d98ee, 0x00000002, 0x0c6f1bbd,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12aca69b, 0x016efa40, 0x00000795, 0x0c0e1ce5, 0x1339df8b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04ac6173, 0x0d1f1c72, 0x185db6d6, 0x0d35ef54,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0d071cf7, 0x1b2c1b93, 0x04ae58e2, 0x0d9a1ccb,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ee00779, 0x02b48fdd, 0x0d591d64, 0x1d3d5c7b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x003cc11c, 0x0e241d30, 0x1bf37c71, 0x3f8707e8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0dc11d84, 0x1c105cf6, 0x3eec887d, 0x0eaf1df7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15d38d2a, 0x33349c99, 0x0d991e66, 0x15bebd6f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3fd9445a, 0x0e171f36, 0x13304199, 0x3141d0ae,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0d1e1f37, 0x12ad1574, 0x3fabc7c8, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c6f1bbd, 0x12aca69b, 0x016efa40, 0x00000795, 0x0d1f1c72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x185db6d6, 0x11d24cc7, 0x0d971b4c, 0x12a11e66,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2db4b6e6, 0x0db71c3e, 0x18614abf, 0x120008f9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0eaf1bb9, 0x1304f6f8, 0x31157ff4, 0x0e211c86,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x18f3c32a, 0x111d38a7, 0x0f1c1cd8, 0x14862020,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x34040cfe, 0x0e341cd3, 0x1b4417c2, 0x0f6c2f95,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0eaf1df7, 0x15d38d2a, 0x33e025cc, 0x0e241d30,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1bf37c71, 0x0dfedeea, 0x00000002, 0x0d971b4c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12a11e66, 0x032ef9ed, 0x0000078d, 0x0eaf1bb9, 0x1304f6f8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x031584ed, 0x0ee11aa1, 0x10942ea5, 0x2c40b730,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0f911b50, 0x10a61336, 0x030268ee, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e241d30, 0x1bf37c71, 0x03abfcca, 0x00000922, 0x0e341cd3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b4417c2, 0x3e31034a, 0x0d9a1ccb, 0x1ee00779,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x022b3fb2, 0x0e211c86, 0x18f3c32a, 0x3a848fbb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0db71c3e, 0x18614abf, 0x3ded4f65, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0dc11d84, 0x1c105cf6, 0x02402ff5, 0x0d591d64,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d3d5c7b, 0x01ac779b, 0x0d991e66, 0x15bebd6f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x31616d58, 0x0c8e1df4, 0x14aaa4bc, 0x3eba8b1b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0d1e1f37, 0x12ad1574, 0x32330d5b, 0x0c3b1ed2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x118b1523, 0x3edc6b66, 0x00000002, 0x00c4fe16, 0x0000073b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0c8e1df4, 0x14aaa4bc, 0x0f008f3f, 0x0b911e1b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10995c6b, 0x2ebd1bd3, 0x0c0e1ce5, 0x1339df8b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c91668b, 0x00000002, 0x0086fbb3, 0x000007df, 0x0c8e1df4,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x14aaa4bc, 0x04c185a2, 0x0d071cf7, 0x1b2c1b93,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0d12c294, 0x0d591d64, 0x1d3d5c7b, 0x02e14cf9,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x0e171f36, 0x13304199, 0x02b9fee8, 0x00000754,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0efa1ecf, 0x12e2697f, 0x3fa457c8, 0x0eaf1df7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15d38d2a, 0x0f509b30, 0x0fa41e1b, 0x12951d02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2f832036, 0x0f1c1cd8, 0x14862020, 0x0d409269,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0ffa1d32, 0x11a65884, 0x3071d8a9, 0x0ff51c37,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1146a7b8, 0x3d10e2e8, 0x00000002, 0x0f1c1cd8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x14862020, 0x04e0fc7f, 0x0000080f, 0x0ff51c37, 0x1146a7b8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2d82bb91, 0x0eaf1bb9, 0x1304f6f8, 0x0d7c06ca,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0f911b50, 0x10a61336, 0x2f431c1e, 0x00000000,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19a707f7, 0x1112c675, 0x01c3fd94, 0x00000875, 0x19e307bf,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19c4075e, 0x3fae9b94, 0x19b307b1, 0x1fefbbd4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x031f8c50, 0x1afd0799, 0x1c338ba7, 0x0123fb52, 0x00000802,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b03077a, 0x1ddf2750, 0x01feebea, 0x1a830792,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x17f4d370, 0x0220f8e0, 0x18cb04b8, 0x16dd6ac2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x021fd3fb, 0x19bb0315, 0x15c0aa8a, 0xfa3cfd29, 0x00000775,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x194a016c, 0x1b6e9b06, 0xf74afd57, 0x0000079b, 0x17770522,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x174f055a, 0xfd870151, 0x00000923, 0x173d04b8, 0x163d794b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x32cdcbea, 0x17190545, 0x101f8dba, 0x0192f839,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x157d165b, 0x04642daf, 0x01a04c24, 0x142b14af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3376fc94, 0x01a06416, 0x13e71559, 0x0156dd07,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0ecf789d, 0x0564094c, 0x02c06e03, 0x03e6f68d, 0x0000ffe0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x058d0b19, 0x02c4164a, 0x06bef756, 0x0000ff86, 0x072e0b8d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x34935253, 0x3f1067de, 0x00000000, 0x08170bf9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x299242b1, 0x291cd0c7, 0x09050ae7, 0x21a233b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0334f6cf, 0x0000fbad, 0x01710b9c, 0x3c57b784, 0x05cdfa5d, 0x00000549,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x02bc0ae8, 0x0d95eef4, 0x233f32cc, 0x02500982,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ce53e80, 0x0d4bca80, 0x02a51d56, 0x0a4ccdb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfd5c02ce, 0x00000502, 0x04881e6f, 0x39fa8568, 0xfb930204, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05f01b5e, 0x0259651e, 0xfdec04d2, 0x00000065, 0x14140907,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e3f34a1, 0x03c7065d, 0x000007ba, 0x14ee0961, 0x15fa2ff8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x08720e78, 0x143408ed, 0x1e3d63ec, 0x35ece534,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x165407b1, 0x1fffe818, 0x014c0288, 0x000008a0, 0x1505077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1def1cae, 0x00dd04c4, 0x00000821, 0x15840792, 0x17f4d090,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0220fb20, 0x18110988, 0x1fff8fed, 0x03f8ffe8, 0x00000912,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x18300a3a, 0x0f8674ae, 0x38c337d2, 0x19cb0ae2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f516436, 0x06bcfda2, 0x0000094a, 0x15b11a92, 0x1903af27,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xff82f64f, 0x0000fdae, 0x16b81b6f, 0x11de9260, 0x056109b2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x163d1a6a, 0x111552f4, 0x2fc096f3, 0x15521864,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x34e6b0d8, 0x04f8f4e4, 0x0000fb94, 0x153816ff, 0x3566830a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0d2b75fb, 0x14321791, 0x21a233b2, 0x347d7ff0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14f819c1, 0x34a89bbf, 0xfeeef4ca, 0x0000fb9e, 0x15301924,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x35ea66b9, 0x0056f216, 0x0000fa94, 0x14fb193f, 0x23ec3c25,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3d1f0984, 0x0ef7026a, 0x15d38ed6, 0x03f40220, 0x00000843,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0dc70268, 0x15bebe91, 0x3fd947a6, 0x0e450327,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1c105f0a, 0x0d0220f3, 0x0ef5039c, 0x1b44143e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f547933, 0x0e6a03e1, 0x1ee00487, 0x022b3c4e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0f0103ec, 0x18f3c0d6, 0x3a848c45, 0x0fd5046f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1304f508, 0x2ef2c8a7, 0x0eff0542, 0x12a11d9a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3cfa7ced, 0x1071055d, 0x10942d5b, 0x2f563be3,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0d1f1c72, 0x185db6d6, 0x023023ec, 0x0d9a1ccb,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ee00779, 0x0752e4bf, 0x0db71c3e, 0x18614abf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_NOP, FIFO_NOP, FIFO_NOP),
+	0x3861db20,
+};
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// Simplified from 766 triangles.
+// 400 triangles in 90 strips, 2726 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_LOD1_POLYGONS 400
+#define SUZANNE_LOD1_VERTICES 604
+#define SUZANNE_LOD1_CYCLES 11190
+
+const u32 suzanne_lod1_commands[] = {
+	2726,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x16690c17, 0x06ef1e0f, 0x033cf6be, 0x000005e9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x157d0c5d, 0x04642e51, 0x08e61c3b, 0x16260d17,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ce53e80, 0x048bf7a9, 0x00000450, 0x13ce0fa3, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0623fc11, 0x0000056d, 0x00000002, 0x195f1ba1, 0x090f0a19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfda6fda0, 0x00000612, 0x1a811b40, 0x33700229, 0x27687bcb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x198d1a6e, 0x04e18e10, 0x1dac3b46, 0x1a881819,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3afe7a10, 0xf642fc22, 0x00000583, 0x00000002, 0x00470ea8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x07d6e4e5, 0x01c057fc, 0x0047102f, 0x0766af00,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3f7055fc, 0x01430ce6, 0x0fb6b785, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x03440e92, 0x126683c9, 0x096afe2d, 0x00000324, 0x03b40d29,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10e5d31e, 0x0906fb4e, 0x0000025e, 0x04ab0d97, 0x06a75b52,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x21543847, 0x04ba0aa9, 0x0b73d265, 0x062cf76c, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06660bd7, 0x3a54fa7a, 0x0762f7e9, 0x0000fd57, 0x0564094c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02c06e03, 0x03e6f68d, 0x0000ffe0, 0x06b80996, 0x0c6df63a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x033cf69c, 0x0000fd94, 0x05d50703, 0x01cc8a34, 0x00a2f765, 0x0000004f,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x06b80996, 0x0c6df63a, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06660bd7, 0x3a54fa7a, 0x0762f7e9, 0x0000fd57, 0x09050ae7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21a233b2, 0x0334f6cf, 0x0000fbad, 0x07360cd7, 0x2c0486ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0762f954, 0x0000faf2, 0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x08af0e87, 0x23126766, 0x3df05bf6, 0x09aa0e53,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x220f4355, 0x02d8fd31, 0x0000f7a7, 0x098c0f7a, 0x200fd7fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_YZ),
+	0x03590000, 0x0000f708, 0x0ad70f82, 0x229cdc00, 0xf79b0014,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x099f10a1, 0x220f64ae, 0x02d802cf, 0x0000f7a7, 0x0b141183,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x28ac2cf9, 0xffd60438, 0x0000f94a, 0x09e2122e, 0x25fdf10a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x021905ba, 0x0000f950, 0x0b1a12d7, 0x2afb64f8, 0x16690069,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0a1b13d8, 0x207ecc27, 0x01710907, 0x0000fbd7, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07d71a49, 0x372930e3, 0xfe8c0572, 0x0000fceb, 0x0729191c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06b8acaf, 0x152165ec, 0x05f01b5e, 0x0259651e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdec04d2, 0x00000065, 0x02c31a00, 0x02297925, 0xff860653, 0x0000044c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02a51d56, 0x0a4ccdb7, 0xfd5c02ce, 0x00000502, 0x01b01d72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f09e7, 0x11012b92, 0x032d1e10, 0x336005d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x27687835, 0x00000002, 0x09050ae7, 0x21a233b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0334f6cf, 0x0000fbad, 0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0a3f0b6b, 0x207ebff0, 0x015af6ef, 0x0000fba0, 0x09aa0e53,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x220f4355, 0x02d8fd31, 0x0000f7a7, 0x0b2e0d80, 0x28bc2f06,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xffd7fbc8, 0x0000f94a, 0x0ad70f82, 0x229cdc00, 0x00140000, 0x0000f79b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_YZ, FIFO_TEX_COORD),
+	0x0c330f8b, 0x2bb9d7fd, 0xf993fd8a, 0x0b141183,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x28ac2cf9, 0xffd60438, 0x0000f94a, 0x0c36116c, 0x315a10fa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x15f91f7c, 0x0b1a12d7, 0x2afb64f8, 0x00590623, 0x0000fab6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0ce612f6, 0x372930e3, 0xfe8c0572, 0x0000fceb, 0x0c4713d1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x38184013, 0xfed80792, 0x0000fd43, 0x0d40142b, 0x06b8acaf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0fa037cc, 0x00000002, 0x0d6e0b05, 0x0698a358,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfeeaf8a6, 0x0000fe09, 0x0b630b4d, 0x25eb6824, 0x20d27eca,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d150c18, 0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x0b400c39,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2adb4f13, 0x004cf9f8, 0x0000faae, 0x0c510da8, 0x312a1f04,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfe1dfc4c, 0x0000faa9, 0x0b2e0d80, 0x28bc2f06, 0x2a16eb7c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0c330f8b, 0x2bb9d7fd, 0xfd8a0000, 0x0000f993, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0b630b4d, 0x25eb6824, 0xff89f770, 0x0000fc16, 0x0a3f0b6b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x207ebff0, 0x38a7477f, 0x0b400c39, 0x2adb4f13,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x004cf9f8, 0x0000faae, 0x0b2e0d80, 0x28bc2f06, 0x29ce2dd0,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x06d706b7, 0x11de9260, 0x3f8fffe0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x07990589, 0x0698a358, 0x005c98a5, 0x05d50703,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01cc8a34, 0x00a2f765, 0x0000004f, 0x02cd04ae, 0x02697adb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff86f9ad, 0x0000044c, 0x02fd072b, 0x005cbe2c, 0x01c9f770, 0x000003de,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01a803d3, 0x09193b1b, 0xff0efa49, 0x00000624, 0x01b50847,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x00000002, 0x033cf6be, 0x000005e9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x02500982, 0x3ce53e80, 0x26753ceb, 0x02fd072b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x005cbe2c, 0x01c9f770, 0x000003de, 0x0564094c, 0x02c06e03,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x03e6f68d, 0x0000ffe0, 0x05d50703, 0x01cc8a34, 0x00a2f765, 0x0000004f,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x01a803d3, 0x09193b1b, 0xff0efa49, 0x00000624,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x02cd04ae, 0x02697adb, 0x2281e364, 0x01c8013c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f0a19, 0xfda6fda0, 0x00000612, 0x02bc015b, 0x0a4cca49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2f0edb92, 0x034600a5, 0x33700229, 0x3869a039,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x049e004b, 0x3a8aaa8e, 0x26af3c91, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfb93fdfc, 0x000002f2, 0x02bc015b, 0x0a4cca49, 0xfd5cfd32, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05e1032c, 0x02096ae0, 0xfdc0fb67, 0x00000072, 0x02cd04ae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02697adb, 0xff86f9ad, 0x0000044c, 0x07990589, 0x0698a358,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfeeaf8a6, 0x0000fe09, 0x00000002, 0x06ac1801, 0x027c9dce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfff7080a, 0x0000fea0, 0x056316b6, 0x027e0def, 0x020a0924, 0x000000db,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0729191c, 0x06b8acaf, 0xfee5075e, 0x0000fe3d, 0x03001787,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x008cb5d2, 0x01c90890, 0x000003de, 0x02c31a00, 0x02297925,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff860653, 0x0000044c, 0x01ce1766, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x01981ad6, 0x091938e5, 0xff0e05b7, 0x00000624, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01ce1766, 0x040c91ca, 0x01e408dc, 0x0000055c, 0x03001787,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x008cb5d2, 0x282f97b4, 0x026f1547, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x048b0857, 0x00000450, 0x056316b6, 0x027e0def, 0x020a0924, 0x000000db,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x056c14d8, 0x033189f4, 0x00005025, 0x07251560,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x07261355, 0x343311b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x06210886, 0x0000fc2c, 0x08d7140b, 0x21c2285d, 0x0338092d, 0x0000fbe4,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07f512af, 0x2972b93f, 0x05d2077b, 0x0000faa9, 0x08dc1226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24e0e50a, 0x28e9c6a5, 0x07b11086, 0x277478a0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x079402e7, 0x0000f90a, 0x08a50fc2, 0x21e28440, 0x05cb00cf, 0x0000f75a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07bf0f3b, 0x2724ffd3, 0x07e5ff60, 0x0000f88a, 0x08af0e87,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23126766, 0x3df05bf6, 0x07360cd7, 0x2c0486ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0762f954, 0x0000faf2, 0x00000002, 0x08af0e87, 0x23126766,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3df05bf6, 0x08a50fc2, 0x21e28440, 0x05cb00cf, 0x0000f75a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x098c0f7a, 0x200fd7fc, 0x03590000, 0x0000f708, 0x099f10a1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x220f64ae, 0x02d802cf, 0x0000f7a7, 0x00000002, 0x08a50fc2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21e28440, 0x05cb00cf, 0x0000f75a, 0x08dc1226, 0x24e0e50a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x099f10a1, 0x220f64ae, 0x02d802cf, 0x0000f7a7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x09e2122e, 0x25fdf10a, 0x021905ba, 0x0000f950, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x08d7140b, 0x21c2285d, 0x0338092d, 0x0000fbe4, 0x0a1b13d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x207ecc27, 0x3f38e7da, 0x08dc1226, 0x24e0e50a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x09e2122e, 0x25fdf10a, 0x021905ba, 0x0000f950,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x199208e0, 0x3f4c0245, 0x034efdd1, 0x00000876,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19a707f7, 0x1112c675, 0x3ff9d7c3, 0x19f00968,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1faf6bbc, 0x0432fd27, 0x0000088d, 0x181f0786, 0x1fffb803,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01150002, 0x00000842, 0x18110988, 0x1fff8fed, 0x03f8ffe8, 0x00000912,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x165407b1, 0x1fffe818, 0x014c0288, 0x000008a0, 0x167408e0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3f4c01bb, 0x034e022f, 0x00000876, 0x166107f7, 0x1112c58b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x3ff9d43d, 0x00000002, 0x01c3026c, 0x00000875, 0x165407b1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fffe818, 0x02be241c, 0x162407bf, 0x19c404a2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3cf07450, 0x15840792, 0x17f4d090, 0x3d4ec90c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x167408e0, 0x3f4c01bb, 0x034e022f, 0x00000876,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16170968, 0x1fbf6c3f, 0x017390aa, 0x18110988,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fff8fed, 0x03f8ffe8, 0x00000912, 0x15d0098d, 0x1fef5818,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0220480d, 0x15ea0aec, 0x1f31b823, 0x07130303, 0x0000093a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x12b80992, 0x1601ed5f, 0x04ad088b, 0x00000738, 0x15b40bae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09b79c24, 0x08230337, 0x0000086f, 0x12490993, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01a04c24, 0x00000002, 0x15b40bae, 0x09b79c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x08230337, 0x0000086f, 0x16790b63, 0x0dc522ba, 0x04fd16ad,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x15ea0aec, 0x1f31b823, 0x07cead1f, 0x18110988,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1fff8fed, 0x03f8ffe8, 0x00000912, 0x00000002, 0x16790b63,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0dc522ba, 0x076801e4, 0x000008be, 0x18300a3a, 0x0f8674ae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04c5ffba, 0x0000089e, 0x18110988, 0x1fff8fed, 0x074ccc2e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19cb0ae2, 0x1f516436, 0x06bcfda2, 0x0000094a, 0x19f00968,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1faf6bbc, 0x0432fd27, 0x0000088d, 0x1a37098d, 0x1fef5be8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00211b8c, 0x00000002, 0x18300a3a, 0x0f8674ae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04c5ffba, 0x0000089e, 0x198e0b63, 0x0cd5613f, 0x0768fe1c, 0x000008be,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x19cb0ae2, 0x1f516436, 0x08cd5386, 0x1a540bae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a678fdd, 0x32559f27, 0x1c7d09bc, 0x1e1f5f55,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x04dff8d9, 0x00000804, 0x1d500992, 0x1601eea1, 0x334f3a9c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1be70895, 0x1fcf1c13, 0x02e4f9d1, 0x0000078c, 0x1bce0845,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1f8167fb, 0x006dc02b, 0x00000002, 0x1be70895,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fcf1c13, 0x02e4f9d1, 0x0000078c, 0x1bd408ed, 0x1e3d6014,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x01327c26, 0x1c7d09bc, 0x1e1f5f55, 0x065572e2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b190961, 0x15fa2c08, 0x044afb2b, 0x00000841, 0x1ac00983,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x09a863f6, 0x0250b0a2, 0x00000002, 0x1bce0845,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f8167fb, 0x0254f9fc, 0x00000792, 0x1d500992, 0x1601eea1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04adf775, 0x00000738, 0x1b6407d7, 0x1115b4e9, 0x0183fa9f, 0x000007c1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x1afd0799, 0x1c338ba7, 0x041e80b3, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a540bae, 0x0a678fdd, 0x0823fcc9, 0x0000086f, 0x1dbe0994,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x01a04fdc, 0x1d500992, 0x1601eea1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0c1fa87c, 0x1e070894, 0x06ef1e0f, 0x2b1a3f49,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1c940744, 0x161c3ee7, 0x009ff8e2, 0x000006b7, 0x1be70614,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09193b1b, 0x36d9bd67, 0x1a5604dc, 0x090f0a19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfda6fda0, 0x00000612, 0x00000002, 0x1d500992, 0x1601eea1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04adf775, 0x00000738, 0x1c940744, 0x161c3ee7, 0x009ff8e2, 0x000006b7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1afd0799, 0x1c338ba7, 0x0123fb52, 0x00000802, 0x19ab0745,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1f4ecbb1, 0x0099fd54, 0x0000085e, 0x1a830792, 0x17f4d370,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3e520ac8, 0x19e307bf, 0x19c4075e, 0x02c1390c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x0169fd28, 0x0000086f, 0x19ab0745, 0x1f4ecbb1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3efcc02c, 0x19a707f7, 0x1112c675, 0x0174a840,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x181f0786, 0x1fffb803, 0x01150002, 0x00000842, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19cb0ae2, 0x1f516436, 0x06bcfda2, 0x0000094a, 0x1c7d09bc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1f5f55, 0x04dff8d9, 0x00000804, 0x1a37098d, 0x1fef5be8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02204bf3, 0x1ac00983, 0x09a863f6, 0x3d7ffb1a,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x15d0098d, 0x1fef5818, 0x0220480d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x15480983, 0x09a8600a, 0x3d7ff8e6, 0x12b80992,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1601ed5f, 0x04ad088b, 0x00000738, 0x14ee0961, 0x15fa2ff8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x044a04d5, 0x00000841, 0x143408ed, 0x1e3d63ec, 0x35ece534,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x03830609, 0x0000079f, 0x14200895, 0x1fcf1fed,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3edd8426, 0x12b80992, 0x1601ed5f, 0x04ad088b, 0x00000738,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14390845, 0x1f816405, 0x02540604, 0x00000792, 0x14a407d7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1115b717, 0x02fcbf5d, 0x00000002, 0x173616dc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x040c91ca, 0x01e408dc, 0x0000055c, 0x164e1565, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x048b0857, 0x00000450, 0x157d165b, 0x04642daf, 0x01a04c24,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x13ce1314, 0x0f96b87a, 0x062303ef, 0x0000056d, 0x142b14af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3376fc94, 0x11f0b5a0, 0x13a21347, 0x2e86778e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x05fc033b, 0x0000066a, 0x129a1390, 0x2ee5e32a, 0x0ea70b54,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12e01226, 0x0766af00, 0x01c05404, 0x11f5134a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0dc522ba, 0x076801e4, 0x000008be, 0x12261132, 0x0f8674ae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04c5ffba, 0x0000089e, 0x00000002, 0x11f5134a, 0x0dc522ba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x076801e4, 0x000008be, 0x123d1414, 0x09b79c24, 0x3b12ed53,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x129a1390, 0x2ee5e32a, 0x2e5e6f58, 0x142b14af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3376fc94, 0x01a06416, 0x00000002, 0x12e01226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0766af00, 0x01c05404, 0x12f410ce, 0x07d6e4e5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x009fae04, 0x12261132, 0x0f8674ae, 0x196e28ab,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x11f50f6d, 0x0cd5613f, 0x0768fe1c, 0x000008be, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1ffa1ba1, 0x090f09e7, 0xfda60260, 0x00000612, 0x1fcc1a6e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04b189f1, 0xfad2034f, 0x00000662, 0x1ed81b40, 0x336005d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x2263cb46, 0x1ece17ac, 0x02dc2dbf, 0xf5e403cb, 0x000005d4,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1e4317d0, 0x2efa10d0, 0x334ecf67, 0x1e38173f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a28fcb9, 0x148f53a4, 0x1c8e1716, 0x3e3807f9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xf502ffe6, 0x000005f5, 0x00000002, 0x032d1e10, 0x336005d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfbc40295, 0x00000488, 0x04881e6f, 0x39fa8568, 0x26af3f6f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02a51d56, 0x0a4ccdb7, 0xfd5c02ce, 0x00000502, 0x05f01b5e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0259651e, 0xfdec04d2, 0x00000065, 0x00000002, 0x1cb00bd0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x027e0def, 0x020a0924, 0x000000db, 0x1a550ca9, 0x027c9dce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfff7080a, 0x0000fea0, 0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1bab0e46, 0x1550a57b, 0x012a08d3, 0x0000fc85, 0x1c230f15,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6dd0fd, 0x3ce60177, 0x1b180e86, 0x158468fe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfffb096b, 0x0000fc95, 0x1baf0fb6, 0x18d0fec3, 0x02520dc8, 0x0000fab7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a9f0f40, 0x110a54ee, 0xfee90aad, 0x0000fd1b, 0x1b650fba,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x166c8121, 0x00340d61, 0x0000fb8e, 0x1ac90fb3, 0x34a89841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfeee0b36, 0x0000fbd1, 0x1b700fd9, 0x35ea6547, 0x00560dea, 0x0000fac7,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b3c0ff8, 0x23ec3fda, 0x3d1f0a7c, 0x1b9e0fea,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x29de3d5f, 0x02210ecd, 0x0000fa2f, 0x1bc81023, 0x23626755,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x04250c3a, 0x0000fa74, 0x1bbd0ff3, 0x26433cde, 0x3e90443a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bd50ff8, 0x30e6d86b, 0x08f46712, 0x1bef0fe4,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bf1f4d7, 0x101f5779, 0x1c3b1193, 0x21c2285d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0338092d, 0x0000fbe4, 0x1d720ecf, 0x0dde71c3, 0x1e701c3d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1b9e0fea, 0x29de3d5f, 0x02210ecd, 0x0000fa2f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x1bbd0ff3, 0x26433cde, 0x3e90443a, 0x1b700fd9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x35ea6547, 0x00560dea, 0x0000fac7, 0x1bb50fde, 0x19705936,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x03580eb4, 0x0000fb4a, 0x1b650fba, 0x166c8121, 0x00340d61, 0x0000fb8e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x1baf0fb6, 0x18d0fec3, 0x02520dc8, 0x0000fab7, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x1bd50ff8, 0x30e6d86b, 0x3eb05436, 0x1bc81023,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23626755, 0x3b2b6eaf, 0x1c3b1193, 0x21c2285d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0338092d, 0x0000fbe4, 0x1aa3118e, 0x207ecc27, 0x3f38e7da,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1bc81023, 0x23626755, 0x04250c3a, 0x0000fa74,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b3c0ff8, 0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1aa3118e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x207ecc27, 0x01710907, 0x0000fbd7, 0x19881041, 0x25ab93c9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x06982fc3, 0x183111a2, 0x2afb64f8, 0x00590623, 0x0000fab6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x18460f71, 0x38184013, 0xfed80792, 0x0000fd43, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b3c0ff8, 0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1ac90fb3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x34a89841, 0x139b5ad0, 0x19881041, 0x25ab93c9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3f1ff823, 0x18460f71, 0x38184013, 0x103d72c8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x1bbd0ff3, 0x26433cde, 0x3e90443a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bef0fe4, 0x1bf1f4d7, 0x1903ba8b, 0x1bb50fde,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19705936, 0x3878e5b0, 0x1bcb0fbc, 0x1d4d4f8e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3750baaa, 0x1baf0fb6, 0x18d0fec3, 0x3f8b306a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x1c230f15, 0x1a6dd0fd, 0x02aa0a4a, 0x0000fc53, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02aa0a4a, 0x0000fc53, 0x1bcb0fbc, 0x1d4d4f8e, 0x03860d5e, 0x0000fabf,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x1bef0fe4,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1bf1f4d7, 0x051f0d04, 0x0000fbc3, 0x00000002, 0x192e1a0d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01cc8a34, 0x00a2f765, 0x0000004f, 0x173417f8, 0x0c6df63a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x033cf69c, 0x0000fd94, 0x16b81b6f, 0x11de9260, 0x3f8fffe0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x169519c3, 0x1550a685, 0x24e59b2c, 0x16171a1a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15846b02, 0x010b4768, 0x162b18fa, 0x1a6dd303,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02aaf5b6, 0x0000fc20, 0x156d1904, 0x18d0fd3d, 0x0252f238, 0x0000fa84,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x157618e9, 0x1d4d4c72, 0x0084d06a, 0x155118e9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19705aca, 0x08bf4aaa, 0x156918b8, 0x1bf1f728,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x07971db0, 0x154318d8, 0x26433f22, 0x26fc4a8b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x152218b5, 0x236264ab, 0x0425f3c6, 0x0000fa40, 0x153a18f7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x29de3ea1, 0x0221f133, 0x0000f9fc, 0x14fb193f, 0x23ec3c25,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0018f39a, 0x0000fa65, 0x15301924, 0x35ea66b9, 0x02f0fa7c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1544193e, 0x166c82df, 0x0c7f7889, 0x155118e9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19705aca, 0x0358f14c, 0x0000fb17, 0x156d1904, 0x18d0fd3d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x36dbe8ec, 0x00000002, 0x155118e9, 0x19705aca,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0358f14c, 0x0000fb17, 0x154318d8, 0x26433f22, 0x2e83643b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15301924, 0x35ea66b9, 0x0056f216, 0x0000fa94, 0x153a18f7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x29de3ea1, 0x36872f1d, 0x00000002, 0x157618e9,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d4d4c72, 0x0386f2a2, 0x0000fa8c, 0x162b18fa, 0x1a6dd303,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x02aaf5b6, 0x0000fc20, 0x156918b8, 0x1bf1f728, 0x051ff2fc, 0x0000fb90,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x173417f8, 0x0c6df63a, 0x033cf69c, 0x0000fd94, 0x15521864,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x34e6b0d8, 0x2006f248, 0x14321791, 0x21a233b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0198f1eb, 0x152218b5, 0x236264ab, 0x0425f3c6, 0x0000fa40,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x136018e5, 0x207ebff0, 0x015af6ef, 0x0000fba0, 0x14fb193f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23ec3c25, 0x0018f39a, 0x0000fa65, 0x13a31a91, 0x25eb6824,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xff89f770, 0x0000fc16, 0x15b91cbc, 0x0698a358, 0x1f3d8536,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1bab0e46, 0x1550a57b, 0x012a08d3, 0x0000fc85,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a550ca9, 0x027c9dce, 0xfff7080a, 0x0000fea0, 0x1b180e86,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x158468fe, 0xfffb096b, 0x0000fc95, 0x1a9f0f40, 0x110a54ee,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x086bb942, 0x00000002, 0x1a550ca9, 0x027c9dce,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfff7080a, 0x0000fea0, 0x188e0d68, 0x06b8acaf, 0x39dbbb54,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a9f0f40, 0x110a54ee, 0xfee90aad, 0x0000fd1b, 0x18460f71,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x38184013, 0xfed80792, 0x0000fd43, 0x1ac90fb3, 0x34a89841,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfeee0b36, 0x0000fbd1, 0x00000002, 0x168a004e, 0x0a28fcb9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xf56b02d6, 0x00000650, 0x15f70078, 0x02dc2dbf, 0x3841e4f5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x16be016c, 0x1b5ec0ff, 0x1c759ade, 0x15a80334,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04b189f1, 0xfad2034f, 0x00000662, 0x17190545, 0x101f8dba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0x15b104db, 0x090f09e7, 0xfda60260, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16fb0618, 0x1eee9465, 0xfef70191, 0x000008b3, 0x1505077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1def1cae, 0x00dd04c4, 0x00000821, 0x165407b1, 0x1fffe818,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x014c0288, 0x000008a0, 0x15840792, 0x17f4d090, 0x3a3f3d5c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x15b104db, 0x090f09e7, 0xfda60260, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14200613, 0x091938e5, 0xff0e05b7, 0x00000624, 0x1505077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1def1cae, 0x1fd73f0d, 0x13730743, 0x161c3d19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x009f071e, 0x000006b7, 0x12b80992, 0x1601ed5f, 0x04ad088b, 0x00000738,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x12490993, 0x04642daf, 0x33f0587c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x165407b1, 0x1fffe818, 0x014c0288, 0x000008a0, 0x181f0786,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fffb803, 0x01150002, 0x00000842, 0x16fb0618, 0x1eee9465,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfef70191, 0x000008b3, 0x190e0614, 0x1ece7b99, 0xfef2fe6a, 0x000008b5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x17190545, 0x101f8dba, 0xfdb70174, 0x00000868, 0x17770522,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x174f055a, 0x0bbf43dd, 0x18ee0545, 0x106f8e49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfdb7fe8c, 0x00000868, 0x18860528, 0x178f2ea8, 0x0bdf3c24,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x190e0614, 0x1ece7b99, 0x3905b3ba, 0x17770522,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x174f055a, 0xfd870151, 0x00000923, 0x00000002, 0x15840792,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x17f4d090, 0x011b03e4, 0x00000843, 0x1505077a, 0x1def1cae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3def08e0, 0x150a0799, 0x1c338859, 0x3e111bea,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x14a407d7, 0x1115b717, 0x3bf180b3, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14200613, 0x091938e5, 0xff0e05b7, 0x00000624, 0x121007ba,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x040c91ca, 0x01e408dc, 0x0000055c, 0x13730743, 0x161c3d19,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x15baee42, 0x12490993, 0x04642daf, 0x01a04c24,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x181f0786, 0x1fffb803, 0x01150002, 0x00000842,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19ab0745, 0x1f4ecbb1, 0x0099fd54, 0x0000085e, 0x190e0614,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1ece7b99, 0x05796516, 0x1c940744, 0x161c3ee7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x009ff8e2, 0x000006b7, 0x1a5604dc, 0x090f0a19, 0xfda6fda0, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x190e0614, 0x1ece7b99, 0xfef2fe6a, 0x000008b5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a5604dc, 0x090f0a19, 0xfda6fda0, 0x00000612, 0x18ee0545,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x106f8e49, 0xfdb7fe8c, 0x00000868, 0x1a5f0334, 0x04e18e10,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfad2fcb1, 0x00000662, 0x194a016c, 0x1b6e9b06, 0xf74afd57, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a4000df, 0x3afe7a10, 0xf642fc22, 0x00000583, 0x19ed0051,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0369b2ca, 0x055d1067, 0x00000002, 0x18040002,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3e3807f9, 0xf502ffe6, 0x000005f5, 0x168a004e, 0x0a28fcb9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf56b02d6, 0x00000650, 0x17d200fa, 0x1faf5bbe, 0xf6220075, 0x000007c5,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16be016c, 0x1b5ec0ff, 0xf74a02a9, 0x0000079b, 0x178e01b3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1d47fc, 0x09014e66, 0x17190545, 0x101f8dba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0x186e01b5, 0x1cec8c10, 0xf794ff15, 0x00000830,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x18ee0545, 0x106f8e49, 0xfdb7fe8c, 0x00000868, 0x194a016c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1b6e9b06, 0xf74afd57, 0x0000079b, 0x00000002, 0x18040002,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3e3807f9, 0xf502ffe6, 0x000005f5, 0x17d200fa, 0x1faf5bbe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x1d04808f, 0x19ed0051, 0x0369b2ca, 0xf586fc89, 0x000005d8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x194a016c, 0x1b6e9b06, 0x1c3710ce, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x178e01b3, 0x1e1d47fc, 0xf79d010f, 0x0000082b, 0x186e01b5,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1cec8c10, 0x005fde06, 0x17d200fa, 0x1faf5bbe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x395a3960, 0x194a016c, 0x1b6e9b06, 0xf74afd57, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x123d0ea3, 0x0a678fdd, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x11f50f6d, 0x0cd5613f, 0x04fd1553, 0x129a0f27,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2ed5e0d5, 0x29615b55, 0x12f410ce, 0x07d6e4e5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01c057fc, 0x13a20f70, 0x2e466478, 0x05fcfcc5, 0x0000066a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x13ce0fa3, 0x0fb6b785, 0x30309f4c, 0x142b0e07,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3376ff6c, 0x11f0b660, 0x157d0c5d, 0x04642e51,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01a04fdc, 0x123d0ea3, 0x0a678fdd, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x0823fcc9, 0x0000086f, 0x129a0f27, 0x2ed5e0d5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x2e5e6ca8, 0x142b0e07, 0x3376ff6c, 0x01a067ea,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x13a20f70, 0x2e466478, 0x05fcfcc5, 0x0000066a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1de51b4e, 0x39fa8568, 0xfb930204, 0x000002f2, 0x1e081a8f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x260e6519, 0x113b4c0a, 0x1cfb1af1, 0x2f795461,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x2ea1a678, 0x1caa1a53, 0x221d2fff, 0x09fc277a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b521a8f, 0x261e66e6, 0xfa66fdf2, 0x00000405, 0x1b0017db,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2cba932b, 0xf5adfcba, 0x00000509, 0x1a811b40, 0x33700229,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfbc4fd6b, 0x00000488, 0x1a881819, 0x3afe7a10, 0xf642fc22, 0x00000583,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1cfb1af1, 0x2f795461, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b521a8f, 0x261e66e6, 0xfa66fdf2, 0x00000405, 0x1b761b4e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3a8aaa8e, 0x2ed4b40a, 0x1a811b40, 0x33700229,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1960c76f, 0x00000002, 0x1de51b4e, 0x39fa8568,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfb930204, 0x000002f2, 0x1ed81b40, 0x336005d6, 0x1960c491,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1e081a8f, 0x260e6519, 0x37da8b79, 0x1e4317d0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2efa10d0, 0xf5970332, 0x00000508, 0x1caa1a53, 0x221d2fff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xf9d80000, 0x0000038e, 0x1ca51886, 0x223d1fff, 0xf6c7001a, 0x00000420,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b0017db, 0x2cba932b, 0xf5adfcba, 0x00000509, 0x1e4317d0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2efa10d0, 0xf5970332, 0x00000508, 0x1c8e1716, 0x3e3807f9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0xf502ffe6, 0x000005f5, 0x00000002, 0xf502ffe6, 0x000005f5, 0x1aba1783,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0369b2ca, 0xf586fc89, 0x000005d8, 0x1b0017db, 0x2cba932b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x33109c31, 0x1a881819, 0x3afe7a10, 0x07a25768,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x11aa1117, 0x39fa8568, 0xfb930204, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x11bb1019, 0x2f795461, 0x3fdcf282, 0x0e67115b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ae928fd, 0xfc850313, 0x0000fe2a, 0x0e190ff0, 0x3678642f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfbdc00a3, 0x0000fd17, 0x0c36116c, 0x315a10fa, 0xfe1d03b4, 0x0000faa9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0c330f8b, 0x2bb9d7fd, 0xfd8a0000, 0x0000f993, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x11aa1117, 0x39fa8568, 0xfb930204, 0x000002f2, 0x0e67115b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ae928fd, 0xfc850313, 0x0000fe2a, 0x0f7f12c5, 0x0259651e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdec04d2, 0x00000065, 0x0ce612f6, 0x372930e3, 0xfe8c0572, 0x0000fceb,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x11bb1019, 0x2f795461, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x11c00e54, 0x3a8aaa8e, 0xfb93fdfc, 0x000002f2, 0x0e630e1f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39d8e32e, 0xfc36fd6b, 0x0000fe02, 0x0fcc0c93, 0x02096ae0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdc0fb67, 0x00000072, 0x0d150c18, 0x37390f2e, 0xfe95fa7e, 0x0000fcf1,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0xfe95fa7e, 0x0000fcf1, 0x0c510da8, 0x312a1f04,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfe1dfc4c, 0x0000faa9, 0x0e630e1f, 0x39d8e32e, 0xfc36fd6b, 0x0000fe02,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c330f8b, 0x2bb9d7fd, 0xfd8a0000, 0x0000f993, 0x0e190ff0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3678642f, 0xfbdc00a3, 0x0000fd17, 0x00000002, 0x07b11086,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x277478a0, 0x079402e7, 0x0000f90a, 0x07bf0f3b, 0x2724ffd3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x07e5ff60, 0x0000f88a, 0x06dd0f71, 0x2f76d80e, 0x1f76c4a0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06c20e22, 0x2f266f73, 0x0968fc8b, 0x0000fb34, 0x05f50ef0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3847bfdd, 0x0a68feb0, 0x0000fca9, 0x061f0d37, 0x37d6d315,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x05160ec1, 0x00a7fbd5, 0x0aa3fe57, 0x0000ff03,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x04ab0d97, 0x06a75b52, 0x0a14fb95, 0x00000073, 0x043a1014,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0907a823, 0x0a640183, 0x0000012d, 0x03440e92, 0x126683c9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x096afe2d, 0x00000324, 0x038b1152, 0x119618b0, 0x093f0404, 0x000002a2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0047102f, 0x0766af00, 0x01c05404, 0x014411f0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0f96b87a, 0x062303ef, 0x0000056d, 0x00000002, 0x07bf0f3b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2724ffd3, 0x07e5ff60, 0x0000f88a, 0x07360cd7, 0x2c0486ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0762f954, 0x0000faf2, 0x06c20e22, 0x2f266f73, 0x0968fc8b, 0x0000fb34,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x061f0d37, 0x37d6d315, 0x0979fa5e, 0x0000fcfe, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07360cd7, 0x2c0486ec, 0x0762f954, 0x0000faf2, 0x06660bd7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_XZ, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3a54fa7a, 0xfd57f7e9, 0x061f0d37, 0x37d6d315,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x04ab0d97, 0x06a75b52, 0x0a14fb95, 0x00000073,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x05160ec1, 0x00a7fbd5, 0x0aa3fe57, 0x0000ff03,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x043a1014, 0x0907a823, 0x0a640183, 0x0000012d, 0x04cc1144,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04e768b1, 0x0a280470, 0x0000fffa, 0x038b1152, 0x119618b0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x093f0404, 0x000002a2, 0x04b31423, 0x0bd3f193, 0x062c0894, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x032514f7, 0x08e4b984, 0x00d04c21, 0x056c14d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x033189f4, 0x00005025, 0x026f1547, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x048b0857, 0x00000450, 0x00000002, 0x038b1152, 0x119618b0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x093f0404, 0x000002a2, 0x014411f0, 0x0f96b87a, 0x062303ef, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x032514f7, 0x08e4b984, 0x00d04c21, 0x026f1547,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x3ce53d80, 0x110ef427, 0x00000002, 0x056c14d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x033189f4, 0x00005025, 0x07261355, 0x343311b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x06210886, 0x0000fc2c, 0x04b31423, 0x0bd3f193, 0x062c0894, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06b71214, 0x31a5991d, 0x083606b4, 0x0000fbe5, 0x04cc1144,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04e768b1, 0x0a280470, 0x0000fffa, 0x05ec1100, 0x39878090,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0a23040f, 0x0000fd52, 0x05160ec1, 0x00a7fbd5, 0x0aa3fe57, 0x0000ff03,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x05f50ef0, 0x3847bfdd, 0x0a68feb0, 0x0000fca9, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07261355, 0x343311b2, 0x06210886, 0x0000fc2c, 0x07f512af,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2972b93f, 0x27dec6f5, 0x06b71214, 0x31a5991d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x083606b4, 0x0000fbe5, 0x07b11086, 0x277478a0, 0x079402e7, 0x0000f90a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06bc10bd, 0x2f969082, 0x09680375, 0x0000fb34, 0x06dd0f71,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2f76d80e, 0x09960000, 0x0000fa81, 0x05f50ef0, 0x3847bfdd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0a68feb0, 0x0000fca9, 0x00000002, 0x0a68feb0, 0x0000fca9, 0x05ec1100,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39878090, 0x0a23040f, 0x0000fd52, 0x06bc10bd, 0x2f969082,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x09680375, 0x0000fb34, 0x06b71214, 0x31a5991d, 0x083606b4, 0x0000fbe5,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x01430ce6, 0x0fb6b785, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x03b40d29, 0x10e5d31e, 0x0906fb4e, 0x0000025e, 0x032009d3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0854a274, 0x00d04fdf, 0x04ba0aa9, 0x0b73d265,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x062cf76c, 0x00000128, 0x0564094c, 0x02c06e03, 0x03e6f68d, 0x0000ffe0,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x01430ce6, 0x0fb6b785, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x032009d3, 0x0854a274, 0x00d04fdf, 0x02500982,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3ce53e80, 0x110ef7d9, 0x0564094c, 0x02c06e03,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x03e6f68d, 0x0000ffe0, 0x00000002, 0x15b91cbc, 0x0698a358,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfeeaf8a6, 0x0000fe09, 0x16b81b6f, 0x11de9260, 0x3fb36b5b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x15401a1e, 0x110a5b11, 0xfee9f553, 0x0000fce7, 0x16171a1a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15846b02, 0x37b44942, 0x156d1904, 0x18d0fd3d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0252f238, 0x0000fa84, 0x00000002, 0x0252f238, 0x0000fa84, 0x1544193e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x166c82df, 0x0034f29f, 0x0000fb5b, 0x15401a1e, 0x110a5b11,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfee9f553, 0x0000fce7, 0x14fb193f, 0x23ec3c25, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x15b91cbc, 0x0698a358, 0xfeeaf8a6, 0x0000fe09, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c381aa8, 0x102dda5c, 0x01aaf970, 0x00000663, 0x0b8f1b50,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f9b5ab3, 0x01fc689a, 0x0d1f1c72, 0x185db6d6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x023023ec, 0x0b341c36, 0x0fda0b1b, 0x2008b3f1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d071cf7, 0x1b2c1b93, 0x0197fbe9, 0x000008fc, 0x0b341d32,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f7907dc, 0xfff5fc10, 0x000006e7, 0x0b911e1b, 0x10995c6b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02f0e118, 0x00000002, 0x002dfd28, 0x00000716, 0x0c3b1ed2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x118b1523, 0x02525cee, 0x0d071cf7, 0x1b2c1b93,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0197fbe9, 0x000008fc, 0x0d1e1f37, 0x12ad1574, 0x01aafeb0, 0x0000074e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e241d30, 0x1bf37c71, 0x03abfcca, 0x00000922, 0x0e171f36,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x13304199, 0x02b9fee8, 0x00000754, 0x0efa1ecf, 0x12e2697f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x3fa457c8, 0x00000002, 0x01d03ffb, 0x0fa41e1b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12951d02, 0x3ed3bb66, 0x0e241d30, 0x1bf37c71,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x1e7bbeb4, 0x0ffa1d32, 0x11a65884, 0x0556fd28, 0x00000716,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0ff51c37, 0x1146a7b8, 0x3d10e2e8, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x058efc10, 0x000006e7, 0x0f911b50, 0x10a61336, 0x3cbf22e8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e241d30, 0x1bf37c71, 0x03abfcca, 0x00000922, 0x0d1f1c72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x185db6d6, 0x39095a3d, 0x0d071cf7, 0x1b2c1b93,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04ae58e2, 0x00000002, 0x0f911b50, 0x10a61336,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0556faf8, 0x000006b2, 0x0ee11aa1, 0x10942ea5, 0x3d0d9b12,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0d1f1c72, 0x185db6d6, 0x023023ec, 0x0dfe1a4a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10327e64, 0x03cef970, 0x00000663, 0x0d0f1a4e, 0x108fce49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3f6bafc5, 0x00000002, 0x0d1f060b, 0x0f9b594d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x01a00c18, 0x0e1c0463, 0x185db52a, 0x02302014,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0c70055b, 0x0fda08e5, 0x2008b00f, 0x0dd203f3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b2c186d, 0x01970417, 0x000008fc, 0x0c0d0474, 0x0f790424,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xfff503f0, 0x000006e7, 0x0c070379, 0x10995f95, 0x02f0e2e8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x00000002, 0x0d1f060b, 0x0f9b594d, 0x01a00c18,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0dfd0663, 0x102dd9a4, 0x3e13989a, 0x0e1c0463,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x185db52a, 0x02302014, 0x0ee60661, 0x108fcdb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02b906cb, 0x00000659, 0x0fc20607, 0x10327d9c, 0x00a457c5,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x03ce0690, 0x00000663, 0x1071055d, 0x10942d5b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x01f3bb66, 0x0e1c0463, 0x185db52a, 0x02302014,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x10ce0477, 0x10a610ca, 0x05560508, 0x000006b2, 0x0ec1034d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bf37f8f, 0x03ab0336, 0x00000922, 0x10ce037b, 0x1146a448,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x058e03f0, 0x000006e7, 0x10700292, 0x11a65b7c, 0x02ff22e8,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x055602d8, 0x00000716, 0x0fc501de, 0x12951efe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x025d9b12, 0x0ec1034d, 0x1bf37f8f, 0x1e7bbd4c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0ee1017b, 0x12e26a81, 0x22c08e1a, 0x0de90176,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x13304267, 0x006bafc8, 0x00000002, 0x0e1c0463,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x185db52a, 0x02302014, 0x0ec1034d, 0x1bf37f8f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0706aa3d, 0x0dd203f3, 0x1b2c186d, 0x01970417, 0x000008fc,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d0301d8, 0x12ad168c, 0x01aa0150, 0x0000074e, 0x0c5b028f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x118b16dd, 0x3edc689a, 0x00000000, 0x07990589,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0698a358, 0xfeeaf8a6, 0x0000fe09, 0x07db0471, 0x37390f2e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x2e8eadd8, 0x05e1032c, 0x02096ae0, 0xfdc0fb67, 0x00000072,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01981ad6, 0x091938e5, 0xff0e05b7, 0x00000624, 0x01b01d72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f09e7, 0xfda60260, 0x00000612, 0x02c31a00, 0x02297925,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff860653, 0x0000044c, 0x13a21347, 0x2e86778e, 0x05fc033b, 0x0000066a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x13ce1314, 0x0f96b87a, 0x30309cb4, 0x12e01226,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0766af00, 0x01c05404, 0x157d165b, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x01a04c24, 0x142b14af, 0x3376fc94, 0x01a06416,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x123d1414, 0x09b79c24, 0x08230337, 0x0000086f, 0x156918b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bf1f728, 0x051ff2fc, 0x0000fb90, 0x15521864, 0x34e6b0d8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x004f65e8, 0x152218b5, 0x236264ab, 0x2accb6e2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x173417f8, 0x0c6df63a, 0x033cf69c, 0x0000fd94, 0x162b18fa,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1a6dd303, 0x28cdbb1a, 0x169519c3, 0x1550a685,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x032a0177, 0x12b80992, 0x1601ed5f, 0x04ad088b, 0x00000738,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14a407d7, 0x1115b717, 0x01830561, 0x000007c1, 0x1505077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1def1cae, 0x060d6b63, 0x0ce612f6, 0x372930e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfe8c0572, 0x0000fceb, 0x0e67115b, 0x3ae928fd, 0xfc850313, 0x0000fe2a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c36116c, 0x315a10fa, 0xfe1d03b4, 0x0000faa9, 0x0e630e1f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x39d8e32e, 0xfc36fd6b, 0x0000fe02, 0x0e190ff0, 0x3678642f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfbdc00a3, 0x0000fd17, 0x11bb1019, 0x2f795461, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0d1f1c72, 0x185db6d6, 0x023023ec, 0x0d0f1a4e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x108fce49, 0x02b9f935, 0x00000659, 0x0c381aa8, 0x102dda5c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00abc43b, 0x0c070379, 0x10995f95, 0x002d02d8, 0x00000716,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0dd203f3, 0x1b2c186d, 0x1e65a93f, 0x0c5b028f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x118b16dd, 0x00c401ea, 0x0000073b, 0x0d0301d8, 0x12ad168c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01339b66, 0x0ec1034d, 0x1bf37f8f, 0x03ab0336, 0x00000922,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_NOP),
+	0x0de90176, 0x13304267, 0x02b90118, 0x00000754,
+};
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// Simplified from 766 triangles.
+// 200 triangles in 44 strips, 1435 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_LOD2_POLYGONS 200
+#define SUZANNE_LOD2_VERTICES 310
+#define SUZANNE_LOD2_CYCLES 5788
+
+const u32 suzanne_lod2_commands[] = {
+	1435,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x11aa1117, 0x39fa8568, 0xfb930204, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x11bb1019, 0x2f795461, 0x3fdcf282, 0x0ce612f6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x372930e3, 0xfe8c0572, 0x0000fceb, 0x0c330f8b, 0x2bb9d7fd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfd8a0000, 0x0000f993, 0x0c36116c, 0x315a10fa, 0xfe1d03b4, 0x0000faa9,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0ad70f82, 0x229cdc00, 0x00140000, 0x0000f79b, 0x0c4713d1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x38184013, 0xfed80792, 0x0000fd43, 0x08dc1226, 0x24e0e50a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x08d7140b, 0x21c2285d, 0x0338092d, 0x0000fbe4,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07261355, 0x343311b2, 0x06210886, 0x0000fc2c, 0x07251560,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x04b31423, 0x0bd3f193,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x062c0894, 0x00000128, 0x026f1547, 0x3ce53d80, 0x048b0857, 0x00000450,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x014411f0, 0x0f96b87a, 0x062303ef, 0x0000056d, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16690c17, 0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x157d0c5d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x08e61c3b, 0x13ce0fa3, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0623fc11, 0x0000056d, 0x123d0ea3, 0x0a678fdd, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12e01226, 0x0766af00, 0x01c05404, 0x12261132,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f8674ae, 0x19fdd6af, 0x123d1414, 0x09b79c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x08230337, 0x0000086f, 0x00000002, 0x026f1547, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x048b0857, 0x00000450, 0x01ce1766, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07251560, 0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x0729191c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x06b8acaf, 0xfee5075e, 0x0000fe3d, 0x00000002, 0x01ce1766,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x040c91ca, 0x01e408dc, 0x0000055c, 0x01981ad6, 0x091938e5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff0e05b7, 0x00000624, 0x0729191c, 0x06b8acaf, 0xfee5075e, 0x0000fe3d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x07d71a49, 0x372930e3, 0x2aee9e14, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01981ad6, 0x091938e5, 0xff0e05b7, 0x00000624, 0x01b01d72,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f09e7, 0xfda60260, 0x00000612, 0x07d71a49, 0x372930e3,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfe8c0572, 0x0000fceb, 0x04881e6f, 0x39fa8568, 0xfb930204, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x049e004b, 0x3a8aaa8e, 0xfb93fdfc, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01c8013c, 0x090f0a19, 0xfda6fda0, 0x00000612, 0x07db0471,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x01a803d3, 0x09193b1b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0x07990589, 0x0698a358, 0xfeeaf8a6, 0x0000fe09,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x01b50847, 0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x06b80996,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_XZ, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0c6df63a, 0xfd94f69c, 0x04ba0aa9, 0x0b73d265,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x062cf76c, 0x00000128, 0x06660bd7, 0x3a54fa7a, 0x0762f7e9, 0x0000fd57,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x04ab0d97, 0x06a75b52, 0x0a14fb95, 0x00000073, 0x061f0d37,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x37d6d315, 0x0979fa5e, 0x0000fcfe, 0x05f50ef0, 0x3847bfdd,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0a68feb0, 0x0000fca9, 0x07bf0f3b, 0x2724ffd3, 0x07e5ff60, 0x0000f88a,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05ec1100, 0x39878090, 0x0a23040f, 0x0000fd52, 0x08a50fc2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21e28440, 0x05cb00cf, 0x0000f75a, 0x07261355, 0x343311b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x06210886, 0x0000fc2c, 0x08dc1226, 0x24e0e50a, 0x04430620, 0x0000f937,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x06b80996, 0x0c6df63a, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x06660bd7, 0x3a54fa7a, 0x0762f7e9, 0x0000fd57, 0x09050ae7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21a233b2, 0x0334f6cf, 0x0000fbad, 0x07360cd7, 0x2c0486ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0762f954, 0x0000faf2, 0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07bf0f3b, 0x2724ffd3, 0x07e5ff60, 0x0000f88a, 0x08a50fc2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x21e28440, 0x05cb00cf, 0x0000f75a, 0x00000002, 0x06660bd7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3a54fa7a, 0x0762f7e9, 0x0000fd57, 0x061f0d37, 0x37d6d315,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x07360cd7, 0x2c0486ec, 0x0762f954, 0x0000faf2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x07bf0f3b, 0x2724ffd3, 0x07e5ff60, 0x0000f88a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x09050ae7, 0x21a233b2, 0x0334f6cf, 0x0000fbad, 0x08eb0ce7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x24d10efb, 0x0468fa20, 0x0000f91d, 0x0b630b4d, 0x25eb6824,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff89f770, 0x0000fc16, 0x0b400c39, 0x2adb4f13, 0x004cf9f8, 0x0000faae,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d150c18, 0x37390f2e, 0xfe95fa7e, 0x0000fcf1, 0x0c330f8b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2bb9d7fd, 0xfd8a0000, 0x0000f993, 0x0e630e1f, 0x39d8e32e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfc36fd6b, 0x0000fe02, 0x11bb1019, 0x2f795461, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x11c00e54, 0x3a8aaa8e, 0xfb93fdfc, 0x000002f2, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d40142b, 0x06b8acaf, 0xfee5075e, 0x0000fe3d, 0x0ce612f6,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x372930e3, 0x2aee9e14, 0x0c4713d1, 0x38184013,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfed80792, 0x0000fd43, 0x0c36116c, 0x315a10fa, 0xfe1d03b4, 0x0000faa9,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x121007ba, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12490993, 0x04642daf, 0x01a04c24, 0x14200613,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x091938e5, 0xff0e05b7, 0x00000624, 0x1505077a, 0x1def1cae,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x1fd73f0d, 0x15b104db, 0x090f09e7, 0xfda60260, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x17190545, 0x101f8dba, 0xfdb70174, 0x00000868, 0x15f70078,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02dc2dbf, 0xf5e403cb, 0x000005d4, 0x16be016c, 0x1b5ec0ff,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x1c759ade, 0x19ed0051, 0x0369b2ca, 0xf586fc89, 0x000005d8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x194a016c, 0x1b6e9b06, 0x1c3710ce, 0x1a5604dc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x090f0a19, 0xfda6fda0, 0x00000612, 0x18ee0545, 0x106f8e49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdb7fe8c, 0x00000868, 0x1afd0799, 0x1c338ba7, 0x0123fb52, 0x00000802,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x1a830792, 0x17f4d370, 0x041fe0ca, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1a5604dc, 0x090f0a19, 0xfda6fda0, 0x00000612, 0x1afd0799,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1c338ba7, 0x0123fb52, 0x00000802, 0x1be70614, 0x09193b1b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0x1e070894, 0x06ef1e0f, 0x033cf6be, 0x000005e9,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x00000002, 0x033cf6be, 0x000005e9, 0x1afd0799, 0x1c338ba7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x0123fb52, 0x00000802, 0x1dbe0994, 0x04642e51, 0x01a04fdc,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b6407d7, 0x1115b4e9, 0x0183fa9f, 0x000007c1, 0x1bce0845,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x1f8167fb, 0x3d13475d, 0x00000002, 0x0254f9fc, 0x00000792,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1be70895, 0x1fcf1c13, 0x3fa243d5, 0x1dbe0994,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642e51, 0x01a04fdc, 0x1c7d09bc, 0x1e1f5f55,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x18d071e0, 0x1a540bae, 0x0a678fdd, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x1a37098d, 0x1fef5be8, 0x02204bf3, 0x19f00968,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1faf6bbc, 0x3feee874, 0x00000002, 0x1a540bae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0a678fdd, 0x0823fcc9, 0x0000086f, 0x19f00968, 0x1faf6bbc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0432fd27, 0x0000088d, 0x18300a3a, 0x0f8674ae, 0x04c5ffba, 0x0000089e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19a707f7, 0x1112c675, 0x01c3fd94, 0x00000875, 0x165407b1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fffe818, 0x014c0288, 0x000008a0, 0x17190545, 0x101f8dba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0x1505077a, 0x1def1cae, 0x00dd04c4, 0x00000821,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1be70895, 0x1fcf1c13, 0x02e4f9d1, 0x0000078c,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1bd408ed, 0x1e3d6014, 0x01327c26, 0x1c7d09bc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1e1f5f55, 0x065572e2, 0x1b190961, 0x15fa2c08,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x044afb2b, 0x00000841, 0x1ac00983, 0x09a863f6, 0x0250b0a2,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x16be016c, 0x1b5ec0ff, 0xf74a02a9, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x17190545, 0x101f8dba, 0xfdb70174, 0x00000868, 0x194a016c,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b6e9b06, 0xf74afd57, 0x0000079b, 0x18ee0545, 0x106f8e49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfdb7fe8c, 0x00000868, 0x00000002, 0x17190545, 0x101f8dba,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0x19a707f7, 0x1112c675, 0x01c3fd94, 0x00000875,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x18ee0545, 0x106f8e49, 0xfdb7fe8c, 0x00000868, 0x19e307bf,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x19c4075e, 0x0169fd28, 0x0000086f, 0x1a830792, 0x17f4d370,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3d4ecaf4, 0x00000002, 0x12e01226, 0x0766af00,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01c05404, 0x123d1414, 0x09b79c24, 0x08230337, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x13ce1314, 0x0f96b87a, 0x062303ef, 0x0000056d, 0x157d165b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04642daf, 0x01a04c24, 0x164e1565, 0x3ce53d80,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x048b0857, 0x00000450, 0x173616dc, 0x040c91ca, 0x01e408dc, 0x0000055c,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x195f1ba1, 0x090f0a19, 0xfda6fda0, 0x00000612,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b761b4e, 0x3a8aaa8e, 0xfb93fdfc, 0x000002f2, 0x1aba1783,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0369b2ca, 0xf586fc89, 0x000005d8, 0x1b0017db, 0x2cba932b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x33109c31, 0x1e4317d0, 0x2efa10d0, 0xf5970332, 0x00000508,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1cfb1af1, 0x2f795461, 0xfacf0086, 0x000002ef, 0x1de51b4e,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x39fa8568, 0x0033117e, 0x00000002, 0x1aba1783,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0369b2ca, 0xf586fc89, 0x000005d8, 0x1e4317d0, 0x2efa10d0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0xf5970332, 0x00000508, 0x1ece17ac, 0x02dc2dbf, 0x0cc13499,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1de51b4e, 0x39fa8568, 0xfb930204, 0x000002f2, 0x1ffa1ba1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x090f09e7, 0xfda60260, 0x00000612, 0x00000002, 0x0c330f8b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x2bb9d7fd, 0xfd8a0000, 0x0000f993, 0x0b400c39, 0x2adb4f13,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x004cf9f8, 0x0000faae, 0x0ad70f82, 0x229cdc00, 0x00140000, 0x0000f79b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x08eb0ce7, 0x24d10efb, 0x0468fa20, 0x0000f91d, 0x08a50fc2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x21e28440, 0x05cb00cf, 0x0000f75a, 0x00000002, 0x01b50847,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06ef1e0f, 0x033cf6be, 0x000005e9, 0x01430ce6, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0623fc11, 0x0000056d, 0x04ba0aa9, 0x0b73d265, 0x062cf76c, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x04ab0d97, 0x06a75b52, 0x0a14fb95, 0x00000073, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0c381aa8, 0x102dda5c, 0x01aaf970, 0x00000663, 0x0b8f1b50,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f9b5ab3, 0x01fc689a, 0x0d0f1a4e, 0x108fce49,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3d77d72b, 0x0b341c36, 0x0fda0b1b, 0x002dfaf8, 0x000006b2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d071cf7, 0x1b2c1b93, 0x0197fbe9, 0x000008fc, 0x0b341d32,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0f7907dc, 0xfff5fc10, 0x000006e7, 0x0b911e1b, 0x10995c6b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x02f0e118, 0x00000002, 0x002dfd28, 0x00000716, 0x0c3b1ed2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x118b1523, 0x02525cee, 0x0d071cf7, 0x1b2c1b93,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0197fbe9, 0x000008fc, 0x0d1e1f37, 0x12ad1574, 0x01aafeb0, 0x0000074e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0fa41e1b, 0x12951d02, 0x04bcfe16, 0x0000073b, 0x0e171f36,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x13304199, 0x02b9fee8, 0x00000754, 0x0efa1ecf, 0x12e2697f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3fa457c8, 0x00000002, 0x0ee1017b, 0x12e26a81,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x01d03c05, 0x0de90176, 0x13304267, 0x006bafc8,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0fc501de, 0x12951efe, 0x04bc01ea, 0x0000073b, 0x0d0301d8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12ad168c, 0x01aa0150, 0x0000074e, 0x0dd203f3, 0x1b2c186d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01970417, 0x000008fc, 0x0c5b028f, 0x118b16dd, 0x00c401ea, 0x0000073b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0c070379, 0x10995f95, 0x3dbda4ee, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x002d02d8, 0x00000716, 0x0c0d0474, 0x0f790424, 0x3d1f2118,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0dd203f3, 0x1b2c186d, 0x01970417, 0x000008fc, 0x0c70055b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x0fda08e5, 0x002d0508, 0x000006b2, 0x0ee60661, 0x108fcdb7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x02b906cb, 0x00000659, 0x0d1f060b, 0x0f9b594d, 0x02982f2b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x0dfd0663, 0x102dd9a4, 0x3e13989a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x10700292, 0x11a65b7c, 0x055602d8, 0x00000716, 0x0fc501de,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12951efe, 0x025d9b12, 0x10ce037b, 0x1146a448,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x058e03f0, 0x000006e7, 0x10ce0477, 0x10a610ca, 0x3cbf2118,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x0ffa1d32, 0x11a65884, 0x0556fd28, 0x00000716,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x0ff51c37, 0x1146a7b8, 0x3d10e2e8, 0x0fa41e1b,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12951d02, 0x04bcfe16, 0x0000073b, 0x0f911b50, 0x10a61336,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0556faf8, 0x000006b2, 0x0d0f1a4e, 0x108fce49, 0x02b9f935, 0x00000659,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x0ee11aa1, 0x10942ea5, 0x01a04fe8, 0x0dfe1a4a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x10327e64, 0x3e1c4b66, 0x00000002, 0x0fc20607,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x10327d9c, 0x03ce0690, 0x00000663, 0x1071055d, 0x10942d5b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01f3bb66, 0x0ee60661, 0x108fcdb7, 0x02b906cb, 0x00000659,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x10ce0477, 0x10a610ca, 0x05560508, 0x000006b2, 0x0fc501de,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x12951efe, 0x04bc01ea, 0x0000073b, 0x00000002, 0x165407b1,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fffe818, 0x014c0288, 0x000008a0, 0x167408e0, 0x3f4c01bb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x034e022f, 0x00000876, 0x18300a3a, 0x0f8674ae, 0x04c5ffba, 0x0000089e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x16170968, 0x1fbf6c3f, 0x043202d9, 0x0000088d, 0x15d0098d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x1fef5818, 0x00211874, 0x00000002, 0x167408e0,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3f4c01bb, 0x034e022f, 0x00000876, 0x165407b1, 0x1fffe818,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x014c0288, 0x000008a0, 0x166107f7, 0x1112c58b, 0x3d51dfe4,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x162407bf, 0x19c404a2, 0x3fae986c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x016902d8, 0x0000086f, 0x165407b1, 0x1fffe818, 0x031f8fb0,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x15840792, 0x17f4d090, 0x3a3f3d5c, 0x1505077a,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1def1cae, 0x3def08e0, 0x150a0799, 0x1c338859,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x3e111bea, 0x14a407d7, 0x1115b717, 0x3bf180b3,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x18300a3a, 0x0f8674ae, 0x04c5ffba, 0x0000089e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x15d0098d, 0x1fef5818, 0x0220480d, 0x15b40bae,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x09b79c24, 0x08230337, 0x0000086f, 0x12490993, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01a04c24, 0x00000002, 0x15d0098d, 0x1fef5818,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x0220480d, 0x15480983, 0x09a8600a, 0x3d7ff8e6,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x12490993, 0x04642daf, 0x01a04c24, 0x14ee0961,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x15fa2ff8, 0x044a04d5, 0x00000841, 0x143408ed, 0x1e3d63ec,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x35ece534, 0x00000002, 0x03830609, 0x0000079f, 0x14200895,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fcf1fed, 0x3edd8426, 0x12490993, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01a04c24, 0x14390845, 0x1f816405, 0x02540604, 0x00000792,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0x14a407d7, 0x1115b717, 0x02fcbf5d, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x07261355, 0x343311b2, 0x06210886, 0x0000fc2c, 0x04cc1144,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x04e768b1, 0x0a280470, 0x0000fffa, 0x04b31423, 0x0bd3f193,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x062c0894, 0x00000128, 0x038b1152, 0x119618b0, 0x093f0404, 0x000002a2,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x014411f0, 0x0f96b87a, 0x062303ef, 0x0000056d, 0x0047102f,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX10, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x0766af00, 0x01c05404, 0x00000002, 0x07261355,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x343311b2, 0x06210886, 0x0000fc2c, 0x05ec1100, 0x39878090,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0a23040f, 0x0000fd52, 0x04cc1144, 0x04e768b1, 0x0a280470, 0x0000fffa,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x05f50ef0, 0x3847bfdd, 0x0a68feb0, 0x0000fca9, 0x03440e92,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x126683c9, 0x096afe2d, 0x00000324, 0x04ab0d97, 0x06a75b52,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0a14fb95, 0x00000073, 0x01430ce6, 0x0fb6b785, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x04cc1144, 0x04e768b1, 0x0a280470, 0x0000fffa,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x03440e92, 0x126683c9, 0x096afe2d, 0x00000324, 0x038b1152,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x119618b0, 0x093f0404, 0x000002a2, 0x0047102f, 0x0766af00,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x01c05404, 0x00000002, 0x188e0d68, 0x06b8acaf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfee5075e, 0x0000fe3d, 0x1b180e86, 0x158468fe, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb, 0x1bcb0fbc,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1d4d4f8e, 0x03860d5e, 0x0000fabf, 0x1bd50ff8, 0x30e6d86b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0037102d, 0x1b650fba, 0x166c8121, 0x00340d61, 0x0000fb8e,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1b9e0fea, 0x29de3d5f, 0x2a17b56c, 0x1b3c0ff8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1c3b1193, 0x21c2285d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0338092d, 0x0000fbe4, 0x18460f71, 0x38184013, 0xfed80792, 0x0000fd43,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x00000002, 0x1d720ecf, 0x0dde71c3, 0x033f096a, 0x0000fdcb,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10, FIFO_TEX_COORD),
+	0x1bd50ff8, 0x30e6d86b, 0x3eb05436, 0x1c3b1193,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21c2285d, 0x0338092d, 0x0000fbe4, 0x1b9e0fea, 0x29de3d5f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x02210ecd, 0x0000fa2f, 0x00000002, 0x1bcb0fbc, 0x1d4d4f8e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x03860d5e, 0x0000fabf, 0x1b180e86, 0x158468fe, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b650fba, 0x166c8121, 0x00340d61, 0x0000fb8e, 0x188e0d68,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x06b8acaf, 0xfee5075e, 0x0000fe3d, 0x18460f71, 0x38184013,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x306fcc34, 0x00000002, 0x14321791, 0x21a233b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0334f6cf, 0x0000fbad, 0x156918b8, 0x1bf1f728, 0x051ff2fc, 0x0000fb90,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x173417f8, 0x0c6df63a, 0x033cf69c, 0x0000fd94, 0x169519c3,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1550a685, 0x012af72d, 0x0000fc52, 0x15b91cbc, 0x0698a358,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfeeaf8a6, 0x0000fe09, 0x14fb193f, 0x23ec3c25, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x13a31a91, 0x25eb6824, 0xff89f770, 0x0000fc16, 0x14321791,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN, FIFO_TEX_COORD),
+	0x21a233b2, 0x0334f6cf, 0x0000fbad, 0x00000002, 0x156918b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bf1f728, 0x051ff2fc, 0x0000fb90, 0x14321791, 0x21a233b2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0334f6cf, 0x0000fbad, 0x153a18f7, 0x29de3ea1, 0x0221f133, 0x0000f9fc,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x14fb193f, 0x23ec3c25, 0x0018f39a, 0x0000fa65, 0x156918b8,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1bf1f728, 0x051ff2fc, 0x0000fb90, 0x156d1904, 0x18d0fd3d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x0252f238, 0x0000fa84, 0x169519c3, 0x1550a685, 0x012af72d, 0x0000fc52,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_BEGIN),
+	0x14fb193f, 0x23ec3c25, 0x0018f39a, 0x0000fa65, 0x00000000,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0e630e1f, 0x39d8e32e, 0xfc36fd6b, 0x0000fe02, 0x11c00e54,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x3a8aaa8e, 0xfb93fdfc, 0x000002f2, 0x0d150c18, 0x37390f2e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0xfe95fa7e, 0x0000fcf1, 0x00000000, 0x0d6e0b05, 0x0698a358,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF),
+	0x11815628, 0x0b630b4d, 0x25eb6824, 0x20d27eca,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x19a707f7, 0x1112c675, 0x01c3fd94, 0x00000875, 0x19f00968,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1faf6bbc, 0x0432fd27, 0x0000088d, 0x199208e0, 0x3f4c0245,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x3e9c70aa, 0x1c7d09bc, 0x1e1f5f55, 0x04dff8d9, 0x00000804,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1ac00983, 0x09a863f6, 0x0476fbcd, 0x00000866, 0x1a37098d,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1fef5be8, 0x029008e6, 0x1b761b4e, 0x3a8aaa8e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0xfb93fdfc, 0x000002f2, 0x1cfb1af1, 0x2f795461, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b0017db, 0x2cba932b, 0xf5adfcba, 0x00000509, 0x08a50fc2,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x21e28440, 0x05cb00cf, 0x0000f75a, 0x08dc1226, 0x24e0e50a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x0ad70f82, 0x229cdc00, 0x00140000, 0x0000f79b,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0d0f1a4e, 0x108fce49, 0x02b9f935, 0x00000659, 0x0d071cf7,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x1b2c1b93, 0x0197fbe9, 0x000008fc, 0x0fa41e1b, 0x12951d02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x04bcfe16, 0x0000073b, 0x0dd203f3, 0x1b2c186d, 0x01970417, 0x000008fc,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x0ee60661, 0x108fcdb7, 0x02b906cb, 0x00000659, 0x0fc501de,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x12951efe, 0x04bc01ea, 0x0000073b, 0x12490993, 0x04642daf,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16),
+	0x01a04c24, 0x14a407d7, 0x1115b717, 0x01830561, 0x000007c1,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD),
+	0x1505077a, 0x1def1cae, 0x060d6b63, 0x03440e92,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x126683c9, 0x096afe2d, 0x00000324, 0x01430ce6, 0x0fb6b785,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX10),
+	0x0623fc11, 0x0000056d, 0x0047102f, 0x0766af00, 0x01c05404,
+	FIFO_COMMAND_PACK(FIFO_TEX_COORD, FIFO_NORMAL, FIFO_VERTEX16, FIFO_TEX_COORD),
+	0x1b3c0ff8, 0x23ec3fda, 0x00180c66, 0x0000fa98, 0x1b650fba,
+	FIFO_COMMAND_PACK(FIFO_NORMAL, FIFO_VERTEX_DIFF, FIFO_TEX_COORD, FIFO_NORMAL),
+	0x166c8121, 0x0f6070fb, 0x18460f71, 0x38184013,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_NOP, FIFO_NOP, FIFO_NOP),
+	0xfed80792, 0x0000fd43,
 };
@@ -0,0 +1,431 @@
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// Closed hull of 300 triangles (source: 766).
+// 300 triangles in 45 strips, 834 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_SHADOW_POLYGONS 300
+#define SUZANNE_SHADOW_VERTICES 404
+#define SUZANNE_SHADOW_CYCLES 3549
+
+const u32 suzanne_shadow_commands[] = {
+	834,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00000002, 0xf74a02a9, 0x0000079b, 0x239a6922, 0xfad2034f, 0x00000662,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xfd5c02ce, 0x00000502, 0xfdb70174, 0x00000868, 0x28919903, 0x009f071e, 0x000006b7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x36d9be99, 0x033c0942, 0x000005e9, 0x01c90890, 0x000003de, 0x00d04c21,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00005025, 0x11c4df55, 0x06210886, 0x0000fc2c, 0x083606b4, 0x0000fbe5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x079402e7, 0x0000f90a, 0x09680375, 0x0000fb34, 0x09960000, 0x0000fa81, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x0a14fb95, 0x00000073, 0x0762f7e9, 0x0000fd57, 0x062cf76c, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x03e6f68d, 0x0000ffe0, 0x00d04fdf, 0x01c9f770, 0x000003de, 0x033cf6be, 0x000005e9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xff0efa49, 0x00000624, 0x09364699, 0xfe1dfd89, 0x000006f1, 0x1c4354e1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x3b3b1422, 0xfd870151, 0x00000923, 0x3450c023, 0xfef2fe6a, 0x000008b5,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX10),
+	0x3a969eea, 0x009ff8e2, 0x000006b7, 0x10a391bd, 0x01e047e0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0533fbdc, 0x00000854, 0x0f6625c6, 0x0183fa9f, 0x000007c1, 0x0099fd54, 0x0000085e,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX_DIFF),
+	0x00000002, 0x009ff8e2, 0x000006b7, 0x01e047e0, 0x272bf2c7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x08e61c3b, 0x00d04fdf, 0x0623fc11, 0x0000056d, 0x0906fb4e, 0x0000025e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x096afe2d, 0x00000324, 0x0a14fb95, 0x00000073, 0x0a640183, 0x0000012d, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a280470, 0x0000fffa, 0x0a23040f, 0x0000fd52, 0x083606b4, 0x0000fbe5, 0x09680375, 0x0000fb34,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x083606b4, 0x0000fbe5, 0x0a280470, 0x0000fffa, 0x062c0894, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x093f0404, 0x000002a2, 0x00d04c21, 0x062303ef, 0x0000056d, 0x01a04c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX10),
+	0x01a06416, 0x08230337, 0x0000086f, 0x2e5e6f58, 0x01c05404,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x01a06416, 0x2e1f4e60, 0x00000002, 0x0a14fb95, 0x00000073,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN),
+	0x062cf76c, 0x00000128, 0x0906fb4e, 0x0000025e, 0x00d04fdf, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfad2034f, 0x00000662, 0xfdb70174, 0x00000868, 0xf74a02a9, 0x0000079b, 0x09014e66,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x39aa1766, 0x06b5caa0, 0x36beda42, 0xfdb7fe8c, 0x00000868,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfd5cfd32, 0x00000502, 0x1ef30457, 0xff86f9ad, 0x0000044c, 0x1d8e209c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01c9f770, 0x000003de, 0x00000002, 0xfdb7fe8c, 0x00000868, 0xf794ff15, 0x00000830,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0xf79d010f, 0x0000082b, 0x00000002, 0xf74a02a9, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf6220075, 0x000007c5, 0xf5e403cb, 0x000005d4, 0xf502ffe6, 0x000005f5, 0xf5970332, 0x00000508,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf5adfcba, 0x00000509, 0xf6c7001a, 0x00000420, 0xf9d80000, 0x0000038e, 0xf5970332, 0x00000508,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX10),
+	0xfd5c02ce, 0x00000502, 0xf5e403cb, 0x000005d4, 0x00000002, 0x00d04c21,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x01a04c24, 0x3729e43b, 0x18e412c7, 0x009f071e, 0x000006b7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x10a39243, 0x00b50272, 0x0000086f, 0x05330424, 0x00000854, 0x03f8ffe8, 0x00000912,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX10, FIFO_VERTEX_DIFF),
+	0x07130303, 0x0000093a, 0x33544034, 0x01e04420, 0x30020cfe,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX10),
+	0x00000002, 0x07130303, 0x0000093a, 0x31a88121, 0x01e04420,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01830561, 0x000007c1, 0x00000002, 0x009f071e, 0x000006b7, 0x00b50272, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfdb70174, 0x00000868, 0x0099fd54, 0x0000085e, 0x00000002, 0x00b50272, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x03f8ffe8, 0x00000912, 0x0099fd54, 0x0000085e, 0x06bcfda2, 0x0000094a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x08230337, 0x0000086f, 0x01c05404, 0x03f8ffe8, 0x00000912, 0x01c057fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0823fcc9, 0x0000086f, 0x2e5e6ca8, 0x01a04fdc, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00000002, 0x01a04fdc, 0x100df4fe, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0dba64d9, 0x03f8ffe8, 0x00000912, 0x00000002, 0x07befd71, 0x00000754,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x01c057fc, 0x0623fc11, 0x0000056d, 0x01c05404, 0x096afe2d, 0x00000324,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x093f0404, 0x000002a2, 0x0a640183, 0x0000012d, 0x0a280470, 0x0000fffa, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xf502ffe6, 0x000005f5, 0x1d04808f, 0xf594fd5f, 0x000006c0, 0x0db6dbf8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf642fc22, 0x00000583, 0xfd5cfd32, 0x00000502, 0xf5adfcba, 0x00000509, 0xfa66fdf2, 0x00000405,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xf9d80000, 0x0000038e, 0x3613dc86, 0x0033117e, 0xfc850313, 0x0000fe2a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF),
+	0xfdec04d2, 0x00000065, 0xfe8c0572, 0x0000fceb, 0x152165ec, 0x20325d6c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF),
+	0x0dbdb5e3, 0x00180c66, 0x0000fa98, 0x0f6070fb, 0x2a17b56c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF),
+	0x11b4dfe7, 0x2e9367c5, 0x1903ba8b, 0x2ff0ac87,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0338092d, 0x0000fbe4, 0x04250c3a, 0x0000fa74, 0x3f1ff823, 0x00180c66, 0x0000fa98,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xf9d80000, 0x0000038e, 0xfb930204, 0x000002f2, 0xfd5c02ce, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfdec04d2, 0x00000065, 0xff860653, 0x0000044c, 0xfee5075e, 0x0000fe3d, 0x3df334c8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfee90aad, 0x0000fd1b, 0x37a44abe, 0x02520dc8, 0x0000fab7, 0x0084d396,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x08bf4956, 0x07971e50, 0x00000002, 0x03580eb4, 0x0000fb4a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x36dbeb14, 0x00340d61, 0x0000fb8e, 0xfee90aad, 0x0000fd1b, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3eb05436, 0x371b9cee, 0x04250c3a, 0x0000fa74, 0x02210ecd, 0x0000fa2f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00180c66, 0x0000fa98, 0x00000002, 0xf502ffe6, 0x000005f5, 0xf594fd5f, 0x000006c0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x2490675b, 0x07a25768, 0x00000002, 0xfd5c02ce, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xff860653, 0x0000044c, 0xfe1d0277, 0x000006f1, 0xff0e05b7, 0x00000624, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff0e05b7, 0x00000624, 0x2281e09c, 0x01c90890, 0x000003de, 0xffb20826, 0x0000fe1c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x033f096a, 0x0000fdcb, 0x012a08d3, 0x0000fc85, 0x03860d5e, 0x0000fabf, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0x01c90890, 0x000003de, 0x033f096a, 0x0000fdcb, 0x00005025,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x06210886, 0x0000fc2c, 0x00000002, 0x03860d5e, 0x0000fabf, 0x104667a6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x033f096a, 0x0000fdcb, 0x219fe7c3, 0x06210886, 0x0000fc2c, 0x04430620, 0x0000f937,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x079402e7, 0x0000f90a, 0x05cb00cf, 0x0000f75a, 0x07e5ff60, 0x0000f88a, 0x3df05bf6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x0762f954, 0x0000faf2, 0x0468fa20, 0x0000f91d, 0x0334f6cf, 0x0000fbad, 0x3f389820,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x0425f3c6, 0x0000fa40, 0x0018f39a, 0x0000fa65, 0x0221f133, 0x0000f9fc, 0x15f84d6c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0358f14c, 0x0000fb17, 0x36dbe8ec, 0x051ff2fc, 0x0000fb90, 0x02aaf5b6, 0x0000fc20,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF),
+	0x174248e6, 0x012af72d, 0x0000fc52, 0x1b2a68d4, 0x25e0de94,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x085bbabe, 0x0252f238, 0x0000fa84, 0x0034f29f, 0x0000fb5b, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x079402e7, 0x0000f90a, 0x07e5ff60, 0x0000f88a, 0x1f76c4a0, 0x0979fa5e, 0x0000fcfe,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x00000002, 0x0338092d, 0x0000fbe4, 0x3f1ff823, 0x04430620, 0x0000f937,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00590623, 0x0000fab6, 0x294df615, 0x15f91f7c, 0xfd8a0000, 0x0000f993,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfbdc00a3, 0x0000fd17, 0xfc36fd6b, 0x0000fe02, 0xfacf0086, 0x000002ef, 0xfb93fdfc, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x113b4ff6, 0xfd5cfd32, 0x00000502, 0x00000002, 0x0252f238, 0x0000fa84,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN),
+	0xfffbf695, 0x0000fc62, 0x02aaf5b6, 0x0000fc20, 0x032a0177, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0034f29f, 0x0000fb5b, 0x30af90fb, 0xfee9f553, 0x0000fce7, 0xfe95fa7e, 0x0000fcf1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x11815628, 0xfdc0fb67, 0x00000072, 0xff92f831, 0x000000ac, 0xff86f9ad, 0x0000044c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01c9f770, 0x000003de, 0x00000002, 0x01c9f770, 0x000003de, 0x03e6f68d, 0x0000ffe0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN),
+	0xff92f831, 0x000000ac, 0x033cf69c, 0x0000fd94, 0x3f8fffe0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff86f9ad, 0x0000044c, 0xfdc0fb67, 0x00000072, 0xfd5cfd32, 0x00000502, 0xfb93fdfc, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xfb93fdfc, 0x000002f2, 0xfdc0fb67, 0x00000072, 0xfc36fd6b, 0x0000fe02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfe95fa7e, 0x0000fcf1, 0xfe1dfc4c, 0x0000faa9, 0x004cf9f8, 0x0000faae, 0xfd8a0000, 0x0000f993,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_YZ, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf79b0014, 0xffd60438, 0x0000f94a, 0x02d802cf, 0x0000f7a7, 0x04430620, 0x0000f937,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x05cb00cf, 0x0000f75a, 0x00000002, 0xfee9f553, 0x0000fce7, 0xfeeaf8a6, 0x0000fe09,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x3fb36b5b, 0xff92f831, 0x000000ac, 0x00000002, 0xfacf0086, 0x000002ef,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfbdc00a3, 0x0000fd17, 0xfc850313, 0x0000fe2a, 0xfe1d03b4, 0x0000faa9, 0xfe8c0572, 0x0000fceb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16),
+	0x00590623, 0x0000fab6, 0x3f1ff823, 0x00000002, 0x07e5ff60, 0x0000f88a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0762f954, 0x0000faf2, 0x0979fa5e, 0x0000fcfe, 0x0762f7e9, 0x0000fd57, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0762f954, 0x0000faf2, 0x0334f6cf, 0x0000fbad, 0x0762f7e9, 0x0000fd57, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x03e6f68d, 0x0000ffe0, 0x00000002, 0x004cf9f8, 0x0000faae, 0x02d8fd31, 0x0000f7a7,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_YZ, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00140000, 0x0000f79b, 0xf7080359, 0x02d802cf, 0x0000f7a7, 0x05cb00cf, 0x0000f75a,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0x05cb00cf, 0x0000f75a, 0x03590000, 0x0000f708, 0x3df05bf6,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x02d8fd31, 0x0000f7a7, 0x0468fa20, 0x0000f91d, 0x015af6ef, 0x0000fba0, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x02d8fd31, 0x0000f7a7, 0x004cf9f8, 0x0000faae, 0x015af6ef, 0x0000fba0, 0x0768bc81,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0018f39a, 0x0000fa65, 0xfe95fa7e, 0x0000fcf1, 0x00000002, 0x0358f14c, 0x0000fb17,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x07971db0, 0x26fc4a8b, 0x0425f3c6, 0x0000fa40, 0x0221f133, 0x0000f9fc,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF),
+	0x00000002, 0x0425f3c6, 0x0000fa40, 0x1503eb36, 0x004f65e8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x033cf69c, 0x0000fd94, 0x219fe033, 0x00000002, 0x00c4fe16, 0x0000073b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX10),
+	0x0197fbe9, 0x000008fc, 0x01a00fe8, 0x023023ec, 0x01a04fe8,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x03abfcca, 0x00000922, 0x2194454c, 0x02b9fee8, 0x00000754, 0x3e782f2e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0197fbe9, 0x000008fc, 0x00000002, 0x02b9fee8, 0x00000754, 0x03abfcca, 0x00000922,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0197fbe9, 0x000008fc, 0x3b61ab1e, 0x00000002, 0x04bcfe16, 0x0000073b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_XY, FIFO_VERTEX10, FIFO_VERTEX_XY, FIFO_BEGIN),
+	0x00c4fe16, 0x01a04fe8, 0x00c4fa0a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0x03ab0336, 0x00000922, 0x219446b4, 0x02b90118, 0x00000754, 0x3e782cd2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX10),
+	0x01970417, 0x000008fc, 0x01a00c18, 0x02302014, 0x01a04c18,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_BEGIN, FIFO_VERTEX10),
+	0x03ab0336, 0x00000922, 0x219446b4, 0x00000002, 0x02302014,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0706aa3d, 0x01970417, 0x000008fc, 0x02b90118, 0x00000754, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_XZ, FIFO_VERTEX16, FIFO_VERTEX_XZ),
+	0x04bc01ea, 0x0000073b, 0x068205f6, 0x00c401ea, 0x0000073b, 0x068205f6,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000000, 0x0a23040f, 0x0000fd52, 0x09680375, 0x0000fb34, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x093f0404, 0x000002a2, 0x01c05404, 0x062303ef, 0x0000056d, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3f04bf68, 0x197a2353, 0xfd8a0000, 0x0000f993, 0xfc36fd6b, 0x0000fe02,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfe1dfc4c, 0x0000faa9, 0x004cf9f8, 0x0000faae, 0xfe95fa7e, 0x0000fcf1, 0xff89f770, 0x0000fc16,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x0221f133, 0x0000f9fc, 0x11b4dc19, 0x2e83643b, 0x0334f6cf, 0x0000fbad,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_NOP, FIFO_NOP),
+	0x0425f3c6, 0x0000fa40, 0x15434d1e,
+};
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// Closed hull of 150 triangles (source: 766).
+// 150 triangles in 23 strips, 449 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_SHADOW_LOD1_POLYGONS 150
+#define SUZANNE_SHADOW_LOD1_VERTICES 204
+#define SUZANNE_SHADOW_LOD1_CYCLES 1820
+
+const u32 suzanne_shadow_lod1_commands[] = {
+	449,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xfdb70174, 0x00000868, 0xfd5c02ce, 0x00000502, 0xff0e05b7, 0x00000624,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0xfc850313, 0x0000fe2a, 0xfee5075e, 0x0000fe3d, 0xffd60438, 0x0000f94a, 0x3f1ff823,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x0338092d, 0x0000fbe4, 0x06210886, 0x0000fc2c, 0x033f096a, 0x0000fdcb,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX10),
+	0x062c0894, 0x00000128, 0x01c90890, 0x000003de, 0x00d04c21, 0x01a04c24,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x062303ef, 0x0000056d, 0x08230337, 0x0000086f, 0x01c05404, 0x03f8ffe8, 0x00000912,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX_DIFF),
+	0x0623fc11, 0x0000056d, 0x0823fcc9, 0x0000086f, 0x01a04fdc, 0x100df4fe,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_XY),
+	0xff0efa49, 0x00000624, 0x0099fd54, 0x0000085e, 0xfdb7fe8c, 0x00000868, 0xfdb70174,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_XY, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf74afd57, 0x0000079b, 0xf74a02a9, 0xf594fd5f, 0x000006c0, 0xf5e403cb, 0x000005d4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x334ecf67, 0xfd5c02ce, 0x00000502, 0xfacf0086, 0x000002ef, 0xfc850313, 0x0000fe2a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfd8a0000, 0x0000f993, 0xffd60438, 0x0000f94a, 0x00140000, 0x0000f79b, 0x04430620, 0x0000f937,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x05cb00cf, 0x0000f75a, 0x06210886, 0x0000fc2c, 0x0a23040f, 0x0000fd52, 0x0a280470, 0x0000fffa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0a68feb0, 0x0000fca9, 0x096afe2d, 0x00000324, 0x0a14fb95, 0x00000073, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00d04fdf, 0x01a04fdc, 0x01c9f770, 0x000003de, 0xff0efa49, 0x00000624,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfeeaf8a6, 0x0000fe09, 0xfc36fd6b, 0x0000fe02, 0xfe95fa7e, 0x0000fcf1, 0xfd8a0000, 0x0000f993,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x004cf9f8, 0x0000faae, 0x00140000, 0x0000f79b, 0x0468fa20, 0x0000f91d, 0x05cb00cf, 0x0000f75a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x07e5ff60, 0x0000f88a, 0x0a23040f, 0x0000fd52, 0x0a68feb0, 0x0000fca9, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0823fcc9, 0x0000086f, 0x01e047e0, 0x03f8ffe8, 0x00000912, 0x0099fd54, 0x0000085e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x00b50272, 0x0000086f, 0xfdb70174, 0x00000868, 0xff0e05b7, 0x00000624, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfd5c02ce, 0x00000502, 0xfdb70174, 0x00000868, 0xf5e403cb, 0x000005d4, 0x1c759ade,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x06210886, 0x0000fc2c, 0x0a280470, 0x0000fffa, 0x062c0894, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0x093f0404, 0x000002a2, 0x00d04c21, 0x062303ef, 0x0000056d, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfd8a0000, 0x0000f993, 0xfacf0086, 0x000002ef, 0xfc36fd6b, 0x0000fe02, 0xfb93fdfc, 0x000002f2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF),
+	0xfd5cfd32, 0x00000502, 0xf5adfcba, 0x00000509, 0xf74afd57, 0x0000079b, 0x32592808,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00000002, 0xf594fd5f, 0x000006c0, 0x2490675b, 0xf5970332, 0x00000508,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfacf0086, 0x000002ef, 0x00000002, 0xfc36fd6b, 0x0000fe02, 0xfd5cfd32, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0xfdb7fe8c, 0x00000868, 0x00000002, 0x0a280470, 0x0000fffa,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x096afe2d, 0x00000324, 0x093f0404, 0x000002a2, 0x01c05404, 0x062303ef, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0x03f8ffe8, 0x00000912, 0x00b50272, 0x0000086f, 0x01e04420,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0xff0e05b7, 0x00000624, 0x01a04c24, 0x01c90890, 0x000003de, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff0e05b7, 0x00000624, 0xfee5075e, 0x0000fe3d, 0x01c90890, 0x000003de, 0x033f096a, 0x0000fdcb,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x00000002, 0x01a04c24, 0x08230337, 0x0000086f, 0x01e04420,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x03f8ffe8, 0x00000912, 0x00000002, 0xfeeaf8a6, 0x0000fe09, 0x01c9f770, 0x000003de,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x033cf69c, 0x0000fd94, 0x00d04fdf, 0x062cf76c, 0x00000128, 0x0a14fb95, 0x00000073,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0762f7e9, 0x0000fd57, 0x0979fa5e, 0x0000fcfe, 0x0762f954, 0x0000faf2, 0x07e5ff60, 0x0000f88a,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0468fa20, 0x0000f91d, 0x00000002, 0x0a14fb95, 0x00000073, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0979fa5e, 0x0000fcfe, 0x07e5ff60, 0x0000f88a, 0x00000002, 0x062cf76c, 0x00000128,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x0762f7e9, 0x0000fd57, 0x033cf69c, 0x0000fd94, 0x219fe033, 0x051ff2fc, 0x0000fb90,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0221f133, 0x0000f9fc, 0x0018f39a, 0x0000fa65, 0x0334f6cf, 0x0000fbad, 0xff89f770, 0x0000fc16,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0468fa20, 0x0000f91d, 0x004cf9f8, 0x0000faae, 0x00000002, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_XZ, FIFO_BEGIN),
+	0x0334f6cf, 0x0000fbad, 0x0762f954, 0x0000faf2, 0xfd57f7e9, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x004cf9f8, 0x0000faae, 0xfe95fa7e, 0x0000fcf1, 0xff89f770, 0x0000fc16, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00000002, 0xfe95fa7e, 0x0000fcf1, 0x11815628, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x012af72d, 0x0000fc52, 0x0252f238, 0x0000fa84, 0x051ff2fc, 0x0000fb90, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0x051ff2fc, 0x0000fb90, 0x012af72d, 0x0000fc52, 0x033cf69c, 0x0000fd94,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfeeaf8a6, 0x0000fe09, 0x00000002, 0xfee5075e, 0x0000fe3d, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x033f096a, 0x0000fdcb, 0x03860d5e, 0x0000fabf, 0x0037102d, 0x00340d61, 0x0000fb8e,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_BEGIN),
+	0x2a17b56c, 0x3f1ff823, 0x0338092d, 0x0000fbe4, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x3f1ff823, 0x00340d61, 0x0000fb8e, 0xfee5075e, 0x0000fe3d, 0xfffb096b, 0x0000fc95,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x00000002, 0x033f096a, 0x0000fdcb, 0x3eb05436, 0x0338092d, 0x0000fbe4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x02210ecd, 0x0000fa2f, 0x00000002, 0x00c4fe16, 0x0000073b, 0x0197fbe9, 0x000008fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX_XY, FIFO_VERTEX16, FIFO_VERTEX_XY),
+	0x01a00fe8, 0x04bcfa0a, 0x00c4fe16, 0x0000073b, 0x04bcfe16,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX10),
+	0x0197fbe9, 0x000008fc, 0x01a04fe8, 0x00000002, 0x01a04c18,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX_XZ, FIFO_VERTEX10),
+	0x01970417, 0x000008fc, 0x01a00c18, 0x073b01ea, 0x01a04c18,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_XZ, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x073b01ea, 0x01970417, 0x000008fc, 0x00c401ea, 0x0000073b, 0x00000000,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfb93fdfc, 0x000002f2, 0xfacf0086, 0x000002ef, 0xf5adfcba, 0x00000509, 0xf74afd57, 0x0000079b,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xfdb7fe8c, 0x00000868, 0xfd5cfd32, 0x00000502, 0x096afe2d, 0x00000324, 0x0623fc11, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01c05404, 0x03860d5e, 0x0000fabf, 0xfffb096b, 0x0000fc95, 0x00340d61, 0x0000fb8e,
+};
+// Generated by tools/obj2displaylist from ressources/suzanne_geometry.obj, do not edit.
+// Closed hull of 80 triangles (source: 766).
+// 80 triangles in 10 strips, 231 words.
+// Polygon and vertex RAM use, and estimated geometry engine cycles.
+#define SUZANNE_SHADOW_LOD2_POLYGONS 80
+#define SUZANNE_SHADOW_LOD2_VERTICES 104
+#define SUZANNE_SHADOW_LOD2_CYCLES 930
+
+const u32 suzanne_shadow_lod2_commands[] = {
+	231,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000002, 0xfd5c02ce, 0x00000502, 0xff0e05b7, 0x00000624, 0xfdb70174, 0x00000868,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01a04c24, 0x03f8ffe8, 0x00000912, 0x08230337, 0x0000086f, 0x062303ef, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01a04c24, 0x062c0894, 0x00000128, 0x0338092d, 0x0000fbe4, 0x06210886, 0x0000fc2c,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x04430620, 0x0000f937, 0x05cb00cf, 0x0000f75a, 0xfd8a0000, 0x0000f993, 0x0468fa20, 0x0000f91d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff89f770, 0x0000fc16, 0x0334f6cf, 0x0000fbad, 0x0018f39a, 0x0000fa65, 0x0221f133, 0x0000f9fc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10),
+	0x051ff2fc, 0x0000fb90, 0x0334f6cf, 0x0000fbad, 0xfeeaf8a6, 0x0000fe09, 0x01a04fdc,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0xfdb7fe8c, 0x00000868, 0xfd5cfd32, 0x00000502, 0xf594fd5f, 0x000006c0,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x2490675b, 0xf5e403cb, 0x000005d4, 0xfacf0086, 0x000002ef, 0xfd5c02ce, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xff0e05b7, 0x00000624, 0x00000002, 0xfd5c02ce, 0x00000502, 0xfdb70174, 0x00000868,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf5e403cb, 0x000005d4, 0x1c759ade, 0xf594fd5f, 0x000006c0, 0xfdb70174, 0x00000868,
+	FIFO_COMMAND_PACK(FIFO_VERTEX_XY, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xfdb7fe8c, 0x03f8ffe8, 0x00000912, 0x01a04fdc, 0x0823fcc9, 0x0000086f,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x0623fc11, 0x0000056d, 0x03f8ffe8, 0x00000912, 0x0a14fb95, 0x00000073, 0x062303ef, 0x0000056d,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0x0a23040f, 0x0000fd52, 0x062c0894, 0x00000128, 0x06210886, 0x0000fc2c, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x06210886, 0x0000fc2c, 0x05cb00cf, 0x0000f75a, 0x0a23040f, 0x0000fd52, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x0a14fb95, 0x00000073, 0x0762f954, 0x0000faf2, 0x00d04fdf, 0x0334f6cf, 0x0000fbad,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x01a04fdc, 0x00000002, 0x0334f6cf, 0x0000fbad, 0x0762f954, 0x0000faf2,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0x0468fa20, 0x0000f91d, 0x05cb00cf, 0x0000f75a, 0x00000002, 0x0a14fb95, 0x00000073,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_BEGIN),
+	0x00d04fdf, 0x0623fc11, 0x0000056d, 0x01a04fdc, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0xf5adfcba, 0x00000509, 0xfd5cfd32, 0x00000502, 0xfacf0086, 0x000002ef, 0xfe95fa7e, 0x0000fcf1,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16),
+	0xfd8a0000, 0x0000f993, 0xff89f770, 0x0000fc16, 0x00000002, 0xfd5cfd32, 0x00000502,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0xff0efa49, 0x00000624, 0xfe95fa7e, 0x0000fcf1, 0x11815628, 0x0018f39a, 0x0000fa65,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x051ff2fc, 0x0000fb90, 0x00000002, 0xfacf0086, 0x000002ef, 0xfd8a0000, 0x0000f993,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16),
+	0xffd60438, 0x0000f94a, 0x04430620, 0x0000f937, 0x3f1ff823, 0x0338092d, 0x0000fbe4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX10, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00340d61, 0x0000fb8e, 0x3eb05436, 0xfee5075e, 0x0000fe3d, 0x0338092d, 0x0000fbe4,
+	FIFO_COMMAND_PACK(FIFO_VERTEX10, FIFO_BEGIN, FIFO_VERTEX10, FIFO_VERTEX16),
+	0x01a04c24, 0x00000002, 0x01a04c24, 0xff0e05b7, 0x00000624,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_BEGIN),
+	0xfee5075e, 0x0000fe3d, 0xfacf0086, 0x000002ef, 0xffd60438, 0x0000f94a, 0x00000002,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX_DIFF, FIFO_VERTEX16),
+	0x00340d61, 0x0000fb8e, 0xfee5075e, 0x0000fe3d, 0x20325d6c, 0xffd60438, 0x0000f94a,
+	FIFO_COMMAND_PACK(FIFO_BEGIN, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16),
+	0x00000000, 0x05cb00cf, 0x0000f75a, 0x0762f954, 0x0000faf2, 0x0a68feb0, 0x0000fca9,
+	FIFO_COMMAND_PACK(FIFO_VERTEX16, FIFO_VERTEX16, FIFO_VERTEX16, FIFO_NOP),
+	0xfe95fa7e, 0x0000fcf1, 0x0018f39a, 0x0000fa65, 0xff89f770, 0x0000fc16,
+};
@@ -0,0 +1,1287 @@
+// Compile an OBJ mesh to a geometry engine display list (for glCallList), as a C header.
+// Triangles are chained in strips with the winding preserved, isolated triangles are grouped in a single list.
+// Each vertex uses the smallest vertex command that meets the precision: VTX_DIFF or VTX_XY/XZ/YZ when exact
+// relative to the previous vertex of the strip, VTX_10 when within the requested precision, VTX_16 otherwise.
+// Texture coordinates and normals are only sent when they change.
+// The list is decoded back and compared with the source triangles, and checked against the polygon and vertex
+// RAM limits of the hardware. An estimate of the geometry engine cycles is written with the list.
+// Lower levels of detail are generated by edge collapses down to a number of triangles. For stencil shadows, the mesh
+// can first be turned into a closed hull (positions only, holes filled, checked watertight), and that hull extruded
+// along the light direction into a shadow volume.
+//
+// Usage: obj2displaylist model.obj name scale textureSize [--precision p] [--lights n] [--no-normals] [--no-texcoords]
+//                        [--triangles n] [--hull] [--extrude x y z distance] > name_geometry.h
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+// Hardware limits, per frame.
+#define MAX_POLYGONS 2048
+#define MAX_VERTICES 6144
+// Geometry engine clock, and cycles per frame at 60Hz.
+#define ENGINE_FREQUENCY 33513982
+#define FRAME_CYCLES (ENGINE_FREQUENCY / 60)
+
+// Geometry commands.
+enum CommandId {
+	CMD_NOP = 0x00,
+	CMD_NORMAL = 0x21,
+	CMD_TEX_COORD = 0x22,
+	CMD_VERTEX16 = 0x23,
+	CMD_VERTEX10 = 0x24,
+	CMD_VERTEX_XY = 0x25,
+	CMD_VERTEX_XZ = 0x26,
+	CMD_VERTEX_YZ = 0x27,
+	CMD_VERTEX_DIFF = 0x28,
+	CMD_BEGIN = 0x40,
+};
+
+// Primitive types for BEGIN.
+#define PRIM_TRIANGLES 0
+#define PRIM_TRIANGLE_STRIP 2
+
+struct Vec3 {
+	float x, y, z;
+};
+
+struct Vertex {
+	int v, t, n;
+	bool operator<(const Vertex& o) const {
+		if(v != o.v) return v < o.v;
+		if(t != o.t) return t < o.t;
+		return n < o.n;
+	}
+};
+
+struct Triangle {
+	int v[3];
+};
+
+struct Mesh {
+	std::vector<Vec3> positions;
+	std::vector<Vec3> uvs;
+	std::vector<Vec3> normals;
+	// Welded vertices and indexed triangles, in the winding of the source.
+	std::vector<Vertex> vertices;
+	std::vector<Triangle> triangles;
+};
+
+struct Options {
+	float scale;
+	int textureSize;
+	// Maximum position error allowed for VTX_10, in object units.
+	float precision;
+	int lights;
+	bool normals;
+	bool texcoords;
+	// Maximum triangle count after simplification, 0 to keep the source triangles.
+	unsigned int triangles;
+	bool hull;
+	// Light direction and length of the shadow volume, in object units.
+	bool extrude;
+	Vec3 direction;
+	float distance;
+};
+
+static int parseIndex(const char* str, int count){
+	const int index = atoi(str);
+	return index < 0 ? count + index : index - 1;
+}
+
+static bool loadObj(const char* path, Mesh& mesh){
+	FILE* file = fopen(path, "r");
+	if(!file){
+		return false;
+	}
+	std::map<Vertex, int> welded;
+	char line[512];
+	while(fgets(line, sizeof(line), file)){
+		Vec3 value = {0.0f, 0.0f, 0.0f};
+		if(strncmp(line, "v ", 2) == 0){
+			sscanf(line + 2, "%f %f %f", &value.x, &value.y, &value.z);
+			mesh.positions.push_back(value);
+		} else if(strncmp(line, "vt ", 3) == 0){
+			sscanf(line + 3, "%f %f", &value.x, &value.y);
+			mesh.uvs.push_back(value);
+		} else if(strncmp(line, "vn ", 3) == 0){
+			sscanf(line + 3, "%f %f %f", &value.x, &value.y, &value.z);
+			mesh.normals.push_back(value);
+		} else if(strncmp(line, "f ", 2) == 0){
+			// Faces are triangulated as fans.
+			std::vector<int> face;
+			for(char* token = strtok(line + 2, " \t\r\n"); token; token = strtok(NULL, " \t\r\n")){
+				Vertex vertex = {0, -1, -1};
+				vertex.v = parseIndex(token, mesh.positions.size());
+				char* slash = strchr(token, '/');
+				if(slash){
+					if(slash[1] != '/'){
+						vertex.t = parseIndex(slash + 1, mesh.uvs.size());
+					}
+					slash = strchr(slash + 1, '/');
+					if(slash){
+						vertex.n = parseIndex(slash + 1, mesh.normals.size());
+					}
+				}
+				std::map<Vertex, int>::iterator it = welded.find(vertex);
+				if(it == welded.end()){
+					it = welded.insert(std::make_pair(vertex, (int)mesh.vertices.size())).first;
+					mesh.vertices.push_back(vertex);
+				}
+				face.push_back(it->second);
+			}
+			for(size_t i = 2; i < face.size(); ++i){
+				Triangle triangle = {{face[0], face[i - 1], face[i]}};
+				// Skip degenerate triangles.
+				if(triangle.v[0] != triangle.v[1] && triangle.v[1] != triangle.v[2] && triangle.v[0] != triangle.v[2]){
+					mesh.triangles.push_back(triangle);
+				}
+			}
+		}
+	}
+	fclose(file);
+	return true;
+}
+
+/// Shadow hulls and simplification.
+
+static std::pair<int, int> edgeKey(int a, int b){
+	return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+}
+
+static Vec3 subtract(const Vec3& a, const Vec3& b){
+	Vec3 r = { a.x - b.x, a.y - b.y, a.z - b.z };
+	return r;
+}
+
+static Vec3 cross(const Vec3& a, const Vec3& b){
+	Vec3 r = { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	return r;
+}
+
+static float dot(const Vec3& a, const Vec3& b){
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// Unnormalized normal of a triangle of positions.
+static Vec3 faceNormal(const Vec3& a, const Vec3& b, const Vec3& c){
+	return cross(subtract(b, a), subtract(c, a));
+}
+
+static Vec3 triangleNormal(const Mesh& mesh, const Triangle& triangle){
+	return faceNormal(mesh.positions[mesh.vertices[triangle.v[0]].v], mesh.positions[mesh.vertices[triangle.v[1]].v],
+					  mesh.positions[mesh.vertices[triangle.v[2]].v]);
+}
+
+// Number of triangles using each edge of positions, in each direction.
+static std::map<std::pair<int, int>, int> directedEdges(const Mesh& mesh){
+	std::map<std::pair<int, int>, int> edges;
+	for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+		const Triangle& triangle = mesh.triangles[tid];
+		for(int i = 0; i < 3; ++i){
+			++edges[std::make_pair(mesh.vertices[triangle.v[i]].v, mesh.vertices[triangle.v[(i + 1) % 3]].v)];
+		}
+	}
+	return edges;
+}
+
+// A closed volume uses each edge as many times in both directions, so that the stencil count along any ray is
+// balanced. Manifold hulls have exactly two triangles per edge, shadow volumes can touch themselves along an edge.
+static bool isWatertight(const Mesh& mesh){
+	const std::map<std::pair<int, int>, int> edges = directedEdges(mesh);
+	for(std::map<std::pair<int, int>, int>::const_iterator it = edges.begin(); it != edges.end(); ++it){
+		std::map<std::pair<int, int>, int>::const_iterator twin = edges.find(std::make_pair(it->first.second, it->first.first));
+		if(twin == edges.end() || twin->second != it->second){
+			return false;
+		}
+	}
+	return !mesh.triangles.empty();
+}
+
+// Keep positions only, remove the dangling triangles around non-manifold edges and close the holes
+// with fans around their centroid. Fails if the result is not watertight.
+static bool buildHull(Mesh& mesh){
+	std::vector<Triangle> triangles;
+	for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+		Triangle triangle = mesh.triangles[tid];
+		for(int i = 0; i < 3; ++i){
+			triangle.v[i] = mesh.vertices[triangle.v[i]].v;
+		}
+		if(triangle.v[0] != triangle.v[1] && triangle.v[1] != triangle.v[2] && triangle.v[0] != triangle.v[2]){
+			triangles.push_back(triangle);
+		}
+	}
+	mesh.vertices.clear();
+	for(size_t pid = 0; pid < mesh.positions.size(); ++pid){
+		Vertex vertex = {(int)pid, -1, -1};
+		mesh.vertices.push_back(vertex);
+	}
+	mesh.triangles = triangles;
+
+	// Triangles with both a boundary and a non-manifold edge hang from the surface.
+	for(bool removed = true; removed;){
+		std::map<std::pair<int, int>, int> shared;
+		for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+			const Triangle& triangle = mesh.triangles[tid];
+			for(int i = 0; i < 3; ++i){
+				++shared[edgeKey(triangle.v[i], triangle.v[(i + 1) % 3])];
+			}
+		}
+		removed = false;
+		std::vector<Triangle> kept;
+		for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+			const Triangle& triangle = mesh.triangles[tid];
+			int boundary = 0;
+			int nonManifold = 0;
+			for(int i = 0; i < 3; ++i){
+				const int count = shared[edgeKey(triangle.v[i], triangle.v[(i + 1) % 3])];
+				boundary += count == 1 ? 1 : 0;
+				nonManifold += count > 2 ? 1 : 0;
+			}
+			if((boundary > 0 && nonManifold > 0) || boundary == 3){
+				removed = true;
+			} else {
+				kept.push_back(triangle);
+			}
+		}
+		mesh.triangles = kept;
+	}
+
+	// Boundary edges have no twin, follow them to list the holes.
+	const std::map<std::pair<int, int>, int> edges = directedEdges(mesh);
+	std::multimap<int, int> boundary;
+	for(std::map<std::pair<int, int>, int>::const_iterator it = edges.begin(); it != edges.end(); ++it){
+		if(edges.find(std::make_pair(it->first.second, it->first.first)) == edges.end()){
+			boundary.insert(it->first);
+		}
+	}
+	unsigned int holes = 0;
+	while(!boundary.empty()){
+		std::vector<int> loop(1, boundary.begin()->first);
+		for(;;){
+			std::multimap<int, int>::iterator next = boundary.find(loop.back());
+			if(next == boundary.end()){
+				return false;
+			}
+			const int vertex = next->second;
+			boundary.erase(next);
+			if(vertex == loop.front()){
+				break;
+			}
+			loop.push_back(vertex);
+		}
+		Vec3 centroid = {0.0f, 0.0f, 0.0f};
+		for(size_t i = 0; i < loop.size(); ++i){
+			const Vec3& p = mesh.positions[loop[i]];
+			centroid.x += p.x / loop.size();
+			centroid.y += p.y / loop.size();
+			centroid.z += p.z / loop.size();
+		}
+		const int center = mesh.positions.size();
+		Vertex vertex = {center, -1, -1};
+		mesh.positions.push_back(centroid);
+		mesh.vertices.push_back(vertex);
+		// The fan uses the boundary edges in the opposite direction.
+		for(size_t i = 0; i < loop.size(); ++i){
+			Triangle triangle = {{loop[(i + 1) % loop.size()], loop[i], center}};
+			mesh.triangles.push_back(triangle);
+		}
+		++holes;
+	}
+	fprintf(stderr, "\thull: %u holes closed, %u triangles.\n", holes, (unsigned int)mesh.triangles.size());
+	return isWatertight(mesh);
+}
+
+// Quadric error of a position, as the symmetric matrix of the sum of squared distances to planes.
+struct Quadric {
+	double q[10];
+};
+
+static void addPlane(Quadric& quadric, const Vec3& normal, double d, double weight){
+	const double p[4] = { normal.x, normal.y, normal.z, d };
+	int k = 0;
+	for(int i = 0; i < 4; ++i){
+		for(int j = i; j < 4; ++j){
+			quadric.q[k++] += weight * p[i] * p[j];
+		}
+	}
+}
+
+static double quadricError(const Quadric& a, const Quadric& b, const Vec3& v){
+	const double p[4] = { v.x, v.y, v.z, 1.0 };
+	double error = 0.0;
+	int k = 0;
+	for(int i = 0; i < 4; ++i){
+		for(int j = i; j < 4; ++j){
+			error += (i == j ? 1.0 : 2.0) * (a.q[k] + b.q[k]) * p[i] * p[j];
+			++k;
+		}
+	}
+	return error;
+}
+
+struct Simplifier {
+	const Mesh* mesh;
+	std::vector<Triangle> triangles;
+	std::vector<bool> alive;
+	// Triangles using each position, including removed ones.
+	std::vector<std::vector<int> > incident;
+	std::vector<Quadric> quadrics;
+	// Positions on a boundary or a non-manifold edge are never moved.
+	std::vector<bool> locked;
+	// Closed volumes can change topology (merge or cut thin parts), as long as each edge stays balanced.
+	bool closed;
+	// Cheapest collapse of each position, and its cost (negative if none).
+	std::vector<int> target;
+	std::vector<double> cost;
+
+	int position(int tid, int i) const {
+		return mesh->vertices[triangles[tid].v[i]].v;
+	}
+
+	int corner(int tid, int pid) const {
+		for(int i = 0; i < 3; ++i){
+			if(position(tid, i) == pid){
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	std::vector<int> neighbours(int pid) const {
+		std::vector<int> result;
+		for(size_t j = 0; j < incident[pid].size(); ++j){
+			const int tid = incident[pid][j];
+			for(int i = 0; alive[tid] && i < 3; ++i){
+				const int other = position(tid, i);
+				if(other != pid && std::find(result.begin(), result.end(), other) == result.end()){
+					result.push_back(other);
+				}
+			}
+		}
+		return result;
+	}
+
+	// Vertices that replace the ones at a when it is moved onto b. Returns false if the collapse is rejected.
+	bool replacements(int a, int b, std::map<int, int>& replaced) const {
+		std::vector<int> shared;
+		std::vector<int> opposite;
+		for(size_t j = 0; j < incident[a].size(); ++j){
+			const int tid = incident[a][j];
+			if(!alive[tid] || corner(tid, b) < 0){
+				continue;
+			}
+			shared.push_back(tid);
+			for(int i = 0; i < 3; ++i){
+				if(position(tid, i) != a && position(tid, i) != b){
+					opposite.push_back(position(tid, i));
+				}
+			}
+		}
+		if(!closed && shared.size() != 2){
+			return false;
+		}
+		// Link condition: the only common neighbours are the opposite vertices of the two shared triangles,
+		// else the collapse would create non-manifold edges.
+		const std::vector<int> neighboursA = neighbours(a);
+		const std::vector<int> neighboursB = closed ? std::vector<int>() : neighbours(b);
+		for(size_t j = 0; j < neighboursA.size(); ++j){
+			const int common = neighboursA[j];
+			if(std::find(neighboursB.begin(), neighboursB.end(), common) != neighboursB.end()
+			   && std::find(opposite.begin(), opposite.end(), common) == opposite.end()){
+				return false;
+			}
+		}
+		// The shared triangles give the attributes of b that replace those of a. On a texture seam, a can only
+		// slide along the seam: each of its vertices must be in a shared triangle, on its side of the seam.
+		replaced.clear();
+		for(size_t j = 0; j < shared.size(); ++j){
+			const int from = triangles[shared[j]].v[corner(shared[j], a)];
+			const int to = triangles[shared[j]].v[corner(shared[j], b)];
+			std::map<int, int>::const_iterator it = replaced.find(from);
+			if(it != replaced.end() && it->second != to){
+				return false;
+			}
+			replaced[from] = to;
+		}
+		// Reject collapses that flip or fold a remaining triangle.
+		const Vec3& destination = mesh->positions[b];
+		for(size_t j = 0; j < incident[a].size(); ++j){
+			const int tid = incident[a][j];
+			if(!alive[tid] || std::find(shared.begin(), shared.end(), tid) != shared.end()){
+				continue;
+			}
+			if(replaced.find(triangles[tid].v[corner(tid, a)]) == replaced.end()){
+				return false;
+			}
+			Vec3 p[3];
+			for(int i = 0; i < 3; ++i){
+				p[i] = mesh->positions[position(tid, i)];
+			}
+			const Vec3 before = faceNormal(p[0], p[1], p[2]);
+			p[corner(tid, a)] = destination;
+			const Vec3 after = faceNormal(p[0], p[1], p[2]);
+			const float lengths = std::sqrt(dot(before, before) * dot(after, after));
+			if(lengths <= 0.0f || dot(before, after) < 0.25f * lengths){
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void update(int a){
+		target[a] = -1;
+		cost[a] = -1.0;
+		if(locked[a]){
+			return;
+		}
+		const std::vector<int> candidates = neighbours(a);
+		std::map<int, int> replaced;
+		for(size_t j = 0; j < candidates.size(); ++j){
+			const int b = candidates[j];
+			const double error = quadricError(quadrics[a], quadrics[b], mesh->positions[b]);
+			if((target[a] < 0 || error < cost[a]) && replacements(a, b, replaced)){
+				target[a] = b;
+				cost[a] = error;
+			}
+		}
+	}
+};
+
+// Move vertices onto one of their neighbours, cheapest quadric error first, until at most target triangles
+// remain. Collapses that would flip a triangle or cross a texture seam are rejected, so seams keep their texture
+// coordinates on both sides. Collapses that change the topology are rejected too, except for closed volumes:
+// moving a vertex removes or moves edges in both directions at once, so the volume stays closed, and pairs of
+// opposite triangles created by pinching a thin part are removed.
+static void decimate(Mesh& mesh, size_t targetCount, bool closed){
+	Simplifier simplifier;
+	simplifier.mesh = &mesh;
+	simplifier.closed = closed;
+	simplifier.triangles = mesh.triangles;
+	simplifier.alive.assign(mesh.triangles.size(), true);
+	const int positionCount = mesh.positions.size();
+	simplifier.incident.resize(positionCount);
+	Quadric zero;
+	memset(&zero, 0, sizeof(Quadric));
+	simplifier.quadrics.assign(positionCount, zero);
+	simplifier.locked.assign(positionCount, false);
+	simplifier.target.assign(positionCount, -1);
+	simplifier.cost.assign(positionCount, -1.0);
+
+	std::map<std::pair<int, int>, int> shared;
+	for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+		const Triangle& triangle = mesh.triangles[tid];
+		const Vec3 normal = triangleNormal(mesh, triangle);
+		const float area = std::sqrt(dot(normal, normal));
+		if(area > 0.0f){
+			const Vec3 unit = { normal.x / area, normal.y / area, normal.z / area };
+			const double d = -dot(unit, mesh.positions[simplifier.position(tid, 0)]);
+			for(int i = 0; i < 3; ++i){
+				addPlane(simplifier.quadrics[simplifier.position(tid, i)], unit, d, area);
+			}
+		}
+		for(int i = 0; i < 3; ++i){
+			const int pid = simplifier.position(tid, i);
+			simplifier.incident[pid].push_back(tid);
+			++shared[edgeKey(pid, simplifier.position(tid, (i + 1) % 3))];
+		}
+	}
+	for(std::map<std::pair<int, int>, int>::const_iterator it = shared.begin(); it != shared.end(); ++it){
+		if(!closed && it->second != 2){
+			simplifier.locked[it->first.first] = simplifier.locked[it->first.second] = true;
+		}
+	}
+	for(int pid = 0; pid < positionCount; ++pid){
+		simplifier.update(pid);
+	}
+
+	size_t remaining = mesh.triangles.size();
+	while(remaining > targetCount){
+		int a = -1;
+		for(int pid = 0; pid < positionCount; ++pid){
+			if(simplifier.target[pid] >= 0 && (a < 0 || simplifier.cost[pid] < simplifier.cost[a])){
+				a = pid;
+			}
+		}
+		if(a < 0){
+			break;
+		}
+		const int b = simplifier.target[a];
+		std::map<int, int> replaced;
+		simplifier.replacements(a, b, replaced);
+		for(size_t j = 0; j < simplifier.incident[a].size(); ++j){
+			const int tid = simplifier.incident[a][j];
+			if(!simplifier.alive[tid]){
+				continue;
+			}
+			if(simplifier.corner(tid, b) >= 0){
+				simplifier.alive[tid] = false;
+				--remaining;
+			} else {
+				int& vertex = simplifier.triangles[tid].v[simplifier.corner(tid, a)];
+				vertex = replaced[vertex];
+				simplifier.incident[b].push_back(tid);
+			}
+		}
+		simplifier.incident[a].clear();
+		for(size_t j = 0; closed && j < simplifier.incident[b].size(); ++j){
+			const int tid = simplifier.incident[b][j];
+			for(size_t k = j + 1; simplifier.alive[tid] && k < simplifier.incident[b].size(); ++k){
+				const int other = simplifier.incident[b][k];
+				const Triangle& t = simplifier.triangles[tid];
+				const Triangle& o = simplifier.triangles[other];
+				const int start = simplifier.corner(other, simplifier.position(tid, 0));
+				if(other == tid || !simplifier.alive[other] || start < 0){
+					continue;
+				}
+				if(o.v[(start + 2) % 3] == t.v[1] && o.v[(start + 1) % 3] == t.v[2]){
+					simplifier.alive[tid] = simplifier.alive[other] = false;
+					remaining -= 2;
+				}
+			}
+		}
+		for(int k = 0; k < 10; ++k){
+			simplifier.quadrics[b].q[k] += simplifier.quadrics[a].q[k];
+		}
+		simplifier.target[a] = -1;
+		// Only the collapses around b have changed.
+		simplifier.update(b);
+		const std::vector<int> around = simplifier.neighbours(b);
+		for(size_t j = 0; j < around.size(); ++j){
+			simplifier.update(around[j]);
+		}
+	}
+
+	const size_t sourceCount = mesh.triangles.size();
+	mesh.triangles.clear();
+	for(size_t tid = 0; tid < simplifier.triangles.size(); ++tid){
+		if(simplifier.alive[tid]){
+			mesh.triangles.push_back(simplifier.triangles[tid]);
+		}
+	}
+	fprintf(stderr, "\tsimplified from %u to %u triangles.\n", (unsigned int)sourceCount, (unsigned int)mesh.triangles.size());
+}
+
+// Replace a hull by its shadow volume for a directional light: the faces turned away from the light, pushed a bit
+// along it so that they do not shadow the object itself, then the same faces moved by the extrusion distance,
+// joined by quads along the silhouette edges. Each dark face is a closed prism, the quads between two dark faces
+// cancel out, the remaining ones are on the silhouette.
+static bool extrudeHull(Mesh& mesh, const Vec3& direction, float distance){
+	const float length = std::sqrt(dot(direction, direction));
+	const Vec3 unit = { direction.x / length, direction.y / length, direction.z / length };
+	const float offset = distance / 256.0f;
+	const int positionCount = mesh.positions.size();
+	std::vector<int> near(positionCount, -1);
+	std::vector<int> far(positionCount, -1);
+	std::vector<bool> dark(mesh.triangles.size(), false);
+	for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+		const Triangle& triangle = mesh.triangles[tid];
+		dark[tid] = dot(triangleNormal(mesh, triangle), unit) > 0.0f;
+		for(int i = 0; dark[tid] && i < 3; ++i){
+			const int pid = triangle.v[i];
+			if(near[pid] >= 0){
+				continue;
+			}
+			const Vec3& p = mesh.positions[pid];
+			const Vec3 pushed = { p.x + offset * unit.x, p.y + offset * unit.y, p.z + offset * unit.z };
+			const Vec3 moved = { p.x + distance * unit.x, p.y + distance * unit.y, p.z + distance * unit.z };
+			near[pid] = mesh.positions.size();
+			mesh.positions.push_back(pushed);
+			far[pid] = mesh.positions.size();
+			mesh.positions.push_back(moved);
+		}
+	}
+	for(size_t pid = mesh.vertices.size(); pid < mesh.positions.size(); ++pid){
+		Vertex vertex = {(int)pid, -1, -1};
+		mesh.vertices.push_back(vertex);
+	}
+
+	std::vector<Triangle> volume;
+	// Prism sides along each edge, positive from the lower to the higher index.
+	std::map<std::pair<int, int>, int> sides;
+	for(size_t tid = 0; tid < mesh.triangles.size(); ++tid){
+		if(!dark[tid]){
+			continue;
+		}
+		const Triangle& triangle = mesh.triangles[tid];
+		const int* v = triangle.v;
+		// The near cap faces the light, the far cap faces away from it.
+		Triangle nearCap = {{near[v[0]], near[v[2]], near[v[1]]}};
+		Triangle farCap = {{far[v[0]], far[v[1]], far[v[2]]}};
+		volume.push_back(nearCap);
+		volume.push_back(farCap);
+		for(int i = 0; i < 3; ++i){
+			const int a = v[i];
+			const int b = v[(i + 1) % 3];
+			sides[edgeKey(a, b)] += a < b ? 1 : -1;
+		}
+	}
+	unsigned int silhouette = 0;
+	for(std::map<std::pair<int, int>, int>::const_iterator it = sides.begin(); it != sides.end(); ++it){
+		const int a = it->second > 0 ? it->first.first : it->first.second;
+		const int b = it->second > 0 ? it->first.second : it->first.first;
+		for(int i = 0; i < std::abs(it->second); ++i){
+			Triangle first = {{near[a], near[b], far[b]}};
+			Triangle second = {{near[a], far[b], far[a]}};
+			volume.push_back(first);
+			volume.push_back(second);
+			++silhouette;
+		}
+	}
+	mesh.triangles = volume;
+	fprintf(stderr, "\tshadow volume: %u silhouette edges, %u triangles.\n", silhouette, (unsigned int)mesh.triangles.size());
+	return isWatertight(mesh);
+}
+
+/// Quantized attributes.
+
+struct Attributes {
+	// 4.12 fixed point position.
+	int position[3];
+	// 12.4 fixed point texel coordinates.
+	int texcoord[2];
+	// 1.9 fixed point normal.
+	int normal[3];
+};
+
+static int toFixed(float value, float one, int minimum, int maximum){
+	const int fixed = (int)lroundf(value * one);
+	return std::min(std::max(fixed, minimum), maximum);
+}
+
+static std::vector<Attributes> quantize(const Mesh& mesh, const Options& options){
+	std::vector<Attributes> attributes(mesh.vertices.size());
+	for(size_t i = 0; i < mesh.vertices.size(); ++i){
+		const Vertex& vertex = mesh.vertices[i];
+		Attributes& attribute = attributes[i];
+		const Vec3& p = mesh.positions[vertex.v];
+		attribute.position[0] = toFixed(options.scale * p.x, 4096.0f, -32768, 32767);
+		attribute.position[1] = toFixed(options.scale * p.y, 4096.0f, -32768, 32767);
+		attribute.position[2] = toFixed(options.scale * p.z, 4096.0f, -32768, 32767);
+		const Vec3 uv = vertex.t >= 0 ? mesh.uvs[vertex.t] : Vec3();
+		attribute.texcoord[0] = toFixed(uv.x * options.textureSize, 16.0f, -32768, 32767);
+		attribute.texcoord[1] = toFixed(uv.y * options.textureSize, 16.0f, -32768, 32767);
+		const Vec3 n = vertex.n >= 0 ? mesh.normals[vertex.n] : Vec3();
+		attribute.normal[0] = toFixed(n.x, 512.0f, -512, 511);
+		attribute.normal[1] = toFixed(n.y, 512.0f, -512, 511);
+		attribute.normal[2] = toFixed(n.z, 512.0f, -512, 511);
+	}
+	return attributes;
+}
+
+/// Stripification.
+
+struct Adjacency {
+	// Triangles sharing each edge.
+	std::map<std::pair<int, int>, std::vector<int> > edges;
+	std::vector<bool> used;
+};
+
+static bool hasDirectedEdge(const Triangle& triangle, int a, int b){
+	for(int i = 0; i < 3; ++i){
+		if(triangle.v[i] == a && triangle.v[(i + 1) % 3] == b){
+			return true;
+		}
+	}
+	return false;
+}
+
+static int thirdVertex(const Triangle& triangle, int a, int b){
+	for(int i = 0; i < 3; ++i){
+		if(triangle.v[i] != a && triangle.v[i] != b){
+			return triangle.v[i];
+		}
+	}
+	return -1;
+}
+
+static int freeNeighbours(const Mesh& mesh, const Adjacency& adjacency, int tid){
+	int count = 0;
+	const Triangle& triangle = mesh.triangles[tid];
+	for(int i = 0; i < 3; ++i){
+		const std::vector<int>& shared = adjacency.edges.find(edgeKey(triangle.v[i], triangle.v[(i + 1) % 3]))->second;
+		for(size_t j = 0; j < shared.size(); ++j){
+			count += (shared[j] != tid && !adjacency.used[shared[j]]) ? 1 : 0;
+		}
+	}
+	return count;
+}
+
+// Extend a strip from its last edge. In a strip, triangle k is (k, k+1, k+2) for even k and (k+1, k, k+2) for odd k,
+// so the next triangle has to contain the last edge in the matching direction to keep its winding.
+static void extendStrip(const Mesh& mesh, Adjacency& adjacency, std::vector<int>& strip, std::vector<int>& triangles){
+	for(;;){
+		const size_t n = strip.size();
+		const bool even = ((n - 2) % 2) == 0;
+		const int a = even ? strip[n - 2] : strip[n - 1];
+		const int b = even ? strip[n - 1] : strip[n - 2];
+		const std::vector<int>& shared = adjacency.edges[edgeKey(a, b)];
+		int best = -1;
+		int bestScore = 0;
+		for(size_t j = 0; j < shared.size(); ++j){
+			const int tid = shared[j];
+			if(adjacency.used[tid] || !hasDirectedEdge(mesh.triangles[tid], a, b)){
+				continue;
+			}
+			const int score = freeNeighbours(mesh, adjacency, tid);
+			if(best < 0 || score < bestScore){
+				best = tid;
+				bestScore = score;
+			}
+		}
+		if(best < 0){
+			return;
+		}
+		adjacency.used[best] = true;
+		triangles.push_back(best);
+		strip.push_back(thirdVertex(mesh.triangles[best], a, b));
+	}
+}
+
+static std::vector<std::vector<int> > buildStrips(const Mesh& mesh){
+	Adjacency adjacency;
+	const int triangleCount = mesh.triangles.size();
+	adjacency.used.assign(triangleCount, false);
+	for(int tid = 0; tid < triangleCount; ++tid){
+		const Triangle& triangle = mesh.triangles[tid];
+		for(int i = 0; i < 3; ++i){
+			adjacency.edges[edgeKey(triangle.v[i], triangle.v[(i + 1) % 3])].push_back(tid);
+		}
+	}
+
+	std::vector<std::vector<int> > strips;
+	int remaining = triangleCount;
+	while(remaining > 0){
+		// Start from the free triangle with the fewest free neighbours.
+		int start = -1;
+		int startScore = 0;
+		for(int tid = 0; tid < triangleCount; ++tid){
+			if(adjacency.used[tid]){
+				continue;
+			}
+			const int score = freeNeighbours(mesh, adjacency, tid);
+			if(start < 0 || score < startScore){
+				start = tid;
+				startScore = score;
+			}
+		}
+		// Try the three rotations of the first triangle, keep the longest strip.
+		std::vector<int> bestStrip;
+		std::vector<int> bestTriangles;
+		for(int rotation = 0; rotation < 3; ++rotation){
+			const Triangle& triangle = mesh.triangles[start];
+			std::vector<int> strip;
+			for(int i = 0; i < 3; ++i){
+				strip.push_back(triangle.v[(rotation + i) % 3]);
+			}
+			std::vector<int> triangles(1, start);
+			adjacency.used[start] = true;
+			extendStrip(mesh, adjacency, strip, triangles);
+			if(triangles.size() > bestTriangles.size()){
+				bestStrip = strip;
+				bestTriangles = triangles;
+			}
+			for(size_t j = 0; j < triangles.size(); ++j){
+				adjacency.used[triangles[j]] = false;
+			}
+		}
+		for(size_t j = 0; j < bestTriangles.size(); ++j){
+			adjacency.used[bestTriangles[j]] = true;
+		}
+		remaining -= bestTriangles.size();
+		strips.push_back(bestStrip);
+	}
+	return strips;
+}
+
+/// Display list.
+
+struct Command {
+	CommandId id;
+	std::vector<uint32_t> params;
+	// Vertex emitted by the command, -1 if none.
+	int vertex;
+};
+
+struct Stats {
+	unsigned int polygons;
+	// Vertices stored in vertex RAM (shared along strips).
+	unsigned int vertices;
+	unsigned int strips;
+	unsigned int vertexCommands[CMD_VERTEX_DIFF + 1];
+	unsigned int attributeCommands;
+	unsigned int skippedAttributes;
+	unsigned long cycles;
+	unsigned int words;
+};
+
+static int commandCycles(CommandId id, const Options& options){
+	// From the documented geometry command timings.
+	switch(id){
+		case CMD_NORMAL: return 8 + options.lights;
+		case CMD_TEX_COORD: return 1;
+		case CMD_VERTEX16: return 9;
+		case CMD_VERTEX10:
+		case CMD_VERTEX_XY:
+		case CMD_VERTEX_XZ:
+		case CMD_VERTEX_YZ:
+		case CMD_VERTEX_DIFF: return 8;
+		case CMD_BEGIN: return 1;
+		default: return 0;
+	}
+}
+
+static int paramCount(CommandId id){
+	switch(id){
+		case CMD_VERTEX16: return 2;
+		case CMD_NOP: return 0;
+		default: return 1;
+	}
+}
+
+static uint32_t pack16(int a, int b){
+	return (uint32_t)(a & 0xFFFF) | ((uint32_t)(b & 0xFFFF) << 16);
+}
+
+static uint32_t pack10(int a, int b, int c){
+	return (uint32_t)(a & 0x3FF) | ((uint32_t)(b & 0x3FF) << 10) | ((uint32_t)(c & 0x3FF) << 20);
+}
+
+// Pick the smallest vertex command for a position, given the previous one in the strip (or NULL).
+static Command vertexCommand(const int* position, const int* previous, const Options& options){
+	Command command;
+	command.vertex = -1;
+	if(previous){
+		const int d[3] = { position[0] - previous[0], position[1] - previous[1], position[2] - previous[2] };
+		if(d[0] >= -512 && d[0] < 512 && d[1] >= -512 && d[1] < 512 && d[2] >= -512 && d[2] < 512){
+			command.id = CMD_VERTEX_DIFF;
+			command.params.push_back(pack10(d[0], d[1], d[2]));
+			return command;
+		}
+		if(d[2] == 0){
+			command.id = CMD_VERTEX_XY;
+			command.params.push_back(pack16(position[0], position[1]));
+			return command;
+		}
+		if(d[1] == 0){
+			command.id = CMD_VERTEX_XZ;
+			command.params.push_back(pack16(position[0], position[2]));
+			return command;
+		}
+		if(d[0] == 0){
+			command.id = CMD_VERTEX_YZ;
+			command.params.push_back(pack16(position[1], position[2]));
+			return command;
+		}
+	}
+	// 3.6 fixed point, 64 units of 4.12.
+	const int tolerance = (int)(options.precision * 4096.0f);
+	bool fits = true;
+	int v10[3];
+	for(int i = 0; i < 3; ++i){
+		v10[i] = (int)lroundf((float)position[i] / 64.0f);
+		fits = fits && v10[i] >= -512 && v10[i] < 512 && std::abs(v10[i] * 64 - position[i]) <= tolerance;
+	}
+	if(fits){
+		command.id = CMD_VERTEX10;
+		command.params.push_back(pack10(v10[0], v10[1], v10[2]));
+		return command;
+	}
+	command.id = CMD_VERTEX16;
+	command.params.push_back(pack16(position[0], position[1]));
+	command.params.push_back(pack16(position[2], 0));
+	return command;
+}
+
+// Emit the attributes that changed, then the vertex.
+static void emitVertex(int vid, const std::vector<Attributes>& attributes, const Options& options, const int*& previous,
+					   const Attributes*& current, std::vector<Command>& commands, Stats& stats){
+	const Attributes& attribute = attributes[vid];
+	if(options.texcoords){
+		if(!current || current->texcoord[0] != attribute.texcoord[0] || current->texcoord[1] != attribute.texcoord[1]){
+			Command command = { CMD_TEX_COORD, std::vector<uint32_t>(1, pack16(attribute.texcoord[0], attribute.texcoord[1])), -1 };
+			commands.push_back(command);
+			++stats.attributeCommands;
+		} else {
+			++stats.skippedAttributes;
+		}
+	}
+	if(options.normals){
+		if(!current || memcmp(current->normal, attribute.normal, sizeof(attribute.normal)) != 0){
+			Command command = { CMD_NORMAL, std::vector<uint32_t>(1, pack10(attribute.normal[0], attribute.normal[1], attribute.normal[2])), -1 };
+			commands.push_back(command);
+			++stats.attributeCommands;
+		} else {
+			++stats.skippedAttributes;
+		}
+	}
+	Command command = vertexCommand(attribute.position, previous, options);
+	command.vertex = vid;
+	commands.push_back(command);
+	++stats.vertexCommands[command.id];
+	previous = attribute.position;
+	current = &attribute;
+}
+
+static std::vector<Command> buildCommands(const std::vector<std::vector<int> >& strips,
+										  const std::vector<Attributes>& attributes, const Options& options, Stats& stats){
+	std::vector<Command> commands;
+	const Attributes* current = NULL;
+	// Strips of at least two triangles, the others are grouped in a list.
+	std::vector<int> isolated;
+	for(size_t sid = 0; sid < strips.size(); ++sid){
+		const std::vector<int>& strip = strips[sid];
+		if(strip.size() < 4){
+			isolated.insert(isolated.end(), strip.begin(), strip.end());
+			continue;
+		}
+		Command begin = { CMD_BEGIN, std::vector<uint32_t>(1, PRIM_TRIANGLE_STRIP), -1 };
+		commands.push_back(begin);
+		// Relative vertex commands are only used inside a strip.
+		const int* previous = NULL;
+		for(size_t i = 0; i < strip.size(); ++i){
+			emitVertex(strip[i], attributes, options, previous, current, commands, stats);
+		}
+		stats.polygons += strip.size() - 2;
+		stats.vertices += strip.size();
+		++stats.strips;
+	}
+	if(!isolated.empty()){
+		Command begin = { CMD_BEGIN, std::vector<uint32_t>(1, PRIM_TRIANGLES), -1 };
+		commands.push_back(begin);
+		const int* previous = NULL;
+		for(size_t i = 0; i < isolated.size(); ++i){
+			emitVertex(isolated[i], attributes, options, previous, current, commands, stats);
+		}
+		stats.polygons += isolated.size() / 3;
+		stats.vertices += isolated.size();
+	}
+	for(size_t cid = 0; cid < commands.size(); ++cid){
+		stats.cycles += commandCycles(commands[cid].id, options);
+	}
+	return commands;
+}
+
+// Pack commands four by four, each pack followed by the parameters of its commands.
+static std::vector<Command> padCommands(const std::vector<Command>& commands){
+	std::vector<Command> padded = commands;
+	while(padded.size() % 4 != 0){
+		Command nop = { CMD_NOP, std::vector<uint32_t>(), -1 };
+		padded.push_back(nop);
+	}
+	return padded;
+}
+
+/// Verification.
+
+static int signExtend(uint32_t value, int bits){
+	const int shift = 32 - bits;
+	return ((int32_t)(value << shift)) >> shift;
+}
+
+// Decode the packed words as the geometry engine would, and compare the triangles with the source.
+static bool checkList(const Mesh& mesh, const std::vector<Attributes>& attributes, const std::vector<Command>& padded,
+					  const std::vector<uint32_t>& words, const Options& options){
+	std::vector<Triangle> decoded;
+	std::vector<int> primitive;
+	int type = -1;
+	int position[3] = {0, 0, 0};
+	uint32_t texcoord = 0;
+	uint32_t normal = 0;
+	const int tolerance = (int)(options.precision * 4096.0f);
+	size_t commandIndex = 0;
+	size_t w = 0;
+	while(w < words.size()){
+		const uint32_t pack = words[w++];
+		for(int c = 0; c < 4; ++c, ++commandIndex){
+			const CommandId id = (CommandId)((pack >> (8 * c)) & 0xFF);
+			const int count = paramCount(id);
+			if(w + count > words.size()){
+				return false;
+			}
+			const uint32_t* params = &words[w];
+			w += count;
+			switch(id){
+				case CMD_BEGIN:
+					type = params[0];
+					primitive.clear();
+					break;
+				case CMD_TEX_COORD:
+					texcoord = params[0];
+					break;
+				case CMD_NORMAL:
+					normal = params[0];
+					break;
+				case CMD_VERTEX16:
+					position[0] = signExtend(params[0], 16);
+					position[1] = signExtend(params[0] >> 16, 16);
+					position[2] = signExtend(params[1], 16);
+					break;
+				case CMD_VERTEX10:
+					position[0] = signExtend(params[0], 10) * 64;
+					position[1] = signExtend(params[0] >> 10, 10) * 64;
+					position[2] = signExtend(params[0] >> 20, 10) * 64;
+					break;
+				case CMD_VERTEX_XY:
+					position[0] = signExtend(params[0], 16);
+					position[1] = signExtend(params[0] >> 16, 16);
+					break;
+				case CMD_VERTEX_XZ:
+					position[0] = signExtend(params[0], 16);
+					position[2] = signExtend(params[0] >> 16, 16);
+					break;
+				case CMD_VERTEX_YZ:
+					position[1] = signExtend(params[0], 16);
+					position[2] = signExtend(params[0] >> 16, 16);
+					break;
+				case CMD_VERTEX_DIFF:
+					position[0] += signExtend(params[0], 10);
+					position[1] += signExtend(params[0] >> 10, 10);
+					position[2] += signExtend(params[0] >> 20, 10);
+					break;
+				default:
+					break;
+			}
+			if(id < CMD_VERTEX16 || id > CMD_VERTEX_DIFF){
+				continue;
+			}
+			// Compare the vertex state with the source vertex.
+			const int vid = padded[commandIndex].vertex;
+			const Attributes& reference = attributes[vid];
+			for(int i = 0; i < 3; ++i){
+				if(std::abs(position[i] - reference.position[i]) > tolerance){
+					return false;
+				}
+			}
+			if(options.texcoords && texcoord != pack16(reference.texcoord[0], reference.texcoord[1])){
+				return false;
+			}
+			if(options.normals && normal != pack10(reference.normal[0], reference.normal[1], reference.normal[2])){
+				return false;
+			}
+			// Assemble triangles.
+			primitive.push_back(vid);
+			const size_t n = primitive.size();
+			if(type == PRIM_TRIANGLES && n % 3 == 0){
+				Triangle triangle = {{primitive[n - 3], primitive[n - 2], primitive[n - 1]}};
+				decoded.push_back(triangle);
+			} else if(type == PRIM_TRIANGLE_STRIP && n >= 3){
+				const bool even = ((n - 3) % 2) == 0;
+				Triangle triangle = {{primitive[even ? n - 3 : n - 2], primitive[even ? n - 2 : n - 3], primitive[n - 1]}};
+				decoded.push_back(triangle);
+			}
+		}
+	}
+
+	// Compare the triangles, with their winding.
+	struct {
+		Triangle operator()(Triangle t) const {
+			const int first = std::min_element(t.v, t.v + 3) - t.v;
+			Triangle r = {{t.v[first], t.v[(first + 1) % 3], t.v[(first + 2) % 3]}};
+			return r;
+		}
+	} rotate;
+	struct {
+		bool operator()(const Triangle& a, const Triangle& b) const {
+			return std::lexicographical_compare(a.v, a.v + 3, b.v, b.v + 3);
+		}
+	} compare;
+	std::vector<Triangle> reference;
+	for(size_t i = 0; i < mesh.triangles.size(); ++i){
+		reference.push_back(rotate(mesh.triangles[i]));
+	}
+	for(size_t i = 0; i < decoded.size(); ++i){
+		decoded[i] = rotate(decoded[i]);
+	}
+	if(decoded.size() != reference.size()){
+		return false;
+	}
+	std::sort(decoded.begin(), decoded.end(), compare);
+	std::sort(reference.begin(), reference.end(), compare);
+	for(size_t i = 0; i < decoded.size(); ++i){
+		if(!std::equal(decoded[i].v, decoded[i].v + 3, reference[i].v)){
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Output.
+
+static const char* commandName(CommandId id){
+	switch(id){
+		case CMD_NORMAL: return "FIFO_NORMAL";
+		case CMD_TEX_COORD: return "FIFO_TEX_COORD";
+		case CMD_VERTEX16: return "FIFO_VERTEX16";
+		case CMD_VERTEX10: return "FIFO_VERTEX10";
+		case CMD_VERTEX_XY: return "FIFO_VERTEX_XY";
+		case CMD_VERTEX_XZ: return "FIFO_VERTEX_XZ";
+		case CMD_VERTEX_YZ: return "FIFO_VERTEX_YZ";
+		case CMD_VERTEX_DIFF: return "FIFO_VERTEX_DIFF";
+		case CMD_BEGIN: return "FIFO_BEGIN";
+		default: return "FIFO_NOP";
+	}
+}
+
+int main(int argc, char** argv){
+	if(argc < 5){
+		fprintf(stderr, "Usage: obj2displaylist model.obj name scale textureSize [--precision p] [--lights n] [--no-normals] [--no-texcoords]"
+				" [--triangles n] [--hull] [--extrude x y z distance]\n");
+		return 1;
+	}
+	const char* name = argv[2];
+	Options options;
+	options.scale = (float)atof(argv[3]);
+	options.textureSize = atoi(argv[4]);
+	options.precision = 0.0f;
+	options.lights = 1;
+	options.normals = true;
+	options.texcoords = true;
+	options.triangles = 0;
+	options.hull = false;
+	options.extrude = false;
+	options.direction = Vec3();
+	options.distance = 0.0f;
+	for(int i = 5; i < argc; ++i){
+		if(strcmp(argv[i], "--precision") == 0 && i + 1 < argc){
+			options.precision = (float)atof(argv[++i]);
+		} else if(strcmp(argv[i], "--lights") == 0 && i + 1 < argc){
+			options.lights = atoi(argv[++i]);
+		} else if(strcmp(argv[i], "--no-normals") == 0){
+			options.normals = false;
+		} else if(strcmp(argv[i], "--no-texcoords") == 0){
+			options.texcoords = false;
+		} else if(strcmp(argv[i], "--triangles") == 0 && i + 1 < argc){
+			options.triangles = atoi(argv[++i]);
+		} else if(strcmp(argv[i], "--hull") == 0){
+			// Shadows only need positions.
+			options.hull = true;
+			options.normals = false;
+			options.texcoords = false;
+		} else if(strcmp(argv[i], "--extrude") == 0 && i + 4 < argc){
+			options.extrude = true;
+			options.direction.x = (float)atof(argv[++i]);
+			options.direction.y = (float)atof(argv[++i]);
+			options.direction.z = (float)atof(argv[++i]);
+			options.distance = (float)atof(argv[++i]);
+		} else {
+			fprintf(stderr, "Unknown option %s.\n", argv[i]);
+			return 1;
+		}
+	}
+
+	Mesh mesh;
+	if(!loadObj(argv[1], mesh)){
+		fprintf(stderr, "Unable to load %s.\n", argv[1]);
+		return 1;
+	}
+	if(options.extrude && !options.hull){
+		fprintf(stderr, "%s: only hulls can be extruded.\n", name);
+		return 1;
+	}
+	fprintf(stderr, "%s:\n", name);
+	const unsigned int sourceTriangles = mesh.triangles.size();
+	if(options.hull && !buildHull(mesh)){
+		fprintf(stderr, "%s: the hull of %s is not watertight.\n", name, argv[1]);
+		return 1;
+	}
+	if(options.triangles > 0){
+		decimate(mesh, options.triangles, options.hull);
+		if(options.hull && !isWatertight(mesh)){
+			fprintf(stderr, "%s: the simplified hull is not watertight.\n", name);
+			return 1;
+		}
+	}
+	const unsigned int hullTriangles = mesh.triangles.size();
+	if(options.extrude && !extrudeHull(mesh, options.direction, options.distance)){
+		fprintf(stderr, "%s: the shadow volume is not watertight.\n", name);
+		return 1;
+	}
+	const std::vector<Attributes> attributes = quantize(mesh, options);
+	const std::vector<std::vector<int> > strips = buildStrips(mesh);
+	Stats stats;
+	memset(&stats, 0, sizeof(Stats));
+	const std::vector<Command> padded = padCommands(buildCommands(strips, attributes, options, stats));
+
+	std::vector<uint32_t> words;
+	for(size_t cid = 0; cid < padded.size(); cid += 4){
+		words.push_back(padded[cid].id | (padded[cid + 1].id << 8) | (padded[cid + 2].id << 16) | (padded[cid + 3].id << 24));
+		for(size_t i = 0; i < 4; ++i){
+			words.insert(words.end(), padded[cid + i].params.begin(), padded[cid + i].params.end());
+		}
+	}
+	stats.words = words.size();
+	if(!checkList(mesh, attributes, padded, words, options)){
+		fprintf(stderr, "%s: decoded list does not match the source triangles.\n", name);
+		return 1;
+	}
+
+	// Budget check. Only polygons that are not culled or clipped are stored: a list that does not fit
+	// even with half of its polygons culled is rejected, else it is only a warning.
+	if(stats.polygons / 2 > MAX_POLYGONS || stats.vertices / 2 > MAX_VERTICES){
+		fprintf(stderr, "%s: %u polygons and %u vertices can not fit in the polygon (%d) and vertex (%d) RAM.\n",
+				name, stats.polygons, stats.vertices, MAX_POLYGONS, MAX_VERTICES);
+		return 1;
+	}
+	if(stats.polygons > MAX_POLYGONS || stats.vertices > MAX_VERTICES){
+		fprintf(stderr, "%s: warning, %u polygons and %u vertices only fit in the polygon (%d) and vertex (%d) RAM if some are culled.\n",
+				name, stats.polygons, stats.vertices, MAX_POLYGONS, MAX_VERTICES);
+	}
+
+	std::string upperName(name);
+	for(size_t i = 0; i < upperName.size(); ++i){
+		upperName[i] = (char)toupper(upperName[i]);
+	}
+	printf("// Generated by tools/obj2displaylist from %s, do not edit.\n", argv[1]);
+	if(options.extrude){
+		printf("// Shadow volume of a closed hull of %u triangles (source: %u), along (%g, %g, %g).\n", hullTriangles, sourceTriangles,
+			   options.direction.x, options.direction.y, options.direction.z);
+	} else if(options.hull){
+		printf("// Closed hull of %u triangles (source: %u).\n", hullTriangles, sourceTriangles);
+	} else if(hullTriangles != sourceTriangles){
+		printf("// Simplified from %u triangles.\n", sourceTriangles);
+	}
+	printf("// %u triangles in %u strips, %u words.\n", stats.polygons, stats.strips, stats.words);
+	printf("// Polygon and vertex RAM use, and estimated geometry engine cycles.\n");
+	printf("#define %s_POLYGONS %u\n", upperName.c_str(), stats.polygons);
+	printf("#define %s_VERTICES %u\n", upperName.c_str(), stats.vertices);
+	printf("#define %s_CYCLES %lu\n\n", upperName.c_str(), stats.cycles);
+	printf("const u32 %s_commands[] = {\n", name);
+	printf("\t%u,\n", stats.words);
+	size_t w = 0;
+	for(size_t cid = 0; cid < padded.size(); cid += 4){
+		printf("\tFIFO_COMMAND_PACK(%s, %s, %s, %s),\n", commandName(padded[cid].id), commandName(padded[cid + 1].id),
+			   commandName(padded[cid + 2].id), commandName(padded[cid + 3].id));
+		++w;
+		const size_t paramEnd = w + padded[cid].params.size() + padded[cid + 1].params.size() + padded[cid + 2].params.size() + padded[cid + 3].params.size();
+		if(paramEnd > w){
+			printf("\t");
+			for(; w < paramEnd; ++w){
+				printf("0x%08x,%s", words[w], w + 1 < paramEnd ? " " : "\n");
+			}
+		}
+	}
+	printf("};\n");
+
+	// Triangle list with every attribute for every vertex.
+	const unsigned int listVertices = 3 * mesh.triangles.size();
+	const unsigned int listAttributes = (options.texcoords ? 1 : 0) + (options.normals ? 1 : 0);
+	const unsigned int listWords = 2 + (listVertices * (listAttributes + 1) + 3) / 4 + listVertices * (listAttributes + 2);
+	const unsigned long listCycles = 1 + listVertices * (commandCycles(CMD_VERTEX16, options)
+		+ (options.texcoords ? commandCycles(CMD_TEX_COORD, options) : 0) + (options.normals ? commandCycles(CMD_NORMAL, options) : 0));
+	fprintf(stderr, "\t%u triangles, %u strips, %u words (%u as a triangle list).\n", stats.polygons, stats.strips, stats.words, listWords);
+	fprintf(stderr, "\tvertex commands: %u VTX_16, %u VTX_10, %u VTX_XY/XZ/YZ, %u VTX_DIFF; %u attribute commands, %u skipped.\n",
+			stats.vertexCommands[CMD_VERTEX16], stats.vertexCommands[CMD_VERTEX10],
+			stats.vertexCommands[CMD_VERTEX_XY] + stats.vertexCommands[CMD_VERTEX_XZ] + stats.vertexCommands[CMD_VERTEX_YZ],
+			stats.vertexCommands[CMD_VERTEX_DIFF], stats.attributeCommands, stats.skippedAttributes);
+	fprintf(stderr, "\t%u/%d polygons, %u/%d vertices, ~%lu geometry cycles (%.1f%% of a frame, %lu as a triangle list).\n",
+			stats.polygons, MAX_POLYGONS, stats.vertices, MAX_VERTICES, stats.cycles, 100.0f * stats.cycles / FRAME_CYCLES, listCycles);
+	return 0;
+}
@@ -4,6 +4,7 @@
 #include <draw.h>
 #include <draw3d.h>
 #include <gs_psm.h>
+#include <gs_gp.h>
 #include <dma_tags.h>
 #include <gif_tags.h>
 #include <packet2.h>
@@ -12,21 +13,35 @@
 
 #include "Draw.hpp"
 
+// VIF codes, written in the upper half of the chain DMA tags.
+#define VIF_CMD_NOP 0x00
+#define VIF_CMD_FLUSHA 0x13
+#define VIF_CMD_MSCAL 0x14
+#define VIF_CMD_DIRECT 0x50
+
+// Maximum size of an image transfer chunk in quadwords (GIF tag NLOOP is 15 bits).
+#define TRANSFER_CHUNK_SIZE 16384
+
+static inline u32 vifCode(u32 cmd, u32 num, u32 immediate){
+	return (cmd << 24) | ((num & 0xFF) << 16) | (immediate & 0xFFFF);
+}
+
 void Commands::allocate(){
 	for(int i = 0; i < 2; ++i){
 		mainPacket[i] = packet2_create(1024, P2_TYPE_NORMAL, P2_MODE_CHAIN, 0);
-		texturePacket[i] = packet2_create(1024, P2_TYPE_NORMAL, P2_MODE_CHAIN, 0);
-		vu1Packets[i] = packet2_create(1024, P2_TYPE_NORMAL, P2_MODE_CHAIN, 1);
 	}
-	indirectPacket = packet2_create(32, P2_TYPE_NORMAL, P2_MODE_CHAIN, 1);
+	vu1Chain = packet2_create(FRAME_CHAIN_SIZE, P2_TYPE_NORMAL, P2_MODE_CHAIN, 1);
+	frameData = packet2_create(FRAME_DATA_SIZE, P2_TYPE_NORMAL, P2_MODE_NORMAL, 0);
 
 	currentFrame = 0;
-	currentDraw = 0;
 }
 
 
 void Commands::beginFrame(){
 	currentFrame = 1 - currentFrame;
+	// The previous chain has been waited for in submit.
+	packet2_reset(vu1Chain, 0);
+	packet2_reset(frameData, 0);
 }
 
 packet2_t* Commands::nextGeneral(){
@@ -34,28 +49,85 @@ packet2_t* Commands::nextGeneral(){
 	return mainPacket[currentFrame];
 }
 
-packet2_t* Commands::nextTexture(){
-	packet2_reset(texturePacket[currentFrame], 0);
-	return texturePacket[currentFrame];
+packet2_t* Commands::chain(){
+	return vu1Chain;
 }
 
-packet2_t* Commands::nextIndirect(){
-	packet2_reset(indirectPacket, 0);
-	return indirectPacket;
+packet2_t* Commands::data(){
+	return frameData;
 }
 
-packet2_t* Commands::nextDraw(){
-	currentDraw = 1 - currentDraw;
-	packet2_reset(vu1Packets[currentDraw], 0);
-	return vu1Packets[currentDraw];
+void Commands::submit(){
+	assert(packet2_get_qw_count(vu1Chain) < FRAME_CHAIN_SIZE);
+	assert(packet2_get_qw_count(frameData) <= FRAME_DATA_SIZE);
+	packet2_utils_vu_add_end_tag(vu1Chain);
+	// Flush the cache so that the frame data is visible to the DMA.
+	dma_channel_send_packet2(vu1Chain, DMA_CHANNEL_VIF1, 1);
+	dma_channel_wait(DMA_CHANNEL_VIF1, 0);
 }
 
 void Commands::clean(){
 	for(int i = 0; i < 2; ++i){
 		packet2_free(mainPacket[i]);
-		packet2_free(texturePacket[i]);
-		packet2_free(vu1Packets[i]);
 	}
-	packet2_free(indirectPacket);
+	packet2_free(vu1Chain);
+	packet2_free(frameData);
 }
 
+void addTextureTransfer(packet2_t* chain, void* src, int width, int height, int psm, int dest, int destWidth, int destY, bool wait){
+	const int bitsPerPixel = psm == GS_PSM_8 ? 8 : (psm == GS_PSM_4 ? 4 : (psm == GS_PSM_16 ? 16 : 32));
+	const int qwCount = (width * height * bitsPerPixel) / 128;
+	const int bufferWidth = destWidth >> 6;
+
+	// Optionally wait for the VU1 program and the GS transfers using the previous texture, then setup the transfer.
+	packet2_chain_open_cnt(chain, 0, 0, 0);
+	packet2_add_u32(chain, vifCode(wait ? VIF_CMD_FLUSHA : VIF_CMD_NOP, 0, 0));
+	packet2_add_u32(chain, vifCode(VIF_CMD_DIRECT, 0, 5));
+	packet2_add_u64(chain, GIF_SET_TAG(4, 0, 0, 0, GIF_FLG_PACKED, 1));
+	packet2_add_u64(chain, GIF_REG_AD);
+	packet2_add_u64(chain, GS_SET_BITBLTBUF(0, 0, 0, dest >> 6, bufferWidth > 0 ? bufferWidth : 1, psm));
+	packet2_add_u64(chain, GS_REG_BITBLTBUF);
+	packet2_add_u64(chain, GS_SET_TRXPOS(0, 0, 0, destY, 0));
+	packet2_add_u64(chain, GS_REG_TRXPOS);
+	packet2_add_u64(chain, GS_SET_TRXREG(width, height));
+	packet2_add_u64(chain, GS_REG_TRXREG);
+	packet2_add_u64(chain, GS_SET_TRXDIR(0));
+	packet2_add_u64(chain, GS_REG_TRXDIR);
+	packet2_chain_close_tag(chain);
+
+	// Image data is referenced in place, by chunks.
+	u8* data = (u8*)src;
+	for(int offset = 0; offset < qwCount; offset += TRANSFER_CHUNK_SIZE){
+		const int chunkSize = (qwCount - offset) > TRANSFER_CHUNK_SIZE ? TRANSFER_CHUNK_SIZE : (qwCount - offset);
+		const int last = (offset + chunkSize) == qwCount;
+		packet2_chain_open_cnt(chain, 0, 0, 0);
+		packet2_add_u32(chain, vifCode(VIF_CMD_NOP, 0, 0));
+		packet2_add_u32(chain, vifCode(VIF_CMD_DIRECT, 0, 1));
+		packet2_add_u64(chain, GIF_SET_TAG(chunkSize, last, 0, 0, GIF_FLG_IMAGE, 0));
+		packet2_add_u64(chain, 0);
+		packet2_chain_close_tag(chain);
+
+		packet2_chain_ref(chain, data + offset * 16, chunkSize, 0, 0, 0);
+		packet2_add_u32(chain, vifCode(VIF_CMD_NOP, 0, 0));
+		packet2_add_u32(chain, vifCode(VIF_CMD_DIRECT, 0, chunkSize));
+	}
+}
+
+void addTextureFlush(packet2_t* chain){
+	packet2_chain_open_cnt(chain, 0, 0, 0);
+	packet2_add_u32(chain, vifCode(VIF_CMD_NOP, 0, 0));
+	packet2_add_u32(chain, vifCode(VIF_CMD_DIRECT, 0, 2));
+	packet2_add_u64(chain, GIF_SET_TAG(1, 1, 0, 0, GIF_FLG_PACKED, 1));
+	packet2_add_u64(chain, GIF_REG_AD);
+	packet2_add_u64(chain, 1);
+	packet2_add_u64(chain, GS_REG_TEXFLUSH);
+	packet2_chain_close_tag(chain);
+}
+
+void addStartProgram(packet2_t* chain, unsigned int address){
+	// Contrary to packet2_utils_vu_add_start_program, no FLUSH after MSCAL.
+	packet2_chain_open_cnt(chain, 0, 0, 0);
+	packet2_add_u32(chain, vifCode(VIF_CMD_MSCAL, 0, address));
+	packet2_add_u32(chain, vifCode(VIF_CMD_NOP, 0, 0));
+	packet2_chain_close_tag(chain);
+}
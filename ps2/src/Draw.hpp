@@ -12,37 +12,55 @@
 #define VU1_BUFFER_SIZE 496
 #define BATCH_VERTEX_SIZE 96
 
+// Sizes of the per-frame packets, in quadwords.
+#define FRAME_CHAIN_SIZE 4096
+#define FRAME_DATA_SIZE 256
+
 // Helpers
 
 struct Memory {
-	unsigned int texture;
-	unsigned int palette;
 	unsigned int programObject;
 	unsigned int programSkybox;
 };
 
+/// All the VU1 work of a frame (texture uploads and vertex batches) is recorded in a single VIF1 DMA chain,
+/// sent once at the end of the frame. Per-batch parameters are stored in a data packet referenced by the chain.
 struct Commands {
-	
+
 	void allocate();
 
 	void beginFrame();
 
 	packet2_t* nextGeneral();
-	packet2_t* nextTexture();
-	packet2_t* nextIndirect();
-	packet2_t* nextDraw();
+
+	/// VIF1 chain of the current frame.
+	packet2_t* chain();
+
+	/// Data packet of the current frame, must stay alive until the chain is submitted.
+	packet2_t* data();
+
+	/// Close and send the frame chain. This is the only wait on the VIF1 channel in a frame.
+	void submit();
 
 	void clean();
-	
+
 private:
 
 	packet2_t* mainPacket[2];
-	packet2_t* texturePacket[2]; 
-	packet2_t* vu1Packets[2] __attribute__((aligned(64)));
-	packet2_t* indirectPacket;
-	
+	packet2_t* vu1Chain __attribute__((aligned(64)));
+	packet2_t* frameData __attribute__((aligned(64)));
+
 	int currentFrame{0};
-	int currentDraw{0};
 };
 
+/// Upload texture rows from the VIF1 chain (PATH2), starting at row destY. If wait is set, the transfer starts once
+/// the previous VU1 work and GS transfers are complete, else it is interleaved with the running VU1 program output.
+void addTextureTransfer(packet2_t* chain, void* src, int width, int height, int psm, int dest, int destWidth, int destY, bool wait);
+
+void addTextureFlush(packet2_t* chain);
+
+/// Start a VU1 program without flushing: the VIF keeps unpacking the next batch in the other half
+/// of the double buffer while VU1 runs, and only stalls on the next program start.
+void addStartProgram(packet2_t* chain, unsigned int address);
+
 #endif
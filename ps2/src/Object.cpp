@@ -20,6 +20,7 @@
 #include "Object.hpp"
 #include "Scene.hpp"
 #include "Draw.hpp"
+#include "TextureCache.hpp"
 
 Object::Object(){
 	
@@ -34,7 +35,8 @@ Object::Object(){
 	object_rotation[3] = 1.0f;
 	
 	// Define the triangle primitive we want to use.
-	prim.type = PRIM_TRIANGLE;
+	// Meshes are triangle strips, the VU1 program sets the ADC bit on restart vertices (see tools/obj2strips).
+	prim.type = PRIM_TRIANGLE_STRIP;
 	prim.shading = PRIM_SHADE_GOURAUD;
 	prim.mapping = DRAW_ENABLE;
 	prim.fogging = DRAW_DISABLE;
@@ -43,10 +45,8 @@ Object::Object(){
 	prim.mapping_type = PRIM_MAP_ST;
 	prim.colorfix = PRIM_UNFIXED;
  
-	tex.width = 1024;
+	// Address and size are set by the texture cache.
 	tex.psm = GS_PSM_8;
-	tex.info.width = draw_log2(1024);
-	tex.info.height = draw_log2(1024);
 	tex.info.components = TEXTURE_COMPONENTS_RGB;
 	tex.info.function = TEXTURE_FUNCTION_MODULATE;
 
@@ -56,18 +56,18 @@ Object::Object(){
 	clut.psm = GS_PSM_32;
 }
 
-void Object::init(const Memory& memory, unsigned int vc, VECTOR * v, VECTOR * n, unsigned char * t, unsigned char * c){
-	tex.address = memory.texture;
-	clut.address = memory.palette;
-
+void Object::init(unsigned int vc, VECTOR * v, VECTOR * n, int texture){
 	_vertex_count = vc;
 	_vertices = v;
 	_normals = n;
-	_texture = t;
-	_clut = c;
+	_texture = texture;
+}
+
+void Object::request(TextureCache& textures){
+	textures.request(_texture);
 }
 
-void Object::render(Commands& commands, Memory& memory, MATRIX world_view, MATRIX view_screen, VECTOR light_dir){
+void Object::render(Commands& commands, Memory& memory, TextureCache& textures, MATRIX world_view, MATRIX view_screen, VECTOR light_dir){
 	
 	// UPDATE
 	// Create the local_world matrix.
@@ -87,53 +87,55 @@ void Object::render(Commands& commands, Memory& memory, MATRIX world_view, MATRI
 	vector_apply(local_light_dir, light_dir, world_local_rot);
 	vector_normalize(local_light_dir, local_light_dir);
 
-	// Load the texture into vram.
-	packet2_t* t = commands.nextTexture();
-	packet2_update(t, draw_texture_transfer(t->next, _texture, 1024, 1024, GS_PSM_8, memory.texture, 1024));
-	packet2_update(t, draw_texture_transfer(t->next, _clut, 16, 16, GS_PSM_32, memory.palette, 16));
-	packet2_update(t, draw_texture_flush(t->next));
-	dma_channel_send_packet2(t, DMA_CHANNEL_GIF, 0);
-	dma_wait_fast();
-	
-	// Submit batches of vertices for processing on VU1.
-	for(unsigned int pIndex = 0; pIndex < _vertex_count; pIndex += BATCH_VERTEX_SIZE){
-
-		unsigned int vertexCount = _vertex_count - pIndex;
-		vertexCount = vertexCount > BATCH_VERTEX_SIZE ? BATCH_VERTEX_SIZE : vertexCount;
+	// Make sure the texture is in vram.
+	packet2_t* chain = commands.chain();
+	textures.bind(chain, _texture, tex, clut);
 
-		// To keep things simple, rebuild the basic parameter packets at each batch.
-		packet2_t * p = commands.nextIndirect();
+	// Parameters for full batches and for the last one, each followed by the transformation data,
+	// so that a batch only needs one upload for its parameters.
+	packet2_t* data = commands.data();
+	unsigned int lastCount = _vertex_count % BATCH_VERTEX_SIZE;
+	lastCount = lastCount == 0 ? BATCH_VERTEX_SIZE : lastCount;
+	qword_t* parameters[2];
+	const unsigned int counts[2] = { BATCH_VERTEX_SIZE, lastCount };
+	for(int i = 0; i < 2; ++i){
+		parameters[i] = data->next;
 		// Prescale light color for conversion, but keep it as float for computations.
-		packet2_add_float(p, 128.f); // White light	
-		packet2_add_float(p, 128.f); 
-		packet2_add_float(p, 128.f); 
-		packet2_add_s32(p, vertexCount); // Vertex count
-		packet2_utils_gs_add_texbuff_clut(p, &tex, &clut);
-		packet2_utils_gs_add_prim_giftag(p, &prim, vertexCount, DRAW_STQ2_REGLIST, 3, 0);
+		packet2_add_float(data, 128.f); // White light
+		packet2_add_float(data, 128.f);
+		packet2_add_float(data, 128.f);
+		packet2_add_s32(data, counts[i]); // Vertex count
+		packet2_utils_gs_add_texbuff_clut(data, &tex, &clut);
+		packet2_utils_gs_add_prim_giftag(data, &prim, counts[i], DRAW_STQ2_REGLIST, 3, 0);
+		// Transformation data.
+		memcpy(data->next, local_screen, 4 * sizeof(qword_t));
+		data->next += 4;
+		memcpy(data->next, local_light_dir, sizeof(qword_t));
+		data->next += 1;
+	}
+	const u32 parametersSize = data->next - parameters[1];
 
-		// Schedule copies from data to VU1 memory.
-		packet2_t* vuPacket = commands.nextDraw();
+	// Chain all batches for processing on VU1. Uploads go to the other half of the VU1 double buffer
+	// while the previous batch is processed, the VIF only stalls when starting the next program.
+	// Strips are packed so that each batch starts with a restart.
+	for(unsigned int pIndex = 0; pIndex < _vertex_count; pIndex += BATCH_VERTEX_SIZE){
+
+		const int last = (pIndex + BATCH_VERTEX_SIZE) >= _vertex_count;
+		const unsigned int vertexCount = counts[last];
 		u32 bufferOffsetQw = 0;
 
-		// Merge packets
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, p->base, packet2_get_qw_count(p), 1);
-		bufferOffsetQw += packet2_get_qw_count(p);
-		// Transformation data.
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, &local_screen, 4, 1);
-		bufferOffsetQw += 4;
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, &local_light_dir, 1, 1);
-		bufferOffsetQw += 1;
+		// Parameters and transformation data.
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, parameters[last], parametersSize, 1);
+		bufferOffsetQw += parametersSize;
 		// Add vertices
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, _vertices + pIndex, vertexCount, 1);
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, _vertices + pIndex, vertexCount, 1);
 		bufferOffsetQw += vertexCount;
 		// Add normals
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, _normals + pIndex, vertexCount, 1);
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, _normals + pIndex, vertexCount, 1);
 		bufferOffsetQw += vertexCount;
 
-		// Execute.
-		packet2_utils_vu_add_start_program(vuPacket, memory.programObject);
-		packet2_utils_vu_add_end_tag(vuPacket);
-		dma_channel_send_packet2(vuPacket, DMA_CHANNEL_VIF1, 1);
-		dma_wait_fast();
+		// Execute, and upload upcoming textures meanwhile.
+		addStartProgram(chain, memory.programObject);
+		textures.stream(chain);
 	}
 }
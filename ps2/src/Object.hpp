@@ -10,6 +10,7 @@
 
 struct Memory;
 struct Commands;
+class TextureCache;
 
 class Object {
 	
@@ -17,9 +18,11 @@ public:
 	
 	Object();
 	
-	void render(Commands& commands, Memory& memory, MATRIX world_view, MATRIX view_screen, VECTOR light_dir);
+	void request(TextureCache& textures);
+
+	void render(Commands& commands, Memory& memory, TextureCache& textures, MATRIX world_view, MATRIX view_screen, VECTOR light_dir);
 	
-	void init(const Memory& memory, unsigned int vc, VECTOR * v, VECTOR * n, unsigned char * t, unsigned char * c);
+	void init(unsigned int vc, VECTOR * v, VECTOR * n, int texture);
 
 	VECTOR object_position;
 	VECTOR object_rotation;
@@ -34,8 +37,7 @@ private:
 	VECTOR * _vertices __attribute__((aligned(128)));
 	VECTOR * _normals __attribute__((aligned(128)));
 
-	unsigned char * _texture;
-	unsigned char * _clut;
+	int _texture;
 	
 	prim_t prim;
 	texbuffer_t tex;
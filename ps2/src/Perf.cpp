@@ -0,0 +1,84 @@
+#include <stdio.h>
+
+#include "Perf.hpp"
+
+// Counter control (PCCR): count in all modes for both counters.
+#define PCCR_CTE (1u << 31)
+#define PCCR_ALL_MODES0 (0xFu << 1)
+#define PCCR_ALL_MODES1 (0xFu << 11)
+#define PCCR_EVENT0(e) ((e) << 5)
+#define PCCR_EVENT1(e) ((e) << 15)
+#define EVENT0_PROCESSOR_CYCLE 1u
+#define EVENT1_DCACHE_MISS 6u
+// The counters are 31 bits, setting the top bit raises a counter exception.
+#define PCR_MASK 0x7FFFFFFFu
+
+static const char* sectionNames[Perf::COUNT] = { "build", "submit", "frame" };
+
+static inline u32 readCycles(){
+	u32 value;
+	asm volatile("mfpc %0, 0" : "=r"(value));
+	return value;
+}
+
+static inline u32 readMisses(){
+	u32 value;
+	asm volatile("mfpc %0, 1" : "=r"(value));
+	return value;
+}
+
+static inline void resetCounters(){
+	asm volatile(
+		"mtpc $zero, 0\n"
+		"mtpc $zero, 1\n"
+		"sync.p\n");
+}
+
+Perf::Perf(){
+	for(int i = 0; i < COUNT; ++i){
+		_startCycles[i] = _startMisses[i] = 0;
+		_cycles[i] = _misses[i] = 0;
+	}
+	_frames = 0;
+}
+
+void Perf::setup(){
+	const u32 control = PCCR_CTE | PCCR_ALL_MODES0 | PCCR_EVENT0(EVENT0_PROCESSOR_CYCLE) | PCCR_ALL_MODES1 | PCCR_EVENT1(EVENT1_DCACHE_MISS);
+	asm volatile(
+		"mtps $zero, 0\n"
+		"sync.p\n"
+		: : );
+	resetCounters();
+	asm volatile(
+		"mtps %0, 0\n"
+		"sync.p\n"
+		: : "r"(control));
+}
+
+void Perf::begin(Section s){
+	_startCycles[s] = readCycles();
+	_startMisses[s] = readMisses();
+}
+
+void Perf::end(Section s){
+	// Differences are taken modulo the counter width.
+	_cycles[s] += (readCycles() - _startCycles[s]) & PCR_MASK;
+	_misses[s] += (readMisses() - _startMisses[s]) & PCR_MASK;
+}
+
+unsigned int Perf::endFrame(){
+	// Restart from zero each frame, far from the overflow (about 7s of cycles).
+	resetCounters();
+	++_frames;
+	if(_frames < PERF_REPORT_FRAMES){
+		return 0;
+	}
+	printf("Perf over %u frames (average per frame):\n", _frames);
+	for(int i = 0; i < COUNT; ++i){
+		printf("\t%s: %u cycles, %u D-cache misses\n", sectionNames[i], (u32)(_cycles[i] / _frames), (u32)(_misses[i] / _frames));
+		_cycles[i] = _misses[i] = 0;
+	}
+	const unsigned int frames = _frames;
+	_frames = 0;
+	return frames;
+}
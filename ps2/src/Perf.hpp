@@ -0,0 +1,46 @@
+#ifndef PERF_HPP
+#define PERF_HPP
+
+#include <kernel.h>
+#include <tamtypes.h>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define PERF_REPORT_FRAMES 300
+
+/// Measure sections of a frame with the EE performance counters: PCR0 counts processor cycles,
+/// PCR1 counts data cache misses. Averages are printed every PERF_REPORT_FRAMES frames.
+class Perf {
+	
+public:
+	
+	enum Section {
+		BUILD = 0, SUBMIT = 1, FRAME = 2, COUNT = 3
+	};
+	
+	Perf();
+	
+	void setup();
+	
+	void begin(Section s);
+	
+	void end(Section s);
+	
+	/// Returns the number of frames averaged if a report was printed, 0 otherwise.
+	unsigned int endFrame();
+	
+private:
+	
+	Perf(const Perf &);
+	Perf & operator = (const Perf &);
+	
+	u32 _startCycles[COUNT];
+	u32 _startMisses[COUNT];
+	u64 _cycles[COUNT];
+	u64 _misses[COUNT];
+	unsigned int _frames;
+};
+
+#endif
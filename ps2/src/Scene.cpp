@@ -25,6 +25,9 @@ extern u32 VU1SkyboxProgram_CodeEnd __attribute__((section(".vudata")));
 extern u32 VU1ObjectProgram_CodeStart __attribute__((section(".vudata")));
 extern u32 VU1ObjectProgram_CodeEnd __attribute__((section(".vudata")));
 
+// Size of the GS memory in words.
+#define VRAM_SIZE_WORDS 1048576
+
 // Camera params.
 
 #define ANGULAR_SPEED 0.1f
@@ -53,34 +56,42 @@ Scene::Scene(int width, int height)  {
 	// Create the view_screen matrix.
 	create_view_screen(_view_screen, graph_aspect_ratio(), -3.00f, 3.00f, -3.00f, 3.00f, 1.00f, 2000.00f);
 	
-	// Allocate memory for texture and palette upload.
-	allocateVRAM(1024u);
+	// Allocate memory for textures and palettes.
+	allocateVRAM();
 
-	// Setup meshes.
+	// Register textures.
 	unsigned char* skyTexs[] = { texture_cubemap_b, texture_cubemap_f,texture_cubemap_l, texture_cubemap_r, texture_cubemap_d, texture_cubemap_u};
 	unsigned char* skyCluts[] = { palette_cubemap_b, palette_cubemap_f, palette_cubemap_l, palette_cubemap_r, palette_cubemap_d, palette_cubemap_u};
-	_skybox.init(_memory, vertices_count_cube, vertices_cube, uvs_cube, skyTexs, skyCluts);
+	int skyTextures[6];
+	for(int i = 0; i < 6; ++i){
+		skyTextures[i] = _textures.add(skyTexs[i], skyCluts[i], 512);
+	}
+	const int planeTexture = _textures.add(texture_floor, (unsigned char*)palette_floor, 1024);
+	const int monkeyTexture = _textures.add(texture_monkey, (unsigned char*)palette_monkey, 1024);
+	const int dragonTexture = _textures.add(texture_dragon, (unsigned char*)palette_dragon, 1024);
+
+	// Setup meshes.
+	_skybox.init(vertices_count_cube, vertices_cube, uvs_cube, skyTextures);
 	
-	_plane.init(_memory, vertex_count_plane, vertices_plane, normals_plane, texture_floor, (unsigned char*)palette_floor);
+	_plane.init(vertex_count_plane, vertices_plane, normals_plane, planeTexture);
 	
-	_monkey.init(_memory, vertex_count_monkey, vertices_monkey, normals_monkey, texture_monkey, (unsigned char*)palette_monkey);
+	_monkey.init(vertex_count_monkey, vertices_monkey, normals_monkey, monkeyTexture);
 	_monkey.object_position[0] = 8.0f;
 	_monkey.object_position[1] = 12.0f;
 	_monkey.object_position[2] = 8.0f;
 	
-	_dragon.init(_memory, vertex_count_dragon, vertices_dragon, normals_dragon, texture_dragon, (unsigned char*)palette_dragon);
+	_dragon.init(vertex_count_dragon, vertices_dragon, normals_dragon, dragonTexture);
 	_dragon.object_position[0] = -11.0f;
 	_dragon.object_position[1] = 15.0f;
 	_dragon.object_position[2] = -11.0f;
 
 }
 
-void Scene::allocateVRAM(unsigned int maxTextureSize){
+void Scene::allocateVRAM(){
 
-	// Allocate some vram for the texture buffer
-	_memory.texture = graph_vram_allocate(maxTextureSize, maxTextureSize, GS_PSM_8, GRAPH_ALIGN_BLOCK);
-	// Allocate some vram for the texture buffer
-	_memory.palette = graph_vram_allocate(16,16,GS_PSM_32,GRAPH_ALIGN_BLOCK);
+	// Keep all the vram left after the frame and depth buffers for textures and palettes.
+	const unsigned int textureStart = graph_vram_allocate(64, 1, GS_PSM_32, GRAPH_ALIGN_BLOCK);
+	_textures.init(textureStart, VRAM_SIZE_WORDS);
 
 	// Upload VU1 programs
 	// Sizes in packets, each sending up to 256 instructions of 2 bytes.
@@ -140,14 +151,23 @@ void Scene::clear(Commands& commands, zbuffer_t * z){
 }
 
 void Scene::render(Commands& commands){
-	
-	dma_channel_wait(DMA_CHANNEL_VIF1, 0);
 
-	// Render the objects.
-	_monkey.render(commands, _memory, _world_view, _view_screen, _light_direction);
-	_dragon.render(commands, _memory, _world_view, _view_screen, _light_direction);
-	_plane.render(commands, _memory, _world_view, _view_screen, _light_direction);
-	_skybox.render(commands, _memory, _world_view, _view_screen);
+	// Declare the textures used by the frame, in draw order, to schedule uploads.
+	_textures.beginFrame();
+	_monkey.request(_textures);
+	_dragon.request(_textures);
+	_plane.request(_textures);
+	_skybox.request(_textures);
+
+	// Record the objects in the frame chain, submitted by the caller.
+	_monkey.render(commands, _memory, _textures, _world_view, _view_screen, _light_direction);
+	_dragon.render(commands, _memory, _textures, _world_view, _view_screen, _light_direction);
+	_plane.render(commands, _memory, _textures, _world_view, _view_screen, _light_direction);
+	_skybox.render(commands, _memory, _textures, _world_view, _view_screen);
+}
+
+void Scene::printStats(unsigned int frames){
+	_textures.printStats(frames);
 }
 
 
@@ -12,6 +12,7 @@
 #include "Object.hpp"
 #include "Skybox.hpp"
 #include "Draw.hpp"
+#include "TextureCache.hpp"
 
 class Scene {
 	
@@ -24,6 +25,8 @@ public:
 	void render(Commands& commands);
 	
 	void update(Pad & pad);
+
+	void printStats(unsigned int frames);
 	
 private:
 
@@ -32,7 +35,9 @@ private:
 	Scene(const Scene &);
 	Scene & operator = (const Scene &);
 	
-	void allocateVRAM(unsigned int maxTextureSize);
+	void allocateVRAM();
+
+	TextureCache _textures;
 	
 	Skybox _skybox;
 	Object _plane;
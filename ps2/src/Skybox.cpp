@@ -20,6 +20,7 @@
 #include "Skybox.hpp"
 #include "Scene.hpp"
 #include "Draw.hpp"
+#include "TextureCache.hpp"
 
 Skybox::Skybox(){
 	
@@ -33,10 +34,8 @@ Skybox::Skybox(){
 	prim.mapping_type = PRIM_MAP_ST;
 	prim.colorfix = PRIM_UNFIXED;
 
-	tex.width = 512;
+	// Address and size are set by the texture cache.
 	tex.psm = GS_PSM_8;
-	tex.info.width = draw_log2(512);
-	tex.info.height = draw_log2(512);
 	tex.info.components = TEXTURE_COMPONENTS_RGB;
 	tex.info.function = TEXTURE_FUNCTION_MODULATE;
 
@@ -46,21 +45,23 @@ Skybox::Skybox(){
 	clut.psm = GS_PSM_32;
 }
 
-void Skybox::init(const Memory& memory, unsigned int vc, VECTOR * v, VECTOR * uv, unsigned char * t[6], unsigned char * c[6]){
-	tex.address = memory.texture;
-	clut.address = memory.palette;
-
+void Skybox::init(unsigned int vc, VECTOR * v, VECTOR * uv, int textures[6]){
 	_vertex_count = vc;
 	_vertices = v;
 	_uvs = uv;
 	for(int i = 0; i < 6; ++i){
-		_textures[i] = t[i];
-		_cluts[i] = c[i];
+		_textures[i] = textures[i];
 	}
 
 }
 
-void Skybox::render(Commands& commands, Memory& memory, MATRIX world_view, MATRIX view_screen){
+void Skybox::request(TextureCache& textures){
+	for(int face = 0; face < 6; ++face){
+		textures.request(_textures[face]);
+	}
+}
+
+void Skybox::render(Commands& commands, Memory& memory, TextureCache& textures, MATRIX world_view, MATRIX view_screen){
 
 	// UPDATE
 	// Create the local_world matrix.
@@ -75,46 +76,38 @@ void Skybox::render(Commands& commands, Memory& memory, MATRIX world_view, MATRI
 	unsigned int faceVertexCount = _vertex_count / 6;
 	assert(faceVertexCount <= BATCH_VERTEX_SIZE);
 	
+	packet2_t* data = commands.data();
+	packet2_t* chain = commands.chain();
 	for(int face = 0; face < 6; ++face){
 
-		// Load the texture into vram.
-		packet2_t* t = commands.nextTexture();
-		packet2_update(t,draw_texture_transfer(t->next, _textures[face], 512, 512, GS_PSM_8, memory.texture, 512));
-		packet2_update(t,draw_texture_transfer(t->next, _cluts[face], 16, 16, GS_PSM_32, memory.palette, 16));
-		packet2_update(t,draw_texture_flush(t->next));
-		dma_channel_send_packet2(t, DMA_CHANNEL_GIF,0);
-		dma_wait_fast();
-
-		// To keep things simple, rebuild the basic parameter packets at each batch.
-		packet2_t * p = commands.nextIndirect();
-		packet2_add_u32(p, 128); // R
-		packet2_add_u32(p, 128); // G
-		packet2_add_u32(p, 128); // B
-		packet2_add_s32(p, faceVertexCount); // Vertex count
-		packet2_utils_gs_add_texbuff_clut(p, &tex, &clut);
-		packet2_utils_gs_add_prim_giftag(p, &prim, faceVertexCount, DRAW_STQ2_REGLIST, 3, 0);
+		// Make sure the texture is in vram.
+		textures.bind(chain, _textures[face], tex, clut);
+
+		qword_t* parameters = data->next;
+		packet2_add_u32(data, 128); // R
+		packet2_add_u32(data, 128); // G
+		packet2_add_u32(data, 128); // B
+		packet2_add_s32(data, faceVertexCount); // Vertex count
+		packet2_utils_gs_add_texbuff_clut(data, &tex, &clut);
+		packet2_utils_gs_add_prim_giftag(data, &prim, faceVertexCount, DRAW_STQ2_REGLIST, 3, 0);
+		// Add transformation matrix.
+		memcpy(data->next, local_screen, 4 * sizeof(qword_t));
+		data->next += 4;
+		const u32 parametersSize = data->next - parameters;
 
 		// Schedule copies from data to VU1 memory.
-		packet2_t* vuPacket = commands.nextDraw();
 		u32 bufferOffsetQw = 0;
-
-		// Merge packets
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, p->base, packet2_get_qw_count(p), 1);
-		bufferOffsetQw += packet2_get_qw_count(p);
-		// Add transformation matrix.
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, &local_screen, 4, 1);
-		bufferOffsetQw += 4;
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, parameters, parametersSize, 1);
+		bufferOffsetQw += parametersSize;
 		// Add vertices
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, _vertices + face * faceVertexCount, faceVertexCount, 1);
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, _vertices + face * faceVertexCount, faceVertexCount, 1);
 		bufferOffsetQw += faceVertexCount;
 		// Add UVs.
-		packet2_utils_vu_add_unpack_data(vuPacket, bufferOffsetQw, _uvs + face * faceVertexCount, faceVertexCount, 1);
+		packet2_utils_vu_add_unpack_data(chain, bufferOffsetQw, _uvs + face * faceVertexCount, faceVertexCount, 1);
 		bufferOffsetQw += faceVertexCount;
 
-		// Execute.
-		packet2_utils_vu_add_start_program(vuPacket, memory.programSkybox);
-		packet2_utils_vu_add_end_tag(vuPacket);
-		dma_channel_send_packet2(vuPacket, DMA_CHANNEL_VIF1, 1);
-		dma_wait_fast();
+		// Execute, and upload upcoming textures meanwhile.
+		addStartProgram(chain, memory.programSkybox);
+		textures.stream(chain);
 	}
 }
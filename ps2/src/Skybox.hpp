@@ -10,6 +10,7 @@
 
 struct Memory;
 struct Commands;
+class TextureCache;
 
 class Skybox {
 	
@@ -17,9 +18,11 @@ public:
 	
 	Skybox();
 	
-	void render(Commands& commands, Memory& memory, MATRIX world_view, MATRIX view_screen);
+	void request(TextureCache& textures);
+
+	void render(Commands& commands, Memory& memory, TextureCache& textures, MATRIX world_view, MATRIX view_screen);
 	
-	void init(const Memory& memory,unsigned int vc, VECTOR * v, VECTOR * uv, unsigned char* t[6], unsigned char * c[6]);
+	void init(unsigned int vc, VECTOR * v, VECTOR * uv, int textures[6]);
 	
 private:
 	
@@ -30,8 +33,7 @@ private:
 	VECTOR * _vertices __attribute__((aligned(128)));
 	VECTOR * _uvs __attribute__((aligned(128)));
 
-	unsigned char * _textures[6];
-	unsigned char * _cluts[6];
+	int _textures[6];
 	
 	prim_t prim;
 	texbuffer_t tex;
@@ -0,0 +1,289 @@
+
+#include <dma.h>
+#include <graph.h>
+#include <draw.h>
+#include <gs_psm.h>
+#include <dma_tags.h>
+#include <gif_tags.h>
+#include <packet2.h>
+#include <packet2_utils.h>
+#include <malloc.h>
+#include <stdio.h>
+
+#include "TextureCache.hpp"
+#include "Draw.hpp"
+
+// A GS block is 64 words, a page 32 blocks (128x64 texels for 8 bits textures).
+#define WORDS_PER_BLOCK 64
+#define BLOCKS_PER_PAGE 32
+// 16x16 32 bits palette.
+#define CLUT_BLOCKS 4
+
+static unsigned int textureBlocks(int size){
+	const unsigned int pagesX = (size + 127) / 128;
+	const unsigned int pagesY = (size + 63) / 64;
+	return pagesX * pagesY * BLOCKS_PER_PAGE;
+}
+
+TextureCache::TextureCache(){
+	_textureCount = 0;
+	_freeCount = 0;
+	_uploadCount = _currentUpload = 0;
+	_drawCount = _previousDrawCount = _currentDraw = 0;
+	_maxBlocks = 0;
+	_needsFlush = false;
+	_hits = _uploadedBytes = _evictions = _stalls = 0;
+}
+
+void TextureCache::init(unsigned int start, unsigned int end){
+	const unsigned int startBlock = (start + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+	const unsigned int endBlock = end / WORDS_PER_BLOCK;
+	_freeBlocks[0].start = startBlock;
+	_freeBlocks[0].count = endBlock - startBlock;
+	_freeCount = 1;
+	// Keep room for at least two textures, one being used while the other is uploaded.
+	_maxBlocks = (endBlock - startBlock) / 2;
+}
+
+int TextureCache::add(unsigned char* pixels, unsigned char* clut, int size){
+	assert(_textureCount < TEXTURE_CACHE_MAX_TEXTURES);
+	Texture& texture = _textures[_textureCount];
+
+	// Palettes stay resident, upload it immediately.
+	unsigned int clutStart = 0;
+	if(!allocate(CLUT_BLOCKS, clutStart)){
+		printf("Texture cache: no space left for palette.\n");
+		return -1;
+	}
+	texture.clutAddress = clutStart * WORDS_PER_BLOCK;
+	packet2_t* p = packet2_create(16, P2_TYPE_NORMAL, P2_MODE_CHAIN, 0);
+	packet2_update(p, draw_texture_transfer(p->next, clut, 16, 16, GS_PSM_32, texture.clutAddress, 64));
+	packet2_update(p, draw_texture_flush(p->next));
+	dma_channel_send_packet2(p, DMA_CHANNEL_GIF, 1);
+	dma_channel_wait(DMA_CHANNEL_GIF, 0);
+	packet2_free(p);
+
+	// Point-sample textures that are too large.
+	int resolution = size;
+	while(textureBlocks(resolution) > _maxBlocks && resolution > 8){
+		resolution /= 2;
+	}
+	texture.pixels = pixels;
+	if(resolution != size){
+		const int step = size / resolution;
+		texture.pixels = (unsigned char*)memalign(128, resolution * resolution);
+		for(int y = 0; y < resolution; ++y){
+			for(int x = 0; x < resolution; ++x){
+				texture.pixels[y * resolution + x] = pixels[(y * step) * size + x * step];
+			}
+		}
+		printf("Texture cache: texture %d reduced from %d to %d.\n", _textureCount, size, resolution);
+	}
+	texture.size = resolution;
+	texture.blocks = textureBlocks(resolution);
+	texture.address = 0;
+	texture.lastDraw = -1;
+	texture.resident = false;
+	return _textureCount++;
+}
+
+/// Free blocks management.
+
+bool TextureCache::allocate(unsigned int count, unsigned int& start){
+	// Best fit: smallest free range large enough.
+	int best = -1;
+	for(int bid = 0; bid < _freeCount; ++bid){
+		if(_freeBlocks[bid].count >= count && (best < 0 || _freeBlocks[bid].count < _freeBlocks[best].count)){
+			best = bid;
+		}
+	}
+	if(best < 0){
+		return false;
+	}
+	start = _freeBlocks[best].start;
+	_freeBlocks[best].start += count;
+	_freeBlocks[best].count -= count;
+	if(_freeBlocks[best].count == 0){
+		--_freeCount;
+		memmove(&_freeBlocks[best], &_freeBlocks[best + 1], (_freeCount - best) * sizeof(Block));
+	}
+	return true;
+}
+
+void TextureCache::release(unsigned int start, unsigned int count){
+	int index = 0;
+	while(index < _freeCount && _freeBlocks[index].start < start){
+		++index;
+	}
+	memmove(&_freeBlocks[index + 1], &_freeBlocks[index], (_freeCount - index) * sizeof(Block));
+	_freeBlocks[index].start = start;
+	_freeBlocks[index].count = count;
+	++_freeCount;
+	// Merge with the next and previous ranges.
+	if(index + 1 < _freeCount && start + count == _freeBlocks[index + 1].start){
+		_freeBlocks[index].count += _freeBlocks[index + 1].count;
+		--_freeCount;
+		memmove(&_freeBlocks[index + 1], &_freeBlocks[index + 2], (_freeCount - index - 1) * sizeof(Block));
+	}
+	if(index > 0 && _freeBlocks[index - 1].start + _freeBlocks[index - 1].count == _freeBlocks[index].start){
+		_freeBlocks[index - 1].count += _freeBlocks[index].count;
+		--_freeCount;
+		memmove(&_freeBlocks[index], &_freeBlocks[index + 1], (_freeCount - index) * sizeof(Block));
+	}
+}
+
+/// Scheduling.
+
+unsigned int TextureCache::nextUse(int handle, int draw) const {
+	// Assume that the frame uses the same textures as the previous one.
+	for(int did = draw + 1; did < _previousDrawCount; ++did){
+		if(_previousOrder[did] == handle){
+			return did - draw;
+		}
+	}
+	for(int did = 0; did < _previousDrawCount; ++did){
+		if(_previousOrder[did] == handle){
+			return _previousDrawCount - draw + did;
+		}
+	}
+	return UINT_MAX;
+}
+
+bool TextureCache::evict(int draw){
+	// Evict the texture needed the farthest in the future. On ties, prefer those not used this frame,
+	// that can be overwritten without waiting. Avoid the texture of the previous draw if possible,
+	// as the upload could not be streamed while that draw is running.
+	int victim = -1;
+	unsigned int victimUse = 0;
+	for(int pass = 0; pass < 2 && victim < 0; ++pass){
+		for(int tid = 0; tid < _textureCount; ++tid){
+			const Texture& texture = _textures[tid];
+			if(!texture.resident || (pass == 0 && draw > 0 && texture.lastDraw == draw - 1)){
+				continue;
+			}
+			const unsigned int use = nextUse(tid, draw);
+			if(victim < 0 || use > victimUse || (use == victimUse && texture.lastDraw < _textures[victim].lastDraw)){
+				victim = tid;
+				victimUse = use;
+			}
+		}
+	}
+	if(victim < 0){
+		return false;
+	}
+	Texture& texture = _textures[victim];
+	release(texture.address / WORDS_PER_BLOCK, texture.blocks);
+	texture.resident = false;
+	++_evictions;
+	// The new texture can only be written once the draws using the victim are complete.
+	Upload& upload = _uploads[_uploadCount - 1];
+	upload.after = texture.lastDraw > upload.after ? texture.lastDraw : upload.after;
+	return true;
+}
+
+void TextureCache::beginFrame(){
+	if(_drawCount > 0){
+		memcpy(_previousOrder, _order, _drawCount * sizeof(int));
+		_previousDrawCount = _drawCount;
+	}
+	_drawCount = _currentDraw = 0;
+	_uploadCount = _currentUpload = 0;
+	_needsFlush = false;
+	for(int tid = 0; tid < _textureCount; ++tid){
+		_textures[tid].lastDraw = -1;
+	}
+}
+
+void TextureCache::request(int handle){
+	assert(_drawCount < TEXTURE_CACHE_MAX_DRAWS);
+	const int draw = _drawCount++;
+	_order[draw] = handle;
+	Texture& texture = _textures[handle];
+
+	if(texture.resident){
+		++_hits;
+		texture.lastDraw = draw;
+		return;
+	}
+
+	Upload& upload = _uploads[_uploadCount++];
+	upload.handle = handle;
+	upload.draw = draw;
+	upload.after = -1;
+	upload.row = 0;
+
+	unsigned int start = 0;
+	bool allocated = allocate(texture.blocks, start);
+	while(!allocated && evict(draw)){
+		allocated = allocate(texture.blocks, start);
+	}
+	// Textures are at most half of the memory, evicting everything is always enough.
+	assert(allocated);
+	texture.address = start * WORDS_PER_BLOCK;
+	texture.resident = true;
+	texture.lastDraw = draw;
+}
+
+void TextureCache::emitChunk(packet2_t* chain, Upload& upload, bool wait){
+	const Texture& texture = _textures[upload.handle];
+	const int rowsPerChunk = (TEXTURE_CHUNK_SIZE * 16) / texture.size;
+	const int rows = (texture.size - upload.row) < rowsPerChunk ? (texture.size - upload.row) : rowsPerChunk;
+	addTextureTransfer(chain, texture.pixels + upload.row * texture.size, texture.size, rows, GS_PSM_8, texture.address, texture.size, upload.row, wait);
+	upload.row += rows;
+	_uploadedBytes += rows * texture.size;
+	_needsFlush = true;
+	if(upload.row == texture.size){
+		++_currentUpload;
+	}
+}
+
+void TextureCache::stream(packet2_t* chain){
+	if(_currentUpload == _uploadCount){
+		return;
+	}
+	// Only write regions that the running draw does not sample.
+	const int running = _currentDraw - 1;
+	Upload& upload = _uploads[_currentUpload];
+	if(upload.after < running){
+		emitChunk(chain, upload, false);
+	}
+}
+
+void TextureCache::bind(packet2_t* chain, int handle, texbuffer_t& tex, clutbuffer_t& clut){
+	const int draw = _currentDraw++;
+	assert(_order[draw] == handle);
+	// The previous draw may still be running.
+	const int running = draw - 1;
+
+	// Complete the uploads needed up to this draw.
+	while(_currentUpload < _uploadCount && _uploads[_currentUpload].draw <= draw){
+		const int index = _currentUpload;
+		Upload& upload = _uploads[index];
+		bool wait = upload.after >= running;
+		if(wait){
+			++_stalls;
+		}
+		while(_currentUpload == index){
+			emitChunk(chain, upload, wait);
+			// Further chunks are ordered after the first one.
+			wait = false;
+		}
+	}
+	if(_needsFlush){
+		addTextureFlush(chain);
+		_needsFlush = false;
+	}
+
+	const Texture& texture = _textures[handle];
+	tex.address = texture.address;
+	tex.width = texture.size;
+	tex.info.width = draw_log2(texture.size);
+	tex.info.height = draw_log2(texture.size);
+	clut.address = texture.clutAddress;
+}
+
+void TextureCache::printStats(unsigned int frames){
+	printf("Textures (average per frame): %u hits, %u KB uploaded, %u evictions, %u stalls\n",
+		   _hits / frames, (_uploadedBytes / frames) / 1024, _evictions / frames, _stalls / frames);
+	_hits = _uploadedBytes = _evictions = _stalls = 0;
+}
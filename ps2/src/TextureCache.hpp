@@ -0,0 +1,113 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+#include <kernel.h>
+#include <tamtypes.h>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <packet2.h>
+#include <draw.h>
+
+#define TEXTURE_CACHE_MAX_TEXTURES 16
+#define TEXTURE_CACHE_MAX_DRAWS 32
+// Size of an upload chunk in quadwords, streamed between two VU1 batches.
+#define TEXTURE_CHUNK_SIZE 2048
+
+/// Keep 8 bits paletized textures resident in GS VRAM across frames.
+/// CLUTs are uploaded once and never evicted. Textures are allocated in the VRAM left after the frame and depth buffers,
+/// in units of GS blocks, and evicted when space is needed, the victim being the texture whose next use is the farthest
+/// (frames draw the same textures in the same order). Textures larger than half of that space are point-sampled down.
+///
+/// The draws of a frame first request their textures in order, so that uploads can be scheduled: an upload is streamed
+/// by chunks from the VIF1 chain between the VU1 batches of previous draws, as soon as the region it overwrites is not
+/// used by a running draw anymore. Remaining chunks are sent when the texture is bound.
+class TextureCache {
+
+public:
+
+	TextureCache();
+
+	/// Memory range in words.
+	void init(unsigned int start, unsigned int end);
+
+	/// Register a square texture and upload its palette, returns a handle.
+	int add(unsigned char* pixels, unsigned char* clut, int size);
+
+	void beginFrame();
+
+	/// Declare the texture used by the next draw of the frame.
+	void request(int handle);
+
+	/// Finish uploading the texture of the next draw, and setup the GS buffers to sample it.
+	void bind(packet2_t* chain, int handle, texbuffer_t& tex, clutbuffer_t& clut);
+
+	/// Stream a chunk of the next pending upload, if possible. Call after starting a VU1 batch.
+	void stream(packet2_t* chain);
+
+	void printStats(unsigned int frames);
+
+private:
+
+	TextureCache(const TextureCache &);
+	TextureCache & operator = (const TextureCache &);
+
+	struct Texture {
+		unsigned char* pixels;
+		int size;
+		unsigned int blocks;
+		unsigned int address;
+		unsigned int clutAddress;
+		// Draw that last used the texture this frame, -1 if none.
+		int lastDraw;
+		bool resident;
+	};
+
+	struct Upload {
+		int handle;
+		int draw;
+		// The region can only be written once this draw is complete, -1 if free.
+		int after;
+		int row;
+	};
+
+	struct Block {
+		unsigned int start;
+		unsigned int count;
+	};
+
+	bool allocate(unsigned int count, unsigned int& start);
+
+	void release(unsigned int start, unsigned int count);
+
+	bool evict(int draw);
+
+	unsigned int nextUse(int handle, int draw) const;
+
+	void emitChunk(packet2_t* chain, Upload& upload, bool wait);
+
+	Texture _textures[TEXTURE_CACHE_MAX_TEXTURES];
+	Block _freeBlocks[TEXTURE_CACHE_MAX_TEXTURES + 2];
+	Upload _uploads[TEXTURE_CACHE_MAX_DRAWS];
+	// Textures requested by the draws of the current and previous frames.
+	int _order[TEXTURE_CACHE_MAX_DRAWS];
+	int _previousOrder[TEXTURE_CACHE_MAX_DRAWS];
+
+	int _textureCount;
+	int _freeCount;
+	int _uploadCount;
+	int _currentUpload;
+	int _drawCount;
+	int _previousDrawCount;
+	int _currentDraw;
+	unsigned int _maxBlocks;
+	bool _needsFlush;
+
+	u32 _hits;
+	u32 _uploadedBytes;
+	u32 _evictions;
+	u32 _stalls;
+};
+
+#endif
@@ -5,9 +5,10 @@
 
 // MODELS
 #include "data/cube_data.h"
-#include "data/plane_data.h"
-#include "data/monkey_data.h"
-#include "data/dragon_data.h"
+// Triangle strips, generated by tools/obj2strips.
+#include "data/plane_strips.h"
+#include "data/monkey_strips.h"
+#include "data/dragon_strips.h"
 
 // TEXTURES
 #include "data/cubemap_b_texture.h"
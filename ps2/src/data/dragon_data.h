@@ -1,19400 +0,0 @@
-int vertex_count_dragon = 9696;
-
-VECTOR vertices_dragon[9696] = {
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{17.7778, -2.6473, -7.5944, 0.9582},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{17.8094, -7.3121, -4.0477, 0.9168},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-5.8625, 9.1580, 10.2919, 0.8705},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-4.9385, -6.0655, -5.4775, 0.2773},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-5.7445, -7.8728, -5.1948, 0.2623},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-14.2759, 8.6461, 13.5203, 0.8841},
-	{-13.5612, 8.1108, 10.8602, 0.8756},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-7.3083, 9.8503, -3.6142, 0.0055},
-	{4.3121, 12.9834, -7.4063, 0.7115},
-	{3.9552, 13.2021, -6.6886, 0.7045},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-1.0330, -14.2897, 14.1703, 0.3374},
-	{-0.8878, -13.2520, 14.3993, 0.3406},
-	{-1.2252, -14.1486, 14.8460, 0.3369},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-8.9049, -2.4916, 2.5529, 0.1339},
-	{10.0827, -15.0745, -11.7295, 0.4311},
-	{7.6038, -13.3962, -12.9579, 0.4030},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{20.2639, -11.6735, -6.5917, 0.1126},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{20.4856, -10.3916, -8.0896, 0.1301},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{3.6900, 4.9223, -11.1604, 0.5609},
-	{0.8369, 3.9820, -9.5500, 0.5288},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{-5.1508, -4.5724, -0.6738, 0.4517},
-	{-5.7023, -5.3300, 1.5778, 0.4516},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{6.1296, -14.3129, 2.8526, 0.0323},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{5.0994, -14.7806, 2.5423, 0.0321},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{-12.8302, -13.6642, 6.5080, 0.0333},
-	{-13.4628, -12.9480, 7.0929, 0.0487},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{3.4180, -12.2527, -7.1864, 0.7251},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.1266, -9.8244, -9.9774, 0.7347},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-4.6971, 15.2349, 7.8126, 0.5215},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-1.8086, 11.3231, 3.5388, 0.7723},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{5.4030, -11.8653, -14.4697, 0.3470},
-	{4.2351, -11.6789, -14.7300, 0.3329},
-	{5.5093, -10.8981, -14.2069, 0.3446},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-3.9698, 17.2277, 6.1559, 0.7962},
-	{-4.9850, 15.7308, 7.3268, 0.7769},
-	{7.9798, -12.4199, -0.5672, 0.0400},
-	{6.6938, -12.3714, -1.3408, 0.0311},
-	{6.6090, -12.7314, 0.6271, 0.0325},
-	{5.9227, -12.9346, -1.5604, 0.0293},
-	{6.6938, -12.3714, -1.3408, 0.0311},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{-5.6419, -0.8683, 2.5663, 0.1553},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-4.8198, 18.0222, -1.5566, 0.9220},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{12.1132, -1.6393, -1.0587, 0.2149},
-	{15.4950, -5.0714, -9.6367, 0.9785},
-	{15.6815, -6.6533, -8.6324, 0.9638},
-	{16.0250, -4.7052, -8.5821, 0.9710},
-	{-0.4557, 10.6176, -0.3438, 0.7866},
-	{-1.6118, 12.2198, 0.5036, 0.7983},
-	{-0.0238, 10.3640, 0.0562, 0.7833},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{11.8280, 2.1740, -2.6673, 0.2222},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{13.8072, 3.9167, -12.0851, 0.9113},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{-6.6939, -8.2873, 13.3505, 0.4292},
-	{-16.3901, -13.8265, 1.3407, 0.0777},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-16.0153, -14.2690, 1.5396, 0.0777},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{4.6125, -13.6330, -16.4045, 0.3392},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{11.2782, 8.5208, -13.2772, 0.6579},
-	{12.1583, 9.6234, -12.5125, 0.6694},
-	{12.4087, 8.9898, -13.1674, 0.6688},
-	{-5.5777, 22.6380, -0.2408, 0.8598},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{4.9667, -12.4043, -12.2140, 0.3014},
-	{3.8133, -10.9201, -11.3600, 0.3164},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{7.7699, -12.5060, 4.7863, 0.0437},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{17.5388, -13.6704, -10.4353, 0.5027},
-	{16.6912, -15.2830, -9.9006, 0.5039},
-	{16.7603, -15.9094, -11.8002, 0.4846},
-	{-3.4096, 5.8519, -1.9252, 0.2386},
-	{-3.6075, 4.8122, -1.5070, 0.2280},
-	{-4.5776, 6.0464, -1.7322, 0.2346},
-	{11.7425, -5.6727, -2.1637, 0.2275},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{1.6235, 11.5088, -5.1563, 0.5488},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{1.0077, 10.1127, -5.6591, 0.5406},
-	{-7.2361, -3.4140, 3.4502, 0.4633},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-8.9049, -2.4916, 2.5529, 0.4585},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{2.9247, -11.8082, 6.6610, 0.3693},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{-2.5806, 9.5378, 1.6786, 0.2600},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{-3.0850, 7.3498, 0.4457, 0.2525},
-	{4.2656, -6.8950, -5.4206, 0.2925},
-	{3.4899, -10.4980, -6.1315, 0.2929},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{-12.7705, 10.3638, 10.8589, 0.7904},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{2.9304, 12.4364, -6.1754, 0.5700},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-3.6470, 18.9561, 6.4188, 0.8076},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-3.1757, 20.1938, 4.8186, 0.8230},
-	{-3.1424, -2.1742, 1.2848, 0.8830},
-	{-3.9636, -1.2419, 0.9111, 0.8899},
-	{-3.7290, -2.4292, 1.7046, 0.8900},
-	{16.7112, 1.6627, -13.8054, 0.8965},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{18.1539, -0.2898, -12.6066, 0.8738},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{0.2826, -13.7945, 4.1088, 0.3207},
-	{15.7192, -16.0359, -9.7895, 0.5200},
-	{15.5862, -16.2784, -8.8372, 0.4977},
-	{11.7920, -15.9856, -10.6589, 0.4353},
-	{16.3969, -5.8303, -10.0012, 0.5907},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{16.9335, -8.6897, -9.8031, 0.5633},
-	{8.7774, 12.6658, -10.4472, 0.6368},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{8.0087, 12.8555, -10.4614, 0.6296},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{8.9535, -13.0259, 0.0785, 0.0498},
-	{6.6090, -12.7314, 0.6271, 0.0375},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{-11.8462, 15.9685, 3.3982, 0.6100},
-	{-11.0690, 16.0556, 1.8443, 0.6046},
-	{-12.4906, 14.1734, 4.7138, 0.6315},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-14.2719, 13.2783, 17.7108, 0.9453},
-	{-16.1453, 13.8767, 19.0847, 0.9486},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{19.3769, 3.7909, -15.6460, 0.2500},
-	{19.4195, 3.8726, -14.8441, 0.2444},
-	{18.4667, 3.7664, -15.0333, 0.2444},
-	{-8.5480, 7.9971, -1.5354, 0.7178},
-	{-7.6339, 7.3001, -1.5053, 0.7106},
-	{-9.4129, 9.0688, -0.3582, 0.7311},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{9.1599, -1.9722, -5.5275, 0.6693},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{-6.6560, -15.3246, -0.9348, 0.6831},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-8.4173, -14.9636, 0.2931, 0.6652},
-	{-15.4064, 12.0264, 16.0740, 0.9548},
-	{-14.7525, 11.8802, 17.4181, 0.9523},
-	{-15.9663, 12.9154, 17.5072, 0.9513},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{-14.8950, 14.2712, 12.6602, 0.5035},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-10.5628, 7.9757, 3.4591, 0.8401},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-3.9068, 17.0203, 2.7177, 0.8908},
-	{-1.7754, 16.9885, 1.6025, 0.9035},
-	{-3.4554, 16.4095, 1.9054, 0.8878},
-	{12.9097, 5.1491, -7.8942, 0.7470},
-	{11.3199, 5.0059, -6.2512, 0.7416},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{11.0406, -14.5414, -15.0672, 0.4265},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-6.1888, -2.2413, 4.8812, 0.1480},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{17.6731, -0.4004, -9.5018, 0.8583},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{-14.2898, -11.8803, 4.7141, 0.0757},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{11.8049, -12.8121, -1.1697, 0.0244},
-	{11.3671, -14.2139, -1.2936, 0.0125},
-	{-12.7705, 10.3638, 10.8589, 0.7904},
-	{-12.2685, 10.2071, 9.0742, 0.7874},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-5.2963, -14.6150, -2.5473, 0.6904},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-6.6560, -15.3246, -0.9348, 0.6831},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{6.9646, -12.7086, -15.8348, 0.3676},
-	{-11.8199, 11.7743, 16.7667, 0.9057},
-	{-13.3308, 12.3683, 16.9123, 0.9122},
-	{-12.6683, 12.3101, 17.3168, 0.9059},
-	{-4.6971, 15.2349, 7.8126, 0.7733},
-	{-4.8660, 14.5008, 7.3299, 0.7671},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{-16.7829, 17.5540, 13.3765, 0.4930},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-4.6971, 15.2349, 7.8126, 0.7733},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{0.5456, 10.8315, -4.4069, 0.6997},
-	{0.1535, 9.0694, -4.8813, 0.6838},
-	{0.0567, 10.7976, -4.1568, 0.6977},
-	{-12.3291, -10.8595, 3.7359, 0.1012},
-	{-14.2898, -11.8803, 4.7141, 0.0757},
-	{-13.8226, -11.5519, 6.6074, 0.0726},
-	{3.4625, -13.7837, 5.8327, 0.3479},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{0.2163, 13.8998, -0.9935, 0.8774},
-	{-1.7488, 15.0511, 0.4650, 0.8851},
-	{0.1807, 14.3208, 0.0519, 0.8834},
-	{6.7492, -13.6822, 3.4298, 0.0338},
-	{7.1357, -13.0246, 2.9627, 0.0373},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{19.7660, -12.2128, -4.6087, 0.0976},
-	{20.2639, -11.6735, -6.5917, 0.1126},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{-14.3932, 11.6734, 11.3851, 0.7960},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{9.7830, -16.5711, -10.0824, 0.7315},
-	{15.6765, -16.1947, -7.0332, 0.7990},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{6.2106, -12.4636, -3.2128, 0.2937},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{-2.7957, -10.1990, 15.5953, 0.3116},
-	{-3.8338, -11.1945, 17.8398, 0.2913},
-	{-2.9906, -12.7535, 17.1323, 0.3083},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{-12.8820, 16.9456, 14.3941, 0.5253},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-16.6978, 8.5855, 13.2630, 0.8087},
-	{-5.2140, -10.0014, 17.2077, 0.3884},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{5.5093, -10.8981, -14.2069, 0.3446},
-	{5.3288, -10.1704, -12.9107, 0.3457},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{-2.9525, 20.3107, 3.3361, 0.9140},
-	{-3.0172, 19.5295, 3.0415, 0.9115},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{-5.7257, 13.0439, -5.9031, 0.0130},
-	{-5.5554, 14.2622, -6.8740, 0.0135},
-	{-6.2313, 14.9946, -5.1307, 0.0322},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{-0.5673, -4.7395, -7.3621, 0.4481},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-2.8264, 3.1792, -0.3501, 0.1392},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{11.8498, -12.3036, -1.2386, 0.0780},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{-8.0148, 9.8406, 10.4461, 0.8509},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{6.9877, -14.1246, -1.2603, 0.0279},
-	{7.2285, -14.4412, 1.5781, 0.0292},
-	{6.1616, -13.9989, 1.1924, 0.0308},
-	{19.8388, -5.6107, -6.1269, 0.9213},
-	{20.1509, -4.4673, -7.9739, 0.9321},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{-11.2562, 9.6756, 18.9114, 0.8844},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{10.9877, -10.4792, -10.3544, 0.5263},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{12.2079, -9.3668, -8.0887, 0.5227},
-	{19.6048, -2.6055, -10.2806, 0.9521},
-	{16.6170, 2.5289, -12.2647, 0.9620},
-	{20.1509, -4.4673, -7.9739, 0.9321},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{15.0203, 6.6327, -12.5542, 0.4393},
-	{15.2535, 4.4336, -12.4394, 0.4226},
-	{-10.2581, 12.0264, 3.4608, 0.7746},
-	{-12.2685, 10.2071, 9.0742, 0.7874},
-	{-9.9824, 11.3279, 5.2837, 0.7696},
-	{-5.9360, -14.0109, 11.8411, 0.6981},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-4.8899, -13.6344, 11.3395, 0.7104},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{9.7438, -8.6649, -3.9130, 0.2691},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{-12.9679, 19.7861, 13.2026, 0.6355},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{11.6590, -5.8169, -2.1081, 0.2285},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{12.5645, -10.4628, -2.0711, 0.7701},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{11.5097, -9.9075, -2.5946, 0.7609},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{-5.7356, -0.1872, 1.5612, 0.1649},
-	{-5.2023, 0.8105, 1.4140, 0.1749},
-	{-5.2492, -0.4274, 2.1339, 0.1627},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-7.3231, 16.5820, 9.8327, 0.5577},
-	{19.0091, -6.1027, -4.9983, 0.1305},
-	{17.8094, -7.3121, -4.0477, 0.1167},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-6.0713, 11.8433, -4.4390, 0.0147},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{4.9667, -12.4043, -12.2140, 0.3020},
-	{7.6038, -13.3962, -12.9579, 0.3404},
-	{14.2479, 5.9961, -13.3436, 0.7707},
-	{13.7087, 5.6327, -12.6901, 0.7654},
-	{14.3765, 3.5262, -12.5860, 0.7485},
-	{-5.7356, -0.1872, 1.5612, 0.1649},
-	{-5.6419, -0.8683, 2.5663, 0.1553},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-13.8226, -11.5519, 6.6074, 0.0726},
-	{-14.9446, -11.8283, 7.1555, 0.0551},
-	{-13.8697, -12.1496, 7.0522, 0.0584},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-15.4064, 12.0264, 16.0740, 0.7886},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{-6.5693, 17.4267, -0.0351, 0.9197},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{-7.6339, 7.3001, -1.5053, 0.2366},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-10.7238, 13.2526, 5.3022, 0.5253},
-	{-4.4049, -10.3551, 19.3219, 0.3746},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{-4.2039, -9.4613, 19.2196, 0.3761},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{5.4504, -10.3001, -3.7998, 0.2924},
-	{4.9971, -7.8016, -4.5740, 0.2924},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{-5.2140, -10.0014, 17.2077, 0.2563},
-	{-6.4427, -10.6470, 16.6438, 0.2649},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-13.3759, 11.0364, 12.4156, 0.9664},
-	{-13.6933, 10.6624, 12.4149, 0.9725},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{-13.7487, -5.1782, 5.3918, 0.0820},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{-9.4803, 12.3522, 5.2508, 0.5452},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-6.1421, 17.2667, 8.5627, 0.5428},
-	{-7.3231, 16.5820, 9.8327, 0.5577},
-	{7.6872, -13.4907, -2.3808, 0.3061},
-	{8.9170, -13.3225, -1.6060, 0.3021},
-	{7.8408, -13.4051, -1.3213, 0.2991},
-	{-2.9254, -5.9912, 8.0761, 0.8826},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{-2.1505, -12.2722, 14.8450, 0.3442},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-6.7421, 18.9786, 3.8471, 0.1667},
-	{-5.6286, 18.2818, 2.8314, 0.1551},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-3.1424, -2.1742, 1.2848, 0.0954},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{-3.3218, 1.9530, 0.0626, 0.1259},
-	{-1.2934, -2.9626, 3.4450, 0.8631},
-	{-2.2107, -2.1324, 2.2530, 0.8734},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{16.6136, -3.8818, -12.8358, 0.6186},
-	{17.7315, -3.9778, -13.0607, 0.6184},
-	{-2.8026, -8.3895, 11.8084, 0.4119},
-	{-5.1566, -7.8780, 13.1179, 0.4234},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-8.7774, 8.6926, 3.9697, 0.8727},
-	{14.1802, -0.9937, -11.1230, 0.8713},
-	{14.8098, -2.5640, -10.6530, 0.8545},
-	{15.3068, -1.7497, -10.4899, 0.8577},
-	{-9.7649, 17.7221, 1.9883, 0.9112},
-	{-10.6137, 16.9895, 1.9262, 0.9194},
-	{-11.4525, 17.7902, 3.6290, 0.9345},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{20.3088, 4.0338, -15.4419, 0.2502},
-	{19.3769, 3.7909, -15.6460, 0.2500},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{13.4484, -6.3018, 2.1993, 0.1945},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{-5.7272, 21.8698, 1.0093, 0.1903},
-	{-5.5654, 23.2070, 0.4411, 0.2008},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{0.3345, 8.3465, -7.6945, 0.6606},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{-10.9298, -15.2923, 7.8475, 0.6427},
-	{-3.6470, 18.9561, 6.4188, 0.8076},
-	{-3.1757, 20.1938, 4.8186, 0.8230},
-	{-5.6919, 17.9576, 7.0778, 0.7892},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{15.6815, -6.6533, -8.6324, 0.8268},
-	{15.4004, -7.5823, -8.0173, 0.8179},
-	{8.9170, -13.3225, -1.6060, 0.0265},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{7.8408, -13.4051, -1.3213, 0.0270},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{17.0896, -9.3267, -2.6090, 0.8143},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{15.6932, -10.2844, -1.9749, 0.7983},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-9.2031, 8.8315, 4.7525, 0.8754},
-	{-9.1270, 8.9055, 4.7912, 0.8756},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{18.8393, -7.2961, -11.5697, 0.5851},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-11.4002, 9.2178, 16.2556, 0.8678},
-	{-10.0676, 9.1055, 13.9447, 0.8641},
-	{-6.1421, 17.2667, 8.5627, 0.9360},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{-7.7625, 17.8735, 10.9254, 0.9601},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{-4.5626, 13.6823, 7.1706, 0.7617},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{14.5693, -3.3949, -2.0728, 0.2113},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{-6.9969, -13.3871, -5.6818, 0.2110},
-	{-13.0066, -13.0004, 10.1754, 0.2615},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{-12.0381, -12.8281, 11.8384, 0.2651},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{-9.4342, 17.9511, 0.6917, 0.8326},
-	{-8.8679, 19.8542, -2.8039, 0.8423},
-	{-2.7771, 3.5188, -0.9287, 0.6595},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-3.1747, 2.4325, -0.3482, 0.6528},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-8.0884, 14.9192, -4.8358, 0.7905},
-	{-8.5402, 15.4434, -2.5444, 0.7993},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{-9.0450, 19.0239, 8.0409, 0.9499},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{-10.2957, 11.8931, 0.9380, 0.7893},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-10.2581, 12.0264, 3.4608, 0.7746},
-	{-1.3468, 14.6962, 2.4091, 0.8110},
-	{-1.4154, 13.4463, 2.1669, 0.8011},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{15.3529, -14.5875, -13.2144, 0.4666},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{18.7331, -3.8729, -12.5950, 0.6190},
-	{18.1539, -0.2898, -12.6066, 0.6377},
-	{19.7848, -3.7773, -11.0931, 0.6172},
-	{3.8825, 13.2386, -7.3097, 0.5821},
-	{3.9552, 13.2021, -6.6886, 0.5815},
-	{4.3121, 12.9834, -7.4063, 0.5861},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{-2.2366, 9.2787, 3.5921, 0.7537},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{-3.0163, 8.7605, 2.8960, 0.7474},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{3.3873, 10.6530, -3.6019, 0.6932},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{-2.2366, 9.2787, 3.5921, 0.7537},
-	{-10.2034, 8.8741, 8.5897, 0.8893},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-11.9456, 8.8136, 7.3754, 0.8693},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{6.5721, 5.7225, -3.4183, 0.7286},
-	{7.1523, 4.0680, -5.7822, 0.7509},
-	{-11.0423, 13.9311, 15.2030, 0.5463},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{-4.8899, -13.6344, 11.3395, 0.3387},
-	{-3.5188, -14.6504, 12.7860, 0.3393},
-	{-4.7243, -15.1252, 12.6717, 0.3291},
-	{-4.2438, -5.4002, -4.8993, 0.5653},
-	{-3.3487, -5.8903, -5.8105, 0.5532},
-	{-3.4679, -9.3998, -5.3591, 0.5297},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-13.8697, -12.1496, 7.0522, 0.0584},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-13.4628, -12.9480, 7.0929, 0.0487},
-	{13.5308, 7.0843, -13.0842, 0.7003},
-	{14.2479, 5.9961, -13.3436, 0.6892},
-	{13.4943, 6.4487, -13.8804, 0.6923},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-2.0292, 12.1267, 3.1993, 0.7806},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-14.9962, -13.8446, 1.9274, 0.0835},
-	{-13.0094, -3.9825, 4.7249, 0.0974},
-	{-13.2106, -4.8603, 2.6326, 0.1109},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{3.5084, 8.9761, -1.7717, 0.6939},
-	{3.8734, 6.9597, -0.9593, 0.7040},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{19.6713, 5.2036, -15.5143, 0.3954},
-	{20.9750, 5.8844, -15.4046, 0.4019},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{-10.3590, -5.7197, 14.6062, 0.0525},
-	{-9.7973, -8.2993, 14.5111, 0.0328},
-	{-7.8423, -8.1706, 13.9791, 0.0418},
-	{-1.9473, 17.2903, 3.4253, 0.8207},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-1.8680, 17.5140, 2.2906, 0.8301},
-	{-3.0163, 8.7605, 2.8960, 0.2497},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{-2.5806, 9.5378, 1.6786, 0.2600},
-	{-11.9983, -3.5871, 4.0195, 0.1067},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{-10.7816, -3.4198, 3.2893, 0.1167},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-14.2470, 13.2123, 11.5925, 0.5032},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{20.2639, -11.6735, -6.5917, 0.1126},
-	{11.7920, -15.9856, -10.6589, 0.4637},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{-7.7625, 17.8735, 10.9254, 0.5685},
-	{-7.3231, 16.5820, 9.8327, 0.5577},
-	{-6.1421, 17.2667, 8.5627, 0.5428},
-	{-5.1508, -4.5724, -0.6738, 0.6078},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-4.4560, -3.6123, -3.3509, 0.5908},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{1.0083, -13.8803, 4.3449, 0.3265},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{3.5084, 8.9761, -1.7717, 0.6939},
-	{9.8295, -12.5934, -1.1503, 0.0610},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{11.0393, -9.9958, 0.1010, 0.1203},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-3.5419, -12.0626, 11.2357, 0.3295},
-	{-8.6857, 16.6325, -3.2761, 0.0743},
-	{-8.6669, 16.8675, -2.0938, 0.0820},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{-13.2004, 17.3741, 6.3688, 0.9677},
-	{-11.7527, 17.2797, 8.9606, 0.9755},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.5071, -14.6809, 4.7707, 0.3252},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-2.5633, -13.8926, 13.4230, 0.3492},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-3.5188, -14.6504, 12.7860, 0.3393},
-	{3.9330, -6.3697, -6.3282, 0.7610},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.4899, -10.4980, -6.1315, 0.7293},
-	{-10.6244, 18.6519, 10.0182, 0.9737},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{11.4715, -6.9738, -9.8564, 0.5492},
-	{11.8520, -6.7169, -9.3782, 0.5460},
-	{11.6555, -8.0978, -8.5264, 0.5325},
-	{11.2025, -6.2287, -8.8013, 0.6375},
-	{11.6555, -8.0978, -8.5264, 0.6199},
-	{11.8520, -6.7169, -9.3782, 0.6348},
-	{14.2918, -11.8568, -9.7028, 0.4623},
-	{14.8646, -11.7386, -11.9010, 0.4711},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{-12.8644, 18.7133, 14.5109, 0.6352},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{-9.2031, 8.8315, 4.7525, 0.8754},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{11.0406, -14.5414, -15.0672, 0.4265},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{1.6899, -11.8764, 3.3873, 0.3332},
-	{0.2826, -13.7945, 4.1088, 0.3172},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{-9.9824, 11.3279, 5.2837, 0.9759},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-1.1804, -15.5428, 0.7072, 0.7357},
-	{-4.0728, -16.0338, -0.9999, 0.7059},
-	{-2.8315, -15.2641, -1.9685, 0.7105},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-14.8950, 14.2712, 12.6602, 0.5035},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{14.2313, 3.0442, -14.0519, 0.6598},
-	{13.5400, 3.1643, -13.8915, 0.6593},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-10.5628, 7.9757, 3.4591, 0.8401},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-5.9165, -3.7333, 5.1811, 0.9105},
-	{-5.3177, -3.6893, 2.8291, 0.9048},
-	{-5.6964, -3.3373, 3.5129, 0.9122},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{-11.2724, 11.1845, 13.9605, 0.9353},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{4.9971, -7.8016, -4.5740, 0.2924},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{1.8234, -9.7317, -2.3379, 0.3857},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{-4.5269, 1.9740, 0.5355, 0.1904},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-5.4022, 3.3471, -0.3145, 0.2042},
-	{4.2327, -14.5406, -15.7300, 0.3292},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{4.6125, -13.6330, -16.4045, 0.3392},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{-8.5647, -15.5069, 1.8687, 0.6644},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{0.2665, -6.4448, 4.9095, 0.4142},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{1.4146, -4.1184, 3.1420, 0.4127},
-	{9.7438, -8.6649, -3.9130, 0.7482},
-	{11.5097, -9.9075, -2.5946, 0.7609},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{-5.2595, -15.4103, 8.3997, 0.6981},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-8.1640, -15.5292, 9.0067, 0.6730},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{15.7192, -16.0359, -9.7895, 0.4984},
-	{16.2911, -16.2725, -10.7365, 0.4904},
-	{16.6912, -15.2830, -9.9006, 0.5039},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{-11.2562, 9.6756, 18.9114, 0.8844},
-	{-11.8749, 9.5391, 19.4097, 0.8836},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{-9.1658, 14.6305, 14.1505, 0.5584},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-12.6683, 12.3101, 17.3168, 0.9059},
-	{-13.3308, 12.3683, 16.9123, 0.9122},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-12.0985, 15.6031, 5.6511, 0.6208},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-11.8462, 15.9685, 3.3982, 0.6100},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{3.1266, -9.8244, -9.9774, 0.2891},
-	{3.8133, -10.9201, -11.3600, 0.2879},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-6.0167, 13.5486, 7.5309, 0.5828},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{4.6527, 2.0609, -7.3862, 0.6558},
-	{4.3563, 2.0278, -7.9927, 0.6517},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{9.0131, -7.2971, -12.7473, 0.5559},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{-6.1073, 8.7623, 10.0622, 0.8654},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{-2.5633, -13.8926, 13.4230, 0.3361},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-2.8986, -14.9993, 14.7084, 0.3292},
-	{-2.1208, -13.0904, 15.2665, 0.3380},
-	{-2.8986, -14.9993, 14.7084, 0.3292},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-3.7684, 9.8448, -2.6950, 0.0122},
-	{-3.3588, 10.6414, -2.6192, 0.0220},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{12.0794, -2.9569, -2.4757, 0.2165},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{4.5081, -10.1702, -12.2700, 0.3314},
-	{5.3288, -10.1704, -12.9107, 0.3457},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-16.4857, -13.9655, 4.0352, 0.0387},
-	{-15.7605, -14.3025, 4.0597, 0.0294},
-	{12.7049, 7.9643, -11.6312, 0.7849},
-	{13.1608, 6.5094, -9.0719, 0.7656},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{-3.8425, 14.2969, -1.9023, 0.0575},
-	{-11.3339, -7.6051, 14.4357, 0.3174},
-	{-10.3590, -5.7197, 14.6062, 0.3324},
-	{-12.0376, -7.0010, 14.3549, 0.3227},
-	{-3.4391, 12.8762, -2.6620, 0.5304},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-3.8205, 3.5443, -1.0253, 0.2289},
-	{-3.6075, 4.8122, -1.5070, 0.2416},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-7.9645, 18.8758, 2.9852, 0.9073},
-	{-9.7649, 17.7221, 1.9883, 0.9112},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{13.8530, -0.1599, -11.1608, 0.8862},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{13.3282, -3.7156, -10.7981, 0.6700},
-	{11.8520, -6.7169, -9.3782, 0.6348},
-	{11.4715, -6.9738, -9.8564, 0.6418},
-	{11.8568, 2.4786, -3.5084, 0.2232},
-	{11.8280, 2.1740, -2.6673, 0.2222},
-	{12.8717, -0.1663, -2.2988, 0.2168},
-	{6.4971, 3.8652, -12.7361, 0.6727},
-	{6.2864, 6.7230, -13.4818, 0.6878},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-16.1453, 13.8767, 19.0847, 0.9486},
-	{-16.2789, 13.4436, 19.3009, 0.9487},
-	{-13.5612, 8.1108, 10.8602, 0.8266},
-	{-14.5913, 7.9342, 10.7804, 0.8198},
-	{-13.0748, 8.1682, 8.5429, 0.8261},
-	{6.5721, 5.7225, -3.4183, 0.6623},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{7.1523, 4.0680, -5.7822, 0.6746},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-0.5673, -4.7395, -7.3621, 0.5480},
-	{-1.6930, -7.7270, -6.3001, 0.5329},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{16.8963, -16.1990, -6.4198, 0.0669},
-	{15.5862, -16.2784, -8.8372, 0.0688},
-	{-2.5633, -13.8926, 13.4230, 0.3492},
-	{-3.5188, -14.6504, 12.7860, 0.3393},
-	{-3.5419, -12.0626, 11.2357, 0.3588},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{2.9738, -13.4960, 8.5257, 0.3585},
-	{-2.9694, 15.5825, 4.9978, 0.7955},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-14.5913, 7.9342, 10.7804, 0.8198},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{7.7965, 3.1330, -6.9403, 0.7635},
-	{9.5263, 5.6549, -5.3833, 0.7635},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{-9.4989, 15.6880, 15.2625, 0.5579},
-	{-9.1658, 14.6305, 14.1505, 0.5584},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{11.2181, 10.7934, -11.8837, 0.6613},
-	{12.0688, 10.1575, -12.5829, 0.6678},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{-5.5654, 23.2070, 0.4411, 0.2008},
-	{-5.7272, 21.8698, 1.0093, 0.1903},
-	{-5.5777, 22.6380, -0.2408, 0.1977},
-	{3.5957, -12.6132, -13.9383, 0.3173},
-	{5.6983, -13.3486, -13.6142, 0.2982},
-	{4.9667, -12.4043, -12.2140, 0.3014},
-	{3.8734, 6.9597, -0.9593, 0.1680},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{4.7116, 3.4303, -1.4022, 0.1377},
-	{-8.4173, -14.9636, 0.2931, 0.6652},
-	{-8.5647, -15.5069, 1.8687, 0.6644},
-	{-10.1598, -14.0057, 1.6100, 0.6434},
-	{11.8049, -12.8121, -1.1697, 0.0787},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{-1.6445, 15.5712, 0.4385, 0.8321},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{15.3068, -1.7497, -10.4899, 0.8577},
-	{16.9817, -3.7512, -7.5745, 0.8442},
-	{10.0119, -15.1105, 1.8163, 0.0292},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{11.6983, -15.0258, 1.4530, 0.0449},
-	{-15.5231, 16.5355, 10.9839, 0.6588},
-	{-14.3858, 14.0698, 7.8485, 0.6517},
-	{-15.8173, 15.5995, 10.1785, 0.6638},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-3.9698, 17.2277, 6.1559, 0.7962},
-	{13.4943, 6.4487, -13.8804, 0.6923},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-9.7820, 15.9348, -1.5339, 0.8029},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{16.7112, 1.6627, -13.8054, 0.5777},
-	{18.1539, -0.2898, -12.6066, 0.5539},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{12.1509, -11.9581, -1.3225, 0.0832},
-	{12.8661, -10.1185, -1.5813, 0.1194},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{3.4899, -10.4980, -6.1315, 0.2929},
-	{3.4180, -12.2527, -7.1864, 0.2967},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.1308, 9.0033, 4.9351, 0.8762},
-	{-9.1388, 9.0247, 5.0866, 0.8768},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{9.6717, -7.5794, -5.1277, 0.6204},
-	{-14.2759, 8.6461, 13.5203, 0.8841},
-	{-15.6423, 9.2485, 14.3285, 0.8823},
-	{-13.5612, 8.1108, 10.8602, 0.8756},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-15.0406, -14.2704, 5.7139, 0.0213},
-	{-15.7588, -13.7484, 6.1398, 0.0352},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-9.2443, -3.8060, 2.9851, 0.4482},
-	{-8.9049, -2.4916, 2.5529, 0.4585},
-	{-1.0391, 8.8979, -2.9978, 0.1975},
-	{-1.6232, 7.1243, -2.3440, 0.1797},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{17.3238, 9.8524, -13.2363, 0.4622},
-	{16.9610, 8.1775, -12.3740, 0.4503},
-	{17.9182, 10.0911, -12.8093, 0.4577},
-	{13.1134, -3.4813, 0.7268, 0.2101},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{12.2605, -3.7441, 0.7837, 0.2124},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{-10.9298, -15.2923, 7.8475, 0.2294},
-	{-9.7077, -15.0751, 10.4995, 0.2344},
-	{-1.2252, -14.1486, 14.8460, 0.3369},
-	{-0.8878, -13.2520, 14.3993, 0.3406},
-	{-1.4820, -13.0582, 15.1007, 0.3397},
-	{-5.6964, -3.3373, 3.5129, 0.1472},
-	{-6.1888, -2.2413, 4.8812, 0.1480},
-	{-5.9165, -3.7333, 5.1811, 0.1347},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.7238, 13.2526, 5.3022, 0.5253},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{12.2882, -6.7028, 1.6119, 0.2020},
-	{11.8405, -7.6519, 0.6353, 0.2150},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{11.0393, -9.9958, 0.1010, 0.2346},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{7.9798, -12.4199, -0.5672, 0.2774},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{13.4514, -1.8334, -12.3691, 0.6076},
-	{13.5467, -3.7221, -11.0855, 0.5868},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-14.3932, 11.6734, 11.3851, 0.7960},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{4.4382, 1.8068, -7.1852, 0.5119},
-	{-5.6338, 19.7575, -0.9304, 0.8979},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{-6.2107, 9.9377, -2.6858, 0.0110},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{1.0488, -0.8718, -8.3470, 0.4870},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{-0.5673, -4.7395, -7.3621, 0.4481},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{-5.8577, 20.5844, 1.1279, 0.8787},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{7.3895, -4.1480, -5.2012, 0.7918},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{-13.1699, -0.8163, 11.3602, 0.3848},
-	{-14.1231, -2.1933, 8.5906, 0.3739},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{-15.9358, -13.2805, 7.5333, 0.0438},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-5.2140, -10.0014, 17.2077, 0.2563},
-	{-6.5106, -9.7525, 14.7792, 0.2518},
-	{-6.4427, -10.6470, 16.6438, 0.2649},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{6.1616, -13.9989, 1.1924, 0.0272},
-	{5.8920, -12.9118, 1.0752, 0.0292},
-	{-8.3005, -8.7975, 14.1086, 0.4347},
-	{-7.9735, -11.3649, 13.7875, 0.4256},
-	{-7.8838, -9.6927, 14.6962, 0.4254},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{5.4766, 11.0116, -11.1080, 0.6009},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{-3.3950, 17.5301, 4.0116, 0.8987},
-	{-3.9068, 17.0203, 2.7177, 0.8908},
-	{-5.1424, 17.9868, 4.0749, 0.8853},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{-7.2512, -13.0756, 13.3614, 0.2976},
-	{-3.1757, 20.1938, 4.8186, 0.9102},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{-5.8711, 18.3209, 5.4078, 0.8771},
-	{-5.6013, -7.4408, -3.5952, 0.2626},
-	{-5.6884, -10.9949, -5.3392, 0.2364},
-	{-5.7302, -10.4307, -3.5717, 0.2365},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{-11.0064, 18.0806, 5.3000, 0.9440},
-	{-11.4525, 17.7902, 3.6290, 0.9345},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{14.8646, -11.7386, -11.9010, 0.4711},
-	{14.2918, -11.8568, -9.7028, 0.4623},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{5.4504, -10.3001, -3.7998, 0.2924},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{-11.8462, 15.9685, 3.3982, 0.6100},
-	{-12.4906, 14.1734, 4.7138, 0.6315},
-	{-12.0985, 15.6031, 5.6511, 0.6208},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-9.1658, 14.6305, 14.1505, 0.5584},
-	{-9.4989, 15.6880, 15.2625, 0.5579},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-14.9160, 12.0514, 14.8918, 0.9591},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-2.0292, 12.1267, 3.1993, 0.7806},
-	{-1.8086, 11.3231, 3.5388, 0.7723},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-13.3832, 19.3209, 16.4978, 0.5212},
-	{-15.6712, 18.9649, 14.5346, 0.5040},
-	{-5.1697, 17.6683, 1.8463, 0.1483},
-	{-5.3487, 17.2728, 0.1648, 0.1389},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{0.8645, -10.4892, 6.9072, 0.4002},
-	{-0.1145, -10.0834, 6.1052, 0.4133},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{0.6859, -15.3500, 9.3779, 0.3417},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{13.5308, 7.0843, -13.0842, 0.7003},
-	{13.4943, 6.4487, -13.8804, 0.6923},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{-11.5234, 15.0454, 15.0451, 0.5414},
-	{-11.8417, 15.0608, 15.9355, 0.5409},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{-10.3921, 5.2184, 5.6217, 0.4749},
-	{-11.7922, 3.1514, 5.9367, 0.4478},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{7.8717, -6.3096, -4.6083, 0.6240},
-	{9.6717, -7.5794, -5.1277, 0.6204},
-	{-0.1444, -0.5583, 2.5858, 0.0921},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{-12.7068, 19.1305, 16.2419, 0.6372},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{5.4030, -11.8653, -14.4697, 0.3470},
-	{5.0484, -12.1720, -15.4119, 0.3452},
-	{4.2351, -11.6789, -14.7300, 0.3341},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{18.8393, -7.2961, -11.5697, 0.5851},
-	{10.6709, -0.9026, -2.6175, 0.2174},
-	{12.1132, -1.6393, -1.0587, 0.2149},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{6.1616, -13.9989, 1.1924, 0.0308},
-	{5.5430, -15.0901, 1.9390, 0.0317},
-	{5.0994, -14.7806, 2.5423, 0.0321},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.5071, -14.6809, 4.7707, 0.3252},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{3.7022, 2.6929, -9.2950, 0.6522},
-	{3.6900, 4.9223, -11.1604, 0.6617},
-	{16.5977, 8.6787, -13.2350, 0.3090},
-	{17.3238, 9.8524, -13.2363, 0.3195},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{11.8405, -7.6519, 0.6353, 0.1804},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{11.8792, -9.2179, 1.6064, 0.1485},
-	{-8.2955, -9.4780, -0.7969, 0.1815},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-8.8689, -8.2056, -0.2558, 0.1688},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{-1.4154, 13.4463, 2.1669, 0.8011},
-	{-2.4610, 10.4681, 1.0558, 0.0358},
-	{-3.2529, 8.6209, -1.6967, 0.0110},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-13.5612, 8.1108, 10.8602, 0.8756},
-	{-11.9456, 8.8136, 7.3754, 0.8693},
-	{16.5977, 8.6787, -13.2350, 0.4599},
-	{15.7333, 9.3575, -12.3397, 0.4599},
-	{16.1312, 9.1850, -11.8702, 0.4569},
-	{-4.6755, 12.7546, 7.1437, 0.7542},
-	{-3.3840, 9.6117, 5.6685, 0.7400},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{2.5758, 0.3187, 1.3016, 0.1027},
-	{-4.8620, 8.5587, 6.0390, 0.7185},
-	{-4.2732, 8.4109, 5.3970, 0.7267},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-4.8640, 17.3333, 6.8541, 0.5309},
-	{-5.2348, 17.6435, 7.2606, 0.5335},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{-13.5994, 11.0540, 11.8702, 0.7938},
-	{-7.8039, 8.7067, -1.8271, 0.7201},
-	{-7.6339, 7.3001, -1.5053, 0.7106},
-	{-8.5480, 7.9971, -1.5354, 0.7178},
-	{-10.2581, 12.0264, 3.4608, 0.5257},
-	{-9.9824, 11.3279, 5.2837, 0.5462},
-	{-9.4803, 12.3522, 5.2508, 0.5452},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-9.2074, 8.0057, 1.9418, 0.2270},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{-3.1785, 11.4398, -3.0189, 0.5176},
-	{-3.3588, 10.6414, -2.6192, 0.5102},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{-4.5353, 10.3089, 7.1983, 0.7321},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{8.0087, 12.8555, -10.4614, 0.6296},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{7.1277, 12.9565, -9.2771, 0.6192},
-	{-14.6287, 16.5303, 14.2202, 0.5115},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{10.0313, -14.8641, -1.8649, 0.0204},
-	{11.3671, -14.2139, -1.2936, 0.0394},
-	{-4.8640, 17.3333, 6.8541, 0.7906},
-	{-3.6470, 18.9561, 6.4188, 0.8076},
-	{-5.2348, 17.6435, 7.2606, 0.7873},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-7.1422, 13.1945, -4.8339, 0.7730},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{-0.1145, -10.0834, 6.1052, 0.4133},
-	{-1.2166, -8.1388, 7.3111, 0.4319},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{-10.6823, 9.2650, 4.7444, 0.8526},
-	{-11.9456, 8.8136, 7.3754, 0.8409},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{-1.2166, -8.1388, 7.3111, 0.8568},
-	{-0.1145, -10.0834, 6.1052, 0.8343},
-	{0.1575, -8.3765, 5.6596, 0.8381},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-11.7922, 3.1514, 5.9367, 0.1588},
-	{-10.3921, 5.2184, 5.6217, 0.1830},
-	{-7.0339, -12.9896, 15.9542, 0.2882},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{-12.8644, 18.7133, 14.5109, 0.6352},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-3.8205, 3.5443, -1.0253, 0.2289},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-4.2002, 2.5427, -0.0851, 0.2171},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{16.8039, -11.6417, -1.7451, 0.0724},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{-9.4333, 16.2045, 11.2308, 0.5860},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{13.5460, 7.7707, -13.1546, 0.7073},
-	{13.5308, 7.0843, -13.0842, 0.7003},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{9.7517, 2.8258, -6.1310, 0.8623},
-	{7.7965, 3.1330, -6.9403, 0.8689},
-	{8.2621, 1.8440, -7.1220, 0.8530},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{-2.1208, -13.0904, 15.2665, 0.3293},
-	{-2.9906, -12.7535, 17.1323, 0.3083},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{-12.2912, -13.8790, 5.4687, 0.0896},
-	{-15.7605, -14.3025, 4.0597, 0.0726},
-	{-14.9962, -13.8446, 1.9274, 0.0843},
-	{6.1296, -14.3129, 2.8526, 0.0323},
-	{6.7492, -13.6822, 3.4298, 0.0338},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-14.3932, 11.6734, 11.3851, 0.7960},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{-3.0351, 20.7927, -4.1365, 0.9026},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-5.6338, 19.7575, -0.9304, 0.8979},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-14.7525, 11.8802, 17.4181, 0.9523},
-	{-13.8602, 12.2784, 17.5724, 0.9513},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-6.1421, 17.2667, 8.5627, 0.5428},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{10.5792, 8.8619, -6.2095, 0.7699},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-1.9653, -13.4975, 8.6495, 0.3180},
-	{-14.3858, 14.0698, 7.8485, 0.4798},
-	{-15.3480, 14.3281, 9.2437, 0.4848},
-	{-15.8173, 15.5995, 10.1785, 0.4825},
-	{-14.8154, 10.6544, 18.2212, 0.8841},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{-14.8421, 11.2524, 18.0801, 0.8918},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{-8.6392, 15.8281, 14.3538, 0.5845},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{-5.9376, -12.6567, -6.4934, 0.2215},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{4.9667, -12.4043, -12.2140, 0.3925},
-	{5.6983, -13.3486, -13.6142, 0.3866},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{-3.1424, -2.1742, 1.2848, 0.8830},
-	{-2.2107, -2.1324, 2.2530, 0.8734},
-	{-1.2322, -0.9956, 2.3762, 0.8603},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-12.8898, 16.6579, 5.0217, 0.9526},
-	{-13.2004, 17.3741, 6.3688, 0.9677},
-	{-12.2677, 17.6232, 5.6051, 0.9551},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{14.2313, 3.0442, -14.0519, 0.5939},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-5.9280, 13.3316, -2.6581, 0.0378},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.2826, -13.7945, 4.1088, 0.3207},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-5.3487, 17.2728, 0.1648, 0.1389},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{9.8648, 10.5618, -12.0736, 0.6472},
-	{9.5217, 9.0918, -13.6644, 0.6392},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{13.7087, 5.6327, -12.6901, 0.7654},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{12.9596, 8.6504, -12.8349, 0.7178},
-	{13.5460, 7.7707, -13.1546, 0.7073},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{4.6205, 1.6841, -7.1764, 0.5102},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{-2.5806, 9.5378, 1.6786, 0.7571},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{-3.0163, 8.7605, 2.8960, 0.7474},
-	{14.5693, -3.3949, -2.0728, 0.2113},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{11.7425, -5.6727, -2.1637, 0.2275},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{17.9182, 10.0911, -12.8093, 0.4577},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{-7.6339, 7.3001, -1.5053, 0.7106},
-	{-8.8486, 8.0071, 0.5674, 0.7176},
-	{-9.4129, 9.0688, -0.3582, 0.7311},
-	{14.0837, -7.3474, -1.4411, 0.2237},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{-1.7488, 15.0511, 0.4650, 0.8306},
-	{-1.6445, 15.5712, 0.4385, 0.8321},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{-10.5027, 17.4226, -1.1235, 0.8231},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-11.0690, 16.0556, 1.8443, 0.8062},
-	{-10.8781, -1.3382, 13.3228, 0.3803},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{-12.0306, -0.8041, 12.5914, 0.3841},
-	{-11.8462, 15.9685, 3.3982, 0.9370},
-	{-10.6137, 16.9895, 1.9262, 0.9194},
-	{-11.0690, 16.0556, 1.8443, 0.9218},
-	{-4.9850, 15.7308, 7.3268, 0.7769},
-	{-4.6971, 15.2349, 7.8126, 0.7733},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-6.6453, 9.8843, -3.2180, 0.0086},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{13.3984, -0.0488, -9.0357, 0.7021},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{-3.6688, -9.8199, 17.8896, 0.3740},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{12.0794, -2.9569, -2.4757, 0.2165},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{-1.2166, -8.1388, 7.3111, 0.8568},
-	{0.1575, -8.3765, 5.6596, 0.8381},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{-9.6062, 10.9789, 0.2842, 0.8052},
-	{-9.4129, 9.0688, -0.3582, 0.8254},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{7.3495, -7.8825, -3.7080, 0.7180},
-	{7.8717, -6.3096, -4.6083, 0.7219},
-	{6.1305, -5.9681, -4.7409, 0.7092},
-	{5.8920, -12.9118, 1.0752, 0.0338},
-	{6.1616, -13.9989, 1.1924, 0.0308},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{7.6038, -13.3962, -12.9579, 0.4030},
-	{4.9667, -12.4043, -12.2140, 0.3925},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{-1.2934, -2.9626, 3.4450, 0.8631},
-	{-1.2322, -0.9956, 2.3762, 0.8603},
-	{-2.2107, -2.1324, 2.2530, 0.8734},
-	{-4.9357, 20.1317, 0.2527, 0.8863},
-	{-5.6338, 19.7575, -0.9304, 0.8979},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{3.9330, -6.3697, -6.3282, 0.7610},
-	{4.2656, -6.8950, -5.4206, 0.7571},
-	{-1.9473, 17.2903, 3.4253, 0.8207},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{2.9304, 12.4364, -6.1754, 0.6944},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{3.9552, 13.2021, -6.6886, 0.7045},
-	{12.2527, -16.0877, -2.5494, 0.2893},
-	{10.0313, -14.8641, -1.8649, 0.2859},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{7.9798, -12.4199, -0.5672, 0.2774},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{-11.7527, 17.2797, 8.9606, 0.6102},
-	{-13.2004, 17.3741, 6.3688, 0.6046},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-3.1260, 13.4372, 0.7263, 0.0641},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{11.8049, -12.8121, -1.1697, 0.0787},
-	{12.1509, -11.9581, -1.3225, 0.0832},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-9.4275, -0.7323, 12.9708, 0.1038},
-	{-6.9060, -3.5212, 12.3504, 0.0889},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{-8.5412, -12.6516, 13.2794, 0.2571},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-7.9911, -14.1694, 12.0448, 0.2384},
-	{9.8295, -12.5934, -1.1503, 0.0610},
-	{8.9535, -13.0259, 0.0785, 0.0505},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{13.4319, 0.4791, -13.3091, 0.6328},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{13.5400, 3.1643, -13.8915, 0.6593},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{-6.9060, -3.5212, 12.3504, 0.0889},
-	{-5.7258, -3.4623, 10.9865, 0.0998},
-	{13.7087, 5.6327, -12.6901, 0.7654},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{14.3765, 3.5262, -12.5860, 0.7485},
-	{-3.6688, -9.8199, 17.8896, 0.3740},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{-3.8338, -11.1945, 17.8398, 0.3669},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-5.8625, 9.1580, 10.2919, 0.8705},
-	{-6.1073, 8.7623, 10.0622, 0.8654},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{-0.4557, 10.6176, -0.3438, 0.8410},
-	{-1.6048, 9.9904, 0.9322, 0.8282},
-	{-2.4610, 10.4681, 1.0558, 0.8310},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-13.1612, -12.5771, 0.9637, 0.1158},
-	{-9.1693, -16.0589, -3.5740, 0.1878},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{-5.3487, 17.2728, 0.1648, 0.1389},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{-9.6771, -6.4746, 1.4750, 0.4222},
-	{-8.0651, -6.7623, 0.6161, 0.4252},
-	{-8.8689, -8.2056, -0.2558, 0.4066},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-1.8086, 11.3231, 3.5388, 0.7723},
-	{-2.0292, 12.1267, 3.1993, 0.7806},
-	{-11.5234, 15.0454, 15.0451, 0.5414},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{9.1599, -1.9722, -5.5275, 0.6693},
-	{7.3895, -4.1480, -5.2012, 0.6444},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{2.9321, -10.9125, 6.7375, 0.3750},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{10.9563, 2.9436, -3.8503, 0.2248},
-	{11.8568, 2.4786, -3.5084, 0.2232},
-	{20.7549, 9.4214, -14.0206, 0.4381},
-	{19.5309, 6.9339, -14.4090, 0.4183},
-	{20.6673, 9.3354, -14.9361, 0.4342},
-	{6.5974, 1.7343, -11.0098, 0.8552},
-	{6.4971, 3.8652, -12.7361, 0.8777},
-	{6.4395, 0.0270, -11.5685, 0.8380},
-	{-2.9906, -12.7535, 17.1323, 0.3083},
-	{-4.1140, -12.9082, 17.9578, 0.2986},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{2.6548, 12.5272, -5.5084, 0.6901},
-	{1.6235, 11.5088, -5.1563, 0.6792},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-11.9540, -13.0669, 2.8997, 0.6218},
-	{-11.3900, -13.1882, 3.0702, 0.6276},
-	{-12.2912, -13.8790, 5.4687, 0.6239},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-8.6669, 16.8675, -2.0938, 0.0820},
-	{-8.2290, 16.8279, -1.5123, 0.0853},
-	{15.7142, -16.0203, -4.2003, 0.8052},
-	{12.2527, -16.0877, -2.5494, 0.7870},
-	{8.8292, -15.9295, -4.5847, 0.7410},
-	{-12.8920, 19.6497, 14.0500, 0.6361},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-12.8644, 18.7133, 14.5109, 0.6352},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{6.1397, -7.9026, -13.4031, 0.5537},
-	{5.3288, -10.1704, -12.9107, 0.5344},
-	{12.0688, 10.1575, -12.5829, 0.6678},
-	{12.1583, 9.6234, -12.5125, 0.6694},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{3.5084, 8.9761, -1.7717, 0.1884},
-	{3.3873, 10.6530, -3.6019, 0.2048},
-	{-8.6857, 16.6325, -3.2761, 0.8097},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-9.7820, 15.9348, -1.5339, 0.8029},
-	{-6.8149, 9.0396, -2.3429, 0.2549},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{-7.6339, 7.3001, -1.5053, 0.2366},
-	{5.3288, -10.1704, -12.9107, 0.3457},
-	{5.5093, -10.8981, -14.2069, 0.3446},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{8.6869, -7.8374, -3.9421, 0.2785},
-	{7.3495, -7.8825, -3.7080, 0.2864},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{20.4856, -10.3916, -8.0896, 0.5411},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{6.8810, 13.3788, -8.8553, 0.7427},
-	{5.6695, 13.0500, -8.3983, 0.7286},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{-9.1351, -15.9701, -2.1212, 0.1799},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{-12.5500, 13.8732, 8.7463, 0.5142},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{15.7121, 3.2941, -15.5172, 0.2452},
-	{14.2423, 5.8573, -13.6831, 0.2718},
-	{15.0203, 6.6327, -12.5542, 0.2825},
-	{14.4858, 6.5577, -13.7337, 0.2773},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{10.9877, -10.4792, -10.3544, 0.5263},
-	{9.0131, -7.2971, -12.7473, 0.5559},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{-8.7441, 4.4453, 9.4249, 0.1715},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{-1.9653, -13.4975, 8.6495, 0.7386},
-	{-3.2417, -14.8505, 8.1421, 0.7259},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-9.1308, 9.0033, 4.9351, 0.8762},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-11.1472, 15.1347, 15.5449, 0.5445},
-	{-11.5234, 15.0454, 15.0451, 0.5414},
-	{-11.0423, 13.9311, 15.2030, 0.5463},
-	{7.8408, -13.4051, -1.3213, 0.0270},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{-3.9698, 17.2277, 6.1559, 0.7962},
-	{-4.8640, 17.3333, 6.8541, 0.7906},
-	{-4.9850, 15.7308, 7.3268, 0.7769},
-	{-9.4225, 17.1743, 10.4049, 0.5847},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{-3.4123, -11.7058, -4.5972, 0.3715},
-	{-1.6930, -7.7270, -6.3001, 0.4134},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.5867, 12.4049, 1.9497, 0.5043},
-	{-10.2581, 12.0264, 3.4608, 0.5257},
-	{2.5758, 0.3187, 1.3016, 0.1027},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{-1.3859, -4.7436, 5.1290, 0.8657},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{14.8646, -11.7386, -11.9010, 0.4711},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{6.8770, -16.4242, -9.7199, 0.3341},
-	{5.5196, -15.3375, -10.0566, 0.3229},
-	{3.7022, 2.6929, -9.2950, 0.5192},
-	{4.3563, 2.0278, -7.9927, 0.5156},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{15.2447, -1.2590, -13.5010, 0.5522},
-	{16.6136, -3.8818, -12.8358, 0.5299},
-	{14.2867, -1.1365, -12.1842, 0.5497},
-	{3.5957, -12.6132, -13.9383, 0.3249},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{5.6983, -13.3486, -13.6142, 0.3123},
-	{-6.8149, 9.0396, -2.3429, 0.2549},
-	{-4.6419, 8.1669, -2.3560, 0.2539},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{20.6673, 9.3354, -14.9361, 0.3078},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{18.5321, 8.5916, -13.5023, 0.3184},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{4.3563, 2.0278, -7.9927, 0.5156},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{0.1575, -8.3765, 5.6596, 0.4081},
-	{0.2773, -10.0645, 5.6429, 0.4054},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-7.0339, -12.9896, 15.9542, 0.2882},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{12.6402, -10.8638, -1.7331, 0.7674},
-	{13.5579, -11.9461, -1.2313, 0.7777},
-	{12.5645, -10.4628, -2.0711, 0.7701},
-	{-7.8039, 8.7067, -1.8271, 0.4866},
-	{-6.8149, 9.0396, -2.3429, 0.4911},
-	{-7.6339, 7.3001, -1.5053, 0.4795},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{-8.7774, 8.6926, 3.9697, 0.8727},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-4.2684, -13.2530, -3.7415, 0.2326},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-3.4123, -11.7058, -4.5972, 0.2475},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-12.0985, 15.6031, 5.6511, 0.6208},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{-4.8620, 8.5587, 6.0390, 0.2253},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-4.2732, 8.4109, 5.3970, 0.2307},
-	{-16.1837, -14.0899, 7.7824, 0.0426},
-	{-15.9358, -13.2805, 7.5333, 0.0438},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-1.3049, -13.0380, 13.3464, 0.3427},
-	{-1.6805, -14.1400, 13.2937, 0.3375},
-	{-14.5351, 17.0043, 11.6655, 0.6509},
-	{-15.9215, 16.1249, 11.5135, 0.6668},
-	{-15.0219, 17.8180, 12.9105, 0.6557},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-8.8358, 16.4585, 12.7067, 0.5831},
-	{-7.2728, 15.1755, 12.1963, 0.5610},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-5.1697, 17.6683, 1.8463, 0.1483},
-	{-0.5514, 22.0208, -6.4770, 0.1569},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{-6.7421, 18.9786, 3.8471, 0.9049},
-	{-7.9645, 18.8758, 2.9852, 0.9073},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-0.0238, 10.3640, 0.0562, 0.7833},
-	{8.6869, -7.8374, -3.9421, 0.7319},
-	{9.6717, -7.5794, -5.1277, 0.7419},
-	{7.8717, -6.3096, -4.6083, 0.7219},
-	{-8.0148, 9.8406, 10.4461, 0.9169},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-10.2034, 8.8741, 8.5897, 0.8893},
-	{-13.3672, -11.3660, 11.3147, 0.2798},
-	{-13.7866, -10.0667, 11.4884, 0.2912},
-	{-13.0066, -13.0004, 10.1754, 0.2615},
-	{10.1601, 11.8141, -11.3540, 0.7905},
-	{10.8335, 11.4811, -11.1021, 0.7945},
-	{11.0841, 11.4103, -12.0361, 0.8006},
-	{-8.6857, 16.6325, -3.2761, 0.8097},
-	{-8.5402, 15.4434, -2.5444, 0.7993},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-12.8898, 16.6579, 5.0217, 0.9526},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{-11.8462, 15.9685, 3.3982, 0.9370},
-	{-7.4131, -14.9587, 7.6645, 0.6798},
-	{-8.1640, -15.5292, 9.0067, 0.6730},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{-3.8697, 15.0446, -1.9699, 0.0638},
-	{-5.1697, 17.6683, 1.8463, 0.1062},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{12.0129, -5.9750, -2.1689, 0.2289},
-	{-11.0891, 2.0356, 3.3666, 0.1614},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{14.4858, 6.5577, -13.7337, 0.2773},
-	{15.0203, 6.6327, -12.5542, 0.2825},
-	{15.3091, 7.3063, -13.3422, 0.2882},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{0.2665, -6.4448, 4.9095, 0.8426},
-	{1.4146, -4.1184, 3.1420, 0.8351},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-10.6244, 18.6519, 10.0182, 0.9737},
-	{-10.2018, 18.0151, 10.2676, 0.9729},
-	{-2.8026, -8.3895, 11.8084, 0.4119},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{1.2794, -12.0556, 8.1840, 0.3793},
-	{8.3087, -6.7818, -13.5410, 0.5642},
-	{7.2311, -6.7954, -13.7344, 0.5641},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{15.7121, 3.2941, -15.5172, 0.2452},
-	{15.1046, 1.7508, -14.9670, 0.2328},
-	{-13.5526, -8.7411, 5.2566, 0.0781},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-5.9372, 10.1045, -6.6120, 0.7312},
-	{-6.3928, 9.7681, -6.3590, 0.7282},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-13.5994, 11.0540, 11.8702, 0.7938},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-6.3602, 15.5921, -4.9454, 0.7987},
-	{-6.2313, 14.9946, -5.1307, 0.7916},
-	{-9.4225, 17.1743, 10.4049, 0.5847},
-	{-8.3499, 17.2083, 10.7745, 0.5724},
-	{-9.4637, 18.1300, 10.8893, 0.5836},
-	{-3.3950, 17.5301, 4.0116, 0.8987},
-	{-5.1424, 17.9868, 4.0749, 0.8853},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{-6.3176, -3.5979, 3.2811, 0.4674},
-	{-5.8695, -2.3683, 3.3816, 0.4762},
-	{-5.6964, -3.3373, 3.5129, 0.4721},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{17.8094, -7.3121, -4.0477, 0.1167},
-	{17.0896, -9.3267, -2.6090, 0.0930},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{-3.3588, 10.6414, -2.6192, 0.5102},
-	{-3.7684, 9.8448, -2.6950, 0.5029},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-0.5514, 22.0208, -6.4770, 0.1569},
-	{-2.3956, 20.9802, -3.5110, 0.1641},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{-8.2512, 11.6577, 9.3403, 0.9182},
-	{-10.7215, 10.6147, 13.3614, 0.9113},
-	{11.6827, -4.4620, -0.7342, 0.2189},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{13.3984, -0.0488, -9.0357, 0.7021},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{16.8963, -16.1990, -6.4198, 0.0669},
-	{-4.2732, 8.4109, 5.3970, 0.7267},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-9.6062, 10.9789, 0.2842, 0.7499},
-	{-10.2957, 11.8931, 0.9380, 0.7604},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{1.5702, -4.3984, 3.5911, 0.4075},
-	{-0.0238, 10.3640, 0.0562, 0.8347},
-	{-1.6048, 9.9904, 0.9322, 0.8282},
-	{-0.4557, 10.6176, -0.3438, 0.8410},
-	{8.6869, -7.8374, -3.9421, 0.2785},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{9.3985, -8.0758, -3.7579, 0.2723},
-	{7.3338, -9.6020, -14.6035, 0.3620},
-	{5.3288, -10.1704, -12.9107, 0.3404},
-	{6.7415, -7.6320, -14.1992, 0.3485},
-	{6.9485, -13.1409, -1.5811, 0.0278},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{15.7142, -16.0203, -4.2003, 0.0483},
-	{16.8963, -16.1990, -6.4198, 0.0669},
-	{13.8530, -0.1599, -11.1608, 0.8862},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{-17.1632, -14.0962, 6.0941, 0.0404},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-15.7588, -13.7484, 6.1398, 0.0352},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{0.2665, -6.4448, 4.9095, 0.8426},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{-3.3588, 10.6414, -2.6192, 0.0220},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{-7.3083, 9.8503, -3.6142, 0.0055},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-15.5231, 16.5355, 10.9839, 0.6588},
-	{-15.8173, 15.5995, 10.1785, 0.6638},
-	{-15.9215, 16.1249, 11.5135, 0.6668},
-	{4.5081, -10.1702, -12.2700, 0.3314},
-	{2.2925, -11.3431, -11.5562, 0.3208},
-	{3.8133, -10.9201, -11.3600, 0.3164},
-	{-0.8419, 22.2036, -6.8040, 0.9055},
-	{-0.5514, 22.0208, -6.4770, 0.9061},
-	{-0.9228, 21.0701, -6.0281, 0.9113},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-13.3832, 19.3209, 16.4978, 0.5212},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{16.9914, -11.4795, -10.5309, 0.1926},
-	{-12.2912, -13.8790, 5.4687, 0.0211},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-15.0406, -14.2704, 5.7139, 0.0275},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{4.2656, -6.8950, -5.4206, 0.7571},
-	{-1.0330, -14.2897, 14.1703, 0.3374},
-	{-1.3049, -13.0380, 13.3464, 0.3427},
-	{-0.8878, -13.2520, 14.3993, 0.3406},
-	{11.7425, -5.6727, -2.1637, 0.2275},
-	{11.6590, -5.8169, -2.1081, 0.2285},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{6.5721, 5.7225, -3.4183, 0.7286},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{7.2660, 7.1829, -3.5873, 0.7325},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{7.2660, 7.1829, -3.5873, 0.7325},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{-5.7023, -5.3300, 1.5778, 0.4516},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-6.4156, 16.9751, -6.7188, 0.0351},
-	{-8.1047, 16.5628, -3.4644, 0.0678},
-	{10.5673, 4.1132, -5.9404, 0.7320},
-	{9.5263, 5.6549, -5.3833, 0.7370},
-	{9.7517, 2.8258, -6.1310, 0.7167},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{13.2540, -12.8488, -12.8420, 0.4433},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{13.1134, -3.4813, 0.7268, 0.2101},
-	{12.9082, -4.6149, 0.6032, 0.2096},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{5.5430, -15.0901, 1.9390, 0.0317},
-	{6.1616, -13.9989, 1.1924, 0.0308},
-	{7.2285, -14.4412, 1.5781, 0.0292},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-12.8920, 19.6497, 14.0500, 0.6361},
-	{-12.9679, 19.7861, 13.2026, 0.6355},
-	{-3.6688, -9.8199, 17.8896, 0.3740},
-	{-3.8338, -11.1945, 17.8398, 0.3669},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{-13.0884, 9.7546, 19.4461, 0.8829},
-	{-14.8154, 10.6544, 18.2212, 0.8841},
-	{-12.6273, 9.7881, 17.5171, 0.8708},
-	{-9.4803, 12.3522, 5.2508, 0.9654},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{-7.7815, 12.5430, 7.2711, 0.9366},
-	{12.2079, -9.3668, -8.0887, 0.1703},
-	{13.4557, -9.2055, -7.4906, 0.1828},
-	{13.6551, -10.3289, -8.1256, 0.1770},
-	{-5.6919, 17.9576, 7.0778, 0.9210},
-	{-5.8711, 18.3209, 5.4078, 0.9087},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-11.7527, 17.2797, 8.9606, 0.6102},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{-2.2107, -2.1324, 2.2530, 0.8734},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{-11.3729, 8.5680, 3.3709, 0.8278},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-15.0219, 17.8180, 12.9105, 0.6557},
-	{-16.4007, 17.7258, 12.8735, 0.6674},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{6.9646, -12.7086, -15.8348, 0.3676},
-	{11.0393, -9.9958, 0.1010, 0.1203},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{11.8405, -7.6519, 0.6353, 0.1804},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-4.9850, 15.7308, 7.3268, 0.5230},
-	{-4.8640, 17.3333, 6.8541, 0.5309},
-	{3.8133, -10.9201, -11.3600, 0.5250},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{4.5081, -10.1702, -12.2700, 0.5313},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{14.0837, -7.3474, -1.4411, 0.1947},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-6.9060, -3.5212, 12.3504, 0.0889},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{-7.9645, 18.8758, 2.9852, 0.9073},
-	{-7.9851, 18.2976, 1.7329, 0.8971},
-	{-9.7649, 17.7221, 1.9883, 0.9112},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{7.3895, -4.1480, -5.2012, 0.7918},
-	{9.1599, -1.9722, -5.5275, 0.8091},
-	{6.4857, -8.3881, -2.6518, 0.2860},
-	{6.2600, -8.5717, -3.7011, 0.2957},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{4.7612, -14.0902, -0.0963, 0.0283},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{4.8188, -14.9696, -0.7263, 0.0282},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{-10.2581, 12.0264, 3.4608, 0.7746},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-12.2685, 10.2071, 9.0742, 0.7874},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{-15.4862, 11.8869, 14.3393, 0.7910},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{10.9563, 2.9436, -3.8503, 0.2248},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{4.6527, 2.0609, -7.3862, 0.6558},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-4.8198, 18.0222, -1.5566, 0.9220},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-2.8143, 19.2991, -4.1041, 0.9199},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{6.5721, 5.7225, -3.4183, 0.6623},
-	{4.7116, 3.4303, -1.4022, 0.6461},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-2.3863, 5.5169, -1.6251, 0.6677},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{-6.7962, -13.7906, 12.5367, 0.3109},
-	{-7.2512, -13.0756, 13.3614, 0.2976},
-	{-7.4007, -12.7785, 13.4808, 0.2936},
-	{-3.4554, 16.4095, 1.9054, 0.8878},
-	{0.0936, 17.0687, -0.7948, 0.9101},
-	{-1.6445, 15.5712, 0.4385, 0.8906},
-	{-13.0094, -3.9825, 4.7249, 0.0974},
-	{-11.9983, -3.5871, 4.0195, 0.1109},
-	{-13.2106, -4.8603, 2.6326, 0.1109},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{8.8292, -15.9295, -4.5847, 0.3012},
-	{12.2527, -16.0877, -2.5494, 0.2893},
-	{-5.2140, -10.0014, 17.2077, 0.3884},
-	{-5.0157, -9.4098, 18.4349, 0.3794},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{6.2864, 6.7230, -13.4818, 0.6878},
-	{8.2491, 5.1440, -14.7678, 0.6833},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{-12.7068, 19.1305, 16.2419, 0.5275},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-11.9356, 18.1080, 17.5606, 0.5356},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{19.7660, -12.2128, -4.6087, 0.0976},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-13.2004, 17.3741, 6.3688, 0.6046},
-	{-12.8898, 16.6579, 5.0217, 0.6081},
-	{-16.7748, -12.8433, 3.4249, 0.0537},
-	{-16.4857, -13.9655, 4.0352, 0.0387},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{-7.3770, 16.6115, -0.9756, 0.0812},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-8.2290, 16.8279, -1.5123, 0.0853},
-	{8.1631, -13.4727, 5.2951, 0.0435},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{-14.6607, -8.2925, 9.4719, 0.0376},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{-13.8697, -12.1496, 7.0522, 0.0112},
-	{8.7774, 12.6658, -10.4472, 0.7717},
-	{8.2892, 13.0061, -9.5667, 0.7615},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{-6.6939, -8.2873, 13.3505, 0.4357},
-	{-5.1566, -7.8780, 13.1179, 0.4361},
-	{0.3345, 8.3465, -7.6945, 0.5390},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{1.5287, 8.0947, -9.6845, 0.5536},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{-9.8680, 12.0612, 7.4716, 0.9582},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{11.8792, -9.2179, 1.6064, 0.1485},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{9.3985, -8.0758, -3.7579, 0.7392},
-	{9.7438, -8.6649, -3.9130, 0.7482},
-	{8.6869, -7.8374, -3.9421, 0.7319},
-	{19.7848, -3.7773, -11.0931, 0.6172},
-	{20.5771, -6.1904, -9.3752, 0.5929},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{2.1439, 2.8748, -9.7078, 0.5338},
-	{0.5962, 1.1958, -9.0417, 0.5262},
-	{0.8369, 3.9820, -9.5500, 0.5288},
-	{16.1312, 9.1850, -11.8702, 0.4569},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{16.9610, 8.1775, -12.3740, 0.4503},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-10.3399, 8.3952, 17.0063, 0.8775},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-9.1693, -16.0589, -3.5740, 0.1878},
-	{-13.1612, -12.5771, 0.9637, 0.1158},
-	{6.5583, 8.0535, -3.0016, 0.7222},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{3.8734, 6.9597, -0.9593, 0.7040},
-	{6.5974, 1.7343, -11.0098, 0.8552},
-	{6.8583, 2.2363, -8.9013, 0.8582},
-	{6.2632, 3.1052, -10.7167, 0.8696},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-10.7255, 13.2299, 5.2475, 0.5248},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-6.4854, 22.2496, 1.8210, 0.8633},
-	{-7.0645, 21.8360, 1.3711, 0.8689},
-	{-7.9645, 18.8758, 2.9852, 0.8962},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{0.5962, 1.1958, -9.0417, 0.5931},
-	{1.0488, -0.8718, -8.3470, 0.5717},
-	{-0.5673, -4.7395, -7.3621, 0.5626},
-	{-5.5554, 14.2622, -6.8740, 0.7840},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-6.2313, 14.9946, -5.1307, 0.7916},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{-7.1422, 13.1945, -4.8339, 0.7730},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{7.7965, 3.1330, -6.9403, 0.6859},
-	{7.1523, 4.0680, -5.7822, 0.6746},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{-8.7774, 8.6926, 3.9697, 0.8727},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-9.2074, 8.0057, 1.9418, 0.8645},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{-5.6013, -7.4408, -3.5952, 0.4154},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{11.5682, -12.8394, -0.4424, 0.0719},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{6.4376, 13.1912, -9.4032, 0.6132},
-	{6.8810, 13.3788, -8.8553, 0.6145},
-	{7.1277, 12.9565, -9.2771, 0.6192},
-	{8.2491, 5.1440, -14.7678, 0.6833},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{-8.6669, 16.8675, -2.0938, 0.8156},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{4.5081, -10.1702, -12.2700, 0.3314},
-	{3.4480, -10.1667, -13.4966, 0.3282},
-	{2.2925, -11.3431, -11.5562, 0.3208},
-	{-13.3672, -11.3660, 11.3147, 0.2798},
-	{-13.0066, -13.0004, 10.1754, 0.2615},
-	{-12.0381, -12.8281, 11.8384, 0.2651},
-	{-2.2366, 9.2787, 3.5921, 0.7537},
-	{-3.0163, 8.7605, 2.8960, 0.7474},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{-3.1757, 20.1938, 4.8186, 0.9102},
-	{-2.9525, 20.3107, 3.3361, 0.9140},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{0.5456, 10.8315, -4.4069, 0.6997},
-	{1.1812, 11.9400, -4.8896, 0.7062},
-	{1.0077, 10.1127, -5.6591, 0.6879},
-	{12.7049, 7.9643, -11.6312, 0.8185},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{13.1608, 6.5094, -9.0719, 0.7985},
-	{15.7121, 3.2941, -15.5172, 0.5880},
-	{16.6223, 3.0472, -15.0082, 0.5919},
-	{16.7112, 1.6627, -13.8054, 0.5777},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{14.2423, 5.8573, -13.6831, 0.6857},
-	{14.2313, 3.0442, -14.0519, 0.6598},
-	{-17.8252, -14.4751, 3.7252, 0.0687},
-	{-16.7748, -12.8433, 3.4249, 0.0660},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{-7.9735, -11.3649, 13.7875, 0.0114},
-	{-10.5017, -11.8747, 13.7665, 0.0027},
-	{-8.5412, -12.6516, 13.2794, 0.0006},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-8.3499, 17.2083, 10.7745, 0.5724},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-7.3231, 16.5820, 9.8327, 0.5577},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{-5.7302, -10.4307, -3.5717, 0.2241},
-	{-5.6884, -10.9949, -5.3392, 0.2294},
-	{-7.4731, -11.2242, -4.6073, 0.2130},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{1.5702, -4.3984, 3.5911, 0.4075},
-	{1.4146, -4.1184, 3.1420, 0.4127},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{-9.8680, 12.0612, 7.4716, 0.9582},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{-14.8421, 11.2524, 18.0801, 0.7955},
-	{-14.7525, 11.8802, 17.4181, 0.7891},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{4.4404, -16.0428, -16.6574, 0.3579},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{15.2706, 6.8616, -14.4437, 0.2809},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{9.2682, -8.1809, 0.1404, 0.2471},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{2.6092, -14.8472, 9.1994, 0.3503},
-	{-3.8425, 14.2969, -1.9023, 0.5460},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-3.8697, 15.0446, -1.9699, 0.5535},
-	{-4.9357, 20.1317, 0.2527, 0.1708},
-	{-5.8577, 20.5844, 1.1279, 0.1785},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{-0.6178, 8.8296, -3.3505, 0.2001},
-	{-1.0391, 8.8979, -2.9978, 0.1975},
-	{-6.1507, -16.1783, -4.5976, 0.2074},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{15.5862, -16.2784, -8.8372, 0.0688},
-	{16.6912, -15.2830, -9.9006, 0.0878},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{16.9335, -8.6897, -9.8031, 0.2072},
-	{16.9914, -11.4795, -10.5309, 0.1926},
-	{-10.6137, 16.9895, 1.9262, 0.9194},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{-11.4525, 17.7902, 3.6290, 0.9345},
-	{-17.1632, -14.0962, 6.0941, 0.0404},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-17.3025, -13.4300, 6.0066, 0.0430},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{-13.0066, -13.0004, 10.1754, 0.2615},
-	{-13.4628, -12.9480, 7.0929, 0.2487},
-	{-8.3005, -8.7975, 14.1086, 0.0341},
-	{-11.0354, -9.4953, 14.4719, 0.0254},
-	{-7.9735, -11.3649, 13.7875, 0.0114},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{9.5217, 9.0918, -13.6644, 0.6392},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{10.6709, -0.9026, -2.6175, 0.2174},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{-5.9165, -3.7333, 5.1811, 0.9105},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{-5.3177, -3.6893, 2.8291, 0.9048},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{-14.7525, 11.8802, 17.4181, 0.7891},
-	{-1.8606, 9.5197, 1.6317, 0.7643},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{-2.5806, 9.5378, 1.6786, 0.7571},
-	{-12.8302, -13.6642, 6.5080, 0.2382},
-	{-10.9298, -15.2923, 7.8475, 0.2294},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{2.7579, -11.6551, 4.0349, 0.3483},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{-16.7829, 17.5540, 13.3765, 0.4930},
-	{-16.4007, 17.7258, 12.8735, 0.4887},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{-1.6445, 15.5712, 0.4385, 0.8321},
-	{-0.6231, 15.9461, -0.2778, 0.8428},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-3.2580, -11.8695, 10.2641, 0.3197},
-	{-1.9653, -13.4975, 8.6495, 0.3180},
-	{11.6983, -15.0258, 1.4530, 0.0449},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{10.0119, -15.1105, 1.8163, 0.0292},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{4.6205, 1.6841, -7.1764, 0.5102},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{1.6899, -11.8764, 3.3873, 0.3312},
-	{2.7579, -11.6551, 4.0349, 0.3483},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{2.3919, -13.7558, -14.0267, 0.3287},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{2.3086, -13.7723, -14.6913, 0.3294},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{10.9563, 2.9436, -3.8503, 0.2248},
-	{10.6709, -0.9026, -2.6175, 0.2174},
-	{0.8645, -10.4892, 6.9072, 0.3948},
-	{1.6623, -9.5868, 6.0928, 0.3910},
-	{0.2773, -10.0645, 5.6429, 0.4054},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-16.4105, -12.2949, 3.8123, 0.0589},
-	{-16.7748, -12.8433, 3.4249, 0.0537},
-	{-0.3166, -14.4506, 4.6156, 0.7506},
-	{-0.8695, -14.6563, 5.4264, 0.7450},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-4.7145, 1.0246, 0.9529, 0.1814},
-	{-5.2023, 0.8105, 1.4140, 0.1749},
-	{-12.2685, 10.2071, 9.0742, 0.7874},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{3.5083, 0.9463, 0.2755, 0.1100},
-	{4.1510, 0.9721, -1.0348, 0.1115},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{5.0866, -14.8700, -17.8805, 0.3579},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{12.8717, -0.1663, -2.2988, 0.2168},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{4.1510, 0.9721, -1.0348, 0.4744},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{4.7116, 3.4303, -1.4022, 0.4999},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{-5.5762, -5.7219, -2.4184, 0.4337},
-	{-5.1508, -4.5724, -0.6738, 0.4517},
-	{-4.4560, -3.6123, -3.3509, 0.4550},
-	{-3.3588, 10.6414, -2.6192, 0.5102},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{4.2327, -14.5406, -15.7300, 0.3526},
-	{4.4404, -16.0428, -16.6574, 0.3579},
-	{6.0478, -14.7572, -15.3357, 0.3693},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{2.2477, -9.9399, 7.1613, 0.3839},
-	{0.8645, -10.4892, 6.9072, 0.3948},
-	{13.5460, 7.7707, -13.1546, 0.7878},
-	{12.9596, 8.6504, -12.8349, 0.7966},
-	{12.7049, 7.9643, -11.6312, 0.7849},
-	{-3.4177, 8.9106, -2.0054, 0.0006},
-	{-3.5671, 8.8851, -2.4176, 0.0076},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{-10.8816, 17.5993, 15.5396, 0.6125},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{-14.2719, 13.2783, 17.7108, 0.9453},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-16.1453, 13.8767, 19.0847, 0.9486},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{8.1631, -13.4727, 5.2951, 0.0435},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{12.9082, -4.6149, 0.6032, 0.2096},
-	{13.1134, -3.4813, 0.7268, 0.2101},
-	{12.2605, -3.7441, 0.7837, 0.2124},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{-6.8869, 9.8867, 9.1845, 0.8517},
-	{-6.1699, 9.7728, 7.3287, 0.8479},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{9.1806, -12.7604, 2.8520, 0.0478},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{-13.8226, -11.5519, 6.6074, 0.0194},
-	{-13.5526, -8.7411, 5.2566, 0.0507},
-	{-12.3291, -10.8595, 3.7359, 0.0371},
-	{16.1312, 9.1850, -11.8702, 0.4569},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{5.8046, -9.8976, -3.1725, 0.2988},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{6.6333, -14.0772, 5.4068, 0.0427},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{-4.0442, -12.1336, -5.4742, 0.2403},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{6.7492, -13.6822, 3.4298, 0.0338},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{17.7778, -2.6473, -7.5944, 0.8494},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{16.9817, -3.7512, -7.5745, 0.8442},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-14.6137, -6.2262, 10.3488, 0.3302},
-	{-11.0690, 16.0556, 1.8443, 0.8062},
-	{-10.6137, 16.9895, 1.9262, 0.8177},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{1.7685, -9.9121, 2.7283, 0.3517},
-	{1.8102, -7.4700, 3.2377, 0.3765},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{-3.9068, 17.0203, 2.7177, 0.8908},
-	{-3.3950, 17.5301, 4.0116, 0.8987},
-	{-1.8680, 17.5140, 2.2906, 0.9056},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{2.6092, -14.8472, 9.1994, 0.3503},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{15.3529, -14.5875, -13.2144, 0.4666},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{11.0356, -10.5086, -12.0589, 0.4124},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{9.0131, -7.2971, -12.7473, 0.3708},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-11.4525, 17.7902, 3.6290, 0.9345},
-	{-11.0064, 18.0806, 5.3000, 0.9440},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{9.5263, 5.6549, -5.3833, 0.7635},
-	{11.3199, 5.0059, -6.2512, 0.7793},
-	{15.8397, -10.9024, -9.3751, 0.1844},
-	{14.2918, -11.8568, -9.7028, 0.1662},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{-1.4665, 12.5815, 0.5091, 0.8019},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-1.6118, 12.2198, 0.5036, 0.7983},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{13.5579, -11.9461, -1.2313, 0.0426},
-	{11.8049, -12.8121, -1.1697, 0.0244},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{4.7612, -14.0902, -0.0963, 0.0283},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{0.3345, 8.3465, -7.6945, 0.5390},
-	{1.0077, 10.1127, -5.6591, 0.5406},
-	{-12.8920, 19.6497, 14.0500, 0.6361},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-12.9679, 19.7861, 13.2026, 0.6355},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-4.6971, 15.2349, 7.8126, 0.7733},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{-8.0884, 14.9192, -4.8358, 0.7905},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{6.2864, 6.7230, -13.4818, 0.5998},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{-5.7258, -3.4623, 10.9865, 0.9231},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{-5.3558, -3.3206, 8.8639, 0.9210},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{-3.1260, 13.4372, 0.7263, 0.0641},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{19.7848, -3.7773, -11.0931, 0.6172},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{18.7331, -3.8729, -12.5950, 0.6190},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{6.2632, 3.1052, -10.7167, 0.6819},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{-17.1829, -13.9211, 2.5898, 0.0720},
-	{-16.3901, -13.8265, 1.3407, 0.0777},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-9.4989, 15.6880, 15.2625, 0.5962},
-	{-8.6392, 15.8281, 14.3538, 0.5845},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{-3.1260, 13.4372, 0.7263, 0.8641},
-	{-1.6118, 12.2198, 0.5036, 0.8541},
-	{-2.4610, 10.4681, 1.0558, 0.8310},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{-15.6712, 18.9649, 14.5346, 0.6617},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-16.4007, 17.7258, 12.8735, 0.6674},
-	{-11.7922, 3.1514, 5.9367, 0.1588},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-4.7145, 1.0246, 0.9529, 0.1814},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-4.5269, 1.9740, 0.5355, 0.1904},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{0.6859, -15.3500, 9.3779, 0.3417},
-	{-12.8820, 16.9456, 14.3941, 0.5253},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-7.2171, -10.9163, -1.8646, 0.1955},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-8.2955, -9.4780, -0.7969, 0.1815},
-	{-4.1140, -12.9082, 17.9578, 0.2986},
-	{-5.1766, -12.2301, 18.3433, 0.2867},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-3.6075, 4.8122, -1.5070, 0.2280},
-	{-3.8205, 3.5443, -1.0253, 0.2151},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{11.1731, -9.1355, -7.1757, 0.7694},
-	{10.3793, -8.0264, -6.3700, 0.7589},
-	{10.0313, -14.8641, -1.8649, 0.2859},
-	{9.1778, -14.3305, -1.9546, 0.2854},
-	{7.6872, -13.4907, -2.3808, 0.2881},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{15.2535, 4.4336, -12.4394, 0.9166},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-12.8820, 16.9456, 14.3941, 0.5253},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{-7.9911, -14.1694, 12.0448, 0.6768},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{6.4395, 0.0270, -11.5685, 0.6383},
-	{7.2055, -0.2363, -13.8788, 0.6318},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-6.6453, 9.8843, -3.2180, 0.0086},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-5.6394, 11.2143, -2.7466, 0.5161},
-	{-5.9280, 13.3316, -2.6581, 0.5379},
-	{15.8397, -10.9024, -9.3751, 0.4856},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{14.2918, -11.8568, -9.7028, 0.4623},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-4.8620, 8.5587, 6.0390, 0.2253},
-	{-5.6730, 7.1143, 6.8094, 0.2080},
-	{20.6673, 9.3354, -14.9361, 0.3078},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{-12.2912, -13.8790, 5.4687, 0.0896},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{-15.6416, 15.8353, 12.7678, 0.4989},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{-11.1472, 15.1347, 15.5449, 0.5445},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{-11.8417, 15.0608, 15.9355, 0.5409},
-	{-7.7815, 12.5430, 7.2711, 0.9366},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{13.7823, -12.6365, -11.1707, 0.4520},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{11.0356, -10.5086, -12.0589, 0.4124},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-1.9112, -11.1936, 12.5903, 0.3569},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-4.4607, 17.7891, 5.6935, 0.8028},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{6.4857, -8.3881, -2.6518, 0.2860},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{-3.2346, -5.3071, 11.1162, 0.4520},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{18.1539, -0.2898, -12.6066, 0.5539},
-	{18.7331, -3.8729, -12.5950, 0.5423},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-10.0676, 9.1055, 13.9447, 0.8641},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{18.7331, -3.8729, -12.5950, 0.5423},
-	{17.7315, -3.9778, -13.0607, 0.5455},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{15.7142, -16.0203, -4.2003, 0.0483},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{12.2527, -16.0877, -2.5494, 0.0180},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{-14.2470, 13.2123, 11.5925, 0.5032},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{2.3919, -13.7558, -14.0267, 0.3287},
-	{2.3086, -13.7723, -14.6913, 0.3294},
-	{4.6205, 1.6841, -7.1764, 0.5102},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{-4.2438, -5.4002, -4.8993, 0.2843},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-4.9385, -6.0655, -5.4775, 0.2773},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{-4.7243, -15.1252, 12.6717, 0.3291},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{12.5645, -10.4628, -2.0711, 0.7701},
-	{15.6932, -10.2844, -1.9749, 0.7983},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-15.0219, 17.8180, 12.9105, 0.6557},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-7.3083, 9.8503, -3.6142, 0.7329},
-	{-8.4392, 10.5384, -3.0647, 0.7430},
-	{-6.3928, 9.7681, -6.3590, 0.7282},
-	{-5.8625, 9.1580, 10.2919, 0.8705},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{20.9750, 5.8844, -15.4046, 0.4019},
-	{20.7836, 6.2748, -15.7469, 0.4051},
-	{19.5309, 6.9339, -14.4090, 0.4183},
-	{-16.7748, -12.8433, 3.4249, 0.0660},
-	{-16.4105, -12.2949, 3.8123, 0.0663},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{19.3552, 7.1245, -15.1128, 0.2855},
-	{20.7836, 6.2748, -15.7469, 0.2722},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{15.1351, -7.1622, 0.4560, 0.1877},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-1.9112, -11.1936, 12.5903, 0.3569},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{11.8498, -12.3036, -1.2386, 0.0780},
-	{-12.1633, 15.7950, 15.7030, 0.5370},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{-12.4106, 15.9474, 16.4255, 0.5365},
-	{-7.2512, -13.0756, 13.3614, 0.2976},
-	{-7.9735, -11.3649, 13.7875, 0.2795},
-	{-7.4007, -12.7785, 13.4808, 0.2936},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{-8.3283, 18.5141, -2.4574, 0.8297},
-	{-8.6669, 16.8675, -2.0938, 0.8156},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{9.8342, 12.3775, -11.2897, 0.6468},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{-1.4154, 13.4463, 2.1669, 0.8011},
-	{-1.3468, 14.6962, 2.4091, 0.8110},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-14.7525, 11.8802, 17.4181, 0.7891},
-	{-15.4064, 12.0264, 16.0740, 0.7886},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{11.8498, -12.3036, -1.2386, 0.0780},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{13.4653, -7.4329, 2.5492, 0.1827},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-13.8602, 12.2784, 17.5724, 0.9067},
-	{-14.8421, 11.2524, 18.0801, 0.8918},
-	{-13.0066, -13.0004, 10.1754, 0.0026},
-	{-13.8697, -12.1496, 7.0522, 0.0112},
-	{-13.4628, -12.9480, 7.0929, 0.0037},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{4.2656, -6.8950, -5.4206, 0.7571},
-	{4.9971, -7.8016, -4.5740, 0.7456},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-8.0807, 18.4528, 9.7007, 0.9577},
-	{12.6402, -10.8638, -1.7331, 0.0415},
-	{12.1509, -11.9581, -1.3225, 0.0290},
-	{11.8049, -12.8121, -1.1697, 0.0244},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{-11.9983, -3.5871, 4.0195, 0.1067},
-	{-12.3739, -1.1932, 4.6760, 0.1243},
-	{-8.3005, -8.7975, 14.1086, 0.4347},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-7.8423, -8.1706, 13.9791, 0.4361},
-	{-4.4607, 17.7891, 5.6935, 0.8028},
-	{-4.8640, 17.3333, 6.8541, 0.7906},
-	{-3.9698, 17.2277, 6.1559, 0.7962},
-	{-8.7441, 4.4453, 9.4249, 0.4563},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{-10.9998, 4.0259, 7.8484, 0.4487},
-	{-14.5351, 17.0043, 11.6655, 0.6509},
-	{-15.5231, 16.5355, 10.9839, 0.6588},
-	{-15.9215, 16.1249, 11.5135, 0.6668},
-	{-3.3950, 17.5301, 4.0116, 0.8202},
-	{-3.0172, 19.5295, 3.0415, 0.8323},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{4.8188, -14.9696, -0.7263, 0.0282},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{4.9673, -14.9897, -0.2152, 0.0282},
-	{6.9485, -13.1409, -1.5811, 0.0278},
-	{7.8408, -13.4051, -1.3213, 0.0270},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{15.2447, -1.2590, -13.5010, 0.5522},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{16.6136, -3.8818, -12.8358, 0.5299},
-	{-9.1351, -15.9701, -2.1212, 0.1799},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-9.1693, -16.0589, -3.5740, 0.1878},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{-7.8039, 8.7067, -1.8271, 0.7201},
-	{-8.5480, 7.9971, -1.5354, 0.7178},
-	{4.6205, 1.6841, -7.1764, 0.5102},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{0.4936, 13.5999, -0.5286, 0.8230},
-	{0.1807, 14.3208, 0.0519, 0.8239},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{-3.8338, -11.1945, 17.8398, 0.3669},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{-5.1766, -12.2301, 18.3433, 0.3701},
-	{5.0866, -14.8700, -17.8805, 0.3579},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{14.2867, -1.1365, -12.1842, 0.6137},
-	{14.0153, -1.8870, -11.2939, 0.6025},
-	{13.4514, -1.8334, -12.3691, 0.6076},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{-3.3840, 9.6117, 5.6685, 0.7400},
-	{-4.5353, 10.3089, 7.1983, 0.7321},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{-3.1424, -2.1742, 1.2848, 0.0954},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{5.8046, -9.8976, -3.1725, 0.2988},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{11.0406, -14.5414, -15.0672, 0.4265},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{-8.0651, -6.7623, 0.6161, 0.4252},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{6.8770, -16.4242, -9.7199, 0.7096},
-	{9.7830, -16.5711, -10.0824, 0.7315},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{-11.7527, 17.2797, 8.9606, 0.6102},
-	{-9.1407, 3.1817, 10.6449, 0.4348},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{-9.4275, -0.7323, 12.9708, 0.3935},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{9.0410, -10.6755, -14.4063, 0.3838},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{6.1397, -7.9026, -13.4031, 0.3401},
-	{6.7415, -7.6320, -14.1992, 0.3485},
-	{5.3288, -10.1704, -12.9107, 0.3404},
-	{4.2656, -6.8950, -5.4206, 0.2925},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{6.2136, -15.1842, 5.5655, 0.0426},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{-6.1699, 9.7728, 7.3287, 0.9120},
-	{-6.8869, 9.8867, 9.1845, 0.9122},
-	{-7.6342, 9.4864, 7.2458, 0.9006},
-	{-5.7356, -0.1872, 1.5612, 0.1649},
-	{-5.2492, -0.4274, 2.1339, 0.1627},
-	{-5.6419, -0.8683, 2.5663, 0.1553},
-	{-13.0739, 13.1598, 5.2124, 0.4825},
-	{-10.5614, 13.3039, 1.4358, 0.4877},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{-9.7973, -8.2993, 14.5111, 0.0328},
-	{-11.3339, -7.6051, 14.4357, 0.0369},
-	{-11.0354, -9.4953, 14.4719, 0.0254},
-	{-5.1697, 17.6683, 1.8463, 0.1483},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-0.9228, 21.0701, -6.0281, 0.1516},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-5.6394, 11.2143, -2.7466, 0.0175},
-	{-6.2107, 9.9377, -2.6858, 0.0110},
-	{-8.6392, 15.8281, 14.3538, 0.5845},
-	{-7.2728, 15.1755, 12.1963, 0.5610},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-15.9663, 12.9154, 17.5072, 0.9513},
-	{-14.7525, 11.8802, 17.4181, 0.9523},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-2.8264, 3.1792, -0.3501, 0.1392},
-	{-3.1747, 2.4325, -0.3482, 0.1329},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{12.2079, -9.3668, -8.0887, 0.1703},
-	{13.1002, -12.2492, -10.4372, 0.1538},
-	{10.9877, -10.4792, -10.3544, 0.1428},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-6.2313, 14.9946, -5.1307, 0.7916},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{-3.2529, 8.6209, -1.6967, 0.0110},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-7.2512, -13.0756, 13.3614, 0.2976},
-	{-6.7962, -13.7906, 12.5367, 0.3109},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{17.4212, -12.2115, -10.7803, 0.5002},
-	{-14.9446, -11.8283, 7.1555, 0.0551},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-13.8697, -12.1496, 7.0522, 0.0584},
-	{-6.0713, 11.8433, -4.4390, 0.7519},
-	{-5.9372, 10.1045, -6.6120, 0.7312},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{0.0567, 10.7976, -4.1568, 0.2195},
-	{-0.6178, 8.8296, -3.3505, 0.2001},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{2.2102, -2.8264, 1.9789, 0.0696},
-	{1.4146, -4.1184, 3.1420, 0.0535},
-	{6.0408, -12.2147, -0.1022, 0.0312},
-	{5.9227, -12.9346, -1.5604, 0.0293},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{1.6235, 11.5088, -5.1563, 0.6792},
-	{1.7081, 10.2578, -4.2031, 0.6789},
-	{-2.9254, -5.9912, 8.0761, 0.8826},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{11.6555, -8.0978, -8.5264, 0.5325},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{11.4715, -6.9738, -9.8564, 0.5492},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{6.2106, -12.4636, -3.2128, 0.2937},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{11.0273, 2.1142, -15.4468, 0.6525},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-8.2512, 11.6577, 9.3403, 0.9297},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-2.1208, -13.0904, 15.2665, 0.3293},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{-1.3468, 14.6962, 2.4091, 0.8110},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{0.1807, 14.3208, 0.0519, 0.8239},
-	{14.0754, -9.6989, 0.1312, 0.1523},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{-14.6287, 16.5303, 14.2202, 0.5115},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{10.8335, 11.4811, -11.1021, 0.7945},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{9.0410, -10.6755, -14.4063, 0.3838},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{1.1812, 11.9400, -4.8896, 0.2335},
-	{0.5456, 10.8315, -4.4069, 0.2236},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{-5.7023, -5.3300, 1.5778, 0.4516},
-	{1.0083, -13.8803, 4.3449, 0.3265},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{5.9227, -12.9346, -1.5604, 0.0293},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{-4.5113, -2.9113, 1.7649, 0.8964},
-	{-5.3177, -3.6893, 2.8291, 0.9048},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{-5.8711, 18.3209, 5.4078, 0.9087},
-	{-6.7421, 18.9786, 3.8471, 0.9049},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-3.8425, 14.2969, -1.9023, 0.5460},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-12.0712, 1.7544, 9.7387, 0.4162},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{-8.5412, -12.6516, 13.2794, 0.2768},
-	{-7.4007, -12.7785, 13.4808, 0.2807},
-	{-7.9735, -11.3649, 13.7875, 0.2860},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{15.4004, -7.5823, -8.0173, 0.2089},
-	{15.6815, -6.6533, -8.6324, 0.2201},
-	{8.0087, 12.8555, -10.4614, 0.6296},
-	{8.2892, 13.0061, -9.5667, 0.6319},
-	{8.7774, 12.6658, -10.4472, 0.6368},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{15.1351, -7.1622, 0.4560, 0.1877},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{-12.4906, 14.1734, 4.7138, 0.6315},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-12.0985, 15.6031, 5.6511, 0.6208},
-	{-3.6470, 18.9561, 6.4188, 0.8076},
-	{-5.6919, 17.9576, 7.0778, 0.7892},
-	{-5.2348, 17.6435, 7.2606, 0.7873},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-2.8143, 19.2991, -4.1041, 0.1419},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{5.8119, 4.4519, -11.7949, 0.5763},
-	{3.6900, 4.9223, -11.1604, 0.5609},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{-7.7482, 8.9352, -3.7482, 0.7258},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-12.8302, -13.6642, 6.5080, 0.6213},
-	{-12.2912, -13.8790, 5.4687, 0.6239},
-	{-8.8679, 19.8542, -2.8039, 0.1154},
-	{-9.4342, 17.9511, 0.6917, 0.1117},
-	{-8.6739, 17.5264, 0.4775, 0.1005},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-6.1073, 8.7623, 10.0622, 0.8654},
-	{-5.8625, 9.1580, 10.2919, 0.8705},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{16.1312, 9.1850, -11.8702, 0.4569},
-	{15.7333, 9.3575, -12.3397, 0.4599},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{7.7699, -12.5060, 4.7863, 0.0437},
-	{-10.8781, -1.3382, 13.3228, 0.3803},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{11.6827, -4.4620, -0.7342, 0.2189},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{11.8405, -7.6519, 0.6353, 0.2150},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{11.0393, -9.9958, 0.1010, 0.2346},
-	{14.2479, 5.9961, -13.3436, 0.6892},
-	{14.2423, 5.8573, -13.6831, 0.6857},
-	{13.4943, 6.4487, -13.8804, 0.6923},
-	{-7.8901, -13.2971, 12.4355, 0.2682},
-	{-7.4007, -12.7785, 13.4808, 0.2807},
-	{-8.5412, -12.6516, 13.2794, 0.2768},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{-6.0807, -16.0401, -2.8046, 0.2030},
-	{-6.6560, -15.3246, -0.9348, 0.1882},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{12.1132, -1.6393, -1.0587, 0.2149},
-	{10.6709, -0.9026, -2.6175, 0.2174},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{5.0484, -12.1720, -15.4119, 0.3452},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{12.2079, -9.3668, -8.0887, 0.7810},
-	{11.1731, -9.1355, -7.1757, 0.7694},
-	{-14.6137, -6.2262, 10.3488, 0.0543},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.6607, -8.2925, 9.4719, 0.0376},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{1.8102, -7.4700, 3.2377, 0.3765},
-	{1.4146, -4.1184, 3.1420, 0.3900},
-	{-1.3207, 20.9402, -6.3941, 0.1455},
-	{-0.9228, 21.0701, -6.0281, 0.1516},
-	{-2.8143, 19.2991, -4.1041, 0.1419},
-	{-7.9851, 18.2976, 1.7329, 0.9048},
-	{-7.0645, 21.8360, 1.3711, 0.8689},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{-4.8594, 9.0884, 7.4120, 0.7198},
-	{-6.1699, 9.7728, 7.3287, 0.7109},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-4.6971, 15.2349, 7.8126, 0.5215},
-	{-4.9850, 15.7308, 7.3268, 0.5230},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-12.9679, 19.7861, 13.2026, 0.6355},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{-4.8594, 9.0884, 7.4120, 0.8598},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{12.0794, -2.9569, -2.4757, 0.2165},
-	{4.7612, -14.0902, -0.0963, 0.0283},
-	{4.8188, -14.9696, -0.7263, 0.0282},
-	{4.9673, -14.9897, -0.2152, 0.0282},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{12.2605, -3.7441, 0.7837, 0.2124},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{12.9082, -4.6149, 0.6032, 0.2096},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{-5.7258, -3.4623, 10.9865, 0.4776},
-	{-6.9060, -3.5212, 12.3504, 0.4751},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{-7.2361, -3.4140, 3.4502, 0.1282},
-	{-8.9049, -2.4916, 2.5529, 0.1339},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{-3.9636, -1.2419, 0.9111, 0.8899},
-	{-4.5113, -2.9113, 1.7649, 0.8964},
-	{-3.7290, -2.4292, 1.7046, 0.8900},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-10.6823, 9.2650, 4.7444, 0.8651},
-	{-10.7867, 8.0620, 2.9362, 0.8537},
-	{-14.3277, 18.9486, 13.8145, 0.6491},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{0.3345, 8.3465, -7.6945, 0.5390},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{-12.2912, -13.8790, 5.4687, 0.0006},
-	{-15.0406, -14.2704, 5.7139, 0.0213},
-	{-15.7605, -14.3025, 4.0597, 0.0294},
-	{4.2327, -14.5406, -15.7300, 0.3526},
-	{3.5420, -16.1792, -16.3830, 0.3571},
-	{4.4404, -16.0428, -16.6574, 0.3579},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{5.8920, -12.9118, 1.0752, 0.0292},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{11.3199, 5.0059, -6.2512, 0.7416},
-	{10.5673, 4.1132, -5.9404, 0.7320},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-9.1407, 3.1817, 10.6449, 0.1484},
-	{-9.4275, -0.7323, 12.9708, 0.1038},
-	{0.3758, -14.1416, 2.0205, 0.7518},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-1.1804, -15.5428, 0.7072, 0.7357},
-	{0.0272, 13.3004, -0.8503, 0.8186},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{-1.4665, 12.5815, 0.5091, 0.8019},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{16.1311, 3.9612, -12.7168, 0.4120},
-	{16.8042, 2.8506, -13.5943, 0.3965},
-	{-9.4275, -0.7323, 12.9708, 0.3935},
-	{-10.8781, -1.3382, 13.3228, 0.3803},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{5.5430, -15.0901, 1.9390, 0.0317},
-	{7.2285, -14.4412, 1.5781, 0.0292},
-	{7.0343, -14.3935, 3.1022, 0.0312},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{8.2892, 13.0061, -9.5667, 0.7615},
-	{7.1277, 12.9565, -9.2771, 0.7492},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{20.4856, -10.3916, -8.0896, 0.1301},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{17.5388, -13.6704, -10.4353, 0.1096},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{12.9082, -4.6149, 0.6032, 0.2096},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{0.2665, -6.4448, 4.9095, 0.4142},
-	{-6.5693, 17.4267, -0.0351, 0.5862},
-	{-8.6739, 17.5264, 0.4775, 0.5999},
-	{-7.9851, 18.2976, 1.7329, 0.6012},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{20.4557, 5.7763, -16.1453, 0.2694},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.7255, 13.2299, 5.2475, 0.5248},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{-9.1351, -15.9701, -2.1212, 0.1799},
-	{-9.1693, -16.0589, -3.5740, 0.1878},
-	{-0.3166, -14.4506, 4.6156, 0.7506},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{0.3758, -14.1416, 2.0205, 0.7518},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{6.4376, 13.1912, -9.4032, 0.6132},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{10.9877, -10.4792, -10.3544, 0.4198},
-	{11.0356, -10.5086, -12.0589, 0.4124},
-	{9.0131, -7.2971, -12.7473, 0.3708},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-12.8051, 15.3194, 7.5782, 0.6279},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{0.5456, 10.8315, -4.4069, 0.2236},
-	{0.0567, 10.7976, -4.1568, 0.2195},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-13.4539, -0.1193, 8.9642, 0.3989},
-	{-13.1699, -0.8163, 11.3602, 0.3848},
-	{-7.6339, 7.3001, -1.5053, 0.2366},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.2540, -3.1432, 10.2030, 0.0775},
-	{-14.1231, -2.1933, 8.5906, 0.0974},
-	{-11.1472, 15.1347, 15.5449, 0.5445},
-	{-11.0423, 13.9311, 15.2030, 0.5463},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{11.3671, -14.2139, -1.2936, 0.0394},
-	{11.8498, -12.3036, -1.2386, 0.0780},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{-15.9358, -13.2805, 7.5333, 0.0438},
-	{-16.1837, -14.0899, 7.7824, 0.0426},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-9.1658, 14.6305, 14.1505, 0.5584},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-8.2512, 11.6577, 9.3403, 0.9297},
-	{-7.7815, 12.5430, 7.2711, 0.9366},
-	{-15.0219, 17.8180, 12.9105, 0.6557},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-14.5351, 17.0043, 11.6655, 0.6509},
-	{-4.2438, -5.4002, -4.8993, 0.5653},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{-3.3487, -5.8903, -5.8105, 0.5532},
-	{-7.2728, 15.1755, 12.1963, 0.5610},
-	{-8.8358, 16.4585, 12.7067, 0.5831},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{-3.3218, 1.9530, 0.0626, 0.6434},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-3.9636, -1.2419, 0.9111, 0.6333},
-	{20.5771, -6.1904, -9.3752, 0.1704},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{20.4856, -10.3916, -8.0896, 0.1301},
-	{-14.9160, 12.0514, 14.8918, 0.7874},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{-15.4064, 12.0264, 16.0740, 0.7886},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{11.0406, -14.5414, -15.0672, 0.4265},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-12.7068, 19.1305, 16.2419, 0.5275},
-	{-13.3832, 19.3209, 16.4978, 0.5212},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{15.2535, 4.4336, -12.4394, 0.9166},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{-2.5385, 0.4656, 0.4353, 0.1125},
-	{-3.1747, 2.4325, -0.3482, 0.1329},
-	{-3.3218, 1.9530, 0.0626, 0.1259},
-	{-5.6286, 18.2818, 2.8314, 0.1551},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{-17.1829, -13.9211, 2.5898, 0.0720},
-	{-17.8252, -14.4751, 3.7252, 0.0687},
-	{18.0389, 10.1497, -13.3565, 0.3229},
-	{18.5321, 8.5916, -13.5023, 0.3184},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{15.6815, -6.6533, -8.6324, 0.9638},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{16.0250, -4.7052, -8.5821, 0.9710},
-	{6.2632, 3.1052, -10.7167, 0.8696},
-	{5.8119, 4.4519, -11.7949, 0.8792},
-	{6.4971, 3.8652, -12.7361, 0.8777},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{-1.4820, -13.0582, 15.1007, 0.3397},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-2.1208, -13.0904, 15.2665, 0.3380},
-	{-14.0837, -6.8521, 5.7232, 0.0757},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{15.7121, 3.2941, -15.5172, 0.5880},
-	{16.7112, 1.6627, -13.8054, 0.5777},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-13.1612, -12.5771, 0.9637, 0.1158},
-	{16.3969, -5.8303, -10.0012, 0.5212},
-	{15.4950, -5.0714, -9.6367, 0.5212},
-	{14.8098, -2.5640, -10.6530, 0.5306},
-	{-4.8640, 17.3333, 6.8541, 0.7906},
-	{-4.4607, 17.7891, 5.6935, 0.8028},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{20.2639, -11.6735, -6.5917, 0.1126},
-	{19.7660, -12.2128, -4.6087, 0.0976},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{-7.7815, 12.5430, 7.2711, 0.5719},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-9.4803, 12.3522, 5.2508, 0.5452},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{-6.5693, 17.4267, -0.0351, 0.9197},
-	{-7.9851, 18.2976, 1.7329, 0.9048},
-	{-16.4007, 17.7258, 12.8735, 0.6674},
-	{-16.7829, 17.5540, 13.3765, 0.6741},
-	{-15.6712, 18.9649, 14.5346, 0.6617},
-	{-3.2529, 8.6209, -1.6967, 0.2755},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-3.4096, 5.8519, -1.9252, 0.2560},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{3.7022, 2.6929, -9.2950, 0.6522},
-	{-13.7070, -9.3744, 12.3304, 0.3012},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{-14.6607, -8.2925, 9.4719, 0.3081},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{16.1311, 3.9612, -12.7168, 0.4120},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{-13.8226, -11.5519, 6.6074, 0.0194},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{-13.5526, -8.7411, 5.2566, 0.0507},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{-7.1422, 13.1945, -4.8339, 0.7730},
-	{-14.8421, 11.2524, 18.0801, 0.8918},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{15.2706, 6.8616, -14.4437, 0.2809},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{14.4858, 6.5577, -13.7337, 0.2773},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{-6.3928, 9.7681, -6.3590, 0.7282},
-	{-8.4392, 10.5384, -3.0647, 0.7430},
-	{1.0893, -5.6004, 4.7461, 0.4072},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{-14.0837, -6.8521, 5.7232, 0.0757},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{-13.5526, -8.7411, 5.2566, 0.0781},
-	{-6.7421, 18.9786, 3.8471, 0.9049},
-	{-5.8711, 18.3209, 5.4078, 0.9087},
-	{-5.6286, 18.2818, 2.8314, 0.8881},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-9.7932, 15.9822, -0.5432, 0.8058},
-	{-12.4906, 14.1734, 4.7138, 0.7907},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{13.5467, -3.7221, -11.0855, 0.5868},
-	{13.0597, -4.0224, -11.0636, 0.5821},
-	{7.2660, 7.1829, -3.5873, 0.7325},
-	{6.5583, 8.0535, -3.0016, 0.7222},
-	{6.5721, 5.7225, -3.4183, 0.7286},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{-16.4105, -12.2949, 3.8123, 0.0589},
-	{3.4480, -10.1667, -13.4966, 0.3282},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{2.2925, -11.3431, -11.5562, 0.3208},
-	{6.9646, -12.7086, -15.8348, 0.3676},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{0.4936, 13.5999, -0.5286, 0.8230},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{0.0272, 13.3004, -0.8503, 0.8186},
-	{17.6731, -0.4004, -9.5018, 0.8583},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{17.7778, -2.6473, -7.5944, 0.8494},
-	{13.4319, 0.4791, -13.3091, 0.6328},
-	{13.4514, -1.8334, -12.3691, 0.6076},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{-5.1508, -4.5724, -0.6738, 0.4517},
-	{-5.5762, -5.7219, -2.4184, 0.4337},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{13.3282, -3.7156, -10.7981, 0.6700},
-	{13.0597, -4.0224, -11.0636, 0.6671},
-	{13.5467, -3.7221, -11.0855, 0.6724},
-	{-9.1407, 3.1817, 10.6449, 0.4348},
-	{-10.1421, 3.4889, 10.0141, 0.4368},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{-13.3832, 19.3209, 16.4978, 0.6446},
-	{-12.7068, 19.1305, 16.2419, 0.6372},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-13.3308, 12.3683, 16.9123, 0.9122},
-	{-13.8602, 12.2784, 17.5724, 0.9067},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{11.0356, -10.5086, -12.0589, 0.4124},
-	{13.1002, -12.2492, -10.4372, 0.4484},
-	{13.7823, -12.6365, -11.1707, 0.4520},
-	{7.6872, -13.4907, -2.3808, 0.3061},
-	{6.9485, -13.1409, -1.5811, 0.2958},
-	{6.2106, -12.4636, -3.2128, 0.3081},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{2.7654, 5.6035, -0.0047, 0.1542},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{-1.2881, -14.4745, 6.9149, 0.3160},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{1.0083, -13.8803, 4.3449, 0.3265},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{7.0576, -14.8434, 4.6898, 0.0425},
-	{6.2136, -15.1842, 5.5655, 0.0426},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{-12.0376, -7.0010, 14.3549, 0.3227},
-	{-6.6560, -15.3246, -0.9348, 0.1882},
-	{-6.0807, -16.0401, -2.8046, 0.2030},
-	{-5.2963, -14.6150, -2.5473, 0.2133},
-	{1.2794, -12.0556, 8.1840, 0.3793},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{0.1535, 9.0694, -4.8813, 0.6838},
-	{0.3345, 8.3465, -7.6945, 0.6606},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-6.6453, 9.8843, -3.2180, 0.0086},
-	{-9.4225, 17.1743, 10.4049, 0.5847},
-	{-10.2018, 18.0151, 10.2676, 0.5906},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-11.2763, -4.3120, 3.1914, 0.4345},
-	{-9.2443, -3.8060, 2.9851, 0.4482},
-	{-8.6639, -5.6106, 2.4701, 0.4386},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{3.4625, -13.7837, 5.8327, 0.3479},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{10.5673, 4.1132, -5.9404, 0.7320},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{14.0153, -1.8870, -11.2939, 0.6885},
-	{13.3282, -3.7156, -10.7981, 0.6700},
-	{13.5467, -3.7221, -11.0855, 0.6724},
-	{-13.3759, 11.0364, 12.4156, 0.9664},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-13.2640, 11.0752, 12.2144, 0.9663},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.9247, -11.8082, 6.6610, 0.3693},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.2031, 8.8315, 4.7525, 0.8754},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{-14.3858, 14.0698, 7.8485, 0.6517},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-9.9824, 11.3279, 5.2837, 0.7696},
-	{-12.2685, 10.2071, 9.0742, 0.7874},
-	{-12.7705, 10.3638, 10.8589, 0.7904},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-1.6048, 9.9904, 0.9322, 0.7720},
-	{-0.0238, 10.3640, 0.0562, 0.7833},
-	{2.7397, -6.6878, 0.9006, 0.3924},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{7.1277, 12.9565, -9.2771, 0.7492},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{-4.2732, 8.4109, 5.3970, 0.2307},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{4.1510, 0.9721, -1.0348, 0.4744},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{-11.4002, 9.2178, 16.2556, 0.8678},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-10.3399, 8.3952, 17.0063, 0.8775},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{7.2311, -6.7954, -13.7344, 0.5641},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{15.1032, -15.6144, -5.1526, 0.7972},
-	{8.8292, -15.9295, -4.5847, 0.7410},
-	{-8.4392, 10.5384, -3.0647, 0.7430},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{-4.0728, -16.0338, -0.9999, 0.7059},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-2.8315, -15.2641, -1.9685, 0.7105},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{16.9335, -8.6897, -9.8031, 0.5633},
-	{17.6724, -7.9110, -11.2655, 0.5755},
-	{16.9914, -11.4795, -10.5309, 0.5394},
-	{-12.4648, 11.2918, 15.8110, 0.9357},
-	{-11.2724, 11.1845, 13.9605, 0.9353},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{5.0866, -14.8700, -17.8805, 0.3579},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{6.0397, -16.1432, -6.0115, 0.3082},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{-13.4539, -0.1193, 8.9642, 0.1168},
-	{-12.6425, 1.6666, 7.9214, 0.1369},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-14.0775, 11.0124, 13.4161, 0.7900},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{-5.2140, -10.0014, 17.2077, 0.2563},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{-5.1766, -12.2301, 18.3433, 0.2867},
-	{3.5036, -12.9985, -16.0544, 0.3353},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{2.3086, -13.7723, -14.6913, 0.3294},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{-1.6232, 7.1243, -2.3440, 0.1797},
-	{-2.3863, 5.5169, -1.6251, 0.1634},
-	{-0.9228, 21.0701, -6.0281, 0.9113},
-	{-1.3207, 20.9402, -6.3941, 0.9120},
-	{-0.8419, 22.2036, -6.8040, 0.9055},
-	{-15.3480, 14.3281, 9.2437, 0.4848},
-	{-13.0739, 13.1598, 5.2124, 0.4825},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{-11.5000, -11.4883, -0.0532, 0.1384},
-	{-16.0153, -14.2690, 1.5396, 0.0777},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-14.9962, -13.8446, 1.9274, 0.0835},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{15.7121, 3.2941, -15.5172, 0.2452},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{-5.7548, -1.8554, 9.5994, 0.1208},
-	{-5.9165, -3.7333, 5.1811, 0.1347},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-1.6232, 7.1243, -2.3440, 0.6794},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{-2.3863, 5.5169, -1.6251, 0.6677},
-	{11.8498, -12.3036, -1.2386, 0.0178},
-	{11.3671, -14.2139, -1.2936, 0.0125},
-	{11.8049, -12.8121, -1.1697, 0.0244},
-	{-7.2728, 15.1755, 12.1963, 0.5783},
-	{-9.4989, 15.6880, 15.2625, 0.5579},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-14.3858, 14.0698, 7.8485, 0.6517},
-	{-15.5231, 16.5355, 10.9839, 0.6588},
-	{0.2826, -13.7945, 4.1088, 0.3207},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-0.3166, -14.4506, 4.6156, 0.3174},
-	{13.4943, 6.4487, -13.8804, 0.6923},
-	{14.2423, 5.8573, -13.6831, 0.6857},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-6.7962, -13.7906, 12.5367, 0.3109},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-3.2529, 8.6209, -1.6967, 0.2755},
-	{-3.2275, 6.6744, -2.4216, 0.2656},
-	{-3.4177, 8.9106, -2.0054, 0.2802},
-	{9.7438, -8.6649, -3.9130, 0.7482},
-	{9.6717, -7.5794, -5.1277, 0.7419},
-	{8.6869, -7.8374, -3.9421, 0.7319},
-	{20.9750, 5.8844, -15.4046, 0.4019},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{19.8388, -5.6107, -6.1269, 0.1431},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{20.1509, -4.4673, -7.9739, 0.1607},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{7.2660, 7.1829, -3.5873, 0.7325},
-	{15.6815, -6.6533, -8.6324, 0.5761},
-	{15.4950, -5.0714, -9.6367, 0.5951},
-	{16.3969, -5.8303, -10.0012, 0.5907},
-	{-2.9525, 20.3107, 3.3361, 0.8352},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-3.0172, 19.5295, 3.0415, 0.8323},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-1.2252, -14.1486, 14.8460, 0.3369},
-	{-2.1208, -13.0904, 15.2665, 0.3380},
-	{4.9667, -12.4043, -12.2140, 0.3020},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{3.8133, -10.9201, -11.3600, 0.2879},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{3.6900, 4.9223, -11.1604, 0.5609},
-	{2.1439, 2.8748, -9.7078, 0.5338},
-	{0.8369, 3.9820, -9.5500, 0.5288},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-1.3049, -13.0380, 13.3464, 0.3427},
-	{19.6713, 5.2036, -15.5143, 0.2607},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{20.4557, 5.7763, -16.1453, 0.2694},
-	{-4.5113, -2.9113, 1.7649, 0.4790},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{9.5217, 9.0918, -13.6644, 0.6392},
-	{9.8648, 10.5618, -12.0736, 0.6472},
-	{-9.4275, -0.7323, 12.9708, 0.3935},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{-10.8781, -1.3382, 13.3228, 0.3803},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{2.9304, 12.4364, -6.1754, 0.5700},
-	{3.9552, 13.2021, -6.6886, 0.5815},
-	{3.8825, 13.2386, -7.3097, 0.5821},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{13.2761, -1.6414, 0.4335, 0.2115},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{-2.0730, 13.6539, 0.4205, 0.8700},
-	{-1.4665, 12.5815, 0.5091, 0.8596},
-	{-3.1260, 13.4372, 0.7263, 0.8641},
-	{-17.1829, -13.9211, 2.5898, 0.0720},
-	{-16.8850, -12.1545, 2.6080, 0.0731},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{-11.2763, -4.3120, 3.1914, 0.1253},
-	{-9.6771, -6.4746, 1.4750, 0.1525},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{4.2327, -14.5406, -15.7300, 0.3292},
-	{5.6983, -13.3486, -13.6142, 0.3123},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-10.9998, 4.0259, 7.8484, 0.4487},
-	{-11.7922, 3.1514, 5.9367, 0.4478},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-10.6823, 9.2650, 4.7444, 0.8651},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{-1.6048, 9.9904, 0.9322, 0.7720},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{-1.8606, 9.5197, 1.6317, 0.7643},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-14.3932, 11.6734, 11.3851, 0.7960},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{7.2055, -0.2363, -13.8788, 0.6318},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-4.7495, -15.4498, 0.7896, 0.7024},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{12.8661, -10.1185, -1.5813, 0.1194},
-	{-5.1766, -12.2301, 18.3433, 0.3701},
-	{-4.4049, -10.3551, 19.3219, 0.3746},
-	{-5.0157, -9.4098, 18.4349, 0.3794},
-	{7.7965, 3.1330, -6.9403, 0.7211},
-	{9.7517, 2.8258, -6.1310, 0.7167},
-	{9.5263, 5.6549, -5.3833, 0.7370},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{-13.0884, 9.7546, 19.4461, 0.8829},
-	{-11.8749, 9.5391, 19.4097, 0.8836},
-	{0.2826, -13.7945, 4.1088, 0.3172},
-	{0.3758, -14.1416, 2.0205, 0.3243},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-8.7441, 4.4453, 9.4249, 0.1715},
-	{-9.1407, 3.1817, 10.6449, 0.1484},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.8046, -9.8976, -3.1725, 0.2988},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{8.9535, -13.0259, 0.0785, 0.0505},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{17.4212, -12.2115, -10.7803, 0.5002},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{16.9914, -11.4795, -10.5309, 0.4973},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{-8.5480, 7.9971, -1.5354, 0.7178},
-	{-9.4129, 9.0688, -0.3582, 0.7311},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{14.5693, -3.3949, -2.0728, 0.2113},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{13.1608, 6.5094, -9.0719, 0.7656},
-	{10.5792, 8.8619, -6.2095, 0.7672},
-	{12.9097, 5.1491, -7.8942, 0.7470},
-	{3.7022, 2.6929, -9.2950, 0.6522},
-	{2.1439, 2.8748, -9.7078, 0.6512},
-	{3.6900, 4.9223, -11.1604, 0.6617},
-	{-13.8226, -11.5519, 6.6074, 0.0726},
-	{-14.2898, -11.8803, 4.7141, 0.0757},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-13.7070, -9.3744, 12.3304, 0.3012},
-	{-14.6607, -8.2925, 9.4719, 0.3081},
-	{-13.7866, -10.0667, 11.4884, 0.2912},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{-1.1804, -15.5428, 0.7072, 0.3177},
-	{-0.8757, -13.8952, -1.8687, 0.3462},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-7.6121, 2.2336, 10.7794, 0.1423},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{2.9738, -13.4960, 8.5257, 0.3585},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{2.6092, -14.8472, 9.1994, 0.3503},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-9.1270, 8.9055, 4.7912, 0.8756},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-10.5017, -11.8747, 13.7665, 0.2719},
-	{-12.0381, -12.8281, 11.8384, 0.2651},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{13.1608, 6.5094, -9.0719, 0.7656},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{-2.8026, -8.3895, 11.8084, 0.4238},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{9.6256, 12.3425, -10.3036, 0.7785},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{10.1601, 11.8141, -11.3540, 0.7905},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{8.1631, -13.4727, 5.2951, 0.0435},
-	{7.7699, -12.5060, 4.7863, 0.0437},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-10.2957, 11.8931, 0.9380, 0.7893},
-	{1.0077, 10.1127, -5.6591, 0.6879},
-	{0.3345, 8.3465, -7.6945, 0.6606},
-	{0.1535, 9.0694, -4.8813, 0.6838},
-	{-6.4535, 13.0135, 7.4080, 0.5812},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-7.7815, 12.5430, 7.2711, 0.5719},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{-5.6884, -10.9949, -5.3392, 0.2364},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{-8.6857, 16.6325, -3.2761, 0.0743},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-8.1047, 16.5628, -3.4644, 0.0678},
-	{-14.7201, 14.2626, 11.7241, 0.5021},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-14.8950, 14.2712, 12.6602, 0.5035},
-	{9.1806, -12.7604, 2.8520, 0.0478},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{6.8035, 10.6094, -12.1665, 0.6164},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{1.2794, -12.0556, 8.1840, 0.3793},
-	{-12.6273, 9.7881, 17.5171, 0.9239},
-	{-14.8154, 10.6544, 18.2212, 0.9124},
-	{-15.6423, 9.2485, 14.3285, 0.8823},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{9.6256, 12.3425, -10.3036, 0.7785},
-	{8.7774, 12.6658, -10.4472, 0.7717},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{13.4484, -6.3018, 2.1993, 0.1945},
-	{12.2882, -6.7028, 1.6119, 0.2020},
-	{-16.6978, 8.5855, 13.2630, 0.8087},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{8.2621, 1.8440, -7.1220, 0.8530},
-	{7.7965, 3.1330, -6.9403, 0.8689},
-	{6.8583, 2.2363, -8.9013, 0.8582},
-	{15.7142, -16.0203, -4.2003, 0.8052},
-	{15.6765, -16.1947, -7.0332, 0.7990},
-	{16.8963, -16.1990, -6.4198, 0.8077},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-15.7605, -14.3025, 4.0597, 0.0294},
-	{-15.0406, -14.2704, 5.7139, 0.0213},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{3.8734, 6.9597, -0.9593, 0.1680},
-	{3.5084, 8.9761, -1.7717, 0.1884},
-	{-8.7441, 4.4453, 9.4249, 0.4563},
-	{-7.1312, 6.7927, 7.2440, 0.4932},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{9.1806, -12.7604, 2.8520, 0.0478},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{14.2423, 5.8573, -13.6831, 0.2718},
-	{14.2479, 5.9961, -13.3436, 0.2726},
-	{15.0203, 6.6327, -12.5542, 0.2825},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-5.6013, -7.4408, -3.5952, 0.4154},
-	{-5.7302, -10.4307, -3.5717, 0.3871},
-	{-6.9668, 8.9693, 6.4013, 0.8997},
-	{-7.6342, 9.4864, 7.2458, 0.9006},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{-1.6232, 7.1243, -2.3440, 0.6794},
-	{-1.0391, 8.8979, -2.9978, 0.6920},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-9.8680, 12.0612, 7.4716, 0.9582},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{16.6170, 2.5289, -12.2647, 0.9620},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{20.1509, -4.4673, -7.9739, 0.9321},
-	{0.5371, -1.9433, 2.9994, 0.0764},
-	{-0.1444, -0.5583, 2.5858, 0.0921},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-3.4123, -11.7058, -4.5972, 0.2475},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-4.0442, -12.1336, -5.4742, 0.2403},
-	{-5.7258, -3.4623, 10.9865, 0.4776},
-	{-3.2346, -5.3071, 11.1162, 0.4520},
-	{-2.9254, -5.9912, 8.0761, 0.4528},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{9.7438, -8.6649, -3.9130, 0.2691},
-	{6.8770, -16.4242, -9.7199, 0.3341},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{5.5196, -15.3375, -10.0566, 0.3229},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{-14.6137, -6.2262, 10.3488, 0.3302},
-	{-14.6607, -8.2925, 9.4719, 0.3081},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{-5.9376, -12.6567, -6.4934, 0.2215},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{11.6827, -4.4620, -0.7342, 0.2189},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{-6.7962, -13.7906, 12.5367, 0.3109},
-	{-5.9360, -14.0109, 11.8411, 0.3219},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{15.7121, 3.2941, -15.5172, 0.5880},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{-10.5017, -11.8747, 13.7665, 0.2719},
-	{-12.3758, -11.0406, 13.0324, 0.2840},
-	{-13.3672, -11.3660, 11.3147, 0.2798},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{9.7830, -16.5711, -10.0824, 0.3917},
-	{6.8770, -16.4242, -9.7199, 0.3341},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{2.6548, 12.5272, -5.5084, 0.6901},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{2.8918, 11.5702, -5.6655, 0.6948},
-	{12.1509, -11.9581, -1.3225, 0.0832},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{9.6717, -7.5794, -5.1277, 0.7419},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{10.3793, -8.0264, -6.3700, 0.7589},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{13.4319, 0.4791, -13.3091, 0.6328},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{19.0091, -6.1027, -4.9983, 0.9236},
-	{19.8388, -5.6107, -6.1269, 0.9213},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{7.8682, -15.8818, -6.0295, 0.7285},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{8.8292, -15.9295, -4.5847, 0.7410},
-	{-14.2719, 13.2783, 17.7108, 0.9492},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-13.8602, 12.2784, 17.5724, 0.9513},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{1.8102, -7.4700, 3.2377, 0.3765},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{12.7049, 7.9643, -11.6312, 0.8185},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{-1.4820, -13.0582, 15.1007, 0.3397},
-	{-2.1208, -13.0904, 15.2665, 0.3380},
-	{-1.2252, -14.1486, 14.8460, 0.3369},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{9.0410, -10.6755, -14.4063, 0.3838},
-	{7.3338, -9.6020, -14.6035, 0.3620},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{17.0896, -9.3267, -2.6090, 0.0930},
-	{16.8039, -11.6417, -1.7451, 0.0724},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{11.0273, 2.1142, -15.4468, 0.6525},
-	{12.6402, -10.8638, -1.7331, 0.0415},
-	{11.8049, -12.8121, -1.1697, 0.0244},
-	{13.5579, -11.9461, -1.2313, 0.0426},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{-5.6338, 19.7575, -0.9304, 0.8979},
-	{-4.2732, 8.4109, 5.3970, 0.7267},
-	{-3.0163, 8.7605, 2.8960, 0.7474},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-9.4803, 12.3522, 5.2508, 0.9654},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{-12.0376, -7.0010, 14.3549, 0.3227},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{-11.3339, -7.6051, 14.4357, 0.3174},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{5.0484, -12.1720, -15.4119, 0.3452},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-9.1308, 9.0033, 4.9351, 0.8762},
-	{-17.8252, -14.4751, 3.7252, 0.0687},
-	{-17.1829, -13.9211, 2.5898, 0.0720},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{11.8568, 2.4786, -3.5084, 0.2232},
-	{12.8717, -0.1663, -2.2988, 0.2168},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{3.6900, 4.9223, -11.1604, 0.5609},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{9.7830, -16.5711, -10.0824, 0.7315},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-12.4106, 15.9474, 16.4255, 0.5365},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{5.4766, 11.0116, -11.1080, 0.6009},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{-10.7238, 13.2526, 5.3022, 0.5253},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-16.4933, -11.4182, 5.1380, 0.0579},
-	{-15.9777, -11.3938, 5.7962, 0.0577},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{9.5263, 5.6549, -5.3833, 0.7635},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{-3.1260, 13.4372, 0.7263, 0.8641},
-	{-1.7488, 15.0511, 0.4650, 0.8851},
-	{-2.0730, 13.6539, 0.4205, 0.8700},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{9.2682, -8.1809, 0.1404, 0.2471},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-5.8577, 20.5844, 1.1279, 0.1785},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-6.0167, 13.5486, 7.5309, 0.5828},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{0.2826, -13.7945, 4.1088, 0.3207},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-16.1453, 13.8767, 19.0847, 0.9486},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-9.6062, 10.9789, 0.2842, 0.7499},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{1.6899, -11.8764, 3.3873, 0.3312},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{0.2826, -13.7945, 4.1088, 0.3207},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{6.4395, 0.0270, -11.5685, 0.8380},
-	{3.7059, -5.5763, -9.7328, 0.7760},
-	{-17.1632, -14.0962, 6.0941, 0.0404},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{18.2357, 2.6241, -14.5739, 0.3875},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{17.1895, 3.0382, -13.9363, 0.3940},
-	{0.5456, 10.8315, -4.4069, 0.6997},
-	{1.0077, 10.1127, -5.6591, 0.6879},
-	{0.1535, 9.0694, -4.8813, 0.6838},
-	{3.5083, 0.9463, 0.2755, 0.1100},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{-3.4391, 12.8762, -2.6620, 0.0408},
-	{-3.8425, 14.2969, -1.9023, 0.0575},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{3.4480, -10.1667, -13.4966, 0.3282},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{-5.9165, -3.7333, 5.1811, 0.9105},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{18.0389, 10.1497, -13.3565, 0.4592},
-	{17.3238, 9.8524, -13.2363, 0.4622},
-	{17.9182, 10.0911, -12.8093, 0.4577},
-	{-1.2322, -0.9956, 2.3762, 0.8603},
-	{-1.2934, -2.9626, 3.4450, 0.8631},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{11.7425, -5.6727, -2.1637, 0.2275},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.6590, -5.8169, -2.1081, 0.2285},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{-11.0891, 2.0356, 3.3666, 0.1614},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{5.6983, -13.3486, -13.6142, 0.3866},
-	{6.0478, -14.7572, -15.3357, 0.3693},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{1.5414, -11.3823, 7.5228, 0.3872},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{-16.4105, -12.2949, 3.8123, 0.0589},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{18.4667, 3.7664, -15.0333, 0.3902},
-	{19.4195, 3.8726, -14.8441, 0.3910},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{6.2015, -14.7169, -16.2630, 0.3662},
-	{6.0478, -14.7572, -15.3357, 0.3698},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{-13.4539, -0.1193, 8.9642, 0.3989},
-	{-12.0712, 1.7544, 9.7387, 0.4162},
-	{-12.6425, 1.6666, 7.9214, 0.4223},
-	{2.5005, 12.6733, -6.0545, 0.5629},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{1.6235, 11.5088, -5.1563, 0.5488},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{13.2842, -15.1610, 1.8744, 0.0472},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{14.5693, -3.3949, -2.0728, 0.2113},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{17.6724, -7.9110, -11.2655, 0.5755},
-	{16.9335, -8.6897, -9.8031, 0.5633},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{0.0936, 17.0687, -0.7948, 0.8522},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{-0.6231, 15.9461, -0.2778, 0.8428},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{-8.2512, 11.6577, 9.3403, 0.9182},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{-6.4535, 13.0135, 7.4080, 0.9140},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-8.5412, -12.6516, 13.2794, 0.2571},
-	{-10.5017, -11.8747, 13.7665, 0.2719},
-	{-10.7215, 10.6147, 13.3614, 0.9113},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{9.3985, -8.0758, -3.7579, 0.2723},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{-13.0748, 8.1682, 8.5429, 0.8261},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{-5.7445, -7.8728, -5.1948, 0.2623},
-	{-5.6013, -7.4408, -3.5952, 0.2626},
-	{-4.9385, -6.0655, -5.4775, 0.2773},
-	{17.8094, -7.3121, -4.0477, 0.9168},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{16.9785, -7.5101, -4.5312, 0.9286},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{10.6705, -6.3049, -7.0521, 0.6345},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{11.3671, -14.2139, -1.2936, 0.0125},
-	{14.6487, -14.4410, -1.5320, 0.0429},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{-1.0391, 8.8979, -2.9978, 0.1975},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{9.0131, -7.2971, -12.7473, 0.5559},
-	{-5.7302, -10.4307, -3.5717, 0.2241},
-	{-7.8645, -11.8165, -3.2458, 0.2013},
-	{-7.2171, -10.9163, -1.8646, 0.2044},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{-9.0450, 19.0239, 8.0409, 0.9499},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{14.8646, -11.7386, -11.9010, 0.4711},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{-11.2763, -4.3120, 3.1914, 0.4345},
-	{-10.7816, -3.4198, 3.2893, 0.4447},
-	{-9.2443, -3.8060, 2.9851, 0.4482},
-	{-5.3558, -3.3206, 8.8639, 0.9210},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{-5.9165, -3.7333, 5.1811, 0.9105},
-	{9.7438, -8.6649, -3.9130, 0.7482},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{9.6717, -7.5794, -5.1277, 0.7419},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{12.9082, -4.6149, 0.6032, 0.2096},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-14.5913, 7.9342, 10.7804, 0.8198},
-	{-13.5612, 8.1108, 10.8602, 0.8266},
-	{11.2025, -6.2287, -8.8013, 0.6375},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-14.3277, 18.9486, 13.8145, 0.6491},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{5.6695, 13.0500, -8.3983, 0.7286},
-	{5.3257, 13.4761, -7.8679, 0.7213},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-9.3756, 13.4800, -1.2327, 0.7774},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-13.1612, -12.5771, 0.9637, 0.1158},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{13.1608, 6.5094, -9.0719, 0.7656},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{-10.3590, -5.7197, 14.6062, 0.0525},
-	{-11.3339, -7.6051, 14.4357, 0.0369},
-	{-9.7973, -8.2993, 14.5111, 0.0328},
-	{-1.6805, -14.1400, 13.2937, 0.3375},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-2.5633, -13.8926, 13.4230, 0.3361},
-	{5.6670, -10.8840, -3.4933, 0.2919},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{6.2106, -12.4636, -3.2128, 0.2937},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{4.2351, -11.6789, -14.7300, 0.3341},
-	{5.0484, -12.1720, -15.4119, 0.3452},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{15.2706, 6.8616, -14.4437, 0.2809},
-	{15.7333, 9.3575, -12.3397, 0.3064},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-9.1658, 14.6305, 14.1505, 0.5584},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{12.2882, -6.7028, 1.6119, 0.2020},
-	{12.8661, -10.1185, -1.5813, 0.1194},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{11.5682, -12.8394, -0.4424, 0.0719},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{-4.0728, -16.0338, -0.9999, 0.7059},
-	{-4.6817, -15.9271, -0.1425, 0.7032},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-7.0645, 21.8360, 1.3711, 0.8689},
-	{-7.9851, 18.2976, 1.7329, 0.9048},
-	{-7.9645, 18.8758, 2.9852, 0.8962},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{7.0770, -16.3347, -6.0022, 0.3086},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{6.0397, -16.1432, -6.0115, 0.3082},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-14.7201, 14.2626, 11.7241, 0.5021},
-	{-14.8950, 14.2712, 12.6602, 0.5035},
-	{13.2842, -15.1610, 1.8744, 0.0472},
-	{11.6983, -15.0258, 1.4530, 0.0449},
-	{13.2954, -15.4297, 1.2413, 0.0464},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{-3.1785, 11.4398, -3.0189, 0.0302},
-	{-3.4391, 12.8762, -2.6620, 0.0408},
-	{-3.1260, 13.4372, 0.7263, 0.8641},
-	{-1.4665, 12.5815, 0.5091, 0.8596},
-	{-1.6118, 12.2198, 0.5036, 0.8541},
-	{-14.4701, 10.7525, 13.6401, 0.7907},
-	{-15.4862, 11.8869, 14.3393, 0.7910},
-	{-14.9160, 12.0514, 14.8918, 0.7874},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{-5.1566, -7.8780, 13.1179, 0.4361},
-	{-2.8026, -8.3895, 11.8084, 0.4238},
-	{6.9485, -13.1409, -1.5811, 0.2958},
-	{6.0652, -13.2733, -1.3619, 0.2888},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-12.3291, -10.8595, 3.7359, 0.1012},
-	{12.1286, 10.2887, -12.0302, 0.8126},
-	{12.1663, 9.3015, -11.7901, 0.8155},
-	{12.0688, 10.1575, -12.5829, 0.8167},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{-9.4637, 18.1300, 10.8893, 0.9728},
-	{-8.0807, 18.4528, 9.7007, 0.9577},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-4.8594, 9.0884, 7.4120, 0.8598},
-	{-4.5353, 10.3089, 7.1983, 0.8750},
-	{8.3087, -6.7818, -13.5410, 0.3591},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-11.8199, 11.7743, 16.7667, 0.9057},
-	{-12.6683, 12.3101, 17.3168, 0.9059},
-	{8.2056, -14.2358, -1.1659, 0.0263},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{8.9170, -13.3225, -1.6060, 0.0265},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{-10.2018, 18.0151, 10.2676, 0.5906},
-	{-10.6244, 18.6519, 10.0182, 0.5941},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-11.9356, 18.1080, 17.5606, 0.5356},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{-5.6964, -3.3373, 3.5129, 0.1472},
-	{-5.8695, -2.3683, 3.3816, 0.1545},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-11.2562, 9.6756, 18.9114, 0.8844},
-	{-10.3399, 8.3952, 17.0063, 0.8775},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-10.9298, -15.2923, 7.8475, 0.6427},
-	{-12.8302, -13.6642, 6.5080, 0.6213},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{5.3288, -10.1704, -12.9107, 0.3457},
-	{-15.6416, 15.8353, 12.7678, 0.4989},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{16.7603, -15.9094, -11.8002, 0.4846},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{17.5388, -13.6704, -10.4353, 0.5027},
-	{9.7517, 2.8258, -6.1310, 0.8430},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{9.1599, -1.9722, -5.5275, 0.8091},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{-8.4392, 10.5384, -3.0647, 0.7430},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.5071, -14.6809, 4.7707, 0.3252},
-	{-3.0850, 7.3498, 0.4457, 0.2525},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-3.2529, 8.6209, -1.6967, 0.2755},
-	{-7.5222, -5.7208, 13.5055, 0.0659},
-	{-7.8423, -8.1706, 13.9791, 0.0418},
-	{-6.6939, -8.2873, 13.3505, 0.0443},
-	{13.3984, -0.0488, -9.0357, 0.7021},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{1.8234, -9.7317, -2.3379, 0.3857},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{-6.6065, 16.3011, -6.4520, 0.8108},
-	{-6.3602, 15.5921, -4.9454, 0.7987},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-5.6394, 11.2143, -2.7466, 0.5161},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-4.2438, -5.4002, -4.8993, 0.2843},
-	{-3.4679, -9.3998, -5.3591, 0.2637},
-	{-10.5017, -11.8747, 13.7665, 0.2719},
-	{-13.3672, -11.3660, 11.3147, 0.2798},
-	{-12.0381, -12.8281, 11.8384, 0.2651},
-	{-5.9376, -12.6567, -6.4934, 0.2215},
-	{-5.6884, -10.9949, -5.3392, 0.2294},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{13.5400, 3.1643, -13.8915, 0.6593},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{-5.5777, 22.6380, -0.2408, 0.8598},
-	{-5.7272, 21.8698, 1.0093, 0.8659},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{10.3793, -8.0264, -6.3700, 0.6152},
-	{11.1731, -9.1355, -7.1757, 0.6101},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{10.6705, -6.3049, -7.0521, 0.6345},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{-9.7587, 8.1353, 1.7902, 0.8462},
-	{4.1510, 0.9721, -1.0348, 0.4744},
-	{3.4023, -1.8623, 0.2152, 0.4423},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{-5.7258, -3.4623, 10.9865, 0.0998},
-	{-5.7548, -1.8554, 9.5994, 0.1208},
-	{-13.2640, 11.0752, 12.2144, 0.9663},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-12.7705, 10.3638, 10.8589, 0.9740},
-	{5.4504, -10.3001, -3.7998, 0.2924},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{-5.7272, 21.8698, 1.0093, 0.1903},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-5.8577, 20.5844, 1.1279, 0.1785},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{1.2794, -12.0556, 8.1840, 0.3794},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{-4.8539, -15.0859, 16.0388, 0.3114},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{-9.6062, 10.9789, 0.2842, 0.7499},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{-12.0306, -0.8041, 12.5914, 0.3841},
-	{-13.1699, -0.8163, 11.3602, 0.3848},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{12.0129, -5.9750, -2.1689, 0.2289},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{12.6402, -10.8638, -1.7331, 0.2601},
-	{12.8661, -10.1185, -1.5813, 0.2535},
-	{12.1509, -11.9581, -1.3225, 0.2653},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{5.6670, -10.8840, -3.4933, 0.2919},
-	{5.4504, -10.3001, -3.7998, 0.2924},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{6.0408, -12.2147, -0.1022, 0.0312},
-	{6.6938, -12.3714, -1.3408, 0.0311},
-	{5.9227, -12.9346, -1.5604, 0.0293},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{3.7059, -5.5763, -9.7328, 0.7760},
-	{3.9330, -6.3697, -6.3282, 0.7610},
-	{-6.8869, 9.8867, 9.1845, 0.8517},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-8.0148, 9.8406, 10.4461, 0.8509},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{-4.2684, -13.2530, -3.7415, 0.3517},
-	{-3.4123, -11.7058, -4.5972, 0.3715},
-	{6.2600, -8.5717, -3.7011, 0.7428},
-	{4.9971, -7.8016, -4.5740, 0.7456},
-	{5.4504, -10.3001, -3.7998, 0.7316},
-	{18.2357, 2.6241, -14.5739, 0.3875},
-	{18.4667, 3.7664, -15.0333, 0.3902},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{-12.1633, 15.7950, 15.7030, 0.5370},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{8.3254, 6.7137, -14.6254, 0.6244},
-	{6.2864, 6.7230, -13.4818, 0.5998},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-10.2957, 11.8931, 0.9380, 0.7893},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{-6.5106, -9.7525, 14.7792, 0.4172},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{3.5957, -12.6132, -13.9383, 0.3249},
-	{2.3919, -13.7558, -14.0267, 0.3287},
-	{-3.1785, 11.4398, -3.0189, 0.0302},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{-3.3588, 10.6414, -2.6192, 0.0220},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-11.4139, -5.2576, 14.4202, 0.3412},
-	{-11.7350, -3.6301, 13.7731, 0.3554},
-	{-12.9262, -4.7566, 13.4325, 0.3446},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{13.2954, -15.4297, 1.2413, 0.0464},
-	{11.6983, -15.0258, 1.4530, 0.0449},
-	{-10.8485, 12.1959, 14.8625, 0.9068},
-	{-10.7215, 10.6147, 13.3614, 0.9113},
-	{-11.2724, 11.1845, 13.9605, 0.9140},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-4.9850, 15.7308, 7.3268, 0.7769},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-7.1422, 13.1945, -4.8339, 0.7730},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{-0.1145, -10.0834, 6.1052, 0.4133},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-8.3005, -8.7975, 14.1086, 0.0341},
-	{-9.7973, -8.2993, 14.5111, 0.0328},
-	{-11.0354, -9.4953, 14.4719, 0.0254},
-	{-5.6730, 7.1143, 6.8094, 0.2080},
-	{-7.1312, 6.7927, 7.2440, 0.1986},
-	{-8.7441, 4.4453, 9.4249, 0.1715},
-	{-5.1697, 17.6683, 1.8463, 0.1483},
-	{-0.9228, 21.0701, -6.0281, 0.1516},
-	{-0.5514, 22.0208, -6.4770, 0.1569},
-	{-7.8039, 8.7067, -1.8271, 0.0013},
-	{-7.7482, 8.9352, -3.7482, 0.0019},
-	{-6.8149, 9.0396, -2.3429, 0.0057},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-8.2955, -9.4780, -0.7969, 0.3990},
-	{-8.8689, -8.2056, -0.2558, 0.4066},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{-5.6884, -10.9949, -5.3392, 0.2294},
-	{-5.9376, -12.6567, -6.4934, 0.2215},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{-8.6739, 17.5264, 0.4775, 0.5999},
-	{-7.3770, 16.6115, -0.9756, 0.5794},
-	{-8.2290, 16.8279, -1.5123, 0.5889},
-	{9.1806, -12.7604, 2.8520, 0.0478},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-9.7649, 17.7221, 1.9883, 0.9112},
-	{-11.4525, 17.7902, 3.6290, 0.9345},
-	{20.7549, 9.4214, -14.0206, 0.3154},
-	{20.6673, 9.3354, -14.9361, 0.3078},
-	{18.5321, 8.5916, -13.5023, 0.3184},
-	{10.6705, -6.3049, -7.0521, 0.6345},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{10.3793, -8.0264, -6.3700, 0.6152},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-5.5554, 14.2622, -6.8740, 0.7840},
-	{-5.5519, 13.3641, -7.4648, 0.7756},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-9.8680, 12.0612, 7.4716, 0.9582},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-2.8143, 19.2991, -4.1041, 0.1419},
-	{-0.9228, 21.0701, -6.0281, 0.1516},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-6.4156, 16.9751, -6.7188, 0.8168},
-	{-6.6065, 16.3011, -6.4520, 0.8108},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{19.7660, -12.2128, -4.6087, 0.0976},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{14.0153, -1.8870, -11.2939, 0.6885},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{13.3282, -3.7156, -10.7981, 0.6700},
-	{-2.8264, 3.1792, -0.3501, 0.1392},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-2.7771, 3.5188, -0.9287, 0.1454},
-	{7.6038, -13.3962, -12.9579, 0.3404},
-	{10.0827, -15.0745, -11.7295, 0.3746},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{10.0827, -15.0745, -11.7295, 0.3746},
-	{9.7830, -16.5711, -10.0824, 0.3917},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-11.0026, 17.2074, 16.4070, 0.5502},
-	{-11.9356, 18.1080, 17.5606, 0.5356},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{2.2377, -10.1881, 3.5253, 0.3466},
-	{1.6899, -11.8764, 3.3873, 0.3332},
-	{-9.2031, 8.8315, 4.7525, 0.8754},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{13.5400, 3.1643, -13.8915, 0.5875},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{13.4319, 0.4791, -13.3091, 0.5695},
-	{-12.0712, 1.7544, 9.7387, 0.4162},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-12.6425, 1.6666, 7.9214, 0.4223},
-	{-9.6771, -6.4746, 1.4750, 0.4222},
-	{-11.2763, -4.3120, 3.1914, 0.4345},
-	{-8.6639, -5.6106, 2.4701, 0.4386},
-	{-12.3739, -1.1932, 4.6760, 0.1243},
-	{-13.0094, -3.9825, 4.7249, 0.0968},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{-2.9694, 15.5825, 4.9978, 0.7955},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{17.7315, -3.9778, -13.0607, 0.5455},
-	{16.6136, -3.8818, -12.8358, 0.5299},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{0.3758, -14.1416, 2.0205, 0.3243},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{-6.3928, 9.7681, -6.3590, 0.0018},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{-7.3083, 9.8503, -3.6142, 0.0055},
-	{15.3068, -1.7497, -10.4899, 0.8577},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{5.6695, 13.0500, -8.3983, 0.7286},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{-14.2470, 13.2123, 11.5925, 0.5032},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-14.7201, 14.2626, 11.7241, 0.5021},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{0.6859, -15.3500, 9.3779, 0.3417},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{-1.2322, -0.9956, 2.3762, 0.8603},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{0.5371, -1.9433, 2.9994, 0.8439},
-	{-8.9049, -2.4916, 2.5529, 0.1339},
-	{-9.2443, -3.8060, 2.9851, 0.1233},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{-12.9262, -4.7566, 13.4325, 0.3446},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{5.5196, -15.3375, -10.0566, 0.3229},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{7.2285, -14.4412, 1.5781, 0.0292},
-	{6.9877, -14.1246, -1.2603, 0.0279},
-	{8.2056, -14.2358, -1.1659, 0.0245},
-	{13.3282, -3.7156, -10.7981, 0.6700},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{11.8520, -6.7169, -9.3782, 0.6348},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{1.7000, -15.0060, 9.6214, 0.3482},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{4.2656, -6.8950, -5.4206, 0.7571},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{3.4899, -10.4980, -6.1315, 0.2929},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{-13.8226, -11.5519, 6.6074, 0.0726},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-14.9446, -11.8283, 7.1555, 0.0551},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-9.1388, 9.0247, 5.0866, 0.8768},
-	{-9.1308, 9.0033, 4.9351, 0.8762},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-13.6933, 10.6624, 12.4149, 0.9725},
-	{-14.0775, 11.0124, 13.4161, 0.9665},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{7.0770, -16.3347, -6.0022, 0.7195},
-	{8.0290, -15.9706, -7.8603, 0.7269},
-	{7.8682, -15.8818, -6.0295, 0.7285},
-	{-3.2417, -14.8505, 8.1421, 0.7259},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{10.8335, 11.4811, -11.1021, 0.7945},
-	{10.1601, 11.8141, -11.3540, 0.7905},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{5.4766, 11.0116, -11.1080, 0.6009},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{-9.4989, 15.6880, 15.2625, 0.5579},
-	{-11.0026, 17.2074, 16.4070, 0.5502},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{6.4971, 3.8652, -12.7361, 0.6727},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{6.4395, 0.0270, -11.5685, 0.6383},
-	{-9.4275, -0.7323, 12.9708, 0.3935},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{-9.8863, -3.6202, 14.1223, 0.3601},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{-9.2074, 8.0057, 1.9418, 0.8519},
-	{-9.7587, 8.1353, 1.7902, 0.8462},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-15.6712, 18.9649, 14.5346, 0.5040},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{12.5645, -10.4628, -2.0711, 0.2597},
-	{12.8661, -10.1185, -1.5813, 0.2535},
-	{12.6402, -10.8638, -1.7331, 0.2601},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{13.2540, -12.8488, -12.8420, 0.4433},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{11.0393, -9.9958, 0.1010, 0.2346},
-	{7.9798, -12.4199, -0.5672, 0.2774},
-	{9.8295, -12.5934, -1.1503, 0.2608},
-	{12.1583, 9.6234, -12.5125, 0.8201},
-	{12.0688, 10.1575, -12.5829, 0.8167},
-	{12.1663, 9.3015, -11.7901, 0.8155},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{5.4766, 11.0116, -11.1080, 0.6009},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{-12.1873, 16.4319, 14.9377, 0.5315},
-	{-11.8417, 15.0608, 15.9355, 0.5409},
-	{-12.1633, 15.7950, 15.7030, 0.5370},
-	{-6.9060, -3.5212, 12.3504, 0.0889},
-	{-9.4275, -0.7323, 12.9708, 0.1038},
-	{-9.8863, -3.6202, 14.1223, 0.0725},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{-9.2031, 8.8315, 4.7525, 0.8754},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{-9.1270, 8.9055, 4.7912, 0.8756},
-	{16.1312, 9.1850, -11.8702, 0.4569},
-	{16.9610, 8.1775, -12.3740, 0.4503},
-	{16.5977, 8.6787, -13.2350, 0.4599},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{12.8717, -0.1663, -2.2988, 0.2168},
-	{11.8280, 2.1740, -2.6673, 0.2222},
-	{-10.6823, 9.2650, 4.7444, 0.8651},
-	{-10.7522, 8.0480, 3.4262, 0.8577},
-	{-10.7867, 8.0620, 2.9362, 0.8537},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-12.6273, 9.7881, 17.5171, 0.8708},
-	{-11.4002, 9.2178, 16.2556, 0.8678},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-15.6416, 15.8353, 12.7678, 0.4989},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{11.2181, 10.7934, -11.8837, 0.8047},
-	{10.8335, 11.4811, -11.1021, 0.7945},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{-5.6286, 18.2818, 2.8314, 0.1551},
-	{-5.1697, 17.6683, 1.8463, 0.1483},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{4.7612, -14.0902, -0.0963, 0.0283},
-	{4.9673, -14.9897, -0.2152, 0.0282},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{-6.4156, 16.9751, -6.7188, 0.8168},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-8.1047, 16.5628, -3.4644, 0.8084},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-3.0351, 20.7927, -4.1365, 0.9026},
-	{-0.8419, 22.2036, -6.8040, 0.9055},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{5.1374, 2.4670, -4.6470, 0.6514},
-	{4.6527, 2.0609, -7.3862, 0.6558},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{-0.5673, -4.7395, -7.3621, 0.4481},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{13.2540, -12.8488, -12.8420, 0.4433},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{-10.1421, 3.4889, 10.0141, 0.4368},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{-15.9215, 16.1249, 11.5135, 0.4870},
-	{-15.8173, 15.5995, 10.1785, 0.4825},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-10.6261, 7.9726, 3.6953, 0.8403},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{5.3257, 13.4761, -7.8679, 0.5974},
-	{4.9641, 13.0677, -8.4608, 0.5958},
-	{4.3121, 12.9834, -7.4063, 0.5861},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{14.2867, -1.1365, -12.1842, 0.5497},
-	{13.4319, 0.4791, -13.3091, 0.5695},
-	{-1.6930, -7.7270, -6.3001, 0.5329},
-	{-3.4123, -11.7058, -4.5972, 0.5229},
-	{-3.4679, -9.3998, -5.3591, 0.5297},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{0.2163, 13.8998, -0.9935, 0.8774},
-	{0.1807, 14.3208, 0.0519, 0.8834},
-	{0.4936, 13.5999, -0.5286, 0.8776},
-	{-8.9049, -2.4916, 2.5529, 0.1339},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-16.4933, -11.4182, 5.1380, 0.0579},
-	{-16.4105, -12.2949, 3.8123, 0.0589},
-	{15.2535, 4.4336, -12.4394, 0.9166},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{16.1311, 3.9612, -12.7168, 0.9124},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{19.6713, 5.2036, -15.5143, 0.3954},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{20.3088, 4.0338, -15.4419, 0.3875},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-10.5867, 12.4049, 1.9497, 0.5043},
-	{9.6256, 12.3425, -10.3036, 0.7785},
-	{9.8342, 12.3775, -11.2897, 0.7848},
-	{8.7774, 12.6658, -10.4472, 0.7717},
-	{-12.0306, -0.8041, 12.5914, 0.3841},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-13.1699, -0.8163, 11.3602, 0.3848},
-	{-11.1145, 13.6920, 1.3257, 0.6272},
-	{-13.0739, 13.1598, 5.2124, 0.6390},
-	{-12.4906, 14.1734, 4.7138, 0.6315},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-8.3499, 17.2083, 10.7745, 0.5724},
-	{-9.4225, 17.1743, 10.4049, 0.5847},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{-6.8869, 9.8867, 9.1845, 0.9122},
-	{-10.2034, 8.8741, 8.5897, 0.8893},
-	{-11.9456, 8.8136, 7.3754, 0.8693},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-14.6287, 16.5303, 14.2202, 0.5115},
-	{-7.8901, -13.2971, 12.4355, 0.6773},
-	{-7.9911, -14.1694, 12.0448, 0.6768},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-7.2728, 15.1755, 12.1963, 0.5610},
-	{-4.6971, 15.2349, 7.8126, 0.5215},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{11.8792, -9.2179, 1.6064, 0.1485},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-12.3291, -10.8595, 3.7359, 0.0902},
-	{-13.5526, -8.7411, 5.2566, 0.0781},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{11.4715, -6.9738, -9.8564, 0.5492},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{-13.2106, -4.8603, 2.6326, 0.1109},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{-4.7243, -15.1252, 12.6717, 0.3291},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{14.4858, 6.5577, -13.7337, 0.2773},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{14.2423, 5.8573, -13.6831, 0.2718},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-14.2719, 13.2783, 17.7108, 0.9453},
-	{-13.3308, 12.3683, 16.9123, 0.9401},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{10.0313, -14.8641, -1.8649, 0.0204},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{9.1778, -14.3305, -1.9546, 0.0069},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{12.3191, -9.1942, -2.0143, 0.2504},
-	{11.5097, -9.9075, -2.5946, 0.2627},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{-8.9049, -2.4916, 2.5529, 0.1339},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-12.8898, 16.6579, 5.0217, 0.6081},
-	{-11.8462, 15.9685, 3.3982, 0.6100},
-	{2.7397, -6.6878, 0.9006, 0.3924},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-10.6261, 7.9726, 3.6953, 0.8403},
-	{14.2313, 3.0442, -14.0519, 0.2432},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{15.1046, 1.7508, -14.9670, 0.2328},
-	{-14.4701, 10.7525, 13.6401, 0.9675},
-	{-14.9160, 12.0514, 14.8918, 0.9591},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-9.3756, 13.4800, -1.2327, 0.7774},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-12.8051, 15.3194, 7.5782, 0.6279},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{-14.2759, 8.6461, 13.5203, 0.8841},
-	{-11.4002, 9.2178, 16.2556, 0.9251},
-	{-15.6423, 9.2485, 14.3285, 0.8823},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{6.7492, -13.6822, 3.4298, 0.0338},
-	{6.1296, -14.3129, 2.8526, 0.0323},
-	{7.0343, -14.3935, 3.1022, 0.0312},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{13.4653, -7.4329, 2.5492, 0.1827},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-13.1612, -12.5771, 0.9637, 0.1158},
-	{-13.0133, 10.2308, 8.3547, 0.7979},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-10.8485, 12.1959, 14.8625, 0.9068},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-10.7215, 10.6147, 13.3614, 0.9113},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{15.7121, 3.2941, -15.5172, 0.2452},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{2.9304, 12.4364, -6.1754, 0.5700},
-	{3.8825, 13.2386, -7.3097, 0.5821},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{11.8049, -12.8121, -1.1697, 0.0787},
-	{11.9751, -12.1051, -1.2478, 0.0816},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{-4.4560, -3.6123, -3.3509, 0.5908},
-	{-2.9592, 0.0691, -5.5000, 0.6077},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{16.6136, -3.8818, -12.8358, 0.6186},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{16.3969, -5.8303, -10.0012, 0.5907},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-2.9694, 15.5825, 4.9978, 0.7955},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{-3.1785, 11.4398, -3.0189, 0.0302},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{8.2621, 1.8440, -7.1220, 0.8530},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{4.4404, -16.0428, -16.6574, 0.3579},
-	{3.5420, -16.1792, -16.3830, 0.3571},
-	{11.6590, -5.8169, -2.1081, 0.2285},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{15.7142, -16.0203, -4.2003, 0.8052},
-	{15.1032, -15.6144, -5.1526, 0.7972},
-	{15.6765, -16.1947, -7.0332, 0.7990},
-	{-8.5647, -15.5069, 1.8687, 0.6644},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-10.1598, -14.0057, 1.6100, 0.6434},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{-6.4427, -10.6470, 16.6438, 0.2649},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{-11.5234, 15.0454, 15.0451, 0.5414},
-	{-11.1472, 15.1347, 15.5449, 0.5445},
-	{-11.8417, 15.0608, 15.9355, 0.5409},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.7643, -10.2065, -3.2475, 0.3007},
-	{-10.2018, 18.0151, 10.2676, 0.9729},
-	{-9.4637, 18.1300, 10.8893, 0.9728},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{-3.0172, 19.5295, 3.0415, 0.9115},
-	{-3.3950, 17.5301, 4.0116, 0.8987},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.1270, 8.9055, 4.7912, 0.8756},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{-5.3177, -3.6893, 2.8291, 0.9048},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{9.0131, -7.2971, -12.7473, 0.5559},
-	{8.3087, -6.7818, -13.5410, 0.5642},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{4.3563, 2.0278, -7.9927, 0.6517},
-	{3.7022, 2.6929, -9.2950, 0.6522},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{6.0429, -10.6972, -1.8452, 0.2911},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{16.6280, 0.2496, -14.0909, 0.5657},
-	{17.7315, -3.9778, -13.0607, 0.5455},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{-11.7527, 17.2797, 8.9606, 0.9755},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-6.4535, 13.0135, 7.4080, 0.5812},
-	{-6.0167, 13.5486, 7.5309, 0.5828},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{4.2656, -6.8950, -5.4206, 0.2925},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.6205, 1.6841, -7.1764, 0.5102},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.5994, 11.0540, 11.8702, 0.7938},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{14.0754, -9.6989, 0.1312, 0.1523},
-	{15.1351, -7.1622, 0.4560, 0.1877},
-	{-1.0391, 8.8979, -2.9978, 0.6920},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-1.7978, 4.9306, -2.9884, 0.6618},
-	{8.3087, -6.7818, -13.5410, 0.3591},
-	{9.0131, -7.2971, -12.7473, 0.3708},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{-12.3739, -1.1932, 4.6760, 0.1243},
-	{-11.9983, -3.5871, 4.0195, 0.1067},
-	{-13.0094, -3.9825, 4.7249, 0.0968},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-10.2018, 18.0151, 10.2676, 0.5906},
-	{-5.8711, 18.3209, 5.4078, 0.9087},
-	{-5.1424, 17.9868, 4.0749, 0.8958},
-	{-5.6286, 18.2818, 2.8314, 0.8881},
-	{-4.6419, 8.1669, -2.3560, 0.2539},
-	{-3.2275, 6.6744, -2.4216, 0.2486},
-	{-3.4096, 5.8519, -1.9252, 0.2386},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{6.8810, 13.3788, -8.8553, 0.7427},
-	{6.4422, 12.1026, -7.7715, 0.7368},
-	{7.1277, 12.9565, -9.2771, 0.7492},
-	{13.9398, -14.0636, -13.5103, 0.4514},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{11.0406, -14.5414, -15.0672, 0.4265},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{20.7549, 9.4214, -14.0206, 0.4381},
-	{18.5321, 8.5916, -13.5023, 0.4423},
-	{-4.8620, 8.5587, 6.0390, 0.2253},
-	{-6.9668, 8.9693, 6.4013, 0.2202},
-	{-7.1312, 6.7927, 7.2440, 0.1986},
-	{2.5005, 12.6733, -6.0545, 0.6898},
-	{2.6548, 12.5272, -5.5084, 0.6901},
-	{2.9304, 12.4364, -6.1754, 0.6944},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{2.6548, 12.5272, -5.5084, 0.6901},
-	{2.5005, 12.6733, -6.0545, 0.6898},
-	{1.6235, 11.5088, -5.1563, 0.6792},
-	{-8.0326, 8.5711, 5.6535, 0.8891},
-	{-6.9668, 8.9693, 6.4013, 0.8997},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{19.3769, 3.7909, -15.6460, 0.2500},
-	{20.3088, 4.0338, -15.4419, 0.2502},
-	{19.4195, 3.8726, -14.8441, 0.2444},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{-1.6930, -7.7270, -6.3001, 0.4134},
-	{-0.5673, -4.7395, -7.3621, 0.4481},
-	{-6.9969, -13.3871, -5.6818, 0.2110},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{0.3345, 8.3465, -7.6945, 0.6606},
-	{0.3812, 5.6803, -9.0451, 0.6323},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{9.7830, -16.5711, -10.0824, 0.7315},
-	{15.5862, -16.2784, -8.8372, 0.7802},
-	{16.8963, -16.1990, -6.4198, 0.8077},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{2.3919, -13.7558, -14.0267, 0.3287},
-	{3.5957, -12.6132, -13.9383, 0.3249},
-	{4.2351, -11.6789, -14.7300, 0.3341},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{-14.2470, 13.2123, 11.5925, 0.5032},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{-15.6416, 15.8353, 12.7678, 0.4989},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{-4.0442, -12.1336, -5.4742, 0.2403},
-	{-3.4679, -9.3998, -5.3591, 0.2637},
-	{-3.4123, -11.7058, -4.5972, 0.2475},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-11.5000, -11.4883, -0.0532, 0.1384},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-11.3729, 8.5680, 3.3709, 0.8278},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-1.2881, -14.4745, 6.9149, 0.7395},
-	{-1.9653, -13.4975, 8.6495, 0.7386},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-13.5994, 11.0540, 11.8702, 0.7938},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{7.8682, -15.8818, -6.0295, 0.7285},
-	{8.8292, -15.9295, -4.5847, 0.7410},
-	{7.0770, -16.3347, -6.0022, 0.7195},
-	{-4.5626, 13.6823, 7.1706, 0.5958},
-	{-6.0167, 13.5486, 7.5309, 0.5828},
-	{-6.4535, 13.0135, 7.4080, 0.5812},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{-11.4479, 18.6465, 9.2176, 0.5997},
-	{-11.7527, 17.2797, 8.9606, 0.6102},
-	{17.9182, 10.0911, -12.8093, 0.4577},
-	{16.9610, 8.1775, -12.3740, 0.4503},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{19.7848, -3.7773, -11.0931, 0.9416},
-	{19.6048, -2.6055, -10.2806, 0.9521},
-	{20.5771, -6.1904, -9.3752, 0.9221},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-14.3932, 11.6734, 11.3851, 0.7960},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{-16.3901, -13.8265, 1.3407, 0.0777},
-	{-16.0153, -14.2690, 1.5396, 0.0777},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{16.2911, -16.2725, -10.7365, 0.4904},
-	{11.7920, -15.9856, -10.6589, 0.4637},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-11.7922, 3.1514, 5.9367, 0.4478},
-	{-12.6425, 1.6666, 7.9214, 0.4223},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{1.5414, -11.3823, 7.5228, 0.3873},
-	{1.2794, -12.0556, 8.1840, 0.3793},
-	{12.9596, 8.6504, -12.8349, 0.7966},
-	{12.1663, 9.3015, -11.7901, 0.7950},
-	{12.7049, 7.9643, -11.6312, 0.7849},
-	{-10.3399, 8.3952, 17.0063, 0.8775},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{-11.4002, 9.2178, 16.2556, 0.8678},
-	{7.0770, -16.3347, -6.0022, 0.7195},
-	{6.0397, -16.1432, -6.0115, 0.7092},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{12.1663, 9.3015, -11.7901, 0.8155},
-	{12.9596, 8.6504, -12.8349, 0.8274},
-	{12.1583, 9.6234, -12.5125, 0.8201},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-3.9068, 17.0203, 2.7177, 0.1070},
-	{-3.4554, 16.4095, 1.9054, 0.0964},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-14.0775, 11.0124, 13.4161, 0.9665},
-	{-14.4701, 10.7525, 13.6401, 0.9675},
-	{-11.2724, 11.1845, 13.9605, 0.9140},
-	{-12.4648, 11.2918, 15.8110, 0.9160},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{-10.0676, 9.1055, 13.9447, 0.9218},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-8.0148, 9.8406, 10.4461, 0.9169},
-	{17.4212, -12.2115, -10.7803, 0.5002},
-	{15.3529, -14.5875, -13.2144, 0.4666},
-	{15.4346, -13.3692, -12.4358, 0.4692},
-	{-2.9254, -5.9912, 8.0761, 0.8826},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{-5.7258, -3.4623, 10.9865, 0.9231},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{12.9596, 8.6504, -12.8349, 0.7178},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{11.2782, 8.5208, -13.2772, 0.7163},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{-6.9969, -13.3871, -5.6818, 0.2110},
-	{-10.8781, -1.3382, 13.3228, 0.3803},
-	{-12.0306, -0.8041, 12.5914, 0.3841},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.4947, -14.3880, 4.7088, 0.3259},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{4.9971, -7.8016, -4.5740, 0.2924},
-	{4.2656, -6.8950, -5.4206, 0.2925},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{-6.5106, -9.7525, 14.7792, 0.2518},
-	{-5.2140, -10.0014, 17.2077, 0.2563},
-	{-4.2797, -8.7476, 14.4908, 0.2302},
-	{11.6555, -8.0978, -8.5264, 0.5325},
-	{12.2079, -9.3668, -8.0887, 0.5227},
-	{10.5620, -8.4810, -9.6722, 0.5347},
-	{-14.2470, 13.2123, 11.5925, 0.5032},
-	{-14.7201, 14.2626, 11.7241, 0.5021},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{16.8039, -11.6417, -1.7451, 0.0724},
-	{15.6932, -10.2844, -1.9749, 0.0728},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{14.6388, -8.5181, -7.5916, 0.1994},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{13.6551, -10.3289, -8.1256, 0.1770},
-	{-8.0326, 8.5711, 5.6535, 0.5153},
-	{-8.5657, 6.9559, 6.1867, 0.4954},
-	{-7.1312, 6.7927, 7.2440, 0.4932},
-	{-14.0837, -6.8521, 5.7232, 0.0757},
-	{-13.7487, -5.1782, 5.3918, 0.0831},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.8046, -9.8976, -3.1725, 0.2988},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{-14.4826, -11.8072, 1.9673, 0.0928},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{10.3793, -8.0264, -6.3700, 0.6152},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{9.6717, -7.5794, -5.1277, 0.6204},
-	{-5.3487, 17.2728, 0.1648, 0.5832},
-	{-7.3770, 16.6115, -0.9756, 0.5794},
-	{-6.5693, 17.4267, -0.0351, 0.5862},
-	{4.9971, -7.8016, -4.5740, 0.2924},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{-5.9280, 13.3316, -2.6581, 0.5379},
-	{-6.8885, 16.0867, -1.6234, 0.5693},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{-12.8898, 16.6579, 5.0217, 0.9526},
-	{-12.2677, 17.6232, 5.6051, 0.9551},
-	{-5.6919, 17.9576, 7.0778, 0.8718},
-	{-3.1757, 20.1938, 4.8186, 0.9102},
-	{-5.8711, 18.3209, 5.4078, 0.8771},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{-9.4803, 12.3522, 5.2508, 0.9654},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-1.8086, 11.3231, 3.5388, 0.7723},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{-3.3487, -5.8903, -5.8105, 0.5532},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-1.6930, -7.7270, -6.3001, 0.5329},
-	{-3.5188, -14.6504, 12.7860, 0.3393},
-	{-4.8899, -13.6344, 11.3395, 0.3387},
-	{-3.5419, -12.0626, 11.2357, 0.3588},
-	{6.4395, 0.0270, -11.5685, 0.6383},
-	{7.0336, 3.3318, -13.5073, 0.6698},
-	{7.2055, -0.2363, -13.8788, 0.6318},
-	{-2.9592, 0.0691, -5.5000, 0.6077},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{0.2665, -6.4448, 4.9095, 0.4142},
-	{0.1575, -8.3765, 5.6596, 0.4081},
-	{-10.1598, -14.0057, 1.6100, 0.1389},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{-8.4173, -14.9636, 0.2931, 0.1651},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{11.5097, -9.9075, -2.5946, 0.2627},
-	{9.7438, -8.6649, -3.9130, 0.2691},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-1.6805, -14.1400, 13.2937, 0.3375},
-	{-2.5633, -13.8926, 13.4230, 0.3361},
-	{-6.8869, 9.8867, 9.1845, 0.8517},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{-6.9755, 8.8095, 10.9249, 0.8646},
-	{-4.6817, -15.9271, -0.1425, 0.7032},
-	{-4.0728, -16.0338, -0.9999, 0.7059},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-8.4392, 10.5384, -3.0647, 0.7430},
-	{-7.7482, 8.9352, -3.7482, 0.7258},
-	{-9.0086, 10.0854, -1.8344, 0.7399},
-	{-11.7350, -3.6301, 13.7731, 0.3554},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{-14.2898, -11.8803, 4.7141, 0.0757},
-	{-12.3291, -10.8595, 3.7359, 0.1012},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{-4.5776, 6.0464, -1.7322, 0.2346},
-	{-3.6075, 4.8122, -1.5070, 0.2280},
-	{7.0770, -16.3347, -6.0022, 0.7195},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{8.0290, -15.9706, -7.8603, 0.7269},
-	{-6.4163, 12.4426, 9.4236, 0.9039},
-	{-4.6755, 12.7546, 7.1437, 0.8996},
-	{-6.4535, 13.0135, 7.4080, 0.9140},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{11.7920, -15.9856, -10.6589, 0.4637},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-6.3602, 15.5921, -4.9454, 0.0373},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-5.1766, -12.2301, 18.3433, 0.2867},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{15.6765, -16.1947, -7.0332, 0.7990},
-	{9.7830, -16.5711, -10.0824, 0.7315},
-	{16.8963, -16.1990, -6.4198, 0.8077},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{13.4653, -7.4329, 2.5492, 0.1827},
-	{13.4484, -6.3018, 2.1993, 0.1945},
-	{13.4557, -9.2055, -7.4906, 0.1828},
-	{14.6388, -8.5181, -7.5916, 0.1994},
-	{13.6551, -10.3289, -8.1256, 0.1770},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-14.2540, -3.1432, 10.2030, 0.3635},
-	{-14.6137, -6.2262, 10.3488, 0.3302},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{-2.9079, -8.8871, 15.3225, 0.3844},
-	{-3.2380, -8.9673, 16.7662, 0.3800},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{-16.4857, -13.9655, 4.0352, 0.0644},
-	{-17.8252, -14.4751, 3.7252, 0.0687},
-	{-6.5106, -9.7525, 14.7792, 0.4172},
-	{-7.8838, -9.6927, 14.6962, 0.4254},
-	{-7.4540, -11.4096, 14.9506, 0.4162},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{3.4180, -12.2527, -7.1864, 0.2967},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{11.0273, 2.1142, -15.4468, 0.6525},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{-1.2934, -2.9626, 3.4450, 0.8631},
-	{-1.3859, -4.7436, 5.1290, 0.8657},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.1231, -2.1933, 8.5906, 0.0974},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{-10.2581, 12.0264, 3.4608, 0.5257},
-	{-9.4803, 12.3522, 5.2508, 0.5452},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-9.8680, 12.0612, 7.4716, 0.9582},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{-8.2147, -15.1697, 5.5634, 0.6711},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-12.5500, 13.8732, 8.7463, 0.5142},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{12.1583, 9.6234, -12.5125, 0.6694},
-	{11.2782, 8.5208, -13.2772, 0.6579},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{11.1731, -9.1355, -7.1757, 0.6101},
-	{12.2079, -9.3668, -8.0887, 0.6090},
-	{-8.2955, -9.4780, -0.7969, 0.3990},
-	{-5.7302, -10.4307, -3.5717, 0.3871},
-	{-7.2171, -10.9163, -1.8646, 0.3851},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{15.6218, 0.5147, -10.3690, 0.8751},
-	{17.7778, -2.6473, -7.5944, 0.8494},
-	{-10.0676, 9.1055, 13.9447, 0.9218},
-	{-11.4002, 9.2178, 16.2556, 0.9251},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-3.8425, 14.2969, -1.9023, 0.5460},
-	{-3.4391, 12.8762, -2.6620, 0.5304},
-	{-6.8869, 9.8867, 9.1845, 0.9122},
-	{-11.9456, 8.8136, 7.3754, 0.8693},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-14.2719, 13.2783, 17.7108, 0.9453},
-	{-13.8602, 12.2784, 17.5724, 0.9401},
-	{-13.3308, 12.3683, 16.9123, 0.9401},
-	{7.3495, -7.8825, -3.7080, 0.2864},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{2.3086, -13.7723, -14.6913, 0.3294},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{3.5036, -12.9985, -16.0544, 0.3353},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{-12.5500, 13.8732, 8.7463, 0.5142},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-3.2417, -14.8505, 8.1421, 0.7259},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{2.3636, -15.4110, 8.8535, 0.3468},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{0.8645, -10.4892, 6.9072, 0.3948},
-	{2.2477, -9.9399, 7.1613, 0.3839},
-	{1.6623, -9.5868, 6.0928, 0.3910},
-	{-8.2147, -15.1697, 5.5634, 0.6711},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-7.4131, -14.9587, 7.6645, 0.6798},
-	{17.0896, -9.3267, -2.6090, 0.8143},
-	{17.8094, -7.3121, -4.0477, 0.8272},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{9.3147, 11.2893, -9.6355, 0.7750},
-	{9.6256, 12.3425, -10.3036, 0.7785},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{-7.8645, -11.8165, -3.2458, 0.2013},
-	{-7.4731, -11.2242, -4.6073, 0.2130},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{9.8295, -12.5934, -1.1503, 0.0610},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{-7.0645, 21.8360, 1.3711, 0.8689},
-	{-6.4854, 22.2496, 1.8210, 0.8633},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-5.9360, -14.0109, 11.8411, 0.6981},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{13.4653, -7.4329, 2.5492, 0.1827},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{13.4484, -6.3018, 2.1993, 0.1945},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-11.1145, 13.6920, 1.3257, 0.7815},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-3.6075, 4.8122, -1.5070, 0.2416},
-	{-3.4096, 5.8519, -1.9252, 0.2560},
-	{-13.2640, 11.0752, 12.2144, 0.9663},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{18.7331, -3.8729, -12.5950, 0.6190},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{18.8393, -7.2961, -11.5697, 0.5851},
-	{-12.1633, 15.7950, 15.7030, 0.5370},
-	{-11.8417, 15.0608, 15.9355, 0.5409},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{7.1357, -13.0246, 2.9627, 0.0432},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{17.3238, 9.8524, -13.2363, 0.3195},
-	{13.5400, 3.1643, -13.8915, 0.6593},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{-3.0163, 8.7605, 2.8960, 0.2497},
-	{-4.2732, 8.4109, 5.3970, 0.2307},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{5.6695, 13.0500, -8.3983, 0.6018},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{4.9641, 13.0677, -8.4608, 0.5958},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{14.6487, -14.4410, -1.5320, 0.0429},
-	{-7.2512, -13.0756, 13.3614, 0.2976},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{-7.9735, -11.3649, 13.7875, 0.2795},
-	{-12.8920, 19.6497, 14.0500, 0.6361},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{2.7654, 5.6035, -0.0047, 0.1542},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-5.3487, 17.2728, 0.1648, 0.1389},
-	{3.8734, 6.9597, -0.9593, 0.1680},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{2.7654, 5.6035, -0.0047, 0.1542},
-	{8.2491, 5.1440, -14.7678, 0.6833},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{12.2605, -3.7441, 0.7837, 0.2124},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{7.2311, -6.7954, -13.7344, 0.3467},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{6.7415, -7.6320, -14.1992, 0.3485},
-	{13.8072, 3.9167, -12.0851, 0.9113},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{11.2181, 10.7934, -11.8837, 0.8047},
-	{-14.8154, 10.6544, 18.2212, 0.8022},
-	{-14.8421, 11.2524, 18.0801, 0.7955},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{11.8405, -7.6519, 0.6353, 0.1804},
-	{11.8792, -9.2179, 1.6064, 0.1485},
-	{12.7972, -7.2130, 1.5698, 0.1873},
-	{-5.7272, 21.8698, 1.0093, 0.8659},
-	{-5.8577, 20.5844, 1.1279, 0.8787},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{11.6827, -4.4620, -0.7342, 0.2189},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{-7.9851, 18.2976, 1.7329, 0.8971},
-	{-8.6739, 17.5264, 0.4775, 0.8976},
-	{-9.7649, 17.7221, 1.9883, 0.9112},
-	{6.1296, -14.3129, 2.8526, 0.0323},
-	{5.5430, -15.0901, 1.9390, 0.0317},
-	{7.0343, -14.3935, 3.1022, 0.0312},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-15.6423, 9.2485, 14.3285, 0.8151},
-	{-16.7826, 9.0543, 15.6327, 0.8072},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-14.1231, -2.1933, 8.5906, 0.0974},
-	{-13.4539, -0.1193, 8.9642, 0.1168},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{13.0597, -4.0224, -11.0636, 0.5821},
-	{11.4715, -6.9738, -9.8564, 0.5492},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{19.6048, -2.6055, -10.2806, 0.8542},
-	{18.1539, -0.2898, -12.6066, 0.8738},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{20.7836, 6.2748, -15.7469, 0.4051},
-	{19.3552, 7.1245, -15.1128, 0.4168},
-	{19.5309, 6.9339, -14.4090, 0.4183},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{13.7823, -12.6365, -11.1707, 0.4533},
-	{14.2918, -11.8568, -9.7028, 0.4623},
-	{6.4971, 3.8652, -12.7361, 0.8777},
-	{6.5974, 1.7343, -11.0098, 0.8552},
-	{6.2632, 3.1052, -10.7167, 0.8696},
-	{-11.0690, 16.0556, 1.8443, 0.8062},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{-10.5027, 17.4226, -1.1235, 0.8231},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-11.0367, 14.4451, 9.0236, 0.5306},
-	{-12.5500, 13.8732, 8.7463, 0.5142},
-	{5.8920, -12.9118, 1.0752, 0.0292},
-	{6.0408, -12.2147, -0.1022, 0.0312},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{17.4212, -12.2115, -10.7803, 0.5308},
-	{17.6724, -7.9110, -11.2655, 0.5755},
-	{-4.9357, 20.1317, 0.2527, 0.8863},
-	{-2.3956, 20.9802, -3.5110, 0.8975},
-	{-3.0351, 20.7927, -4.1365, 0.9026},
-	{-14.0775, 11.0124, 13.4161, 0.7900},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{-14.4701, 10.7525, 13.6401, 0.7907},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{-7.5222, -5.7208, 13.5055, 0.4611},
-	{-4.8620, 8.5587, 6.0390, 0.2253},
-	{-7.1312, 6.7927, 7.2440, 0.1986},
-	{-5.6730, 7.1143, 6.8094, 0.2080},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-7.7815, 12.5430, 7.2711, 0.9366},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-7.4540, -11.4096, 14.9506, 0.4162},
-	{-7.8838, -9.6927, 14.6962, 0.4254},
-	{-7.9735, -11.3649, 13.7875, 0.4256},
-	{15.1046, 1.7508, -14.9670, 0.5830},
-	{15.2447, -1.2590, -13.5010, 0.5522},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{5.8119, 4.4519, -11.7949, 0.5763},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{6.4971, 3.8652, -12.7361, 0.5861},
-	{-7.3770, 16.6115, -0.9756, 0.0812},
-	{-6.8885, 16.0867, -1.6234, 0.0682},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{6.7492, -13.6822, 3.4298, 0.0417},
-	{7.0343, -14.3935, 3.1022, 0.0400},
-	{3.4625, -13.7837, 5.8327, 0.3479},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{12.6484, 6.0254, -13.9383, 0.6892},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{-4.4560, -3.6123, -3.3509, 0.5908},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{-2.9592, 0.0691, -5.5000, 0.6077},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{16.7603, -15.9094, -11.8002, 0.4846},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{4.9971, -7.8016, -4.5740, 0.7456},
-	{6.2600, -8.5717, -3.7011, 0.7428},
-	{-5.9372, 10.1045, -6.6120, 0.0026},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-6.3928, 9.7681, -6.3590, 0.0018},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{6.4857, -8.3881, -2.6518, 0.2860},
-	{7.1957, -8.4780, -1.2066, 0.2703},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{12.2527, -16.0877, -2.5494, 0.2893},
-	{11.3671, -14.2139, -1.2936, 0.2827},
-	{10.0313, -14.8641, -1.8649, 0.2859},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{16.8963, -16.1990, -6.4198, 0.0669},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{8.3087, -6.7818, -13.5410, 0.5642},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{7.3495, -7.8825, -3.7080, 0.2864},
-	{6.4857, -8.3881, -2.6518, 0.2860},
-	{18.1539, -0.2898, -12.6066, 0.9639},
-	{19.6048, -2.6055, -10.2806, 0.9521},
-	{19.7848, -3.7773, -11.0931, 0.9416},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{-11.3339, -7.6051, 14.4357, 0.3174},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{-13.7070, -9.3744, 12.3304, 0.3012},
-	{8.2621, 1.8440, -7.1220, 0.8530},
-	{6.8583, 2.2363, -8.9013, 0.8582},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{-6.2107, 9.9377, -2.6858, 0.0110},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-5.8695, -2.3683, 3.3816, 0.1370},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{-5.6419, -0.8683, 2.5663, 0.1553},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{1.0083, -13.8803, 4.3449, 0.3265},
-	{0.3898, -14.4096, 4.7748, 0.3258},
-	{-4.5626, 13.6823, 7.1706, 0.5958},
-	{-6.4535, 13.0135, 7.4080, 0.5812},
-	{-4.6755, 12.7546, 7.1437, 0.5956},
-	{5.9169, -12.4713, 1.9970, 0.0354},
-	{5.8920, -12.9118, 1.0752, 0.0338},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{-9.1270, 8.9055, 4.7912, 0.8756},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-10.8485, 12.1959, 14.8625, 0.9068},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-8.6639, -5.6106, 2.4701, 0.4386},
-	{-9.2074, 8.0057, 1.9418, 0.2270},
-	{-8.8486, 8.0071, 0.5674, 0.2321},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{6.0408, -12.2147, -0.1022, 0.0312},
-	{6.6090, -12.7314, 0.6271, 0.0325},
-	{6.6938, -12.3714, -1.3408, 0.0311},
-	{-7.9911, -14.1694, 12.0448, 0.2384},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-9.7077, -15.0751, 10.4995, 0.2344},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-16.7826, 9.0543, 15.6327, 0.8072},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-12.2157, 15.2600, 11.1469, 0.5271},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{-15.3480, 14.3281, 9.2437, 0.4848},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-12.0712, 1.7544, 9.7387, 0.4162},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{1.6623, -9.5868, 6.0928, 0.3910},
-	{2.2477, -9.9399, 7.1613, 0.3839},
-	{-5.7356, -0.1872, 1.5612, 0.1649},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-5.2023, 0.8105, 1.4140, 0.1749},
-	{16.4153, -7.7792, -8.8455, 0.2147},
-	{16.9335, -8.6897, -9.8031, 0.2072},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{-8.6392, 15.8281, 14.3538, 0.5663},
-	{-9.4989, 15.6880, 15.2625, 0.5579},
-	{-7.2728, 15.1755, 12.1963, 0.5783},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{-8.8358, 16.4585, 12.7067, 0.5831},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{4.9673, -14.9897, -0.2152, 0.0282},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{-1.8680, 17.5140, 2.2906, 0.8301},
-	{-3.3950, 17.5301, 4.0116, 0.8202},
-	{-1.9473, 17.2903, 3.4253, 0.8207},
-	{-11.9356, 18.1080, 17.5606, 0.6207},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{-12.7068, 19.1305, 16.2419, 0.6372},
-	{-3.1424, -2.1742, 1.2848, 0.8830},
-	{-3.7290, -2.4292, 1.7046, 0.8900},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{-14.9160, 12.0514, 14.8918, 0.7874},
-	{-15.4862, 11.8869, 14.3393, 0.7910},
-	{-11.0354, -9.4953, 14.4719, 0.3000},
-	{-11.3339, -7.6051, 14.4357, 0.3174},
-	{-13.7070, -9.3744, 12.3304, 0.3012},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{6.8035, 10.6094, -12.1665, 0.6164},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-10.5628, 7.9757, 3.4591, 0.8401},
-	{-7.5222, -5.7208, 13.5055, 0.0659},
-	{-6.9060, -3.5212, 12.3504, 0.0889},
-	{-9.8863, -3.6202, 14.1223, 0.0725},
-	{12.0129, -5.9750, -2.1689, 0.2289},
-	{12.0344, -5.9644, -2.1240, 0.2286},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{10.8335, 11.4811, -11.1021, 0.7945},
-	{11.2181, 10.7934, -11.8837, 0.8047},
-	{11.0841, 11.4103, -12.0361, 0.8006},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{-4.6530, 17.9187, -0.6715, 0.1429},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{10.5673, 4.1132, -5.9404, 0.7320},
-	{9.7517, 2.8258, -6.1310, 0.7167},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.5071, -14.6809, 4.7707, 0.3252},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{17.4212, -12.2115, -10.7803, 0.5002},
-	{17.5388, -13.6704, -10.4353, 0.5027},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{-8.6639, -5.6106, 2.4701, 0.4386},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-9.6771, -6.4746, 1.4750, 0.4222},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{3.8133, -10.9201, -11.3600, 0.3164},
-	{2.2925, -11.3431, -11.5562, 0.3208},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{1.8234, -9.7317, -2.3379, 0.3857},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{14.8098, -2.5640, -10.6530, 0.9874},
-	{15.4950, -5.0714, -9.6367, 0.9785},
-	{16.0250, -4.7052, -8.5821, 0.9710},
-	{-11.0064, 18.0806, 5.3000, 0.9440},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-2.1208, -13.0904, 15.2665, 0.3380},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-2.1505, -12.2722, 14.8450, 0.3442},
-	{0.5071, -14.6809, 4.7707, 0.3252},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-2.9079, -8.8871, 15.3225, 0.3844},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{-3.2380, -8.9673, 16.7662, 0.3800},
-	{4.2656, -6.8950, -5.4206, 0.2925},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{5.4958, 2.7254, -8.0001, 0.6645},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{1.5287, 8.0947, -9.6845, 0.5536},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{-7.5287, 9.6045, 12.3147, 0.8764},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{-5.2023, 0.8105, 1.4140, 0.1914},
-	{-4.7145, 1.0246, 0.9529, 0.1977},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{2.2102, -2.8264, 1.9789, 0.0696},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{-4.2684, -13.2530, -3.7415, 0.3517},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{-5.2963, -14.6150, -2.5473, 0.3320},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-8.3005, -8.7975, 14.1086, 0.4347},
-	{-7.8838, -9.6927, 14.6962, 0.4254},
-	{12.1656, -16.3635, -14.3949, 0.4451},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{6.4376, 13.1912, -9.4032, 0.6132},
-	{5.6695, 13.0500, -8.3983, 0.6018},
-	{6.8810, 13.3788, -8.8553, 0.6145},
-	{-17.3025, -13.4300, 6.0066, 0.0430},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-17.1632, -14.0962, 6.0941, 0.0404},
-	{-4.2684, -13.2530, -3.7415, 0.2326},
-	{-5.2963, -14.6150, -2.5473, 0.2133},
-	{-6.0807, -16.0401, -2.8046, 0.2030},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{6.8583, 2.2363, -8.9013, 0.6850},
-	{7.7965, 3.1330, -6.9403, 0.6859},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{-11.8199, 11.7743, 16.7667, 0.9057},
-	{-12.4648, 11.2918, 15.8110, 0.9160},
-	{-13.3308, 12.3683, 16.9123, 0.9122},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{-8.0651, -6.7623, 0.6161, 0.4252},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-8.8689, -8.2056, -0.2558, 0.4066},
-	{7.6872, -13.4907, -2.3808, 0.2881},
-	{6.2106, -12.4636, -3.2128, 0.2937},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{4.3563, 2.0278, -7.9927, 0.5156},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{-3.1260, 13.4372, 0.7263, 0.0641},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{-3.7872, 13.2210, -0.6716, 0.0538},
-	{-3.2380, -8.9673, 16.7662, 0.3800},
-	{-3.6688, -9.8199, 17.8896, 0.3740},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{-9.6771, -6.4746, 1.4750, 0.4222},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-8.0651, -6.7623, 0.6161, 0.4252},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{13.4484, -6.3018, 2.1993, 0.1945},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{12.2882, -6.7028, 1.6119, 0.2020},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{19.0091, -6.1027, -4.9983, 0.1305},
-	{18.4060, -9.9136, -2.8495, 0.0969},
-	{-7.8039, 8.7067, -1.8271, 0.7201},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{-7.7482, 8.9352, -3.7482, 0.7258},
-	{-15.6423, 9.2485, 14.3285, 0.8151},
-	{-14.8154, 10.6544, 18.2212, 0.8022},
-	{-16.2533, 10.0287, 16.8532, 0.8050},
-	{-7.2361, -3.4140, 3.4502, 0.4633},
-	{-6.3176, -3.5979, 3.2811, 0.4674},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{3.5957, -12.6132, -13.9383, 0.3249},
-	{3.5467, -12.1224, -13.2989, 0.3250},
-	{4.2351, -11.6789, -14.7300, 0.3341},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{5.1374, 2.4670, -4.6470, 0.5057},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{2.9304, 12.4364, -6.1754, 0.6944},
-	{2.8918, 11.5702, -5.6655, 0.6948},
-	{-12.4106, 15.9474, 16.4255, 0.5365},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{-12.1633, 15.7950, 15.7030, 0.5370},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{20.6673, 9.3354, -14.9361, 0.3078},
-	{19.3552, 7.1245, -15.1128, 0.2855},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{-7.4731, -11.2242, -4.6073, 0.2130},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{13.5460, 7.7707, -13.1546, 0.7878},
-	{12.7049, 7.9643, -11.6312, 0.7849},
-	{13.5308, 7.0843, -13.0842, 0.7820},
-	{-3.2580, -11.8695, 10.2641, 0.3197},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-3.5419, -12.0626, 11.2357, 0.3295},
-	{-13.2004, 17.3741, 6.3688, 0.9677},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{-12.2677, 17.6232, 5.6051, 0.9551},
-	{-10.7215, 10.6147, 13.3614, 0.9302},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-11.2724, 11.1845, 13.9605, 0.9353},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{14.0754, -9.6989, 0.1312, 0.1523},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{-12.3609, 15.5518, 8.4093, 0.6267},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{9.1599, -1.9722, -5.5275, 0.6693},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{4.6125, -13.6330, -16.4045, 0.3486},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{-12.2912, -13.8790, 5.4687, 0.6239},
-	{-11.3900, -13.1882, 3.0702, 0.6276},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{8.3254, 6.7137, -14.6254, 0.6244},
-	{8.2491, 5.1440, -14.7678, 0.6112},
-	{6.2864, 6.7230, -13.4818, 0.5998},
-	{11.7920, -15.9856, -10.6589, 0.4637},
-	{10.0827, -15.0745, -11.7295, 0.4311},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{12.9097, 5.1491, -7.8942, 0.7470},
-	{12.2625, 2.6827, -6.9473, 0.7224},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{5.4030, -11.8653, -14.4697, 0.3470},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{5.0484, -12.1720, -15.4119, 0.3452},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{-5.6013, -7.4408, -3.5952, 0.2626},
-	{-4.2438, -5.4002, -4.8993, 0.2843},
-	{-4.9385, -6.0655, -5.4775, 0.2773},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-10.5867, 12.4049, 1.9497, 0.5043},
-	{1.5414, -11.3823, 7.5228, 0.3872},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{0.8645, -10.4892, 6.9072, 0.3948},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{-2.0292, 12.1267, 3.1993, 0.7806},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{5.6695, 13.0500, -8.3983, 0.6018},
-	{6.4376, 13.1912, -9.4032, 0.6132},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{-10.7255, 13.2299, 5.2475, 0.5248},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{12.0794, -2.9569, -2.4757, 0.2165},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-9.1388, 9.0247, 5.0866, 0.8768},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-4.2684, -13.2530, -3.7415, 0.2326},
-	{-6.1507, -16.1783, -4.5976, 0.2074},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{13.2761, -1.6414, 0.4335, 0.2115},
-	{17.5388, -13.6704, -10.4353, 0.1096},
-	{18.5374, -14.4576, -7.1385, 0.0911},
-	{16.6912, -15.2830, -9.9006, 0.0878},
-	{18.0389, 10.1497, -13.3565, 0.3229},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{17.3238, 9.8524, -13.2363, 0.3195},
-	{-6.2107, 9.9377, -2.6858, 0.0110},
-	{-6.8149, 9.0396, -2.3429, 0.0057},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-9.1407, 3.1817, 10.6449, 0.4348},
-	{-8.7441, 4.4453, 9.4249, 0.4563},
-	{-10.1421, 3.4889, 10.0141, 0.4368},
-	{4.3121, 12.9834, -7.4063, 0.5861},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{-9.3935, 7.0172, 4.6010, 0.5006},
-	{-8.7774, 8.6926, 3.9697, 0.5200},
-	{-9.2074, 8.0057, 1.9418, 0.5132},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{15.4431, -9.5359, -2.9302, 0.8005},
-	{13.4557, -9.2055, -7.4906, 0.7920},
-	{4.1510, 0.9721, -1.0348, 0.1115},
-	{4.7116, 3.4303, -1.4022, 0.1377},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{-6.1699, 9.7728, 7.3287, 0.8479},
-	{-4.8594, 9.0884, 7.4120, 0.8598},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{13.3151, -8.8095, 2.1959, 0.1636},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{0.3345, 8.3465, -7.6945, 0.5390},
-	{1.5287, 8.0947, -9.6845, 0.5536},
-	{0.3812, 5.6803, -9.0451, 0.5309},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{5.3288, -10.1704, -12.9107, 0.5344},
-	{4.5081, -10.1702, -12.2700, 0.5313},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-14.3277, 18.9486, 13.8145, 0.6491},
-	{-15.6712, 18.9649, 14.5346, 0.6617},
-	{-3.1757, 20.1938, 4.8186, 0.8230},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-2.9525, 20.3107, 3.3361, 0.8352},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{12.8717, -0.1663, -2.2988, 0.2168},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.4341, -7.2520, -10.4022, 0.7607},
-	{3.1266, -9.8244, -9.9774, 0.7347},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.7238, 13.2526, 5.3022, 0.5253},
-	{-16.7826, 9.0543, 15.6327, 0.8072},
-	{-16.2533, 10.0287, 16.8532, 0.8050},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-1.6048, 9.9904, 0.9322, 0.8282},
-	{-1.8606, 9.5197, 1.6317, 0.8198},
-	{-2.5806, 9.5378, 1.6786, 0.8181},
-	{12.2079, -9.3668, -8.0887, 0.6090},
-	{11.6555, -8.0978, -8.5264, 0.6199},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{-6.8507, -14.4578, 14.6365, 0.3034},
-	{-7.0339, -12.9896, 15.9542, 0.2882},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{7.0576, -14.8434, 4.6898, 0.0425},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.7425, -5.6727, -2.1637, 0.2275},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{-12.7068, 19.1305, 16.2419, 0.6372},
-	{-12.5453, 18.5223, 15.2560, 0.6312},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-6.4854, 22.2496, 1.8210, 0.1955},
-	{-6.7421, 18.9786, 3.8471, 0.1667},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-6.2107, 9.9377, -2.6858, 0.5023},
-	{-5.6394, 11.2143, -2.7466, 0.5161},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{-5.3487, 17.2728, 0.1648, 0.1389},
-	{-2.9079, -8.8871, 15.3225, 0.3844},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{17.6724, -7.9110, -11.2655, 0.5755},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{-10.6244, 18.6519, 10.0182, 0.5941},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-14.2559, 14.5942, 11.9472, 0.5071},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{-0.2912, 2.7386, -8.6407, 0.6119},
-	{0.8369, 3.9820, -9.5500, 0.6111},
-	{0.5962, 1.1958, -9.0417, 0.5931},
-	{-10.1421, 3.4889, 10.0141, 0.4368},
-	{-8.7441, 4.4453, 9.4249, 0.4563},
-	{-10.9998, 4.0259, 7.8484, 0.4487},
-	{13.4178, -4.5192, 1.6616, 0.2052},
-	{13.2761, -1.6414, 0.4335, 0.2115},
-	{13.1134, -3.4813, 0.7268, 0.2101},
-	{-7.6342, 9.4864, 7.2458, 0.9006},
-	{-6.8869, 9.8867, 9.1845, 0.9122},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{-11.8199, 11.7743, 16.7667, 0.9057},
-	{-8.3283, 18.5141, -2.4574, 0.0973},
-	{-8.6739, 17.5264, 0.4775, 0.1005},
-	{-8.2290, 16.8279, -1.5123, 0.0853},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{-3.4554, 16.4095, 1.9054, 0.8878},
-	{-1.7488, 15.0511, 0.4650, 0.8851},
-	{-3.1260, 13.4372, 0.7263, 0.8641},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{-13.5994, 11.0540, 11.8702, 0.7938},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{10.9563, 2.9436, -3.8503, 0.2248},
-	{11.5884, -1.8662, -3.3455, 0.2166},
-	{10.6709, -0.9026, -2.6175, 0.2174},
-	{-7.7815, 12.5430, 7.2711, 0.9248},
-	{-8.2512, 11.6577, 9.3403, 0.9182},
-	{-6.4535, 13.0135, 7.4080, 0.9140},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.1388, 9.0247, 5.0866, 0.8768},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-9.4342, 17.9511, 0.6917, 0.1117},
-	{-9.7649, 17.7221, 1.9883, 0.1142},
-	{-8.6739, 17.5264, 0.4775, 0.1005},
-	{-5.6884, -10.9949, -5.3392, 0.2294},
-	{-6.3457, -11.3748, -5.9058, 0.2234},
-	{-7.4731, -11.2242, -4.6073, 0.2130},
-	{3.1266, -9.8244, -9.9774, 0.7347},
-	{3.4341, -7.2520, -10.4022, 0.7607},
-	{4.4434, -6.3544, -12.2300, 0.7627},
-	{5.6695, 13.0500, -8.3983, 0.6018},
-	{4.9641, 13.0677, -8.4608, 0.5958},
-	{5.3257, 13.4761, -7.8679, 0.5974},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{-13.0739, 13.1598, 5.2124, 0.6390},
-	{-14.3858, 14.0698, 7.8485, 0.6517},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{15.1351, -7.1622, 0.4560, 0.1877},
-	{11.2782, 8.5208, -13.2772, 0.7163},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{9.9077, 7.5246, -14.5226, 0.7074},
-	{-8.6669, 16.8675, -2.0938, 0.8156},
-	{-9.7932, 15.9822, -0.5432, 0.8058},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-2.9906, -12.7535, 17.1323, 0.3083},
-	{-3.8338, -11.1945, 17.8398, 0.2913},
-	{-4.1140, -12.9082, 17.9578, 0.2986},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-1.9473, 17.2903, 3.4253, 0.8207},
-	{-2.9562, 16.2011, 4.5165, 0.8033},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{-0.8757, -13.8952, -1.8687, 0.3462},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{6.2015, -14.7169, -16.2630, 0.3662},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{-7.9645, 18.8758, 2.9852, 0.9073},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-9.7587, 8.1353, 1.7902, 0.8561},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-10.7867, 8.0620, 2.9362, 0.8537},
-	{-1.2881, -14.4745, 6.9149, 0.3160},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{12.7049, 7.9643, -11.6312, 0.7849},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{13.5308, 7.0843, -13.0842, 0.7820},
-	{-12.8644, 18.7133, 14.5109, 0.6352},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-12.8920, 19.6497, 14.0500, 0.6361},
-	{16.4153, -7.7792, -8.8455, 0.2147},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{15.6815, -6.6533, -8.6324, 0.2201},
-	{6.4395, 0.0270, -11.5685, 0.8380},
-	{5.8641, -1.9685, -7.5838, 0.8088},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{-6.8885, 16.0867, -1.6234, 0.5693},
-	{-7.3770, 16.6115, -0.9756, 0.5794},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{-11.8749, 9.5391, 19.4097, 0.8836},
-	{-11.2562, 9.6756, 18.9114, 0.8844},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{-9.2443, -3.8060, 2.9851, 0.4482},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-8.6639, -5.6106, 2.4701, 0.4386},
-	{-6.4156, 16.9751, -6.7188, 0.0351},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-5.9204, 16.9396, -6.5831, 0.0342},
-	{14.6388, -8.5181, -7.5916, 0.8051},
-	{13.4557, -9.2055, -7.4906, 0.7920},
-	{15.4431, -9.5359, -2.9302, 0.8005},
-	{-9.4951, 12.1110, 7.0498, 0.9572},
-	{-9.8615, 12.0495, 7.4529, 0.9586},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-6.1507, -16.1783, -4.5976, 0.2074},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{9.9077, 7.5246, -14.5226, 0.7074},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{8.3254, 6.7137, -14.6254, 0.6990},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-1.9301, -11.4960, 13.2052, 0.3545},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{15.4004, -7.5823, -8.0173, 0.2089},
-	{15.8287, -9.0444, -8.1414, 0.1997},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{-8.2512, 11.6577, 9.3403, 0.9182},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-12.0712, 1.7544, 9.7387, 0.4162},
-	{-13.4539, -0.1193, 8.9642, 0.3989},
-	{14.6388, -8.5181, -7.5916, 0.1994},
-	{15.4004, -7.5823, -8.0173, 0.2089},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{5.6983, -13.3486, -13.6142, 0.3123},
-	{4.2327, -14.5406, -15.7300, 0.3292},
-	{6.0478, -14.7572, -15.3357, 0.3168},
-	{-16.7748, -12.8433, 3.4249, 0.0660},
-	{-17.8252, -14.4751, 3.7252, 0.0687},
-	{-16.4857, -13.9655, 4.0352, 0.0644},
-	{16.5977, 8.6787, -13.2350, 0.3090},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{15.7333, 9.3575, -12.3397, 0.3064},
-	{5.8920, -12.9118, 1.0752, 0.0338},
-	{5.9169, -12.4713, 1.9970, 0.0354},
-	{6.6090, -12.7314, 0.6271, 0.0375},
-	{-9.3756, 13.4800, -1.2327, 0.7774},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{-12.8302, -13.6642, 6.5080, 0.2382},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{-13.4628, -12.9480, 7.0929, 0.2487},
-	{-10.6823, 9.2650, 4.7444, 0.8651},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{-11.9456, 8.8136, 7.3754, 0.8693},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{10.0425, -5.4472, -6.0778, 0.6386},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{-12.9679, 19.7861, 13.2026, 0.6355},
-	{-12.0568, 18.9575, 14.5718, 0.6281},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{9.8342, 12.3775, -11.2897, 0.6468},
-	{10.1601, 11.8141, -11.3540, 0.6495},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{-11.4139, -5.2576, 14.4202, 0.3412},
-	{-12.9262, -4.7566, 13.4325, 0.3446},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{20.1509, -4.4673, -7.9739, 0.9321},
-	{20.5771, -6.1904, -9.3752, 0.9221},
-	{19.6048, -2.6055, -10.2806, 0.9521},
-	{-6.3176, -3.5979, 3.2811, 0.1333},
-	{-7.2361, -3.4140, 3.4502, 0.1282},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{-8.0148, 9.8406, 10.4461, 0.8509},
-	{-8.6119, 8.9229, 13.4800, 0.8719},
-	{-10.0676, 9.1055, 13.9447, 0.8641},
-	{-5.6286, 18.2818, 2.8314, 0.1188},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-5.1697, 17.6683, 1.8463, 0.1062},
-	{15.3068, -1.7497, -10.4899, 0.8577},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.1802, -0.9937, -11.1230, 0.8713},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-9.3263, 11.9291, 9.7207, 0.9404},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-1.3049, -13.0380, 13.3464, 0.3427},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-0.8878, -13.2520, 14.3993, 0.3406},
-	{-14.2540, -3.1432, 10.2030, 0.0775},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.6137, -6.2262, 10.3488, 0.0543},
-	{-2.0730, 13.6539, 0.4205, 0.8700},
-	{0.2163, 13.8998, -0.9935, 0.8774},
-	{0.0272, 13.3004, -0.8503, 0.8735},
-	{10.6705, -6.3049, -7.0521, 0.6345},
-	{10.3793, -8.0264, -6.3700, 0.6152},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-6.3773, 21.0174, 0.5830, 0.8768},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{5.5093, -10.8981, -14.2069, 0.3446},
-	{4.2351, -11.6789, -14.7300, 0.3329},
-	{0.0567, 10.7976, -4.1568, 0.6977},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-0.6178, 8.8296, -3.3505, 0.6917},
-	{-6.4163, 12.4426, 9.4236, 0.9039},
-	{-4.5353, 10.3089, 7.1983, 0.8750},
-	{-4.6755, 12.7546, 7.1437, 0.8996},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{11.8280, 2.1740, -2.6673, 0.2222},
-	{11.8568, 2.4786, -3.5084, 0.2232},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-13.0739, 13.1598, 5.2124, 0.6390},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-5.1566, -7.8780, 13.1179, 0.4234},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{-14.1231, -2.1933, 8.5906, 0.0974},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-9.0450, 19.0239, 8.0409, 0.9499},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-16.1453, 13.8767, 19.0847, 0.9486},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-16.2789, 13.4436, 19.3009, 0.9487},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{2.9738, -13.4960, 8.5257, 0.3585},
-	{-7.7625, 17.8735, 10.9254, 0.5685},
-	{-9.4637, 18.1300, 10.8893, 0.5836},
-	{-8.3499, 17.2083, 10.7745, 0.5724},
-	{17.7778, -2.6473, -7.5944, 0.9582},
-	{17.8094, -7.3121, -4.0477, 0.9168},
-	{19.0091, -6.1027, -4.9983, 0.9236},
-	{-7.7815, 12.5430, 7.2711, 0.9366},
-	{-9.5700, 12.0890, 7.6255, 0.9547},
-	{-9.9040, 12.0078, 7.7336, 0.9562},
-	{-5.6394, 11.2143, -2.7466, 0.5161},
-	{-6.0329, 10.6207, -3.5943, 0.5194},
-	{-5.9280, 13.3316, -2.6581, 0.5379},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{-6.4807, -12.2114, 17.2308, 0.2805},
-	{-7.0339, -12.9896, 15.9542, 0.2882},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{2.7397, -6.6878, 0.9006, 0.3924},
-	{1.7685, -9.9121, 2.7283, 0.3562},
-	{14.8098, -2.5640, -10.6530, 0.5306},
-	{16.6136, -3.8818, -12.8358, 0.5299},
-	{16.3969, -5.8303, -10.0012, 0.5212},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-1.6639, 3.9319, -0.8641, 0.1484},
-	{-2.7771, 3.5188, -0.9287, 0.1454},
-	{-0.1145, -10.0834, 6.1052, 0.4065},
-	{0.8645, -10.4892, 6.9072, 0.3948},
-	{0.2773, -10.0645, 5.6429, 0.4054},
-	{-15.0219, 17.8180, 12.9105, 0.6557},
-	{-15.9215, 16.1249, 11.5135, 0.6668},
-	{-16.4007, 17.7258, 12.8735, 0.6674},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-4.8539, -15.0859, 16.0388, 0.3114},
-	{-6.1972, -15.0670, 14.5235, 0.3101},
-	{-9.8822, 12.0268, 7.3008, 0.9592},
-	{-9.9132, 11.9953, 7.3752, 0.9591},
-	{-10.0703, 12.1059, 7.3364, 0.9600},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{19.3769, 3.7909, -15.6460, 0.2500},
-	{18.4667, 3.7664, -15.0333, 0.2444},
-	{13.4557, -9.2055, -7.4906, 0.7920},
-	{12.2079, -9.3668, -8.0887, 0.7810},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{0.1807, 14.3208, 0.0519, 0.8239},
-	{-1.7488, 15.0511, 0.4650, 0.8306},
-	{-15.4082, 13.3557, 18.9306, 0.9481},
-	{-16.2789, 13.4436, 19.3009, 0.9487},
-	{-15.9663, 12.9154, 17.5072, 0.9513},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-5.6730, 7.1143, 6.8094, 0.2080},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{-15.0406, -14.2704, 5.7139, 0.0275},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-15.7588, -13.7484, 6.1398, 0.0378},
-	{-6.5693, 17.4267, -0.0351, 0.5862},
-	{-7.3770, 16.6115, -0.9756, 0.5794},
-	{-8.6739, 17.5264, 0.4775, 0.5999},
-	{-3.5671, 8.8851, -2.4176, 0.0076},
-	{-3.7684, 9.8448, -2.6950, 0.0122},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{-1.9112, -11.1936, 12.5903, 0.3569},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{8.7774, 12.6658, -10.4472, 0.6368},
-	{9.8342, 12.3775, -11.2897, 0.6468},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{-4.2002, 2.5427, -0.0851, 0.2171},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-4.5269, 1.9740, 0.5355, 0.2076},
-	{-1.4820, -13.0582, 15.1007, 0.3397},
-	{-0.8878, -13.2520, 14.3993, 0.3406},
-	{-1.4693, -12.3000, 14.3852, 0.3455},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{-6.4535, 13.0135, 7.4080, 0.9140},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{-6.4163, 12.4426, 9.4236, 0.9039},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{3.4180, -12.2527, -7.1864, 0.2967},
-	{3.1266, -9.8244, -9.9774, 0.2891},
-	{14.1802, -0.9937, -11.1230, 0.8713},
-	{14.0153, -1.8870, -11.2939, 0.8648},
-	{14.8098, -2.5640, -10.6530, 0.8545},
-	{-11.4002, 9.2178, 16.2556, 0.9251},
-	{-12.6273, 9.7881, 17.5171, 0.9239},
-	{-15.6423, 9.2485, 14.3285, 0.8823},
-	{-0.8757, -13.8952, -1.8687, 0.3462},
-	{-1.1804, -15.5428, 0.7072, 0.3177},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{6.0397, -16.1432, -6.0115, 0.3082},
-	{-11.9983, -3.5871, 4.0195, 0.1109},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{-13.2106, -4.8603, 2.6326, 0.1109},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-10.6823, 9.2650, 4.7444, 0.8526},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{6.7492, -13.6822, 3.4298, 0.0417},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{12.1779, -5.9657, -2.2709, 0.2285},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{-1.6930, -7.7270, -6.3001, 0.4134},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{8.9170, -13.3225, -1.6060, 0.0265},
-	{-11.1145, 13.6920, 1.3257, 0.7815},
-	{-10.5614, 13.3039, 1.4358, 0.7733},
-	{-13.0739, 13.1598, 5.2124, 0.7791},
-	{0.3812, 5.6803, -9.0451, 0.5309},
-	{1.5287, 8.0947, -9.6845, 0.5536},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-16.2533, 10.0287, 16.8532, 0.8050},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{-8.7774, 8.6926, 3.9697, 0.8727},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-7.7482, 8.9352, -3.7482, 0.0019},
-	{-8.4392, 10.5384, -3.0647, 0.0034},
-	{-7.3083, 9.8503, -3.6142, 0.0055},
-	{7.0576, -14.8434, 4.6898, 0.0425},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{6.2136, -15.1842, 5.5655, 0.0426},
-	{-8.6857, 16.6325, -3.2761, 0.8097},
-	{-8.1047, 16.5628, -3.4644, 0.8084},
-	{-8.5402, 15.4434, -2.5444, 0.7993},
-	{-4.4049, -10.3551, 19.3219, 0.3746},
-	{-5.1766, -12.2301, 18.3433, 0.3701},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{6.9485, -13.1409, -1.5811, 0.0278},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{16.8039, -11.6417, -1.7451, 0.0724},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-10.5027, 17.4226, -1.1235, 0.8231},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{-8.8486, 8.0071, 0.5674, 0.2321},
-	{-7.6339, 7.3001, -1.5053, 0.2366},
-	{-9.1911, 5.4707, 0.7922, 0.2070},
-	{14.2423, 5.8573, -13.6831, 0.2718},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{14.2313, 3.0442, -14.0519, 0.2432},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{1.8234, -9.7317, -2.3379, 0.3857},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-0.8419, 22.2036, -6.8040, 0.9055},
-	{-1.3207, 20.9402, -6.3941, 0.9120},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.0012, 13.3475, 4.7221, 0.5346},
-	{7.3895, -4.1480, -5.2012, 0.7918},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{7.8717, -6.3096, -4.6083, 0.7760},
-	{-12.6273, 9.7881, 17.5171, 0.8708},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{-13.0884, 9.7546, 19.4461, 0.8829},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-5.2492, -0.4274, 2.1339, 0.1787},
-	{-5.2023, 0.8105, 1.4140, 0.1914},
-	{0.3758, -14.1416, 2.0205, 0.7518},
-	{0.2826, -13.7945, 4.1088, 0.7625},
-	{-0.3166, -14.4506, 4.6156, 0.7506},
-	{-11.0064, 18.0806, 5.3000, 0.9440},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{-12.2677, 17.6232, 5.6051, 0.9551},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{5.0866, -14.8700, -17.8805, 0.3579},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{-6.0713, 11.8433, -4.4390, 0.7519},
-	{-7.5584, 11.4258, -4.3407, 0.7500},
-	{-6.3602, 15.5921, -4.9454, 0.0373},
-	{-5.8729, 16.4362, -6.8259, 0.0305},
-	{-5.9204, 16.9396, -6.5831, 0.0342},
-	{2.9247, -11.8082, 6.6610, 0.3693},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.9321, -10.9125, 6.7375, 0.3750},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-1.7754, 16.9885, 1.6025, 0.8337},
-	{-1.8680, 17.5140, 2.2906, 0.8301},
-	{-5.1697, 17.6683, 1.8463, 0.1062},
-	{-3.8697, 15.0446, -1.9699, 0.0638},
-	{-5.3487, 17.2728, 0.1648, 0.0933},
-	{0.1575, -8.3765, 5.6596, 0.8381},
-	{-0.1145, -10.0834, 6.1052, 0.8343},
-	{0.2773, -10.0645, 5.6429, 0.8300},
-	{11.5682, -12.8394, -0.4424, 0.0719},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{12.8661, -10.1185, -1.5813, 0.1194},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{-4.6817, -15.9271, -0.1425, 0.7032},
-	{-4.7495, -15.4498, 0.7896, 0.7024},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-10.1421, 3.4889, 10.0141, 0.4368},
-	{-10.9998, 4.0259, 7.8484, 0.4487},
-	{-11.7720, 2.5454, 9.7670, 0.4235},
-	{-14.5913, 7.9342, 10.7804, 0.8198},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-10.5027, 17.4226, -1.1235, 0.8231},
-	{-6.0807, -16.0401, -2.8046, 0.2030},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{-6.1507, -16.1783, -4.5976, 0.2074},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-6.7421, 18.9786, 3.8471, 0.9049},
-	{-9.2245, 19.1413, 6.3190, 0.9386},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-7.6342, 9.4864, 7.2458, 0.9006},
-	{-9.2871, 9.2959, 5.7905, 0.8791},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{10.5792, 8.8619, -6.2095, 0.7699},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{-11.5055, 8.3940, 12.7242, 0.9006},
-	{-11.4002, 9.2178, 16.2556, 0.9251},
-	{-14.2759, 8.6461, 13.5203, 0.8841},
-	{14.2212, -2.6369, 1.4115, 0.2077},
-	{14.9448, -3.0144, -0.7198, 0.2088},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{8.2056, -14.2358, -1.1659, 0.0263},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{-4.6286, 17.9645, -0.7810, 0.1428},
-	{-4.8198, 18.0222, -1.5566, 0.1396},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{11.2025, -6.2287, -8.8013, 0.6375},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{-1.4154, 13.4463, 2.1669, 0.8011},
-	{-6.3176, -3.5979, 3.2811, 0.4674},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{-7.3518, -4.8091, 3.2898, 0.4530},
-	{-16.7829, 17.5540, 13.3765, 0.4930},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{-15.6712, 18.9649, 14.5346, 0.5040},
-	{9.3985, -8.0758, -3.7579, 0.2723},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{9.7438, -8.6649, -3.9130, 0.2691},
-	{10.0313, -14.8641, -1.8649, 0.2859},
-	{7.6872, -13.4907, -2.3808, 0.2881},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{7.0343, -14.3935, 3.1022, 0.0400},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{2.3919, -13.7558, -14.0267, 0.3287},
-	{4.2351, -11.6789, -14.7300, 0.3341},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{-6.3409, 14.6128, -3.0854, 0.5557},
-	{-6.8885, 16.0867, -1.6234, 0.5693},
-	{-5.9280, 13.3316, -2.6581, 0.5379},
-	{-2.7771, 3.5188, -0.9287, 0.1454},
-	{-3.1747, 2.4325, -0.3482, 0.1329},
-	{-2.8264, 3.1792, -0.3501, 0.1392},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.5740, 13.4215, 5.5159, 0.5267},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-6.6939, -8.2873, 13.3505, 0.4292},
-	{-7.8423, -8.1706, 13.9791, 0.4361},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{10.1601, 11.8141, -11.3540, 0.6495},
-	{11.0841, 11.4103, -12.0361, 0.6571},
-	{16.8042, 2.8506, -13.5943, 0.5864},
-	{16.7112, 1.6627, -13.8054, 0.5777},
-	{16.6223, 3.0472, -15.0082, 0.5919},
-	{6.6090, -12.7314, 0.6271, 0.0325},
-	{6.0408, -12.2147, -0.1022, 0.0312},
-	{5.8920, -12.9118, 1.0752, 0.0292},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{10.0119, -15.1105, 1.8163, 0.0443},
-	{3.5728, -12.8766, -8.9544, 0.3003},
-	{3.8133, -10.9201, -11.3600, 0.2879},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{-5.2492, -0.4274, 2.1339, 0.1787},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-5.6419, -0.8683, 2.5663, 0.1717},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{6.1616, -13.9989, 1.1924, 0.0272},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-5.9165, -3.7333, 5.1811, 0.1347},
-	{-6.1888, -2.2413, 4.8812, 0.1480},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{13.3984, -0.0488, -9.0357, 0.7021},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-10.2650, 12.6491, 4.0714, 0.5268},
-	{-10.7255, 13.2299, 5.2475, 0.5248},
-	{-1.3859, -4.7436, 5.1290, 0.8657},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{13.2954, -15.4297, 1.2413, 0.0464},
-	{-5.6964, -3.3373, 3.5129, 0.4721},
-	{-5.3177, -3.6893, 2.8291, 0.4699},
-	{-6.3176, -3.5979, 3.2811, 0.4674},
-	{8.0290, -15.9706, -7.8603, 0.7269},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{7.9798, -12.4199, -0.5672, 0.0400},
-	{8.9535, -13.0259, 0.0785, 0.0505},
-	{9.8295, -12.5934, -1.1503, 0.0610},
-	{-2.9592, 0.0691, -5.5000, 0.6077},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{-4.8620, 8.5587, 6.0390, 0.9092},
-	{-6.1699, 9.7728, 7.3287, 0.9120},
-	{-6.9668, 8.9693, 6.4013, 0.8997},
-	{-6.6560, -15.3246, -0.9348, 0.1882},
-	{-8.4173, -14.9636, 0.2931, 0.1651},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{0.3812, 5.6803, -9.0451, 0.6323},
-	{0.8369, 3.9820, -9.5500, 0.6111},
-	{20.4557, 5.7763, -16.1453, 0.2694},
-	{20.9750, 5.8844, -15.4046, 0.2689},
-	{19.6713, 5.2036, -15.5143, 0.2607},
-	{-8.8689, -8.2056, -0.2558, 0.1688},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{-4.8660, 14.5008, 7.3299, 0.7671},
-	{-4.5626, 13.6823, 7.1706, 0.7617},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{-4.0442, -12.1336, -5.4742, 0.2403},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-3.4679, -9.3998, -5.3591, 0.2637},
-	{17.9231, 2.9307, -15.1797, 0.2390},
-	{18.4667, 3.7664, -15.0333, 0.2444},
-	{18.2357, 2.6241, -14.5739, 0.2351},
-	{-2.3863, 5.5169, -1.6251, 0.1634},
-	{-2.7771, 3.5188, -0.9287, 0.1454},
-	{-1.6639, 3.9319, -0.8641, 0.1484},
-	{-5.8695, -2.3683, 3.3816, 0.1370},
-	{-6.3176, -3.5979, 3.2811, 0.1333},
-	{-6.3879, -2.0530, 2.8437, 0.1415},
-	{15.6932, -10.2844, -1.9749, 0.7983},
-	{12.5645, -10.4628, -2.0711, 0.7701},
-	{13.5579, -11.9461, -1.2313, 0.7777},
-	{15.7333, 9.3575, -12.3397, 0.4599},
-	{15.3091, 7.3063, -13.3422, 0.4468},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{-10.3921, 5.2184, 5.6217, 0.4749},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{-8.5657, 6.9559, 6.1867, 0.4954},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-17.1011, 9.6318, 15.3201, 0.8051},
-	{-16.6978, 8.5855, 13.2630, 0.8087},
-	{17.6724, -7.9110, -11.2655, 0.5755},
-	{17.4212, -12.2115, -10.7803, 0.5308},
-	{16.9914, -11.4795, -10.5309, 0.5394},
-	{-1.4665, 12.5815, 0.5091, 0.8596},
-	{-2.0730, 13.6539, 0.4205, 0.8700},
-	{0.0272, 13.3004, -0.8503, 0.8735},
-	{-8.0651, -6.7623, 0.6161, 0.4252},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-7.3231, 16.5820, 9.8327, 0.5577},
-	{-7.7625, 17.8735, 10.9254, 0.5685},
-	{-8.3499, 17.2083, 10.7745, 0.5724},
-	{-6.4163, 12.4426, 9.4236, 0.9039},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-4.5353, 10.3089, 7.1983, 0.8750},
-	{-15.9663, 12.9154, 17.5072, 0.9513},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-15.4064, 12.0264, 16.0740, 0.9562},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-13.1986, 17.0525, 15.8386, 0.5265},
-	{20.4856, -10.3916, -8.0896, 0.1301},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{20.2639, -11.6735, -6.5917, 0.1126},
-	{12.0129, -5.9750, -2.1689, 0.2289},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{11.9655, -6.0595, -2.2543, 0.2294},
-	{-8.4173, -14.9636, 0.2931, 0.1651},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{8.2056, -14.2358, -1.1659, 0.0019},
-	{9.1778, -14.3305, -1.9546, 0.0069},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{-5.7548, -1.8554, 9.5994, 0.1208},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-13.4628, -12.9480, 7.0929, 0.0487},
-	{-6.8869, 9.8867, 9.1845, 0.9122},
-	{-8.0148, 9.8406, 10.4461, 0.9169},
-	{-10.2034, 8.8741, 8.5897, 0.8893},
-	{19.0091, -6.1027, -4.9983, 0.1305},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{19.8388, -5.6107, -6.1269, 0.1431},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{2.3562, -12.2616, 7.1362, 0.3732},
-	{2.9247, -11.8082, 6.6610, 0.3693},
-	{-13.7487, -5.1782, 5.3918, 0.0820},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{-13.0094, -3.9825, 4.7249, 0.0968},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-10.7837, 13.4200, 5.6813, 0.5262},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{17.7778, -2.6473, -7.5944, 0.9582},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{17.6731, -0.4004, -9.5018, 0.9751},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-9.7077, -15.0751, 10.4995, 0.6661},
-	{-10.9298, -15.2923, 7.8475, 0.6427},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-15.6416, 15.8353, 12.7678, 0.4989},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-1.6639, 3.9319, -0.8641, 0.1484},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{-2.3863, 5.5169, -1.6251, 0.1634},
-	{-8.8689, -8.2056, -0.2558, 0.1688},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{-9.6771, -6.4746, 1.4750, 0.1525},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{0.8369, 3.9820, -9.5500, 0.5288},
-	{0.3812, 5.6803, -9.0451, 0.5309},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{5.3257, 13.4761, -7.8679, 0.7213},
-	{4.3121, 12.9834, -7.4063, 0.7115},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{6.2064, -14.0518, -1.7674, 0.0281},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{-8.0884, 14.9192, -4.8358, 0.7905},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-8.5402, 15.4434, -2.5444, 0.7993},
-	{-7.5222, -5.7208, 13.5055, 0.4611},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{-6.9060, -3.5212, 12.3504, 0.4751},
-	{4.4382, 1.8068, -7.1852, 0.5119},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{12.1132, -1.6393, -1.0587, 0.2149},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{3.5083, 0.9463, 0.2755, 0.1100},
-	{2.5758, 0.3187, 1.3016, 0.1027},
-	{7.2311, -6.7954, -13.7344, 0.3467},
-	{8.3087, -6.7818, -13.5410, 0.3591},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{-15.3108, 16.7398, 13.8331, 0.5052},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-16.4593, 17.3603, 14.2740, 0.4980},
-	{-2.9694, 15.5825, 4.9978, 0.7955},
-	{-4.1858, 16.1901, 6.0537, 0.7895},
-	{-3.9373, 14.8965, 5.8136, 0.7819},
-	{-8.0884, 14.9192, -4.8358, 0.7905},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-11.3729, 8.5680, 3.3709, 0.8278},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{2.9321, -10.9125, 6.7375, 0.3750},
-	{2.2477, -9.9399, 7.1613, 0.3839},
-	{-3.2380, -8.9673, 16.7662, 0.3800},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{-3.6688, -9.8199, 17.8896, 0.3740},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{-5.6419, -0.8683, 2.5663, 0.1717},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{-5.6730, 7.1143, 6.8094, 0.2080},
-	{-8.7441, 4.4453, 9.4249, 0.1715},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-4.7145, 1.0246, 0.9529, 0.1977},
-	{-4.5269, 1.9740, 0.5355, 0.2076},
-	{-5.6419, -0.8683, 2.5663, 0.1717},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{-5.8695, -2.3683, 3.3816, 0.1545},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{12.4645, -15.1920, 0.5546, 0.0468},
-	{10.0119, -15.1105, 1.8163, 0.0292},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-7.7482, 8.9352, -3.7482, 0.0019},
-	{-7.3083, 9.8503, -3.6142, 0.0055},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-10.8816, 17.5993, 15.5396, 0.6125},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{15.8842, -16.4335, -12.5128, 0.4765},
-	{16.7603, -15.9094, -11.8002, 0.4846},
-	{16.2911, -16.2725, -10.7365, 0.4904},
-	{-3.9068, 17.0203, 2.7177, 0.8908},
-	{-1.8680, 17.5140, 2.2906, 0.9056},
-	{-1.7754, 16.9885, 1.6025, 0.9035},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-5.2023, 0.8105, 1.4140, 0.1749},
-	{-6.6070, -0.1847, 1.7596, 0.1597},
-	{17.9231, 2.9307, -15.1797, 0.2390},
-	{18.2357, 2.6241, -14.5739, 0.2351},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{1.3899, 6.2334, -0.1500, 0.1611},
-	{1.4455, 3.6228, 1.0999, 0.1344},
-	{2.7654, 5.6035, -0.0047, 0.1542},
-	{-5.8729, 16.4362, -6.8259, 0.8122},
-	{-6.6065, 16.3011, -6.4520, 0.8108},
-	{-6.4156, 16.9751, -6.7188, 0.8168},
-	{14.7260, 4.5795, -15.1151, 0.2575},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{-12.6260, 16.3994, 6.5295, 0.6152},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-12.8051, 15.3194, 7.5782, 0.6279},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{6.9646, -12.7086, -15.8348, 0.3676},
-	{-5.5654, 23.2070, 0.4411, 0.8552},
-	{-5.5777, 22.6380, -0.2408, 0.8598},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{4.3121, 12.9834, -7.4063, 0.5861},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{3.8825, 13.2386, -7.3097, 0.5821},
-	{-10.6244, 18.6519, 10.0182, 0.5941},
-	{-11.4479, 18.6465, 9.2176, 0.5997},
-	{-11.8279, 17.2406, 9.6540, 0.6126},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{0.2137, 17.1031, -0.0058, 0.8462},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{0.0936, 17.0687, -0.7948, 0.8522},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.5461, -14.3065, 4.6786, 0.3260},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{15.1032, -15.6144, -5.1526, 0.7972},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{15.6765, -16.1947, -7.0332, 0.7990},
-	{6.5583, 8.0535, -3.0016, 0.1643},
-	{4.7116, 3.4303, -1.4022, 0.1377},
-	{6.5721, 5.7225, -3.4183, 0.1540},
-	{-13.5612, 8.1108, 10.8602, 0.8266},
-	{-13.0748, 8.1682, 8.5429, 0.8261},
-	{-11.9456, 8.8136, 7.3754, 0.8409},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{7.7699, -12.5060, 4.7863, 0.0437},
-	{8.1631, -13.4727, 5.2951, 0.0435},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{-10.7238, 13.2526, 5.3022, 0.5253},
-	{-10.6137, 16.9895, 1.9262, 0.9194},
-	{-11.8462, 15.9685, 3.3982, 0.9370},
-	{-11.8190, 17.0112, 4.2909, 0.9423},
-	{11.7920, -15.9856, -10.6589, 0.4353},
-	{9.7830, -16.5711, -10.0824, 0.3917},
-	{10.0827, -15.0745, -11.7295, 0.3746},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{4.3121, 12.9834, -7.4063, 0.7115},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-15.7588, -13.7484, 6.1398, 0.0378},
-	{-16.1837, -14.0899, 7.7824, 0.0426},
-	{1.4146, -4.1184, 3.1420, 0.3900},
-	{1.5702, -4.3984, 3.5911, 0.4075},
-	{1.6684, -6.6972, 4.3489, 0.3930},
-	{-3.7684, 9.8448, -2.6950, 0.5029},
-	{-3.5671, 8.8851, -2.4176, 0.4933},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-8.5657, 6.9559, 6.1867, 0.4954},
-	{-9.3935, 7.0172, 4.6010, 0.5006},
-	{-10.3921, 5.2184, 5.6217, 0.4749},
-	{-1.9301, -11.4960, 13.2052, 0.3790},
-	{-2.5633, -13.8926, 13.4230, 0.3492},
-	{-3.5419, -12.0626, 11.2357, 0.3588},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{-7.5222, -5.7208, 13.5055, 0.0659},
-	{-9.8863, -3.6202, 14.1223, 0.0725},
-	{-7.8423, -8.1706, 13.9791, 0.0418},
-	{9.8648, 10.5618, -12.0736, 0.6472},
-	{11.0841, 11.4103, -12.0361, 0.6571},
-	{11.2181, 10.7934, -11.8837, 0.6613},
-	{20.5771, -6.1904, -9.3752, 0.1704},
-	{20.1509, -4.4673, -7.9739, 0.1607},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{-6.2896, 20.1314, 0.3410, 0.8876},
-	{-5.8577, 20.5844, 1.1279, 0.8787},
-	{-4.9357, 20.1317, 0.2527, 0.8863},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{11.7791, -3.5361, -7.9690, 0.6640},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-12.0381, -12.8281, 11.8384, 0.2651},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{11.8049, -12.8121, -1.1697, 0.0787},
-	{-2.4610, 10.4681, 1.0558, 0.8310},
-	{-1.6048, 9.9904, 0.9322, 0.8282},
-	{-2.5806, 9.5378, 1.6786, 0.8181},
-	{0.3758, -14.1416, 2.0205, 0.3243},
-	{-1.1804, -15.5428, 0.7072, 0.3177},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{-1.7754, 16.9885, 1.6025, 0.9035},
-	{0.2137, 17.1031, -0.0058, 0.9141},
-	{0.0936, 17.0687, -0.7948, 0.9101},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{1.8102, -7.4700, 3.2377, 0.0192},
-	{2.7397, -6.6878, 0.9006, 0.0316},
-	{12.1286, 10.2887, -12.0302, 0.8126},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{12.1663, 9.3015, -11.7901, 0.8155},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{-1.2322, -0.9956, 2.3762, 0.0904},
-	{-4.6817, -15.9271, -0.1425, 0.7032},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-4.7495, -15.4498, 0.7896, 0.7024},
-	{-11.5000, -11.4883, -0.0532, 0.1340},
-	{-12.7965, -10.7170, 1.9838, 0.1104},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{11.8405, -7.6519, 0.6353, 0.2150},
-	{12.2882, -6.7028, 1.6119, 0.2020},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{8.9554, -13.0218, 3.6571, 0.0448},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{-8.8486, 8.0071, 0.5674, 0.8520},
-	{-9.2074, 8.0057, 1.9418, 0.8519},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{-12.2912, -13.8790, 5.4687, 0.0896},
-	{-14.9962, -13.8446, 1.9274, 0.0843},
-	{-4.6817, -15.9271, -0.1425, 0.7032},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{-9.1693, -16.0589, -3.5740, 0.1878},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{16.1311, 3.9612, -12.7168, 0.4120},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-8.7774, 8.6926, 3.9697, 0.8727},
-	{-8.0326, 8.5711, 5.6535, 0.8891},
-	{16.9785, -7.5101, -4.5312, 0.9286},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{15.6815, -6.6533, -8.6324, 0.9638},
-	{-4.8616, 4.6617, 6.8354, 0.1911},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{-7.8645, -11.8165, -3.2458, 0.1948},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{7.1277, 12.9565, -9.2771, 0.6192},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{6.4376, 13.1912, -9.4032, 0.6132},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{4.4382, 1.8068, -7.1852, 0.5119},
-	{8.2892, 13.0061, -9.5667, 0.6319},
-	{8.0087, 12.8555, -10.4614, 0.6296},
-	{7.1277, 12.9565, -9.2771, 0.6192},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{-6.5106, -9.7525, 14.7792, 0.2518},
-	{-7.4540, -11.4096, 14.9506, 0.2736},
-	{-6.4427, -10.6470, 16.6438, 0.2649},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-9.3756, 13.4800, -1.2327, 0.7774},
-	{-7.9122, 12.0837, -4.6986, 0.7617},
-	{13.4319, 0.4791, -13.3091, 0.6328},
-	{14.2867, -1.1365, -12.1842, 0.6137},
-	{13.4514, -1.8334, -12.3691, 0.6076},
-	{-8.8679, 19.8542, -2.8039, 0.8423},
-	{-8.3283, 18.5141, -2.4574, 0.8297},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{16.9610, 8.1775, -12.3740, 0.3118},
-	{17.3238, 9.8524, -13.2363, 0.3195},
-	{16.5977, 8.6787, -13.2350, 0.3090},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{-14.6137, -6.2262, 10.3488, 0.3302},
-	{-13.7066, -7.3132, 12.5516, 0.3199},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{14.6487, -14.4410, -1.5320, 0.0429},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{-5.7258, -3.4623, 10.9865, 0.4776},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{-3.2346, -5.3071, 11.1162, 0.4520},
-	{0.2665, -6.4448, 4.9095, 0.8426},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{0.1575, -8.3765, 5.6596, 0.8381},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{-6.1421, 17.2667, 8.5627, 0.9360},
-	{-6.7820, 18.5176, 8.3488, 0.9377},
-	{1.1812, 11.9400, -4.8896, 0.2335},
-	{1.7081, 10.2578, -4.2031, 0.2176},
-	{1.6235, 11.5088, -5.1563, 0.2323},
-	{-8.1640, -15.5292, 9.0067, 0.6730},
-	{-10.9298, -15.2923, 7.8475, 0.6427},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{16.8042, 2.8506, -13.5943, 0.9095},
-	{16.1311, 3.9612, -12.7168, 0.9124},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.7059, -5.5763, -9.7328, 0.7760},
-	{3.4341, -7.2520, -10.4022, 0.7607},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{3.7022, 2.6929, -9.2950, 0.5192},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{7.0740, -14.4810, 3.9877, 0.0420},
-	{7.0343, -14.3935, 3.1022, 0.0400},
-	{12.9097, 5.1491, -7.8942, 0.7861},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{11.3199, 5.0059, -6.2512, 0.7793},
-	{3.5036, -12.9985, -16.0544, 0.3353},
-	{3.6588, -11.9904, -16.1421, 0.3363},
-	{4.6125, -13.6330, -16.4045, 0.3392},
-	{4.2351, -11.6789, -14.7300, 0.3329},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{0.7806, -14.5484, 4.6027, 0.3259},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{-14.2540, -3.1432, 10.2030, 0.3635},
-	{-13.3308, 12.3683, 16.9123, 0.9401},
-	{-12.4648, 11.2918, 15.8110, 0.9357},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{15.6932, -10.2844, -1.9749, 0.0728},
-	{13.5579, -11.9461, -1.2313, 0.0426},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{-7.9735, -11.3649, 13.7875, 0.0114},
-	{-11.0354, -9.4953, 14.4719, 0.0254},
-	{-10.5017, -11.8747, 13.7665, 0.0027},
-	{-12.2912, -13.8790, 5.4687, 0.0211},
-	{-12.8302, -13.6642, 6.5080, 0.0333},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-15.4064, 12.0264, 16.0740, 0.9562},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-14.9160, 12.0514, 14.8918, 0.9591},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.4382, 1.8068, -7.1852, 0.5119},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{-3.0850, 7.3498, 0.4457, 0.2525},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{7.3338, -9.6020, -14.6035, 0.3620},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{5.3288, -10.1704, -12.9107, 0.3404},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-4.7243, -15.1252, 12.6717, 0.3291},
-	{-3.5188, -14.6504, 12.7860, 0.3393},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{3.7022, 2.6929, -9.2950, 0.5905},
-	{1.0488, -0.8718, -8.3470, 0.5717},
-	{2.1439, 2.8748, -9.7078, 0.5944},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-7.1437, 14.5619, -5.3751, 0.7872},
-	{-6.2313, 14.9946, -5.1307, 0.7916},
-	{-5.7257, 13.0439, -5.9031, 0.0130},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-6.0713, 11.8433, -4.4390, 0.0147},
-	{-5.2595, -15.4103, 8.3997, 0.6981},
-	{-7.4131, -14.9587, 7.6645, 0.6798},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{5.4216, -12.7932, -0.1476, 0.0295},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{4.7612, -14.0902, -0.0963, 0.0283},
-	{-0.6178, 8.8296, -3.3505, 0.6917},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{-1.0391, 8.8979, -2.9978, 0.6920},
-	{-4.7243, -15.1252, 12.6717, 0.3291},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{-4.8899, -13.6344, 11.3395, 0.3387},
-	{-8.9384, 3.8866, 0.5087, 0.1956},
-	{-7.1474, 5.0254, -1.2686, 0.2172},
-	{-8.3255, 1.2062, 0.7083, 0.1732},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{19.3769, 3.7909, -15.6460, 0.2500},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{-17.1829, -13.9211, 2.5898, 0.0720},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{-16.3901, -13.8265, 1.3407, 0.0777},
-	{15.6932, -10.2844, -1.9749, 0.7983},
-	{15.4431, -9.5359, -2.9302, 0.8005},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{1.6899, -11.8764, 3.3873, 0.3312},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{5.0994, -14.7806, 2.5423, 0.0321},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{6.1616, -13.9989, 1.1924, 0.0308},
-	{-7.8901, -13.2971, 12.4355, 0.2448},
-	{-8.5412, -12.6516, 13.2794, 0.2571},
-	{-7.9911, -14.1694, 12.0448, 0.2384},
-	{2.1468, -14.3108, 4.1293, 0.3354},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{-1.4665, 12.5815, 0.5091, 0.8019},
-	{-0.6174, 13.0274, 1.5906, 0.8029},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{-1.6639, 3.9319, -0.8641, 0.1484},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{-5.9204, 16.9396, -6.5831, 0.0342},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-6.3602, 15.5921, -4.9454, 0.0373},
-	{9.6256, 12.3425, -10.3036, 0.7785},
-	{10.1601, 11.8141, -11.3540, 0.7905},
-	{9.8342, 12.3775, -11.2897, 0.7848},
-	{-3.2380, -8.9673, 16.7662, 0.3800},
-	{-4.2797, -8.7476, 14.4908, 0.4039},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{12.1509, -11.9581, -1.3225, 0.0832},
-	{13.8072, 3.9167, -12.0851, 0.7471},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{13.9798, 1.5943, -11.8175, 0.7248},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-3.5419, -12.0626, 11.2357, 0.7264},
-	{-4.8899, -13.6344, 11.3395, 0.7104},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{13.1134, -3.4813, 0.7268, 0.2101},
-	{13.2761, -1.6414, 0.4335, 0.2115},
-	{-4.6419, 8.1669, -2.3560, 0.2539},
-	{-3.5671, 8.8851, -2.4176, 0.2640},
-	{-3.2275, 6.6744, -2.4216, 0.2486},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-5.9372, 10.1045, -6.6120, 0.0026},
-	{-6.0713, 11.8433, -4.4390, 0.0147},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-11.0891, 2.0356, 3.3666, 0.1614},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-7.2668, 13.6777, 7.2201, 0.5681},
-	{-10.3355, 14.5258, 9.6574, 0.5398},
-	{-9.1565, 13.9495, 6.1364, 0.5449},
-	{1.2406, -5.3267, -6.4240, 0.4412},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{-6.1699, 9.7728, 7.3287, 0.7109},
-	{-4.8620, 8.5587, 6.0390, 0.7185},
-	{-6.2107, 9.9377, -2.6858, 0.5023},
-	{-4.6419, 8.1669, -2.3560, 0.4956},
-	{-6.8149, 9.0396, -2.3429, 0.4911},
-	{18.8393, -7.2961, -11.5697, 0.5851},
-	{17.7315, -3.9778, -13.0607, 0.6184},
-	{18.7331, -3.8729, -12.5950, 0.6190},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{-1.3468, 14.6962, 2.4091, 0.8110},
-	{0.1807, 14.3208, 0.0519, 0.8239},
-	{-7.1422, 13.1945, -4.8339, 0.7730},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{-11.9456, 8.8136, 7.3754, 0.8409},
-	{-13.0748, 8.1682, 8.5429, 0.8261},
-	{9.7830, -16.5711, -10.0824, 0.3917},
-	{11.7920, -15.9856, -10.6589, 0.4353},
-	{15.5862, -16.2784, -8.8372, 0.4977},
-	{13.7823, -12.6365, -11.1707, 0.4520},
-	{13.2540, -12.8488, -12.8420, 0.4433},
-	{10.5979, -11.0174, -13.7878, 0.4048},
-	{-14.5351, 17.0043, 11.6655, 0.6509},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{13.0597, -4.0224, -11.0636, 0.5821},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{-6.7820, 18.5176, 8.3488, 0.9377},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{16.9914, -11.4795, -10.5309, 0.4973},
-	{15.3972, -10.9997, -11.4141, 0.4780},
-	{15.8397, -10.9024, -9.3751, 0.4856},
-	{3.8734, 6.9597, -0.9593, 0.1680},
-	{2.7654, 5.6035, -0.0047, 0.1542},
-	{3.3111, 3.0533, 0.1791, 0.1289},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{-1.9112, -11.1936, 12.5903, 0.3569},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{-9.1407, 3.1817, 10.6449, 0.4348},
-	{-10.6991, 1.9371, 11.2847, 0.4174},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{9.2682, -8.1809, 0.1404, 0.2471},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{-14.3277, 18.9486, 13.8145, 0.6491},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-15.6712, 18.9649, 14.5346, 0.6617},
-	{-10.7215, 10.6147, 13.3614, 0.9302},
-	{-8.2512, 11.6577, 9.3403, 0.9297},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-3.9842, 13.3250, 5.6312, 0.7679},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{20.4557, 5.7763, -16.1453, 0.2694},
-	{20.7836, 6.2748, -15.7469, 0.2722},
-	{20.9750, 5.8844, -15.4046, 0.2689},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{2.9738, -13.4960, 8.5257, 0.3585},
-	{2.6092, -14.8472, 9.1994, 0.3503},
-	{20.6673, 9.3354, -14.9361, 0.3078},
-	{19.5309, 6.9339, -14.4090, 0.2858},
-	{19.3552, 7.1245, -15.1128, 0.2855},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{-14.6607, -8.2925, 9.4719, 0.0376},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-16.3901, -13.8265, 1.3407, 0.0777},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{4.5081, -10.1702, -12.2700, 0.3314},
-	{3.8938, -9.9459, -14.3642, 0.3340},
-	{3.4480, -10.1667, -13.4966, 0.3282},
-	{0.0567, 10.7976, -4.1568, 0.6977},
-	{0.1535, 9.0694, -4.8813, 0.6838},
-	{-0.8602, 7.3037, -3.9972, 0.6751},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{13.1608, 6.5094, -9.0719, 0.7656},
-	{12.9097, 5.1491, -7.8942, 0.7470},
-	{13.6692, 2.7175, -9.1863, 0.7290},
-	{-6.4804, 9.9528, -3.1135, 0.0095},
-	{-6.6453, 9.8843, -3.2180, 0.0086},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{6.2030, -14.0398, -1.7413, 0.0281},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{2.3133, 7.7510, -0.8429, 0.1754},
-	{3.3873, 10.6530, -3.6019, 0.2048},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{-5.9632, 1.6393, 0.6543, 0.1837},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-5.4022, 3.3471, -0.3145, 0.2042},
-	{-15.7605, -14.3025, 4.0597, 0.0680},
-	{-16.4857, -13.9655, 4.0352, 0.0644},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{14.2313, 3.0442, -14.0519, 0.5939},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{13.5400, 3.1643, -13.8915, 0.5875},
-	{9.9134, 1.0972, -15.5351, 0.6438},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-8.0884, 14.9192, -4.8358, 0.7905},
-	{1.6235, 11.5088, -5.1563, 0.5488},
-	{1.0077, 10.1127, -5.6591, 0.5406},
-	{1.1812, 11.9400, -4.8896, 0.5442},
-	{-9.4129, 9.0688, -0.3582, 0.7311},
-	{-9.6062, 10.9789, 0.2842, 0.7499},
-	{-8.7524, 9.4353, -1.1985, 0.7319},
-	{13.1002, -12.2492, -10.4372, 0.1538},
-	{12.2079, -9.3668, -8.0887, 0.1703},
-	{14.2918, -11.8568, -9.7028, 0.1662},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{-3.4391, 12.8762, -2.6620, 0.5304},
-	{-3.1785, 11.4398, -3.0189, 0.5176},
-	{8.2056, -14.2358, -1.1659, 0.0263},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{-3.1260, 13.4372, 0.7263, 0.0641},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-3.4554, 16.4095, 1.9054, 0.0964},
-	{-11.7922, 3.1514, 5.9367, 0.1588},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-12.6425, 1.6666, 7.9214, 0.1369},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{4.4363, 1.7568, -7.3652, 0.5114},
-	{-2.3956, 20.9802, -3.5110, 0.1641},
-	{-0.5514, 22.0208, -6.4770, 0.1569},
-	{-0.8419, 22.2036, -6.8040, 0.1601},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{1.7685, -9.9121, 2.7283, 0.3562},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{-8.4173, -14.9636, 0.2931, 0.6652},
-	{-5.5530, -15.9135, -0.8765, 0.6931},
-	{-8.5647, -15.5069, 1.8687, 0.6644},
-	{-11.0354, -9.4953, 14.4719, 0.3000},
-	{-12.3758, -11.0406, 13.0324, 0.2840},
-	{-10.5017, -11.8747, 13.7665, 0.2719},
-	{2.1439, 2.8748, -9.7078, 0.5944},
-	{1.0488, -0.8718, -8.3470, 0.5717},
-	{0.5962, 1.1958, -9.0417, 0.5931},
-	{-15.7605, -14.3025, 4.0597, 0.0680},
-	{-17.1281, -14.4211, 3.2459, 0.0693},
-	{-16.0153, -14.2690, 1.5396, 0.0777},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{19.8388, -5.6107, -6.1269, 0.1431},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{2.2102, -2.8264, 1.9789, 0.0696},
-	{0.5371, -1.9433, 2.9994, 0.0764},
-	{1.4146, -4.1184, 3.1420, 0.0535},
-	{9.0410, -10.6755, -14.4063, 0.3838},
-	{10.6937, -12.5708, -13.9227, 0.4130},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-1.1057, -9.7416, 11.8766, 0.3861},
-	{-2.8026, -8.3895, 11.8084, 0.4119},
-	{11.6555, -8.0978, -8.5264, 0.6199},
-	{11.2025, -6.2287, -8.8013, 0.6375},
-	{10.7031, -7.6516, -8.0828, 0.6229},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{14.5738, 0.4312, -11.5131, 0.8833},
-	{13.8530, -0.1599, -11.1608, 0.8862},
-	{14.1802, -0.9937, -11.1230, 0.8713},
-	{11.8351, -4.6064, 0.0008, 0.2161},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{11.5504, -4.2621, -1.6148, 0.2173},
-	{9.9077, 7.5246, -14.5226, 0.6374},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{11.2782, 8.5208, -13.2772, 0.6579},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{-6.0540, -15.4355, -5.6802, 0.2116},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{1.5414, -11.3823, 7.5228, 0.3873},
-	{0.8645, -10.4892, 6.9072, 0.4002},
-	{9.1778, -14.3305, -1.9546, 0.2854},
-	{8.9170, -13.3225, -1.6060, 0.2832},
-	{7.6872, -13.4907, -2.3808, 0.2881},
-	{-1.2881, -14.4745, 6.9149, 0.7395},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-0.8695, -14.6563, 5.4264, 0.7450},
-	{1.7685, -9.9121, 2.7283, 0.3562},
-	{2.2377, -10.1881, 3.5253, 0.3466},
-	{1.1652, -11.9536, 2.9422, 0.3389},
-	{-2.7957, -10.1990, 15.5953, 0.3116},
-	{-2.1208, -13.0904, 15.2665, 0.3293},
-	{-2.1505, -12.2722, 14.8450, 0.3291},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{-7.4893, -16.2213, -5.1795, 0.2022},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{7.9798, -12.4199, -0.5672, 0.2774},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{-10.2957, 11.8931, 0.9380, 0.7604},
-	{-10.5614, 13.3039, 1.4358, 0.7733},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{-2.2366, 9.2787, 3.5921, 0.7537},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{15.7333, 9.3575, -12.3397, 0.3064},
-	{15.2706, 6.8616, -14.4437, 0.2809},
-	{15.3091, 7.3063, -13.3422, 0.2882},
-	{-4.5626, 13.6823, 7.1706, 0.5958},
-	{-4.8660, 14.5008, 7.3299, 0.6005},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.8046, -9.8976, -3.1725, 0.2988},
-	{16.4153, -7.7792, -8.8455, 0.5687},
-	{15.6815, -6.6533, -8.6324, 0.5761},
-	{16.3969, -5.8303, -10.0012, 0.5907},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-10.5614, 13.3039, 1.4358, 0.4877},
-	{-10.5867, 12.4049, 1.9497, 0.5043},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{9.9077, 7.5246, -14.5226, 0.6374},
-	{8.3254, 6.7137, -14.6254, 0.6244},
-	{-13.1699, -0.8163, 11.3602, 0.3848},
-	{-13.4539, -0.1193, 8.9642, 0.3989},
-	{-14.1231, -2.1933, 8.5906, 0.3739},
-	{1.9252, 9.4734, -9.2458, 0.5614},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{2.6043, 6.8029, -10.9398, 0.5628},
-	{-3.8425, 14.2969, -1.9023, 0.0575},
-	{-3.8697, 15.0446, -1.9699, 0.0638},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{-3.9068, 17.0203, 2.7177, 0.1070},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-5.6286, 18.2818, 2.8314, 0.1188},
-	{-10.5867, 12.4049, 1.9497, 0.5043},
-	{-10.5614, 13.3039, 1.4358, 0.4877},
-	{-10.2957, 11.8931, 0.9380, 0.5092},
-	{-5.3487, 17.2728, 0.1648, 0.5832},
-	{-3.8697, 15.0446, -1.9699, 0.5535},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-12.4906, 14.1734, 4.7138, 0.7907},
-	{-9.7932, 15.9822, -0.5432, 0.8058},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-5.5150, 0.9075, 8.0799, 0.1538},
-	{-6.0504, 4.1347, 8.5272, 0.1731},
-	{-6.3614, -1.5692, 10.6655, 0.1155},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{2.2477, -9.9399, 7.1613, 0.3839},
-	{2.9321, -10.9125, 6.7375, 0.3750},
-	{-4.1988, 16.6831, 1.9061, 0.0990},
-	{-4.1672, 15.1997, -0.0514, 0.0744},
-	{-5.1697, 17.6683, 1.8463, 0.1062},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-13.0094, -3.9825, 4.7249, 0.0968},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{-0.5493, -15.6007, 7.1884, 0.3276},
-	{0.6859, -15.3500, 9.3779, 0.3417},
-	{11.5682, -12.8394, -0.4424, 0.0719},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{12.1251, -11.9110, -1.1024, 0.0861},
-	{16.9914, -11.4795, -10.5309, 0.1926},
-	{15.8397, -10.9024, -9.3751, 0.1844},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{-4.4560, -3.6123, -3.3509, 0.4550},
-	{-5.6013, -7.4408, -3.5952, 0.4154},
-	{-5.5762, -5.7219, -2.4184, 0.4337},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{10.5792, 8.8619, -6.2095, 0.7699},
-	{13.1608, 6.5094, -9.0719, 0.7985},
-	{6.2864, 6.7230, -13.4818, 0.5998},
-	{6.4971, 3.8652, -12.7361, 0.5861},
-	{4.7317, 6.5993, -12.3038, 0.5829},
-	{-9.7809, -14.1838, 11.9127, 0.2471},
-	{-12.1064, -14.3064, 9.3530, 0.2462},
-	{-9.7077, -15.0751, 10.4995, 0.2344},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{-8.1047, 16.5628, -3.4644, 0.8084},
-	{-7.3739, 15.4861, -4.8637, 0.7983},
-	{-8.5402, 15.4434, -2.5444, 0.7993},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{-3.3840, 9.6117, 5.6685, 0.7400},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{-7.1312, 6.7927, 7.2440, 0.4932},
-	{-8.5657, 6.9559, 6.1867, 0.4954},
-	{-7.8645, -11.8165, -3.2458, 0.1948},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-7.2171, -10.9163, -1.8646, 0.1955},
-	{-11.9983, -3.5871, 4.0195, 0.1109},
-	{-11.2763, -4.3120, 3.1914, 0.1253},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{15.4411, -5.4773, -0.5673, 0.2004},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{-5.5762, -5.7219, -2.4184, 0.4337},
-	{-5.6013, -7.4408, -3.5952, 0.4154},
-	{11.8520, -6.7169, -9.3782, 0.6348},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{11.2025, -6.2287, -8.8013, 0.6375},
-	{11.8049, -12.8121, -1.1697, 0.0787},
-	{12.0256, -12.0169, -1.2668, 0.0816},
-	{11.8498, -12.3036, -1.2386, 0.0780},
-	{8.2056, -14.2358, -1.1659, 0.0336},
-	{10.0119, -15.1105, 1.8163, 0.0443},
-	{7.2285, -14.4412, 1.5781, 0.0390},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{1.8102, -7.4700, 3.2377, 0.0192},
-	{1.7685, -9.9121, 2.7283, 0.0006},
-	{2.7397, -6.6878, 0.9006, 0.0316},
-	{-2.4610, 10.4681, 1.0558, 0.8310},
-	{-1.6118, 12.2198, 0.5036, 0.8541},
-	{-0.4557, 10.6176, -0.3438, 0.8410},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{-1.3859, -4.7436, 5.1290, 0.8657},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{14.0754, -9.6989, 0.1312, 0.1523},
-	{12.0974, -13.0074, 0.7693, 0.0754},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{14.6388, -8.5181, -7.5916, 0.8051},
-	{15.4431, -9.5359, -2.9302, 0.8005},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-6.5106, -9.7525, 14.7792, 0.4172},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{-9.1741, 11.0433, 13.1369, 0.8990},
-	{-10.0166, 10.7093, 14.4407, 0.8986},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{6.0397, -16.1432, -6.0115, 0.7092},
-	{6.8770, -16.4242, -9.7199, 0.7096},
-	{7.7495, -16.5007, -9.1989, 0.7219},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{-12.2390, 10.3380, 5.4834, 0.8038},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{2.5447, -15.5540, 6.3621, 0.3417},
-	{3.4625, -13.7837, 5.8327, 0.3479},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{-2.6629, -11.9433, 11.5700, 0.3376},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{18.5321, 8.5916, -13.5023, 0.4423},
-	{18.0389, 10.1497, -13.3565, 0.4592},
-	{-2.8986, -14.9993, 14.7084, 0.3301},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{-4.8539, -15.0859, 16.0388, 0.3114},
-	{-5.7023, -5.3300, 1.5778, 0.4516},
-	{-5.1508, -4.5724, -0.6738, 0.4517},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{11.8568, 2.4786, -3.5084, 0.2232},
-	{10.9563, 2.9436, -3.8503, 0.2248},
-	{10.8078, 3.1044, -3.3031, 0.2254},
-	{-3.4177, 8.9106, -2.0054, 0.0085},
-	{-3.0851, 9.5759, -2.8310, 0.0114},
-	{-3.2529, 8.6209, -1.6967, 0.0110},
-	{-1.0330, -14.2897, 14.1703, 0.3374},
-	{-1.2252, -14.1486, 14.8460, 0.3369},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-10.2581, 12.0264, 3.4608, 0.7746},
-	{-10.5867, 12.4049, 1.9497, 0.7768},
-	{-10.2957, 11.8931, 0.9380, 0.7893},
-	{17.6731, -0.4004, -9.5018, 0.9751},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{16.6170, 2.5289, -12.2647, 0.9620},
-	{6.4857, -8.3881, -2.6518, 0.2860},
-	{7.3495, -7.8825, -3.7080, 0.2864},
-	{6.2600, -8.5717, -3.7011, 0.2957},
-	{-5.5654, 23.2070, 0.4411, 0.2008},
-	{-6.4854, 22.2496, 1.8210, 0.1955},
-	{-5.8071, 20.6262, 2.1145, 0.1778},
-	{-6.3602, 15.5921, -4.9454, 0.7987},
-	{-6.6065, 16.3011, -6.4520, 0.8108},
-	{-5.8729, 16.4362, -6.8259, 0.8122},
-	{-4.5269, 1.9740, 0.5355, 0.2076},
-	{-4.0834, 4.1951, 0.8309, 0.2241},
-	{-4.8759, 2.1071, 2.4843, 0.1969},
-	{-5.5654, 23.2070, 0.4411, 0.8552},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{-6.4854, 22.2496, 1.8210, 0.8633},
-	{4.7116, 3.4303, -1.4022, 0.1377},
-	{6.5583, 8.0535, -3.0016, 0.1643},
-	{3.8734, 6.9597, -0.9593, 0.1680},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{-2.4610, 10.4681, 1.0558, 0.0358},
-	{-3.0850, 7.3498, 0.4457, 0.0217},
-	{-3.2529, 8.6209, -1.6967, 0.0110},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-4.8539, -15.0859, 16.0388, 0.3114},
-	{-6.1734, -8.7732, 14.0830, 0.4206},
-	{-5.1566, -7.8780, 13.1179, 0.4234},
-	{-6.6939, -8.2873, 13.3505, 0.4292},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{15.1351, -7.1622, 0.4560, 0.1877},
-	{14.0754, -9.6989, 0.1312, 0.1523},
-	{12.9097, 5.1491, -7.8942, 0.7861},
-	{10.5792, 8.8619, -6.2095, 0.7699},
-	{9.0686, 8.2447, -4.7634, 0.7521},
-	{-4.8198, 18.0222, -1.5566, 0.9220},
-	{-5.3487, 17.2728, 0.1648, 0.9298},
-	{-6.5693, 17.4267, -0.0351, 0.9197},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{-17.1632, -14.0962, 6.0941, 0.0404},
-	{-15.7588, -13.7484, 6.1398, 0.0352},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-8.0326, 8.5711, 5.6535, 0.5153},
-	{-8.7774, 8.6926, 3.9697, 0.5200},
-	{-9.3935, 7.0172, 4.6010, 0.5006},
-	{-11.8749, 9.5391, 19.4097, 0.8836},
-	{-12.4130, 10.8065, 18.8862, 0.8901},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{14.2479, 5.9961, -13.3436, 0.7707},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{13.7087, 5.6327, -12.6901, 0.7654},
-	{4.4329, 1.7575, -7.4214, 0.5115},
-	{4.4236, 1.7513, -7.4028, 0.5115},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{11.3671, -14.2139, -1.2936, 0.0125},
-	{12.2527, -16.0877, -2.5494, 0.0180},
-	{14.6487, -14.4410, -1.5320, 0.0429},
-	{-3.3218, 1.9530, 0.0626, 0.8868},
-	{-3.9636, -1.2419, 0.9111, 0.8899},
-	{-3.1424, -2.1742, 1.2848, 0.8830},
-	{-8.8038, 11.6428, -2.4820, 0.7557},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-14.9160, 12.0514, 14.8918, 0.9591},
-	{12.1658, -13.2495, 0.3758, 0.0680},
-	{13.2842, -15.1610, 1.8744, 0.0472},
-	{13.2954, -15.4297, 1.2413, 0.0464},
-	{-9.4225, 17.1743, 10.4049, 0.5847},
-	{-9.4637, 18.1300, 10.8893, 0.5836},
-	{-10.2018, 18.0151, 10.2676, 0.5906},
-	{-5.6013, -7.4408, -3.5952, 0.2626},
-	{-5.7445, -7.8728, -5.1948, 0.2623},
-	{-5.6884, -10.9949, -5.3392, 0.2364},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{-0.2912, 2.7386, -8.6407, 0.6119},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{12.1632, -5.3758, -2.3096, 0.2245},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{3.5083, 0.9463, 0.2755, 0.1100},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{4.1510, 0.9721, -1.0348, 0.1115},
-	{-1.9653, -13.4975, 8.6495, 0.3180},
-	{-1.2881, -14.4745, 6.9149, 0.3160},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{-0.6489, -12.7077, 11.1792, 0.3509},
-	{-1.1045, -14.3039, 9.3438, 0.3312},
-	{0.6859, -15.3500, 9.3779, 0.3417},
-	{7.2311, -6.7954, -13.7344, 0.5641},
-	{6.1397, -7.9026, -13.4031, 0.5537},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{-0.5673, -4.7395, -7.3621, 0.5626},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{0.5962, 1.1958, -9.0417, 0.5931},
-	{20.4856, -10.3916, -8.0896, 0.5411},
-	{17.5388, -13.6704, -10.4353, 0.5214},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{-3.4096, 5.8519, -1.9252, 0.2386},
-	{-4.5776, 6.0464, -1.7322, 0.2346},
-	{-4.6419, 8.1669, -2.3560, 0.2539},
-	{-1.6118, 12.2198, 0.5036, 0.7983},
-	{-1.2279, 12.2291, 1.8707, 0.7908},
-	{-0.0238, 10.3640, 0.0562, 0.7833},
-	{-4.5776, 6.0464, -1.7322, 0.2346},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{11.6590, -5.8169, -2.1081, 0.2285},
-	{-12.7998, 18.6988, 17.5244, 0.5293},
-	{-14.8376, 18.6351, 15.1219, 0.5097},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{6.2136, -15.1842, 5.5655, 0.0426},
-	{6.6333, -14.0772, 5.4068, 0.0427},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{19.1037, -13.7912, -4.5492, 0.0855},
-	{18.2964, -12.9271, -2.7478, 0.0779},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{-13.0884, 9.7546, 19.4461, 0.8829},
-	{-13.0654, 10.6109, 19.6353, 0.8867},
-	{-14.8154, 10.6544, 18.2212, 0.8841},
-	{-5.7258, -3.4623, 10.9865, 0.0998},
-	{-5.3558, -3.3206, 8.8639, 0.1143},
-	{-5.7548, -1.8554, 9.5994, 0.1208},
-	{-4.1140, -12.9082, 17.9578, 0.2986},
-	{-3.8338, -11.1945, 17.8398, 0.2913},
-	{-5.1766, -12.2301, 18.3433, 0.2867},
-	{-2.8143, 19.2991, -4.1041, 0.1419},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-12.8820, 16.9456, 14.3941, 0.5253},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{-16.1837, -14.0899, 7.7824, 0.0426},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{12.9596, 8.6504, -12.8349, 0.7178},
-	{11.2782, 8.5208, -13.2772, 0.7163},
-	{12.4087, 8.9898, -13.1674, 0.7220},
-	{-5.1424, 17.9868, 4.0749, 0.1205},
-	{-3.9068, 17.0203, 2.7177, 0.1070},
-	{-5.6286, 18.2818, 2.8314, 0.1188},
-	{-11.2763, -4.3120, 3.1914, 0.1253},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{-3.8205, 3.5443, -1.0253, 0.2151},
-	{-4.2002, 2.5427, -0.0851, 0.2010},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-3.2580, -11.8695, 10.2641, 0.7313},
-	{-3.5419, -12.0626, 11.2357, 0.7264},
-	{-3.0351, 20.7927, -4.1365, 0.9026},
-	{-2.3956, 20.9802, -3.5110, 0.8975},
-	{-0.8419, 22.2036, -6.8040, 0.9055},
-	{-9.4803, 12.3522, 5.2508, 0.9654},
-	{-9.9824, 11.3279, 5.2837, 0.9759},
-	{-10.8556, 11.5331, 8.0795, 0.9650},
-	{-4.8640, 17.3333, 6.8541, 0.7906},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-3.6470, 18.9561, 6.4188, 0.8076},
-	{-15.4862, 11.8869, 14.3393, 0.7910},
-	{-14.4701, 10.7525, 13.6401, 0.7907},
-	{-15.1015, 11.2064, 12.7639, 0.7955},
-	{-14.4598, 18.0937, 11.8274, 0.6463},
-	{-14.3091, 18.2801, 13.1058, 0.6504},
-	{-14.0562, 19.5393, 13.3274, 0.6428},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-5.9280, 13.3316, -2.6581, 0.5379},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-10.1598, -14.0057, 1.6100, 0.1389},
-	{-11.3900, -13.1882, 3.0702, 0.1151},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{1.6623, -9.5868, 6.0928, 0.3910},
-	{2.5610, -9.5974, 5.6971, 0.3801},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{-9.2443, -3.8060, 2.9851, 0.1233},
-	{-10.7816, -3.4198, 3.2893, 0.1167},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{16.5026, 0.6838, -10.1659, 0.8730},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{16.1311, 3.9612, -12.7168, 0.9124},
-	{5.0994, -14.7806, 2.5423, 0.0321},
-	{5.5430, -15.0901, 1.9390, 0.0317},
-	{6.1296, -14.3129, 2.8526, 0.0323},
-	{17.9182, 10.0911, -12.8093, 0.4577},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{18.0389, 10.1497, -13.3565, 0.4592},
-	{-1.9653, -13.4975, 8.6495, 0.7386},
-	{-3.2580, -11.8695, 10.2641, 0.7313},
-	{-3.2417, -14.8505, 8.1421, 0.7259},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{-8.8358, 16.4585, 12.7067, 0.5831},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{-9.4989, 15.6880, 15.2625, 0.5962},
-	{6.0397, -16.1432, -6.0115, 0.3082},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{6.8770, -16.4242, -9.7199, 0.3341},
-	{-9.8863, -3.6202, 14.1223, 0.3601},
-	{-11.6078, -2.9673, 13.9009, 0.3631},
-	{-11.7350, -3.6301, 13.7731, 0.3554},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{0.2137, 17.1031, -0.0058, 0.8462},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{7.1357, -13.0246, 2.9627, 0.0432},
-	{6.7492, -13.6822, 3.4298, 0.0417},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{14.6388, -8.5181, -7.5916, 0.8051},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{15.4004, -7.5823, -8.0173, 0.8179},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{11.9613, -6.5006, -2.2015, 0.2330},
-	{-6.1421, 17.2667, 8.5627, 0.5428},
-	{-6.0694, 15.8669, 9.3110, 0.5395},
-	{-5.2348, 17.6435, 7.2606, 0.5335},
-	{5.5196, -15.3375, -10.0566, 0.3229},
-	{4.7194, -15.0873, -8.0987, 0.3110},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{-5.5530, -15.9135, -0.8765, 0.3198},
-	{-5.2963, -14.6150, -2.5473, 0.3320},
-	{-9.7649, 17.7221, 1.9883, 0.1142},
-	{-9.4342, 17.9511, 0.6917, 0.1117},
-	{-10.6137, 16.9895, 1.9262, 0.1256},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-14.6287, 16.5303, 14.2202, 0.5115},
-	{-15.0996, 15.1615, 13.2360, 0.5049},
-	{-13.9729, -5.4397, 3.9988, 0.0959},
-	{-13.7487, -5.1782, 5.3918, 0.0831},
-	{-13.0094, -3.9825, 4.7249, 0.0974},
-	{11.7100, -4.7876, -1.2849, 0.2214},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{2.9304, 12.4364, -6.1754, 0.6944},
-	{2.6548, 12.5272, -5.5084, 0.6901},
-	{2.8918, 11.5702, -5.6655, 0.6948},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.9330, -6.3697, -6.3282, 0.7610},
-	{3.7059, -5.5763, -9.7328, 0.7760},
-	{-12.4648, 11.2918, 15.8110, 0.9160},
-	{-11.8199, 11.7743, 16.7667, 0.9057},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{6.2600, -8.5717, -3.7011, 0.2957},
-	{5.4504, -10.3001, -3.7998, 0.3042},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{-6.5531, -5.5871, 2.5329, 0.4493},
-	{-5.7023, -5.3300, 1.5778, 0.4516},
-	{-6.8248, -6.4647, -0.1074, 0.4323},
-	{-4.6755, 12.7546, 7.1437, 0.7542},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{-4.5626, 13.6823, 7.1706, 0.7617},
-	{-4.5626, 13.6823, 7.1706, 0.5958},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{-6.0167, 13.5486, 7.5309, 0.5828},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-7.7953, 13.6238, 11.1325, 0.5672},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{-9.7910, 18.7287, 9.1524, 0.9631},
-	{-9.0450, 19.0239, 8.0409, 0.9499},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-9.6477, 12.8483, 0.4894, 0.7674},
-	{-10.5614, 13.3039, 1.4358, 0.7733},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{15.3091, 7.3063, -13.3422, 0.4468},
-	{15.0203, 6.6327, -12.5542, 0.4393},
-	{3.5420, -16.1792, -16.3830, 0.3571},
-	{4.2327, -14.5406, -15.7300, 0.3526},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{6.2015, -14.7169, -16.2630, 0.3662},
-	{-14.1250, 10.0048, 10.4961, 0.8016},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{12.4190, -5.0920, -2.1804, 0.2220},
-	{-5.4979, -6.3073, 13.3241, 0.4481},
-	{-7.5222, -5.7208, 13.5055, 0.4611},
-	{-6.6939, -8.2873, 13.3505, 0.4357},
-	{14.5693, -3.3949, -2.0728, 0.2113},
-	{13.4732, -3.6522, -2.8359, 0.2148},
-	{12.4356, 0.1557, -3.1347, 0.2182},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{13.4653, -7.4329, 2.5492, 0.1827},
-	{-3.1747, 2.4325, -0.3482, 0.6528},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-1.3541, -6.1225, 6.3068, 0.8641},
-	{-2.9254, -5.9912, 8.0761, 0.8826},
-	{-1.2166, -8.1388, 7.3111, 0.8568},
-	{9.9077, 7.5246, -14.5226, 0.7074},
-	{12.3068, 7.3203, -13.5831, 0.7033},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{-15.6423, 9.2485, 14.3285, 0.8151},
-	{-16.3219, 7.8515, 12.9625, 0.8116},
-	{-13.5612, 8.1108, 10.8602, 0.8266},
-	{-17.3025, -13.4300, 6.0066, 0.0430},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-16.4857, -13.9655, 4.0352, 0.0387},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{5.7750, -10.1268, -3.2066, 0.3000},
-	{5.8583, -9.3000, -2.7091, 0.2935},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{18.2357, 2.6241, -14.5739, 0.2351},
-	{17.1895, 3.0382, -13.9363, 0.2310},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-5.2595, -15.4103, 8.3997, 0.6981},
-	{2.7579, -11.6551, 4.0349, 0.3483},
-	{1.6899, -11.8764, 3.3873, 0.3312},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-7.8645, -11.8165, -3.2458, 0.1948},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{-4.2002, 2.5427, -0.0851, 0.2010},
-	{-5.4022, 3.3471, -0.3145, 0.2042},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{6.9485, -13.1409, -1.5811, 0.0278},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{-3.4256, -0.6095, -0.7740, 0.4812},
-	{-5.1508, -4.5724, -0.6738, 0.4517},
-	{-14.8111, 13.2315, 16.4871, 0.9499},
-	{-14.2719, 13.2783, 17.7108, 0.9453},
-	{-12.4072, 11.6707, 14.6539, 0.9428},
-	{-3.4554, 16.4095, 1.9054, 0.8878},
-	{-1.7754, 16.9885, 1.6025, 0.9035},
-	{0.0936, 17.0687, -0.7948, 0.9101},
-	{16.8042, 2.8506, -13.5943, 0.3965},
-	{17.1895, 3.0382, -13.9363, 0.3940},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{-5.7548, -1.8554, 9.5994, 0.1208},
-	{-5.3558, -3.3206, 8.8639, 0.1143},
-	{-5.9165, -3.7333, 5.1811, 0.1347},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-5.2595, -15.4103, 8.3997, 0.6981},
-	{-6.5106, -9.7525, 14.7792, 0.4172},
-	{-7.4621, -8.7753, 14.8099, 0.4272},
-	{-7.8838, -9.6927, 14.6962, 0.4254},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{6.5583, 8.0535, -3.0016, 0.7222},
-	{7.2660, 7.1829, -3.5873, 0.7325},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-15.9777, -11.3938, 5.7962, 0.0577},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{20.3088, 4.0338, -15.4419, 0.2502},
-	{18.8821, 5.3003, -15.8959, 0.2626},
-	{19.6713, 5.2036, -15.5143, 0.2607},
-	{-3.4256, -0.6095, -0.7740, 0.4812},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{-3.9636, -1.2419, 0.9111, 0.4917},
-	{-12.4730, 17.4973, 10.8080, 0.6236},
-	{-13.1322, 19.3910, 12.0976, 0.6346},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{3.3873, 10.6530, -3.6019, 0.6932},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{1.7081, 10.2578, -4.2031, 0.6789},
-	{-4.2002, 2.5427, -0.0851, 0.2010},
-	{-4.5269, 1.9740, 0.5355, 0.1904},
-	{-5.4022, 3.3471, -0.3145, 0.2042},
-	{-1.9112, -11.1936, 12.5903, 0.3569},
-	{-1.1760, -10.4132, 12.5473, 0.3688},
-	{-1.8075, -9.6083, 13.6573, 0.3748},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{11.7342, -5.6584, -2.1619, 0.2275},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{6.2015, -14.7169, -16.2630, 0.3662},
-	{8.1752, -13.9610, -14.5342, 0.3976},
-	{6.0478, -14.7572, -15.3357, 0.3698},
-	{5.7779, -9.9654, -3.0576, 0.2983},
-	{5.7810, -9.8947, -3.1973, 0.2990},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{15.0025, -9.8575, -7.9714, 0.1885},
-	{14.2918, -11.8568, -9.7028, 0.1662},
-	{13.6551, -10.3289, -8.1256, 0.1770},
-	{1.0083, -13.8803, 4.3449, 0.3265},
-	{0.6420, -14.4104, 4.6912, 0.3260},
-	{0.5318, -14.2932, 4.7045, 0.3259},
-	{7.3338, -9.6020, -14.6035, 0.3620},
-	{6.7415, -7.6320, -14.1992, 0.3485},
-	{7.7553, -7.7810, -14.4479, 0.3582},
-	{-8.2147, -15.1697, 5.5634, 0.6711},
-	{-7.4131, -14.9587, 7.6645, 0.6798},
-	{-9.6546, -15.6318, 6.0986, 0.6556},
-	{-3.2275, 6.6744, -2.4216, 0.2656},
-	{-3.2529, 8.6209, -1.6967, 0.2755},
-	{-3.4096, 5.8519, -1.9252, 0.2560},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{-10.2957, 11.8931, 0.9380, 0.7893},
-	{-9.6062, 10.9789, 0.2842, 0.8052},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{13.2425, 6.5375, -11.8364, 0.7713},
-	{14.2479, 5.9961, -13.3436, 0.7707},
-	{13.5308, 7.0843, -13.0842, 0.7820},
-	{-9.8863, -3.6202, 14.1223, 0.3601},
-	{-11.7350, -3.6301, 13.7731, 0.3554},
-	{-11.4139, -5.2576, 14.4202, 0.3412},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{5.6670, -10.8840, -3.4933, 0.3048},
-	{6.2106, -12.4636, -3.2128, 0.3081},
-	{-6.2313, 14.9946, -5.1307, 0.0322},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-5.7257, 13.0439, -5.9031, 0.0130},
-	{-3.9636, -1.2419, 0.9111, 0.4917},
-	{-4.9757, -4.3671, 0.8884, 0.4636},
-	{-4.5113, -2.9113, 1.7649, 0.4790},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{19.4195, 3.8726, -14.8441, 0.3910},
-	{20.3088, 4.0338, -15.4419, 0.3875},
-	{-11.2562, 9.6756, 18.9114, 0.8844},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{-10.3399, 8.3952, 17.0063, 0.8775},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-9.7587, 8.1353, 1.7902, 0.8561},
-	{-9.2074, 8.0057, 1.9418, 0.8645},
-	{12.3191, -9.1942, -2.0143, 0.2504},
-	{12.6605, -7.8214, -2.0916, 0.2371},
-	{14.1806, -8.9851, -0.7236, 0.2410},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{9.7517, 2.8258, -6.1310, 0.7167},
-	{9.1599, -1.9722, -5.5275, 0.6693},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{5.4586, -6.4858, -13.1710, 0.5681},
-	{4.5081, -10.1702, -12.2700, 0.5313},
-	{2.9304, 12.4364, -6.1754, 0.5700},
-	{2.2036, 11.0205, -6.6421, 0.5581},
-	{2.5005, 12.6733, -6.0545, 0.5629},
-	{-10.8816, 17.5993, 15.5396, 0.6125},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-11.0026, 17.2074, 16.4070, 0.6135},
-	{1.1090, -14.5516, 4.5875, 0.3266},
-	{1.0219, -15.0000, 4.7515, 0.3265},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{-11.4479, 18.6465, 9.2176, 0.9739},
-	{-10.3358, 18.6556, 5.1110, 0.9368},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{4.1772, -9.8102, -4.8229, 0.2923},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{11.5097, -9.9075, -2.5946, 0.7609},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{-8.6739, 17.5264, 0.4775, 0.1005},
-	{-8.3283, 18.5141, -2.4574, 0.0973},
-	{-8.8679, 19.8542, -2.8039, 0.1154},
-	{-11.6548, 18.2003, 7.7478, 0.9662},
-	{-11.0064, 18.0806, 5.3000, 0.9440},
-	{-12.2677, 17.6232, 5.6051, 0.9551},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-4.4607, 17.7891, 5.6935, 0.8028},
-	{-3.9698, 17.2277, 6.1559, 0.7962},
-	{14.1802, -0.9937, -11.1230, 0.7000},
-	{13.8530, -0.1599, -11.1608, 0.7058},
-	{14.0153, -1.8870, -11.2939, 0.6885},
-	{6.2015, -14.7169, -16.2630, 0.3662},
-	{6.8008, -13.6179, -16.3233, 0.3687},
-	{8.3424, -13.4454, -15.5782, 0.3916},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{-15.9777, -11.3938, 5.7962, 0.0577},
-	{-16.4933, -11.4182, 5.1380, 0.0579},
-	{13.5467, -3.7221, -11.0855, 0.5868},
-	{13.4514, -1.8334, -12.3691, 0.6076},
-	{14.0153, -1.8870, -11.2939, 0.6025},
-	{-14.8134, 10.7131, 11.9846, 0.7978},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{-1.7488, 15.0511, 0.4650, 0.8851},
-	{-3.4554, 16.4095, 1.9054, 0.8878},
-	{-1.6445, 15.5712, 0.4385, 0.8906},
-	{7.8408, -13.4051, -1.3213, 0.0270},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{-5.4022, 3.3471, -0.3145, 0.2042},
-	{-6.6893, 3.1425, -0.6262, 0.1996},
-	{-4.9676, 4.9415, -1.1882, 0.2221},
-	{6.6090, -12.7314, 0.6271, 0.0325},
-	{8.9535, -13.0259, 0.0785, 0.0505},
-	{7.9798, -12.4199, -0.5672, 0.0400},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-9.7932, 15.9822, -0.5432, 0.8058},
-	{-9.7820, 15.9348, -1.5339, 0.8029},
-	{-5.2348, 17.6435, 7.2606, 0.9233},
-	{-5.6919, 17.9576, 7.0778, 0.9210},
-	{-6.1421, 17.2667, 8.5627, 0.9360},
-	{-14.0077, -7.5467, 2.7546, 0.1029},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{-1.8086, 11.3231, 3.5388, 0.7723},
-	{-2.9910, 11.4120, 4.9298, 0.7611},
-	{11.9679, -5.5207, -2.2521, 0.2258},
-	{11.9448, -5.3209, -2.3063, 0.2251},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{-6.1888, -2.2413, 4.8812, 0.1480},
-	{-5.6964, -3.3373, 3.5129, 0.1472},
-	{-5.8261, -0.2308, 3.9424, 0.1679},
-	{1.1689, -13.1361, 10.0701, 0.3616},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{1.7087, -12.6144, 8.9620, 0.3685},
-	{7.7495, -16.1130, -3.9107, 0.2983},
-	{7.0770, -16.3347, -6.0022, 0.3086},
-	{8.8292, -15.9295, -4.5847, 0.3012},
-	{-0.1304, 2.7122, 1.0814, 0.1263},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{-2.0426, 2.2504, -0.0700, 0.1296},
-	{-5.9360, -14.0109, 11.8411, 0.6981},
-	{-6.7962, -13.7906, 12.5367, 0.6872},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{-12.3758, -11.0406, 13.0324, 0.2840},
-	{-13.7866, -10.0667, 11.4884, 0.2912},
-	{-13.3672, -11.3660, 11.3147, 0.2798},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{2.9738, -13.4960, 8.5257, 0.3585},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{-11.5568, 17.7195, 14.4826, 0.6168},
-	{-10.0839, 16.9240, 15.8865, 0.6035},
-	{-9.3592, 16.1508, 13.5334, 0.5892},
-	{1.6606, 2.4765, 1.3128, 0.1213},
-	{2.5758, 0.3187, 1.3016, 0.1027},
-	{3.5083, 0.9463, 0.2755, 0.1100},
-	{2.9247, -11.8082, 6.6610, 0.3693},
-	{2.9321, -10.9125, 6.7375, 0.3750},
-	{2.2573, -10.9310, 7.7785, 0.3822},
-	{12.5645, -10.4628, -2.0711, 0.2597},
-	{12.3191, -9.1942, -2.0143, 0.2504},
-	{12.8661, -10.1185, -1.5813, 0.2535},
-	{-12.2924, 17.0967, 16.7586, 0.5346},
-	{-12.4106, 15.9474, 16.4255, 0.5365},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{-11.0471, 7.7768, 3.7253, 0.8391},
-	{-10.6823, 9.2650, 4.7444, 0.8526},
-	{-12.4399, 7.6773, 6.3858, 0.8303},
-	{1.8526, -5.6215, -5.6168, 0.4346},
-	{2.8873, -2.6660, -6.0526, 0.4634},
-	{2.1731, -5.7060, -5.2275, 0.4324},
-	{13.7639, -6.3259, -1.7996, 0.2189},
-	{12.3049, -6.0644, -2.0922, 0.2274},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{-2.3956, 20.9802, -3.5110, 0.1641},
-	{-4.9357, 20.1317, 0.2527, 0.1708},
-	{-4.8320, 19.6742, 1.0510, 0.1666},
-	{7.3895, -4.1480, -5.2012, 0.6444},
-	{7.8717, -6.3096, -4.6083, 0.6240},
-	{8.9449, -4.8666, -5.2597, 0.6413},
-	{-14.9962, -13.8446, 1.9274, 0.0843},
-	{-15.7605, -14.3025, 4.0597, 0.0680},
-	{-16.0153, -14.2690, 1.5396, 0.0777},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2620, 1.8465, -12.1291, 0.8974},
-	{0.5416, -14.7577, 4.9211, 0.3256},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{11.7704, -6.0343, -2.1851, 0.2303},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{8.2056, -14.2358, -1.1659, 0.0263},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{9.9077, 7.5246, -14.5226, 0.6374},
-	{9.5217, 9.0918, -13.6644, 0.6392},
-	{-7.8423, -8.1706, 13.9791, 0.0418},
-	{-9.8863, -3.6202, 14.1223, 0.0725},
-	{-10.3590, -5.7197, 14.6062, 0.0525},
-	{10.0119, -15.1105, 1.8163, 0.0443},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{7.2285, -14.4412, 1.5781, 0.0390},
-	{-4.1768, 18.1862, -0.7833, 0.1453},
-	{-4.5869, 18.0077, -0.8042, 0.1426},
-	{-4.3666, 18.2778, -1.3709, 0.1418},
-	{-8.1640, -15.5292, 9.0067, 0.6730},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-10.9298, -15.2923, 7.8475, 0.6427},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{8.4669, -3.8403, -14.5670, 0.5971},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{-0.2912, 2.7386, -8.6407, 0.6119},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-6.4854, 22.2496, 1.8210, 0.1955},
-	{-7.9645, 18.8758, 2.9852, 0.1715},
-	{-6.7421, 18.9786, 3.8471, 0.1667},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{11.9617, -0.9758, -14.2655, 0.6212},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{-15.9954, 9.1100, 12.8836, 0.8069},
-	{-16.3234, 10.6144, 15.2969, 0.7990},
-	{-16.0199, 10.9984, 14.4985, 0.7966},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{10.0119, -15.1105, 1.8163, 0.0292},
-	{8.2056, -14.2358, -1.1659, 0.0019},
-	{13.5469, -9.9104, -3.4291, 0.7824},
-	{13.4557, -9.2055, -7.4906, 0.7920},
-	{11.2965, -9.1759, -5.2898, 0.7656},
-	{-3.7290, -2.4292, 1.7046, 0.8900},
-	{-4.5113, -2.9113, 1.7649, 0.8964},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{3.1266, -9.8244, -9.9774, 0.7347},
-	{4.4434, -6.3544, -12.2300, 0.7627},
-	{3.8133, -10.9201, -11.3600, 0.7389},
-	{7.4437, -1.0848, -6.3734, 0.8201},
-	{9.7517, 2.8258, -6.1310, 0.8430},
-	{8.2621, 1.8440, -7.1220, 0.8530},
-	{-10.6757, 13.3453, 5.3942, 0.5260},
-	{-10.8476, 13.3236, 5.6455, 0.5253},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-7.0319, 16.7905, -3.3772, 0.0615},
-	{-6.8885, 16.0867, -1.6234, 0.0682},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-4.5193, -4.6280, 3.7173, 0.8976},
-	{-4.6337, -4.4257, 7.6324, 0.9068},
-	{-2.9807, -4.9551, 6.1538, 0.8833},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-10.7255, 13.2299, 5.2475, 0.5248},
-	{-10.7356, 13.2678, 5.2796, 0.5252},
-	{6.2632, 3.1052, -10.7167, 0.6819},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{5.8119, 4.4519, -11.7949, 0.6789},
-	{-13.6333, 11.0685, 11.8969, 0.7939},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-1.4390, 12.7078, 3.0104, 0.7893},
-	{-2.7067, 13.0017, 4.6801, 0.7751},
-	{-2.0292, 12.1267, 3.1993, 0.7806},
-	{12.1583, 9.6234, -12.5125, 0.6694},
-	{12.9596, 8.6504, -12.8349, 0.6763},
-	{12.4087, 8.9898, -13.1674, 0.6688},
-	{0.2137, 17.1031, -0.0058, 0.8462},
-	{-1.7754, 16.9885, 1.6025, 0.8337},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-2.4610, 10.4681, 1.0558, 0.0358},
-	{-2.5806, 9.5378, 1.6786, 0.0317},
-	{-3.0850, 7.3498, 0.4457, 0.0217},
-	{-11.0354, -9.4953, 14.4719, 0.3000},
-	{-13.7866, -10.0667, 11.4884, 0.2912},
-	{-12.3758, -11.0406, 13.0324, 0.2840},
-	{-13.2106, -4.8603, 2.6326, 0.1109},
-	{-12.4982, -5.6931, 1.1097, 0.1253},
-	{-13.2773, -7.0027, 0.9435, 0.1219},
-	{6.8583, 2.2363, -8.9013, 0.8582},
-	{6.5974, 1.7343, -11.0098, 0.8552},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{-8.9582, 9.7324, 14.2500, 0.8815},
-	{-10.6505, 9.6297, 16.9299, 0.8845},
-	{-10.3945, 8.8220, 16.3228, 0.8763},
-	{-6.1699, 9.7728, 7.3287, 0.9120},
-	{-7.6342, 9.4864, 7.2458, 0.9006},
-	{-6.9668, 8.9693, 6.4013, 0.8997},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-11.3729, 8.5680, 3.3709, 0.8278},
-	{-4.6419, 8.1669, -2.3560, 0.2539},
-	{-4.5776, 6.0464, -1.7322, 0.2346},
-	{-5.7736, 6.8766, -2.2808, 0.2416},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{-2.0421, 0.8352, -6.9441, 0.6051},
-	{-7.8423, -8.1706, 13.9791, 0.0418},
-	{-9.7973, -8.2993, 14.5111, 0.0328},
-	{-8.3005, -8.7975, 14.1086, 0.0341},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-9.3935, 7.0172, 4.6010, 0.2055},
-	{-9.2074, 8.0057, 1.9418, 0.2270},
-	{-13.5491, 11.0623, 11.7669, 0.7938},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.7046, 11.2102, 11.3417, 0.7951},
-	{-5.0157, -9.4098, 18.4349, 0.3794},
-	{-5.2140, -10.0014, 17.2077, 0.3803},
-	{-5.1766, -12.2301, 18.3433, 0.3701},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{-11.7656, 16.0137, 16.2675, 0.5401},
-	{-11.1472, 15.1347, 15.5449, 0.5445},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-4.0442, -12.1336, -5.4742, 0.2403},
-	{-5.1341, -12.9625, -5.9302, 0.2268},
-	{15.7192, -16.0359, -9.7895, 0.0760},
-	{16.6912, -15.2830, -9.9006, 0.0878},
-	{15.5862, -16.2784, -8.8372, 0.0688},
-	{-5.2595, -15.4103, 8.3997, 0.6981},
-	{-8.1640, -15.5292, 9.0067, 0.6730},
-	{-7.4131, -14.9587, 7.6645, 0.6798},
-	{-1.8606, 9.5197, 1.6317, 0.7643},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{-2.2083, 9.7246, 2.9989, 0.7590},
-	{16.3644, 8.2019, -14.3585, 0.2981},
-	{17.8361, 8.3392, -14.8423, 0.3031},
-	{16.3759, 5.4022, -15.8353, 0.2638},
-	{-1.0330, -14.2897, 14.1703, 0.3374},
-	{-2.2096, -14.9441, 14.4689, 0.3333},
-	{-1.6805, -14.1400, 13.2937, 0.3375},
-	{-3.1260, 13.4372, 0.7263, 0.0641},
-	{-2.4610, 10.4681, 1.0558, 0.0358},
-	{-3.4315, 11.5938, -0.8806, 0.0385},
-	{20.5771, -6.1904, -9.3752, 0.5929},
-	{20.4856, -10.3916, -8.0896, 0.5680},
-	{19.7669, -8.0548, -10.6247, 0.5757},
-	{-12.4906, 14.1734, 4.7138, 0.7907},
-	{-10.4351, 14.2539, 0.5883, 0.7886},
-	{-11.1145, 13.6920, 1.3257, 0.7815},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-15.9777, -11.3938, 5.7962, 0.0577},
-	{-16.7531, -12.5768, 5.6890, 0.0489},
-	{4.6527, 2.0609, -7.3862, 0.5138},
-	{4.2029, 1.8077, -8.0605, 0.5107},
-	{4.4382, 1.8068, -7.1852, 0.5119},
-	{12.6893, -2.4044, -12.4130, 0.6009},
-	{10.8611, -6.1947, -10.6352, 0.5582},
-	{10.4554, -3.9144, -13.8823, 0.5928},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{0.5371, -1.9433, 2.9994, 0.0764},
-	{2.2102, -2.8264, 1.9789, 0.0696},
-	{-3.6084, 8.2459, 6.1939, 0.7271},
-	{-4.5353, 10.3089, 7.1983, 0.7321},
-	{-4.8594, 9.0884, 7.4120, 0.7198},
-	{14.6487, -14.4410, -1.5320, 0.0429},
-	{12.2527, -16.0877, -2.5494, 0.0180},
-	{16.3838, -15.9144, -3.5411, 0.0542},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{7.7509, -13.6759, -1.2492, 0.0269},
-	{13.9798, 1.5943, -11.8175, 0.8957},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{-15.3639, -12.0072, 5.9372, 0.0569},
-	{-15.1313, -12.5643, 7.3297, 0.0494},
-	{-14.9446, -11.8283, 7.1555, 0.0551},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{0.5583, -14.5254, 4.7335, 0.3256},
-	{0.5296, -14.6809, 4.6757, 0.3252},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.8406, -10.0729, -3.2700, 0.2999},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{-11.3042, 17.4615, 11.8723, 0.6112},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{-10.9185, 17.4243, 10.6973, 0.6025},
-	{12.0465, -5.4494, -2.2489, 0.2252},
-	{11.7177, -5.4951, -1.9905, 0.2262},
-	{12.0105, -5.4725, -2.2377, 0.2257},
-	{-16.2533, 10.0287, 16.8532, 0.8050},
-	{-16.7826, 9.0543, 15.6327, 0.8072},
-	{-15.6423, 9.2485, 14.3285, 0.8151},
-	{-4.2122, 11.6548, 6.1504, 0.7520},
-	{-3.3840, 9.6117, 5.6685, 0.7400},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{6.8035, 10.6094, -12.1665, 0.6164},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{14.2938, 1.5348, -11.9982, 0.8948},
-	{14.2823, 1.6384, -12.0414, 0.8960},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{-16.0086, 15.0928, 11.2505, 0.6753},
-	{-16.4007, 17.7258, 12.8735, 0.6674},
-	{-15.9215, 16.1249, 11.5135, 0.6668},
-	{-5.2607, -13.8363, 10.9635, 0.7070},
-	{-3.2417, -14.8505, 8.1421, 0.7259},
-	{-3.2580, -11.8695, 10.2641, 0.7313},
-	{-0.5031, 16.2072, 1.0332, 0.8370},
-	{-1.5924, 16.9474, 2.1661, 0.8284},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{2.9116, -5.0861, -4.1337, 0.4335},
-	{2.9027, -6.7402, -1.5080, 0.4070},
-	{2.1760, -7.2577, -3.9295, 0.4160},
-	{14.3638, -5.0764, 2.2277, 0.1985},
-	{14.7397, -7.0840, 1.6420, 0.1849},
-	{15.2881, -5.0925, 0.7464, 0.1993},
-	{14.0153, -1.8870, -11.2939, 0.5390},
-	{14.2867, -1.1365, -12.1842, 0.5497},
-	{14.8098, -2.5640, -10.6530, 0.5306},
-	{14.2517, 1.5260, -11.9701, 0.8946},
-	{13.8530, -0.1599, -11.1608, 0.8862},
-	{14.3568, 1.1217, -11.8395, 0.8908},
-	{6.6333, -14.0772, 5.4068, 0.0427},
-	{7.4745, -12.4565, 4.4019, 0.0435},
-	{6.8389, -13.8788, 4.3963, 0.0423},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{14.0837, -7.3474, -1.4411, 0.1947},
-	{14.8062, -5.5010, -1.6121, 0.2060},
-	{15.4431, -9.5359, -2.9302, 0.8005},
-	{15.6932, -10.2844, -1.9749, 0.7983},
-	{16.9785, -7.5101, -4.5312, 0.8244},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{-2.8558, 20.1247, -5.0393, 0.9146},
-	{-1.3207, 20.9402, -6.3941, 0.9120},
-	{-2.8143, 19.2991, -4.1041, 0.9199},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-6.8149, 9.0396, -2.3429, 0.0057},
-	{-7.7482, 8.9352, -3.7482, 0.0019},
-	{-8.5657, 6.9559, 6.1867, 0.4954},
-	{-8.0326, 8.5711, 5.6535, 0.5153},
-	{-9.3935, 7.0172, 4.6010, 0.5006},
-	{1.8234, -9.7317, -2.3379, 0.3857},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{-1.3049, -13.0380, 13.3464, 0.3427},
-	{-1.0330, -14.2897, 14.1703, 0.3374},
-	{-1.6805, -14.1400, 13.2937, 0.3375},
-	{6.9646, -12.7086, -15.8348, 0.3676},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{-7.2728, 15.1755, 12.1963, 0.5783},
-	{-7.3972, 13.9671, 11.5907, 0.5729},
-	{-4.8660, 14.5008, 7.3299, 0.6005},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{-0.1444, -0.5583, 2.5858, 0.0921},
-	{-11.5789, 7.8415, 3.4832, 0.8319},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{-10.9360, 7.7746, 3.2306, 0.8377},
-	{-8.6669, 16.8675, -2.0938, 0.0820},
-	{-8.3283, 18.5141, -2.4574, 0.0973},
-	{-8.2290, 16.8279, -1.5123, 0.0853},
-	{13.7823, -12.6365, -11.1707, 0.4520},
-	{14.5224, -13.0362, -12.1867, 0.4603},
-	{13.2540, -12.8488, -12.8420, 0.4433},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{6.5187, -12.1034, -15.3292, 0.3615},
-	{5.4030, -11.8653, -14.4697, 0.3470},
-	{1.0330, -14.8488, 4.7099, 0.3265},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{1.4146, -4.1184, 3.1420, 0.0535},
-	{1.8102, -7.4700, 3.2377, 0.0192},
-	{3.4023, -1.8623, 0.2152, 0.0819},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{4.1667, -9.7160, -4.8683, 0.2923},
-	{-3.2882, -14.0542, 16.8740, 0.3119},
-	{-4.1140, -12.9082, 17.9578, 0.2986},
-	{-5.9650, -14.7005, 17.0218, 0.3004},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{6.6333, -14.0772, 5.4068, 0.0427},
-	{6.2136, -15.1842, 5.5655, 0.0426},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{-13.0739, 13.1598, 5.2124, 0.6390},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-12.4906, 14.1734, 4.7138, 0.6315},
-	{7.8682, -15.8818, -6.0295, 0.7285},
-	{8.0290, -15.9706, -7.8603, 0.7269},
-	{12.7136, -15.8725, -7.8912, 0.7698},
-	{-1.6930, -7.7270, -6.3001, 0.5329},
-	{-3.4679, -9.3998, -5.3591, 0.5297},
-	{-3.3487, -5.8903, -5.8105, 0.5532},
-	{-13.8226, -11.5519, 6.6074, 0.0194},
-	{-13.8697, -12.1496, 7.0522, 0.0112},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{7.8408, -13.4051, -1.3213, 0.0270},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{7.7383, -13.8237, -1.2410, 0.0269},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{-6.9969, -13.3871, -5.6818, 0.2110},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{0.8438, -14.9755, 4.7421, 0.3267},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{0.8127, -15.5752, 4.9700, 0.3284},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{-9.4129, 9.0688, -0.3582, 0.8254},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{-0.3166, -14.4506, 4.6156, 0.3174},
-	{-11.3729, 8.5680, 3.3709, 0.8278},
-	{-10.9026, 10.4698, 2.8369, 0.8095},
-	{-9.8403, 8.4261, 0.8183, 0.8373},
-	{-10.0576, 13.2131, -0.4482, 0.7741},
-	{-10.5614, 13.3039, 1.4358, 0.7733},
-	{-11.1145, 13.6920, 1.3257, 0.7815},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{3.3873, 10.6530, -3.6019, 0.2048},
-	{1.7081, 10.2578, -4.2031, 0.2176},
-	{2.7397, -6.6878, 0.9006, 0.3924},
-	{4.1592, -0.2252, -3.6729, 0.4744},
-	{3.4023, -1.8623, 0.2152, 0.4423},
-	{10.5723, 0.4116, -5.8161, 0.6968},
-	{11.0840, -2.1811, -6.3387, 0.6729},
-	{12.6109, 0.0682, -7.4474, 0.6997},
-	{-1.9473, 17.2903, 3.4253, 0.8207},
-	{-3.3950, 17.5301, 4.0116, 0.8202},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{19.4949, 5.1635, -14.7504, 0.4003},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{19.4195, 3.8726, -14.8441, 0.3910},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{-4.4560, -3.6123, -3.3509, 0.5908},
-	{5.7686, -10.2340, -3.2831, 0.3010},
-	{5.7759, -10.1338, -3.2302, 0.3003},
-	{5.8434, -10.1165, -3.2845, 0.3004},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{1.5912, -15.6187, 4.8801, 0.3327},
-	{16.6170, 2.5289, -12.2647, 0.8977},
-	{16.7112, 1.6627, -13.8054, 0.8965},
-	{16.8042, 2.8506, -13.5943, 0.9095},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-9.1052, 9.0189, 4.4973, 0.8739},
-	{20.7877, -9.0926, -6.2108, 0.1300},
-	{20.1553, -9.7580, -4.6069, 0.1137},
-	{19.7660, -12.2128, -4.6087, 0.0976},
-	{16.6912, -15.2830, -9.9006, 0.5039},
-	{16.2911, -16.2725, -10.7365, 0.4904},
-	{16.7603, -15.9094, -11.8002, 0.4846},
-	{-3.2346, -5.3071, 11.1162, 0.4520},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{-2.9254, -5.9912, 8.0761, 0.4528},
-	{-3.3218, 1.9530, 0.0626, 0.6434},
-	{-3.1747, 2.4325, -0.3482, 0.6528},
-	{-3.4256, -0.6095, -0.7740, 0.6283},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{16.8039, -11.6417, -1.7451, 0.0724},
-	{17.0896, -9.3267, -2.6090, 0.0930},
-	{15.6932, -10.2844, -1.9749, 0.0728},
-	{-0.2912, 2.7386, -8.6407, 0.6119},
-	{0.5962, 1.1958, -9.0417, 0.5931},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-6.2107, 9.9377, -2.6858, 0.0110},
-	{-6.7890, 9.7713, -3.0974, 0.0080},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-4.6755, 12.7546, 7.1437, 0.7542},
-	{-4.5353, 10.3089, 7.1983, 0.7321},
-	{-3.3840, 9.6117, 5.6685, 0.7400},
-	{-2.9254, -5.9912, 8.0761, 0.4528},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{-1.2166, -8.1388, 7.3111, 0.4319},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{7.2055, -0.2363, -13.8788, 0.6318},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{3.7022, 2.6929, -9.2950, 0.5192},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{1.0488, -0.8718, -8.3470, 0.4870},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{-3.2346, -5.3071, 11.1162, 0.4520},
-	{-5.2451, -4.4035, 12.8185, 0.4623},
-	{0.5371, -1.9433, 2.9994, 0.8439},
-	{-0.4679, -3.3539, 3.7315, 0.8519},
-	{1.4146, -4.1184, 3.1420, 0.8351},
-	{-10.5900, 15.2479, 15.4488, 0.5477},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-11.2326, 16.5534, 17.0353, 0.5427},
-	{-2.9656, 20.0318, 4.2760, 0.8260},
-	{-3.5138, 17.3848, 4.9357, 0.8081},
-	{-3.0172, 19.5295, 3.0415, 0.8323},
-	{3.6591, -15.9668, -17.1929, 0.3570},
-	{4.2327, -14.5406, -15.7300, 0.3526},
-	{4.6125, -13.6330, -16.4045, 0.3486},
-	{-12.6683, 12.3101, 17.3168, 0.9059},
-	{-13.3202, 11.8223, 18.2672, 0.8977},
-	{-12.0131, 11.0407, 18.4551, 0.8942},
-	{-5.8711, 18.3209, 5.4078, 0.8771},
-	{-4.2001, 19.3315, 4.0430, 0.8997},
-	{-5.1424, 17.9868, 4.0749, 0.8853},
-	{-12.2754, 0.7893, 10.9750, 0.4023},
-	{-12.0306, -0.8041, 12.5914, 0.3841},
-	{-10.5638, 0.6253, 12.4290, 0.4002},
-	{11.6827, -4.4620, -0.7342, 0.2189},
-	{11.1755, -5.8092, -1.7041, 0.2312},
-	{10.4327, -6.2294, -1.3010, 0.2384},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{-3.0163, 8.7605, 2.8960, 0.7474},
-	{-3.4090, 9.9984, 4.9407, 0.7476},
-	{-3.6907, 8.9043, 5.4826, 0.7326},
-	{17.1895, 3.0382, -13.9363, 0.2310},
-	{16.8042, 2.8506, -13.5943, 0.2279},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{-7.3265, 15.5545, 11.1350, 0.5607},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-8.8358, 16.4585, 12.7067, 0.5831},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{12.1286, 10.2887, -12.0302, 0.8126},
-	{11.2181, 10.7934, -11.8837, 0.8047},
-	{6.0419, -14.2980, -1.0249, 0.0279},
-	{5.7368, -13.9272, 0.4908, 0.0279},
-	{4.9673, -14.9897, -0.2152, 0.0282},
-	{-8.0807, 18.4528, 9.7007, 0.9577},
-	{-7.7625, 17.8735, 10.9254, 0.9601},
-	{-7.5922, 18.1799, 9.1233, 0.9481},
-	{8.1387, 2.3922, -14.8666, 0.6566},
-	{7.4944, -2.2788, -14.4165, 0.6118},
-	{7.2055, -0.2363, -13.8788, 0.6318},
-	{4.2832, 1.3154, -7.2225, 0.5062},
-	{3.6203, -0.6153, -6.0371, 0.4833},
-	{2.3067, -1.3265, -7.4616, 0.4803},
-	{1.2794, -12.0556, 8.1840, 0.3793},
-	{1.5414, -11.3823, 7.5228, 0.3873},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{-7.0645, 21.8360, 1.3711, 0.8689},
-	{-6.0194, 23.2255, 0.0480, 0.8583},
-	{-7.1805, 20.2048, 0.8711, 0.8870},
-	{-9.3756, 13.4800, -1.2327, 0.7774},
-	{-9.4752, 14.8371, -1.8382, 0.7922},
-	{-8.8617, 13.6567, -2.7841, 0.7766},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{0.9282, -14.7437, 4.4997, 0.3269},
-	{0.5001, -14.7632, 4.7368, 0.3253},
-	{0.6714, -14.6124, 4.6683, 0.3257},
-	{-13.2358, 14.6663, 10.8140, 0.5137},
-	{-14.1466, 13.6146, 9.9796, 0.5013},
-	{-12.5500, 13.8732, 8.7463, 0.5142},
-	{17.7253, 4.4167, -15.6073, 0.2537},
-	{18.4667, 3.7664, -15.0333, 0.2444},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{11.6983, -15.0258, 1.4530, 0.0449},
-	{13.2842, -15.1610, 1.8744, 0.0472},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{14.2479, 5.9961, -13.3436, 0.9305},
-	{14.3765, 3.5262, -12.5860, 0.9122},
-	{15.2535, 4.4336, -12.4394, 0.9166},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-10.6823, 9.2650, 4.7444, 0.8651},
-	{-9.5038, 9.1775, 2.8702, 0.8637},
-	{-0.8757, -13.8952, -1.8687, 0.3462},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-16.7829, 17.5540, 13.3765, 0.4930},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{-11.5000, -11.4883, -0.0532, 0.1384},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{6.2864, 6.7230, -13.4818, 0.5998},
-	{-13.7866, -10.0667, 11.4884, 0.0228},
-	{-14.6607, -8.2925, 9.4719, 0.0376},
-	{-13.8697, -12.1496, 7.0522, 0.0112},
-	{4.9667, -12.4043, -12.2140, 0.3014},
-	{3.5467, -12.1224, -13.2989, 0.3189},
-	{3.5957, -12.6132, -13.9383, 0.3173},
-	{-8.8474, 8.9638, 4.9700, 0.8782},
-	{-9.1339, 9.0194, 5.2851, 0.8776},
-	{-9.1388, 9.0247, 5.0866, 0.8768},
-	{-4.2684, -13.2530, -3.7415, 0.2326},
-	{-6.0807, -16.0401, -2.8046, 0.2030},
-	{-6.1507, -16.1783, -4.5976, 0.2074},
-	{-1.1037, 5.5954, -1.4879, 0.1656},
-	{-1.6639, 3.9319, -0.8641, 0.1484},
-	{-0.2034, 4.2062, 0.3097, 0.1438},
-	{-4.4560, -3.6123, -3.3509, 0.4550},
-	{-4.2438, -5.4002, -4.8993, 0.4365},
-	{-5.6013, -7.4408, -3.5952, 0.4154},
-	{-4.2039, -9.4613, 19.2196, 0.3761},
-	{-3.6910, -10.0233, 18.8886, 0.3740},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{-1.3795, 10.6013, 2.0250, 0.7744},
-	{-1.6124, 9.8796, 2.4305, 0.7666},
-	{-1.6048, 9.9904, 0.9322, 0.7720},
-	{-13.3476, -0.4510, 6.4598, 0.1198},
-	{-11.0891, 2.0356, 3.3666, 0.1614},
-	{-12.3739, -1.1932, 4.6760, 0.1243},
-	{-1.3443, 4.8885, -6.7997, 0.6388},
-	{0.8369, 3.9820, -9.5500, 0.6111},
-	{-0.2912, 2.7386, -8.6407, 0.6119},
-	{-6.0329, 10.6207, -3.5943, 0.0140},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-6.0713, 11.8433, -4.4390, 0.0147},
-	{7.1357, -13.0246, 2.9627, 0.0373},
-	{9.8579, -13.1750, 1.4101, 0.0586},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{-14.8421, 11.2524, 18.0801, 0.8918},
-	{-13.8602, 12.2784, 17.5724, 0.9067},
-	{-14.7525, 11.8802, 17.4181, 0.9029},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-12.8464, 12.3786, 7.0869, 0.5063},
-	{-11.3528, 12.2641, 4.7835, 0.5150},
-	{-0.8695, -14.6563, 5.4264, 0.7450},
-	{-2.5991, -15.5903, 6.3945, 0.7242},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{6.8035, 10.6094, -12.1665, 0.6164},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{9.4310, -12.6926, -15.0130, 0.3991},
-	{7.6987, -11.6537, -15.7006, 0.3749},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{-2.8315, -15.2641, -1.9685, 0.3306},
-	{-3.4123, -11.7058, -4.5972, 0.3715},
-	{14.8098, -2.5640, -10.6530, 0.5306},
-	{14.2867, -1.1365, -12.1842, 0.5497},
-	{16.6136, -3.8818, -12.8358, 0.5299},
-	{-6.9969, -13.3871, -5.6818, 0.2110},
-	{-6.2708, -14.1430, -6.5240, 0.2143},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{-2.8026, -8.3895, 11.8084, 0.4238},
-	{1.2794, -12.0556, 8.1840, 0.3794},
-	{-10.7699, 11.5630, 12.1983, 0.9408},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-13.5502, 11.4646, 13.4272, 0.9579},
-	{1.0445, -14.6655, 4.5904, 0.3266},
-	{0.9089, -14.6580, 4.4811, 0.3266},
-	{0.8895, -14.6940, 4.6027, 0.3265},
-	{17.5388, -13.6704, -10.4353, 0.5214},
-	{17.4212, -12.2115, -10.7803, 0.5308},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{-4.4560, -3.6123, -3.3509, 0.5908},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{-4.2438, -5.4002, -4.8993, 0.5653},
-	{4.1697, -9.7254, -4.8714, 0.2922},
-	{4.2322, -9.8184, -4.8000, 0.2922},
-	{4.9971, -7.8016, -4.5740, 0.2924},
-	{-3.3678, 6.2014, 3.5409, 0.2252},
-	{-4.2318, 3.1596, 4.0097, 0.1979},
-	{-3.0850, 7.3498, 0.4457, 0.2525},
-	{16.2911, -16.2725, -10.7365, 0.4904},
-	{15.7192, -16.0359, -9.7895, 0.4984},
-	{11.7920, -15.9856, -10.6589, 0.4637},
-	{-12.8820, 16.9456, 14.3941, 0.5253},
-	{-13.7366, 16.8686, 14.8133, 0.5199},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{15.6932, -10.2844, -1.9749, 0.0728},
-	{14.6886, -12.6468, -1.1543, 0.0500},
-	{15.8735, -13.3156, -1.4386, 0.0568},
-	{-9.1351, -15.9701, -2.1212, 0.1799},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{-13.0768, -13.2217, 1.5997, 0.1103},
-	{0.0936, 17.0687, -0.7948, 0.9101},
-	{-0.6231, 15.9461, -0.2778, 0.9001},
-	{-1.6445, 15.5712, 0.4385, 0.8906},
-	{6.8244, -11.2663, -14.5883, 0.3634},
-	{5.4030, -11.8653, -14.4697, 0.3470},
-	{5.5093, -10.8981, -14.2069, 0.3446},
-	{-8.0807, 18.4528, 9.7007, 0.9577},
-	{-9.4637, 18.1300, 10.8893, 0.9728},
-	{-7.7625, 17.8735, 10.9254, 0.9601},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-10.6261, 7.9726, 3.6953, 0.8403},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{14.8098, -2.5640, -10.6530, 0.9874},
-	{16.0250, -4.7052, -8.5821, 0.9710},
-	{6.9677, 1.0667, -8.7550, 0.8447},
-	{6.5974, 1.7343, -11.0098, 0.8552},
-	{6.4395, 0.0270, -11.5685, 0.8380},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{6.2632, 3.1052, -10.7167, 0.6819},
-	{6.8583, 2.2363, -8.9013, 0.6850},
-	{-16.0086, 15.0928, 11.2505, 0.4897},
-	{-15.8173, 15.5995, 10.1785, 0.4825},
-	{-15.3480, 14.3281, 9.2437, 0.4848},
-	{-10.5157, 7.9850, 3.4374, 0.8399},
-	{-10.5628, 7.9757, 3.4591, 0.8401},
-	{-10.7867, 8.0620, 2.9362, 0.8378},
-	{18.1403, -11.2384, -10.9867, 0.5438},
-	{17.4212, -12.2115, -10.7803, 0.5308},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{18.4895, 6.9922, -15.7770, 0.2813},
-	{20.7836, 6.2748, -15.7469, 0.2722},
-	{20.4557, 5.7763, -16.1453, 0.2694},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{3.2252, -12.3793, 7.1455, 0.3646},
-	{3.5476, -14.4203, 7.4735, 0.3509},
-	{-6.5017, 9.9142, -3.1427, 0.0094},
-	{-6.7108, 9.8988, -3.1992, 0.0084},
-	{-6.6453, 9.8843, -3.2180, 0.0086},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{12.1132, -1.6393, -1.0587, 0.2149},
-	{11.5703, -2.4851, -1.4730, 0.2161},
-	{14.2918, -11.8568, -9.7028, 0.1662},
-	{13.7823, -12.6365, -11.1707, 0.1574},
-	{13.1002, -12.2492, -10.4372, 0.1538},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{8.1305, 11.9573, -9.0363, 0.7598},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-13.3954, 10.3307, 10.7151, 0.7948},
-	{-7.2728, 15.1755, 12.1963, 0.5610},
-	{-4.8660, 14.5008, 7.3299, 0.5242},
-	{-4.6971, 15.2349, 7.8126, 0.5215},
-	{-4.8198, 18.0222, -1.5566, 0.9220},
-	{-6.5693, 17.4267, -0.0351, 0.9197},
-	{-6.1743, 18.8810, -0.6204, 0.9057},
-	{2.2377, -10.1881, 3.5253, 0.3551},
-	{3.6683, -12.3695, 5.6964, 0.3573},
-	{2.7579, -11.6551, 4.0349, 0.3483},
-	{2.8918, 11.5702, -5.6655, 0.6948},
-	{2.6486, 10.9596, -4.7157, 0.6883},
-	{3.9959, 11.8253, -6.1238, 0.7056},
-	{6.6938, -12.3714, -1.3408, 0.2907},
-	{6.2106, -12.4636, -3.2128, 0.3081},
-	{6.9485, -13.1409, -1.5811, 0.2958},
-	{-11.5234, 15.0454, 15.0451, 0.5414},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-11.0423, 13.9311, 15.2030, 0.5463},
-	{-7.3159, -14.9281, 10.6520, 0.6807},
-	{-7.9911, -14.1694, 12.0448, 0.6768},
-	{-9.7077, -15.0751, 10.4995, 0.6661},
-	{6.0652, -13.2733, -1.3619, 0.0287},
-	{5.8931, -14.1146, -1.1852, 0.0281},
-	{4.8188, -14.9696, -0.7263, 0.0282},
-	{10.5792, 8.8619, -6.2095, 0.7699},
-	{9.3611, 10.8494, -6.8779, 0.7594},
-	{7.7184, 10.2760, -4.4253, 0.7360},
-	{8.8292, -15.9295, -4.5847, 0.7410},
-	{15.1032, -15.6144, -5.1526, 0.7972},
-	{15.7142, -16.0203, -4.2003, 0.8052},
-	{7.3495, -7.8825, -3.7080, 0.7491},
-	{6.1305, -5.9681, -4.7409, 0.7687},
-	{6.2600, -8.5717, -3.7011, 0.7428},
-	{-5.8639, -14.7476, 12.4751, 0.3213},
-	{-5.9360, -14.0109, 11.8411, 0.3219},
-	{-4.8899, -13.6344, 11.3395, 0.3387},
-	{11.8902, -13.4574, 1.2269, 0.0632},
-	{10.2738, -13.6534, 1.9413, 0.0547},
-	{10.0119, -15.1105, 1.8163, 0.0443},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{-6.0918, 14.1948, -7.0258, 0.7823},
-	{-5.5519, 13.3641, -7.4648, 0.7756},
-	{6.7415, -7.6320, -14.1992, 0.3485},
-	{6.1397, -7.9026, -13.4031, 0.3401},
-	{7.2311, -6.7954, -13.7344, 0.3467},
-	{0.3758, -14.1416, 2.0205, 0.3243},
-	{0.1877, -13.7181, -0.4856, 0.3417},
-	{1.9425, -10.7811, -0.0957, 0.3658},
-	{11.3898, 9.5885, -8.3339, 0.7846},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{10.3427, 10.6849, -10.1924, 0.7883},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{11.8405, -7.6519, 0.6353, 0.2150},
-	{14.3432, 0.4232, -13.4474, 0.5692},
-	{15.2447, -1.2590, -13.5010, 0.5522},
-	{14.2867, -1.1365, -12.1842, 0.5497},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-5.8625, 9.1580, 10.2919, 0.8705},
-	{-5.4808, 9.1277, 8.7743, 0.8645},
-	{14.8098, -2.5640, -10.6530, 0.9874},
-	{16.9817, -3.7512, -7.5745, 0.9594},
-	{15.3068, -1.7497, -10.4899, 0.9910},
-	{-7.1312, 6.7927, 7.2440, 0.4932},
-	{-6.9668, 8.9693, 6.4013, 0.5187},
-	{-8.0326, 8.5711, 5.6535, 0.5153},
-	{11.1638, -12.7838, 1.4828, 0.0762},
-	{11.8792, -9.2179, 1.6064, 0.1485},
-	{10.7685, -11.5465, 0.9382, 0.0923},
-	{-6.0953, 10.1029, -4.1608, 0.0089},
-	{-6.5093, 9.8563, -3.2525, 0.0088},
-	{-6.3928, 9.7681, -6.3590, 0.0018},
-	{-6.1421, 17.2667, 8.5627, 0.9360},
-	{-5.6919, 17.9576, 7.0778, 0.9210},
-	{-6.7820, 18.5176, 8.3488, 0.9377},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{2.5758, 0.3187, 1.3016, 0.1027},
-	{0.5672, 1.6332, 1.7871, 0.1129},
-	{16.1311, 3.9612, -12.7168, 0.4120},
-	{16.0176, 6.4151, -12.3729, 0.4375},
-	{15.2535, 4.4336, -12.4394, 0.4226},
-	{-7.8645, -11.8165, -3.2458, 0.2013},
-	{-5.7302, -10.4307, -3.5717, 0.2241},
-	{-7.4731, -11.2242, -4.6073, 0.2130},
-	{9.1778, -14.3305, -1.9546, 0.0260},
-	{8.2056, -14.2358, -1.1659, 0.0263},
-	{8.9170, -13.3225, -1.6060, 0.0265},
-	{-13.2861, 16.0678, 10.0361, 0.6371},
-	{-15.5231, 16.5355, 10.9839, 0.6588},
-	{-14.5351, 17.0043, 11.6655, 0.6509},
-	{-8.6669, 16.8675, -2.0938, 0.8156},
-	{-9.7820, 15.9348, -1.5339, 0.8029},
-	{-9.7932, 15.9822, -0.5432, 0.8058},
-	{3.4899, -10.4980, -6.1315, 0.7293},
-	{3.2195, -8.0422, -8.8112, 0.7500},
-	{3.4180, -12.2527, -7.1864, 0.7251},
-	{3.7059, -5.5763, -9.7328, 0.5918},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{3.4341, -7.2520, -10.4022, 0.5683},
-	{-6.7962, -13.7906, 12.5367, 0.6872},
-	{-7.8901, -13.2971, 12.4355, 0.6773},
-	{-7.2841, -13.9336, 11.9667, 0.6832},
-	{-9.4333, 16.2045, 11.2308, 0.5860},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-9.9193, 16.6433, 10.4346, 0.5893},
-	{20.7549, 9.4214, -14.0206, 0.4381},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{19.5309, 6.9339, -14.4090, 0.4183},
-	{7.3495, -7.8825, -3.7080, 0.7180},
-	{8.6869, -7.8374, -3.9421, 0.7319},
-	{7.8717, -6.3096, -4.6083, 0.7219},
-	{-13.0066, -13.0004, 10.1754, 0.0026},
-	{-13.7866, -10.0667, 11.4884, 0.0228},
-	{-13.8697, -12.1496, 7.0522, 0.0112},
-	{-10.6079, 15.0268, 13.0736, 0.5417},
-	{-9.9957, 14.6780, 14.2911, 0.5513},
-	{-11.0423, 13.9311, 15.2030, 0.5463},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-10.7522, 8.0480, 3.4262, 0.8408},
-	{-10.6261, 7.9726, 3.6953, 0.8403},
-	{-11.5000, -11.4883, -0.0532, 0.1340},
-	{-12.3038, -9.6536, -0.2082, 0.1359},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{4.0980, -11.1187, -4.9305, 0.2929},
-	{3.4899, -10.4980, -6.1315, 0.2929},
-	{4.6772, -13.7029, -5.0930, 0.2987},
-	{16.6223, 3.0472, -15.0082, 0.2387},
-	{18.4667, 3.7664, -15.0333, 0.2444},
-	{17.9231, 2.9307, -15.1797, 0.2390},
-	{4.7833, -14.0170, -17.6383, 0.3564},
-	{4.6125, -13.6330, -16.4045, 0.3486},
-	{5.3503, -13.4319, -15.8675, 0.3499},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-2.2630, 2.8849, -5.5154, 0.6294},
-	{-3.0331, 0.9932, -3.9316, 0.6206},
-	{13.6551, -10.3289, -8.1256, 0.1770},
-	{14.2918, -11.8568, -9.7028, 0.1662},
-	{12.2079, -9.3668, -8.0887, 0.1703},
-	{1.6623, -9.5868, 6.0928, 0.3910},
-	{1.2216, -7.8000, 6.0820, 0.4001},
-	{0.2773, -10.0645, 5.6429, 0.4054},
-	{-7.5440, -15.9269, -1.0982, 0.1856},
-	{-11.9540, -13.0669, 2.8997, 0.1109},
-	{-9.1351, -15.9701, -2.1212, 0.1799},
-	{-1.7488, 15.0511, 0.4650, 0.8851},
-	{0.2163, 13.8998, -0.9935, 0.8774},
-	{-2.0730, 13.6539, 0.4205, 0.8700},
-	{-14.0164, 16.4778, 12.9976, 0.5152},
-	{-13.3998, 16.9594, 13.6990, 0.5205},
-	{-14.6287, 16.5303, 14.2202, 0.5115},
-	{-7.8243, -7.8461, -0.7050, 0.4128},
-	{-5.7302, -10.4307, -3.5717, 0.3871},
-	{-8.2955, -9.4780, -0.7969, 0.3990},
-	{0.9623, -14.5218, 4.3858, 0.3268},
-	{1.0987, -14.2578, 4.3898, 0.3264},
-	{0.6907, -14.6145, 4.5606, 0.3257},
-	{-5.0157, -9.4098, 18.4349, 0.3794},
-	{-4.4049, -10.3551, 19.3219, 0.3746},
-	{-4.2039, -9.4613, 19.2196, 0.3761},
-	{-11.4139, -5.2576, 14.4202, 0.3412},
-	{-13.9057, -5.2088, 12.2115, 0.3416},
-	{-12.0376, -7.0010, 14.3549, 0.3227},
-	{-13.5543, 10.8563, 11.5477, 0.7939},
-	{-13.5942, 10.7741, 11.4446, 0.7941},
-	{-13.6339, 10.7889, 10.9343, 0.7957},
-	{-12.9262, -4.7566, 13.4325, 0.3446},
-	{-11.7350, -3.6301, 13.7731, 0.3554},
-	{-13.6590, -3.3670, 11.7522, 0.3584},
-	{-12.7705, 10.3638, 10.8589, 0.9740},
-	{-12.2558, 11.2063, 10.7976, 0.9642},
-	{-9.9824, 11.3279, 5.2837, 0.9759},
-	{-5.5519, 13.3641, -7.4648, 0.7756},
-	{-5.7257, 13.0439, -5.9031, 0.7664},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{15.3091, 7.3063, -13.3422, 0.2882},
-	{15.2706, 6.8616, -14.4437, 0.2809},
-	{14.4858, 6.5577, -13.7337, 0.2773},
-	{0.2163, 13.8998, -0.9935, 0.8774},
-	{0.4936, 13.5999, -0.5286, 0.8776},
-	{0.0272, 13.3004, -0.8503, 0.8735},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{17.2344, -6.3646, -11.5969, 0.5928},
-	{17.7315, -3.9778, -13.0607, 0.6184},
-	{-9.8403, 8.4261, 0.8183, 0.7258},
-	{-9.4129, 9.0688, -0.3582, 0.7311},
-	{-8.8486, 8.0071, 0.5674, 0.7176},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{5.1769, 9.8356, -12.2213, 0.5990},
-	{3.9110, 8.7137, -11.8679, 0.5839},
-	{-0.2747, 7.2703, -2.1575, 0.1816},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{-0.6178, 8.8296, -3.3505, 0.2001},
-	{-5.7445, -7.8728, -5.1948, 0.2623},
-	{-4.7684, -11.6717, -6.0052, 0.2384},
-	{-5.6884, -10.9949, -5.3392, 0.2364},
-	{-3.2963, -2.4603, -5.7834, 0.5854},
-	{-1.2229, -2.8064, -7.7015, 0.5698},
-	{-3.3487, -5.8903, -5.8105, 0.5532},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{-7.4385, -15.4578, -5.8877, 0.2049},
-	{-8.8926, -15.4262, -4.4866, 0.1933},
-	{-3.0351, 20.7927, -4.1365, 0.9026},
-	{-5.6338, 19.7575, -0.9304, 0.8979},
-	{-4.9357, 20.1317, 0.2527, 0.8863},
-	{-16.3890, 15.2945, 12.2995, 0.4933},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-14.9852, 14.4135, 11.2925, 0.4981},
-	{-10.8485, 12.1959, 14.8625, 0.9068},
-	{-11.2724, 11.1845, 13.9605, 0.9140},
-	{-11.1126, 11.2937, 15.5611, 0.9053},
-	{18.2812, -6.9962, -11.8129, 0.5866},
-	{17.7315, -3.9778, -13.0607, 0.6184},
-	{18.8393, -7.2961, -11.5697, 0.5851},
-	{0.5301, -10.3960, -3.8692, 0.3857},
-	{-0.8757, -13.8952, -1.8687, 0.3462},
-	{-1.3535, -11.7950, -4.1150, 0.3725},
-	{20.7549, 9.4214, -14.0206, 0.4381},
-	{18.5225, 7.9913, -12.9373, 0.4384},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{7.9336, -11.0571, -14.2245, 0.3760},
-	{7.3338, -9.6020, -14.6035, 0.3620},
-	{9.0410, -10.6755, -14.4063, 0.3838},
-	{4.6125, -13.6330, -16.4045, 0.3392},
-	{3.5938, -14.0647, -14.9438, 0.3280},
-	{3.5036, -12.9985, -16.0544, 0.3353},
-	{-10.3921, 5.2184, 5.6217, 0.1830},
-	{-9.3935, 7.0172, 4.6010, 0.2055},
-	{-10.1264, 5.5772, 3.1130, 0.1964},
-	{-17.3025, -13.4300, 6.0066, 0.0430},
-	{-16.4857, -13.9655, 4.0352, 0.0387},
-	{-16.8048, -14.0906, 5.1808, 0.0388},
-	{-11.3900, -13.1882, 3.0702, 0.6276},
-	{-10.1598, -14.0057, 1.6100, 0.6434},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-2.7957, -10.1990, 15.5953, 0.3116},
-	{-2.9906, -12.7535, 17.1323, 0.3083},
-	{-2.1208, -13.0904, 15.2665, 0.3293},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{6.4395, 0.0270, -11.5685, 0.6383},
-	{4.4434, -6.3544, -12.2300, 0.5699},
-	{3.7059, -5.5763, -9.7328, 0.5918},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{-12.4906, 14.1734, 4.7138, 0.7907},
-	{-11.0690, 16.0556, 1.8443, 0.8062},
-	{-9.8978, 16.6229, -0.1324, 0.8116},
-	{-0.8583, -8.1748, 9.1578, 0.4250},
-	{-2.0226, -7.3254, 11.1081, 0.4311},
-	{0.6709, -10.5695, 8.2635, 0.3984},
-	{-11.0891, 2.0356, 3.3666, 0.1614},
-	{-10.4500, -1.1084, 2.8281, 0.1385},
-	{-12.3739, -1.1932, 4.6760, 0.1243},
-	{9.8648, 10.5618, -12.0736, 0.6472},
-	{11.2181, 10.7934, -11.8837, 0.6613},
-	{10.7485, 9.5988, -12.8164, 0.6542},
-	{-10.6137, 16.9895, 1.9262, 0.8177},
-	{-9.4342, 17.9511, 0.6917, 0.8326},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{-2.3863, 5.5169, -1.6251, 0.6677},
-	{-2.6285, 2.2519, -1.9621, 0.6448},
-	{-2.7771, 3.5188, -0.9287, 0.6595},
-	{1.8221, -5.5747, -5.6844, 0.4352},
-	{1.8007, -5.6517, -5.6582, 0.4346},
-	{0.5501, -6.6270, -6.3347, 0.4278},
-	{-10.7816, -3.4198, 3.2893, 0.4447},
-	{-11.2763, -4.3120, 3.1914, 0.4345},
-	{-11.9983, -3.5871, 4.0195, 0.4333},
-	{12.1663, 9.3015, -11.7901, 0.8155},
-	{11.5331, 9.6068, -10.8102, 0.8039},
-	{12.7049, 7.9643, -11.6312, 0.8185},
-	{-6.7962, -13.7906, 12.5367, 0.6872},
-	{-7.4007, -12.7785, 13.4808, 0.6846},
-	{-7.8901, -13.2971, 12.4355, 0.6773},
-	{7.2918, 8.8996, -13.6351, 0.6174},
-	{9.5217, 9.0918, -13.6644, 0.6392},
-	{9.9077, 7.5246, -14.5226, 0.6374},
-	{12.0688, 10.1575, -12.5829, 0.8167},
-	{11.2181, 10.7934, -11.8837, 0.8047},
-	{12.1286, 10.2887, -12.0302, 0.8126},
-	{-13.0748, 8.1682, 8.5429, 0.8261},
-	{-14.5913, 7.9342, 10.7804, 0.8198},
-	{-13.6932, 8.5840, 8.5936, 0.8174},
-	{-10.7287, 13.3241, 5.6161, 0.5254},
-	{-10.8423, 13.3000, 5.6530, 0.5251},
-	{-10.7702, 13.2522, 5.3522, 0.5251},
-	{-6.4163, 12.4426, 9.4236, 0.9039},
-	{-7.3371, 12.2495, 10.3882, 0.9054},
-	{-5.9440, 10.5621, 9.6057, 0.8821},
-	{-14.3858, 14.0698, 7.8485, 0.4798},
-	{-13.0739, 13.1598, 5.2124, 0.4825},
-	{-15.3480, 14.3281, 9.2437, 0.4848},
-	{0.5879, 8.9598, -3.2617, 0.2018},
-	{1.7081, 10.2578, -4.2031, 0.2176},
-	{1.1812, 11.9400, -4.8896, 0.2335},
-	{8.8091, 11.3179, -11.4451, 0.6363},
-	{11.0841, 11.4103, -12.0361, 0.6571},
-	{9.8648, 10.5618, -12.0736, 0.6472},
-	{-16.2789, 13.4436, 19.3009, 0.9487},
-	{-15.9458, 13.5069, 17.4381, 0.9505},
-	{-15.9663, 12.9154, 17.5072, 0.9513},
-	{-16.1837, -14.0899, 7.7824, 0.0426},
-	{-15.7588, -13.7484, 6.1398, 0.0378},
-	{-15.3498, -14.0387, 7.1401, 0.0391},
-	{-5.0157, -9.4098, 18.4349, 0.3794},
-	{-4.2039, -9.4613, 19.2196, 0.3761},
-	{-4.0589, -9.1645, 17.4163, 0.3814},
-	{19.5309, 6.9339, -14.4090, 0.4183},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{20.9750, 5.8844, -15.4046, 0.4019},
-	{-1.3859, -4.7436, 5.1290, 0.8657},
-	{-1.2934, -2.9626, 3.4450, 0.8631},
-	{-2.6834, -4.0747, 3.8838, 0.8792},
-	{11.3199, 5.0059, -6.2512, 0.7793},
-	{9.5263, 5.6549, -5.3833, 0.7635},
-	{10.5673, 4.1132, -5.9404, 0.7732},
-	{-5.6919, 17.9576, 7.0778, 0.9210},
-	{-7.6646, 18.7388, 7.2641, 0.9348},
-	{-6.7820, 18.5176, 8.3488, 0.9377},
-	{-10.6125, 7.9863, 3.2678, 0.8395},
-	{-10.5628, 7.9757, 3.4591, 0.8401},
-	{-10.5954, 7.9714, 3.5221, 0.8402},
-	{-14.7364, -5.5286, 8.4094, 0.0675},
-	{-14.2558, -3.9795, 7.1195, 0.0871},
-	{-14.0837, -6.8521, 5.7232, 0.0618},
-	{-10.5876, 13.4822, 5.6036, 0.5266},
-	{-10.8043, 13.3746, 5.6629, 0.5257},
-	{-10.5960, 13.5623, 5.9886, 0.5278},
-	{-13.0884, 9.7546, 19.4461, 0.8829},
-	{-11.2288, 8.7374, 18.3723, 0.8799},
-	{-11.8749, 9.5391, 19.4097, 0.8836},
-	{-13.5785, 10.7818, 11.4880, 0.7941},
-	{-13.3759, 11.0364, 12.4156, 0.7935},
-	{-13.6039, 11.0513, 11.8879, 0.7938},
-	{11.8163, -5.9392, -2.1878, 0.2295},
-	{11.7588, -5.8343, -1.9829, 0.2289},
-	{11.9966, -5.9449, -2.1414, 0.2289},
-	{4.3121, 12.9834, -7.4063, 0.5861},
-	{4.9641, 13.0677, -8.4608, 0.5958},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{-11.7922, 3.1514, 5.9367, 0.4478},
-	{-10.9998, 4.0259, 7.8484, 0.4487},
-	{-10.0158, 5.0554, 7.8509, 0.4624},
-	{7.1277, 12.9565, -9.2771, 0.6192},
-	{7.3256, 11.8135, -10.5512, 0.6219},
-	{5.9545, 11.8975, -9.7167, 0.6075},
-	{14.2413, 1.8818, -12.1605, 0.8973},
-	{14.2224, 2.2518, -12.2509, 0.9009},
-	{14.2299, 1.7436, -12.0801, 0.8966},
-	{-11.0354, -9.4953, 14.4719, 0.3000},
-	{-13.7070, -9.3744, 12.3304, 0.3012},
-	{-13.7866, -10.0667, 11.4884, 0.2912},
-	{-0.1444, -0.5583, 2.5858, 0.0921},
-	{0.5371, -1.9433, 2.9994, 0.0764},
-	{1.8850, -0.8077, 2.0364, 0.0882},
-	{13.1479, -1.3589, -0.6657, 0.2132},
-	{11.7999, -1.9666, -0.0019, 0.2138},
-	{13.2761, -1.6414, 0.4335, 0.2115},
-	{16.8144, 7.2024, -12.1116, 0.4412},
-	{18.1750, 4.3097, -14.2603, 0.3993},
-	{19.0657, 6.5754, -13.6902, 0.4204},
-	{-12.5405, 12.3026, 5.6742, 0.4982},
-	{-14.2074, 13.1500, 8.9440, 0.4951},
-	{-13.0739, 13.1598, 5.2124, 0.4825},
-	{-15.0714, -13.0853, 1.2965, 0.0878},
-	{-16.8425, -12.8021, 1.7940, 0.0759},
-	{-13.3803, -11.9527, 1.1149, 0.1114},
-	{4.2656, -6.8950, -5.4206, 0.7571},
-	{3.9330, -6.3697, -6.3282, 0.7610},
-	{3.4899, -10.4980, -6.1315, 0.7293},
-	{-13.6319, -11.2348, 3.0889, 0.0912},
-	{-16.4105, -12.2949, 3.8123, 0.0589},
-	{-16.4933, -11.4182, 5.1380, 0.0579},
-	{0.8187, -15.0735, 4.8956, 0.3264},
-	{0.6017, -15.0481, 4.8041, 0.3261},
-	{0.8409, -15.0048, 4.6750, 0.3270},
-	{-9.5182, 9.3101, 4.3058, 0.8710},
-	{-9.1603, 8.9545, 4.9048, 0.8759},
-	{-9.1308, 9.0033, 4.9351, 0.8762},
-	{10.9877, -10.4792, -10.3544, 0.1428},
-	{13.1002, -12.2492, -10.4372, 0.1538},
-	{11.0356, -10.5086, -12.0589, 0.1435},
-	{7.6872, -13.4907, -2.3808, 0.3061},
-	{7.8408, -13.4051, -1.3213, 0.2991},
-	{6.9485, -13.1409, -1.5811, 0.2958},
-	{-3.5671, 8.8851, -2.4176, 0.2640},
-	{-3.4177, 8.9106, -2.0054, 0.2670},
-	{-3.2275, 6.6744, -2.4216, 0.2486},
-	{-13.6933, 10.6624, 12.4149, 0.7931},
-	{-13.2640, 11.0752, 12.2144, 0.7930},
-	{-14.1186, 11.0897, 11.8935, 0.7952},
-	{-10.3590, -5.7197, 14.6062, 0.3324},
-	{-11.4139, -5.2576, 14.4202, 0.3412},
-	{-12.0376, -7.0010, 14.3549, 0.3227},
-	{10.5052, 5.0839, -15.2997, 0.6804},
-	{8.2491, 5.1440, -14.7678, 0.6833},
-	{8.3254, 6.7137, -14.6254, 0.6990},
-	{-2.9577, 15.0647, 4.3734, 0.7945},
-	{-1.3468, 14.6962, 2.4091, 0.8110},
-	{-1.4582, 15.2349, 1.8349, 0.8209},
-	{-5.3801, 14.9274, -1.4422, 0.5563},
-	{-7.3770, 16.6115, -0.9756, 0.5794},
-	{-5.3487, 17.2728, 0.1648, 0.5832},
-	{-5.5519, 13.3641, -7.4648, 0.0053},
-	{-5.5554, 14.2622, -6.8740, 0.0135},
-	{-5.7257, 13.0439, -5.9031, 0.0130},
-	{19.0091, -6.1027, -4.9983, 0.9236},
-	{18.9866, -2.5262, -8.1504, 0.9526},
-	{17.7778, -2.6473, -7.5944, 0.9582},
-	{-6.3602, 15.5921, -4.9454, 0.0373},
-	{-6.3409, 14.6128, -3.0854, 0.0436},
-	{-6.2313, 14.9946, -5.1307, 0.0322},
-	{-6.4221, 13.4068, -6.8726, 0.7746},
-	{-5.7257, 13.0439, -5.9031, 0.7664},
-	{-6.0713, 11.8433, -4.4390, 0.7519},
-	{8.9958, -14.4963, 3.6326, 0.0441},
-	{7.0343, -14.3935, 3.1022, 0.0400},
-	{7.2285, -14.4412, 1.5781, 0.0390},
-	{-13.3832, 19.3209, 16.4978, 0.6446},
-	{-13.5837, 19.1655, 14.5919, 0.6422},
-	{-15.6712, 18.9649, 14.5346, 0.6617},
-	{13.0597, -4.0224, -11.0636, 0.5821},
-	{13.3282, -3.7156, -10.7981, 0.5719},
-	{11.4715, -6.9738, -9.8564, 0.5492},
-	{-0.8695, -14.6563, 5.4264, 0.3168},
-	{0.4043, -14.6937, 4.8372, 0.3252},
-	{0.5833, -14.9287, 4.8163, 0.3259},
-	{-7.8931, -15.7594, 2.7509, 0.6748},
-	{-10.4447, -15.2611, 4.2961, 0.6469},
-	{-8.5647, -15.5069, 1.8687, 0.6644},
-	{4.6316, 11.8351, -8.6114, 0.5911},
-	{3.2369, 10.6172, -9.7323, 0.5780},
-	{3.2913, 11.6817, -7.4313, 0.5734},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{4.7116, 3.4303, -1.4022, 0.6461},
-	{5.1374, 2.4670, -4.6470, 0.6514},
-	{9.6277, -9.3126, 0.4589, 0.2463},
-	{9.2682, -8.1809, 0.1404, 0.2471},
-	{7.6997, -10.3350, -0.1901, 0.2684},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{5.9169, -12.4713, 1.9970, 0.0354},
-	{5.8071, -13.0907, 2.7111, 0.0344},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{3.3873, 10.6530, -3.6019, 0.6932},
-	{3.5084, 8.9761, -1.7717, 0.6939},
-	{7.1523, 4.0680, -5.7822, 0.6746},
-	{6.1832, 3.6827, -5.2672, 0.6627},
-	{6.3325, 2.7990, -8.2380, 0.6757},
-	{-8.7033, 16.2062, 11.5139, 0.5773},
-	{-9.4333, 16.2045, 11.2308, 0.5860},
-	{-10.3666, 16.7026, 12.7049, 0.5967},
-	{11.2175, -0.3489, -15.0601, 0.6296},
-	{11.0273, 2.1142, -15.4468, 0.6525},
-	{12.0782, 2.8686, -14.9459, 0.6586},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{15.3529, -14.5875, -13.2144, 0.4666},
-	{17.4212, -12.2115, -10.7803, 0.5002},
-	{-10.3590, -5.7197, 14.6062, 0.0525},
-	{-9.8863, -3.6202, 14.1223, 0.0725},
-	{-11.4139, -5.2576, 14.4202, 0.0592},
-	{7.4503, -13.5698, -1.1902, 0.0271},
-	{7.9397, -14.0164, -1.2880, 0.0266},
-	{6.9877, -14.1246, -1.2603, 0.0274},
-	{-10.3331, 18.2096, -1.5932, 0.8296},
-	{-8.8679, 19.8542, -2.8039, 0.8423},
-	{-9.1907, 18.6702, -2.0833, 0.8301},
-	{-2.2107, -2.1324, 2.2530, 0.8734},
-	{-3.1424, -2.1742, 1.2848, 0.8830},
-	{-3.8360, -4.0075, 2.2455, 0.8908},
-	{16.9335, -8.6897, -9.8031, 0.5633},
-	{16.4153, -7.7792, -8.8455, 0.5687},
-	{16.3969, -5.8303, -10.0012, 0.5907},
-	{-16.2533, 10.0287, 16.8532, 0.8050},
-	{-14.8154, 10.6544, 18.2212, 0.8022},
-	{-16.6372, 10.4729, 16.0508, 0.8012},
-	{-4.5788, 11.6399, -2.3799, 0.5200},
-	{-5.6394, 11.2143, -2.7466, 0.5161},
-	{-4.7449, 13.4000, -1.9784, 0.5383},
-	{-8.9130, -11.0273, -2.4950, 0.1808},
-	{-11.3509, -8.3408, -0.9427, 0.1461},
-	{-10.5491, -6.9071, 0.0045, 0.1483},
-	{-9.7820, 15.9348, -1.5339, 0.8029},
-	{-8.6669, 16.8675, -2.0938, 0.8156},
-	{-8.6857, 16.6325, -3.2761, 0.8097},
-	{-5.8729, 16.4362, -6.8259, 0.0305},
-	{-6.4156, 16.9751, -6.7188, 0.0351},
-	{-5.9204, 16.9396, -6.5831, 0.0342},
-	{5.9169, -12.4713, 1.9970, 0.0354},
-	{6.4831, -12.3670, 2.5929, 0.0368},
-	{6.6090, -12.7314, 0.6271, 0.0375},
-	{9.2682, -8.1809, 0.1404, 0.2471},
-	{11.5286, -6.9468, 0.7154, 0.2166},
-	{11.7170, -5.5727, 0.2155, 0.2187},
-	{8.3078, -14.4570, 4.9951, 0.0433},
-	{7.5319, -14.4712, 5.2406, 0.0429},
-	{7.0576, -14.8434, 4.6898, 0.0425},
-	{-2.2540, -8.4004, 14.2087, 0.3912},
-	{-2.9079, -8.8871, 15.3225, 0.3844},
-	{-2.7957, -10.1990, 15.5953, 0.3683},
-	{6.9485, -13.1409, -1.5811, 0.0278},
-	{6.2769, -14.0534, -1.7819, 0.0281},
-	{6.3033, -13.7563, -1.6823, 0.0281},
-	{6.0478, -14.7572, -15.3357, 0.3698},
-	{4.4404, -16.0428, -16.6574, 0.3579},
-	{5.3424, -15.9946, -17.0634, 0.3589},
-	{-12.8051, 15.3194, 7.5782, 0.6279},
-	{-12.3915, 14.6835, 6.3907, 0.6302},
-	{-13.3749, 15.1322, 7.4686, 0.6365},
-	{4.9667, -12.4043, -12.2140, 0.3020},
-	{6.9856, -14.9644, -11.2372, 0.3339},
-	{4.5838, -13.5717, -10.7383, 0.3095},
-	{5.8119, 4.4519, -11.7949, 0.6789},
-	{5.3873, 3.4200, -9.9207, 0.6709},
-	{3.6900, 4.9223, -11.1604, 0.6617},
-	{15.2535, 4.4336, -12.4394, 0.4226},
-	{15.0203, 6.6327, -12.5542, 0.4393},
-	{14.2479, 5.9961, -13.3436, 0.4362},
-	{-9.1890, -12.1088, -2.7824, 0.1787},
-	{-7.8471, -12.8962, -4.2548, 0.2015},
-	{-8.3668, -13.8579, -4.8058, 0.1969},
-	{9.8500, -15.0849, -1.4270, 0.0203},
-	{11.3671, -14.2139, -1.2936, 0.0394},
-	{11.6966, -13.4392, -0.3092, 0.0615},
-	{15.3529, -14.5875, -13.2144, 0.4666},
-	{16.6360, -15.5142, -12.7430, 0.4779},
-	{13.8470, -16.2725, -14.3344, 0.4557},
-	{8.1864, 6.2096, -4.4641, 0.7467},
-	{7.1523, 4.0680, -5.7822, 0.7509},
-	{7.7965, 3.1330, -6.9403, 0.7635},
-	{-1.1804, -15.5428, 0.7072, 0.7357},
-	{-1.2165, -15.5867, 4.1932, 0.7380},
-	{-4.0728, -16.0338, -0.9999, 0.7059},
-	{-12.8786, -1.5072, 11.7612, 0.3770},
-	{-14.1231, -2.1933, 8.5906, 0.3739},
-	{-14.2540, -3.1432, 10.2030, 0.3635},
-	{6.9307, 11.4862, -5.4838, 0.7322},
-	{5.1124, 12.0512, -6.7810, 0.7193},
-	{4.7414, 11.1258, -3.9495, 0.7069},
-	{-7.4007, -12.7785, 13.4808, 0.2908},
-	{-7.5928, -9.6273, 13.5417, 0.3218},
-	{-8.2183, -9.5714, 12.4432, 0.3228},
-	{-3.4177, 8.9106, -2.0054, 0.2861},
-	{-5.2041, 12.9544, -1.1914, 0.3303},
-	{-4.6053, 13.0205, -2.1252, 0.3268},
-	{14.0837, -7.3474, -1.4411, 0.1947},
-	{14.1806, -8.9851, -0.7236, 0.1671},
-	{12.6605, -7.8214, -2.0916, 0.1939},
-	{12.3191, -9.1942, -2.0143, 0.2504},
-	{12.5645, -10.4628, -2.0711, 0.2597},
-	{11.5097, -9.9075, -2.5946, 0.2627},
-	{12.8661, -10.1185, -1.5813, 0.2535},
-	{12.3191, -9.1942, -2.0143, 0.2504},
-	{14.1806, -8.9851, -0.7236, 0.2410},
-	{-7.8901, -13.2971, 12.4355, 0.2861},
-	{-7.4007, -12.7785, 13.4808, 0.2908},
-	{-8.2183, -9.5714, 12.4432, 0.3228},
-	{-3.0851, 9.5759, -2.8310, 0.2892},
-	{-3.4177, 8.9106, -2.0054, 0.2861},
-	{-4.6053, 13.0205, -2.1252, 0.3268},
-};
-
-VECTOR normals_dragon[9696] = {
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.1161, 0.5786, 0.8073, 0.6060},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.1331, 0.5679, 0.8123, 0.5677},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{0.8455, -0.2186, 0.4873, 0.2268},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{-0.3307, 0.5962, -0.7316, 0.9134},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{-0.8875, 0.1416, -0.4384, 0.9113},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{-0.1994, -0.9560, 0.2153, 0.7297},
-	{0.1707, -0.9829, 0.0693, 0.7558},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{-0.0854, -0.7503, -0.6556, 0.1217},
-	{-0.0675, 0.9886, -0.1342, 0.8853},
-	{0.2730, 0.8253, 0.4943, 0.8860},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.8154, -0.5622, -0.1381, 0.6133},
-	{0.9722, 0.1887, 0.1386, 0.6112},
-	{0.5580, -0.4338, 0.7074, 0.6110},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{-0.1006, -0.3306, -0.9384, 0.5758},
-	{-0.3021, -0.8740, -0.3807, 0.8787},
-	{-0.4063, -0.8914, -0.2009, 0.8692},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{0.9302, -0.3645, -0.0428, 0.2514},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.9205, -0.2688, -0.2836, 0.2578},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{-0.3436, -0.4323, -0.8337, 0.1659},
-	{-0.5694, -0.0739, -0.8188, 0.1717},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{-0.8570, 0.5126, -0.0526, 0.1302},
-	{-0.7215, 0.6525, -0.2318, 0.1547},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{-0.3218, -0.3970, 0.8596, 0.7132},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{-0.8362, -0.4198, 0.3530, 0.7120},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{-0.3043, -0.9223, 0.2380, 0.9685},
-	{-0.4577, -0.5685, 0.6836, 0.9594},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.9463, -0.2772, 0.1661, 0.4722},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.9793, -0.0393, -0.1984, 0.4578},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{0.8682, 0.1707, 0.4659, 0.8883},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.9008, -0.0111, 0.4341, 0.3660},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.0218, 0.6616, -0.7495, 0.9276},
-	{-0.4078, 0.6986, -0.5879, 0.9322},
-	{0.1800, 0.6143, -0.7683, 0.9402},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.8023, 0.3144, 0.5074, 0.2986},
-	{0.8363, 0.3359, 0.4334, 0.3015},
-	{-0.0360, 0.4841, 0.8743, 0.6930},
-	{-0.9191, 0.3542, 0.1726, 0.6935},
-	{0.0822, 0.9898, 0.1159, 0.7006},
-	{-0.4653, 0.0260, -0.8848, 0.6952},
-	{-0.9191, 0.3542, 0.1726, 0.6935},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{0.8118, -0.4978, -0.3052, 0.5538},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{-0.1001, -0.8332, -0.5439, 0.3372},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{-0.6658, 0.5287, 0.5265, 0.7597},
-	{-0.9487, -0.2730, -0.1598, 0.5735},
-	{-0.9846, -0.0281, -0.1725, 0.5612},
-	{-0.8252, 0.1046, 0.5551, 0.5807},
-	{0.2493, -0.0521, -0.9670, 0.4027},
-	{0.2589, 0.0997, -0.9608, 0.3885},
-	{0.8804, -0.3887, -0.2718, 0.3997},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{0.4580, 0.6135, 0.6433, 0.7609},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{0.9063, 0.1697, 0.3870, 0.0355},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{0.2183, 0.5054, 0.8348, 0.5737},
-	{-0.4254, -0.2550, -0.8684, 0.8815},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{0.0344, -0.8183, -0.5737, 0.8790},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{-0.4354, 0.5439, -0.7174, 0.9030},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.2507, 0.4647, -0.8493, 0.1770},
-	{0.7470, 0.4675, -0.4727, 0.1875},
-	{0.3238, 0.3169, -0.8914, 0.1782},
-	{0.4693, -0.0563, -0.8812, 0.3195},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{-0.6125, -0.7885, -0.0558, 0.9427},
-	{-0.9929, -0.1185, 0.0031, 0.9567},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.0541, 0.7990, 0.5989, 0.7183},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{0.8773, -0.3136, -0.3632, 0.9441},
-	{0.7666, -0.6420, 0.0103, 0.9208},
-	{0.8213, -0.5612, -0.1021, 0.9243},
-	{0.6755, -0.3762, -0.6342, 0.5545},
-	{0.6514, -0.3862, -0.6531, 0.5536},
-	{-0.0610, -0.3610, -0.9306, 0.5666},
-	{0.6797, -0.4199, 0.6014, 0.7670},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.2788, 0.9589, 0.0518, 0.2640},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.7787, 0.4834, -0.3999, 0.2496},
-	{0.1318, -0.1373, -0.9817, 0.1819},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.1006, -0.3306, -0.9384, 0.1914},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.7532, 0.1973, 0.6275, 0.7311},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{0.7192, -0.6694, -0.1863, 0.4911},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.9568, -0.2573, -0.1352, 0.5092},
-	{-0.7292, 0.2842, 0.6225, 0.3365},
-	{-0.9547, -0.0224, 0.2968, 0.3380},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{-0.4223, 0.8225, -0.3809, 0.7106},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{0.0367, 0.9992, 0.0168, 0.2616},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{0.7043, 0.2073, 0.6789, 0.2814},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.3158, 0.8806, 0.3533, 0.2813},
-	{-0.2241, 0.5052, 0.8334, 0.9749},
-	{-0.7379, 0.4419, 0.5101, 0.9849},
-	{0.1361, 0.4282, 0.8934, 0.9717},
-	{0.9244, 0.0952, -0.3693, 0.0839},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{0.8572, 0.3182, -0.4049, 0.0898},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{0.5240, -0.6781, -0.5153, 0.7309},
-	{0.2967, -0.9529, 0.0635, 0.3597},
-	{0.2820, -0.9484, -0.1451, 0.3463},
-	{-0.0585, -0.9638, -0.2600, 0.3690},
-	{-0.7958, -0.3691, -0.4801, 0.1387},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{-0.8846, -0.0062, -0.4664, 0.1242},
-	{0.1788, 0.9561, -0.2323, 0.2317},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{-0.1438, 0.6836, -0.7156, 0.2337},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{0.0925, 0.9692, 0.2281, 0.7025},
-	{0.0822, 0.9898, 0.1159, 0.7047},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.9004, 0.1637, -0.4031, 0.9800},
-	{-0.9039, 0.0524, -0.4245, 0.9966},
-	{-0.9214, 0.3077, -0.2376, 0.9751},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{0.6238, 0.7294, 0.2807, 0.1275},
-	{-0.3479, 0.8329, 0.4303, 0.1219},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{0.1174, -0.7612, -0.6379, 0.0498},
-	{0.3561, -0.6832, 0.6376, 0.0505},
-	{0.3497, -0.9030, -0.2498, 0.0574},
-	{-0.6773, -0.5073, -0.5329, 0.2265},
-	{-0.5859, -0.2830, -0.7594, 0.2245},
-	{-0.8471, -0.2198, -0.4838, 0.2382},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.0458, 0.1274, 0.9908, 0.5804},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.0290, -0.9995, 0.0120, 0.8147},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{-0.2741, -0.9499, 0.1502, 0.8008},
-	{-0.9885, 0.1506, -0.0125, 0.1215},
-	{-0.6863, 0.0094, 0.7273, 0.1195},
-	{-0.8993, -0.4372, 0.0133, 0.1225},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{-0.1571, -0.7974, 0.5827, 0.6408},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{-0.1835, -0.7883, -0.5874, 0.7915},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.1475, 0.8808, -0.4499, 0.6093},
-	{-0.1059, 0.9577, -0.2675, 0.5897},
-	{-0.1707, 0.5758, -0.7996, 0.5982},
-	{0.8362, 0.1292, 0.5330, 0.6043},
-	{0.5903, 0.0384, 0.8063, 0.5831},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{0.2402, 0.0276, -0.9703, 0.9163},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.9991, 0.0368, 0.0202, 0.5335},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{0.3832, 0.6734, 0.6322, 0.0637},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{-0.0066, 0.9694, 0.2453, 0.9291},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{-0.3597, 0.0793, 0.9297, 0.1981},
-	{0.2953, -0.6258, 0.7219, 0.2111},
-	{-0.4223, 0.8225, -0.3809, 0.7106},
-	{-0.3868, 0.9184, -0.0836, 0.7279},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{0.5081, -0.8163, -0.2747, 0.8238},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{0.0290, -0.9995, 0.0120, 0.8147},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{-0.3527, 0.5343, -0.7682, 0.9121},
-	{0.5883, 0.8078, -0.0369, 0.1343},
-	{0.5541, 0.8229, 0.1259, 0.1186},
-	{0.3088, 0.9352, 0.1734, 0.1222},
-	{0.8682, 0.1707, 0.4659, 0.3106},
-	{0.7801, -0.2337, 0.5804, 0.3139},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{-0.9675, 0.2481, -0.0487, 0.6170},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{0.8682, 0.1707, 0.4659, 0.3106},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{-0.6611, 0.7252, 0.1925, 0.2809},
-	{-0.8481, 0.3567, -0.3918, 0.2891},
-	{-0.4565, 0.8811, 0.1235, 0.2891},
-	{-0.9642, 0.2629, 0.0357, 0.9318},
-	{-0.0066, 0.9694, 0.2453, 0.9291},
-	{-0.8496, 0.5161, -0.1091, 0.9444},
-	{0.8883, -0.3035, -0.3446, 0.7267},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.3334, 0.3195, -0.8870, 0.5501},
-	{-0.0543, 0.4619, -0.8853, 0.5708},
-	{0.7779, 0.6218, 0.0908, 0.5521},
-	{-0.8468, 0.0758, 0.5264, 0.7154},
-	{-0.1095, 0.9075, 0.4055, 0.7151},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.8939, -0.2588, 0.3660, 0.2410},
-	{0.9302, -0.3645, -0.0428, 0.2514},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{-0.3095, 0.9433, -0.1196, 0.7035},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{-0.0107, -0.9588, -0.2839, 0.0731},
-	{-0.3709, -0.6859, 0.6261, 0.0580},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.7772, -0.3624, 0.5144, 0.3298},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{0.8903, 0.1264, 0.4375, 0.1235},
-	{0.8020, -0.1630, 0.5747, 0.1427},
-	{0.7932, -0.0642, 0.6056, 0.1529},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{-0.3296, -0.9391, 0.0976, 0.6237},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.9050, 0.0097, -0.4252, 0.6888},
-	{-0.7317, 0.6214, 0.2801, 0.5529},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{0.1800, 0.6143, -0.7683, 0.9402},
-	{-0.3037, 0.6004, -0.7398, 0.9543},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{0.3468, 0.7679, -0.5386, 0.6382},
-	{0.3704, -0.0645, -0.9266, 0.6324},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{0.8749, -0.4637, -0.1399, 0.1542},
-	{0.7304, 0.6044, -0.3182, 0.1686},
-	{0.7147, 0.5899, -0.3757, 0.1637},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{0.0548, -0.3023, -0.9516, 0.4989},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.2307, 0.7129, 0.6623, 0.3352},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.7598, -0.3354, 0.5570, 0.8018},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{-0.0723, -0.9856, -0.1527, 0.2158},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{0.2034, -0.8014, -0.5624, 0.7090},
-	{-0.0749, -0.9885, -0.1310, 0.7124},
-	{-0.7417, -0.6107, -0.2774, 0.7100},
-	{0.7585, 0.3987, 0.5155, 0.6034},
-	{0.9037, 0.3671, 0.2205, 0.6224},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{0.7793, 0.2321, 0.5821, 0.1282},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{0.7463, 0.5882, -0.3115, 0.4499},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{0.5075, 0.7911, -0.3416, 0.4214},
-	{0.9048, 0.4256, 0.0146, 0.6409},
-	{0.8830, 0.4098, 0.2289, 0.6364},
-	{0.9037, 0.3671, 0.2205, 0.6224},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{-0.4666, 0.4578, 0.7568, 0.0171},
-	{-0.1392, 0.2158, 0.9665, 0.0137},
-	{-0.9093, 0.3754, 0.1795, 0.8041},
-	{-0.3868, 0.9184, -0.0836, 0.7279},
-	{-0.5559, 0.8207, 0.1320, 0.7804},
-	{-0.1808, -0.8793, -0.4406, 0.6816},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.4704, -0.7134, -0.5194, 0.6851},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.6635, 0.7231, -0.1923, 0.7824},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{0.2671, 0.9552, -0.1271, 0.8686},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{-0.9996, 0.0183, -0.0197, 0.7675},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{0.6916, 0.7202, 0.0548, 0.1342},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{0.6162, 0.6719, -0.4108, 0.1237},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{0.1007, -0.4912, -0.8652, 0.5573},
-	{0.6109, -0.6349, -0.4729, 0.5540},
-	{0.8221, -0.5535, -0.1334, 0.5519},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.5761, 0.3515, 0.7379, 0.8901},
-	{0.3981, 0.4950, 0.7723, 0.2013},
-	{-0.1331, 0.5679, 0.8123, 0.1933},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.9517, -0.0684, -0.2993, 0.1370},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{-0.6125, -0.7885, -0.0558, 0.3739},
-	{-0.4063, -0.8914, -0.2009, 0.3925},
-	{0.2760, 0.9216, 0.2729, 0.6566},
-	{0.8275, 0.1032, 0.5519, 0.6505},
-	{0.0971, 0.3053, 0.9473, 0.6541},
-	{0.1007, -0.4912, -0.8652, 0.5573},
-	{0.8118, -0.4978, -0.3052, 0.5538},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{-0.8496, 0.5161, -0.1091, 0.9444},
-	{-0.3856, 0.6785, 0.6253, 0.9421},
-	{-0.6136, 0.0291, 0.7891, 0.9528},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{-0.9885, 0.1506, -0.0125, 0.6743},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{-0.3082, 0.3755, -0.8741, 0.3123},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{-0.5859, -0.2830, -0.7594, 0.6015},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{0.4707, -0.8229, 0.3184, 0.7198},
-	{-0.0843, -0.2271, 0.9702, 0.5514},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{0.1351, 0.6363, 0.7595, 0.5533},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{-0.7380, 0.0921, 0.6685, 0.3357},
-	{-0.5259, 0.2486, 0.8134, 0.3363},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.7317, 0.6214, 0.2801, 0.1707},
-	{-0.7108, 0.4588, 0.5332, 0.1844},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.7185, 0.6771, -0.1586, 0.1686},
-	{-0.3698, 0.9243, 0.0950, 0.1708},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{-0.9405, 0.2829, -0.1882, 0.6179},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{-0.7993, 0.5004, 0.3329, 0.7339},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.6941, 0.4384, 0.5710, 0.8986},
-	{0.5761, 0.3515, 0.7379, 0.8901},
-	{-0.4917, -0.7379, 0.4623, 0.6825},
-	{-0.6851, -0.7041, -0.1867, 0.6707},
-	{-0.1835, -0.7467, -0.6393, 0.6762},
-	{0.6894, 0.7049, 0.1667, 0.8951},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{0.7428, 0.1567, 0.6510, 0.6005},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.2852, 0.8849, 0.3684, 0.0615},
-	{0.7864, 0.5650, 0.2497, 0.0766},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{-0.2241, 0.5052, 0.8334, 0.3308},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{-0.5204, 0.5779, 0.6287, 0.3289},
-	{-0.2045, 0.5912, 0.7801, 0.9552},
-	{-0.5862, 0.5134, 0.6267, 0.9694},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{-0.5247, -0.4905, -0.6957, 0.1229},
-	{0.1214, -0.3144, -0.9415, 0.1111},
-	{0.6716, 0.5691, 0.4744, 0.6173},
-	{0.2075, 0.4652, 0.8605, 0.5884},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.9287, -0.2848, 0.2374, 0.8391},
-	{-0.3289, 0.0834, 0.9407, 0.0248},
-	{-0.9306, -0.2509, 0.2666, 0.0218},
-	{-0.6724, 0.1679, 0.7209, 0.0321},
-	{-0.4218, 0.8652, -0.2710, 0.5194},
-	{-0.7818, 0.5826, -0.2221, 0.5277},
-	{-0.7548, 0.5797, -0.3070, 0.5179},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.9190, -0.3578, -0.1655, 0.0445},
-	{0.1174, -0.7612, -0.6379, 0.0498},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{-0.4911, 0.1951, 0.8490, 0.7440},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{0.9464, -0.2549, -0.1986, 0.0952},
-	{0.6203, 0.7636, 0.1792, 0.1012},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.8275, 0.4334, -0.3569, 0.2750},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{-0.4014, -0.9129, 0.0744, 0.7213},
-	{0.7043, 0.2073, 0.6789, 0.2814},
-	{0.3158, 0.8806, 0.3533, 0.2813},
-	{0.2308, 0.8675, 0.4406, 0.2773},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{-0.9846, -0.0281, -0.1725, 0.0798},
-	{-0.9206, 0.3127, -0.2339, 0.0843},
-	{-0.6851, -0.7041, -0.1867, 0.6942},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{-0.1835, -0.7467, -0.6393, 0.6949},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{0.0899, 0.5360, 0.8394, 0.1372},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{-0.0110, 0.5258, 0.8506, 0.1456},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{-0.4933, -0.8223, -0.2836, 0.8319},
-	{0.5380, -0.8428, -0.0177, 0.8318},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{0.4705, -0.2263, -0.8529, 0.0989},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{-0.2721, -0.9622, 0.0151, 0.1370},
-	{0.0745, -0.9969, -0.0259, 0.1644},
-	{0.6941, 0.4384, 0.5710, 0.4384},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{0.4746, 0.3089, 0.8242, 0.4422},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{0.8094, -0.0293, 0.5866, 0.3156},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{0.7870, 0.1409, -0.6007, 0.7646},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{-0.6860, 0.2373, -0.6879, 0.8844},
-	{-0.7951, -0.5325, 0.2903, 0.2382},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{-0.5845, -0.5686, 0.5788, 0.2552},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{0.0329, 0.9376, 0.3462, 0.2409},
-	{0.0934, 0.7683, -0.6332, 0.2168},
-	{-0.8153, 0.4576, 0.3547, 0.3612},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.8980, 0.2954, 0.3262, 0.3727},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{-0.7319, 0.1277, -0.6694, 0.1853},
-	{-0.6930, 0.0767, -0.7168, 0.2044},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{0.1922, 0.9435, 0.2700, 0.4690},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{-0.8413, -0.0416, -0.5389, 0.8336},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.9093, 0.3754, 0.1795, 0.8041},
-	{0.7742, 0.2596, 0.5773, 0.3530},
-	{0.7325, 0.1673, 0.6599, 0.3627},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{0.4159, 0.3398, -0.8436, 0.9345},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{0.6528, -0.0657, -0.7547, 0.1017},
-	{0.8572, 0.3182, -0.4049, 0.0937},
-	{0.9146, 0.1285, -0.3833, 0.0845},
-	{-0.1977, 0.8256, -0.5285, 0.2592},
-	{0.2730, 0.8253, 0.4943, 0.2633},
-	{-0.0675, 0.9886, -0.1342, 0.2578},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{0.7889, -0.5424, 0.2889, 0.3742},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{0.8930, -0.3670, 0.2605, 0.3812},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{-0.2280, 0.7995, 0.5557, 0.9237},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.7889, -0.5424, 0.2889, 0.3742},
-	{0.2766, -0.9403, -0.1984, 0.7956},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{0.4838, -0.8688, 0.1050, 0.7982},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{0.7278, -0.3236, 0.6047, 0.9806},
-	{0.3980, -0.7242, 0.5632, 0.9902},
-	{-0.1856, -0.9124, 0.3648, 0.6256},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{0.4704, -0.7134, -0.5194, 0.2185},
-	{0.5308, -0.6575, -0.5347, 0.1948},
-	{0.0675, -0.9023, -0.4257, 0.2012},
-	{-0.7639, 0.2401, -0.5990, 0.3829},
-	{-0.6158, -0.0817, -0.7837, 0.3727},
-	{0.0108, -0.0932, -0.9956, 0.3946},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{-0.6136, 0.0291, 0.7891, 0.9528},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{-0.4577, -0.5685, 0.6836, 0.9594},
-	{0.8820, 0.4305, -0.1916, 0.4137},
-	{0.2760, 0.9216, 0.2729, 0.4080},
-	{0.3518, 0.3483, -0.8689, 0.4164},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.9087, -0.0823, 0.4094, 0.3632},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{0.3238, -0.8445, -0.4265, 0.8734},
-	{-0.8010, 0.4273, -0.4192, 0.9938},
-	{-0.6226, 0.6446, -0.4437, 0.9772},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{0.1024, 0.5979, 0.7950, 0.9409},
-	{0.4573, 0.2614, 0.8500, 0.9597},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.7177, -0.4829, -0.5017, 0.0676},
-	{0.9603, -0.2203, 0.1710, 0.0774},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{0.0869, 0.0972, 0.9915, 0.4572},
-	{0.1301, -0.0722, 0.9889, 0.4699},
-	{0.2312, 0.3824, 0.8946, 0.4856},
-	{0.8073, 0.3940, 0.4394, 0.3233},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.3911, 0.8852, -0.2517, 0.3265},
-	{0.8930, -0.3670, 0.2605, 0.4845},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.7192, -0.6694, -0.1863, 0.4911},
-	{-0.5321, 0.4244, -0.7326, 0.6066},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{-0.3478, 0.0471, -0.9364, 0.5975},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{0.0079, -0.8955, 0.4450, 0.6503},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.9302, -0.3645, -0.0428, 0.2514},
-	{-0.0585, -0.9638, -0.2600, 0.8847},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{0.4746, 0.3089, 0.8242, 0.8995},
-	{0.5761, 0.3515, 0.7379, 0.8901},
-	{0.6941, 0.4384, 0.5710, 0.8986},
-	{-0.8570, 0.5126, -0.0526, 0.3984},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{-0.9259, 0.3032, -0.2253, 0.3837},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.7927, 0.6095, -0.0127, 0.7270},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{0.1024, 0.5979, 0.7950, 0.9409},
-	{-0.3062, 0.3674, 0.8782, 0.6809},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{-0.6090, -0.0175, 0.7930, 0.6864},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.5742, -0.7735, -0.2683, 0.6341},
-	{-0.5329, 0.3905, -0.7507, 0.1734},
-	{-0.4116, 0.6903, -0.5951, 0.1658},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{-0.9478, 0.3159, 0.0427, 0.5097},
-	{-0.9545, 0.2860, 0.0851, 0.4888},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{-0.7070, -0.3078, 0.6367, 0.7256},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.3532, -0.5085, -0.7853, 0.1845},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{0.5308, -0.6575, -0.5347, 0.1948},
-	{-0.8840, 0.3199, 0.3408, 0.4949},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.9547, -0.0224, 0.2968, 0.4949},
-	{-0.0727, 0.7955, 0.6016, 0.4689},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{0.6407, -0.4697, -0.6073, 0.4288},
-	{0.9588, -0.2231, 0.1757, 0.4234},
-	{0.9727, 0.1849, 0.1403, 0.4232},
-	{0.8648, -0.0650, 0.4979, 0.6319},
-	{0.9727, 0.1849, 0.1403, 0.6352},
-	{0.9588, -0.2231, 0.1757, 0.6414},
-	{-0.2266, 0.8250, -0.5177, 0.9843},
-	{-0.4548, 0.5328, -0.7136, 0.9680},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.1745, 0.8170, 0.5497, 0.8556},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{-0.4933, -0.8223, -0.2836, 0.8319},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{0.2402, 0.0276, -0.9703, 0.9163},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{0.5272, -0.2673, -0.8066, 0.4243},
-	{0.5240, -0.6781, -0.5153, 0.4336},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{-0.5559, 0.8207, 0.1320, 0.2637},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{0.4815, -0.8623, -0.1567, 0.7968},
-	{0.0187, -0.9425, -0.3336, 0.8099},
-	{0.2615, -0.7676, -0.5852, 0.8184},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.1571, -0.7974, 0.5827, 0.6408},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{-0.5808, -0.1282, -0.8039, 0.4143},
-	{0.1558, -0.0906, -0.9836, 0.4196},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{-0.1835, -0.7883, -0.5874, 0.7915},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.8563, 0.5164, -0.0107, 0.9361},
-	{-0.0947, 0.9861, -0.1367, 0.9558},
-	{0.8203, 0.4864, -0.3010, 0.9512},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{0.2469, 0.9653, -0.0853, 0.1667},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{-0.5259, 0.2486, 0.8134, 0.3363},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{0.8591, -0.3939, -0.3267, 0.4599},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.7162, -0.5213, -0.4640, 0.5509},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.0816, -0.5218, -0.8492, 0.5645},
-	{-0.8279, -0.4407, 0.3468, 0.9001},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.4354, 0.5439, -0.7174, 0.9030},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{-0.4195, -0.8771, -0.2340, 0.7835},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.1749, 0.4767, 0.8615, 0.7842},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.6471, 0.2960, 0.7026, 0.8241},
-	{0.6635, 0.7231, -0.1923, 0.1072},
-	{0.6162, 0.6719, -0.4108, 0.1237},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.0929, -0.9668, 0.2381, 0.7218},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{-0.0365, -0.9854, 0.1665, 0.7150},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{0.2967, -0.9529, 0.0635, 0.9066},
-	{0.4448, -0.8666, 0.2262, 0.9156},
-	{0.7666, -0.6420, 0.0103, 0.9208},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{0.7793, 0.2321, 0.5821, 0.1282},
-	{0.3154, -0.2677, 0.9104, 0.1251},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{0.3691, -0.7519, 0.5463, 0.6325},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{0.3088, 0.9352, 0.1734, 0.1222},
-	{0.5541, 0.8229, 0.1259, 0.1186},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{-0.9775, -0.0590, -0.2026, 0.9604},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.9004, 0.1637, -0.4031, 0.9800},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{-0.9793, -0.0393, -0.1984, 0.3517},
-	{-0.9929, -0.1185, 0.0031, 0.3633},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{0.0978, -0.8102, 0.5780, 0.6999},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{0.7940, -0.5722, -0.2055, 0.0990},
-	{0.6664, -0.6028, -0.4388, 0.1060},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{0.8562, 0.0205, -0.5163, 0.4652},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{0.1762, -0.9844, -0.0040, 0.2266},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{0.3532, -0.5085, -0.7853, 0.6200},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{0.3973, -0.9077, 0.1354, 0.6119},
-	{0.6845, -0.0171, 0.7288, 0.6045},
-	{0.3973, -0.9077, 0.1354, 0.6119},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{-0.6739, 0.2329, -0.7011, 0.0896},
-	{0.5845, 0.0351, -0.8106, 0.0897},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{-0.6860, -0.4591, -0.5645, 0.7613},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.6819, 0.6370, -0.3594, 0.9574},
-	{-0.3037, 0.6004, -0.7398, 0.9543},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.7076, -0.5762, 0.4089, 0.8983},
-	{-0.0091, -0.9999, 0.0097, 0.9006},
-	{0.8867, 0.3875, 0.2523, 0.6303},
-	{0.9221, 0.2930, 0.2526, 0.6127},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{0.6756, 0.2814, -0.6814, 0.1049},
-	{-0.3128, -0.1142, 0.9429, 0.2788},
-	{0.0869, 0.0972, 0.9915, 0.2870},
-	{-0.5087, -0.1668, 0.8447, 0.2735},
-	{0.5618, 0.3684, -0.7407, 0.5487},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.5257, -0.5779, -0.6242, 0.5424},
-	{0.6514, -0.3862, -0.6531, 0.5394},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.5637, 0.8259, -0.0093, 0.4955},
-	{-0.4218, 0.8652, -0.2710, 0.5194},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.7262, 0.0241, 0.6871, 0.0284},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{0.7843, -0.3281, 0.5266, 0.6508},
-	{0.9588, -0.2231, 0.1757, 0.6414},
-	{0.6407, -0.4697, -0.6073, 0.6462},
-	{0.7407, 0.4998, -0.4489, 0.7607},
-	{0.4580, 0.6135, 0.6433, 0.7609},
-	{0.8891, 0.4550, -0.0491, 0.7608},
-	{-0.8718, -0.2590, -0.4158, 0.5040},
-	{-0.5586, -0.0152, -0.8293, 0.4896},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{-0.3479, 0.8329, 0.4303, 0.1219},
-	{-0.5655, -0.2409, 0.7888, 0.1219},
-	{0.1707, -0.9829, 0.0693, 0.7046},
-	{-0.4510, -0.8506, -0.2702, 0.7095},
-	{0.0643, -0.9978, 0.0182, 0.7288},
-	{0.7278, -0.3236, 0.6047, 0.0527},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.3980, -0.7242, 0.5632, 0.0715},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{0.0548, -0.3023, -0.9516, 0.3446},
-	{-0.0934, -0.3215, -0.9423, 0.3694},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.4178, -0.9083, -0.0217, 0.2776},
-	{0.2820, -0.9484, -0.1451, 0.3020},
-	{0.3532, -0.5085, -0.7853, 0.1845},
-	{0.5308, -0.6575, -0.5347, 0.1948},
-	{0.5742, -0.7735, -0.2683, 0.2153},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{0.7711, 0.2752, 0.5742, 0.7097},
-	{0.8867, -0.0356, 0.4610, 0.3217},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{-0.4510, -0.8506, -0.2702, 0.7095},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.3514, -0.5799, 0.7350, 0.9994},
-	{0.2955, -0.2901, 0.9102, 0.9737},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{0.6153, -0.3223, 0.7194, 0.6198},
-	{0.3691, -0.7519, 0.5463, 0.6325},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{0.6905, 0.6446, -0.3283, 0.2011},
-	{0.5841, 0.4308, -0.6879, 0.1929},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{0.6203, 0.7636, 0.1792, 0.1012},
-	{0.9464, -0.2549, -0.1986, 0.0952},
-	{0.4693, -0.0563, -0.8812, 0.1063},
-	{-0.8227, -0.0703, 0.5641, 0.9330},
-	{-0.1193, -0.8052, 0.5808, 0.9268},
-	{-0.6125, -0.7885, -0.0558, 0.9427},
-	{0.4573, 0.2614, 0.8500, 0.4070},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.8400, -0.1295, 0.5269, 0.4219},
-	{-0.2741, -0.9499, 0.1502, 0.8008},
-	{-0.4195, -0.8771, -0.2340, 0.7835},
-	{-0.3981, -0.9038, 0.1570, 0.7877},
-	{-0.3597, 0.0793, 0.9297, 0.8012},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{-0.0472, -0.4350, -0.8992, 0.3582},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{-0.6724, 0.1679, 0.7209, 0.0321},
-	{-0.7180, 0.3291, 0.6134, 0.0461},
-	{0.1672, -0.8755, 0.4533, 0.7503},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{-0.0025, -0.5954, 0.8034, 0.7518},
-	{-0.5001, 0.8160, -0.2900, 0.9044},
-	{-0.5991, 0.6261, -0.4990, 0.9379},
-	{-0.8080, 0.3359, -0.4840, 0.9155},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.8023, 0.3144, 0.5074, 0.2986},
-	{0.3518, 0.3483, -0.8689, 0.4164},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{-0.8955, 0.3403, -0.2869, 0.2213},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{0.9244, 0.0952, -0.3693, 0.0185},
-	{0.8572, 0.3182, -0.4049, 0.0086},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{0.8539, -0.4209, 0.3062, 0.8058},
-	{0.7925, -0.1961, -0.5775, 0.8129},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.9547, -0.0224, 0.2968, 0.3380},
-	{-0.9463, -0.2772, 0.1661, 0.3417},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.5704, -0.6525, 0.4988, 0.8307},
-	{-0.1224, -0.9325, -0.3398, 0.8297},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.6886, 0.4445, 0.5730, 0.5937},
-	{-0.1994, -0.9560, 0.2153, 0.7297},
-	{0.2337, -0.8818, 0.4096, 0.7148},
-	{0.1707, -0.9829, 0.0693, 0.7558},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.0481, -0.9889, 0.1403, 0.9213},
-	{-0.6214, -0.6232, 0.4749, 0.9229},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.0853, -0.0147, -0.9962, 0.1958},
-	{-0.1006, -0.3306, -0.9384, 0.1914},
-	{-0.3917, 0.9041, 0.1710, 0.3585},
-	{-0.8219, 0.4352, 0.3677, 0.3509},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.6623, 0.7483, -0.0359, 0.0592},
-	{0.2156, 0.4123, 0.8851, 0.0452},
-	{0.2164, 0.7439, 0.6323, 0.0625},
-	{-0.5779, 0.1707, 0.7981, 0.7546},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.4299, -0.0243, 0.9025, 0.7541},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{-0.4014, -0.9129, 0.0744, 0.2373},
-	{-0.1736, -0.9293, 0.3260, 0.2612},
-	{0.5580, -0.4338, 0.7074, 0.6110},
-	{0.9722, 0.1887, 0.1386, 0.6112},
-	{0.4706, 0.2924, 0.8325, 0.6072},
-	{0.8203, 0.4864, -0.3010, 0.5466},
-	{0.9991, 0.0368, 0.0202, 0.5335},
-	{0.8563, 0.5164, -0.0107, 0.5376},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.4707, -0.8229, 0.3184, 0.7198},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{-0.6246, -0.0635, 0.7783, 0.7336},
-	{-0.4976, -0.0473, 0.8661, 0.7176},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{-0.6090, -0.0175, 0.7930, 0.6934},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.0360, 0.4841, 0.8743, 0.6834},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.5203, -0.4377, -0.7333, 0.4151},
-	{0.8000, -0.5943, -0.0821, 0.4126},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{-0.3095, 0.9433, -0.1196, 0.7035},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{-0.1371, -0.1821, 0.9737, 0.4469},
-	{-0.6468, 0.6563, -0.3885, 0.3340},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{0.4035, -0.4619, -0.7898, 0.1185},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.2489, -0.3748, -0.8931, 0.4837},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.0548, -0.3023, -0.9516, 0.4989},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{0.8137, 0.4732, -0.3377, 0.3259},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{-0.0620, 0.2819, 0.9574, 0.5275},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{-0.8584, 0.2331, 0.4569, 0.2480},
-	{-0.9656, 0.2599, 0.0054, 0.2243},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{-0.6880, 0.4614, 0.5602, 0.9398},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{-0.7317, 0.6214, 0.2801, 0.1707},
-	{-0.2545, 0.5740, 0.7783, 0.2017},
-	{-0.7108, 0.4588, 0.5332, 0.1844},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{-0.7417, -0.6107, -0.2774, 0.6986},
-	{-0.8937, 0.4360, 0.1062, 0.6998},
-	{-0.1885, 0.0785, 0.9789, 0.5551},
-	{-0.4740, -0.3401, 0.8122, 0.5410},
-	{-0.6049, -0.0334, 0.7956, 0.5521},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.2882, 0.7606, -0.5818, 0.2166},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{0.4481, 0.8321, -0.3268, 0.6188},
-	{0.1475, 0.8808, -0.4499, 0.6093},
-	{0.1346, 0.8735, -0.4678, 0.6288},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{-0.9330, -0.3576, -0.0405, 0.2161},
-	{0.3158, 0.8806, 0.3533, 0.6458},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{-0.0136, 0.9965, 0.0830, 0.6429},
-	{-0.9239, 0.2541, -0.2862, 0.9228},
-	{-0.4974, 0.5056, -0.7049, 0.8951},
-	{-0.8406, 0.4391, -0.3172, 0.9134},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{-0.6071, 0.7803, -0.1503, 0.5056},
-	{-0.7548, 0.5797, -0.3070, 0.5179},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.4548, 0.5328, -0.7136, 0.9680},
-	{-0.2266, 0.8250, -0.5177, 0.9843},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.7380, 0.0921, 0.6685, 0.3357},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{-0.9004, 0.1637, -0.4031, 0.9800},
-	{-0.9214, 0.3077, -0.2376, 0.9751},
-	{-0.9775, -0.0590, -0.2026, 0.9604},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{0.3691, -0.7519, 0.5463, 0.6325},
-	{0.6153, -0.3223, 0.7194, 0.6198},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{-0.4120, 0.7796, -0.4716, 0.1391},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{0.9087, -0.0823, 0.4094, 0.3632},
-	{0.9008, -0.0111, 0.4341, 0.3660},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.2453, 0.8795, 0.4079, 0.5945},
-	{-0.5942, 0.7714, 0.2277, 0.6043},
-	{0.9387, 0.3345, 0.0828, 0.0843},
-	{0.7622, -0.1359, -0.6329, 0.0959},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.0441, 0.9041, 0.4251, 0.7130},
-	{0.7128, 0.6137, 0.3395, 0.7196},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{-0.1434, -0.8472, 0.5116, 0.6969},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.8820, 0.4305, -0.1916, 0.4137},
-	{0.3518, 0.3483, -0.8689, 0.4164},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.8181, -0.5603, -0.1292, 0.6242},
-	{-0.3708, -0.7673, 0.5232, 0.6197},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{-0.7999, 0.5886, 0.1169, 0.2263},
-	{-0.8750, 0.4797, -0.0649, 0.2249},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.1985, 0.3629, 0.9104, 0.5773},
-	{0.6886, 0.4445, 0.5730, 0.5937},
-	{-0.0745, 0.3249, 0.9428, 0.3627},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.5372, 0.8433, -0.0135, 0.8390},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{0.0218, 0.6616, -0.7495, 0.9276},
-	{0.2366, 0.7306, -0.6405, 0.9167},
-	{-0.4078, 0.6986, -0.5879, 0.9237},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{0.4705, -0.2263, -0.8529, 0.0989},
-	{-0.9880, -0.1501, 0.0354, 0.7605},
-	{-0.6658, 0.5287, 0.5265, 0.7597},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{-0.7417, -0.6107, -0.2774, 0.7100},
-	{-0.4134, -0.8569, -0.3080, 0.7119},
-	{-0.8362, -0.4198, 0.3530, 0.7120},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.7070, -0.3078, 0.6367, 0.7256},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{0.2738, -0.6418, -0.7164, 0.1206},
-	{-0.3436, -0.4323, -0.8337, 0.1459},
-	{-0.2658, 0.9639, -0.0148, 0.0912},
-	{-0.6623, 0.7483, -0.0359, 0.0830},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.4976, -0.0473, 0.8661, 0.6967},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{-0.6418, 0.1967, 0.7412, 0.7189},
-	{-0.0822, 0.4653, -0.8814, 0.9439},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.0051, 0.5905, -0.8070, 0.9556},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.7325, 0.1673, 0.6599, 0.3627},
-	{0.3951, -0.2508, -0.8837, 0.0597},
-	{0.9771, -0.0602, -0.2041, 0.0739},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{0.1707, -0.9829, 0.0693, 0.7558},
-	{0.4838, -0.8688, 0.1050, 0.7982},
-	{-0.2658, 0.9639, -0.0148, 0.0458},
-	{-0.4996, 0.8475, 0.1792, 0.0344},
-	{0.0474, 0.6273, 0.7773, 0.0363},
-	{0.7036, 0.1085, 0.7023, 0.3234},
-	{0.9429, -0.1702, 0.2862, 0.3539},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{0.6192, 0.1329, 0.7740, 0.3932},
-	{0.1679, -0.5133, 0.8416, 0.3562},
-	{0.7824, -0.5565, 0.2797, 0.3613},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.7699, 0.0425, 0.6367, 0.9004},
-	{0.5343, 0.4108, 0.7387, 0.9084},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{-0.4834, -0.8596, -0.1659, 0.7035},
-	{-0.4448, -0.5400, -0.7145, 0.2172},
-	{-0.5859, -0.2830, -0.7594, 0.2245},
-	{-0.6773, -0.5073, -0.5329, 0.2265},
-	{-0.9093, 0.3754, 0.1795, 0.7537},
-	{-0.5559, 0.8207, 0.1320, 0.7483},
-	{-0.7993, 0.5004, 0.3329, 0.7339},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.9339, -0.3504, 0.0705, 0.6364},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.5715, -0.0954, -0.8150, 0.5486},
-	{0.5845, 0.0351, -0.8106, 0.5501},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{0.8177, 0.0106, 0.5755, 0.3369},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{-0.1438, 0.6836, -0.7156, 0.2337},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{0.3648, 0.9202, -0.1421, 0.2413},
-	{-0.1096, -0.6085, 0.7859, 0.6224},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{-0.1297, -0.9403, 0.3148, 0.7922},
-	{0.2953, -0.6258, 0.7219, 0.7940},
-	{0.7699, 0.0425, 0.6367, 0.2893},
-	{0.7043, 0.2073, 0.6789, 0.2814},
-	{0.5343, 0.4108, 0.7387, 0.2819},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{-0.8462, 0.1898, -0.4979, 0.1797},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{0.7128, 0.6137, 0.3395, 0.7196},
-	{0.8445, 0.4828, 0.2317, 0.6993},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.4783, -0.8590, 0.1828, 0.7799},
-	{0.4838, -0.8688, 0.1050, 0.7407},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{0.8445, 0.4828, 0.2317, 0.8886},
-	{0.7128, 0.6137, 0.3395, 0.8812},
-	{0.2425, 0.1763, 0.9540, 0.8995},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.8750, 0.4797, -0.0649, 0.6556},
-	{-0.7999, 0.5886, 0.1169, 0.6565},
-	{-0.9314, -0.1882, 0.3115, 0.1928},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{0.1745, 0.8170, 0.5497, 0.8556},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.5257, -0.5779, -0.6242, 0.5424},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.5812, -0.6776, -0.4506, 0.5425},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{0.3085, 0.1057, 0.9453, 0.2140},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{0.1364, 0.9693, 0.2048, 0.8826},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{0.8703, 0.2799, -0.4053, 0.4139},
-	{0.8820, 0.4305, -0.1916, 0.4137},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{-0.3157, -0.0484, 0.9476, 0.5220},
-	{-0.3514, -0.5799, 0.7350, 0.5149},
-	{-0.7253, 0.0630, 0.6856, 0.5146},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{0.6845, -0.0171, 0.7288, 0.1510},
-	{0.7932, -0.0642, 0.6056, 0.1529},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{-0.3122, -0.9336, -0.1762, 0.8274},
-	{-0.0091, -0.9999, 0.0097, 0.8656},
-	{0.3238, -0.8445, -0.4265, 0.8732},
-	{-0.3218, -0.3970, 0.8596, 0.7132},
-	{-0.8468, 0.0758, 0.5264, 0.7154},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{-0.3095, 0.9433, -0.1196, 0.7035},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{-0.6356, 0.7386, -0.2248, 0.3748},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{-0.6468, 0.6563, -0.3885, 0.3340},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{-0.6863, 0.0094, 0.7273, 0.1195},
-	{0.3438, 0.4810, 0.8065, 0.1176},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.6941, 0.4384, 0.5710, 0.8986},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.7116, 0.3457, 0.6117, 0.9373},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{-0.2704, -0.8199, 0.5046, 0.6788},
-	{-0.5991, 0.6261, -0.4990, 0.6700},
-	{-0.8851, -0.3374, -0.3204, 0.6593},
-	{-0.8080, 0.3359, -0.4840, 0.6454},
-	{-0.6368, -0.4067, 0.6550, 0.1031},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{-0.6160, 0.4382, 0.6546, 0.1001},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.8584, 0.2993, 0.4165, 0.8477},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{0.0652, 0.2155, -0.9743, 0.8821},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{-0.6125, -0.7885, -0.0558, 0.8595},
-	{-0.1193, -0.8052, 0.5808, 0.8626},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{-0.2241, 0.5052, 0.8334, 0.9749},
-	{-0.5862, 0.5134, 0.6267, 0.9694},
-	{-0.4308, 0.3968, 0.8106, 0.9739},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.9170, -0.1049, -0.3848, 0.5257},
-	{-0.9478, 0.3159, 0.0427, 0.5097},
-	{-0.4593, 0.8160, -0.3510, 0.5124},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{-0.5808, -0.1282, -0.8039, 0.0519},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.7346, 0.2381, -0.6353, 0.1341},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{0.5240, -0.6781, -0.5153, 0.7309},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{0.7622, -0.1359, -0.6329, 0.0959},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{0.0002, 0.5669, -0.8238, 0.2024},
-	{0.1062, 0.5919, -0.7990, 0.1812},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{0.8275, 0.1032, 0.5519, 0.6505},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.7898, 0.5275, -0.3129, 0.4173},
-	{0.8703, 0.2799, -0.4053, 0.4139},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.8179, -0.4907, -0.3005, 0.4453},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{0.7192, -0.6694, -0.1863, 0.3912},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{0.8930, -0.3670, 0.2605, 0.3812},
-	{0.7870, 0.1409, -0.6007, 0.7646},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{0.6797, -0.4199, 0.6014, 0.7670},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.2164, 0.7439, 0.6323, 0.0625},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{-0.5859, -0.2830, -0.7594, 0.2245},
-	{-0.8199, -0.4252, -0.3834, 0.2419},
-	{-0.8471, -0.2198, -0.4838, 0.2382},
-	{0.5038, -0.2667, -0.8216, 0.7918},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{-0.0543, 0.4619, -0.8853, 0.3613},
-	{-0.0472, -0.4350, -0.8992, 0.3582},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{-0.6327, -0.4710, -0.6147, 0.2335},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{-0.9039, 0.0524, -0.4245, 0.2582},
-	{-0.1867, 0.3659, 0.9117, 0.2766},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{-0.5787, 0.2214, 0.7849, 0.2642},
-	{-0.9004, 0.1637, -0.4031, 0.5335},
-	{-0.7818, 0.5826, -0.2221, 0.5277},
-	{-0.9039, 0.0524, -0.4245, 0.5370},
-	{0.8363, 0.3359, 0.4334, 0.3015},
-	{0.8682, 0.1707, 0.4659, 0.3106},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.5413, 0.5376, -0.6465, 0.1204},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.9255, -0.1984, 0.3227, 0.6271},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{0.9283, 0.2530, 0.2724, 0.5591},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.6860, -0.4591, -0.5645, 0.7613},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.8445, 0.4828, 0.2317, 0.8886},
-	{0.2425, 0.1763, 0.9540, 0.8995},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.9007, -0.0366, -0.4329, 0.8386},
-	{-0.8471, -0.2198, -0.4838, 0.8450},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{-0.2788, 0.8163, 0.5058, 0.1080},
-	{0.1985, 0.3629, 0.9104, 0.0912},
-	{-0.2868, 0.3755, 0.8813, 0.0989},
-	{-0.8937, 0.4360, 0.1062, 0.7076},
-	{-0.7417, -0.6107, -0.2774, 0.7100},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{-0.4063, -0.8914, -0.2009, 0.8692},
-	{-0.6125, -0.7885, -0.0558, 0.8595},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{-0.2045, 0.5912, 0.7801, 0.9552},
-	{-0.4308, 0.3968, 0.8106, 0.9739},
-	{-0.5862, 0.5134, 0.6267, 0.9694},
-	{0.1943, 0.9739, 0.1170, 0.3325},
-	{-0.6468, 0.6563, -0.3885, 0.3340},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{-0.8840, 0.3199, 0.3408, 0.4949},
-	{-0.7292, 0.2842, 0.6225, 0.5065},
-	{0.8073, 0.3940, 0.4394, 0.3233},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{0.0367, 0.9992, 0.0168, 0.8934},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{0.2730, 0.8253, 0.4943, 0.8860},
-	{-0.0000, -0.8889, 0.4580, 0.3025},
-	{-0.1297, -0.9403, 0.3148, 0.3120},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{-0.0360, 0.4841, 0.8743, 0.6834},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{-0.9545, 0.2860, 0.0851, 0.9256},
-	{-0.9478, 0.3159, 0.0427, 0.9503},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{0.4072, 0.2197, -0.8865, 0.0757},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{-0.3597, 0.0793, 0.9297, 0.8012},
-	{0.8539, -0.4209, 0.3062, 0.8058},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{0.2864, 0.3616, 0.8873, 0.4485},
-	{0.4615, 0.4621, 0.7572, 0.4811},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{-0.0437, -0.5611, 0.8266, 0.2896},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{0.1480, -0.7030, 0.6956, 0.2830},
-	{-0.3062, 0.3674, 0.8782, 0.6809},
-	{0.0925, 0.9692, 0.2281, 0.7001},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{0.3316, -0.3475, -0.8771, 0.4194},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{0.1558, -0.0906, -0.9836, 0.4196},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{0.4615, 0.4621, 0.7572, 0.4811},
-	{0.7299, 0.6038, 0.3203, 0.4949},
-	{0.8275, 0.1032, 0.5519, 0.6505},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.0971, 0.3053, 0.9473, 0.6541},
-	{0.9283, 0.2530, 0.2724, 0.5591},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{0.8020, -0.1630, 0.5747, 0.5537},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{0.8455, -0.2186, 0.4873, 0.2268},
-	{0.1762, -0.9844, -0.0040, 0.2266},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{0.2493, -0.0521, -0.9670, 0.5457},
-	{0.0967, -0.9029, -0.4189, 0.5576},
-	{0.3951, -0.2508, -0.8837, 0.5694},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{-0.6021, -0.3146, -0.7338, 0.8822},
-	{-0.5315, -0.8099, -0.2480, 0.8670},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{0.7622, -0.1359, -0.6329, 0.0959},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{0.2036, 0.7662, -0.6094, 0.1792},
-	{-0.3243, 0.7713, -0.5477, 0.1609},
-	{-0.0051, 0.5905, -0.8070, 0.1596},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.9008, -0.0111, 0.4341, 0.3660},
-	{0.9087, -0.0823, 0.4094, 0.3632},
-	{-0.8181, -0.5603, -0.1292, 0.6242},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.0458, 0.1274, 0.9908, 0.5804},
-	{-0.0620, 0.2819, 0.9574, 0.5723},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.8876, 0.2327, 0.3975, 0.7390},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{-0.2620, 0.5764, -0.7740, 0.7609},
-	{0.7407, 0.4998, -0.4489, 0.7607},
-	{0.6959, 0.6155, 0.3699, 0.0861},
-	{0.9497, 0.0426, 0.3102, 0.0705},
-	{0.6253, 0.5681, -0.5350, 0.0908},
-	{-0.9928, -0.0583, 0.1049, 0.4701},
-	{-0.8718, -0.2590, -0.4158, 0.4581},
-	{-0.9701, 0.2080, -0.1247, 0.4616},
-	{0.7932, -0.0642, 0.6056, 0.1529},
-	{0.3418, -0.3041, 0.8892, 0.1602},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{0.2756, 0.7552, 0.5948, 0.8976},
-	{-0.2788, 0.9589, 0.0518, 0.9022},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.0086, -0.9999, -0.0147, 0.7634},
-	{-0.4674, -0.8704, -0.1549, 0.7755},
-	{-0.3122, -0.9336, -0.1762, 0.7481},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{-0.4116, 0.6903, -0.5951, 0.1658},
-	{0.6526, 0.7519, -0.0930, 0.1584},
-	{-0.0339, -0.9994, 0.0048, 0.0332},
-	{-0.0000, -0.8889, 0.4580, 0.0139},
-	{0.0865, -0.9926, -0.0848, 0.0196},
-	{0.1833, 0.8818, 0.4346, 0.8626},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{0.1745, 0.8170, 0.5497, 0.8556},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{-0.6034, 0.1195, -0.7885, 0.5005},
-	{-0.3037, 0.6004, -0.7398, 0.5116},
-	{0.5841, 0.4308, -0.6879, 0.1929},
-	{0.7470, 0.4675, -0.4727, 0.1875},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{0.1024, 0.5979, 0.7950, 0.4064},
-	{-0.2280, 0.7995, 0.5557, 0.4007},
-	{-0.5329, 0.3905, -0.7507, 0.2036},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.8955, 0.3403, -0.2869, 0.2213},
-	{0.1204, -0.5628, -0.8178, 0.5861},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{-0.5859, -0.2830, -0.7594, 0.6015},
-	{-0.3037, 0.6004, -0.7398, 0.9543},
-	{0.1800, 0.6143, -0.7683, 0.9402},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{0.3731, 0.9187, 0.1296, 0.7557},
-	{-0.2788, 0.8163, 0.5058, 0.7463},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{0.9205, -0.2688, -0.2836, 0.0833},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{0.4985, 0.8400, 0.2144, 0.8763},
-	{0.0664, 0.9957, -0.0650, 0.8801},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{-0.2778, -0.9466, 0.1638, 0.8600},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{0.4172, -0.7907, 0.4480, 0.6769},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{-0.0922, -0.2711, -0.9581, 0.0847},
-	{-0.4172, 0.5113, -0.7514, 0.1085},
-	{-0.4666, 0.4578, 0.7568, 0.1094},
-	{-0.8459, 0.5166, -0.1327, 0.1045},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{0.7463, 0.5882, -0.3115, 0.4499},
-	{0.8562, 0.0205, -0.5163, 0.4652},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{-0.0638, 0.7133, 0.6979, 0.4406},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{-0.2704, -0.8199, 0.5046, 0.7180},
-	{0.4256, -0.7199, 0.5483, 0.7221},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.5704, -0.6525, 0.4988, 0.8307},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{0.0896, -0.5786, 0.8107, 0.6212},
-	{-0.8181, -0.5603, -0.1292, 0.6242},
-	{-0.1856, -0.9124, 0.3648, 0.6256},
-	{-0.1835, -0.7467, -0.6393, 0.6949},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{0.8023, 0.3144, 0.5074, 0.2986},
-	{0.7699, 0.0425, 0.6367, 0.2893},
-	{0.8363, 0.3359, 0.4334, 0.3015},
-	{-0.3435, 0.0802, 0.9357, 0.8934},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{0.5116, -0.4641, -0.7231, 0.5181},
-	{-0.0934, -0.3215, -0.9423, 0.5073},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.8831, -0.4312, -0.1851, 0.7699},
-	{-0.9093, 0.3754, 0.1795, 0.7537},
-	{0.6192, 0.1329, 0.7740, 0.3932},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{0.1284, 0.7280, 0.6734, 0.9283},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{-0.4548, 0.5328, -0.7136, 0.9680},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{-0.2986, -0.8941, -0.3339, 0.3410},
-	{-0.6009, -0.6623, -0.4476, 0.3502},
-	{0.2738, -0.6418, -0.7164, 0.4661},
-	{0.6664, -0.6028, -0.4388, 0.4517},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{-0.6040, -0.4385, -0.6655, 0.0421},
-	{-0.5247, -0.4905, -0.6957, 0.0376},
-	{-0.1829, -0.6633, -0.7257, 0.0591},
-	{-0.8227, -0.0703, 0.5641, 0.9145},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.1193, -0.8052, 0.5808, 0.9058},
-	{0.1204, -0.5628, -0.8178, 0.5861},
-	{-0.0256, -0.1273, -0.9915, 0.5721},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{0.6253, 0.5681, -0.5350, 0.0385},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{0.5139, 0.8212, 0.2479, 0.0607},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{0.6664, -0.6028, -0.4388, 0.4517},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{0.2425, 0.1763, 0.9540, 0.7654},
-	{0.1646, 0.5297, 0.8320, 0.7471},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{-0.9314, -0.1882, 0.3115, 0.1928},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{0.8085, 0.1793, 0.5605, 0.1409},
-	{-0.0124, 0.2814, 0.9595, 0.1513},
-	{0.6916, 0.7202, 0.0548, 0.1342},
-	{-0.4448, -0.5400, -0.7145, 0.5895},
-	{0.1204, -0.5628, -0.8178, 0.5821},
-	{-0.5859, -0.2830, -0.7594, 0.5854},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.9287, -0.2848, 0.2374, 0.8391},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{0.5710, -0.6458, -0.5068, 0.8539},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.5116, -0.4641, -0.7231, 0.8639},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.9775, -0.0590, -0.2026, 0.9604},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.1679, -0.5133, 0.8416, 0.4528},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{0.7824, -0.5565, 0.2797, 0.4674},
-	{-0.5415, -0.5234, 0.6579, 0.9402},
-	{-0.6880, 0.4614, 0.5602, 0.9398},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.7058, 0.1194, -0.6982, 0.6156},
-	{0.2296, -0.4959, -0.8375, 0.6168},
-	{-0.5758, 0.5612, -0.5946, 0.8956},
-	{-0.7870, 0.4590, -0.4123, 0.9021},
-	{-0.2999, 0.6118, -0.7319, 0.8806},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.4208, 0.8724, 0.2486, 0.8662},
-	{0.8416, 0.2044, 0.4999, 0.8651},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{0.9387, 0.3345, 0.0828, 0.0843},
-	{0.9259, 0.3443, -0.1552, 0.1862},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{0.2852, 0.8849, 0.3684, 0.4825},
-	{-0.5637, 0.8259, -0.0093, 0.4955},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{0.8804, -0.3887, -0.2718, 0.3997},
-	{0.3731, 0.9187, 0.1296, 0.1040},
-	{0.6886, 0.4445, 0.5730, 0.0937},
-	{0.1985, 0.3629, 0.9104, 0.0912},
-	{-0.0723, -0.9856, -0.1527, 0.7985},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{0.2766, -0.9403, -0.1984, 0.7956},
-	{-0.8314, -0.3962, 0.3895, 0.2439},
-	{-0.8827, -0.3050, 0.3576, 0.2434},
-	{-0.7951, -0.5325, 0.2903, 0.2382},
-	{0.3586, 0.8645, -0.3521, 0.8813},
-	{0.7220, 0.5659, 0.3981, 0.8883},
-	{0.5918, 0.5107, -0.6236, 0.8848},
-	{-0.5329, 0.3905, -0.7507, 0.2036},
-	{-0.6930, 0.0767, -0.7168, 0.2044},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.9170, -0.1049, -0.3848, 0.5257},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.9004, 0.1637, -0.4031, 0.5335},
-	{0.0260, -0.9946, -0.1000, 0.7285},
-	{-0.0365, -0.9854, 0.1665, 0.7150},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{0.5660, 0.3094, -0.7641, 0.1066},
-	{0.9387, 0.3345, 0.0828, 0.0997},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.3671, -0.1598, 0.9163, 0.7698},
-	{-0.8235, 0.0960, -0.5591, 0.6222},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.8459, 0.5166, -0.1327, 0.1045},
-	{-0.4666, 0.4578, 0.7568, 0.1094},
-	{-0.8762, 0.4240, 0.2292, 0.1039},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{0.1749, 0.4767, 0.8615, 0.9180},
-	{0.6471, 0.2960, 0.7026, 0.9462},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{-0.0727, 0.7955, 0.6016, 0.4689},
-	{-0.0207, 0.4741, 0.8802, 0.4629},
-	{0.6716, 0.5691, 0.4744, 0.6173},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{0.7098, 0.5867, 0.3899, 0.7039},
-	{0.4643, -0.0041, -0.8857, 0.4757},
-	{-0.1878, 0.1793, -0.9657, 0.4878},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.0922, -0.2711, -0.9581, 0.0847},
-	{-0.4027, -0.2974, -0.8657, 0.0958},
-	{-0.9366, -0.2467, -0.2488, 0.9428},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{0.4561, -0.0727, -0.8870, 0.1649},
-	{-0.2409, -0.6805, -0.6920, 0.1686},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{-0.4834, -0.8596, -0.1659, 0.7035},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{0.9420, -0.1023, -0.3196, 0.1713},
-	{0.7147, 0.5899, -0.3757, 0.1650},
-	{-0.3435, 0.0802, 0.9357, 0.8934},
-	{0.2064, -0.0201, 0.9783, 0.8928},
-	{-0.3166, 0.3876, 0.8658, 0.9011},
-	{0.4481, 0.8321, -0.3268, 0.6188},
-	{0.1346, 0.8735, -0.4678, 0.6288},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{-0.1254, 0.1694, -0.9775, 0.1731},
-	{0.8077, -0.0935, -0.5821, 0.1733},
-	{0.8203, 0.4864, -0.3010, 0.1701},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{-0.1331, 0.5679, 0.8123, 0.1933},
-	{0.0899, 0.5360, 0.8394, 0.2010},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{0.5845, 0.0351, -0.8106, 0.5501},
-	{-0.6739, 0.2329, -0.7011, 0.5526},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{0.9259, 0.3443, -0.1552, 0.1862},
-	{-0.4537, 0.8911, 0.0085, 0.1504},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{-0.1192, 0.9575, 0.2626, 0.2261},
-	{0.4232, 0.9045, 0.0533, 0.1730},
-	{-0.7328, 0.6604, 0.1638, 0.7559},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{0.9255, -0.1984, 0.3227, 0.6271},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{0.4178, -0.9083, -0.0217, 0.2776},
-	{0.7824, -0.5565, 0.2797, 0.3613},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{-0.9007, -0.0366, -0.4329, 0.2422},
-	{-0.8413, -0.0416, -0.5389, 0.2480},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{0.6573, 0.6722, 0.3408, 0.8200},
-	{0.8804, -0.3887, -0.2718, 0.5467},
-	{0.0967, -0.9029, -0.4189, 0.5576},
-	{0.2493, -0.0521, -0.9670, 0.5457},
-	{0.3731, 0.9187, 0.1296, 0.7557},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{0.3460, 0.5263, -0.7767, 0.7671},
-	{-0.2873, -0.1227, -0.9500, 0.9530},
-	{-0.3037, 0.6004, -0.7398, 0.9351},
-	{-0.5415, 0.3814, -0.7492, 0.9675},
-	{-0.4223, -0.5637, -0.7099, 0.6950},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{-0.0339, -0.9994, 0.0048, 0.2602},
-	{0.4178, -0.9083, -0.0217, 0.2776},
-	{0.7262, 0.0241, 0.6871, 0.0284},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{-0.5704, -0.6212, 0.5373, 0.9163},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.6214, -0.6232, 0.4749, 0.9229},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.1749, 0.4767, 0.8615, 0.9180},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{0.5845, 0.0351, -0.8106, 0.0897},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{-0.0854, -0.7503, -0.6556, 0.1217},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{-0.5001, 0.8160, -0.2900, 0.9044},
-	{-0.8080, 0.3359, -0.4840, 0.9155},
-	{-0.7870, 0.4590, -0.4123, 0.9021},
-	{-0.6819, 0.6370, -0.3594, 0.9574},
-	{-0.8175, -0.1724, 0.5496, 0.9491},
-	{-0.9929, -0.1185, 0.0031, 0.9567},
-	{0.1472, 0.6436, -0.7511, 0.4043},
-	{0.9259, 0.3443, -0.1552, 0.4072},
-	{0.8564, -0.5112, -0.0728, 0.4058},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{-0.2453, 0.8795, 0.4079, 0.5945},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{-0.1964, 0.4941, -0.8469, 0.0017},
-	{-0.3122, -0.9336, -0.1762, 0.9696},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.0481, -0.9889, 0.1403, 0.9391},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.7292, 0.2842, 0.6225, 0.5065},
-	{0.8154, -0.5622, -0.1381, 0.6133},
-	{0.7058, 0.1194, -0.6982, 0.6156},
-	{0.9722, 0.1887, 0.1386, 0.6112},
-	{0.6797, -0.4199, 0.6014, 0.7670},
-	{-0.9996, 0.0183, -0.0197, 0.7675},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{0.7278, -0.3236, 0.6047, 0.9806},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{0.5751, -0.0706, 0.8150, 0.9634},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{0.5751, -0.0706, 0.8150, 0.9634},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{-0.7215, 0.6525, -0.2318, 0.1547},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{-0.3804, 0.6299, -0.6771, 0.1878},
-	{-0.5689, 0.4621, -0.6803, 0.1737},
-	{0.3103, -0.0983, 0.9456, 0.5759},
-	{0.2955, -0.2901, 0.9102, 0.5626},
-	{-0.3157, -0.0484, 0.9476, 0.5711},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.4682, 0.6911, -0.5506, 0.9517},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{-0.5779, 0.1707, 0.7981, 0.7546},
-	{-0.6796, 0.1462, 0.7189, 0.7504},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{-0.4134, -0.8569, -0.3080, 0.7119},
-	{-0.7417, -0.6107, -0.2774, 0.7100},
-	{-0.0749, -0.9885, -0.1310, 0.7124},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.1833, 0.8818, 0.4346, 0.8626},
-	{0.2671, 0.9552, -0.1271, 0.8686},
-	{0.9283, 0.2530, 0.2724, 0.5591},
-	{0.8020, -0.1630, 0.5747, 0.5537},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{-0.4280, -0.6557, 0.6220, 0.1190},
-	{-0.6368, -0.4067, 0.6550, 0.1031},
-	{-0.3765, -0.9240, 0.0673, 0.1196},
-	{-0.7993, 0.5004, 0.3329, 0.2686},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{-0.4185, 0.7714, 0.4793, 0.2564},
-	{0.5075, 0.7911, -0.3416, 0.0491},
-	{-0.1458, 0.9031, -0.4039, 0.0415},
-	{0.1543, 0.6393, -0.7533, 0.0336},
-	{0.2308, 0.8675, 0.4406, 0.4482},
-	{-0.0136, 0.9965, 0.0830, 0.4623},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{-0.9545, 0.2860, 0.0851, 0.9256},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{-0.5862, 0.5134, 0.6267, 0.9694},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.8247, 0.0389, -0.5643, 0.7927},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.2999, 0.6118, -0.7319, 0.8806},
-	{-0.5083, 0.6049, -0.6130, 0.8812},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{-0.3527, 0.5343, -0.7682, 0.9121},
-	{-0.6090, -0.0175, 0.7930, 0.6864},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{-0.4976, -0.0473, 0.8661, 0.6967},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.8363, 0.3359, 0.4334, 0.8947},
-	{0.7699, 0.0425, 0.6367, 0.9004},
-	{-0.9929, -0.1185, 0.0031, 0.5358},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.6819, 0.6370, -0.3594, 0.5225},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{0.5038, -0.2667, -0.8216, 0.7906},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{0.4615, 0.4621, 0.7572, 0.4811},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{-0.5637, 0.8259, -0.0093, 0.4955},
-	{-0.6154, 0.6377, -0.4634, 0.5067},
-	{-0.4218, 0.8652, -0.2710, 0.5194},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.0620, 0.2819, 0.9574, 0.5275},
-	{0.0458, 0.1274, 0.9908, 0.5330},
-	{-0.6841, 0.7055, 0.1851, 0.7331},
-	{-0.6489, 0.5254, 0.5504, 0.7371},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.9442, 0.1750, 0.2788, 0.6972},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.5175, -0.6904, -0.5056, 0.6970},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{-0.9093, 0.3754, 0.1795, 0.8041},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.3868, 0.9184, -0.0836, 0.7279},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.4167, 0.8981, -0.1410, 0.6867},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{-0.2620, 0.5764, -0.7740, 0.7609},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.7940, -0.5722, -0.2055, 0.0990},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{-0.1001, -0.8332, -0.5439, 0.3372},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{0.2477, -0.8990, -0.3610, 0.3688},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.7278, -0.3236, 0.6047, 0.0527},
-	{0.8400, -0.1295, 0.5269, 0.0541},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.8176, 0.4403, 0.3712, 0.3450},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{-0.5668, -0.8197, 0.0829, 0.2182},
-	{-0.9330, -0.3576, -0.0405, 0.2161},
-	{0.3793, -0.3260, 0.8659, 0.2170},
-	{-0.1707, 0.5758, -0.7996, 0.5982},
-	{0.4778, 0.3240, -0.8165, 0.5646},
-	{-0.0472, -0.4350, -0.8992, 0.5725},
-	{-0.8010, 0.4273, -0.4192, 0.9938},
-	{-0.5321, 0.4244, -0.7326, 0.9983},
-	{-0.6226, 0.6446, -0.4437, 0.9772},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{0.0865, -0.9926, -0.0848, 0.3129},
-	{-0.0000, -0.8889, 0.4580, 0.3025},
-	{-0.7317, 0.6214, 0.2801, 0.5529},
-	{-0.7185, 0.6437, 0.2637, 0.5525},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{-0.5586, -0.0152, -0.8293, 0.4896},
-	{-0.4319, 0.0300, -0.9014, 0.4711},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{0.5372, 0.8433, -0.0135, 0.5909},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{0.3989, 0.2372, 0.8858, 0.5966},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.8939, -0.2588, 0.3660, 0.2410},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.9478, 0.3159, 0.0427, 0.9503},
-	{-0.9170, -0.1049, -0.3848, 0.9627},
-	{-0.8337, 0.3697, 0.4103, 0.8981},
-	{-0.7076, -0.5762, 0.4089, 0.8983},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{0.3376, 0.8670, -0.3665, 0.1505},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{0.6526, 0.7519, -0.0930, 0.1584},
-	{0.3357, 0.2379, 0.9114, 0.7189},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{-0.9890, -0.1306, 0.0692, 0.6453},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{-0.6136, 0.0291, 0.7891, 0.6105},
-	{0.1788, 0.9561, -0.2323, 0.8773},
-	{0.4889, 0.7745, 0.4013, 0.8776},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{0.2183, 0.5054, 0.8348, 0.6142},
-	{0.2075, 0.4652, 0.8605, 0.6271},
-	{-0.8275, 0.4334, -0.3569, 0.2216},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.6664, 0.3097, -0.6782, 0.2049},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.7919, -0.5824, -0.1835, 0.2429},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{-0.6418, 0.1967, 0.7412, 0.7189},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{0.3460, 0.5263, -0.7767, 0.1084},
-	{0.6635, 0.7231, -0.1923, 0.1072},
-	{0.3731, 0.9187, 0.1296, 0.1040},
-	{0.9146, 0.1285, -0.3833, 0.0845},
-	{0.9774, 0.0562, -0.2040, 0.0702},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{-0.0829, -0.3785, -0.9219, 0.1577},
-	{-0.2804, -0.1980, -0.9393, 0.1636},
-	{-0.5694, -0.0739, -0.8188, 0.1717},
-	{0.0474, 0.6273, 0.7773, 0.0363},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.2156, 0.4123, 0.8851, 0.0452},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.5983, -0.8012, -0.0112, 0.1382},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.5315, -0.8099, -0.2480, 0.8670},
-	{-0.6021, -0.3146, -0.7338, 0.8822},
-	{0.6121, 0.1059, 0.7836, 0.9559},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.4573, 0.2614, 0.8500, 0.9597},
-	{-0.9928, -0.0583, 0.1049, 0.4701},
-	{-0.8597, -0.4108, 0.3035, 0.4921},
-	{-0.8424, -0.5052, -0.1876, 0.4742},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{-0.7149, -0.5345, 0.4508, 0.7205},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{-0.1072, 0.7055, 0.7006, 0.3020},
-	{-0.8919, 0.4523, 0.0060, 0.3044},
-	{-0.5637, 0.8259, -0.0093, 0.2806},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.2804, -0.1980, -0.9393, 0.2971},
-	{0.2489, -0.3748, -0.8931, 0.3047},
-	{0.0548, -0.3023, -0.9516, 0.3241},
-	{0.7304, 0.6044, -0.3182, 0.1548},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{0.7147, 0.5899, -0.3757, 0.1650},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{-0.8462, 0.1898, -0.4979, 0.1797},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{-0.3514, -0.5799, 0.7350, 0.0821},
-	{0.3980, -0.7242, 0.5632, 0.0715},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{-0.9287, -0.2848, 0.2374, 0.8391},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{-0.9339, -0.3504, 0.0705, 0.8448},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.9239, 0.2541, -0.2862, 0.1075},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.9906, -0.1137, 0.0765, 0.7872},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{-0.1456, 0.6936, -0.7055, 0.2446},
-	{0.4985, 0.8400, 0.2144, 0.2513},
-	{0.3648, 0.9202, -0.1421, 0.2413},
-	{-0.4319, 0.0300, -0.9014, 0.4711},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{-0.4116, 0.6903, -0.5951, 0.2117},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{-0.6819, 0.6370, -0.3594, 0.9574},
-	{-0.7570, 0.6309, -0.1702, 0.9480},
-	{-0.8175, -0.1724, 0.5496, 0.9491},
-	{-0.8314, -0.3962, 0.3895, 0.2439},
-	{-0.7951, -0.5325, 0.2903, 0.2382},
-	{-0.5845, -0.5686, 0.5788, 0.2552},
-	{0.7889, -0.5424, 0.2889, 0.3742},
-	{0.8930, -0.3670, 0.2605, 0.3812},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{0.3158, 0.8806, 0.3533, 0.6458},
-	{0.3468, 0.7679, -0.5386, 0.6382},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{-0.6611, 0.7252, 0.1925, 0.2809},
-	{-0.1112, 0.9938, 0.0005, 0.2727},
-	{-0.7787, 0.4834, -0.3999, 0.2742},
-	{0.8867, 0.3875, 0.2523, 0.9158},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.9221, 0.2930, 0.2526, 0.9344},
-	{-0.0922, -0.2711, -0.9581, 0.0288},
-	{0.2665, -0.6820, -0.6811, 0.0235},
-	{0.9244, 0.0952, -0.3693, 0.0185},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{-0.4172, 0.5113, -0.7514, 0.4096},
-	{-0.5808, -0.1282, -0.8039, 0.4143},
-	{-0.7590, -0.5274, 0.3817, 0.8812},
-	{-0.8337, 0.3697, 0.4103, 0.8876},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{-0.4740, -0.3401, 0.8122, 0.4963},
-	{-0.2443, -0.4778, 0.8438, 0.4913},
-	{-0.0437, -0.5611, 0.8266, 0.4991},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.2064, -0.0201, 0.9783, 0.8928},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.5761, 0.3515, 0.7379, 0.8901},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{-0.8406, 0.4391, -0.3172, 0.9176},
-	{-0.4974, 0.5056, -0.7049, 0.8974},
-	{-0.7281, 0.6054, -0.3215, 0.9026},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.6573, 0.6722, 0.3408, 0.8200},
-	{0.6471, 0.2960, 0.7026, 0.8241},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{-0.7919, -0.5824, -0.1835, 0.2429},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{-0.6160, 0.4382, 0.6546, 0.6580},
-	{-0.6863, 0.0094, 0.7273, 0.6627},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{0.1122, -0.9280, 0.3554, 0.8862},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{-0.5863, 0.4679, -0.6613, 0.0962},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.4536, 0.3068, 0.8367, 0.7210},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{0.6541, -0.1749, 0.7359, 0.7051},
-	{0.6756, 0.2814, -0.6814, 0.5522},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{0.5660, 0.3094, -0.7641, 0.5513},
-	{0.1943, 0.9739, 0.1170, 0.1035},
-	{0.8137, 0.4732, -0.3377, 0.0945},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{-0.5988, 0.7541, 0.2698, 0.3632},
-	{-0.3917, 0.9041, 0.1710, 0.3585},
-	{0.4846, -0.8583, -0.1691, 0.8613},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.2820, -0.9484, -0.1451, 0.3020},
-	{0.7666, -0.6420, 0.0103, 0.3064},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{-0.8846, -0.0062, -0.4664, 0.0070},
-	{-0.1964, 0.4941, -0.8469, 0.0017},
-	{-0.7818, 0.5826, -0.2221, 0.5277},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.7548, 0.5797, -0.3070, 0.5179},
-	{-0.5704, -0.6212, 0.5373, 0.9163},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{-0.7864, 0.2552, 0.5625, 0.9158},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{-0.7951, -0.5325, 0.2903, 0.2382},
-	{-0.4577, -0.5685, 0.6836, 0.2224},
-	{-0.1885, 0.0785, 0.9789, 0.4836},
-	{-0.2813, -0.1737, 0.9438, 0.4606},
-	{-0.4740, -0.3401, 0.8122, 0.4963},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{0.1062, 0.5919, -0.7990, 0.1812},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{-0.9880, -0.1501, 0.0354, 0.7605},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{0.8563, 0.5164, -0.0107, 0.9361},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{-0.0947, 0.9861, -0.1367, 0.9558},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.6863, 0.0094, 0.7273, 0.6627},
-	{0.3853, -0.9062, -0.1739, 0.3914},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{0.7192, -0.6694, -0.1863, 0.3912},
-	{-0.3043, -0.9223, 0.2380, 0.2241},
-	{-0.4014, -0.9129, 0.0744, 0.2373},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{0.7661, -0.0308, -0.6420, 0.7518},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{-0.9675, 0.2481, -0.0487, 0.6170},
-	{-0.5083, 0.6049, -0.6130, 0.6246},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{-0.0472, -0.4350, -0.8992, 0.3582},
-	{0.1844, -0.7136, -0.6758, 0.3577},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{0.1365, -0.9088, 0.3943, 0.6470},
-	{-0.2704, -0.8199, 0.5046, 0.6788},
-	{-0.0025, -0.5954, 0.8034, 0.7518},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.1672, -0.8755, 0.4533, 0.7503},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{0.8179, -0.4907, -0.3005, 0.4453},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.5272, -0.2673, -0.8066, 0.7489},
-	{0.7661, -0.0308, -0.6420, 0.7518},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{-0.6248, -0.2959, 0.7225, 0.9100},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.9175, -0.3395, -0.2071, 0.9097},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{-0.2620, 0.5764, -0.7740, 0.7609},
-	{-0.9880, -0.1501, 0.0354, 0.7605},
-	{0.0441, 0.9041, 0.4251, 0.7379},
-	{-0.0824, 0.5702, 0.8174, 0.7525},
-	{0.1646, 0.5297, 0.8320, 0.7471},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{-0.6831, 0.7232, -0.1019, 0.9042},
-	{-0.8337, 0.3697, 0.4103, 0.8981},
-	{0.4344, -0.8812, -0.1864, 0.7593},
-	{0.1166, -0.9931, -0.0119, 0.7532},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.6023, -0.7173, -0.3503, 0.5523},
-	{0.6109, -0.6349, -0.4729, 0.5540},
-	{-0.3868, 0.9184, -0.0836, 0.7279},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.7946, 0.0675, 0.6033, 0.4050},
-	{0.9410, -0.1276, 0.3134, 0.4208},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{0.1977, -0.0914, -0.9760, 0.8890},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.8891, 0.4550, -0.0491, 0.7608},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{0.9410, -0.1276, 0.3134, 0.3971},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{0.8400, -0.1295, 0.5269, 0.3954},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{-0.8751, 0.3795, -0.3002, 0.1188},
-	{-0.8570, 0.5126, -0.0526, 0.1302},
-	{-0.9259, 0.3032, -0.2253, 0.1042},
-	{0.5845, 0.0351, -0.8106, 0.5501},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{-0.8279, -0.4407, 0.3468, 0.8804},
-	{0.1122, -0.9280, 0.3554, 0.8862},
-	{0.1546, -0.8735, 0.4616, 0.8831},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.2616, 0.7317, 0.6294, 0.7420},
-	{0.0441, 0.9041, 0.4251, 0.7379},
-	{0.8703, 0.2799, -0.4053, 0.6469},
-	{0.7898, 0.5275, -0.3129, 0.6391},
-	{0.8867, 0.3875, 0.2523, 0.6303},
-	{0.6145, -0.4954, -0.6140, 0.0895},
-	{0.4773, -0.2967, -0.8271, 0.0880},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{0.2741, 0.9578, 0.0866, 0.8434},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.6238, 0.7294, 0.2807, 0.1275},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{-0.3479, 0.8329, 0.4303, 0.1219},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{0.3357, 0.2379, 0.9114, 0.7189},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{-0.6796, 0.1462, 0.7189, 0.7504},
-	{-0.5779, 0.1707, 0.7981, 0.7546},
-	{-0.4299, -0.0243, 0.9025, 0.7541},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{-0.2137, -0.9605, -0.1784, 0.2330},
-	{-0.1632, -0.9518, 0.2597, 0.2507},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{0.3838, 0.9222, 0.0465, 0.7180},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{-0.8496, 0.5161, -0.1091, 0.6061},
-	{-0.9366, -0.2467, -0.2488, 0.6033},
-	{-0.9642, 0.2629, 0.0357, 0.5819},
-	{0.0474, 0.6273, 0.7773, 0.0363},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{0.6137, 0.7808, 0.1173, 0.7223},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.5198, 0.4726, 0.7117, 0.7189},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{0.7194, -0.2848, -0.6335, 0.8724},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{-0.8468, 0.0758, 0.5264, 0.7154},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{-0.1161, 0.5786, 0.8073, 0.0534},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{-0.7180, 0.3291, 0.6134, 0.0461},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.9737, 0.0178, 0.2269, 0.2304},
-	{-0.9039, 0.0524, -0.4245, 0.2582},
-	{-0.7818, 0.5826, -0.2221, 0.2525},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{0.9742, -0.1633, -0.1559, 0.7851},
-	{0.9825, 0.0541, 0.1780, 0.7968},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{0.1475, 0.8808, -0.4499, 0.6093},
-	{0.4481, 0.8321, -0.3268, 0.6188},
-	{0.3911, 0.8852, -0.2517, 0.5960},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.6541, -0.1749, 0.7359, 0.7051},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{0.4159, 0.3398, -0.8436, 0.9345},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.7604, 0.6245, -0.1784, 0.9774},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{0.8562, 0.0205, -0.5163, 0.9898},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.7548, 0.5797, -0.3070, 0.5179},
-	{-0.6071, 0.7803, -0.1503, 0.5056},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{0.2955, -0.2901, 0.9102, 0.9737},
-	{0.5903, 0.0384, 0.8063, 0.9688},
-	{-0.3022, 0.8035, -0.5129, 0.0107},
-	{-0.2266, 0.8250, -0.5177, 0.0126},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{0.2615, -0.5752, -0.7751, 0.3883},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.2589, 0.0997, -0.9608, 0.3885},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{-0.0124, 0.2814, 0.9595, 0.1996},
-	{-0.3597, 0.0793, 0.9297, 0.1981},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{-0.9442, 0.1750, 0.2788, 0.6972},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.8275, 0.4334, -0.3569, 0.2216},
-	{-0.7787, 0.4834, -0.3999, 0.2496},
-	{0.1833, 0.8818, 0.4346, 0.8626},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.2671, 0.9552, -0.1271, 0.8686},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.8682, 0.1707, 0.4659, 0.3106},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{-0.7319, 0.1277, -0.6694, 0.1853},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.5586, -0.0152, -0.8293, 0.1682},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{0.7299, 0.6038, 0.3203, 0.8813},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{0.9242, 0.3816, 0.0181, 0.8979},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{0.4072, 0.2197, -0.8865, 0.0757},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{0.9146, 0.1285, -0.3833, 0.0845},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{0.6528, -0.0657, -0.7547, 0.1017},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{-0.8424, -0.5052, -0.1876, 0.1260},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{-0.8270, -0.2832, -0.4856, 0.8817},
-	{-0.4254, -0.2550, -0.8684, 0.8815},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.6153, -0.3223, 0.7194, 0.8374},
-	{0.8584, 0.2993, 0.4165, 0.8477},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.4072, 0.2197, -0.8865, 0.5801},
-	{0.2589, 0.0997, -0.9608, 0.5621},
-	{0.3951, -0.2508, -0.8837, 0.5694},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{-0.5942, 0.7714, 0.2277, 0.8624},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.5083, 0.6049, -0.6130, 0.8812},
-	{-0.8750, 0.4797, -0.0649, 0.6556},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{0.6023, -0.7173, -0.3503, 0.5523},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.7162, -0.5213, -0.4640, 0.5509},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{-0.1434, -0.8472, 0.5116, 0.6969},
-	{-0.3296, -0.9391, 0.0976, 0.6237},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.4274, 0.5541, -0.7143, 0.9311},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.0822, 0.4653, -0.8814, 0.9439},
-	{0.3418, -0.3041, 0.8892, 0.1602},
-	{-0.2773, -0.1585, 0.9476, 0.1625},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{0.6514, -0.3862, -0.6531, 0.5536},
-	{0.5257, -0.5779, -0.6242, 0.5526},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.6086, 0.7648, 0.2113, 0.0830},
-	{0.8958, 0.3738, 0.2404, 0.0873},
-	{-0.1297, -0.9403, 0.3148, 0.3120},
-	{-0.6493, -0.7577, -0.0651, 0.3154},
-	{-0.4917, -0.7379, 0.4623, 0.3244},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{-0.1392, 0.2158, 0.9665, 0.0525},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.3296, -0.9391, 0.0976, 0.6237},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{0.1480, -0.7030, 0.6956, 0.6834},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{-0.9701, 0.2080, -0.1247, 0.5081},
-	{-0.8476, 0.0971, -0.5217, 0.4904},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{-0.5413, 0.5376, -0.6465, 0.1204},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{0.6262, 0.0104, -0.7796, 0.5733},
-	{0.7346, 0.2381, -0.6353, 0.5747},
-	{-0.3022, 0.8035, -0.5129, 0.9909},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{-0.2266, 0.8250, -0.5177, 0.9843},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{0.1679, -0.5133, 0.8416, 0.4528},
-	{0.3718, 0.3341, 0.8661, 0.4550},
-	{0.6253, 0.5681, -0.5350, 0.0385},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{-0.3122, -0.9336, -0.1762, 0.8274},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{-0.3899, -0.6640, 0.6380, 0.6314},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{0.0896, -0.5786, 0.8107, 0.6212},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{-0.3708, -0.7673, 0.5232, 0.6197},
-	{-0.4185, 0.7714, 0.4793, 0.2564},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{0.2190, 0.9223, -0.3184, 0.9683},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{0.7604, 0.6245, -0.1784, 0.9774},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.7439, -0.5372, 0.3976, 0.6294},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.8927, 0.1149, 0.4357, 0.2941},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{-0.6841, 0.7055, 0.1851, 0.7331},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.7158, 0.6526, 0.2486, 0.6546},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.8572, 0.3182, -0.4049, 0.0086},
-	{0.6528, -0.0657, -0.7547, 0.0156},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{0.0745, -0.9969, -0.0259, 0.1644},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{0.6528, -0.0657, -0.7547, 0.0156},
-	{0.1214, -0.3144, -0.9415, 0.0253},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{-0.0339, -0.9994, 0.0048, 0.2602},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{-0.0000, -0.8889, 0.4580, 0.2342},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{0.0079, -0.8955, 0.4450, 0.6503},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.6248, -0.2959, 0.7225, 0.9100},
-	{-0.9175, -0.3395, -0.2071, 0.9097},
-	{0.8179, -0.4907, -0.3005, 0.4453},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{-0.7639, 0.2401, -0.5990, 0.9149},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{-0.3307, 0.5962, -0.7316, 0.9134},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{0.0675, -0.9023, -0.4257, 0.2012},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{0.6916, 0.7202, 0.0548, 0.1342},
-	{-0.0110, 0.5258, 0.8506, 0.1456},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.2999, 0.6118, -0.7319, 0.8806},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.0854, -0.7503, -0.6556, 0.1941},
-	{-0.8371, -0.1053, -0.5368, 0.2029},
-	{-0.2409, -0.6805, -0.6920, 0.1686},
-	{0.8455, -0.2186, 0.4873, 0.2268},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{0.9603, -0.2203, 0.1710, 0.0774},
-	{0.7277, 0.5585, -0.3981, 0.0806},
-	{0.9497, 0.0426, 0.3102, 0.0705},
-	{-0.8337, 0.3697, 0.4103, 0.8876},
-	{-0.6831, 0.7232, -0.1019, 0.8942},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{0.7696, 0.2955, -0.5660, 0.0437},
-	{0.7277, 0.5585, -0.3981, 0.0375},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.9558, -0.2830, 0.0794, 0.7672},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{0.7439, -0.5372, 0.3976, 0.6294},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{0.7598, -0.3354, 0.5570, 0.8018},
-	{-0.7902, -0.6081, -0.0756, 0.6184},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{-0.3789, -0.7091, 0.5947, 0.6143},
-	{-0.9330, -0.3576, -0.0405, 0.2161},
-	{-0.4740, -0.3401, 0.8122, 0.2182},
-	{0.3793, -0.3260, 0.8659, 0.2170},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{0.6697, 0.0931, -0.7368, 0.2109},
-	{-0.4116, 0.6903, -0.5951, 0.2117},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{0.4095, 0.7255, -0.5531, 0.2237},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{0.7325, 0.1673, 0.6599, 0.3627},
-	{0.7742, 0.2596, 0.5773, 0.3530},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{-0.6863, 0.0094, 0.7273, 0.6627},
-	{-0.9885, 0.1506, -0.0125, 0.6743},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{0.7598, -0.3354, 0.5570, 0.8018},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{-0.1662, -0.0856, 0.9824, 0.7429},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{0.3438, 0.4810, 0.8065, 0.1103},
-	{-0.6160, 0.4382, 0.6546, 0.1001},
-	{-0.7951, -0.5325, 0.2903, 0.6209},
-	{-0.6136, 0.0291, 0.7891, 0.6105},
-	{-0.4577, -0.5685, 0.6836, 0.6079},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{-0.7292, 0.2842, 0.6225, 0.5065},
-	{-0.5259, 0.2486, 0.8134, 0.5189},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{0.3328, 0.9363, 0.1120, 0.4513},
-	{0.8085, 0.1793, 0.5605, 0.1917},
-	{0.8539, -0.4209, 0.3062, 0.1932},
-	{-0.3597, 0.0793, 0.9297, 0.1981},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{-0.5321, 0.4244, -0.7326, 0.6066},
-	{-0.7754, 0.1118, -0.6216, 0.6233},
-	{-0.1885, 0.0785, 0.9789, 0.5551},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{0.2312, 0.3824, 0.8946, 0.5621},
-	{0.8927, 0.1149, 0.4357, 0.2941},
-	{0.7699, 0.0425, 0.6367, 0.2893},
-	{0.8023, 0.3144, 0.5074, 0.2986},
-	{-0.0638, 0.7133, 0.6979, 0.2664},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{-0.7014, 0.6824, 0.2057, 0.2439},
-	{-0.5758, 0.5612, -0.5946, 0.8956},
-	{-0.5001, 0.8160, -0.2900, 0.9044},
-	{-0.7870, 0.4590, -0.4123, 0.9021},
-	{0.4481, 0.8321, -0.3268, 0.3082},
-	{0.3704, -0.0645, -0.9266, 0.2946},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{-0.5175, -0.6904, -0.5056, 0.6970},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{-0.2062, -0.8787, 0.4306, 0.6970},
-	{-0.4223, -0.5637, -0.7099, 0.6950},
-	{-0.1835, -0.7467, -0.6393, 0.6949},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{-0.6040, -0.4385, -0.6655, 0.0421},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{-0.5247, -0.4905, -0.6957, 0.0376},
-	{-0.2778, -0.9466, 0.1638, 0.8600},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{-0.5315, -0.8099, -0.2480, 0.8670},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{-0.4448, -0.5400, -0.7145, 0.2172},
-	{-0.6773, -0.5073, -0.5329, 0.2265},
-	{0.8179, -0.4907, -0.3005, 0.4453},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.9646, -0.2439, -0.1004, 0.3860},
-	{0.7779, 0.6218, 0.0908, 0.3776},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.8020, -0.1630, 0.5747, 0.5537},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{-0.2773, -0.1585, 0.9476, 0.5428},
-	{0.1977, -0.0914, -0.9760, 0.8890},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.1829, -0.6633, -0.7257, 0.4097},
-	{0.5524, -0.7496, 0.3646, 0.4055},
-	{0.5203, -0.4377, -0.7333, 0.4151},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{0.9429, -0.1702, 0.2862, 0.3539},
-	{0.8177, 0.0106, 0.5755, 0.3369},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{-0.2241, 0.5052, 0.8334, 0.3308},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{0.6137, 0.7808, 0.1173, 0.7223},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{0.2402, 0.0276, -0.9703, 0.9163},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{-0.3243, 0.7713, -0.5477, 0.1609},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{-0.2986, -0.8941, -0.3339, 0.0603},
-	{-0.0107, -0.9588, -0.2839, 0.0731},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{-0.9545, 0.2860, 0.0851, 0.9256},
-	{0.0415, 0.6355, 0.7710, 0.2749},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{0.2864, 0.3616, 0.8873, 0.2893},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{0.1720, -0.0618, -0.9832, 0.9529},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{-0.6034, 0.1195, -0.7885, 0.9628},
-	{-0.5415, 0.3814, -0.7492, 0.9675},
-	{-0.3037, 0.6004, -0.7398, 0.9351},
-	{-0.7292, 0.2842, 0.6225, 0.3365},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{-0.6041, -0.6306, 0.4872, 0.7190},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{-0.1632, -0.9518, 0.2597, 0.8307},
-	{-0.2137, -0.9605, -0.1784, 0.8155},
-	{-0.0419, -0.9496, 0.3107, 0.8236},
-	{0.1007, -0.4912, -0.8652, 0.5573},
-	{0.8221, -0.5535, -0.1334, 0.5519},
-	{0.8118, -0.4978, -0.3052, 0.5538},
-	{-0.8896, -0.1610, -0.4274, 0.7163},
-	{-0.7427, -0.5655, -0.3586, 0.7631},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{0.1301, -0.0722, 0.9889, 0.4699},
-	{-0.3128, -0.1142, 0.9429, 0.4545},
-	{-0.2813, -0.1737, 0.9438, 0.4606},
-	{0.9387, 0.3345, 0.0828, 0.0843},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.8564, -0.5112, -0.0728, 0.1771},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.6262, 0.0104, -0.7796, 0.1225},
-	{0.4035, -0.4619, -0.7898, 0.1185},
-	{0.8584, 0.2993, 0.4165, 0.8477},
-	{0.8416, 0.2044, 0.4999, 0.8651},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{-0.8993, -0.4372, 0.0133, 0.1225},
-	{-0.6863, 0.0094, 0.7273, 0.1195},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{-0.2307, 0.7129, 0.6623, 0.3352},
-	{-0.8980, 0.2954, 0.3262, 0.3298},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{0.5075, 0.7911, -0.3416, 0.0491},
-	{0.3976, 0.8504, -0.3447, 0.0148},
-	{0.7463, 0.5882, -0.3115, 0.0386},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{0.7147, 0.5899, -0.3757, 0.1650},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.9771, -0.0602, -0.2041, 0.0739},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.9330, -0.3576, -0.0405, 0.2161},
-	{-0.5668, -0.8197, 0.0829, 0.2182},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{0.2592, 0.0554, -0.9642, 0.9585},
-	{-0.3856, 0.6785, 0.6253, 0.9421},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{-0.6136, 0.0291, 0.7891, 0.9528},
-	{0.9517, -0.0684, -0.2993, 0.1692},
-	{0.4561, -0.0727, -0.8870, 0.1649},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.4565, 0.8811, 0.1235, 0.3712},
-	{-0.5988, 0.7541, 0.2698, 0.3632},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.7491, 0.0856, 0.6569, 0.3869},
-	{0.6471, 0.2960, 0.7026, 0.3755},
-	{-0.1740, 0.9785, 0.1109, 0.6974},
-	{-0.4653, 0.0260, -0.8848, 0.6952},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{-0.2788, 0.9589, 0.0518, 0.9022},
-	{-0.0565, 0.6602, 0.7489, 0.9152},
-	{0.6894, 0.7049, 0.1667, 0.8951},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{0.9727, 0.1849, 0.1403, 0.4232},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{0.6407, -0.4697, -0.6073, 0.4288},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{-0.7772, -0.3624, 0.5144, 0.3298},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{0.2700, -0.0139, -0.9627, 0.4478},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{-0.1192, 0.9575, 0.2626, 0.2220},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{0.6845, -0.0171, 0.7288, 0.1510},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.7742, 0.2596, 0.5773, 0.3530},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.7779, 0.6218, 0.0908, 0.3776},
-	{0.8919, -0.4507, 0.0369, 0.7777},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{-0.1096, -0.6085, 0.7859, 0.6224},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{0.7220, 0.5659, 0.3981, 0.8883},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.1720, -0.0618, -0.9832, 0.9529},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.1112, 0.9938, 0.0005, 0.3839},
-	{-0.6611, 0.7252, 0.1925, 0.3750},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{-0.7215, 0.6525, -0.2318, 0.1547},
-	{-0.7927, 0.6095, -0.0127, 0.7270},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{-0.4653, 0.0260, -0.8848, 0.6952},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.6325, 0.5786, 0.5149, 0.9671},
-	{-0.0947, 0.9861, -0.1367, 0.9558},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.0136, 0.9965, 0.0830, 0.4623},
-	{0.2852, 0.8849, 0.3684, 0.4825},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{0.6756, 0.2814, -0.6814, 0.5522},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{-0.8109, 0.4549, 0.3681, 0.2450},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{-0.0437, -0.5611, 0.8266, 0.6594},
-	{0.3793, -0.3260, 0.8659, 0.6694},
-	{-0.4740, -0.3401, 0.8122, 0.6613},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{-0.9206, 0.3127, -0.2339, 0.0384},
-	{-0.9846, -0.0281, -0.1725, 0.0369},
-	{-0.1438, 0.6836, -0.7156, 0.2337},
-	{0.4889, 0.7745, 0.4013, 0.2413},
-	{0.1788, 0.9561, -0.2323, 0.2317},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.9558, -0.2830, 0.0794, 0.7672},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{-0.9214, 0.3077, -0.2376, 0.9751},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{-0.9775, -0.0590, -0.2026, 0.9604},
-	{0.7043, 0.2073, 0.6789, 0.2814},
-	{0.2308, 0.8675, 0.4406, 0.2773},
-	{0.5343, 0.4108, 0.7387, 0.2819},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.2477, -0.8990, -0.3610, 0.1455},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{-0.6733, -0.5739, -0.4662, 0.1548},
-	{-0.3436, -0.4323, -0.8337, 0.1659},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{-0.1289, -0.5984, -0.7907, 0.2006},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.3043, -0.9223, 0.2380, 0.7379},
-	{-0.3122, -0.9336, -0.1762, 0.7481},
-	{0.0934, 0.7683, -0.6332, 0.1846},
-	{0.0329, 0.9376, 0.3462, 0.1359},
-	{0.3213, 0.9419, -0.0976, 0.1381},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{0.1762, -0.9844, -0.0040, 0.2266},
-	{0.8455, -0.2186, 0.4873, 0.2268},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{0.0474, 0.6273, 0.7773, 0.0363},
-	{-0.4996, 0.8475, 0.1792, 0.0344},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{-0.0541, 0.7990, 0.5989, 0.7183},
-	{-0.1867, 0.3659, 0.9117, 0.2766},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{-0.7328, 0.6604, 0.1638, 0.7559},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{-0.4976, -0.0473, 0.8661, 0.7176},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.6090, -0.0175, 0.7930, 0.6934},
-	{0.2760, 0.9216, 0.2729, 0.4080},
-	{-0.4172, 0.5113, -0.7514, 0.4096},
-	{0.3518, 0.3483, -0.8689, 0.4164},
-	{0.1009, -0.6644, 0.7406, 0.6694},
-	{0.3793, -0.3260, 0.8659, 0.6694},
-	{-0.0437, -0.5611, 0.8266, 0.6594},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{0.5216, -0.8309, 0.1937, 0.8500},
-	{0.0290, -0.9995, 0.0120, 0.8345},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{-0.6658, 0.5287, 0.5265, 0.7597},
-	{-0.9880, -0.1501, 0.0354, 0.7605},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{0.2366, 0.7306, -0.6405, 0.9167},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.5075, 0.7911, -0.3416, 0.0772},
-	{0.6086, 0.7648, 0.2113, 0.0830},
-	{-0.9737, 0.0178, 0.2269, 0.6597},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9890, -0.1306, 0.0692, 0.6453},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{0.9825, 0.0541, 0.1780, 0.7968},
-	{0.6471, 0.2960, 0.7026, 0.8098},
-	{0.0059, -0.5459, -0.8378, 0.1721},
-	{0.8564, -0.5112, -0.0728, 0.1771},
-	{0.2477, -0.8990, -0.3610, 0.1455},
-	{-0.6154, 0.6377, -0.4634, 0.2931},
-	{-0.8919, 0.4523, 0.0060, 0.3044},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{0.2535, -0.8114, 0.5267, 0.3405},
-	{-0.1632, -0.9518, 0.2597, 0.3401},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.8682, 0.1707, 0.4659, 0.8883},
-	{0.8363, 0.3359, 0.4334, 0.8947},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.2671, 0.9552, -0.1271, 0.8686},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{0.2535, -0.8114, 0.5267, 0.2564},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{-0.6860, -0.4591, -0.5645, 0.7613},
-	{-0.9442, 0.1750, 0.2788, 0.6972},
-	{-0.5175, -0.6904, -0.5056, 0.6970},
-	{-0.2062, -0.8787, 0.4306, 0.6970},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.4299, -0.0243, 0.9025, 0.7541},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.6796, 0.1462, 0.7189, 0.7504},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.7299, 0.6038, 0.3203, 0.6455},
-	{0.4615, 0.4621, 0.7572, 0.6280},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{0.1318, -0.1373, -0.9817, 0.5631},
-	{-0.1006, -0.3306, -0.9384, 0.5758},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.7379, 0.4419, 0.5101, 0.9849},
-	{-0.6325, 0.5786, 0.5149, 0.9671},
-	{0.1361, 0.4282, 0.8934, 0.9717},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{0.4783, -0.8590, 0.1828, 0.8232},
-	{0.0347, -0.8970, -0.4407, 0.8360},
-	{-0.5826, 0.7809, -0.2256, 0.8671},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{-0.8275, 0.4334, -0.3569, 0.2216},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.3122, -0.9336, -0.1762, 0.9147},
-	{-0.0481, -0.9889, 0.1403, 0.9213},
-	{-0.0091, -0.9999, 0.0097, 0.9006},
-	{-0.8279, -0.4407, 0.3468, 0.8804},
-	{-0.6573, -0.6227, 0.4245, 0.8865},
-	{0.1122, -0.9280, 0.3554, 0.8862},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{-0.8937, 0.4360, 0.1062, 0.6998},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{0.5903, 0.0384, 0.8063, 0.5831},
-	{0.3103, -0.0983, 0.9456, 0.5759},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{0.0415, 0.6355, 0.7710, 0.4417},
-	{0.2864, 0.3616, 0.8873, 0.4485},
-	{0.8212, -0.5707, -0.0026, 0.7783},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{0.4815, -0.8623, -0.1567, 0.7968},
-	{0.1224, -0.6692, -0.7329, 0.3908},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.2615, -0.5752, -0.7751, 0.3883},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.6278, 0.1343, 0.7667, 0.0197},
-	{0.9442, -0.2121, 0.2520, 0.0235},
-	{0.2864, 0.3616, 0.8873, 0.2893},
-	{-0.1867, 0.3659, 0.9117, 0.2766},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{-0.4134, -0.8569, -0.3080, 0.7119},
-	{-0.0749, -0.9885, -0.1310, 0.7124},
-	{-0.2447, -0.9353, 0.2556, 0.7148},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.4889, 0.7745, 0.4013, 0.8776},
-	{0.3648, 0.9202, -0.1421, 0.8767},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.9205, -0.2688, -0.2836, 0.2578},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.8773, -0.3136, -0.3632, 0.3040},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.6796, 0.1462, 0.7189, 0.7504},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.1749, 0.4767, 0.8615, 0.7842},
-	{-0.3082, 0.3755, -0.8741, 0.5698},
-	{0.3213, 0.9419, -0.0976, 0.5844},
-	{-0.6154, 0.6377, -0.4634, 0.5742},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.4217, -0.2859, -0.8605, 0.0408},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{-0.7149, -0.5345, 0.4508, 0.7205},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{-0.2778, -0.9466, 0.1638, 0.8600},
-	{-0.5315, -0.8099, -0.2480, 0.8670},
-	{0.4344, -0.8812, -0.1864, 0.7593},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{0.8212, -0.5707, -0.0026, 0.7783},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.1456, 0.6936, -0.7055, 0.2446},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{0.7463, 0.5882, -0.3115, 0.9930},
-	{0.7604, 0.6245, -0.1784, 0.9774},
-	{0.8562, 0.0205, -0.5163, 0.9898},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.6613, 0.7378, -0.1354, 0.9443},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.6611, 0.7252, 0.1925, 0.3750},
-	{-0.4565, 0.8811, 0.1235, 0.3712},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.9136, 0.3934, 0.1027, 0.2278},
-	{-0.8584, 0.2331, 0.4569, 0.2480},
-	{-0.5859, -0.2830, -0.7594, 0.6015},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9334, 0.2796, 0.2248, 0.6661},
-	{-0.9656, 0.2599, 0.0054, 0.6611},
-	{0.0896, -0.5786, 0.8107, 0.6212},
-	{-0.1856, -0.9124, 0.3648, 0.6256},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{0.2953, -0.6258, 0.7219, 0.7940},
-	{0.7598, -0.3354, 0.5570, 0.8018},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{-0.6880, 0.4614, 0.5602, 0.9398},
-	{-0.5415, -0.5234, 0.6579, 0.9402},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{0.3691, -0.7519, 0.5463, 0.6325},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{-0.1192, 0.9575, 0.2626, 0.2220},
-	{-0.4185, 0.7714, 0.4793, 0.2564},
-	{-0.2999, 0.6118, -0.7319, 0.8806},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.5758, 0.5612, -0.5946, 0.8956},
-	{-0.7639, 0.2401, -0.5990, 0.3829},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{-0.6158, -0.0817, -0.7837, 0.3727},
-	{0.8416, 0.2044, 0.4999, 0.8651},
-	{0.4208, 0.8724, 0.2486, 0.8662},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{-0.5204, 0.5779, 0.6287, 0.3893},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{-0.7379, 0.4419, 0.5101, 0.4031},
-	{0.9774, 0.0562, -0.2040, 0.2356},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.9205, -0.2688, -0.2836, 0.2578},
-	{-0.4120, 0.7796, -0.4716, 0.6847},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.9885, 0.1506, -0.0125, 0.6743},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{0.2402, 0.0276, -0.9703, 0.9163},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{0.5372, 0.8433, -0.0135, 0.5909},
-	{-0.2453, 0.8795, 0.4079, 0.5945},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{-0.1392, 0.2158, 0.9665, 0.0525},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{-0.2878, 0.3573, 0.8885, 0.3345},
-	{-0.8980, 0.2954, 0.3262, 0.3298},
-	{-0.5204, 0.5779, 0.6287, 0.3289},
-	{0.7864, 0.5650, 0.2497, 0.0766},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{-0.8270, -0.2832, -0.4856, 0.8817},
-	{-0.7590, -0.5274, 0.3817, 0.8812},
-	{0.4031, 0.8693, -0.2860, 0.0759},
-	{0.5139, 0.8212, 0.2479, 0.0607},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.9846, -0.0281, -0.1725, 0.5612},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.8252, 0.1046, 0.5551, 0.5807},
-	{-0.8424, -0.5052, -0.1876, 0.4742},
-	{-0.6733, -0.5739, -0.4662, 0.4668},
-	{-0.8718, -0.2590, -0.4158, 0.4581},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{0.4706, 0.2924, 0.8325, 0.6072},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.6845, -0.0171, 0.7288, 0.6045},
-	{-0.9890, -0.0368, -0.1431, 0.9619},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{-0.0922, -0.2711, -0.9581, 0.0288},
-	{0.9244, 0.0952, -0.3693, 0.0185},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{-0.6021, -0.3146, -0.7338, 0.8822},
-	{-0.7958, -0.3691, -0.4801, 0.0510},
-	{-0.9487, -0.2730, -0.1598, 0.0590},
-	{-0.9306, -0.2509, 0.2666, 0.0623},
-	{0.7699, 0.0425, 0.6367, 0.2893},
-	{0.8927, 0.1149, 0.4357, 0.2941},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.9302, -0.3645, -0.0428, 0.2514},
-	{0.8939, -0.2588, 0.3660, 0.2410},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{-0.4185, 0.7714, 0.4793, 0.7136},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.7993, 0.5004, 0.3329, 0.7339},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{-0.3082, 0.3755, -0.8741, 0.3123},
-	{-0.6154, 0.6377, -0.4634, 0.2931},
-	{-0.5083, 0.6049, -0.6130, 0.8812},
-	{-0.9675, 0.2481, -0.0487, 0.8780},
-	{-0.5942, 0.7714, 0.2277, 0.8624},
-	{0.9771, -0.0602, -0.2041, 0.5210},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.6755, -0.3762, -0.6342, 0.5374},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{0.2738, -0.6418, -0.7164, 0.1206},
-	{-0.7700, -0.3137, 0.5556, 0.2493},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{-0.9890, -0.1306, 0.0692, 0.2316},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{0.6278, 0.1343, 0.7667, 0.0197},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{-0.8496, 0.5161, -0.1091, 0.6061},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{-0.9366, -0.2467, -0.2488, 0.6033},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{-0.8462, 0.1898, -0.4979, 0.1797},
-	{-0.6160, 0.4382, 0.6546, 0.1001},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{-0.5863, 0.4679, -0.6613, 0.0962},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.8459, 0.5166, -0.1327, 0.1045},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.2409, -0.6805, -0.6920, 0.1686},
-	{-0.8371, -0.1053, -0.5368, 0.2029},
-	{0.1299, 0.6400, 0.7574, 0.7998},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{-0.9890, -0.0368, -0.1431, 0.9619},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{-0.9366, -0.2467, -0.2488, 0.9428},
-	{0.2852, 0.8849, 0.3684, 0.4825},
-	{-0.0136, 0.9965, 0.0830, 0.4623},
-	{0.7864, 0.5650, 0.2497, 0.4766},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{-0.9135, 0.2882, -0.2873, 0.2315},
-	{-0.9214, 0.3077, -0.2376, 0.2660},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.8000, -0.5943, -0.0821, 0.4126},
-	{0.5853, -0.6279, -0.5130, 0.4162},
-	{0.5751, -0.0706, 0.8150, 0.9634},
-	{0.6121, 0.1059, 0.7836, 0.9559},
-	{0.7278, -0.3236, 0.6047, 0.9806},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{-0.6831, 0.7232, -0.1019, 0.9042},
-	{-0.7570, 0.6309, -0.1702, 0.9480},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{-0.8175, -0.1724, 0.5496, 0.9491},
-	{-0.3527, 0.5343, -0.7682, 0.9121},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{0.9646, -0.2439, -0.1004, 0.3860},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.1224, -0.6692, -0.7329, 0.3908},
-	{0.3832, 0.6734, 0.6322, 0.0637},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{-0.1161, 0.5786, 0.8073, 0.0534},
-	{0.3316, -0.3475, -0.8771, 0.4194},
-	{0.5203, -0.4377, -0.7333, 0.4151},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{-0.8570, 0.5126, -0.0526, 0.1302},
-	{-0.8751, 0.3795, -0.3002, 0.1188},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{0.7843, -0.3281, 0.5266, 0.6508},
-	{0.5853, -0.6279, -0.5130, 0.6546},
-	{0.8000, -0.5943, -0.0821, 0.6554},
-	{0.0415, 0.6355, 0.7710, 0.2749},
-	{-0.3714, 0.7472, 0.5511, 0.2622},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{-0.2453, 0.8795, 0.4079, 0.8389},
-	{0.5372, 0.8433, -0.0135, 0.8390},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{0.5541, 0.8229, 0.1259, 0.1186},
-	{0.3438, 0.4810, 0.8065, 0.1103},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{0.7604, 0.6245, -0.1784, 0.9774},
-	{0.3976, 0.8504, -0.3447, 0.9711},
-	{0.2190, 0.9223, -0.3184, 0.9683},
-	{-0.4917, -0.7379, 0.4623, 0.6825},
-	{-0.4223, -0.5637, -0.7099, 0.6855},
-	{-0.7772, -0.3624, 0.5144, 0.6975},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.3233, 0.2994, 0.8977, 0.3960},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{-0.2657, -0.9215, 0.2832, 0.7015},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.7927, 0.6095, -0.0127, 0.7270},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{0.2110, -0.9510, -0.2259, 0.7192},
-	{-0.6041, -0.6306, 0.4872, 0.7190},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{-0.5087, -0.1668, 0.8447, 0.2735},
-	{0.0290, -0.9995, 0.0120, 0.8345},
-	{0.5216, -0.8309, 0.1937, 0.8500},
-	{0.5081, -0.8163, -0.2747, 0.8434},
-	{0.7098, 0.5867, 0.3899, 0.7039},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{-0.8481, 0.3567, -0.3918, 0.2891},
-	{-0.8275, 0.4334, -0.3569, 0.2750},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{-0.5413, 0.5376, -0.6465, 0.1204},
-	{-0.3435, 0.0802, 0.9357, 0.8934},
-	{-0.0207, 0.4741, 0.8802, 0.9010},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{-0.0504, 0.6080, -0.7923, 0.2051},
-	{-0.0853, -0.0147, -0.9962, 0.1958},
-	{0.0841, 0.6101, -0.7878, 0.1799},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.8883, -0.3035, -0.3446, 0.7267},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.3103, -0.0983, 0.9456, 0.5759},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{0.5524, -0.7496, 0.3646, 0.6559},
-	{0.7843, -0.3281, 0.5266, 0.6508},
-	{0.8000, -0.5943, -0.0821, 0.6554},
-	{-0.7185, 0.6771, -0.1586, 0.1686},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.3561, 0.8911, -0.2813, 0.1713},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.7532, 0.1973, 0.6275, 0.7311},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.4933, -0.8223, -0.2836, 0.8319},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.5991, 0.6261, -0.4990, 0.9379},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{-0.5559, 0.8207, 0.1320, 0.7804},
-	{-0.3868, 0.9184, -0.0836, 0.7279},
-	{-0.4223, 0.8225, -0.3809, 0.7106},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{0.0967, -0.9029, -0.4189, 0.3935},
-	{0.8804, -0.3887, -0.2718, 0.3997},
-	{0.9684, -0.1415, 0.2052, 0.4178},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.3648, 0.9202, -0.1421, 0.8767},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.7824, -0.5565, 0.2797, 0.4674},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.9410, -0.1276, 0.3134, 0.3971},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{-0.2721, -0.9622, 0.0151, 0.1370},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{0.5983, -0.8012, -0.0112, 0.1382},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.1878, 0.1793, -0.9657, 0.4878},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{-0.2475, -0.9664, -0.0696, 0.0392},
-	{0.0865, -0.9926, -0.0848, 0.0196},
-	{-0.8371, -0.1053, -0.5368, 0.2029},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{0.0187, -0.9425, -0.3336, 0.8099},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{0.2615, -0.7676, -0.5852, 0.8184},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.8846, -0.0062, -0.4664, 0.1242},
-	{-0.6940, -0.1604, -0.7019, 0.1131},
-	{-0.1964, 0.4941, -0.8469, 0.1135},
-	{0.4609, 0.8793, -0.1197, 0.1448},
-	{0.2469, 0.9653, -0.0853, 0.1667},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{0.1977, -0.0914, -0.9760, 0.8890},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.5309, -0.8161, 0.2283, 0.3263},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.9136, 0.3934, 0.1027, 0.6669},
-	{-0.8803, 0.4719, 0.0491, 0.6655},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{-0.4007, 0.9022, -0.1598, 0.6972},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.7317, 0.6214, 0.2801, 0.1707},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.2773, -0.1585, 0.9476, 0.1625},
-	{-0.5701, -0.2354, -0.7871, 0.9084},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.9175, -0.3395, -0.2071, 0.9097},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{-0.8219, 0.4352, 0.3677, 0.3509},
-	{-0.8176, 0.4403, 0.3712, 0.3432},
-	{0.8564, -0.5112, -0.0728, 0.4058},
-	{0.0059, -0.5459, -0.8378, 0.3980},
-	{0.1472, 0.6436, -0.7511, 0.4043},
-	{-0.8851, -0.3374, -0.3204, 0.6593},
-	{-0.8896, -0.1610, -0.4274, 0.7163},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.7548, 0.1316, -0.6426, 0.9060},
-	{0.0344, -0.8183, -0.5737, 0.8790},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{0.3238, -0.8445, -0.4265, 0.8734},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{-0.0922, -0.2711, -0.9581, 0.0847},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{0.9597, 0.1729, 0.2216, 0.4933},
-	{0.8563, 0.5164, -0.0107, 0.5376},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{-0.8219, 0.4352, 0.3677, 0.3266},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{-0.8176, 0.4403, 0.3712, 0.3450},
-	{0.7598, -0.3354, 0.5570, 0.2019},
-	{0.2953, -0.6258, 0.7219, 0.2111},
-	{-0.3597, 0.0793, 0.9297, 0.1981},
-	{0.8416, 0.2044, 0.4999, 0.6472},
-	{0.6153, -0.3223, 0.7194, 0.6198},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{-0.5991, 0.6261, -0.4990, 0.9379},
-	{-0.5001, 0.8160, -0.2900, 0.9044},
-	{0.5240, -0.6781, -0.5153, 0.7309},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.4344, -0.8812, -0.1864, 0.7251},
-	{0.3518, 0.3483, -0.8689, 0.4164},
-	{-0.4172, 0.5113, -0.7514, 0.4096},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.5668, -0.8197, 0.0829, 0.2182},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.9771, -0.0602, -0.2041, 0.5210},
-	{0.5984, -0.3496, -0.7208, 0.5339},
-	{0.6145, -0.4954, -0.6140, 0.5218},
-	{0.6635, 0.7231, -0.1923, 0.1072},
-	{0.6886, 0.4445, 0.5730, 0.0937},
-	{0.3731, 0.9187, 0.1296, 0.1040},
-	{0.9603, -0.2203, 0.1710, 0.0774},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{0.7585, 0.3987, 0.5155, 0.2087},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.9037, 0.3671, 0.2205, 0.2195},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.5751, -0.0706, 0.8150, 0.9634},
-	{-0.9846, -0.0281, -0.1725, 0.1466},
-	{-0.9487, -0.2730, -0.1598, 0.1469},
-	{-0.7958, -0.3691, -0.4801, 0.1387},
-	{0.3468, 0.7679, -0.5386, 0.2863},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.3704, -0.0645, -0.9266, 0.2946},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{0.5580, -0.4338, 0.7074, 0.6110},
-	{0.6845, -0.0171, 0.7288, 0.6045},
-	{-0.6125, -0.7885, -0.0558, 0.3739},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{-0.9929, -0.1185, 0.0031, 0.3633},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{-0.3436, -0.4323, -0.8337, 0.1659},
-	{-0.0829, -0.3785, -0.9219, 0.1577},
-	{-0.5694, -0.0739, -0.8188, 0.1717},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.7058, 0.1194, -0.6982, 0.6156},
-	{0.7177, -0.4829, -0.5017, 0.0447},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.4217, -0.2859, -0.8605, 0.0408},
-	{-0.6325, 0.5786, 0.5149, 0.1480},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{0.1062, 0.5919, -0.7990, 0.1812},
-	{0.0002, 0.5669, -0.8238, 0.2024},
-	{0.2864, 0.3616, 0.8873, 0.2893},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{-0.1867, 0.3659, 0.9117, 0.2766},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.0367, 0.9992, 0.0168, 0.2616},
-	{0.2730, 0.8253, 0.4943, 0.2633},
-	{-0.1977, 0.8256, -0.5285, 0.2592},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{0.0667, 0.8071, 0.5866, 0.7587},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{-0.3833, -0.0618, -0.9216, 0.5706},
-	{0.2615, -0.5752, -0.7751, 0.5631},
-	{0.4072, 0.2197, -0.8865, 0.5801},
-	{-0.8270, -0.2832, -0.4856, 0.8817},
-	{-0.6486, 0.7542, -0.1023, 0.8900},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{-0.0504, 0.6080, -0.7923, 0.9957},
-	{0.2036, 0.7662, -0.6094, 0.9771},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{-0.8279, -0.4407, 0.3468, 0.9001},
-	{-0.1193, -0.8052, 0.5808, 0.9058},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.7014, 0.6824, 0.2057, 0.2439},
-	{-0.8750, 0.4797, -0.0649, 0.2249},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{0.4783, -0.8590, 0.1828, 0.8232},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{0.0967, -0.9029, -0.4189, 0.3935},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{0.3853, -0.9062, -0.1739, 0.3914},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{-0.3095, 0.9433, -0.1196, 0.7035},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{-0.8476, 0.0971, -0.5217, 0.4904},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.0106, -0.9562, 0.2925, 0.7946},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.7925, -0.1961, -0.5775, 0.8129},
-	{-0.2773, -0.1585, 0.9476, 0.5428},
-	{-0.0843, -0.2271, 0.9702, 0.5514},
-	{-0.7185, 0.6437, 0.2637, 0.5525},
-	{-0.3514, -0.5799, 0.7350, 0.5530},
-	{-0.3157, -0.0484, 0.9476, 0.5711},
-	{0.2955, -0.2901, 0.9102, 0.5626},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{-0.4280, -0.6557, 0.6220, 0.1190},
-	{0.3154, -0.2677, 0.9104, 0.1251},
-	{0.5240, -0.6781, -0.5153, 0.4336},
-	{0.8212, -0.5707, -0.0026, 0.4528},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{-0.0638, 0.7133, 0.6979, 0.4406},
-	{0.0415, 0.6355, 0.7710, 0.4417},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{0.6137, 0.7808, 0.1173, 0.7223},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{0.0925, 0.9692, 0.2281, 0.7001},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{0.2592, 0.0554, -0.9642, 0.9585},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{-0.1964, 0.4941, -0.8469, 0.9722},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{-0.6773, -0.5073, -0.5329, 0.2265},
-	{-0.8471, -0.2198, -0.4838, 0.2382},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{0.7870, 0.1409, -0.6007, 0.7646},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{0.9221, 0.2930, 0.2526, 0.6127},
-	{0.7116, 0.3457, 0.6117, 0.5908},
-	{0.8362, 0.1292, 0.5330, 0.6043},
-	{0.2738, -0.6418, -0.7164, 0.1206},
-	{-0.0829, -0.3785, -0.9219, 0.1348},
-	{-0.3436, -0.4323, -0.8337, 0.1459},
-	{-0.8496, 0.5161, -0.1091, 0.9444},
-	{-0.0066, 0.9694, 0.2453, 0.9291},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.7700, -0.3137, 0.5556, 0.2493},
-	{-0.9890, -0.1306, 0.0692, 0.2316},
-	{-0.8827, -0.3050, 0.3576, 0.2434},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{0.4815, -0.8623, -0.1567, 0.4770},
-	{0.5719, -0.6349, -0.5195, 0.4893},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{0.4844, 0.4129, 0.7713, 0.4538},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{0.7711, 0.2752, 0.5742, 0.7097},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{0.6541, -0.1749, 0.7359, 0.7051},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{0.5380, -0.8428, -0.0177, 0.8318},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{-0.2443, -0.4778, 0.8438, 0.2756},
-	{-0.5845, -0.5686, 0.5788, 0.2552},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.9221, 0.2930, 0.2526, 0.6127},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.6716, 0.5691, 0.4744, 0.6483},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.6683, 0.5889, 0.4545, 0.8830},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{0.3586, 0.8645, -0.3521, 0.8813},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{0.3357, 0.2379, 0.9114, 0.7189},
-	{-0.0541, 0.7990, 0.5989, 0.7183},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.8413, -0.0416, -0.5389, 0.8336},
-	{-0.7787, 0.4834, -0.3999, 0.2742},
-	{-0.8275, 0.4334, -0.3569, 0.2750},
-	{-0.8481, 0.3567, -0.3918, 0.2891},
-	{-0.1082, 0.5377, 0.8362, 0.7072},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.4185, 0.7714, 0.4793, 0.7136},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{-0.4974, 0.5056, -0.7049, 0.8951},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.5329, 0.3905, -0.7507, 0.1734},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{-0.5689, 0.4621, -0.6803, 0.1737},
-	{-0.4181, -0.8047, 0.4216, 0.6454},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{-0.1571, -0.7974, 0.5827, 0.6408},
-	{0.3838, 0.9222, 0.0465, 0.7180},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{-0.1858, 0.7303, -0.6574, 0.2051},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{0.7098, 0.5867, 0.3899, 0.7039},
-	{-0.3765, -0.9240, 0.0673, 0.7031},
-	{-0.6368, -0.4067, 0.6550, 0.6861},
-	{0.2337, -0.8818, 0.4096, 0.7148},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.6683, 0.5889, 0.4545, 0.8830},
-	{0.1788, 0.9561, -0.2323, 0.8773},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{-0.4911, 0.1951, 0.8490, 0.7440},
-	{-0.6246, -0.0635, 0.7783, 0.7336},
-	{-0.9050, 0.0097, -0.4252, 0.6888},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.7253, 0.0630, 0.6856, 0.5146},
-	{-0.3514, -0.5799, 0.7350, 0.5149},
-	{-0.8597, -0.4108, 0.3035, 0.4921},
-	{-0.0339, -0.9994, 0.0048, 0.0332},
-	{-0.3709, -0.6859, 0.6261, 0.0580},
-	{0.4178, -0.9083, -0.0217, 0.0596},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.0091, -0.9999, 0.0097, 0.9006},
-	{-0.0481, -0.9889, 0.1403, 0.9213},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{0.4573, 0.2614, 0.8500, 0.4070},
-	{0.1024, 0.5979, 0.7950, 0.4064},
-	{-0.0638, 0.7133, 0.6979, 0.2664},
-	{-0.1361, 0.6037, 0.7855, 0.2656},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{0.3838, 0.9222, 0.0465, 0.7180},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.4172, 0.5113, -0.7514, 0.1085},
-	{0.2760, 0.9216, 0.2729, 0.1112},
-	{-0.4666, 0.4578, 0.7568, 0.1094},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{-0.9239, 0.2541, -0.2862, 0.1075},
-	{-0.8406, 0.4391, -0.3172, 0.1118},
-	{-0.1934, -0.4228, 0.8853, 0.8343},
-	{-0.0419, -0.9496, 0.3107, 0.8236},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{-0.8219, 0.4352, 0.3677, 0.3266},
-	{-0.3917, 0.9041, 0.1710, 0.3118},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.7919, -0.5824, -0.1835, 0.2429},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{0.8830, 0.4098, 0.2289, 0.6364},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{0.9037, 0.3671, 0.2205, 0.6224},
-	{0.2662, 0.3158, 0.9107, 0.3682},
-	{-0.0745, 0.3249, 0.9428, 0.3627},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{0.5116, -0.4641, -0.7231, 0.8639},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.7194, -0.2848, -0.6335, 0.8724},
-	{0.7299, 0.6038, 0.3203, 0.6455},
-	{0.7158, 0.6526, 0.2486, 0.6546},
-	{0.6894, 0.7049, 0.1667, 0.6825},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.6635, 0.7231, -0.1923, 0.7824},
-	{-0.2986, -0.8941, -0.3339, 0.3410},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.6009, -0.6623, -0.4476, 0.3502},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{-0.9737, 0.0178, 0.2269, 0.2304},
-	{-0.9890, -0.1306, 0.0692, 0.2316},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{0.0652, 0.2155, -0.9743, 0.8821},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{-0.7328, 0.6604, 0.1638, 0.7559},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.5668, -0.8197, 0.0829, 0.2182},
-	{-0.1808, -0.8793, -0.4406, 0.2192},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{-0.0922, -0.2711, -0.9581, 0.0288},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{-0.2443, -0.4778, 0.8438, 0.2756},
-	{-0.6523, -0.4056, 0.6403, 0.2613},
-	{-0.8314, -0.3962, 0.3895, 0.2439},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{-0.0107, -0.9588, -0.2839, 0.3455},
-	{-0.2986, -0.8941, -0.3339, 0.3410},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{0.2756, 0.7552, 0.5948, 0.8976},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{0.5496, 0.5667, 0.6138, 0.9027},
-	{0.8539, -0.4209, 0.3062, 0.8058},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{0.6886, 0.4445, 0.5730, 0.0937},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.8958, 0.3738, 0.2404, 0.0873},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{0.3316, -0.3475, -0.8771, 0.4194},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.3981, 0.4950, 0.7723, 0.5888},
-	{0.7585, 0.3987, 0.5155, 0.6034},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{0.3015, -0.9494, -0.0878, 0.0309},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{0.0865, -0.9926, -0.0848, 0.0196},
-	{0.6238, 0.7294, 0.2807, 0.1188},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{0.3438, 0.4810, 0.8065, 0.1176},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{0.9825, 0.0541, 0.1780, 0.7968},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.8867, 0.3875, 0.2523, 0.9158},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.4706, 0.2924, 0.8325, 0.6072},
-	{0.6845, -0.0171, 0.7288, 0.6045},
-	{0.5580, -0.4338, 0.7074, 0.6110},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{0.1720, -0.0618, -0.9832, 0.9529},
-	{-0.2873, -0.1227, -0.9500, 0.9530},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{0.0899, 0.5360, 0.8394, 0.2010},
-	{0.3085, 0.1057, 0.9453, 0.2140},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.2700, -0.0139, -0.9627, 0.4478},
-	{0.8085, 0.1793, 0.5605, 0.1917},
-	{-0.3597, 0.0793, 0.9297, 0.1981},
-	{-0.0124, 0.2814, 0.9595, 0.1996},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{-0.6468, 0.6563, -0.3885, 0.3340},
-	{0.7824, -0.5565, 0.2797, 0.3613},
-	{0.8930, -0.3670, 0.2605, 0.3812},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.7993, 0.5004, 0.3329, 0.2686},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{-0.5087, -0.1668, 0.8447, 0.2735},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{-0.3128, -0.1142, 0.9429, 0.2788},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{0.2366, 0.7306, -0.6405, 0.9167},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.5704, -0.6525, 0.4988, 0.8307},
-	{-0.7590, -0.5274, 0.3817, 0.8812},
-	{-0.8270, -0.2832, -0.4856, 0.8817},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{0.7407, 0.4998, -0.4489, 0.7607},
-	{0.8891, 0.4550, -0.0491, 0.7608},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{-0.3436, -0.4323, -0.8337, 0.1659},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{-0.0107, -0.9588, -0.2839, 0.0731},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.3789, -0.7091, 0.5947, 0.6143},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{-0.2882, 0.7606, -0.5818, 0.2166},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{0.4707, -0.8229, 0.3184, 0.7198},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.6879, 0.7258, 0.0008, 0.9174},
-	{-0.1235, 0.7156, 0.6875, 0.9227},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{0.2955, -0.2901, 0.9102, 0.9737},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.4072, 0.2197, -0.8865, 0.5801},
-	{-0.0543, 0.4619, -0.8853, 0.5708},
-	{-0.3833, -0.0618, -0.9216, 0.5706},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{-0.4536, 0.3068, 0.8367, 0.7210},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{0.8137, 0.4732, -0.3377, 0.0945},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{0.0978, -0.8102, 0.5780, 0.6999},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{0.5240, -0.6781, -0.5153, 0.7309},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.3479, 0.8329, 0.4303, 0.1219},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{-0.9007, -0.0366, -0.4329, 0.2422},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{0.5272, -0.2673, -0.8066, 0.7489},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{0.5240, -0.6781, -0.5153, 0.7309},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{-0.9701, 0.2080, -0.1247, 0.4616},
-	{-0.9391, 0.3339, -0.0815, 0.4703},
-	{-0.5704, -0.6212, 0.5373, 0.9163},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{0.5747, -0.7967, 0.1871, 0.0350},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.4477, -0.7783, 0.4401, 0.0279},
-	{-0.6611, 0.7252, 0.1925, 0.2809},
-	{-0.7787, 0.4834, -0.3999, 0.2742},
-	{-0.8481, 0.3567, -0.3918, 0.2891},
-	{0.7946, 0.0675, 0.6033, 0.4050},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{0.5618, 0.3684, -0.7407, 0.1029},
-	{0.6756, 0.2814, -0.6814, 0.1049},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{-0.7570, 0.6309, -0.1702, 0.9480},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{0.8563, 0.5164, -0.0107, 0.9361},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{0.4031, 0.8693, -0.2860, 0.0661},
-	{-0.6623, 0.7483, -0.0359, 0.0592},
-	{0.2164, 0.7439, 0.6323, 0.0625},
-	{-0.4308, 0.3968, 0.8106, 0.9739},
-	{-0.2045, 0.5912, 0.7801, 0.9552},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{0.6797, -0.4199, 0.6014, 0.7670},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{-0.9996, 0.0183, -0.0197, 0.7675},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{-0.8235, 0.0960, -0.5591, 0.6222},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{-0.1193, -0.8052, 0.5808, 0.8626},
-	{0.1546, -0.8735, 0.4616, 0.8831},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.3732, 0.2623, 0.8899, 0.7289},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{-0.6831, 0.7232, -0.1019, 0.9042},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{0.3497, -0.9030, -0.2498, 0.0444},
-	{0.3561, -0.6832, 0.6376, 0.0518},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{0.7582, -0.6370, -0.1391, 0.8896},
-	{0.1546, -0.8735, 0.4616, 0.8834},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{-0.9136, 0.3934, 0.1027, 0.2278},
-	{-0.8109, 0.4549, 0.3681, 0.2450},
-	{-0.8803, 0.4719, 0.0491, 0.2253},
-	{-0.2683, 0.8985, -0.3475, 0.2620},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.2788, 0.9589, 0.0518, 0.2640},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.6274, -0.2245, 0.7456, 0.7572},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{0.7870, 0.1409, -0.6007, 0.7646},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.6940, -0.1604, -0.7019, 0.1131},
-	{-0.8846, -0.0062, -0.4664, 0.1242},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{0.4778, 0.3240, -0.8165, 0.3549},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{0.1844, -0.7136, -0.6758, 0.3577},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{-0.1192, 0.9575, 0.2626, 0.2261},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{-0.1082, 0.5377, 0.8362, 0.2559},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{-0.0437, -0.5611, 0.8266, 0.2896},
-	{-0.2443, -0.4778, 0.8438, 0.2756},
-	{0.4232, 0.9045, 0.0533, 0.1730},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{0.3460, 0.5263, -0.7767, 0.7671},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{0.0643, -0.9978, 0.0182, 0.7288},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{-0.8875, 0.1416, -0.4384, 0.9113},
-	{-0.9239, 0.2541, -0.2862, 0.9228},
-	{-0.3307, 0.5962, -0.7316, 0.9134},
-	{-0.1331, 0.5679, 0.8123, 0.5677},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.6044, 0.6091, 0.5136, 0.5701},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{0.8966, -0.1100, 0.4289, 0.6147},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{0.2953, -0.6258, 0.7219, 0.2111},
-	{0.1917, -0.4699, 0.8616, 0.2267},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{-0.3917, 0.9041, 0.1710, 0.3585},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.8562, 0.0205, -0.5163, 0.4652},
-	{-0.8406, 0.4391, -0.3172, 0.9176},
-	{-0.5188, 0.7059, -0.4822, 0.9100},
-	{-0.4274, 0.5541, -0.7143, 0.9269},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{0.1922, 0.9435, 0.2700, 0.4690},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{-0.4548, 0.5328, -0.7136, 0.9680},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{-0.0504, 0.6080, -0.7923, 0.2051},
-	{-0.3478, 0.0471, -0.9364, 0.2125},
-	{-0.0853, -0.0147, -0.9962, 0.1958},
-	{0.9242, 0.3816, 0.0181, 0.8979},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{0.8563, 0.5164, -0.0107, 0.9361},
-	{0.6635, 0.7231, -0.1923, 0.1072},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.6886, 0.4445, 0.5730, 0.0937},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{-0.6796, 0.1462, 0.7189, 0.7504},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.4510, -0.8506, -0.2702, 0.7095},
-	{0.1707, -0.9829, 0.0693, 0.7046},
-	{0.8648, -0.0650, 0.4979, 0.6319},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.5826, 0.7809, -0.2256, 0.8671},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.0664, 0.9957, -0.0650, 0.8801},
-	{0.3213, 0.9305, 0.1761, 0.8812},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{-0.8786, 0.1012, -0.4667, 0.2229},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.6021, -0.3146, -0.7338, 0.8822},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.9221, 0.2930, 0.2526, 0.6127},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.0869, 0.0972, 0.9915, 0.4572},
-	{-0.3128, -0.1142, 0.9429, 0.4545},
-	{0.1301, -0.0722, 0.9889, 0.4699},
-	{0.2296, -0.4959, -0.8375, 0.6168},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{0.3532, -0.5085, -0.7853, 0.6200},
-	{-0.8479, -0.0537, 0.5274, 0.3345},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.7772, -0.3624, 0.5144, 0.3298},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.4078, 0.6986, -0.5879, 0.9237},
-	{0.2366, 0.7306, -0.6405, 0.9167},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.5863, 0.4679, -0.6613, 0.0962},
-	{-0.4996, 0.8475, 0.1792, 0.1040},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{0.3691, -0.7519, 0.5463, 0.6325},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.6246, -0.0635, 0.7783, 0.7336},
-	{0.7925, -0.1961, -0.5775, 0.8129},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.9906, -0.1137, 0.0765, 0.7872},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{0.0187, -0.9425, -0.3336, 0.8099},
-	{-0.0397, -0.9855, 0.1650, 0.8011},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{-0.8919, 0.4523, 0.0060, 0.3044},
-	{-0.6154, 0.6377, -0.4634, 0.2931},
-	{-0.5637, 0.8259, -0.0093, 0.2806},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{0.0898, -0.9951, 0.0416, 0.3205},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{-0.5309, -0.8161, 0.2283, 0.3263},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.4181, -0.8047, 0.4216, 0.6454},
-	{-0.1571, -0.7974, 0.5827, 0.6408},
-	{0.6274, -0.2245, 0.7456, 0.7572},
-	{-0.0025, -0.5954, 0.8034, 0.7518},
-	{0.7219, -0.6696, -0.1746, 0.7576},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{0.5715, -0.0954, -0.8150, 0.0981},
-	{0.5618, 0.3684, -0.7407, 0.1029},
-	{0.4072, 0.2197, -0.8865, 0.5801},
-	{0.2615, -0.5752, -0.7751, 0.5631},
-	{0.2589, 0.0997, -0.9608, 0.5621},
-	{-0.0553, 0.9770, -0.2060, 0.6945},
-	{-0.4167, 0.8981, -0.1410, 0.6867},
-	{-0.4120, 0.7796, -0.4716, 0.6847},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{0.2075, 0.4652, 0.8605, 0.6271},
-	{0.6716, 0.5691, 0.4744, 0.6483},
-	{-0.4223, -0.5637, -0.7099, 0.6855},
-	{-0.5596, 0.0289, -0.8283, 0.6851},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.9642, 0.2629, 0.0357, 0.9318},
-	{0.8188, 0.5565, 0.1409, 0.8956},
-	{0.8773, 0.3281, 0.3502, 0.9037},
-	{0.5841, 0.4308, -0.6879, 0.8938},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.3166, 0.3876, 0.8658, 0.4556},
-	{0.3328, 0.9363, 0.1120, 0.4513},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.2535, -0.8114, 0.5267, 0.2564},
-	{0.8177, 0.0106, 0.5755, 0.2614},
-	{0.4643, -0.0041, -0.8857, 0.9831},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{0.5883, 0.8078, -0.0369, 0.1343},
-	{0.3088, 0.9352, 0.1734, 0.1222},
-	{-0.3059, -0.7763, -0.5512, 0.6951},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{-0.6851, -0.7041, -0.1867, 0.6942},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{-0.0207, 0.4741, 0.8802, 0.9010},
-	{-0.0727, 0.7955, 0.6016, 0.9063},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{0.3989, 0.2372, 0.8858, 0.5966},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.8203, 0.4864, -0.3010, 0.5466},
-	{0.8077, -0.0935, -0.5821, 0.5459},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.7793, 0.2321, 0.5821, 0.1282},
-	{0.5983, -0.8012, -0.0112, 0.1382},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{-0.4014, -0.9129, 0.0744, 0.7213},
-	{-0.3043, -0.9223, 0.2380, 0.7379},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{-0.3037, 0.6004, -0.7398, 0.9543},
-	{-0.3899, -0.6640, 0.6380, 0.6314},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.8213, -0.5612, -0.1021, 0.9243},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{0.8773, -0.3136, -0.3632, 0.9441},
-	{-0.3157, -0.0484, 0.9476, 0.5294},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{0.0458, 0.1274, 0.9908, 0.5330},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{-0.8371, -0.1053, -0.5368, 0.2029},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.7070, -0.3078, 0.6367, 0.7256},
-	{0.9568, -0.2573, -0.1352, 0.5092},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.9771, -0.0602, -0.2041, 0.5210},
-	{0.2901, 0.1948, 0.9370, 0.4812},
-	{0.2312, 0.3824, 0.8946, 0.4856},
-	{0.2183, 0.5054, 0.8348, 0.4933},
-	{0.9255, -0.1984, 0.3227, 0.6271},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.8591, -0.3939, -0.3267, 0.4599},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{-0.5971, -0.4884, -0.6364, 0.1649},
-	{0.9420, -0.1023, -0.3196, 0.1713},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{0.6262, 0.0104, -0.7796, 0.5733},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{-0.7639, 0.2401, -0.5990, 0.9149},
-	{0.0108, -0.0932, -0.9956, 0.8860},
-	{-0.2443, -0.4778, 0.8438, 0.2756},
-	{-0.8314, -0.3962, 0.3895, 0.2439},
-	{-0.5845, -0.5686, 0.5788, 0.2552},
-	{0.0652, 0.2155, -0.9743, 0.8821},
-	{-0.4974, 0.5056, -0.7049, 0.8974},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{0.1558, -0.0906, -0.9836, 0.4196},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{0.4693, -0.0563, -0.8812, 0.3195},
-	{0.9464, -0.2549, -0.1986, 0.3232},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{0.8958, 0.3738, 0.2404, 0.6117},
-	{0.6086, 0.7648, 0.2113, 0.6238},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.8966, -0.1100, 0.4289, 0.6147},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{-0.1030, -0.9923, 0.0683, 0.8139},
-	{0.9410, -0.1276, 0.3134, 0.3971},
-	{0.9211, -0.0583, 0.3850, 0.4089},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{0.7299, 0.6038, 0.3203, 0.4949},
-	{0.9597, 0.1729, 0.2216, 0.4933},
-	{-0.3561, 0.8911, -0.2813, 0.1713},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{-0.4223, 0.8225, -0.3809, 0.1852},
-	{-0.7380, 0.0921, 0.6685, 0.3357},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{0.9464, -0.2549, -0.1986, 0.0952},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{0.8137, 0.4732, -0.3377, 0.0945},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.7098, 0.5867, 0.3899, 0.7044},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{0.0849, -0.9546, 0.2855, 0.1795},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{-0.9007, -0.0366, -0.4329, 0.2422},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{-0.5787, 0.2214, 0.7849, 0.2642},
-	{-0.8584, 0.2331, 0.4569, 0.2480},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{-0.3671, -0.1598, 0.9163, 0.7698},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{0.8085, 0.1793, 0.5605, 0.8185},
-	{0.7925, -0.1961, -0.5775, 0.8151},
-	{0.8539, -0.4209, 0.3062, 0.8257},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.8479, -0.0537, 0.5274, 0.3345},
-	{-0.7380, 0.0921, 0.6685, 0.3357},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.1740, 0.9785, 0.1109, 0.6974},
-	{-0.9191, 0.3542, 0.1726, 0.6935},
-	{-0.4653, 0.0260, -0.8848, 0.6952},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{-0.9391, 0.3339, -0.0815, 0.4703},
-	{-0.8840, 0.3199, 0.3408, 0.4949},
-	{-0.2137, -0.9605, -0.1784, 0.2330},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{-0.0723, -0.9856, -0.1527, 0.2158},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{0.5710, -0.6458, -0.5068, 0.5242},
-	{0.5116, -0.4641, -0.7231, 0.5181},
-	{-0.6489, 0.5254, 0.5504, 0.5316},
-	{-0.5259, 0.2486, 0.8134, 0.5189},
-	{-0.7380, 0.0921, 0.6685, 0.5245},
-	{0.5747, -0.7967, 0.1871, 0.0350},
-	{0.3497, -0.9030, -0.2498, 0.0444},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{-0.7902, -0.6081, -0.0756, 0.6184},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{-0.2888, 0.2125, -0.9335, 0.1649},
-	{-0.5586, -0.0152, -0.8293, 0.1682},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.8413, -0.0416, -0.5389, 0.8336},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{-0.2545, 0.5740, 0.7783, 0.5600},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.8227, -0.0703, 0.5641, 0.9145},
-	{-0.6248, -0.2959, 0.7225, 0.9100},
-	{0.5715, -0.0954, -0.8150, 0.0981},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.5845, 0.0351, -0.8106, 0.0897},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.3295, 0.1682, 0.9290, 0.2778},
-	{-0.4687, 0.1573, 0.8692, 0.2728},
-	{-0.6734, -0.0052, 0.7392, 0.2626},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{0.7219, -0.6696, -0.1746, 0.7576},
-	{-0.0025, -0.5954, 0.8034, 0.7518},
-	{0.0195, 0.9860, 0.1655, 0.1571},
-	{0.4232, 0.9045, 0.0533, 0.1730},
-	{0.2469, 0.9653, -0.0853, 0.1622},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.8363, 0.3359, 0.4334, 0.3015},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{-0.8462, 0.1898, -0.4979, 0.1797},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{0.7128, 0.6137, 0.3395, 0.7196},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{-0.1885, 0.0785, 0.9789, 0.4836},
-	{0.1301, -0.0722, 0.9889, 0.4699},
-	{-0.2813, -0.1737, 0.9438, 0.4606},
-	{0.3718, 0.3341, 0.8661, 0.4550},
-	{-0.1361, 0.6037, 0.7855, 0.4411},
-	{-0.0638, 0.7133, 0.6979, 0.4406},
-	{0.9387, 0.3345, 0.0828, 0.0843},
-	{0.8564, -0.5112, -0.0728, 0.1771},
-	{0.9259, 0.3443, -0.1552, 0.1862},
-	{-0.4448, -0.5400, -0.7145, 0.1111},
-	{-0.1289, -0.5984, -0.7907, 0.1200},
-	{0.1204, -0.5628, -0.8178, 0.1140},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{-0.0822, 0.4653, -0.8814, 0.1507},
-	{-0.0051, 0.5905, -0.8070, 0.1596},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{-0.4974, 0.5056, -0.7049, 0.8974},
-	{0.0652, 0.2155, -0.9743, 0.8821},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.3213, 0.9419, -0.0976, 0.5844},
-	{0.3376, 0.8670, -0.3665, 0.5816},
-	{0.6526, 0.7519, -0.0930, 0.5865},
-	{0.3838, 0.9222, 0.0465, 0.7180},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.4218, 0.8652, -0.2710, 0.5194},
-	{-0.7548, 0.5797, -0.3070, 0.5179},
-	{0.6959, 0.6155, 0.3699, 0.0391},
-	{0.6253, 0.5681, -0.5350, 0.0385},
-	{0.5139, 0.8212, 0.2479, 0.0607},
-	{0.8966, -0.1100, 0.4289, 0.6147},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{0.8958, 0.3738, 0.2404, 0.6117},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{0.7304, 0.6044, -0.3182, 0.1548},
-	{0.4280, -0.3914, -0.8146, 0.1527},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.7919, -0.5824, -0.1835, 0.2429},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.2477, -0.8990, -0.3610, 0.1455},
-	{0.8564, -0.5112, -0.0728, 0.1771},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{-0.3804, 0.6299, -0.6771, 0.1625},
-	{-0.5971, -0.4884, -0.6364, 0.1649},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{0.8939, -0.2588, 0.3660, 0.2410},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{0.5524, -0.7496, 0.3646, 0.6559},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.7843, -0.3281, 0.5266, 0.6508},
-	{-0.2307, 0.7129, 0.6623, 0.3352},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.8153, 0.4576, 0.3547, 0.3352},
-	{-0.4063, -0.8914, -0.2009, 0.3925},
-	{-0.3021, -0.8740, -0.3807, 0.3843},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{-0.3021, -0.8740, -0.3807, 0.3843},
-	{-0.0107, -0.9588, -0.2839, 0.3455},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{0.7164, 0.5456, 0.4349, 0.6070},
-	{0.3989, 0.2372, 0.8858, 0.5966},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{0.8855, 0.0523, -0.4618, 0.4134},
-	{0.5272, -0.2673, -0.8066, 0.4243},
-	{-0.4933, -0.8223, -0.2836, 0.8319},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{0.1558, -0.0906, -0.9836, 0.0559},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{0.3316, -0.3475, -0.8771, 0.0593},
-	{-0.8109, 0.4549, 0.3681, 0.2450},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.8803, 0.4719, 0.0491, 0.2253},
-	{0.2036, 0.7662, -0.6094, 0.1792},
-	{-0.0504, 0.6080, -0.7923, 0.2051},
-	{0.0841, 0.6101, -0.7878, 0.1799},
-	{-0.7754, 0.1118, -0.6216, 0.6233},
-	{-0.8010, 0.4273, -0.4192, 0.6146},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{0.8867, -0.0356, 0.4610, 0.3217},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.1214, -0.3144, -0.9415, 0.0253},
-	{-0.5247, -0.4905, -0.6957, 0.0376},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{0.8212, -0.5707, -0.0026, 0.4528},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{-0.2409, -0.6805, -0.6920, 0.1322},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{-0.0854, -0.7503, -0.6556, 0.1217},
-	{-0.6724, 0.1679, 0.7209, 0.0321},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{0.0664, 0.9957, -0.0650, 0.8801},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{0.0079, -0.8955, 0.4450, 0.6503},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{-0.4181, -0.8047, 0.4216, 0.6454},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{-0.1434, -0.8472, 0.5116, 0.6969},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{-0.4308, 0.3968, 0.8106, 0.9739},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{0.2662, 0.3158, 0.9107, 0.9664},
-	{-0.1006, -0.3306, -0.9384, 0.5758},
-	{-0.0853, -0.0147, -0.9962, 0.5856},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{-0.6734, -0.0052, 0.7392, 0.2626},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{-0.6009, -0.6623, -0.4476, 0.3502},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{-0.0749, -0.9885, -0.1310, 0.7124},
-	{0.2034, -0.8014, -0.5624, 0.7090},
-	{-0.3059, -0.7763, -0.5512, 0.7100},
-	{0.7843, -0.3281, 0.5266, 0.6508},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.9588, -0.2231, 0.1757, 0.6414},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{0.3354, -0.4562, 0.8243, 0.7000},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{-0.7292, 0.2842, 0.6225, 0.5065},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{-0.9547, -0.0224, 0.2968, 0.3380},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.8496, 0.5161, -0.1091, 0.9444},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.3856, 0.6785, 0.6253, 0.9421},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.1224, -0.9325, -0.3398, 0.8297},
-	{-0.5704, -0.6525, 0.4988, 0.8307},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.3698, 0.9243, 0.0950, 0.1708},
-	{-0.4007, 0.9022, -0.1598, 0.1557},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{0.0898, -0.9951, 0.0416, 0.0282},
-	{0.2963, -0.9342, 0.1988, 0.0475},
-	{0.3015, -0.9494, -0.0878, 0.0309},
-	{0.4256, -0.7199, 0.5483, 0.7221},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{0.7220, 0.5659, 0.3981, 0.8883},
-	{0.3586, 0.8645, -0.3521, 0.8813},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{-0.2882, 0.7606, -0.5818, 0.2166},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{0.6153, -0.3223, 0.7194, 0.6198},
-	{0.7164, 0.5456, 0.4349, 0.6070},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{-0.8718, -0.2590, -0.4158, 0.5040},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{-0.9701, 0.2080, -0.1247, 0.5081},
-	{0.2864, 0.3616, 0.8873, 0.2893},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{0.1931, 0.2597, 0.9462, 0.2828},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{-0.9339, -0.3504, 0.0705, 0.8217},
-	{-0.1030, -0.9923, 0.0683, 0.8139},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.5942, 0.7714, 0.2277, 0.6043},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{0.6916, 0.7202, 0.0548, 0.8090},
-	{0.7925, -0.1961, -0.5775, 0.8151},
-	{0.8085, 0.1793, 0.5605, 0.8185},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{0.4682, 0.6911, -0.5506, 0.9517},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{-0.6090, -0.0175, 0.7930, 0.6934},
-	{-0.0360, 0.4841, 0.8743, 0.6834},
-	{-0.3062, 0.3674, 0.8782, 0.6714},
-	{0.7470, 0.4675, -0.4727, 0.8989},
-	{0.5841, 0.4308, -0.6879, 0.8938},
-	{0.8773, 0.3281, 0.3502, 0.9037},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{-0.2882, 0.7606, -0.5818, 0.2166},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.7198, -0.6656, -0.1971, 0.6234},
-	{-0.3708, -0.7673, 0.5232, 0.6197},
-	{-0.7902, -0.6081, -0.0756, 0.6184},
-	{0.4615, 0.4621, 0.7572, 0.4811},
-	{0.2864, 0.3616, 0.8873, 0.4485},
-	{0.1931, 0.2597, 0.9462, 0.4508},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{-0.4933, -0.8223, -0.2836, 0.8319},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{0.5380, -0.8428, -0.0177, 0.8318},
-	{0.0474, 0.6273, 0.7773, 0.0363},
-	{0.2156, 0.4123, 0.8851, 0.0452},
-	{-0.2658, 0.9639, -0.0148, 0.0458},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{0.8891, 0.4550, -0.0491, 0.7608},
-	{0.4580, 0.6135, 0.6433, 0.7609},
-	{0.4783, -0.8590, 0.1828, 0.8232},
-	{0.9774, 0.2034, 0.0577, 0.8311},
-	{0.0347, -0.8970, -0.4407, 0.8360},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{-0.3765, -0.9240, 0.0673, 0.1196},
-	{-0.2721, -0.9622, 0.0151, 0.1370},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{-0.3899, -0.6640, 0.6380, 0.6314},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{0.6905, 0.6446, -0.3283, 0.8894},
-	{0.7220, 0.5659, 0.3981, 0.8883},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{0.7864, 0.5650, 0.2497, 0.0766},
-	{0.9387, 0.3345, 0.0828, 0.0843},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{-0.9442, 0.1750, 0.2788, 0.6972},
-	{-0.2062, -0.8787, 0.4306, 0.6970},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{-0.3804, 0.6299, -0.6771, 0.1625},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{-0.5689, 0.4621, -0.6803, 0.1976},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{-0.6356, 0.7386, -0.2248, 0.3748},
-	{0.1472, 0.6436, -0.7511, 0.4043},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.8759, -0.4768, 0.0735, 0.0733},
-	{0.7940, -0.5722, -0.2055, 0.0990},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{0.0548, -0.3023, -0.9516, 0.4989},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.4682, 0.6911, -0.5506, 0.9517},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{-0.3714, 0.7472, 0.5511, 0.2622},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{-0.7870, 0.4590, -0.4123, 0.6398},
-	{-0.8080, 0.3359, -0.4840, 0.6454},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{0.5546, 0.1550, 0.8176, 0.7904},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{0.3213, 0.9305, 0.1761, 0.2556},
-	{-0.3539, 0.5375, -0.7654, 0.2505},
-	{-0.0675, 0.9886, -0.1342, 0.2578},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{-0.1829, -0.6633, -0.7257, 0.0591},
-	{0.3316, -0.3475, -0.8771, 0.0593},
-	{-0.0934, -0.3215, -0.9423, 0.3694},
-	{0.5116, -0.4641, -0.7231, 0.3912},
-	{0.0108, -0.0932, -0.9956, 0.3946},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{0.3334, 0.3195, -0.8870, 0.5501},
-	{0.7779, 0.6218, 0.0908, 0.5521},
-	{0.9646, -0.2439, -0.1004, 0.5468},
-	{-0.1006, -0.3306, -0.9384, 0.5758},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{-0.6879, 0.7258, 0.0008, 0.9174},
-	{-0.6831, 0.7232, -0.1019, 0.9042},
-	{-0.1392, 0.2158, 0.9665, 0.0525},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{0.6278, 0.1343, 0.7667, 0.0606},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{0.7177, -0.4829, -0.5017, 0.0676},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{0.9190, -0.3578, -0.1655, 0.0607},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{-0.8831, -0.4312, -0.1851, 0.7699},
-	{0.6683, 0.5889, 0.4545, 0.8830},
-	{0.4095, 0.7255, -0.5531, 0.8790},
-	{0.1788, 0.9561, -0.2323, 0.8773},
-	{-0.5787, 0.2214, 0.7849, 0.2642},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.8584, 0.2331, 0.4569, 0.2480},
-	{-0.8713, -0.1955, -0.4501, 0.9970},
-	{-0.8896, -0.1610, -0.4274, 0.9768},
-	{-0.9214, 0.3077, -0.2376, 0.9751},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.2064, -0.0201, 0.9783, 0.8928},
-	{-0.3435, 0.0802, 0.9357, 0.8934},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{-0.2137, -0.9605, -0.1784, 0.8155},
-	{0.2766, -0.9403, -0.1984, 0.7956},
-	{0.4838, -0.8688, 0.1050, 0.7982},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.1096, -0.6085, 0.7859, 0.6224},
-	{0.1009, -0.6644, 0.7406, 0.6696},
-	{0.1480, -0.7030, 0.6956, 0.6834},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.8416, 0.2044, 0.4999, 0.8651},
-	{0.8682, 0.1707, 0.4659, 0.8883},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{-0.6418, 0.1967, 0.7412, 0.7189},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.9642, 0.2629, 0.0357, 0.9173},
-	{-0.9366, -0.2467, -0.2488, 0.9428},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.6407, -0.4697, -0.6073, 0.4288},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{-0.6226, 0.6446, -0.4437, 0.9772},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{0.0675, -0.9023, -0.4257, 0.2012},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{-0.8459, 0.5166, -0.1327, 0.1045},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.4172, 0.5113, -0.7514, 0.1085},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{0.6238, 0.7294, 0.2807, 0.1275},
-	{0.5541, 0.8229, 0.1259, 0.1341},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{-0.1297, -0.9403, 0.3148, 0.7922},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{-0.6493, -0.7577, -0.0651, 0.7911},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.6305, -0.0874, -0.7713, 0.8022},
-	{0.6162, 0.6719, -0.4108, 0.7980},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{-0.1006, -0.3306, -0.9384, 0.5758},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.9170, -0.1049, -0.3848, 0.9627},
-	{-0.9004, 0.1637, -0.4031, 0.9800},
-	{0.9684, -0.1415, 0.2052, 0.4178},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.5546, 0.1550, 0.8176, 0.7904},
-	{-0.5808, -0.1282, -0.8039, 0.1068},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.4027, -0.2974, -0.8657, 0.0958},
-	{-0.0553, 0.9770, -0.2060, 0.1489},
-	{-0.4120, 0.7796, -0.4716, 0.1391},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.8786, 0.1012, -0.4667, 0.2229},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.6613, 0.7378, -0.1354, 0.9443},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{-0.1994, -0.9560, 0.2153, 0.7297},
-	{-0.2721, -0.9622, 0.0151, 0.7262},
-	{0.2337, -0.8818, 0.4096, 0.7148},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.8468, 0.0758, 0.5264, 0.7154},
-	{-0.3218, -0.3970, 0.8596, 0.7132},
-	{-0.2447, -0.9353, 0.2556, 0.7148},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{-0.1662, -0.0856, 0.9824, 0.7429},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.6021, -0.3146, -0.7338, 0.8822},
-	{-0.6228, 0.7746, -0.1102, 0.7338},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{0.0195, 0.9860, 0.1655, 0.1571},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.4232, 0.9045, 0.0533, 0.1730},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{-0.0922, -0.2711, -0.9581, 0.0847},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{0.0367, 0.9992, 0.0168, 0.2616},
-	{-0.1977, 0.8256, -0.5285, 0.2592},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{-0.3597, 0.0793, 0.9297, 0.8012},
-	{0.9636, -0.2646, 0.0377, 0.8022},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{-0.9259, 0.3032, -0.2253, 0.3837},
-	{-0.8965, 0.2868, -0.3377, 0.3455},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{-0.5247, -0.4905, -0.6957, 0.1229},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{-0.7958, -0.3691, -0.4801, 0.1387},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.8867, -0.0356, 0.4610, 0.3217},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.5715, -0.0954, -0.8150, 0.0981},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{-0.7253, 0.0630, 0.6856, 0.5146},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{0.1122, -0.9280, 0.3554, 0.8862},
-	{-0.6573, -0.6227, 0.4245, 0.8865},
-	{-0.9996, 0.0183, -0.0197, 0.7675},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.0339, -0.9994, 0.0048, 0.0332},
-	{-0.2475, -0.9664, -0.0696, 0.0392},
-	{-0.3709, -0.6859, 0.6261, 0.0580},
-	{-0.4195, -0.8771, -0.2340, 0.7835},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.3981, -0.9038, 0.1570, 0.7877},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.7108, 0.4588, 0.5332, 0.1844},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{-0.8181, -0.5603, -0.1292, 0.6242},
-	{0.0896, -0.5786, 0.8107, 0.6212},
-	{-0.3708, -0.7673, 0.5232, 0.6197},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.9606, -0.0558, 0.2722, 0.7204},
-	{-0.0207, 0.4741, 0.8802, 0.4629},
-	{-0.3166, 0.3876, 0.8658, 0.4556},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{0.3704, -0.0645, -0.9266, 0.6324},
-	{0.4481, 0.8321, -0.3268, 0.6188},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{0.5380, -0.8428, -0.0177, 0.8318},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.0947, 0.9861, -0.1367, 0.9558},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{0.8562, 0.0205, -0.5163, 0.4652},
-	{0.4643, -0.0041, -0.8857, 0.4757},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{0.6664, -0.6028, -0.4388, 0.1060},
-	{0.2738, -0.6418, -0.7164, 0.1206},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.8791, -0.0302, 0.4757, 0.7100},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{0.5813, -0.0355, -0.8129, 0.0237},
-	{0.1214, -0.3144, -0.9415, 0.0253},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{-0.9545, 0.2860, 0.0851, 0.4888},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.1082, 0.5377, 0.8362, 0.7072},
-	{0.0978, -0.8102, 0.5780, 0.6999},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.7292, 0.2842, 0.6225, 0.3365},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{0.8179, -0.4907, -0.3005, 0.4453},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.4834, -0.8596, -0.1659, 0.7035},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.8919, -0.4507, 0.0369, 0.7777},
-	{0.9558, -0.2830, 0.0794, 0.7672},
-	{-0.3917, 0.9041, 0.1710, 0.3118},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.9357, 0.2353, -0.2628, 0.3348},
-	{0.4643, -0.0041, -0.8857, 0.9831},
-	{0.8562, 0.0205, -0.5163, 0.9898},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{-0.7754, 0.1118, -0.6216, 0.6233},
-	{-0.5321, 0.4244, -0.7326, 0.6066},
-	{-0.8010, 0.4273, -0.4192, 0.6146},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{-0.0207, 0.4741, 0.8802, 0.9010},
-	{-0.0136, 0.9965, 0.0830, 0.4623},
-	{0.1346, 0.8735, -0.4678, 0.4660},
-	{0.7864, 0.5650, 0.2497, 0.4766},
-	{-0.0256, -0.1273, -0.9915, 0.5721},
-	{0.5984, -0.3496, -0.7208, 0.5573},
-	{0.6755, -0.3762, -0.6342, 0.5545},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{0.4985, 0.8400, 0.2144, 0.8763},
-	{0.3268, 0.8288, 0.4543, 0.8915},
-	{0.3648, 0.9202, -0.1421, 0.8767},
-	{0.3586, 0.4819, -0.7995, 0.9344},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{0.2402, 0.0276, -0.9703, 0.9163},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.6959, 0.6155, 0.3699, 0.0861},
-	{0.5139, 0.8212, 0.2479, 0.0647},
-	{0.1679, -0.5133, 0.8416, 0.4528},
-	{-0.1934, -0.4228, 0.8853, 0.4382},
-	{-0.1361, 0.6037, 0.7855, 0.4411},
-	{-0.2683, 0.8985, -0.3475, 0.8943},
-	{0.2756, 0.7552, 0.5948, 0.8976},
-	{0.0367, 0.9992, 0.0168, 0.8934},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{0.2756, 0.7552, 0.5948, 0.8976},
-	{-0.2683, 0.8985, -0.3475, 0.8943},
-	{-0.2788, 0.9589, 0.0518, 0.9022},
-	{-0.7009, 0.2165, 0.6796, 0.8357},
-	{-0.1934, -0.4228, 0.8853, 0.8343},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{0.1174, -0.7612, -0.6379, 0.0498},
-	{0.9190, -0.3578, -0.1655, 0.0445},
-	{0.3561, -0.6832, 0.6376, 0.0505},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{-0.0934, -0.3215, -0.9423, 0.5073},
-	{0.0548, -0.3023, -0.9516, 0.4989},
-	{-0.6860, 0.2373, -0.6879, 0.8844},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{-0.8275, 0.4334, -0.3569, 0.2750},
-	{-0.7625, 0.1132, -0.6370, 0.2787},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.0107, -0.9588, -0.2839, 0.0731},
-	{0.2820, -0.9484, -0.1451, 0.0738},
-	{0.4178, -0.9083, -0.0217, 0.0596},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{-0.6248, -0.2959, 0.7225, 0.9100},
-	{-0.8227, -0.0703, 0.5641, 0.9145},
-	{-0.4078, 0.6986, -0.5879, 0.9237},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{0.0079, -0.8955, 0.4450, 0.6503},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{-0.3899, -0.6640, 0.6380, 0.6314},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{0.7194, -0.2848, -0.6335, 0.8724},
-	{0.0108, -0.0932, -0.9956, 0.8860},
-	{0.5116, -0.4641, -0.7231, 0.8639},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.7548, 0.1316, -0.6426, 0.9060},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.8247, 0.0389, -0.5643, 0.7927},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{-0.2657, -0.9215, 0.2832, 0.7359},
-	{-0.2704, -0.8199, 0.5046, 0.7180},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{-0.4834, -0.8596, -0.1659, 0.7035},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{0.3015, -0.9494, -0.0878, 0.0309},
-	{0.0865, -0.9926, -0.0848, 0.0196},
-	{0.0898, -0.9951, 0.0416, 0.0282},
-	{0.8094, -0.0293, 0.5866, 0.7015},
-	{0.0978, -0.8102, 0.5780, 0.6999},
-	{-0.1082, 0.5377, 0.8362, 0.7072},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{-0.6503, 0.7208, 0.2398, 0.9186},
-	{-0.9545, 0.2860, 0.0851, 0.9256},
-	{0.2164, 0.7439, 0.6323, 0.0625},
-	{0.2156, 0.4123, 0.8851, 0.0452},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.9146, 0.1285, -0.3833, 0.6510},
-	{0.9048, 0.4256, 0.0146, 0.6409},
-	{0.9774, 0.0562, -0.2040, 0.6351},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{-0.3095, 0.9433, -0.1196, 0.7035},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{-0.4254, -0.2550, -0.8684, 0.8815},
-	{0.0344, -0.8183, -0.5737, 0.8790},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{0.4448, -0.8666, 0.2262, 0.9156},
-	{-0.0585, -0.9638, -0.2600, 0.8847},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.8750, 0.4797, -0.0649, 0.2249},
-	{-0.8803, 0.4719, 0.0491, 0.2253},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{0.3732, 0.2623, 0.8899, 0.7129},
-	{0.7098, 0.5867, 0.3899, 0.7039},
-	{0.7898, 0.5275, -0.3129, 0.6391},
-	{0.8773, 0.3281, 0.3502, 0.6258},
-	{0.8867, 0.3875, 0.2523, 0.6303},
-	{0.5983, -0.8012, -0.0112, 0.1382},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{-0.2721, -0.9622, 0.0151, 0.1370},
-	{0.0898, -0.9951, 0.0416, 0.0282},
-	{-0.5309, -0.8161, 0.2283, 0.0390},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{0.8773, 0.3281, 0.3502, 0.9037},
-	{0.7898, 0.5275, -0.3129, 0.9035},
-	{0.7470, 0.4675, -0.4727, 0.8989},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{0.1475, 0.8808, -0.4499, 0.0822},
-	{-0.1707, 0.5758, -0.7996, 0.0817},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.4007, 0.9022, -0.1598, 0.1557},
-	{-0.0553, 0.9770, -0.2060, 0.1489},
-	{0.2469, 0.9653, -0.0853, 0.1622},
-	{0.4609, 0.8793, -0.1197, 0.1385},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{0.0745, -0.9969, -0.0259, 0.7538},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{-0.0723, -0.9856, -0.1527, 0.7985},
-	{0.2592, 0.0554, -0.9642, 0.9585},
-	{0.4159, 0.3398, -0.8436, 0.9345},
-	{0.2727, 0.4959, -0.8244, 0.9529},
-	{0.6894, 0.7049, 0.1667, 0.8951},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{0.7299, 0.6038, 0.3203, 0.8813},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{0.7898, 0.5275, -0.3129, 0.4173},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.2507, 0.4647, -0.8493, 0.4338},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{-0.6860, 0.2373, -0.6879, 0.8844},
-	{-0.1867, 0.3659, 0.9117, 0.2766},
-	{-0.5787, 0.2214, 0.7849, 0.2642},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.2442, 0.3620, 0.8997, 0.7260},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.5259, 0.2486, 0.8134, 0.3363},
-	{-0.7292, 0.2842, 0.6225, 0.3365},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{-0.2545, 0.5740, 0.7783, 0.2017},
-	{-0.7317, 0.6214, 0.2801, 0.1707},
-	{-0.1771, 0.9171, 0.3572, 0.1897},
-	{0.9727, 0.1849, 0.1403, 0.4232},
-	{0.5075, 0.7911, -0.3416, 0.4214},
-	{0.8273, -0.0030, -0.5618, 0.4371},
-	{0.0079, -0.8955, 0.4450, 0.6503},
-	{-0.4181, -0.8047, 0.4216, 0.6454},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.3085, 0.1057, 0.9453, 0.2140},
-	{-0.0110, 0.5258, 0.8506, 0.1984},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{-0.6596, 0.6457, -0.3849, 0.0406},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{0.1543, 0.6393, -0.7533, 0.0336},
-	{-0.7009, 0.2165, 0.6796, 0.2509},
-	{-0.6134, 0.5884, 0.5267, 0.2478},
-	{-0.1361, 0.6037, 0.7855, 0.2656},
-	{-0.9890, -0.0368, -0.1431, 0.9619},
-	{-0.9405, 0.2829, -0.1882, 0.9821},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{0.6137, 0.7808, 0.1173, 0.7223},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{-0.3670, 0.8574, -0.3607, 0.8995},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{0.8958, 0.3738, 0.2404, 0.6117},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{0.6886, 0.4445, 0.5730, 0.5937},
-	{0.7622, -0.1359, -0.6329, 0.5584},
-	{0.3376, 0.8670, -0.3665, 0.5816},
-	{-0.3082, 0.3755, -0.8741, 0.5698},
-	{-0.5259, 0.2486, 0.8134, 0.3363},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{0.7346, 0.2381, -0.6353, 0.5747},
-	{0.7922, 0.6035, -0.0907, 0.5811},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.9170, -0.1049, -0.3848, 0.5257},
-	{-0.4593, 0.8160, -0.3510, 0.5124},
-	{0.2308, 0.8675, 0.4406, 0.6561},
-	{0.3158, 0.8806, 0.3533, 0.6458},
-	{-0.0136, 0.9965, 0.0830, 0.6429},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{-0.7993, 0.5004, 0.3329, 0.2686},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{0.9008, -0.0111, 0.4341, 0.3660},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{-0.6158, -0.0817, -0.7837, 0.3727},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{-0.0934, -0.3215, -0.9423, 0.3694},
-	{0.5308, -0.6575, -0.5347, 0.1948},
-	{0.4704, -0.7134, -0.5194, 0.2185},
-	{0.5742, -0.7735, -0.2683, 0.2153},
-	{-0.9701, 0.2080, -0.1247, 0.5081},
-	{-0.8116, -0.0676, -0.5803, 0.4917},
-	{-0.8476, 0.0971, -0.5217, 0.4904},
-	{-0.8965, 0.2868, -0.3377, 0.3455},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{0.1749, 0.4767, 0.8615, 0.7842},
-	{0.2425, 0.1763, 0.9540, 0.7654},
-	{-0.3981, -0.9038, 0.1570, 0.8412},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{-0.2741, -0.9499, 0.1502, 0.8370},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.6162, 0.6719, -0.4108, 0.7980},
-	{0.6635, 0.7231, -0.1923, 0.7824},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.2296, -0.4959, -0.8375, 0.6168},
-	{0.3532, -0.5085, -0.7853, 0.6200},
-	{-0.2137, -0.9605, -0.1784, 0.2330},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{-0.0166, -0.9967, 0.0800, 0.2143},
-	{-0.0397, -0.9855, 0.1650, 0.8011},
-	{0.0187, -0.9425, -0.3336, 0.8099},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{-0.8371, -0.1053, -0.5368, 0.2029},
-	{-0.1289, -0.5984, -0.7907, 0.2006},
-	{-0.9228, -0.2698, -0.2750, 0.2181},
-	{-0.4687, 0.1573, 0.8692, 0.2728},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{-0.0066, 0.9694, 0.2453, 0.9291},
-	{-0.9642, 0.2629, 0.0357, 0.9318},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{-0.0610, -0.3610, -0.9306, 0.5666},
-	{0.6514, -0.3862, -0.6531, 0.5536},
-	{0.0898, -0.9951, 0.0416, 0.0282},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{0.2963, -0.9342, 0.1988, 0.0475},
-	{0.5129, 0.6787, 0.5256, 0.2440},
-	{0.7036, 0.1085, 0.7023, 0.2699},
-	{-0.1082, 0.5377, 0.8362, 0.2559},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{-0.0585, -0.9638, -0.2600, 0.8847},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.9420, -0.1023, -0.3196, 0.1669},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{-0.2773, -0.1585, 0.9476, 0.1625},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.3709, -0.6859, 0.6261, 0.0580},
-	{-0.0107, -0.9588, -0.2839, 0.0731},
-	{0.4178, -0.9083, -0.0217, 0.0596},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{-0.1662, -0.0856, 0.9824, 0.7429},
-	{-0.4911, 0.1951, 0.8490, 0.7440},
-	{-0.1458, 0.9031, -0.4039, 0.0415},
-	{-0.6596, 0.6457, -0.3849, 0.0406},
-	{0.1543, 0.6393, -0.7533, 0.0336},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.9334, 0.2796, 0.2248, 0.2303},
-	{-0.9737, 0.0178, 0.2269, 0.2304},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.5500, 0.7337, 0.3990, 0.5851},
-	{0.5960, 0.7125, 0.3703, 0.5700},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{-0.7076, -0.5762, 0.4089, 0.8788},
-	{-0.7590, -0.5274, 0.3817, 0.8812},
-	{-0.2545, 0.5740, 0.7783, 0.5600},
-	{-0.6049, -0.0334, 0.7956, 0.5521},
-	{-0.9021, -0.0231, 0.4309, 0.5438},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.9463, -0.2772, 0.1661, 0.3417},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{0.2700, -0.0139, -0.9627, 0.4478},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{-0.2045, 0.5912, 0.7801, 0.9552},
-	{0.1284, 0.7280, 0.6734, 0.9283},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9656, 0.2599, 0.0054, 0.6611},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{-0.9093, 0.3754, 0.1795, 0.7537},
-	{-0.7993, 0.5004, 0.3329, 0.7339},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.7919, -0.5824, -0.1835, 0.2429},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{0.1089, -0.9827, 0.1501, 0.7471},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{0.4172, -0.7907, 0.4480, 0.6769},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{0.7470, 0.4675, -0.4727, 0.1875},
-	{0.2507, 0.4647, -0.8493, 0.1770},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{0.6086, 0.7648, 0.2113, 0.6238},
-	{0.5075, 0.7911, -0.3416, 0.6360},
-	{-0.0822, 0.4653, -0.8814, 0.1507},
-	{-0.8406, 0.4391, -0.3172, 0.1118},
-	{-0.4274, 0.5541, -0.7143, 0.1363},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{-0.5609, 0.2960, 0.7732, 0.0471},
-	{-0.1161, 0.5786, 0.8073, 0.0534},
-	{0.0745, -0.9969, -0.0259, 0.7538},
-	{-0.2721, -0.9622, 0.0151, 0.7262},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{0.6756, 0.2814, -0.6814, 0.5522},
-	{0.5618, 0.3684, -0.7407, 0.5487},
-	{-0.2137, -0.9605, -0.1784, 0.8155},
-	{0.4838, -0.8688, 0.1050, 0.7982},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{0.6238, 0.7294, 0.2807, 0.1275},
-	{0.3438, 0.4810, 0.8065, 0.1297},
-	{0.5541, 0.8229, 0.1259, 0.1341},
-	{-0.2788, 0.8163, 0.5058, 0.7463},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{-0.9175, -0.3395, -0.2071, 0.9097},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.5701, -0.2354, -0.7871, 0.9084},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{0.4172, -0.7907, 0.4480, 0.6769},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{0.4256, -0.7199, 0.5483, 0.7221},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{0.4229, -0.8424, 0.3340, 0.7061},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{0.0441, 0.9041, 0.4251, 0.7379},
-	{0.2616, 0.7317, 0.6294, 0.7420},
-	{-0.0824, 0.5702, 0.8174, 0.7525},
-	{0.1089, -0.9827, 0.1501, 0.7471},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{0.0260, -0.9946, -0.1000, 0.7285},
-	{0.0899, 0.5360, 0.8394, 0.1372},
-	{-0.1331, 0.5679, 0.8123, 0.1270},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{0.6393, 0.6385, 0.4284, 0.8936},
-	{0.6683, 0.5889, 0.4545, 0.8830},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{-0.5188, 0.7059, -0.4822, 0.9100},
-	{-0.7281, 0.6054, -0.3215, 0.9026},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{-0.3062, 0.3674, 0.8782, 0.6809},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{-0.8919, 0.4523, 0.0060, 0.3044},
-	{-0.1072, 0.7055, 0.7006, 0.3020},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{-0.1808, -0.8793, -0.4406, 0.6816},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{-0.1662, -0.0856, 0.9824, 0.7429},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{-0.4911, 0.1951, 0.8490, 0.7440},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.8713, -0.1955, -0.4501, 0.2548},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.6514, -0.3862, -0.6531, 0.5394},
-	{0.6755, -0.3762, -0.6342, 0.5374},
-	{-0.3561, 0.8911, -0.2813, 0.1713},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{0.6528, -0.0657, -0.7547, 0.1017},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{0.4705, -0.2263, -0.8529, 0.0989},
-	{-0.7902, -0.6081, -0.0756, 0.6184},
-	{-0.3708, -0.7673, 0.5232, 0.6197},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.1095, 0.9075, 0.4055, 0.7160},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.6623, 0.7483, -0.0359, 0.0830},
-	{0.1558, -0.0906, -0.9836, 0.4196},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.8930, -0.3670, 0.2605, 0.4845},
-	{0.7824, -0.5565, 0.2797, 0.4674},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.0664, 0.9957, -0.0650, 0.2514},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.3539, 0.5375, -0.7654, 0.2505},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{0.1917, -0.4699, 0.8616, 0.2267},
-	{-0.9330, -0.3576, -0.0405, 0.2161},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{-0.4740, -0.3401, 0.8122, 0.2182},
-	{0.1833, 0.8818, 0.4346, 0.8626},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{0.3233, 0.2994, 0.8977, 0.3960},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.7622, -0.1359, -0.6329, 0.0959},
-	{0.4573, 0.2614, 0.8500, 0.4070},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{0.3233, 0.2994, 0.8977, 0.3960},
-	{-0.4319, 0.0300, -0.9014, 0.4711},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.4299, -0.0243, 0.9025, 0.7541},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.1878, 0.1793, -0.9657, 0.9756},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{-0.5415, 0.3814, -0.7492, 0.9675},
-	{0.9063, 0.1697, 0.3870, 0.0355},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.6905, 0.6446, -0.3283, 0.8894},
-	{-0.6368, -0.4067, 0.6550, 0.6626},
-	{-0.6160, 0.4382, 0.6546, 0.6580},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.4976, -0.0473, 0.8661, 0.6967},
-	{-0.6418, 0.1967, 0.7412, 0.7189},
-	{-0.6235, -0.1035, 0.7749, 0.7291},
-	{0.9464, -0.2549, -0.1986, 0.3232},
-	{0.8137, 0.4732, -0.3377, 0.3259},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{-0.7328, 0.6604, 0.1638, 0.7559},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.6154, 0.6377, -0.4634, 0.5067},
-	{0.3213, 0.9419, -0.0976, 0.5190},
-	{-0.4218, 0.8652, -0.2710, 0.5194},
-	{-0.3218, -0.3970, 0.8596, 0.7132},
-	{-0.4134, -0.8569, -0.3080, 0.7119},
-	{-0.2447, -0.9353, 0.2556, 0.7148},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{0.2337, -0.8818, 0.4096, 0.6815},
-	{-0.3378, -0.7932, 0.5066, 0.6793},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.9656, 0.2599, 0.0054, 0.6611},
-	{-0.9136, 0.3934, 0.1027, 0.6669},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.5853, -0.6279, -0.5130, 0.4162},
-	{0.6407, -0.4697, -0.6073, 0.4288},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{0.9048, 0.4256, 0.0146, 0.0857},
-	{0.8572, 0.3182, -0.4049, 0.0898},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{0.7277, 0.5585, -0.3981, 0.0806},
-	{0.7696, 0.2955, -0.5660, 0.0758},
-	{0.9497, 0.0426, 0.3102, 0.0705},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{0.2190, 0.9223, -0.3184, 0.9720},
-	{-0.2266, 0.8250, -0.5177, 0.9843},
-	{-0.8718, -0.2590, -0.4158, 0.4581},
-	{-0.9928, -0.0583, 0.1049, 0.4701},
-	{-0.8424, -0.5052, -0.1876, 0.4742},
-	{-0.9039, 0.0524, -0.4245, 0.2582},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{-0.6327, -0.4710, -0.6147, 0.2335},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{0.1055, -0.9495, 0.2954, 0.6755},
-	{0.4172, -0.7907, 0.4480, 0.6769},
-	{-0.8937, 0.4360, 0.1062, 0.6998},
-	{-0.1740, 0.9785, 0.1109, 0.6974},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{0.2592, 0.0554, -0.9642, 0.1068},
-	{-0.6940, -0.1604, -0.7019, 0.1131},
-	{0.1943, 0.9739, 0.1170, 0.3325},
-	{-0.4537, 0.8911, 0.0085, 0.3717},
-	{-0.6356, 0.7386, -0.2248, 0.3748},
-	{-0.4007, 0.9022, -0.1598, 0.6972},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.0553, 0.9770, -0.2060, 0.6945},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.2901, 0.1948, 0.9370, 0.6138},
-	{0.1679, -0.5133, 0.8416, 0.4528},
-	{-0.1361, 0.6037, 0.7855, 0.4411},
-	{0.3718, 0.3341, 0.8661, 0.4550},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{-0.4185, 0.7714, 0.4793, 0.2564},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{-0.9021, -0.0231, 0.4309, 0.5438},
-	{-0.6049, -0.0334, 0.7956, 0.5521},
-	{-0.4740, -0.3401, 0.8122, 0.5410},
-	{-0.4027, -0.2974, -0.8657, 0.0381},
-	{-0.6040, -0.4385, -0.6655, 0.0421},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{-0.6733, -0.5739, -0.4662, 0.1548},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{-0.8718, -0.2590, -0.4158, 0.1535},
-	{0.3376, 0.8670, -0.3665, 0.1505},
-	{0.7922, 0.6035, -0.0907, 0.1511},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{-0.8468, 0.0758, 0.5264, 0.7176},
-	{-0.2447, -0.9353, 0.2556, 0.7197},
-	{0.8883, -0.3035, -0.3446, 0.7267},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.2566, 0.2018, -0.9452, 0.4247},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{-0.9259, 0.3032, -0.2253, 0.3837},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{-0.8965, 0.2868, -0.3377, 0.3455},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{0.8213, -0.5612, -0.1021, 0.9243},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{-0.5259, 0.2486, 0.8134, 0.5189},
-	{-0.6489, 0.5254, 0.5504, 0.5316},
-	{0.4561, -0.0727, -0.8870, 0.1341},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{-0.2409, -0.6805, -0.6920, 0.1322},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.6841, 0.7055, 0.1851, 0.7331},
-	{-0.6648, 0.4806, 0.5719, 0.7226},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{-0.0000, -0.8889, 0.4580, 0.3025},
-	{0.2953, -0.6258, 0.7219, 0.3079},
-	{-0.1297, -0.9403, 0.3148, 0.3120},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{0.4178, -0.9083, -0.0217, 0.2776},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{0.4643, -0.0041, -0.8857, 0.4757},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.2788, 0.8163, 0.5058, 0.7463},
-	{-0.6841, 0.7055, 0.1851, 0.7331},
-	{0.8572, 0.3182, -0.4049, 0.6569},
-	{0.9048, 0.4256, 0.0146, 0.6409},
-	{0.9146, 0.1285, -0.3833, 0.6510},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.3128, -0.1142, 0.9429, 0.2788},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{-0.7700, -0.3137, 0.5556, 0.2493},
-	{-0.7253, 0.0630, 0.6856, 0.5146},
-	{-0.8597, -0.4108, 0.3035, 0.4921},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{0.4035, -0.4619, -0.7898, 0.1185},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{0.8077, -0.0935, -0.5821, 0.5501},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{0.8118, -0.4978, -0.3052, 0.5538},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{-0.7927, 0.6095, -0.0127, 0.7270},
-	{0.9321, -0.1176, -0.3427, 0.7259},
-	{0.8094, -0.0293, 0.5866, 0.7015},
-	{-0.1082, 0.5377, 0.8362, 0.7072},
-	{0.7036, 0.1085, 0.7023, 0.7091},
-	{-0.6522, 0.7578, -0.0178, 0.7101},
-	{-0.8937, 0.4360, 0.1062, 0.7076},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{0.5380, -0.8428, -0.0177, 0.8318},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.0195, 0.9860, 0.1655, 0.1571},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{0.0841, 0.6101, -0.7878, 0.1799},
-	{-0.9339, -0.3504, 0.0705, 0.6364},
-	{-0.8199, -0.4252, -0.3834, 0.6229},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{-0.1740, 0.9785, 0.1109, 0.6974},
-	{0.0822, 0.9898, 0.1159, 0.7006},
-	{-0.9191, 0.3542, 0.1726, 0.6935},
-	{0.1480, -0.7030, 0.6956, 0.2830},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{-0.1736, -0.9293, 0.3260, 0.2612},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.3378, -0.7932, 0.5066, 0.6793},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.0516, -0.9013, 0.4301, 0.6514},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{-0.8851, -0.3374, -0.3204, 0.6593},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.8109, 0.4549, 0.3681, 0.2450},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{-0.0824, 0.5702, 0.8174, 0.7525},
-	{0.2616, 0.7317, 0.6294, 0.7420},
-	{0.1007, -0.4912, -0.8652, 0.5573},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{0.6109, -0.6349, -0.4729, 0.5540},
-	{-0.7870, -0.1584, -0.5963, 0.0267},
-	{-0.8846, -0.0062, -0.4664, 0.0070},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{0.8584, 0.2993, 0.4165, 0.6247},
-	{0.6153, -0.3223, 0.7194, 0.6198},
-	{0.8416, 0.2044, 0.4999, 0.6472},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{0.4208, 0.8724, 0.2486, 0.8662},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{-0.2062, -0.8787, 0.4306, 0.6970},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{0.3911, 0.8852, -0.2517, 0.3265},
-	{0.4481, 0.8321, -0.3268, 0.3082},
-	{0.8073, 0.3940, 0.4394, 0.3233},
-	{0.3989, 0.2372, 0.8858, 0.8282},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{0.5372, 0.8433, -0.0135, 0.8390},
-	{-0.2241, 0.5052, 0.8334, 0.9749},
-	{0.1361, 0.4282, 0.8934, 0.9717},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.4120, 0.7796, -0.4716, 0.6847},
-	{-0.4167, 0.8981, -0.1410, 0.6867},
-	{-0.2813, -0.1737, 0.9438, 0.2782},
-	{-0.3128, -0.1142, 0.9429, 0.2788},
-	{-0.7700, -0.3137, 0.5556, 0.2493},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{-0.1858, 0.7303, -0.6574, 0.2051},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{-0.1835, -0.7883, -0.5874, 0.7915},
-	{0.2901, 0.1948, 0.9370, 0.4812},
-	{0.4615, 0.4621, 0.7572, 0.4811},
-	{0.1931, 0.2597, 0.9462, 0.4508},
-	{-0.3671, -0.1598, 0.9163, 0.7698},
-	{0.2018, 0.9479, -0.2464, 0.7698},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.7220, 0.5659, 0.3981, 0.8883},
-	{0.6905, 0.6446, -0.3283, 0.8894},
-	{0.5918, 0.5107, -0.6236, 0.8848},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{0.4365, -0.8606, -0.2624, 0.1078},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{0.3103, -0.0983, 0.9456, 0.5759},
-	{-0.3157, -0.0484, 0.9476, 0.5711},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.7070, -0.3078, 0.6367, 0.7256},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{0.2592, 0.0554, -0.9642, 0.9585},
-	{0.8773, -0.3136, -0.3632, 0.9441},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{0.0841, 0.6101, -0.7878, 0.1799},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{0.2036, 0.7662, -0.6094, 0.1792},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{-0.9929, -0.1185, 0.0031, 0.9567},
-	{-0.8175, -0.1724, 0.5496, 0.9491},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{0.8591, -0.3939, -0.3267, 0.4599},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{-0.9306, -0.2509, 0.2666, 0.5856},
-	{-0.9487, -0.2730, -0.1598, 0.5735},
-	{-0.8252, 0.1046, 0.5551, 0.5807},
-	{-0.6071, 0.7803, -0.1503, 0.5056},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{0.6845, -0.0171, 0.7288, 0.6045},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.7428, 0.1567, 0.6510, 0.6005},
-	{-0.7070, -0.3078, 0.6367, 0.7256},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.5500, 0.7337, 0.3990, 0.5851},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{0.5960, 0.7125, 0.3703, 0.5700},
-	{-0.7292, 0.2842, 0.6225, 0.3365},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.3374, -0.9333, -0.1230, 0.1026},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{-0.6664, 0.3097, -0.6782, 0.2049},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{0.7950, 0.0312, 0.6058, 0.2022},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.6109, -0.6349, -0.4729, 0.5415},
-	{0.6023, -0.7173, -0.3503, 0.5413},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{0.7491, 0.0856, 0.6569, 0.3869},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.5710, -0.6458, -0.5068, 0.5242},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{0.5081, -0.8163, -0.2747, 0.5306},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{-0.1885, 0.0785, 0.9789, 0.5551},
-	{-0.6049, -0.0334, 0.7956, 0.5521},
-	{-0.1748, -0.8446, -0.5060, 0.9094},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{-0.1456, 0.6936, -0.7055, 0.2446},
-	{0.0664, 0.9957, -0.0650, 0.2514},
-	{0.4985, 0.8400, 0.2144, 0.2513},
-	{-0.7864, 0.2552, 0.5625, 0.9158},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.5704, -0.6212, 0.5373, 0.9163},
-	{0.5710, -0.6458, -0.5068, 0.8539},
-	{0.5081, -0.8163, -0.2747, 0.8434},
-	{0.5216, -0.8309, 0.1937, 0.8500},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{-0.8597, -0.4108, 0.3035, 0.1073},
-	{-0.3514, -0.5799, 0.7350, 0.0821},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{0.5883, 0.8078, -0.0369, 0.1343},
-	{0.4609, 0.8793, -0.1197, 0.1385},
-	{0.5541, 0.8229, 0.1259, 0.1186},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.3243, 0.7713, -0.5477, 0.1609},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{-0.0051, 0.5905, -0.8070, 0.1596},
-	{-0.4917, -0.7379, 0.4623, 0.3244},
-	{-0.7772, -0.3624, 0.5144, 0.3298},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.6664, -0.6028, -0.4388, 0.4517},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{0.4072, 0.2197, -0.8865, 0.0757},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.9601, 0.2312, -0.1572, 0.0886},
-	{0.5960, 0.7125, 0.3703, 0.5700},
-	{0.9283, 0.2530, 0.2724, 0.5591},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{0.2036, 0.7662, -0.6094, 0.1792},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{-0.3243, 0.7713, -0.5477, 0.1609},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.4911, 0.1951, 0.8490, 0.7440},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{-0.6246, -0.0635, 0.7783, 0.7336},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.3981, 0.4950, 0.7723, 0.2013},
-	{0.5333, 0.2214, 0.8164, 0.2127},
-	{-0.4448, -0.5400, -0.7145, 0.2172},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{-0.1289, -0.5984, -0.7907, 0.2006},
-	{0.2337, -0.8818, 0.4096, 0.6815},
-	{-0.6368, -0.4067, 0.6550, 0.6626},
-	{-0.5316, -0.4272, 0.7314, 0.6718},
-	{0.1318, -0.1373, -0.9817, 0.1819},
-	{-0.1254, 0.1694, -0.9775, 0.1731},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.8227, -0.0703, 0.5641, 0.9145},
-	{-0.8660, -0.4980, 0.0447, 0.9186},
-	{-0.4078, 0.6986, -0.5879, 0.9237},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.8759, -0.4768, 0.0735, 0.4175},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{0.0367, 0.9992, 0.0168, 0.8934},
-	{0.5496, 0.5667, 0.6138, 0.9027},
-	{-0.3789, -0.7091, 0.5947, 0.6143},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{-0.7902, -0.6081, -0.0756, 0.6184},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.6253, 0.5681, -0.5350, 0.0385},
-	{0.7696, 0.2955, -0.5660, 0.0437},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{-0.7281, 0.6054, -0.3215, 0.9026},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{0.8703, 0.2799, -0.4053, 0.6469},
-	{0.8867, 0.3875, 0.2523, 0.6303},
-	{0.8820, 0.4305, -0.1916, 0.6490},
-	{0.1365, -0.9088, 0.3943, 0.6470},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{0.5742, -0.7735, -0.2683, 0.6341},
-	{-0.9478, 0.3159, 0.0427, 0.5097},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{-0.4593, 0.8160, -0.3510, 0.5124},
-	{0.4232, 0.9045, 0.0533, 0.1776},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{0.2469, 0.9653, -0.0853, 0.1667},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.8919, -0.4507, 0.0369, 0.7777},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{-0.6682, 0.7337, -0.1234, 0.9327},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{0.0458, 0.1274, 0.9908, 0.5804},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{-0.4354, 0.5439, -0.7174, 0.8920},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{-0.3122, -0.9336, -0.1762, 0.7481},
-	{-0.4674, -0.8704, -0.1549, 0.7755},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.2888, 0.2125, -0.9335, 0.1649},
-	{-0.4319, 0.0300, -0.9014, 0.1556},
-	{-0.5586, -0.0152, -0.8293, 0.1682},
-	{-0.0585, -0.9638, -0.2600, 0.8847},
-	{-0.3021, -0.8740, -0.3807, 0.8787},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{0.8362, 0.1292, 0.5330, 0.6043},
-	{0.7039, 0.0011, 0.7103, 0.5983},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{0.0218, 0.6616, -0.7495, 0.9276},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{0.2366, 0.7306, -0.6405, 0.9167},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{-0.9239, 0.2541, -0.2862, 0.9228},
-	{-0.7639, 0.2401, -0.5990, 0.9149},
-	{-0.3307, 0.5962, -0.7316, 0.9134},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.8831, -0.4312, -0.1851, 0.7699},
-	{0.3732, 0.2623, 0.8899, 0.7289},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.0441, 0.9041, 0.4251, 0.7379},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.9087, -0.0823, 0.4094, 0.3632},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{0.0664, 0.9957, -0.0650, 0.2514},
-	{-0.1456, 0.6936, -0.7055, 0.2446},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{-0.7149, -0.5345, 0.4508, 0.7205},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{-0.6860, -0.4591, -0.5645, 0.7613},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{-0.1224, -0.9325, -0.3398, 0.8297},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.5710, -0.6458, -0.5068, 0.8539},
-	{0.4846, -0.8583, -0.1691, 0.8613},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{0.0667, 0.8071, 0.5866, 0.7587},
-	{0.8773, -0.3136, -0.3632, 0.3040},
-	{0.7707, -0.6098, -0.1849, 0.2729},
-	{0.7666, -0.6420, 0.0103, 0.3064},
-	{0.4031, 0.8693, -0.2860, 0.0759},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.6623, 0.7483, -0.0359, 0.0830},
-	{0.4035, -0.4619, -0.7898, 0.1185},
-	{0.1204, -0.5628, -0.8178, 0.1140},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.0415, 0.6355, 0.7710, 0.2749},
-	{-0.0638, 0.7133, 0.6979, 0.2664},
-	{-0.3714, 0.7472, 0.5511, 0.2622},
-	{-0.0675, 0.9886, -0.1342, 0.2578},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{-0.8550, 0.4695, 0.2205, 0.2295},
-	{-0.9287, -0.2848, 0.2374, 0.2300},
-	{-0.9339, -0.3504, 0.0705, 0.2242},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{-0.3588, 0.7796, 0.5132, 0.1334},
-	{-0.1458, 0.9031, -0.4039, 0.0853},
-	{0.9410, -0.1276, 0.3134, 0.4208},
-	{0.8400, -0.1295, 0.5269, 0.4219},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{-0.1632, -0.9518, 0.2597, 0.2507},
-	{0.2535, -0.8114, 0.5267, 0.2564},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{0.1721, -0.2096, 0.9625, 0.7407},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{-0.8275, 0.4334, -0.3569, 0.2216},
-	{-0.6664, 0.3097, -0.6782, 0.2049},
-	{-0.7625, 0.1132, -0.6370, 0.1912},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{-0.3037, 0.6004, -0.7398, 0.5116},
-	{-0.6819, 0.6370, -0.3594, 0.5225},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{-0.5826, 0.7809, -0.2256, 0.8671},
-	{-0.5942, 0.7714, 0.2277, 0.8624},
-	{0.3158, 0.8806, 0.3533, 0.2813},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.3468, 0.7679, -0.5386, 0.2863},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{0.8891, 0.4550, -0.0491, 0.7608},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.9501, 0.1422, -0.2777, 0.4588},
-	{-0.9793, -0.0393, -0.1984, 0.4578},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.4707, -0.8229, 0.3184, 0.7198},
-	{-0.3378, -0.7932, 0.5066, 0.6793},
-	{-0.5316, -0.4272, 0.7314, 0.6718},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{0.0967, -0.9029, -0.4189, 0.5576},
-	{0.3853, -0.9062, -0.1739, 0.5611},
-	{0.7192, -0.6694, -0.1863, 0.5678},
-	{0.5075, 0.7911, -0.3416, 0.6360},
-	{0.9727, 0.1849, 0.1403, 0.6352},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{-0.8484, -0.5282, 0.0358, 0.1987},
-	{-0.9314, -0.1882, 0.3115, 0.1928},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{0.2110, -0.9510, -0.2259, 0.7192},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{0.6797, -0.4199, 0.6014, 0.7670},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{0.5372, 0.8433, -0.0135, 0.8390},
-	{0.6247, 0.7805, 0.0236, 0.8499},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{-0.1072, 0.7055, 0.7006, 0.0846},
-	{0.2852, 0.8849, 0.3684, 0.0615},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{0.4035, -0.4619, -0.7898, 0.5775},
-	{0.6262, 0.0104, -0.7796, 0.5733},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{0.7622, -0.1359, -0.6329, 0.0959},
-	{0.5500, 0.7337, 0.3990, 0.5851},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{-0.6940, -0.1604, -0.7019, 0.1131},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{-0.0727, 0.7955, 0.6016, 0.9063},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{0.6218, -0.4426, 0.6461, 0.6454},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{-0.6714, 0.0501, -0.7394, 0.3016},
-	{-0.5694, -0.0739, -0.8188, 0.2864},
-	{-0.2804, -0.1980, -0.9393, 0.2971},
-	{-0.3714, 0.7472, 0.5511, 0.2622},
-	{-0.0638, 0.7133, 0.6979, 0.2664},
-	{-0.7014, 0.6824, 0.2057, 0.2439},
-	{-0.6189, 0.2991, 0.7263, 0.7515},
-	{0.0667, 0.8071, 0.5866, 0.7587},
-	{-0.5779, 0.1707, 0.7981, 0.7546},
-	{-0.0419, -0.9496, 0.3107, 0.8236},
-	{-0.2137, -0.9605, -0.1784, 0.8155},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{0.5883, 0.8078, -0.0369, 0.1343},
-	{0.6697, 0.0931, -0.7368, 0.1760},
-	{0.3213, 0.9419, -0.0976, 0.1381},
-	{0.6526, 0.7519, -0.0930, 0.1584},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.1707, 0.5758, -0.7996, 0.5982},
-	{-0.0543, 0.4619, -0.8853, 0.5708},
-	{0.4072, 0.2197, -0.8865, 0.5801},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{-0.4834, -0.8596, -0.1659, 0.7035},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{-0.2620, 0.5764, -0.7740, 0.7609},
-	{-0.4031, -0.3812, -0.8319, 0.7607},
-	{-0.9880, -0.1501, 0.0354, 0.7605},
-	{-0.4185, 0.7714, 0.4793, 0.2470},
-	{-0.1192, 0.9575, 0.2626, 0.2261},
-	{-0.1082, 0.5377, 0.8362, 0.2559},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{-0.1224, -0.9325, -0.3398, 0.8297},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{0.0329, 0.9376, 0.3462, 0.1359},
-	{-0.4218, 0.8652, -0.2710, 0.1227},
-	{0.3213, 0.9419, -0.0976, 0.1381},
-	{-0.4974, 0.5056, -0.7049, 0.8974},
-	{-0.2674, 0.5838, -0.7666, 0.8928},
-	{-0.7281, 0.6054, -0.3215, 0.9026},
-	{-0.9793, -0.0393, -0.1984, 0.4578},
-	{-0.9501, 0.1422, -0.2777, 0.4588},
-	{-0.8157, 0.1440, -0.5603, 0.4450},
-	{0.0664, 0.9957, -0.0650, 0.2514},
-	{-0.3539, 0.5375, -0.7654, 0.2505},
-	{0.3213, 0.9305, 0.1761, 0.2556},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.8896, -0.1610, -0.4274, 0.9768},
-	{-0.5991, 0.6261, -0.4990, 0.9379},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{0.9558, -0.2830, 0.0794, 0.7672},
-	{0.2507, 0.4647, -0.8493, 0.4338},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.1342, 0.4108, -0.9018, 0.4508},
-	{-0.4116, 0.6903, -0.5951, 0.2117},
-	{-0.9135, 0.2882, -0.2873, 0.2315},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{0.7932, -0.0642, 0.6056, 0.1529},
-	{0.8020, -0.1630, 0.5747, 0.1427},
-	{0.3418, -0.3041, 0.8892, 0.1602},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.8073, 0.3940, 0.4394, 0.3233},
-	{0.8429, 0.0685, 0.5338, 0.3202},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{0.5719, -0.6349, -0.5195, 0.4893},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{0.7582, -0.6370, -0.1391, 0.8896},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{-0.5637, 0.8259, -0.0093, 0.4955},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{-0.1030, -0.9923, 0.0683, 0.8432},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{0.0347, -0.8970, -0.4407, 0.8360},
-	{-0.2657, -0.9215, 0.2832, 0.7015},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{0.8867, 0.3875, 0.2523, 0.6303},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.8820, 0.4305, -0.1916, 0.6490},
-	{0.1745, 0.8170, 0.5497, 0.8556},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.1833, 0.8818, 0.4346, 0.8626},
-	{-0.7870, -0.1584, -0.5963, 0.0267},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{-0.9846, -0.0281, -0.1725, 0.0369},
-	{-0.9701, 0.2080, -0.1247, 0.4616},
-	{-0.8146, 0.4640, 0.3480, 0.4974},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{0.7922, 0.6035, -0.0907, 0.5811},
-	{0.3376, 0.8670, -0.3665, 0.5816},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.3154, -0.2677, 0.9104, 0.1251},
-	{0.7793, 0.2321, 0.5821, 0.1282},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{-0.0853, -0.0147, -0.9962, 0.1958},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{0.0841, 0.6101, -0.7878, 0.1799},
-	{-0.3804, 0.6299, -0.6771, 0.1878},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{0.7166, 0.6620, -0.2198, 0.1856},
-	{-0.6596, 0.6457, -0.3849, 0.0875},
-	{-0.1458, 0.9031, -0.4039, 0.0853},
-	{-0.3588, 0.7796, 0.5132, 0.1334},
-	{-0.2057, 0.9749, 0.0849, 0.2486},
-	{-0.1427, -0.9015, 0.4085, 0.2433},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{0.4846, -0.8583, -0.1691, 0.8613},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{0.1342, 0.4108, -0.9018, 0.4508},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{-0.2888, 0.2125, -0.9335, 0.4667},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.9201, -0.1270, -0.3704, 0.6202},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{-0.9206, 0.3127, -0.2339, 0.0384},
-	{-0.5752, 0.1161, -0.8097, 0.0266},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{-0.1192, 0.9575, 0.2626, 0.2261},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.8109, 0.4549, 0.3681, 0.2450},
-	{-0.9136, 0.3934, 0.1027, 0.2278},
-	{-0.6596, 0.6457, -0.3849, 0.0406},
-	{-0.9206, 0.3127, -0.2339, 0.0384},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{-0.1193, -0.8052, 0.5808, 0.9058},
-	{-0.8279, -0.4407, 0.3468, 0.9001},
-	{0.1546, -0.8735, 0.4616, 0.8984},
-	{-0.8337, 0.3697, 0.4103, 0.8876},
-	{-0.7590, -0.5274, 0.3817, 0.8812},
-	{-0.7076, -0.5762, 0.4089, 0.8788},
-	{-0.2658, 0.9639, -0.0148, 0.0912},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.4996, 0.8475, 0.1792, 0.1040},
-	{-0.8937, 0.4360, 0.1062, 0.7076},
-	{-0.6522, 0.7578, -0.0178, 0.7101},
-	{0.0822, 0.9898, 0.1159, 0.7047},
-	{-0.8786, 0.1012, -0.4667, 0.2229},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{-0.3043, -0.9223, 0.2380, 0.2241},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{-0.4577, -0.5685, 0.6836, 0.2224},
-	{0.4783, -0.8590, 0.1828, 0.8232},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{0.4838, -0.8688, 0.1050, 0.7982},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.7408, -0.0074, 0.6717, 0.6001},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.2671, 0.9552, -0.1271, 0.8686},
-	{0.5742, 0.6798, 0.4563, 0.8564},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{0.4095, 0.7255, -0.5531, 0.2237},
-	{0.3586, 0.8645, -0.3521, 0.2167},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{-0.3295, 0.1682, 0.9290, 0.2778},
-	{-0.6734, -0.0052, 0.7392, 0.2626},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{0.9037, 0.3671, 0.2205, 0.6224},
-	{0.9774, 0.0562, -0.2040, 0.6351},
-	{0.9048, 0.4256, 0.0146, 0.6409},
-	{-0.1254, 0.1694, -0.9775, 0.5554},
-	{0.1318, -0.1373, -0.9817, 0.5631},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{-0.0723, -0.9856, -0.1527, 0.2158},
-	{0.4141, -0.8842, 0.2162, 0.1818},
-	{0.0745, -0.9969, -0.0259, 0.1644},
-	{0.7864, 0.5650, 0.2497, 0.0968},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{0.9387, 0.3345, 0.0828, 0.0997},
-	{-0.6724, 0.1679, 0.7209, 0.0321},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{-0.3289, 0.0834, 0.9407, 0.0248},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{0.0423, 0.9758, 0.2147, 0.2217},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{0.7058, 0.1194, -0.6982, 0.6156},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.9722, 0.1887, 0.1386, 0.6112},
-	{-0.9334, 0.2796, 0.2248, 0.6661},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9737, 0.0178, 0.2269, 0.6597},
-	{-0.3833, -0.0618, -0.9216, 0.5706},
-	{0.3334, 0.3195, -0.8870, 0.5501},
-	{0.1224, -0.6692, -0.7329, 0.5490},
-	{0.8966, -0.1100, 0.4289, 0.6147},
-	{0.8958, 0.3738, 0.2404, 0.6117},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{0.2610, -0.1270, -0.9569, 0.3178},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{0.1800, 0.6143, -0.7683, 0.9402},
-	{-0.4078, 0.6986, -0.5879, 0.9322},
-	{-0.4565, 0.8811, 0.1235, 0.2891},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.5988, 0.7541, 0.2698, 0.3071},
-	{0.5129, 0.6787, 0.5256, 0.2440},
-	{0.8177, 0.0106, 0.5755, 0.2614},
-	{0.7036, 0.1085, 0.7023, 0.2699},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{0.4580, 0.6135, 0.6433, 0.7609},
-	{0.7407, 0.4998, -0.4489, 0.7607},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{-0.8896, -0.1610, -0.4274, 0.9768},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.2075, 0.4652, 0.8605, 0.5884},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{-0.9656, 0.2599, 0.0054, 0.6611},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{0.1922, 0.9435, 0.2700, 0.4690},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{-0.3479, 0.8329, 0.4303, 0.1219},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{-0.5655, -0.2409, 0.7888, 0.1219},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.7711, 0.2752, 0.5742, 0.7097},
-	{0.4746, 0.3089, 0.8242, 0.8995},
-	{-0.3166, 0.3876, 0.8658, 0.9011},
-	{0.2064, -0.0201, 0.9783, 0.8928},
-	{-0.1161, 0.5786, 0.8073, 0.6060},
-	{-0.1331, 0.5679, 0.8123, 0.5677},
-	{0.3981, 0.4950, 0.7723, 0.5888},
-	{-0.4185, 0.7714, 0.4793, 0.2564},
-	{-0.2170, 0.9757, -0.0297, 0.2424},
-	{-0.3676, 0.9232, 0.1119, 0.2400},
-	{0.6262, 0.0104, -0.7796, 0.5733},
-	{0.9727, -0.2155, -0.0861, 0.5795},
-	{0.7346, 0.2381, -0.6353, 0.5747},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{-0.7696, 0.0472, 0.6367, 0.1802},
-	{-0.9314, -0.1882, 0.3115, 0.1928},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.9684, -0.1415, 0.2052, 0.4178},
-	{0.9742, -0.1633, -0.1559, 0.4207},
-	{-0.9306, -0.2509, 0.2666, 0.0623},
-	{-0.5247, -0.4905, -0.6957, 0.0376},
-	{-0.7958, -0.3691, -0.4801, 0.0510},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.4005, 0.4345, 0.8067, 0.3488},
-	{-0.8153, 0.4576, 0.3547, 0.3352},
-	{0.7128, 0.6137, 0.3395, 0.7419},
-	{0.0441, 0.9041, 0.4251, 0.7379},
-	{0.1646, 0.5297, 0.8320, 0.7471},
-	{-0.2999, 0.6118, -0.7319, 0.8806},
-	{-0.7870, 0.4590, -0.4123, 0.9021},
-	{-0.5083, 0.6049, -0.6130, 0.8812},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{0.0849, -0.9546, 0.2855, 0.1795},
-	{-0.4165, -0.9089, -0.0209, 0.1953},
-	{-0.2836, 0.9364, -0.2069, 0.2438},
-	{-0.7370, 0.5614, 0.3762, 0.2432},
-	{-0.8947, 0.3004, -0.3305, 0.2432},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{0.1174, -0.7612, -0.6379, 0.0498},
-	{0.3497, -0.9030, -0.2498, 0.0574},
-	{-0.1458, 0.9031, -0.4039, 0.0853},
-	{0.5075, 0.7911, -0.3416, 0.0772},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{0.7779, 0.6218, 0.0908, 0.3776},
-	{-0.0543, 0.4619, -0.8853, 0.3613},
-	{0.4431, -0.1740, 0.8794, 0.1213},
-	{-0.5655, -0.2409, 0.7888, 0.1219},
-	{-0.8993, -0.4372, 0.0133, 0.1225},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{0.3718, 0.3341, 0.8661, 0.4550},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{-0.0481, -0.9889, 0.1403, 0.9391},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.6214, -0.6232, 0.4749, 0.9332},
-	{-0.3082, 0.3755, -0.8741, 0.5698},
-	{0.3376, 0.8670, -0.3665, 0.5816},
-	{0.3213, 0.9419, -0.0976, 0.5844},
-	{0.4773, -0.2967, -0.8271, 0.0880},
-	{-0.6739, 0.2329, -0.7011, 0.0896},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{0.7439, -0.5372, 0.3976, 0.6294},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.1788, 0.9561, -0.2323, 0.2317},
-	{0.4095, 0.7255, -0.5531, 0.2237},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{0.5812, -0.6776, -0.4506, 0.5425},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.7162, -0.5213, -0.4640, 0.5409},
-	{0.4706, 0.2924, 0.8325, 0.6072},
-	{0.9722, 0.1887, 0.1386, 0.6112},
-	{0.8700, 0.3723, 0.3231, 0.6078},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{-0.1082, 0.5377, 0.8362, 0.2559},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{0.5129, 0.6787, 0.5256, 0.2440},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{-0.9463, -0.2772, 0.1661, 0.3417},
-	{-0.9793, -0.0393, -0.1984, 0.3517},
-	{-0.3289, 0.0834, 0.9407, 0.0248},
-	{0.5524, -0.7496, 0.3646, 0.0178},
-	{-0.9306, -0.2509, 0.2666, 0.0218},
-	{-0.2721, -0.9622, 0.0151, 0.7262},
-	{-0.3765, -0.9240, 0.0673, 0.7031},
-	{0.2337, -0.8818, 0.4096, 0.7148},
-	{0.5719, -0.6349, -0.5195, 0.4893},
-	{0.4815, -0.8623, -0.1567, 0.4770},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{-0.5309, -0.8161, 0.2283, 0.3263},
-	{-0.5321, 0.4244, -0.7326, 0.9983},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{-0.6226, 0.6446, -0.4437, 0.9772},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.4783, -0.8590, 0.1828, 0.7799},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.8468, 0.0758, 0.5264, 0.7176},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.4874, 0.5744, -0.6576, 0.7709},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{-0.0934, -0.3215, -0.9423, 0.5073},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{-0.6851, -0.7041, -0.1867, 0.6942},
-	{-0.8713, -0.1955, -0.4501, 0.2548},
-	{-0.7427, -0.5655, -0.3586, 0.2531},
-	{-0.8896, -0.1610, -0.4274, 0.2732},
-	{-0.7625, 0.1132, -0.6370, 0.1912},
-	{-0.6664, 0.3097, -0.6782, 0.2049},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.5316, -0.4272, 0.7314, 0.6718},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{-0.9287, -0.2848, 0.2374, 0.8391},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.1289, -0.5984, -0.7907, 0.1200},
-	{-0.8371, -0.1053, -0.5368, 0.1230},
-	{-0.0854, -0.7503, -0.6556, 0.1217},
-	{0.2110, -0.9510, -0.2259, 0.7192},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{-0.6041, -0.6306, 0.4872, 0.7190},
-	{-0.5329, 0.3905, -0.7507, 0.2036},
-	{-0.5689, 0.4621, -0.6803, 0.1976},
-	{-0.6930, 0.0767, -0.7168, 0.2044},
-	{-0.0843, -0.2271, 0.9702, 0.5514},
-	{-0.2773, -0.1585, 0.9476, 0.5428},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.4223, -0.5637, -0.7099, 0.6950},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.3085, 0.1057, 0.9453, 0.2140},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{-0.6327, -0.4710, -0.6147, 0.2335},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{-0.8199, -0.4252, -0.3834, 0.6229},
-	{-0.5859, -0.2830, -0.7594, 0.6015},
-	{-0.8710, -0.0001, -0.4912, 0.6136},
-	{-0.4172, 0.5113, -0.7514, 0.1085},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.5808, -0.1282, -0.8039, 0.1068},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.8591, -0.3939, -0.3267, 0.4599},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{0.1472, 0.6436, -0.7511, 0.4043},
-	{0.0059, -0.5459, -0.8378, 0.3980},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{-0.0218, -0.7605, 0.6490, 0.7222},
-	{-0.0620, 0.2819, 0.9574, 0.5275},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{0.1985, 0.3629, 0.9104, 0.5328},
-	{-0.3765, -0.9240, 0.0673, 0.1196},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{-0.4280, -0.6557, 0.6220, 0.1190},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.8221, -0.5535, -0.1334, 0.5443},
-	{0.6109, -0.6349, -0.4729, 0.5415},
-	{0.8212, -0.5707, -0.0026, 0.7783},
-	{0.5240, -0.6781, -0.5153, 0.7653},
-	{0.4344, -0.8812, -0.1864, 0.7593},
-	{-0.6071, 0.7803, -0.1503, 0.5056},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.4593, 0.8160, -0.3510, 0.5124},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{0.1977, -0.0914, -0.9760, 0.8890},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{0.9517, -0.0684, -0.2993, 0.1692},
-	{-0.6805, -0.2196, -0.6991, 0.1848},
-	{0.9420, -0.1023, -0.3196, 0.1669},
-	{0.6058, -0.3462, -0.7164, 0.1844},
-	{0.7166, 0.6620, -0.2198, 0.1856},
-	{0.7532, 0.1973, 0.6275, 0.7311},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.8876, 0.2327, 0.3975, 0.7390},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{-0.1059, 0.9577, -0.2675, 0.3322},
-	{0.3911, 0.8852, -0.2517, 0.3265},
-	{0.9387, 0.3345, 0.0828, 0.0997},
-	{0.5660, 0.3094, -0.7641, 0.1066},
-	{0.7622, -0.1359, -0.6329, 0.1066},
-	{0.2425, 0.1763, 0.9540, 0.8995},
-	{0.7128, 0.6137, 0.3395, 0.8812},
-	{0.1646, 0.5297, 0.8320, 0.8841},
-	{0.9906, -0.1137, 0.0765, 0.7872},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{0.7925, -0.1961, -0.5775, 0.8129},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.0397, -0.9855, 0.1650, 0.8011},
-	{-0.0106, -0.9562, 0.2925, 0.7946},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.3714, 0.7472, 0.5511, 0.2622},
-	{-0.7014, 0.6824, 0.2057, 0.2439},
-	{-0.7288, 0.5351, 0.4272, 0.2487},
-	{-0.4510, -0.8506, -0.2702, 0.7095},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{-0.6327, -0.4710, -0.6147, 0.2335},
-	{0.5216, -0.8309, 0.1937, 0.8500},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{0.4846, -0.8583, -0.1691, 0.8613},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{0.2852, 0.8849, 0.3684, 0.4825},
-	{-0.0755, 0.9970, -0.0180, 0.4821},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.0419, -0.9496, 0.3107, 0.8236},
-	{-0.0362, -0.9929, 0.1132, 0.8245},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.7116, 0.3457, 0.6117, 0.9373},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.1875, -0.9768, 0.1034, 0.7543},
-	{-0.2721, -0.9622, 0.0151, 0.7262},
-	{-0.1994, -0.9560, 0.2153, 0.7297},
-	{0.3259, 0.5900, 0.7387, 0.7573},
-	{0.9013, 0.4314, -0.0386, 0.7628},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{-0.3059, -0.7763, -0.5512, 0.6951},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{-0.4897, -0.2793, -0.8260, 0.1088},
-	{-0.1001, -0.8332, -0.5439, 0.1122},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.8648, -0.0650, 0.4979, 0.6319},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.7325, 0.1673, 0.6599, 0.3627},
-	{-0.1254, 0.1694, -0.9775, 0.1731},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{-0.0007, 0.3644, -0.9313, 0.1748},
-	{-0.9675, 0.2481, -0.0487, 0.6170},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{-0.5942, 0.7714, 0.2277, 0.6043},
-	{0.3460, 0.5263, -0.7767, 0.7671},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{0.6635, 0.7231, -0.1923, 0.7824},
-	{-0.1297, -0.9403, 0.3148, 0.3120},
-	{-0.4917, -0.7379, 0.4623, 0.3244},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{-0.2447, -0.9353, 0.2556, 0.7197},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.6248, -0.2959, 0.7225, 0.9100},
-	{-0.4078, 0.6986, -0.5879, 0.9237},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{0.9687, 0.2442, 0.0452, 0.5832},
-	{0.7922, 0.6035, -0.0907, 0.5811},
-	{0.7346, 0.2381, -0.6353, 0.5747},
-	{-0.8153, 0.4576, 0.3547, 0.3352},
-	{-0.8980, 0.2954, 0.3262, 0.3298},
-	{-0.2307, 0.7129, 0.6623, 0.3352},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.2312, -0.2257, -0.9464, 0.7170},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{0.2183, 0.5054, 0.8348, 0.5737},
-	{0.2312, 0.3824, 0.8946, 0.5621},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{0.3586, 0.8645, -0.3521, 0.2167},
-	{0.5918, 0.5107, -0.6236, 0.2082},
-	{0.9442, -0.2121, 0.2520, 0.0158},
-	{0.9244, 0.0952, -0.3693, 0.0185},
-	{0.2665, -0.6820, -0.6811, 0.0235},
-	{0.0822, 0.9898, 0.1159, 0.7006},
-	{-0.1740, 0.9785, 0.1109, 0.6974},
-	{-0.8937, 0.4360, 0.1062, 0.6998},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{0.1672, -0.8755, 0.4533, 0.7309},
-	{-0.9230, -0.3654, -0.1206, 0.3492},
-	{-0.9929, -0.1185, 0.0031, 0.3633},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{0.8221, -0.5535, -0.1334, 0.5443},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.8118, -0.4978, -0.3052, 0.5434},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.7417, -0.6107, -0.2774, 0.6986},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.8563, 0.5164, -0.0107, 0.5376},
-	{0.9991, 0.0368, 0.0202, 0.5335},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.9255, -0.1984, 0.3227, 0.6271},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.2818, -0.8003, 0.5293, 0.7423},
-	{-0.7149, -0.5345, 0.4508, 0.7205},
-	{0.1284, 0.7280, 0.6734, 0.9283},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.7219, -0.6696, -0.1746, 0.7576},
-	{0.8203, 0.4864, -0.3010, 0.1701},
-	{-0.0947, 0.9861, -0.1367, 0.1628},
-	{-0.1254, 0.1694, -0.9775, 0.1731},
-	{0.2963, -0.9342, 0.1988, 0.0475},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{-0.0360, 0.4841, 0.8743, 0.6930},
-	{0.0925, 0.9692, 0.2281, 0.7001},
-	{-0.3062, 0.3674, 0.8782, 0.6809},
-	{-0.8965, 0.2868, -0.3377, 0.3455},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{0.1679, -0.5133, 0.8416, 0.8464},
-	{-0.1632, -0.9518, 0.2597, 0.8307},
-	{-0.1934, -0.4228, 0.8853, 0.8343},
-	{0.0290, -0.9995, 0.0120, 0.8345},
-	{-0.2741, -0.9499, 0.1502, 0.8370},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.7625, 0.1132, -0.6370, 0.2787},
-	{-0.5694, -0.0739, -0.8188, 0.2864},
-	{0.4217, -0.2859, -0.8605, 0.0408},
-	{0.9603, -0.2203, 0.1710, 0.0359},
-	{0.7177, -0.4829, -0.5017, 0.0447},
-	{-0.0051, 0.5905, -0.8070, 0.9556},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{0.7801, -0.2337, 0.5804, 0.3139},
-	{0.8094, -0.0293, 0.5866, 0.3156},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{0.7194, -0.2848, -0.6335, 0.8724},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{0.0108, -0.0932, -0.9956, 0.8860},
-	{0.1647, -0.4521, -0.8766, 0.0646},
-	{0.3497, -0.9030, -0.2498, 0.0574},
-	{0.5747, -0.7967, 0.1871, 0.0634},
-	{-0.8176, 0.4403, 0.3712, 0.3432},
-	{-0.8153, 0.4576, 0.3547, 0.3352},
-	{-0.4005, 0.4345, 0.8067, 0.3488},
-	{0.8077, -0.0935, -0.5821, 0.5501},
-	{-0.1254, 0.1694, -0.9775, 0.5554},
-	{0.3272, -0.4279, -0.8425, 0.5584},
-	{-0.0110, 0.5258, 0.8506, 0.1456},
-	{0.6916, 0.7202, 0.0548, 0.1342},
-	{-0.0124, 0.2814, 0.9595, 0.1513},
-	{-0.4996, 0.8475, 0.1792, 0.0344},
-	{-0.8762, 0.4240, 0.2292, 0.0213},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{-0.7999, 0.5886, 0.1169, 0.2263},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{-0.6134, 0.5884, 0.5267, 0.2478},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{-0.9930, 0.1184, 0.0012, 0.6801},
-	{-0.9050, 0.0097, -0.4252, 0.6888},
-	{-0.6940, -0.1604, -0.7019, 0.1131},
-	{0.2592, 0.0554, -0.9642, 0.1068},
-	{-0.1964, 0.4941, -0.8469, 0.1135},
-	{0.2615, -0.5752, -0.7751, 0.5631},
-	{-0.3833, -0.0618, -0.9216, 0.5706},
-	{0.1224, -0.6692, -0.7329, 0.5490},
-	{-0.3243, 0.7713, -0.5477, 0.1609},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{0.5761, 0.3515, 0.7379, 0.8901},
-	{0.4746, 0.3089, 0.8242, 0.8995},
-	{0.2064, -0.0201, 0.9783, 0.8928},
-	{0.5129, 0.6787, 0.5256, 0.2440},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.8177, 0.0106, 0.5755, 0.2614},
-	{-0.8993, -0.4372, 0.0133, 0.1225},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{-0.9885, 0.1506, -0.0125, 0.1308},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.7518, -0.5548, 0.3563, 0.6122},
-	{0.9205, -0.2688, -0.2836, 0.2578},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.9302, -0.3645, -0.0428, 0.2514},
-	{-0.3671, -0.1598, 0.9163, 0.7698},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.7002, -0.1834, -0.6900, 0.7700},
-	{-0.2741, -0.9499, 0.1502, 0.8370},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{-0.3059, -0.7763, -0.5512, 0.7789},
-	{-0.6493, -0.7577, -0.0651, 0.7911},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{0.9597, 0.1729, 0.2216, 0.4933},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.4577, -0.5685, 0.6836, 0.9594},
-	{-0.2137, -0.9605, -0.1784, 0.8155},
-	{-0.0723, -0.9856, -0.1527, 0.7985},
-	{0.2766, -0.9403, -0.1984, 0.7956},
-	{0.3981, 0.4950, 0.7723, 0.2013},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.7585, 0.3987, 0.5155, 0.2087},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.4470, 0.5519, 0.7040, 0.7221},
-	{0.7532, 0.1973, 0.6275, 0.7311},
-	{-0.9405, 0.2829, -0.1882, 0.6179},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{-0.8010, 0.4273, -0.4192, 0.6146},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.7356, -0.6756, -0.0491, 0.7159},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{-0.1161, 0.5786, 0.8073, 0.6060},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{0.3832, 0.6734, 0.6322, 0.6279},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{-0.1736, -0.9293, 0.3260, 0.6959},
-	{-0.4014, -0.9129, 0.0744, 0.7213},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{-0.3899, -0.6640, 0.6380, 0.6314},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{-0.4005, 0.4345, 0.8067, 0.3488},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{-0.8176, 0.4403, 0.3712, 0.3432},
-	{-0.0051, 0.5905, -0.8070, 0.9556},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{0.2036, 0.7662, -0.6094, 0.9771},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{-0.5694, -0.0739, -0.8188, 0.1717},
-	{-0.7625, 0.1132, -0.6370, 0.1912},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.3213, 0.9305, 0.1761, 0.8812},
-	{-0.0675, 0.9886, -0.1342, 0.8853},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{-0.2591, -0.4051, -0.8768, 0.6958},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.7319, 0.1277, -0.6694, 0.1853},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.6930, 0.0767, -0.7168, 0.2044},
-	{0.2901, 0.1948, 0.9370, 0.6138},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.4615, 0.4621, 0.7572, 0.6280},
-	{-0.1371, -0.1821, 0.9737, 0.4469},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{-0.6658, 0.5287, 0.5265, 0.7597},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.7946, 0.0675, 0.6033, 0.4050},
-	{0.6192, 0.1329, 0.7740, 0.3932},
-	{-0.1878, 0.1793, -0.9657, 0.9756},
-	{0.4643, -0.0041, -0.8857, 0.9831},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{-0.3518, -0.5290, 0.7722, 0.6233},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.6362, -0.2575, 0.7273, 0.6159},
-	{0.8867, -0.0356, 0.4610, 0.3217},
-	{0.8355, -0.0408, 0.5480, 0.3058},
-	{0.8483, 0.1925, 0.4933, 0.3182},
-	{-0.7319, 0.1277, -0.6694, 0.1853},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{-0.8247, 0.0389, -0.5643, 0.7927},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.8876, 0.2327, 0.3975, 0.7390},
-	{0.2616, 0.7317, 0.6294, 0.7420},
-	{0.5960, 0.7125, 0.3703, 0.5700},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{0.9283, 0.2530, 0.2724, 0.5591},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.8118, -0.4978, -0.3052, 0.5434},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{0.3718, 0.3341, 0.8661, 0.4550},
-	{-0.0638, 0.7133, 0.6979, 0.4406},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.6023, -0.7173, -0.3503, 0.5413},
-	{0.7162, -0.5213, -0.4640, 0.5409},
-	{0.8118, -0.4978, -0.3052, 0.5434},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.8077, -0.0935, -0.5821, 0.5459},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{0.4079, -0.7157, -0.5669, 0.7606},
-	{0.1672, -0.8755, 0.4533, 0.7503},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{-0.1289, -0.5984, -0.7907, 0.1200},
-	{-0.0854, -0.7503, -0.6556, 0.1217},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.2741, 0.9578, 0.0866, 0.8434},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.3450, -0.9036, -0.2537, 0.9200},
-	{0.8213, -0.5612, -0.1021, 0.9243},
-	{0.4448, -0.8666, 0.2262, 0.9156},
-	{0.1475, 0.8808, -0.4499, 0.6093},
-	{0.3911, 0.8852, -0.2517, 0.5960},
-	{-0.1059, 0.9577, -0.2675, 0.5897},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.6109, -0.6349, -0.4729, 0.5540},
-	{0.1034, -0.5276, -0.8432, 0.5641},
-	{0.1647, -0.4521, -0.8766, 0.0646},
-	{0.5747, -0.7967, 0.1871, 0.0634},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{-0.2291, 0.4978, 0.8365, 0.3831},
-	{0.0923, 0.3078, 0.9470, 0.3813},
-	{0.3233, 0.2994, 0.8977, 0.3960},
-	{0.6058, -0.3462, -0.7164, 0.1580},
-	{-0.5971, -0.4884, -0.6364, 0.1649},
-	{-0.3804, 0.6299, -0.6771, 0.1625},
-	{-0.7034, 0.0977, -0.7041, 0.0958},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{-0.9593, -0.2751, 0.0644, 0.9503},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{-0.6613, 0.7378, -0.1354, 0.9443},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{-0.3527, 0.5343, -0.7682, 0.9121},
-	{0.6203, 0.7636, 0.1792, 0.3162},
-	{0.4693, -0.0563, -0.8812, 0.3195},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{-0.0675, 0.9886, -0.1342, 0.2578},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{-0.1977, 0.8256, -0.5285, 0.2592},
-	{-0.0727, 0.7955, 0.6016, 0.9063},
-	{-0.6503, 0.7208, 0.2398, 0.9186},
-	{-0.7702, 0.6297, -0.1017, 0.9127},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{0.8996, 0.4317, 0.0660, 0.3465},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{0.4778, 0.3240, -0.8165, 0.3549},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{0.3346, 0.6568, 0.6758, 0.7261},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.2475, -0.9664, -0.0696, 0.0392},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{-0.3709, -0.6859, 0.6261, 0.0580},
-	{0.6121, 0.1059, 0.7836, 0.4300},
-	{0.8400, -0.1295, 0.5269, 0.4219},
-	{0.7278, -0.3236, 0.6047, 0.4364},
-	{0.1707, -0.9829, 0.0693, 0.7046},
-	{0.0643, -0.9978, 0.0182, 0.7288},
-	{0.4838, -0.8688, 0.1050, 0.7407},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{-0.0541, 0.7990, 0.5989, 0.7183},
-	{0.3357, 0.2379, 0.9114, 0.7189},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{0.4707, -0.8229, 0.3184, 0.7198},
-	{-0.7818, 0.5826, -0.2221, 0.5277},
-	{-0.9004, 0.1637, -0.4031, 0.5335},
-	{-0.7358, 0.5362, -0.4136, 0.5209},
-	{-0.0585, -0.9638, -0.2600, 0.3690},
-	{-0.0107, -0.9588, -0.2839, 0.3455},
-	{-0.3021, -0.8740, -0.3807, 0.3843},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{-0.0675, 0.9886, -0.1342, 0.8853},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.6214, -0.6232, 0.4749, 0.9332},
-	{-0.5415, -0.5234, 0.6579, 0.9402},
-	{0.6471, 0.2960, 0.7026, 0.8098},
-	{0.6573, 0.6722, 0.3408, 0.8200},
-	{0.9580, 0.2468, 0.1461, 0.7948},
-	{-0.6739, 0.2329, -0.7011, 0.5526},
-	{0.4773, -0.2967, -0.8271, 0.5516},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{-0.6134, 0.5884, 0.5267, 0.2478},
-	{-0.8550, 0.4695, 0.2205, 0.2295},
-	{-0.7999, 0.5886, 0.1169, 0.2263},
-	{0.9201, -0.1270, -0.3704, 0.1912},
-	{0.3532, -0.5085, -0.7853, 0.1845},
-	{0.5742, -0.7735, -0.2683, 0.2153},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{0.2901, 0.1948, 0.9370, 0.4812},
-	{0.1931, 0.2597, 0.9462, 0.4508},
-	{0.2312, 0.3824, 0.8946, 0.4856},
-	{0.0002, 0.5669, -0.8238, 0.2024},
-	{0.5918, 0.5107, -0.6236, 0.2082},
-	{0.6905, 0.6446, -0.3283, 0.2011},
-	{0.9774, 0.0562, -0.2040, 0.2356},
-	{0.9037, 0.3671, 0.2205, 0.2195},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{-0.2242, 0.6396, -0.7353, 0.3207},
-	{0.8137, 0.4732, -0.3377, 0.3259},
-	{0.1943, 0.9739, 0.1170, 0.3325},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.8741, -0.2584, 0.4112, 0.6214},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{-0.5845, -0.5686, 0.5788, 0.2552},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{-0.3597, 0.0793, 0.9297, 0.8012},
-	{0.3951, -0.2508, -0.8837, 0.5694},
-	{0.0967, -0.9029, -0.4189, 0.5576},
-	{0.7192, -0.6694, -0.1863, 0.5678},
-	{0.8212, -0.5707, -0.0026, 0.4528},
-	{0.4815, -0.8623, -0.1567, 0.4770},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{-0.1059, 0.9577, -0.2675, 0.5897},
-	{0.8996, 0.4317, 0.0660, 0.5680},
-	{0.4778, 0.3240, -0.8165, 0.5646},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.9825, 0.0541, 0.1780, 0.3830},
-	{0.9684, -0.1415, 0.2052, 0.4034},
-	{0.8188, 0.5565, 0.1409, 0.8956},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.8773, 0.3281, 0.3502, 0.9037},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{-0.4308, 0.3968, 0.8106, 0.3507},
-	{-0.0397, -0.9855, 0.1650, 0.8011},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{-0.0106, -0.9562, 0.2925, 0.7946},
-	{-0.7548, 0.1316, -0.6426, 0.9118},
-	{-0.9218, 0.2442, -0.3011, 0.9168},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{-0.4976, -0.0473, 0.8661, 0.7176},
-	{-0.6246, -0.0635, 0.7783, 0.7336},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{0.7494, 0.4608, 0.4755, 0.7188},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{-0.8199, -0.4252, -0.3834, 0.8385},
-	{-0.9339, -0.3504, 0.0705, 0.8217},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{-0.3122, -0.9336, -0.1762, 0.8274},
-	{0.3238, -0.8445, -0.4265, 0.8732},
-	{-0.0397, -0.9855, 0.1650, 0.8011},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{-0.5315, -0.8099, -0.2480, 0.8670},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.6278, 0.1343, 0.7667, 0.0197},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{-0.9287, -0.2848, 0.2374, 0.8391},
-	{-0.7009, 0.2165, 0.6796, 0.8357},
-	{-0.6044, 0.6091, 0.5136, 0.5701},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.9846, -0.0281, -0.1725, 0.5612},
-	{0.8424, 0.0839, 0.5323, 0.4758},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.5188, 0.7059, -0.4822, 0.9059},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{0.3648, 0.9202, -0.1421, 0.2413},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{-0.1456, 0.6936, -0.7055, 0.2446},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{-0.1371, -0.1821, 0.9737, 0.4469},
-	{0.4889, 0.7745, 0.4013, 0.2413},
-	{-0.1438, 0.6836, -0.7156, 0.2337},
-	{0.3648, 0.9202, -0.1421, 0.2413},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{-0.2545, 0.5740, 0.7783, 0.2017},
-	{-0.9021, -0.0231, 0.4309, 0.2045},
-	{-0.7108, 0.4588, 0.5332, 0.1844},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.8786, 0.1012, -0.4667, 0.2229},
-	{-0.7621, -0.2047, -0.6142, 0.1855},
-	{0.3316, -0.3475, -0.8771, 0.4194},
-	{-0.1829, -0.6633, -0.7257, 0.4097},
-	{0.5203, -0.4377, -0.7333, 0.4151},
-	{0.0934, 0.7683, -0.6332, 0.2168},
-	{0.6697, 0.0931, -0.7368, 0.2109},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{0.2156, 0.4123, 0.8851, 0.0928},
-	{-0.6623, 0.7483, -0.0359, 0.0830},
-	{-0.2658, 0.9639, -0.0148, 0.0912},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{-0.9737, 0.0178, 0.2269, 0.2304},
-	{-0.8250, -0.0606, 0.5619, 0.2506},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{0.1917, -0.4699, 0.8616, 0.2267},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{0.7299, 0.6038, 0.3203, 0.6455},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.7158, 0.6526, 0.2486, 0.6546},
-	{0.1749, 0.4767, 0.8615, 0.9180},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.2425, 0.1763, 0.9540, 0.8995},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{0.6941, 0.4384, 0.5710, 0.4384},
-	{0.4013, 0.8252, 0.3976, 0.4511},
-	{-0.1112, 0.9938, 0.0005, 0.3839},
-	{-0.0565, 0.6602, 0.7489, 0.3896},
-	{-0.2788, 0.9589, 0.0518, 0.3884},
-	{-0.0365, -0.9854, 0.1665, 0.7150},
-	{-0.4014, -0.9129, 0.0744, 0.7213},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{0.9442, -0.2121, 0.2520, 0.0753},
-	{0.6278, 0.1343, 0.7667, 0.0606},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.9391, 0.3339, -0.0815, 0.4703},
-	{-0.9501, 0.1422, -0.2777, 0.4588},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.2738, -0.6418, -0.7164, 0.4661},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{-0.5206, -0.8143, -0.2566, 0.7195},
-	{-0.2447, -0.9353, 0.2556, 0.7197},
-	{0.8362, 0.1292, 0.5330, 0.9578},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{0.5903, 0.0384, 0.8063, 0.9688},
-	{-0.5701, -0.2354, -0.7871, 0.9084},
-	{-0.3358, 0.6780, -0.6539, 0.9124},
-	{-0.4354, 0.5439, -0.7174, 0.9030},
-	{-0.4078, 0.6986, -0.5879, 0.9322},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{-0.0555, 0.9983, 0.0179, 0.7267},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{-0.9334, 0.2796, 0.2248, 0.2303},
-	{0.5541, 0.8229, 0.1259, 0.1341},
-	{0.4609, 0.8793, -0.1197, 0.1448},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{-0.0110, 0.5258, 0.8506, 0.1984},
-	{-0.0124, 0.2814, 0.9595, 0.1996},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{-0.4740, -0.3401, 0.8122, 0.4963},
-	{-0.2813, -0.1737, 0.9438, 0.4606},
-	{-0.2443, -0.4778, 0.8438, 0.4913},
-	{-0.3122, -0.9336, -0.1762, 0.9696},
-	{-0.3043, -0.9223, 0.2380, 0.9685},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.9885, 0.1506, -0.0125, 0.1308},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{-0.4120, 0.7796, -0.4716, 0.1391},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{-0.1371, -0.1821, 0.9737, 0.4469},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.9568, -0.2573, -0.1352, 0.5092},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{-0.2873, -0.1227, -0.9500, 0.9530},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{-0.3037, 0.6004, -0.7398, 0.9351},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{0.0675, -0.9023, -0.4257, 0.2012},
-	{0.5308, -0.6575, -0.5347, 0.1948},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{0.2738, -0.6418, -0.7164, 0.2759},
-	{0.2489, -0.3748, -0.8931, 0.3047},
-	{-0.0829, -0.3785, -0.9219, 0.2830},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{-0.6035, 0.2047, -0.7706, 0.1750},
-	{0.7147, 0.5899, -0.3757, 0.1650},
-	{0.8749, -0.4637, -0.1399, 0.1542},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.9517, -0.0684, -0.2993, 0.1370},
-	{0.0929, -0.9668, 0.2381, 0.7218},
-	{0.0260, -0.9946, -0.1000, 0.7285},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.8706, 0.4916, 0.0193, 0.6971},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.9442, 0.1750, 0.2788, 0.6972},
-	{-0.5988, 0.7541, 0.2698, 0.3071},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{-0.3917, 0.9041, 0.1710, 0.3118},
-	{0.0675, -0.9023, -0.4257, 0.2012},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{0.4704, -0.7134, -0.5194, 0.2185},
-	{-0.7467, -0.0604, -0.6624, 0.6022},
-	{-0.4509, -0.2653, -0.8522, 0.5873},
-	{-0.2987, -0.3891, -0.8715, 0.5867},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.1174, -0.7612, -0.6379, 0.0498},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{-0.8270, -0.2832, -0.4856, 0.8817},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{-0.4254, -0.2550, -0.8684, 0.8815},
-	{-0.0110, 0.5258, 0.8506, 0.1456},
-	{-0.3588, 0.7796, 0.5132, 0.1334},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{0.5272, -0.2673, -0.8066, 0.7489},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{-0.8362, -0.4198, 0.3530, 0.7120},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{-0.7417, -0.6107, -0.2774, 0.7100},
-	{0.1009, -0.6644, 0.7406, 0.2901},
-	{-0.0437, -0.5611, 0.8266, 0.2896},
-	{0.1480, -0.7030, 0.6956, 0.2830},
-	{0.4108, -0.4155, -0.8116, 0.7321},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{0.2615, -0.5752, -0.7751, 0.3883},
-	{0.8658, -0.3532, 0.3544, 0.3731},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{-0.4005, 0.4345, 0.8067, 0.3488},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{0.7166, 0.6620, -0.2198, 0.1856},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{0.9420, -0.1023, -0.3196, 0.1669},
-	{0.6683, 0.5889, 0.4545, 0.8830},
-	{0.3586, 0.8645, -0.3521, 0.8813},
-	{0.4095, 0.7255, -0.5531, 0.8790},
-	{0.5960, 0.7125, 0.3703, 0.5700},
-	{-0.1771, 0.9171, 0.3572, 0.5775},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{0.8539, -0.4209, 0.3062, 0.8058},
-	{0.9063, 0.1697, 0.3870, 0.6474},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.7243, 0.2049, 0.6583, 0.6519},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.5742, -0.7735, -0.2683, 0.6847},
-	{0.4704, -0.7134, -0.5194, 0.6851},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.5779, 0.1707, 0.7981, 0.7546},
-	{0.0667, 0.8071, 0.5866, 0.7587},
-	{-0.0256, -0.1273, -0.9915, 0.5721},
-	{0.4773, -0.2967, -0.8271, 0.5661},
-	{0.5984, -0.3496, -0.7208, 0.5573},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{0.4561, -0.0727, -0.8870, 0.1341},
-	{0.9517, -0.0684, -0.2993, 0.1370},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.8235, 0.0960, -0.5591, 0.6222},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{-0.4234, -0.6756, 0.6036, 0.7037},
-	{-0.2232, -0.9664, 0.1272, 0.6727},
-	{-0.1504, -0.9176, 0.3679, 0.7108},
-	{0.5449, -0.3365, -0.7680, 0.4779},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{-0.1632, -0.9518, 0.2597, 0.3401},
-	{0.1679, -0.5133, 0.8416, 0.3562},
-	{0.4035, -0.4619, -0.7898, 0.5775},
-	{-0.0256, -0.1273, -0.9915, 0.5603},
-	{0.1204, -0.5628, -0.8178, 0.5821},
-	{0.4705, -0.2263, -0.8529, 0.0989},
-	{0.1214, -0.3144, -0.9415, 0.1111},
-	{0.6528, -0.0657, -0.7547, 0.1017},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{0.7742, 0.2596, 0.5773, 0.3530},
-	{0.7779, 0.6218, 0.0908, 0.3776},
-	{-0.8462, 0.1898, -0.4979, 0.1797},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{0.4838, -0.8688, 0.1050, 0.7407},
-	{0.0643, -0.9978, 0.0182, 0.7288},
-	{-0.0107, -0.9588, -0.2839, 0.3455},
-	{-0.0585, -0.9638, -0.2600, 0.3690},
-	{0.2820, -0.9484, -0.1451, 0.3463},
-	{0.2190, 0.9223, -0.3184, 0.9683},
-	{0.4682, 0.6911, -0.5506, 0.9517},
-	{0.5916, 0.3431, -0.7296, 0.9580},
-	{-0.5758, 0.5612, -0.5946, 0.8956},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{0.5853, -0.6279, -0.5130, 0.4162},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{0.4013, 0.8252, 0.3976, 0.4511},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{-0.1964, 0.4941, -0.8469, 0.9722},
-	{-0.0841, 0.8573, -0.5080, 0.9733},
-	{-0.3022, 0.8035, -0.5129, 0.9909},
-	{0.4573, 0.2614, 0.8500, 0.4070},
-	{0.3233, 0.2994, 0.8977, 0.3960},
-	{0.6442, 0.0965, 0.7588, 0.4009},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{0.7439, -0.5372, 0.3976, 0.6294},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{0.0415, 0.6355, 0.7710, 0.2749},
-	{-0.4062, 0.6163, 0.6747, 0.2652},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.4536, 0.3068, 0.8367, 0.7210},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.5826, 0.7809, -0.2256, 0.8671},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.5942, 0.7714, 0.2277, 0.8624},
-	{0.4232, 0.9045, 0.0533, 0.1776},
-	{-0.1192, 0.9575, 0.2626, 0.2220},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.6885, -0.2741, 0.6714, 0.3290},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.4217, -0.2859, -0.8605, 0.0408},
-	{0.7277, 0.5585, -0.3981, 0.0375},
-	{0.9603, -0.2203, 0.1710, 0.0359},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.7711, 0.2752, 0.5742, 0.7097},
-	{0.6541, -0.1749, 0.7359, 0.7051},
-	{0.6253, 0.5681, -0.5350, 0.0385},
-	{0.9497, 0.0426, 0.3102, 0.0380},
-	{0.7696, 0.2955, -0.5660, 0.0437},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{-0.9890, -0.1306, 0.0692, 0.6453},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{-0.4254, -0.2550, -0.8684, 0.8815},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{-0.6819, 0.6370, -0.3594, 0.9574},
-	{-0.3419, 0.6999, -0.6271, 0.9437},
-	{-0.7570, 0.6309, -0.1702, 0.9480},
-	{-0.4565, 0.8811, 0.1235, 0.2891},
-	{-0.8481, 0.3567, -0.3918, 0.2891},
-	{-0.9049, 0.2938, -0.3078, 0.3100},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{0.9221, 0.2930, 0.2526, 0.6127},
-	{0.8362, 0.1292, 0.5330, 0.6043},
-	{0.9556, 0.0238, 0.2936, 0.6246},
-	{0.6556, -0.3991, -0.6410, 0.1205},
-	{-0.5413, 0.5376, -0.6465, 0.1204},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.2768, -0.2675, 0.9229, 0.6958},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{-0.1038, 0.5652, 0.8184, 0.3922},
-	{-0.2280, 0.7995, 0.5557, 0.4007},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{0.1414, -0.5570, -0.8183, 0.5636},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{0.0816, -0.5218, -0.8492, 0.5645},
-	{-0.0091, -0.9999, 0.0097, 0.8709},
-	{-0.7076, -0.5762, 0.4089, 0.8788},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{-0.5808, -0.1282, -0.8039, 0.0519},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{0.1558, -0.0906, -0.9836, 0.0559},
-	{-0.0905, -0.0635, -0.9939, 0.4589},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.7319, 0.1277, -0.6694, 0.1853},
-	{-0.2788, 0.9589, 0.0518, 0.2640},
-	{-0.7787, 0.4834, -0.3999, 0.2496},
-	{-0.1112, 0.9938, 0.0005, 0.2678},
-	{-0.8471, -0.2198, -0.4838, 0.2382},
-	{-0.9007, -0.0366, -0.4329, 0.2422},
-	{-0.8604, -0.2490, -0.4447, 0.2257},
-	{0.3976, 0.8504, -0.3447, 0.0148},
-	{0.5075, 0.7911, -0.3416, 0.0491},
-	{-0.2266, 0.8250, -0.5177, 0.0126},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{0.5618, 0.3684, -0.7407, 0.5487},
-	{0.5715, -0.0954, -0.8150, 0.5486},
-	{-0.3059, -0.7763, -0.5512, 0.6951},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{0.4072, 0.2197, -0.8865, 0.0757},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{-0.1707, 0.5758, -0.7996, 0.0817},
-	{-0.8750, 0.4797, -0.0649, 0.6556},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{-0.8803, 0.4719, 0.0491, 0.6655},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.1771, -0.9605, -0.2148, 0.4475},
-	{-0.4537, 0.8911, 0.0085, 0.1504},
-	{0.9259, 0.3443, -0.1552, 0.1862},
-	{0.1472, 0.6436, -0.7511, 0.1868},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.9742, -0.1633, -0.1559, 0.4207},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{-0.2741, -0.9499, 0.1502, 0.8008},
-	{-0.1932, -0.9177, -0.3471, 0.8127},
-	{-0.4195, -0.8771, -0.2340, 0.7835},
-	{-0.2813, -0.1737, 0.9438, 0.2782},
-	{-0.6523, -0.4056, 0.6403, 0.2613},
-	{-0.2443, -0.4778, 0.8438, 0.2756},
-	{-0.0829, -0.3785, -0.9219, 0.2830},
-	{0.2489, -0.3748, -0.8931, 0.3047},
-	{-0.2804, -0.1980, -0.9393, 0.2971},
-	{-0.0091, -0.9999, 0.0097, 0.8709},
-	{-0.1266, -0.9838, -0.1268, 0.8792},
-	{0.0344, -0.8183, -0.5737, 0.8790},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{0.7585, 0.3987, 0.5155, 0.2087},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.7491, 0.0856, 0.6569, 0.3869},
-	{0.2662, 0.3158, 0.9107, 0.3682},
-	{0.6471, 0.2960, 0.7026, 0.3755},
-	{0.1720, -0.0618, -0.9832, 0.9529},
-	{0.4095, 0.4585, -0.7887, 0.9408},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.7915, 0.5940, 0.1435, 0.6369},
-	{0.6716, 0.5691, 0.4744, 0.6173},
-	{0.9727, 0.1849, 0.1403, 0.6352},
-	{0.8648, -0.0650, 0.4979, 0.6319},
-	{0.8367, 0.1849, 0.5155, 0.6256},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.3631, 0.2924, 0.8847, 0.0339},
-	{0.7262, 0.0241, 0.6871, 0.0284},
-	{-0.3289, 0.0834, 0.9407, 0.0248},
-	{-0.8107, 0.1310, 0.5706, 0.7516},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.8447, -0.3179, -0.4306, 0.7595},
-	{0.1342, 0.4108, -0.9018, 0.1714},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{0.2507, 0.4647, -0.8493, 0.1770},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{0.5251, -0.5981, -0.6055, 0.8674},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{0.3732, 0.2623, 0.8899, 0.7129},
-	{0.0441, 0.9041, 0.4251, 0.7130},
-	{-0.6493, -0.7577, -0.0651, 0.3154},
-	{-0.6851, -0.7041, -0.1867, 0.3190},
-	{-0.4917, -0.7379, 0.4623, 0.3244},
-	{-0.2657, -0.9215, 0.2832, 0.7359},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{0.1166, -0.9931, -0.0119, 0.7532},
-	{0.9742, -0.1633, -0.1559, 0.4207},
-	{0.8855, 0.0523, -0.4618, 0.4134},
-	{0.8748, -0.4219, -0.2380, 0.4294},
-	{0.8903, 0.1264, 0.4375, 0.1235},
-	{0.6845, -0.0171, 0.7288, 0.1510},
-	{0.7428, 0.1567, 0.6510, 0.1414},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{-0.1820, -0.8767, -0.4453, 0.8671},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.0360, 0.4841, 0.8743, 0.6834},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{-0.8413, -0.0416, -0.5389, 0.2480},
-	{-0.7427, -0.5655, -0.3586, 0.2531},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{0.7889, -0.5424, 0.2889, 0.3742},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{-0.4996, 0.8475, 0.1792, 0.1040},
-	{-0.5863, 0.4679, -0.6613, 0.0962},
-	{-0.8762, 0.4240, 0.2292, 0.1039},
-	{0.8094, -0.0293, 0.5866, 0.7015},
-	{0.7801, -0.2337, 0.5804, 0.6968},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{0.6137, 0.7808, 0.1173, 0.7223},
-	{-0.7870, -0.1584, -0.5963, 0.1395},
-	{-0.9846, -0.0281, -0.1725, 0.1466},
-	{-0.7958, -0.3691, -0.4801, 0.1387},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{-0.7427, -0.5655, -0.3586, 0.7631},
-	{-0.8831, -0.4312, -0.1851, 0.7699},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{0.1342, 0.4108, -0.9018, 0.1714},
-	{-0.2888, 0.2125, -0.9335, 0.1649},
-	{-0.8584, 0.2331, 0.4569, 0.2480},
-	{-0.9136, 0.3934, 0.1027, 0.2278},
-	{-0.9656, 0.2599, 0.0054, 0.2243},
-	{-0.7094, 0.5065, -0.4901, 0.2195},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.6094, 0.0216, -0.7926, 0.1862},
-	{0.6756, 0.2814, -0.6814, 0.1049},
-	{0.5660, 0.3094, -0.7641, 0.1066},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{0.1475, 0.8808, -0.4499, 0.0822},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{0.7864, 0.5650, 0.2497, 0.0968},
-	{-0.8831, -0.4312, -0.1851, 0.7699},
-	{-0.7427, -0.5655, -0.3586, 0.7631},
-	{-0.8413, -0.0416, -0.5389, 0.8106},
-	{0.7622, -0.1359, -0.6329, 0.5584},
-	{0.5660, 0.3094, -0.7641, 0.5513},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{-0.9214, 0.3077, -0.2376, 0.2660},
-	{-0.9135, 0.2882, -0.2873, 0.2315},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{0.9687, -0.0518, 0.2429, 0.4920},
-	{0.6314, 0.3066, 0.7123, 0.4613},
-	{0.8202, 0.2572, 0.5110, 0.4792},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.2616, 0.7317, 0.6294, 0.7420},
-	{0.8876, 0.2327, 0.3975, 0.7390},
-	{0.5345, 0.6701, -0.5151, 0.0871},
-	{0.9416, 0.3224, -0.0971, 0.0946},
-	{0.9387, 0.3345, 0.0828, 0.0997},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{-0.8010, 0.4273, -0.4192, 0.6146},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{-0.4867, -0.8732, 0.0233, 0.7051},
-	{-0.1434, -0.8472, 0.5116, 0.6969},
-	{0.9906, -0.1137, 0.0765, 0.7872},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.9077, -0.3640, 0.2088, 0.8014},
-	{-0.1964, 0.4941, -0.8469, 0.0017},
-	{-0.3022, 0.8035, -0.5129, 0.0107},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{-0.9259, 0.3032, -0.2253, 0.1042},
-	{-0.9239, 0.2541, -0.2862, 0.1075},
-	{-0.8751, 0.3795, -0.3002, 0.1188},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.7116, 0.3457, 0.6117, 0.9373},
-	{0.9221, 0.2930, 0.2526, 0.9344},
-	{-0.5586, -0.0152, -0.8293, 0.1682},
-	{-0.8718, -0.2590, -0.4158, 0.1535},
-	{-0.5618, -0.1911, -0.8049, 0.1739},
-	{-0.2356, -0.7534, 0.6140, 0.2701},
-	{-0.6080, -0.7593, 0.2321, 0.2395},
-	{-0.1736, -0.9293, 0.3260, 0.2612},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{-0.5689, 0.4621, -0.6803, 0.1976},
-	{-0.6212, 0.1724, -0.7645, 0.1797},
-	{-0.6930, 0.0767, -0.7168, 0.2044},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{0.9429, -0.1702, 0.2862, 0.3539},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{-0.1361, 0.6037, 0.7855, 0.2656},
-	{-0.6134, 0.5884, 0.5267, 0.2478},
-	{-0.5188, 0.7059, -0.4822, 0.9059},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.4274, 0.5541, -0.7143, 0.9311},
-	{-0.5321, 0.4244, -0.7326, 0.9983},
-	{-0.0504, 0.6080, -0.7923, 0.9957},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{0.9758, -0.0588, -0.2105, 0.7679},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{-0.8751, 0.3795, -0.3002, 0.1188},
-	{-0.9239, 0.2541, -0.2862, 0.1075},
-	{0.9588, -0.2231, 0.1757, 0.6414},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.8648, -0.0650, 0.4979, 0.6319},
-	{-0.3597, 0.0793, 0.9297, 0.8012},
-	{0.7144, -0.5083, 0.4809, 0.8026},
-	{0.7598, -0.3354, 0.5570, 0.8018},
-	{-0.3059, -0.7763, -0.5512, 0.7314},
-	{0.1672, -0.8755, 0.4533, 0.7309},
-	{-0.0749, -0.9885, -0.1310, 0.7236},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{0.9825, 0.0541, 0.1780, 0.3830},
-	{0.9742, -0.1633, -0.1559, 0.3906},
-	{0.9684, -0.1415, 0.2052, 0.4034},
-	{0.3951, -0.2508, -0.8837, 0.5694},
-	{0.2589, 0.0997, -0.9608, 0.5621},
-	{0.2493, -0.0521, -0.9670, 0.5457},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.1284, 0.7280, 0.6734, 0.9283},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{0.8919, -0.4507, 0.0369, 0.7777},
-	{0.8145, -0.2349, 0.5304, 0.7547},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{-0.6596, 0.6457, -0.3849, 0.0875},
-	{-0.3588, 0.7796, 0.5132, 0.1334},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{-0.2545, 0.5740, 0.7783, 0.5600},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{0.2392, 0.8886, 0.3913, 0.1849},
-	{0.6423, 0.7291, 0.2364, 0.1660},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{-0.5309, -0.8161, 0.2283, 0.0390},
-	{-0.2986, -0.8941, -0.3339, 0.0603},
-	{0.0040, -0.9951, 0.0988, 0.0583},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{-0.9104, 0.2613, -0.3207, 0.7718},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.5093, -0.8499, -0.1354, 0.7181},
-	{0.8883, -0.3035, -0.3446, 0.7267},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{-0.1001, -0.9345, 0.3417, 0.6406},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.5139, 0.8212, 0.2479, 0.0647},
-	{0.4031, 0.8693, -0.2860, 0.0661},
-	{0.3973, -0.9077, 0.1354, 0.1743},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{0.0849, -0.9546, 0.2855, 0.1795},
-	{-0.7215, 0.6525, -0.2318, 0.1547},
-	{-0.8570, 0.5126, -0.0526, 0.1302},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{0.7407, 0.4998, -0.4489, 0.7607},
-	{-0.2620, 0.5764, -0.7740, 0.7609},
-	{-0.4965, 0.8416, 0.2125, 0.7610},
-	{0.6145, -0.4954, -0.6140, 0.0748},
-	{0.6374, -0.1755, -0.7503, 0.0855},
-	{0.9771, -0.0602, -0.2041, 0.0739},
-	{0.8154, -0.5622, -0.1381, 0.6133},
-	{0.5580, -0.4338, 0.7074, 0.6110},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{-0.9093, 0.3754, 0.1795, 0.8041},
-	{-0.8831, -0.4312, -0.1851, 0.8164},
-	{-0.8413, -0.0416, -0.5389, 0.8336},
-	{0.3832, 0.6734, 0.6322, 0.6279},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{0.8830, 0.4098, 0.2289, 0.6364},
-	{-0.6841, 0.7055, 0.1851, 0.7331},
-	{-0.2788, 0.8163, 0.5058, 0.7463},
-	{-0.6489, 0.5254, 0.5504, 0.7371},
-	{0.6203, 0.7636, 0.1792, 0.1012},
-	{-0.1072, 0.7055, 0.7006, 0.0846},
-	{0.8060, 0.3464, 0.4800, 0.0850},
-	{0.9420, -0.1023, -0.3196, 0.1713},
-	{-0.5971, -0.4884, -0.6364, 0.1649},
-	{0.6058, -0.3462, -0.7164, 0.1580},
-	{0.7162, -0.5213, -0.4640, 0.5409},
-	{0.9676, -0.2452, 0.0607, 0.5259},
-	{0.9409, -0.3351, 0.0489, 0.5285},
-	{0.6203, 0.7636, 0.1792, 0.3162},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{-0.1072, 0.7055, 0.7006, 0.3020},
-	{0.8400, -0.1295, 0.5269, 0.4219},
-	{0.6121, 0.1059, 0.7836, 0.4300},
-	{0.4573, 0.2614, 0.8500, 0.4070},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{0.3951, -0.2508, -0.8837, 0.0597},
-	{0.9568, -0.2573, -0.1352, 0.0588},
-	{0.9771, -0.0602, -0.2041, 0.0739},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{0.0849, -0.9546, 0.2855, 0.1795},
-	{0.0427, 0.7425, 0.6685, 0.5697},
-	{0.2075, 0.4652, 0.8605, 0.5884},
-	{0.2183, 0.5054, 0.8348, 0.5737},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.9558, -0.2830, 0.0794, 0.7672},
-	{0.8919, -0.4507, 0.0369, 0.7777},
-	{0.8362, 0.1292, 0.5330, 0.9578},
-	{0.7116, 0.3457, 0.6117, 0.9373},
-	{0.5735, 0.1030, 0.8127, 0.9501},
-	{-0.1001, -0.8332, -0.5439, 0.3372},
-	{0.7622, -0.1359, -0.6329, 0.3210},
-	{-0.3082, 0.3755, -0.8741, 0.3123},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.5704, -0.6212, 0.5373, 0.9163},
-	{-0.6214, -0.6232, 0.4749, 0.9229},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.7009, 0.2165, 0.6796, 0.2509},
-	{-0.9287, -0.2848, 0.2374, 0.2300},
-	{-0.8550, 0.4695, 0.2205, 0.2295},
-	{0.3154, -0.2677, 0.9104, 0.1251},
-	{0.5325, 0.5856, 0.6111, 0.1240},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{0.2760, 0.9216, 0.2729, 0.6566},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.8275, 0.1032, 0.5519, 0.6505},
-	{0.7671, -0.5819, -0.2701, 0.4478},
-	{0.6747, -0.7331, 0.0851, 0.4478},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{0.2953, -0.6258, 0.7219, 0.2111},
-	{-0.0000, -0.8889, 0.4580, 0.2342},
-	{0.1917, -0.4699, 0.8616, 0.2267},
-	{-0.5204, 0.5779, 0.6287, 0.9979},
-	{-0.7379, 0.4419, 0.5101, 0.9849},
-	{-0.2241, 0.5052, 0.8334, 0.9749},
-	{-0.9103, -0.1463, -0.3873, 0.2102},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{-0.4120, 0.7796, -0.4716, 0.1391},
-	{0.9678, -0.0842, -0.2373, 0.7672},
-	{0.6274, -0.2245, 0.7456, 0.7572},
-	{0.7219, -0.6696, -0.1746, 0.7576},
-	{-0.3435, 0.0802, 0.9357, 0.8934},
-	{-0.3166, 0.3876, 0.8658, 0.9011},
-	{-0.0207, 0.4741, 0.8802, 0.9010},
-	{-0.9239, 0.2541, -0.2862, 0.9228},
-	{-0.8875, 0.1416, -0.4384, 0.9113},
-	{-0.4974, 0.5056, -0.7049, 0.8951},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.6714, 0.0501, -0.7394, 0.3016},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{0.5420, -0.5091, -0.6686, 0.7666},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.7946, 0.0675, 0.6033, 0.4050},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{0.9410, -0.1276, 0.3134, 0.4208},
-	{-0.2704, -0.8199, 0.5046, 0.6788},
-	{-0.2657, -0.9215, 0.2832, 0.7015},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{0.1215, -0.5712, 0.8117, 0.6648},
-	{-0.5748, -0.7181, 0.3925, 0.6838},
-	{-0.1434, -0.8472, 0.5116, 0.6969},
-	{-0.1878, 0.1793, -0.9657, 0.4878},
-	{-0.6034, 0.1195, -0.7885, 0.5005},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{0.0548, -0.3023, -0.9516, 0.3241},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{-0.2804, -0.1980, -0.9393, 0.2971},
-	{0.9205, -0.2688, -0.2836, 0.0833},
-	{0.8773, -0.3136, -0.3632, 0.1047},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{0.6755, -0.3762, -0.6342, 0.5545},
-	{-0.0610, -0.3610, -0.9306, 0.5666},
-	{-0.0256, -0.1273, -0.9915, 0.5721},
-	{0.2589, 0.0997, -0.9608, 0.3885},
-	{0.9417, -0.2343, 0.2415, 0.3769},
-	{0.8804, -0.3887, -0.2718, 0.3997},
-	{-0.0610, -0.3610, -0.9306, 0.5666},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.9996, 0.0183, -0.0197, 0.7675},
-	{-0.1900, 0.3651, 0.9114, 0.5965},
-	{-0.5707, -0.2727, 0.7746, 0.6061},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.6041, -0.6306, 0.4872, 0.7190},
-	{-0.5198, 0.4726, 0.7117, 0.7189},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{0.7962, -0.5388, 0.2753, 0.2492},
-	{0.6461, -0.2772, 0.7111, 0.2313},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{-0.4280, -0.6557, 0.6220, 0.1190},
-	{-0.0639, 0.3352, 0.9400, 0.1186},
-	{-0.6368, -0.4067, 0.6550, 0.1031},
-	{0.7299, 0.6038, 0.3203, 0.4949},
-	{0.9242, 0.3816, 0.0181, 0.5092},
-	{0.9597, 0.1729, 0.2216, 0.4933},
-	{0.3418, -0.3041, 0.8892, 0.1602},
-	{0.8020, -0.1630, 0.5747, 0.1427},
-	{-0.2773, -0.1585, 0.9476, 0.1625},
-	{0.2477, -0.8990, -0.3610, 0.1455},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.3296, -0.9391, 0.0976, 0.6237},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{-0.5415, -0.5234, 0.6579, 0.9402},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{0.7898, 0.5275, -0.3129, 0.4173},
-	{0.2507, 0.4647, -0.8493, 0.4338},
-	{0.3238, 0.3169, -0.8914, 0.4238},
-	{0.1346, 0.8735, -0.4678, 0.0853},
-	{0.1475, 0.8808, -0.4499, 0.0822},
-	{0.7864, 0.5650, 0.2497, 0.0968},
-	{-0.0504, 0.6080, -0.7923, 0.9957},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{0.5257, -0.5779, -0.6242, 0.5526},
-	{0.5812, -0.6776, -0.4506, 0.5504},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.1365, -0.9088, 0.3943, 0.6913},
-	{0.5742, -0.7735, -0.2683, 0.6847},
-	{-0.6356, 0.7386, -0.2248, 0.3748},
-	{-0.4537, 0.8911, 0.0085, 0.3717},
-	{0.1472, 0.6436, -0.7511, 0.4043},
-	{-0.7993, 0.5004, 0.3329, 0.2686},
-	{-0.5559, 0.8207, 0.1320, 0.2637},
-	{-0.5414, 0.8336, -0.1090, 0.2301},
-	{0.7699, 0.0425, 0.6367, 0.2893},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.7043, 0.2073, 0.6789, 0.2814},
-	{-0.4167, 0.8981, -0.1410, 0.6867},
-	{-0.0553, 0.9770, -0.2060, 0.6945},
-	{-0.3622, 0.8221, -0.4392, 0.6958},
-	{-0.7095, 0.4506, -0.5417, 0.8856},
-	{-0.7273, 0.6189, -0.2966, 0.8758},
-	{-0.6467, 0.7622, -0.0286, 0.8695},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{0.7346, 0.2381, -0.6353, 0.5747},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{-0.3981, -0.9038, 0.1570, 0.8412},
-	{-0.4674, -0.8704, -0.1549, 0.8414},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{-0.0824, 0.5702, 0.8174, 0.7525},
-	{0.8571, 0.4751, 0.1994, 0.7552},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{-0.0853, -0.0147, -0.9962, 0.5856},
-	{-0.3478, 0.0471, -0.9364, 0.5975},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{0.0260, 0.6156, 0.7876, 0.0565},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{0.6278, 0.1343, 0.7667, 0.0606},
-	{-0.8362, -0.4198, 0.3530, 0.7120},
-	{-0.4134, -0.8569, -0.3080, 0.7119},
-	{-0.3218, -0.3970, 0.8596, 0.7132},
-	{0.2164, 0.7439, 0.6323, 0.0625},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.4031, 0.8693, -0.2860, 0.0661},
-	{-0.2704, -0.8199, 0.5046, 0.7180},
-	{0.1365, -0.9088, 0.3943, 0.6913},
-	{0.4256, -0.7199, 0.5483, 0.7221},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{0.4208, 0.8724, 0.2486, 0.8662},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{0.6153, -0.3223, 0.7194, 0.8374},
-	{-0.5309, -0.8161, 0.2283, 0.3263},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.2986, -0.8941, -0.3339, 0.3410},
-	{0.1931, 0.2597, 0.9462, 0.2828},
-	{-0.4000, 0.1976, 0.8950, 0.2732},
-	{-0.4687, 0.1573, 0.8692, 0.2728},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{0.8996, 0.4317, 0.0660, 0.3465},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{-0.1095, 0.9075, 0.4055, 0.7160},
-	{-0.8468, 0.0758, 0.5264, 0.7176},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.6596, 0.6457, -0.3849, 0.0875},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{-0.9206, 0.3127, -0.2339, 0.0843},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.1468, 0.1824, -0.9722, 0.7725},
-	{0.6941, 0.4384, 0.5710, 0.8986},
-	{0.7663, 0.3181, 0.5582, 0.8867},
-	{0.5343, 0.4108, 0.7387, 0.9084},
-	{-0.6009, -0.6623, -0.4476, 0.3502},
-	{-0.7834, -0.6213, -0.0140, 0.3407},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{-0.1932, -0.9177, -0.3471, 0.5245},
-	{0.5081, -0.8163, -0.2747, 0.5306},
-	{-0.4218, 0.8652, -0.2710, 0.1227},
-	{0.0329, 0.9376, 0.3462, 0.1359},
-	{-0.7818, 0.5826, -0.2221, 0.1159},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{-0.1096, -0.6085, 0.7859, 0.6224},
-	{-0.2146, -0.6744, 0.7065, 0.6342},
-	{-0.9345, 0.3377, -0.1127, 0.9745},
-	{-0.9405, 0.2829, -0.1882, 0.9821},
-	{-0.8010, 0.4273, -0.4192, 0.9938},
-	{-0.8563, 0.2282, -0.4634, 0.7591},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{0.0367, 0.9992, 0.0168, 0.8934},
-	{0.2756, 0.7552, 0.5948, 0.8976},
-	{0.5496, 0.5667, 0.6138, 0.9027},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.8840, 0.3199, 0.3408, 0.4949},
-	{-0.9391, 0.3339, -0.0815, 0.4703},
-	{0.4609, 0.8793, -0.1197, 0.1385},
-	{0.5883, 0.8078, -0.0369, 0.1343},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{-0.6489, 0.5254, 0.5504, 0.7371},
-	{-0.7380, 0.0921, 0.6685, 0.7240},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.3772, 0.7134, -0.5906, 0.1639},
-	{-0.7215, 0.6525, -0.2318, 0.1547},
-	{-0.6372, 0.7035, -0.3147, 0.1468},
-	{0.7036, 0.1085, 0.7023, 0.3234},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.8094, -0.0293, 0.5866, 0.3156},
-	{0.8094, -0.0293, 0.5866, 0.7015},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{0.0978, -0.8102, 0.5780, 0.6999},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{0.0354, -0.9835, 0.1777, 0.6635},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{0.0701, 0.9587, 0.2756, 0.4669},
-	{0.1922, 0.9435, 0.2700, 0.4690},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.8290, -0.4023, -0.3885, 0.2417},
-	{-0.7427, -0.5655, -0.3586, 0.2531},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{-0.8762, 0.4240, 0.2292, 0.0213},
-	{-0.4666, 0.4578, 0.7568, 0.0171},
-	{-0.6573, -0.6227, 0.4245, 0.8865},
-	{-0.8279, -0.4407, 0.3468, 0.8804},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{0.7582, -0.6370, -0.1391, 0.8896},
-	{-0.5726, 0.6010, -0.5576, 0.7103},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{-0.2937, -0.0011, -0.9559, 0.7671},
-	{0.3160, 0.0811, 0.9453, 0.6254},
-	{0.2901, 0.1948, 0.9370, 0.6138},
-	{0.2183, 0.5054, 0.8348, 0.6142},
-	{0.7870, 0.1409, -0.6007, 0.7646},
-	{0.1562, -0.1962, -0.9680, 0.7641},
-	{0.6582, 0.1015, -0.7460, 0.7609},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{-0.1662, -0.0856, 0.9824, 0.7429},
-	{-0.8980, 0.2954, 0.3262, 0.3727},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{0.6097, 0.4787, 0.6317, 0.9089},
-	{0.6894, 0.7049, 0.1667, 0.8951},
-	{0.8445, 0.4828, 0.2317, 0.8886},
-	{0.1342, 0.4108, -0.9018, 0.4508},
-	{0.2827, 0.3982, -0.8727, 0.4262},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{0.2337, -0.8818, 0.4096, 0.6815},
-	{-0.4434, -0.8835, -0.1512, 0.6898},
-	{0.1707, -0.9829, 0.0693, 0.7046},
-	{-0.7864, 0.2552, 0.5625, 0.9158},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{-0.7076, -0.5762, 0.4089, 0.8983},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{-0.8302, 0.4420, -0.3397, 0.7208},
-	{-0.9107, 0.3181, 0.2636, 0.7239},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{0.5747, -0.7967, 0.1871, 0.0634},
-	{0.4477, -0.7783, 0.4401, 0.0737},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{0.0929, -0.9668, 0.2381, 0.7218},
-	{0.7661, -0.0308, -0.6420, 0.7518},
-	{0.5272, -0.2673, -0.8066, 0.7489},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.5188, 0.7059, -0.4822, 0.9059},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{0.5812, -0.6776, -0.4506, 0.5504},
-	{0.0816, -0.5218, -0.8492, 0.5645},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{-0.4223, -0.5637, -0.7099, 0.6950},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{-0.9598, 0.2512, -0.1250, 0.1255},
-	{-0.8570, 0.5126, -0.0526, 0.1302},
-	{0.0626, 0.9198, -0.3874, 0.1307},
-	{0.6238, 0.7294, 0.2807, 0.1275},
-	{0.4158, 0.9093, 0.0142, 0.1557},
-	{-0.1707, 0.5758, -0.7996, 0.5982},
-	{-0.1059, 0.9577, -0.2675, 0.5897},
-	{0.4778, 0.3240, -0.8165, 0.5646},
-	{0.9442, -0.2121, 0.2520, 0.0235},
-	{0.4477, -0.7783, 0.4401, 0.0279},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.9597, 0.1729, 0.2216, 0.4933},
-	{0.9242, 0.3816, 0.0181, 0.5092},
-	{0.8563, 0.5164, -0.0107, 0.5376},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{0.0929, -0.9668, 0.2381, 0.7218},
-	{-0.2545, 0.5740, 0.7783, 0.5600},
-	{-0.0822, 0.4819, 0.8724, 0.5592},
-	{-0.6049, -0.0334, 0.7956, 0.5521},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.6121, 0.1059, 0.7836, 0.9559},
-	{0.5751, -0.0706, 0.8150, 0.9634},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.1235, 0.7156, 0.6875, 0.9227},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{0.9190, -0.3578, -0.1655, 0.0445},
-	{0.0147, -0.1330, -0.9910, 0.0508},
-	{0.7177, -0.4829, -0.5017, 0.0447},
-	{-0.9598, 0.2512, -0.1250, 0.1255},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{-0.7379, 0.4419, 0.5101, 0.1324},
-	{-0.0400, 0.7807, -0.6237, 0.8970},
-	{0.0631, 0.8042, -0.5910, 0.8774},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{-0.2280, 0.7995, 0.5557, 0.9237},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{-0.0565, 0.6602, 0.7489, 0.9152},
-	{0.5812, -0.6776, -0.4506, 0.5504},
-	{0.7162, -0.5213, -0.4640, 0.5509},
-	{0.0816, -0.5218, -0.8492, 0.5645},
-	{0.7439, -0.5372, 0.3976, 0.6294},
-	{0.7728, -0.0732, 0.6304, 0.6367},
-	{0.9215, 0.1002, 0.3752, 0.6103},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{-0.9939, 0.1091, -0.0167, 0.7668},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{0.7582, -0.6370, -0.1391, 0.8896},
-	{-0.2019, -0.9791, -0.0256, 0.8911},
-	{0.1546, -0.8735, 0.4616, 0.8834},
-	{-0.9953, 0.0572, 0.0787, 0.7214},
-	{-0.7863, -0.1784, 0.5915, 0.7225},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{-0.2814, 0.4154, -0.8650, 0.0278},
-	{-0.2266, 0.8250, -0.5177, 0.0126},
-	{0.1543, 0.6393, -0.7533, 0.0336},
-	{-0.7927, 0.6095, -0.0127, 0.7270},
-	{0.7737, -0.6130, -0.1600, 0.7262},
-	{0.0806, -0.5386, -0.8387, 0.7262},
-	{-0.2873, -0.1227, -0.9500, 0.9530},
-	{-0.5415, 0.3814, -0.7492, 0.9675},
-	{0.1613, 0.3455, -0.9245, 0.9712},
-	{0.1089, -0.9827, 0.1501, 0.7471},
-	{0.0260, -0.9946, -0.1000, 0.7285},
-	{-0.0414, -0.9991, -0.0007, 0.7415},
-	{0.5984, -0.3496, -0.7208, 0.5339},
-	{0.9771, -0.0602, -0.2041, 0.5210},
-	{0.6755, -0.3762, -0.6342, 0.5374},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.8413, -0.0416, -0.5389, 0.8336},
-	{-0.9007, -0.0366, -0.4329, 0.8386},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{0.9397, 0.2646, 0.2169, 0.6384},
-	{0.2760, 0.9216, 0.2729, 0.6566},
-	{0.8820, 0.4305, -0.1916, 0.6490},
-	{0.1931, 0.2597, 0.9462, 0.2828},
-	{-0.4687, 0.1573, 0.8692, 0.2728},
-	{-0.3295, 0.1682, 0.9290, 0.2778},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.8479, -0.0537, 0.5274, 0.7149},
-	{-0.7772, -0.3624, 0.5144, 0.6975},
-	{0.7147, 0.5899, -0.3757, 0.1637},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.8749, -0.4637, -0.1399, 0.1542},
-	{-0.7379, 0.4419, 0.5101, 0.1324},
-	{-0.8764, 0.4710, -0.1002, 0.1446},
-	{-0.6325, 0.5786, 0.5149, 0.1480},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{0.3561, -0.6832, 0.6376, 0.0518},
-	{0.9190, -0.3578, -0.1655, 0.0607},
-	{0.7793, 0.2321, 0.5821, 0.1282},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{0.5983, -0.8012, -0.0112, 0.1382},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{-0.1030, -0.9923, 0.0683, 0.8432},
-	{-0.9339, -0.3504, 0.0705, 0.8448},
-	{0.6305, -0.0874, -0.7713, 0.8022},
-	{0.4812, -0.0765, -0.8733, 0.7912},
-	{0.7906, -0.3466, -0.5049, 0.8170},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{-0.3157, -0.0484, 0.9476, 0.5711},
-	{0.0458, 0.1274, 0.9908, 0.5804},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.5369, 0.0040, -0.8436, 0.5058},
-	{-0.6819, 0.6370, -0.3594, 0.5225},
-	{0.0367, 0.9992, 0.0168, 0.2616},
-	{-0.7179, 0.5520, -0.4242, 0.2501},
-	{-0.2683, 0.8985, -0.3475, 0.2620},
-	{0.2741, 0.9578, 0.0866, 0.8434},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.7164, 0.5456, 0.4349, 0.8360},
-	{-0.9702, -0.2422, -0.0108, 0.7265},
-	{-0.9091, 0.2984, 0.2906, 0.7254},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.6503, 0.7208, 0.2398, 0.4791},
-	{-0.4267, 0.8885, -0.1688, 0.4967},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{-0.7796, 0.2000, 0.5935, 0.3365},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{0.6162, 0.6719, -0.4108, 0.1237},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.3213, 0.9419, -0.0976, 0.1381},
-	{0.6697, 0.0931, -0.7368, 0.1760},
-	{0.0934, 0.7683, -0.6332, 0.1846},
-	{-0.6872, 0.7257, 0.0330, 0.4914},
-	{-0.6071, 0.7803, -0.1503, 0.5056},
-	{-0.4593, 0.8160, -0.3510, 0.5124},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.8927, 0.1149, 0.4357, 0.2941},
-	{0.8023, 0.3144, 0.5074, 0.2986},
-	{-0.3289, 0.0834, 0.9407, 0.6550},
-	{0.7262, 0.0241, 0.6871, 0.6491},
-	{0.5524, -0.7496, 0.3646, 0.6559},
-	{0.7582, -0.6370, -0.1391, 0.8896},
-	{0.4911, 0.0395, -0.8702, 0.8998},
-	{0.3393, -0.3190, -0.8849, 0.9058},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{-0.1235, 0.7156, 0.6875, 0.9227},
-	{-0.6879, 0.7258, 0.0008, 0.9174},
-	{0.8000, -0.5943, -0.0821, 0.4126},
-	{0.5203, -0.4377, -0.7333, 0.4151},
-	{0.5524, -0.7496, 0.3646, 0.4055},
-	{-0.7036, 0.6335, -0.3220, 0.7002},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.0543, 0.4619, -0.8853, 0.5708},
-	{-0.1707, 0.5758, -0.7996, 0.5982},
-	{-0.0472, -0.4350, -0.8992, 0.5725},
-	{-0.1835, -0.7467, -0.6393, 0.6949},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{0.0816, -0.5218, -0.8492, 0.5645},
-	{0.0012, -0.4761, -0.8794, 0.5765},
-	{-0.0471, -0.4304, -0.9014, 0.5654},
-	{0.0822, 0.9898, 0.1159, 0.7006},
-	{0.0925, 0.9692, 0.2281, 0.7001},
-	{-0.0360, 0.4841, 0.8743, 0.6930},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{-0.9135, 0.2882, -0.2873, 0.2315},
-	{-0.8955, 0.3403, -0.2869, 0.2213},
-	{0.5343, 0.4108, 0.7387, 0.4410},
-	{0.2308, 0.8675, 0.4406, 0.4482},
-	{0.6941, 0.4384, 0.5710, 0.4384},
-	{-0.9765, -0.0991, -0.1915, 0.9525},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{0.9008, -0.0111, 0.4341, 0.3660},
-	{0.7206, -0.0943, 0.6869, 0.3509},
-	{0.6043, -0.7266, -0.3270, 0.7665},
-	{-0.3952, 0.2953, -0.8698, 0.7662},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{0.9991, 0.0368, 0.0202, 0.5335},
-	{0.8203, 0.4864, -0.3010, 0.5466},
-	{0.9677, -0.2317, 0.0992, 0.5279},
-	{0.6680, 0.0893, 0.7388, 0.6893},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.6514, 0.6374, 0.4116, 0.7002},
-	{-0.2957, -0.8422, 0.4509, 0.3171},
-	{0.0898, -0.9951, 0.0416, 0.3205},
-	{0.0865, -0.9926, -0.0848, 0.3129},
-	{-0.3500, 0.4039, 0.8452, 0.3650},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{-0.3065, 0.4093, 0.8594, 0.3418},
-	{-0.1808, -0.8793, -0.4406, 0.6816},
-	{-0.5668, -0.8197, 0.0829, 0.6723},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{-0.6523, -0.4056, 0.6403, 0.2613},
-	{-0.8827, -0.3050, 0.3576, 0.2434},
-	{-0.8314, -0.3962, 0.3895, 0.2439},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.7711, 0.2752, 0.5742, 0.7097},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.7241, 0.6869, 0.0612, 0.8534},
-	{0.7007, 0.4246, 0.5733, 0.8394},
-	{0.4670, 0.8768, 0.1149, 0.8584},
-	{0.2966, 0.2362, 0.9253, 0.3827},
-	{0.6192, 0.1329, 0.7740, 0.3932},
-	{0.7946, 0.0675, 0.6033, 0.4050},
-	{0.7532, 0.1973, 0.6275, 0.7311},
-	{0.8876, 0.2327, 0.3975, 0.7390},
-	{0.2618, 0.1192, 0.9577, 0.7344},
-	{0.6916, 0.7202, 0.0548, 0.8090},
-	{0.6305, -0.0874, -0.7713, 0.8022},
-	{0.7925, -0.1961, -0.5775, 0.8151},
-	{-0.4851, -0.4615, 0.7428, 0.6074},
-	{-0.3789, -0.7091, 0.5947, 0.6143},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{0.4901, -0.8311, 0.2630, 0.7878},
-	{0.4783, -0.8590, 0.1828, 0.7799},
-	{-0.0742, -0.9959, 0.0524, 0.7546},
-	{-0.6883, 0.4111, 0.5977, 0.4704},
-	{0.7933, -0.3190, -0.5185, 0.4596},
-	{0.7441, -0.3986, -0.5361, 0.4663},
-	{0.2799, -0.1849, -0.9421, 0.7800},
-	{0.3794, 0.2620, -0.8874, 0.7722},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{-0.4537, 0.8911, 0.0085, 0.1504},
-	{0.1943, 0.9739, 0.1170, 0.1035},
-	{0.8108, 0.3802, 0.4451, 0.0964},
-	{-0.0620, 0.2819, 0.9574, 0.5723},
-	{0.1985, 0.3629, 0.9104, 0.5773},
-	{0.3675, 0.1214, 0.9221, 0.5834},
-	{0.3238, -0.8445, -0.4265, 0.8732},
-	{-0.0091, -0.9999, 0.0097, 0.8709},
-	{0.0344, -0.8183, -0.5737, 0.8790},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.1053, 0.6775, 0.7279, 0.0363},
-	{0.3618, 0.1472, -0.9206, 0.7254},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.4489, -0.0812, -0.8899, 0.7689},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{-0.3059, -0.7763, -0.5512, 0.6951},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{0.1342, 0.4108, -0.9018, 0.1714},
-	{0.1062, 0.5919, -0.7990, 0.1812},
-	{0.2312, 0.3824, 0.8946, 0.4856},
-	{0.1931, 0.2597, 0.9462, 0.4508},
-	{0.0869, 0.0972, 0.9915, 0.4572},
-	{0.1672, -0.8755, 0.4533, 0.7309},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{-0.0749, -0.9885, -0.1310, 0.7236},
-	{0.6426, -0.7660, -0.0162, 0.1105},
-	{0.6209, -0.7226, -0.3041, 0.1086},
-	{0.4058, -0.8983, -0.1683, 0.1139},
-	{-0.0365, -0.9854, 0.1665, 0.7150},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{-0.4014, -0.9129, 0.0744, 0.7213},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{-0.0226, -0.2344, -0.9719, 0.4746},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{-0.6714, 0.0501, -0.7394, 0.3016},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{-0.1072, 0.7055, 0.7006, 0.0846},
-	{-0.5637, 0.8259, -0.0093, 0.0548},
-	{0.2852, 0.8849, 0.3684, 0.0615},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.6430, -0.3183, -0.6966, 0.4378},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{-0.7862, 0.3046, -0.5377, 0.6920},
-	{-0.8047, 0.5711, -0.1621, 0.6798},
-	{-0.8727, 0.4368, -0.2180, 0.6845},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{0.1672, -0.8755, 0.4533, 0.7503},
-	{-0.3059, -0.7763, -0.5512, 0.7789},
-	{-0.0439, 0.9533, 0.2987, 0.1251},
-	{-0.1458, 0.9031, -0.4039, 0.0853},
-	{0.4217, 0.8901, 0.1727, 0.0997},
-	{0.1361, 0.4282, 0.8934, 0.9717},
-	{-0.6325, 0.5786, 0.5149, 0.9671},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.9793, -0.0393, -0.1984, 0.4578},
-	{-0.8157, 0.1440, -0.5603, 0.4450},
-	{-0.9929, -0.1185, 0.0031, 0.4461},
-	{-0.5528, 0.3638, 0.7497, 0.5185},
-	{-0.3157, -0.0484, 0.9476, 0.5294},
-	{-0.7253, 0.0630, 0.6856, 0.5146},
-	{0.3287, -0.8341, 0.4429, 0.7184},
-	{0.8043, -0.2155, 0.5538, 0.7164},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{0.5143, 0.8549, 0.0682, 0.1663},
-	{0.7922, 0.6035, -0.0907, 0.1511},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.2272, 0.9424, 0.2454, 0.9439},
-	{0.6454, 0.7637, 0.0119, 0.9093},
-	{0.3199, 0.8860, 0.3357, 0.9206},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{-0.7149, -0.5345, 0.4508, 0.7205},
-	{0.3690, -0.8046, 0.4653, 0.7199},
-	{-0.8424, -0.5052, -0.1876, 0.1260},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{-0.6733, -0.5739, -0.4662, 0.1405},
-	{0.8719, -0.4633, 0.1586, 0.7034},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{0.8542, -0.1426, 0.5001, 0.3626},
-	{0.7622, 0.0323, 0.6465, 0.3426},
-	{0.9087, -0.0823, 0.4094, 0.3632},
-	{0.7470, 0.4675, -0.4727, 0.1875},
-	{0.7898, 0.5275, -0.3129, 0.1796},
-	{0.3238, 0.3169, -0.8914, 0.1782},
-	{0.8996, 0.4317, 0.0660, 0.3465},
-	{-0.1059, 0.9577, -0.2675, 0.3322},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.3951, -0.2508, -0.8837, 0.0597},
-	{0.7192, -0.6694, -0.1863, 0.0457},
-	{0.9568, -0.2573, -0.1352, 0.0588},
-	{-0.2813, -0.1737, 0.9438, 0.2782},
-	{-0.8827, -0.3050, 0.3576, 0.2434},
-	{-0.6523, -0.4056, 0.6403, 0.2613},
-	{-0.6226, 0.6446, -0.4437, 0.9772},
-	{-0.2889, 0.6616, -0.6919, 0.9682},
-	{-0.7875, 0.1900, -0.5863, 0.9551},
-	{-0.8597, -0.4108, 0.3035, 0.4921},
-	{-0.9928, -0.0583, 0.1049, 0.4701},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{0.7995, 0.2339, 0.5533, 0.1742},
-	{0.8803, 0.3140, 0.3555, 0.1399},
-	{0.5367, -0.8437, 0.0113, 0.1440},
-	{-0.1632, -0.9518, 0.2597, 0.8307},
-	{-0.0419, -0.9496, 0.3107, 0.8236},
-	{-0.1934, -0.4228, 0.8853, 0.8343},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{-0.8247, 0.0389, -0.5643, 0.7927},
-	{-0.0256, -0.1273, -0.9915, 0.5721},
-	{-0.0610, -0.3610, -0.9306, 0.5666},
-	{-0.0749, -0.2522, -0.9648, 0.5798},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.8142, 0.1114, -0.5698, 0.3274},
-	{0.2312, 0.3824, 0.8946, 0.4856},
-	{0.1301, -0.0722, 0.9889, 0.4699},
-	{-0.1885, 0.0785, 0.9789, 0.4836},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.8550, 0.4695, 0.2205, 0.6518},
-	{-0.9339, -0.3504, 0.0705, 0.6364},
-	{0.5774, 0.7974, -0.1756, 0.7037},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{0.6628, 0.7287, -0.1726, 0.7044},
-	{-0.7185, 0.6437, 0.2637, 0.5525},
-	{-0.7317, 0.6214, 0.2801, 0.5453},
-	{-0.2773, -0.1585, 0.9476, 0.5428},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{0.2570, -0.4132, 0.8736, 0.6145},
-	{0.0896, -0.5786, 0.8107, 0.6212},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{0.7194, -0.2848, -0.6335, 0.8724},
-	{0.5100, -0.0978, -0.8546, 0.8763},
-	{0.2967, -0.9529, 0.0635, 0.3143},
-	{0.7666, -0.6420, 0.0103, 0.3064},
-	{0.2820, -0.9484, -0.1451, 0.3020},
-	{0.0929, -0.9668, 0.2381, 0.7218},
-	{-0.0365, -0.9854, 0.1665, 0.7150},
-	{0.0260, -0.9946, -0.1000, 0.7285},
-	{0.3853, -0.9062, -0.1739, 0.3914},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{0.8280, -0.5179, 0.2149, 0.3779},
-	{-0.4648, 0.5886, -0.6615, 0.0864},
-	{-0.1906, 0.6473, -0.7380, 0.0674},
-	{-0.2708, 0.1420, -0.9521, 0.0785},
-	{0.8154, -0.5622, -0.1381, 0.6133},
-	{0.1570, -0.9802, 0.1208, 0.6136},
-	{0.2296, -0.4959, -0.8375, 0.6168},
-	{0.4072, 0.2197, -0.8865, 0.0757},
-	{0.3951, -0.2508, -0.8837, 0.0597},
-	{0.9741, 0.1585, -0.1613, 0.0814},
-	{0.9774, 0.0562, -0.2040, 0.0702},
-	{0.9205, -0.2688, -0.2836, 0.0691},
-	{0.7838, -0.1936, -0.5900, 0.0882},
-	{-0.9214, 0.3077, -0.2376, 0.2660},
-	{-0.8768, 0.1334, -0.4620, 0.2422},
-	{-0.8713, -0.1955, -0.4501, 0.2548},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.1235, 0.7156, 0.6875, 0.9227},
-	{-0.8043, 0.3432, 0.4851, 0.9183},
-	{0.7940, -0.5722, -0.2055, 0.4461},
-	{0.7376, -0.4608, -0.4935, 0.4524},
-	{-0.1371, -0.1821, 0.9737, 0.4469},
-	{0.5476, -0.4772, -0.6873, 0.4249},
-	{0.6081, -0.4686, -0.6408, 0.4363},
-	{0.5334, -0.4430, -0.7205, 0.4539},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.2662, 0.3158, 0.9107, 0.3682},
-	{0.7491, 0.0856, 0.6569, 0.3869},
-	{0.6840, -0.6928, 0.2284, 0.3535},
-	{0.8177, 0.0106, 0.5755, 0.3369},
-	{0.2535, -0.8114, 0.5267, 0.3405},
-	{0.1917, -0.4699, 0.8616, 0.2267},
-	{-0.0000, -0.8889, 0.4580, 0.2342},
-	{0.3785, -0.8227, 0.4242, 0.2507},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{-0.0291, -0.1655, -0.9858, 0.6951},
-	{0.7243, 0.2049, 0.6583, 0.0334},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{-0.2643, 0.7812, 0.5656, 0.9306},
-	{-0.2449, 0.3345, 0.9100, 0.9427},
-	{-0.3856, 0.6785, 0.6253, 0.9421},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{0.4878, 0.0153, 0.8728, 0.7260},
-	{-0.0426, -0.7226, -0.6899, 0.7259},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.3042, -0.4918, 0.8159, 0.7209},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{0.5846, 0.8048, -0.1023, 0.8829},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{0.1678, 0.8656, 0.4718, 0.8959},
-	{-0.6182, 0.2381, -0.7491, 0.7664},
-	{-0.6106, 0.1374, -0.7800, 0.7661},
-	{0.6151, -0.6817, -0.3961, 0.7663},
-	{-0.5316, -0.4272, 0.7314, 0.6718},
-	{-0.3378, -0.7932, 0.5066, 0.6793},
-	{0.2337, -0.8818, 0.4096, 0.6815},
-	{0.9166, 0.1872, 0.3532, 0.3353},
-	{0.9429, -0.1702, 0.2862, 0.3539},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{-0.1858, 0.7303, -0.6574, 0.2051},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{-0.5857, -0.4025, -0.7035, 0.0357},
-	{-0.1685, 0.3061, 0.9370, 0.0358},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{-0.9384, -0.2561, -0.2322, 0.9006},
-	{-0.5083, 0.6049, -0.6130, 0.8812},
-	{-0.7870, 0.4590, -0.4123, 0.9021},
-	{0.4725, -0.8216, 0.3188, 0.6898},
-	{0.4256, -0.7199, 0.5483, 0.7221},
-	{0.1365, -0.9088, 0.3943, 0.6913},
-	{0.8443, -0.3973, 0.3596, 0.3488},
-	{0.8624, 0.3978, 0.3131, 0.3325},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.9181, -0.2878, -0.2724, 0.4515},
-	{0.9699, -0.2355, -0.0625, 0.4390},
-	{0.8367, -0.3676, -0.4059, 0.4602},
-	{0.3342, 0.2023, 0.9205, 0.7535},
-	{0.8028, -0.2189, 0.5545, 0.7560},
-	{0.9463, 0.1056, 0.3056, 0.7616},
-	{0.5524, -0.7496, 0.3646, 0.0656},
-	{-0.1829, -0.6633, -0.7257, 0.0591},
-	{-0.9306, -0.2509, 0.2666, 0.0623},
-	{0.5923, 0.2690, 0.7595, 0.0356},
-	{0.7262, 0.0241, 0.6871, 0.0284},
-	{-0.0989, 0.3433, 0.9340, 0.0350},
-	{-0.5198, 0.4726, 0.7117, 0.7189},
-	{-0.4226, 0.8867, 0.1875, 0.7179},
-	{-0.9776, 0.1730, -0.1198, 0.7185},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.5038, -0.2667, -0.8216, 0.7906},
-	{0.6803, -0.1951, -0.7065, 0.7720},
-	{-0.3588, 0.7796, 0.5132, 0.1334},
-	{-0.0110, 0.5258, 0.8506, 0.1456},
-	{-0.6044, 0.6091, 0.5136, 0.1177},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{-0.6467, -0.2374, -0.7249, 0.3783},
-	{0.0059, -0.5459, -0.8378, 0.3980},
-	{0.2477, -0.8990, -0.3610, 0.3688},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.1204, -0.5628, -0.8178, 0.1140},
-	{-0.1289, -0.5984, -0.7907, 0.1200},
-	{-0.6134, 0.5884, 0.5267, 0.2478},
-	{-0.7009, 0.2165, 0.6796, 0.2509},
-	{-0.8550, 0.4695, 0.2205, 0.2295},
-	{0.8591, -0.3939, -0.3267, 0.4599},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{0.7058, 0.1194, -0.6982, 0.6156},
-	{0.8154, -0.5622, -0.1381, 0.6133},
-	{0.2296, -0.4959, -0.8375, 0.6168},
-	{-0.3527, 0.5343, -0.7682, 0.9121},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{0.8416, 0.2044, 0.4999, 0.6472},
-	{0.6033, -0.6533, 0.4574, 0.6580},
-	{0.7801, -0.2337, 0.5804, 0.6968},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{-0.0745, 0.3249, 0.9428, 0.3627},
-	{-0.6540, -0.5475, -0.5220, 0.7879},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{0.1349, -0.9048, -0.4040, 0.7914},
-	{-0.4116, 0.6903, -0.5951, 0.1658},
-	{0.6697, 0.0931, -0.7368, 0.1760},
-	{0.6526, 0.7519, -0.0930, 0.1584},
-	{0.2190, 0.9223, -0.3184, 0.9683},
-	{-0.0555, 0.7301, -0.6811, 0.9569},
-	{0.4682, 0.6911, -0.5506, 0.9517},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{-0.2813, 0.6196, -0.7328, 0.9210},
-	{0.0218, 0.6616, -0.7495, 0.9276},
-	{0.8645, 0.1297, 0.4856, 0.7258},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{0.6471, 0.2960, 0.7026, 0.3755},
-	{0.9825, 0.0541, 0.1780, 0.3830},
-	{0.9211, -0.0583, 0.3850, 0.4098},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{0.9086, -0.3328, -0.2523, 0.3365},
-	{0.5563, -0.5751, 0.5998, 0.1645},
-	{0.3418, -0.3041, 0.8892, 0.1602},
-	{-0.4094, -0.6861, 0.6014, 0.1809},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.5198, 0.4726, 0.7117, 0.7189},
-	{-0.6041, -0.6306, 0.4872, 0.7190},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{-0.8896, -0.1610, -0.4274, 0.9768},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{-0.9214, 0.3077, -0.2376, 0.9751},
-	{0.3015, -0.9494, -0.0878, 0.0309},
-	{0.2963, -0.9342, 0.1988, 0.0475},
-	{-0.1113, -0.9360, 0.3341, 0.0586},
-	{-0.0934, -0.3215, -0.9423, 0.3694},
-	{0.0108, -0.0932, -0.9956, 0.3946},
-	{-0.6158, -0.0817, -0.7837, 0.3727},
-	{-0.8496, 0.5161, -0.1091, 0.6061},
-	{-0.6136, 0.0291, 0.7891, 0.6105},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{-0.1835, -0.7467, -0.6393, 0.6949},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.1091, -0.0123, 0.9940, 0.6952},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.6860, 0.2373, -0.6879, 0.8844},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{-0.5791, -0.2427, 0.7783, 0.7252},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{-0.2600, -0.7976, -0.5442, 0.7218},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.8471, -0.2198, -0.4838, 0.8450},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{0.4344, -0.8812, -0.1864, 0.7251},
-	{-0.8247, 0.0389, -0.5643, 0.7927},
-	{-0.8815, -0.0847, -0.4644, 0.8044},
-	{-0.6972, -0.5804, -0.4208, 0.8302},
-	{-0.9012, -0.2370, -0.3629, 0.2341},
-	{-0.7427, -0.5655, -0.3586, 0.2531},
-	{-0.8713, -0.1955, -0.4501, 0.2548},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.2280, 0.7995, 0.5557, 0.4007},
-	{-0.0565, 0.6602, 0.7489, 0.3896},
-	{0.9684, -0.1415, 0.2052, 0.4178},
-	{0.9628, -0.2694, -0.0184, 0.4233},
-	{0.9211, -0.0583, 0.3850, 0.4089},
-	{0.3186, 0.0211, 0.9477, 0.5892},
-	{0.6374, -0.1375, 0.7581, 0.6007},
-	{0.7875, -0.1198, 0.6046, 0.6112},
-	{0.8073, 0.3940, 0.4394, 0.3233},
-	{0.4481, 0.8321, -0.3268, 0.3082},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.6415, -0.3030, 0.7048, 0.0615},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.3561, -0.6832, 0.6376, 0.0518},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{-0.9259, 0.3032, -0.2253, 0.3837},
-	{-0.7790, -0.1434, -0.6104, 0.7205},
-	{-0.8176, 0.2385, 0.5240, 0.7209},
-	{-0.8192, 0.1624, 0.5501, 0.7211},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{0.2115, -0.8269, -0.5211, 0.7231},
-	{0.8830, 0.4098, 0.2289, 0.0678},
-	{0.9244, 0.0952, -0.3693, 0.0839},
-	{0.9442, -0.2121, 0.2520, 0.0753},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.5050, -0.8630, -0.0143, 0.8332},
-	{0.9821, 0.0201, 0.1873, 0.2328},
-	{0.8400, 0.0598, 0.5393, 0.2269},
-	{0.8939, -0.2588, 0.3660, 0.2410},
-	{0.7666, -0.6420, 0.0103, 0.9208},
-	{0.4448, -0.8666, 0.2262, 0.9156},
-	{0.8213, -0.5612, -0.1021, 0.9243},
-	{0.7158, 0.6526, 0.2486, 0.6546},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.6894, 0.7049, 0.1667, 0.6825},
-	{-0.5204, 0.5779, 0.6287, 0.3893},
-	{-0.8980, 0.2954, 0.3262, 0.3727},
-	{-0.9598, 0.2512, -0.1250, 0.3870},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{0.3085, 0.1057, 0.9453, 0.2140},
-	{0.0899, 0.5360, 0.8394, 0.2010},
-	{-0.0110, 0.5258, 0.8506, 0.1984},
-	{-0.6714, 0.0501, -0.7394, 0.3016},
-	{-0.2804, -0.1980, -0.9393, 0.2971},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{0.4035, -0.4619, -0.7898, 0.1185},
-	{0.5512, -0.6335, -0.5430, 0.1195},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.7036, 0.1085, 0.7023, 0.3234},
-	{0.8177, 0.0106, 0.5755, 0.3369},
-	{0.9429, -0.1702, 0.2862, 0.3539},
-	{0.6894, 0.7049, 0.1667, 0.6825},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.8445, 0.4828, 0.2317, 0.6993},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.8476, 0.0971, -0.5217, 0.4904},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{0.2738, -0.6418, -0.7164, 0.4661},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.2489, -0.3748, -0.8931, 0.4837},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.7158, 0.6526, 0.2486, 0.6546},
-	{0.4162, 0.5646, 0.7127, 0.6347},
-	{0.2662, 0.3158, 0.9107, 0.9664},
-	{0.2222, 0.4874, 0.8444, 0.9506},
-	{0.6471, 0.2960, 0.7026, 0.9462},
-	{0.5907, -0.3701, 0.7170, 0.6213},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{0.2179, -0.4400, 0.8711, 0.6073},
-	{0.9747, 0.1293, 0.1821, 0.2868},
-	{0.8130, 0.1991, 0.5471, 0.3046},
-	{0.3704, -0.0645, -0.9266, 0.2946},
-	{-0.7134, -0.4321, -0.5517, 0.8868},
-	{-0.8279, -0.4407, 0.3468, 0.8804},
-	{-0.4354, 0.5439, -0.7174, 0.8920},
-	{0.3088, 0.9352, 0.1734, 0.1222},
-	{0.0114, 0.7782, 0.6280, 0.1163},
-	{0.6577, 0.4315, 0.6174, 0.1257},
-	{-0.0136, 0.9965, 0.0830, 0.6429},
-	{-0.6579, 0.4764, -0.5833, 0.6367},
-	{0.1346, 0.8735, -0.4678, 0.6288},
-	{-0.6793, 0.5713, 0.4606, 0.2521},
-	{-0.5787, 0.2214, 0.7849, 0.2642},
-	{-0.1699, 0.5369, 0.8264, 0.2729},
-	{-0.7328, 0.6604, 0.1638, 0.7559},
-	{-0.5078, 0.5728, -0.6435, 0.7619},
-	{-0.5752, 0.8083, -0.1259, 0.7507},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{0.8930, -0.3670, 0.2605, 0.3812},
-	{0.8875, -0.1438, 0.4377, 0.3572},
-	{0.9156, -0.3872, 0.1080, 0.3586},
-	{0.4477, -0.7783, 0.4401, 0.0737},
-	{0.9442, -0.2121, 0.2520, 0.0766},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{0.5283, 0.7672, 0.3636, 0.8762},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.4208, 0.8724, 0.2486, 0.8662},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.8188, 0.5565, 0.1409, 0.8956},
-	{0.6905, 0.6446, -0.3283, 0.8894},
-	{0.1057, -0.9738, -0.2013, 0.6964},
-	{-0.5065, -0.6227, 0.5964, 0.6979},
-	{-0.2062, -0.8787, 0.4306, 0.6970},
-	{0.3328, 0.9363, 0.1120, 0.4513},
-	{0.4746, 0.3089, 0.8242, 0.4422},
-	{0.4094, 0.8741, 0.2615, 0.4501},
-	{-0.5460, 0.0421, -0.8367, 0.4740},
-	{-0.4982, -0.0110, -0.8670, 0.4837},
-	{-0.8476, 0.0971, -0.5217, 0.4904},
-	{0.8098, -0.5117, -0.2871, 0.4476},
-	{0.8722, -0.3724, -0.3171, 0.4488},
-	{0.5858, -0.4187, -0.6939, 0.4683},
-	{0.7098, 0.5867, 0.3899, 0.7039},
-	{0.3732, 0.2623, 0.8899, 0.7129},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{-0.8919, 0.4523, 0.0060, 0.3044},
-	{-0.3577, 0.7804, -0.5129, 0.3162},
-	{-0.7578, 0.1747, -0.6286, 0.3087},
-	{-0.8786, 0.1012, -0.4667, 0.2229},
-	{-0.8782, -0.1120, -0.4650, 0.2170},
-	{-0.8942, -0.1495, -0.4219, 0.2041},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.3140, -0.3362, -0.8879, 0.7268},
-	{-0.7842, -0.2136, -0.5825, 0.7255},
-	{-0.4907, 0.0066, 0.8713, 0.7263},
-	{0.5204, -0.6924, 0.4997, 0.6540},
-	{0.1324, -0.9348, 0.3297, 0.6602},
-	{0.4172, -0.7907, 0.4480, 0.6769},
-	{0.0135, -0.3835, -0.9234, 0.0649},
-	{0.3497, -0.9030, -0.2498, 0.0574},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{-0.0025, -0.5954, 0.8034, 0.7518},
-	{0.6274, -0.2245, 0.7456, 0.7572},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.2760, 0.9216, 0.2729, 0.0443},
-	{0.0971, 0.3053, 0.9473, 0.0412},
-	{-0.1392, 0.2158, 0.9665, 0.0525},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{0.4783, -0.8590, 0.1828, 0.8232},
-	{-0.1559, -0.8738, 0.4606, 0.8393},
-	{0.5719, -0.6349, -0.5195, 0.4893},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{-0.9675, 0.2481, -0.0487, 0.6170},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.7548, 0.1316, -0.6426, 0.9060},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{-0.5586, -0.0152, -0.8293, 0.1682},
-	{-0.8827, -0.3050, 0.3576, 0.6421},
-	{-0.9890, -0.1306, 0.0692, 0.6453},
-	{-0.6136, 0.0291, 0.7891, 0.6105},
-	{-0.6125, -0.7885, -0.0558, 0.9427},
-	{-0.8660, -0.4980, 0.0447, 0.9381},
-	{-0.8227, -0.0703, 0.5641, 0.9330},
-	{-0.2977, -0.9183, 0.2611, 0.8321},
-	{0.0541, -0.9074, 0.4167, 0.8284},
-	{-0.1224, -0.9325, -0.3398, 0.8297},
-	{0.5710, -0.6458, -0.5068, 0.8539},
-	{0.5216, -0.8309, 0.1937, 0.8500},
-	{0.4846, -0.8583, -0.1691, 0.8613},
-	{-0.3358, 0.4761, 0.8127, 0.3555},
-	{-0.4005, 0.4345, 0.8067, 0.3488},
-	{-0.4533, 0.4509, 0.7689, 0.3666},
-	{-0.9259, 0.3032, -0.2253, 0.1042},
-	{-0.7639, 0.2401, -0.5990, 0.0933},
-	{-0.9239, 0.2541, -0.2862, 0.1075},
-	{0.1351, 0.6363, 0.7595, 0.5533},
-	{0.8857, 0.0241, 0.4637, 0.5543},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{0.9128, -0.2116, 0.3494, 0.3836},
-	{0.7964, -0.5298, 0.2917, 0.3832},
-	{0.0967, -0.9029, -0.4189, 0.3935},
-	{-0.9196, 0.2569, -0.2971, 0.6478},
-	{-0.8235, 0.0960, -0.5591, 0.6222},
-	{-0.7754, 0.1118, -0.6216, 0.6233},
-	{-0.8850, 0.2606, -0.3859, 0.3047},
-	{-0.5694, -0.0739, -0.8188, 0.2864},
-	{-0.6714, 0.0501, -0.7394, 0.3016},
-	{0.9727, -0.2155, -0.0861, 0.1245},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{0.9517, -0.0684, -0.2993, 0.1370},
-	{-0.1095, 0.9075, 0.4055, 0.7151},
-	{-0.0449, 0.9346, 0.3528, 0.7173},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{-0.6160, 0.4382, 0.6546, 0.1001},
-	{0.3438, 0.4810, 0.8065, 0.1103},
-	{-0.6863, 0.0094, 0.7273, 0.0984},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{0.0195, -0.9672, 0.2531, 0.6933},
-	{0.2977, -0.9342, 0.1965, 0.7328},
-	{0.1166, -0.9931, -0.0119, 0.7532},
-	{0.2844, -0.9210, 0.2662, 0.7414},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{-0.1858, 0.7303, -0.6574, 0.2051},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{0.4265, 0.4801, -0.7665, 0.9258},
-	{0.1298, 0.6231, -0.7713, 0.9243},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{0.2615, -0.7676, -0.5852, 0.5049},
-	{0.5116, -0.4641, -0.7231, 0.5181},
-	{-0.9306, -0.2509, 0.2666, 0.0623},
-	{-0.1829, -0.6633, -0.7257, 0.0591},
-	{-0.5247, -0.4905, -0.6957, 0.0376},
-	{-0.6860, 0.2373, -0.6879, 0.8844},
-	{0.0153, -0.1455, -0.9892, 0.8751},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.6716, 0.5691, 0.4744, 0.6483},
-	{0.7098, 0.5867, 0.3899, 0.7044},
-	{0.2633, 0.9370, 0.2294, 0.1879},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{-0.3051, 0.8577, -0.4138, 0.1586},
-	{-0.4961, 0.5633, 0.6608, 0.7266},
-	{0.0077, -0.1582, -0.9874, 0.7268},
-	{0.1763, 0.2464, 0.9530, 0.7266},
-	{0.8773, -0.3136, -0.3632, 0.1047},
-	{0.2592, 0.0554, -0.9642, 0.1068},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{-0.9259, 0.3032, -0.2253, 0.3837},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{-0.7639, 0.2401, -0.5990, 0.3829},
-	{-0.7964, 0.0547, 0.6023, 0.3365},
-	{-0.3844, 0.5563, 0.7367, 0.3364},
-	{-0.5259, 0.2486, 0.8134, 0.3363},
-	{0.9666, -0.1447, 0.2117, 0.4931},
-	{0.9404, -0.3383, 0.0347, 0.5072},
-	{0.9568, -0.2573, -0.1352, 0.5092},
-	{0.4448, -0.8666, 0.2262, 0.9156},
-	{0.2967, -0.9529, 0.0635, 0.9066},
-	{-0.0585, -0.9638, -0.2600, 0.8847},
-	{-0.3296, -0.9391, 0.0976, 0.6237},
-	{-0.2003, -0.8926, 0.4040, 0.6189},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{-0.0110, 0.5258, 0.8506, 0.1984},
-	{0.1433, 0.0450, 0.9887, 0.2099},
-	{0.3446, -0.2188, 0.9129, 0.2205},
-	{-0.2778, -0.9466, 0.1638, 0.8600},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{-0.1616, -0.9423, -0.2933, 0.8690},
-	{0.4778, 0.3240, -0.8165, 0.5646},
-	{0.1844, -0.7136, -0.6758, 0.5646},
-	{-0.0472, -0.4350, -0.8992, 0.5725},
-	{-0.1523, 0.7901, -0.5938, 0.9344},
-	{0.0218, 0.6616, -0.7495, 0.9276},
-	{0.1800, 0.6143, -0.7683, 0.9402},
-	{0.3328, 0.9363, 0.1120, 0.4513},
-	{-0.3166, 0.3876, 0.8658, 0.4556},
-	{0.4746, 0.3089, 0.8242, 0.4422},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{0.5546, 0.1550, 0.8176, 0.7904},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.9306, -0.2509, 0.2666, 0.5856},
-	{-0.8252, 0.1046, 0.5551, 0.5807},
-	{-0.9191, 0.1948, 0.3426, 0.4940},
-	{-0.9928, -0.0583, 0.1049, 0.4701},
-	{-0.9701, 0.2080, -0.1247, 0.4616},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{-0.8424, -0.5052, -0.1876, 0.1260},
-	{-0.8597, -0.4108, 0.3035, 0.1073},
-	{-0.9384, -0.2561, -0.2322, 0.6409},
-	{-0.8080, 0.3359, -0.4840, 0.6454},
-	{-0.8851, -0.3374, -0.3204, 0.6593},
-	{0.8035, 0.0610, -0.5922, 0.7915},
-	{-0.1835, -0.7883, -0.5874, 0.7915},
-	{0.0347, -0.8970, -0.4407, 0.7963},
-	{0.4255, -0.2828, -0.8596, 0.1010},
-	{0.2592, 0.0554, -0.9642, 0.1068},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{-0.0388, 0.3392, -0.9399, 0.0558},
-	{0.7277, 0.5585, -0.3981, 0.0375},
-	{0.4217, -0.2859, -0.8605, 0.0408},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.6875, 0.5760, 0.4423, 0.7236},
-	{0.9447, -0.2902, 0.1527, 0.7167},
-	{0.9196, -0.3853, -0.0771, 0.1206},
-	{0.2276, -0.9594, -0.1666, 0.1203},
-	{-0.5413, 0.5376, -0.6465, 0.1204},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{-0.6658, 0.5287, 0.5265, 0.7597},
-	{-0.9968, -0.0371, 0.0702, 0.7596},
-	{-0.2266, 0.8250, -0.5177, 0.0126},
-	{0.2190, 0.9223, -0.3184, 0.0056},
-	{0.3976, 0.8504, -0.3447, 0.0148},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.4981, 0.7049, 0.5049, 0.8898},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{0.0362, 0.9087, -0.4158, 0.7104},
-	{0.8416, 0.2044, 0.4999, 0.8651},
-	{0.7801, -0.2337, 0.5804, 0.8802},
-	{0.8682, 0.1707, 0.4659, 0.8883},
-	{-0.1001, -0.8332, -0.5439, 0.3372},
-	{-0.3082, 0.3755, -0.8741, 0.3123},
-	{-0.7616, 0.0525, -0.6459, 0.3252},
-	{0.8855, 0.0523, -0.4618, 0.7690},
-	{0.9856, 0.1019, -0.1352, 0.7352},
-	{0.7661, -0.0308, -0.6420, 0.7518},
-	{0.5496, 0.5667, 0.6138, 0.9027},
-	{-0.0914, 0.7731, 0.6277, 0.9124},
-	{0.1438, 0.7717, 0.6195, 0.9000},
-	{-0.9191, 0.3542, 0.1726, 0.6919},
-	{-0.7772, -0.3624, 0.5144, 0.6975},
-	{-0.4223, -0.5637, -0.7099, 0.6855},
-	{-0.8181, -0.5603, -0.1292, 0.6242},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{-0.1856, -0.9124, 0.3648, 0.6256},
-	{0.1537, -0.8831, 0.4433, 0.6967},
-	{0.1480, -0.7030, 0.6956, 0.6834},
-	{-0.1736, -0.9293, 0.3260, 0.6959},
-	{-0.5596, 0.0289, -0.8283, 0.6955},
-	{-0.4385, -0.4687, -0.7669, 0.6963},
-	{-0.5175, -0.6904, -0.5056, 0.6970},
-	{0.7116, 0.3457, 0.6117, 0.9373},
-	{0.5574, 0.7519, 0.3522, 0.9177},
-	{0.4899, 0.5127, 0.7051, 0.9310},
-	{0.0865, -0.9926, -0.0848, 0.0196},
-	{-0.2475, -0.9664, -0.0696, 0.0392},
-	{-0.0339, -0.9994, 0.0048, 0.0332},
-	{-0.2788, 0.8163, 0.5058, 0.5370},
-	{-0.2868, 0.3755, 0.8813, 0.5237},
-	{-0.6489, 0.5254, 0.5504, 0.5316},
-	{-0.4100, -0.7756, -0.4798, 0.2085},
-	{-0.1808, -0.8793, -0.4406, 0.2192},
-	{0.4704, -0.7134, -0.5194, 0.2185},
-	{0.5301, 0.3292, 0.7814, 0.7516},
-	{0.5775, 0.2579, 0.7746, 0.7256},
-	{0.1672, -0.8755, 0.4533, 0.7309},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{-0.4067, 0.5746, -0.7103, 0.1585},
-	{0.4280, -0.3914, -0.8146, 0.1527},
-	{-0.5415, 0.3814, -0.7492, 0.9675},
-	{-0.6034, 0.1195, -0.7885, 0.9628},
-	{-0.1878, 0.1793, -0.9657, 0.9756},
-	{0.8212, -0.5707, -0.0026, 0.4528},
-	{0.7503, -0.5895, -0.2990, 0.4708},
-	{0.9319, -0.3568, -0.0655, 0.4478},
-	{0.7623, 0.5945, 0.2558, 0.9222},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.7042, 0.6054, 0.3709, 0.8986},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.4976, -0.0473, 0.8661, 0.7176},
-	{-0.5045, -0.3878, -0.7714, 0.0521},
-	{-0.6040, -0.4385, -0.6655, 0.0421},
-	{-0.1829, -0.6633, -0.7257, 0.0591},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{0.8455, -0.2186, 0.4873, 0.2268},
-	{0.5138, -0.8502, 0.1150, 0.2415},
-	{-0.9306, -0.2509, 0.2666, 0.5856},
-	{-0.7180, 0.3291, 0.6134, 0.5930},
-	{-0.6724, 0.1679, 0.7209, 0.5990},
-	{-0.1361, 0.6037, 0.7855, 0.2656},
-	{-0.1934, -0.4228, 0.8853, 0.2663},
-	{-0.7009, 0.2165, 0.6796, 0.2509},
-	{0.1380, 0.1380, 0.9808, 0.7329},
-	{-0.6418, 0.1967, 0.7412, 0.7189},
-	{-0.7965, 0.3064, 0.5213, 0.7095},
-	{0.8760, -0.4764, 0.0752, 0.1263},
-	{0.4561, -0.8759, 0.1577, 0.1210},
-	{-0.2409, -0.6805, -0.6920, 0.1322},
-	{0.6941, 0.4384, 0.5710, 0.4384},
-	{0.2308, 0.8675, 0.4406, 0.4482},
-	{0.4013, 0.8252, 0.3976, 0.4511},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.6192, 0.1329, 0.7740, 0.3932},
-	{0.0188, 0.3623, 0.9319, 0.3710},
-	{0.6278, 0.1343, 0.7667, 0.0197},
-	{-0.2519, 0.0069, 0.9677, 0.0266},
-	{-0.1392, 0.2158, 0.9665, 0.0137},
-	{-0.5188, 0.7059, -0.4822, 0.9100},
-	{-0.8406, 0.4391, -0.3172, 0.9176},
-	{-0.7281, 0.6054, -0.3215, 0.9026},
-	{-0.6493, -0.7577, -0.0651, 0.6944},
-	{-0.3059, -0.7763, -0.5512, 0.6951},
-	{-0.6851, -0.7041, -0.1867, 0.6942},
-	{-0.3695, 0.7087, -0.6010, 0.9152},
-	{-0.5001, 0.8160, -0.2900, 0.9044},
-	{-0.5758, 0.5612, -0.5946, 0.8956},
-	{-0.4116, 0.6903, -0.5951, 0.2117},
-	{-0.8955, 0.3403, -0.2869, 0.2213},
-	{-0.9135, 0.2882, -0.2873, 0.2315},
-	{-0.9547, -0.0224, 0.2968, 0.4949},
-	{-0.9909, 0.1175, 0.0651, 0.4733},
-	{-0.9463, -0.2772, 0.1661, 0.4722},
-	{-0.9391, 0.3339, -0.0815, 0.5287},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.9501, 0.1422, -0.2777, 0.5330},
-	{-0.5668, -0.8197, 0.0829, 0.6723},
-	{0.1009, -0.6644, 0.7406, 0.6696},
-	{0.0796, -0.8171, 0.5710, 0.6791},
-	{0.1364, 0.9693, 0.2048, 0.8826},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.1856, 0.6649, 0.7235, 0.8903},
-	{0.6959, 0.6155, 0.3699, 0.0861},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.9497, 0.0426, 0.3102, 0.0705},
-	{-0.2788, 0.8163, 0.5058, 0.1080},
-	{0.3731, 0.9187, 0.1296, 0.1040},
-	{0.1985, 0.3629, 0.9104, 0.0912},
-	{-0.7951, -0.5325, 0.2903, 0.6209},
-	{-0.8827, -0.3050, 0.3576, 0.6421},
-	{-0.6136, 0.0291, 0.7891, 0.6105},
-	{-0.4722, -0.8814, -0.0113, 0.6387},
-	{0.1639, -0.9599, 0.2275, 0.6305},
-	{-0.1856, -0.9124, 0.3648, 0.6256},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{0.9774, 0.2034, 0.0577, 0.7917},
-	{0.5546, 0.1550, 0.8176, 0.7904},
-	{-0.7548, 0.1316, -0.6426, 0.9118},
-	{-0.7948, -0.1700, -0.5826, 0.9302},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.8153, -0.1102, 0.5684, 0.3362},
-	{-0.9547, -0.0224, 0.2968, 0.3380},
-	{-0.7808, -0.3922, 0.4863, 0.3336},
-	{0.2665, -0.6820, -0.6811, 0.0759},
-	{0.3497, -0.9030, -0.2498, 0.0574},
-	{0.1647, -0.4521, -0.8766, 0.0646},
-	{-0.3019, 0.5943, -0.7455, 0.8904},
-	{-0.4354, 0.5439, -0.7174, 0.8920},
-	{-0.0129, 0.7536, -0.6572, 0.9041},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.9452, 0.2364, -0.2252, 0.3276},
-	{-0.9494, 0.2941, -0.1098, 0.3528},
-	{0.1543, 0.6393, -0.7533, 0.0336},
-	{-0.2266, 0.8250, -0.5177, 0.0126},
-	{0.5075, 0.7911, -0.3416, 0.0491},
-	{-0.0824, 0.5702, 0.8174, 0.7525},
-	{0.1128, 0.3277, 0.9380, 0.7720},
-	{0.1646, 0.5297, 0.8320, 0.7471},
-	{0.1259, -0.9007, 0.4159, 0.8434},
-	{0.0086, -0.9999, -0.0147, 0.8462},
-	{-0.2778, -0.9466, 0.1638, 0.8600},
-	{-0.0543, 0.4619, -0.8853, 0.5708},
-	{0.3334, 0.3195, -0.8870, 0.5501},
-	{-0.3833, -0.0618, -0.9216, 0.5706},
-	{0.4308, -0.7372, 0.5206, 0.6328},
-	{-0.0225, -0.9628, 0.2692, 0.6275},
-	{-0.1096, -0.6085, 0.7859, 0.6224},
-	{-0.6102, 0.4470, -0.6541, 0.1492},
-	{-0.8406, 0.4391, -0.3172, 0.1118},
-	{-0.0822, 0.4653, -0.8814, 0.1507},
-	{-0.4739, -0.5546, -0.6839, 0.7278},
-	{-0.5861, -0.6739, 0.4498, 0.7268},
-	{-0.2207, -0.7774, -0.5890, 0.7267},
-	{-0.7185, 0.6437, 0.2637, 0.5525},
-	{-0.0843, -0.2271, 0.9702, 0.5514},
-	{0.1351, 0.6363, 0.7595, 0.5533},
-	{-0.3295, 0.1682, 0.9290, 0.2778},
-	{-0.8692, 0.1065, 0.4828, 0.2486},
-	{-0.5087, -0.1668, 0.8447, 0.2735},
-	{0.9429, 0.0382, -0.3309, 0.7047},
-	{0.5939, 0.8045, 0.0003, 0.7051},
-	{0.5459, 0.5601, -0.6232, 0.7066},
-	{-0.6734, -0.0052, 0.7392, 0.2626},
-	{-0.4687, 0.1573, 0.8692, 0.2728},
-	{-0.8336, 0.2729, 0.4803, 0.2466},
-	{-0.4223, 0.8225, -0.3809, 0.1852},
-	{-0.5451, 0.7989, -0.2544, 0.1915},
-	{-0.5559, 0.8207, 0.1320, 0.2637},
-	{0.4280, -0.3914, -0.8146, 0.1527},
-	{0.8749, -0.4637, -0.1399, 0.1613},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{-0.8762, 0.4240, 0.2292, 0.1039},
-	{-0.5863, 0.4679, -0.6613, 0.0962},
-	{-0.8459, 0.5166, -0.1327, 0.1045},
-	{0.3334, 0.3195, -0.8870, 0.5501},
-	{0.9646, -0.2439, -0.1004, 0.5468},
-	{0.1224, -0.6692, -0.7329, 0.5490},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{-0.6722, -0.3669, -0.6431, 0.1173},
-	{0.1214, -0.3144, -0.9415, 0.1111},
-	{-0.6972, -0.5804, -0.4208, 0.2450},
-	{-0.8471, -0.2198, -0.4838, 0.2382},
-	{-0.8199, -0.4252, -0.3834, 0.2419},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.4318, 0.5184, -0.7381, 0.2013},
-	{-0.6115, 0.2355, -0.7554, 0.1951},
-	{-0.2733, 0.5456, 0.7922, 0.3650},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.5988, 0.7541, 0.2698, 0.3632},
-	{-0.8875, 0.1416, -0.4384, 0.9113},
-	{0.0258, -0.0123, -0.9996, 0.8833},
-	{-0.4974, 0.5056, -0.7049, 0.8951},
-	{-0.8208, 0.0943, -0.5634, 0.3567},
-	{-0.4552, -0.1279, -0.8812, 0.3352},
-	{-0.6158, -0.0817, -0.7837, 0.3727},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.3616, -0.3463, -0.8657, 0.8714},
-	{-0.7285, -0.2371, -0.6427, 0.8734},
-	{-0.6356, 0.7386, -0.2248, 0.3748},
-	{-0.6468, 0.6563, -0.3885, 0.3340},
-	{0.1943, 0.9739, 0.1170, 0.3325},
-	{-0.7326, -0.6146, 0.2925, 0.6336},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.5692, -0.7770, 0.2687, 0.6461},
-	{0.0195, 0.9860, 0.1655, 0.1571},
-	{0.2469, 0.9653, -0.0853, 0.1622},
-	{0.3442, 0.9151, 0.2103, 0.1505},
-	{-0.0688, -0.3106, -0.9480, 0.1060},
-	{0.1214, -0.3144, -0.9415, 0.1111},
-	{0.4705, -0.2263, -0.8529, 0.0989},
-	{0.6348, -0.4923, -0.5956, 0.4813},
-	{0.5719, -0.6349, -0.5195, 0.4893},
-	{0.3374, -0.5398, -0.7712, 0.4984},
-	{0.6959, 0.6155, 0.3699, 0.0861},
-	{0.5225, 0.0286, 0.8522, 0.0603},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.0233, 0.3478, -0.9373, 0.9410},
-	{-0.2873, -0.1227, -0.9500, 0.9530},
-	{0.1720, -0.0618, -0.9832, 0.9529},
-	{-0.4354, 0.5439, -0.7174, 0.9030},
-	{-0.2937, -0.9483, 0.1206, 0.9059},
-	{-0.5701, -0.2354, -0.7871, 0.9084},
-	{-0.7999, 0.5886, 0.1169, 0.6565},
-	{-0.8550, 0.4695, 0.2205, 0.6518},
-	{-0.9232, 0.3046, -0.2342, 0.6380},
-	{-0.7864, 0.2552, 0.5625, 0.9158},
-	{-0.7076, -0.5762, 0.4089, 0.8983},
-	{-0.5775, -0.8097, -0.1038, 0.9121},
-	{-0.4674, -0.8704, -0.1549, 0.7755},
-	{-0.3981, -0.9038, 0.1570, 0.7877},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{0.8903, 0.1264, 0.4375, 0.1235},
-	{0.7932, -0.0642, 0.6056, 0.1529},
-	{0.6845, -0.0171, 0.7288, 0.1510},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{-0.9701, 0.2080, -0.1247, 0.5081},
-	{-0.8157, 0.1440, -0.5603, 0.5202},
-	{-0.9391, 0.3339, -0.0815, 0.5287},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.9214, 0.3077, -0.2376, 0.2660},
-	{-0.9039, 0.0524, -0.4245, 0.2582},
-	{-0.7135, -0.3744, -0.5923, 0.2348},
-	{0.8328, 0.5472, 0.0833, 0.6835},
-	{0.7563, 0.2868, 0.5881, 0.6604},
-	{0.8209, 0.5133, 0.2503, 0.7006},
-	{-0.8235, 0.0960, -0.5591, 0.6222},
-	{-0.5767, -0.1303, -0.8065, 0.5979},
-	{-0.7754, 0.1118, -0.6216, 0.6233},
-	{0.0002, 0.5669, -0.8238, 0.2024},
-	{0.6905, 0.6446, -0.3283, 0.2011},
-	{0.1562, 0.5626, -0.8118, 0.1886},
-	{-0.7818, 0.5826, -0.2221, 0.2525},
-	{0.0329, 0.9376, 0.3462, 0.2409},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{-0.8176, 0.4403, 0.3712, 0.3450},
-	{-0.9604, 0.2157, -0.1765, 0.3605},
-	{-0.8153, 0.4576, 0.3547, 0.3612},
-	{0.7841, -0.0627, -0.6175, 0.4709},
-	{0.7123, -0.4172, -0.5644, 0.4712},
-	{0.4486, -0.4073, -0.7955, 0.4864},
-	{-0.3478, 0.0471, -0.9364, 0.2125},
-	{-0.0504, 0.6080, -0.7923, 0.2051},
-	{-0.5321, 0.4244, -0.7326, 0.2189},
-	{0.8773, 0.3281, 0.3502, 0.9037},
-	{0.7794, 0.5625, 0.2760, 0.9063},
-	{0.8867, 0.3875, 0.2523, 0.9158},
-	{-0.5668, -0.8197, 0.0829, 0.6723},
-	{0.3793, -0.3260, 0.8659, 0.6580},
-	{0.1009, -0.6644, 0.7406, 0.6696},
-	{-0.2570, 0.4320, -0.8645, 0.1840},
-	{0.1062, 0.5919, -0.7990, 0.1812},
-	{0.1342, 0.4108, -0.9018, 0.1714},
-	{0.5841, 0.4308, -0.6879, 0.8938},
-	{0.6905, 0.6446, -0.3283, 0.8894},
-	{0.8188, 0.5565, 0.1409, 0.8956},
-	{0.0643, -0.9978, 0.0182, 0.7288},
-	{-0.4510, -0.8506, -0.2702, 0.7095},
-	{-0.8791, -0.2509, -0.4053, 0.7277},
-	{0.4892, -0.8651, 0.1108, 0.7165},
-	{0.6109, -0.2161, 0.7616, 0.7162},
-	{0.7650, -0.5325, 0.3623, 0.7193},
-	{0.5129, 0.6787, 0.5256, 0.2440},
-	{0.1165, 0.8782, 0.4638, 0.2247},
-	{0.8375, 0.2319, 0.4948, 0.2357},
-	{-0.5991, 0.6261, -0.4990, 0.6700},
-	{-0.8896, -0.1610, -0.4274, 0.7163},
-	{-0.8851, -0.3374, -0.3204, 0.6593},
-	{-0.2119, 0.6012, 0.7705, 0.3757},
-	{-0.0565, 0.6602, 0.7489, 0.3896},
-	{-0.1112, 0.9938, 0.0005, 0.3839},
-	{-0.1510, 0.5930, -0.7909, 0.2135},
-	{0.5918, 0.5107, -0.6236, 0.2082},
-	{0.0002, 0.5669, -0.8238, 0.2024},
-	{-0.5655, -0.2409, 0.7888, 0.1219},
-	{-0.6507, 0.6670, -0.3628, 0.1244},
-	{-0.8993, -0.4372, 0.0133, 0.1225},
-	{-0.5415, -0.5234, 0.6579, 0.9402},
-	{-0.6214, -0.6232, 0.4749, 0.9332},
-	{0.1604, -0.8551, 0.4931, 0.9431},
-	{-0.7185, 0.6437, 0.2637, 0.5525},
-	{0.1351, 0.6363, 0.7595, 0.5533},
-	{-0.0443, 0.9647, 0.2595, 0.5604},
-	{0.9497, 0.0426, 0.3102, 0.0705},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{0.9603, -0.2203, 0.1710, 0.0774},
-	{0.1284, 0.7280, 0.6734, 0.9283},
-	{-0.2045, 0.5912, 0.7801, 0.9552},
-	{-0.3258, 0.8092, 0.4890, 0.9444},
-	{0.5903, 0.0384, 0.8063, 0.9688},
-	{0.2955, -0.2901, 0.9102, 0.9737},
-	{0.3103, -0.0983, 0.9456, 0.9758},
-	{0.2308, 0.8675, 0.4406, 0.4482},
-	{0.2488, 0.9584, 0.1399, 0.4649},
-	{0.4013, 0.8252, 0.3976, 0.4511},
-	{0.9899, -0.1241, 0.0681, 0.7931},
-	{-0.1835, -0.7883, -0.5874, 0.7915},
-	{-0.0041, 0.9872, -0.1595, 0.7911},
-	{-0.9947, 0.0555, -0.0863, 0.6448},
-	{-0.9441, 0.1647, -0.2855, 0.6380},
-	{-0.9890, -0.0368, -0.1431, 0.6164},
-	{0.5034, -0.2058, -0.8392, 0.7165},
-	{-0.4098, 0.4486, -0.7943, 0.7163},
-	{0.3756, -0.8692, 0.3218, 0.7124},
-	{-0.4280, -0.6557, 0.6220, 0.1190},
-	{0.1491, -0.9046, 0.3994, 0.1299},
-	{0.3154, -0.2677, 0.9104, 0.1251},
-	{0.3854, 0.8346, -0.3936, 0.7050},
-	{-0.7185, 0.6771, -0.1586, 0.7027},
-	{-0.6153, 0.3282, 0.7167, 0.7035},
-	{0.0461, 0.4791, -0.8765, 0.7683},
-	{-0.3212, 0.4752, -0.8191, 0.7672},
-	{0.5256, 0.8219, -0.2196, 0.7696},
-	{-0.0675, 0.9886, -0.1342, 0.2578},
-	{-0.3539, 0.5375, -0.7654, 0.2505},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.8750, 0.4797, -0.0649, 0.2249},
-	{-0.7014, 0.6824, 0.2057, 0.2439},
-	{-0.5941, 0.6790, 0.4314, 0.2496},
-	{0.3648, 0.9202, -0.1421, 0.2413},
-	{-0.3073, 0.6831, -0.6626, 0.2252},
-	{-0.3868, 0.6864, -0.6158, 0.2339},
-	{0.2232, 0.4001, 0.8889, 0.0364},
-	{0.4732, 0.2068, 0.8563, 0.0373},
-	{0.5224, 0.3334, 0.7848, 0.0359},
-	{-0.2813, -0.1737, 0.9438, 0.2782},
-	{-0.7700, -0.3137, 0.5556, 0.2493},
-	{-0.8827, -0.3050, 0.3576, 0.2434},
-	{-0.0745, 0.3249, 0.9428, 0.3627},
-	{0.2662, 0.3158, 0.9107, 0.3682},
-	{0.5522, 0.1715, 0.8159, 0.3826},
-	{0.2664, 0.8448, 0.4640, 0.7603},
-	{-0.7153, 0.5048, 0.4832, 0.7582},
-	{0.0667, 0.8071, 0.5866, 0.7587},
-	{0.2327, -0.1511, 0.9607, 0.0404},
-	{0.5464, -0.3150, 0.7760, 0.0427},
-	{0.5982, -0.2865, 0.7483, 0.0621},
-	{-0.4233, -0.8903, -0.1679, 0.7130},
-	{-0.4222, -0.8965, 0.1344, 0.6708},
-	{-0.8896, -0.1610, -0.4274, 0.7163},
-	{-0.0306, -0.1763, -0.9839, 0.8822},
-	{-0.6771, 0.3518, -0.6464, 0.8864},
-	{-0.4762, 0.4593, -0.7498, 0.8940},
-	{-0.7292, 0.2842, 0.6225, 0.5065},
-	{-0.8840, 0.3199, 0.3408, 0.4949},
-	{-0.9547, -0.0224, 0.2968, 0.4949},
-	{-0.3622, 0.9306, 0.0536, 0.9174},
-	{-0.6831, 0.7232, -0.1019, 0.9042},
-	{-0.6879, 0.7258, 0.0008, 0.9174},
-	{-0.1063, 0.8440, -0.5258, 0.7250},
-	{-0.4140, -0.2852, -0.8644, 0.7243},
-	{-0.4297, -0.5831, -0.6894, 0.7251},
-	{-0.2892, -0.9558, 0.0532, 0.8311},
-	{-0.7627, 0.6163, 0.1960, 0.8309},
-	{-0.5704, -0.6525, 0.4988, 0.8307},
-	{0.7463, 0.5882, -0.3115, 0.0386},
-	{0.3976, 0.8504, -0.3447, 0.0148},
-	{0.7604, 0.6245, -0.1784, 0.0194},
-	{-0.4917, -0.7379, 0.4623, 0.6825},
-	{-0.1835, -0.7467, -0.6393, 0.6762},
-	{-0.4223, -0.5637, -0.7099, 0.6855},
-	{0.4773, -0.2967, -0.8271, 0.5661},
-	{0.6145, -0.4954, -0.6140, 0.5625},
-	{0.5984, -0.3496, -0.7208, 0.5573},
-	{-0.3698, 0.9243, 0.0950, 0.7016},
-	{-0.3561, 0.8911, -0.2813, 0.7027},
-	{-0.0599, 0.7609, 0.6461, 0.7026},
-	{0.0869, 0.0972, 0.9915, 0.2870},
-	{-0.3295, 0.1682, 0.9290, 0.2778},
-	{-0.5087, -0.1668, 0.8447, 0.2735},
-	{0.1241, 0.1939, -0.9731, 0.4498},
-	{-0.4319, 0.0300, -0.9014, 0.4711},
-	{-0.2888, 0.2125, -0.9335, 0.4667},
-	{0.8725, 0.0053, 0.4886, 0.3295},
-	{0.7742, 0.2596, 0.5773, 0.3530},
-	{0.9452, 0.1044, 0.3093, 0.3522},
-	{0.1145, 0.4833, -0.8679, 0.5649},
-	{0.3376, 0.8670, -0.3665, 0.5816},
-	{0.7622, -0.1359, -0.6329, 0.5584},
-	{0.4280, -0.3914, -0.8146, 0.1652},
-	{0.7304, 0.6044, -0.3182, 0.1686},
-	{0.8749, -0.4637, -0.1399, 0.1542},
-	{0.3981, 0.4950, 0.7723, 0.5888},
-	{0.6165, 0.6181, 0.4877, 0.6189},
-	{-0.1161, 0.5786, 0.8073, 0.6060},
-	{0.9420, -0.1023, -0.3196, 0.1669},
-	{0.9687, 0.2442, 0.0452, 0.1451},
-	{0.7147, 0.5899, -0.3757, 0.1637},
-	{-0.6962, -0.3370, -0.6338, 0.1603},
-	{0.8749, -0.4637, -0.1399, 0.1613},
-	{0.9517, -0.0684, -0.2993, 0.1692},
-	{0.5541, -0.7072, 0.4391, 0.7216},
-	{-0.2447, -0.9353, 0.2556, 0.7197},
-	{-0.0749, -0.9885, -0.1310, 0.7236},
-	{-0.2453, 0.8795, 0.4079, 0.8389},
-	{0.0463, 0.9791, 0.1978, 0.8576},
-	{-0.5942, 0.7714, 0.2277, 0.8624},
-	{0.5853, -0.6279, -0.5130, 0.4162},
-	{0.7843, -0.3281, 0.5266, 0.4173},
-	{0.6407, -0.4697, -0.6073, 0.4288},
-	{0.1166, -0.9931, -0.0119, 0.7174},
-	{-0.1597, -0.5338, -0.8304, 0.7255},
-	{-0.0419, 0.0761, -0.9962, 0.7248},
-	{-0.1047, -0.9945, -0.0065, 0.7721},
-	{-0.5228, -0.8218, -0.2264, 0.7596},
-	{-0.4195, -0.8771, -0.2340, 0.7835},
-	{-0.5290, 0.6452, -0.5513, 0.2410},
-	{-0.5735, 0.6703, -0.4710, 0.2244},
-	{-0.6525, 0.5827, -0.4844, 0.2473},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{0.8400, -0.1295, 0.5269, 0.0541},
-	{0.8759, -0.4768, 0.0735, 0.0733},
-	{-0.1442, -0.0977, 0.9847, 0.7077},
-	{-0.4536, 0.3068, 0.8367, 0.7210},
-	{-0.5006, -0.0006, 0.8657, 0.7044},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{-0.6522, 0.7578, -0.0178, 0.7101},
-	{-0.8096, 0.3167, 0.4943, 0.7119},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{-0.2280, 0.7995, 0.5557, 0.9237},
-	{0.1024, 0.5979, 0.7950, 0.9409},
-	{0.3980, -0.7242, 0.5632, 0.0715},
-	{0.6732, -0.6790, 0.2928, 0.0723},
-	{-0.1938, -0.9653, 0.1749, 0.1023},
-	{0.2508, 0.9386, 0.2368, 0.8786},
-	{0.1364, 0.9693, 0.2048, 0.8826},
-	{0.4848, 0.8746, 0.0042, 0.8689},
-	{0.4054, -0.2254, -0.8859, 0.4474},
-	{0.2700, -0.0139, -0.9627, 0.4478},
-	{0.5120, 0.0219, -0.8587, 0.4363},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{0.4159, 0.3398, -0.8436, 0.9345},
-	{0.2592, 0.0554, -0.9642, 0.9585},
-	{0.0869, 0.0972, 0.9915, 0.4572},
-	{0.1931, 0.2597, 0.9462, 0.4508},
-	{-0.3295, 0.1682, 0.9290, 0.4486},
-	{0.0654, -0.2657, -0.9618, 0.6951},
-	{-0.5044, -0.6146, -0.6066, 0.6951},
-	{0.2034, -0.8014, -0.5624, 0.6956},
-	{-0.8088, 0.2387, -0.5375, 0.2304},
-	{0.0934, 0.7683, -0.6332, 0.2168},
-	{-0.3526, -0.3969, -0.8474, 0.2190},
-	{-0.5862, 0.5134, 0.6267, 0.9694},
-	{-0.2241, 0.5052, 0.8334, 0.9749},
-	{-0.1294, 0.7382, 0.6620, 0.9575},
-	{-0.8846, -0.0062, -0.4664, 0.1242},
-	{-0.7870, -0.1584, -0.5963, 0.1395},
-	{-0.7958, -0.3691, -0.4801, 0.1387},
-	{-0.5316, -0.4272, 0.7314, 0.6718},
-	{-0.6368, -0.4067, 0.6550, 0.6626},
-	{-0.8305, 0.5174, 0.2064, 0.6762},
-	{-0.0563, 0.0902, -0.9943, 0.5603},
-	{0.6262, 0.0104, -0.7796, 0.5733},
-	{0.0378, 0.3086, -0.9504, 0.5612},
-	{-0.0432, 0.5245, -0.8503, 0.9180},
-	{-0.3524, 0.3367, -0.8732, 0.9424},
-	{0.2107, 0.6822, -0.7001, 0.9611},
-	{-0.8955, 0.3403, -0.2869, 0.2213},
-	{-0.4116, 0.6903, -0.5951, 0.2117},
-	{-0.5329, 0.3905, -0.7507, 0.2036},
-	{0.6058, -0.3462, -0.7164, 0.1844},
-	{-0.3804, 0.6299, -0.6771, 0.1878},
-	{0.7166, 0.6620, -0.2198, 0.1856},
-	{-0.6522, 0.7578, -0.0178, 0.7101},
-	{-0.1003, 0.8891, 0.4466, 0.7118},
-	{0.0822, 0.9898, 0.1159, 0.7047},
-	{-0.4536, 0.3068, 0.8367, 0.7210},
-	{-0.5166, 0.1187, 0.8480, 0.7285},
-	{-0.9158, 0.2799, 0.2881, 0.7449},
-	{0.5751, -0.6264, 0.5262, 0.7195},
-	{0.2491, -0.4049, 0.8798, 0.7191},
-	{0.2110, -0.9510, -0.2259, 0.7192},
-	{0.5784, 0.7354, 0.3531, 0.6019},
-	{0.5500, 0.7337, 0.3990, 0.5851},
-	{0.8903, 0.1264, 0.4375, 0.5803},
-	{-0.4223, -0.5637, -0.7099, 0.6950},
-	{-0.3678, -0.5361, -0.7598, 0.6959},
-	{-0.2898, 0.3576, -0.8878, 0.6958},
-	{0.1546, -0.8735, 0.4616, 0.8834},
-	{0.1122, -0.9280, 0.3554, 0.8862},
-	{0.4774, -0.8343, -0.2758, 0.8874},
-	{-0.6613, 0.7378, -0.1354, 0.9443},
-	{-0.8115, 0.4058, -0.4205, 0.9570},
-	{-0.4983, 0.7597, -0.4177, 0.9429},
-	{-0.6125, -0.7885, -0.0558, 0.3739},
-	{-0.2910, -0.6597, -0.6929, 0.3622},
-	{-0.7237, -0.5027, -0.4727, 0.3605},
-	{-0.6733, -0.5739, -0.4662, 0.1405},
-	{-0.2237, -0.8644, -0.4503, 0.1240},
-	{-0.3436, -0.4323, -0.8337, 0.1459},
-	{-0.1392, 0.2158, 0.9665, 0.0137},
-	{-0.4666, 0.4578, 0.7568, 0.0171},
-	{0.2760, 0.9216, 0.2729, 0.0053},
-	{-0.5279, 0.3785, -0.7604, 0.9072},
-	{-0.6525, 0.4572, -0.6043, 0.8933},
-	{-0.6330, 0.3309, -0.6999, 0.8821},
-	{-0.0685, -0.9528, -0.2958, 0.7826},
-	{0.2953, -0.6258, 0.7219, 0.7940},
-	{0.9042, -0.1349, -0.4053, 0.7828},
-	{0.4159, 0.3398, -0.8436, 0.9345},
-	{0.7498, -0.1772, -0.6374, 0.9289},
-	{0.3120, -0.5271, -0.7904, 0.9184},
-	{0.5231, -0.3535, 0.7755, 0.9706},
-	{0.3980, -0.7242, 0.5632, 0.9902},
-	{-0.3514, -0.5799, 0.7350, 0.9994},
-	{0.4815, -0.8623, -0.1567, 0.7968},
-	{0.4361, -0.8901, 0.1326, 0.7678},
-	{0.0187, -0.9425, -0.3336, 0.8099},
-	{-0.7941, 0.1774, 0.5813, 0.2521},
-	{-0.9656, 0.2599, 0.0054, 0.2243},
-	{-0.9334, 0.2796, 0.2248, 0.2303},
-	{0.2833, 0.8682, 0.4075, 0.9167},
-	{0.2162, 0.8363, 0.5038, 0.8964},
-	{0.0651, 0.8213, 0.5667, 0.9234},
-	{-0.8838, -0.0760, 0.4616, 0.8446},
-	{-0.8686, -0.0624, 0.4915, 0.8455},
-	{-0.8731, -0.0663, 0.4830, 0.8331},
-	{-0.8106, -0.2497, -0.5297, 0.8571},
-	{-0.8072, -0.2488, -0.5352, 0.8571},
-	{-0.8078, -0.2490, -0.5343, 0.8467},
-	{0.5038, -0.2667, -0.8216, 0.7906},
-	{0.7906, -0.3466, -0.5049, 0.7928},
-	{0.4812, -0.0765, -0.8733, 0.8120},
-	{0.6305, -0.0874, -0.7713, 0.8022},
-	{0.6916, 0.7202, 0.0548, 0.8090},
-	{0.6162, 0.6719, -0.4108, 0.7980},
-	{0.7925, -0.1961, -0.5775, 0.8151},
-	{0.6305, -0.0874, -0.7713, 0.8022},
-	{0.7906, -0.3466, -0.5049, 0.8170},
-	{-0.8872, -0.0791, 0.4546, 0.8331},
-	{-0.8838, -0.0760, 0.4616, 0.8446},
-	{-0.8731, -0.0663, 0.4830, 0.8331},
-	{-0.8114, -0.2499, -0.5283, 0.8467},
-	{-0.8106, -0.2497, -0.5297, 0.8571},
-	{-0.8078, -0.2490, -0.5343, 0.8467},
-};
-
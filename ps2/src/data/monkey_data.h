@@ -1,6008 +0,0 @@
-int vertex_count_monkey = 3000;
-
-VECTOR vertices_monkey[3000] = {
-	{-0.0472, -8.7432, 5.3556, 0.0055},
-	{2.2951, -8.5023, 5.0645, 0.0094},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{-2.1315, -8.3841, 5.4095, 0.0158},
-	{-2.1040, -8.5914, 4.5043, 0.0040},
-	{-0.0472, -8.7432, 5.3556, 0.0055},
-	{-2.1315, -8.3841, 5.4095, 0.0158},
-	{-2.8873, -8.2719, 4.6880, 0.0113},
-	{-2.1040, -8.5914, 4.5043, 0.0040},
-	{2.6634, -7.8107, 5.4952, 0.0263},
-	{2.8557, -8.3615, 4.3947, 0.0113},
-	{3.0087, -7.3572, 5.1624, 0.0330},
-	{2.6634, -7.8107, 5.4952, 0.0263},
-	{2.2951, -8.5023, 5.0645, 0.0094},
-	{2.8557, -8.3615, 4.3947, 0.0113},
-	{3.0087, -7.3572, 5.1624, 0.0330},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{2.6634, -7.8107, 5.4952, 0.0263},
-	{2.1843, -4.5574, 6.0643, 0.0973},
-	{3.0087, -7.3572, 5.1624, 0.0330},
-	{2.6584, -4.1615, 5.1285, 0.1001},
-	{-2.1842, -4.5575, 6.0643, 0.0973},
-	{-3.0087, -7.3571, 5.1624, 0.0330},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{1.9891, -1.5276, 5.5728, 0.1648},
-	{4.6346, -0.7310, 4.9389, 0.1903},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{1.9891, -1.5276, 5.5728, 0.1648},
-	{-1.9886, -1.5264, 5.5772, 0.1649},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{-4.6346, -0.7310, 4.9393, 0.1904},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-4.6346, -0.7310, 4.9393, 0.1904},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-6.0699, 0.2019, 4.6374, 0.2131},
-	{6.0700, 0.2020, 4.6373, 0.2131},
-	{7.1193, 1.5198, 4.3052, 0.2414},
-	{7.4280, 2.5611, 4.7393, 0.2677},
-	{-7.4281, 2.5610, 4.7392, 0.2678},
-	{-7.1193, 1.5198, 4.3052, 0.2415},
-	{-6.0699, 0.2019, 4.6374, 0.2131},
-	{7.4280, 2.5611, 4.7393, 0.2677},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{-7.4281, 2.5610, 4.7392, 0.2678},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{-7.3742, 3.5594, 5.0909, 0.2930},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{7.3742, 3.5594, 5.0909, 0.2930},
-	{6.9980, 3.9876, 5.3485, 0.3059},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{6.9980, 3.9876, 5.3485, 0.3059},
-	{5.0766, 4.9393, 5.7109, 0.3367},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{-6.9980, 3.9876, 5.3485, 0.3059},
-	{-7.3742, 3.5594, 5.0909, 0.2930},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{5.0766, 4.9393, 5.7109, 0.3367},
-	{2.9824, 6.3896, 6.5299, 0.3663},
-	{-2.9825, 6.3896, 6.5298, 0.3663},
-	{-5.0766, 4.9393, 5.7109, 0.3368},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{2.9824, 6.3896, 6.5299, 0.3663},
-	{2.1973, 6.4512, 6.6665, 0.3688},
-	{2.2324, 6.1523, 7.1543, 0.3566},
-	{2.1973, 6.4512, 6.6665, 0.3688},
-	{1.5120, 6.0392, 6.7377, 0.3622},
-	{2.0684, 5.5439, 7.4207, 0.3429},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{-2.2324, 6.1523, 7.1543, 0.3566},
-	{-1.5654, 5.7430, 7.2081, 0.3500},
-	{-1.5120, 6.0392, 6.7377, 0.3622},
-	{-2.1973, 6.4512, 6.6665, 0.3688},
-	{-2.9825, 6.3896, 6.5298, 0.3663},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{1.5120, 6.0392, 6.7377, 0.3622},
-	{0.4462, 4.1254, 6.6699, 0.3291},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{2.0684, 5.5439, 7.4207, 0.3429},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{0.4462, 4.1254, 6.6699, 0.3291},
-	{0.0000, 3.8957, 6.6313, 0.3252},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{-0.4117, 4.0198, 6.9470, 0.3220},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{0.0000, 3.8957, 6.6313, 0.3252},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{2.0684, 5.5439, 7.4207, 0.3429},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{-5.2219, 3.3861, 6.1382, 0.2917},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{5.2220, 3.3861, 6.1382, 0.2917},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{-5.2219, 3.3861, 6.1382, 0.2917},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{3.9329, 0.2603, 6.1751, 0.2216},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-3.9328, 0.2603, 6.1751, 0.2216},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-0.0472, -8.7432, 5.3556, 0.0055},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{-2.1315, -8.3841, 5.4095, 0.0158},
-	{-0.0472, -8.7432, 5.3556, 0.0055},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{-2.6617, -7.8091, 5.5008, 0.0264},
-	{-2.1315, -8.3841, 5.4095, 0.0158},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-0.2013, -2.9258, 6.7601, 0.1373},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{-0.2013, -2.9258, 6.7601, 0.1373},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{-1.0500, -2.1001, 7.2202, 0.1584},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{0.7508, -1.2337, 6.8265, 0.1785},
-	{0.7252, -1.2223, 7.1892, 0.1721},
-	{1.0468, -2.0838, 7.2441, 0.1585},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-0.8148, -1.2665, 7.1474, 0.1717},
-	{-0.7059, -1.2214, 6.8112, 0.1790},
-	{-0.8148, -1.2665, 7.1474, 0.1717},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-0.0139, -1.5027, 6.8865, 0.1762},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{1.0468, -2.0838, 7.2441, 0.1585},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{-0.2013, -2.9258, 6.7601, 0.1373},
-	{-1.0500, -2.1001, 7.2202, 0.1584},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{-0.2013, -2.9258, 6.7601, 0.1373},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{1.0468, -2.0838, 7.2441, 0.1585},
-	{0.7252, -1.2223, 7.1892, 0.1721},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{0.7252, -1.2223, 7.1892, 0.1721},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{1.0156, -1.8216, 7.3335, 0.1637},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-0.8148, -1.2665, 7.1474, 0.1717},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{1.0156, -1.8216, 7.3335, 0.1637},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{1.6879, -2.5176, 6.0902, 0.1418},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{-1.4034, -1.6755, 6.5195, 0.1667},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-0.7059, -1.2214, 6.8112, 0.1790},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{2.1843, -4.5574, 6.0643, 0.0973},
-	{1.6879, -2.5176, 6.0902, 0.1418},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-2.1842, -4.5575, 6.0643, 0.0973},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{1.6879, -2.5176, 6.0902, 0.1418},
-	{2.1843, -4.5574, 6.0643, 0.0973},
-	{2.6584, -4.1615, 5.1285, 0.1001},
-	{2.6584, -4.1615, 5.1285, 0.1001},
-	{1.9123, -1.8981, 4.8487, 0.1517},
-	{1.6879, -2.5176, 6.0902, 0.1418},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-1.9123, -1.8981, 4.8487, 0.1518},
-	{-2.6584, -4.1615, 5.1285, 0.1001},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{1.9123, -1.8981, 4.8487, 0.1517},
-	{1.9891, -1.5276, 5.5728, 0.1648},
-	{1.9891, -1.5276, 5.5728, 0.1648},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{-1.4034, -1.6755, 6.5195, 0.1667},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{-1.9886, -1.5264, 5.5772, 0.1649},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{0.2826, -7.6832, 5.8123, 0.0361},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{0.2826, -7.6832, 5.8123, 0.0361},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{-0.7881, -7.1689, 5.8556, 0.0421},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{0.7879, -6.9631, 5.9705, 0.0443},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{-0.7052, -6.9428, 6.0213, 0.0455},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{0.7879, -6.9631, 5.9705, 0.0443},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{0.7879, -6.9631, 5.9705, 0.0443},
-	{-0.7052, -6.9428, 6.0213, 0.0455},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{-0.4866, -7.5857, 5.8009, 0.0375},
-	{0.2826, -7.6832, 5.8123, 0.0361},
-	{-0.7881, -7.1689, 5.8556, 0.0421},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{-0.7052, -6.9428, 6.0213, 0.0455},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{3.9329, 0.2603, 6.1751, 0.2216},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-3.9328, 0.2603, 6.1751, 0.2216},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{-3.9328, 0.2603, 6.1751, 0.2216},
-	{5.2220, 3.3861, 6.1382, 0.2917},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{5.2220, 3.3861, 6.1382, 0.2917},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{-3.7809, 3.6150, 6.8159, 0.2986},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{-1.1099, 3.1741, 7.0472, 0.2926},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{2.5790, 3.5571, 6.8803, 0.2982},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{2.2628, 3.3780, 6.8397, 0.2939},
-	{2.5790, 3.5571, 6.8803, 0.2982},
-	{3.7809, 3.6150, 6.8159, 0.2986},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{2.5790, 3.5571, 6.8803, 0.2982},
-	{-3.7809, 3.6150, 6.8159, 0.2986},
-	{-3.6427, 3.4450, 6.7732, 0.2951},
-	{-2.5790, 3.5571, 6.8803, 0.2982},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{4.2539, 3.2695, 6.4336, 0.2889},
-	{4.6758, 3.0234, 6.1875, 0.2830},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-3.6427, 3.4450, 6.7732, 0.2951},
-	{-3.7809, 3.6150, 6.8159, 0.2986},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{4.6758, 3.0234, 6.1875, 0.2830},
-	{4.8867, 2.7773, 6.0820, 0.2778},
-	{4.8867, 2.7773, 6.0820, 0.2778},
-	{5.0068, 2.3606, 5.9847, 0.2691},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{-4.8867, 2.7773, 6.0820, 0.2778},
-	{-4.6758, 3.0234, 6.1875, 0.2830},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-5.0068, 2.3606, 5.9847, 0.2691},
-	{-4.8867, 2.7773, 6.0820, 0.2778},
-	{5.0068, 2.3606, 5.9847, 0.2691},
-	{4.8340, 1.8721, 6.0820, 0.2584},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{-4.8340, 1.8721, 6.0820, 0.2584},
-	{-5.0068, 2.3606, 5.9847, 0.2691},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{-4.3462, 1.2232, 6.2393, 0.2453},
-	{-4.8340, 1.8721, 6.0820, 0.2584},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{4.3461, 1.2232, 6.2393, 0.2453},
-	{3.7617, 0.9141, 6.4336, 0.2374},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{3.7617, 0.9141, 6.4336, 0.2374},
-	{3.0744, 0.7911, 6.5454, 0.2366},
-	{-3.7617, 0.9141, 6.4336, 0.2374},
-	{-4.3462, 1.2232, 6.2393, 0.2453},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{3.0744, 0.7911, 6.5454, 0.2366},
-	{2.2852, 1.1338, 6.7764, 0.2421},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{2.2852, 1.1338, 6.7764, 0.2421},
-	{1.9230, 1.3930, 6.7808, 0.2488},
-	{-1.9230, 1.3930, 6.7808, 0.2488},
-	{-2.2852, 1.1338, 6.7764, 0.2421},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{1.9336, 2.9531, 6.8203, 0.2846},
-	{2.2628, 3.3780, 6.8397, 0.2939},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-1.9336, 2.9531, 6.8203, 0.2847},
-	{-1.8134, 2.5970, 6.8324, 0.2766},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{-2.2628, 3.3780, 6.8397, 0.2939},
-	{-1.9336, 2.9531, 6.8203, 0.2847},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{1.9230, 1.3930, 6.7808, 0.2488},
-	{1.9230, 1.3930, 6.7808, 0.2488},
-	{1.8134, 2.5969, 6.8324, 0.2766},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{-1.9230, 1.3930, 6.7808, 0.2488},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-1.8134, 2.5970, 6.8324, 0.2766},
-	{-1.9230, 1.3930, 6.7808, 0.2488},
-	{0.4451, 4.0472, 5.5837, 0.5513},
-	{-0.2101, 3.9305, 5.5737, 0.5385},
-	{0.0000, 3.8957, 6.6313, 0.5424},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{1.0864, 4.3723, 5.4751, 0.5687},
-	{0.4451, 4.0472, 5.5837, 0.5513},
-	{-0.2101, 3.9305, 5.5737, 0.5385},
-	{-1.0864, 4.3723, 5.4751, 0.5161},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-0.2101, 3.9305, 5.5737, 0.5385},
-	{-0.4117, 4.0198, 6.9470, 0.5312},
-	{0.0000, 3.8957, 6.6313, 0.5424},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{2.2351, 5.9817, 5.6472, 0.6114},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{2.2351, 5.9817, 5.6472, 0.6114},
-	{1.0864, 4.3723, 5.4751, 0.5687},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-1.5120, 6.0392, 6.7377, 0.4820},
-	{-0.4117, 4.0198, 6.9470, 0.5312},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{1.5120, 6.0392, 6.7377, 0.6028},
-	{2.1973, 6.4512, 6.6665, 0.6203},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{2.1973, 6.4512, 6.6665, 0.6203},
-	{2.9824, 6.3896, 6.5299, 0.6351},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{-2.9825, 6.3896, 6.5298, 0.4497},
-	{-2.1973, 6.4512, 6.6665, 0.4645},
-	{-1.5120, 6.0392, 6.7377, 0.4820},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{2.9824, 6.3896, 6.5299, 0.6351},
-	{5.0766, 4.9393, 5.7109, 0.6627},
-	{5.0766, 4.9393, 5.7109, 0.6627},
-	{4.1231, 4.9809, 5.0182, 0.6367},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{-4.1231, 4.9809, 5.0182, 0.4481},
-	{-5.0766, 4.9393, 5.7109, 0.4221},
-	{5.0766, 4.9393, 5.7109, 0.6627},
-	{4.4490, 4.6856, 4.2743, 0.6347},
-	{4.1231, 4.9809, 5.0182, 0.6367},
-	{7.3742, 3.5594, 5.0909, 0.7020},
-	{6.7199, 3.6192, 3.4692, 0.6691},
-	{6.9980, 3.9876, 5.3485, 0.6956},
-	{-6.9980, 3.9876, 5.3485, 0.3892},
-	{-6.7199, 3.6193, 3.4692, 0.4080},
-	{-7.3742, 3.5594, 5.0909, 0.3829},
-	{7.1193, 1.5198, 4.3052, 0.7312},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{7.1367, 2.6104, 3.6255, 0.6981},
-	{7.4280, 2.5611, 4.7393, 0.7070},
-	{7.1367, 2.6104, 3.6255, 0.6880},
-	{6.7199, 3.6192, 3.4692, 0.6691},
-	{-7.1367, 2.6104, 3.6255, 0.2620},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-7.1193, 1.5198, 4.3052, 0.2264},
-	{-7.4281, 2.5610, 4.7392, 0.3778},
-	{-7.3742, 3.5594, 5.0909, 0.3829},
-	{-6.7199, 3.6193, 3.4692, 0.4080},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{7.1193, 1.5198, 4.3052, 0.7312},
-	{-6.0699, 0.2019, 4.6374, 0.1768},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-7.1193, 1.5198, 4.3052, 0.2264},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{5.6823, 0.0730, 3.4040, 0.7922},
-	{6.0700, 0.2020, 4.6373, 0.7809},
-	{-4.6346, -0.7310, 4.9393, 0.1195},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{0.7364, -4.1217, 2.4572, 0.8411},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{0.0000, -4.1477, 2.2738, 0.8429},
-	{0.7364, -4.1217, 2.4572, 0.8411},
-	{1.4780, -3.7031, 2.3106, 0.8530},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-1.4780, -3.7031, 2.3106, 0.8530},
-	{-0.7364, -4.1217, 2.4572, 0.8411},
-	{-0.7364, -4.1217, 2.4572, 0.8411},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{0.0482, -7.3821, 3.3093, 0.7668},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{2.1564, -8.1722, 3.8697, 0.7483},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{2.1564, -8.1722, 3.8697, 0.7483},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{2.8557, -8.3615, 4.3947, 0.7402},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{2.1564, -8.1722, 3.8697, 0.7483},
-	{2.1564, -8.1722, 3.8697, 0.7483},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{2.8557, -8.3615, 4.3947, 0.7402},
-	{-2.1040, -8.5914, 4.5043, 0.7340},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{2.8557, -8.3615, 4.3947, 0.7402},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.5597, -7.4674, 3.6497, 0.7623},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.8873, -8.2719, 4.6880, 0.7365},
-	{-3.0087, -7.3571, 5.1624, 0.7515},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{2.1993, -2.8066, 4.1799, 0.8601},
-	{2.6584, -4.1615, 5.1285, 0.8259},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.1632, -4.2922, 3.6471, 0.8308},
-	{-2.5597, -7.4674, 3.6497, 0.7623},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-3.0087, -7.3571, 5.1624, 0.7515},
-	{-2.6584, -4.1615, 5.1285, 0.8259},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{-2.5597, -7.4674, 3.6497, 0.7623},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{1.8857, -3.1812, 2.7216, 0.8543},
-	{2.0412, -3.5501, 3.5400, 0.8484},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-2.1632, -4.2922, 3.6471, 0.8308},
-	{-2.0473, -3.2041, 3.5459, 0.8564},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-1.8857, -3.1811, 2.7216, 0.8543},
-	{-1.4780, -3.7031, 2.3106, 0.8530},
-	{-2.1993, -2.8066, 4.1799, 0.8601},
-	{-2.0473, -3.2041, 3.5459, 0.8564},
-	{-2.1632, -4.2922, 3.6471, 0.8308},
-	{-2.1993, -2.8066, 4.1799, 0.0224},
-	{-1.9123, -1.8981, 4.8487, 0.0389},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{2.0412, -3.5501, 3.5400, 0.9395},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{2.1993, -2.8066, 4.1799, 0.9369},
-	{-2.1993, -2.8066, 4.1799, 0.0224},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{-2.0473, -3.2041, 3.5459, 0.0201},
-	{-2.1993, -2.8066, 4.1799, 0.8601},
-	{-2.6584, -4.1615, 5.1285, 0.8259},
-	{-1.9123, -1.8981, 4.8487, 0.8634},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{1.9891, -1.5276, 5.5728, 0.9120},
-	{1.9123, -1.8981, 4.8487, 0.9199},
-	{1.9123, -1.8981, 4.8487, 0.9199},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{-2.0737, -1.6658, 4.4792, 0.0490},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{-1.9123, -1.8981, 4.8487, 0.0389},
-	{-1.9123, -1.8981, 4.8487, 0.0389},
-	{-1.9886, -1.5264, 5.5772, 0.0466},
-	{-2.0737, -1.6658, 4.4792, 0.0490},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{-1.9886, -1.5264, 5.5772, 0.0466},
-	{-4.6346, -0.7310, 4.9393, 0.1195},
-	{0.0000, -0.5273, -6.4160, 0.4848},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{1.5161, -1.4810, -5.2734, 0.5121},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{0.0000, -0.5273, -6.4160, 0.4848},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{0.0000, -0.5273, -6.4160, 0.4848},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{1.5161, -1.4810, -5.2734, 0.5121},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{1.5161, -1.4810, -5.2734, 0.5121},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{1.3053, -3.1154, -2.2884, 0.5150},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-1.5161, -1.4810, -5.2734, 0.4588},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{1.3053, -3.1154, -2.2884, 0.5150},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{1.4780, -3.7031, 2.3106, 0.5342},
-	{0.7364, -4.1217, 2.4572, 0.5132},
-	{0.7364, -4.1217, 2.4572, 0.5132},
-	{0.0000, -4.1477, 2.2738, 0.4910},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{-0.7364, -4.1217, 2.4572, 0.4687},
-	{-1.4780, -3.7031, 2.3106, 0.4476},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-1.3053, -3.1154, -2.2884, 0.4597},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{0.0000, -4.1477, 2.2738, 0.4910},
-	{-0.7364, -4.1217, 2.4572, 0.4687},
-	{-1.8857, -3.1811, 2.7216, 0.0216},
-	{-2.0473, -3.2041, 3.5459, 0.0201},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{5.6823, 0.0730, 3.4040, 0.7922},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{7.4242, 2.2272, 0.5217, 0.6963},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{-6.2762, -0.3447, 0.5413, 0.1843},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-7.4203, 2.2210, 0.5499, 0.2637},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{0.0000, 4.6626, -6.9521, 0.4832},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{0.0000, 4.6626, -6.9521, 0.4832},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{0.0000, 7.7058, 2.3752, 0.4819},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{2.0391, 8.2441, 0.8438, 0.5164},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{-3.8385, 8.0020, 0.1289, 0.4194},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{0.0000, 7.7058, 2.3752, 0.4819},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{3.8385, 8.0020, 0.1289, 0.5445},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{2.0435, 7.5981, -4.0957, 0.5118},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{-2.0391, 8.2793, -2.4258, 0.4518},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-3.8385, 8.0020, 0.1289, 0.4194},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{2.0435, 7.5981, -4.0957, 0.5118},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{0.0000, 4.6626, -6.9521, 0.4832},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{-2.0566, 6.2227, -5.5898, 0.4534},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{0.0000, 4.6626, -6.9521, 0.4832},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{6.7199, 3.6192, 3.4692, 0.6657},
-	{-6.7199, 3.6193, 3.4692, 0.2962},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{-6.9994, 4.8230, 0.8152, 0.3295},
-	{-7.0590, 5.2197, -0.5052, 0.3425},
-	{-6.9994, 4.8230, 0.8152, 0.3295},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{6.5255, 5.9700, -0.7772, 0.5997},
-	{6.5255, 5.9700, -0.7772, 0.5997},
-	{7.0763, 5.0693, 0.2577, 0.6274},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{6.6533, 4.8316, -3.4673, 0.5994},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-7.0590, 5.2197, -0.5052, 0.3425},
-	{-6.5250, 5.9706, -0.7771, 0.3636},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{6.6533, 4.8316, -3.4673, 0.5994},
-	{7.1495, 2.4879, -3.4790, 0.6264},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{6.6533, 4.8316, -3.4673, 0.5994},
-	{-6.5884, 4.9739, -3.4455, 0.3672},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{-6.1933, 4.3682, -4.2001, 0.3742},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{5.7812, 2.9059, -4.7677, 0.5899},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-6.1933, 4.3682, -4.2001, 0.3742},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-6.8291, 2.5562, -3.9739, 0.3421},
-	{-6.1933, 4.3682, -4.2001, 0.3742},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{3.8385, 8.0020, 0.1289, 0.5445},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{6.5255, 5.9700, -0.7772, 0.5997},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-3.8385, 8.0020, 0.1289, 0.4194},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-6.5250, 5.9706, -0.7771, 0.3636},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{3.8595, 5.0537, 3.7628, 0.5790},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-3.8595, 5.0537, 3.7628, 0.3845},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{4.4490, 4.6856, 4.2743, 0.5985},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{3.8595, 5.0537, 3.7628, 0.5790},
-	{-4.4490, 4.6856, 4.2743, 0.4501},
-	{-6.7199, 3.6193, 3.4692, 0.4080},
-	{-6.9980, 3.9876, 5.3485, 0.3892},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{2.3688, 4.7726, 4.7529, 0.5426},
-	{3.8595, 5.0537, 3.7628, 0.5790},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-3.8595, 5.0537, 3.7628, 0.3845},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{0.0000, 7.7058, 2.3752, 0.4819},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{1.0864, 4.3723, 5.4751, 0.5687},
-	{2.2351, 5.9817, 5.6472, 0.6114},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{2.2351, 5.9817, 5.6472, 0.6114},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{4.1231, 4.9809, 5.0182, 0.6367},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{-2.2351, 5.9817, 5.6472, 0.4734},
-	{-1.0864, 4.3723, 5.4751, 0.5161},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-4.1231, 4.9809, 5.0182, 0.4481},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{4.1231, 4.9809, 5.0182, 0.6367},
-	{4.4490, 4.6856, 4.2743, 0.6347},
-	{2.3688, 4.7726, 4.7529, 0.5426},
-	{4.4490, 4.6856, 4.2743, 0.5985},
-	{3.8595, 5.0537, 3.7628, 0.5790},
-	{2.3688, 4.7726, 4.7529, 0.5426},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{1.0864, 4.3723, 5.4751, 0.5057},
-	{-4.4490, 4.6856, 4.2743, 0.4501},
-	{-4.1231, 4.9809, 5.0182, 0.4481},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-2.3688, 4.7726, 4.7529, 0.4887},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-1.0864, 4.3723, 5.4751, 0.5161},
-	{-1.0864, 4.3723, 5.4751, 0.4580},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{-2.3688, 4.7726, 4.7529, 0.4211},
-	{-0.2101, 3.9305, 5.5737, 0.5385},
-	{0.4451, 4.0472, 5.5837, 0.5513},
-	{1.0864, 4.3723, 5.4751, 0.5687},
-	{-0.2101, 3.9305, 5.5737, 0.4815},
-	{1.0864, 4.3723, 5.4751, 0.5057},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{7.1367, 2.6104, 3.6255, 0.6981},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{7.4242, 2.2272, 0.5217, 0.6963},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-7.4203, 2.2210, 0.5499, 0.2637},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-6.7199, 3.6193, 3.4692, 0.2962},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{7.4242, 2.2272, 0.5217, 0.6963},
-	{7.4242, 2.2272, 0.5217, 0.6963},
-	{7.5438, 2.7818, -1.4600, 0.6704},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{-6.9994, 4.8230, 0.8152, 0.3295},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-7.5422, 2.7779, -1.6337, 0.2995},
-	{-7.4203, 2.2210, 0.5499, 0.2637},
-	{7.5438, 2.7818, -1.4600, 0.6704},
-	{7.4561, 3.0887, -1.8429, 0.6567},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-7.4566, 3.0887, -2.0038, 0.3087},
-	{-7.5422, 2.7779, -1.6337, 0.2995},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-6.9994, 4.8230, 0.8152, 0.3295},
-	{-7.0590, 5.2197, -0.5052, 0.3425},
-	{7.2952, 3.0841, -2.7419, 0.6417},
-	{7.1495, 2.4879, -3.4790, 0.6264},
-	{6.6533, 4.8316, -3.4673, 0.5994},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{7.0763, 5.0693, 0.2577, 0.6274},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{7.4561, 3.0887, -1.8429, 0.6567},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-7.0590, 5.2197, -0.5052, 0.3425},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-6.5884, 4.9739, -3.4455, 0.3672},
-	{-6.8291, 2.5562, -3.9739, 0.3421},
-	{-7.2963, 3.0842, -2.9029, 0.3247},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-7.2963, 3.0842, -2.9029, 0.3247},
-	{-7.4566, 3.0887, -2.0038, 0.3087},
-	{3.6928, -1.8141, 0.4405, 0.5836},
-	{1.4780, -3.7031, 2.3106, 0.5342},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-4.4509, -1.2764, -1.7640, 0.3733},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-1.4780, -3.7031, 2.3106, 0.4476},
-	{-3.7427, -1.7822, 0.3401, 0.3925},
-	{3.6928, -1.8141, 0.4405, 0.5836},
-	{3.9615, -1.5679, -1.9047, 0.5855},
-	{4.7750, -1.2291, -1.4513, 0.6077},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-6.2762, -0.3447, 0.5413, 0.1843},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{2.8420, -1.8123, 3.2856, 0.8920},
-	{3.6928, -1.8141, 0.4405, 0.8617},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{-2.8420, -1.8123, 3.2856, 0.0673},
-	{2.8420, -1.8123, 3.2856, 0.8920},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{1.8857, -3.1812, 2.7216, 0.9384},
-	{-1.8857, -3.1811, 2.7216, 0.0216},
-	{-2.8420, -1.8123, 3.2856, 0.0673},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{-1.8857, -3.1811, 2.7216, 0.0216},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{-1.4780, -3.7031, 2.3106, 0.0055},
-	{-1.8857, -3.1811, 2.7216, 0.0216},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{-2.8420, -1.8123, 3.2856, 0.0673},
-	{5.7812, 2.9059, -4.7677, 0.5899},
-	{7.1495, 2.4879, -3.4790, 0.6264},
-	{6.8356, 1.0826, -3.5528, 0.6201},
-	{-4.8576, 0.2578, -4.2920, 0.3819},
-	{-6.3264, -0.1566, -3.4295, 0.3532},
-	{-6.8361, 1.0625, -3.7179, 0.3568},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{5.7812, 2.9059, -4.7677, 0.5899},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{4.9054, 0.2620, -4.2670, 0.5880},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-4.8576, 0.2578, -4.2920, 0.3819},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{5.7015, -0.7809, -2.4765, 0.6193},
-	{5.6002, -0.9717, -1.5503, 0.6302},
-	{4.7750, -1.2291, -1.4513, 0.6077},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{4.7750, -1.2291, -1.4513, 0.6077},
-	{3.9615, -1.5679, -1.9047, 0.5855},
-	{-4.4509, -1.2764, -1.7640, 0.3733},
-	{-5.6347, -0.9513, -1.6444, 0.3444},
-	{-5.7513, -0.7863, -2.6354, 0.3527},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-5.7513, -0.7863, -2.6354, 0.3527},
-	{-6.3264, -0.1566, -3.4295, 0.3532},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{4.9054, 0.2620, -4.2670, 0.5880},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{3.9615, -1.5679, -1.9047, 0.5855},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-4.8576, 0.2578, -4.2920, 0.3819},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{11.2017, 1.6436, -3.7222, 0.4929},
-	{10.7112, 0.9042, -3.7085, 0.4903},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-10.7112, 0.9042, -3.8693, 0.7862},
-	{-11.2017, 1.6436, -3.8830, 0.7821},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-11.2017, 1.6436, -3.8830, 0.7821},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{10.0755, 0.3012, -3.3939, 0.4871},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-10.0755, 0.3012, -3.5547, 0.7919},
-	{-10.7112, 0.9042, -3.8693, 0.7862},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-10.4150, -0.1538, -3.6940, 0.7914},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{11.2017, 1.6436, -3.7222, 0.4929},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-11.2017, 1.6436, -3.8830, 0.7821},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{-11.2017, 1.6436, -3.8830, 0.7821},
-	{-10.7112, 0.9042, -3.8693, 0.7862},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{7.2883, 1.4834, -2.2849, 0.4443},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{6.2047, -0.4444, 0.2917, 0.3692},
-	{5.6002, -0.9717, -1.5503, 0.4268},
-	{6.1325, -0.6509, -1.2654, 0.4142},
-	{6.1325, -0.6509, -1.2654, 0.4142},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{6.4795, 0.0107, -1.0732, 0.3956},
-	{-6.4804, 0.0092, -1.2454, 0.8645},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{-6.1360, -0.6480, -1.4298, 0.8858},
-	{-5.6347, -0.9513, -1.6444, 0.1630},
-	{-6.2762, -0.3447, 0.5413, 0.1843},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{-6.1360, -0.6480, -1.4298, 0.1822},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{-6.4804, 0.0092, -1.2454, 0.2098},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{-6.1360, -0.6480, -1.4298, 0.8858},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{7.5438, 2.7818, -1.4600, 0.6704},
-	{7.4242, 2.2272, 0.5217, 0.6963},
-	{-7.4203, 2.2210, 0.5499, 0.2637},
-	{-7.5422, 2.7779, -1.6337, 0.2995},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{7.1881, -0.1456, -2.1278, 0.4437},
-	{-7.1881, -0.1456, -2.2885, 0.8282},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{-7.1881, -0.1456, -2.2885, 0.8282},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{-6.9793, 0.8609, -2.5889, 0.8101},
-	{7.2883, 1.4834, -2.2849, 0.4443},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-7.2877, 1.4824, -2.4455, 0.7953},
-	{7.6124, 2.6663, -1.7965, 0.6668},
-	{7.4561, 3.0887, -1.8429, 0.6567},
-	{7.5438, 2.7818, -1.4600, 0.6704},
-	{-7.5422, 2.7779, -1.6337, 0.7282},
-	{-7.4566, 3.0887, -2.0038, 0.7262},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{6.4795, 0.0107, -1.0732, 0.3956},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{-6.4804, 0.0092, -1.2454, 0.8645},
-	{-7.5422, 2.7779, -1.6337, 0.7282},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{6.4795, 0.0107, -1.0732, 0.3956},
-	{-6.4804, 0.0092, -1.2454, 0.8645},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{7.2883, 1.4834, -2.2849, 0.4443},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{-7.2877, 1.4824, -2.4455, 0.7953},
-	{7.2883, 1.4834, -2.2849, 0.4443},
-	{6.9793, 0.8609, -2.4281, 0.4394},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{-6.9793, 0.8609, -2.5889, 0.8101},
-	{-7.2877, 1.4824, -2.4455, 0.7953},
-	{6.9793, 0.8609, -2.4281, 0.4394},
-	{7.6900, 0.3986, -2.8523, 0.4541},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{-7.6900, 0.3986, -3.0131, 0.8097},
-	{-6.9793, 0.8609, -2.5889, 0.8101},
-	{7.6900, 0.3986, -2.8523, 0.4541},
-	{6.9793, 0.8609, -2.4281, 0.4394},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{7.5071, -0.0524, -2.7346, 0.4533},
-	{7.6900, 0.3986, -2.8523, 0.4541},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{7.1881, -0.1456, -2.1278, 0.4437},
-	{7.5071, -0.0524, -2.7346, 0.4533},
-	{-7.5071, -0.0524, -2.8954, 0.8163},
-	{-7.1881, -0.1456, -2.2885, 0.8282},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{7.5071, -0.0524, -2.7346, 0.4533},
-	{7.1881, -0.1456, -2.1278, 0.4437},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{9.5401, 2.9996, -3.6593, 0.4879},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{9.5401, 2.9996, -3.6593, 0.4879},
-	{-9.5403, 2.9996, -3.8202, 0.7763},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{11.0823, 1.9239, -4.2482, 0.4911},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{10.7112, 0.9042, -3.7085, 0.4903},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{-10.7112, 0.9042, -3.8693, 0.7862},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{10.0755, 0.3012, -3.3939, 0.4871},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{10.0755, 0.3012, -3.3939, 0.4871},
-	{10.7112, 0.9042, -3.7085, 0.4903},
-	{-10.0755, 0.3012, -3.5547, 0.7919},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{8.2181, 1.6967, -2.9907, 0.4674},
-	{9.5401, 2.9996, -3.6593, 0.4879},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{8.2181, 1.6967, -2.9907, 0.4674},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{8.2181, 1.6967, -2.9907, 0.4674},
-	{-8.2181, 1.6967, -3.1514, 0.7869},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{-7.6900, 0.3986, -3.0131, 0.8097},
-	{-7.5071, -0.0524, -2.8954, 0.8163},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{-11.0824, 1.9239, -4.4090, 0.7815},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{11.0823, 1.9239, -4.2482, 0.4911},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-11.0824, 1.9239, -4.4090, 0.7815},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{-9.5403, 2.9996, -3.8202, 0.7763},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{7.4412, -1.0961, -2.4486, 0.4784},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{7.4412, -1.0961, -2.4486, 0.4784},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{-7.4390, -1.0964, -2.6084, 0.8361},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{10.5117, -0.1758, -4.0078, 0.4946},
-	{11.4521, 0.6108, -4.2231, 0.4956},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{10.4150, -0.1538, -3.5332, 0.4914},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{10.5117, -0.1758, -4.0078, 0.4946},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{11.4749, 1.0272, -4.5981, 0.4972},
-	{11.4521, 0.6108, -4.2231, 0.4956},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-10.4150, -0.1538, -3.6940, 0.7914},
-	{-10.5117, -0.1758, -4.1686, 0.7893},
-	{-10.4150, -0.1538, -3.6940, 0.7914},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-11.4521, 0.6108, -4.3839, 0.7839},
-	{-11.4749, 1.0272, -4.7589, 0.7820},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{12.0285, 2.7064, -4.2562, 0.4968},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{11.4521, 0.6108, -4.2231, 0.4956},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{11.4521, 0.6108, -4.2231, 0.4956},
-	{11.4749, 1.0272, -4.5981, 0.4972},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{11.9380, 1.9668, -4.6445, 0.4973},
-	{12.0285, 2.7064, -4.2562, 0.4968},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-11.9380, 1.9668, -4.8053, 0.7794},
-	{-11.4749, 1.0272, -4.7589, 0.7820},
-	{-11.4521, 0.6108, -4.3839, 0.7839},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-12.0285, 2.7064, -4.4169, 0.7782},
-	{11.0654, 4.1572, -4.2363, 0.4987},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{11.7627, 3.2344, -4.6025, 0.4981},
-	{11.1585, 3.6057, -4.6498, 0.4993},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-12.0285, 2.7064, -4.4169, 0.7782},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-11.0654, 4.1572, -4.3971, 0.7742},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-11.0654, 4.1572, -4.3971, 0.7742},
-	{-11.1585, 3.6057, -4.8106, 0.7753},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{11.0654, 4.1572, -4.2363, 0.4987},
-	{11.1585, 3.6057, -4.6498, 0.4993},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{-11.1585, 3.6057, -4.8106, 0.7753},
-	{-11.0654, 4.1572, -4.3971, 0.7742},
-	{-10.1953, 4.2539, -4.1334, 0.7714},
-	{-11.0654, 4.1572, -4.3971, 0.7742},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{-10.1953, 4.2539, -4.1334, 0.7714},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{7.2952, 3.0841, -2.7419, 0.5334},
-	{7.4561, 3.0887, -1.8429, 0.4907},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-7.4566, 3.0887, -2.0038, 0.7262},
-	{-7.2963, 3.0842, -2.9029, 0.7168},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{9.3296, 1.6260, -4.3022, 0.5097},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{9.3296, 1.6260, -4.3022, 0.5097},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{-7.5717, 1.2288, -3.5946, 0.7776},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{-9.3296, 1.6260, -4.4630, 0.7773},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{9.3296, 1.6260, -4.3022, 0.5097},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{11.1585, 3.6057, -4.6498, 0.4993},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{-11.4749, 1.0272, -4.7589, 0.7820},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-11.1585, 3.6057, -4.8106, 0.7753},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{11.1585, 3.6057, -4.6498, 0.4993},
-	{11.7627, 3.2344, -4.6025, 0.4981},
-	{11.9380, 1.9668, -4.6445, 0.4973},
-	{11.7627, 3.2344, -4.6025, 0.4981},
-	{12.0285, 2.7064, -4.2562, 0.4968},
-	{11.9380, 1.9668, -4.6445, 0.4973},
-	{11.4749, 1.0272, -4.5981, 0.4972},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-11.4749, 1.0272, -4.7589, 0.7820},
-	{-11.9380, 1.9668, -4.8053, 0.7794},
-	{-11.7627, 3.2344, -4.7633, 0.7768},
-	{-11.1585, 3.6057, -4.8106, 0.7753},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-7.2963, 3.0842, -2.9029, 0.7168},
-	{-6.8291, 2.5562, -3.9739, 0.7234},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{7.1495, 2.4879, -3.4790, 0.5577},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{6.8356, 1.0826, -3.5528, 0.5606},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{6.8356, 1.0826, -3.5528, 0.5606},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{4.9054, 0.2620, -4.2670, 0.5510},
-	{-6.8361, 1.0625, -3.7179, 0.7788},
-	{-6.3264, -0.1566, -3.4295, 0.8385},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{-6.8361, 1.0625, -3.7179, 0.7788},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{-6.8291, 2.5562, -3.9739, 0.7234},
-	{5.7015, -0.7809, -2.4765, 0.4856},
-	{4.9054, 0.2620, -4.2670, 0.5510},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{5.7015, -0.7809, -2.4765, 0.4856},
-	{7.4412, -1.0961, -2.4486, 0.4784},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{-5.7513, -0.7863, -2.6354, 0.8866},
-	{-7.4390, -1.0964, -2.6084, 0.8361},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{-5.7513, -0.7863, -2.6354, 0.8866},
-	{-5.6347, -0.9513, -1.6444, 0.9129},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{2.2951, -8.5023, 5.0645, 0.0094},
-	{2.6634, -7.8107, 5.4952, 0.0263},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{-2.8873, -8.2719, 4.6880, 0.0113},
-	{-2.6617, -7.8091, 5.5008, 0.0264},
-	{-3.0087, -7.3571, 5.1624, 0.0330},
-	{-2.1315, -8.3841, 5.4095, 0.0158},
-	{-2.6617, -7.8091, 5.5008, 0.0264},
-	{-2.8873, -8.2719, 4.6880, 0.0113},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{-3.0087, -7.3571, 5.1624, 0.0330},
-	{-2.6617, -7.8091, 5.5008, 0.0264},
-	{3.0087, -7.3572, 5.1624, 0.0330},
-	{2.1843, -4.5574, 6.0643, 0.0973},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{-3.0087, -7.3571, 5.1624, 0.0330},
-	{-2.1842, -4.5575, 6.0643, 0.0973},
-	{-2.6584, -4.1615, 5.1285, 0.1001},
-	{-4.6346, -0.7310, 4.9393, 0.1904},
-	{-1.9886, -1.5264, 5.5772, 0.1649},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{4.6346, -0.7310, 4.9389, 0.1903},
-	{6.0700, 0.2020, 4.6373, 0.2131},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{4.6346, -0.7310, 4.9389, 0.1903},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{6.0700, 0.2020, 4.6373, 0.2131},
-	{7.4280, 2.5611, 4.7393, 0.2677},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-7.4281, 2.5610, 4.7392, 0.2678},
-	{-6.0699, 0.2019, 4.6374, 0.2131},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{7.4280, 2.5611, 4.7393, 0.2677},
-	{7.3742, 3.5594, 5.0909, 0.2930},
-	{7.4280, 2.5611, 4.7393, 0.2677},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{-7.4281, 2.5610, 4.7392, 0.2678},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{-7.4281, 2.5610, 4.7392, 0.2678},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-6.9980, 3.9876, 5.3485, 0.3059},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{-5.0766, 4.9393, 5.7109, 0.3368},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{5.0766, 4.9393, 5.7109, 0.3367},
-	{6.8970, 3.7302, 5.7606, 0.2982},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-5.0766, 4.9393, 5.7109, 0.3368},
-	{-6.8970, 3.7302, 5.7606, 0.2982},
-	{2.2324, 6.1523, 7.1543, 0.3566},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{2.1973, 6.4512, 6.6665, 0.3688},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{2.2324, 6.1523, 7.1543, 0.3566},
-	{1.5120, 6.0392, 6.7377, 0.3622},
-	{2.2324, 6.1523, 7.1543, 0.3566},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{2.0684, 5.5439, 7.4207, 0.3429},
-	{2.2324, 6.1523, 7.1543, 0.3566},
-	{2.0684, 5.5439, 7.4207, 0.3429},
-	{2.8773, 6.0813, 7.0520, 0.3553},
-	{-2.2324, 6.1523, 7.1543, 0.3566},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{-1.5654, 5.7430, 7.2081, 0.3500},
-	{-2.1973, 6.4512, 6.6665, 0.3688},
-	{-2.2324, 6.1523, 7.1543, 0.3566},
-	{-1.5120, 6.0392, 6.7377, 0.3622},
-	{-2.2324, 6.1523, 7.1543, 0.3566},
-	{-2.1973, 6.4512, 6.6665, 0.3688},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-2.2324, 6.1523, 7.1543, 0.3566},
-	{-2.8771, 6.0813, 7.0520, 0.3553},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{0.4462, 4.1254, 6.6699, 0.3291},
-	{1.5654, 5.7430, 7.2081, 0.3500},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{-1.5654, 5.7430, 7.2081, 0.3500},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{-0.4117, 4.0198, 6.9470, 0.3220},
-	{-1.5120, 6.0392, 6.7377, 0.3622},
-	{-1.5654, 5.7430, 7.2081, 0.3500},
-	{-0.4117, 4.0198, 6.9470, 0.3220},
-	{-0.4117, 4.0198, 6.9470, 0.3220},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{0.1584, 3.7037, 7.0573, 0.3140},
-	{-0.0739, 3.1903, 7.2891, 0.2978},
-	{-0.4117, 4.0198, 6.9470, 0.3220},
-	{-2.0005, 5.4291, 7.4592, 0.3411},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{0.7485, 3.7300, 7.3646, 0.3104},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{2.7052, 5.5848, 7.3294, 0.3399},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{5.2220, 3.3861, 6.1382, 0.2917},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{-2.7008, 5.5855, 7.3304, 0.3398},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{6.1301, 3.7098, 6.2909, 0.3001},
-	{5.2220, 3.3861, 6.1382, 0.2917},
-	{-6.5149, 2.9590, 5.7918, 0.2836},
-	{-5.2219, 3.3861, 6.1382, 0.2917},
-	{-6.1298, 3.7100, 6.2910, 0.3001},
-	{6.5144, 2.9594, 5.7920, 0.2836},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{3.9329, 0.2603, 6.1751, 0.2216},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{5.7631, 0.5492, 5.3950, 0.2271},
-	{-3.9328, 0.2603, 6.1751, 0.2216},
-	{-5.7630, 0.5490, 5.3949, 0.2271},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{3.1034, -0.4857, 6.2004, 0.2016},
-	{3.9329, 0.2603, 6.1751, 0.2216},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{-3.9328, 0.2603, 6.1751, 0.2216},
-	{-3.1104, -0.4874, 6.1959, 0.2017},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{1.0859, 1.1631, 6.7418, 0.2421},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{0.0145, 0.7813, 6.6375, 0.2327},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{-0.0472, -8.7432, 5.3556, 0.0055},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{0.2100, -7.9706, 6.1987, 0.0286},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{1.7459, -8.1628, 5.7880, 0.0225},
-	{2.6634, -7.8107, 5.4952, 0.0263},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{-2.6617, -7.8091, 5.5008, 0.0264},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{-1.1257, -7.8770, 6.1710, 0.0304},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{1.0507, -2.3601, 6.7043, 0.1499},
-	{2.0708, -6.7825, 6.1792, 0.0511},
-	{2.1843, -4.5574, 6.0643, 0.0973},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{-2.1842, -4.5575, 6.0643, 0.0973},
-	{-2.0630, -6.7432, 6.1869, 0.0511},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{0.4750, -2.8157, 6.7526, 0.1396},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{1.0156, -1.8216, 7.3335, 0.1637},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{0.7252, -1.2223, 7.1892, 0.1721},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{1.0156, -1.8216, 7.3335, 0.1637},
-	{1.0468, -2.0838, 7.2441, 0.1585},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-1.0500, -2.1001, 7.2202, 0.1584},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-0.7059, -1.2214, 6.8112, 0.1790},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-0.8148, -1.2665, 7.1474, 0.1717},
-	{0.7252, -1.2223, 7.1892, 0.1721},
-	{0.7508, -1.2337, 6.8265, 0.1785},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-0.7059, -1.2214, 6.8112, 0.1790},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-0.0139, -1.5027, 6.8865, 0.1762},
-	{-0.0009, -1.7290, 7.3838, 0.1653},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-0.0139, -1.5027, 6.8865, 0.1762},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-0.4868, -1.2773, 7.2286, 0.1723},
-	{-1.0500, -2.1001, 7.2202, 0.1584},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{-1.0265, -1.9034, 7.3486, 0.1624},
-	{-0.2013, -2.9258, 6.7601, 0.1373},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{-1.0500, -2.1001, 7.2202, 0.1584},
-	{-0.0257, -2.5513, 7.2419, 0.1488},
-	{1.0468, -2.0838, 7.2441, 0.1585},
-	{1.0156, -1.8216, 7.3335, 0.1637},
-	{0.7508, -1.2337, 6.8265, 0.1785},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-0.7059, -1.2214, 6.8112, 0.1790},
-	{0.0136, -1.2670, 6.7346, 0.1807},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{0.7508, -1.2337, 6.8265, 0.1785},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{1.2712, -0.8455, 6.9871, 0.1901},
-	{-1.4034, -1.6755, 6.5195, 0.1667},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-1.2733, -0.8473, 6.9970, 0.1899},
-	{-1.1342, -1.8668, 6.7367, 0.1632},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-0.9520, -2.4604, 6.7266, 0.1475},
-	{-2.1842, -4.5575, 6.0643, 0.0973},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-2.6584, -4.1615, 5.1285, 0.1001},
-	{1.1715, -1.8093, 6.7472, 0.1678},
-	{1.6879, -2.5176, 6.0902, 0.1418},
-	{1.9123, -1.8981, 4.8487, 0.1517},
-	{-1.9123, -1.8981, 4.8487, 0.1518},
-	{-1.4034, -1.6755, 6.5195, 0.1667},
-	{-1.9886, -1.5264, 5.5772, 0.1649},
-	{-1.4034, -1.6755, 6.5195, 0.1667},
-	{-1.9123, -1.8981, 4.8487, 0.1518},
-	{-1.6879, -2.5176, 6.0902, 0.1418},
-	{-0.4866, -7.5857, 5.8009, 0.0375},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{0.2826, -7.6832, 5.8123, 0.0361},
-	{-0.4866, -7.5857, 5.8009, 0.0375},
-	{-0.7881, -7.1689, 5.8556, 0.0421},
-	{-0.4926, -7.8430, 6.2279, 0.0320},
-	{0.8552, -6.8031, 6.5422, 0.0517},
-	{0.7879, -6.9631, 5.9705, 0.0443},
-	{0.8200, -7.5487, 6.3671, 0.0373},
-	{-0.7881, -7.1689, 5.8556, 0.0421},
-	{-0.7052, -6.9428, 6.0213, 0.0455},
-	{-0.9374, -7.1432, 6.4531, 0.0448},
-	{-0.7052, -6.9428, 6.0213, 0.0455},
-	{0.7879, -6.9631, 5.9705, 0.0443},
-	{-0.7604, -6.8092, 6.5677, 0.0533},
-	{-0.7881, -7.1689, 5.8556, 0.0421},
-	{-0.4866, -7.5857, 5.8009, 0.0375},
-	{0.7077, -7.3197, 5.8089, 0.0407},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{-1.0607, 1.3248, 6.7566, 0.2483},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{2.0811, 0.5360, 6.7245, 0.2275},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-2.1004, 0.5143, 6.7143, 0.2273},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{3.9329, 0.2603, 6.1751, 0.2216},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{6.0270, 1.9201, 5.6921, 0.2622},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-5.2219, 3.3861, 6.1382, 0.2917},
-	{-6.0271, 1.9200, 5.6921, 0.2623},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{3.7809, 3.6150, 6.8159, 0.2986},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-3.7809, 3.6150, 6.8159, 0.2986},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{-5.2219, 3.3861, 6.1382, 0.2917},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-3.6308, 4.0335, 6.6450, 0.3083},
-	{3.7809, 3.6150, 6.8159, 0.2986},
-	{3.6308, 4.0335, 6.6450, 0.3082},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{2.6818, 4.0735, 6.8241, 0.3096},
-	{1.1296, 3.1756, 7.0439, 0.2928},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{-2.5790, 3.5571, 6.8803, 0.2982},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{-2.2628, 3.3780, 6.8397, 0.2939},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{-2.5790, 3.5571, 6.8803, 0.2982},
-	{3.6427, 3.4450, 6.7733, 0.2951},
-	{3.7809, 3.6150, 6.8159, 0.2986},
-	{2.5790, 3.5571, 6.8803, 0.2982},
-	{-2.6820, 4.0735, 6.8241, 0.3096},
-	{-3.7809, 3.6150, 6.8159, 0.2986},
-	{-2.5790, 3.5571, 6.8803, 0.2982},
-	{3.6427, 3.4450, 6.7733, 0.2951},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{3.7809, 3.6150, 6.8159, 0.2986},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{3.6427, 3.4450, 6.7733, 0.2951},
-	{4.2539, 3.2695, 6.4336, 0.2889},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-4.2539, 3.2695, 6.4336, 0.2890},
-	{-3.6427, 3.4450, 6.7732, 0.2951},
-	{-4.2539, 3.2695, 6.4336, 0.2890},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-4.6758, 3.0234, 6.1875, 0.2830},
-	{5.0068, 2.3606, 5.9847, 0.2691},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{5.1439, 3.0186, 6.2046, 0.2815},
-	{-5.0068, 2.3606, 5.9847, 0.2691},
-	{-5.1439, 3.0185, 6.2046, 0.2815},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{4.3461, 1.2232, 6.2393, 0.2453},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{4.8340, 1.8721, 6.0820, 0.2584},
-	{5.1229, 1.8057, 6.1226, 0.2579},
-	{4.3461, 1.2232, 6.2393, 0.2453},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{-5.1229, 1.8057, 6.1226, 0.2580},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-4.3462, 1.2232, 6.2393, 0.2453},
-	{-3.7617, 0.9141, 6.4336, 0.2374},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-3.0744, 0.7911, 6.5454, 0.2366},
-	{2.0663, 1.0399, 6.9076, 0.2400},
-	{3.7200, 0.6786, 6.5689, 0.2324},
-	{3.0744, 0.7911, 6.5454, 0.2366},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-3.0744, 0.7911, 6.5454, 0.2366},
-	{-3.7200, 0.6786, 6.5689, 0.2324},
-	{-3.0744, 0.7911, 6.5454, 0.2366},
-	{-2.0681, 1.0384, 6.9076, 0.2400},
-	{-2.2852, 1.1338, 6.7764, 0.2421},
-	{1.9336, 2.9531, 6.8203, 0.2846},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{1.8134, 2.5969, 6.8324, 0.2766},
-	{1.5375, 2.1532, 6.9580, 0.2663},
-	{1.9336, 2.9531, 6.8203, 0.2846},
-	{1.9314, 3.3249, 6.9754, 0.2935},
-	{-1.5381, 2.1540, 6.9576, 0.2663},
-	{-1.9314, 3.3250, 6.9754, 0.2935},
-	{-1.9336, 2.9531, 6.8203, 0.2847},
-	{0.4462, 4.1254, 6.6699, 0.5535},
-	{0.4451, 4.0472, 5.5837, 0.5513},
-	{0.0000, 3.8957, 6.6313, 0.5424},
-	{0.4451, 4.0472, 5.5837, 0.5513},
-	{0.4462, 4.1254, 6.6699, 0.5535},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{-0.2101, 3.9305, 5.5737, 0.5385},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-0.4117, 4.0198, 6.9470, 0.5312},
-	{1.5120, 6.0392, 6.7377, 0.6028},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{0.4462, 4.1254, 6.6699, 0.5535},
-	{0.7876, 4.4651, 6.0324, 0.5648},
-	{1.5120, 6.0392, 6.7377, 0.6028},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-2.2351, 5.9817, 5.6472, 0.4734},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{-1.5120, 6.0392, 6.7377, 0.4820},
-	{-2.2351, 5.9817, 5.6472, 0.4734},
-	{-0.7876, 4.4651, 6.0324, 0.5200},
-	{-1.0864, 4.3723, 5.4751, 0.5161},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{2.9824, 6.3896, 6.5299, 0.6351},
-	{2.0181, 6.3151, 6.1196, 0.6130},
-	{3.0405, 6.1943, 5.7635, 0.6278},
-	{2.2351, 5.9817, 5.6472, 0.6114},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{-2.2351, 5.9817, 5.6472, 0.4734},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{-2.1973, 6.4512, 6.6665, 0.4645},
-	{-2.0181, 6.3151, 6.1196, 0.4718},
-	{-2.9825, 6.3896, 6.5298, 0.4497},
-	{-2.9825, 6.3896, 6.5298, 0.4497},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{-5.0766, 4.9393, 5.7109, 0.4221},
-	{5.0766, 4.9393, 5.7109, 0.6627},
-	{6.9980, 3.9876, 5.3485, 0.6956},
-	{4.4490, 4.6856, 4.2743, 0.6347},
-	{-5.0766, 4.9393, 5.7109, 0.4221},
-	{-4.4490, 4.6856, 4.2743, 0.4501},
-	{-6.9980, 3.9876, 5.3485, 0.3892},
-	{-4.4490, 4.6856, 4.2743, 0.4501},
-	{-5.0766, 4.9393, 5.7109, 0.4221},
-	{-4.1231, 4.9809, 5.0182, 0.4481},
-	{7.4280, 2.5611, 4.7393, 0.7070},
-	{7.1193, 1.5198, 4.3052, 0.7144},
-	{7.1367, 2.6104, 3.6255, 0.6880},
-	{7.3742, 3.5594, 5.0909, 0.7020},
-	{7.4280, 2.5611, 4.7393, 0.7070},
-	{6.7199, 3.6192, 3.4692, 0.6691},
-	{-7.4281, 2.5610, 4.7392, 0.2587},
-	{-7.1367, 2.6104, 3.6255, 0.2620},
-	{-7.1193, 1.5198, 4.3052, 0.2264},
-	{-7.1367, 2.6104, 3.6255, 0.2620},
-	{-7.4281, 2.5610, 4.7392, 0.2587},
-	{-6.7199, 3.6193, 3.4692, 0.2962},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{6.0700, 0.2020, 4.6373, 0.7809},
-	{5.6823, 0.0730, 3.4040, 0.7922},
-	{6.0700, 0.2020, 4.6373, 0.7809},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{7.1193, 1.5198, 4.3052, 0.7312},
-	{-6.0699, 0.2019, 4.6374, 0.1768},
-	{-7.1193, 1.5198, 4.3052, 0.2264},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{4.6346, -0.7310, 4.9389, 0.8386},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{6.0700, 0.2020, 4.6373, 0.7809},
-	{-4.6346, -0.7310, 4.9393, 0.1195},
-	{-6.0699, 0.2019, 4.6374, 0.1768},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{0.7364, -4.1217, 2.4572, 0.8411},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{-0.7364, -4.1217, 2.4572, 0.8411},
-	{0.0000, -4.1477, 2.2738, 0.8429},
-	{0.0482, -7.3821, 3.3093, 0.7668},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{0.0482, -7.3821, 3.3093, 0.7668},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-0.0115, -4.9494, 2.8522, 0.8220},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{2.1564, -8.1722, 3.8697, 0.7483},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{0.0482, -7.3821, 3.3093, 0.7668},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{0.0482, -7.3821, 3.3093, 0.7668},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{-0.0472, -8.7432, 5.3556, 0.7161},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{2.2951, -8.5023, 5.0645, 0.7264},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{-2.1040, -8.5914, 4.5043, 0.7340},
-	{-0.4304, -8.4849, 4.0447, 0.7400},
-	{-2.1040, -8.5914, 4.5043, 0.7340},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{-0.0472, -8.7432, 5.3556, 0.7161},
-	{2.8557, -8.3615, 4.3947, 0.7402},
-	{2.2951, -8.5023, 5.0645, 0.7264},
-	{0.3713, -8.7698, 4.6035, 0.7269},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{-2.1040, -8.5914, 4.5043, 0.7340},
-	{-2.8873, -8.2719, 4.6880, 0.7365},
-	{2.8557, -8.3615, 4.3947, 0.7402},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{3.0087, -7.3572, 5.1624, 0.7515},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{-2.8873, -8.2719, 4.6880, 0.7365},
-	{3.0087, -7.3572, 5.1624, 0.7515},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{2.6584, -4.1615, 5.1285, 0.8259},
-	{2.0412, -3.5501, 3.5400, 0.8484},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{2.9744, -7.6636, 4.1034, 0.7540},
-	{2.0412, -3.5501, 3.5400, 0.8484},
-	{2.1993, -2.8066, 4.1799, 0.8601},
-	{-2.1993, -2.8066, 4.1799, 0.8601},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.6584, -4.1615, 5.1285, 0.8259},
-	{-2.9744, -7.6636, 4.1034, 0.7540},
-	{-2.1993, -2.8066, 4.1799, 0.8601},
-	{-2.1632, -4.2922, 3.6471, 0.8308},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{2.0412, -3.5501, 3.5400, 0.8484},
-	{2.5719, -7.5715, 3.6850, 0.7591},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-2.5597, -7.4674, 3.6497, 0.7623},
-	{-2.1632, -4.2922, 3.6471, 0.8308},
-	{-2.5597, -7.4674, 3.6497, 0.7623},
-	{-1.2695, -7.2762, 3.4470, 0.7704},
-	{-2.6331, -8.2252, 3.9922, 0.7470},
-	{1.8857, -3.1812, 2.7216, 0.8543},
-	{1.6160, -4.4202, 3.1448, 0.8328},
-	{1.4780, -3.7031, 2.3106, 0.8530},
-	{-1.8857, -3.1811, 2.7216, 0.8543},
-	{-1.6358, -4.4319, 3.1712, 0.8323},
-	{-2.0473, -3.2041, 3.5459, 0.8564},
-	{1.9123, -1.8981, 4.8487, 0.9199},
-	{2.1993, -2.8066, 4.1799, 0.9369},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{2.6584, -4.1615, 5.1285, 0.8259},
-	{2.1993, -2.8066, 4.1799, 0.8601},
-	{1.9123, -1.8981, 4.8487, 0.8634},
-	{4.6346, -0.7310, 4.9389, 0.8386},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{1.9891, -1.5276, 5.5728, 0.9120},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{4.6346, -0.7310, 4.9389, 0.8386},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{-2.0737, -1.6658, 4.4792, 0.0490},
-	{-1.9886, -1.5264, 5.5772, 0.0466},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{1.5161, -1.4810, -5.2734, 0.5121},
-	{0.0000, -0.5273, -6.4160, 0.4848},
-	{1.4845, -0.1123, -6.3347, 0.5102},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{-1.5161, -1.4810, -5.2734, 0.4588},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-1.5161, -1.4810, -5.2734, 0.4588},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{0.0000, -1.5754, -5.5679, 0.4854},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{1.5161, -1.4810, -5.2734, 0.5121},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{1.3053, -3.1154, -2.2884, 0.5150},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{1.4414, -2.3379, -4.1133, 0.5136},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{-1.3053, -3.1154, -2.2884, 0.4597},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-1.5161, -1.4810, -5.2734, 0.4588},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{-1.5161, -1.4810, -5.2734, 0.4588},
-	{0.0000, -2.4697, -4.3594, 0.4861},
-	{-1.3053, -3.1154, -2.2884, 0.4597},
-	{-1.4414, -2.3379, -4.1133, 0.4588},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{1.3053, -3.1154, -2.2884, 0.5150},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{0.7364, -4.1217, 2.4572, 0.5132},
-	{1.3053, -3.1154, -2.2884, 0.5150},
-	{0.7364, -4.1217, 2.4572, 0.5132},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{-1.3053, -3.1154, -2.2884, 0.4597},
-	{-0.7364, -4.1217, 2.4572, 0.4687},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-1.3053, -3.1154, -2.2884, 0.4597},
-	{0.0000, -3.2975, -2.4123, 0.4874},
-	{-0.7364, -4.1217, 2.4572, 0.4687},
-	{2.0412, -3.5501, 3.5400, 0.9395},
-	{1.8857, -3.1812, 2.7216, 0.9384},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{6.4931, 0.8906, 3.1419, 0.7583},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{6.9277, 1.6435, 3.1156, 0.7264},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{-6.2762, -0.3447, 0.5413, 0.1843},
-	{-6.5157, 0.9169, 3.1722, 0.2003},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{0.0000, 2.6895, -7.2070, 0.4837},
-	{-1.4841, -0.1125, -6.3348, 0.4592},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{0.0000, 0.8394, -6.9478, 0.4843},
-	{2.0391, 8.2441, 0.8438, 0.5164},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{3.8385, 8.0020, 0.1289, 0.5445},
-	{2.0391, 8.2441, 0.8438, 0.5164},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{2.0391, 8.2441, 0.8438, 0.5164},
-	{3.8385, 8.0020, 0.1289, 0.5445},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{2.0391, 8.2441, 0.8438, 0.5164},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{-3.8385, 8.0020, 0.1289, 0.4194},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{-1.2215, 8.3491, 0.9471, 0.4614},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{2.0391, 8.4375, -0.7295, 0.5142},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{2.0435, 7.5981, -4.0957, 0.5118},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{2.0391, 8.2793, -2.4258, 0.5126},
-	{2.0435, 7.5981, -4.0957, 0.5118},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-2.0391, 8.2793, -2.4258, 0.4518},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{-2.0391, 8.2793, -2.4258, 0.4518},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{-2.0391, 8.2793, -2.4258, 0.4518},
-	{-1.3338, 8.5464, -0.7957, 0.4611},
-	{-2.0391, 8.2793, -2.4258, 0.4518},
-	{0.0000, 8.3760, -2.6191, 0.4823},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{2.0435, 7.5981, -4.0957, 0.5118},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{1.9995, 4.4385, -6.6094, 0.5124},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{-2.0566, 6.2227, -5.5898, 0.4534},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-2.0566, 6.2227, -5.5898, 0.4534},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-2.0435, 7.5981, -4.0957, 0.4531},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{-2.0566, 6.2227, -5.5898, 0.4534},
-	{0.0000, 7.7014, -4.4165, 0.4825},
-	{-2.0566, 6.2227, -5.5898, 0.4534},
-	{0.0000, 6.3984, -5.9414, 0.4828},
-	{-1.9995, 4.4385, -6.6094, 0.4540},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{7.0763, 5.0693, 0.2577, 0.6274},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{6.5255, 5.9700, -0.7772, 0.5997},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{7.0763, 5.0693, 0.2577, 0.6274},
-	{-6.5250, 5.9706, -0.7771, 0.3636},
-	{-7.0590, 5.2197, -0.5052, 0.3425},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-6.5250, 5.9706, -0.7771, 0.3636},
-	{-6.5884, 4.9739, -3.4455, 0.3672},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{5.7812, 2.9059, -4.7677, 0.5899},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{7.1495, 2.4879, -3.4790, 0.6264},
-	{-6.5884, 4.9739, -3.4455, 0.3672},
-	{-6.1933, 4.3682, -4.2001, 0.3742},
-	{-6.8291, 2.5562, -3.9739, 0.3421},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{6.0573, 4.6347, -4.2505, 0.5852},
-	{2.3698, 6.0547, -5.6122, 0.5170},
-	{5.3568, 6.2148, -3.7356, 0.5666},
-	{-4.3754, 5.5803, -4.8808, 0.4146},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-6.1933, 4.3682, -4.2001, 0.3742},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{3.7826, 7.2444, -3.6683, 0.5387},
-	{5.0937, 7.1028, -2.5900, 0.5622},
-	{3.7793, 7.9277, -2.2412, 0.5394},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-6.5250, 5.9706, -0.7771, 0.3636},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-3.7793, 7.9277, -2.2412, 0.4248},
-	{-5.3569, 6.2147, -3.7355, 0.3978},
-	{-5.0937, 7.1029, -2.5900, 0.4019},
-	{-3.7826, 7.2444, -3.6683, 0.4259},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{3.8385, 8.0020, 0.1289, 0.5445},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{6.5255, 5.9700, -0.7772, 0.5997},
-	{4.9753, 7.3780, -0.4419, 0.5648},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-6.1136, 5.8614, 0.6061, 0.3591},
-	{-4.9753, 7.3780, -0.4418, 0.3989},
-	{-4.0659, 7.2009, 1.7664, 0.4061},
-	{-3.8385, 8.0020, 0.1289, 0.4194},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{6.1137, 5.8616, 0.6061, 0.6039},
-	{6.7199, 3.6192, 3.4692, 0.6691},
-	{4.4490, 4.6856, 4.2743, 0.6347},
-	{6.9980, 3.9876, 5.3485, 0.6956},
-	{4.4490, 4.6856, 4.2743, 0.5985},
-	{6.7199, 3.6192, 3.4692, 0.6657},
-	{5.3969, 4.5493, 2.8456, 0.6188},
-	{-4.4490, 4.6856, 4.2743, 0.3651},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-6.7199, 3.6193, 3.4692, 0.2962},
-	{-5.3969, 4.5492, 2.8455, 0.3444},
-	{-4.4490, 4.6856, 4.2743, 0.3651},
-	{-3.8595, 5.0537, 3.7628, 0.3845},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{2.3688, 4.7726, 4.7529, 0.5426},
-	{4.0659, 7.2010, 1.7664, 0.5575},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{3.8595, 5.0537, 3.7628, 0.5790},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{2.2018, 7.4843, 2.3882, 0.5207},
-	{0.0000, 7.7058, 2.3752, 0.4819},
-	{-2.3688, 4.7726, 4.7529, 0.4211},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{-3.8595, 5.0537, 3.7628, 0.3845},
-	{-2.2018, 7.4844, 2.3882, 0.4431},
-	{-2.3688, 4.7726, 4.7529, 0.4211},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{-2.2351, 5.9817, 5.6472, 0.4734},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-3.0405, 6.1943, 5.7635, 0.4570},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{2.3688, 4.7726, 4.7529, 0.5962},
-	{1.0864, 4.3723, 5.4751, 0.5687},
-	{2.3688, 4.7726, 4.7529, 0.5962},
-	{2.5973, 4.8086, 5.1542, 0.6024},
-	{4.4490, 4.6856, 4.2743, 0.6347},
-	{-4.4490, 4.6856, 4.2743, 0.3651},
-	{-2.3688, 4.7726, 4.7529, 0.4211},
-	{-3.8595, 5.0537, 3.7628, 0.3845},
-	{-2.3688, 4.7726, 4.7529, 0.4887},
-	{-4.4490, 4.6856, 4.2743, 0.4501},
-	{-2.5973, 4.8086, 5.1542, 0.4824},
-	{-1.0864, 4.3723, 5.4751, 0.4580},
-	{-0.2101, 3.9305, 5.5737, 0.4815},
-	{0.0000, 5.3671, 4.6988, 0.4818},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{6.7199, 3.6192, 3.4692, 0.6657},
-	{7.1367, 2.6104, 3.6255, 0.6981},
-	{6.7199, 3.6192, 3.4692, 0.6657},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{-7.1367, 2.6104, 3.6255, 0.2620},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-6.9241, 1.6296, 3.1503, 0.2325},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-7.1367, 2.6104, 3.6255, 0.2620},
-	{-6.7199, 3.6193, 3.4692, 0.2962},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{7.0763, 5.0693, 0.2577, 0.6274},
-	{7.4087, 3.9977, 0.0842, 0.6519},
-	{6.5968, 3.8178, 2.6351, 0.6562},
-	{7.0870, 2.7817, 2.2743, 0.6869},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-7.4203, 2.2210, 0.5499, 0.2637},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-7.0870, 2.7817, 2.2744, 0.2740},
-	{-6.5968, 3.8179, 2.6350, 0.3059},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{7.2952, 3.0841, -2.7419, 0.6417},
-	{6.6533, 4.8316, -3.4673, 0.5994},
-	{7.2952, 3.0841, -2.7419, 0.6417},
-	{6.8599, 5.3481, -2.4209, 0.6034},
-	{7.4561, 3.0887, -1.8429, 0.6567},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-6.5884, 4.9739, -3.4455, 0.3672},
-	{-7.2963, 3.0842, -2.9029, 0.3247},
-	{-7.4046, 4.0230, 0.0776, 0.3101},
-	{-6.8358, 5.3811, -2.4203, 0.3610},
-	{-7.4566, 3.0887, -2.0038, 0.3087},
-	{3.9615, -1.5679, -1.9047, 0.5855},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{2.1781, -3.0628, -0.3937, 0.5431},
-	{3.9615, -1.5679, -1.9047, 0.5855},
-	{3.6928, -1.8141, 0.4405, 0.5836},
-	{-2.1781, -3.0628, -0.3936, 0.4340},
-	{-3.7427, -1.7822, 0.3401, 0.3925},
-	{-4.4509, -1.2764, -1.7640, 0.3733},
-	{4.7750, -1.2291, -1.4513, 0.8213},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{3.6928, -1.8141, 0.4405, 0.8617},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{4.7750, -1.2291, -1.4513, 0.8213},
-	{5.6002, -0.9717, -1.5503, 0.7975},
-	{-5.6347, -0.9513, -1.6444, 0.1630},
-	{-4.4509, -1.2764, -1.7640, 0.1388},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{-5.6347, -0.9513, -1.6444, 0.1630},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{-6.2762, -0.3447, 0.5413, 0.1843},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{3.6928, -1.8141, 0.4405, 0.8617},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{5.6823, 0.0730, 3.4040, 0.7922},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{-5.4027, -0.1682, 3.5144, 0.1560},
-	{-3.7427, -1.7822, 0.3401, 0.0994},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{2.8420, -1.8123, 3.2856, 0.8920},
-	{4.2694, -0.7907, 3.7995, 0.8392},
-	{2.8420, -1.8123, 3.2856, 0.8920},
-	{2.1378, -1.6129, 4.5250, 0.9083},
-	{2.2169, -2.1952, 4.0292, 0.9182},
-	{-2.8420, -1.8123, 3.2856, 0.0673},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{3.6928, -1.8141, 0.4405, 0.8617},
-	{1.8857, -3.1812, 2.7216, 0.9384},
-	{1.4780, -3.7031, 2.3106, 0.9549},
-	{2.8420, -1.8123, 3.2856, 0.8920},
-	{1.8857, -3.1812, 2.7216, 0.9384},
-	{3.6928, -1.8141, 0.4405, 0.8617},
-	{-2.0737, -1.6658, 4.4792, 0.0490},
-	{-3.0890, -1.2671, 4.1689, 0.0789},
-	{-2.2169, -2.1952, 4.0292, 0.0410},
-	{6.8356, 1.0826, -3.5528, 0.6201},
-	{4.9054, 0.2620, -4.2670, 0.5880},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{6.8356, 1.0826, -3.5528, 0.6201},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{5.7812, 2.9059, -4.7677, 0.5899},
-	{-6.8361, 1.0625, -3.7179, 0.3568},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{-4.8576, 0.2578, -4.2920, 0.3819},
-	{-6.8361, 1.0625, -3.7179, 0.3568},
-	{-6.8291, 2.5562, -3.9739, 0.3421},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{4.2647, 3.7430, -5.7488, 0.5524},
-	{4.6011, 1.6845, -5.3751, 0.5681},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{2.2701, 2.3226, -6.7069, 0.5198},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{-6.8291, 2.5562, -3.9739, 0.3421},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{-4.2648, 3.7432, -5.7488, 0.4136},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{-4.6011, 1.6845, -5.3750, 0.3989},
-	{-2.2702, 2.3224, -6.7068, 0.4475},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{5.7015, -0.7809, -2.4765, 0.6193},
-	{4.7750, -1.2291, -1.4513, 0.6077},
-	{5.7015, -0.7809, -2.4765, 0.6193},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{4.9054, 0.2620, -4.2670, 0.5880},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-4.4509, -1.2764, -1.7640, 0.3733},
-	{-5.7513, -0.7863, -2.6354, 0.3527},
-	{-4.8576, 0.2578, -4.2920, 0.3819},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-6.3264, -0.1566, -3.4295, 0.3532},
-	{2.6846, -2.3134, -2.9877, 0.5424},
-	{3.3322, -0.4694, -5.2515, 0.5467},
-	{4.4629, -0.7647, -3.1987, 0.5882},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-3.3321, -0.4697, -5.2512, 0.4229},
-	{-4.5816, -0.7427, -3.0837, 0.3789},
-	{-2.6845, -2.3134, -2.9878, 0.4308},
-	{-4.4509, -1.2764, -1.7640, 0.3733},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{7.4561, 3.0887, -1.8429, 0.4907},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-7.4566, 3.0887, -2.0038, 0.7262},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-11.0448, 2.8720, -3.9225, 0.7775},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-10.8411, 3.9073, -3.6964, 0.7740},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{11.2017, 1.6436, -3.7222, 0.4929},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{11.2017, 1.6436, -3.7222, 0.4929},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{-11.8204, 2.6448, -3.9470, 0.7786},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-11.2017, 1.6436, -3.8830, 0.7821},
-	{10.0755, 0.3012, -3.3939, 0.4871},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{10.7112, 0.9042, -3.7085, 0.4903},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{10.4150, -0.1538, -3.5332, 0.4914},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{-10.0755, 0.3012, -3.5547, 0.7919},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{8.4729, -0.8982, -2.2657, 0.4766},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{9.2651, -0.1288, -2.8564, 0.4806},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{11.2017, 1.6436, -3.7222, 0.4929},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{10.7112, 0.9042, -3.7085, 0.4903},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{10.3755, 3.2977, -3.7225, 0.4934},
-	{10.8411, 3.9073, -3.5356, 0.4966},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-9.8889, 4.0509, -3.2399, 0.7697},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{8.8514, 2.8814, -3.0338, 0.4841},
-	{9.8888, 4.0508, -3.0791, 0.4969},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-7.2877, 1.4824, -2.4455, 0.7953},
-	{6.1325, -0.6509, -1.2654, 0.7740},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{6.2047, -0.4444, 0.2917, 0.7825},
-	{6.8821, 0.4512, 0.2981, 0.7415},
-	{6.1325, -0.6509, -1.2654, 0.7740},
-	{6.4795, 0.0107, -1.0732, 0.7501},
-	{-6.1360, -0.6480, -1.4298, 0.1822},
-	{-5.6347, -0.9513, -1.6444, 0.1630},
-	{-6.8889, 0.4469, 0.2131, 0.2172},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{6.1325, -0.6509, -1.2654, 0.4142},
-	{5.6002, -0.9717, -1.5503, 0.4268},
-	{6.1325, -0.6509, -1.2654, 0.4142},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{-5.6347, -0.9513, -1.6444, 0.9129},
-	{-6.1360, -0.6480, -1.4298, 0.8858},
-	{7.6776, -0.4866, -1.5889, 0.4555},
-	{7.1881, -0.1456, -2.1278, 0.4437},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{-7.6776, -0.4866, -1.7497, 0.8335},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{-7.1881, -0.1456, -2.2885, 0.8282},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{6.5239, -0.3135, -1.4792, 0.4205},
-	{7.1881, -0.1456, -2.1278, 0.4437},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{-6.5238, -0.3133, -1.6400, 0.8564},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{7.3635, 0.2473, -2.3979, 0.4460},
-	{6.9793, 0.8609, -2.4281, 0.4394},
-	{6.9793, 0.8609, -2.4281, 0.4394},
-	{7.2883, 1.4834, -2.2849, 0.4443},
-	{6.6781, 0.5600, -1.8145, 0.4203},
-	{-6.9793, 0.8609, -2.5889, 0.8101},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{-7.2877, 1.4824, -2.4455, 0.7953},
-	{6.4795, 0.0107, -1.0732, 0.3956},
-	{7.5438, 2.7818, -1.4600, 0.4463},
-	{6.8821, 0.4512, 0.2981, 0.3692},
-	{7.5438, 2.7818, -1.4600, 0.4463},
-	{6.4795, 0.0107, -1.0732, 0.3956},
-	{7.6124, 2.6663, -1.7965, 0.4667},
-	{-6.4804, 0.0092, -1.2454, 0.8645},
-	{-6.8889, 0.4469, 0.2131, 0.8141},
-	{-7.5422, 2.7779, -1.6337, 0.7282},
-	{-6.6781, 0.5600, -1.9753, 0.8290},
-	{-6.4804, 0.0092, -1.2454, 0.8645},
-	{-7.6122, 2.6656, -1.9574, 0.7506},
-	{-6.9793, 0.8609, -2.5889, 0.8101},
-	{-7.6900, 0.3986, -3.0131, 0.8097},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{-7.6900, 0.3986, -3.0131, 0.8097},
-	{-7.5071, -0.0524, -2.8954, 0.8163},
-	{-7.3634, 0.2473, -2.5587, 0.8185},
-	{-7.1881, -0.1456, -2.2885, 0.8282},
-	{-7.5071, -0.0524, -2.8954, 0.8163},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-9.5403, 2.9996, -3.8202, 0.7763},
-	{-10.3755, 3.2977, -3.8832, 0.7754},
-	{11.0448, 2.8720, -3.7617, 0.4939},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{-11.0824, 1.9239, -4.4090, 0.7815},
-	{-10.7706, 2.7952, -4.3906, 0.7786},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{11.0823, 1.9239, -4.2482, 0.4911},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{11.0829, 1.9485, -3.9207, 0.4923},
-	{-11.0824, 1.9239, -4.4090, 0.7815},
-	{-11.0829, 1.9486, -4.0815, 0.7813},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{10.0755, 0.3012, -3.3939, 0.4871},
-	{-10.0755, 0.3012, -3.5547, 0.7919},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{-10.7112, 0.9042, -3.8693, 0.7862},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{-10.0755, 0.3012, -3.5547, 0.7919},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{-9.2651, -0.1288, -3.0172, 0.8020},
-	{8.2181, 1.6967, -2.9907, 0.4674},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{9.5401, 2.9996, -3.6593, 0.4879},
-	{-8.2181, 1.6967, -3.1514, 0.7869},
-	{-9.5403, 2.9996, -3.8202, 0.7763},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{-9.5403, 2.9996, -3.8202, 0.7763},
-	{-8.2181, 1.6967, -3.1514, 0.7869},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-8.8519, 2.8818, -3.1946, 0.7724},
-	{-8.2181, 1.6967, -3.1514, 0.7869},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{7.6900, 0.3986, -2.8523, 0.4541},
-	{7.0926, 0.9428, -2.7998, 0.4460},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{8.2181, 1.6967, -2.9907, 0.4674},
-	{-7.0926, 0.9428, -2.9606, 0.8051},
-	{-8.2181, 1.6967, -3.1514, 0.7869},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{7.5071, -0.0524, -2.7346, 0.4533},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{7.5071, -0.0524, -2.7346, 0.4533},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{7.6900, 0.3986, -2.8523, 0.4541},
-	{-7.5071, -0.0524, -2.8954, 0.8163},
-	{-7.6900, 0.3986, -3.0131, 0.8097},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{8.0887, -0.0964, -2.5417, 0.4626},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{8.3657, 0.5854, -3.0192, 0.4665},
-	{-8.0887, -0.0963, -2.7025, 0.8144},
-	{-8.3657, 0.5854, -3.1800, 0.8014},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{9.4009, 0.1356, -3.5702, 0.4806},
-	{-10.4940, 0.6988, -4.2570, 0.7870},
-	{-9.4009, 0.1356, -3.7310, 0.7954},
-	{-9.8078, 2.1833, -3.7184, 0.7814},
-	{11.0823, 1.9239, -4.2482, 0.4911},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{10.4940, 0.6988, -4.0962, 0.4880},
-	{10.7705, 2.7952, -4.2298, 0.4918},
-	{9.5401, 2.9996, -3.6593, 0.4879},
-	{9.8078, 2.1833, -3.5576, 0.4856},
-	{7.4412, -1.0961, -2.4486, 0.4784},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-7.4390, -1.0964, -2.6084, 0.8361},
-	{-8.4729, -0.8982, -2.4264, 0.8162},
-	{-7.4390, -1.0964, -2.6084, 0.8361},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{10.4150, -0.1538, -3.5332, 0.4914},
-	{10.5117, -0.1758, -4.0078, 0.4946},
-	{10.8578, 0.3257, -3.5926, 0.4915},
-	{10.5117, -0.1758, -4.0078, 0.4946},
-	{10.4150, -0.1538, -3.5332, 0.4914},
-	{9.3516, -0.7207, -3.5640, 0.4925},
-	{10.5117, -0.1758, -4.0078, 0.4946},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{11.4521, 0.6108, -4.2231, 0.4956},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-10.5117, -0.1758, -4.1686, 0.7893},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{-10.5117, -0.1758, -4.1686, 0.7893},
-	{-9.3516, -0.7207, -3.7247, 0.7992},
-	{-10.4150, -0.1538, -3.6940, 0.7914},
-	{-11.4521, 0.6108, -4.3839, 0.7839},
-	{-10.5117, -0.1758, -4.1686, 0.7893},
-	{-10.8578, 0.3257, -3.7534, 0.7882},
-	{-10.5117, -0.1758, -4.1686, 0.7893},
-	{-11.4521, 0.6108, -4.3839, 0.7839},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{11.9380, 1.9668, -4.6445, 0.4973},
-	{11.9031, 1.5636, -4.1012, 0.4958},
-	{11.4749, 1.0272, -4.5981, 0.4972},
-	{-11.4521, 0.6108, -4.3839, 0.7839},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-11.4749, 1.0272, -4.7589, 0.7820},
-	{-11.9380, 1.9668, -4.8053, 0.7794},
-	{-11.9031, 1.5636, -4.2620, 0.7807},
-	{-12.0285, 2.7064, -4.4169, 0.7782},
-	{12.0285, 2.7064, -4.2562, 0.4968},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{11.8204, 2.6448, -3.7862, 0.4957},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{12.0285, 2.7064, -4.2562, 0.4968},
-	{11.7627, 3.2344, -4.6025, 0.4981},
-	{11.0654, 4.1572, -4.2363, 0.4987},
-	{11.6617, 3.6701, -4.0815, 0.4974},
-	{11.1585, 3.6057, -4.6498, 0.4993},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-11.7627, 3.2344, -4.7633, 0.7768},
-	{-12.0285, 2.7064, -4.4169, 0.7782},
-	{-11.7627, 3.2344, -4.7633, 0.7768},
-	{-11.6617, 3.6701, -4.2423, 0.7761},
-	{-11.1585, 3.6057, -4.8106, 0.7753},
-	{10.1953, 4.2539, -3.9727, 0.5002},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{11.0654, 4.1572, -4.2363, 0.4987},
-	{10.1953, 4.2539, -3.9727, 0.5002},
-	{10.6532, 4.3317, -3.6794, 0.4982},
-	{10.1953, 4.2539, -3.9727, 0.5002},
-	{11.0654, 4.1572, -4.2363, 0.4987},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{10.1953, 4.2539, -3.9727, 0.5002},
-	{9.9502, 3.5732, -4.3850, 0.5035},
-	{-10.1953, 4.2539, -4.1334, 0.7714},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{-11.0654, 4.1572, -4.3971, 0.7742},
-	{-10.1953, 4.2539, -4.1334, 0.7714},
-	{-10.6532, 4.3317, -3.8402, 0.7726},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{7.2952, 3.0841, -2.7419, 0.5334},
-	{8.8557, 3.9212, -2.5599, 0.4983},
-	{8.9283, 3.9918, -3.3915, 0.5048},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{7.2952, 3.0841, -2.7419, 0.5334},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{-8.8557, 3.9212, -2.7207, 0.7607},
-	{-7.2963, 3.0842, -2.9029, 0.7168},
-	{-8.9283, 3.9918, -3.5523, 0.7622},
-	{-7.2963, 3.0842, -2.9029, 0.7168},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{9.3296, 1.6260, -4.3022, 0.5097},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{-9.3296, 1.6260, -4.4630, 0.7773},
-	{-7.5717, 1.2288, -3.5946, 0.7776},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{-7.5717, 1.2288, -3.5946, 0.7776},
-	{-9.3296, 1.6260, -4.4630, 0.7773},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{11.4749, 1.0272, -4.5981, 0.4972},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{9.9619, 0.0684, -4.3437, 0.4990},
-	{9.3296, 1.6260, -4.3022, 0.5097},
-	{-9.3296, 1.6260, -4.4630, 0.7773},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-9.9502, 3.5732, -4.5458, 0.7713},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{-9.3296, 1.6260, -4.4630, 0.7773},
-	{-9.9619, 0.0684, -4.5044, 0.7889},
-	{11.9380, 1.9668, -4.6445, 0.4973},
-	{11.0853, 2.2689, -4.7707, 0.5001},
-	{11.7627, 3.2344, -4.6025, 0.4981},
-	{-11.7627, 3.2344, -4.7633, 0.7768},
-	{-11.9380, 1.9668, -4.8053, 0.7794},
-	{-12.0285, 2.7064, -4.4169, 0.7782},
-	{-11.9380, 1.9668, -4.8053, 0.7794},
-	{-11.7627, 3.2344, -4.7633, 0.7768},
-	{-11.0853, 2.2689, -4.9315, 0.7780},
-	{7.1495, 2.4879, -3.4790, 0.5577},
-	{7.2952, 3.0841, -2.7419, 0.5334},
-	{7.8352, 2.8981, -3.3987, 0.5313},
-	{6.8356, 1.0826, -3.5528, 0.5606},
-	{7.1495, 2.4879, -3.4790, 0.5577},
-	{7.5717, 1.2288, -3.4338, 0.5405},
-	{-7.5717, 1.2288, -3.5946, 0.7776},
-	{-6.8361, 1.0625, -3.7179, 0.7788},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{-6.8361, 1.0625, -3.7179, 0.7788},
-	{-7.5717, 1.2288, -3.5946, 0.7776},
-	{-7.4662, 2.6250, -3.5119, 0.7383},
-	{7.4412, -1.0961, -2.4486, 0.4784},
-	{5.7015, -0.7809, -2.4765, 0.4856},
-	{6.9876, -0.3784, -3.0504, 0.5095},
-	{5.6002, -0.9717, -1.5503, 0.4268},
-	{5.7015, -0.7809, -2.4765, 0.4856},
-	{7.1039, -1.0204, -1.4327, 0.4529},
-	{-6.3264, -0.1566, -3.4295, 0.8385},
-	{-5.7513, -0.7863, -2.6354, 0.8866},
-	{-7.2790, -0.4647, -3.2241, 0.8253},
-	{-7.4390, -1.0964, -2.6084, 0.8361},
-	{-5.7513, -0.7863, -2.6354, 0.8866},
-	{-7.1027, -1.0206, -1.5932, 0.8484},
-	{4.2148, 1.9371, 6.8021, 0.1430},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{-4.2148, 1.9371, 6.8021, 0.8806},
-	{-5.3167, 1.3136, 5.1593, 0.8330},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{5.3167, 1.3137, 5.1594, 0.1996},
-	{5.4584, 2.1884, 5.1024, 0.1994},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{5.3167, 1.3137, 5.1594, 0.1996},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{4.7900, 0.6152, 5.2295, 0.1889},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{3.1641, -0.0352, 5.5459, 0.1392},
-	{4.0430, 0.1406, 5.3789, 0.1674},
-	{4.7900, 0.6152, 5.2295, 0.1889},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-4.0430, 0.1406, 5.3789, 0.8816},
-	{-3.1641, -0.0352, 5.5459, 0.9124},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-4.7900, 0.6152, 5.2295, 0.8535},
-	{-4.0430, 0.1406, 5.3789, 0.8816},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{3.1945, 1.2513, 7.2212, 0.1221},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{3.1945, 1.2513, 7.2212, 0.1221},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{-3.1945, 1.2513, 7.2212, 0.9067},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{1.5381, 0.6152, 5.8096, 0.0799},
-	{2.2852, 0.1406, 5.6953, 0.1085},
-	{3.1641, -0.0352, 5.5459, 0.1392},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{-2.2852, 0.1406, 5.6953, 0.9408},
-	{-1.5381, 0.6152, 5.8096, 0.9631},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{-3.1641, -0.0352, 5.5459, 0.9124},
-	{-2.2852, 0.1406, 5.6953, 0.9408},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{0.8789, 2.1885, 5.8887, 0.0457},
-	{1.0547, 1.3359, 5.8711, 0.0576},
-	{1.0547, 1.3359, 5.8711, 0.0576},
-	{1.5381, 0.6152, 5.8096, 0.0799},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{-1.0547, 1.3359, 5.8711, 0.9755},
-	{-0.8789, 2.1885, 5.8887, 0.9753},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{-1.5381, 0.6152, 5.8096, 0.9631},
-	{-1.0547, 1.3359, 5.8711, 0.9755},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{2.1472, 1.9626, 7.1543, 0.0967},
-	{-2.1472, 1.9626, 7.1543, 0.9265},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{1.5381, 3.8057, 5.8096, 0.0584},
-	{1.0547, 3.0586, 5.8711, 0.0463},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{1.0547, 3.0586, 5.8711, 0.0463},
-	{0.8789, 2.1885, 5.8887, 0.0457},
-	{-1.0547, 3.0586, 5.8711, 0.9628},
-	{-1.5381, 3.8057, 5.8096, 0.9408},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{-0.8789, 2.1885, 5.8887, 0.9753},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{3.1641, 4.4648, 5.5459, 0.1088},
-	{2.2852, 4.2891, 5.6953, 0.0803},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{2.2852, 4.2891, 5.6953, 0.0803},
-	{1.5381, 3.8057, 5.8096, 0.0584},
-	{-2.2852, 4.2891, 5.6953, 0.9124},
-	{-3.1641, 4.4648, 5.5459, 0.8817},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{-1.5381, 3.8057, 5.8096, 0.9408},
-	{3.4803, 3.1451, 7.1542, 0.1189},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-3.4803, 3.1451, 7.1542, 0.8950},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{-2.3068, 2.8405, 7.1353, 0.9190},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{4.8167, 3.8395, 5.2547, 0.1676},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-4.8167, 3.8396, 5.2547, 0.8321},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{4.0430, 4.2891, 5.3789, 0.1395},
-	{3.1641, 4.4648, 5.5459, 0.1088},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{5.2734, 3.0586, 5.1328, 0.1884},
-	{4.8167, 3.8395, 5.2547, 0.1676},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{4.8167, 3.8395, 5.2547, 0.1676},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{-4.2148, 1.9371, 6.8021, 0.8806},
-	{2.3068, 2.8405, 7.1353, 0.0967},
-	{2.1472, 1.9626, 7.1543, 0.0967},
-	{2.1870, 2.0944, 7.3609, 0.1010},
-	{-2.1870, 2.0944, 7.3609, 0.9209},
-	{-2.1472, 1.9626, 7.1543, 0.9265},
-	{-2.3068, 2.8405, 7.1353, 0.9190},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{3.1945, 1.2513, 7.2212, 0.1221},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{3.1945, 1.2513, 7.2212, 0.1221},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-3.1945, 1.2513, 7.2212, 0.9067},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-2.1870, 2.0944, 7.3609, 0.9209},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{3.4803, 3.1451, 7.1542, 0.1189},
-	{-3.4803, 3.1451, 7.1542, 0.8950},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{3.3974, 2.1919, 7.3539, 0.1212},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{3.4803, 3.1451, 7.1542, 0.1189},
-	{5.3167, 1.3137, 5.1594, 0.1996},
-	{4.2148, 1.9371, 6.8021, 0.1430},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{4.2148, 1.9371, 6.8021, 0.1430},
-	{5.3167, 1.3137, 5.1594, 0.1996},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{-4.2148, 1.9371, 6.8021, 0.8806},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-4.2148, 1.9371, 6.8021, 0.8806},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{-5.3167, 1.3136, 5.1593, 0.8330},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-5.3167, 1.3136, 5.1593, 0.8330},
-	{-4.7900, 0.6152, 5.2295, 0.8535},
-	{-5.4584, 2.1884, 5.1024, 0.8220},
-	{-5.3167, 1.3136, 5.1593, 0.8330},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{4.0430, 0.1406, 5.3789, 0.1674},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{3.1641, -0.0352, 5.5459, 0.1392},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{-4.1236, 0.6852, 6.2064, 0.8833},
-	{-3.1641, -0.0352, 5.5459, 0.9124},
-	{4.1238, 0.6852, 6.2063, 0.1545},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{-3.1945, 1.2513, 7.2212, 0.9067},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{3.1945, 1.2513, 7.2212, 0.1221},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-3.1945, 1.2513, 7.2212, 0.9067},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{2.2852, 0.1406, 5.6953, 0.1085},
-	{2.7957, 0.4503, 6.4685, 0.1194},
-	{1.5381, 0.6152, 5.8096, 0.0799},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{-2.7957, 0.4503, 6.4685, 0.9205},
-	{-1.5381, 0.6152, 5.8096, 0.9631},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{1.0547, 1.3359, 5.8711, 0.0576},
-	{1.8872, 0.9184, 6.5323, 0.0929},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{-1.8872, 0.9184, 6.5323, 0.9421},
-	{-1.0547, 1.3359, 5.8711, 0.9755},
-	{2.1472, 1.9626, 7.1543, 0.0967},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{-2.1472, 1.9626, 7.1543, 0.9265},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-1.4448, 1.8164, 6.6397, 0.9499},
-	{2.3068, 2.8405, 7.1353, 0.0967},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{2.1472, 1.9626, 7.1543, 0.0967},
-	{-2.3068, 2.8405, 7.1353, 0.9190},
-	{-2.1472, 1.9626, 7.1543, 0.9265},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{1.4449, 1.8163, 6.6397, 0.0754},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{0.8789, 2.1885, 5.8887, 0.0457},
-	{-1.0547, 3.0586, 5.8711, 0.9628},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{-0.8789, 2.1885, 5.8887, 0.9753},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{2.2852, 4.2891, 5.6953, 0.0803},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{1.5381, 3.8057, 5.8096, 0.0584},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-2.2852, 4.2891, 5.6953, 0.9124},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-2.2852, 4.2891, 5.6953, 0.9124},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-1.5381, 3.8057, 5.8096, 0.9408},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{3.4803, 3.1451, 7.1542, 0.1189},
-	{2.4731, 3.8408, 6.4512, 0.0927},
-	{2.3068, 2.8405, 7.1353, 0.0967},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{1.6980, 3.1468, 6.6498, 0.0751},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-3.4803, 3.1451, 7.1542, 0.8950},
-	{-2.4731, 3.8408, 6.4511, 0.9107},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{-1.6980, 3.1468, 6.6498, 0.9369},
-	{3.4803, 3.1451, 7.1542, 0.1189},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{-3.4803, 3.1451, 7.1542, 0.8950},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{3.4331, 3.9180, 6.3833, 0.1176},
-	{4.8167, 3.8395, 5.2547, 0.1676},
-	{4.0430, 4.2891, 5.3789, 0.1395},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-4.0430, 4.2891, 5.3789, 0.8535},
-	{-4.8167, 3.8396, 5.2547, 0.8321},
-	{-4.0430, 4.2891, 5.3789, 0.8535},
-	{-3.4323, 3.9180, 6.3835, 0.8846},
-	{-3.1641, 4.4648, 5.5459, 0.8817},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{5.4584, 2.1884, 5.1024, 0.1994},
-	{5.2734, 3.0586, 5.1328, 0.1884},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{-5.2734, 3.0586, 5.1328, 0.8215},
-	{-5.4584, 2.1884, 5.1024, 0.8220},
-	{-5.2734, 3.0586, 5.1328, 0.8215},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{-4.8167, 3.8396, 5.2547, 0.8321},
-	{4.9061, 2.5884, 6.0186, 0.1641},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{4.2148, 1.9371, 6.8021, 0.1430},
-	{-4.9062, 2.5882, 6.0186, 0.8528},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{-4.8167, 3.8396, 5.2547, 0.8321},
-	{2.1870, 2.0944, 7.3609, 0.1010},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{2.3068, 2.8405, 7.1353, 0.0967},
-	{-2.1870, 2.0944, 7.3609, 0.9209},
-	{-2.3068, 2.8405, 7.1353, 0.9190},
-	{-2.7133, 3.0296, 7.3210, 0.9099},
-	{2.1870, 2.0944, 7.3609, 0.1010},
-	{2.1472, 1.9626, 7.1543, 0.0967},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{-2.1870, 2.0944, 7.3609, 0.9209},
-	{-2.6655, 1.4463, 7.3534, 0.9158},
-	{-2.1472, 1.9626, 7.1543, 0.9265},
-	{3.8894, 1.4914, 7.0151, 0.1357},
-	{4.2148, 1.9371, 6.8021, 0.1430},
-	{4.0859, 2.6986, 6.9307, 0.1353},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{-4.2148, 1.9371, 6.8021, 0.8806},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{-3.1945, 1.2513, 7.2212, 0.9067},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-3.8894, 1.4914, 7.0151, 0.8913},
-	{2.6655, 1.4463, 7.3534, 0.1108},
-	{2.7133, 3.0296, 7.3210, 0.1048},
-	{2.1870, 2.0944, 7.3609, 0.1010},
-	{-4.0859, 2.6985, 6.9307, 0.8815},
-	{-3.3974, 2.1919, 7.3539, 0.8998},
-	{-3.4803, 3.1451, 7.1542, 0.8950},
-};
-
-VECTOR normals_monkey[3000] = {
-	{-0.0141, -0.9279, 0.3726, 0.2495},
-	{0.3694, -0.8743, 0.3148, 0.2956},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{-0.3367, -0.7767, 0.5324, 0.2072},
-	{-0.2104, -0.9663, -0.1486, 0.2024},
-	{-0.0141, -0.9279, 0.3726, 0.2495},
-	{-0.3367, -0.7767, 0.5324, 0.2072},
-	{-0.7645, -0.6395, 0.0814, 0.1870},
-	{-0.2104, -0.9663, -0.1486, 0.2024},
-	{0.6641, -0.3854, 0.6407, 0.3016},
-	{0.6820, -0.7049, -0.1951, 0.3121},
-	{0.9420, -0.0755, 0.3271, 0.3156},
-	{0.6641, -0.3854, 0.6407, 0.3016},
-	{0.3694, -0.8743, 0.3148, 0.2956},
-	{0.6820, -0.7049, -0.1951, 0.3121},
-	{0.9420, -0.0755, 0.3271, 0.3156},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{0.6641, -0.3854, 0.6407, 0.3016},
-	{0.7215, 0.0855, 0.6871, 0.3005},
-	{0.9420, -0.0755, 0.3271, 0.3156},
-	{0.9691, 0.1927, 0.1540, 0.3232},
-	{-0.7145, 0.0872, 0.6942, 0.1986},
-	{-0.9425, -0.0528, 0.3301, 0.1834},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{0.5621, -0.7368, 0.3757, 0.3174},
-	{0.4720, -0.8366, 0.2782, 0.3709},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{0.5621, -0.7368, 0.3757, 0.3174},
-	{-0.5658, -0.7392, 0.3653, 0.1818},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{-0.4587, -0.8449, 0.2751, 0.1282},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.4587, -0.8449, 0.2751, 0.1282},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.6907, -0.6884, 0.2215, 0.0904},
-	{0.6827, -0.6972, 0.2184, 0.4087},
-	{0.8954, -0.4265, 0.1278, 0.4356},
-	{0.9698, -0.1445, 0.1964, 0.4368},
-	{-0.9698, -0.1445, 0.1963, 0.0623},
-	{-0.8956, -0.4264, 0.1265, 0.0635},
-	{-0.6907, -0.6884, 0.2215, 0.0904},
-	{0.9698, -0.1445, 0.1964, 0.4368},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{-0.9698, -0.1445, 0.1963, 0.0623},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.9463, 0.2917, 0.1390, 0.0658},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.9463, 0.2917, 0.1390, 0.4333},
-	{0.6245, 0.7636, 0.1642, 0.4236},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.6245, 0.7636, 0.1642, 0.4236},
-	{0.4818, 0.8730, -0.0763, 0.3803},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{-0.6245, 0.7636, 0.1642, 0.0756},
-	{-0.9463, 0.2917, 0.1390, 0.0658},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.4818, 0.8730, -0.0763, 0.3803},
-	{0.3552, 0.9198, 0.1667, 0.3313},
-	{-0.3552, 0.9198, 0.1668, 0.1679},
-	{-0.4818, 0.8730, -0.0763, 0.1189},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.3552, 0.9198, 0.1667, 0.3313},
-	{-0.1641, 0.9682, 0.1890, 0.3134},
-	{-0.0592, 0.6725, 0.7377, 0.3127},
-	{-0.1641, 0.9682, 0.1890, 0.3134},
-	{-0.7148, 0.6910, 0.1077, 0.2963},
-	{-0.0288, 0.1763, 0.9839, 0.3084},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.0562, 0.6667, 0.7432, 0.1865},
-	{0.5263, 0.4725, 0.7069, 0.2001},
-	{0.7116, 0.6948, 0.1040, 0.2029},
-	{0.1641, 0.9682, 0.1890, 0.1858},
-	{-0.3552, 0.9198, 0.1668, 0.1679},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.7148, 0.6910, 0.1077, 0.2963},
-	{-0.7206, 0.6925, 0.0350, 0.2596},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{-0.0288, 0.1763, 0.9839, 0.3084},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.7206, 0.6925, 0.0350, 0.2596},
-	{-0.0177, 0.9875, 0.1568, 0.2496},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{0.6208, 0.6690, 0.4088, 0.2380},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.0177, 0.9875, 0.1568, 0.2496},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{-0.0288, 0.1763, 0.9839, 0.3084},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{-0.2210, -0.2670, 0.9380, 0.1212},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{0.2210, -0.2671, 0.9380, 0.3779},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{-0.2210, -0.2670, 0.9380, 0.1212},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.3780, -0.4283, 0.8208, 0.3462},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.3783, -0.4288, 0.8204, 0.1529},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.0141, -0.9279, 0.3726, 0.2495},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{-0.3367, -0.7767, 0.5324, 0.2072},
-	{-0.0141, -0.9279, 0.3726, 0.2495},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{-0.6461, -0.3589, 0.6736, 0.1975},
-	{-0.3367, -0.7767, 0.5324, 0.2072},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{-0.0845, -0.3780, 0.9219, 0.2438},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{-0.0845, -0.3780, 0.9219, 0.2438},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{-0.7506, -0.4303, 0.5014, 0.2313},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.1960, 0.3715, 0.9075, 0.2674},
-	{0.2948, 0.8009, 0.5212, 0.2634},
-	{0.6844, -0.3702, 0.6282, 0.2674},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{-0.5227, 0.7487, 0.4078, 0.2343},
-	{-0.1334, 0.3497, 0.9273, 0.2330},
-	{-0.5227, 0.7487, 0.4078, 0.2343},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{-0.2565, 0.7182, 0.6468, 0.2493},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.6844, -0.3702, 0.6282, 0.2674},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{-0.0845, -0.3780, 0.9219, 0.2438},
-	{-0.7506, -0.4303, 0.5014, 0.2313},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{-0.0845, -0.3780, 0.9219, 0.2438},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{0.6844, -0.3702, 0.6282, 0.2674},
-	{0.2948, 0.8009, 0.5212, 0.2634},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{0.2948, 0.8009, 0.5212, 0.2634},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{0.6148, 0.1251, 0.7787, 0.2655},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{-0.5227, 0.7487, 0.4078, 0.2343},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{0.6148, 0.1251, 0.7787, 0.2655},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.8322, 0.2332, 0.5030, 0.2987},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{-0.8054, -0.1672, 0.5687, 0.2099},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.1334, 0.3497, 0.9273, 0.2330},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.7215, 0.0855, 0.6871, 0.3005},
-	{0.8322, 0.2332, 0.5030, 0.2987},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{-0.7145, 0.0872, 0.6942, 0.1986},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{0.8322, 0.2332, 0.5030, 0.2987},
-	{0.7215, 0.0855, 0.6871, 0.3005},
-	{0.9691, 0.1927, 0.1540, 0.3232},
-	{0.9691, 0.1927, 0.1540, 0.3232},
-	{0.9522, -0.1345, 0.2741, 0.3221},
-	{0.8322, 0.2332, 0.5030, 0.2987},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{-0.9669, -0.0935, 0.2376, 0.1770},
-	{-0.9691, 0.1927, 0.1540, 0.1759},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.9522, -0.1345, 0.2741, 0.3221},
-	{0.5621, -0.7368, 0.3757, 0.3174},
-	{0.5621, -0.7368, 0.3757, 0.3174},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{-0.8054, -0.1672, 0.5687, 0.2099},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{-0.5658, -0.7392, 0.3653, 0.1818},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{-0.2121, 0.5488, 0.8086, 0.2532},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{-0.2121, 0.5488, 0.8086, 0.2532},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{0.6649, -0.1330, 0.7350, 0.2409},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{-0.6030, -0.5567, 0.5715, 0.2586},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{0.3899, -0.7762, 0.4955, 0.2408},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{-0.6030, -0.5567, 0.5715, 0.2586},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{-0.6030, -0.5567, 0.5715, 0.2586},
-	{0.3899, -0.7762, 0.4955, 0.2408},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{0.3676, 0.4515, 0.8131, 0.2444},
-	{-0.2121, 0.5488, 0.8086, 0.2532},
-	{0.6649, -0.1330, 0.7350, 0.2409},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{0.3899, -0.7762, 0.4955, 0.2408},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.3780, -0.4283, 0.8208, 0.3462},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.3783, -0.4288, 0.8204, 0.1529},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{-0.3783, -0.4288, 0.8204, 0.1529},
-	{0.2210, -0.2671, 0.9380, 0.3779},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.2210, -0.2671, 0.9380, 0.3779},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{-0.3183, 0.0829, 0.9443, 0.1562},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{-0.1509, -0.1852, 0.9710, 0.2192},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{0.1128, 0.0101, 0.9936, 0.3165},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{0.3722, -0.6633, 0.6492, 0.3094},
-	{0.1128, 0.0101, 0.9936, 0.3165},
-	{0.3183, 0.0830, 0.9443, 0.3429},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{0.1128, 0.0101, 0.9936, 0.3165},
-	{-0.3183, 0.0829, 0.9443, 0.1562},
-	{-0.1118, -0.3710, 0.9219, 0.1581},
-	{-0.1128, 0.0101, 0.9936, 0.1826},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{-0.2499, -0.9645, 0.0856, 0.3548},
-	{-0.0343, -0.6586, 0.7517, 0.3649},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.1118, -0.3710, 0.9219, 0.1581},
-	{-0.3183, 0.0829, 0.9443, 0.1562},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{-0.0343, -0.6586, 0.7517, 0.3649},
-	{-0.1293, -0.3361, 0.9329, 0.3697},
-	{-0.1293, -0.3361, 0.9329, 0.3697},
-	{-0.6638, -0.0229, 0.7475, 0.3711},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.1293, -0.3361, 0.9329, 0.1294},
-	{0.0343, -0.6586, 0.7517, 0.1342},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{0.6638, -0.0229, 0.7475, 0.1280},
-	{0.1293, -0.3361, 0.9329, 0.1294},
-	{-0.6638, -0.0229, 0.7475, 0.3711},
-	{-0.0760, 0.2579, 0.9632, 0.3680},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{0.0760, 0.2578, 0.9632, 0.1311},
-	{0.6638, -0.0229, 0.7475, 0.1280},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{0.5053, 0.7758, 0.3779, 0.1437},
-	{0.0760, 0.2578, 0.9632, 0.1311},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{-0.5052, 0.7758, 0.3779, 0.3554},
-	{0.0364, 0.4930, 0.8693, 0.3425},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{0.0364, 0.4930, 0.8693, 0.3425},
-	{0.1926, 0.9813, 0.0034, 0.3273},
-	{-0.0364, 0.4930, 0.8693, 0.1566},
-	{0.5053, 0.7758, 0.3779, 0.1437},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.1926, 0.9813, 0.0034, 0.3273},
-	{0.3673, 0.3488, 0.8622, 0.3081},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.3673, 0.3488, 0.8622, 0.3081},
-	{0.8192, 0.4138, 0.3972, 0.3007},
-	{-0.8212, 0.4149, 0.3917, 0.1984},
-	{-0.3673, 0.3496, 0.8619, 0.1910},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{0.6676, -0.2781, 0.6906, 0.3012},
-	{0.3722, -0.6633, 0.6492, 0.3094},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.6676, -0.2781, 0.6906, 0.1979},
-	{-0.6068, -0.1568, 0.7792, 0.2014},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{-0.3722, -0.6633, 0.6492, 0.1897},
-	{-0.6676, -0.2781, 0.6906, 0.1979},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.8192, 0.4138, 0.3972, 0.3007},
-	{0.8192, 0.4138, 0.3972, 0.3007},
-	{0.6069, -0.1567, 0.7792, 0.2977},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{-0.8212, 0.4149, 0.3917, 0.1984},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.6068, -0.1568, 0.7792, 0.2014},
-	{-0.8212, 0.4149, 0.3917, 0.1984},
-	{-0.3475, 0.8393, 0.4180, 0.4095},
-	{0.1767, 0.8842, 0.4325, 0.4094},
-	{-0.0177, 0.9875, 0.1568, 0.4325},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{-0.3923, 0.9135, 0.1074, 0.4029},
-	{-0.3475, 0.8393, 0.4180, 0.4095},
-	{0.1767, 0.8842, 0.4325, 0.4094},
-	{0.4016, 0.9100, 0.1027, 0.4029},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.1767, 0.8842, 0.4325, 0.4094},
-	{0.6208, 0.6690, 0.4088, 0.4332},
-	{-0.0177, 0.9875, 0.1568, 0.4325},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{-0.2901, 0.5476, -0.7848, 0.4120},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{-0.2901, 0.5476, -0.7848, 0.4120},
-	{-0.3923, 0.9135, 0.1074, 0.4029},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.7116, 0.6948, 0.1040, 0.4388},
-	{0.6208, 0.6690, 0.4088, 0.4332},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{-0.7148, 0.6910, 0.1077, 0.4388},
-	{-0.1641, 0.9682, 0.1890, 0.4352},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{-0.1641, 0.9682, 0.1890, 0.4352},
-	{0.3552, 0.9198, 0.1667, 0.4246},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.3552, 0.9198, 0.1668, 0.4246},
-	{0.1641, 0.9682, 0.1890, 0.4352},
-	{0.7116, 0.6948, 0.1040, 0.4388},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{0.3552, 0.9198, 0.1667, 0.4246},
-	{0.4818, 0.8730, -0.0763, 0.3731},
-	{0.4818, 0.8730, -0.0763, 0.3731},
-	{0.1309, 0.8448, -0.5188, 0.3709},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.1309, 0.8448, -0.5188, 0.3709},
-	{-0.4818, 0.8730, -0.0763, 0.3731},
-	{0.4818, 0.8730, -0.0763, 0.3731},
-	{0.2849, 0.9584, -0.0153, 0.3503},
-	{0.1309, 0.8448, -0.5188, 0.3709},
-	{0.9463, 0.2917, 0.1390, 0.3222},
-	{0.7466, 0.6606, -0.0794, 0.3025},
-	{0.6245, 0.7636, 0.1642, 0.3358},
-	{-0.6245, 0.7636, 0.1642, 0.3358},
-	{-0.7465, 0.6606, -0.0794, 0.3078},
-	{-0.9463, 0.2917, 0.1390, 0.3222},
-	{0.8954, -0.4265, 0.1278, 0.9436},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{0.9843, 0.0991, -0.1464, 0.9259},
-	{0.9698, -0.1445, 0.1964, 0.2997},
-	{0.9843, 0.0991, -0.1464, 0.2863},
-	{0.7466, 0.6606, -0.0794, 0.3025},
-	{-0.9843, 0.0975, -0.1470, 0.9282},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.8956, -0.4264, 0.1265, 0.9447},
-	{-0.9698, -0.1445, 0.1963, 0.2997},
-	{-0.9463, 0.2917, 0.1390, 0.3222},
-	{-0.7465, 0.6606, -0.0794, 0.3078},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{0.8954, -0.4265, 0.1278, 0.9436},
-	{-0.6907, -0.6884, 0.2215, 0.9466},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.8956, -0.4264, 0.1265, 0.9447},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.6213, -0.7809, 0.0653, 0.9094},
-	{0.6827, -0.6972, 0.2184, 0.9473},
-	{-0.4587, -0.8449, 0.2751, 0.9483},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{0.2886, -0.8120, -0.5072, 0.0862},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{0.0007, -0.8700, -0.4930, 0.1039},
-	{0.2886, -0.8120, -0.5072, 0.0862},
-	{0.6347, -0.7348, -0.2394, 0.0698},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.6336, -0.7351, -0.2410, 0.1380},
-	{-0.2905, -0.8110, -0.5078, 0.1215},
-	{-0.2905, -0.8110, -0.5078, 0.1215},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{-0.0102, -0.3550, -0.9348, 0.1048},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{0.1802, -0.6504, -0.7379, 0.0605},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{0.1802, -0.6504, -0.7379, 0.0605},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{0.6820, -0.7049, -0.1951, 0.0453},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{0.1802, -0.6504, -0.7379, 0.0605},
-	{0.1802, -0.6504, -0.7379, 0.0605},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{0.6820, -0.7049, -0.1951, 0.0453},
-	{-0.2104, -0.9663, -0.1486, 0.1487},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.6820, -0.7049, -0.1951, 0.0453},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.4546, -0.1626, -0.8757, 0.1557},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.7645, -0.6395, 0.0814, 0.1677},
-	{-0.9425, -0.0528, 0.3301, 0.1801},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.9895, 0.1155, -0.0868, 0.0156},
-	{0.9691, 0.1927, 0.1540, 0.0063},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.7890, 0.0896, -0.6079, 0.1665},
-	{-0.4546, -0.1626, -0.8757, 0.1557},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.9425, -0.0528, 0.3301, 0.1801},
-	{-0.9691, 0.1927, 0.1540, 0.2015},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{-0.4546, -0.1626, -0.8757, 0.1557},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{0.8708, -0.4906, -0.0316, 0.0538},
-	{0.9239, -0.0279, -0.3817, 0.0369},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.7890, 0.0896, -0.6079, 0.1665},
-	{-0.9600, -0.0572, -0.2741, 0.1729},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.8684, -0.4956, -0.0136, 0.1540},
-	{-0.6336, -0.7351, -0.2410, 0.1380},
-	{-0.9886, 0.1158, -0.0964, 0.1922},
-	{-0.9600, -0.0572, -0.2741, 0.1729},
-	{-0.7890, 0.0896, -0.6079, 0.1665},
-	{-0.9886, 0.1158, -0.0964, 0.9223},
-	{-0.9669, -0.0935, 0.2376, 0.9434},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{0.9239, -0.0279, -0.3817, 0.9007},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{0.9895, 0.1155, -0.0868, 0.9254},
-	{-0.9886, 0.1158, -0.0964, 0.9223},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{-0.9600, -0.0572, -0.2741, 0.8977},
-	{-0.9886, 0.1158, -0.0964, 0.1922},
-	{-0.9691, 0.1927, 0.1540, 0.2015},
-	{-0.9669, -0.0935, 0.2376, 0.2071},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{0.5621, -0.7368, 0.3757, 0.9572},
-	{0.9522, -0.1345, 0.2741, 0.9464},
-	{0.9522, -0.1345, 0.2741, 0.9464},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{-0.7182, -0.5605, 0.4123, 0.9351},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{-0.9669, -0.0935, 0.2376, 0.9434},
-	{-0.9669, -0.0935, 0.2376, 0.9434},
-	{-0.5658, -0.7392, 0.3653, 0.9542},
-	{-0.7182, -0.5605, 0.4123, 0.9351},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{-0.5658, -0.7392, 0.3653, 0.9542},
-	{-0.4587, -0.8449, 0.2751, 0.9483},
-	{0.0000, -0.5189, -0.8549, 0.6509},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.2854, -0.7011, -0.6534, 0.6279},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{0.0000, -0.5189, -0.8549, 0.6509},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{0.0000, -0.5189, -0.8549, 0.6509},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{0.2854, -0.7011, -0.6534, 0.6279},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.2854, -0.7011, -0.6534, 0.6279},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.2774, -0.9261, -0.2556, 0.5609},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.2854, -0.7011, -0.6534, 0.6264},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{0.2774, -0.9261, -0.2556, 0.5609},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{0.6347, -0.7348, -0.2394, 0.4483},
-	{0.2886, -0.8120, -0.5072, 0.4458},
-	{0.2886, -0.8120, -0.5072, 0.4458},
-	{0.0007, -0.8700, -0.4930, 0.4448},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{-0.2905, -0.8110, -0.5078, 0.4443},
-	{-0.6336, -0.7351, -0.2410, 0.4456},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.2774, -0.9261, -0.2556, 0.5592},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{0.0007, -0.8700, -0.4930, 0.4448},
-	{-0.2905, -0.8110, -0.5078, 0.4443},
-	{-0.8684, -0.4956, -0.0136, 0.8694},
-	{-0.9600, -0.0572, -0.2741, 0.8977},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.6213, -0.7809, 0.0653, 0.9094},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.9868, -0.1349, 0.0898, 0.8358},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{-0.6758, -0.7278, 0.1169, 0.8269},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.9870, -0.1319, 0.0915, 0.8352},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{0.0000, 0.3278, -0.9448, 0.7301},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{0.0000, 0.3278, -0.9448, 0.7301},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{0.0210, 0.8346, 0.5504, 0.8982},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.1342, 0.9481, 0.2881, 0.8668},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{-0.3728, 0.9104, 0.1794, 0.8514},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{0.0210, 0.8346, 0.5504, 0.8982},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{0.3839, 0.9065, 0.1759, 0.8519},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.1995, 0.8258, -0.5275, 0.7887},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{-0.1590, 0.9571, -0.2424, 0.8146},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.3728, 0.9104, 0.1794, 0.8514},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{0.1995, 0.8258, -0.5275, 0.7887},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{0.0000, 0.3278, -0.9448, 0.7301},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{-0.2775, 0.6025, -0.7483, 0.7587},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{0.0000, 0.3278, -0.9448, 0.7301},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{0.7466, 0.6606, -0.0794, 0.9236},
-	{-0.7465, 0.6606, -0.0794, 0.9275},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{-0.8217, 0.4645, 0.3301, 0.8518},
-	{-0.8853, 0.4604, 0.0650, 0.8244},
-	{-0.8217, 0.4645, 0.3301, 0.8518},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.7520, 0.6570, 0.0533, 0.8271},
-	{0.7520, 0.6570, 0.0533, 0.8271},
-	{0.8518, 0.4761, 0.2186, 0.8409},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.8016, 0.3525, -0.4829, 0.7706},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.8853, 0.4604, 0.0650, 0.8244},
-	{-0.7416, 0.6671, 0.0712, 0.8258},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.8016, 0.3525, -0.4829, 0.7706},
-	{0.4561, 0.1592, -0.8756, 0.7238},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{0.8016, 0.3525, -0.4829, 0.7706},
-	{-0.7770, 0.3900, -0.4941, 0.7701},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{-0.6532, 0.2696, -0.7076, 0.7472},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.6169, -0.0123, -0.7869, 0.7195},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.6532, 0.2696, -0.7076, 0.7472},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.6476, 0.0698, -0.7588, 0.7180},
-	{-0.6532, 0.2696, -0.7076, 0.7472},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.3839, 0.9065, 0.1759, 0.8519},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{0.7520, 0.6570, 0.0533, 0.8271},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.3728, 0.9104, 0.1794, 0.8514},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.7416, 0.6671, 0.0712, 0.8258},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.3585, 0.7545, 0.5497, 0.9436},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.3585, 0.7545, 0.5497, 0.9437},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{0.2849, 0.9584, -0.0153, 0.9560},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{0.3585, 0.7545, 0.5497, 0.9436},
-	{-0.2849, 0.9584, -0.0153, 0.3502},
-	{-0.7465, 0.6606, -0.0794, 0.3078},
-	{-0.6245, 0.7636, 0.1642, 0.3358},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.0622, 0.9063, 0.4180, 0.9768},
-	{0.3585, 0.7545, 0.5497, 0.9436},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.3585, 0.7545, 0.5497, 0.9437},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.0210, 0.8346, 0.5504, 0.8982},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{-0.3923, 0.9135, 0.1074, 0.4029},
-	{-0.2901, 0.5476, -0.7848, 0.4120},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{-0.2901, 0.5476, -0.7848, 0.4120},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{0.1309, 0.8448, -0.5188, 0.3709},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{0.2901, 0.5476, -0.7848, 0.4120},
-	{0.4016, 0.9100, 0.1027, 0.4029},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{-0.1309, 0.8448, -0.5188, 0.3709},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{0.1309, 0.8448, -0.5188, 0.3709},
-	{0.2849, 0.9584, -0.0153, 0.3503},
-	{0.0622, 0.9063, 0.4180, 0.9768},
-	{0.2849, 0.9584, -0.0153, 0.9560},
-	{0.3585, 0.7545, 0.5497, 0.9436},
-	{0.0622, 0.9063, 0.4180, 0.9768},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{-0.3923, 0.9135, 0.1074, 0.9913},
-	{-0.2849, 0.9584, -0.0153, 0.3502},
-	{-0.1309, 0.8448, -0.5188, 0.3709},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{-0.0622, 0.9063, 0.4180, 0.3811},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{0.4016, 0.9100, 0.1027, 0.4029},
-	{0.4016, 0.9100, 0.1027, 0.9913},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{-0.0622, 0.9063, 0.4180, 0.9768},
-	{0.1767, 0.8842, 0.4325, 0.4094},
-	{-0.3475, 0.8393, 0.4180, 0.4095},
-	{-0.3923, 0.9135, 0.1074, 0.4029},
-	{0.1767, 0.8842, 0.4325, 0.9996},
-	{-0.3923, 0.9135, 0.1074, 0.9913},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{0.9843, 0.0991, -0.1464, 0.9259},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{0.9868, -0.1349, 0.0898, 0.8358},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.9870, -0.1319, 0.0915, 0.8352},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.7465, 0.6606, -0.0794, 0.9275},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{0.9868, -0.1349, 0.0898, 0.8358},
-	{0.9868, -0.1349, 0.0898, 0.8358},
-	{0.9983, -0.0136, 0.0573, 0.7916},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{-0.8217, 0.4645, 0.3301, 0.8518},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.9980, -0.0122, 0.0622, 0.7901},
-	{-0.9870, -0.1319, 0.0915, 0.8352},
-	{0.9983, -0.0136, 0.0573, 0.7916},
-	{0.8277, 0.4980, 0.2587, 0.7777},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.8242, 0.5033, 0.2595, 0.7705},
-	{-0.9980, -0.0122, 0.0622, 0.7901},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.8217, 0.4645, 0.3301, 0.8518},
-	{-0.8853, 0.4604, 0.0650, 0.8244},
-	{0.4324, 0.7903, -0.4341, 0.7546},
-	{0.4561, 0.1592, -0.8756, 0.7238},
-	{0.8016, 0.3525, -0.4829, 0.7706},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.8518, 0.4761, 0.2186, 0.8409},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{0.8277, 0.4980, 0.2587, 0.7777},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.8853, 0.4604, 0.0650, 0.8244},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.7770, 0.3900, -0.4941, 0.7701},
-	{-0.6476, 0.0698, -0.7588, 0.7180},
-	{-0.3819, 0.7891, -0.4812, 0.7482},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.3819, 0.7891, -0.4812, 0.7482},
-	{-0.8242, 0.5033, 0.2595, 0.7705},
-	{0.5778, -0.8130, 0.0714, 0.5095},
-	{0.6347, -0.7348, -0.2394, 0.4483},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.4199, -0.8912, -0.1718, 0.5722},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.6336, -0.7351, -0.2410, 0.4456},
-	{-0.5731, -0.8148, 0.0879, 0.5073},
-	{0.5778, -0.8130, 0.0714, 0.5095},
-	{0.5522, -0.8179, -0.1618, 0.5760},
-	{0.3830, -0.9189, -0.0949, 0.5811},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.6758, -0.7278, 0.1169, 0.8269},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{0.6342, -0.7158, 0.2922, 0.8977},
-	{0.5778, -0.8130, 0.0714, 0.8205},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{-0.7214, -0.6523, 0.2326, 0.8954},
-	{0.6342, -0.7158, 0.2922, 0.8977},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{0.8708, -0.4906, -0.0316, 0.8721},
-	{-0.8684, -0.4956, -0.0136, 0.8694},
-	{-0.7214, -0.6523, 0.2326, 0.8954},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{-0.8684, -0.4956, -0.0136, 0.8694},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{-0.6336, -0.7351, -0.2410, 0.8510},
-	{-0.8684, -0.4956, -0.0136, 0.8694},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{-0.7214, -0.6523, 0.2326, 0.8954},
-	{0.6169, -0.0123, -0.7869, 0.7195},
-	{0.4561, 0.1592, -0.8756, 0.7238},
-	{0.3925, -0.2182, -0.8935, 0.6842},
-	{-0.4706, -0.5801, -0.6648, 0.6484},
-	{-0.1436, -0.5862, -0.7973, 0.6442},
-	{-0.3501, -0.2227, -0.9099, 0.6798},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{0.6169, -0.0123, -0.7869, 0.7195},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.4880, -0.5736, -0.6579, 0.6532},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.4706, -0.5801, -0.6648, 0.6484},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{0.0783, -0.9236, -0.3753, 0.6163},
-	{0.2197, -0.9745, 0.0460, 0.5859},
-	{0.3830, -0.9189, -0.0949, 0.5811},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{0.3830, -0.9189, -0.0949, 0.5811},
-	{0.5522, -0.8179, -0.1618, 0.5760},
-	{-0.4199, -0.8912, -0.1718, 0.5722},
-	{-0.2686, -0.9621, 0.0460, 0.5803},
-	{-0.0584, -0.9211, -0.3849, 0.6115},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.0584, -0.9211, -0.3849, 0.6115},
-	{-0.1436, -0.5862, -0.7973, 0.6442},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.4880, -0.5736, -0.6579, 0.6532},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{0.5522, -0.8179, -0.1618, 0.5760},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.4706, -0.5801, -0.6648, 0.6484},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{-0.3009, 0.1748, 0.9375, 0.1367},
-	{-0.5352, 0.4245, 0.7303, 0.1401},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{0.5352, 0.4245, 0.7303, 0.3326},
-	{0.3009, 0.1748, 0.9375, 0.3329},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{0.3009, 0.1748, 0.9375, 0.3329},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{-0.0982, 0.7947, 0.5989, 0.1450},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{0.0982, 0.7947, 0.5989, 0.3326},
-	{0.5352, 0.4245, 0.7303, 0.3326},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.6098, -0.6981, 0.3754, 0.3371},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{-0.3009, 0.1748, 0.9375, 0.1367},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{0.3009, 0.1748, 0.9375, 0.3329},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{0.3009, 0.1748, 0.9375, 0.3329},
-	{0.5352, 0.4245, 0.7303, 0.3326},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{0.7968, -0.4805, 0.3664, 0.1222},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{0.6496, -0.7498, 0.1254, 0.2395},
-	{0.2197, -0.9745, 0.0460, 0.2537},
-	{0.4746, -0.6731, 0.5671, 0.2157},
-	{0.4746, -0.6731, 0.5671, 0.2157},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{0.9280, -0.3717, 0.0269, 0.1756},
-	{-0.9284, -0.3704, 0.0307, 0.2735},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{-0.3618, -0.6132, 0.7022, 0.3089},
-	{-0.2686, -0.9621, 0.0460, 0.7594},
-	{-0.6758, -0.7278, 0.1169, 0.8269},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{-0.3618, -0.6132, 0.7022, 0.7660},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{-0.9284, -0.3704, 0.0307, 0.7863},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{-0.3618, -0.6132, 0.7022, 0.3089},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.9983, -0.0136, 0.0573, 0.7916},
-	{0.9868, -0.1349, 0.0898, 0.8358},
-	{-0.9870, -0.1319, 0.0915, 0.8352},
-	{-0.9980, -0.0122, 0.0622, 0.7901},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{0.4845, 0.6364, 0.6002, 0.1623},
-	{-0.4845, 0.6365, 0.6001, 0.3060},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{-0.4845, 0.6365, 0.6001, 0.3060},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{-0.9180, 0.0041, 0.3965, 0.2900},
-	{0.7968, -0.4805, 0.3664, 0.1222},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.7969, -0.4805, 0.3661, 0.2864},
-	{0.8407, -0.1550, 0.5188, 0.7759},
-	{0.8277, 0.4980, 0.2587, 0.7777},
-	{0.9983, -0.0136, 0.0573, 0.7916},
-	{-0.9980, -0.0122, 0.0622, 0.2534},
-	{-0.8242, 0.5033, 0.2595, 0.2918},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{0.9280, -0.3717, 0.0269, 0.1756},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{-0.9284, -0.3704, 0.0307, 0.2735},
-	{-0.9980, -0.0122, 0.0622, 0.2534},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{0.9280, -0.3717, 0.0269, 0.1756},
-	{-0.9284, -0.3704, 0.0307, 0.2735},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{0.7968, -0.4805, 0.3664, 0.1222},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{-0.7969, -0.4805, 0.3661, 0.2864},
-	{0.7968, -0.4805, 0.3664, 0.1222},
-	{0.9180, 0.0041, 0.3965, 0.1375},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{-0.9180, 0.0041, 0.3965, 0.2900},
-	{-0.7969, -0.4805, 0.3661, 0.2864},
-	{0.9180, 0.0041, 0.3965, 0.1375},
-	{0.4050, 0.1930, 0.8937, 0.1461},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{-0.4050, 0.1930, 0.8937, 0.3063},
-	{-0.9180, 0.0041, 0.3965, 0.2900},
-	{0.4050, 0.1930, 0.8937, 0.1461},
-	{0.9180, 0.0041, 0.3965, 0.1375},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.4709, 0.5525, 0.6878, 0.1536},
-	{0.4050, 0.1930, 0.8937, 0.1461},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.4845, 0.6364, 0.6002, 0.1623},
-	{0.4709, 0.5525, 0.6878, 0.1536},
-	{-0.4709, 0.5525, 0.6878, 0.3095},
-	{-0.4845, 0.6365, 0.6001, 0.3060},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{0.4709, 0.5525, 0.6878, 0.1536},
-	{0.4845, 0.6364, 0.6002, 0.1623},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{0.4774, -0.4854, 0.7324, 0.1263},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.4774, -0.4854, 0.7324, 0.1263},
-	{-0.4774, -0.4853, 0.7325, 0.3234},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{-0.6201, 0.0707, 0.7813, 0.1347},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{-0.5352, 0.4245, 0.7303, 0.1401},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{0.5352, 0.4245, 0.7303, 0.3326},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{-0.0982, 0.7947, 0.5989, 0.1450},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{-0.0982, 0.7947, 0.5989, 0.1450},
-	{-0.5352, 0.4245, 0.7303, 0.1401},
-	{0.0982, 0.7947, 0.5989, 0.3326},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{0.2791, -0.0376, 0.9595, 0.1262},
-	{0.4774, -0.4854, 0.7324, 0.1263},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.2791, -0.0376, 0.9595, 0.1262},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{0.2791, -0.0376, 0.9595, 0.1262},
-	{-0.2791, -0.0376, 0.9595, 0.3069},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{-0.4050, 0.1930, 0.8937, 0.3063},
-	{-0.4709, 0.5525, 0.6878, 0.3095},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{0.6201, 0.0707, 0.7813, 0.3304},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{-0.6201, 0.0707, 0.7813, 0.1347},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{0.6201, 0.0707, 0.7813, 0.3304},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.4774, -0.4853, 0.7325, 0.3234},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.0542, -0.9615, -0.2692, 0.1932},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{-0.0542, -0.9615, -0.2692, 0.1932},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{0.0497, -0.9630, -0.2650, 0.3502},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{0.4764, -0.8091, -0.3440, 0.1466},
-	{0.7359, -0.6604, -0.1494, 0.1406},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.6098, -0.6981, 0.3754, 0.1471},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{0.4764, -0.8091, -0.3440, 0.1466},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{0.4550, -0.3842, -0.8033, 0.1394},
-	{0.7359, -0.6604, -0.1494, 0.1406},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{-0.6098, -0.6981, 0.3754, 0.3371},
-	{-0.4764, -0.8091, -0.3440, 0.3395},
-	{-0.6098, -0.6981, 0.3754, 0.3371},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.7359, -0.6604, -0.1494, 0.3372},
-	{-0.4551, -0.3842, -0.8033, 0.3378},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.9901, 0.1400, 0.0124, 0.1344},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.7359, -0.6604, -0.1494, 0.1406},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.7359, -0.6604, -0.1494, 0.1406},
-	{0.4550, -0.3842, -0.8033, 0.1394},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.7288, -0.1367, -0.6710, 0.1363},
-	{0.9901, 0.1400, 0.0124, 0.1344},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.7288, -0.1367, -0.6710, 0.3363},
-	{-0.4551, -0.3842, -0.8033, 0.3378},
-	{-0.7359, -0.6604, -0.1494, 0.3372},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{-0.9901, 0.1400, 0.0124, 0.3350},
-	{0.3199, 0.8419, -0.4346, 0.1308},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.6267, 0.3578, -0.6923, 0.1335},
-	{0.1313, 0.4319, -0.8923, 0.1324},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.9901, 0.1400, 0.0124, 0.3350},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.3199, 0.8419, -0.4346, 0.3346},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.3199, 0.8419, -0.4346, 0.3346},
-	{-0.1313, 0.4319, -0.8923, 0.3358},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{0.3199, 0.8419, -0.4346, 0.1308},
-	{0.1313, 0.4319, -0.8923, 0.1324},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{-0.1313, 0.4319, -0.8923, 0.3358},
-	{-0.3199, 0.8419, -0.4346, 0.3346},
-	{0.2361, 0.8611, -0.4504, 0.3344},
-	{-0.3199, 0.8419, -0.4346, 0.3346},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{0.2361, 0.8611, -0.4504, 0.3344},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{0.4324, 0.7903, -0.4341, 0.0836},
-	{0.8277, 0.4980, 0.2587, 0.0651},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{-0.8242, 0.5033, 0.2595, 0.2918},
-	{-0.3819, 0.7891, -0.4812, 0.3370},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{-0.3646, -0.0171, -0.9310, 0.1417},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{-0.3646, -0.0171, -0.9310, 0.1417},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{0.1571, -0.0687, -0.9852, 0.3856},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.3545, -0.0268, -0.9347, 0.3493},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{-0.3646, -0.0171, -0.9310, 0.1417},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{0.1313, 0.4319, -0.8923, 0.1324},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{-0.4551, -0.3842, -0.8033, 0.3378},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{-0.1313, 0.4319, -0.8923, 0.3358},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{0.1313, 0.4319, -0.8923, 0.1324},
-	{0.6267, 0.3578, -0.6923, 0.1335},
-	{0.7288, -0.1367, -0.6710, 0.1363},
-	{0.6267, 0.3578, -0.6923, 0.1335},
-	{0.9901, 0.1400, 0.0124, 0.1344},
-	{0.7288, -0.1367, -0.6710, 0.1363},
-	{0.4550, -0.3842, -0.8033, 0.1394},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{-0.4551, -0.3842, -0.8033, 0.3378},
-	{-0.7288, -0.1367, -0.6710, 0.3363},
-	{-0.6267, 0.3578, -0.6923, 0.3355},
-	{-0.1313, 0.4319, -0.8923, 0.3358},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{-0.3819, 0.7891, -0.4812, 0.3370},
-	{-0.6476, 0.0698, -0.7588, 0.3923},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{0.4561, 0.1592, -0.8756, 0.1191},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{0.3925, -0.2182, -0.8935, 0.1760},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{0.3925, -0.2182, -0.8935, 0.1760},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{0.4880, -0.5736, -0.6579, 0.2440},
-	{-0.3501, -0.2227, -0.9099, 0.4093},
-	{-0.1436, -0.5862, -0.7973, 0.4085},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{-0.3501, -0.2227, -0.9099, 0.4093},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{-0.6476, 0.0698, -0.7588, 0.3923},
-	{0.0783, -0.9236, -0.3753, 0.2585},
-	{0.4880, -0.5736, -0.6579, 0.2440},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{0.0783, -0.9236, -0.3753, 0.2585},
-	{-0.0542, -0.9615, -0.2692, 0.1932},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{-0.0584, -0.9211, -0.3849, 0.3879},
-	{0.0497, -0.9630, -0.2650, 0.3502},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{-0.0584, -0.9211, -0.3849, 0.3879},
-	{-0.2686, -0.9621, 0.0460, 0.3361},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{0.3694, -0.8743, 0.3148, 0.2956},
-	{0.6641, -0.3854, 0.6407, 0.3016},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{-0.7645, -0.6395, 0.0814, 0.1870},
-	{-0.6461, -0.3589, 0.6736, 0.1975},
-	{-0.9425, -0.0528, 0.3301, 0.1834},
-	{-0.3367, -0.7767, 0.5324, 0.2072},
-	{-0.6461, -0.3589, 0.6736, 0.1975},
-	{-0.7645, -0.6395, 0.0814, 0.1870},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{-0.9425, -0.0528, 0.3301, 0.1834},
-	{-0.6461, -0.3589, 0.6736, 0.1975},
-	{0.9420, -0.0755, 0.3271, 0.3156},
-	{0.7215, 0.0855, 0.6871, 0.3005},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{-0.9425, -0.0528, 0.3301, 0.1834},
-	{-0.7145, 0.0872, 0.6942, 0.1986},
-	{-0.9691, 0.1927, 0.1540, 0.1759},
-	{-0.4587, -0.8449, 0.2751, 0.1282},
-	{-0.5658, -0.7392, 0.3653, 0.1818},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{0.4720, -0.8366, 0.2782, 0.3709},
-	{0.6827, -0.6972, 0.2184, 0.4087},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{0.4720, -0.8366, 0.2782, 0.3709},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{0.6827, -0.6972, 0.2184, 0.4087},
-	{0.9698, -0.1445, 0.1964, 0.4368},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.9698, -0.1445, 0.1963, 0.0623},
-	{-0.6907, -0.6884, 0.2215, 0.0904},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.9698, -0.1445, 0.1964, 0.4368},
-	{0.9463, 0.2917, 0.1390, 0.4333},
-	{0.9698, -0.1445, 0.1964, 0.4368},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{-0.9698, -0.1445, 0.1963, 0.0623},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{-0.9698, -0.1445, 0.1963, 0.0623},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.6245, 0.7636, 0.1642, 0.0756},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.4818, 0.8730, -0.0763, 0.1189},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.4818, 0.8730, -0.0763, 0.3803},
-	{0.6805, 0.2206, 0.6988, 0.4159},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{-0.4818, 0.8730, -0.0763, 0.1189},
-	{-0.6805, 0.2208, 0.6987, 0.0832},
-	{-0.0592, 0.6725, 0.7377, 0.3127},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{-0.1641, 0.9682, 0.1890, 0.3134},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.0592, 0.6725, 0.7377, 0.3127},
-	{-0.7148, 0.6910, 0.1077, 0.2963},
-	{-0.0592, 0.6725, 0.7377, 0.3127},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.0288, 0.1763, 0.9839, 0.3084},
-	{-0.0592, 0.6725, 0.7377, 0.3127},
-	{-0.0288, 0.1763, 0.9839, 0.3084},
-	{0.3562, 0.6127, 0.7055, 0.3258},
-	{0.0562, 0.6667, 0.7432, 0.1865},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{0.5263, 0.4725, 0.7069, 0.2001},
-	{0.1641, 0.9682, 0.1890, 0.1858},
-	{0.0562, 0.6667, 0.7432, 0.1865},
-	{0.7116, 0.6948, 0.1040, 0.2029},
-	{0.0562, 0.6667, 0.7432, 0.1865},
-	{0.1641, 0.9682, 0.1890, 0.1858},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{0.0562, 0.6667, 0.7432, 0.1865},
-	{-0.3537, 0.6111, 0.7081, 0.1733},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.7206, 0.6925, 0.0350, 0.2596},
-	{-0.5282, 0.4831, 0.6983, 0.2990},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{0.5263, 0.4725, 0.7069, 0.2001},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{0.6208, 0.6690, 0.4088, 0.2380},
-	{0.7116, 0.6948, 0.1040, 0.2029},
-	{0.5263, 0.4725, 0.7069, 0.2001},
-	{0.6208, 0.6690, 0.4088, 0.2380},
-	{0.6208, 0.6690, 0.4088, 0.2380},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{-0.2785, 0.6214, 0.7323, 0.2537},
-	{-0.0107, -0.0555, 0.9984, 0.2479},
-	{0.6208, 0.6690, 0.4088, 0.2380},
-	{0.0360, 0.0981, 0.9945, 0.1928},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{-0.0708, -0.0542, 0.9960, 0.2706},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{0.2397, 0.1250, 0.9628, 0.3240},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{0.2210, -0.2671, 0.9380, 0.3779},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{-0.2284, 0.1367, 0.9639, 0.1752},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{0.3698, -0.0753, 0.9261, 0.3972},
-	{0.2210, -0.2671, 0.9380, 0.3779},
-	{-0.4724, -0.3075, 0.8260, 0.0925},
-	{-0.2210, -0.2670, 0.9380, 0.1212},
-	{-0.3698, -0.0752, 0.9261, 0.1019},
-	{0.4723, -0.3076, 0.8260, 0.4066},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{0.3780, -0.4283, 0.8208, 0.3462},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{0.5587, -0.4588, 0.6909, 0.3921},
-	{-0.3783, -0.4288, 0.8204, 0.1529},
-	{-0.5587, -0.4588, 0.6909, 0.1070},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.3702, -0.5052, 0.7796, 0.3304},
-	{0.3780, -0.4283, 0.8208, 0.3462},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{-0.3783, -0.4288, 0.8204, 0.1529},
-	{-0.3714, -0.5061, 0.7784, 0.1686},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{-0.0889, -0.0647, 0.9939, 0.2832},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{0.0060, -0.0197, 0.9998, 0.2467},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{-0.0141, -0.9279, 0.3726, 0.2495},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{-0.0769, -0.1142, 0.9905, 0.2540},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{0.2799, -0.6192, 0.7336, 0.2828},
-	{0.6641, -0.3854, 0.6407, 0.3016},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{-0.6461, -0.3589, 0.6736, 0.1975},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{-0.1958, -0.5171, 0.8332, 0.2274},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{0.6872, -0.2919, 0.6652, 0.2759},
-	{0.5070, -0.1253, 0.8528, 0.2894},
-	{0.7215, 0.0855, 0.6871, 0.3005},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{-0.7145, 0.0872, 0.6942, 0.1986},
-	{-0.5094, -0.1179, 0.8524, 0.2097},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{0.1983, -0.3860, 0.9009, 0.2629},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{0.6148, 0.1251, 0.7787, 0.2655},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.2948, 0.8009, 0.5212, 0.2634},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.6148, 0.1251, 0.7787, 0.2655},
-	{0.6844, -0.3702, 0.6282, 0.2674},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.7506, -0.4303, 0.5014, 0.2313},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{-0.1334, 0.3497, 0.9273, 0.2330},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.5227, 0.7487, 0.4078, 0.2343},
-	{0.2948, 0.8009, 0.5212, 0.2634},
-	{0.1960, 0.3715, 0.9075, 0.2674},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.1334, 0.3497, 0.9273, 0.2330},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{-0.2565, 0.7182, 0.6468, 0.2493},
-	{0.0091, 0.2761, 0.9611, 0.2495},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.2565, 0.7182, 0.6468, 0.2493},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{0.1139, 0.7524, 0.6488, 0.2410},
-	{-0.7506, -0.4303, 0.5014, 0.2313},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{-0.6388, 0.0203, 0.7691, 0.2342},
-	{-0.0845, -0.3780, 0.9219, 0.2438},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{-0.7506, -0.4303, 0.5014, 0.2313},
-	{-0.0040, -0.5615, 0.8275, 0.2494},
-	{0.6844, -0.3702, 0.6282, 0.2674},
-	{0.6148, 0.1251, 0.7787, 0.2655},
-	{0.1960, 0.3715, 0.9075, 0.2674},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.1334, 0.3497, 0.9273, 0.2330},
-	{-0.0177, 0.4780, 0.8782, 0.2498},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{0.1960, 0.3715, 0.9075, 0.2674},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.2036, -0.1843, 0.9615, 0.2821},
-	{-0.8054, -0.1672, 0.5687, 0.2099},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.1999, -0.1852, 0.9621, 0.2170},
-	{-0.8262, -0.0938, 0.5555, 0.2216},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{-0.6178, -0.3317, 0.7130, 0.2253},
-	{-0.7145, 0.0872, 0.6942, 0.1986},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{-0.9691, 0.1927, 0.1540, 0.1759},
-	{0.8677, -0.0387, 0.4956, 0.2792},
-	{0.8322, 0.2332, 0.5030, 0.2987},
-	{0.9522, -0.1345, 0.2741, 0.3221},
-	{-0.9669, -0.0935, 0.2376, 0.1770},
-	{-0.8054, -0.1672, 0.5687, 0.2099},
-	{-0.5658, -0.7392, 0.3653, 0.1818},
-	{-0.8054, -0.1672, 0.5687, 0.2099},
-	{-0.9669, -0.0935, 0.2376, 0.1770},
-	{-0.8322, 0.1601, 0.5308, 0.2004},
-	{0.3676, 0.4515, 0.8131, 0.2444},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{-0.2121, 0.5488, 0.8086, 0.2532},
-	{0.3676, 0.4515, 0.8131, 0.2444},
-	{0.6649, -0.1330, 0.7350, 0.2409},
-	{0.2272, 0.0512, 0.9725, 0.2407},
-	{-0.0240, -0.3544, 0.9348, 0.2644},
-	{-0.6030, -0.5567, 0.5715, 0.2586},
-	{-0.2933, -0.1149, 0.9491, 0.2652},
-	{0.6649, -0.1330, 0.7350, 0.2409},
-	{0.3899, -0.7762, 0.4955, 0.2408},
-	{0.2927, -0.2774, 0.9151, 0.2328},
-	{0.3899, -0.7762, 0.4955, 0.2408},
-	{-0.6030, -0.5567, 0.5715, 0.2586},
-	{0.0404, -0.4472, 0.8935, 0.2364},
-	{0.6649, -0.1330, 0.7350, 0.2409},
-	{0.3676, 0.4515, 0.8131, 0.2444},
-	{-0.5704, 0.1059, 0.8145, 0.2575},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{0.0893, -0.0798, 0.9928, 0.2180},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.1437, -0.1752, 0.9740, 0.3014},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.1571, -0.1714, 0.9726, 0.1978},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{0.3780, -0.4283, 0.8208, 0.3462},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{0.3842, -0.2200, 0.8967, 0.3945},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.2210, -0.2670, 0.9380, 0.1212},
-	{-0.3840, -0.2200, 0.8967, 0.1047},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{0.3183, 0.0830, 0.9443, 0.3429},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.3183, 0.0829, 0.9443, 0.1562},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{-0.2210, -0.2670, 0.9380, 0.1212},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.2119, -0.0069, 0.9773, 0.1575},
-	{0.3183, 0.0830, 0.9443, 0.3429},
-	{0.2119, -0.0068, 0.9773, 0.3416},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{0.1828, -0.1239, 0.9753, 0.3208},
-	{0.1579, -0.2129, 0.9642, 0.2804},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{-0.1128, 0.0101, 0.9936, 0.1826},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{-0.3722, -0.6633, 0.6492, 0.1897},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{-0.1128, 0.0101, 0.9936, 0.1826},
-	{0.1119, -0.3708, 0.9219, 0.3410},
-	{0.3183, 0.0830, 0.9443, 0.3429},
-	{0.1128, 0.0101, 0.9936, 0.3165},
-	{-0.1821, -0.1236, 0.9755, 0.1783},
-	{-0.3183, 0.0829, 0.9443, 0.1562},
-	{-0.1128, 0.0101, 0.9936, 0.1826},
-	{0.1119, -0.3708, 0.9219, 0.3410},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.3183, 0.0830, 0.9443, 0.3429},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.1119, -0.3708, 0.9219, 0.3410},
-	{-0.2499, -0.9645, 0.0856, 0.3548},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{0.2500, -0.9645, 0.0856, 0.1443},
-	{-0.1118, -0.3710, 0.9219, 0.1581},
-	{0.2500, -0.9645, 0.0856, 0.1443},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{0.0343, -0.6586, 0.7517, 0.1342},
-	{-0.6638, -0.0229, 0.7475, 0.3711},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{0.2719, -0.1159, 0.9553, 0.3731},
-	{0.6638, -0.0229, 0.7475, 0.1280},
-	{-0.2719, -0.1159, 0.9553, 0.1260},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{-0.5052, 0.7758, 0.3779, 0.3554},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{-0.0760, 0.2579, 0.9632, 0.3680},
-	{0.2110, -0.0050, 0.9775, 0.3737},
-	{-0.5052, 0.7758, 0.3779, 0.3554},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{-0.2109, -0.0050, 0.9775, 0.1254},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{0.5053, 0.7758, 0.3779, 0.1437},
-	{-0.0364, 0.4930, 0.8693, 0.1566},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.1926, 0.9813, 0.0062, 0.1718},
-	{0.1230, -0.0073, 0.9924, 0.3029},
-	{0.2291, -0.1150, 0.9666, 0.3411},
-	{0.1926, 0.9813, 0.0034, 0.3273},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{-0.1926, 0.9813, 0.0062, 0.1718},
-	{-0.2309, -0.1132, 0.9664, 0.1580},
-	{-0.1926, 0.9813, 0.0062, 0.1718},
-	{-0.1092, -0.0163, 0.9939, 0.1962},
-	{-0.3673, 0.3496, 0.8619, 0.1910},
-	{0.6676, -0.2781, 0.6906, 0.3012},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{0.6069, -0.1567, 0.7792, 0.2977},
-	{0.1301, -0.0821, 0.9881, 0.2913},
-	{0.6676, -0.2781, 0.6906, 0.3012},
-	{0.2331, -0.0924, 0.9681, 0.3013},
-	{-0.1310, -0.0841, 0.9878, 0.2078},
-	{-0.2345, -0.0937, 0.9676, 0.1978},
-	{-0.6676, -0.2781, 0.6906, 0.1979},
-	{-0.7206, 0.6925, 0.0350, 0.4332},
-	{-0.3475, 0.8393, 0.4180, 0.4095},
-	{-0.0177, 0.9875, 0.1568, 0.4325},
-	{-0.3475, 0.8393, 0.4180, 0.4095},
-	{-0.7206, 0.6925, 0.0350, 0.4332},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{0.1767, 0.8842, 0.4325, 0.4094},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.6208, 0.6690, 0.4088, 0.4332},
-	{-0.7148, 0.6910, 0.1077, 0.4388},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{-0.7206, 0.6925, 0.0350, 0.4332},
-	{-0.7361, 0.6157, -0.2811, 0.4206},
-	{-0.7148, 0.6910, 0.1077, 0.4388},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.2901, 0.5476, -0.7848, 0.4120},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{0.7116, 0.6948, 0.1040, 0.4388},
-	{0.2901, 0.5476, -0.7848, 0.4120},
-	{0.7277, 0.6400, -0.2465, 0.4206},
-	{0.4016, 0.9100, 0.1027, 0.4029},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{0.3552, 0.9198, 0.1667, 0.4246},
-	{-0.4149, 0.8145, -0.4055, 0.4240},
-	{0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.2901, 0.5476, -0.7848, 0.4120},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{0.2901, 0.5476, -0.7848, 0.4120},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{0.1641, 0.9682, 0.1890, 0.4352},
-	{0.4149, 0.8145, -0.4055, 0.4240},
-	{-0.3552, 0.9198, 0.1668, 0.4246},
-	{-0.3552, 0.9198, 0.1668, 0.4246},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.4818, 0.8730, -0.0763, 0.3731},
-	{0.4818, 0.8730, -0.0763, 0.3731},
-	{0.6245, 0.7636, 0.1642, 0.3358},
-	{0.2849, 0.9584, -0.0153, 0.3503},
-	{-0.4818, 0.8730, -0.0763, 0.3731},
-	{-0.2849, 0.9584, -0.0153, 0.3502},
-	{-0.6245, 0.7636, 0.1642, 0.3358},
-	{-0.2849, 0.9584, -0.0153, 0.3502},
-	{-0.4818, 0.8730, -0.0763, 0.3731},
-	{-0.1309, 0.8448, -0.5188, 0.3709},
-	{0.9698, -0.1445, 0.1964, 0.2997},
-	{0.8954, -0.4265, 0.1278, 0.2747},
-	{0.9843, 0.0991, -0.1464, 0.2863},
-	{0.9463, 0.2917, 0.1390, 0.3222},
-	{0.9698, -0.1445, 0.1964, 0.2997},
-	{0.7466, 0.6606, -0.0794, 0.3025},
-	{-0.9698, -0.1445, 0.1963, 0.9467},
-	{-0.9843, 0.0975, -0.1470, 0.9282},
-	{-0.8956, -0.4264, 0.1265, 0.9447},
-	{-0.9843, 0.0975, -0.1470, 0.9282},
-	{-0.9698, -0.1445, 0.1963, 0.9467},
-	{-0.7465, 0.6606, -0.0794, 0.9275},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.6827, -0.6972, 0.2184, 0.9473},
-	{0.6213, -0.7809, 0.0653, 0.9094},
-	{0.6827, -0.6972, 0.2184, 0.9473},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.8954, -0.4265, 0.1278, 0.9436},
-	{-0.6907, -0.6884, 0.2215, 0.9466},
-	{-0.8956, -0.4264, 0.1265, 0.9447},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{0.4720, -0.8366, 0.2782, 0.9502},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.6827, -0.6972, 0.2184, 0.9473},
-	{-0.4587, -0.8449, 0.2751, 0.9483},
-	{-0.6907, -0.6884, 0.2215, 0.9466},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{0.2886, -0.8120, -0.5072, 0.0862},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{-0.2905, -0.8110, -0.5078, 0.1215},
-	{0.0007, -0.8700, -0.4930, 0.1039},
-	{-0.0102, -0.3550, -0.9348, 0.1048},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{-0.0102, -0.3550, -0.9348, 0.1048},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.0101, -0.3643, -0.9312, 0.1042},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{0.1802, -0.6504, -0.7379, 0.0605},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{-0.0102, -0.3550, -0.9348, 0.1048},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{-0.0102, -0.3550, -0.9348, 0.1048},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{-0.0141, -0.9279, 0.3726, 0.1039},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{0.3694, -0.8743, 0.3148, 0.0557},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{-0.2104, -0.9663, -0.1486, 0.1487},
-	{-0.0377, -0.7496, -0.6608, 0.1128},
-	{-0.2104, -0.9663, -0.1486, 0.1487},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{-0.0141, -0.9279, 0.3726, 0.1039},
-	{0.6820, -0.7049, -0.1951, 0.0453},
-	{0.3694, -0.8743, 0.3148, 0.0557},
-	{0.0538, -0.9744, -0.2183, 0.0959},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{-0.2104, -0.9663, -0.1486, 0.1487},
-	{-0.7645, -0.6395, 0.0814, 0.1677},
-	{0.6820, -0.7049, -0.1951, 0.0453},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.9420, -0.0755, 0.3271, 0.0276},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{-0.7645, -0.6395, 0.0814, 0.1677},
-	{0.9420, -0.0755, 0.3271, 0.0276},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.9691, 0.1927, 0.1540, 0.0063},
-	{0.9239, -0.0279, -0.3817, 0.0369},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{0.8998, -0.1313, -0.4162, 0.0425},
-	{0.9239, -0.0279, -0.3817, 0.0369},
-	{0.9895, 0.1155, -0.0868, 0.0156},
-	{-0.9886, 0.1158, -0.0964, 0.1922},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.9691, 0.1927, 0.1540, 0.2015},
-	{-0.9104, -0.1224, -0.3953, 0.1653},
-	{-0.9886, 0.1158, -0.0964, 0.1922},
-	{-0.7890, 0.0896, -0.6079, 0.1665},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{0.9239, -0.0279, -0.3817, 0.0369},
-	{0.4690, -0.2151, -0.8566, 0.0518},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.4546, -0.1626, -0.8757, 0.1557},
-	{-0.7890, 0.0896, -0.6079, 0.1665},
-	{-0.4546, -0.1626, -0.8757, 0.1557},
-	{-0.1156, -0.2975, -0.9477, 0.1304},
-	{-0.4546, -0.6352, -0.6244, 0.1561},
-	{0.8708, -0.4906, -0.0316, 0.0538},
-	{0.5560, -0.2477, -0.7934, 0.0617},
-	{0.6347, -0.7348, -0.2394, 0.0698},
-	{-0.8684, -0.4956, -0.0136, 0.1540},
-	{-0.5762, -0.2376, -0.7820, 0.1461},
-	{-0.9600, -0.0572, -0.2741, 0.1729},
-	{0.9522, -0.1345, 0.2741, 0.9464},
-	{0.9895, 0.1155, -0.0868, 0.9254},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{0.9691, 0.1927, 0.1540, 0.0063},
-	{0.9895, 0.1155, -0.0868, 0.0156},
-	{0.9522, -0.1345, 0.2741, 0.0007},
-	{0.4720, -0.8366, 0.2782, 0.9502},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.5621, -0.7368, 0.3757, 0.9572},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{0.4720, -0.8366, 0.2782, 0.9502},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{-0.7182, -0.5605, 0.4123, 0.9351},
-	{-0.5658, -0.7392, 0.3653, 0.9542},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.2854, -0.7011, -0.6534, 0.6279},
-	{0.0000, -0.5189, -0.8549, 0.6509},
-	{0.2929, -0.4132, -0.8623, 0.6570},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{-0.2854, -0.7011, -0.6534, 0.6264},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.2854, -0.7011, -0.6534, 0.6264},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{0.0000, -0.7123, -0.7019, 0.6288},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{0.2854, -0.7011, -0.6534, 0.6279},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.2774, -0.9261, -0.2556, 0.5609},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{0.2864, -0.8346, -0.4706, 0.6014},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{-0.2774, -0.9261, -0.2556, 0.5592},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.2854, -0.7011, -0.6534, 0.6264},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{-0.2854, -0.7011, -0.6534, 0.6264},
-	{0.0000, -0.8656, -0.5008, 0.6023},
-	{-0.2774, -0.9261, -0.2556, 0.5592},
-	{-0.2864, -0.8346, -0.4706, 0.5998},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{0.2774, -0.9261, -0.2556, 0.5609},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{0.2886, -0.8120, -0.5072, 0.4458},
-	{0.2774, -0.9261, -0.2556, 0.5609},
-	{0.2886, -0.8120, -0.5072, 0.4458},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{-0.2774, -0.9261, -0.2556, 0.5592},
-	{-0.2905, -0.8110, -0.5078, 0.4443},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.2774, -0.9261, -0.2556, 0.5592},
-	{0.0000, -0.9565, -0.2916, 0.5602},
-	{-0.2905, -0.8110, -0.5078, 0.4443},
-	{0.9239, -0.0279, -0.3817, 0.9007},
-	{0.8708, -0.4906, -0.0316, 0.8721},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.7985, -0.5999, 0.0510, 0.9042},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.9516, -0.3069, -0.0172, 0.9079},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{-0.6758, -0.7278, 0.1169, 0.8269},
-	{-0.7981, -0.6004, 0.0505, 0.9046},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{-0.0000, -0.0065, -1.0000, 0.7017},
-	{-0.2929, -0.4132, -0.8623, 0.6558},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{0.0000, -0.2417, -0.9703, 0.6737},
-	{0.1342, 0.9481, 0.2881, 0.8668},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.3839, 0.9065, 0.1759, 0.8519},
-	{0.1342, 0.9481, 0.2881, 0.8668},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.1342, 0.9481, 0.2881, 0.8668},
-	{0.3839, 0.9065, 0.1759, 0.8519},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{0.1342, 0.9481, 0.2881, 0.8668},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{-0.3728, 0.9104, 0.1794, 0.8514},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{-0.0835, 0.9550, 0.2846, 0.8677},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{0.1239, 0.9923, 0.0095, 0.8412},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.1995, 0.8258, -0.5275, 0.7887},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.1446, 0.9607, -0.2368, 0.8151},
-	{0.1995, 0.8258, -0.5275, 0.7887},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.1590, 0.9571, -0.2424, 0.8146},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{-0.1590, 0.9571, -0.2424, 0.8146},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{-0.1590, 0.9571, -0.2424, 0.8146},
-	{-0.0829, 0.9965, 0.0050, 0.8411},
-	{-0.1590, 0.9571, -0.2424, 0.8146},
-	{0.0097, 0.9730, -0.2306, 0.8132},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{0.1995, 0.8258, -0.5275, 0.7887},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.2952, 0.2846, -0.9121, 0.7295},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{-0.2775, 0.6025, -0.7483, 0.7587},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.2775, 0.6025, -0.7483, 0.7587},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.2155, 0.8218, -0.5274, 0.7881},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{-0.2775, 0.6025, -0.7483, 0.7587},
-	{0.0039, 0.8487, -0.5289, 0.7855},
-	{-0.2775, 0.6025, -0.7483, 0.7587},
-	{0.0060, 0.6376, -0.7704, 0.7576},
-	{-0.2923, 0.2855, -0.9127, 0.7286},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{0.8518, 0.4761, 0.2186, 0.8409},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{0.7520, 0.6570, 0.0533, 0.8271},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{0.8518, 0.4761, 0.2186, 0.8409},
-	{-0.7416, 0.6671, 0.0712, 0.8258},
-	{-0.8853, 0.4604, 0.0650, 0.8244},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.7416, 0.6671, 0.0712, 0.8258},
-	{-0.7770, 0.3900, -0.4941, 0.7701},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{0.6169, -0.0123, -0.7869, 0.7195},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.4561, 0.1592, -0.8756, 0.7238},
-	{-0.7770, 0.3900, -0.4941, 0.7701},
-	{-0.6532, 0.2696, -0.7076, 0.7472},
-	{-0.6476, 0.0698, -0.7588, 0.7180},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{0.6260, 0.3092, -0.7159, 0.7511},
-	{0.3060, 0.5674, -0.7645, 0.7596},
-	{0.5548, 0.6032, -0.5730, 0.7810},
-	{-0.4435, 0.4902, -0.7503, 0.7567},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.6532, 0.2696, -0.7076, 0.7472},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.3565, 0.7710, -0.5277, 0.7909},
-	{0.5736, 0.7756, -0.2637, 0.8049},
-	{0.3472, 0.9116, -0.2202, 0.8148},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.7416, 0.6671, 0.0712, 0.8258},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.3440, 0.9136, -0.2167, 0.8140},
-	{-0.5623, 0.6073, -0.5612, 0.7793},
-	{-0.5731, 0.7759, -0.2637, 0.8037},
-	{-0.3454, 0.7618, -0.5481, 0.7899},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{0.3839, 0.9065, 0.1759, 0.8519},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.7520, 0.6570, 0.0533, 0.8271},
-	{0.5994, 0.7933, 0.1070, 0.8397},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.6653, 0.6475, 0.3717, 0.8565},
-	{-0.5994, 0.7933, 0.1071, 0.8389},
-	{-0.4654, 0.7269, 0.5051, 0.8810},
-	{-0.3728, 0.9104, 0.1794, 0.8514},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{0.6542, 0.6515, 0.3841, 0.8573},
-	{0.7466, 0.6606, -0.0794, 0.3025},
-	{0.2849, 0.9584, -0.0153, 0.3503},
-	{0.6245, 0.7636, 0.1642, 0.3358},
-	{0.2849, 0.9584, -0.0153, 0.9560},
-	{0.7466, 0.6606, -0.0794, 0.9236},
-	{0.5398, 0.7261, 0.4259, 0.9167},
-	{-0.2849, 0.9584, -0.0153, 0.9561},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.7465, 0.6606, -0.0794, 0.9275},
-	{-0.5398, 0.7262, 0.4258, 0.9168},
-	{-0.2849, 0.9584, -0.0153, 0.9561},
-	{-0.3585, 0.7545, 0.5497, 0.9437},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.0622, 0.9063, 0.4180, 0.9768},
-	{0.4708, 0.7219, 0.5071, 0.8814},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.3585, 0.7545, 0.5497, 0.9436},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.1954, 0.7863, 0.5862, 0.8977},
-	{0.0210, 0.8346, 0.5504, 0.8982},
-	{-0.0622, 0.9063, 0.4180, 0.9768},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{-0.3585, 0.7545, 0.5497, 0.9437},
-	{-0.2122, 0.7847, 0.5824, 0.8975},
-	{-0.0622, 0.9063, 0.4180, 0.9768},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.2901, 0.5476, -0.7848, 0.4120},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{-0.1890, 0.8029, -0.5654, 0.4095},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{0.0622, 0.9063, 0.4180, 0.3811},
-	{-0.3923, 0.9135, 0.1074, 0.4029},
-	{0.0622, 0.9063, 0.4180, 0.3811},
-	{-0.1653, 0.7961, -0.5822, 0.3865},
-	{0.2849, 0.9584, -0.0153, 0.3503},
-	{-0.2849, 0.9584, -0.0153, 0.9561},
-	{-0.0622, 0.9063, 0.4180, 0.9768},
-	{-0.3585, 0.7545, 0.5497, 0.9437},
-	{-0.0622, 0.9063, 0.4180, 0.3811},
-	{-0.2849, 0.9584, -0.0153, 0.3502},
-	{0.1653, 0.7961, -0.5822, 0.3865},
-	{0.4016, 0.9100, 0.1027, 0.9913},
-	{0.1767, 0.8842, 0.4325, 0.9996},
-	{-0.0009, 0.6536, 0.7569, 0.9694},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{0.7466, 0.6606, -0.0794, 0.9236},
-	{0.9843, 0.0991, -0.1464, 0.9259},
-	{0.7466, 0.6606, -0.0794, 0.9236},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{-0.9843, 0.0975, -0.1470, 0.9282},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.9511, -0.3081, -0.0219, 0.9097},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.9843, 0.0975, -0.1470, 0.9282},
-	{-0.7465, 0.6606, -0.0794, 0.9275},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{0.8518, 0.4761, 0.2186, 0.8409},
-	{0.9755, 0.1931, 0.1055, 0.8315},
-	{0.7666, 0.5931, 0.2460, 0.9013},
-	{0.9781, 0.1498, 0.1446, 0.8878},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.9870, -0.1319, 0.0915, 0.8352},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.9779, 0.1506, 0.1450, 0.8883},
-	{-0.7665, 0.5919, 0.2491, 0.9018},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.4324, 0.7903, -0.4341, 0.7546},
-	{0.8016, 0.3525, -0.4829, 0.7706},
-	{0.4324, 0.7903, -0.4341, 0.7546},
-	{0.8530, 0.4738, -0.2188, 0.7917},
-	{0.8277, 0.4980, 0.2587, 0.7777},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.7770, 0.3900, -0.4941, 0.7701},
-	{-0.3819, 0.7891, -0.4812, 0.7482},
-	{-0.9757, 0.1929, 0.1037, 0.8297},
-	{-0.8481, 0.4813, -0.2217, 0.7901},
-	{-0.8242, 0.5033, 0.2595, 0.7705},
-	{0.5522, -0.8179, -0.1618, 0.5760},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.5181, -0.8502, -0.0931, 0.5242},
-	{0.5522, -0.8179, -0.1618, 0.5760},
-	{0.5778, -0.8130, 0.0714, 0.5095},
-	{-0.5130, -0.8534, -0.0924, 0.5208},
-	{-0.5731, -0.8148, 0.0879, 0.5073},
-	{-0.4199, -0.8912, -0.1718, 0.5722},
-	{0.3830, -0.9189, -0.0949, 0.7621},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.5778, -0.8130, 0.0714, 0.8205},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.3830, -0.9189, -0.0949, 0.7621},
-	{0.2197, -0.9745, 0.0460, 0.7623},
-	{-0.2686, -0.9621, 0.0460, 0.7594},
-	{-0.4199, -0.8912, -0.1718, 0.7545},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{-0.2686, -0.9621, 0.0460, 0.7594},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{-0.6758, -0.7278, 0.1169, 0.8269},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.5778, -0.8130, 0.0714, 0.8205},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.6213, -0.7809, 0.0653, 0.9094},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{-0.5696, -0.8201, 0.0555, 0.9104},
-	{-0.5731, -0.8148, 0.0879, 0.8153},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{0.6342, -0.7158, 0.2922, 0.8977},
-	{0.4777, -0.8750, 0.0787, 0.9196},
-	{0.6342, -0.7158, 0.2922, 0.8977},
-	{0.6880, -0.6579, 0.3062, 0.9373},
-	{0.9189, -0.2505, 0.3047, 0.9180},
-	{-0.7214, -0.6523, 0.2326, 0.8954},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{0.5778, -0.8130, 0.0714, 0.8205},
-	{0.8708, -0.4906, -0.0316, 0.8721},
-	{0.6347, -0.7348, -0.2394, 0.8537},
-	{0.6342, -0.7158, 0.2922, 0.8977},
-	{0.8708, -0.4906, -0.0316, 0.8721},
-	{0.5778, -0.8130, 0.0714, 0.8205},
-	{-0.7182, -0.5605, 0.4123, 0.9351},
-	{-0.4765, -0.8608, 0.1788, 0.9257},
-	{-0.8821, -0.3450, 0.3208, 0.9152},
-	{0.3925, -0.2182, -0.8935, 0.6842},
-	{0.4880, -0.5736, -0.6579, 0.6532},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.3925, -0.2182, -0.8935, 0.6842},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.6169, -0.0123, -0.7869, 0.7195},
-	{-0.3501, -0.2227, -0.9099, 0.6798},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{-0.4706, -0.5801, -0.6648, 0.6484},
-	{-0.3501, -0.2227, -0.9099, 0.6798},
-	{-0.6476, 0.0698, -0.7588, 0.7180},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{0.4840, 0.1697, -0.8585, 0.7256},
-	{0.5148, -0.2447, -0.8217, 0.6912},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.3404, -0.0934, -0.9356, 0.6993},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{-0.6476, 0.0698, -0.7588, 0.7180},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{-0.4920, 0.1461, -0.8582, 0.7233},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.5090, -0.2359, -0.8278, 0.6877},
-	{-0.3404, -0.0934, -0.9356, 0.6980},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{0.0783, -0.9236, -0.3753, 0.6163},
-	{0.3830, -0.9189, -0.0949, 0.5811},
-	{0.0783, -0.9236, -0.3753, 0.6163},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{0.4880, -0.5736, -0.6579, 0.6532},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.4199, -0.8912, -0.1718, 0.5722},
-	{-0.0584, -0.9211, -0.3849, 0.6115},
-	{-0.4706, -0.5801, -0.6648, 0.6484},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.1436, -0.5862, -0.7973, 0.6442},
-	{0.4951, -0.8138, -0.3043, 0.5863},
-	{0.4989, -0.5493, -0.6704, 0.6465},
-	{0.4637, -0.7831, -0.4145, 0.6166},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.4999, -0.5487, -0.6701, 0.6433},
-	{-0.3890, -0.8122, -0.4347, 0.6106},
-	{-0.4898, -0.8158, -0.3074, 0.5830},
-	{-0.4199, -0.8912, -0.1718, 0.5722},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{0.8277, 0.4980, 0.2587, 0.0651},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.8242, 0.5033, 0.2595, 0.2918},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{0.3408, -0.3011, 0.8906, 0.3312},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.4240, 0.1440, 0.8941, 0.3320},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{-0.3009, 0.1748, 0.9375, 0.1367},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{-0.3009, 0.1748, 0.9375, 0.1367},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{-0.6052, 0.0545, 0.7942, 0.3339},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{0.3009, 0.1748, 0.9375, 0.3329},
-	{-0.0982, 0.7947, 0.5989, 0.1450},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{-0.5352, 0.4245, 0.7303, 0.1401},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{0.6098, -0.6981, 0.3754, 0.1471},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.0982, 0.7947, 0.5989, 0.3326},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{0.5075, -0.6868, 0.5204, 0.1680},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{0.2146, 0.6871, 0.6942, 0.1533},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{-0.3009, 0.1748, 0.9375, 0.1367},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{-0.5352, 0.4245, 0.7303, 0.1401},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{0.1675, -0.5338, 0.8288, 0.1287},
-	{0.4240, 0.1440, 0.8941, 0.1292},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.4292, 0.2375, 0.8715, 0.3295},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{0.6232, -0.4657, 0.6283, 0.1190},
-	{0.4292, 0.2374, 0.8715, 0.1240},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.7969, -0.4805, 0.3661, 0.2864},
-	{0.4746, -0.6731, 0.5671, 0.7868},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.6496, -0.7498, 0.1254, 0.8179},
-	{0.8882, -0.4572, 0.0463, 0.8200},
-	{0.4746, -0.6731, 0.5671, 0.7868},
-	{0.9280, -0.3717, 0.0269, 0.7915},
-	{-0.3618, -0.6132, 0.7022, 0.7660},
-	{-0.2686, -0.9621, 0.0460, 0.7594},
-	{-0.8868, -0.4613, 0.0282, 0.8164},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{0.4746, -0.6731, 0.5671, 0.2157},
-	{0.2197, -0.9745, 0.0460, 0.2537},
-	{0.4746, -0.6731, 0.5671, 0.2157},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{-0.2686, -0.9621, 0.0460, 0.3361},
-	{-0.3618, -0.6132, 0.7022, 0.3089},
-	{0.3971, 0.3669, 0.8413, 0.1760},
-	{0.4845, 0.6364, 0.6002, 0.1623},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{-0.3971, 0.3668, 0.8413, 0.3226},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{-0.4845, 0.6365, 0.6001, 0.3060},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.6580, 0.0794, 0.7488, 0.1823},
-	{0.4845, 0.6364, 0.6002, 0.1623},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{-0.6555, 0.0793, 0.7510, 0.2971},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{0.7811, 0.1680, 0.6014, 0.1519},
-	{0.9180, 0.0041, 0.3965, 0.1375},
-	{0.9180, 0.0041, 0.3965, 0.1375},
-	{0.7968, -0.4805, 0.3664, 0.1222},
-	{0.9302, -0.1383, 0.3400, 0.1489},
-	{-0.9180, 0.0041, 0.3965, 0.2900},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{-0.7969, -0.4805, 0.3661, 0.2864},
-	{0.9280, -0.3717, 0.0269, 0.1756},
-	{0.9983, -0.0136, 0.0573, 0.0664},
-	{0.8882, -0.4572, 0.0463, 0.1035},
-	{0.9983, -0.0136, 0.0573, 0.0664},
-	{0.9280, -0.3717, 0.0269, 0.1756},
-	{0.8407, -0.1550, 0.5188, 0.0791},
-	{-0.9284, -0.3704, 0.0307, 0.2735},
-	{-0.8868, -0.4613, 0.0282, 0.2131},
-	{-0.9980, -0.0122, 0.0622, 0.2534},
-	{-0.9305, -0.1387, 0.3389, 0.2800},
-	{-0.9284, -0.3704, 0.0307, 0.2735},
-	{-0.8381, -0.1548, 0.5231, 0.2816},
-	{-0.9180, 0.0041, 0.3965, 0.2900},
-	{-0.4050, 0.1930, 0.8937, 0.3063},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{-0.4050, 0.1930, 0.8937, 0.3063},
-	{-0.4709, 0.5525, 0.6878, 0.3095},
-	{-0.7811, 0.1681, 0.6014, 0.3026},
-	{-0.4845, 0.6365, 0.6001, 0.3060},
-	{-0.4709, 0.5525, 0.6878, 0.3095},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{-0.4774, -0.4853, 0.7325, 0.3234},
-	{-0.1675, -0.5339, 0.8288, 0.3291},
-	{-0.3408, -0.3011, 0.8906, 0.1317},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{0.6201, 0.0707, 0.7813, 0.3304},
-	{0.2156, -0.3245, 0.9210, 0.3294},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{-0.6201, 0.0707, 0.7813, 0.1347},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{-0.9490, 0.0336, 0.3136, 0.1352},
-	{0.6201, 0.0707, 0.7813, 0.3304},
-	{0.9490, 0.0336, 0.3136, 0.3316},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{-0.0982, 0.7947, 0.5989, 0.1450},
-	{0.0982, 0.7947, 0.5989, 0.3326},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{0.5352, 0.4245, 0.7303, 0.3326},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{0.0982, 0.7947, 0.5989, 0.3326},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{-0.2146, 0.6871, 0.6941, 0.3315},
-	{0.2791, -0.0376, 0.9595, 0.1262},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{0.4774, -0.4854, 0.7324, 0.1263},
-	{-0.2791, -0.0376, 0.9595, 0.3069},
-	{-0.4774, -0.4853, 0.7325, 0.3234},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.4774, -0.4853, 0.7325, 0.3234},
-	{-0.2791, -0.0376, 0.9595, 0.3069},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.6232, -0.4657, 0.6282, 0.3166},
-	{-0.2791, -0.0376, 0.9595, 0.3069},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{0.4050, 0.1930, 0.8937, 0.1461},
-	{0.7541, 0.0291, 0.6561, 0.1353},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.2791, -0.0376, 0.9595, 0.1262},
-	{-0.7541, 0.0290, 0.6562, 0.2943},
-	{-0.2791, -0.0376, 0.9595, 0.3069},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.4709, 0.5525, 0.6878, 0.1536},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{0.4709, 0.5525, 0.6878, 0.1536},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{0.4050, 0.1930, 0.8937, 0.1461},
-	{-0.4709, 0.5525, 0.6878, 0.3095},
-	{-0.4050, 0.1930, 0.8937, 0.3063},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{0.0971, 0.8245, 0.5574, 0.1571},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{0.3316, 0.1569, 0.9303, 0.1437},
-	{-0.0971, 0.8245, 0.5574, 0.3187},
-	{-0.3316, 0.1569, 0.9303, 0.3151},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{0.1710, 0.6078, 0.7754, 0.1452},
-	{0.2842, 0.5092, 0.8123, 0.3305},
-	{-0.1710, 0.6078, 0.7754, 0.3274},
-	{-0.4059, 0.0901, 0.9095, 0.3240},
-	{-0.6201, 0.0707, 0.7813, 0.1347},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{-0.2843, 0.5092, 0.8123, 0.1396},
-	{-0.2156, -0.3245, 0.9210, 0.1316},
-	{0.4774, -0.4854, 0.7324, 0.1263},
-	{0.4059, 0.0901, 0.9095, 0.1310},
-	{-0.0542, -0.9615, -0.2692, 0.1932},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{0.0497, -0.9630, -0.2650, 0.3502},
-	{-0.5075, -0.6868, 0.5204, 0.3358},
-	{0.0497, -0.9630, -0.2650, 0.3502},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{0.6098, -0.6981, 0.3754, 0.1471},
-	{0.4764, -0.8091, -0.3440, 0.1466},
-	{0.5714, -0.2970, 0.7651, 0.1432},
-	{0.4764, -0.8091, -0.3440, 0.1466},
-	{0.6098, -0.6981, 0.3754, 0.1471},
-	{0.1282, -0.9186, -0.3739, 0.1574},
-	{0.4764, -0.8091, -0.3440, 0.1466},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{0.7359, -0.6604, -0.1494, 0.1406},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{-0.4764, -0.8091, -0.3440, 0.3395},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{-0.4764, -0.8091, -0.3440, 0.3395},
-	{-0.1257, -0.9181, -0.3760, 0.3434},
-	{-0.6098, -0.6981, 0.3754, 0.3371},
-	{-0.7359, -0.6604, -0.1494, 0.3372},
-	{-0.4764, -0.8091, -0.3440, 0.3395},
-	{-0.5714, -0.2970, 0.7651, 0.3352},
-	{-0.4764, -0.8091, -0.3440, 0.3395},
-	{-0.7359, -0.6604, -0.1494, 0.3372},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.7288, -0.1367, -0.6710, 0.1363},
-	{0.9046, -0.3060, 0.2968, 0.1369},
-	{0.4550, -0.3842, -0.8033, 0.1394},
-	{-0.7359, -0.6604, -0.1494, 0.3372},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.4551, -0.3842, -0.8033, 0.3378},
-	{-0.7288, -0.1367, -0.6710, 0.3363},
-	{-0.9046, -0.3060, 0.2968, 0.3353},
-	{-0.9901, 0.1400, 0.0124, 0.3350},
-	{0.9901, 0.1400, 0.0124, 0.1344},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.6052, 0.0545, 0.7942, 0.1341},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.9901, 0.1400, 0.0124, 0.1344},
-	{0.6267, 0.3578, -0.6923, 0.1335},
-	{0.3199, 0.8419, -0.4346, 0.1308},
-	{0.7908, 0.5927, 0.1525, 0.1322},
-	{0.1313, 0.4319, -0.8923, 0.1324},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.6267, 0.3578, -0.6923, 0.3355},
-	{-0.9901, 0.1400, 0.0124, 0.3350},
-	{-0.6267, 0.3578, -0.6923, 0.3355},
-	{-0.7908, 0.5927, 0.1526, 0.3342},
-	{-0.1313, 0.4319, -0.8923, 0.3358},
-	{-0.2361, 0.8611, -0.4504, 0.1283},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{0.3199, 0.8419, -0.4346, 0.1308},
-	{-0.2361, 0.8611, -0.4504, 0.1283},
-	{0.2827, 0.9068, 0.3126, 0.1286},
-	{-0.2361, 0.8611, -0.4504, 0.1283},
-	{0.3199, 0.8419, -0.4346, 0.1308},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{-0.2361, 0.8611, -0.4504, 0.1283},
-	{-0.3440, 0.3447, -0.8734, 0.1303},
-	{0.2361, 0.8611, -0.4504, 0.3344},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{-0.3199, 0.8419, -0.4346, 0.3346},
-	{0.2361, 0.8611, -0.4504, 0.3344},
-	{-0.2827, 0.9068, 0.3126, 0.3330},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{0.4324, 0.7903, -0.4341, 0.0836},
-	{0.0093, 0.7607, 0.6491, 0.1137},
-	{-0.4291, 0.8378, -0.3376, 0.1200},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{0.4324, 0.7903, -0.4341, 0.0836},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{-0.0092, 0.7606, 0.6491, 0.3252},
-	{-0.3819, 0.7891, -0.4812, 0.3370},
-	{0.4271, 0.8395, -0.3360, 0.3337},
-	{-0.3819, 0.7891, -0.4812, 0.3370},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{-0.3646, -0.0171, -0.9310, 0.1417},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{0.3545, -0.0268, -0.9347, 0.3493},
-	{0.1571, -0.0687, -0.9852, 0.3856},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.1571, -0.0687, -0.9852, 0.3856},
-	{0.3545, -0.0268, -0.9347, 0.3493},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{0.4550, -0.3842, -0.8033, 0.1394},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{-0.0942, -0.4306, -0.8976, 0.1489},
-	{-0.3646, -0.0171, -0.9310, 0.1417},
-	{0.3545, -0.0268, -0.9347, 0.3493},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{0.3387, 0.3478, -0.8742, 0.3382},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{0.3545, -0.0268, -0.9347, 0.3493},
-	{0.0977, -0.4311, -0.8970, 0.3443},
-	{0.7288, -0.1367, -0.6710, 0.1363},
-	{-0.0533, -0.0030, -0.9986, 0.1364},
-	{0.6267, 0.3578, -0.6923, 0.1335},
-	{-0.6267, 0.3578, -0.6923, 0.3355},
-	{-0.7288, -0.1367, -0.6710, 0.3363},
-	{-0.9901, 0.1400, 0.0124, 0.3350},
-	{-0.7288, -0.1367, -0.6710, 0.3363},
-	{-0.6267, 0.3578, -0.6923, 0.3355},
-	{0.0533, -0.0030, -0.9986, 0.3386},
-	{0.4561, 0.1592, -0.8756, 0.1191},
-	{0.4324, 0.7903, -0.4341, 0.0836},
-	{-0.4317, 0.4072, -0.8049, 0.1151},
-	{0.3925, -0.2182, -0.8935, 0.1760},
-	{0.4561, 0.1592, -0.8756, 0.1191},
-	{-0.1511, -0.0653, -0.9864, 0.1620},
-	{0.1571, -0.0687, -0.9852, 0.3856},
-	{-0.3501, -0.2227, -0.9099, 0.4093},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{-0.3501, -0.2227, -0.9099, 0.4093},
-	{0.1571, -0.0687, -0.9852, 0.3856},
-	{0.0882, 0.4425, -0.8924, 0.3658},
-	{-0.0542, -0.9615, -0.2692, 0.1932},
-	{0.0783, -0.9236, -0.3753, 0.2585},
-	{-0.0573, -0.5700, -0.8197, 0.2047},
-	{0.2197, -0.9745, 0.0460, 0.2537},
-	{0.0783, -0.9236, -0.3753, 0.2585},
-	{0.1375, -0.6607, 0.7379, 0.1926},
-	{-0.1436, -0.5862, -0.7973, 0.4085},
-	{-0.0584, -0.9211, -0.3849, 0.3879},
-	{0.1561, -0.5377, -0.8285, 0.3731},
-	{0.0497, -0.9630, -0.2650, 0.3502},
-	{-0.0584, -0.9211, -0.3849, 0.3879},
-	{-0.1363, -0.6614, 0.7376, 0.3289},
-	{0.7102, -0.1342, 0.6911, 0.5517},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{-0.7102, -0.1342, 0.6911, 0.5854},
-	{-0.7746, -0.2691, 0.5723, 0.6182},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{0.7746, -0.2690, 0.5723, 0.5629},
-	{0.8569, 0.0022, 0.5155, 0.5344},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{0.7746, -0.2690, 0.5723, 0.5629},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{0.6605, -0.5679, 0.4911, 0.5900},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{0.1348, -0.8564, 0.4984, 0.6234},
-	{0.3955, -0.7845, 0.4776, 0.6113},
-	{0.6605, -0.5679, 0.4911, 0.5900},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{-0.3955, -0.7845, 0.4777, 0.6499},
-	{-0.1348, -0.8564, 0.4984, 0.6499},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{-0.6605, -0.5679, 0.4912, 0.6388},
-	{-0.3955, -0.7845, 0.4777, 0.6499},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{0.2002, -0.5399, 0.8176, 0.5695},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{0.2002, -0.5399, 0.8176, 0.5695},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{-0.2003, -0.5399, 0.8176, 0.5936},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{-0.5339, -0.6478, 0.5434, 0.6139},
-	{-0.2728, -0.8173, 0.5075, 0.6242},
-	{0.1348, -0.8564, 0.4984, 0.6234},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{0.2728, -0.8174, 0.5075, 0.6386},
-	{0.5339, -0.6478, 0.5434, 0.6178},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{-0.1348, -0.8564, 0.4984, 0.6499},
-	{0.2728, -0.8174, 0.5075, 0.6386},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.7976, 0.0272, 0.6026, 0.5653},
-	{-0.7469, -0.3515, 0.5645, 0.5934},
-	{-0.7469, -0.3515, 0.5645, 0.5934},
-	{-0.5339, -0.6478, 0.5434, 0.6139},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{0.7469, -0.3515, 0.5645, 0.5901},
-	{0.7976, 0.0272, 0.6026, 0.5597},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{0.5339, -0.6478, 0.5434, 0.6178},
-	{0.7469, -0.3515, 0.5645, 0.5901},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.7250, -0.1581, 0.6703, 0.5603},
-	{0.7250, -0.1581, 0.6703, 0.5751},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.5281, 0.6359, 0.5628, 0.5072},
-	{-0.7511, 0.3040, 0.5860, 0.5350},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.7511, 0.3040, 0.5860, 0.5350},
-	{-0.7976, 0.0272, 0.6026, 0.5653},
-	{0.7511, 0.3040, 0.5860, 0.5320},
-	{0.5281, 0.6359, 0.5628, 0.5112},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{0.7976, 0.0272, 0.6026, 0.5597},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{0.0831, 0.8464, 0.5260, 0.4748},
-	{-0.2146, 0.8082, 0.5484, 0.4863},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{-0.2146, 0.8082, 0.5484, 0.4863},
-	{-0.5281, 0.6359, 0.5628, 0.5072},
-	{0.2147, 0.8082, 0.5484, 0.5007},
-	{-0.0832, 0.8464, 0.5260, 0.5014},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.5281, 0.6359, 0.5628, 0.5112},
-	{0.3387, 0.4923, 0.8018, 0.5322},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{-0.3388, 0.4923, 0.8018, 0.5581},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{0.5598, 0.2515, 0.7896, 0.5575},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.6363, 0.5146, 0.5748, 0.4862},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{-0.6362, 0.5145, 0.5748, 0.5350},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{0.4138, 0.7431, 0.5258, 0.4748},
-	{0.0831, 0.8464, 0.5260, 0.4748},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{0.8212, 0.2873, 0.4930, 0.5076},
-	{0.6363, 0.5146, 0.5748, 0.4862},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{0.6363, 0.5146, 0.5748, 0.4862},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{-0.7102, -0.1342, 0.6911, 0.5854},
-	{-0.5598, 0.2515, 0.7896, 0.5411},
-	{-0.7250, -0.1581, 0.6703, 0.5603},
-	{-0.6801, -0.0319, 0.7324, 0.5561},
-	{0.6801, -0.0319, 0.7325, 0.5730},
-	{0.7250, -0.1581, 0.6703, 0.5751},
-	{0.5598, 0.2515, 0.7896, 0.5575},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{0.2002, -0.5399, 0.8176, 0.5695},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.2002, -0.5399, 0.8176, 0.5695},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{-0.2003, -0.5399, 0.8176, 0.5936},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{0.6801, -0.0319, 0.7325, 0.5730},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{0.3387, 0.4923, 0.8018, 0.5322},
-	{-0.3388, 0.4923, 0.8018, 0.5581},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{0.2742, -0.0009, 0.9617, 0.5496},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.3387, 0.4923, 0.8018, 0.5322},
-	{0.7746, -0.2690, 0.5723, 0.5629},
-	{0.7102, -0.1342, 0.6911, 0.5517},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{0.7102, -0.1342, 0.6911, 0.5517},
-	{0.7746, -0.2690, 0.5723, 0.5629},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{-0.7102, -0.1342, 0.6911, 0.5854},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{-0.7102, -0.1342, 0.6911, 0.5854},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{-0.7746, -0.2691, 0.5723, 0.6182},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{-0.7746, -0.2691, 0.5723, 0.6182},
-	{-0.6605, -0.5679, 0.4912, 0.6388},
-	{-0.8569, 0.0022, 0.5155, 0.5919},
-	{-0.7746, -0.2691, 0.5723, 0.6182},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{0.3955, -0.7845, 0.4776, 0.6113},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{0.1348, -0.8564, 0.4984, 0.6234},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{-0.5017, -0.6207, 0.6025, 0.6209},
-	{-0.1348, -0.8564, 0.4984, 0.6499},
-	{0.5018, -0.6207, 0.6025, 0.5853},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{-0.2003, -0.5399, 0.8176, 0.5936},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{0.2002, -0.5399, 0.8176, 0.5695},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{-0.2003, -0.5399, 0.8176, 0.5936},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{-0.2728, -0.8173, 0.5075, 0.6242},
-	{-0.0499, -0.7728, 0.6327, 0.5980},
-	{-0.5339, -0.6478, 0.5434, 0.6139},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{0.0499, -0.7728, 0.6327, 0.6187},
-	{0.5339, -0.6478, 0.5434, 0.6178},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.7469, -0.3515, 0.5645, 0.5934},
-	{-0.4873, -0.5845, 0.6487, 0.5909},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{0.4873, -0.5845, 0.6487, 0.6018},
-	{0.7469, -0.3515, 0.5645, 0.5901},
-	{-0.7250, -0.1581, 0.6703, 0.5603},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{0.7250, -0.1581, 0.6703, 0.5751},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{0.6974, -0.1367, 0.7035, 0.5755},
-	{-0.5598, 0.2515, 0.7896, 0.5411},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.7250, -0.1581, 0.6703, 0.5603},
-	{0.5598, 0.2515, 0.7896, 0.5575},
-	{0.7250, -0.1581, 0.6703, 0.5751},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{-0.6974, -0.1367, 0.7035, 0.5698},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.7976, 0.0272, 0.6026, 0.5653},
-	{0.7511, 0.3040, 0.5860, 0.5320},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.7976, 0.0272, 0.6026, 0.5597},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{-0.2146, 0.8082, 0.5484, 0.4863},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{-0.5281, 0.6359, 0.5628, 0.5072},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{0.2147, 0.8082, 0.5484, 0.5007},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{0.2147, 0.8082, 0.5484, 0.5007},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{0.5281, 0.6359, 0.5628, 0.5112},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{0.3387, 0.4923, 0.8018, 0.5322},
-	{-0.2109, 0.7524, 0.6240, 0.5107},
-	{-0.5598, 0.2515, 0.7896, 0.5411},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{-0.6002, 0.3959, 0.6950, 0.5331},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{-0.3388, 0.4923, 0.8018, 0.5581},
-	{0.2109, 0.7524, 0.6240, 0.5279},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{0.6002, 0.3959, 0.6950, 0.5416},
-	{0.3387, 0.4923, 0.8018, 0.5322},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{-0.3388, 0.4923, 0.8018, 0.5581},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{0.2488, 0.7445, 0.6195, 0.5025},
-	{0.6363, 0.5146, 0.5748, 0.4862},
-	{0.4138, 0.7431, 0.5258, 0.4748},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{-0.4137, 0.7431, 0.5260, 0.5135},
-	{-0.6362, 0.5145, 0.5748, 0.5350},
-	{-0.4137, 0.7431, 0.5260, 0.5135},
-	{-0.2486, 0.7445, 0.6196, 0.5303},
-	{-0.0832, 0.8464, 0.5260, 0.5014},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{0.8569, 0.0022, 0.5155, 0.5344},
-	{0.8212, 0.2873, 0.4930, 0.5076},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{-0.8212, 0.2872, 0.4931, 0.5628},
-	{-0.8569, 0.0022, 0.5155, 0.5919},
-	{-0.8212, 0.2872, 0.4931, 0.5628},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{-0.6362, 0.5145, 0.5748, 0.5350},
-	{0.7995, 0.1433, 0.5833, 0.5304},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{0.7102, -0.1342, 0.6911, 0.5517},
-	{-0.7995, 0.1432, 0.5833, 0.5742},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{-0.6362, 0.5145, 0.5748, 0.5350},
-	{-0.6801, -0.0319, 0.7324, 0.5561},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{-0.5598, 0.2515, 0.7896, 0.5411},
-	{0.6801, -0.0319, 0.7325, 0.5730},
-	{0.5598, 0.2515, 0.7896, 0.5575},
-	{0.1355, 0.4206, 0.8971, 0.5570},
-	{-0.6801, -0.0319, 0.7324, 0.5561},
-	{-0.7250, -0.1581, 0.6703, 0.5603},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{0.6801, -0.0319, 0.7325, 0.5730},
-	{0.1743, -0.4036, 0.8982, 0.5858},
-	{0.7250, -0.1581, 0.6703, 0.5751},
-	{0.5456, -0.3525, 0.7604, 0.5621},
-	{0.7102, -0.1342, 0.6911, 0.5517},
-	{0.6221, 0.2465, 0.7431, 0.5363},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{-0.7102, -0.1342, 0.6911, 0.5854},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{-0.2003, -0.5399, 0.8176, 0.5936},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{-0.5456, -0.3525, 0.7603, 0.5922},
-	{-0.1743, -0.4036, 0.8982, 0.5659},
-	{-0.1355, 0.4206, 0.8971, 0.5371},
-	{-0.6801, -0.0319, 0.7324, 0.5561},
-	{-0.6221, 0.2466, 0.7431, 0.5683},
-	{-0.2742, -0.0009, 0.9617, 0.5750},
-	{-0.3388, 0.4923, 0.8018, 0.5581},
-};
-
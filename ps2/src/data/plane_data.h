@@ -1,722 +0,0 @@
-int vertex_count_plane = 357;
-
-VECTOR vertices_plane[357] = {
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{50.0000, -0.0000, 28.1250, 0.9999},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{-34.3750, 0.0000, -50.0000, 0.1564},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-18.7500, 0.0000, -12.5000, 0.3125},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-31.2500, 0.0000, -28.1250, 0.1876},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-31.2500, 0.0000, -28.1250, 0.1876},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-9.3750, -0.0000, 43.7500, 0.4062},
-	{-34.3750, -0.0000, 28.1250, 0.1564},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{28.1250, -0.0000, 21.8750, 0.7811},
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{9.3750, -0.0000, 9.3750, 0.5938},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{28.1250, 0.0000, -3.1250, 0.7811},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{28.1250, -0.0000, 21.8750, 0.7811},
-	{-12.5000, -0.0000, 3.1250, 0.3750},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{-17.1875, 0.0000, -50.0000, 0.3281},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{28.1250, 0.0000, -50.0000, 0.7811},
-	{23.4375, 0.0000, -43.7500, 0.7343},
-	{50.0000, 0.0000, -28.1250, 0.9999},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{40.6250, 0.0000, -21.8750, 0.9061},
-	{40.6250, 0.0000, -21.8750, 0.9061},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{23.4375, 0.0000, -43.7500, 0.7343},
-	{23.4375, 0.0000, -32.0312, 0.7343},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{-31.2500, 0.0000, -28.1250, 0.1876},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{-9.3750, -0.0000, 15.6250, 0.4062},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-21.8750, -0.0000, 28.1250, 0.2812},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-28.1250, -0.0000, 4.6875, 0.2188},
-	{9.3750, -0.0000, 9.3750, 0.5938},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{21.8750, -0.0000, 50.0000, 0.7187},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{9.3750, -0.0000, 50.0000, 0.5938},
-	{9.3750, -0.0000, 50.0000, 0.5938},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{-3.1250, -0.0000, 50.0000, 0.4688},
-	{50.0000, -0.0000, 50.0000, 0.9999},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{34.3750, -0.0000, 50.0000, 0.8436},
-	{34.3750, -0.0000, 50.0000, 0.8436},
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{21.8750, -0.0000, 50.0000, 0.7187},
-	{-21.8750, -0.0000, 28.1250, 0.2812},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{-34.3750, -0.0000, 28.1250, 0.1564},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{-50.0000, -0.0000, 4.6875, 0.0001},
-	{-50.0000, -0.0000, 26.5625, 0.0001},
-	{-32.8125, -0.0000, 50.0000, 0.1719},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-50.0000, -0.0000, 50.0000, 0.0001},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-50.0000, -0.0000, 26.5625, 0.0001},
-	{-50.0000, -0.0000, 50.0000, 0.0001},
-	{-3.1250, -0.0000, 50.0000, 0.4688},
-	{-9.3750, -0.0000, 43.7500, 0.4062},
-	{-15.6250, -0.0000, 50.0000, 0.3438},
-	{-15.6250, -0.0000, 50.0000, 0.3438},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-32.8125, -0.0000, 50.0000, 0.1719},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-21.8750, -0.0000, 28.1250, 0.2812},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-50.0000, 0.0000, -34.3750, 0.0001},
-	{-50.0000, 0.0000, -21.8750, 0.0001},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-50.0000, 0.0000, -50.0000, 0.0001},
-	{-50.0000, 0.0000, -34.3750, 0.0001},
-	{-28.1250, -0.0000, 4.6875, 0.2188},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-28.1250, -0.0000, 4.6875, 0.2188},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{-50.0000, 0.0000, -9.3750, 0.0001},
-	{-50.0000, -0.0000, 4.6875, 0.0001},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-50.0000, 0.0000, -21.8750, 0.0001},
-	{-50.0000, 0.0000, -9.3750, 0.0001},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-31.2500, 0.0000, -28.1250, 0.1876},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-18.7500, 0.0000, -12.5000, 0.3125},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{15.6250, 0.0000, -21.8750, 0.6562},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{-3.1250, 0.0000, -50.0000, 0.4688},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{3.1250, 0.0000, -9.3750, 0.5312},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{3.1250, 0.0000, -9.3750, 0.5312},
-	{50.0000, 0.0000, -3.1250, 0.9999},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{50.0000, 0.0000, -15.6250, 0.9999},
-	{40.6250, 0.0000, -21.8750, 0.9061},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{15.6250, 0.0000, -21.8750, 0.6562},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{23.4375, 0.0000, -43.7500, 0.7343},
-	{14.0625, 0.0000, -50.0000, 0.6407},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{3.1250, 0.0000, -9.3750, 0.5312},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-34.3750, -0.0000, 28.1250, 0.1564},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-28.1250, -0.0000, 4.6875, 0.2188},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{9.3750, -0.0000, 9.3750, 0.5938},
-	{50.0000, -0.0000, 10.9375, 0.9999},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{-9.3750, -0.0000, 15.6250, 0.4062},
-	{50.0000, -0.0000, 10.9375, 0.9999},
-	{50.0000, 0.0000, -3.1250, 0.9999},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{28.1250, 0.0000, -3.1250, 0.7811},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{28.1250, -0.0000, 21.8750, 0.7811},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{-17.1875, 0.0000, -50.0000, 0.3281},
-	{-34.3750, 0.0000, -50.0000, 0.1564},
-	{23.4375, 0.0000, -43.7500, 0.7343},
-	{28.1250, 0.0000, -50.0000, 0.7811},
-	{14.0625, 0.0000, -50.0000, 0.6407},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{23.4375, 0.0000, -32.0312, 0.7343},
-	{15.6250, 0.0000, -21.8750, 0.6562},
-	{50.0000, 0.0000, -15.6250, 0.9999},
-	{50.0000, 0.0000, -28.1250, 0.9999},
-	{40.6250, 0.0000, -21.8750, 0.9061},
-	{50.0000, 0.0000, -3.1250, 0.9999},
-	{50.0000, 0.0000, -15.6250, 0.9999},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{28.1250, 0.0000, -3.1250, 0.7811},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-34.3750, 0.0000, -50.0000, 0.1564},
-	{-50.0000, 0.0000, -50.0000, 0.0001},
-	{-9.3750, -0.0000, 43.7500, 0.4062},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{28.1250, -0.0000, 21.8750, 0.7811},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{1.5625, -0.0000, 19.5312, 0.5156},
-	{9.3750, -0.0000, 9.3750, 0.5938},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{28.1250, -0.0000, 21.8750, 0.7811},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{-21.8750, 0.0000, -39.0625, 0.2812},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{50.0000, 0.0000, -50.0000, 0.9999},
-	{28.1250, 0.0000, -50.0000, 0.7811},
-	{50.0000, 0.0000, -28.1250, 0.9999},
-	{50.0000, 0.0000, -50.0000, 0.9999},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{39.8438, 0.0000, -39.0625, 0.8983},
-	{23.4375, 0.0000, -32.0312, 0.7343},
-	{-9.3750, -0.0000, 29.6875, 0.4062},
-	{-9.3750, -0.0000, 15.6250, 0.4062},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-9.3750, -0.0000, 15.6250, 0.4062},
-	{-12.5000, -0.0000, 3.1250, 0.3750},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{50.0000, -0.0000, 28.1250, 0.9999},
-	{50.0000, -0.0000, 10.9375, 0.9999},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{40.6250, -0.0000, 17.1875, 0.9061},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{21.8750, -0.0000, 50.0000, 0.7187},
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{9.3750, -0.0000, 50.0000, 0.5938},
-	{15.6250, -0.0000, 39.0625, 0.6562},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{34.3750, -0.0000, 50.0000, 0.8436},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{28.1250, -0.0000, 39.0625, 0.7811},
-	{-21.8750, -0.0000, 28.1250, 0.2812},
-	{-20.3125, -0.0000, 13.2812, 0.2969},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{-50.0000, -0.0000, 4.6875, 0.0001},
-	{-34.3750, -0.0000, 28.1250, 0.1564},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{-32.8125, -0.0000, 50.0000, 0.1719},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-42.1875, -0.0000, 38.2812, 0.0782},
-	{-43.7500, -0.0000, 21.8750, 0.0626},
-	{-50.0000, -0.0000, 26.5625, 0.0001},
-	{-3.1250, -0.0000, 50.0000, 0.4688},
-	{3.1250, -0.0000, 37.5000, 0.5312},
-	{-9.3750, -0.0000, 43.7500, 0.4062},
-	{-15.6250, -0.0000, 50.0000, 0.3438},
-	{-9.3750, -0.0000, 43.7500, 0.4062},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-35.9375, 0.0000, -40.6250, 0.1408},
-	{-50.0000, 0.0000, -34.3750, 0.0001},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-50.0000, 0.0000, -9.3750, 0.0001},
-	{-35.9375, 0.0000, -7.8125, 0.1407},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-50.0000, 0.0000, -21.8750, 0.0001},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{3.1250, 0.0000, -9.3750, 0.5312},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-18.7500, 0.0000, -12.5000, 0.3125},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{-12.5000, -0.0000, 3.1250, 0.3750},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-21.8750, 0.0000, -3.1250, 0.2812},
-	{-18.7500, 0.0000, -12.5000, 0.3125},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{15.6250, 0.0000, -21.8750, 0.6562},
-	{23.4375, 0.0000, -32.0312, 0.7343},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{14.0625, 0.0000, -50.0000, 0.6407},
-	{-3.1250, 0.0000, -50.0000, 0.4688},
-	{15.6250, 0.0000, -4.6875, 0.6562},
-	{15.6250, 0.0000, -21.8750, 0.6562},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{28.1250, 0.0000, -3.1250, 0.7811},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{40.6250, -0.0000, 3.1250, 0.9061},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{28.1250, 0.0000, -3.1250, 0.7811},
-	{38.2812, 0.0000, -10.9375, 0.8827},
-	{40.6250, 0.0000, -21.8750, 0.9061},
-	{28.1250, 0.0000, -18.7500, 0.7811},
-	{23.4375, 0.0000, -32.0312, 0.7343},
-	{23.4375, 0.0000, -43.7500, 0.7343},
-	{9.3750, 0.0000, -39.0625, 0.5938},
-	{3.1250, 0.0000, -9.3750, 0.5312},
-	{1.5625, 0.0000, -24.2188, 0.5156},
-	{-14.8438, 0.0000, -23.0469, 0.3516},
-	{-28.1250, 0.0000, -15.6250, 0.2188},
-	{-31.2500, 0.0000, -28.1250, 0.1876},
-	{-42.1875, 0.0000, -24.2188, 0.0782},
-	{-23.4375, -0.0000, 40.6250, 0.2657},
-	{-21.8750, -0.0000, 28.1250, 0.2812},
-	{-34.3750, -0.0000, 28.1250, 0.1564},
-	{-34.3750, -0.0000, 15.6250, 0.1564},
-	{-28.1250, -0.0000, 4.6875, 0.2188},
-	{-41.4062, -0.0000, 6.2500, 0.0860},
-	{50.0000, -0.0000, 50.0000, 0.9999},
-	{50.0000, -0.0000, 28.1250, 0.9999},
-	{40.6250, -0.0000, 39.0625, 0.9061},
-	{16.4062, -0.0000, 18.7500, 0.6640},
-	{25.7812, -0.0000, 7.8125, 0.7577},
-	{9.3750, -0.0000, 9.3750, 0.5938},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{-9.3750, 0.0000, -8.5938, 0.4062},
-	{-12.5000, -0.0000, 3.1250, 0.3750},
-	{-9.3750, -0.0000, 15.6250, 0.4062},
-	{0.0000, -0.0000, 3.1250, 0.5000},
-	{-12.5000, -0.0000, 3.1250, 0.3750},
-	{-8.5938, 0.0000, -39.4531, 0.4141},
-	{-3.1250, 0.0000, -50.0000, 0.4688},
-	{-17.1875, 0.0000, -50.0000, 0.3281},
-};
-
-VECTOR normals_plane[357] = {
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.3750},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.9374},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.5938},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0626},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0626},
-	{0.0000, 1.0000, 0.0000, 0.1798},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.5468},
-	{0.0000, 1.0000, 0.0000, 0.5938},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.5469},
-	{0.0000, 1.0000, 0.0000, 0.7655},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.7655},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9374},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.1564},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.1564},
-	{0.0000, 1.0000, 0.0000, 0.5468},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.5468},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.5469},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.3750},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.0626},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.5468},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.5938},
-	{0.0000, 1.0000, 0.0000, 0.6093},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.6093},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0626},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.1798},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.9374},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.6953},
-	{0.0000, 1.0000, 0.0000, 0.5938},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.1798},
-	{0.0000, 1.0000, 0.0000, 0.7968},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6093},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.6718},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6328},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.5469},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.8827},
-	{0.0000, 1.0000, 0.0000, 0.7187},
-	{0.0000, 1.0000, 0.0000, 0.7655},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.8749},
-	{0.0000, 1.0000, 0.0000, 0.9374},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.9374},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.0939},
-	{0.0000, 1.0000, 0.0000, 0.1564},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.4219},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3750},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3750},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.1798},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.4531},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.4688},
-	{0.0000, 1.0000, 0.0000, 0.3906},
-	{0.0000, 1.0000, 0.0000, 0.2812},
-	{0.0000, 1.0000, 0.0000, 0.3125},
-	{0.0000, 1.0000, 0.0000, 0.1798},
-	{0.0000, 1.0000, 0.0000, 0.0626},
-	{0.0000, 1.0000, 0.0000, 0.1095},
-	{0.0000, 1.0000, 0.0000, 0.4062},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.2695},
-	{0.0000, 1.0000, 0.0000, 0.3438},
-	{0.0000, 1.0000, 0.0000, 0.2188},
-	{0.0000, 1.0000, 0.0000, 0.2578},
-	{0.0000, 1.0000, 0.0000, 0.9061},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.5468},
-	{0.0000, 1.0000, 0.0000, 0.5625},
-	{0.0000, 1.0000, 0.0000, 0.9999},
-	{0.0000, 1.0000, 0.0000, 0.7812},
-	{0.0000, 1.0000, 0.0000, 0.8905},
-	{0.0000, 1.0000, 0.0000, 0.6874},
-	{0.0000, 1.0000, 0.0000, 0.5781},
-	{0.0000, 1.0000, 0.0000, 0.5938},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.4141},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.6562},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.5312},
-	{0.0000, 1.0000, 0.0000, 0.1056},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-	{0.0000, 1.0000, 0.0000, 0.0001},
-};
-
@@ -23,6 +23,7 @@
 #include <libpad.h>
 
 #include "Pad.hpp"
+#include "Perf.hpp"
 #include "Scene.hpp"
 #include "Draw.hpp"
 
@@ -104,8 +105,11 @@ int main(){
 	packet2_t *flipBuffersPacket = packet2_create(8, P2_TYPE_UNCACHED_ACCL, P2_MODE_NORMAL, 0);
 	Commands commands;
 	commands.allocate();
+	Perf perf;
+	perf.setup();
 
 	for(;;){
+		perf.begin(Perf::FRAME);
 		// Read gamepad.
 		pad.update();
 
@@ -114,7 +118,13 @@ int main(){
 		// Render.
 		scene.update(pad);
 		scene.clear(commands, &z);
+		perf.begin(Perf::BUILD);
 		scene.render(commands);
+		perf.end(Perf::BUILD);
+		// Send the whole frame to VU1 at once.
+		perf.begin(Perf::SUBMIT);
+		commands.submit();
+		perf.end(Perf::SUBMIT);
 		
 		// Wait for scene to finish drawing
 		draw_wait_finish();
@@ -134,6 +144,11 @@ int main(){
 		dma_wait_fast();
 		dma_channel_send_packet2(flipBuffersPacket, DMA_CHANNEL_GIF, 0);
 		draw_wait_finish();
+		perf.end(Perf::FRAME);
+		const unsigned int frames = perf.endFrame();
+		if(frames > 0){
+			scene.printStats(frames);
+		}
 	}
 
 	packet2_free(flipBuffersPacket);
@@ -0,0 +1,409 @@
+// Convert an OBJ mesh to triangle strips for the VU1 object program, as a C header.
+// Strips are packed in batches that fit in the VU1 double buffer (BATCH_VERTEX_SIZE in Draw.hpp).
+// The first two vertices of each strip, and of each batch, are flagged as restarts: the VU1 program
+// then sets the ADC bit of their XYZ register, so that no triangle is drawn across strips.
+// Strips can also turn on the other edge of their last triangle by repeating a vertex with the restart flag (swap).
+// The restart flag is stored in the lowest mantissa bit of the normal X component.
+//
+// Usage: obj2strips model.obj name scale batchSize > name_strips.h
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+struct Vec3 {
+	float x, y, z;
+};
+
+struct Vertex {
+	int v, t, n;
+	bool operator<(const Vertex& o) const {
+		if(v != o.v) return v < o.v;
+		if(t != o.t) return t < o.t;
+		return n < o.n;
+	}
+};
+
+struct Triangle {
+	int v[3];
+};
+
+struct Mesh {
+	std::vector<Vec3> positions;
+	std::vector<Vec3> uvs;
+	std::vector<Vec3> normals;
+	// Welded vertices and indexed triangles.
+	std::vector<Vertex> vertices;
+	std::vector<Triangle> triangles;
+};
+
+static int parseIndex(const char* str, int count){
+	const int index = atoi(str);
+	return index < 0 ? count + index : index - 1;
+}
+
+static bool loadObj(const char* path, Mesh& mesh){
+	FILE* file = fopen(path, "r");
+	if(!file){
+		return false;
+	}
+	std::map<Vertex, int> welded;
+	char line[512];
+	while(fgets(line, sizeof(line), file)){
+		Vec3 value = {0.0f, 0.0f, 0.0f};
+		if(strncmp(line, "v ", 2) == 0){
+			sscanf(line + 2, "%f %f %f", &value.x, &value.y, &value.z);
+			mesh.positions.push_back(value);
+		} else if(strncmp(line, "vt ", 3) == 0){
+			sscanf(line + 3, "%f %f", &value.x, &value.y);
+			mesh.uvs.push_back(value);
+		} else if(strncmp(line, "vn ", 3) == 0){
+			sscanf(line + 3, "%f %f %f", &value.x, &value.y, &value.z);
+			mesh.normals.push_back(value);
+		} else if(strncmp(line, "f ", 2) == 0){
+			// Faces are triangulated as fans.
+			std::vector<int> face;
+			for(char* token = strtok(line + 2, " \t\r\n"); token; token = strtok(NULL, " \t\r\n")){
+				Vertex vertex = {0, -1, -1};
+				vertex.v = parseIndex(token, mesh.positions.size());
+				char* slash = strchr(token, '/');
+				if(slash){
+					if(slash[1] != '/'){
+						vertex.t = parseIndex(slash + 1, mesh.uvs.size());
+					}
+					slash = strchr(slash + 1, '/');
+					if(slash){
+						vertex.n = parseIndex(slash + 1, mesh.normals.size());
+					}
+				}
+				std::map<Vertex, int>::iterator it = welded.find(vertex);
+				if(it == welded.end()){
+					it = welded.insert(std::make_pair(vertex, (int)mesh.vertices.size())).first;
+					mesh.vertices.push_back(vertex);
+				}
+				face.push_back(it->second);
+			}
+			for(size_t i = 2; i < face.size(); ++i){
+				Triangle triangle = {{face[0], face[i - 1], face[i]}};
+				// Skip degenerate triangles.
+				if(triangle.v[0] != triangle.v[1] && triangle.v[1] != triangle.v[2] && triangle.v[0] != triangle.v[2]){
+					mesh.triangles.push_back(triangle);
+				}
+			}
+		}
+	}
+	fclose(file);
+	return true;
+}
+
+/// Stripification.
+
+struct StripVertex {
+	int index;
+	// No triangle ends at this vertex (ADC bit).
+	bool restart;
+};
+
+typedef std::vector<StripVertex> Strip;
+
+struct Adjacency {
+	// Triangles sharing each edge.
+	std::map<std::pair<int, int>, std::vector<int> > edges;
+	std::vector<bool> used;
+};
+
+static std::pair<int, int> edgeKey(int a, int b){
+	return a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+}
+
+static int freeNeighbours(const Mesh& mesh, const Adjacency& adjacency, int tid){
+	int count = 0;
+	for(int i = 0; i < 3; ++i){
+		const Triangle& triangle = mesh.triangles[tid];
+		const std::vector<int>& shared = adjacency.edges.find(edgeKey(triangle.v[i], triangle.v[(i + 1) % 3]))->second;
+		for(size_t j = 0; j < shared.size(); ++j){
+			count += (shared[j] != tid && !adjacency.used[shared[j]]) ? 1 : 0;
+		}
+	}
+	return count;
+}
+
+static int thirdVertex(const Triangle& triangle, int a, int b){
+	for(int i = 0; i < 3; ++i){
+		if(triangle.v[i] != a && triangle.v[i] != b){
+			return triangle.v[i];
+		}
+	}
+	return -1;
+}
+
+// Free triangle on an edge with the fewest free neighbours, -1 if none.
+static int bestTriangle(const Mesh& mesh, Adjacency& adjacency, int a, int b){
+	const std::vector<int>& shared = adjacency.edges[edgeKey(a, b)];
+	int best = -1;
+	int bestScore = 0;
+	for(size_t j = 0; j < shared.size(); ++j){
+		const int tid = shared[j];
+		if(adjacency.used[tid]){
+			continue;
+		}
+		const int score = freeNeighbours(mesh, adjacency, tid);
+		if(best < 0 || score < bestScore){
+			best = tid;
+			bestScore = score;
+		}
+	}
+	return best;
+}
+
+// Extend a strip greedily from its last edge. If no triangle is free on that edge, try the other edge
+// of the last triangle through a swap: the first vertex of the triangle is repeated with the restart flag.
+static void extendStrip(const Mesh& mesh, Adjacency& adjacency, Strip& strip, std::vector<int>& triangles){
+	for(;;){
+		const size_t n = strip.size();
+		const int b = strip[n - 2].index;
+		const int c = strip[n - 1].index;
+		int tid = bestTriangle(mesh, adjacency, b, c);
+		if(tid >= 0){
+			const StripVertex vertex = { thirdVertex(mesh.triangles[tid], b, c), false };
+			strip.push_back(vertex);
+		} else {
+			if(strip[n - 1].restart){
+				return;
+			}
+			const int a = strip[n - 3].index;
+			tid = bestTriangle(mesh, adjacency, a, c);
+			if(tid < 0){
+				return;
+			}
+			const StripVertex swap = { a, true };
+			const StripVertex vertex = { thirdVertex(mesh.triangles[tid], a, c), false };
+			strip.push_back(swap);
+			strip.push_back(vertex);
+		}
+		adjacency.used[tid] = true;
+		triangles.push_back(tid);
+	}
+}
+
+// Reverse a strip, moving the restart flags so that the same triangles are drawn.
+static Strip reverseStrip(const Strip& strip){
+	const size_t n = strip.size();
+	Strip reversed(n);
+	for(size_t j = 0; j < n; ++j){
+		reversed[j].index = strip[n - 1 - j].index;
+		// The triangle ending at j started at n - 1 - j in the original strip.
+		reversed[j].restart = j < 2 || strip[n + 1 - j].restart;
+	}
+	return reversed;
+}
+
+static std::vector<Strip> buildStrips(const Mesh& mesh){
+	Adjacency adjacency;
+	const int triangleCount = mesh.triangles.size();
+	adjacency.used.assign(triangleCount, false);
+	for(int tid = 0; tid < triangleCount; ++tid){
+		const Triangle& triangle = mesh.triangles[tid];
+		for(int i = 0; i < 3; ++i){
+			adjacency.edges[edgeKey(triangle.v[i], triangle.v[(i + 1) % 3])].push_back(tid);
+		}
+	}
+
+	std::vector<Strip> strips;
+	int remaining = triangleCount;
+	while(remaining > 0){
+		// Start from the free triangle with the fewest free neighbours.
+		int start = -1;
+		int startScore = 0;
+		for(int tid = 0; tid < triangleCount; ++tid){
+			if(adjacency.used[tid]){
+				continue;
+			}
+			const int score = freeNeighbours(mesh, adjacency, tid);
+			if(start < 0 || score < startScore){
+				start = tid;
+				startScore = score;
+			}
+		}
+		// Try the three orientations of the first triangle, in both directions, and keep the strip
+		// with the fewest vertices per triangle.
+		Strip bestStrip;
+		std::vector<int> bestTriangles;
+		for(int rotation = 0; rotation < 3; ++rotation){
+			const Triangle& triangle = mesh.triangles[start];
+			Strip strip;
+			std::vector<int> triangles(1, start);
+			for(int i = 0; i < 3; ++i){
+				const StripVertex vertex = { triangle.v[(rotation + i) % 3], i < 2 };
+				strip.push_back(vertex);
+			}
+			adjacency.used[start] = true;
+			extendStrip(mesh, adjacency, strip, triangles);
+			// Extend backwards from the first edge (the GS does not cull, winding is not preserved).
+			strip = reverseStrip(strip);
+			extendStrip(mesh, adjacency, strip, triangles);
+			if(bestStrip.empty() || strip.size() * bestTriangles.size() < bestStrip.size() * triangles.size()){
+				bestStrip = strip;
+				bestTriangles = triangles;
+			}
+			for(size_t j = 0; j < triangles.size(); ++j){
+				adjacency.used[triangles[j]] = false;
+			}
+		}
+		for(size_t j = 0; j < bestTriangles.size(); ++j){
+			adjacency.used[bestTriangles[j]] = true;
+		}
+		remaining -= bestTriangles.size();
+		strips.push_back(bestStrip);
+	}
+	return strips;
+}
+
+/// Batching.
+
+static Strip packStrips(const std::vector<Strip>& strips, int batchSize){
+	Strip out;
+	for(size_t sid = 0; sid < strips.size(); ++sid){
+		const Strip& strip = strips[sid];
+		size_t position = 0;
+		for(;;){
+			const size_t space = batchSize - (out.size() % batchSize);
+			if(space < 3){
+				// Not enough room for a triangle, pad until the next batch.
+				const StripVertex padding = { out.back().index, true };
+				out.insert(out.end(), space, padding);
+				continue;
+			}
+			const size_t count = std::min(space, strip.size() - position);
+			for(size_t i = 0; i < count; ++i){
+				const StripVertex vertex = { strip[position + i].index, i < 2 || strip[position + i].restart };
+				out.push_back(vertex);
+			}
+			if(position + count == strip.size()){
+				break;
+			}
+			// Continue the strip in the next batch, restarting from the last edge.
+			position += count - 2;
+		}
+	}
+	return out;
+}
+
+// Decode the packed strips as the GS would, and compare with the source triangles.
+static bool checkStrips(const Mesh& mesh, const Strip& out, int batchSize){
+	std::vector<Triangle> decoded;
+	for(size_t i = 0; i < out.size(); ++i){
+		if(out[i].restart){
+			continue;
+		}
+		if(i % batchSize < 2){
+			return false;
+		}
+		Triangle triangle = {{out[i - 2].index, out[i - 1].index, out[i].index}};
+		std::sort(triangle.v, triangle.v + 3);
+		decoded.push_back(triangle);
+	}
+	std::vector<Triangle> reference = mesh.triangles;
+	for(size_t i = 0; i < reference.size(); ++i){
+		std::sort(reference[i].v, reference[i].v + 3);
+	}
+	if(decoded.size() != reference.size()){
+		return false;
+	}
+	struct {
+		bool operator()(const Triangle& a, const Triangle& b) const {
+			return std::lexicographical_compare(a.v, a.v + 3, b.v, b.v + 3);
+		}
+	} compare;
+	std::sort(decoded.begin(), decoded.end(), compare);
+	std::sort(reference.begin(), reference.end(), compare);
+	for(size_t i = 0; i < decoded.size(); ++i){
+		if(!std::equal(decoded[i].v, decoded[i].v + 3, reference[i].v)){
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Output.
+
+static float withFlag(float value, bool flag){
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(float));
+	bits = flag ? (bits | 1u) : (bits & ~1u);
+	memcpy(&value, &bits, sizeof(float));
+	return value;
+}
+
+// Print a float that converts back to the exact same bits.
+static void printFloat(float value){
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.9g", value);
+	printf("%s%sf", buffer, strpbrk(buffer, ".en") ? "" : ".0");
+}
+
+static void printVector(float x, float y, float z, float w){
+	printf("\t{");
+	printFloat(x); printf(", ");
+	printFloat(y); printf(", ");
+	printFloat(z); printf(", ");
+	printFloat(w);
+	printf("},\n");
+}
+
+int main(int argc, char** argv){
+	if(argc < 5){
+		fprintf(stderr, "Usage: obj2strips model.obj name scale batchSize\n");
+		return 1;
+	}
+	const char* name = argv[2];
+	const float scale = (float)atof(argv[3]);
+	const int batchSize = atoi(argv[4]);
+	if(batchSize < 3){
+		fprintf(stderr, "Batch size should be at least 3.\n");
+		return 1;
+	}
+
+	Mesh mesh;
+	if(!loadObj(argv[1], mesh)){
+		fprintf(stderr, "Unable to load %s.\n", argv[1]);
+		return 1;
+	}
+	const std::vector<Strip> strips = buildStrips(mesh);
+	const Strip out = packStrips(strips, batchSize);
+	if(!checkStrips(mesh, out, batchSize)){
+		fprintf(stderr, "%s: strips do not match the source triangles.\n", name);
+		return 1;
+	}
+
+	printf("// Generated by tools/obj2strips from %s, do not edit.\n", argv[1]);
+	printf("// %u triangles as %u strips, in batches of %d vertices.\n", (unsigned int)mesh.triangles.size(), (unsigned int)strips.size(), batchSize);
+	printf("// Position and S in vertices, normal and T in normals, restart flag in the lowest bit of the normal X.\n\n");
+	printf("int vertex_count_%s = %u;\n\n", name, (unsigned int)out.size());
+	printf("VECTOR vertices_%s[%u] = {\n", name, (unsigned int)out.size());
+	for(size_t i = 0; i < out.size(); ++i){
+		const Vertex& vertex = mesh.vertices[out[i].index];
+		const Vec3& p = mesh.positions[vertex.v];
+		const float s = vertex.t >= 0 ? mesh.uvs[vertex.t].x : 0.0f;
+		printVector(scale * p.x, scale * p.y, scale * p.z, s);
+	}
+	printf("};\n\n");
+	printf("VECTOR normals_%s[%u] = {\n", name, (unsigned int)out.size());
+	for(size_t i = 0; i < out.size(); ++i){
+		const Vertex& vertex = mesh.vertices[out[i].index];
+		const Vec3 n = vertex.n >= 0 ? mesh.normals[vertex.n] : Vec3();
+		const float t = vertex.t >= 0 ? 1.0f - mesh.uvs[vertex.t].y : 0.0f;
+		printVector(withFlag(n.x, out[i].restart), n.y, n.z, t);
+	}
+	printf("};\n");
+
+	const size_t listCount = 3 * mesh.triangles.size();
+	fprintf(stderr, "%s: %u triangles, %u strips, %u vertices instead of %u (%.2f per triangle, %.2fx fewer quadwords).\n",
+			name, (unsigned int)mesh.triangles.size(), (unsigned int)strips.size(), (unsigned int)out.size(), (unsigned int)listCount,
+			(float)out.size() / mesh.triangles.size(), (float)listCount / out.size());
+	return 0;
+}
@@ -13,17 +13,29 @@
 // ROM content.
 
 // Provides:
-// * const uint8_t edgeCounts[]; index: [objectId]
-//		contains the edge count for each object
 // * for each object (N = objectId)
 // 		* const int8_t verticesN[][]; index: [angleId][vertexId] : 
 //			two int8_t representing screenspace x,y in -127,127 foreach vertex at a given camera angle in 0,127
-// 		* const uint16_t edgesN[]; index: [edgeId]
-//			one uint16_t packing the two 8-bits vertexIds for the current edge
+//		* or, if DELTA_VERTICES is defined:
+//			* const int8_t keysN[][]; index: [angleId / KEY_INTERVAL][vertexId] : 
+//				the screenspace vertices at every KEY_INTERVAL angles, in the same layout
+//			* const uint8_t deltasN[][]; index: [angleId][vertexId] :
+//				one uint8_t per vertex packing the two signed 4-bits y,x deltas from the previous angle
+// 		* const uint8_t pathN[]; index: [pointId]
+//			beam path through the object edges, chained in as few strokes as possible: one uint8_t per point,
+//			containing the 8-bits vertexId, with the lowest bit set if the beam moves to the point instead of drawing
+// 		* const uint8_t visibleN[][]; index: [angleId][pointId / 8] :
+//			one bit per path point (lowest bit first), set if the line to the point is visible at a given camera angle,
+//			based on a depth test against the object triangles
+// * const uint8_t pathLengths[]; index: [objectId]
+//		contains the path point count for each object
+// * MAX_PATH_LENGTH: the longest path point count
+// * const uint8_t vertexCounts[]; index: [objectId]
+//		contains the vertex count for each object
+// * MAX_VERTEX_COUNT: the largest vertex count
 
 #include "resources.h"
 
-#define MAX_EDGES 35
 #define MAX_OBJECTS 4
 
 // Helpers
@@ -39,22 +51,38 @@ void packets(int8_t* list)
 	}
 }
 
+#ifdef DELTA_VERTICES
+
+// Sign extension of 4-bits deltas.
+const int8_t nibbles[16] = {0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1};
+
+/* Update decoded vertices in place, from the previous angle to the angle of the deltas, or back */
+void applyDeltas(int8_t* vertices, const uint8_t* deltas, uint8_t count, uint8_t backward)
+{
+	if(backward){
+		for(uint8_t vId = 0; vId != count; ++vId){
+			const uint8_t delta = deltas[vId];
+			*(vertices++) -= nibbles[delta >> 4];
+			*(vertices++) -= nibbles[delta & 0x0F];
+		}
+	} else {
+		for(uint8_t vId = 0; vId != count; ++vId){
+			const uint8_t delta = deltas[vId];
+			*(vertices++) += nibbles[delta >> 4];
+			*(vertices++) += nibbles[delta & 0x0F];
+		}
+	}
+}
+
+#endif
+
 // Main program.
 
 int main(){
 	
 	// Scratch buffers for computations.
-	// scale + #edges * { move dy dx, draw dy dx } + end marker
-	int8_t packs[1 + MAX_EDGES * 3 * 2 + 1];
-
-	// Pre-fill draw list "action" bytes (alternating 0x00 Y X and 0xFF Y X, see packId below)
-	char flip = 0;
-	for(uint16_t i = 1; i < sizeof(packs) / sizeof(packs[0]); i += 3){
-		packs[i] = flip ? 0xFF : 0x00;
-		packs[i+1] = 0x00;
-		packs[i+2] = 0x00;
-		flip = !flip;
-	}
+	// scale + #points * { move or draw, dy dx } + end marker
+	int8_t packs[1 + MAX_PATH_LENGTH * 3 + 1];
 	
 	// Input.
 	uint8_t angle = 0; 
@@ -63,8 +91,17 @@ int main(){
 	uint16_t frameId;
 	intensity(0x7F);
 
-	// All edges.
-	const uint16_t* edges[MAX_OBJECTS] = {&edges0, &edges1, &edges2, &edges3};
+#ifdef DELTA_VERTICES
+	// Projected vertices for the decoded angle, updated incrementally.
+	int8_t decoded[MAX_OBJECTS][2 * MAX_VERTEX_COUNT];
+	const int8_t* keys[MAX_OBJECTS] = {&keys0[0][0], &keys1[0][0], &keys2[0][0], &keys3[0][0]};
+	const uint8_t* deltas[MAX_OBJECTS] = {&deltas0[0][0], &deltas1[0][0], &deltas2[0][0], &deltas3[0][0]};
+	// Invalid angle, to load a keyframe first.
+	uint8_t decodedAngle = 0x80;
+#endif
+
+	// All paths.
+	const uint8_t* paths[MAX_OBJECTS] = {&path0, &path1, &path2, &path3};
 
 
 	while(1){
@@ -111,8 +148,49 @@ int main(){
 		move(0,0);
 
 		// Per-object projected vertices for the current angle.
+#ifdef DELTA_VERTICES
+		{
+			uint8_t forward = (angle - decodedAngle) & 0x7F;
+			uint8_t backward = (decodedAngle - angle) & 0x7F;
+			// Restart from the closest keyframe when far from the decoded angle.
+			if(decodedAngle > 0x7F || (forward > KEY_INTERVAL / 2 && backward > KEY_INTERVAL / 2)){
+				const uint8_t keyId = ((angle + KEY_INTERVAL / 2) & 0x7F) / KEY_INTERVAL;
+				for(uint8_t oid = 0; oid != MAX_OBJECTS; ++oid){
+					const uint8_t size = 2 * vertexCounts[oid];
+					const int8_t* key = keys[oid] + keyId * size;
+					for(uint8_t i = 0; i != size; ++i){
+						decoded[oid][i] = key[i];
+					}
+				}
+				decodedAngle = keyId * KEY_INTERVAL;
+				forward = (angle - decodedAngle) & 0x7F;
+				backward = (decodedAngle - angle) & 0x7F;
+			}
+			// Step one angle at a time.
+			if(forward <= backward){
+				while(decodedAngle != angle){
+					decodedAngle = (decodedAngle + 1) & 0x7F;
+					for(uint8_t oid = 0; oid != MAX_OBJECTS; ++oid){
+						applyDeltas(decoded[oid], deltas[oid] + decodedAngle * vertexCounts[oid], vertexCounts[oid], 0);
+					}
+				}
+			} else {
+				while(decodedAngle != angle){
+					for(uint8_t oid = 0; oid != MAX_OBJECTS; ++oid){
+						applyDeltas(decoded[oid], deltas[oid] + decodedAngle * vertexCounts[oid], vertexCounts[oid], 1);
+					}
+					decodedAngle = (decodedAngle - 1) & 0x7F;
+				}
+			}
+		}
+		const int8_t* vertices[MAX_OBJECTS] = {decoded[0], decoded[1], decoded[2], decoded[3]};
+#else
 		const int8_t* vertices[MAX_OBJECTS] = {&vertices0[angle][0], 
 			&vertices1[angle][0], &vertices2[angle][0], &vertices3[angle][0]};
+#endif
+		// Per-object visible lines for the current angle.
+		const uint8_t* visibles[MAX_OBJECTS] = {&visible0[angle][0], 
+			&visible1[angle][0], &visible2[angle][0], &visible3[angle][0]};
 		
 		// Frame counter.
 #ifdef ONE_OBJECT_PER_FRAME
@@ -129,37 +207,50 @@ int main(){
 			// 		* end of list (0x01)
 			int8_t* packId = &packs[1];
 
-			for(uint8_t eId = 0; eId != edgeCounts[oid]; ++eId){
-				// Read and unpack the two vertex indices
-				const uint16_t id = edges[oid][eId];
-				const int8_t id0 = (int8_t)(id >> 8);
-				const int8_t id1 = (int8_t)(id & 0xFF);
+			// Visibility bits, walked along with the path.
+			const uint8_t* visible = visibles[oid];
+			uint8_t bit = 0x01;
+			// Start of the current move, to merge consecutive moves.
+			uint8_t moving = 0;
+			int8_t starty = 0;
+			int8_t startx = 0;
+
+			for(uint8_t pId = 0; pId != pathLengths[oid]; ++pId){
+				// Unpack the vertex index, hidden lines become moves.
+				const uint8_t id = paths[oid][pId] & 0xFE;
+				const uint8_t draw = *visible & bit;
 				// Corresponding screen space coordinates.
-				const int8_t p0y = vertices[oid][id0];
-				const int8_t p0x = vertices[oid][id0+1];
-				const int8_t p1y = vertices[oid][id1];
-				const int8_t p1x = vertices[oid][id1+1];
-				
-				//packs[packId ] = 0x00; // already setup in init
-				*(++packId) = p0y - prevy;
-				*(++packId) = p0x - prevx;
-				++packId;
-				//packs[packId + 3] = 0xFF; // already setup in init
-				*(++packId) = p1y - p0y;
-				*(++packId) = p1x - p0x;
+				const int8_t py = vertices[oid][id];
+				const int8_t px = vertices[oid][id+1];
+
+				if(!draw && moving){
+					// Extend the previous move.
+					packId -= 3;
+				} else {
+					starty = prevy;
+					startx = prevx;
+				}
+				*packId = draw ? 0xFF : 0x00;
+				*(++packId) = py - starty;
+				*(++packId) = px - startx;
 				++packId;
+				moving = !draw;
+
+				// Store current beam position for next point.
+				prevy = py;
+				prevx = px;
 
-				// Store current beam position for next move.
-				prevy = p1y;
-				prevx = p1x;
-				
+				// Next visibility bit.
+				bit <<= 1;
+				if(bit == 0){
+					bit = 0x01;
+					++visible;
+				}
 			}
 			// Mark end of list
 			*packId = 0x01;
 			// Draw
 			packets(packs);
-			// Unmark end of list
-			*packId = 0x00;
 		}
 		
 	}
@@ -1,4 +1,4 @@
-const int8_t vertices0[][32] = { 
+const int8_t keys0[][32] = { 
 	{
 		-19, -42, 
 		-5, -49, 
@@ -17,564 +17,6 @@ const int8_t vertices0[][32] = {
 		1, -47, 
 		-30, -50, 
 	},
-	{
-		-20, -41, 
-		-5, -47, 
-		-4, -41, 
-		14, -37, 
-		-13, -26, 
-		-10, -24, 
-		1, -22, 
-		0, -17, 
-		2, -26, 
-		1, -22, 
-		-28, -45, 
-		-4, -49, 
-		-4, -51, 
-		1, -52, 
-		1, -47, 
-		-31, -49, 
-	},
-	{
-		-20, -40, 
-		-5, -46, 
-		-4, -41, 
-		14, -36, 
-		-13, -24, 
-		-10, -24, 
-		1, -19, 
-		0, -17, 
-		2, -24, 
-		1, -21, 
-		-29, -45, 
-		-4, -49, 
-		-4, -50, 
-		1, -52, 
-		1, -47, 
-		-31, -49, 
-	},
-	{
-		-20, -40, 
-		-5, -44, 
-		-4, -41, 
-		14, -35, 
-		-13, -22, 
-		-10, -23, 
-		1, -16, 
-		0, -17, 
-		2, -22, 
-		1, -21, 
-		-30, -44, 
-		-4, -48, 
-		-4, -49, 
-		1, -51, 
-		1, -47, 
-		-32, -48, 
-	},
-	{
-		-21, -39, 
-		-5, -42, 
-		-4, -40, 
-		14, -34, 
-		-13, -20, 
-		-10, -22, 
-		1, -13, 
-		0, -17, 
-		2, -19, 
-		1, -20, 
-		-30, -44, 
-		-4, -47, 
-		-4, -48, 
-		1, -49, 
-		1, -46, 
-		-33, -46, 
-	},
-	{
-		-21, -37, 
-		-5, -40, 
-		-4, -40, 
-		14, -33, 
-		-13, -18, 
-		-10, -22, 
-		1, -10, 
-		0, -17, 
-		2, -17, 
-		1, -20, 
-		-31, -43, 
-		-4, -47, 
-		-4, -47, 
-		1, -48, 
-		1, -46, 
-		-33, -45, 
-	},
-	{
-		-21, -36, 
-		-5, -38, 
-		-5, -39, 
-		14, -32, 
-		-13, -16, 
-		-10, -21, 
-		1, -6, 
-		0, -16, 
-		2, -15, 
-		1, -19, 
-		-31, -42, 
-		-4, -46, 
-		-4, -46, 
-		1, -46, 
-		1, -45, 
-		-34, -43, 
-	},
-	{
-		-22, -34, 
-		-5, -35, 
-		-5, -39, 
-		15, -30, 
-		-13, -14, 
-		-10, -20, 
-		1, -3, 
-		0, -16, 
-		2, -12, 
-		1, -18, 
-		-32, -41, 
-		-4, -44, 
-		-4, -44, 
-		1, -44, 
-		1, -44, 
-		-34, -42, 
-	},
-	{
-		-22, -33, 
-		-5, -33, 
-		-5, -38, 
-		15, -28, 
-		-13, -11, 
-		-10, -19, 
-		1, 1, 
-		0, -16, 
-		2, -9, 
-		1, -18, 
-		-32, -40, 
-		-4, -43, 
-		-4, -42, 
-		1, -42, 
-		1, -43, 
-		-35, -40, 
-	},
-	{
-		-22, -31, 
-		-5, -30, 
-		-5, -37, 
-		15, -27, 
-		-13, -9, 
-		-10, -18, 
-		1, 4, 
-		0, -16, 
-		2, -7, 
-		1, -17, 
-		-33, -38, 
-		-4, -41, 
-		-4, -41, 
-		1, -40, 
-		1, -42, 
-		-35, -38, 
-	},
-	{
-		-22, -29, 
-		-5, -26, 
-		-5, -36, 
-		15, -25, 
-		-13, -7, 
-		-11, -17, 
-		1, 8, 
-		0, -16, 
-		2, -4, 
-		1, -16, 
-		-33, -37, 
-		-4, -40, 
-		-4, -38, 
-		1, -37, 
-		1, -41, 
-		-36, -35, 
-	},
-	{
-		-23, -27, 
-		-5, -23, 
-		-5, -35, 
-		15, -23, 
-		-13, -4, 
-		-11, -16, 
-		1, 11, 
-		0, -15, 
-		2, -1, 
-		1, -15, 
-		-33, -35, 
-		-4, -38, 
-		-4, -36, 
-		1, -34, 
-		1, -39, 
-		-36, -33, 
-	},
-	{
-		-23, -25, 
-		-6, -20, 
-		-5, -33, 
-		15, -21, 
-		-13, -2, 
-		-11, -15, 
-		1, 14, 
-		0, -15, 
-		2, 2, 
-		1, -14, 
-		-34, -33, 
-		-4, -36, 
-		-4, -33, 
-		1, -31, 
-		1, -37, 
-		-37, -30, 
-	},
-	{
-		-23, -22, 
-		-6, -16, 
-		-5, -32, 
-		15, -18, 
-		-13, 1, 
-		-11, -14, 
-		1, 18, 
-		0, -14, 
-		2, 4, 
-		1, -13, 
-		-34, -31, 
-		-4, -33, 
-		-4, -31, 
-		1, -28, 
-		1, -35, 
-		-37, -27, 
-	},
-	{
-		-23, -20, 
-		-6, -13, 
-		-5, -30, 
-		16, -16, 
-		-13, 3, 
-		-11, -13, 
-		1, 21, 
-		0, -14, 
-		2, 7, 
-		1, -12, 
-		-35, -29, 
-		-4, -31, 
-		-4, -28, 
-		1, -25, 
-		1, -33, 
-		-38, -24, 
-	},
-	{
-		-23, -17, 
-		-6, -9, 
-		-5, -28, 
-		16, -14, 
-		-13, 6, 
-		-11, -11, 
-		1, 24, 
-		0, -14, 
-		2, 10, 
-		1, -11, 
-		-35, -27, 
-		-4, -28, 
-		-5, -25, 
-		1, -21, 
-		1, -31, 
-		-38, -21, 
-	},
-	{
-		-24, -15, 
-		-6, -5, 
-		-5, -26, 
-		16, -11, 
-		-13, 8, 
-		-11, -10, 
-		1, 26, 
-		0, -13, 
-		2, 12, 
-		1, -10, 
-		-35, -24, 
-		-4, -25, 
-		-5, -21, 
-		1, -17, 
-		1, -28, 
-		-38, -17, 
-	},
-	{
-		-24, -12, 
-		-6, -1, 
-		-5, -24, 
-		16, -9, 
-		-13, 11, 
-		-11, -9, 
-		1, 29, 
-		0, -12, 
-		2, 15, 
-		1, -8, 
-		-36, -21, 
-		-4, -22, 
-		-5, -18, 
-		1, -14, 
-		1, -26, 
-		-38, -14, 
-	},
-	{
-		-24, -9, 
-		-6, 3, 
-		-5, -22, 
-		16, -6, 
-		-13, 13, 
-		-11, -7, 
-		1, 32, 
-		0, -12, 
-		2, 17, 
-		1, -7, 
-		-36, -19, 
-		-5, -19, 
-		-5, -14, 
-		1, -10, 
-		1, -23, 
-		-39, -10, 
-	},
-	{
-		-24, -6, 
-		-6, 6, 
-		-5, -20, 
-		16, -3, 
-		-13, 15, 
-		-11, -6, 
-		1, 34, 
-		0, -11, 
-		2, 20, 
-		1, -6, 
-		-36, -16, 
-		-5, -16, 
-		-5, -11, 
-		1, -6, 
-		1, -20, 
-		-39, -6, 
-	},
-	{
-		-24, -3, 
-		-6, 10, 
-		-5, -17, 
-		16, -1, 
-		-13, 18, 
-		-11, -4, 
-		1, 36, 
-		0, -10, 
-		2, 22, 
-		1, -5, 
-		-36, -13, 
-		-5, -13, 
-		-5, -7, 
-		1, -2, 
-		1, -17, 
-		-39, -3, 
-	},
-	{
-		-24, 0, 
-		-6, 14, 
-		-5, -15, 
-		16, 2, 
-		-13, 20, 
-		-11, -3, 
-		1, 38, 
-		0, -10, 
-		2, 24, 
-		1, -3, 
-		-37, -10, 
-		-5, -9, 
-		-5, -3, 
-		1, 2, 
-		1, -14, 
-		-39, 1, 
-	},
-	{
-		-24, 3, 
-		-6, 18, 
-		-5, -12, 
-		16, 5, 
-		-13, 22, 
-		-11, -1, 
-		1, 40, 
-		0, -9, 
-		2, 26, 
-		1, -2, 
-		-37, -7, 
-		-5, -6, 
-		-5, 0, 
-		1, 6, 
-		1, -11, 
-		-39, 5, 
-	},
-	{
-		-24, 6, 
-		-5, 21, 
-		-5, -9, 
-		16, 7, 
-		-13, 24, 
-		-11, 0, 
-		1, 42, 
-		0, -8, 
-		2, 28, 
-		1, -1, 
-		-37, -4, 
-		-5, -2, 
-		-5, 4, 
-		1, 10, 
-		1, -7, 
-		-39, 8, 
-	},
-	{
-		-24, 9, 
-		-5, 24, 
-		-5, -7, 
-		16, 10, 
-		-13, 26, 
-		-11, 2, 
-		1, 43, 
-		0, -7, 
-		2, 30, 
-		1, 1, 
-		-37, 0, 
-		-5, 1, 
-		-5, 8, 
-		1, 14, 
-		1, -4, 
-		-39, 12, 
-	},
-	{
-		-24, 11, 
-		-5, 28, 
-		-5, -4, 
-		16, 12, 
-		-12, 27, 
-		-11, 3, 
-		1, 44, 
-		0, -6, 
-		2, 32, 
-		1, 2, 
-		-37, 3, 
-		-5, 5, 
-		-5, 11, 
-		1, 18, 
-		1, -1, 
-		-38, 15, 
-	},
-	{
-		-24, 14, 
-		-5, 31, 
-		-5, -1, 
-		16, 15, 
-		-12, 29, 
-		-11, 5, 
-		1, 45, 
-		0, -6, 
-		2, 33, 
-		1, 3, 
-		-37, 6, 
-		-5, 8, 
-		-5, 15, 
-		1, 22, 
-		1, 2, 
-		-38, 19, 
-	},
-	{
-		-23, 17, 
-		-5, 34, 
-		-5, 1, 
-		16, 17, 
-		-12, 30, 
-		-11, 6, 
-		1, 46, 
-		0, -5, 
-		2, 34, 
-		1, 5, 
-		-37, 9, 
-		-5, 12, 
-		-5, 19, 
-		1, 25, 
-		1, 6, 
-		-38, 22, 
-	},
-	{
-		-23, 19, 
-		-5, 36, 
-		-5, 4, 
-		15, 19, 
-		-12, 32, 
-		-11, 7, 
-		1, 47, 
-		0, -4, 
-		2, 36, 
-		1, 6, 
-		-37, 12, 
-		-5, 15, 
-		-5, 22, 
-		1, 28, 
-		1, 9, 
-		-37, 25, 
-	},
-	{
-		-23, 22, 
-		-5, 39, 
-		-5, 7, 
-		15, 22, 
-		-12, 33, 
-		-11, 9, 
-		1, 48, 
-		0, -3, 
-		2, 37, 
-		1, 7, 
-		-36, 15, 
-		-5, 18, 
-		-5, 25, 
-		1, 32, 
-		1, 12, 
-		-37, 28, 
-	},
-	{
-		-23, 24, 
-		-5, 41, 
-		-5, 10, 
-		15, 24, 
-		-12, 34, 
-		-11, 10, 
-		1, 48, 
-		0, -2, 
-		2, 38, 
-		1, 8, 
-		-36, 18, 
-		-4, 22, 
-		-4, 28, 
-		1, 35, 
-		1, 15, 
-		-37, 31, 
-	},
-	{
-		-23, 27, 
-		-5, 43, 
-		-5, 12, 
-		15, 26, 
-		-12, 35, 
-		-11, 12, 
-		1, 48, 
-		0, -1, 
-		2, 39, 
-		1, 10, 
-		-36, 21, 
-		-4, 25, 
-		-4, 31, 
-		1, 37, 
-		1, 19, 
-		-36, 34, 
-	},
 	{
 		-22, 29, 
 		-5, 45, 
@@ -593,564 +35,6 @@ const int8_t vertices0[][32] = {
 		1, 22, 
 		-36, 36, 
 	},
-	{
-		-22, 31, 
-		-5, 46, 
-		-5, 17, 
-		15, 29, 
-		-11, 36, 
-		-11, 14, 
-		1, 48, 
-		0, 1, 
-		1, 40, 
-		1, 12, 
-		-35, 26, 
-		-4, 30, 
-		-4, 36, 
-		1, 42, 
-		1, 24, 
-		-35, 39, 
-	},
-	{
-		-22, 32, 
-		-5, 48, 
-		-5, 20, 
-		15, 31, 
-		-11, 37, 
-		-11, 15, 
-		1, 48, 
-		0, 2, 
-		1, 40, 
-		1, 13, 
-		-35, 28, 
-		-4, 33, 
-		-4, 39, 
-		1, 44, 
-		1, 27, 
-		-35, 41, 
-	},
-	{
-		-22, 34, 
-		-5, 49, 
-		-5, 22, 
-		14, 32, 
-		-11, 37, 
-		-11, 16, 
-		1, 48, 
-		0, 3, 
-		1, 41, 
-		1, 14, 
-		-34, 31, 
-		-4, 35, 
-		-4, 41, 
-		1, 46, 
-		1, 30, 
-		-34, 43, 
-	},
-	{
-		-21, 36, 
-		-5, 50, 
-		-5, 24, 
-		14, 34, 
-		-11, 38, 
-		-11, 18, 
-		1, 48, 
-		0, 4, 
-		1, 41, 
-		1, 15, 
-		-34, 33, 
-		-4, 37, 
-		-4, 43, 
-		1, 48, 
-		1, 32, 
-		-34, 44, 
-	},
-	{
-		-21, 37, 
-		-4, 51, 
-		-5, 26, 
-		14, 35, 
-		-11, 38, 
-		-10, 19, 
-		1, 47, 
-		0, 4, 
-		1, 41, 
-		1, 16, 
-		-34, 35, 
-		-4, 39, 
-		-4, 45, 
-		1, 49, 
-		1, 34, 
-		-33, 46, 
-	},
-	{
-		-21, 38, 
-		-4, 52, 
-		-5, 28, 
-		14, 36, 
-		-10, 38, 
-		-10, 19, 
-		1, 47, 
-		0, 5, 
-		1, 41, 
-		1, 17, 
-		-33, 36, 
-		-4, 41, 
-		-4, 46, 
-		1, 51, 
-		1, 36, 
-		-32, 47, 
-	},
-	{
-		-20, 39, 
-		-4, 52, 
-		-5, 30, 
-		14, 37, 
-		-10, 38, 
-		-10, 20, 
-		1, 46, 
-		0, 6, 
-		1, 41, 
-		1, 18, 
-		-33, 38, 
-		-4, 43, 
-		-4, 47, 
-		1, 52, 
-		1, 38, 
-		-32, 48, 
-	},
-	{
-		-20, 40, 
-		-4, 52, 
-		-5, 32, 
-		13, 38, 
-		-10, 38, 
-		-10, 21, 
-		1, 45, 
-		0, 7, 
-		1, 40, 
-		1, 18, 
-		-32, 39, 
-		-4, 44, 
-		-4, 49, 
-		1, 53, 
-		1, 40, 
-		-31, 49, 
-	},
-	{
-		-20, 41, 
-		-4, 52, 
-		-5, 33, 
-		13, 38, 
-		-10, 38, 
-		-10, 22, 
-		1, 44, 
-		0, 8, 
-		1, 40, 
-		1, 19, 
-		-32, 41, 
-		-4, 45, 
-		-4, 49, 
-		1, 53, 
-		1, 41, 
-		-31, 50, 
-	},
-	{
-		-19, 42, 
-		-4, 52, 
-		-5, 35, 
-		13, 39, 
-		-10, 38, 
-		-10, 23, 
-		1, 43, 
-		0, 9, 
-		1, 40, 
-		1, 20, 
-		-31, 42, 
-		-4, 46, 
-		-4, 50, 
-		1, 54, 
-		1, 43, 
-		-30, 50, 
-	},
-	{
-		-19, 42, 
-		-4, 52, 
-		-5, 36, 
-		13, 39, 
-		-10, 37, 
-		-10, 23, 
-		1, 42, 
-		0, 9, 
-		1, 39, 
-		1, 20, 
-		-31, 43, 
-		-4, 47, 
-		-4, 51, 
-		1, 54, 
-		1, 44, 
-		-29, 51, 
-	},
-	{
-		-19, 43, 
-		-4, 52, 
-		-5, 37, 
-		13, 39, 
-		-10, 37, 
-		-10, 24, 
-		1, 41, 
-		0, 10, 
-		1, 39, 
-		1, 21, 
-		-30, 44, 
-		-4, 48, 
-		-4, 51, 
-		1, 54, 
-		1, 45, 
-		-29, 51, 
-	},
-	{
-		-19, 43, 
-		-4, 52, 
-		-5, 38, 
-		12, 40, 
-		-9, 36, 
-		-10, 24, 
-		1, 40, 
-		0, 11, 
-		1, 38, 
-		1, 21, 
-		-30, 44, 
-		-4, 48, 
-		-3, 51, 
-		1, 54, 
-		1, 46, 
-		-28, 51, 
-	},
-	{
-		-18, 43, 
-		-4, 51, 
-		-5, 39, 
-		12, 40, 
-		-9, 36, 
-		-10, 24, 
-		1, 39, 
-		0, 12, 
-		1, 37, 
-		1, 22, 
-		-29, 45, 
-		-4, 49, 
-		-3, 51, 
-		1, 54, 
-		1, 46, 
-		-28, 51, 
-	},
-	{
-		-18, 43, 
-		-4, 50, 
-		-5, 39, 
-		12, 40, 
-		-9, 35, 
-		-10, 25, 
-		1, 38, 
-		0, 12, 
-		1, 36, 
-		1, 22, 
-		-29, 45, 
-		-3, 49, 
-		-3, 51, 
-		1, 53, 
-		1, 47, 
-		-27, 51, 
-	},
-	{
-		-18, 43, 
-		-4, 50, 
-		-4, 40, 
-		12, 39, 
-		-9, 34, 
-		-10, 25, 
-		1, 37, 
-		0, 13, 
-		1, 35, 
-		1, 22, 
-		-28, 45, 
-		-3, 49, 
-		-3, 51, 
-		1, 53, 
-		1, 47, 
-		-27, 50, 
-	},
-	{
-		-17, 43, 
-		-3, 49, 
-		-4, 40, 
-		12, 39, 
-		-9, 34, 
-		-9, 25, 
-		1, 35, 
-		0, 13, 
-		1, 35, 
-		1, 22, 
-		-28, 45, 
-		-3, 49, 
-		-3, 51, 
-		1, 52, 
-		1, 47, 
-		-26, 50, 
-	},
-	{
-		-17, 42, 
-		-3, 48, 
-		-4, 41, 
-		12, 39, 
-		-9, 33, 
-		-9, 25, 
-		1, 34, 
-		0, 14, 
-		1, 34, 
-		1, 22, 
-		-27, 45, 
-		-3, 49, 
-		-3, 50, 
-		1, 52, 
-		1, 47, 
-		-26, 49, 
-	},
-	{
-		-17, 42, 
-		-3, 47, 
-		-4, 41, 
-		11, 38, 
-		-9, 32, 
-		-9, 25, 
-		1, 33, 
-		0, 14, 
-		1, 33, 
-		1, 23, 
-		-27, 45, 
-		-3, 49, 
-		-3, 50, 
-		1, 51, 
-		1, 47, 
-		-25, 49, 
-	},
-	{
-		-17, 41, 
-		-3, 46, 
-		-4, 41, 
-		11, 38, 
-		-9, 31, 
-		-9, 25, 
-		1, 31, 
-		0, 15, 
-		1, 32, 
-		1, 23, 
-		-26, 45, 
-		-3, 48, 
-		-3, 49, 
-		1, 50, 
-		1, 47, 
-		-25, 48, 
-	},
-	{
-		-16, 41, 
-		-3, 45, 
-		-4, 41, 
-		11, 37, 
-		-9, 30, 
-		-9, 25, 
-		1, 30, 
-		0, 15, 
-		1, 30, 
-		1, 23, 
-		-26, 44, 
-		-3, 48, 
-		-3, 48, 
-		1, 49, 
-		1, 47, 
-		-24, 47, 
-	},
-	{
-		-16, 40, 
-		-3, 43, 
-		-4, 41, 
-		11, 37, 
-		-8, 29, 
-		-9, 25, 
-		1, 28, 
-		0, 15, 
-		1, 29, 
-		1, 22, 
-		-25, 44, 
-		-3, 47, 
-		-3, 48, 
-		1, 48, 
-		1, 46, 
-		-24, 46, 
-	},
-	{
-		-16, 39, 
-		-3, 42, 
-		-4, 41, 
-		11, 36, 
-		-8, 28, 
-		-9, 25, 
-		1, 27, 
-		0, 16, 
-		1, 28, 
-		1, 22, 
-		-25, 43, 
-		-3, 46, 
-		-3, 47, 
-		1, 47, 
-		1, 46, 
-		-23, 45, 
-	},
-	{
-		-16, 39, 
-		-3, 41, 
-		-4, 40, 
-		11, 35, 
-		-8, 27, 
-		-9, 24, 
-		1, 25, 
-		0, 16, 
-		1, 27, 
-		1, 22, 
-		-25, 43, 
-		-3, 46, 
-		-3, 46, 
-		1, 46, 
-		1, 45, 
-		-23, 44, 
-	},
-	{
-		-15, 38, 
-		-3, 40, 
-		-4, 40, 
-		10, 34, 
-		-8, 26, 
-		-9, 24, 
-		1, 24, 
-		0, 16, 
-		1, 26, 
-		1, 22, 
-		-24, 42, 
-		-3, 45, 
-		-3, 45, 
-		1, 45, 
-		1, 45, 
-		-23, 43, 
-	},
-	{
-		-15, 37, 
-		-3, 38, 
-		-4, 39, 
-		10, 34, 
-		-8, 25, 
-		-9, 24, 
-		1, 22, 
-		0, 16, 
-		1, 24, 
-		1, 22, 
-		-24, 41, 
-		-3, 44, 
-		-3, 43, 
-		1, 43, 
-		1, 44, 
-		-22, 42, 
-	},
-	{
-		-15, 36, 
-		-3, 37, 
-		-4, 39, 
-		10, 33, 
-		-8, 23, 
-		-9, 23, 
-		1, 21, 
-		0, 17, 
-		1, 23, 
-		1, 21, 
-		-23, 40, 
-		-3, 43, 
-		-3, 42, 
-		1, 42, 
-		1, 43, 
-		-22, 41, 
-	},
-	{
-		-15, 35, 
-		-3, 35, 
-		-4, 38, 
-		10, 32, 
-		-8, 22, 
-		-8, 23, 
-		1, 19, 
-		0, 17, 
-		1, 22, 
-		1, 21, 
-		-23, 39, 
-		-3, 42, 
-		-3, 41, 
-		1, 41, 
-		1, 42, 
-		-22, 39, 
-	},
-	{
-		-14, 34, 
-		-3, 34, 
-		-4, 37, 
-		10, 31, 
-		-8, 21, 
-		-8, 22, 
-		1, 17, 
-		0, 17, 
-		1, 21, 
-		1, 21, 
-		-23, 38, 
-		-3, 40, 
-		-3, 40, 
-		1, 39, 
-		1, 41, 
-		-21, 38, 
-	},
-	{
-		-14, 32, 
-		-3, 32, 
-		-4, 36, 
-		10, 30, 
-		-8, 20, 
-		-8, 22, 
-		1, 16, 
-		0, 17, 
-		1, 19, 
-		1, 20, 
-		-22, 37, 
-		-3, 39, 
-		-3, 38, 
-		1, 38, 
-		1, 40, 
-		-21, 37, 
-	},
-	{
-		-14, 31, 
-		-3, 31, 
-		-4, 36, 
-		10, 28, 
-		-8, 19, 
-		-8, 21, 
-		1, 14, 
-		0, 17, 
-		1, 18, 
-		1, 20, 
-		-22, 36, 
-		-3, 38, 
-		-3, 37, 
-		1, 36, 
-		1, 39, 
-		-21, 35, 
-	},
 	{
 		-14, 30, 
 		-3, 29, 
@@ -1170,1167 +54,317 @@ const int8_t vertices0[][32] = {
 		-20, 34, 
 	},
 	{
-		-14, 29, 
-		-3, 27, 
-		-3, 34, 
-		10, 26, 
-		-8, 16, 
-		-8, 20, 
-		1, 11, 
-		0, 16, 
-		1, 15, 
-		1, 18, 
-		-21, 34, 
-		-3, 35, 
-		-2, 34, 
-		1, 33, 
-		1, 36, 
-		-20, 32, 
-	},
-	{
-		-14, 28, 
-		-3, 26, 
-		-3, 33, 
-		9, 25, 
-		-8, 15, 
-		-8, 19, 
-		1, 9, 
-		0, 16, 
-		1, 14, 
-		1, 18, 
-		-21, 33, 
-		-3, 34, 
-		-2, 33, 
-		1, 31, 
-		1, 35, 
-		-20, 31, 
-	},
-	{
-		-14, 26, 
-		-3, 24, 
-		-3, 32, 
-		9, 24, 
-		-8, 13, 
-		-8, 19, 
-		1, 8, 
-		0, 16, 
-		1, 12, 
-		1, 17, 
-		-21, 31, 
-		-2, 33, 
-		-2, 31, 
-		1, 30, 
-		1, 34, 
-		-20, 29, 
-	},
-	{
-		-13, 25, 
-		-3, 23, 
-		-3, 31, 
-		9, 22, 
-		-8, 12, 
-		-8, 18, 
-		1, 6, 
-		0, 16, 
-		1, 11, 
-		1, 17, 
-		-21, 30, 
-		-2, 31, 
-		-2, 30, 
-		1, 28, 
-		1, 33, 
-		-19, 28, 
-	},
-	{
-		-13, 24, 
-		-3, 21, 
-		-3, 29, 
-		9, 21, 
-		-8, 11, 
-		-8, 17, 
-		1, 5, 
-		0, 16, 
-		1, 9, 
-		1, 16, 
-		-20, 29, 
-		-2, 30, 
-		-2, 28, 
-		1, 27, 
-		1, 31, 
-		-19, 26, 
-	},
-	{
-		-13, 22, 
-		-3, 19, 
-		-3, 28, 
-		9, 20, 
-		-7, 9, 
-		-8, 16, 
-		1, 3, 
-		0, 15, 
-		1, 8, 
-		1, 15, 
-		-20, 27, 
-		-2, 28, 
-		-2, 27, 
-		0, 25, 
-		1, 30, 
-		-19, 24, 
-	},
-	{
-		-13, 21, 
-		-3, 18, 
-		-3, 27, 
-		9, 19, 
-		-7, 8, 
-		-8, 15, 
-		1, 1, 
-		0, 15, 
-		1, 6, 
-		1, 14, 
-		-20, 26, 
-		-2, 27, 
-		-2, 25, 
-		0, 23, 
-		1, 28, 
-		-19, 23, 
-	},
-	{
-		-13, 19, 
-		-3, 16, 
-		-3, 26, 
-		9, 17, 
-		-7, 6, 
-		-8, 14, 
-		1, 0, 
-		0, 15, 
-		1, 5, 
-		1, 14, 
-		-20, 25, 
-		-2, 25, 
-		-2, 23, 
-		0, 22, 
-		1, 27, 
-		-19, 21, 
-	},
-	{
-		-13, 18, 
-		-3, 14, 
-		-3, 25, 
-		9, 16, 
-		-7, 5, 
-		-8, 14, 
-		1, -2, 
-		0, 14, 
-		1, 4, 
-		1, 13, 
-		-20, 23, 
-		-2, 24, 
-		-2, 22, 
-		0, 20, 
-		1, 26, 
-		-19, 20, 
-	},
-	{
-		-13, 17, 
-		-3, 13, 
-		-3, 23, 
-		9, 14, 
-		-7, 4, 
-		-8, 13, 
-		1, -4, 
-		0, 14, 
-		1, 2, 
-		1, 12, 
-		-19, 22, 
-		-2, 22, 
-		-2, 20, 
-		0, 18, 
-		1, 24, 
-		-18, 18, 
-	},
-	{
-		-13, 15, 
-		-3, 11, 
-		-3, 22, 
-		9, 13, 
-		-7, 2, 
-		-8, 12, 
-		1, -5, 
-		0, 13, 
-		1, 1, 
-		1, 11, 
-		-19, 20, 
-		-2, 21, 
-		-2, 18, 
-		0, 16, 
-		1, 23, 
-		-18, 16, 
-	},
-	{
-		-13, 14, 
-		-3, 9, 
-		-3, 21, 
-		9, 12, 
-		-7, 1, 
-		-8, 11, 
-		1, -7, 
-		0, 13, 
-		1, -1, 
-		1, 10, 
-		-19, 19, 
-		-2, 19, 
-		-2, 17, 
-		0, 15, 
-		1, 21, 
-		-18, 15, 
-	},
-	{
-		-13, 12, 
-		-3, 7, 
-		-3, 19, 
-		9, 10, 
-		-7, 0, 
-		-8, 10, 
-		1, -9, 
-		0, 12, 
-		1, -2, 
-		1, 10, 
-		-19, 17, 
-		-2, 17, 
-		-2, 15, 
-		0, 13, 
-		1, 19, 
-		-18, 13, 
-	},
-	{
-		-12, 11, 
-		-3, 6, 
-		-3, 18, 
-		9, 9, 
-		-7, -2, 
-		-8, 9, 
-		1, -10, 
-		0, 12, 
-		1, -4, 
-		1, 9, 
-		-19, 16, 
-		-2, 16, 
-		-2, 13, 
-		0, 11, 
-		1, 18, 
-		-18, 11, 
-	},
-	{
-		-12, 9, 
-		-3, 4, 
-		-3, 17, 
-		9, 7, 
-		-7, -3, 
-		-8, 8, 
-		1, -12, 
-		0, 11, 
-		1, -5, 
-		1, 8, 
-		-19, 14, 
-		-2, 14, 
-		-2, 12, 
-		0, 10, 
-		1, 16, 
-		-18, 10, 
-	},
-	{
-		-12, 8, 
-		-3, 2, 
-		-3, 15, 
-		9, 6, 
-		-7, -5, 
-		-8, 7, 
-		1, -13, 
-		0, 11, 
-		1, -7, 
-		1, 7, 
-		-19, 13, 
-		-2, 13, 
-		-2, 10, 
-		0, 8, 
-		1, 15, 
-		-18, 8, 
-	},
-	{
-		-12, 6, 
-		-3, 1, 
-		-3, 14, 
-		9, 5, 
-		-7, -6, 
-		-8, 6, 
-		1, -15, 
-		0, 10, 
-		1, -8, 
-		1, 6, 
-		-19, 11, 
-		-2, 11, 
-		-2, 8, 
-		0, 6, 
-		1, 13, 
-		-18, 6, 
-	},
-	{
-		-12, 5, 
-		-3, -1, 
-		-3, 12, 
-		9, 3, 
-		-7, -7, 
-		-7, 5, 
-		1, -17, 
-		0, 10, 
-		1, -10, 
-		1, 5, 
-		-19, 10, 
-		-2, 9, 
-		-2, 7, 
-		0, 4, 
-		1, 12, 
-		-18, 5, 
-	},
-	{
-		-12, 3, 
-		-3, -3, 
-		-3, 11, 
-		9, 2, 
-		-7, -9, 
-		-7, 4, 
-		1, -18, 
-		0, 9, 
-		1, -11, 
-		1, 4, 
-		-18, 8, 
-		-2, 8, 
-		-2, 5, 
-		0, 3, 
-		1, 10, 
-		-18, 3, 
-	},
-	{
-		-12, 2, 
-		-3, -5, 
-		-3, 9, 
-		9, 0, 
-		-7, -10, 
-		-7, 3, 
-		1, -20, 
-		0, 8, 
-		1, -12, 
-		1, 3, 
-		-18, 6, 
-		-2, 6, 
-		-2, 3, 
-		0, 1, 
-		1, 8, 
-		-18, 1, 
-	},
-	{
-		-12, 0, 
-		-3, -6, 
-		-3, 8, 
-		9, -1, 
-		-8, -12, 
-		-7, 2, 
-		1, -21, 
-		0, 8, 
-		1, -14, 
-		1, 2, 
-		-18, 5, 
-		-2, 4, 
-		-2, 2, 
-		0, -1, 
-		1, 7, 
-		-18, 0, 
-	},
-	{
-		-12, -1, 
-		-3, -8, 
-		-3, 7, 
-		9, -3, 
-		-8, -13, 
-		-7, 1, 
-		1, -23, 
-		0, 7, 
-		1, -15, 
-		1, 1, 
-		-18, 3, 
-		-2, 3, 
-		-2, 0, 
-		0, -3, 
-		1, 5, 
-		-18, -2, 
-	},
-	{
-		-12, -3, 
-		-3, -10, 
-		-3, 5, 
-		9, -4, 
-		-8, -14, 
-		-7, 0, 
-		1, -24, 
-		0, 6, 
-		1, -17, 
-		1, 0, 
-		-18, 2, 
-		-2, 1, 
-		-2, -2, 
-		0, -4, 
-		1, 4, 
-		-18, -4, 
-	},
-	{
-		-12, -4, 
-		-3, -11, 
-		-3, 4, 
-		9, -5, 
-		-8, -16, 
-		-7, -1, 
-		1, -26, 
-		0, 6, 
-		1, -18, 
-		1, 0, 
-		-18, 0, 
-		-2, -1, 
-		-2, -4, 
-		0, -6, 
-		1, 2, 
-		-18, -6, 
-	},
-	{
-		-12, -6, 
-		-3, -13, 
-		-3, 2, 
-		9, -7, 
-		-8, -17, 
-		-7, -2, 
-		1, -27, 
-		0, 5, 
-		1, -19, 
-		1, -1, 
-		-18, -1, 
-		-2, -2, 
-		-2, -5, 
-		0, -8, 
-		1, 0, 
-		-18, -7, 
-	},
-	{
-		-12, -7, 
-		-3, -15, 
-		-3, 1, 
-		9, -8, 
-		-8, -18, 
-		-7, -3, 
-		1, -29, 
-		0, 4, 
-		1, -21, 
-		1, -2, 
-		-18, -3, 
-		-2, -4, 
-		-2, -7, 
-		0, -10, 
-		1, -1, 
-		-18, -9, 
-	},
-	{
-		-12, -9, 
-		-3, -17, 
-		-3, -1, 
-		9, -10, 
-		-8, -19, 
-		-7, -4, 
-		1, -30, 
-		0, 4, 
-		1, -22, 
-		1, -3, 
-		-18, -5, 
-		-2, -6, 
-		-2, -9, 
-		0, -11, 
-		1, -3, 
-		-18, -11, 
-	},
-	{
-		-12, -10, 
-		-3, -18, 
-		-3, -2, 
-		9, -11, 
-		-8, -21, 
-		-7, -5, 
-		1, -32, 
-		0, 3, 
-		1, -23, 
-		1, -4, 
-		-18, -6, 
-		-2, -7, 
-		-2, -10, 
-		0, -13, 
-		1, -4, 
-		-18, -12, 
-	},
-	{
-		-13, -12, 
-		-3, -20, 
-		-3, -4, 
-		9, -12, 
-		-8, -22, 
-		-8, -6, 
-		1, -33, 
-		0, 2, 
-		1, -25, 
-		1, -5, 
-		-18, -8, 
-		-2, -9, 
-		-2, -12, 
-		0, -15, 
-		1, -6, 
-		-18, -14, 
-	},
-	{
-		-13, -13, 
-		-3, -22, 
-		-3, -5, 
-		9, -14, 
-		-8, -23, 
-		-8, -7, 
-		1, -34, 
-		0, 2, 
-		1, -26, 
-		1, -6, 
-		-18, -9, 
-		-2, -11, 
-		-2, -14, 
-		0, -17, 
-		1, -8, 
-		-18, -16, 
-	},
-	{
-		-13, -15, 
-		-3, -23, 
-		-3, -7, 
-		9, -15, 
-		-8, -24, 
-		-8, -8, 
-		1, -36, 
-		0, 1, 
-		1, -27, 
-		1, -7, 
-		-19, -11, 
-		-2, -12, 
-		-2, -15, 
-		0, -18, 
-		1, -9, 
-		-18, -17, 
-	},
-	{
-		-13, -16, 
-		-3, -25, 
-		-3, -8, 
-		9, -17, 
-		-8, -25, 
-		-8, -9, 
-		1, -37, 
-		0, 0, 
-		1, -28, 
-		1, -8, 
-		-19, -12, 
-		-2, -14, 
-		-2, -17, 
-		0, -20, 
-		1, -11, 
-		-19, -19, 
-	},
-	{
-		-13, -18, 
-		-3, -26, 
-		-3, -10, 
-		9, -18, 
-		-8, -27, 
-		-8, -10, 
-		1, -38, 
-		0, -1, 
-		1, -29, 
-		1, -9, 
-		-19, -14, 
-		-2, -15, 
-		-2, -19, 
-		0, -22, 
-		1, -12, 
-		-19, -20, 
-	},
-	{
-		-13, -19, 
-		-3, -28, 
-		-3, -11, 
-		9, -19, 
-		-8, -28, 
-		-8, -11, 
-		1, -40, 
-		0, -1, 
-		1, -31, 
-		1, -9, 
-		-19, -15, 
-		-2, -17, 
-		-2, -20, 
-		0, -23, 
-		1, -14, 
-		-19, -22, 
-	},
-	{
-		-13, -21, 
-		-3, -30, 
-		-3, -12, 
-		9, -21, 
-		-8, -29, 
-		-8, -12, 
-		1, -41, 
-		0, -2, 
-		1, -32, 
-		1, -10, 
-		-19, -17, 
-		-2, -19, 
-		-2, -22, 
-		0, -25, 
-		1, -16, 
-		-19, -24, 
-	},
-	{
-		-13, -22, 
-		-3, -31, 
-		-3, -14, 
-		9, -22, 
-		-9, -30, 
-		-8, -13, 
-		1, -42, 
-		0, -3, 
-		1, -33, 
-		1, -11, 
-		-19, -18, 
-		-2, -20, 
-		-2, -24, 
-		1, -27, 
-		1, -17, 
-		-19, -25, 
-	},
-	{
-		-13, -23, 
-		-3, -33, 
-		-3, -15, 
-		9, -23, 
-		-9, -31, 
-		-8, -14, 
-		1, -43, 
-		0, -3, 
-		1, -34, 
-		1, -12, 
-		-19, -20, 
-		-2, -22, 
-		-2, -25, 
-		1, -28, 
-		1, -19, 
-		-19, -27, 
-	},
-	{
-		-13, -25, 
-		-3, -34, 
-		-3, -17, 
-		9, -24, 
-		-9, -32, 
-		-8, -15, 
-		1, -44, 
-		0, -4, 
-		1, -35, 
-		1, -13, 
-		-19, -21, 
-		-2, -23, 
-		-2, -27, 
-		1, -30, 
-		1, -20, 
-		-20, -28, 
-	},
-	{
-		-13, -26, 
-		-3, -36, 
-		-3, -18, 
-		9, -26, 
-		-9, -33, 
-		-8, -15, 
-		1, -45, 
-		0, -5, 
-		1, -36, 
-		1, -14, 
-		-20, -23, 
-		-2, -25, 
-		-2, -28, 
-		1, -32, 
-		1, -22, 
-		-20, -30, 
-	},
-	{
-		-14, -27, 
-		-3, -37, 
-		-3, -19, 
-		10, -27, 
-		-9, -33, 
-		-8, -16, 
-		1, -45, 
-		0, -6, 
-		1, -36, 
-		1, -14, 
-		-20, -24, 
-		-2, -26, 
-		-2, -30, 
-		1, -33, 
-		1, -23, 
-		-20, -31, 
-	},
-	{
-		-14, -29, 
-		-3, -39, 
-		-3, -21, 
-		10, -28, 
-		-9, -34, 
-		-8, -17, 
-		1, -46, 
-		0, -6, 
-		1, -37, 
-		1, -15, 
-		-20, -26, 
-		-2, -28, 
-		-2, -31, 
-		1, -35, 
-		1, -25, 
-		-20, -33, 
-	},
-	{
-		-14, -30, 
-		-3, -40, 
-		-3, -22, 
-		10, -29, 
-		-9, -35, 
-		-8, -18, 
-		1, -47, 
-		0, -7, 
-		1, -38, 
-		1, -16, 
-		-20, -27, 
-		-2, -29, 
-		-2, -33, 
-		1, -36, 
-		1, -26, 
-		-21, -34, 
-	},
-	{
-		-14, -31, 
-		-3, -41, 
-		-3, -23, 
-		10, -30, 
-		-9, -36, 
-		-8, -19, 
-		1, -47, 
-		0, -8, 
-		1, -39, 
-		1, -17, 
-		-20, -28, 
-		-2, -31, 
-		-2, -34, 
-		1, -38, 
-		1, -28, 
-		-21, -36, 
-	},
-	{
-		-14, -32, 
-		-3, -43, 
-		-3, -25, 
-		10, -31, 
-		-9, -36, 
-		-8, -19, 
-		1, -48, 
-		0, -8, 
-		1, -39, 
-		1, -17, 
-		-21, -30, 
-		-2, -32, 
-		-2, -36, 
-		1, -39, 
-		1, -29, 
-		-21, -37, 
-	},
-	{
-		-14, -33, 
-		-3, -44, 
-		-3, -26, 
-		10, -32, 
-		-10, -37, 
-		-8, -20, 
-		1, -48, 
-		0, -9, 
-		1, -40, 
-		1, -18, 
-		-21, -31, 
-		-3, -34, 
-		-3, -37, 
-		1, -41, 
-		1, -31, 
-		-21, -39, 
-	},
-	{
-		-15, -34, 
-		-3, -45, 
-		-3, -27, 
-		10, -33, 
-		-10, -37, 
-		-8, -21, 
-		1, -48, 
-		0, -9, 
-		1, -40, 
-		1, -18, 
-		-21, -32, 
-		-3, -35, 
-		-3, -39, 
-		1, -42, 
-		1, -32, 
-		-22, -40, 
-	},
-	{
-		-15, -36, 
-		-3, -46, 
-		-3, -28, 
-		10, -34, 
-		-10, -38, 
-		-8, -21, 
-		1, -48, 
-		0, -10, 
-		1, -40, 
-		1, -19, 
-		-21, -34, 
-		-3, -36, 
-		-3, -40, 
-		1, -43, 
-		1, -33, 
-		-22, -41, 
-	},
-	{
-		-15, -37, 
-		-3, -47, 
-		-3, -30, 
-		11, -35, 
-		-10, -38, 
-		-8, -22, 
-		1, -48, 
-		0, -11, 
-		1, -41, 
-		1, -20, 
-		-22, -35, 
-		-3, -38, 
-		-3, -41, 
-		1, -45, 
-		1, -35, 
-		-22, -42, 
-	},
-	{
-		-15, -37, 
-		-3, -48, 
-		-3, -31, 
-		11, -36, 
-		-10, -38, 
-		-8, -22, 
-		1, -48, 
-		0, -11, 
-		1, -41, 
-		1, -20, 
-		-22, -36, 
-		-3, -39, 
-		-3, -43, 
-		1, -46, 
-		1, -36, 
-		-23, -44, 
-	},
-	{
-		-15, -38, 
-		-4, -49, 
-		-3, -32, 
-		11, -36, 
-		-10, -38, 
-		-9, -23, 
-		1, -48, 
-		0, -12, 
-		1, -41, 
-		1, -20, 
-		-22, -37, 
-		-3, -40, 
-		-3, -44, 
-		1, -47, 
-		1, -37, 
-		-23, -45, 
-	},
-	{
-		-16, -39, 
-		-4, -50, 
-		-3, -33, 
-		11, -37, 
-		-10, -38, 
-		-9, -23, 
-		1, -47, 
-		0, -12, 
-		1, -41, 
-		1, -21, 
-		-23, -38, 
-		-3, -41, 
-		-3, -45, 
-		1, -48, 
-		1, -38, 
-		-24, -46, 
-	},
-	{
-		-16, -40, 
-		-4, -51, 
-		-3, -34, 
-		11, -38, 
-		-11, -38, 
-		-9, -24, 
-		1, -47, 
-		0, -13, 
-		1, -41, 
-		1, -21, 
-		-23, -39, 
-		-3, -42, 
-		-3, -46, 
-		1, -49, 
-		1, -39, 
-		-24, -47, 
-	},
-	{
-		-16, -41, 
-		-4, -51, 
-		-3, -35, 
-		11, -38, 
-		-11, -38, 
-		-9, -24, 
-		1, -46, 
-		0, -13, 
-		1, -40, 
-		1, -22, 
-		-23, -40, 
-		-3, -43, 
-		-3, -47, 
-		1, -50, 
-		1, -40, 
-		-24, -48, 
-	},
-	{
-		-16, -41, 
-		-4, -52, 
-		-4, -36, 
-		11, -39, 
-		-11, -38, 
-		-9, -24, 
-		1, -45, 
-		0, -14, 
-		1, -40, 
-		1, -22, 
-		-24, -41, 
-		-3, -44, 
-		-3, -48, 
-		1, -51, 
-		1, -41, 
-		-25, -48, 
-	},
-	{
-		-17, -42, 
-		-4, -52, 
-		-4, -37, 
-		12, -39, 
-		-11, -37, 
-		-9, -25, 
-		1, -44, 
-		0, -14, 
-		1, -39, 
-		1, -22, 
-		-24, -42, 
-		-3, -45, 
-		-3, -49, 
-		1, -52, 
-		1, -42, 
-		-25, -49, 
-	},
-	{
-		-17, -42, 
-		-4, -52, 
-		-4, -37, 
-		12, -39, 
-		-11, -37, 
-		-9, -25, 
-		1, -42, 
-		0, -14, 
-		2, -39, 
-		1, -22, 
-		-24, -43, 
-		-3, -46, 
-		-3, -49, 
-		1, -53, 
-		1, -43, 
-		-26, -50, 
-	},
-	{
-		-17, -43, 
-		-4, -52, 
-		-4, -38, 
-		12, -40, 
-		-11, -36, 
-		-9, -25, 
-		1, -41, 
-		0, -15, 
-		2, -38, 
-		1, -22, 
-		-25, -43, 
-		-3, -47, 
-		-3, -50, 
-		1, -53, 
-		1, -44, 
-		-26, -50, 
-	},
-	{
-		-18, -43, 
-		-4, -52, 
-		-4, -39, 
-		12, -40, 
-		-12, -35, 
-		-9, -25, 
-		1, -39, 
-		0, -15, 
-		2, -37, 
-		1, -23, 
-		-25, -44, 
-		-3, -48, 
-		-3, -51, 
-		1, -54, 
-		1, -45, 
-		-27, -51, 
-	},
-	{
-		-18, -43, 
-		-4, -52, 
-		-4, -39, 
-		12, -40, 
-		-12, -34, 
-		-9, -25, 
-		1, -37, 
-		0, -15, 
-		2, -36, 
-		1, -23, 
-		-26, -44, 
-		-3, -48, 
-		-3, -51, 
-		1, -54, 
-		1, -46, 
-		-27, -51, 
-	},
-	{
-		-18, -43, 
-		-4, -52, 
-		-4, -40, 
-		13, -40, 
-		-12, -33, 
-		-9, -25, 
-		1, -35, 
-		0, -16, 
-		2, -34, 
-		1, -23, 
-		-26, -45, 
-		-3, -49, 
-		-3, -51, 
-		1, -54, 
-		1, -46, 
-		-28, -51, 
-	},
-	{
-		-18, -43, 
-		-4, -51, 
-		-4, -40, 
-		13, -39, 
-		-12, -32, 
-		-9, -25, 
-		1, -33, 
-		0, -16, 
-		2, -33, 
-		1, -23, 
-		-27, -45, 
-		-3, -49, 
-		-3, -51, 
-		1, -54, 
-		1, -47, 
-		-29, -51, 
-	},
-	{
-		-19, -43, 
-		-4, -51, 
-		-4, -41, 
-		13, -39, 
-		-12, -31, 
-		-10, -25, 
-		1, -31, 
-		0, -16, 
-		2, -31, 
-		1, -22, 
-		-27, -45, 
-		-3, -49, 
-		-3, -51, 
-		1, -54, 
-		1, -47, 
-		-29, -51, 
-	},
-	{
-		-19, -42, 
-		-5, -50, 
-		-4, -41, 
-		13, -38, 
-		-12, -29, 
-		-10, -25, 
-		1, -28, 
-		0, -16, 
-		2, -30, 
-		1, -22, 
-		-28, -45, 
-		-3, -49, 
-		-3, -51, 
-		1, -54, 
-		1, -47, 
-		-30, -51, 
+		-13, -16, 
+		-3, -25, 
+		-3, -8, 
+		9, -17, 
+		-8, -25, 
+		-8, -9, 
+		1, -37, 
+		0, 0, 
+		1, -28, 
+		1, -8, 
+		-19, -12, 
+		-2, -14, 
+		-2, -17, 
+		0, -20, 
+		1, -11, 
+		-19, -19, 
 	},
 };
-const uint16_t edges0[] = { 
-	0x8, 
+const uint8_t deltas0[][16] = { 
+	{ 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x3, 0xf, 0x2, 0x0, 0x0, 0x0, 0xf0, 0x1, 0x0, 0x1, },
+	{ 0xf1, 0x2, 0x0, 0x11, 0xf2, 0x0, 0x3, 0x0, 0x2, 0x0, 0x0, 0xf0, 0x0, 0x1, 0x0, 0xf1, },
+	{ 0x1, 0x1, 0x0, 0x1, 0x2, 0x0, 0x3, 0x0, 0x2, 0x1, 0xf0, 0x0, 0x1, 0x0, 0x0, 0x0, },
+	{ 0x0, 0x2, 0x0, 0x1, 0x2, 0x1, 0x3, 0x0, 0x2, 0x0, 0xf1, 0x1, 0x1, 0x1, 0x0, 0xf1, },
+	{ 0xf1, 0x2, 0x1, 0x1, 0x2, 0x1, 0x3, 0x0, 0x3, 0x1, 0x0, 0x1, 0x1, 0x2, 0x1, 0xf2, },
+	{ 0x2, 0x2, 0x0, 0x1, 0x2, 0x0, 0x3, 0x0, 0x2, 0x0, 0xf1, 0x0, 0x1, 0x1, 0x0, 0x1, },
+	{ 0x1, 0x2, 0xf1, 0x1, 0x2, 0x1, 0x4, 0x1, 0x2, 0x1, 0x1, 0x1, 0x1, 0x2, 0x1, 0xf2, },
+	{ 0xf2, 0x3, 0x0, 0x12, 0x2, 0x1, 0x3, 0x0, 0x3, 0x1, 0xf1, 0x2, 0x2, 0x2, 0x1, 0x1, },
+	{ 0x1, 0x2, 0x1, 0x2, 0x3, 0x1, 0x4, 0x0, 0x3, 0x0, 0x1, 0x1, 0x2, 0x2, 0x1, 0xf2, },
+	{ 0x2, 0x3, 0x1, 0x1, 0x2, 0x1, 0x3, 0x0, 0x2, 0x1, 0xf2, 0x2, 0x1, 0x2, 0x1, 0x2, },
+	{ 0x2, 0x4, 0x1, 0x2, 0x2, 0xf1, 0x4, 0x0, 0x3, 0x1, 0x1, 0x1, 0x3, 0x3, 0x1, 0xf3, },
+	{ 0xf2, 0x3, 0x1, 0x2, 0x3, 0x1, 0x3, 0x1, 0x3, 0x1, 0x2, 0x2, 0x2, 0x3, 0x2, 0x2, },
+	{ 0x2, 0xf3, 0x2, 0x2, 0x2, 0x1, 0x3, 0x0, 0x3, 0x1, 0xf2, 0x2, 0x3, 0x3, 0x2, 0xf3, },
+	{ 0x3, 0x4, 0x1, 0x3, 0x3, 0x1, 0x4, 0x1, 0x2, 0x1, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, },
+	{ 0x2, 0x3, 0x2, 0x12, 0x2, 0x1, 0x3, 0x0, 0x3, 0x1, 0xf2, 0x2, 0x3, 0x3, 0x2, 0xf3, },
+	{ 0x3, 0x4, 0x2, 0x2, 0x3, 0x2, 0x3, 0x0, 0x3, 0x1, 0x2, 0x3, 0xf3, 0x4, 0x2, 0x3, },
+	{ 0xf2, 0x4, 0x2, 0x3, 0x2, 0x1, 0x2, 0x1, 0x2, 0x1, 0x3, 0x3, 0x4, 0x4, 0x3, 0x4, },
+	{ 0x3, 0x4, 0x2, 0x2, 0x3, 0x1, 0x3, 0x1, 0x3, 0x2, 0xf3, 0x3, 0x3, 0x3, 0x2, 0x3, },
+	{ 0x3, 0x4, 0x2, 0x3, 0x2, 0x2, 0x3, 0x0, 0x2, 0x1, 0x2, 0xf3, 0x4, 0x4, 0x3, 0xf4, },
+	{ 0x3, 0x3, 0x2, 0x3, 0x2, 0x1, 0x2, 0x1, 0x3, 0x1, 0x3, 0x3, 0x3, 0x4, 0x3, 0x4, },
+	{ 0x3, 0x4, 0x3, 0x2, 0x3, 0x2, 0x2, 0x1, 0x2, 0x1, 0x3, 0x3, 0x4, 0x4, 0x3, 0x3, },
+	{ 0x3, 0x4, 0x2, 0x3, 0x2, 0x1, 0x2, 0x0, 0x2, 0x2, 0xf3, 0x4, 0x4, 0x4, 0x3, 0x4, },
+	{ 0x3, 0x4, 0x3, 0x3, 0x2, 0x2, 0x2, 0x1, 0x2, 0x1, 0x3, 0x3, 0x3, 0x4, 0x3, 0x4, },
+	{ 0x3, 0x13, 0x3, 0x2, 0x2, 0x1, 0x2, 0x1, 0x2, 0x1, 0x3, 0x4, 0x4, 0x4, 0x4, 0x3, },
+	{ 0x3, 0x3, 0x2, 0x3, 0x2, 0x2, 0x1, 0x1, 0x2, 0x2, 0x4, 0x3, 0x4, 0x4, 0x3, 0x4, },
+	{ 0x2, 0x4, 0x3, 0x2, 0x11, 0x1, 0x1, 0x1, 0x2, 0x1, 0x3, 0x4, 0x3, 0x4, 0x3, 0x13, },
+	{ 0x3, 0x3, 0x3, 0x3, 0x2, 0x2, 0x1, 0x0, 0x1, 0x1, 0x3, 0x3, 0x4, 0x4, 0x3, 0x4, },
+	{ 0x13, 0x3, 0x2, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x3, 0x4, 0x4, 0x3, 0x4, 0x3, },
+	{ 0x2, 0x2, 0x3, 0xf2, 0x2, 0x1, 0x1, 0x1, 0x2, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x13, },
+	{ 0x3, 0x3, 0x3, 0x3, 0x1, 0x2, 0x1, 0x1, 0x1, 0x1, 0x13, 0x3, 0x3, 0x4, 0x3, 0x3, },
+	{ 0x2, 0x2, 0x3, 0x2, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x3, 0x14, 0x13, 0x3, 0x3, 0x3, },
+	{ 0x3, 0x2, 0x2, 0x2, 0x1, 0x2, 0x0, 0x1, 0x1, 0x2, 0x3, 0x3, 0x3, 0x2, 0x4, 0x13, },
+	{ 0x12, 0x2, 0x3, 0x2, 0x11, 0x1, 0x0, 0x1, 0xf0, 0x1, 0x2, 0x2, 0x3, 0x3, 0x3, 0x2, },
+	{ 0x2, 0x1, 0x2, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x13, 0x3, 0x2, 0x2, 0x2, 0x13, },
+	{ 0x1, 0x2, 0x3, 0x2, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x2, 0x3, 0x3, 0x2, 0x3, 0x2, },
+	{ 0x2, 0x1, 0x2, 0xf1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x13, 0x2, 0x2, 0x2, 0x3, 0x12, },
+	{ 0x12, 0x1, 0x2, 0x2, 0x1, 0x2, 0x0, 0x1, 0x0, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, },
+	{ 0x1, 0x11, 0x2, 0x1, 0x0, 0x11, 0xf, 0x0, 0x0, 0x1, 0x2, 0x2, 0x2, 0x1, 0x2, 0x12, },
+	{ 0x1, 0x1, 0x2, 0x1, 0x10, 0x0, 0x0, 0x1, 0x0, 0x1, 0x11, 0x2, 0x1, 0x2, 0x2, 0x11, },
+	{ 0x11, 0x0, 0x2, 0x1, 0x0, 0x1, 0xf, 0x1, 0x0, 0x1, 0x2, 0x2, 0x1, 0x1, 0x2, 0x1, },
+	{ 0x1, 0x0, 0x2, 0xf1, 0x0, 0x1, 0xf, 0x1, 0xf, 0x0, 0x11, 0x1, 0x2, 0x1, 0x2, 0x11, },
+	{ 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0xf, 0x1, 0x0, 0x1, 0x2, 0x1, 0x0, 0x0, 0x1, 0x1, },
+	{ 0x11, 0x0, 0x2, 0x1, 0x0, 0x1, 0xf, 0x1, 0x0, 0x1, 0x11, 0x1, 0x1, 0x1, 0x2, 0x10, },
+	{ 0x0, 0x0, 0x1, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x11, },
+	{ 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0xf, 0x1, 0x0, 0x1, 0x11, 0x1, 0x0, 0x0, 0x1, 0x0, },
+	{ 0x0, 0x0, 0x1, 0xf1, 0x1f, 0x0, 0xf, 0x1, 0xf, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1, 0x10, },
+	{ 0x10, 0xf, 0x1, 0x0, 0x0, 0x0, 0xf, 0x1, 0xf, 0x1, 0x11, 0x1, 0x0, 0x0, 0x0, 0x0, },
+	{ 0x0, 0xf, 0x0, 0x0, 0xf, 0x1, 0xf, 0x0, 0xf, 0x0, 0x0, 0x10, 0x0, 0xf, 0x1, 0x10, },
+	{ 0x0, 0x0, 0x11, 0xf, 0xf, 0x0, 0xf, 0x1, 0xf, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, },
+	{ 0x10, 0x1f, 0x0, 0x0, 0x0, 0x10, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x10, },
+	{ 0xf, 0xf, 0x1, 0x0, 0xf, 0x0, 0xf, 0x1, 0xf, 0x0, 0x10, 0x0, 0xf, 0x0, 0x0, 0xf, },
+	{ 0x0, 0xf, 0x0, 0xff, 0xf, 0x0, 0xf, 0x0, 0xf, 0x1, 0x0, 0x0, 0x0, 0xf, 0x0, 0x10, },
+	{ 0xf, 0xf, 0x0, 0x0, 0xf, 0x0, 0xe, 0x1, 0xf, 0x0, 0x10, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0x10, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xe, 0x0, 0xf, 0x0, 0xf, 0xf, 0x0, 0x1f, },
+	{ 0xf, 0xe, 0x0, 0x0, 0x1f, 0x0, 0xe, 0x0, 0xf, 0xf, 0x10, 0xf, 0x0, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0x1, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x1f, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, },
+	{ 0x1f, 0xf, 0x0, 0xff, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x1f, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0x0, 0xf, 0x0, 0xe, 0x0, 0xe, 0x0, 0xf, 0xf, 0xe, 0xe, 0xf, 0x1f, },
+	{ 0xf, 0xf, 0x0, 0xf, 0xe, 0xf, 0xf, 0x1, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0x10, 0xe, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, },
+	{ 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0xe, 0xf, 0xe, 0xf, 0x1f, },
+	{ 0xe, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xe, 0xf, 0x1f, 0xf, 0xe, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, },
+	{ 0xf, 0xe, 0x1f, 0xf, 0xe, 0x0, 0xf, 0x0, 0xe, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0x1f, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x1f, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xff, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xe, 0xe, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xe, 0xf, 0xe, 0x1f, 0xe, 0xf, 0xf, 0xe, },
+	{ 0x1f, 0xf, 0xf, 0xe, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0xe, 0xf, 0xe, 0xf, 0x1f, },
+	{ 0xf, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0xe, 0xf, 0x1f, 0xf, 0xe, 0xf, 0xe, 0xe, },
+	{ 0xe, 0xe, 0xf, 0xf, 0x1e, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xfe, 0xf, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xf, },
+	{ 0xe, 0xe, 0xf, 0xe, 0xe, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, 0x0, 0xe, 0xf, 0x1f, 0xe, 0xe, 0xe, 0xe, 0x1e, },
+	{ 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xe, 0xf, 0xe, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xe, 0xf, },
+	{ 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0x0, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0x1f, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xe, },
+	{ 0xe, 0xe, 0xf, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, },
+	{ 0xf, 0xe, 0xe, 0xf, 0xe, 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xe, },
+	{ 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xe, 0xe, 0xe, 0xf, 0x1f, 0xe, 0x0, 0xe, 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1e, 0xf, 0xe, 0xf, 0xe, 0xe, },
+	{ 0xf, 0xe, 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xe, 0xf, 0xf, 0xf, 0xfe, 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0x0, 0xf, 0x0, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xf, 0xe, },
+	{ 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xe, 0xe, 0xe, 0xf, 0xe, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xfe, 0xe, 0xe, 0xf, 0xf, 0xff, 0xf, 0xf, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xfe, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xfe, },
+	{ 0xe, 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0x0, 0xf, 0xe, 0xf, 0xf, 0xe, 0xe, },
+	{ 0xe, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xf, 0xe, 0xf, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x1e, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, 0xe, },
+	{ 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xff, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xfe, 0xe, 0xf, 0xe, 0xe, 0xe, },
+	{ 0xff, 0xf, 0xf, 0x1f, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, },
+	{ 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xff, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xe, 0xe, },
+	{ 0xf, 0xe, 0xe, 0xf, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xfe, 0xf, 0xe, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xff, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xfe, 0xff, 0xe, 0xe, 0xe, },
+	{ 0xff, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xe, 0xf, 0xf, 0xff, },
+	{ 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0x0, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xe, 0x1f, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0xff, 0xe, 0xf, 0xe, 0xe, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xe, 0xf, 0xf, 0xfe, },
+	{ 0xf, 0xff, 0xf, 0x0, 0x0, 0xff, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xff, 0xf, 0xf, 0xf, 0x0, 0x0, 0x1, 0x0, 0x0, 0xf, 0xff, 0xf, 0xf, 0xf, 0xf, 0xff, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0x0, 0xf, 0xff, 0xf, 0x0, 0x0, 0x1, 0xf, 0x0, 0x0, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf0, },
+	{ 0xff, 0x0, 0xf, 0x10, 0x1, 0xf, 0x1, 0x0, 0x1, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x10, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xff, },
+	{ 0xf, 0x0, 0xf, 0xf, 0x1, 0x0, 0x1, 0xf, 0x1, 0x0, 0xf0, 0xf, 0xf, 0x0, 0xf, 0x0, },
+	{ 0xf0, 0x0, 0xf, 0x0, 0xf1, 0x0, 0x2, 0x0, 0x1, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xff, },
+	{ 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0, },
+	{ 0x0, 0x0, 0xf, 0x10, 0x1, 0x0, 0x2, 0xf, 0x2, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0xf0, },
+	{ 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xf0, },
+	{ 0xf0, 0x0, 0xf, 0x0, 0x1, 0xf0, 0x2, 0x0, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, },
+	{ 0x1, 0xf1, 0x0, 0x1, 0x2, 0x0, 0x3, 0x0, 0x1, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf0, },
+};
+const uint8_t path0[] = { 
+	0x13, 
+	0xe, 
 	0xa, 
-	0x14, 
+	0x12, 
+	0x6, 
+	0x10, 
+	0x9, 
+	0x10, 
+	0xc, 
+	0x8, 
+	0x0, 
+	0x1e, 
+	0x15, 
 	0x1e, 
-	0x218, 
-	0x21a, 
-	0x416, 
-	0x41c, 
-	0x610, 
-	0x612, 
-	0x61a, 
-	0x61c, 
-	0x80c, 
-	0x810, 
-	0xa0e, 
-	0xa12, 
-	0xc10, 
-	0xe12, 
-	0x1416, 
-	0x141e, 
-	0x161c, 
-	0x181a, 
-	0x181e, 
+	0x18, 
+	0x17, 
+	0x1c, 
+	0x4, 
+	0x16, 
+	0x14, 
+	0x0, 
+	0xa, 
+	0x1d, 
+	0x6, 
+	0x1a, 
+	0x2, 
+	0x18, 
+	0x1a, 
 };
 
-const int8_t vertices1[][22] = { 
+const uint8_t visible0[][4] = { 
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xb6, 0x6f, 0xbf, 0xf, },
+	{ 0xb8, 0x6f, 0xbf, 0xf, },
+	{ 0xb8, 0x6f, 0xbf, 0xf, },
+	{ 0xb8, 0x6f, 0xbf, 0xf, },
+	{ 0xb8, 0x6f, 0xbb, 0xf, },
+	{ 0xb8, 0x6f, 0xb9, 0xf, },
+	{ 0xb8, 0x6f, 0xb9, 0xf, },
+	{ 0xb8, 0x6f, 0xbd, 0xf, },
+	{ 0xb8, 0x6f, 0xbd, 0xf, },
+	{ 0xb8, 0x6f, 0xbf, 0xf, },
+	{ 0xb8, 0x6f, 0xbd, 0xf, },
+	{ 0xb8, 0x6f, 0xbd, 0xf, },
+	{ 0xb8, 0x6f, 0xbd, 0xf, },
+	{ 0xb8, 0x6f, 0xb9, 0xf, },
+	{ 0xbe, 0x6f, 0xb9, 0xf, },
+	{ 0xbe, 0x6f, 0xb9, 0xf, },
+	{ 0xbe, 0x6f, 0xb9, 0xf, },
+	{ 0xac, 0x6f, 0xbf, 0xf, },
+	{ 0xac, 0x6f, 0xbf, 0xf, },
+	{ 0xa8, 0x6f, 0xbf, 0xf, },
+	{ 0xa0, 0x67, 0x8f, 0xf, },
+	{ 0xa0, 0x67, 0x8f, 0xf, },
+	{ 0xa6, 0x67, 0x8f, 0xf, },
+	{ 0xa6, 0x67, 0x8f, 0xf, },
+	{ 0xa6, 0x67, 0x8f, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0x9e, 0x67, 0xaf, 0xf, },
+	{ 0x9e, 0x63, 0xaf, 0xf, },
+	{ 0x1e, 0x63, 0xaf, 0xf, },
+	{ 0x1e, 0x63, 0xaf, 0xf, },
+	{ 0x1e, 0x60, 0xaf, 0xf, },
+	{ 0x1e, 0x60, 0xaf, 0xf, },
+	{ 0x1e, 0x60, 0xaf, 0xf, },
+	{ 0x1e, 0x60, 0xaf, 0xf, },
+	{ 0x9e, 0x64, 0xaf, 0xf, },
+	{ 0xbe, 0x67, 0xaf, 0xf, },
+	{ 0xbe, 0x65, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6c, 0xbf, 0xf, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0x9, },
+	{ 0xbe, 0x6c, 0xbf, 0xb, },
+	{ 0xbe, 0x6c, 0xbf, 0xf, },
+	{ 0xbe, 0x6c, 0xbf, 0xf, },
+	{ 0xbe, 0x6c, 0xbf, 0xf, },
+	{ 0xbe, 0x6e, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xd, },
+	{ 0xbe, 0x6f, 0xbf, 0x9, },
+	{ 0xbe, 0x6f, 0xbf, 0x0, },
+	{ 0xbe, 0x6f, 0xbf, 0x0, },
+	{ 0xbe, 0x6f, 0xbf, 0x0, },
+	{ 0xbe, 0x6f, 0xbf, 0x0, },
+	{ 0xbe, 0x2f, 0xbf, 0x0, },
+	{ 0xbe, 0x6f, 0xbf, 0x0, },
+	{ 0xbe, 0x6f, 0xbe, 0x0, },
+	{ 0xbe, 0x6f, 0xbe, 0x0, },
+	{ 0xbe, 0x6f, 0xb8, 0x0, },
+	{ 0xbe, 0x6f, 0xb8, 0x0, },
+	{ 0xbe, 0x6f, 0xb8, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x0, },
+	{ 0xbe, 0x6f, 0x38, 0x1, },
+	{ 0xbe, 0x6f, 0x38, 0x7, },
+	{ 0xbe, 0x6f, 0x38, 0x7, },
+	{ 0xbe, 0x6f, 0x38, 0x7, },
+	{ 0xbe, 0x6f, 0x38, 0x7, },
+	{ 0xbe, 0x6f, 0x38, 0x7, },
+	{ 0xbe, 0x6f, 0x38, 0xf, },
+	{ 0xbe, 0x6f, 0x38, 0xf, },
+	{ 0xbe, 0x6f, 0xb8, 0xf, },
+	{ 0xbe, 0x6f, 0xbd, 0xf, },
+	{ 0xbe, 0x6f, 0xbd, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+	{ 0xbe, 0x6f, 0xbf, 0xf, },
+};
+
+const int8_t keys1[][22] = { 
 	{
 		-38, 26, 
 		-49, 38, 
@@ -2345,5238 +379,744 @@ const int8_t vertices1[][22] = {
 		-15, 16, 
 	},
 	{
-		-37, 26, 
-		-48, 38, 
-		15, 35, 
-		3, 48, 
-		1, 30, 
-		-43, 36, 
-		11, 28, 
-		-46, 9, 
-		15, 53, 
-		-42, 0, 
-		-15, 17, 
-	},
-	{
-		-37, 26, 
-		-47, 39, 
-		15, 35, 
-		3, 48, 
-		1, 29, 
-		-43, 36, 
-		11, 28, 
-		-46, 10, 
-		15, 54, 
-		-42, 1, 
-		-15, 19, 
+		-29, 11, 
+		-32, 18, 
+		12, 4, 
+		2, 12, 
+		1, 1, 
+		-33, 4, 
+		8, 13, 
+		-37, 19, 
+		9, 21, 
+		-39, 10, 
+		-11, 22, 
 	},
 	{
-		-37, 27, 
-		-47, 39, 
-		15, 35, 
-		3, 48, 
-		1, 29, 
-		-42, 36, 
-		11, 28, 
-		-46, 11, 
-		15, 54, 
-		-42, 1, 
-		-15, 20, 
+		-31, -21, 
+		-34, -26, 
+		14, -33, 
+		3, -37, 
+		1, -30, 
+		-40, -34, 
+		9, -21, 
+		-34, -6, 
+		10, -34, 
+		-36, 0, 
+		-10, -11, 
 	},
 	{
-		-36, 27, 
-		-46, 40, 
-		14, 34, 
-		3, 47, 
-		1, 28, 
-		-41, 35, 
-		11, 29, 
-		-46, 12, 
-		14, 54, 
-		-42, 2, 
-		-15, 21, 
-	},
-	{
-		-36, 27, 
-		-45, 40, 
-		14, 34, 
-		3, 47, 
-		1, 28, 
-		-41, 34, 
-		10, 29, 
-		-46, 13, 
-		14, 54, 
-		-42, 2, 
-		-15, 22, 
-	},
-	{
-		-35, 27, 
-		-44, 40, 
-		14, 33, 
-		3, 46, 
-		1, 27, 
-		-40, 34, 
-		10, 29, 
-		-45, 14, 
-		14, 54, 
-		-42, 3, 
-		-15, 23, 
-	},
-	{
-		-35, 27, 
-		-44, 40, 
-		14, 32, 
-		3, 45, 
-		1, 26, 
-		-40, 33, 
-		10, 29, 
-		-45, 15, 
-		13, 53, 
-		-42, 3, 
-		-14, 24, 
-	},
-	{
-		-35, 27, 
-		-43, 40, 
-		14, 32, 
-		3, 45, 
-		1, 26, 
-		-39, 32, 
-		10, 29, 
-		-45, 16, 
-		13, 53, 
-		-42, 4, 
-		-14, 24, 
-	},
-	{
-		-34, 27, 
-		-42, 40, 
-		14, 31, 
-		3, 44, 
-		1, 25, 
-		-39, 31, 
-		10, 29, 
-		-45, 17, 
-		13, 52, 
-		-42, 4, 
-		-14, 25, 
-	},
-	{
-		-34, 26, 
-		-42, 39, 
-		13, 30, 
-		3, 43, 
-		1, 24, 
-		-38, 31, 
-		10, 29, 
-		-44, 18, 
-		13, 51, 
-		-42, 5, 
-		-14, 26, 
-	},
-	{
-		-34, 26, 
-		-41, 39, 
-		13, 29, 
-		3, 42, 
-		1, 23, 
-		-38, 30, 
-		10, 28, 
-		-44, 18, 
-		12, 51, 
-		-42, 5, 
-		-14, 26, 
-	},
-	{
-		-33, 26, 
-		-41, 39, 
-		13, 28, 
-		3, 41, 
-		1, 22, 
-		-37, 29, 
-		10, 28, 
-		-44, 19, 
-		12, 50, 
-		-41, 6, 
-		-14, 27, 
-	},
-	{
-		-33, 25, 
-		-40, 38, 
-		13, 27, 
-		3, 40, 
-		1, 21, 
-		-37, 28, 
-		10, 28, 
-		-43, 19, 
-		12, 49, 
-		-41, 6, 
-		-14, 27, 
-	},
-	{
-		-33, 25, 
-		-39, 37, 
-		13, 26, 
-		3, 38, 
-		1, 21, 
-		-37, 27, 
-		9, 27, 
-		-43, 20, 
-		12, 48, 
-		-41, 7, 
-		-13, 27, 
-	},
-	{
-		-32, 25, 
-		-39, 37, 
-		13, 25, 
-		2, 37, 
-		1, 20, 
-		-36, 26, 
-		9, 27, 
-		-43, 20, 
-		11, 47, 
-		-41, 7, 
-		-13, 28, 
-	},
-	{
-		-32, 24, 
-		-38, 36, 
-		13, 24, 
-		2, 36, 
-		1, 19, 
-		-36, 24, 
-		9, 26, 
-		-42, 21, 
-		11, 45, 
-		-41, 7, 
-		-13, 28, 
-	},
-	{
-		-32, 23, 
-		-38, 35, 
-		13, 23, 
-		2, 35, 
-		1, 18, 
-		-36, 23, 
-		9, 26, 
-		-42, 21, 
-		11, 44, 
-		-41, 8, 
-		-13, 28, 
-	},
-	{
-		-32, 23, 
-		-37, 34, 
-		12, 22, 
-		2, 33, 
-		1, 17, 
-		-35, 22, 
-		9, 25, 
-		-42, 21, 
-		11, 43, 
-		-41, 8, 
-		-13, 28, 
-	},
-	{
-		-31, 22, 
-		-37, 33, 
-		12, 21, 
-		2, 32, 
-		1, 15, 
-		-35, 21, 
-		9, 24, 
-		-41, 21, 
-		11, 41, 
-		-41, 8, 
-		-13, 28, 
-	},
-	{
-		-31, 21, 
-		-36, 32, 
-		12, 19, 
-		2, 30, 
-		1, 14, 
-		-35, 20, 
-		9, 24, 
-		-41, 22, 
-		11, 40, 
-		-41, 9, 
-		-13, 27, 
-	},
-	{
-		-31, 21, 
-		-36, 31, 
-		12, 18, 
-		2, 29, 
-		1, 13, 
-		-34, 18, 
-		9, 23, 
-		-41, 22, 
-		10, 39, 
-		-40, 9, 
-		-12, 27, 
-	},
-	{
-		-31, 20, 
-		-35, 30, 
-		12, 17, 
-		2, 28, 
-		1, 12, 
-		-34, 17, 
-		9, 22, 
-		-40, 22, 
-		10, 37, 
-		-40, 9, 
-		-12, 27, 
-	},
-	{
-		-30, 19, 
-		-35, 29, 
-		12, 16, 
-		2, 26, 
-		1, 11, 
-		-34, 16, 
-		9, 21, 
-		-40, 22, 
-		10, 36, 
-		-40, 9, 
-		-12, 27, 
-	},
-	{
-		-30, 18, 
-		-35, 28, 
-		12, 15, 
-		2, 25, 
-		1, 10, 
-		-34, 15, 
-		9, 21, 
-		-40, 21, 
-		10, 34, 
-		-40, 10, 
-		-12, 26, 
-	},
-	{
-		-30, 18, 
-		-34, 27, 
-		12, 13, 
-		2, 23, 
-		1, 9, 
-		-34, 13, 
-		9, 20, 
-		-39, 21, 
-		10, 33, 
-		-40, 10, 
-		-12, 26, 
-	},
-	{
-		-30, 17, 
-		-34, 26, 
-		12, 12, 
-		2, 22, 
-		1, 8, 
-		-33, 12, 
-		9, 19, 
-		-39, 21, 
-		10, 31, 
-		-40, 10, 
-		-12, 25, 
-	},
-	{
-		-29, 16, 
-		-34, 24, 
-		12, 11, 
-		2, 20, 
-		1, 6, 
-		-33, 11, 
-		8, 18, 
-		-39, 21, 
-		10, 29, 
-		-39, 10, 
-		-12, 25, 
-	},
-	{
-		-29, 15, 
-		-33, 23, 
-		12, 9, 
-		2, 18, 
-		1, 5, 
-		-33, 9, 
-		8, 17, 
-		-38, 21, 
-		10, 28, 
-		-39, 10, 
-		-12, 24, 
-	},
-	{
-		-29, 14, 
-		-33, 22, 
-		12, 8, 
-		2, 17, 
-		1, 4, 
-		-33, 8, 
-		8, 16, 
-		-38, 20, 
-		9, 26, 
-		-39, 10, 
-		-12, 24, 
-	},
-	{
-		-29, 13, 
-		-33, 21, 
-		12, 7, 
-		2, 15, 
-		1, 3, 
-		-33, 7, 
-		8, 15, 
-		-38, 20, 
-		9, 24, 
-		-39, 10, 
-		-11, 23, 
-	},
-	{
-		-29, 12, 
-		-33, 19, 
-		12, 5, 
-		2, 14, 
-		1, 2, 
-		-33, 5, 
-		8, 14, 
-		-37, 20, 
-		9, 23, 
-		-39, 10, 
-		-11, 22, 
-	},
-	{
-		-29, 11, 
-		-32, 18, 
-		12, 4, 
-		2, 12, 
-		1, 1, 
-		-33, 4, 
-		8, 13, 
-		-37, 19, 
-		9, 21, 
-		-39, 10, 
-		-11, 22, 
-	},
-	{
-		-29, 10, 
-		-32, 17, 
-		12, 3, 
-		2, 10, 
+		-41, -16, 
+		-53, -29, 
+		20, -7, 
+		4, -24, 
 		1, -1, 
-		-33, 3, 
-		8, 12, 
-		-37, 19, 
-		9, 19, 
-		-39, 10, 
-		-11, 21, 
-	},
-	{
-		-29, 9, 
-		-32, 15, 
-		12, 1, 
-		2, 9, 
-		1, -2, 
-		-33, 1, 
-		8, 11, 
-		-37, 18, 
-		9, 18, 
-		-38, 10, 
-		-11, 20, 
-	},
-	{
-		-28, 8, 
-		-32, 14, 
-		12, 0, 
-		2, 7, 
-		1, -3, 
-		-33, 0, 
-		8, 10, 
-		-36, 18, 
-		9, 16, 
-		-38, 10, 
-		-11, 19, 
-	},
-	{
-		-28, 7, 
-		-32, 12, 
-		12, -1, 
-		2, 6, 
-		1, -4, 
-		-33, -1, 
-		8, 8, 
-		-36, 17, 
-		9, 14, 
-		-38, 10, 
-		-11, 18, 
-	},
-	{
-		-28, 6, 
-		-31, 11, 
-		12, -3, 
-		2, 4, 
-		1, -5, 
-		-33, -3, 
-		8, 7, 
-		-36, 16, 
-		9, 12, 
-		-38, 10, 
-		-11, 17, 
-	},
-	{
-		-28, 5, 
-		-31, 10, 
-		12, -4, 
-		2, 2, 
-		1, -6, 
-		-33, -4, 
-		8, 6, 
-		-36, 16, 
-		9, 11, 
-		-38, 10, 
-		-11, 16, 
-	},
-	{
-		-28, 4, 
-		-31, 8, 
-		12, -5, 
-		2, 1, 
-		1, -8, 
-		-33, -6, 
-		8, 5, 
-		-35, 15, 
-		9, 9, 
-		-38, 10, 
-		-11, 15, 
-	},
-	{
-		-28, 3, 
-		-31, 7, 
-		12, -7, 
-		2, -1, 
-		1, -9, 
-		-33, -7, 
-		8, 4, 
-		-35, 14, 
-		9, 7, 
-		-38, 9, 
-		-11, 15, 
-	},
-	{
-		-28, 2, 
-		-31, 5, 
-		12, -8, 
-		2, -3, 
-		1, -10, 
-		-33, -8, 
-		8, 3, 
-		-35, 14, 
-		9, 5, 
-		-37, 9, 
-		-11, 14, 
-	},
-	{
-		-28, 0, 
-		-31, 4, 
-		12, -9, 
-		2, -4, 
-		1, -11, 
-		-33, -10, 
-		8, 2, 
-		-35, 13, 
-		9, 4, 
-		-37, 9, 
-		-11, 13, 
-	},
-	{
-		-28, -1, 
-		-31, 2, 
-		12, -10, 
-		2, -6, 
-		1, -12, 
-		-33, -11, 
-		8, 1, 
-		-35, 12, 
-		9, 2, 
-		-37, 9, 
-		-10, 12, 
-	},
-	{
-		-28, -2, 
-		-31, 1, 
-		12, -12, 
-		2, -7, 
-		1, -13, 
-		-34, -12, 
-		8, -1, 
-		-35, 11, 
-		9, 0, 
-		-37, 8, 
-		-10, 10, 
-	},
-	{
-		-28, -3, 
-		-31, 0, 
-		12, -13, 
-		2, -9, 
-		1, -14, 
-		-34, -14, 
-		8, -2, 
-		-34, 11, 
-		9, -2, 
-		-37, 8, 
-		-10, 9, 
-	},
-	{
-		-28, -4, 
-		-31, -2, 
-		12, -14, 
-		2, -11, 
-		1, -15, 
-		-34, -15, 
-		8, -3, 
-		-34, 10, 
-		9, -3, 
-		-37, 8, 
-		-10, 8, 
-	},
-	{
-		-28, -5, 
-		-31, -3, 
-		12, -16, 
-		2, -12, 
-		1, -17, 
-		-34, -16, 
-		8, -4, 
-		-34, 9, 
-		9, -5, 
-		-37, 7, 
-		-10, 7, 
-	},
-	{
-		-28, -6, 
-		-31, -5, 
-		12, -17, 
-		2, -14, 
-		1, -18, 
-		-34, -17, 
-		8, -5, 
-		-34, 8, 
-		9, -7, 
-		-37, 7, 
-		-10, 6, 
-	},
-	{
-		-28, -7, 
-		-31, -6, 
-		12, -18, 
-		2, -15, 
-		1, -19, 
-		-35, -19, 
-		8, -6, 
-		-34, 7, 
-		9, -9, 
-		-36, 7, 
-		-10, 5, 
-	},
-	{
-		-28, -8, 
-		-31, -8, 
+		-58, -7, 
 		12, -19, 
-		2, -17, 
-		1, -20, 
-		-35, -20, 
-		8, -7, 
-		-34, 6, 
-		9, -10, 
-		-36, 6, 
-		-10, 4, 
-	},
-	{
-		-29, -9, 
-		-31, -9, 
-		12, -20, 
-		2, -19, 
-		1, -21, 
-		-35, -21, 
-		8, -8, 
-		-34, 6, 
-		9, -12, 
-		-36, 6, 
-		-10, 3, 
-	},
-	{
-		-29, -10, 
-		-31, -11, 
-		12, -22, 
-		2, -20, 
-		1, -21, 
-		-35, -22, 
-		8, -9, 
-		-34, 5, 
-		9, -14, 
-		-36, 6, 
-		-10, 2, 
+		-41, -21, 
+		18, -41, 
+		-38, -10, 
+		-14, -26, 
 	},
+};
+const uint8_t deltas1[][11] = { 
+	{ 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, },
+	{ 0x10, 0x10, 0xf, 0x0, 0x0, 0x1f, 0x1, 0x11, 0xf0, 0x0, 0x1, },
+	{ 0x0, 0x11, 0x0, 0x0, 0xf, 0x0, 0x0, 0x1, 0x1, 0x1, 0x2, },
+	{ 0x1, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1, 0x0, 0x0, 0x1, },
+	{ 0x10, 0x11, 0xff, 0xf, 0xf, 0x1f, 0x1, 0x1, 0xf0, 0x1, 0x1, },
+	{ 0x0, 0x10, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x1, 0x0, 0x0, 0x1, },
+	{ 0x10, 0x10, 0xf, 0xf, 0xf, 0x10, 0x0, 0x11, 0x0, 0x1, 0x1, },
+	{ 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x1, 0xff, 0x0, 0x11, },
+	{ 0x0, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x1, 0x0, 0x1, 0x0, },
+	{ 0x10, 0x10, 0xf, 0xf, 0xf, 0xf, 0x0, 0x1, 0xf, 0x0, 0x1, },
+	{ 0xf, 0xf, 0xff, 0xf, 0xf, 0x10, 0x0, 0x11, 0xf, 0x1, 0x1, },
+	{ 0x0, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf0, 0x0, 0x0, },
+	{ 0x10, 0x0, 0xf, 0xf, 0xf, 0x1f, 0x0, 0x1, 0xf, 0x11, 0x1, },
+	{ 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0x0, 0x10, 0xf, 0x0, 0x0, },
+	{ 0x0, 0x1f, 0xf, 0xe, 0x0, 0xf, 0xff, 0x1, 0xf, 0x1, 0x10, },
+	{ 0x10, 0x0, 0xf, 0xff, 0xf, 0x1f, 0x0, 0x0, 0xff, 0x0, 0x1, },
+	{ 0xf, 0x1f, 0xf, 0xf, 0xf, 0xe, 0xf, 0x11, 0xe, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0x1, 0x0, },
+	{ 0x0, 0x1f, 0xff, 0xe, 0xf, 0x1f, 0xf, 0x0, 0xf, 0x0, 0x0, },
+	{ 0x1f, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0x10, 0xe, 0x0, 0x0, },
+	{ 0xf, 0x1f, 0xe, 0xe, 0xf, 0xf, 0x0, 0x1, 0xf, 0x1, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0x1e, 0xf, 0x0, 0xff, 0x10, 0x10, },
+	{ 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x10, 0xe, 0x0, 0x0, },
+	{ 0x1f, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xe, 0x1, 0xf, },
+	{ 0x0, 0x1f, 0xe, 0xe, 0xf, 0xe, 0xf, 0x10, 0xf, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0x1f, 0xf, 0x0, 0xe, 0x0, 0xf, },
+	{ 0x1f, 0xe, 0xf, 0xe, 0xe, 0xf, 0xff, 0x0, 0xe, 0x10, 0x0, },
+	{ 0xf, 0x1f, 0xe, 0xe, 0xf, 0xe, 0xf, 0x10, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xfe, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xe, 0x0, 0x1f, },
+	{ 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0x10, 0xf, 0x0, 0xf, },
+	{ 0xf, 0x1f, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0x0, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xe, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x10, 0xf, },
+	{ 0x1f, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x10, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0x1f, 0xe, 0xe, 0xf, 0xe, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xf, 0xe, 0xe, 0xf, 0x1f, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0x0, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xe, 0x10, 0xf, },
+	{ 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0x1f, },
+	{ 0xf, 0xf, 0xe, 0xf, 0xf, 0xff, 0xe, 0xf, 0xe, 0xf, 0xe, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0x10, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xfe, 0xf, 0xf, 0xe, 0x10, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xff, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0x0, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xe, 0xf, 0x0, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xf, 0xff, 0xe, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xff, 0x1f, 0xf, 0xf, 0xe, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xff, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xe, },
+	{ 0xf, 0xe, 0xf, 0xf, 0x0, 0xff, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xff, 0xff, 0xf, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, },
+	{ 0x0, 0xe, 0x1f, 0xf, 0x0, 0xff, 0xf, 0xf, 0x1e, 0x0, 0xf, },
+	{ 0xf, 0xff, 0x0, 0xe, 0xf, 0x0, 0x1f, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xff, 0xf, 0xf, 0xf, 0x0, 0xff, 0x0, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xfe, 0x0, 0xf, 0x0, 0xff, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xe, 0x0, 0x0, 0xf, 0xf, 0xe, 0xf, 0xff, },
+	{ 0xff, 0xf, 0x1f, 0xf, 0x0, 0xff, 0xf, 0x0, 0xf, 0x0, 0xf, },
+	{ 0x0, 0xff, 0x0, 0xf, 0xf, 0xf0, 0x0, 0xf, 0x1e, 0xf, 0xf, },
+	{ 0xf, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xff, 0xf, 0xf, 0x0, 0xff, 0xf, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf0, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, 0xff, 0xe, 0xf, 0xf, },
+	{ 0x0, 0xff, 0x10, 0x0, 0x1, 0xf0, 0xf, 0x0, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0x0, 0xf, 0x0, 0xf0, 0x0, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0x1f, 0xf, 0x1f, 0x0, 0x0, },
+	{ 0x0, 0xf, 0x0, 0x0, 0x1, 0xf0, 0x0, 0xf, 0xe, 0xf, 0xf, },
+	{ 0xf, 0xff, 0x11, 0xf, 0x0, 0xf0, 0x0, 0xf0, 0xf, 0x0, 0xf, },
+	{ 0xf0, 0x0, 0x0, 0x0, 0x1, 0x1, 0xf, 0xf, 0x0, 0x0, 0xf, },
+	{ 0x0, 0xff, 0x0, 0x0, 0x1, 0xf0, 0x0, 0xf, 0x1f, 0xf, 0x0, },
+	{ 0xf0, 0xf0, 0x1, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf, 0x0, 0xff, },
+	{ 0x0, 0xf, 0x1, 0x0, 0x1, 0x1, 0x0, 0xf, 0xf, 0xf, 0xf, },
+	{ 0x0, 0xf0, 0x11, 0x0, 0x1, 0xf1, 0x0, 0xf0, 0x0, 0xf0, 0x0, },
+	{ 0xf0, 0xf0, 0x1, 0x1, 0x1, 0xf1, 0x0, 0xf, 0x1f, 0x0, 0xf, },
+	{ 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x10, 0x0, 0x0, 0xf, 0x0, },
+	{ 0x0, 0xf0, 0x1, 0x11, 0x2, 0xf1, 0x1, 0xff, 0x0, 0x0, 0xf, },
+	{ 0xf1, 0xf0, 0x11, 0x1, 0x1, 0xf1, 0x0, 0x0, 0x10, 0x0, 0x0, },
+	{ 0x0, 0x0, 0x2, 0x1, 0x2, 0x2, 0x0, 0x0, 0x0, 0xf, 0x0, },
+	{ 0xf1, 0xf1, 0x1, 0x1, 0x1, 0xf1, 0x1, 0xf, 0x1, 0x0, 0xf0, },
+	{ 0x0, 0xf0, 0x2, 0x1, 0x2, 0x2, 0x0, 0xf0, 0x0, 0x0, 0xf, },
+	{ 0x1, 0x1, 0x1, 0x2, 0x1, 0xf2, 0x1, 0x0, 0x11, 0x0, 0x0, },
+	{ 0xf1, 0xf1, 0x2, 0x2, 0x2, 0x2, 0x1, 0x0, 0x1, 0xf0, 0x0, },
+	{ 0x1, 0xf1, 0x12, 0x2, 0x2, 0xf2, 0x1, 0xff, 0x1, 0xf, 0x0, },
+	{ 0x1, 0xf1, 0x2, 0x2, 0x2, 0x2, 0x11, 0x0, 0x11, 0x0, 0x0, },
+	{ 0xf1, 0x1, 0x2, 0x2, 0x1, 0x2, 0x1, 0x0, 0x2, 0x0, 0x1, },
+	{ 0x1, 0xf1, 0x2, 0x3, 0x2, 0xf2, 0x1, 0xf0, 0x2, 0x0, 0xf0, },
+	{ 0x1, 0xf2, 0x3, 0x2, 0x2, 0x3, 0x1, 0x1, 0x12, 0x0, 0x0, },
+	{ 0x1, 0x2, 0x2, 0x3, 0x2, 0x2, 0x1, 0x0, 0x2, 0x0, 0x1, },
+	{ 0xf2, 0xf1, 0x2, 0x3, 0x2, 0x2, 0x2, 0xf0, 0x2, 0xf0, 0x0, },
+	{ 0x1, 0x2, 0x2, 0x3, 0x2, 0x3, 0x1, 0x0, 0x3, 0x0, 0x1, },
+	{ 0x1, 0xf2, 0x3, 0x3, 0x2, 0x2, 0x2, 0x0, 0x13, 0x0, 0x0, },
+	{ 0x2, 0x2, 0x2, 0x3, 0x2, 0x3, 0x1, 0xf1, 0x3, 0x0, 0x1, },
+	{ 0x1, 0xf3, 0x2, 0x4, 0x1, 0x2, 0x2, 0x0, 0x3, 0x0, 0x1, },
+	{ 0x2, 0x2, 0x3, 0x3, 0x2, 0x2, 0x1, 0x1, 0x4, 0x0, 0xf1, },
+	{ 0xf1, 0x2, 0x2, 0x3, 0x2, 0x3, 0x2, 0xf0, 0x13, 0xf0, 0x1, },
+	{ 0x2, 0xf3, 0x2, 0x4, 0x2, 0x2, 0x2, 0x1, 0x4, 0x0, 0x1, },
+	{ 0x2, 0x2, 0x2, 0x3, 0x1, 0x12, 0x1, 0x1, 0x4, 0x0, 0x1, },
+	{ 0x1, 0x3, 0x2, 0x4, 0x2, 0x3, 0x12, 0xf0, 0x4, 0x0, 0x1, },
+	{ 0x2, 0x3, 0x2, 0x3, 0x1, 0x2, 0x2, 0x1, 0x4, 0x1, 0x1, },
+	{ 0x2, 0x2, 0xf2, 0x3, 0x2, 0x12, 0x2, 0x1, 0x4, 0x0, 0x2, },
+	{ 0x1, 0x3, 0x2, 0x3, 0x1, 0x1, 0x2, 0x1, 0x4, 0x0, 0x1, },
+	{ 0x2, 0x3, 0x2, 0x3, 0x1, 0x12, 0x1, 0xf1, 0x3, 0xf0, 0x1, },
+	{ 0x11, 0x2, 0x2, 0x3, 0x2, 0x2, 0xf2, 0x1, 0x4, 0x1, 0xf2, },
+	{ 0x2, 0x3, 0x1, 0x3, 0x1, 0x12, 0x2, 0x1, 0x4, 0x0, 0x2, },
+	{ 0x1, 0x2, 0x2, 0x3, 0x1, 0x1, 0x2, 0x1, 0x4, 0x0, 0x1, },
+	{ 0x2, 0x3, 0xf1, 0x2, 0x1, 0x11, 0x1, 0x1, 0xf4, 0x1, 0x2, },
+	{ 0x1, 0x12, 0x1, 0x2, 0x0, 0x12, 0x2, 0xf1, 0x3, 0x0, 0x1, },
+	{ 0x2, 0x3, 0x1, 0x3, 0x1, 0x1, 0x1, 0x1, 0x3, 0x1, 0x2, },
+	{ 0x11, 0x12, 0x1, 0x1, 0x1, 0x11, 0x2, 0x2, 0x3, 0x0, 0x2, },
+	{ 0x1, 0x2, 0x1, 0x2, 0x0, 0x10, 0x1, 0x1, 0x3, 0xf0, 0x1, },
+	{ 0x1, 0x12, 0xf1, 0x2, 0x1, 0x1, 0x2, 0x1, 0xf3, 0x1, 0x2, },
+	{ 0x1, 0x2, 0x0, 0x1, 0x0, 0x11, 0x1, 0x1, 0x3, 0x0, 0x2, },
+	{ 0x11, 0x12, 0x1, 0x1, 0x0, 0x10, 0x1, 0x2, 0x2, 0x1, 0x1, },
+	{ 0x1, 0x2, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0xf2, 0x0, 0x2, },
+	{ 0x1, 0x11, 0xf1, 0x1, 0x0, 0x10, 0x1, 0x1, 0x2, 0x1, 0x2, },
+	{ 0x11, 0x11, 0x0, 0xf1, 0x0, 0x10, 0x1, 0x1, 0x1, 0x0, 0x1, },
+	{ 0x1, 0x2, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x2, 0xf2, 0x1, 0x12, },
+	{ 0x10, 0x11, 0x0, 0x1, 0xf, 0x10, 0x1, 0x1, 0x1, 0x1, 0x1, },
+	{ 0x1, 0x11, 0xf0, 0x0, 0x0, 0x10, 0x0, 0x1, 0x1, 0x0, 0x2, },
+};
+const uint8_t path1[] = { 
+	0x9, 
+	0xc, 
+	0x5, 
+	0xc, 
+	0xe, 
+	0x12, 
+	0x0, 
+	0xe, 
+	0x2, 
+	0xa, 
+	0x0, 
+	0x8, 
+	0x4, 
+	0x6, 
+	0x2, 
+	0x0, 
+	0xf, 
+	0x14, 
+	0x2, 
+	0x10, 
+	0x6, 
+};
+
+const uint8_t visible1[][3] = { 
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+	{ 0x7a, 0x61, 0x1e, },
+	{ 0x7a, 0x69, 0x1e, },
+	{ 0x7a, 0x69, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0x7a, 0x79, 0x1e, },
+	{ 0xfa, 0x79, 0x1e, },
+	{ 0xfa, 0x79, 0x1e, },
+	{ 0xfa, 0x79, 0x1e, },
+	{ 0xfa, 0x7d, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x7f, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0x3e, 0x1e, },
+	{ 0xfa, 0xbf, 0x1e, },
+	{ 0xfa, 0xbf, 0x16, },
+	{ 0xfa, 0xbf, 0x16, },
+	{ 0xfa, 0xbf, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xbf, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x6, },
+	{ 0xfa, 0xff, 0x16, },
+	{ 0xfa, 0xff, 0x16, },
+	{ 0xfa, 0xff, 0x16, },
+	{ 0xfa, 0xff, 0x1e, },
+	{ 0xfa, 0xff, 0x1e, },
+	{ 0xfa, 0xff, 0x1e, },
+	{ 0xfa, 0xff, 0x1e, },
+	{ 0xfa, 0xff, 0x1e, },
+	{ 0xfa, 0xff, 0x1a, },
+	{ 0xfa, 0xff, 0x1a, },
+	{ 0xfa, 0xff, 0x1a, },
+	{ 0xfa, 0xff, 0x1a, },
+	{ 0xfa, 0xff, 0x1a, },
+	{ 0xfa, 0xff, 0x18, },
+	{ 0xfa, 0xff, 0x18, },
+	{ 0xfa, 0xff, 0x18, },
+	{ 0xfa, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xf0, 0xff, 0x18, },
+	{ 0xe0, 0xfe, 0x18, },
+	{ 0x60, 0xfe, 0x18, },
+	{ 0x60, 0xfe, 0x18, },
+	{ 0x60, 0xfe, 0x18, },
+	{ 0x68, 0xfe, 0x18, },
+	{ 0x68, 0xfe, 0x18, },
+	{ 0x68, 0xfe, 0x18, },
+	{ 0x78, 0xfe, 0x18, },
+	{ 0x78, 0xfe, 0x18, },
+	{ 0x58, 0xfe, 0x18, },
+	{ 0x18, 0xfe, 0x18, },
+	{ 0x18, 0xfe, 0x18, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0xff, 0x1e, },
+	{ 0x18, 0x7f, 0x1e, },
+	{ 0x18, 0x7f, 0x1e, },
+	{ 0x18, 0x7f, 0x1e, },
+	{ 0x18, 0x67, 0x1e, },
+	{ 0x18, 0x67, 0x1e, },
+	{ 0x18, 0x67, 0x1e, },
+	{ 0x18, 0x67, 0x1e, },
+	{ 0x38, 0x67, 0x1e, },
+	{ 0x78, 0x47, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x67, 0x1e, },
+	{ 0x78, 0x63, 0x1e, },
+	{ 0x78, 0x61, 0x1e, },
+};
+
+const int8_t keys2[][36] = { 
 	{
-		-29, -11, 
-		-31, -12, 
+		13, 13, 
+		24, -20, 
+		19, -1, 
+		25, 11, 
+		29, 15, 
+		26, -4, 
+		21, -6, 
+		28, -19, 
 		12, -23, 
-		2, -22, 
-		1, -22, 
-		-36, -23, 
-		8, -11, 
-		-34, 4, 
-		9, -15, 
-		-36, 5, 
-		-10, 1, 
-	},
-	{
-		-29, -12, 
-		-32, -13, 
-		13, -24, 
-		2, -23, 
-		1, -23, 
-		-36, -25, 
-		8, -12, 
-		-34, 3, 
-		9, -17, 
-		-36, 5, 
-		-10, 0, 
-	},
-	{
-		-29, -13, 
-		-32, -15, 
-		13, -25, 
-		2, -25, 
-		1, -24, 
-		-36, -26, 
-		8, -13, 
-		-34, 2, 
-		9, -19, 
-		-36, 4, 
-		-10, -1, 
-	},
-	{
-		-29, -14, 
-		-32, -16, 
-		13, -26, 
-		2, -26, 
-		1, -25, 
-		-37, -27, 
-		8, -14, 
-		-34, 1, 
-		9, -21, 
-		-36, 4, 
-		-10, -2, 
-	},
-	{
-		-29, -15, 
-		-32, -17, 
-		13, -27, 
-		2, -28, 
-		1, -26, 
-		-37, -28, 
-		8, -15, 
-		-34, 0, 
-		9, -22, 
-		-36, 4, 
-		-10, -4, 
-	},
-	{
-		-29, -16, 
-		-32, -19, 
-		13, -28, 
-		2, -29, 
-		1, -26, 
-		-38, -29, 
-		8, -16, 
-		-34, -1, 
-		9, -24, 
-		-36, 3, 
-		-10, -5, 
-	},
-	{
-		-30, -17, 
-		-33, -20, 
-		13, -29, 
-		2, -31, 
-		1, -27, 
-		-38, -30, 
-		8, -17, 
-		-34, -2, 
-		9, -26, 
-		-36, 3, 
-		-10, -6, 
-	},
-	{
-		-30, -18, 
-		-33, -21, 
-		13, -30, 
-		2, -32, 
-		1, -28, 
-		-38, -31, 
-		8, -18, 
-		-34, -2, 
-		9, -27, 
-		-36, 2, 
-		-10, -7, 
+		20, 25, 
+		11, -17, 
+		18, 13, 
+		22, -13, 
+		26, 5, 
+		18, -23, 
+		32, 5, 
+		39, 13, 
+		35, 32, 
 	},
 	{
-		-30, -18, 
-		-33, -23, 
-		14, -31, 
-		2, -33, 
-		1, -28, 
-		-39, -32, 
-		8, -19, 
-		-34, -3, 
-		10, -29, 
-		-36, 2, 
-		-10, -8, 
+		12, -10, 
+		35, -29, 
+		23, -25, 
+		25, -15, 
+		30, -18, 
+		31, -21, 
+		25, -18, 
+		41, -35, 
+		18, -34, 
+		18, -11, 
+		17, -40, 
+		17, -3, 
+		31, -37, 
+		27, -11, 
+		29, -41, 
+		33, -7, 
+		38, -10, 
+		28, -1, 
 	},
 	{
-		-30, -19, 
-		-34, -24, 
-		14, -31, 
-		2, -35, 
-		1, -29, 
-		-39, -32, 
-		9, -20, 
-		-34, -4, 
-		10, -31, 
-		-36, 1, 
-		-10, -9, 
+		15, -15, 
+		35, 29, 
+		28, 1, 
+		32, -15, 
+		40, -20, 
+		35, 5, 
+		28, 8, 
+		44, 30, 
+		18, 35, 
+		25, -31, 
+		19, 29, 
+		19, -14, 
+		37, 22, 
+		31, -5, 
+		30, 38, 
+		37, -6, 
+		46, -15, 
+		36, -33, 
 	},
 	{
-		-31, -20, 
-		-34, -25, 
-		14, -32, 
-		2, -36, 
-		1, -29, 
-		-40, -33, 
-		9, -20, 
-		-34, -5, 
-		10, -32, 
-		-36, 1, 
-		-10, -10, 
-	},
-	{
-		-31, -21, 
-		-34, -26, 
-		14, -33, 
-		3, -37, 
-		1, -30, 
-		-40, -34, 
-		9, -21, 
-		-34, -6, 
-		10, -34, 
-		-36, 0, 
-		-10, -11, 
-	},
-	{
-		-31, -22, 
-		-35, -28, 
-		14, -33, 
-		3, -38, 
-		1, -30, 
-		-41, -35, 
-		9, -22, 
-		-34, -7, 
-		10, -35, 
-		-36, 0, 
-		-10, -12, 
-	},
-	{
-		-31, -22, 
-		-35, -29, 
-		14, -34, 
-		3, -40, 
-		1, -30, 
-		-41, -35, 
-		9, -23, 
-		-34, -8, 
-		10, -37, 
-		-36, -1, 
-		-11, -13, 
-	},
-	{
-		-32, -23, 
-		-35, -30, 
-		15, -35, 
-		3, -41, 
-		1, -30, 
-		-42, -36, 
-		9, -24, 
-		-34, -8, 
-		10, -38, 
-		-36, -1, 
-		-11, -14, 
-	},
-	{
-		-32, -23, 
-		-36, -31, 
-		15, -35, 
-		3, -42, 
-		1, -31, 
-		-43, -36, 
-		9, -24, 
-		-34, -9, 
-		11, -40, 
-		-36, -2, 
-		-11, -15, 
-	},
-	{
-		-32, -24, 
-		-36, -32, 
-		15, -35, 
-		3, -43, 
-		1, -31, 
-		-43, -36, 
-		9, -25, 
-		-34, -10, 
-		11, -41, 
-		-36, -2, 
-		-11, -16, 
-	},
-	{
-		-32, -25, 
-		-37, -33, 
-		15, -36, 
-		3, -44, 
-		1, -31, 
-		-44, -37, 
-		9, -26, 
-		-34, -11, 
-		11, -42, 
-		-36, -2, 
-		-11, -17, 
-	},
-	{
-		-33, -25, 
-		-37, -34, 
-		15, -36, 
-		3, -45, 
-		1, -31, 
-		-44, -37, 
-		9, -26, 
-		-35, -12, 
-		11, -44, 
-		-36, -3, 
-		-11, -18, 
-	},
-	{
-		-33, -25, 
-		-38, -35, 
-		16, -36, 
-		3, -45, 
-		1, -30, 
-		-45, -37, 
-		9, -27, 
-		-35, -12, 
-		11, -45, 
-		-36, -3, 
-		-11, -19, 
-	},
-	{
-		-33, -26, 
-		-38, -36, 
-		16, -36, 
-		3, -46, 
-		1, -30, 
-		-46, -37, 
-		9, -27, 
-		-35, -13, 
-		11, -46, 
-		-36, -4, 
-		-11, -20, 
-	},
-	{
-		-34, -26, 
-		-39, -36, 
-		16, -36, 
-		3, -47, 
-		1, -30, 
-		-46, -37, 
-		10, -28, 
-		-35, -14, 
-		12, -47, 
-		-36, -4, 
-		-11, -20, 
-	},
-	{
-		-34, -26, 
-		-39, -37, 
-		16, -36, 
-		3, -47, 
-		1, -29, 
-		-47, -37, 
-		10, -28, 
-		-35, -15, 
-		12, -49, 
-		-36, -5, 
-		-11, -21, 
-	},
-	{
-		-34, -27, 
-		-40, -38, 
-		17, -35, 
-		3, -48, 
-		1, -29, 
-		-48, -37, 
-		10, -28, 
-		-36, -15, 
-		12, -50, 
-		-36, -5, 
-		-11, -22, 
-	},
-	{
-		-35, -27, 
-		-40, -38, 
-		17, -35, 
-		3, -48, 
-		1, -28, 
-		-48, -36, 
-		10, -29, 
-		-36, -16, 
-		12, -50, 
-		-36, -5, 
-		-11, -23, 
-	},
-	{
-		-35, -27, 
-		-41, -39, 
-		17, -35, 
-		3, -48, 
-		1, -27, 
-		-49, -36, 
-		10, -29, 
-		-36, -17, 
-		13, -51, 
-		-36, -6, 
-		-11, -23, 
-	},
-	{
-		-36, -27, 
-		-42, -39, 
-		17, -34, 
-		3, -48, 
-		1, -27, 
-		-50, -35, 
-		10, -29, 
-		-36, -17, 
-		13, -52, 
-		-36, -6, 
-		-12, -24, 
-	},
-	{
-		-36, -27, 
-		-42, -40, 
-		17, -33, 
-		3, -48, 
-		1, -26, 
-		-50, -34, 
-		10, -29, 
-		-36, -18, 
-		13, -53, 
-		-36, -7, 
-		-12, -25, 
-	},
-	{
-		-36, -27, 
-		-43, -40, 
-		18, -32, 
-		3, -48, 
-		1, -25, 
-		-51, -33, 
-		10, -29, 
-		-37, -18, 
-		13, -53, 
-		-37, -7, 
-		-12, -25, 
-	},
-	{
-		-37, -27, 
-		-44, -40, 
-		18, -31, 
-		3, -47, 
-		1, -24, 
-		-52, -32, 
-		10, -29, 
-		-37, -19, 
-		14, -54, 
-		-37, -7, 
-		-12, -26, 
-	},
-	{
-		-37, -26, 
-		-44, -40, 
-		18, -30, 
-		3, -47, 
-		1, -23, 
-		-52, -31, 
-		11, -29, 
-		-37, -19, 
-		14, -54, 
-		-37, -8, 
-		-12, -26, 
-	},
-	{
-		-37, -26, 
-		-45, -40, 
-		18, -29, 
-		4, -46, 
-		1, -21, 
-		-53, -30, 
-		11, -28, 
-		-38, -20, 
-		14, -54, 
-		-37, -8, 
-		-12, -27, 
-	},
-	{
-		-38, -25, 
-		-46, -40, 
-		19, -28, 
-		4, -45, 
-		1, -20, 
-		-54, -29, 
-		11, -28, 
-		-38, -20, 
-		15, -54, 
-		-37, -8, 
-		-12, -27, 
-	},
-	{
-		-38, -25, 
-		-46, -40, 
-		19, -26, 
-		4, -44, 
-		1, -18, 
-		-54, -27, 
-		11, -28, 
-		-38, -20, 
-		15, -54, 
-		-37, -9, 
-		-12, -27, 
-	},
-	{
-		-39, -24, 
-		-47, -39, 
-		19, -25, 
-		4, -43, 
-		1, -17, 
-		-55, -26, 
-		11, -27, 
-		-38, -21, 
-		15, -53, 
-		-37, -9, 
-		-13, -27, 
-	},
-	{
-		-39, -24, 
-		-48, -39, 
-		19, -23, 
-		4, -42, 
-		1, -15, 
-		-55, -24, 
-		11, -27, 
-		-39, -21, 
-		15, -53, 
-		-37, -9, 
-		-13, -28, 
-	},
-	{
-		-39, -23, 
-		-48, -38, 
-		19, -22, 
-		4, -40, 
-		1, -14, 
-		-56, -22, 
-		11, -26, 
-		-39, -21, 
-		16, -52, 
-		-37, -9, 
-		-13, -28, 
-	},
-	{
-		-40, -22, 
-		-49, -37, 
-		19, -20, 
-		4, -38, 
-		1, -12, 
-		-56, -20, 
-		11, -25, 
-		-39, -21, 
-		16, -51, 
-		-38, -9, 
-		-13, -28, 
-	},
-	{
-		-40, -21, 
-		-50, -36, 
-		20, -18, 
-		4, -36, 
-		1, -10, 
-		-57, -18, 
-		11, -24, 
-		-40, -22, 
-		16, -50, 
-		-38, -10, 
-		-13, -28, 
-	},
-	{
-		-40, -20, 
-		-51, -35, 
-		20, -16, 
-		4, -34, 
-		1, -8, 
-		-57, -16, 
-		12, -23, 
-		-40, -22, 
-		17, -49, 
-		-38, -10, 
-		-13, -28, 
-	},
-	{
-		-41, -19, 
-		-51, -34, 
-		20, -14, 
-		4, -32, 
-		1, -7, 
-		-57, -14, 
-		12, -22, 
-		-40, -22, 
-		17, -47, 
-		-38, -10, 
-		-13, -27, 
-	},
-	{
-		-41, -18, 
-		-52, -33, 
-		20, -12, 
-		4, -29, 
-		1, -5, 
-		-58, -12, 
-		12, -21, 
-		-41, -22, 
-		17, -45, 
-		-38, -10, 
-		-14, -27, 
-	},
-	{
-		-41, -17, 
-		-53, -31, 
-		20, -9, 
-		4, -27, 
-		1, -3, 
-		-58, -9, 
-		12, -20, 
-		-41, -21, 
-		18, -43, 
-		-38, -10, 
-		-14, -27, 
-	},
-	{
-		-41, -16, 
-		-53, -29, 
-		20, -7, 
-		4, -24, 
-		1, -1, 
-		-58, -7, 
-		12, -19, 
-		-41, -21, 
-		18, -41, 
-		-38, -10, 
-		-14, -26, 
-	},
-	{
-		-42, -14, 
-		-54, -28, 
-		20, -5, 
-		4, -21, 
-		1, 1, 
-		-58, -5, 
-		12, -17, 
-		-42, -21, 
-		18, -39, 
-		-39, -10, 
-		-14, -26, 
-	},
-	{
-		-42, -13, 
-		-54, -26, 
-		20, -3, 
-		4, -18, 
-		1, 3, 
-		-58, -2, 
-		12, -16, 
-		-42, -21, 
-		18, -36, 
-		-39, -10, 
-		-14, -25, 
-	},
-	{
-		-42, -12, 
-		-55, -24, 
-		20, 0, 
-		4, -15, 
-		1, 5, 
-		-58, 0, 
-		12, -14, 
-		-42, -21, 
-		19, -33, 
-		-39, -10, 
-		-14, -25, 
-	},
-	{
-		-42, -10, 
-		-55, -22, 
-		20, 2, 
-		4, -12, 
-		1, 7, 
-		-58, 3, 
-		12, -13, 
-		-43, -20, 
-		19, -30, 
-		-39, -10, 
-		-14, -24, 
-	},
-	{
-		-42, -9, 
-		-56, -19, 
-		20, 4, 
-		4, -8, 
-		1, 8, 
-		-58, 5, 
-		12, -11, 
-		-43, -20, 
-		19, -27, 
-		-39, -10, 
-		-14, -23, 
-	},
-	{
-		-42, -7, 
-		-56, -17, 
-		20, 7, 
-		4, -5, 
-		1, 10, 
-		-58, 7, 
-		12, -10, 
-		-43, -19, 
-		19, -23, 
-		-39, -10, 
-		-15, -22, 
-	},
-	{
-		-43, -6, 
-		-56, -15, 
-		20, 9, 
-		4, -2, 
-		1, 12, 
-		-58, 10, 
-		12, -8, 
-		-44, -19, 
-		20, -20, 
-		-40, -10, 
-		-15, -21, 
-	},
-	{
-		-43, -4, 
-		-57, -12, 
-		20, 11, 
-		4, 2, 
-		1, 14, 
-		-58, 12, 
-		12, -6, 
-		-44, -18, 
-		20, -16, 
-		-40, -10, 
-		-15, -20, 
-	},
-	{
-		-43, -2, 
-		-57, -10, 
-		20, 13, 
-		4, 5, 
-		1, 15, 
-		-57, 14, 
-		12, -5, 
-		-44, -17, 
-		20, -12, 
-		-40, -10, 
-		-15, -19, 
-	},
-	{
-		-43, -1, 
-		-57, -7, 
-		20, 15, 
-		4, 9, 
-		1, 17, 
-		-57, 17, 
-		13, -3, 
-		-45, -17, 
-		20, -8, 
-		-40, -10, 
-		-15, -18, 
-	},
-	{
-		-43, 1, 
-		-57, -4, 
-		20, 17, 
-		4, 12, 
-		1, 18, 
-		-57, 19, 
-		13, -1, 
-		-45, -16, 
-		20, -4, 
-		-40, -9, 
-		-15, -17, 
-	},
-	{
-		-43, 3, 
-		-57, -2, 
-		19, 19, 
-		4, 15, 
-		1, 20, 
-		-56, 21, 
-		13, 1, 
-		-45, -15, 
-		20, 0, 
-		-40, -9, 
-		-15, -15, 
-	},
-	{
-		-43, 4, 
-		-57, 1, 
-		19, 21, 
-		4, 18, 
-		1, 21, 
-		-56, 22, 
-		13, 3, 
-		-45, -14, 
-		20, 4, 
-		-40, -9, 
-		-15, -14, 
-	},
-	{
-		-43, 6, 
-		-57, 4, 
-		19, 23, 
-		4, 21, 
-		1, 22, 
-		-55, 24, 
-		13, 4, 
-		-46, -13, 
-		20, 7, 
-		-41, -9, 
-		-15, -13, 
-	},
-	{
-		-42, 7, 
-		-57, 6, 
-		19, 25, 
-		4, 24, 
-		1, 24, 
-		-55, 26, 
-		12, 6, 
-		-46, -12, 
-		20, 11, 
-		-41, -8, 
-		-16, -11, 
-	},
-	{
-		-42, 9, 
-		-57, 9, 
-		19, 26, 
-		4, 27, 
-		1, 25, 
-		-54, 28, 
-		12, 8, 
-		-46, -11, 
-		20, 15, 
-		-41, -8, 
-		-16, -9, 
-	},
-	{
-		-42, 10, 
-		-57, 11, 
-		19, 28, 
-		4, 30, 
-		1, 26, 
-		-54, 29, 
-		12, 10, 
-		-46, -10, 
-		20, 19, 
-		-41, -8, 
-		-16, -8, 
-	},
-	{
-		-42, 12, 
-		-57, 14, 
-		18, 29, 
-		4, 32, 
-		1, 27, 
-		-53, 30, 
-		12, 11, 
-		-46, -9, 
-		19, 23, 
-		-41, -7, 
-		-16, -6, 
-	},
-	{
-		-42, 13, 
-		-56, 16, 
-		18, 30, 
-		4, 34, 
-		1, 27, 
-		-52, 32, 
-		12, 13, 
-		-47, -8, 
-		19, 26, 
-		-41, -7, 
-		-16, -5, 
-	},
-	{
-		-42, 15, 
-		-56, 19, 
-		18, 31, 
-		4, 37, 
-		1, 28, 
-		-52, 33, 
-		12, 14, 
-		-47, -7, 
-		19, 29, 
-		-41, -6, 
-		-16, -3, 
-	},
-	{
-		-41, 16, 
-		-55, 21, 
-		18, 32, 
-		4, 38, 
-		1, 29, 
-		-51, 34, 
-		12, 16, 
-		-47, -5, 
-		19, 32, 
-		-41, -6, 
-		-16, -1, 
-	},
-	{
-		-41, 17, 
-		-55, 23, 
-		18, 33, 
-		4, 40, 
-		1, 29, 
-		-50, 34, 
-		12, 17, 
-		-47, -4, 
-		19, 35, 
-		-42, -6, 
-		-16, 0, 
-	},
-	{
-		-41, 18, 
-		-54, 25, 
-		17, 34, 
-		4, 42, 
-		1, 30, 
-		-50, 35, 
-		12, 19, 
-		-47, -3, 
-		18, 38, 
-		-42, -5, 
-		-16, 2, 
-	},
-	{
-		-41, 19, 
-		-54, 27, 
-		17, 34, 
-		4, 43, 
-		1, 30, 
-		-49, 36, 
-		12, 20, 
-		-47, -2, 
-		18, 41, 
-		-42, -5, 
-		-16, 4, 
-	},
-	{
-		-40, 20, 
-		-53, 29, 
-		17, 35, 
-		4, 44, 
-		1, 30, 
-		-48, 36, 
-		12, 21, 
-		-47, 0, 
-		18, 43, 
-		-42, -4, 
-		-16, 5, 
-	},
-	{
-		-40, 21, 
-		-53, 31, 
-		17, 35, 
-		4, 45, 
-		1, 31, 
-		-48, 37, 
-		12, 22, 
-		-47, 1, 
-		17, 45, 
-		-42, -4, 
-		-16, 7, 
-	},
-	{
-		-40, 22, 
-		-52, 32, 
-		16, 36, 
-		4, 46, 
-		1, 31, 
-		-47, 37, 
-		12, 23, 
-		-47, 2, 
-		17, 47, 
-		-42, -3, 
-		-16, 9, 
-	},
-	{
-		-39, 23, 
-		-51, 33, 
-		16, 36, 
-		3, 47, 
-		1, 31, 
-		-46, 37, 
-		12, 24, 
-		-47, 3, 
-		17, 48, 
-		-42, -3, 
-		-16, 10, 
-	},
-	{
-		-39, 24, 
-		-51, 35, 
-		16, 36, 
-		3, 47, 
-		1, 31, 
-		-46, 37, 
-		11, 25, 
-		-47, 5, 
-		16, 50, 
-		-42, -2, 
-		-15, 12, 
-	},
-	{
-		-38, 24, 
-		-50, 36, 
-		16, 36, 
-		3, 48, 
-		1, 30, 
-		-45, 37, 
-		11, 26, 
-		-47, 6, 
-		16, 51, 
-		-42, -1, 
-		-15, 13, 
-	},
-	{
-		-38, 25, 
-		-49, 37, 
-		15, 36, 
-		3, 48, 
-		1, 30, 
-		-44, 37, 
-		11, 26, 
-		-47, 7, 
-		16, 52, 
-		-42, -1, 
-		-15, 15, 
-	},
-};
-const uint16_t edges1[] = { 
-	0x2, 
-	0x8, 
-	0xa, 
-	0xe, 
-	0x12, 
-	0x206, 
-	0x20a, 
-	0x20e, 
-	0x210, 
-	0x214, 
-	0x406, 
-	0x408, 
-	0x40c, 
-	0x610, 
-	0x80c, 
-	0xc0e, 
-	0xe12, 
-	0xe14, 
-};
-
-const int8_t vertices2[][36] = { 
-	{
-		13, 13, 
-		24, -20, 
-		19, -1, 
-		25, 11, 
-		29, 15, 
-		26, -4, 
-		21, -6, 
-		28, -19, 
-		12, -23, 
-		20, 25, 
-		11, -17, 
-		18, 13, 
-		22, -13, 
-		26, 5, 
-		18, -23, 
-		32, 5, 
-		39, 13, 
-		35, 32, 
-	},
-	{
-		13, 12, 
-		24, -21, 
-		19, -2, 
-		25, 11, 
-		29, 14, 
-		26, -5, 
-		21, -7, 
-		28, -20, 
-		12, -24, 
-		20, 24, 
-		11, -18, 
-		18, 13, 
-		22, -14, 
-		26, 4, 
-		18, -24, 
-		32, 5, 
-		38, 12, 
-		35, 32, 
-	},
-	{
-		13, 12, 
-		24, -22, 
-		19, -3, 
-		25, 10, 
-		29, 13, 
-		26, -5, 
-		21, -8, 
-		28, -21, 
-		12, -26, 
-		20, 23, 
-		11, -20, 
-		18, 13, 
-		22, -15, 
-		26, 3, 
-		18, -26, 
-		32, 5, 
-		38, 12, 
-		34, 31, 
-	},
-	{
-		13, 11, 
-		24, -23, 
-		19, -4, 
-		24, 9, 
-		29, 12, 
-		26, -6, 
-		21, -8, 
-		28, -23, 
-		12, -27, 
-		20, 22, 
-		11, -21, 
-		18, 13, 
-		22, -17, 
-		26, 3, 
-		19, -27, 
-		32, 4, 
-		38, 11, 
-		34, 31, 
-	},
-	{
-		13, 10, 
-		25, -24, 
-		19, -5, 
-		24, 8, 
-		29, 11, 
-		26, -7, 
-		21, -9, 
-		29, -24, 
-		12, -28, 
-		19, 21, 
-		11, -23, 
-		18, 12, 
-		22, -18, 
-		26, 2, 
-		19, -28, 
-		32, 4, 
-		38, 10, 
-		33, 30, 
-	},
-	{
-		12, 10, 
-		25, -25, 
-		19, -6, 
-		24, 7, 
-		28, 10, 
-		26, -8, 
-		21, -10, 
-		29, -25, 
-		12, -29, 
-		19, 20, 
-		11, -24, 
-		18, 12, 
-		22, -19, 
-		26, 2, 
-		19, -30, 
-		32, 3, 
-		38, 10, 
-		33, 29, 
-	},
-	{
-		12, 9, 
-		25, -26, 
-		19, -7, 
-		24, 7, 
-		28, 9, 
-		26, -9, 
-		22, -11, 
-		29, -26, 
-		12, -30, 
-		19, 19, 
-		11, -25, 
-		17, 12, 
-		23, -21, 
-		26, 1, 
-		19, -31, 
-		32, 3, 
-		38, 9, 
-		33, 29, 
-	},
-	{
-		12, 8, 
-		25, -27, 
-		19, -8, 
-		24, 6, 
-		28, 8, 
-		26, -9, 
-		22, -11, 
-		29, -27, 
-		12, -31, 
-		19, 18, 
-		12, -26, 
-		17, 11, 
-		23, -22, 
-		26, 1, 
-		20, -32, 
-		32, 3, 
-		38, 8, 
-		32, 28, 
-	},
-	{
-		12, 8, 
-		26, -28, 
-		19, -9, 
-		24, 5, 
-		28, 7, 
-		26, -10, 
-		22, -12, 
-		30, -28, 
-		13, -32, 
-		19, 17, 
-		12, -28, 
-		17, 11, 
-		23, -23, 
-		26, 0, 
-		20, -34, 
-		32, 2, 
-		37, 8, 
-		32, 27, 
-	},
-	{
-		12, 7, 
-		26, -29, 
-		20, -10, 
-		24, 4, 
-		28, 6, 
-		26, -11, 
-		22, -12, 
-		30, -29, 
-		13, -33, 
-		19, 16, 
-		12, -29, 
-		17, 10, 
-		23, -24, 
-		26, 0, 
-		20, -35, 
-		32, 2, 
-		37, 7, 
-		32, 26, 
-	},
-	{
-		12, 6, 
-		26, -29, 
-		20, -11, 
-		24, 3, 
-		28, 5, 
-		27, -12, 
-		22, -13, 
-		30, -30, 
-		13, -34, 
-		19, 15, 
-		12, -30, 
-		17, 10, 
-		23, -25, 
-		26, -1, 
-		20, -36, 
-		32, 1, 
-		37, 6, 
-		31, 25, 
-	},
-	{
-		12, 5, 
-		27, -30, 
-		20, -12, 
-		24, 2, 
-		28, 4, 
-		27, -12, 
-		22, -14, 
-		31, -31, 
-		13, -35, 
-		18, 14, 
-		12, -31, 
-		17, 10, 
-		24, -26, 
-		26, -2, 
-		21, -37, 
-		32, 1, 
-		37, 5, 
-		31, 24, 
-	},
-	{
-		12, 5, 
-		27, -31, 
-		20, -13, 
-		24, 1, 
-		28, 3, 
-		27, -13, 
-		22, -14, 
-		31, -32, 
-		13, -36, 
-		18, 13, 
-		12, -32, 
-		17, 9, 
-		24, -28, 
-		26, -2, 
-		21, -38, 
-		32, 0, 
-		37, 5, 
-		31, 23, 
-	},
-	{
-		12, 4, 
-		27, -32, 
-		20, -14, 
-		24, 0, 
-		28, 2, 
-		27, -14, 
-		22, -15, 
-		32, -33, 
-		13, -37, 
-		18, 11, 
-		12, -33, 
-		17, 9, 
-		24, -29, 
-		26, -3, 
-		21, -39, 
-		32, 0, 
-		37, 4, 
-		30, 22, 
-	},
-	{
-		12, 3, 
-		28, -32, 
-		20, -15, 
-		24, 0, 
-		28, 1, 
-		27, -14, 
-		22, -15, 
-		32, -34, 
-		14, -38, 
-		18, 10, 
-		13, -34, 
-		17, 8, 
-		24, -30, 
-		26, -3, 
-		22, -40, 
-		32, 0, 
-		37, 3, 
-		30, 21, 
-	},
-	{
-		12, 3, 
-		28, -33, 
-		20, -15, 
-		24, -1, 
-		28, -1, 
-		27, -15, 
-		23, -16, 
-		32, -35, 
-		14, -38, 
-		18, 9, 
-		13, -35, 
-		17, 7, 
-		25, -31, 
-		26, -4, 
-		22, -41, 
-		32, -1, 
-		37, 2, 
-		30, 20, 
-	},
-	{
-		12, 2, 
-		28, -33, 
-		20, -16, 
-		24, -2, 
-		28, -2, 
-		27, -16, 
-		23, -16, 
-		33, -35, 
-		14, -39, 
-		18, 8, 
-		13, -36, 
-		17, 7, 
-		25, -32, 
-		26, -4, 
-		22, -42, 
-		32, -1, 
-		37, 2, 
-		30, 19, 
-	},
-	{
-		12, 1, 
-		29, -33, 
-		20, -17, 
-		24, -3, 
-		28, -3, 
-		28, -16, 
-		23, -16, 
-		33, -36, 
-		14, -39, 
-		18, 7, 
-		13, -37, 
-		17, 6, 
-		25, -32, 
-		26, -5, 
-		23, -43, 
-		32, -2, 
-		37, 1, 
-		30, 18, 
-	},
-	{
-		12, 0, 
-		29, -34, 
-		21, -18, 
-		24, -4, 
-		28, -4, 
-		28, -17, 
-		23, -17, 
-		34, -37, 
-		15, -40, 
-		18, 5, 
-		13, -38, 
-		17, 6, 
-		26, -33, 
-		26, -5, 
-		23, -44, 
-		32, -2, 
-		37, 0, 
-		29, 16, 
-	},
-	{
-		12, -1, 
-		29, -34, 
-		21, -19, 
-		24, -5, 
-		28, -5, 
-		28, -17, 
-		23, -17, 
-		34, -37, 
-		15, -40, 
-		18, 4, 
-		13, -38, 
-		17, 5, 
-		26, -34, 
-		26, -6, 
-		23, -44, 
-		32, -3, 
-		37, -1, 
-		29, 15, 
-	},
-	{
-		12, -1, 
-		30, -34, 
-		21, -19, 
-		24, -6, 
-		28, -6, 
-		28, -18, 
-		23, -17, 
-		35, -38, 
-		15, -40, 
-		18, 3, 
-		14, -39, 
-		17, 5, 
-		26, -35, 
-		26, -6, 
-		24, -45, 
-		32, -3, 
-		37, -1, 
-		29, 14, 
-	},
-	{
-		12, -2, 
-		30, -34, 
-		21, -20, 
-		24, -6, 
-		28, -7, 
-		28, -18, 
-		23, -18, 
-		35, -38, 
-		15, -40, 
-		18, 2, 
-		14, -40, 
-		17, 4, 
-		27, -35, 
-		26, -7, 
-		24, -45, 
-		32, -3, 
-		37, -2, 
-		29, 13, 
-	},
-	{
-		12, -3, 
-		31, -34, 
-		21, -21, 
-		24, -7, 
-		28, -8, 
-		29, -19, 
-		24, -18, 
-		36, -38, 
-		15, -40, 
-		18, 1, 
-		14, -40, 
-		17, 3, 
-		27, -36, 
-		26, -7, 
-		25, -45, 
-		32, -4, 
-		37, -3, 
-		29, 12, 
-	},
-	{
-		12, -4, 
-		31, -34, 
-		21, -21, 
-		24, -8, 
-		28, -9, 
-		29, -19, 
-		24, -18, 
-		36, -38, 
-		16, -40, 
-		18, -1, 
-		14, -41, 
-		17, 3, 
-		27, -37, 
-		26, -8, 
-		25, -46, 
-		32, -4, 
-		37, -4, 
-		29, 10, 
-	},
-	{
-		12, -4, 
-		31, -34, 
-		22, -22, 
-		24, -9, 
-		28, -10, 
-		29, -19, 
-		24, -18, 
-		37, -38, 
-		16, -40, 
-		18, -2, 
-		15, -41, 
-		17, 2, 
-		28, -37, 
-		26, -8, 
-		26, -46, 
-		32, -5, 
-		37, -4, 
-		29, 9, 
-	},
-	{
-		12, -5, 
-		32, -34, 
-		22, -22, 
-		25, -10, 
-		29, -11, 
-		29, -20, 
-		24, -18, 
-		37, -38, 
-		16, -40, 
-		18, -3, 
-		15, -41, 
-		17, 2, 
-		28, -37, 
-		26, -9, 
-		26, -46, 
-		32, -5, 
-		37, -5, 
-		28, 8, 
-	},
-	{
-		12, -6, 
-		32, -33, 
-		22, -23, 
-		25, -11, 
-		29, -12, 
-		29, -20, 
-		24, -18, 
-		38, -38, 
-		16, -39, 
-		18, -4, 
-		15, -41, 
-		17, 1, 
-		29, -38, 
-		26, -9, 
-		26, -45, 
-		32, -5, 
-		37, -6, 
-		28, 7, 
-	},
-	{
-		12, -6, 
-		33, -33, 
-		22, -23, 
-		25, -11, 
-		29, -13, 
-		30, -20, 
-		24, -18, 
-		39, -38, 
-		17, -39, 
-		18, -5, 
-		15, -41, 
-		17, 0, 
-		29, -38, 
-		27, -9, 
-		27, -45, 
-		33, -6, 
-		37, -7, 
-		28, 5, 
-	},
-	{
-		12, -7, 
-		33, -32, 
-		22, -24, 
-		25, -12, 
-		29, -14, 
-		30, -20, 
-		25, -18, 
-		39, -38, 
-		17, -38, 
-		18, -7, 
-		16, -41, 
-		17, 0, 
-		29, -38, 
-		27, -10, 
-		27, -45, 
-		33, -6, 
-		37, -7, 
-		28, 4, 
-	},
-	{
-		12, -8, 
-		33, -32, 
-		22, -24, 
-		25, -13, 
-		29, -15, 
-		30, -20, 
-		25, -18, 
-		40, -37, 
-		17, -37, 
-		18, -8, 
-		16, -41, 
-		17, -1, 
-		30, -38, 
-		27, -10, 
-		28, -44, 
-		33, -6, 
-		37, -8, 
-		28, 3, 
-	},
-	{
-		12, -9, 
-		34, -31, 
-		23, -25, 
-		25, -14, 
-		29, -16, 
-		30, -21, 
-		25, -18, 
-		40, -37, 
-		17, -36, 
-		18, -9, 
-		16, -41, 
-		17, -2, 
-		30, -38, 
-		27, -11, 
-		28, -43, 
-		33, -7, 
-		38, -9, 
-		28, 2, 
-	},
-	{
-		12, -9, 
-		34, -30, 
-		23, -25, 
-		25, -14, 
-		29, -17, 
-		31, -21, 
-		25, -18, 
-		41, -36, 
-		18, -35, 
-		18, -10, 
-		16, -40, 
-		17, -2, 
-		31, -38, 
-		27, -11, 
-		29, -42, 
-		33, -7, 
-		38, -9, 
-		28, 0, 
-	},
-	{
-		12, -10, 
-		35, -29, 
-		23, -25, 
-		25, -15, 
-		30, -18, 
-		31, -21, 
-		25, -18, 
-		41, -35, 
-		18, -34, 
-		18, -11, 
-		17, -40, 
-		17, -3, 
-		31, -37, 
-		27, -11, 
-		29, -41, 
-		33, -7, 
-		38, -10, 
-		28, -1, 
-	},
-	{
-		13, -11, 
-		35, -28, 
-		23, -25, 
-		26, -16, 
-		30, -18, 
-		31, -20, 
-		25, -17, 
-		42, -34, 
-		18, -33, 
-		18, -13, 
-		17, -39, 
-		17, -3, 
-		32, -37, 
-		27, -11, 
-		30, -40, 
-		33, -8, 
-		38, -11, 
-		28, -2, 
-	},
-	{
-		13, -11, 
-		35, -26, 
-		24, -25, 
-		26, -16, 
-		30, -19, 
-		31, -20, 
-		26, -17, 
-		43, -33, 
-		18, -31, 
-		18, -14, 
-		17, -38, 
-		17, -4, 
-		32, -37, 
-		27, -12, 
-		30, -39, 
-		33, -8, 
-		38, -11, 
-		28, -4, 
-	},
-	{
-		13, -12, 
-		36, -25, 
-		24, -25, 
-		26, -17, 
-		30, -20, 
-		32, -20, 
-		26, -17, 
-		43, -32, 
-		19, -30, 
-		19, -15, 
-		17, -37, 
-		17, -5, 
-		33, -36, 
-		27, -12, 
-		31, -37, 
-		33, -8, 
-		38, -12, 
-		28, -5, 
-	},
-	{
-		13, -12, 
-		36, -24, 
-		24, -25, 
-		26, -17, 
-		31, -21, 
-		32, -20, 
-		26, -16, 
-		44, -30, 
-		19, -28, 
-		19, -16, 
-		18, -36, 
-		17, -5, 
-		33, -35, 
-		28, -12, 
-		31, -35, 
-		33, -8, 
-		39, -12, 
-		28, -6, 
-	},
-	{
-		13, -13, 
-		36, -22, 
-		24, -25, 
-		26, -18, 
-		31, -21, 
-		32, -20, 
-		26, -16, 
-		44, -29, 
-		19, -26, 
-		19, -17, 
-		18, -34, 
-		17, -6, 
-		34, -34, 
-		28, -12, 
-		31, -33, 
-		33, -9, 
-		39, -13, 
-		28, -7, 
-	},
-	{
-		13, -13, 
-		37, -20, 
-		25, -25, 
-		26, -18, 
-		31, -22, 
-		32, -19, 
-		26, -15, 
-		45, -27, 
-		19, -24, 
-		19, -18, 
-		18, -33, 
-		17, -6, 
-		34, -33, 
-		28, -12, 
-		32, -31, 
-		34, -9, 
-		39, -14, 
-		28, -9, 
-	},
-	{
-		13, -14, 
-		37, -19, 
-		25, -25, 
-		27, -19, 
-		31, -23, 
-		33, -19, 
-		26, -15, 
-		45, -26, 
-		19, -22, 
-		19, -19, 
-		18, -31, 
-		17, -7, 
-		34, -32, 
-		28, -12, 
-		32, -29, 
-		34, -9, 
-		39, -14, 
-		29, -10, 
-	},
-	{
-		13, -14, 
-		37, -17, 
-		25, -24, 
-		27, -19, 
-		32, -23, 
-		33, -18, 
-		27, -14, 
-		45, -24, 
-		20, -19, 
-		19, -20, 
-		18, -30, 
-		17, -7, 
-		35, -31, 
-		28, -13, 
-		33, -27, 
-		34, -9, 
-		39, -15, 
-		29, -11, 
-	},
-	{
-		13, -15, 
-		37, -15, 
-		25, -24, 
-		27, -20, 
-		32, -24, 
-		33, -18, 
-		27, -14, 
-		46, -22, 
-		20, -17, 
-		19, -21, 
-		19, -28, 
-		17, -8, 
-		35, -29, 
-		28, -13, 
-		33, -24, 
-		34, -9, 
-		40, -15, 
-		29, -12, 
-	},
-	{
-		13, -15, 
-		38, -13, 
-		25, -24, 
-		27, -20, 
-		32, -25, 
-		33, -17, 
-		27, -13, 
-		46, -20, 
-		20, -15, 
-		20, -22, 
-		19, -26, 
-		17, -9, 
-		36, -28, 
-		28, -13, 
-		33, -22, 
-		34, -9, 
-		40, -15, 
-		29, -14, 
-	},
-	{
-		13, -16, 
-		38, -11, 
-		26, -23, 
-		27, -20, 
-		33, -25, 
-		33, -17, 
-		27, -12, 
-		47, -18, 
-		20, -12, 
-		20, -23, 
-		19, -24, 
-		17, -9, 
-		36, -26, 
-		29, -13, 
-		33, -19, 
-		34, -9, 
-		40, -16, 
-		29, -15, 
-	},
-	{
-		13, -16, 
-		38, -9, 
-		26, -23, 
-		28, -21, 
-		33, -25, 
-		34, -16, 
-		27, -11, 
-		47, -15, 
-		20, -10, 
-		20, -24, 
-		19, -21, 
-		17, -10, 
-		36, -24, 
-		29, -13, 
-		34, -16, 
-		34, -9, 
-		40, -16, 
-		29, -16, 
-	},
-	{
-		13, -16, 
-		38, -7, 
-		26, -22, 
-		28, -21, 
-		33, -26, 
-		34, -15, 
-		27, -11, 
-		47, -13, 
-		20, -7, 
-		20, -25, 
-		19, -19, 
-		17, -10, 
-		37, -22, 
-		29, -13, 
-		34, -13, 
-		34, -10, 
-		41, -17, 
-		29, -17, 
-	},
-	{
-		13, -17, 
-		38, -5, 
-		26, -21, 
-		28, -21, 
-		33, -26, 
-		34, -14, 
-		27, -10, 
-		47, -11, 
-		20, -4, 
-		20, -26, 
-		19, -17, 
-		17, -10, 
-		37, -20, 
-		29, -12, 
-		34, -10, 
-		35, -10, 
-		41, -17, 
-		30, -18, 
-	},
-	{
-		14, -17, 
-		38, -2, 
-		27, -20, 
-		28, -21, 
-		34, -26, 
-		34, -14, 
-		27, -9, 
-		48, -8, 
-		20, -1, 
-		20, -26, 
-		20, -14, 
-		17, -11, 
-		37, -18, 
-		29, -12, 
-		34, -7, 
-		35, -10, 
-		41, -17, 
-		30, -19, 
-	},
-	{
-		14, -17, 
-		38, 0, 
-		27, -19, 
-		29, -21, 
-		34, -27, 
-		34, -13, 
-		28, -8, 
-		48, -6, 
-		20, 1, 
-		21, -27, 
-		20, -12, 
-		17, -11, 
-		37, -16, 
-		29, -12, 
-		34, -4, 
-		35, -10, 
-		41, -17, 
-		30, -20, 
-	},
-	{
-		14, -17, 
-		38, 2, 
-		27, -19, 
-		29, -21, 
-		35, -27, 
-		35, -12, 
-		28, -7, 
-		48, -3, 
-		20, 4, 
-		21, -28, 
-		20, -9, 
-		17, -12, 
-		38, -14, 
-		29, -12, 
-		34, 0, 
-		35, -9, 
-		42, -18, 
-		30, -22, 
-	},
-	{
-		14, -18, 
-		38, 4, 
-		27, -18, 
-		29, -21, 
-		35, -27, 
-		35, -11, 
-		28, -6, 
-		48, -1, 
-		20, 7, 
-		21, -29, 
-		20, -6, 
-		18, -12, 
-		38, -12, 
-		29, -12, 
-		34, 3, 
-		35, -9, 
-		42, -18, 
-		31, -23, 
-	},
-	{
-		14, -18, 
-		38, 6, 
-		27, -16, 
-		29, -21, 
-		35, -27, 
-		35, -10, 
-		28, -5, 
-		48, 2, 
-		20, 9, 
-		21, -29, 
-		20, -3, 
-		18, -12, 
-		38, -9, 
-		30, -11, 
-		34, 6, 
-		35, -9, 
-		42, -18, 
-		31, -24, 
-	},
-	{
-		14, -18, 
-		38, 9, 
-		28, -15, 
-		30, -21, 
-		36, -27, 
-		35, -9, 
-		28, -4, 
-		48, 4, 
-		20, 12, 
-		22, -30, 
-		20, -1, 
-		18, -13, 
-		38, -7, 
-		30, -11, 
-		34, 9, 
-		35, -9, 
-		43, -18, 
-		31, -25, 
-	},
-	{
-		14, -18, 
-		38, 11, 
-		28, -14, 
-		30, -21, 
-		36, -27, 
-		35, -8, 
-		28, -3, 
-		48, 7, 
-		20, 14, 
-		22, -30, 
-		20, 2, 
-		18, -13, 
-		38, -4, 
-		30, -11, 
-		34, 12, 
-		35, -9, 
-		43, -18, 
-		31, -26, 
-	},
-	{
-		14, -18, 
-		38, 13, 
-		28, -13, 
-		30, -20, 
-		36, -26, 
-		35, -7, 
-		28, -2, 
-		47, 9, 
-		20, 17, 
-		22, -31, 
-		20, 5, 
-		18, -13, 
-		38, -2, 
-		30, -10, 
-		34, 15, 
-		36, -9, 
-		43, -18, 
-		32, -26, 
-	},
-	{
-		14, -18, 
-		37, 15, 
-		28, -12, 
-		30, -20, 
-		37, -26, 
-		35, -5, 
-		28, -1, 
-		47, 12, 
-		20, 19, 
-		22, -31, 
-		20, 8, 
-		18, -13, 
-		38, 1, 
-		30, -10, 
-		34, 18, 
-		36, -9, 
-		43, -18, 
-		32, -27, 
-	},
-	{
-		14, -18, 
-		37, 17, 
-		28, -10, 
-		30, -20, 
-		37, -26, 
-		35, -4, 
-		28, 0, 
-		47, 14, 
-		19, 22, 
-		23, -31, 
-		20, 10, 
-		18, -14, 
-		38, 3, 
-		30, -10, 
-		33, 21, 
-		36, -8, 
-		44, -18, 
-		32, -28, 
-	},
-	{
-		14, -17, 
-		37, 18, 
-		28, -9, 
-		31, -19, 
-		37, -25, 
-		35, -3, 
-		28, 1, 
-		47, 17, 
-		19, 24, 
-		23, -32, 
-		20, 13, 
-		18, -14, 
-		38, 6, 
-		30, -9, 
-		33, 23, 
-		36, -8, 
-		44, -18, 
-		33, -29, 
-	},
-	{
-		15, -17, 
-		37, 20, 
-		28, -7, 
-		31, -19, 
-		38, -25, 
-		35, -2, 
-		28, 2, 
-		46, 19, 
-		19, 26, 
-		23, -32, 
-		20, 16, 
-		18, -14, 
-		38, 8, 
-		30, -9, 
-		33, 26, 
-		36, -8, 
-		44, -17, 
-		33, -30, 
-	},
-	{
-		15, -17, 
-		36, 22, 
-		28, -6, 
-		31, -18, 
-		38, -24, 
-		35, -1, 
-		28, 3, 
-		46, 21, 
-		19, 28, 
-		24, -32, 
-		19, 18, 
-		18, -14, 
-		38, 11, 
-		31, -8, 
-		32, 28, 
-		36, -8, 
-		45, -17, 
-		34, -30, 
-	},
-	{
-		15, -17, 
-		36, 23, 
-		28, -5, 
-		31, -18, 
-		39, -24, 
-		35, 0, 
-		28, 4, 
-		46, 23, 
-		19, 29, 
-		24, -32, 
-		19, 21, 
-		18, -14, 
-		38, 13, 
-		31, -8, 
-		32, 31, 
-		36, -7, 
-		45, -17, 
-		34, -31, 
-	},
-	{
-		15, -16, 
-		36, 25, 
-		28, -3, 
-		32, -17, 
-		39, -23, 
-		35, 2, 
-		28, 5, 
-		45, 25, 
-		18, 31, 
-		24, -32, 
-		19, 23, 
-		19, -14, 
-		38, 15, 
-		31, -7, 
-		32, 33, 
-		36, -7, 
-		45, -17, 
-		34, -32, 
-	},
-	{
-		15, -16, 
-		35, 26, 
-		28, -2, 
-		32, -16, 
-		39, -22, 
-		35, 3, 
-		28, 6, 
-		45, 27, 
-		18, 33, 
-		24, -32, 
-		19, 25, 
-		19, -14, 
-		37, 17, 
-		31, -7, 
-		31, 35, 
-		36, -7, 
-		45, -16, 
-		35, -32, 
-	},
-	{
-		15, -16, 
-		35, 27, 
-		28, 0, 
-		32, -16, 
-		40, -21, 
-		35, 4, 
-		28, 7, 
-		44, 28, 
-		18, 34, 
-		25, -31, 
-		19, 27, 
-		19, -14, 
-		37, 20, 
-		31, -6, 
-		31, 37, 
-		37, -6, 
-		46, -16, 
-		35, -33, 
-	},
-	{
-		15, -15, 
-		35, 29, 
-		28, 1, 
-		32, -15, 
-		40, -20, 
-		35, 5, 
-		28, 8, 
-		44, 30, 
-		18, 35, 
-		25, -31, 
-		19, 29, 
-		19, -14, 
-		37, 22, 
-		31, -5, 
-		30, 38, 
-		37, -6, 
-		46, -15, 
-		36, -33, 
-	},
-	{
-		15, -15, 
-		34, 30, 
-		28, 3, 
-		32, -14, 
-		40, -19, 
-		35, 6, 
-		27, 9, 
-		43, 31, 
-		17, 36, 
-		25, -30, 
-		18, 31, 
-		19, -14, 
-		36, 24, 
-		31, -5, 
-		30, 40, 
-		37, -6, 
-		46, -15, 
-		36, -33, 
-	},
-	{
-		15, -14, 
-		34, 31, 
-		28, 4, 
-		33, -13, 
-		41, -18, 
-		35, 7, 
-		27, 10, 
-		43, 32, 
-		17, 37, 
-		26, -30, 
-		18, 32, 
-		19, -14, 
-		36, 25, 
-		31, -4, 
-		29, 41, 
-		37, -5, 
-		47, -14, 
-		37, -34, 
-	},
-	{
-		15, -13, 
-		33, 31, 
-		28, 6, 
-		33, -12, 
-		41, -17, 
-		35, 8, 
-		27, 11, 
-		42, 34, 
-		17, 38, 
-		26, -29, 
-		18, 34, 
-		19, -14, 
-		36, 27, 
-		31, -4, 
-		29, 42, 
-		37, -5, 
-		47, -13, 
-		37, -34, 
-	},
-	{
-		15, -13, 
-		33, 32, 
-		28, 7, 
-		33, -11, 
-		41, -16, 
-		35, 9, 
-		27, 12, 
-		42, 35, 
-		17, 39, 
-		26, -29, 
-		18, 35, 
-		19, -14, 
-		35, 29, 
-		31, -3, 
-		28, 43, 
-		37, -4, 
-		47, -13, 
-		38, -34, 
-	},
-	{
-		16, -12, 
-		33, 33, 
-		28, 9, 
-		33, -10, 
-		41, -14, 
-		35, 10, 
-		27, 12, 
-		41, 36, 
-		16, 39, 
-		26, -28, 
-		17, 36, 
-		19, -13, 
-		35, 30, 
-		31, -2, 
-		28, 44, 
-		37, -4, 
-		47, -12, 
-		38, -34, 
-	},
-	{
-		16, -11, 
-		32, 33, 
-		28, 10, 
-		33, -9, 
-		42, -13, 
-		35, 11, 
-		27, 13, 
-		41, 36, 
-		16, 40, 
-		27, -27, 
-		17, 38, 
-		20, -13, 
-		35, 31, 
-		31, -2, 
-		28, 44, 
-		37, -3, 
-		47, -11, 
-		39, -34, 
-	},
-	{
-		16, -11, 
-		32, 34, 
-		28, 12, 
-		33, -8, 
-		42, -12, 
-		35, 12, 
-		27, 14, 
-		40, 37, 
-		16, 40, 
-		27, -26, 
-		17, 38, 
-		20, -13, 
-		34, 33, 
-		31, -1, 
-		27, 45, 
-		37, -3, 
-		48, -11, 
-		39, -34, 
-	},
-	{
-		16, -10, 
-		31, 34, 
-		28, 13, 
-		33, -7, 
-		42, -10, 
-		34, 13, 
-		27, 14, 
-		39, 38, 
-		16, 40, 
-		27, -25, 
-		17, 39, 
-		20, -12, 
-		34, 34, 
-		31, 0, 
-		27, 45, 
-		37, -2, 
-		48, -10, 
-		40, -33, 
-	},
-	{
-		16, -9, 
-		31, 34, 
-		28, 14, 
-		33, -5, 
-		42, -9, 
-		34, 14, 
-		26, 15, 
-		39, 38, 
-		15, 40, 
-		28, -23, 
-		16, 40, 
-		20, -12, 
-		33, 35, 
-		31, 0, 
-		26, 46, 
-		37, -2, 
-		48, -9, 
-		40, -33, 
-	},
-	{
-		16, -8, 
-		31, 34, 
-		28, 15, 
-		33, -4, 
-		42, -7, 
-		34, 15, 
-		26, 16, 
-		38, 38, 
-		15, 40, 
-		28, -22, 
-		16, 40, 
-		20, -12, 
-		33, 36, 
-		31, 1, 
-		26, 46, 
-		37, -1, 
-		48, -8, 
-		41, -32, 
-	},
-	{
-		16, -7, 
-		30, 34, 
-		27, 16, 
-		33, -3, 
-		42, -6, 
-		34, 16, 
-		26, 16, 
-		38, 38, 
-		15, 40, 
-		28, -21, 
-		16, 41, 
-		20, -11, 
-		32, 36, 
-		31, 2, 
-		25, 46, 
-		37, -1, 
-		48, -7, 
-		41, -32, 
-	},
-	{
-		16, -6, 
-		30, 34, 
-		27, 17, 
-		33, -2, 
-		42, -4, 
-		34, 16, 
-		26, 17, 
-		37, 38, 
-		15, 40, 
-		28, -19, 
-		16, 41, 
-		20, -11, 
-		32, 37, 
-		31, 3, 
-		25, 45, 
-		37, 0, 
-		48, -6, 
-		42, -31, 
-	},
-	{
-		16, -5, 
-		29, 34, 
-		27, 18, 
-		34, -1, 
-		42, -2, 
-		33, 17, 
-		26, 17, 
-		37, 38, 
-		15, 40, 
-		28, -18, 
-		15, 41, 
-		20, -10, 
-		31, 37, 
-		31, 3, 
-		24, 45, 
-		37, 0, 
-		49, -5, 
-		42, -30, 
-	},
-	{
-		16, -4, 
-		29, 34, 
-		27, 19, 
-		34, 1, 
-		42, -1, 
-		33, 18, 
-		26, 17, 
-		36, 38, 
-		14, 39, 
-		29, -16, 
-		15, 41, 
-		20, -10, 
-		31, 38, 
-		31, 4, 
-		24, 45, 
-		37, 1, 
-		49, -4, 
-		43, -30, 
-	},
-	{
-		16, -3, 
-		29, 34, 
-		27, 20, 
-		33, 2, 
-		42, 1, 
-		33, 18, 
-		25, 18, 
-		36, 38, 
-		14, 39, 
-		29, -14, 
-		15, 41, 
-		20, -9, 
-		31, 38, 
-		31, 5, 
-		24, 44, 
-		37, 1, 
-		49, -3, 
-		43, -29, 
-	},
-	{
-		16, -2, 
-		28, 33, 
-		26, 21, 
-		33, 3, 
-		42, 2, 
-		33, 19, 
-		25, 18, 
-		35, 38, 
-		14, 38, 
-		29, -13, 
-		15, 41, 
-		20, -8, 
-		30, 38, 
-		31, 5, 
-		23, 44, 
-		37, 2, 
-		49, -2, 
-		44, -27, 
-	},
-	{
-		16, -1, 
-		28, 33, 
-		26, 22, 
-		33, 4, 
-		42, 4, 
-		32, 19, 
-		25, 18, 
-		35, 37, 
-		14, 38, 
-		29, -11, 
-		14, 41, 
-		20, -8, 
-		30, 38, 
-		31, 6, 
-		23, 43, 
-		37, 2, 
-		49, -1, 
-		44, -26, 
-	},
-	{
-		16, 0, 
-		28, 32, 
-		26, 23, 
-		33, 5, 
-		42, 6, 
-		32, 19, 
-		25, 18, 
-		34, 37, 
-		14, 37, 
-		29, -9, 
-		14, 40, 
-		20, -7, 
-		29, 38, 
-		31, 6, 
-		22, 42, 
-		37, 3, 
-		49, 0, 
-		45, -25, 
-	},
-	{
-		16, 1, 
-		27, 32, 
-		26, 23, 
-		33, 7, 
-		42, 7, 
-		32, 20, 
-		25, 18, 
-		34, 36, 
-		13, 36, 
-		29, -7, 
-		14, 40, 
-		21, -6, 
-		29, 38, 
-		31, 7, 
-		22, 41, 
-		37, 3, 
-		49, 1, 
-		45, -23, 
-	},
-	{
-		16, 2, 
-		27, 31, 
-		25, 24, 
-		33, 8, 
-		42, 9, 
-		32, 20, 
-		25, 18, 
-		33, 36, 
-		13, 35, 
-		29, -5, 
-		14, 39, 
-		21, -6, 
-		28, 38, 
-		31, 7, 
-		22, 41, 
-		37, 3, 
-		49, 2, 
-		45, -22, 
-	},
-	{
-		16, 3, 
-		27, 30, 
-		25, 24, 
-		33, 9, 
-		42, 10, 
-		31, 20, 
-		24, 18, 
-		33, 35, 
-		13, 34, 
-		29, -3, 
-		14, 39, 
-		21, -5, 
-		28, 37, 
-		31, 8, 
-		21, 40, 
-		37, 4, 
-		49, 3, 
-		46, -20, 
-	},
-	{
-		16, 4, 
-		26, 29, 
-		25, 24, 
-		33, 10, 
-		42, 12, 
-		31, 20, 
-		24, 18, 
-		32, 34, 
-		13, 33, 
-		29, -1, 
-		13, 38, 
-		21, -4, 
-		28, 37, 
-		31, 9, 
-		21, 39, 
-		37, 4, 
-		49, 4, 
-		46, -19, 
-	},
-	{
-		16, 5, 
-		26, 29, 
-		25, 25, 
-		33, 11, 
-		41, 13, 
-		31, 20, 
-		24, 18, 
-		32, 34, 
-		13, 32, 
-		29, 1, 
-		13, 37, 
-		21, -3, 
-		27, 36, 
-		30, 9, 
-		21, 38, 
-		37, 5, 
-		49, 5, 
-		46, -17, 
-	},
-	{
-		16, 6, 
-		26, 28, 
-		25, 25, 
-		33, 12, 
-		41, 14, 
-		31, 21, 
-		24, 18, 
-		31, 33, 
-		12, 31, 
-		29, 3, 
-		13, 36, 
-		21, -3, 
-		27, 36, 
-		30, 9, 
-		20, 36, 
-		37, 5, 
-		49, 6, 
-		47, -15, 
-	},
-	{
-		16, 7, 
-		25, 27, 
-		24, 25, 
-		33, 13, 
-		41, 16, 
-		30, 21, 
-		24, 18, 
-		31, 32, 
-		12, 30, 
-		29, 5, 
-		13, 36, 
-		21, -2, 
-		26, 35, 
-		30, 10, 
-		20, 35, 
-		37, 6, 
-		48, 7, 
-		47, -13, 
-	},
-	{
-		16, 7, 
-		25, 26, 
-		24, 25, 
-		32, 14, 
-		41, 17, 
-		30, 20, 
-		24, 18, 
-		31, 31, 
-		12, 29, 
-		29, 7, 
-		13, 35, 
-		21, -1, 
-		26, 34, 
-		30, 10, 
-		20, 34, 
-		37, 6, 
-		48, 8, 
-		47, -11, 
-	},
-	{
-		16, 8, 
-		25, 25, 
-		24, 25, 
-		32, 15, 
-		40, 18, 
-		30, 20, 
-		23, 18, 
-		30, 30, 
-		12, 28, 
-		29, 9, 
-		12, 34, 
-		21, 0, 
-		26, 34, 
-		30, 11, 
-		20, 33, 
-		37, 6, 
-		48, 8, 
-		47, -9, 
-	},
-	{
-		16, 9, 
-		25, 24, 
-		24, 25, 
-		32, 16, 
-		40, 19, 
-		30, 20, 
-		23, 17, 
-		30, 29, 
-		12, 27, 
-		29, 11, 
-		12, 33, 
-		21, 0, 
-		25, 33, 
-		30, 11, 
-		19, 32, 
-		36, 7, 
-		48, 9, 
-		47, -7, 
-	},
-	{
-		16, 10, 
-		24, 23, 
-		23, 25, 
-		32, 16, 
-		40, 20, 
-		30, 20, 
-		23, 17, 
-		30, 28, 
-		12, 26, 
-		29, 13, 
-		12, 32, 
-		21, 1, 
-		25, 32, 
-		30, 11, 
-		19, 30, 
-		36, 7, 
-		48, 10, 
-		48, -5, 
-	},
-	{
-		16, 11, 
-		24, 22, 
-		23, 25, 
-		32, 17, 
-		40, 21, 
-		29, 20, 
-		23, 17, 
-		29, 27, 
-		12, 24, 
-		29, 14, 
-		12, 30, 
-		21, 2, 
-		25, 31, 
-		30, 12, 
-		19, 29, 
-		36, 7, 
-		48, 11, 
-		48, -3, 
-	},
-	{
-		16, 12, 
-		24, 21, 
-		23, 25, 
-		31, 18, 
-		39, 22, 
-		29, 19, 
-		23, 16, 
-		29, 25, 
-		12, 23, 
-		29, 16, 
-		12, 29, 
-		21, 3, 
-		25, 30, 
-		29, 12, 
-		19, 28, 
-		36, 8, 
-		47, 12, 
-		48, 0, 
-	},
-	{
-		16, 12, 
-		24, 20, 
-		23, 25, 
-		31, 18, 
-		39, 23, 
-		29, 19, 
-		23, 16, 
-		29, 24, 
-		11, 22, 
-		28, 18, 
-		12, 28, 
-		21, 3, 
-		24, 29, 
-		29, 12, 
-		18, 26, 
-		36, 8, 
-		47, 12, 
-		48, 2, 
-	},
-	{
-		15, 13, 
-		24, 19, 
-		22, 24, 
-		31, 19, 
-		39, 24, 
-		29, 19, 
-		22, 15, 
-		28, 23, 
-		11, 21, 
-		28, 19, 
-		12, 27, 
-		21, 4, 
-		24, 28, 
-		29, 12, 
-		18, 25, 
-		36, 8, 
-		47, 13, 
-		48, 4, 
-	},
-	{
-		15, 14, 
-		23, 18, 
-		22, 24, 
-		31, 19, 
-		38, 24, 
-		28, 18, 
-		22, 15, 
-		28, 22, 
-		11, 19, 
-		28, 21, 
-		12, 26, 
-		21, 5, 
-		24, 27, 
-		29, 12, 
-		18, 23, 
-		36, 9, 
-		47, 14, 
-		48, 6, 
-	},
-	{
-		15, 14, 
-		23, 16, 
-		22, 23, 
-		30, 20, 
-		38, 25, 
-		28, 18, 
-		22, 14, 
-		28, 21, 
-		11, 18, 
-		28, 22, 
-		11, 24, 
-		21, 6, 
-		23, 26, 
-		29, 12, 
-		18, 22, 
-		36, 9, 
-		46, 14, 
-		47, 8, 
-	},
-	{
-		15, 15, 
-		23, 15, 
-		22, 23, 
-		30, 20, 
-		37, 25, 
-		28, 17, 
-		22, 14, 
-		28, 19, 
-		11, 16, 
-		28, 23, 
-		11, 23, 
-		21, 6, 
-		23, 25, 
-		29, 13, 
-		18, 20, 
-		36, 9, 
-		46, 15, 
-		47, 10, 
-	},
-	{
-		15, 15, 
-		23, 14, 
-		22, 22, 
-		30, 20, 
-		37, 26, 
-		28, 17, 
-		22, 13, 
-		28, 18, 
-		11, 15, 
-		27, 25, 
-		11, 22, 
-		20, 7, 
-		23, 24, 
-		29, 13, 
-		18, 19, 
-		35, 9, 
-		46, 15, 
-		47, 12, 
-	},
-	{
-		15, 16, 
-		23, 13, 
-		22, 22, 
-		30, 21, 
-		37, 26, 
-		28, 16, 
-		22, 13, 
-		27, 17, 
-		11, 14, 
-		27, 26, 
-		11, 20, 
-		20, 8, 
-		23, 22, 
-		28, 13, 
-		18, 17, 
-		35, 9, 
-		46, 16, 
-		47, 14, 
-	},
-	{
-		15, 16, 
-		23, 12, 
-		21, 21, 
-		30, 21, 
-		36, 26, 
-		28, 16, 
-		22, 12, 
-		27, 15, 
-		11, 12, 
-		27, 27, 
-		11, 19, 
-		20, 8, 
-		23, 21, 
-		28, 13, 
-		17, 16, 
-		35, 9, 
-		45, 16, 
-		47, 16, 
-	},
-	{
-		15, 17, 
-		23, 10, 
-		21, 21, 
-		29, 21, 
-		36, 27, 
-		27, 15, 
-		22, 12, 
-		27, 14, 
-		11, 11, 
-		26, 28, 
-		11, 18, 
-		20, 9, 
-		22, 20, 
-		28, 13, 
-		17, 14, 
-		35, 9, 
-		45, 17, 
-		46, 18, 
-	},
-	{
-		15, 17, 
-		23, 9, 
-		21, 20, 
-		29, 21, 
-		36, 27, 
-		27, 15, 
-		22, 11, 
-		27, 13, 
-		11, 9, 
-		26, 29, 
-		11, 16, 
-		20, 10, 
-		22, 19, 
-		28, 13, 
-		17, 13, 
-		35, 9, 
-		45, 17, 
-		46, 20, 
-	},
-	{
-		15, 17, 
-		23, 8, 
-		21, 19, 
-		29, 21, 
-		35, 27, 
-		27, 14, 
-		21, 10, 
-		27, 11, 
-		11, 8, 
-		26, 29, 
-		11, 15, 
-		20, 10, 
-		22, 17, 
-		28, 12, 
-		17, 11, 
-		35, 10, 
-		44, 17, 
-		46, 21, 
-	},
-	{
-		15, 17, 
-		23, 6, 
-		21, 19, 
-		29, 21, 
-		35, 27, 
-		27, 13, 
-		21, 10, 
-		27, 10, 
-		11, 7, 
-		26, 30, 
-		11, 13, 
-		20, 11, 
-		22, 16, 
-		28, 12, 
-		17, 10, 
-		35, 10, 
-		44, 18, 
-		45, 23, 
-	},
-	{
-		14, 18, 
-		22, 5, 
-		21, 18, 
-		28, 21, 
-		35, 27, 
-		27, 13, 
-		21, 9, 
-		27, 9, 
-		11, 5, 
-		25, 30, 
-		11, 12, 
-		20, 11, 
-		22, 15, 
-		28, 12, 
-		17, 8, 
-		35, 10, 
-		44, 18, 
-		45, 24, 
-	},
-	{
-		14, 18, 
-		22, 4, 
-		20, 17, 
-		28, 21, 
-		34, 27, 
-		27, 12, 
-		21, 8, 
-		26, 7, 
-		11, 4, 
-		25, 31, 
-		11, 11, 
-		20, 12, 
-		22, 13, 
-		28, 12, 
-		17, 7, 
-		34, 10, 
-		44, 18, 
-		44, 26, 
-	},
-	{
-		14, 18, 
-		22, 3, 
-		20, 16, 
-		28, 21, 
-		34, 26, 
-		27, 11, 
-		21, 7, 
-		26, 6, 
-		11, 2, 
-		25, 31, 
-		11, 9, 
-		20, 12, 
-		22, 12, 
-		27, 12, 
-		17, 5, 
-		34, 9, 
-		43, 18, 
-		44, 27, 
-	},
-	{
-		14, 18, 
-		22, 1, 
-		20, 15, 
-		28, 21, 
-		33, 26, 
-		26, 10, 
-		21, 7, 
-		26, 5, 
-		11, 1, 
-		24, 32, 
-		11, 8, 
-		20, 12, 
-		22, 11, 
-		27, 12, 
-		17, 3, 
-		34, 9, 
-		43, 18, 
-		43, 28, 
-	},
-	{
-		14, 18, 
-		22, 0, 
-		20, 15, 
-		27, 20, 
-		33, 26, 
-		26, 10, 
-		21, 6, 
-		26, 3, 
-		11, -1, 
-		24, 32, 
-		11, 6, 
-		20, 13, 
-		21, 9, 
-		27, 11, 
-		17, 2, 
-		34, 9, 
-		43, 18, 
-		43, 29, 
-	},
-	{
-		14, 18, 
-		22, -1, 
-		20, 14, 
-		27, 20, 
-		33, 25, 
-		26, 9, 
-		21, 5, 
-		26, 2, 
-		11, -2, 
-		24, 32, 
-		11, 5, 
-		20, 13, 
-		21, 8, 
-		27, 11, 
-		17, 0, 
-		34, 9, 
-		42, 18, 
-		42, 30, 
-	},
-	{
-		14, 18, 
-		22, -3, 
-		20, 13, 
-		27, 20, 
-		33, 25, 
-		26, 8, 
-		21, 5, 
-		26, 0, 
-		11, -4, 
-		24, 32, 
-		11, 3, 
-		19, 13, 
-		21, 7, 
-		27, 11, 
-		17, -1, 
-		34, 9, 
-		42, 18, 
-		42, 31, 
-	},
-	{
-		14, 18, 
-		22, -4, 
-		20, 12, 
-		27, 19, 
-		32, 24, 
-		26, 7, 
-		21, 4, 
-		26, -1, 
-		11, -5, 
-		23, 32, 
-		10, 2, 
-		19, 14, 
-		21, 5, 
-		27, 10, 
-		17, -3, 
-		34, 9, 
-		42, 18, 
-		41, 32, 
-	},
-	{
-		14, 17, 
-		22, -5, 
-		20, 11, 
-		27, 19, 
-		32, 24, 
-		26, 6, 
-		21, 3, 
-		26, -2, 
-		11, -6, 
-		23, 32, 
-		10, 0, 
-		19, 14, 
-		21, 4, 
-		27, 10, 
-		17, -4, 
-		34, 9, 
-		42, 17, 
-		41, 32, 
-	},
-	{
-		14, 17, 
-		23, -6, 
-		20, 10, 
-		26, 18, 
-		32, 23, 
-		26, 6, 
-		21, 2, 
-		26, -4, 
-		11, -8, 
-		23, 31, 
-		10, -1, 
-		19, 14, 
-		21, 2, 
-		27, 10, 
-		17, -6, 
-		33, 9, 
-		41, 17, 
-		40, 33, 
-	},
-	{
-		14, 17, 
-		23, -8, 
-		19, 9, 
-		26, 18, 
-		31, 23, 
-		26, 5, 
-		21, 1, 
-		26, -5, 
-		11, -9, 
-		22, 31, 
-		11, -3, 
-		19, 14, 
-		21, 1, 
-		27, 9, 
-		17, -8, 
-		33, 8, 
-		41, 17, 
-		40, 33, 
-	},
-	{
-		13, 17, 
-		23, -9, 
-		19, 8, 
-		26, 17, 
-		31, 22, 
-		26, 4, 
-		21, 1, 
-		26, -7, 
-		11, -11, 
-		22, 31, 
-		11, -4, 
-		19, 14, 
-		21, 0, 
-		26, 9, 
-		17, -9, 
-		33, 8, 
-		41, 17, 
-		39, 33, 
-	},
-	{
-		13, 16, 
-		23, -10, 
-		19, 7, 
-		26, 17, 
-		31, 21, 
-		26, 3, 
-		21, 0, 
-		27, -8, 
-		11, -12, 
-		22, 30, 
-		11, -6, 
-		19, 14, 
-		21, -2, 
-		26, 8, 
-		17, -11, 
-		33, 8, 
-		40, 16, 
-		39, 34, 
-	},
-	{
-		13, 16, 
-		23, -11, 
-		19, 6, 
-		26, 16, 
-		31, 21, 
-		26, 2, 
-		21, -1, 
-		27, -9, 
-		11, -14, 
-		22, 30, 
-		11, -7, 
-		19, 14, 
-		21, -3, 
-		26, 8, 
-		17, -12, 
-		33, 8, 
-		40, 16, 
-		38, 34, 
-	},
-	{
-		13, 16, 
-		23, -13, 
-		19, 5, 
-		26, 16, 
-		30, 20, 
-		26, 1, 
-		21, -2, 
-		27, -11, 
-		11, -15, 
-		21, 29, 
-		11, -9, 
-		19, 14, 
-		21, -5, 
-		26, 8, 
-		17, -14, 
-		33, 7, 
-		40, 16, 
-		38, 34, 
-	},
-	{
-		13, 15, 
-		23, -14, 
-		19, 4, 
-		25, 15, 
-		30, 19, 
-		26, 1, 
-		21, -2, 
-		27, -12, 
-		11, -16, 
-		21, 29, 
-		11, -10, 
-		18, 14, 
-		21, -6, 
-		26, 7, 
-		17, -15, 
-		33, 7, 
-		40, 15, 
-		37, 34, 
-	},
-	{
-		13, 15, 
-		23, -15, 
-		19, 3, 
-		25, 14, 
-		30, 18, 
-		26, 0, 
-		21, -3, 
-		27, -14, 
-		11, -18, 
-		21, 28, 
-		11, -11, 
-		18, 14, 
-		21, -7, 
-		26, 7, 
-		18, -17, 
-		33, 7, 
-		39, 15, 
-		37, 34, 
-	},
-	{
-		13, 14, 
-		23, -16, 
-		19, 2, 
-		25, 14, 
-		30, 17, 
-		26, -1, 
-		21, -4, 
-		27, -15, 
-		11, -19, 
-		21, 27, 
-		11, -13, 
-		18, 14, 
-		21, -9, 
-		26, 6, 
-		18, -18, 
-		33, 6, 
-		39, 14, 
-		36, 33, 
-	},
-	{
-		13, 14, 
-		23, -17, 
-		19, 1, 
-		25, 13, 
-		29, 17, 
-		26, -2, 
-		21, -5, 
-		27, -16, 
-		11, -20, 
-		20, 26, 
-		11, -14, 
-		18, 14, 
-		22, -10, 
-		26, 6, 
-		18, -20, 
-		33, 6, 
-		39, 14, 
-		36, 33, 
-	},
-	{
-		13, 13, 
-		24, -19, 
-		19, 0, 
-		25, 12, 
-		29, 16, 
-		26, -3, 
-		21, -6, 
-		27, -17, 
-		11, -22, 
-		20, 26, 
-		11, -16, 
-		18, 14, 
-		22, -11, 
-		26, 5, 
-		18, -21, 
-		33, 6, 
-		39, 13, 
-		35, 33, 
+		16, 12, 
+		24, 20, 
+		23, 25, 
+		31, 18, 
+		39, 23, 
+		29, 19, 
+		23, 16, 
+		29, 24, 
+		11, 22, 
+		28, 18, 
+		12, 28, 
+		21, 3, 
+		24, 29, 
+		29, 12, 
+		18, 26, 
+		36, 8, 
+		47, 12, 
+		48, 2, 
 	},
 };
-const uint16_t edges2[] = { 
+const uint8_t deltas2[][18] = { 
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x1e, 0x1f, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0xff, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xff, 0x0, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xe, 0xf, 0xe, 0x0, 0xf, 0xf, 0xe, 0x0, 0x0, 0xff, },
+	{ 0xf, 0xf, 0xf, 0xff, 0xf, 0xf, 0x0, 0xe, 0xf, 0xf, 0xf, 0x0, 0xe, 0x0, 0x1f, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xff, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xff, },
+	{ 0xf0, 0xf, 0xf, 0xf, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xe, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf0, 0x1e, 0xf, 0xf, 0x0, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0x0, 0x1f, 0x0, 0xf, 0xff, },
+	{ 0x0, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1f, 0x1f, 0xf, 0xe, 0x0, 0xf, 0xf, 0xe, 0xf, 0xf0, 0xf, },
+	{ 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, },
+	{ 0xf, 0x0, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xff, },
+	{ 0xf, 0x1f, 0xf, 0xf, 0xf, 0x0, 0xf, 0x1f, 0xf, 0xff, 0xf, 0x0, 0x1f, 0xf, 0x1f, 0x0, 0xf, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, 0xf, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xe, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xff, },
+	{ 0xf, 0x10, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0x1f, 0xf, 0x1f, 0xf, 0xf, 0x0, 0x1f, 0x0, 0xf, 0xf, },
+	{ 0x0, 0xf, 0x0, 0xf, 0xe, 0xf, 0x1f, 0xf, 0x0, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0x10, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, },
+	{ 0xf, 0x10, 0xf, 0xf, 0xf, 0x10, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0x1f, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0x1f, 0xf, 0xf, 0xf, 0xf, 0x1f, 0x1f, 0xe, 0xf, 0x0, 0x1f, 0x0, 0xf, 0x0, 0xf, 0xfe, },
+	{ 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, },
+	{ 0x0, 0x10, 0x0, 0xf, 0xf, 0xf, 0x0, 0x1f, 0x0, 0xf, 0x1f, 0x0, 0xf, 0x0, 0x1f, 0x0, 0x0, 0xf, },
+	{ 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0x10, 0xf, 0x0, 0x0, 0xf, 0xf, },
+	{ 0xf, 0x10, 0xf, 0xf, 0xf, 0x1f, 0x10, 0x10, 0x0, 0xf, 0x0, 0xf, 0xf, 0x0, 0x10, 0xf, 0xf, 0xf, },
+	{ 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0x10, 0xe, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xe, },
+	{ 0x0, 0x0, 0x1f, 0xf, 0xf, 0x0, 0x0, 0x10, 0x0, 0xf, 0x10, 0xf, 0x10, 0x0, 0x10, 0xf, 0x0, 0xf, },
+	{ 0xf, 0x10, 0x0, 0x1f, 0x1f, 0xf, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0xf, 0xff, },
+	{ 0xf, 0x1, 0xf, 0xf, 0xf, 0x0, 0x0, 0x10, 0x1, 0xf, 0x0, 0xf, 0x1f, 0x0, 0x1, 0x0, 0xf, 0xf, },
+	{ 0x0, 0x10, 0x0, 0x0, 0xf, 0x10, 0x0, 0x10, 0x10, 0xf, 0x0, 0xf, 0x0, 0x10, 0x10, 0x1f, 0xf, 0xe, },
+	{ 0xf, 0x1, 0xf, 0xf, 0xf, 0x0, 0x10, 0x0, 0x1, 0xe, 0x10, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, },
+	{ 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x11, 0x1, 0xf, 0x0, 0xf, 0x10, 0x0, 0x11, 0x0, 0xf, 0xf, },
+	{ 0xf, 0x11, 0x1f, 0xf, 0xf, 0xf, 0x0, 0x0, 0x1, 0xf, 0x0, 0xf, 0x0, 0xf, 0x1, 0xf, 0x1f, 0xf, },
+	{ 0x0, 0x1, 0x0, 0x0, 0xf, 0x10, 0x0, 0x11, 0x11, 0xf, 0x1, 0x0, 0x10, 0x0, 0x11, 0x0, 0x0, 0xe, },
+	{ 0xf, 0x11, 0x0, 0xf, 0x1f, 0x0, 0x0, 0x1, 0x1, 0xf, 0x10, 0xf, 0x1, 0x0, 0x1, 0x0, 0xf, 0xf, },
+	{ 0x1f, 0x1, 0x0, 0x1f, 0x0, 0x1, 0x1, 0x11, 0x1, 0xe, 0x1, 0x0, 0x10, 0x0, 0x11, 0xf, 0xf, 0xf, },
+	{ 0x0, 0x2, 0x10, 0x0, 0xf, 0x0, 0x10, 0x11, 0x2, 0xf, 0x1, 0xf, 0x0, 0xf, 0x1, 0x0, 0x0, 0xe, },
+	{ 0xf, 0x11, 0x0, 0xf, 0xf, 0x10, 0x0, 0x1, 0x11, 0x1f, 0x1, 0xf, 0x11, 0x0, 0x12, 0x0, 0xf, 0xf, },
+	{ 0x0, 0x1, 0x0, 0x0, 0x1f, 0x0, 0x1, 0x12, 0x2, 0xf, 0x11, 0x0, 0x1, 0x10, 0x2, 0x0, 0x10, 0xf, },
+	{ 0xf, 0x2, 0x0, 0xf, 0x0, 0x0, 0x0, 0x1, 0x2, 0xf, 0x2, 0xf, 0x11, 0x0, 0x2, 0xf, 0xf, 0xf, },
+	{ 0x0, 0x12, 0x10, 0x0, 0xf, 0x1, 0x1, 0x12, 0x2, 0xf, 0x1, 0x0, 0x1, 0x0, 0x12, 0x10, 0xf, 0xe, },
+	{ 0xf, 0x1, 0x0, 0x1f, 0xf, 0x10, 0x0, 0x1, 0x2, 0xf, 0x2, 0xf, 0x1, 0x0, 0x2, 0x0, 0x0, 0x1f, },
+	{ 0x0, 0x2, 0x1, 0x0, 0x10, 0x1, 0x11, 0x2, 0x13, 0xf, 0x1, 0x0, 0x11, 0xf, 0x12, 0x0, 0xf, 0xf, },
+	{ 0xf, 0x2, 0x0, 0xf, 0xf, 0x0, 0x0, 0x12, 0x2, 0xf, 0x12, 0xf, 0x2, 0x0, 0x3, 0x0, 0x10, 0xf, },
+	{ 0x0, 0x12, 0x0, 0x0, 0xf, 0x1, 0x1, 0x2, 0x2, 0x1f, 0x2, 0xf, 0x11, 0x0, 0x2, 0x0, 0x0, 0xe, },
+	{ 0xf, 0x2, 0x11, 0x0, 0x10, 0x0, 0x1, 0x12, 0x3, 0xf, 0x2, 0x0, 0x2, 0x10, 0x3, 0x0, 0xf, 0xf, },
+	{ 0x0, 0x2, 0x0, 0x1f, 0x0, 0x11, 0x1, 0x3, 0x2, 0xf, 0x3, 0xf, 0x2, 0x0, 0x13, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x2, 0x1, 0x0, 0xf, 0x1, 0x0, 0x2, 0x3, 0xf, 0x2, 0x0, 0x12, 0x0, 0x3, 0xf, 0x1f, 0xf, },
+	{ 0xf, 0x2, 0x1, 0x0, 0x0, 0x1, 0x1, 0x2, 0x3, 0xf, 0x2, 0x0, 0x2, 0x1, 0x3, 0x10, 0x0, 0x1f, },
+	{ 0x10, 0x3, 0x11, 0x0, 0x10, 0x0, 0x1, 0x13, 0x3, 0x0, 0x13, 0xf, 0x2, 0x0, 0x3, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x2, 0x1, 0x10, 0xf, 0x1, 0x11, 0x2, 0x2, 0x1f, 0x2, 0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x2, 0x0, 0x0, 0x10, 0x11, 0x1, 0x3, 0x3, 0xf, 0x3, 0xf, 0x12, 0x0, 0x4, 0x1, 0x1f, 0xe, },
+	{ 0xf, 0x2, 0x1, 0x0, 0x0, 0x1, 0x1, 0x2, 0x3, 0xf, 0x3, 0x10, 0x2, 0x0, 0x3, 0x0, 0x0, 0x1f, },
+	{ 0x0, 0x2, 0x2, 0x0, 0x0, 0x1, 0x1, 0x3, 0x2, 0x0, 0x3, 0x0, 0x3, 0x11, 0x3, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x3, 0x11, 0x10, 0x10, 0x1, 0x1, 0x2, 0x3, 0x1f, 0x2, 0xf, 0x2, 0x0, 0x3, 0x0, 0x10, 0xf, },
+	{ 0x0, 0x2, 0x1, 0x0, 0x0, 0x1, 0x1, 0x3, 0x2, 0x0, 0x3, 0x0, 0x3, 0x0, 0x3, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1, 0xf2, 0x3, 0xf, 0x3, 0x0, 0x2, 0x1, 0x3, 0x10, 0x0, 0x10, },
+	{ 0x0, 0xf2, 0x1, 0x0, 0x10, 0x2, 0x1, 0x3, 0x2, 0x0, 0x3, 0x0, 0x3, 0x0, 0x3, 0x0, 0x0, 0xf, },
+	{ 0x0, 0x2, 0x2, 0x0, 0x0, 0x1, 0x1, 0x2, 0xf3, 0x10, 0x2, 0xf, 0x2, 0x0, 0xf3, 0x1, 0x10, 0xf, },
+	{ 0x1, 0x1, 0x1, 0x11, 0x1, 0x1, 0x1, 0x3, 0x2, 0xf, 0x3, 0x0, 0x3, 0x1, 0x2, 0x0, 0x0, 0x1f, },
+	{ 0x10, 0x2, 0x2, 0x0, 0x10, 0x1, 0x1, 0xf2, 0x2, 0x0, 0x3, 0x0, 0x2, 0x0, 0x3, 0x0, 0x1, 0xf, },
+	{ 0x0, 0xf2, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x10, 0xf2, 0x0, 0x3, 0x11, 0xf2, 0x0, 0x10, 0x10, },
+	{ 0x0, 0x1, 0x1, 0x0, 0x10, 0x1, 0x1, 0x2, 0x1, 0x0, 0x3, 0x0, 0x2, 0x0, 0x3, 0x1, 0x0, 0xf, },
+	{ 0x1, 0x2, 0x2, 0x11, 0x1, 0x2, 0x1, 0xf2, 0xf2, 0x0, 0x2, 0x10, 0x2, 0x1, 0x2, 0x0, 0x0, 0xf, },
+	{ 0x0, 0xf1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x0, 0x2, 0x0, 0xf2, 0x0, 0xf2, 0x0, 0x1, 0x10, },
+	{ 0x0, 0x1, 0x2, 0x0, 0x11, 0x1, 0x1, 0xf1, 0x1, 0x11, 0x2, 0x0, 0x3, 0x1, 0x2, 0x11, 0x10, 0xf, },
+	{ 0x1, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x1, 0x0, 0x2, 0x0, 0x2, 0x1, 0xf1, 0x0, 0x1, 0x10, },
+	{ 0x0, 0xf1, 0x2, 0x1, 0x1, 0x1, 0xf1, 0xf1, 0xf1, 0x1, 0xf2, 0x0, 0xf2, 0x0, 0x2, 0x0, 0x0, 0x0, },
+	{ 0x1, 0x1, 0x1, 0x11, 0x11, 0x1, 0x1, 0x1, 0x1, 0x10, 0x1, 0x0, 0x1, 0x1, 0xf1, 0x1, 0x11, 0x1f, },
+	{ 0x1, 0xf0, 0x2, 0x1, 0x1, 0x1, 0x1, 0xf2, 0x1, 0x1, 0x2, 0x0, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, },
+	{ 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0xf2, 0x1, 0xf1, 0x1, 0x0, 0x10, },
+	{ 0x11, 0x1, 0x2, 0x1, 0x2, 0x1, 0x0, 0xf1, 0xf0, 0x1, 0xf1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, },
+	{ 0x1, 0xf0, 0x1, 0x1, 0x11, 0x1, 0x1, 0x0, 0x1, 0x11, 0x2, 0x10, 0x1, 0x0, 0x0, 0x1, 0x1, 0x10, },
+	{ 0x0, 0x1, 0x2, 0x1, 0x1, 0x1, 0x1, 0xf1, 0x0, 0x1, 0x0, 0x0, 0xf2, 0x1, 0xf1, 0x0, 0x10, 0x0, },
+	{ 0x1, 0xf0, 0x1, 0x1, 0x2, 0xf1, 0x0, 0xf1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x11, },
+	{ 0x1, 0x0, 0x1, 0x2, 0x1, 0x1, 0xf1, 0x0, 0xf0, 0x12, 0xf1, 0x0, 0xf1, 0x0, 0xf1, 0x0, 0x1, 0x0, },
+	{ 0x1, 0x0, 0x1, 0x1, 0x2, 0x1, 0x1, 0xf0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x11, },
+	{ 0x1, 0xf0, 0xf1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0xf0, 0x1, 0xf0, 0x0, 0x1, 0x0, },
+	{ 0x1, 0x0, 0x1, 0x1, 0x2, 0x0, 0x1, 0xf0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x1, 0xf, 0x1, 0x1, 0x11, },
+	{ 0x1, 0xf0, 0x1, 0x11, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x1, 0xf0, 0x0, 0xf0, 0x0, 0x11, 0x1, },
+	{ 0x1, 0x0, 0x1, 0x2, 0x1, 0x1, 0x0, 0xf0, 0xff, 0x12, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x10, },
+	{ 0x1, 0x0, 0x1, 0xf1, 0x2, 0x0, 0xf1, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x1, 0xf, 0x0, 0x1, 0x1, },
+	{ 0x1, 0xff, 0xf1, 0x1, 0x1, 0x1, 0x0, 0xf0, 0xf, 0x1, 0x0, 0x1, 0xf0, 0x0, 0xf0, 0x1, 0x1, 0x12, },
+	{ 0x1, 0x0, 0x1, 0x1, 0x2, 0xf0, 0x0, 0xf, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x1, 0xf, 0x0, 0x1, 0x1, },
+	{ 0x1, 0xf, 0x1, 0x1, 0x2, 0x0, 0x0, 0xf0, 0xf, 0x2, 0xf, 0x1, 0xf0, 0x0, 0xff, 0x1, 0x1, 0x11, },
+	{ 0x1, 0xf0, 0x0, 0x2, 0x1, 0x1, 0x0, 0xf, 0xff, 0x2, 0x0, 0x11, 0x0, 0x1, 0xf, 0x0, 0x1, 0x2, },
+	{ 0x1, 0xf, 0xf1, 0x1, 0x2, 0x0, 0x0, 0xf0, 0xf, 0x2, 0xf, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x1, 0x1, },
+	{ 0x1, 0xf, 0x0, 0x1, 0x1, 0xf0, 0xf0, 0xf, 0xf, 0x2, 0x0, 0x1, 0xf, 0x1, 0xff, 0x1, 0x1, 0x12, },
+	{ 0x1, 0xff, 0x0, 0x1, 0x2, 0x0, 0x0, 0xff, 0xf, 0x2, 0xff, 0x1, 0x0, 0x1, 0xf, 0x0, 0x1, 0x1, },
+	{ 0x1, 0x0, 0x1, 0x1, 0xf1, 0x0, 0x0, 0x0, 0xf, 0x2, 0xf, 0x1, 0xff, 0xf0, 0xf, 0x1, 0x1, 0x2, },
+	{ 0x1, 0xf, 0x0, 0x1, 0x1, 0x1, 0x0, 0xff, 0xff, 0x2, 0xf, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x1, 0x12, },
+	{ 0x1, 0xff, 0xf0, 0x1, 0x2, 0xf0, 0x0, 0xf, 0xf, 0x2, 0x0, 0x1, 0xff, 0x1, 0xf, 0x1, 0xf1, 0x2, },
+	{ 0x0, 0xf, 0x0, 0xf1, 0x1, 0xf, 0x0, 0xf, 0xf, 0x2, 0xf, 0x1, 0xf, 0x0, 0xf, 0x0, 0x1, 0x2, },
+	{ 0x1, 0xf, 0x0, 0x1, 0xf1, 0x0, 0xf0, 0xff, 0xf, 0x2, 0xff, 0x1, 0x0, 0x1, 0xf, 0x0, 0x0, 0x2, },
+	{ 0x1, 0xf, 0x0, 0x1, 0x1, 0x0, 0xf, 0xf, 0xf, 0x2, 0xf, 0x0, 0xff, 0x0, 0xff, 0xf1, 0x1, 0x2, },
+	{ 0x1, 0xff, 0xf0, 0x0, 0x1, 0x0, 0x0, 0xf, 0xf, 0x2, 0xf, 0x1, 0xf, 0x0, 0xe, 0x0, 0x1, 0x12, },
+	{ 0x1, 0xf, 0x0, 0x1, 0x1, 0xf0, 0x0, 0xff, 0xe, 0x1, 0xe, 0x1, 0xf, 0x1, 0xf, 0x0, 0x1, 0x2, },
+	{ 0x1, 0xf, 0x0, 0xf1, 0xf1, 0xf, 0xf, 0xe, 0xf, 0x2, 0xf, 0x1, 0xf, 0xf0, 0xf, 0x1, 0xf1, 0x3, },
+	{ 0x0, 0xf, 0x0, 0x0, 0x1, 0x0, 0x0, 0xf, 0xff, 0xf2, 0xf, 0x0, 0xff, 0x0, 0xfe, 0x0, 0x0, 0x2, },
+	{ 0xf1, 0xf, 0xff, 0x1, 0x1, 0x0, 0xff, 0xff, 0xf, 0x1, 0xf, 0x1, 0xf, 0x0, 0xf, 0x0, 0x1, 0x2, },
+	{ 0x1, 0xff, 0x0, 0x0, 0xf0, 0xff, 0x0, 0xf, 0xe, 0x2, 0xf, 0x1, 0xf, 0x0, 0xe, 0x1, 0x1, 0x2, },
+	{ 0x0, 0xe, 0xf, 0xf1, 0x1, 0x0, 0xf, 0xf, 0xf, 0x1, 0xfe, 0x1, 0xff, 0x0, 0xf, 0x0, 0xf0, 0xf2, },
+	{ 0x1, 0xf, 0x0, 0x0, 0xf0, 0xf, 0x0, 0xe, 0xe, 0x1, 0xf, 0x0, 0xf, 0x1, 0xe, 0x0, 0x1, 0x2, },
+	{ 0x0, 0xf, 0xf, 0x0, 0x1, 0x0, 0xf, 0xf, 0xf, 0xf2, 0xf, 0xf1, 0xf, 0x0, 0xf, 0xf0, 0x0, 0x2, },
+	{ 0x1, 0xf, 0x0, 0x1, 0x0, 0xf, 0x0, 0xff, 0xf, 0x1, 0xe, 0x1, 0xe, 0xf0, 0xe, 0x0, 0x1, 0x2, },
+	{ 0x0, 0xf, 0xff, 0x0, 0xf0, 0x0, 0xf, 0xe, 0xe, 0x1, 0xf, 0x0, 0xf, 0x0, 0xff, 0x0, 0xf0, 0x2, },
+	{ 0x1, 0xe, 0x0, 0xf0, 0x1, 0xff, 0x0, 0xf, 0xf, 0xf1, 0xf, 0x1, 0xff, 0x0, 0xe, 0x0, 0x1, 0xf2, },
+	{ 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0xf, 0xf, 0xe, 0x1, 0xe, 0x1, 0xf, 0x0, 0xf, 0x0, 0x0, 0x2, },
+	{ 0x0, 0xf, 0xf, 0x0, 0xf0, 0xf, 0xff, 0xe, 0xf, 0x0, 0xf, 0x0, 0xe, 0xf, 0xe, 0x1, 0xf0, 0x1, },
+	{ 0x0, 0xe, 0x0, 0x0, 0x0, 0xf, 0x0, 0xf, 0xf, 0x1, 0xe, 0x1, 0xf, 0x0, 0xf, 0x0, 0x1, 0xf2, },
+	{ 0xf1, 0xff, 0xf, 0xf0, 0x0, 0x0, 0xf, 0xf, 0xe, 0xf0, 0xf, 0x0, 0xf, 0x0, 0xe, 0x0, 0x0, 0x1, },
+	{ 0x0, 0xf, 0xff, 0x0, 0xf0, 0xf, 0xf, 0xfe, 0xf, 0x1, 0xf, 0x1, 0xe, 0x0, 0xf, 0xf0, 0x0, 0xf2, },
+	{ 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0x0, 0xf, 0xf0, 0xe, 0xf, 0xf0, 0x1, },
+	{ 0x0, 0xe, 0xf, 0x0, 0xf0, 0xff, 0x0, 0xf, 0xf, 0xf1, 0xf, 0x0, 0xf, 0x0, 0xe, 0x0, 0x0, 0xf1, },
+	{ 0x0, 0xf, 0x0, 0xff, 0x0, 0x0, 0xf, 0xe, 0xe, 0x0, 0xe, 0x1, 0xfe, 0xf, 0xf, 0x0, 0x0, 0x1, },
+	{ 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xe, 0x0, 0xf0, 0xf1, },
+	{ 0x0, 0xe, 0xf, 0x0, 0x0, 0xf, 0x0, 0xe, 0xe, 0x0, 0xe, 0xf0, 0xf, 0x0, 0xf, 0x0, 0x0, 0x1, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf0, 0xff, 0x1, 0xe, 0xf, 0xe, 0x0, 0x0, 0xf1, },
+	{ 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0xe, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, },
+	{ 0x0, 0x1f, 0xf, 0xff, 0xf, 0x0, 0xf, 0xe, 0xe, 0xf, 0xf, 0x0, 0xe, 0x0, 0xe, 0xf0, 0xf0, 0xf1, },
+	{ 0x0, 0xe, 0xff, 0x0, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf0, 0x1e, 0x0, 0xf, 0xf, 0xe, 0xf, 0x0, 0x0, },
+	{ 0xf0, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xe, 0xe, 0x0, 0xf, 0x0, 0xf, 0xf0, 0xf, 0x0, 0x0, 0xf0, },
+	{ 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0x1f, 0xf, 0xf, 0xe, 0x0, 0xe, 0xf, 0xe, 0x0, 0xff, 0x1, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf0, },
+	{ 0x0, 0xe, 0xf, 0x0, 0xff, 0xf, 0xf, 0xe, 0xf, 0xff, 0xe, 0x0, 0xe, 0x0, 0xe, 0xf, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0xff, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf0, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xf, 0xf, 0x0, 0xf, 0x0, 0x1e, 0x0, 0xf0, 0x0, },
+	{ 0xf, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0xf, 0xf, 0xf, 0xf, 0xff, },
+	{ 0x0, 0xf, 0xf, 0xf, 0xf0, 0xf, 0xf, 0xf, 0xf, 0xff, 0xf, 0x0, 0x1f, 0x0, 0xe, 0x0, 0x0, 0x0, },
+	{ 0xf, 0x1e, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xe, 0x0, 0xe, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0xf0, },
+};
+const uint8_t path2[] = { 
+	0xd, 
+	0x1a, 
 	0x6, 
-	0x10, 
 	0x12, 
+	0x0, 
 	0x14, 
-	0x16, 
+	0x1c, 
+	0x10, 
+	0x14, 
+	0x4, 
+	0xb, 
+	0x1e, 
 	0x1a, 
-	0x20c, 
-	0x20e, 
-	0x218, 
-	0x406, 
-	0x40a, 
-	0x40c, 
-	0x414, 
-	0x418, 
-	0x608, 
-	0x60a, 
-	0x612, 
-	0x61a, 
-	0x620, 
-	0x622, 
-	0x80a, 
-	0xa0c, 
-	0xa0e, 
-	0xa1a, 
-	0xa1e, 
-	0xc10, 
-	0xc1a, 
-	0xe18, 
-	0x1014, 
-	0x101c, 
-	0x141c, 
-	0x161a, 
-	0x1a1e, 
-	0x1a20, 
-	0x1a22, 
-};
-
-const int8_t vertices3[][26] = { 
-	{
-		-37, 16, 
-		-25, -9, 
-		-28, -3, 
-		-33, -25, 
-		11, 27, 
-		-38, -2, 
-		-14, 7, 
-		13, 13, 
-		-24, -8, 
-		13, 0, 
-		5, 12, 
-		15, 36, 
-		13, -2, 
-	},
-	{
-		-37, 16, 
-		-25, -10, 
-		-28, -5, 
-		-34, -26, 
-		11, 28, 
-		-38, -2, 
-		-14, 6, 
-		13, 13, 
-		-24, -8, 
-		13, -1, 
-		5, 11, 
-		15, 35, 
-		13, -2, 
-	},
-	{
-		-37, 15, 
-		-25, -11, 
-		-28, -6, 
-		-34, -26, 
-		11, 28, 
-		-38, -3, 
-		-14, 5, 
-		13, 12, 
-		-24, -9, 
-		13, -2, 
-		5, 11, 
-		15, 35, 
-		13, -3, 
-	},
-	{
-		-37, 14, 
-		-25, -12, 
-		-28, -8, 
-		-34, -27, 
-		11, 28, 
-		-38, -3, 
-		-14, 4, 
-		13, 11, 
-		-24, -9, 
-		13, -3, 
-		5, 10, 
-		15, 35, 
-		13, -4, 
-	},
-	{
-		-36, 13, 
-		-25, -13, 
-		-28, -9, 
-		-35, -28, 
-		10, 29, 
-		-38, -3, 
-		-14, 3, 
-		13, 11, 
-		-24, -10, 
-		13, -3, 
-		5, 10, 
-		14, 34, 
-		13, -5, 
-	},
-	{
-		-36, 12, 
-		-25, -14, 
-		-28, -11, 
-		-35, -29, 
-		10, 29, 
-		-38, -4, 
-		-14, 2, 
-		13, 10, 
-		-24, -10, 
-		13, -4, 
-		5, 10, 
-		14, 34, 
-		13, -5, 
-	},
-	{
-		-36, 12, 
-		-26, -15, 
-		-28, -13, 
-		-36, -29, 
-		10, 29, 
-		-38, -4, 
-		-14, 2, 
-		13, 10, 
-		-25, -11, 
-		13, -5, 
-		5, 9, 
-		14, 33, 
-		13, -6, 
-	},
-	{
-		-36, 11, 
-		-26, -16, 
-		-28, -14, 
-		-36, -30, 
-		10, 29, 
-		-38, -4, 
-		-14, 1, 
-		13, 9, 
-		-25, -11, 
-		13, -6, 
-		5, 9, 
-		14, 32, 
-		13, -7, 
-	},
-	{
-		-36, 10, 
-		-26, -17, 
-		-28, -16, 
-		-36, -30, 
-		10, 29, 
-		-38, -5, 
-		-14, 0, 
-		12, 8, 
-		-25, -12, 
-		13, -7, 
-		5, 8, 
-		14, 32, 
-		13, -7, 
-	},
-	{
-		-36, 9, 
-		-26, -18, 
-		-29, -17, 
-		-37, -31, 
-		10, 29, 
-		-38, -5, 
-		-14, -1, 
-		12, 7, 
-		-25, -12, 
-		13, -8, 
-		5, 8, 
-		14, 31, 
-		13, -8, 
-	},
-	{
-		-35, 8, 
-		-26, -19, 
-		-29, -19, 
-		-37, -31, 
-		10, 29, 
-		-38, -5, 
-		-14, -2, 
-		12, 7, 
-		-25, -12, 
-		13, -8, 
-		5, 7, 
-		13, 30, 
-		13, -9, 
-	},
-	{
-		-35, 7, 
-		-26, -19, 
-		-29, -20, 
-		-38, -32, 
-		10, 28, 
-		-38, -6, 
-		-14, -3, 
-		12, 6, 
-		-25, -13, 
-		13, -9, 
-		5, 7, 
-		13, 29, 
-		13, -9, 
-	},
-	{
-		-35, 6, 
-		-27, -20, 
-		-29, -21, 
-		-38, -32, 
-		10, 28, 
-		-38, -6, 
-		-14, -4, 
-		12, 5, 
-		-25, -13, 
-		13, -10, 
-		5, 6, 
-		13, 28, 
-		13, -10, 
-	},
-	{
-		-35, 6, 
-		-27, -21, 
-		-30, -23, 
-		-39, -32, 
-		9, 28, 
-		-38, -6, 
-		-14, -5, 
-		12, 4, 
-		-25, -13, 
-		13, -11, 
-		5, 6, 
-		13, 27, 
-		13, -10, 
-	},
-	{
-		-35, 5, 
-		-27, -22, 
-		-30, -24, 
-		-39, -32, 
-		9, 27, 
-		-38, -6, 
-		-14, -6, 
-		12, 4, 
-		-25, -14, 
-		13, -11, 
-		5, 5, 
-		13, 26, 
-		13, -11, 
-	},
-	{
-		-35, 4, 
-		-27, -23, 
-		-30, -26, 
-		-40, -32, 
-		9, 27, 
-		-39, -7, 
-		-14, -6, 
-		12, 3, 
-		-26, -14, 
-		13, -12, 
-		5, 5, 
-		13, 25, 
-		13, -12, 
-	},
-	{
-		-35, 3, 
-		-28, -23, 
-		-30, -27, 
-		-40, -32, 
-		9, 26, 
-		-39, -7, 
-		-14, -7, 
-		12, 2, 
-		-26, -14, 
-		13, -13, 
-		5, 4, 
-		13, 24, 
-		13, -12, 
-	},
-	{
-		-35, 2, 
-		-28, -24, 
-		-31, -28, 
-		-41, -32, 
-		9, 26, 
-		-39, -7, 
-		-14, -8, 
-		12, 1, 
-		-26, -14, 
-		13, -13, 
-		5, 4, 
-		12, 23, 
-		13, -13, 
-	},
-	{
-		-35, 1, 
-		-28, -25, 
-		-31, -30, 
-		-41, -32, 
-		9, 25, 
-		-39, -7, 
-		-14, -9, 
-		12, 1, 
-		-26, -14, 
-		13, -14, 
-		5, 3, 
-		12, 22, 
-		13, -13, 
-	},
-	{
-		-35, 0, 
-		-28, -25, 
-		-31, -31, 
-		-42, -32, 
-		9, 24, 
-		-39, -7, 
-		-14, -10, 
-		12, 0, 
-		-26, -14, 
-		14, -15, 
-		5, 2, 
-		12, 21, 
-		13, -14, 
-	},
-	{
-		-35, -1, 
-		-29, -26, 
-		-32, -32, 
-		-42, -31, 
-		9, 24, 
-		-39, -7, 
-		-14, -11, 
-		12, -1, 
-		-26, -15, 
-		14, -15, 
-		5, 2, 
-		12, 19, 
-		14, -14, 
-	},
-	{
-		-35, -2, 
-		-29, -26, 
-		-32, -34, 
-		-43, -31, 
-		9, 23, 
-		-39, -8, 
-		-14, -11, 
-		12, -2, 
-		-26, -15, 
-		14, -16, 
-		5, 1, 
-		12, 18, 
-		14, -14, 
-	},
-	{
-		-35, -3, 
-		-29, -27, 
-		-33, -35, 
-		-43, -30, 
-		9, 22, 
-		-39, -8, 
-		-14, -12, 
-		12, -2, 
-		-27, -15, 
-		14, -16, 
-		5, 1, 
-		12, 17, 
-		14, -15, 
-	},
-	{
-		-35, -4, 
-		-30, -27, 
-		-33, -36, 
-		-44, -30, 
-		9, 21, 
-		-39, -8, 
-		-14, -13, 
-		12, -3, 
-		-27, -15, 
-		14, -17, 
-		5, 0, 
-		12, 16, 
-		14, -15, 
-	},
-	{
-		-35, -5, 
-		-30, -28, 
-		-34, -37, 
-		-44, -29, 
-		9, 20, 
-		-40, -8, 
-		-14, -14, 
-		12, -4, 
-		-27, -14, 
-		14, -17, 
-		5, -1, 
-		12, 15, 
-		14, -15, 
-	},
-	{
-		-35, -6, 
-		-30, -28, 
-		-34, -38, 
-		-45, -28, 
-		8, 20, 
-		-40, -8, 
-		-14, -14, 
-		12, -5, 
-		-27, -14, 
-		14, -18, 
-		5, -1, 
-		12, 13, 
-		14, -16, 
-	},
-	{
-		-35, -6, 
-		-30, -28, 
-		-35, -39, 
-		-45, -27, 
-		8, 19, 
-		-40, -8, 
-		-14, -15, 
-		12, -5, 
-		-27, -14, 
-		14, -18, 
-		5, -2, 
-		12, 12, 
-		14, -16, 
-	},
-	{
-		-35, -7, 
-		-31, -28, 
-		-35, -40, 
-		-46, -26, 
-		8, 18, 
-		-40, -8, 
-		-14, -16, 
-		12, -6, 
-		-27, -14, 
-		14, -19, 
-		5, -2, 
-		12, 11, 
-		14, -16, 
-	},
-	{
-		-35, -8, 
-		-31, -28, 
-		-36, -41, 
-		-46, -25, 
-		8, 17, 
-		-40, -8, 
-		-15, -16, 
-		12, -7, 
-		-28, -14, 
-		14, -19, 
-		5, -3, 
-		12, 9, 
-		14, -16, 
-	},
-	{
-		-36, -9, 
-		-32, -28, 
-		-36, -42, 
-		-47, -23, 
-		8, 16, 
-		-40, -8, 
-		-15, -17, 
-		12, -8, 
-		-28, -14, 
-		14, -19, 
-		5, -3, 
-		12, 8, 
-		14, -17, 
-	},
-	{
-		-36, -10, 
-		-32, -28, 
-		-37, -42, 
-		-47, -22, 
-		8, 15, 
-		-40, -8, 
-		-15, -17, 
-		13, -8, 
-		-28, -13, 
-		15, -19, 
-		5, -4, 
-		12, 7, 
-		14, -17, 
-	},
-	{
-		-36, -11, 
-		-32, -28, 
-		-37, -43, 
-		-47, -21, 
-		8, 14, 
-		-40, -8, 
-		-15, -18, 
-		13, -9, 
-		-28, -13, 
-		15, -20, 
-		5, -5, 
-		12, 5, 
-		14, -17, 
-	},
-	{
-		-36, -12, 
-		-33, -28, 
-		-38, -43, 
-		-48, -19, 
-		8, 13, 
-		-41, -8, 
-		-15, -19, 
-		13, -10, 
-		-28, -13, 
-		15, -20, 
-		5, -5, 
-		12, 4, 
-		15, -17, 
-	},
-	{
-		-36, -12, 
-		-33, -28, 
-		-39, -44, 
-		-48, -17, 
-		8, 12, 
-		-41, -8, 
-		-15, -19, 
-		13, -10, 
-		-28, -12, 
-		15, -20, 
-		5, -6, 
-		12, 3, 
-		15, -17, 
-	},
-	{
-		-36, -13, 
-		-33, -27, 
-		-39, -44, 
-		-48, -16, 
-		8, 11, 
-		-41, -8, 
-		-15, -19, 
-		13, -11, 
-		-28, -12, 
-		15, -20, 
-		5, -6, 
-		11, 1, 
-		15, -17, 
-	},
-	{
-		-37, -14, 
-		-34, -27, 
-		-40, -45, 
-		-49, -14, 
-		8, 10, 
-		-41, -8, 
-		-15, -20, 
-		13, -12, 
-		-29, -11, 
-		15, -20, 
-		5, -7, 
-		11, 0, 
-		15, -17, 
-	},
-	{
-		-37, -15, 
-		-34, -26, 
-		-41, -45, 
-		-49, -12, 
-		8, 8, 
-		-41, -7, 
-		-15, -20, 
-		13, -12, 
-		-29, -11, 
-		15, -20, 
-		5, -7, 
-		11, -1, 
-		15, -16, 
-	},
-	{
-		-37, -16, 
-		-34, -26, 
-		-41, -45, 
-		-49, -10, 
-		8, 7, 
-		-41, -7, 
-		-16, -21, 
-		13, -13, 
-		-29, -10, 
-		15, -20, 
-		5, -8, 
-		12, -3, 
-		15, -16, 
-	},
-	{
-		-37, -16, 
-		-35, -25, 
-		-42, -45, 
-		-49, -8, 
-		8, 6, 
-		-41, -7, 
-		-16, -21, 
-		13, -13, 
-		-29, -10, 
-		15, -20, 
-		5, -8, 
-		12, -4, 
-		15, -16, 
-	},
-	{
-		-37, -17, 
-		-35, -24, 
-		-43, -44, 
-		-49, -6, 
-		8, 5, 
-		-41, -7, 
-		-16, -21, 
-		13, -14, 
-		-29, -9, 
-		16, -20, 
-		5, -9, 
-		12, -5, 
-		15, -16, 
-	},
-	{
-		-38, -18, 
-		-35, -23, 
-		-44, -44, 
-		-49, -4, 
-		8, 4, 
-		-41, -7, 
-		-16, -21, 
-		13, -14, 
-		-29, -8, 
-		16, -19, 
-		5, -9, 
-		12, -7, 
-		15, -15, 
-	},
-	{
-		-38, -18, 
-		-36, -22, 
-		-44, -44, 
-		-50, -2, 
-		8, 3, 
-		-42, -6, 
-		-16, -21, 
-		13, -15, 
-		-29, -8, 
-		16, -19, 
-		5, -10, 
-		12, -8, 
-		15, -15, 
-	},
-	{
-		-38, -19, 
-		-36, -21, 
-		-45, -43, 
-		-50, 0, 
-		8, 2, 
-		-42, -6, 
-		-16, -21, 
-		13, -15, 
-		-29, -7, 
-		16, -19, 
-		5, -10, 
-		12, -9, 
-		16, -15, 
-	},
-	{
-		-38, -19, 
-		-36, -20, 
-		-46, -42, 
-		-50, 2, 
-		8, 1, 
-		-42, -6, 
-		-16, -21, 
-		13, -16, 
-		-29, -6, 
-		16, -18, 
-		5, -10, 
-		12, -10, 
-		16, -14, 
-	},
-	{
-		-39, -20, 
-		-36, -19, 
-		-47, -41, 
-		-49, 4, 
-		8, -1, 
-		-42, -5, 
-		-16, -21, 
-		13, -16, 
-		-29, -6, 
-		16, -18, 
-		5, -11, 
-		12, -12, 
-		16, -14, 
-	},
-	{
-		-39, -20, 
-		-37, -18, 
-		-47, -40, 
-		-49, 6, 
-		8, -2, 
-		-42, -5, 
-		-17, -21, 
-		13, -17, 
-		-29, -5, 
-		16, -18, 
-		5, -11, 
-		12, -13, 
-		16, -13, 
-	},
-	{
-		-39, -21, 
-		-37, -17, 
-		-48, -39, 
-		-49, 8, 
-		8, -3, 
-		-42, -5, 
-		-17, -21, 
-		14, -17, 
-		-29, -4, 
-		16, -17, 
-		5, -11, 
-		12, -14, 
-		16, -13, 
-	},
-	{
-		-40, -21, 
-		-37, -15, 
-		-49, -37, 
-		-49, 10, 
-		8, -4, 
-		-42, -4, 
-		-17, -21, 
-		14, -17, 
-		-30, -3, 
-		16, -16, 
-		5, -12, 
-		12, -16, 
-		16, -12, 
-	},
-	{
-		-40, -22, 
-		-37, -14, 
-		-50, -36, 
-		-49, 12, 
-		8, -5, 
-		-42, -4, 
-		-17, -21, 
-		14, -18, 
-		-30, -2, 
-		17, -16, 
-		6, -12, 
-		12, -17, 
-		16, -11, 
-	},
-	{
-		-40, -22, 
-		-38, -12, 
-		-50, -34, 
-		-49, 14, 
-		8, -6, 
-		-42, -4, 
-		-17, -21, 
-		14, -18, 
-		-30, -2, 
-		17, -15, 
-		6, -12, 
-		12, -18, 
-		16, -11, 
-	},
-	{
-		-41, -22, 
-		-38, -11, 
-		-51, -32, 
-		-48, 16, 
-		8, -7, 
-		-42, -3, 
-		-17, -20, 
-		14, -18, 
-		-30, -1, 
-		17, -14, 
-		6, -13, 
-		12, -19, 
-		16, -10, 
-	},
-	{
-		-41, -22, 
-		-38, -9, 
-		-51, -30, 
-		-48, 17, 
-		8, -8, 
-		-42, -3, 
-		-17, -20, 
-		14, -18, 
-		-30, 0, 
-		17, -13, 
-		6, -13, 
-		12, -20, 
-		16, -9, 
-	},
-	{
-		-41, -23, 
-		-38, -7, 
-		-52, -28, 
-		-48, 19, 
-		8, -9, 
-		-42, -3, 
-		-18, -19, 
-		14, -18, 
-		-30, 1, 
-		17, -13, 
-		6, -13, 
-		12, -22, 
-		16, -8, 
-	},
-	{
-		-42, -23, 
-		-38, -6, 
-		-53, -26, 
-		-47, 20, 
-		8, -11, 
-		-42, -2, 
-		-18, -19, 
-		14, -18, 
-		-30, 2, 
-		17, -12, 
-		6, -13, 
-		12, -23, 
-		16, -8, 
-	},
-	{
-		-42, -23, 
-		-38, -4, 
-		-53, -23, 
-		-47, 22, 
-		8, -12, 
-		-42, -2, 
-		-18, -18, 
-		14, -18, 
-		-30, 2, 
-		17, -11, 
-		6, -13, 
-		13, -24, 
-		16, -7, 
-	},
+	0x20, 
+	0x6, 
+	0x22, 
+	0x1a, 
+	0x16, 
+	0x0, 
+	0x6, 
+	0x4, 
+	0xa, 
+	0x6, 
+	0x8, 
+	0xa, 
+	0xc, 
+	0x2, 
+	0xe, 
+	0xa, 
+	0x1a, 
+	0x0, 
+	0x10, 
+	0xc, 
+	0x4, 
+	0x18, 
+	0xe, 
+	0x3, 
+	0x18, 
+};
+
+const uint8_t visible2[][5] = { 
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0x8f, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0x7, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0x7, 0xfe, 0x25, },
+	{ 0xfa, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xfa, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xfa, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xea, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2d, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xfe, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xec, 0x2f, },
+	{ 0xe2, 0xfb, 0x7, 0xec, 0x2f, },
+	{ 0xe2, 0xf9, 0x7, 0xec, 0x2f, },
+	{ 0xe2, 0xf9, 0x7, 0xec, 0x2f, },
+	{ 0xe2, 0x79, 0xe, 0xec, 0x2f, },
+	{ 0xe2, 0x19, 0xe, 0xcc, 0x2f, },
+	{ 0xe0, 0x1b, 0xe, 0xcc, 0x2f, },
+	{ 0xf8, 0x13, 0x8e, 0xcd, 0x2f, },
+	{ 0xf8, 0x3, 0x8c, 0xcd, 0x2e, },
+	{ 0xf8, 0x3, 0x88, 0xcd, 0x2e, },
+	{ 0xf8, 0x63, 0xd8, 0x8d, 0x2e, },
+	{ 0xf8, 0x63, 0xd8, 0x8d, 0x2e, },
+	{ 0xf8, 0x63, 0xd8, 0x8d, 0x2f, },
+	{ 0xf8, 0x63, 0xd8, 0x8d, 0x2f, },
+	{ 0xf8, 0xe3, 0xd9, 0x8d, 0x2f, },
+	{ 0xf8, 0xeb, 0xd9, 0x8d, 0x2f, },
+	{ 0xf8, 0xeb, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xeb, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xeb, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xeb, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xeb, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2f, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2d, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2d, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2d, },
+	{ 0xf8, 0xe3, 0xf9, 0x9d, 0x2d, },
+	{ 0xf8, 0xe3, 0xf9, 0x95, 0x2d, },
+	{ 0xf8, 0xe3, 0xf9, 0x95, 0x2d, },
+	{ 0xf8, 0xe3, 0xfd, 0x95, 0x2d, },
+	{ 0xf8, 0xe3, 0xfd, 0x95, 0x2d, },
+	{ 0xf8, 0xe3, 0xfd, 0x95, 0x2d, },
+	{ 0xf8, 0xe3, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xf3, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xf3, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xfb, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xfb, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xfb, 0xff, 0x95, 0x2d, },
+	{ 0xf8, 0xfb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xfb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xfb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xfb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xeb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xeb, 0xff, 0x91, 0xd, },
+	{ 0xf8, 0xe3, 0xff, 0x91, 0xd, },
+	{ 0xfc, 0xe3, 0xff, 0x91, 0xd, },
+	{ 0xfc, 0xe3, 0xff, 0xd1, 0xd, },
+	{ 0xfc, 0xe3, 0xff, 0xd1, 0xd, },
+	{ 0xfc, 0xe3, 0x9f, 0xd1, 0xd, },
+	{ 0x7c, 0xf3, 0x9f, 0xd1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xd1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xd1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xc1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xc1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xc1, 0xd, },
+	{ 0x3c, 0xfb, 0x9f, 0xc1, 0x5, },
+	{ 0x3c, 0x9b, 0x8f, 0xc1, 0x1, },
+	{ 0x3c, 0xfb, 0x8f, 0xc1, 0x1, },
+	{ 0x3c, 0xfb, 0x8f, 0xcd, 0x1, },
+	{ 0x3e, 0xfb, 0x8f, 0xdd, 0x1, },
+	{ 0x3e, 0xfb, 0x8f, 0xdd, 0x1, },
+	{ 0x3e, 0xfb, 0x8f, 0xdd, 0x1, },
+	{ 0x3e, 0xfb, 0x8f, 0xdd, 0x1, },
+	{ 0xbe, 0xfb, 0x8f, 0xdd, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xff, 0x1, },
+	{ 0xfe, 0xfb, 0x8f, 0xfe, 0x1, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x1, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x1, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x1, },
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x5, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xfe, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x25, },
+	{ 0xfe, 0xfb, 0xf, 0xff, 0x25, },
+};
+
+const int8_t keys3[][26] = { 
 	{
-		-43, -23, 
+		-37, 16, 
+		-25, -9, 
+		-28, -3, 
+		-33, -25, 
+		11, 27, 
 		-38, -2, 
-		-54, -20, 
-		-47, 23, 
-		8, -13, 
-		-42, -1, 
-		-18, -18, 
-		14, -18, 
-		-30, 3, 
-		17, -10, 
-		6, -13, 
-		13, -25, 
-		16, -6, 
-	},
-	{
-		-43, -23, 
-		-38, 0, 
-		-54, -18, 
-		-46, 25, 
-		8, -14, 
-		-42, -1, 
-		-18, -17, 
-		15, -18, 
-		-29, 4, 
-		17, -9, 
-		6, -13, 
-		13, -26, 
-		16, -5, 
-	},
-	{
-		-43, -23, 
-		-38, 1, 
-		-54, -15, 
-		-46, 26, 
-		8, -15, 
-		-42, -1, 
-		-18, -16, 
-		15, -18, 
-		-29, 5, 
-		17, -8, 
-		6, -13, 
-		13, -27, 
-		16, -4, 
-	},
-	{
-		-44, -22, 
-		-38, 3, 
-		-55, -12, 
-		-45, 27, 
-		8, -16, 
-		-43, 0, 
-		-18, -15, 
-		15, -18, 
-		-29, 5, 
-		17, -7, 
-		6, -13, 
-		13, -28, 
-		16, -3, 
-	},
-	{
-		-44, -22, 
-		-38, 5, 
-		-55, -9, 
-		-45, 28, 
-		8, -17, 
-		-43, 0, 
-		-18, -14, 
-		15, -18, 
-		-29, 6, 
-		17, -6, 
-		6, -13, 
-		13, -29, 
-		16, -2, 
-	},
-	{
-		-44, -22, 
-		-38, 6, 
-		-55, -6, 
-		-44, 29, 
-		8, -18, 
-		-42, 1, 
-		-18, -13, 
-		15, -17, 
-		-29, 7, 
-		17, -4, 
-		6, -13, 
-		13, -30, 
-		17, -1, 
-	},
-	{
-		-45, -21, 
-		-38, 8, 
-		-55, -3, 
-		-44, 30, 
-		8, -19, 
-		-42, 1, 
-		-19, -12, 
-		15, -17, 
-		-29, 8, 
-		17, -3, 
-		6, -13, 
-		14, -31, 
-		17, -1, 
+		-14, 7, 
+		13, 13, 
+		-24, -8, 
+		13, 0, 
+		5, 12, 
+		15, 36, 
+		13, -2, 
 	},
 	{
-		-45, -21, 
-		-38, 10, 
-		-55, 0, 
-		-43, 30, 
-		8, -20, 
-		-42, 1, 
-		-19, -11, 
+		-36, -12, 
+		-33, -28, 
+		-38, -43, 
+		-48, -19, 
+		8, 13, 
+		-41, -8, 
+		-15, -19, 
+		13, -10, 
+		-28, -13, 
+		15, -20, 
+		5, -5, 
+		12, 4, 
 		15, -17, 
-		-29, 8, 
-		17, -2, 
-		6, -13, 
-		14, -31, 
-		17, 0, 
-	},
-	{
-		-46, -21, 
-		-38, 11, 
-		-55, 3, 
-		-43, 31, 
-		9, -20, 
-		-42, 2, 
-		-19, -10, 
-		15, -16, 
-		-29, 9, 
-		17, -1, 
-		6, -13, 
-		14, -32, 
-		17, 1, 
 	},
 	{
 		-46, -20, 
@@ -7593,471 +1133,6 @@ const int8_t vertices3[][26] = {
 		14, -33, 
 		16, 2, 
 	},
-	{
-		-46, -19, 
-		-37, 14, 
-		-55, 10, 
-		-42, 32, 
-		9, -22, 
-		-42, 3, 
-		-19, -8, 
-		15, -15, 
-		-29, 10, 
-		17, 1, 
-		6, -12, 
-		14, -33, 
-		16, 3, 
-	},
-	{
-		-47, -19, 
-		-37, 16, 
-		-55, 13, 
-		-41, 32, 
-		9, -23, 
-		-42, 3, 
-		-19, -7, 
-		16, -15, 
-		-29, 11, 
-		17, 2, 
-		6, -12, 
-		14, -34, 
-		16, 4, 
-	},
-	{
-		-47, -18, 
-		-37, 17, 
-		-54, 15, 
-		-41, 32, 
-		9, -24, 
-		-42, 3, 
-		-19, -6, 
-		16, -14, 
-		-29, 11, 
-		17, 4, 
-		6, -12, 
-		15, -35, 
-		16, 5, 
-	},
-	{
-		-47, -17, 
-		-37, 18, 
-		-54, 18, 
-		-40, 32, 
-		9, -24, 
-		-42, 4, 
-		-19, -5, 
-		16, -13, 
-		-28, 12, 
-		17, 5, 
-		6, -11, 
-		15, -35, 
-		16, 6, 
-	},
-	{
-		-48, -16, 
-		-36, 20, 
-		-53, 21, 
-		-40, 32, 
-		9, -25, 
-		-42, 4, 
-		-19, -3, 
-		16, -13, 
-		-28, 12, 
-		17, 6, 
-		6, -11, 
-		15, -35, 
-		16, 7, 
-	},
-	{
-		-48, -15, 
-		-36, 21, 
-		-53, 24, 
-		-39, 32, 
-		9, -26, 
-		-42, 5, 
-		-19, -2, 
-		16, -12, 
-		-28, 12, 
-		17, 7, 
-		6, -11, 
-		15, -36, 
-		16, 8, 
-	},
-	{
-		-48, -15, 
-		-36, 22, 
-		-52, 26, 
-		-39, 32, 
-		9, -26, 
-		-42, 5, 
-		-19, -1, 
-		16, -11, 
-		-28, 13, 
-		17, 8, 
-		6, -10, 
-		15, -36, 
-		16, 8, 
-	},
-	{
-		-48, -14, 
-		-35, 23, 
-		-52, 28, 
-		-38, 32, 
-		9, -27, 
-		-42, 5, 
-		-19, 0, 
-		16, -10, 
-		-28, 13, 
-		17, 9, 
-		6, -10, 
-		16, -36, 
-		16, 9, 
-	},
-	{
-		-49, -12, 
-		-35, 24, 
-		-51, 31, 
-		-38, 32, 
-		9, -27, 
-		-42, 6, 
-		-19, 2, 
-		16, -10, 
-		-28, 13, 
-		17, 10, 
-		6, -9, 
-		16, -36, 
-		16, 10, 
-	},
-	{
-		-49, -11, 
-		-35, 25, 
-		-51, 33, 
-		-37, 31, 
-		9, -28, 
-		-42, 6, 
-		-19, 3, 
-		16, -9, 
-		-28, 14, 
-		17, 11, 
-		6, -9, 
-		16, -36, 
-		16, 11, 
-	},
-	{
-		-49, -10, 
-		-34, 25, 
-		-50, 35, 
-		-37, 31, 
-		10, -28, 
-		-42, 6, 
-		-19, 4, 
-		16, -8, 
-		-27, 14, 
-		17, 12, 
-		6, -8, 
-		16, -36, 
-		16, 11, 
-	},
-	{
-		-49, -9, 
-		-34, 26, 
-		-49, 36, 
-		-36, 30, 
-		10, -28, 
-		-42, 6, 
-		-19, 5, 
-		16, -7, 
-		-27, 14, 
-		17, 13, 
-		6, -8, 
-		17, -35, 
-		16, 12, 
-	},
-	{
-		-49, -8, 
-		-34, 27, 
-		-49, 38, 
-		-36, 30, 
-		10, -29, 
-		-41, 7, 
-		-19, 6, 
-		16, -6, 
-		-27, 14, 
-		17, 14, 
-		6, -7, 
-		17, -35, 
-		16, 13, 
-	},
-	{
-		-50, -7, 
-		-33, 27, 
-		-48, 39, 
-		-36, 29, 
-		10, -29, 
-		-41, 7, 
-		-19, 8, 
-		16, -5, 
-		-27, 14, 
-		17, 14, 
-		6, -6, 
-		17, -35, 
-		16, 13, 
-	},
-	{
-		-50, -5, 
-		-33, 27, 
-		-47, 40, 
-		-35, 29, 
-		10, -29, 
-		-41, 7, 
-		-19, 9, 
-		16, -4, 
-		-27, 15, 
-		17, 15, 
-		6, -6, 
-		17, -34, 
-		16, 14, 
-	},
-	{
-		-50, -4, 
-		-33, 28, 
-		-46, 41, 
-		-35, 28, 
-		10, -29, 
-		-41, 7, 
-		-19, 10, 
-		16, -3, 
-		-27, 15, 
-		17, 16, 
-		6, -5, 
-		17, -33, 
-		16, 14, 
-	},
-	{
-		-50, -3, 
-		-32, 28, 
-		-46, 42, 
-		-34, 27, 
-		10, -29, 
-		-41, 7, 
-		-19, 11, 
-		16, -2, 
-		-27, 15, 
-		16, 17, 
-		6, -4, 
-		18, -32, 
-		16, 15, 
-	},
-	{
-		-50, -1, 
-		-32, 28, 
-		-45, 43, 
-		-34, 27, 
-		10, -29, 
-		-41, 8, 
-		-19, 12, 
-		16, -1, 
-		-26, 15, 
-		16, 17, 
-		6, -4, 
-		18, -31, 
-		15, 15, 
-	},
-	{
-		-50, 0, 
-		-32, 28, 
-		-44, 44, 
-		-34, 26, 
-		10, -29, 
-		-41, 8, 
-		-19, 13, 
-		16, 0, 
-		-26, 14, 
-		16, 18, 
-		6, -3, 
-		18, -30, 
-		15, 15, 
-	},
-	{
-		-50, 1, 
-		-31, 28, 
-		-43, 44, 
-		-33, 25, 
-		11, -28, 
-		-41, 8, 
-		-18, 14, 
-		16, 1, 
-		-26, 14, 
-		16, 18, 
-		6, -2, 
-		18, -29, 
-		15, 16, 
-	},
-	{
-		-50, 3, 
-		-31, 28, 
-		-43, 45, 
-		-33, 24, 
-		11, -28, 
-		-40, 8, 
-		-18, 15, 
-		16, 2, 
-		-26, 14, 
-		16, 19, 
-		6, -2, 
-		19, -28, 
-		15, 16, 
-	},
-	{
-		-50, 4, 
-		-31, 28, 
-		-42, 45, 
-		-33, 23, 
-		11, -28, 
-		-40, 8, 
-		-18, 16, 
-		16, 3, 
-		-26, 14, 
-		16, 19, 
-		6, -1, 
-		19, -27, 
-		15, 16, 
-	},
-	{
-		-50, 5, 
-		-30, 28, 
-		-41, 45, 
-		-33, 22, 
-		11, -27, 
-		-40, 8, 
-		-18, 16, 
-		16, 4, 
-		-26, 14, 
-		16, 19, 
-		6, 0, 
-		19, -25, 
-		15, 16, 
-	},
-	{
-		-50, 7, 
-		-30, 28, 
-		-41, 45, 
-		-32, 21, 
-		11, -26, 
-		-40, 8, 
-		-18, 17, 
-		16, 5, 
-		-26, 14, 
-		16, 20, 
-		6, 1, 
-		19, -23, 
-		15, 17, 
-	},
-	{
-		-49, 8, 
-		-30, 27, 
-		-40, 45, 
-		-32, 20, 
-		11, -26, 
-		-40, 8, 
-		-18, 18, 
-		16, 6, 
-		-25, 13, 
-		16, 20, 
-		6, 1, 
-		19, -22, 
-		15, 17, 
-	},
-	{
-		-49, 9, 
-		-29, 27, 
-		-39, 44, 
-		-32, 19, 
-		11, -25, 
-		-40, 8, 
-		-18, 18, 
-		16, 7, 
-		-25, 13, 
-		15, 20, 
-		6, 2, 
-		19, -20, 
-		15, 17, 
-	},
-	{
-		-49, 10, 
-		-29, 27, 
-		-39, 44, 
-		-32, 18, 
-		11, -24, 
-		-40, 8, 
-		-18, 19, 
-		16, 8, 
-		-25, 13, 
-		15, 20, 
-		6, 3, 
-		20, -18, 
-		15, 17, 
-	},
-	{
-		-49, 11, 
-		-29, 26, 
-		-38, 43, 
-		-31, 17, 
-		11, -23, 
-		-40, 8, 
-		-17, 20, 
-		16, 9, 
-		-25, 13, 
-		15, 20, 
-		6, 4, 
-		20, -16, 
-		14, 17, 
-	},
-	{
-		-49, 12, 
-		-29, 26, 
-		-37, 43, 
-		-31, 16, 
-		12, -22, 
-		-40, 8, 
-		-17, 20, 
-		16, 10, 
-		-25, 12, 
-		15, 20, 
-		6, 4, 
-		20, -14, 
-		14, 17, 
-	},
-	{
-		-48, 14, 
-		-28, 25, 
-		-37, 42, 
-		-31, 14, 
-		12, -21, 
-		-39, 8, 
-		-17, 20, 
-		16, 11, 
-		-25, 12, 
-		15, 20, 
-		6, 5, 
-		20, -12, 
-		14, 17, 
-	},
-	{
-		-48, 15, 
-		-28, 24, 
-		-36, 41, 
-		-31, 13, 
-		12, -20, 
-		-39, 8, 
-		-17, 21, 
-		16, 11, 
-		-25, 11, 
-		15, 20, 
-		6, 6, 
-		20, -9, 
-		14, 16, 
-	},
 	{
 		-48, 16, 
 		-28, 24, 
@@ -8073,503 +1148,318 @@ const int8_t vertices3[][26] = {
 		20, -7, 
 		14, 16, 
 	},
-	{
-		-48, 16, 
-		-27, 23, 
-		-35, 40, 
-		-31, 11, 
-		12, -17, 
-		-39, 7, 
-		-17, 21, 
-		16, 13, 
-		-24, 10, 
-		15, 20, 
-		6, 7, 
-		20, -5, 
-		14, 16, 
-	},
-	{
-		-47, 17, 
-		-27, 22, 
-		-34, 39, 
-		-30, 10, 
-		12, -16, 
-		-39, 7, 
-		-17, 21, 
-		16, 14, 
-		-24, 10, 
-		15, 19, 
-		6, 7, 
-		20, -3, 
-		14, 16, 
-	},
-	{
-		-47, 18, 
-		-27, 22, 
-		-34, 38, 
-		-30, 9, 
-		12, -14, 
-		-39, 7, 
-		-17, 21, 
-		16, 14, 
-		-24, 10, 
-		14, 19, 
-		6, 8, 
-		20, 0, 
-		14, 15, 
-	},
-	{
-		-47, 19, 
-		-27, 21, 
-		-33, 37, 
-		-30, 7, 
-		12, -13, 
-		-39, 7, 
-		-16, 21, 
-		15, 15, 
-		-24, 9, 
-		14, 19, 
-		6, 9, 
-		20, 2, 
-		14, 15, 
-	},
-	{
-		-46, 19, 
-		-27, 20, 
-		-33, 36, 
-		-30, 6, 
-		12, -11, 
-		-39, 7, 
-		-16, 21, 
-		15, 15, 
-		-24, 8, 
-		14, 19, 
-		6, 9, 
-		20, 4, 
-		14, 15, 
-	},
-	{
-		-46, 20, 
-		-26, 19, 
-		-33, 34, 
-		-30, 5, 
-		12, -10, 
-		-39, 7, 
-		-16, 21, 
-		15, 16, 
-		-24, 8, 
-		14, 18, 
-		6, 10, 
-		20, 7, 
-		14, 14, 
-	},
-	{
-		-46, 21, 
-		-26, 18, 
-		-32, 33, 
-		-30, 4, 
-		12, -8, 
-		-38, 6, 
-		-16, 21, 
-		15, 16, 
-		-24, 7, 
-		14, 18, 
-		6, 10, 
-		20, 9, 
-		14, 14, 
-	},
-	{
-		-45, 21, 
-		-26, 17, 
-		-32, 32, 
-		-30, 3, 
-		12, -6, 
-		-38, 6, 
-		-16, 21, 
-		15, 17, 
-		-24, 7, 
-		14, 17, 
-		6, 11, 
-		20, 11, 
-		13, 14, 
-	},
-	{
-		-45, 21, 
-		-26, 16, 
-		-31, 31, 
-		-30, 1, 
-		12, -5, 
-		-38, 6, 
-		-16, 21, 
-		15, 17, 
-		-24, 6, 
-		14, 17, 
-		6, 11, 
-		20, 13, 
-		13, 13, 
-	},
-	{
-		-44, 22, 
-		-26, 15, 
-		-31, 29, 
-		-30, 0, 
-		12, -3, 
-		-38, 6, 
-		-16, 21, 
-		15, 17, 
-		-24, 6, 
-		14, 16, 
-		6, 11, 
-		20, 15, 
-		13, 13, 
-	},
-	{
-		-44, 22, 
-		-26, 14, 
-		-31, 28, 
-		-30, -1, 
-		12, -1, 
-		-38, 5, 
-		-15, 20, 
-		15, 18, 
-		-24, 5, 
-		14, 16, 
-		6, 12, 
-		20, 17, 
-		13, 12, 
-	},
-	{
-		-44, 22, 
-		-25, 13, 
-		-30, 27, 
-		-30, -2, 
-		12, 1, 
-		-38, 5, 
-		-15, 20, 
-		15, 18, 
-		-24, 4, 
-		14, 15, 
-		6, 12, 
-		19, 19, 
-		13, 12, 
-	},
-	{
-		-43, 23, 
-		-25, 12, 
-		-30, 25, 
-		-30, -4, 
-		12, 3, 
-		-38, 5, 
-		-15, 20, 
-		15, 18, 
-		-24, 4, 
-		13, 15, 
-		6, 12, 
-		19, 21, 
-		13, 11, 
-	},
-	{
-		-43, 23, 
-		-25, 11, 
-		-30, 24, 
-		-30, -5, 
-		12, 4, 
-		-38, 4, 
-		-15, 19, 
-		15, 18, 
-		-24, 3, 
-		13, 14, 
-		6, 13, 
-		19, 23, 
-		13, 10, 
-	},
-	{
-		-43, 23, 
-		-25, 10, 
-		-29, 23, 
-		-30, -6, 
-		12, 6, 
-		-38, 4, 
-		-15, 19, 
-		14, 18, 
-		-24, 3, 
-		13, 13, 
-		6, 13, 
-		19, 25, 
-		13, 10, 
-	},
-	{
-		-42, 23, 
-		-25, 9, 
-		-29, 21, 
-		-30, -7, 
-		12, 8, 
-		-38, 4, 
-		-15, 18, 
-		14, 18, 
-		-24, 2, 
-		13, 13, 
-		6, 13, 
-		19, 26, 
-		13, 9, 
-	},
-	{
-		-42, 23, 
-		-25, 8, 
-		-29, 20, 
-		-30, -9, 
-		12, 10, 
-		-38, 3, 
-		-15, 18, 
-		14, 18, 
-		-24, 1, 
-		13, 12, 
-		6, 13, 
-		19, 28, 
-		13, 9, 
-	},
-	{
-		-41, 23, 
-		-25, 7, 
-		-29, 18, 
-		-30, -10, 
-		12, 11, 
-		-38, 3, 
-		-15, 17, 
-		14, 18, 
-		-24, 1, 
-		13, 11, 
-		6, 13, 
-		18, 29, 
-		13, 8, 
-	},
-	{
-		-41, 22, 
-		-25, 6, 
-		-29, 17, 
-		-30, -11, 
-		12, 13, 
-		-38, 3, 
-		-15, 17, 
-		14, 18, 
-		-24, 0, 
-		13, 10, 
-		6, 13, 
-		18, 30, 
-		13, 7, 
-	},
-	{
-		-41, 22, 
-		-25, 5, 
-		-28, 15, 
-		-31, -12, 
-		12, 14, 
-		-38, 2, 
-		-15, 16, 
-		14, 18, 
-		-24, -1, 
-		13, 10, 
-		6, 13, 
-		18, 31, 
-		13, 7, 
-	},
-	{
-		-40, 22, 
-		-25, 4, 
-		-28, 14, 
-		-31, -13, 
-		12, 16, 
-		-38, 2, 
-		-14, 15, 
-		14, 18, 
-		-24, -1, 
-		13, 9, 
-		6, 13, 
-		18, 32, 
-		13, 6, 
-	},
-	{
-		-40, 22, 
-		-25, 3, 
-		-28, 12, 
-		-31, -14, 
-		12, 17, 
-		-38, 2, 
-		-14, 15, 
-		14, 17, 
-		-24, -2, 
-		13, 8, 
-		6, 13, 
-		17, 33, 
-		13, 5, 
-	},
-	{
-		-40, 21, 
-		-25, 1, 
-		-28, 11, 
-		-31, -16, 
-		12, 19, 
-		-37, 1, 
-		-14, 14, 
-		14, 17, 
-		-24, -2, 
-		13, 7, 
-		6, 13, 
-		17, 34, 
-		13, 5, 
-	},
-	{
-		-39, 21, 
-		-25, 0, 
-		-28, 9, 
-		-31, -17, 
-		12, 20, 
-		-37, 1, 
-		-14, 13, 
-		14, 17, 
-		-24, -3, 
-		13, 7, 
-		6, 13, 
-		17, 34, 
-		13, 4, 
-	},
-	{
-		-39, 20, 
-		-25, -1, 
-		-28, 8, 
-		-32, -18, 
-		12, 21, 
-		-37, 1, 
-		-14, 12, 
-		13, 17, 
-		-24, -4, 
-		13, 6, 
-		6, 13, 
-		17, 35, 
-		13, 3, 
-	},
-	{
-		-39, 20, 
-		-25, -2, 
-		-28, 6, 
-		-32, -19, 
-		12, 22, 
-		-37, 0, 
-		-14, 12, 
-		13, 16, 
-		-24, -4, 
-		13, 5, 
-		6, 13, 
-		17, 35, 
-		13, 3, 
-	},
-	{
-		-38, 19, 
-		-25, -3, 
-		-28, 4, 
-		-32, -20, 
-		11, 23, 
-		-37, 0, 
-		-14, 11, 
-		13, 16, 
-		-24, -5, 
-		13, 4, 
-		6, 13, 
-		16, 36, 
-		13, 2, 
-	},
-	{
-		-38, 19, 
-		-25, -4, 
-		-28, 3, 
-		-32, -21, 
-		11, 24, 
-		-37, -1, 
-		-14, 10, 
-		13, 15, 
-		-24, -6, 
-		13, 3, 
-		6, 13, 
-		16, 36, 
-		13, 1, 
-	},
-	{
-		-38, 18, 
-		-25, -5, 
-		-28, 1, 
-		-33, -22, 
-		11, 25, 
-		-37, -1, 
-		-14, 9, 
-		13, 15, 
-		-24, -6, 
-		13, 2, 
-		6, 12, 
-		16, 36, 
-		13, 0, 
-	},
-	{
-		-38, 18, 
-		-25, -6, 
-		-28, 0, 
-		-33, -23, 
-		11, 26, 
-		-37, -1, 
-		-14, 8, 
-		13, 14, 
-		-24, -7, 
-		13, 2, 
-		6, 12, 
-		16, 36, 
-		13, 0, 
-	},
-	{
-		-37, 17, 
-		-25, -7, 
-		-28, -2, 
-		-33, -24, 
-		11, 26, 
-		-38, -2, 
-		-14, 8, 
-		13, 14, 
-		-24, -7, 
-		13, 1, 
-		6, 12, 
-		15, 36, 
-		13, -1, 
-	},
 };
-const uint16_t edges3[] = { 
+const uint8_t deltas3[][13] = { 
+	{ 0xf, 0xe, 0xf, 0xf, 0x1, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf0, 0x0, 0xf, },
+	{ 0x0, 0xf, 0xe, 0xff, 0x1, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, },
+	{ 0x1f, 0xf, 0xf, 0xff, 0xf1, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xff, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, },
+	{ 0x0, 0xff, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xe, 0x0, 0x0, 0xf, 0xf, 0xff, 0xf, 0xf, 0xf, 0x0, 0x0, },
+	{ 0xf, 0xf, 0xff, 0xff, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, },
+	{ 0x1f, 0xf, 0xe, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf, },
+	{ 0xf, 0x0, 0xf, 0xff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, },
+	{ 0xf, 0xff, 0xf, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0xf, },
+	{ 0x0, 0xf, 0xfe, 0xf0, 0xf0, 0x0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xf0, 0x0, 0xff, 0x0, 0xf, 0xf0, 0xf, 0x0, 0xf, 0xf, },
+	{ 0xf, 0xf0, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0xff, 0xf, },
+	{ 0xf, 0xf, 0xe, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x0, 0xf, 0xf0, 0xf, 0x0, 0xf, 0xf, 0x0, 0x1f, 0xf, 0xf, 0xf, },
+	{ 0xf, 0xff, 0xff, 0x1, 0x0, 0x0, 0xf, 0xf, 0xf, 0x0, 0x0, 0xe, 0x10, },
+	{ 0xf, 0x0, 0xe, 0xf0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xff, 0x1, 0xf, 0x0, 0xf, 0x0, 0xf0, 0x0, 0x0, 0xf, 0xf, },
+	{ 0xf, 0xf0, 0xf, 0xf0, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xf, 0x0, },
+	{ 0xf, 0xf, 0xff, 0x1, 0xf, 0xf0, 0xf, 0xf, 0x1, 0x0, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x0, 0xf, 0xf1, 0xf0, 0x0, 0x0, 0xf, 0x0, 0xf, 0x0, 0xe, 0xf, },
+	{ 0x0, 0x0, 0xff, 0x1, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, },
+	{ 0xf, 0xf0, 0xf, 0xf1, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, },
+	{ 0xf, 0x0, 0xff, 0x1, 0xf, 0x0, 0xf0, 0xf, 0xf0, 0x0, 0xf, 0xe, 0x0, },
+	{ 0xff, 0xf0, 0xf, 0xf2, 0xf, 0x0, 0xf, 0xf, 0x0, 0x0, 0x0, 0xf, 0xf, },
+	{ 0xf, 0x0, 0xf0, 0x1, 0xf, 0x0, 0x0, 0x10, 0x1, 0x10, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x0, 0xf, 0x1, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf, 0xf, 0xe, 0x0, },
+	{ 0xf, 0xf0, 0xf0, 0xf2, 0xf, 0xf0, 0xf, 0xf, 0x0, 0x0, 0x0, 0xf, 0x10, },
+	{ 0x0, 0x0, 0xff, 0x2, 0xf, 0x0, 0x0, 0x0, 0x1, 0x0, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x1, 0x0, 0x1, 0xf, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xfe, 0x0, },
+	{ 0xff, 0xf0, 0xff, 0xf2, 0xf, 0x0, 0xf, 0xf, 0xf1, 0x0, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x1, 0xf0, 0x2, 0xe, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x1, },
+	{ 0xf, 0x0, 0x0, 0x2, 0xf, 0x0, 0xff, 0xf, 0x1, 0x0, 0xf, 0x1e, 0x0, },
+	{ 0x0, 0xf1, 0xf0, 0x2, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, },
+	{ 0xf, 0x1, 0xf1, 0x2, 0xf, 0x0, 0x0, 0xf, 0x1, 0x10, 0xf, 0xf, 0x0, },
+	{ 0xff, 0x1, 0xf0, 0x2, 0xf, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0xe, 0x1, },
+	{ 0x0, 0xf1, 0x0, 0xf2, 0xf, 0xf1, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, },
+	{ 0xf, 0x1, 0xf1, 0x2, 0xf, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0xf, 0x10, },
+	{ 0x0, 0x1, 0xf1, 0x2, 0xf, 0x0, 0x0, 0xf, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0xff, 0x1, 0xf1, 0x12, 0xe, 0x1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe, 0x0, },
+	{ 0x0, 0xf1, 0x1, 0x2, 0xf, 0x0, 0xf0, 0xf, 0x1, 0x0, 0x0, 0xf, 0x1, },
+	{ 0xf, 0x1, 0xf1, 0x2, 0xf, 0x0, 0x0, 0x10, 0x1, 0x1, 0x0, 0xf, 0x0, },
+	{ 0xf0, 0x2, 0xf2, 0x2, 0xf, 0x1, 0x0, 0x0, 0xf1, 0x1, 0xf, 0xe, 0x1, },
+	{ 0xf, 0x1, 0xf1, 0x2, 0xf, 0x0, 0x0, 0xf, 0x1, 0x10, 0x10, 0xf, 0x1, },
+	{ 0x0, 0xf2, 0x2, 0x2, 0xf, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xf, 0x0, },
+	{ 0xf0, 0x1, 0xf2, 0x12, 0xf, 0x1, 0x1, 0x0, 0x1, 0x1, 0xf, 0xf, 0x1, },
+	{ 0x0, 0x2, 0x2, 0x1, 0xf, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0xf, 0x2, 0xf2, 0x2, 0xf, 0x0, 0xf1, 0x0, 0x1, 0x0, 0x0, 0xe, 0x1, },
+	{ 0xf0, 0x1, 0xf2, 0x11, 0xe, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0xf, 0x0, },
+	{ 0x0, 0x2, 0x3, 0x2, 0xf, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1f, 0x1, },
+	{ 0xf0, 0x2, 0xf3, 0x1, 0xf, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x0, 0x2, 0x2, 0x12, 0xf, 0x0, 0x1, 0x10, 0x11, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x0, 0x1, 0x3, 0x1, 0xf, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0xf1, 0x2, 0xf3, 0x11, 0xf, 0xf1, 0x1, 0x0, 0x0, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x0, 0x2, 0x3, 0x1, 0xf, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x0, 0x1, 0x3, 0x11, 0xf, 0x11, 0x1, 0x1, 0x1, 0x2, 0x0, 0xf, 0x11, },
+	{ 0xf1, 0x2, 0x3, 0x1, 0xf, 0x0, 0xf1, 0x0, 0x1, 0x1, 0x0, 0x1f, 0x0, },
+	{ 0x0, 0x2, 0x3, 0x10, 0xf, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, },
+	{ 0xf0, 0x1, 0x3, 0x1, 0x10, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x1, 0x2, 0x4, 0x10, 0xf, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0xf, 0xf1, },
+	{ 0x1, 0x11, 0x3, 0x1, 0xf, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, },
+	{ 0xf0, 0x2, 0x3, 0x10, 0xf, 0x0, 0x1, 0x10, 0x1, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x1, 0x1, 0x12, 0x0, 0xf, 0x0, 0x1, 0x1, 0x0, 0x2, 0x0, 0x1f, 0x1, },
+	{ 0x1, 0x1, 0x3, 0x10, 0x0, 0x1, 0x1, 0x1, 0x11, 0x1, 0x1, 0x0, 0x1, },
+	{ 0xf1, 0x12, 0x13, 0x0, 0xf, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, },
+	{ 0x1, 0x1, 0x3, 0x10, 0xf, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0xf, 0x1, },
+	{ 0x0, 0x1, 0x12, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, },
+	{ 0x1, 0x11, 0x2, 0x10, 0xf, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x10, 0x1, },
+	{ 0xf2, 0x1, 0x13, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, },
+	{ 0x1, 0x1, 0x2, 0x1f, 0xf, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, },
+	{ 0x1, 0x10, 0x12, 0x0, 0x10, 0x0, 0x1, 0x1, 0x10, 0x1, 0x1, 0x0, 0x0, },
+	{ 0x1, 0x1, 0x11, 0x1f, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x11, 0x1, },
+	{ 0x1, 0x1, 0x2, 0x0, 0xf, 0x11, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, },
+	{ 0xf1, 0x10, 0x11, 0xf, 0x0, 0x0, 0x2, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, },
+	{ 0x2, 0x0, 0x11, 0x10, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, },
+	{ 0x1, 0x1, 0x11, 0xf, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, },
+	{ 0x1, 0x10, 0x1, 0x1f, 0x0, 0x0, 0x1, 0x1, 0x0, 0xf1, 0x1, 0x11, 0x1, },
+	{ 0x2, 0x0, 0x11, 0x0, 0x0, 0x1, 0x1, 0x1, 0x10, 0x0, 0x0, 0x1, 0xf0, },
+	{ 0x1, 0x0, 0x11, 0xf, 0x0, 0x0, 0x1, 0x1, 0xf, 0x1, 0x1, 0x1, 0x0, },
+	{ 0x1, 0x10, 0x10, 0x1f, 0x11, 0x0, 0x11, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, },
+	{ 0x2, 0x0, 0x1, 0xf, 0x0, 0x10, 0x1, 0x1, 0x0, 0x1, 0x0, 0x11, 0x0, },
+	{ 0x1, 0x0, 0x10, 0xf, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, },
+	{ 0x1, 0x10, 0x10, 0xf, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x2, 0x0, },
+	{ 0x2, 0x0, 0x0, 0x1f, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x2, 0x1, },
+	{ 0x11, 0xf, 0x10, 0xf, 0x0, 0x0, 0x1, 0x1, 0x1f, 0x0, 0x0, 0x1, 0x0, },
+	{ 0x1, 0x10, 0x1f, 0xf, 0x1, 0x0, 0x0, 0x1, 0x0, 0xf0, 0x1, 0x2, 0x0, },
+	{ 0x1, 0x0, 0x0, 0xf, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x12, 0x0, },
+	{ 0x1, 0xf, 0x1f, 0x1f, 0x1, 0x0, 0x11, 0x1, 0x0, 0x0, 0x1, 0x2, 0xf0, },
+	{ 0x1, 0x0, 0x10, 0xf, 0x11, 0x0, 0x0, 0x1, 0xf, 0x0, 0x0, 0x2, 0x0, },
+	{ 0x12, 0x1f, 0xf, 0xe, 0x1, 0x10, 0x0, 0x1, 0x0, 0x0, 0x1, 0x2, 0x0, },
+	{ 0x1, 0xf, 0x1f, 0xf, 0x1, 0x0, 0x1, 0x0, 0xf, 0x0, 0x1, 0x3, 0xf, },
+	{ 0x1, 0x0, 0x0, 0xf, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, },
+	{ 0x0, 0x1f, 0x1f, 0xf, 0x2, 0xf, 0x0, 0x1, 0x1f, 0x0, 0x1, 0x2, 0x0, },
+	{ 0x11, 0xf, 0x1f, 0x1f, 0x1, 0x0, 0x0, 0x1, 0x0, 0xf, 0x0, 0x2, 0x0, },
+	{ 0x1, 0x0, 0xf, 0xf, 0x2, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x1, 0x3, 0xf, },
+	{ 0x1, 0xf, 0x1f, 0xe, 0x1, 0x0, 0x10, 0xf1, 0xf, 0x0, 0x1, 0x2, 0x0, },
+	{ 0x10, 0xf, 0xf, 0xf, 0x2, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x2, 0x0, },
+	{ 0x1, 0x1f, 0xe, 0xf, 0x1, 0x0, 0x0, 0x1, 0x0, 0xf, 0x1, 0x3, 0xf, },
+	{ 0x1, 0xf, 0x1f, 0xf, 0x2, 0x1f, 0x0, 0x0, 0xf, 0x0, 0x0, 0x2, 0x0, },
+	{ 0x10, 0xf, 0xf, 0xf, 0x2, 0x0, 0x0, 0x1, 0x0, 0xf, 0x1, 0x2, 0xf0, },
+	{ 0x0, 0xf, 0x1f, 0xe, 0x1, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x2, 0xf, },
+	{ 0x11, 0xf, 0xe, 0xf, 0x2, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x2, 0x0, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x2, 0xf, 0x1f, 0x1, 0xf, 0x0, 0x1, 0x2, 0xf, },
+	{ 0x0, 0x1f, 0x1f, 0xf, 0x2, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf2, 0x0, },
+	{ 0x11, 0xf, 0xe, 0xe, 0x2, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x2, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0x0, 0xf, 0xf, 0x1, 0x2, 0xf, },
+	{ 0x0, 0xf, 0x1f, 0xf, 0x2, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x2, 0x0, },
+	{ 0x10, 0xf, 0xe, 0xf, 0x2, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0x1, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xe, 0x2, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0x2, 0x0, },
+	{ 0x10, 0xf, 0xe, 0xf, 0x1, 0x0, 0xf, 0x0, 0x0, 0xf, 0x0, 0xf1, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xf, 0x2, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x1, 0xf, },
+	{ 0x0, 0xf, 0x1e, 0xff, 0x1, 0xf, 0xf, 0x0, 0xf, 0x0, 0x0, 0x1, 0x0, },
+	{ 0x10, 0xf, 0xf, 0xf, 0x2, 0x0, 0x1f, 0x0, 0x0, 0xf, 0x0, 0x1, 0xf, },
+	{ 0x0, 0xf, 0xe, 0xf, 0x1, 0x0, 0x0, 0xf, 0xf, 0xf, 0x0, 0xf1, 0xf, },
+	{ 0xf, 0xe, 0xf, 0xe, 0x2, 0x1f, 0xf, 0x0, 0x0, 0xf, 0x0, 0x1, 0x0, },
+	{ 0x10, 0xf, 0xe, 0xf, 0x1, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xf, 0xff, 0x1, 0x0, 0xf, 0xf0, 0xf, 0xf, 0x0, 0x1, 0xf, },
+	{ 0x0, 0xf, 0xe, 0xf, 0x1, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0x0, 0x0, },
+	{ 0x1f, 0xf, 0xe, 0xf, 0xf1, 0x0, 0xf, 0x0, 0xf, 0xf, 0x0, 0xf1, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x1, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0xf, },
+	{ 0xf, 0xf, 0xe, 0xff, 0x1, 0x0, 0xf, 0x0, 0x0, 0xf, 0xf, 0x0, 0xf, },
+	{ 0x0, 0xf, 0xf, 0xf, 0x1, 0x0, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, },
+	{ 0x1f, 0xf, 0xe, 0xf, 0x0, 0xff, 0x0, 0x0, 0x0, 0xf, 0x0, 0xf0, 0xf, },
+};
+const uint8_t path3[] = { 
+	0x15, 
+	0x16, 
+	0x8, 
+	0x17, 
+	0x0, 
 	0x2, 
 	0x4, 
+	0x0, 
+	0xa, 
+	0x6, 
+	0x2, 
+	0x10, 
+	0x6, 
+	0x3, 
+	0x12, 
+	0xe, 
+	0xc, 
+	0x10, 
 	0xa, 
+	0x8, 
 	0x14, 
-	0x16, 
-	0x204, 
-	0x206, 
-	0x210, 
-	0x212, 
-	0x60a, 
-	0x610, 
-	0x80a, 
-	0x814, 
-	0x816, 
-	0xa10, 
-	0xc0e, 
-	0xc10, 
-	0xc14, 
-	0xe12, 
-	0xe18, 
-	0x1014, 
-	0x1018, 
-	0x1218, 
-	0x1416, 
+	0x0, 
+	0xd, 
+	0x14, 
+	0x10, 
+	0x18, 
+	0x12, 
+	0x19, 
+	0xe, 
+};
+
+const uint8_t visible3[][4] = { 
+	{ 0x16, 0xd3, 0x1d, 0x17, },
+	{ 0x16, 0xd3, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0xdf, 0x1d, 0x17, },
+	{ 0x16, 0x5f, 0x1d, 0x17, },
+	{ 0x16, 0x5f, 0x1d, 0x17, },
+	{ 0x56, 0x5f, 0x1d, 0x17, },
+	{ 0x56, 0x5f, 0x1d, 0x17, },
+	{ 0x56, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xd6, 0x5f, 0x9f, 0x17, },
+	{ 0xc6, 0x5e, 0x9f, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5e, 0x9d, 0x17, },
+	{ 0xc6, 0x5c, 0x98, 0x17, },
+	{ 0xc6, 0x5c, 0x98, 0x7, },
+	{ 0xf6, 0x5d, 0x9b, 0x7, },
+	{ 0xf6, 0x5d, 0x9b, 0x7, },
+	{ 0xf6, 0x5d, 0xbb, 0x7, },
+	{ 0xf6, 0x5d, 0x3b, 0x7, },
+	{ 0xf4, 0x5d, 0x3b, 0x6, },
+	{ 0xf4, 0xdd, 0x3b, 0x6, },
+	{ 0xf4, 0xdf, 0x3b, 0x6, },
+	{ 0xf4, 0xdf, 0x3f, 0x6, },
+	{ 0xf6, 0xdf, 0x3f, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xdf, 0x2f, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xdf, 0x27, 0x6, },
+	{ 0xf6, 0xde, 0x27, 0x6, },
+	{ 0xf6, 0xde, 0x23, 0x6, },
+	{ 0xf6, 0xde, 0x33, 0x6, },
+	{ 0xf6, 0xde, 0x33, 0x6, },
+	{ 0xf2, 0xde, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0x23, 0x6, },
+	{ 0xf2, 0xd6, 0xa3, 0x6, },
+	{ 0xf2, 0xd6, 0xa3, 0x6, },
+	{ 0xf2, 0xd6, 0xa3, 0x4, },
+	{ 0xf2, 0xd6, 0xa3, 0x4, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd6, 0xa3, 0x0, },
+	{ 0xf2, 0xd4, 0xa3, 0x0, },
+	{ 0xf2, 0xc0, 0xa3, 0x0, },
+	{ 0xf2, 0xc0, 0xa3, 0x0, },
+	{ 0xf2, 0xc0, 0xa3, 0x0, },
+	{ 0xf6, 0xc0, 0xa3, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc0, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x0, },
+	{ 0xf6, 0xc1, 0xab, 0x10, },
+	{ 0xf4, 0xc3, 0x8b, 0x10, },
+	{ 0xd4, 0xd3, 0x8b, 0x12, },
+	{ 0xd4, 0x13, 0x8b, 0x10, },
+	{ 0xd4, 0x13, 0x8b, 0x10, },
+	{ 0xd4, 0x13, 0x9, 0x0, },
+	{ 0xd4, 0x13, 0x8, 0x0, },
+	{ 0xd4, 0x13, 0xc, 0x0, },
+	{ 0xd4, 0x13, 0xc, 0x1, },
+	{ 0x14, 0x13, 0xc, 0x1, },
+	{ 0x14, 0x13, 0xc, 0x11, },
+	{ 0x14, 0x13, 0xc, 0x13, },
+	{ 0x14, 0x13, 0xc, 0x13, },
+	{ 0x14, 0x13, 0xc, 0x13, },
+	{ 0x14, 0x13, 0xc, 0x13, },
+	{ 0x14, 0x13, 0x1c, 0x13, },
+	{ 0x14, 0x13, 0x1c, 0x13, },
+	{ 0x14, 0x13, 0x1d, 0x13, },
+	{ 0x14, 0x13, 0x1d, 0x13, },
+	{ 0x14, 0x13, 0x1d, 0x13, },
+	{ 0x14, 0x13, 0x1d, 0x13, },
+	{ 0x14, 0x93, 0x1d, 0x17, },
+	{ 0x14, 0x93, 0x1d, 0x17, },
+	{ 0x14, 0x93, 0x1d, 0x17, },
+	{ 0x16, 0x93, 0x1d, 0x17, },
+	{ 0x16, 0x93, 0x1d, 0x17, },
+};
+
+const uint8_t pathLengths[] = {
+	28,
+	21,
+	38,
+	29,
 };
 
-const uint8_t edgeCounts[] = {
-	23,
+#define MAX_PATH_LENGTH 38
+
+const uint8_t vertexCounts[] = {
+	16,
+	11,
 	18,
-	35,
-	24,
+	13,
 };
 
+#define MAX_VERTEX_COUNT 18
+
+#define DELTA_VERTICES
+#define KEY_INTERVAL 32
+
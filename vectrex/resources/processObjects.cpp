@@ -6,18 +6,314 @@
 #include <sstream>
 #include <set>
 #include <map>
+#include <limits>
+#include <algorithm>
 
 struct Object {
 	std::vector<uint> edges;
 	std::vector<float> vertices;
+	std::vector<std::vector<int>> faces;
 	unsigned int vCount = 0;
 	unsigned int eCount = 0;
 };
 
+// Beam path: vertex ids, with a flag set when the beam moves to the vertex instead of drawing.
+struct PathPoint {
+	unsigned int id;
+	bool move;
+};
+
+// Chain the edges of an object into the minimal number of trails: each connected component needs one trail
+// per pair of odd-degree vertices (or one closed trail if there are none). Odd vertices are paired with
+// virtual edges, greedily by distance, and an Euler circuit of the resulting graph is split at the virtual edges.
+// Trails are then ordered greedily, jumping each time to the closest trail endpoint.
+std::vector<PathPoint> buildPath(const Object& obj, const std::vector<float>& positions){
+
+	auto distance = [&positions](unsigned int a, unsigned int b){
+		float d = 0.0f;
+		for(int j = 0; j < 3; ++j){
+			const float delta = positions[3 * a + j] - positions[3 * b + j];
+			d += delta * delta;
+		}
+		return d;
+	};
+
+	// Adjacency: for each vertex, list of (neighbour, edge id).
+	std::vector<std::vector<std::pair<unsigned int, unsigned int>>> adjacency(obj.vCount);
+	std::vector<bool> virtualEdges;
+	auto addEdge = [&adjacency, &virtualEdges](unsigned int v0, unsigned int v1, bool isVirtual){
+		const unsigned int eid = virtualEdges.size();
+		adjacency[v0].emplace_back(v1, eid);
+		adjacency[v1].emplace_back(v0, eid);
+		virtualEdges.push_back(isVirtual);
+	};
+	for(size_t i = 0; i < obj.edges.size(); i += 2){
+		addEdge(obj.edges[i], obj.edges[i+1], false);
+	}
+
+	// Connected components.
+	std::vector<int> components(obj.vCount, -1);
+	int componentCount = 0;
+	for(unsigned int v = 0; v < obj.vCount; ++v){
+		if(components[v] >= 0 || adjacency[v].empty()){
+			continue;
+		}
+		std::vector<unsigned int> stack(1, v);
+		components[v] = componentCount;
+		while(!stack.empty()){
+			const unsigned int current = stack.back();
+			stack.pop_back();
+			for(const auto& neighbour : adjacency[current]){
+				if(components[neighbour.first] < 0){
+					components[neighbour.first] = componentCount;
+					stack.push_back(neighbour.first);
+				}
+			}
+		}
+		++componentCount;
+	}
+
+	// Pair odd vertices in each component.
+	for(int c = 0; c < componentCount; ++c){
+		std::vector<unsigned int> odds;
+		for(unsigned int v = 0; v < obj.vCount; ++v){
+			if(components[v] == c && (adjacency[v].size() % 2) == 1){
+				odds.push_back(v);
+			}
+		}
+		while(!odds.empty()){
+			const unsigned int v0 = odds.back();
+			odds.pop_back();
+			size_t closest = 0;
+			for(size_t o = 1; o < odds.size(); ++o){
+				if(distance(v0, odds[o]) < distance(v0, odds[closest])){
+					closest = o;
+				}
+			}
+			addEdge(v0, odds[closest], true);
+			odds.erase(odds.begin() + closest);
+		}
+	}
+
+	// Euler circuit of each component (Hierholzer), split in trails at virtual edges.
+	std::vector<std::vector<unsigned int>> trails;
+	std::vector<bool> usedEdges(virtualEdges.size(), false);
+	std::vector<size_t> nextEdge(obj.vCount, 0);
+	for(int c = 0; c < componentCount; ++c){
+		unsigned int start = 0;
+		while(components[start] != c){
+			++start;
+		}
+		// Vertices of the circuit, and the edge used to reach each of them.
+		std::vector<std::pair<unsigned int, int>> stack(1, std::make_pair(start, -1));
+		std::vector<std::pair<unsigned int, int>> circuit;
+		while(!stack.empty()){
+			const unsigned int current = stack.back().first;
+			size_t& next = nextEdge[current];
+			while(next < adjacency[current].size() && usedEdges[adjacency[current][next].second]){
+				++next;
+			}
+			if(next == adjacency[current].size()){
+				circuit.push_back(stack.back());
+				stack.pop_back();
+			} else {
+				const auto& edge = adjacency[current][next];
+				usedEdges[edge.second] = true;
+				stack.emplace_back(edge.first, edge.second);
+			}
+		}
+		// The circuit is reversed, doesn't matter. Each point was reached from the next one by the edge stored with it.
+		const size_t firstTrail = trails.size();
+		bool split = false;
+		std::vector<unsigned int> trail(1, circuit[0].first);
+		for(size_t i = 1; i < circuit.size(); ++i){
+			const int eid = circuit[i-1].second;
+			if(virtualEdges[eid]){
+				if(trail.size() > 1){
+					trails.push_back(trail);
+				}
+				trail.clear();
+				split = true;
+			}
+			trail.push_back(circuit[i].first);
+		}
+		// The circuit is closed: if it was split, the last trail continues with the first one.
+		if(split && trail.size() > 1 && trails.size() > firstTrail && trail.back() == trails[firstTrail].front()){
+			trail.insert(trail.end(), trails[firstTrail].begin() + 1, trails[firstTrail].end());
+			trails[firstTrail] = trail;
+		} else if(trail.size() > 1){
+			trails.push_back(trail);
+		}
+	}
+
+	// Order trails, starting from the center of the scene.
+	std::vector<PathPoint> path;
+	std::vector<float> beam(3, 0.0f);
+	std::vector<bool> usedTrails(trails.size(), false);
+	for(size_t t = 0; t < trails.size(); ++t){
+		int best = -1;
+		bool reversed = false;
+		float bestDistance = std::numeric_limits<float>::max();
+		for(size_t o = 0; o < trails.size(); ++o){
+			if(usedTrails[o]){
+				continue;
+			}
+			for(int end = 0; end < 2; ++end){
+				const unsigned int v = end == 0 ? trails[o].front() : trails[o].back();
+				float d = 0.0f;
+				for(int j = 0; j < 3; ++j){
+					d += (positions[3 * v + j] - beam[j]) * (positions[3 * v + j] - beam[j]);
+				}
+				if(d < bestDistance){
+					best = o;
+					reversed = end == 1;
+					bestDistance = d;
+				}
+			}
+		}
+		usedTrails[best] = true;
+		std::vector<unsigned int> trail = trails[best];
+		if(reversed){
+			std::reverse(trail.begin(), trail.end());
+		}
+		for(size_t i = 0; i < trail.size(); ++i){
+			path.push_back({trail[i], i == 0});
+		}
+		for(int j = 0; j < 3; ++j){
+			beam[j] = positions[3 * trail.back() + j];
+		}
+	}
+	return path;
+}
+
+enum EdgeType {
+	SILHOUETTE = 0, CREASE, BACK, HIDDEN, TYPE_COUNT
+};
+
+// Classify the path lines for a camera angle, given camera space vertices (x, y, depth).
+// Silhouettes separate a front face from a back face (or border a single face), creases are between two front faces,
+// and the remaining lines only touch back faces; meshes are not closed, so these can still be visible.
+// A line is hidden if none of its samples passes a depth test against the object triangles not containing it.
+std::vector<EdgeType> classifyPath(const Object& obj, const std::vector<PathPoint>& path, const std::vector<float>& camera){
+
+	auto project = [](const float* p, float& x, float& y){
+		x = p[0] / p[2];
+		y = p[1] / p[2];
+	};
+
+	// Facing of each face, from its projected signed area (counter-clockwise is front facing).
+	std::vector<bool> frontFaces(obj.faces.size());
+	for(size_t fid = 0; fid < obj.faces.size(); ++fid){
+		const std::vector<int>& face = obj.faces[fid];
+		float area = 0.0f;
+		for(size_t i = 0; i < face.size(); ++i){
+			float x0, y0, x1, y1;
+			project(&camera[3 * face[i]], x0, y0);
+			project(&camera[3 * face[(i+1) % face.size()]], x1, y1);
+			area += x0 * y1 - x1 * y0;
+		}
+		frontFaces[fid] = area > 0.0f;
+	}
+
+	auto faceHasEdge = [](const std::vector<int>& face, int v0, int v1){
+		for(size_t i = 0; i < face.size(); ++i){
+			const int a = face[i];
+			const int b = face[(i+1) % face.size()];
+			if((a == v0 && b == v1) || (a == v1 && b == v0)){
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Is a camera space point behind a triangle?
+	auto occludes = [&camera, &project](int i0, int i1, int i2, const float* p){
+		float px, py;
+		project(p, px, py);
+		float x[3], y[3];
+		const int ids[3] = {i0, i1, i2};
+		for(int j = 0; j < 3; ++j){
+			project(&camera[3 * ids[j]], x[j], y[j]);
+		}
+		const float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+		if(std::abs(area) < 1e-8f){
+			return false;
+		}
+		float b[3];
+		b[0] = ((x[1] - px) * (y[2] - py) - (x[2] - px) * (y[1] - py)) / area;
+		b[1] = ((x[2] - px) * (y[0] - py) - (x[0] - px) * (y[2] - py)) / area;
+		b[2] = 1.0f - b[0] - b[1];
+		if(b[0] < 0.0f || b[1] < 0.0f || b[2] < 0.0f){
+			return false;
+		}
+		// Perspective correct depth.
+		float invDepth = 0.0f;
+		for(int j = 0; j < 3; ++j){
+			invDepth += b[j] / camera[3 * ids[j] + 2];
+		}
+		const float depthEpsilon = 0.5f;
+		return 1.0f / invDepth < p[2] - depthEpsilon;
+	};
+
+	const int sampleCount = 8;
+	std::vector<EdgeType> types(path.size(), HIDDEN);
+	for(size_t pid = 1; pid < path.size(); ++pid){
+		if(path[pid].move){
+			continue;
+		}
+		const int v0 = path[pid-1].id;
+		const int v1 = path[pid].id;
+
+		bool visible = false;
+		for(int sid = 0; sid < sampleCount && !visible; ++sid){
+			const float t = (float(sid) + 0.5f) / float(sampleCount);
+			float sample[3];
+			for(int j = 0; j < 3; ++j){
+				sample[j] = (1.0f - t) * camera[3 * v0 + j] + t * camera[3 * v1 + j];
+			}
+			bool occluded = false;
+			for(size_t fid = 0; fid < obj.faces.size() && !occluded; ++fid){
+				const std::vector<int>& face = obj.faces[fid];
+				if(faceHasEdge(face, v0, v1)){
+					continue;
+				}
+				// Faces are triangulated as fans.
+				for(size_t i = 2; i < face.size() && !occluded; ++i){
+					occluded = occludes(face[0], face[i-1], face[i], sample);
+				}
+			}
+			visible = !occluded;
+		}
+		if(!visible){
+			continue;
+		}
+
+		int frontCount = 0;
+		int faceCount = 0;
+		for(size_t fid = 0; fid < obj.faces.size(); ++fid){
+			if(faceHasEdge(obj.faces[fid], v0, v1)){
+				++faceCount;
+				frontCount += frontFaces[fid] ? 1 : 0;
+			}
+		}
+		if(frontCount == 0){
+			types[pid] = BACK;
+		} else if(frontCount == faceCount && faceCount > 1){
+			types[pid] = CREASE;
+		} else {
+			types[pid] = SILHOUETTE;
+		}
+	}
+	return types;
+}
+
 int main(int argc, char** argv){
 	
 	std::vector<Object> objects;
 
+	// Store vertices as keyframes and per-angle deltas.
+	bool deltaVertices = false;
+
 	// Inset an edge while ensuring uniqueness.
 	auto insertEdge = [](std::set<std::pair<int, int>>& e, int v0, int v1){
 		if (v0 < v1){
@@ -39,11 +335,15 @@ int main(int argc, char** argv){
 	// Parse all OBJs.
 	for(int i = 1; i < argc; ++i){
 		const std::string path(argv[i]);
+		if(path == "--delta"){
+			deltaVertices = true;
+			continue;
+		}
 		std::ifstream file(path);
 
 		if(!file.is_open()){
 			std::cerr << "Unable to open file at path " << path << "." << std::endl;
-			continue;
+			return 1;
 		}
 
 		// Create new object.
@@ -79,6 +379,7 @@ int main(int argc, char** argv){
 				while(std::getline(lineS, ll, ' ')){
 					ids.push_back(std::stoi(ll) - 1);
 				}
+				obj.faces.push_back(ids);
 				// Add all edges in set.
 				for(unsigned int eid = 0; eid < ids.size(); ++eid){
 					const unsigned int eidNext = (eid+1) % ids.size();
@@ -100,6 +401,12 @@ int main(int argc, char** argv){
 	}
 
 	const size_t angleCount = 128;
+	// Angles between two vertex keyframes, in delta mode.
+	const size_t keyInterval = 32;
+	std::vector<unsigned int> pathLengths;
+	std::vector<unsigned int> vertexCounts;
+	size_t fullVerticesSize = 0;
+	size_t storedVerticesSize = 0;
 	const float defaultRadius = 384.0f;
 
 	for(size_t k = 0; k < objects.size(); ++k){
@@ -109,7 +416,17 @@ int main(int argc, char** argv){
 		const unsigned int vertex3DCount = obj.vCount * 3;
 		const unsigned int vertex2DCount = obj.vCount * 2;
 
+		// Vertex positions normalized in the bounding box, in -127,127.
+		std::vector<float> positions(vertex3DCount);
+		for(size_t i = 0; i < vertex3DCount; i+=3){
+			for(int j = 0; j < 3; ++j){
+				const float xyz = (obj.vertices[i+j] - mini[j]) / (maxi[j] - mini[j]);
+				positions[i+j] = 127.0f * (2.f * xyz - 1.f);
+			}
+		}
+
 		std::vector<std::vector<int>> perAngleScreenVertices(angleCount);
+		std::vector<std::vector<float>> perAngleCameraVertices(angleCount);
 
 		// For each angle, generate screen space vertices.
 		for(size_t aId = 0; aId < angleCount; ++aId){
@@ -122,14 +439,14 @@ int main(int argc, char** argv){
 			const float cz = defaultRadius * si;
 
 			perAngleScreenVertices[aId].resize( vertex2DCount );
+			perAngleCameraVertices[aId].reserve( vertex3DCount );
 			size_t d2Index = 0;
 
 			for(size_t i = 0; i < vertex3DCount; i+=3){
 				// Normalize vertex coordinates in bouding box, and move to -127,127.
 				float xyz[3];
 				for(int j = 0; j < 3; ++j){
-					xyz[j] = (obj.vertices[i+j] - mini[j]) / (maxi[j] - mini[j]);
-					xyz[j] = 127.0f * (2.f * xyz[j] - 1.f);
+					xyz[j] = positions[i+j];
 				}
 				// Move to camera space.
 				xyz[0] = xyz[0] - cx;
@@ -139,6 +456,10 @@ int main(int argc, char** argv){
 				const float rx =  si * xyz[0] + co * xyz[2];
 				const float rz = -co * xyz[0] + si * xyz[2];
 
+				perAngleCameraVertices[aId].push_back(rx);
+				perAngleCameraVertices[aId].push_back(xyz[1]);
+				perAngleCameraVertices[aId].push_back(rz);
+
 				// Perspective division.
 				const float dx = 127.0f * rx / rz;
 				const float dy = 127.0f * xyz[1] / rz;
@@ -152,50 +473,152 @@ int main(int argc, char** argv){
 		}
 
 		// Output vertices.
-		std::cout << "const int8_t vertices" << k << "[][" << vertex2DCount << "] = { " << "\n";
+		vertexCounts.push_back(obj.vCount);
+		fullVerticesSize += angleCount * vertex2DCount;
 
-		for(size_t aId = 0; aId < angleCount; ++aId){
-			// For each angle.
-			std::cout << "\t{" << "\n";
+		if(deltaVertices){
+			// Keyframes, in the same layout as the full vertices.
+			std::cout << "const int8_t keys" << k << "[][" << vertex2DCount << "] = { " << "\n";
+
+			for(size_t aId = 0; aId < angleCount; aId += keyInterval){
+				std::cout << "\t{" << "\n";
+
+				const auto& screenVerts = perAngleScreenVertices[aId];
+				for(size_t v = 0; v < vertex2DCount; v += 2){
+					// Y first.
+					std::cout << "\t\t" << screenVerts[v+1] << ", " << screenVerts[v] << ", "  << "\n";
+				}
+
+				std::cout << "\t}," << "\n";
+			}
+
+			std::cout << "};" << "\n";
+
+			// Deltas from the previous angle, packed as two signed nibbles per vertex.
+			std::cout << "const uint8_t deltas" << k << "[][" << obj.vCount << "] = { " << "\n";
+
+			std::cout << std::hex;
+			for(size_t aId = 0; aId < angleCount; ++aId){
+				const auto& screenVerts = perAngleScreenVertices[aId];
+				const auto& prevScreenVerts = perAngleScreenVertices[(aId + angleCount - 1) % angleCount];
+				std::cout << "\t{ ";
+				for(size_t v = 0; v < vertex2DCount; v += 2){
+					const int dy = screenVerts[v+1] - prevScreenVerts[v+1];
+					const int dx = screenVerts[v] - prevScreenVerts[v];
+					if(dy < -8 || dy > 7 || dx < -8 || dx > 7){
+						std::cerr << "Object " << k << ": vertex delta (" << dy << ", " << dx << ") at angle " << aId << " does not fit in 4 bits." << std::endl;
+						return 1;
+					}
+					// Y first.
+					std::cout << "0x" << (((dy & 0xF) << 4) | (dx & 0xF)) << ", ";
+				}
+				std::cout << "}," << "\n";
+			}
+			std::cout << std::dec;
+
+			std::cout << "};" << "\n";
+
+			storedVerticesSize += (angleCount / keyInterval) * vertex2DCount + angleCount * obj.vCount;
+
+		} else {
+			std::cout << "const int8_t vertices" << k << "[][" << vertex2DCount << "] = { " << "\n";
+
+			for(size_t aId = 0; aId < angleCount; ++aId){
+				// For each angle.
+				std::cout << "\t{" << "\n";
+
+				const auto& screenVerts = perAngleScreenVertices[aId];
+				for(size_t v = 0; v < vertex2DCount; v += 2){
+					// Y first.
+					std::cout << "\t\t" << screenVerts[v+1] << ", " << screenVerts[v] << ", "  << "\n";
+				}
 
-			const auto& screenVerts = perAngleScreenVertices[aId];
-			for(size_t v = 0; v < vertex2DCount; v += 2){
-				// Y first.
-				std::cout << "\t\t" << screenVerts[v+1] << ", " << screenVerts[v] << ", "  << "\n";
+				std::cout << "\t}," << "\n";
 			}
 
-			std::cout << "\t}," << "\n";
+			std::cout << "};" << "\n";
+
+			storedVerticesSize += angleCount * vertex2DCount;
 		}
 
-		std::cout << "};" << "\n";
+		// Output beam path.
+		const std::vector<PathPoint> path = buildPath(obj, positions);
+		unsigned int moveCount = 0;
+		std::cout << "const uint8_t path" << k << "[] = { " << "\n";
 
-		// Output edge vertex indices.
-		std::cout << "const uint16_t edges" << k << "[] = { " << "\n";
-		
 		std::cout << std::hex;
-		for(size_t i = 0; i < obj.edges.size(); i+=2){
-			// Premultiply by 2.
-			const unsigned int doubleId0 = 2 * obj.edges[i];
-			const unsigned int doubleId1 = 2 * obj.edges[i+1];
-			// Pack in 16 bits
-			const unsigned int packedIds = (doubleId0 << 8) | doubleId1;
+		for(const auto& point : path){
+			// Premultiply by 2, and store the move flag in the lowest bit.
+			const unsigned int packedId = (2 * point.id) | (point.move ? 1 : 0);
+			moveCount += point.move ? 1 : 0;
 			// Store as hex.
-			std::cout << "\t0x" << packedIds << ", \n";
+			std::cout << "\t0x" << packedId << ", \n";
+		}
+		std::cout << std::dec;
+
+		std::cout << "};" << "\n\n";
+
+		pathLengths.push_back(path.size());
+		std::cerr << "Object " << k << ": " << obj.eCount << " edges, " << moveCount << " moves for " << (path.size() - moveCount) << " draws";
+		std::cerr << " (move/draw ratio " << (float(moveCount) / float(path.size() - moveCount)) << ", was 1)." << std::endl;
+
+		// Output visible lines.
+		const unsigned int maskSize = (path.size() + 7) / 8;
+		unsigned int typeCounts[TYPE_COUNT] = {0};
+		std::cout << "const uint8_t visible" << k << "[][" << maskSize << "] = { " << "\n";
+
+		std::cout << std::hex;
+		for(size_t aId = 0; aId < angleCount; ++aId){
+			// One bit per path point, set if the beam draws to the point.
+			const std::vector<EdgeType> types = classifyPath(obj, path, perAngleCameraVertices[aId]);
+			std::vector<unsigned int> mask(maskSize, 0);
+			for(size_t pid = 0; pid < path.size(); ++pid){
+				if(path[pid].move){
+					continue;
+				}
+				++typeCounts[types[pid]];
+				if(types[pid] != HIDDEN){
+					mask[pid / 8] |= 1 << (pid % 8);
+				}
+			}
+			std::cout << "\t{ ";
+			for(const auto& byte : mask){
+				std::cout << "0x" << byte << ", ";
+			}
+			std::cout << "}," << "\n";
 		}
 		std::cout << std::dec;
 
 		std::cout << "};" << "\n\n";
 
+		std::cerr << "\tper angle: " << float(typeCounts[SILHOUETTE]) / angleCount << " silhouette, " << float(typeCounts[CREASE]) / angleCount << " crease, ";
+		std::cerr << float(typeCounts[BACK]) / angleCount << " back facing, " << float(typeCounts[HIDDEN]) / angleCount << " hidden lines." << std::endl;
+
 	}
 
 	
-	std::cout << "const uint8_t edgeCounts[] = {\n";
-	for(const auto & obj : objects){
-		std::cout << "\t" << obj.eCount << "," << std::endl;
+	std::cout << "const uint8_t pathLengths[] = {\n";
+	for(const auto & length : pathLengths){
+		std::cout << "\t" << length << "," << std::endl;
 	}
 	std::cout << "};\n\n";
 	
+	std::cout << "#define MAX_PATH_LENGTH " << *std::max_element(pathLengths.begin(), pathLengths.end()) << "\n\n";
+
+	std::cout << "const uint8_t vertexCounts[] = {\n";
+	for(const auto & count : vertexCounts){
+		std::cout << "\t" << count << "," << std::endl;
+	}
+	std::cout << "};\n\n";
+
+	std::cout << "#define MAX_VERTEX_COUNT " << *std::max_element(vertexCounts.begin(), vertexCounts.end()) << "\n\n";
+
+	if(deltaVertices){
+		std::cout << "#define DELTA_VERTICES" << "\n";
+		std::cout << "#define KEY_INTERVAL " << keyInterval << "\n\n";
+	}
+
+	std::cerr << "Vertices: " << storedVerticesSize << " bytes of ROM, instead of " << fullVerticesSize << " bytes for full tables." << std::endl;
 	
-	
-	return 0;
+		return 0;
 }
@@ -2,4 +2,10 @@ C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/object.vert.spv ob
 C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/object.frag.spv object.frag
 C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/skybox.vert.spv skybox.vert
 C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/skybox.frag.spv skybox.frag
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/shadow.vert.spv shadow.vert
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/object_indirect.vert.spv object_indirect.vert
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/object_indirect.frag.spv object_indirect.frag
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/shadow_indirect.vert.spv shadow_indirect.vert
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/cull.comp.spv cull.comp
+C:/VulkanSDK/1.1.77.0/Bin/glslangValidator.exe -V -o compiled/mipmap.comp.spv mipmap.comp
 pause
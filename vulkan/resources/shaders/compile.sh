@@ -3,3 +3,8 @@
 /Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/skybox.vert.spv skybox.vert
 /Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/skybox.frag.spv skybox.frag
 /Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/shadow.vert.spv shadow.vert
+/Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/object_indirect.vert.spv object_indirect.vert
+/Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/object_indirect.frag.spv object_indirect.frag
+/Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/shadow_indirect.vert.spv shadow_indirect.vert
+/Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/cull.comp.spv cull.comp
+/Developer/VulkanSDK/macOS/Bin/glslangValidator -V -o compiled/mipmap.comp.spv mipmap.comp
@@ -3,19 +3,23 @@
 
 layout(location = 0) in vec3 fragViewSpacePos;
 layout(location = 1) in vec2 fragUv;
-layout(location = 2) in vec4 fragLightSpacePos;
+layout(location = 2) in vec3 fragWorldPos;
 layout(location = 3) in mat3 fragTbn;
 
-layout(binding = 1) uniform sampler2D colorMap;
-layout(binding = 2) uniform sampler2D normalMap;
-layout(binding = 4) uniform sampler2D shadowMap;
+layout(set = 1, binding = 0) uniform sampler2D colorMap;
+layout(set = 1, binding = 1) uniform sampler2D normalMap;
+layout(set = 0, binding = 3) uniform sampler2DArray shadowMap;
 
-layout(binding = 3) uniform LightInfos {
-	mat4 viewproj;
+// Should match SHADOW_CASCADES in common.hpp.
+#define CASCADES 3
+
+layout(set = 0, binding = 1) uniform LightInfos {
+	mat4 viewprojs[CASCADES];
+	vec4 splits;
 	vec3 viewSpaceDir;
 } light;
 
-layout(push_constant) uniform ModelInfos {
+layout(set = 0, binding = 2) uniform ModelInfos {
 	mat4 model;
 	float shininess;
 } object;
@@ -23,13 +27,22 @@ layout(push_constant) uniform ModelInfos {
 layout(location = 0) out vec4 outColor;
 
 float estimateShadowing(){
-	vec3 lightSpaceNdc = fragLightSpacePos.xyz/fragLightSpacePos.w;
-	if(any(greaterThan(abs(lightSpaceNdc), vec3(1.0)))){
+	// Find the cascade containing the fragment.
+	float depth = -fragViewSpacePos.z;
+	int cascade = 0;
+	for(int i = 0; i < CASCADES - 1; ++i){
+		if(depth > light.splits[i]){
+			cascade = i + 1;
+		}
+	}
+	vec4 lightSpacePos = light.viewprojs[cascade] * vec4(fragWorldPos, 1.0);
+	vec3 lightSpaceNdc = lightSpacePos.xyz/lightSpacePos.w;
+	if(depth > light.splits[CASCADES - 1] || any(greaterThan(abs(lightSpaceNdc), vec3(1.0)))){
 		return 1.0;
 	}
 	vec2 shadowUV = lightSpaceNdc.xy * 0.5 + 0.5;
 	// Read both depths.
-	float lightDepth = texture(shadowMap, shadowUV).r;
+	float lightDepth = texture(shadowMap, vec3(shadowUV, float(cascade))).r;
 	// Compare depth.
 	if(lightSpaceNdc.z < lightDepth){
 		// We are not in shadow is the point is closer than the corresponding point in the shadow map.
@@ -7,24 +7,19 @@ layout(location = 2) in vec3 inTangent;
 layout(location = 3) in vec3 inBitangent;
 layout(location = 4) in vec2 inTexCoord;
 
-layout(binding = 0) uniform CameraInfos {
+layout(set = 0, binding = 0) uniform CameraInfos {
     mat4 view;
     mat4 proj;
 } cam;
 
-layout(binding = 3) uniform LightInfos {
-	mat4 viewproj;
-	vec3 viewSpaceDir;
-} light;
-
-layout(push_constant) uniform ModelInfos {
+layout(set = 0, binding = 2) uniform ModelInfos {
 	mat4 model;
 	float shininess;
 } object;
 
 layout(location = 0) out vec3 fragViewSpacePos;
 layout(location = 1) out vec2 fragUv;
-layout(location = 2) out vec4 fragLightSpacePos;
+layout(location = 2) out vec3 fragWorldPos;
 layout(location = 3) out mat3 fragTbn;
 
 
@@ -45,7 +40,7 @@ void main() {
 	fragUv = inTexCoord;
 	fragTbn = mat3(T, B, N);
 	
-	fragLightSpacePos = light.viewproj * object.model * vec4(inPosition, 1.0);
+	fragWorldPos = (object.model * vec4(inPosition, 1.0)).xyz;
 	
 	gl_Position = cam.proj * viewSpacePos;
 	
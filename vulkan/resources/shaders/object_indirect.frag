@@ -0,0 +1,83 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+// Should match MAX_INDIRECT_MATERIALS in common.hpp.
+#define MAX_MATERIALS 16
+
+layout(location = 0) in vec3 fragViewSpacePos;
+layout(location = 1) in vec2 fragUv;
+layout(location = 2) in vec3 fragWorldPos;
+layout(location = 3) in mat3 fragTbn;
+layout(location = 6) flat in uint fragMaterial;
+layout(location = 7) flat in float fragShininess;
+
+// Color and normal maps of each material, interleaved.
+layout(set = 1, binding = 1) uniform sampler2D textures[2*MAX_MATERIALS];
+layout(set = 0, binding = 3) uniform sampler2DArray shadowMap;
+
+// Should match SHADOW_CASCADES in common.hpp.
+#define CASCADES 3
+
+layout(set = 0, binding = 1) uniform LightInfos {
+	mat4 viewprojs[CASCADES];
+	vec4 splits;
+	vec3 viewSpaceDir;
+} light;
+
+layout(location = 0) out vec4 outColor;
+
+float estimateShadowing(){
+	// Find the cascade containing the fragment.
+	float depth = -fragViewSpacePos.z;
+	int cascade = 0;
+	for(int i = 0; i < CASCADES - 1; ++i){
+		if(depth > light.splits[i]){
+			cascade = i + 1;
+		}
+	}
+	vec4 lightSpacePos = light.viewprojs[cascade] * vec4(fragWorldPos, 1.0);
+	vec3 lightSpaceNdc = lightSpacePos.xyz/lightSpacePos.w;
+	if(depth > light.splits[CASCADES - 1] || any(greaterThan(abs(lightSpaceNdc), vec3(1.0)))){
+		return 1.0;
+	}
+	vec2 shadowUV = lightSpaceNdc.xy * 0.5 + 0.5;
+	// Read both depths.
+	float lightDepth = texture(shadowMap, vec3(shadowUV, float(cascade))).r;
+	// Compare depth.
+	if(lightSpaceNdc.z < lightDepth){
+		// We are not in shadow is the point is closer than the corresponding point in the shadow map.
+		return 1.0;
+	}
+	return 0.0;
+}
+
+
+void main() {
+	// Base color.
+	vec3 albedo = texture(textures[2*fragMaterial], fragUv).rgb;
+	
+	// Compute normal in view space.
+	vec3 n = normalize(2.0 * texture(textures[2*fragMaterial+1], fragUv).rgb - 1.0);
+	n = normalize(fragTbn * n);
+	// Light dir.
+	vec3 l = vec3(normalize(light.viewSpaceDir));
+	
+	// Shadowing
+	float shadowFactor = estimateShadowing();
+	
+	// Phong lighting.
+	// Ambient term.
+	vec3 color = 0.1 * albedo;
+	// Diffuse term.
+	float diffuse = max(0.0, dot(n, l));
+	color += shadowFactor * diffuse * albedo;
+	// Specular term.
+	if(diffuse > 0.0){
+		vec3 v = normalize(-fragViewSpacePos);
+		vec3 r = reflect(-l, n);
+		float specular = pow(max(dot(r, v), 0.0), fragShininess);
+		color += shadowFactor*specular;
+	}
+	outColor = vec4(color,1.0);
+	
+}
@@ -0,0 +1,65 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec3 inTangent;
+layout(location = 3) in vec3 inBitangent;
+layout(location = 4) in vec2 inTexCoord;
+
+struct InstanceInfos {
+	mat4 model;
+	vec4 bounds;
+	uint indexCount;
+	uint firstIndex;
+	int vertexOffset;
+	uint material;
+	float shininess;
+	uint flags;
+	uint pad0;
+	uint pad1;
+};
+
+layout(set = 0, binding = 0) uniform CameraInfos {
+    mat4 view;
+    mat4 proj;
+} cam;
+
+layout(set = 1, binding = 0) readonly buffer Instances {
+	InstanceInfos instances[];
+};
+
+layout(location = 0) out vec3 fragViewSpacePos;
+layout(location = 1) out vec2 fragUv;
+layout(location = 2) out vec3 fragWorldPos;
+layout(location = 3) out mat3 fragTbn;
+layout(location = 6) flat out uint fragMaterial;
+layout(location = 7) flat out float fragShininess;
+
+
+out gl_PerVertex {
+	vec4 gl_Position;
+};
+
+void main() {
+	// The culling pass stored the instance index as the first instance.
+	InstanceInfos instance = instances[gl_InstanceIndex];
+	
+	mat4 modelView = cam.view * instance.model;
+	mat3 normalMat = transpose(inverse(mat3(modelView)));
+	vec3 T = normalize(normalMat * inTangent);
+	vec3 B = normalize(normalMat * inBitangent);
+	vec3 N = normalize(normalMat * inNormal);
+	
+	vec4 viewSpacePos = modelView * vec4(inPosition, 1.0);
+	fragViewSpacePos = viewSpacePos.xyz;
+	fragUv = inTexCoord;
+	fragTbn = mat3(T, B, N);
+	fragMaterial = instance.material;
+	fragShininess = instance.shininess;
+	
+	fragWorldPos = (instance.model * vec4(inPosition, 1.0)).xyz;
+	
+	gl_Position = cam.proj * viewSpacePos;
+	
+}
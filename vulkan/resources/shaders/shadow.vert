@@ -7,12 +7,11 @@ layout(location = 2) in vec3 inTangent;
 layout(location = 3) in vec3 inBitangent;
 layout(location = 4) in vec2 inTexCoord;
 
-layout(binding = 0) uniform LightInfos {
+layout(set = 0, binding = 0) uniform CascadeInfos {
 	mat4 viewproj;
-	vec3 viewSpaceDir;
-} light;
+} cascade;
 
-layout(push_constant) uniform ModelInfos {
+layout(set = 0, binding = 1) uniform ModelInfos {
 	mat4 model;
 	float shininess;
 } object;
@@ -22,5 +21,5 @@ out gl_PerVertex {
 };
 
 void main() {
-	gl_Position = light.viewproj * object.model * vec4(inPosition, 1.0);
+	gl_Position = cascade.viewproj * object.model * vec4(inPosition, 1.0);
 }
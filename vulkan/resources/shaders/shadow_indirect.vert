@@ -0,0 +1,37 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec3 inTangent;
+layout(location = 3) in vec3 inBitangent;
+layout(location = 4) in vec2 inTexCoord;
+
+struct InstanceInfos {
+	mat4 model;
+	vec4 bounds;
+	uint indexCount;
+	uint firstIndex;
+	int vertexOffset;
+	uint material;
+	float shininess;
+	uint flags;
+	uint pad0;
+	uint pad1;
+};
+
+layout(set = 0, binding = 0) uniform CascadeInfos {
+	mat4 viewproj;
+} cascade;
+
+layout(set = 1, binding = 0) readonly buffer Instances {
+	InstanceInfos instances[];
+};
+
+out gl_PerVertex {
+	vec4 gl_Position;
+};
+
+void main() {
+	gl_Position = cascade.viewproj * instances[gl_InstanceIndex].model * vec4(inPosition, 1.0);
+}
@@ -3,7 +3,7 @@
 
 layout(location = 0) in vec3 fragUv;
 
-layout(binding = 1) uniform samplerCube colorMap;
+layout(set = 1, binding = 0) uniform samplerCube colorMap;
 
 layout(location = 0) out vec4 outColor;
 
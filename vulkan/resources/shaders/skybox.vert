@@ -7,12 +7,12 @@ layout(location = 2) in vec3 inTangent;
 layout(location = 3) in vec3 inBitangent;
 layout(location = 4) in vec2 inTexCoord;
 
-layout(binding = 0) uniform CameraInfos {
+layout(set = 0, binding = 0) uniform CameraInfos {
     mat4 view;
     mat4 proj;
 } cam;
 
-layout(push_constant) uniform ModelInfos {
+layout(set = 0, binding = 2) uniform ModelInfos {
 	mat4 model;
 	float shininess;
 } object;
@@ -0,0 +1,180 @@
+#include "Benchmark.hpp"
+#include "Swapchain.hpp"
+#include "Renderer.hpp"
+#include "VulkanUtilities.hpp"
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <new>
+#include <sstream>
+
+/// Allocations tracking.
+// Replacing the global allocation functions is the only portable way to count them,
+// the cost of the atomic increment is negligible compared to the allocation itself.
+
+static std::atomic<uint64_t> allocationCount(0);
+
+void * operator new(size_t size){
+	++allocationCount;
+	void * ptr = std::malloc(size > 0 ? size : 1);
+	if(!ptr){
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void * operator new[](size_t size){
+	++allocationCount;
+	void * ptr = std::malloc(size > 0 ? size : 1);
+	if(!ptr){
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void * ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept {
+	std::free(ptr);
+}
+
+uint64_t Benchmark::allocations(){
+	return allocationCount.load();
+}
+
+/// Statistics.
+
+static void printStatistics(const std::string & name, std::vector<double> values){
+	if(values.empty()){
+		std::cout << name << ": unavailable" << std::endl;
+		return;
+	}
+	std::sort(values.begin(), values.end());
+	double total = 0.0;
+	for(const double value : values){
+		total += value;
+	}
+	const double percentile95 = values[std::min(values.size() - 1, (values.size() * 95) / 100)];
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << name << ": avg " << total / double(values.size()) << ", median " << values[values.size() / 2] << ", p95 " << percentile95 << ", min " << values.front() << ", max " << values.back() << std::endl;
+	std::cout.unsetf(std::ios::floatfield);
+}
+
+int Benchmark::run(const Options & options){
+
+	/// Vulkan instance creation, no window extensions.
+	VkInstance instance;
+	if(VulkanUtilities::createInstance("Dragon Vulkan Benchmark", options.debug, true, instance) != 0){
+		return 3;
+	}
+
+	/// Offscreen swapchain.
+	VkSurfaceKHR surface = VK_NULL_HANDLE;
+	Swapchain swapchain(instance, surface, options.width, options.height);
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(swapchain.physicalDevice, &properties);
+	std::cout << "Benchmarking on " << properties.deviceName << ", " << options.frames << " frames at " << options.width << "x" << options.height << "." << std::endl;
+	if(!swapchain.timestamps){
+		std::cerr << "Timestamps not supported, GPU time will be unavailable." << std::endl;
+	}
+
+	/// Create the renderer.
+	Renderer renderer(swapchain, options.width, options.height);
+	renderer.useCameraPath();
+
+	// Fixed timestep so that each frame is identical from run to run.
+	const double frameTime = 1.0 / 60.0;
+	std::vector<double> cpuTimes;
+	std::vector<double> gpuTimes;
+	std::vector<double> frameAllocations;
+	std::vector<bool> pending(swapchain.count, false);
+	std::vector<unsigned char> pixels;
+	VkRenderPassBeginInfo finalPassInfos;
+
+	/// Main loop.
+	for(uint32_t frame = 0; frame < options.frames; ++frame){
+		// Waits for the previous frame using the same image.
+		VkResult status = swapchain.begin(finalPassInfos);
+		if(status != VK_SUCCESS){
+			std::cerr << "Error while rendering." << std::endl;
+			break;
+		}
+		const uint32_t index = swapchain.imageIndex;
+		if(pending[index]){
+			const double gpuTime = renderer.gpuTime(index);
+			if(gpuTime >= 0.0){
+				gpuTimes.push_back(gpuTime);
+			}
+			pending[index] = false;
+		}
+
+		// Measure the CPU side of the frame: update and encoding.
+		const uint64_t allocationsStart = allocations();
+		const auto start = std::chrono::high_resolution_clock::now();
+		renderer.update(frameTime);
+		renderer.encode(swapchain.graphicsQueue, index, swapchain.getCommandBuffer(), finalPassInfos, swapchain.getStartSemaphore(), swapchain.getEndSemaphore(), swapchain.getFence());
+		const auto end = std::chrono::high_resolution_clock::now();
+		cpuTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+		frameAllocations.push_back(double(allocations() - allocationsStart));
+		pending[index] = true;
+		swapchain.commit();
+
+		// Dump frames for regression tests.
+		const bool lastFrame = (frame + 1 == options.frames);
+		const bool dumpFrame = !options.dumpDirectory.empty() && (lastFrame || (options.dumpStep > 0 && frame % options.dumpStep == 0));
+		if(dumpFrame){
+			vkWaitForFences(swapchain.device, 1, &swapchain.getFence(), VK_TRUE, std::numeric_limits<uint64_t>::max());
+			swapchain.readback(pixels);
+			std::stringstream path;
+			path << options.dumpDirectory << "/frame_" << std::setfill('0') << std::setw(4) << frame << ".ppm";
+			writePPM(path.str(), options.width, options.height, pixels);
+		}
+		swapchain.step();
+	}
+
+	// Collect the last timings.
+	vkDeviceWaitIdle(swapchain.device);
+	for(uint32_t index = 0; index < swapchain.count; ++index){
+		if(pending[index]){
+			const double gpuTime = renderer.gpuTime(index);
+			if(gpuTime >= 0.0){
+				gpuTimes.push_back(gpuTime);
+			}
+		}
+	}
+
+	/// Report.
+	printStatistics("CPU encode (ms)", cpuTimes);
+	printStatistics("GPU frame (ms)", gpuTimes);
+	printStatistics("Heap allocations per frame", frameAllocations);
+
+	/// Cleanup.
+	renderer.clean();
+	swapchain.clean();
+	VulkanUtilities::cleanupDebug(instance);
+	vkDestroyInstance(instance, nullptr);
+	return 0;
+}
+
+void Benchmark::writePPM(const std::string & path, const uint32_t width, const uint32_t height, const std::vector<unsigned char> & bgra){
+	std::ofstream file(path, std::ios::binary);
+	if(!file.is_open()){
+		std::cerr << "Unable to write frame to " << path << "." << std::endl;
+		return;
+	}
+	file << "P6\n" << width << " " << height << "\n255\n";
+	std::vector<unsigned char> rgb(size_t(width) * height * 3);
+	for(size_t i = 0; i < size_t(width) * height; ++i){
+		rgb[3*i+0] = bgra[4*i+2];
+		rgb[3*i+1] = bgra[4*i+1];
+		rgb[3*i+2] = bgra[4*i+0];
+	}
+	file.write(reinterpret_cast<const char*>(rgb.data()), rgb.size());
+}
@@ -0,0 +1,32 @@
+#ifndef Benchmark_hpp
+#define Benchmark_hpp
+
+#include "common.hpp"
+
+/// Headless benchmark: render the scene offscreen along a fixed camera path, without any window or surface
+/// (so that it runs on software implementations such as lavapipe). Reports CPU encoding time,
+/// GPU time from timestamp queries and heap allocations per frame, and can dump frames as PPM images.
+class Benchmark {
+public:
+
+	struct Options {
+		uint32_t frames = 300;
+		uint32_t width = 1280;
+		uint32_t height = 800;
+		// Frames are dumped in this directory if not empty, every dumpStep frames (and the last one).
+		std::string dumpDirectory;
+		uint32_t dumpStep = 0;
+		bool debug = false;
+	};
+
+	static int run(const Options & options);
+
+	/// Number of heap allocations since the start of the program.
+	static uint64_t allocations();
+
+private:
+
+	static void writePPM(const std::string & path, const uint32_t width, const uint32_t height, const std::vector<unsigned char> & bgra);
+};
+
+#endif /* Benchmark_hpp */
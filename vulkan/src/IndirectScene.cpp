@@ -0,0 +1,308 @@
+#include "IndirectScene.hpp"
+#include "VulkanUtilities.hpp"
+#include "PipelineUtilities.hpp"
+
+#include <array>
+
+IndirectScene::IndirectScene(){
+	_device = VK_NULL_HANDLE;
+	_instanceCount = 0;
+	_drawIndexedIndirectCount = nullptr;
+}
+
+void IndirectScene::init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, const std::vector<Object> & objects, const VkSampler & sampler, const VkBuffer & uniforms, const ShadowPass & shadowPass, const uint32_t count){
+	_device = device;
+	_instanceCount = static_cast<uint32_t>(objects.size());
+	_drawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCountKHR)vkGetDeviceProcAddr(_device, "vkCmdDrawIndexedIndirectCountKHR");
+	if(_drawIndexedIndirectCount == nullptr){
+		std::cerr << "Unable to load vkCmdDrawIndexedIndirectCountKHR." << std::endl;
+	}
+
+	/// Merged geometry.
+	// Each object is placed at an offset in the global buffers, and each instance stores its own range.
+	_instances.resize(_instanceCount);
+	uint32_t vertexCount = 0;
+	uint32_t indexCount = 0;
+	for(size_t i = 0; i < objects.size(); ++i){
+		const auto & object = objects[i];
+		InstanceInfos & instance = _instances[i];
+		instance.model = object.infos.model;
+		instance.bounds = glm::vec4(0.0f, 0.0f, 0.0f, object._radius);
+		instance.indexCount = object._count;
+		instance.firstIndex = indexCount;
+		instance.vertexOffset = static_cast<int32_t>(vertexCount);
+		instance.material = static_cast<uint32_t>(i);
+		instance.shininess = object.infos.shininess;
+		instance.flags = object.animated ? INSTANCE_DYNAMIC : INSTANCE_STATIC;
+		vertexCount += object._vertexCount;
+		indexCount += object._count;
+	}
+	VulkanUtilities::createBuffer(physicalDevice, _device, vertexCount * sizeof(Vertex), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _vertexBuffer, _vertexBufferMemory);
+	VulkanUtilities::createBuffer(physicalDevice, _device, indexCount * sizeof(uint32_t), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _indexBuffer, _indexBufferMemory);
+	// The objects geometry is already on the GPU, copy it in place.
+	VkCommandBuffer commandBuffer = VulkanUtilities::beginOneShotCommandBuffer(_device, commandPool);
+	for(size_t i = 0; i < objects.size(); ++i){
+		const auto & object = objects[i];
+		VkBufferCopy vertexRegion = {};
+		vertexRegion.srcOffset = 0;
+		vertexRegion.dstOffset = _instances[i].vertexOffset * sizeof(Vertex);
+		vertexRegion.size = object._vertexCount * sizeof(Vertex);
+		vkCmdCopyBuffer(commandBuffer, object._vertexBuffer, _vertexBuffer, 1, &vertexRegion);
+		VkBufferCopy indexRegion = {};
+		indexRegion.srcOffset = 0;
+		indexRegion.dstOffset = _instances[i].firstIndex * sizeof(uint32_t);
+		indexRegion.size = object._count * sizeof(uint32_t);
+		vkCmdCopyBuffer(commandBuffer, object._indexBuffer, _indexBuffer, 1, &indexRegion);
+	}
+	VulkanUtilities::endOneShotCommandBuffer(commandBuffer, _device, commandPool, graphicsQueue);
+
+	/// Per frame buffers.
+	const VkDeviceSize instancesSize = _instanceCount * sizeof(InstanceInfos);
+	const VkDeviceSize drawsSize = MAX_CULL_VIEWS * _instanceCount * sizeof(VkDrawIndexedIndirectCommand);
+	const VkDeviceSize countsSize = MAX_CULL_VIEWS * sizeof(uint32_t);
+	_instanceBuffers.resize(count);
+	_instanceMemorys.resize(count);
+	_instanceDatas.resize(count);
+	_drawBuffers.resize(count);
+	_drawMemorys.resize(count);
+	_countBuffers.resize(count);
+	_countMemorys.resize(count);
+	for(size_t i = 0; i < count; ++i){
+		// Instances are updated by the CPU each frame, keep them mapped.
+		VulkanUtilities::createBuffer(physicalDevice, _device, instancesSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, _instanceBuffers[i], _instanceMemorys[i]);
+		void * data = nullptr;
+		if(vkMapMemory(_device, _instanceMemorys[i], 0, instancesSize, 0, &data) != VK_SUCCESS){
+			std::cerr << "Unable to map instance buffer." << std::endl;
+		}
+		_instanceDatas[i] = static_cast<char*>(data);
+		memcpy(_instanceDatas[i], _instances.data(), instancesSize);
+		// Commands and counts are only written by the culling pass.
+		VulkanUtilities::createBuffer(physicalDevice, _device, drawsSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _drawBuffers[i], _drawMemorys[i]);
+		VulkanUtilities::createBuffer(physicalDevice, _device, countsSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _countBuffers[i], _countMemorys[i]);
+	}
+
+	/// Layouts.
+	// Culling: instances, views with a dynamic offset in the uniform ring, commands and counts.
+	std::array<VkDescriptorSetLayoutBinding, 4> cullBindings = {};
+	for(size_t i = 0; i < cullBindings.size(); ++i){
+		cullBindings[i].binding = static_cast<uint32_t>(i);
+		cullBindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		cullBindings[i].descriptorCount = 1;
+		cullBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	}
+	cullBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	VkDescriptorSetLayoutCreateInfo cullLayoutInfo = {};
+	cullLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	cullLayoutInfo.bindingCount = static_cast<uint32_t>(cullBindings.size());
+	cullLayoutInfo.pBindings = cullBindings.data();
+	if (vkCreateDescriptorSetLayout(_device, &cullLayoutInfo, nullptr, &_cullSetLayout) != VK_SUCCESS) {
+		std::cerr << "Unable to create culling descriptor." << std::endl;
+	}
+	// Drawing: instances and all materials textures.
+	const std::vector<VkSampler> samplers(2 * MAX_INDIRECT_MATERIALS, sampler);
+	std::array<VkDescriptorSetLayoutBinding, 2> drawBindings = {};
+	drawBindings[0].binding = 0;
+	drawBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	drawBindings[0].descriptorCount = 1;
+	drawBindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	drawBindings[1].binding = 1;
+	drawBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	drawBindings[1].descriptorCount = static_cast<uint32_t>(samplers.size());
+	drawBindings[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+	drawBindings[1].pImmutableSamplers = samplers.data();
+	VkDescriptorSetLayoutCreateInfo drawLayoutInfo = {};
+	drawLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	drawLayoutInfo.bindingCount = static_cast<uint32_t>(drawBindings.size());
+	drawLayoutInfo.pBindings = drawBindings.data();
+	if (vkCreateDescriptorSetLayout(_device, &drawLayoutInfo, nullptr, &_drawSetLayout) != VK_SUCCESS) {
+		std::cerr << "Unable to create indirect draw descriptor." << std::endl;
+	}
+
+	/// Descriptor sets.
+	std::array<VkDescriptorPoolSize, 3> poolSizes = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	poolSizes[0].descriptorCount = count * 4;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	poolSizes[1].descriptorCount = count;
+	poolSizes[2].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	poolSizes[2].descriptorCount = count * 2 * MAX_INDIRECT_MATERIALS;
+	VkDescriptorPoolCreateInfo descPoolInfo = {};
+	descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	descPoolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+	descPoolInfo.pPoolSizes = poolSizes.data();
+	descPoolInfo.maxSets = 2 * count;
+	if (vkCreateDescriptorPool(_device, &descPoolInfo, nullptr, &_descriptorPool) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor pool." << std::endl;
+	}
+
+	_cullSets.resize(count);
+	_drawSets.resize(count);
+	std::vector<VkDescriptorSetLayout> cullLayouts(count, _cullSetLayout);
+	std::vector<VkDescriptorSetLayout> drawLayouts(count, _drawSetLayout);
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = _descriptorPool;
+	allocInfo.descriptorSetCount = count;
+	allocInfo.pSetLayouts = cullLayouts.data();
+	if (vkAllocateDescriptorSets(_device, &allocInfo, _cullSets.data()) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
+	}
+	allocInfo.pSetLayouts = drawLayouts.data();
+	if (vkAllocateDescriptorSets(_device, &allocInfo, _drawSets.data()) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
+	}
+
+	// The whole texture array is used by the shader, fill the unused slots with the first material.
+	std::vector<VkDescriptorImageInfo> imageInfos(2 * MAX_INDIRECT_MATERIALS);
+	for(size_t i = 0; i < MAX_INDIRECT_MATERIALS; ++i){
+		const auto & object = objects[i < objects.size() ? i : 0];
+		imageInfos[2*i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		imageInfos[2*i].imageView = object.colorView();
+		imageInfos[2*i+1].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		imageInfos[2*i+1].imageView = object.normalView();
+	}
+
+	VkDescriptorBufferInfo viewsInfo = {};
+	viewsInfo.buffer = uniforms;
+	viewsInfo.offset = 0;
+	viewsInfo.range = sizeof(CullInfos);
+
+	for(size_t i = 0; i < count; ++i){
+		VkDescriptorBufferInfo instancesInfo = {};
+		instancesInfo.buffer = _instanceBuffers[i];
+		instancesInfo.offset = 0;
+		instancesInfo.range = VK_WHOLE_SIZE;
+		VkDescriptorBufferInfo drawsInfo = {};
+		drawsInfo.buffer = _drawBuffers[i];
+		drawsInfo.offset = 0;
+		drawsInfo.range = VK_WHOLE_SIZE;
+		VkDescriptorBufferInfo countsInfo = {};
+		countsInfo.buffer = _countBuffers[i];
+		countsInfo.offset = 0;
+		countsInfo.range = VK_WHOLE_SIZE;
+		const std::array<const VkDescriptorBufferInfo *, 4> cullInfos = { &instancesInfo, &viewsInfo, &drawsInfo, &countsInfo };
+
+		std::array<VkWriteDescriptorSet, 6> descriptorWrites = {};
+		for(size_t j = 0; j < cullInfos.size(); ++j){
+			descriptorWrites[j].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[j].dstSet = _cullSets[i];
+			descriptorWrites[j].dstBinding = static_cast<uint32_t>(j);
+			descriptorWrites[j].dstArrayElement = 0;
+			descriptorWrites[j].descriptorType = cullBindings[j].descriptorType;
+			descriptorWrites[j].descriptorCount = 1;
+			descriptorWrites[j].pBufferInfo = cullInfos[j];
+		}
+
+		descriptorWrites[4].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[4].dstSet = _drawSets[i];
+		descriptorWrites[4].dstBinding = 0;
+		descriptorWrites[4].dstArrayElement = 0;
+		descriptorWrites[4].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorWrites[4].descriptorCount = 1;
+		descriptorWrites[4].pBufferInfo = &instancesInfo;
+
+		descriptorWrites[5].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[5].dstSet = _drawSets[i];
+		descriptorWrites[5].dstBinding = 1;
+		descriptorWrites[5].dstArrayElement = 0;
+		descriptorWrites[5].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrites[5].descriptorCount = static_cast<uint32_t>(imageInfos.size());
+		descriptorWrites[5].pImageInfo = imageInfos.data();
+
+		vkUpdateDescriptorSets(_device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+	}
+
+	/// Pipelines independent from the final render pass.
+	PipelineUtilities::createComputePipeline(_device, "cull", {_cullSetLayout}, 0, _cullPipelineLayout, _cullPipeline);
+	PipelineUtilities::createPipeline(_device, "shadow_indirect", shadowPass.renderPass, {ShadowPass::descriptorSetLayout, _drawSetLayout}, shadowPass.size[0], shadowPass.size[1], true, VK_CULL_MODE_BACK_BIT, true, true, true, VK_COMPARE_OP_LESS, 0, _shadowPipelineLayout, _shadowPipeline);
+}
+
+void IndirectScene::createPipelines(const VkRenderPass & finalRenderPass, const VkDescriptorSetLayout & frameLayout, const uint32_t width, const uint32_t height){
+	PipelineUtilities::createPipeline(_device, "object_indirect", finalRenderPass, {frameLayout, _drawSetLayout}, width, height, false, VK_CULL_MODE_BACK_BIT, true, true, false, VK_COMPARE_OP_LESS, 0, _objectPipelineLayout, _objectPipeline);
+}
+
+void IndirectScene::update(const uint32_t index, const std::vector<Object> & objects){
+	// Only the transformations can change, the geometry ranges are fixed.
+	for(size_t i = 0; i < objects.size(); ++i){
+		_instances[i].model = objects[i].infos.model;
+		_instances[i].shininess = objects[i].infos.shininess;
+	}
+	memcpy(_instanceDatas[index], _instances.data(), _instances.size() * sizeof(InstanceInfos));
+}
+
+void IndirectScene::cull(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cullOffset){
+	// Reset the counts.
+	vkCmdFillBuffer(commandBuffer, _countBuffers[index], 0, VK_WHOLE_SIZE, 0);
+	VkMemoryBarrier fillBarrier = {};
+	fillBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	fillBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &fillBarrier, 0, nullptr, 0, nullptr);
+
+	// One thread per instance, testing all views.
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _cullPipeline);
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _cullPipelineLayout, 0, 1, &_cullSets[index], 1, &cullOffset);
+	vkCmdDispatch(commandBuffer, (_instanceCount + 63) / 64, 1, 1);
+
+	// Commands and counts will be read by the indirect draws.
+	VkMemoryBarrier cullBarrier = {};
+	cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+}
+
+void IndirectScene::drawShadows(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t view, const VkDescriptorSet & shadowSet, const std::array<uint32_t, 2> & shadowOffsets){
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPipeline);
+	const std::array<VkDescriptorSet, 2> sets = { shadowSet, _drawSets[index] };
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPipelineLayout, 0, static_cast<uint32_t>(sets.size()), sets.data(), static_cast<uint32_t>(shadowOffsets.size()), shadowOffsets.data());
+	drawView(commandBuffer, index, view);
+}
+
+void IndirectScene::draw(VkCommandBuffer & commandBuffer, const uint32_t index, const VkDescriptorSet & frameSet, const std::array<uint32_t, 3> & frameOffsets){
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipeline);
+	const std::array<VkDescriptorSet, 2> sets = { frameSet, _drawSets[index] };
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipelineLayout, 0, static_cast<uint32_t>(sets.size()), sets.data(), static_cast<uint32_t>(frameOffsets.size()), frameOffsets.data());
+	drawView(commandBuffer, index, 0);
+}
+
+void IndirectScene::drawView(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t view){
+	VkDeviceSize offsets[1] = { 0 };
+	vkCmdBindVertexBuffers(commandBuffer, 0, 1, &_vertexBuffer, offsets);
+	vkCmdBindIndexBuffer(commandBuffer, _indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+	const uint32_t stride = sizeof(VkDrawIndexedIndirectCommand);
+	const VkDeviceSize drawOffset = view * _instanceCount * stride;
+	const VkDeviceSize countOffset = view * sizeof(uint32_t);
+	_drawIndexedIndirectCount(commandBuffer, _drawBuffers[index], drawOffset, _countBuffers[index], countOffset, _instanceCount, stride);
+}
+
+void IndirectScene::cleanPipelines(){
+	vkDestroyPipeline(_device, _objectPipeline, nullptr);
+	vkDestroyPipelineLayout(_device, _objectPipelineLayout, nullptr);
+}
+
+void IndirectScene::clean(){
+	cleanPipelines();
+	vkDestroyPipeline(_device, _shadowPipeline, nullptr);
+	vkDestroyPipelineLayout(_device, _shadowPipelineLayout, nullptr);
+	vkDestroyPipeline(_device, _cullPipeline, nullptr);
+	vkDestroyPipelineLayout(_device, _cullPipelineLayout, nullptr);
+
+	vkDestroyDescriptorPool(_device, _descriptorPool, nullptr);
+	vkDestroyDescriptorSetLayout(_device, _cullSetLayout, nullptr);
+	vkDestroyDescriptorSetLayout(_device, _drawSetLayout, nullptr);
+
+	for(size_t i = 0; i < _instanceBuffers.size(); ++i){
+		vkUnmapMemory(_device, _instanceMemorys[i]);
+		vkDestroyBuffer(_device, _instanceBuffers[i], nullptr);
+		vkFreeMemory(_device, _instanceMemorys[i], nullptr);
+		vkDestroyBuffer(_device, _drawBuffers[i], nullptr);
+		vkFreeMemory(_device, _drawMemorys[i], nullptr);
+		vkDestroyBuffer(_device, _countBuffers[i], nullptr);
+		vkFreeMemory(_device, _countMemorys[i], nullptr);
+	}
+	vkDestroyBuffer(_device, _vertexBuffer, nullptr);
+	vkFreeMemory(_device, _vertexBufferMemory, nullptr);
+	vkDestroyBuffer(_device, _indexBuffer, nullptr);
+	vkFreeMemory(_device, _indexBufferMemory, nullptr);
+}
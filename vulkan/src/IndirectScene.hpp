@@ -0,0 +1,79 @@
+#ifndef IndirectScene_hpp
+#define IndirectScene_hpp
+
+#include "common.hpp"
+#include "Object.hpp"
+#include "ShadowPass.hpp"
+
+#include <array>
+
+/// GPU-driven rendering of a list of objects.
+/// All meshes are merged in a unique vertex and index buffer, and per-instance infos are stored in a storage buffer.
+/// A compute pass culls instances against each view and generates the indirect draw commands and their count,
+/// so that each pass only submits a single indirect draw call.
+class IndirectScene {
+public:
+
+	IndirectScene();
+
+	void init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, const std::vector<Object> & objects, const VkSampler & sampler, const VkBuffer & uniforms, const ShadowPass & shadowPass, const uint32_t count);
+
+	/// Pipelines depending on the final render pass size.
+	void createPipelines(const VkRenderPass & finalRenderPass, const VkDescriptorSetLayout & frameLayout, const uint32_t width, const uint32_t height);
+
+	void cleanPipelines();
+
+	void clean();
+
+	/// Update the per-instance data for a given frame.
+	void update(const uint32_t index, const std::vector<Object> & objects);
+
+	/// Cull all instances against the views stored at the given offset in the uniform ring. Has to be encoded outside of any render pass.
+	void cull(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cullOffset);
+
+	/// Draw the instances visible from a shadow cascade view, using the shadow pass set (cascade and object dynamic uniforms).
+	void drawShadows(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t view, const VkDescriptorSet & shadowSet, const std::array<uint32_t, 2> & shadowOffsets);
+
+	/// Draw the instances visible from the camera (view 0), using the frame set (camera, light, object dynamic uniforms and shadow map).
+	void draw(VkCommandBuffer & commandBuffer, const uint32_t index, const VkDescriptorSet & frameSet, const std::array<uint32_t, 3> & frameOffsets);
+
+private:
+
+	void drawView(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t view);
+
+	VkDevice _device;
+	uint32_t _instanceCount;
+	std::vector<InstanceInfos> _instances;
+	PFN_vkCmdDrawIndexedIndirectCountKHR _drawIndexedIndirectCount;
+
+	// Merged geometry.
+	VkBuffer _vertexBuffer;
+	VkDeviceMemory _vertexBufferMemory;
+	VkBuffer _indexBuffer;
+	VkDeviceMemory _indexBufferMemory;
+
+	// Per frame data.
+	std::vector<VkBuffer> _instanceBuffers;
+	std::vector<VkDeviceMemory> _instanceMemorys;
+	std::vector<char*> _instanceDatas;
+	std::vector<VkBuffer> _drawBuffers;
+	std::vector<VkDeviceMemory> _drawMemorys;
+	std::vector<VkBuffer> _countBuffers;
+	std::vector<VkDeviceMemory> _countMemorys;
+	std::vector<VkDescriptorSet> _cullSets;
+	std::vector<VkDescriptorSet> _drawSets;
+
+	VkDescriptorPool _descriptorPool;
+	VkDescriptorSetLayout _cullSetLayout;
+	VkDescriptorSetLayout _drawSetLayout;
+
+	// Pipelines.
+	VkPipelineLayout _cullPipelineLayout;
+	VkPipeline _cullPipeline;
+	VkPipelineLayout _shadowPipelineLayout;
+	VkPipeline _shadowPipeline;
+	VkPipelineLayout _objectPipelineLayout;
+	VkPipeline _objectPipeline;
+};
+
+#endif /* IndirectScene_hpp */
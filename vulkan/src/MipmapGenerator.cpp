@@ -0,0 +1,568 @@
+#include "MipmapGenerator.hpp"
+#include "VulkanUtilities.hpp"
+#include "PipelineUtilities.hpp"
+
+#include <fstream>
+#include <array>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define MIPMAP_USE_SSE
+#include <emmintrin.h>
+#endif
+
+#define MIPMAP_LEVELS_PER_DISPATCH 4
+#define MIPMAP_CACHE_MAGIC 0x32504D44
+
+bool MipmapGenerator::preferCPU = false;
+
+/// Filtering and recording helpers.
+
+namespace {
+
+	struct MipmapParameters {
+		glm::uvec2 srcSize;
+		uint32_t levelCount;
+		uint32_t srgb;
+	};
+
+	uint32_t levelSize(const uint32_t size, const uint32_t level){
+		return std::max(size >> level, 1u);
+	}
+
+	/// FNV-1a over the RGBA8 pixels, one pixel at a time.
+	uint32_t hashPixels(const void * image, const size_t pixelCount){
+		const uint32_t * pixels = static_cast<const uint32_t*>(image);
+		uint32_t hash = 2166136261u;
+		for(size_t i = 0; i < pixelCount; ++i){
+			hash = (hash ^ pixels[i]) * 16777619u;
+		}
+		return hash;
+	}
+
+	/// Lookup tables for sRGB conversions, 8 bits to linear float and 12 bits linear to 8 bits.
+	struct SrgbTables {
+		float toLinear[256];
+		unsigned char toSrgb[4096];
+
+		SrgbTables(){
+			for(int i = 0; i < 256; ++i){
+				const float c = float(i) / 255.0f;
+				toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+			}
+			for(int i = 0; i < 4096; ++i){
+				const float c = float(i) / 4095.0f;
+				const float s = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f/2.4f) - 0.055f;
+				toSrgb[i] = static_cast<unsigned char>(std::min(std::max(s * 255.0f + 0.5f, 0.0f), 255.0f));
+			}
+		}
+	};
+
+	const SrgbTables & srgbTables(){
+		static const SrgbTables tables;
+		return tables;
+	}
+
+	/// Kaiser-windowed sinc weights for a 2x reduction: 8 taps at the source texels centers around the destination texel.
+	struct KaiserKernel {
+		float weights[8];
+
+		static float bessel0(const float x){
+			// Power series of the modified Bessel function of the first kind.
+			float sum = 1.0f;
+			float term = 1.0f;
+			for(int k = 1; k < 16; ++k){
+				term *= (0.5f * x / float(k)) * (0.5f * x / float(k));
+				sum += term;
+			}
+			return sum;
+		}
+
+		KaiserKernel(){
+			const float alpha = 4.0f;
+			const float radius = 2.0f;
+			float total = 0.0f;
+			for(int k = 0; k < 8; ++k){
+				// Distance in destination texels.
+				const float d = (float(k) - 3.5f) * 0.5f;
+				const float sinc = std::sin(float(M_PI) * d) / (float(M_PI) * d);
+				const float ratio = d / radius;
+				const float window = bessel0(alpha * std::sqrt(std::max(1.0f - ratio * ratio, 0.0f))) / bessel0(alpha);
+				weights[k] = sinc * window;
+				total += weights[k];
+			}
+			for(int k = 0; k < 8; ++k){
+				weights[k] /= total;
+			}
+		}
+	};
+
+	const KaiserKernel & kaiserKernel(){
+		static const KaiserKernel kernel;
+		return kernel;
+	}
+
+	// Levels are filtered in RGBA float, one pixel at a time.
+#ifdef MIPMAP_USE_SSE
+	typedef __m128 Pixel;
+	inline Pixel pixelZero(){ return _mm_setzero_ps(); }
+	inline Pixel pixelLoad(const float * src){ return _mm_loadu_ps(src); }
+	inline void pixelStore(float * dst, const Pixel & p){ _mm_storeu_ps(dst, p); }
+	inline Pixel pixelMadd(const Pixel & acc, const Pixel & p, const float w){ return _mm_add_ps(acc, _mm_mul_ps(p, _mm_set1_ps(w))); }
+	inline Pixel pixelAverage(const Pixel & a, const Pixel & b, const Pixel & c, const Pixel & d){
+		return _mm_mul_ps(_mm_add_ps(_mm_add_ps(a, b), _mm_add_ps(c, d)), _mm_set1_ps(0.25f));
+	}
+#else
+	typedef glm::vec4 Pixel;
+	inline Pixel pixelZero(){ return Pixel(0.0f); }
+	inline Pixel pixelLoad(const float * src){ return Pixel(src[0], src[1], src[2], src[3]); }
+	inline void pixelStore(float * dst, const Pixel & p){ dst[0] = p[0]; dst[1] = p[1]; dst[2] = p[2]; dst[3] = p[3]; }
+	inline Pixel pixelMadd(const Pixel & acc, const Pixel & p, const float w){ return acc + p * w; }
+	inline Pixel pixelAverage(const Pixel & a, const Pixel & b, const Pixel & c, const Pixel & d){ return 0.25f * (a + b + c + d); }
+#endif
+
+	void downsampleBox(const std::vector<float> & src, const uint32_t sw, const uint32_t sh, std::vector<float> & dst, const uint32_t dw, const uint32_t dh){
+		for(uint32_t y = 0; y < dh; ++y){
+			const uint32_t y0 = std::min(2*y, sh-1);
+			const uint32_t y1 = std::min(2*y+1, sh-1);
+			for(uint32_t x = 0; x < dw; ++x){
+				const uint32_t x0 = std::min(2*x, sw-1);
+				const uint32_t x1 = std::min(2*x+1, sw-1);
+				const Pixel p = pixelAverage(pixelLoad(&src[4*(y0*sw+x0)]), pixelLoad(&src[4*(y0*sw+x1)]), pixelLoad(&src[4*(y1*sw+x0)]), pixelLoad(&src[4*(y1*sw+x1)]));
+				pixelStore(&dst[4*(y*dw+x)], p);
+			}
+		}
+	}
+
+	void downsampleKaiser(const std::vector<float> & src, const uint32_t sw, const uint32_t sh, std::vector<float> & dst, const uint32_t dw, const uint32_t dh){
+		const KaiserKernel & kernel = kaiserKernel();
+		// Horizontal pass.
+		std::vector<float> temp(4 * dw * sh);
+		for(uint32_t y = 0; y < sh; ++y){
+			for(uint32_t x = 0; x < dw; ++x){
+				Pixel acc = pixelZero();
+				for(int k = 0; k < 8; ++k){
+					const int sx = std::min(std::max(int(2*x) - 3 + k, 0), int(sw) - 1);
+					acc = pixelMadd(acc, pixelLoad(&src[4*(y*sw+sx)]), kernel.weights[k]);
+				}
+				pixelStore(&temp[4*(y*dw+x)], acc);
+			}
+		}
+		// Vertical pass.
+		for(uint32_t y = 0; y < dh; ++y){
+			for(uint32_t x = 0; x < dw; ++x){
+				Pixel acc = pixelZero();
+				for(int k = 0; k < 8; ++k){
+					const int sy = std::min(std::max(int(2*y) - 3 + k, 0), int(sh) - 1);
+					acc = pixelMadd(acc, pixelLoad(&temp[4*(sy*dw+x)]), kernel.weights[k]);
+				}
+				pixelStore(&dst[4*(y*dw+x)], acc);
+			}
+		}
+	}
+
+	VkImageView createLevelView(const VkDevice & device, const VkImage & image, const uint32_t level, const uint32_t layers){
+		VkImageViewCreateInfo viewInfo = {};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+		viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+		viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		viewInfo.subresourceRange.baseMipLevel = level;
+		viewInfo.subresourceRange.levelCount = 1;
+		viewInfo.subresourceRange.baseArrayLayer = 0;
+		viewInfo.subresourceRange.layerCount = layers;
+		VkImageView imageView;
+		if(vkCreateImageView(device, &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+			std::cerr << "Unable to create mip level view." << std::endl;
+		}
+		return imageView;
+	}
+
+	void levelsBarrier(VkCommandBuffer & commandBuffer, const VkImage & image, const uint32_t baseLevel, const uint32_t levelCount, const uint32_t layers, const VkImageLayout oldLayout, const VkImageLayout newLayout, const VkAccessFlags srcAccess, const VkAccessFlags dstAccess, const VkPipelineStageFlags srcStage, const VkPipelineStageFlags dstStage){
+		VkImageMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.image = image;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = layers;
+		barrier.subresourceRange.baseMipLevel = baseLevel;
+		barrier.subresourceRange.levelCount = levelCount;
+		barrier.oldLayout = oldLayout;
+		barrier.newLayout = newLayout;
+		barrier.srcAccessMask = srcAccess;
+		barrier.dstAccessMask = dstAccess;
+		vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	}
+}
+
+MipmapGenerator::MipmapGenerator(){
+	_physicalDevice = VK_NULL_HANDLE;
+	_device = VK_NULL_HANDLE;
+	_commandPool = VK_NULL_HANDLE;
+	_commandBuffer = VK_NULL_HANDLE;
+	_computeSupported = false;
+	_sampler = VK_NULL_HANDLE;
+	_setLayout = VK_NULL_HANDLE;
+	_pipelineLayout = VK_NULL_HANDLE;
+	_pipeline = VK_NULL_HANDLE;
+}
+
+void MipmapGenerator::init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool){
+	_physicalDevice = physicalDevice;
+	_device = device;
+	_commandPool = commandPool;
+
+	// Levels are written as storage images, fallback to the CPU path if unsupported.
+	VkFormatProperties formatProperties;
+	vkGetPhysicalDeviceFormatProperties(_physicalDevice, VK_FORMAT_R8G8B8A8_UNORM, &formatProperties);
+	_computeSupported = (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0;
+	if(!_computeSupported){
+		std::cerr << "Storage images not supported for textures, mipmaps will be generated on the CPU." << std::endl;
+		return;
+	}
+
+	// Texel fetches only, the sampler is never filtering.
+	VkSamplerCreateInfo samplerInfo = {};
+	samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	samplerInfo.magFilter = VK_FILTER_NEAREST;
+	samplerInfo.minFilter = VK_FILTER_NEAREST;
+	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+	samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.anisotropyEnable = VK_FALSE;
+	samplerInfo.maxAnisotropy = 1.0f;
+	samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+	samplerInfo.unnormalizedCoordinates = VK_FALSE;
+	samplerInfo.compareEnable = VK_FALSE;
+	samplerInfo.minLod = 0.0f;
+	samplerInfo.maxLod = 0.0f;
+	if(vkCreateSampler(_device, &samplerInfo, nullptr, &_sampler) != VK_SUCCESS) {
+		std::cerr << "Unable to create mipmap sampler." << std::endl;
+	}
+
+	VkDescriptorSetLayoutBinding srcBinding = {};
+	srcBinding.binding = 0;
+	srcBinding.descriptorCount = 1;
+	srcBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	srcBinding.pImmutableSamplers = &_sampler;
+	srcBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+	VkDescriptorSetLayoutBinding dstBinding = {};
+	dstBinding.binding = 1;
+	dstBinding.descriptorCount = MIPMAP_LEVELS_PER_DISPATCH;
+	dstBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+	dstBinding.pImmutableSamplers = nullptr;
+	dstBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+	std::vector<VkDescriptorSetLayoutBinding> bindings = {srcBinding, dstBinding};
+	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+	layoutInfo.pBindings = bindings.data();
+	if(vkCreateDescriptorSetLayout(_device, &layoutInfo, nullptr, &_setLayout) != VK_SUCCESS) {
+		std::cerr << "Unable to create mipmap descriptor set layout." << std::endl;
+	}
+
+	PipelineUtilities::createComputePipeline(_device, "mipmap", {_setLayout}, sizeof(MipmapParameters), _pipelineLayout, _pipeline);
+}
+
+void MipmapGenerator::begin(){
+	_commandBuffer = VulkanUtilities::beginOneShotCommandBuffer(_device, _commandPool);
+}
+
+void MipmapGenerator::upload(const void * image, const uint32_t width, const uint32_t height, const bool cube, const uint32_t mipCount, const bool srgb, const std::string & cachePath, VkImage & textureImage, VkDeviceMemory & textureMemory, VkImageView & textureView){
+	const uint32_t layers = cube ? 6 : 1;
+
+	// Pick the source of the levels: cache, compute shader or CPU filtering.
+	std::vector<unsigned char> levels;
+	const uint32_t sourceHash = cachePath.empty() ? 0 : hashPixels(image, size_t(width) * height * layers);
+	bool allLevels = !cachePath.empty() && readCache(cachePath, width, height, layers, mipCount, srgb, sourceHash, levels);
+	if(!allLevels && (preferCPU || !_computeSupported)){
+		computeLevels(static_cast<const unsigned char*>(image), width, height, layers, mipCount, srgb, Kaiser, levels);
+		if(!cachePath.empty()){
+			writeCache(cachePath, width, height, layers, mipCount, srgb, sourceHash, levels);
+		}
+		allLevels = true;
+	}
+
+	const VkDeviceSize baseSize = VkDeviceSize(width) * height * 4 * layers;
+	const VkDeviceSize imageSize = allLevels ? VkDeviceSize(levels.size()) : baseSize;
+	const void * imageData = allLevels ? static_cast<const void*>(levels.data()) : image;
+
+	// The staging buffer will be released once the batch has been executed.
+	VkBuffer stagingBuffer;
+	VkDeviceMemory stagingMemory;
+	VulkanUtilities::createBuffer(_physicalDevice, _device, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingMemory);
+	void* data;
+	vkMapMemory(_device, stagingMemory, 0, imageSize, 0, &data);
+	memcpy(data, imageData, static_cast<size_t>(imageSize));
+	vkUnmapMemory(_device, stagingMemory);
+	_stagingBuffers.push_back(stagingBuffer);
+	_stagingMemorys.push_back(stagingMemory);
+
+	VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	if(!allLevels){
+		usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+	}
+	VulkanUtilities::createImage(_physicalDevice, _device, width, height, mipCount, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, cube, textureImage, textureMemory);
+
+	// Copy all available levels.
+	levelsBarrier(_commandBuffer, textureImage, 0, mipCount, layers, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	std::vector<VkBufferImageCopy> regions;
+	VkDeviceSize offset = 0;
+	for(uint32_t level = 0; level < (allLevels ? mipCount : 1); ++level){
+		const uint32_t w = levelSize(width, level);
+		const uint32_t h = levelSize(height, level);
+		VkBufferImageCopy region = {};
+		region.bufferOffset = offset;
+		region.bufferRowLength = 0;
+		region.bufferImageHeight = 0;
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = level;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = layers;
+		region.imageOffset = {0, 0, 0};
+		region.imageExtent = { w, h, 1 };
+		regions.push_back(region);
+		offset += VkDeviceSize(w) * h * 4 * layers;
+	}
+	vkCmdCopyBufferToImage(_commandBuffer, stagingBuffer, textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+	if(allLevels){
+		levelsBarrier(_commandBuffer, textureImage, 0, mipCount, layers, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	} else {
+		generate(textureImage, width, height, layers, mipCount, srgb);
+	}
+
+	textureView = VulkanUtilities::createImageView(_device, textureImage, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT, cube, mipCount);
+}
+
+void MipmapGenerator::generate(const VkImage & image, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb){
+	// Level 0 is read, other levels are written then read by the next dispatches.
+	levelsBarrier(_commandBuffer, image, 0, 1, layers, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+	if(mipCount > 1){
+		levelsBarrier(_commandBuffer, image, 1, mipCount - 1, layers, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+	}
+
+	std::vector<VkImageView> views(mipCount);
+	for(uint32_t level = 0; level < mipCount; ++level){
+		views[level] = createLevelView(_device, image, level, layers);
+		_levelViews.push_back(views[level]);
+	}
+
+	// One set per dispatch, each dispatch reduces up to 4 levels.
+	const uint32_t dispatchCount = (mipCount - 1 + MIPMAP_LEVELS_PER_DISPATCH - 1) / MIPMAP_LEVELS_PER_DISPATCH;
+	if(dispatchCount == 0){
+		return;
+	}
+	std::array<VkDescriptorPoolSize, 2> poolSizes = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	poolSizes[0].descriptorCount = dispatchCount;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+	poolSizes[1].descriptorCount = dispatchCount * MIPMAP_LEVELS_PER_DISPATCH;
+	VkDescriptorPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+	poolInfo.pPoolSizes = poolSizes.data();
+	poolInfo.maxSets = dispatchCount;
+	VkDescriptorPool pool;
+	if(vkCreateDescriptorPool(_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+		std::cerr << "Unable to create mipmap descriptor pool." << std::endl;
+		return;
+	}
+	_pools.push_back(pool);
+	std::vector<VkDescriptorSetLayout> layouts(dispatchCount, _setLayout);
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = pool;
+	allocInfo.descriptorSetCount = dispatchCount;
+	allocInfo.pSetLayouts = layouts.data();
+	std::vector<VkDescriptorSet> sets(dispatchCount);
+	if(vkAllocateDescriptorSets(_device, &allocInfo, sets.data()) != VK_SUCCESS) {
+		std::cerr << "Unable to allocate mipmap descriptor sets." << std::endl;
+		return;
+	}
+
+	vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
+	for(uint32_t d = 0; d < dispatchCount; ++d){
+		const uint32_t srcLevel = d * MIPMAP_LEVELS_PER_DISPATCH;
+		const uint32_t levelCount = std::min(uint32_t(MIPMAP_LEVELS_PER_DISPATCH), mipCount - 1 - srcLevel);
+
+		VkDescriptorImageInfo srcInfo = {};
+		srcInfo.imageLayout = srcLevel == 0 ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+		srcInfo.imageView = views[srcLevel];
+		srcInfo.sampler = _sampler;
+		// Unused slots point to the last generated level, they are never written.
+		std::array<VkDescriptorImageInfo, MIPMAP_LEVELS_PER_DISPATCH> dstInfos = {};
+		for(uint32_t l = 0; l < MIPMAP_LEVELS_PER_DISPATCH; ++l){
+			dstInfos[l].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+			dstInfos[l].imageView = views[srcLevel + 1 + std::min(l, levelCount - 1)];
+			dstInfos[l].sampler = VK_NULL_HANDLE;
+		}
+		std::array<VkWriteDescriptorSet, 2> writes = {};
+		writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		writes[0].dstSet = sets[d];
+		writes[0].dstBinding = 0;
+		writes[0].dstArrayElement = 0;
+		writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		writes[0].descriptorCount = 1;
+		writes[0].pImageInfo = &srcInfo;
+		writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		writes[1].dstSet = sets[d];
+		writes[1].dstBinding = 1;
+		writes[1].dstArrayElement = 0;
+		writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+		writes[1].descriptorCount = MIPMAP_LEVELS_PER_DISPATCH;
+		writes[1].pImageInfo = dstInfos.data();
+		vkUpdateDescriptorSets(_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+		MipmapParameters parameters;
+		parameters.srcSize = glm::uvec2(levelSize(width, srcLevel), levelSize(height, srcLevel));
+		parameters.levelCount = levelCount;
+		parameters.srgb = srgb ? 1 : 0;
+		vkCmdPushConstants(_commandBuffer, _pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(MipmapParameters), &parameters);
+		vkCmdBindDescriptorSets(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, 1, &sets[d], 0, nullptr);
+		// Each 8x8 group covers a 16x16 tile of the source level.
+		const uint32_t groupsX = (levelSize(width, srcLevel + 1) + 7) / 8;
+		const uint32_t groupsY = (levelSize(height, srcLevel + 1) + 7) / 8;
+		vkCmdDispatch(_commandBuffer, groupsX, groupsY, layers);
+
+		// The last level written is the source of the next dispatch.
+		if(d + 1 < dispatchCount){
+			levelsBarrier(_commandBuffer, image, srcLevel + levelCount, 1, layers, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+		}
+	}
+	levelsBarrier(_commandBuffer, image, 1, mipCount - 1, layers, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+}
+
+void MipmapGenerator::end(const VkQueue & queue){
+	VulkanUtilities::endOneShotCommandBuffer(_commandBuffer, _device, _commandPool, queue);
+	_commandBuffer = VK_NULL_HANDLE;
+	for(size_t i = 0; i < _stagingBuffers.size(); ++i){
+		vkDestroyBuffer(_device, _stagingBuffers[i], nullptr);
+		vkFreeMemory(_device, _stagingMemorys[i], nullptr);
+	}
+	for(auto & view : _levelViews){
+		vkDestroyImageView(_device, view, nullptr);
+	}
+	for(auto & pool : _pools){
+		vkDestroyDescriptorPool(_device, pool, nullptr);
+	}
+	_stagingBuffers.clear();
+	_stagingMemorys.clear();
+	_levelViews.clear();
+	_pools.clear();
+}
+
+void MipmapGenerator::clean(){
+	if(!_computeSupported){
+		return;
+	}
+	vkDestroyPipeline(_device, _pipeline, nullptr);
+	vkDestroyPipelineLayout(_device, _pipelineLayout, nullptr);
+	vkDestroyDescriptorSetLayout(_device, _setLayout, nullptr);
+	vkDestroySampler(_device, _sampler, nullptr);
+}
+
+void MipmapGenerator::computeLevels(const unsigned char * image, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const Filter filter, std::vector<unsigned char> & levels){
+	const SrgbTables & tables = srgbTables();
+
+	// Total size of all levels.
+	size_t totalSize = 0;
+	for(uint32_t level = 0; level < mipCount; ++level){
+		totalSize += size_t(levelSize(width, level)) * levelSize(height, level) * 4 * layers;
+	}
+	levels.resize(totalSize);
+	// Level 0 is copied as-is.
+	const size_t baseSize = size_t(width) * height * 4;
+	memcpy(levels.data(), image, baseSize * layers);
+
+	std::vector<float> src;
+	std::vector<float> dst;
+	size_t levelOffset = baseSize * layers;
+	for(uint32_t layer = 0; layer < layers; ++layer){
+		// Decode the base level in linear space.
+		src.resize(4 * size_t(width) * height);
+		const unsigned char * base = image + layer * baseSize;
+		for(size_t i = 0; i < size_t(width) * height; ++i){
+			for(int c = 0; c < 3; ++c){
+				src[4*i+c] = srgb ? tables.toLinear[base[4*i+c]] : float(base[4*i+c]) / 255.0f;
+			}
+			src[4*i+3] = float(base[4*i+3]) / 255.0f;
+		}
+
+		// Each level is filtered from the previous one, kept in float to avoid accumulating quantization errors.
+		size_t offset = levelOffset;
+		for(uint32_t level = 1; level < mipCount; ++level){
+			const uint32_t sw = levelSize(width, level - 1);
+			const uint32_t sh = levelSize(height, level - 1);
+			const uint32_t dw = levelSize(width, level);
+			const uint32_t dh = levelSize(height, level);
+			dst.resize(4 * size_t(dw) * dh);
+			if(filter == Kaiser){
+				downsampleKaiser(src, sw, sh, dst, dw, dh);
+			} else {
+				downsampleBox(src, sw, sh, dst, dw, dh);
+			}
+			// Encode in the output.
+			const size_t layerSize = size_t(dw) * dh * 4;
+			unsigned char * out = &levels[offset + layer * layerSize];
+			for(size_t i = 0; i < size_t(dw) * dh; ++i){
+				for(int c = 0; c < 3; ++c){
+					const float v = std::min(std::max(dst[4*i+c], 0.0f), 1.0f);
+					out[4*i+c] = srgb ? tables.toSrgb[int(v * 4095.0f + 0.5f)] : static_cast<unsigned char>(v * 255.0f + 0.5f);
+				}
+				out[4*i+3] = static_cast<unsigned char>(std::min(std::max(dst[4*i+3], 0.0f), 1.0f) * 255.0f + 0.5f);
+			}
+			offset += layerSize * layers;
+			std::swap(src, dst);
+		}
+	}
+}
+
+bool MipmapGenerator::readCache(const std::string & path, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const uint32_t sourceHash, std::vector<unsigned char> & levels){
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if(!file.is_open()){
+		return false;
+	}
+	const size_t fileSize = static_cast<size_t>(file.tellg());
+	file.seekg(0);
+	uint32_t header[7];
+	if(fileSize < sizeof(header)){
+		return false;
+	}
+	file.read(reinterpret_cast<char*>(header), sizeof(header));
+	// Reject stale caches, including the ones generated from a different version of the source.
+	if(header[0] != MIPMAP_CACHE_MAGIC || header[1] != width || header[2] != height || header[3] != layers || header[4] != mipCount || header[5] != (srgb ? 1u : 0u) || header[6] != sourceHash){
+		std::cerr << "Outdated mipmap cache at " << path << "." << std::endl;
+		return false;
+	}
+	size_t totalSize = 0;
+	for(uint32_t level = 0; level < mipCount; ++level){
+		totalSize += size_t(levelSize(width, level)) * levelSize(height, level) * 4 * layers;
+	}
+	if(fileSize != sizeof(header) + totalSize){
+		std::cerr << "Truncated mipmap cache at " << path << "." << std::endl;
+		return false;
+	}
+	levels.resize(totalSize);
+	file.read(reinterpret_cast<char*>(levels.data()), totalSize);
+	return true;
+}
+
+void MipmapGenerator::writeCache(const std::string & path, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const uint32_t sourceHash, const std::vector<unsigned char> & levels){
+	std::ofstream file(path, std::ios::binary);
+	if(!file.is_open()){
+		std::cerr << "Unable to write mipmap cache at " << path << "." << std::endl;
+		return;
+	}
+	const uint32_t header[7] = { MIPMAP_CACHE_MAGIC, width, height, layers, mipCount, srgb ? 1u : 0u, sourceHash };
+	file.write(reinterpret_cast<const char*>(header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(levels.data()), levels.size());
+}
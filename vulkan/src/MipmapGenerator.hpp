@@ -0,0 +1,65 @@
+#ifndef MipmapGenerator_hpp
+#define MipmapGenerator_hpp
+
+#include "common.hpp"
+
+/// Upload textures and generate their mip levels, recording all uploads of a batch in a single command buffer.
+/// Levels are either reduced on the GPU by a compute shader (up to four levels per dispatch),
+/// or on the CPU with a box or Kaiser filter, in which case they can be cached on disk.
+/// sRGB-encoded images are filtered in linear space, but still stored and sampled as UNORM.
+class MipmapGenerator {
+public:
+
+	enum Filter {
+		Box, Kaiser
+	};
+
+	MipmapGenerator();
+
+	void init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool);
+
+	void clean();
+
+	/// Start a batch of uploads.
+	void begin();
+
+	/// Record the upload of an image and its mip levels. If a valid cache file exists at the given path, levels are read from it (an empty path disables caching).
+	void upload(const void * image, const uint32_t width, const uint32_t height, const bool cube, const uint32_t mipCount, const bool srgb, const std::string & cachePath, VkImage & textureImage, VkDeviceMemory & textureMemory, VkImageView & textureView);
+
+	/// Submit the batch, wait for completion and release temporary resources.
+	void end(const VkQueue & queue);
+
+	/// Compute all levels on the CPU. For each level, all layers are tightly packed.
+	static void computeLevels(const unsigned char * image, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const Filter filter, std::vector<unsigned char> & levels);
+
+	/// Use the CPU path and write caches, for offline baking.
+	static bool preferCPU;
+
+private:
+
+	void generate(const VkImage & image, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb);
+
+	/// Caches are tagged with a hash of the source pixels, so that they are rejected when the source texture is edited.
+	static bool readCache(const std::string & path, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const uint32_t sourceHash, std::vector<unsigned char> & levels);
+
+	static void writeCache(const std::string & path, const uint32_t width, const uint32_t height, const uint32_t layers, const uint32_t mipCount, const bool srgb, const uint32_t sourceHash, const std::vector<unsigned char> & levels);
+
+	VkPhysicalDevice _physicalDevice;
+	VkDevice _device;
+	VkCommandPool _commandPool;
+	VkCommandBuffer _commandBuffer;
+	bool _computeSupported;
+
+	VkSampler _sampler;
+	VkDescriptorSetLayout _setLayout;
+	VkPipelineLayout _pipelineLayout;
+	VkPipeline _pipeline;
+
+	// Temporary resources, released at the end of each batch.
+	std::vector<VkDescriptorPool> _pools;
+	std::vector<VkBuffer> _stagingBuffers;
+	std::vector<VkDeviceMemory> _stagingMemorys;
+	std::vector<VkImageView> _levelViews;
+};
+
+#endif /* MipmapGenerator_hpp */
@@ -9,6 +9,7 @@
 #include "Object.hpp"
 #include "VulkanUtilities.hpp"
 #include "resources/Resources.hpp"
+#include <algorithm>
 
 VkDescriptorSetLayout Object::descriptorSetLayout = VK_NULL_HANDLE;
 
@@ -18,9 +19,10 @@ Object::Object(const std::string &name, const float shininess) {
 	_name = name;
 	infos.model = glm::mat4(1.0f);
 	infos.shininess = shininess;
+	animated = false;
 }
 
-void Object::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue) {
+void Object::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, MipmapGenerator & mipmaps) {
 	
 	// Mesh.
 	Mesh mesh;
@@ -33,129 +35,69 @@ void Object::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & de
 	VulkanUtilities::setupBuffers(physicalDevice, device, commandPool, graphicsQueue, mesh, _vertexBuffer, _vertexBufferMemory, _indexBuffer, _indexBufferMemory);
 	
 	_count  = static_cast<uint32_t>(mesh.indices.size());
+	_vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+	// Bounding sphere radius, the mesh is centered.
+	_radius = 0.0f;
+	for(const auto & vertex : mesh.vertices){
+		_radius = std::max(_radius, glm::length(vertex.pos));
+	}
 	
 	/// Textures.
 	unsigned int texWidth, texHeight, texChannels;
 	void* image;
-	int rett = Resources::loadImage("resources/textures/" + _name + "_texture_color.png", texWidth, texHeight, texChannels, &image, true);
+	const std::string colorPath = "resources/textures/" + _name + "_texture_color.png";
+	int rett = Resources::loadImage(colorPath, texWidth, texHeight, texChannels, &image, true);
 	if(rett != 0){ std::cerr << "Error loading color image." << std::endl; }
-	VulkanUtilities::createTexture(image, texWidth, texHeight, false, MAX_MIPMAP_LEVELS, physicalDevice, device, commandPool, graphicsQueue, _textureColorImage, _textureColorMemory, _textureColorView);
+	// Color is sRGB-encoded, filter it in linear space.
+	mipmaps.upload(image, texWidth, texHeight, false, MAX_MIPMAP_LEVELS, true, colorPath + ".mips", _textureColorImage, _textureColorMemory, _textureColorView);
 	free(image);
 	
-	rett = Resources::loadImage("resources/textures/" + _name + "_texture_normal.png", texWidth, texHeight, texChannels, &image, true);
+	const std::string normalPath = "resources/textures/" + _name + "_texture_normal.png";
+	rett = Resources::loadImage(normalPath, texWidth, texHeight, texChannels, &image, true);
 	if(rett != 0){ std::cerr << "Error loading normal image." << std::endl; }
-	VulkanUtilities::createTexture(image, texWidth, texHeight, false, MAX_MIPMAP_LEVELS, physicalDevice, device, commandPool, graphicsQueue, _textureNormalImage, _textureNormalMemory, _textureNormalView);
+	mipmaps.upload(image, texWidth, texHeight, false, MAX_MIPMAP_LEVELS, false, normalPath + ".mips", _textureNormalImage, _textureNormalMemory, _textureNormalView);
 	free(image);
 }
 
-void Object::generateDescriptorSets(const VkDevice & device, const VkDescriptorSetLayout & shadowLayout, const VkDescriptorPool & pool, const std::vector<VkBuffer> & constants, const std::vector<VkImageView> & shadowMaps, int count){
-	
-	_descriptorSets.resize(count);
-	_shadowDescriptorSets.resize(count);
+void Object::generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool){
+	// Textures don't change between frames, a unique set is enough.
+	// Per-frame data (camera, light, transformation) is bound separately using dynamic offsets.
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = pool;
+	allocInfo.descriptorSetCount = 1;
+	allocInfo.pSetLayouts = &descriptorSetLayout;
 	
-	for (size_t i = 0; i < _descriptorSets.size(); i++) {
-		VkDescriptorSetAllocateInfo allocInfo = {};
-		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfo.descriptorPool = pool;
-		allocInfo.descriptorSetCount = 1;
-		allocInfo.pSetLayouts = &descriptorSetLayout;
-		
-		if (vkAllocateDescriptorSets(device, &allocInfo, &_descriptorSets[i]) != VK_SUCCESS) {
-			std::cerr << "Unable to create descriptor sets." << std::endl;
-		}
-		
-		VkDescriptorBufferInfo bufferCameraInfo = {};
-		bufferCameraInfo.buffer = constants[i];
-		bufferCameraInfo.offset = 0;
-		bufferCameraInfo.range = sizeof(CameraInfos);
-		
-		VkDescriptorBufferInfo bufferLightInfo = {};
-		bufferLightInfo.buffer = constants[i];
-		bufferLightInfo.offset = VulkanUtilities::nextOffset(sizeof(CameraInfos));
-		bufferLightInfo.range = sizeof(LightInfos);
-		
-		VkDescriptorImageInfo imageInfo = {};
-		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageInfo.imageView = _textureColorView;
-		
-		VkDescriptorImageInfo imageNormalInfo = {};
-		imageNormalInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageNormalInfo.imageView = _textureNormalView;
-		
-		VkDescriptorImageInfo imageShadowInfo = {};
-		imageShadowInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageShadowInfo.imageView = shadowMaps[i];
-		
-		std::array<VkWriteDescriptorSet, 5> descriptorWrites = {};
-		descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[0].dstSet = _descriptorSets[i];
-		descriptorWrites[0].dstBinding = 0;
-		descriptorWrites[0].dstArrayElement = 0;
-		descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		descriptorWrites[0].descriptorCount = 1;
-		descriptorWrites[0].pBufferInfo = &bufferCameraInfo;
-		
-		descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[1].dstSet = _descriptorSets[i];
-		descriptorWrites[1].dstBinding = 1;
-		descriptorWrites[1].dstArrayElement = 0;
-		descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		descriptorWrites[1].descriptorCount = 1;
-		descriptorWrites[1].pImageInfo = &imageInfo;
-		
-		descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[2].dstSet = _descriptorSets[i];
-		descriptorWrites[2].dstBinding = 2;
-		descriptorWrites[2].dstArrayElement = 0;
-		descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		descriptorWrites[2].descriptorCount = 1;
-		descriptorWrites[2].pImageInfo = &imageNormalInfo;
-		
-		descriptorWrites[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[3].dstSet = _descriptorSets[i];
-		descriptorWrites[3].dstBinding = 3;
-		descriptorWrites[3].dstArrayElement = 0;
-		descriptorWrites[3].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		descriptorWrites[3].descriptorCount = 1;
-		descriptorWrites[3].pBufferInfo = &bufferLightInfo;
-		
-		descriptorWrites[4].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[4].dstSet = _descriptorSets[i];
-		descriptorWrites[4].dstBinding = 4;
-		descriptorWrites[4].dstArrayElement = 0;
-		descriptorWrites[4].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		descriptorWrites[4].descriptorCount = 1;
-		descriptorWrites[4].pImageInfo = &imageShadowInfo;
-		
-		vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
-		
-		// Shadow descriptor.
-		
-		VkDescriptorSetAllocateInfo allocInfoShadow = {};
-		allocInfoShadow.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfoShadow.descriptorPool = pool;
-		allocInfoShadow.descriptorSetCount = 1;
-		allocInfoShadow.pSetLayouts = &shadowLayout;
-		
-		if (vkAllocateDescriptorSets(device, &allocInfoShadow, &_shadowDescriptorSets[i]) != VK_SUCCESS) {
-			std::cerr << "Unable to create descriptor sets." << std::endl;
-		}
-		
-		
-		std::array<VkWriteDescriptorSet, 1> shadowDescriptorWrites = {};
-		shadowDescriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		shadowDescriptorWrites[0].dstSet = _shadowDescriptorSets[i];
-		shadowDescriptorWrites[0].dstBinding = 0;
-		shadowDescriptorWrites[0].dstArrayElement = 0;
-		shadowDescriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		shadowDescriptorWrites[0].descriptorCount = 1;
-		shadowDescriptorWrites[0].pBufferInfo = &bufferLightInfo;
-		
-		vkUpdateDescriptorSets(device, static_cast<uint32_t>(shadowDescriptorWrites.size()), shadowDescriptorWrites.data(), 0, nullptr);
+	if (vkAllocateDescriptorSets(device, &allocInfo, &_descriptorSet) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
 	}
 	
+	VkDescriptorImageInfo imageInfo = {};
+	imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	imageInfo.imageView = _textureColorView;
+	
+	VkDescriptorImageInfo imageNormalInfo = {};
+	imageNormalInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	imageNormalInfo.imageView = _textureNormalView;
 	
+	std::array<VkWriteDescriptorSet, 2> descriptorWrites = {};
+	descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrites[0].dstSet = _descriptorSet;
+	descriptorWrites[0].dstBinding = 0;
+	descriptorWrites[0].dstArrayElement = 0;
+	descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	descriptorWrites[0].descriptorCount = 1;
+	descriptorWrites[0].pImageInfo = &imageInfo;
 	
+	descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrites[1].dstSet = _descriptorSet;
+	descriptorWrites[1].dstBinding = 1;
+	descriptorWrites[1].dstArrayElement = 0;
+	descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	descriptorWrites[1].descriptorCount = 1;
+	descriptorWrites[1].pImageInfo = &imageNormalInfo;
+	
+	vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 }
 
 void Object::clean(VkDevice & device){
@@ -172,45 +114,26 @@ void Object::clean(VkDevice & device){
 	vkFreeMemory(device, _indexBufferMemory, nullptr);
 }
 
-VkDescriptorSetLayout Object::createDescriptorSetLayout(const VkDevice & device, const VkSampler & sampler, const VkSampler & shadowSampler){
+VkDescriptorSetLayout Object::createDescriptorSetLayout(const VkDevice & device, const VkSampler & sampler){
 	descriptorSetLayout = {};
-	// Descriptor layout for standard objects.
-	// Uniform binding.
-	VkDescriptorSetLayoutBinding uboLayoutBinding = {};
-	uboLayoutBinding.binding = 0;// binding in 0.
-	uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-	uboLayoutBinding.descriptorCount = 1;
-	uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-	
+	// Descriptor layout for standard objects materials.
 	// Image+sampler binding.
 	VkDescriptorSetLayoutBinding samplerLayoutBinding = {};
-	samplerLayoutBinding.binding = 1;
+	samplerLayoutBinding.binding = 0;
 	samplerLayoutBinding.descriptorCount = 1;
 	samplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 	samplerLayoutBinding.pImmutableSamplers = &sampler;
 	// Image+sampler binding.
 	VkDescriptorSetLayoutBinding samplerLayoutNormalBinding = {};
-	samplerLayoutNormalBinding.binding = 2;
+	samplerLayoutNormalBinding.binding = 1;
 	samplerLayoutNormalBinding.descriptorCount = 1;
 	samplerLayoutNormalBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	samplerLayoutNormalBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 	samplerLayoutNormalBinding.pImmutableSamplers = &sampler;
 	
-	VkDescriptorSetLayoutBinding uboLayoutLightBinding = {};
-	uboLayoutLightBinding.binding = 3;
-	uboLayoutLightBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-	uboLayoutLightBinding.descriptorCount = 1;
-	uboLayoutLightBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_VERTEX_BIT;
-	
-	VkDescriptorSetLayoutBinding samplerLayoutShadowmapBinding = {};
-	samplerLayoutShadowmapBinding.binding = 4;
-	samplerLayoutShadowmapBinding.descriptorCount = 1;
-	samplerLayoutShadowmapBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-	samplerLayoutShadowmapBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-	samplerLayoutShadowmapBinding.pImmutableSamplers = &shadowSampler;
 	// Create the layout (== defining a struct)
-	std::array<VkDescriptorSetLayoutBinding, 5> bindings = {uboLayoutBinding, uboLayoutLightBinding, samplerLayoutBinding, samplerLayoutNormalBinding, samplerLayoutShadowmapBinding};
+	std::array<VkDescriptorSetLayoutBinding, 2> bindings = {samplerLayoutBinding, samplerLayoutNormalBinding};
 	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -10,6 +10,7 @@
 #define Object_hpp
 
 #include "common.hpp"
+#include "MipmapGenerator.hpp"
 #include "resources/MeshUtilities.hpp"
 
 class Object {
@@ -19,21 +20,27 @@ public:
 	
 	~Object();
 	
-	void upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue);
+	void upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, MipmapGenerator & mipmaps);
 
 	void clean(VkDevice & device);
 	
-	void generateDescriptorSets(const VkDevice & device, const VkDescriptorSetLayout & shadowLayout, const VkDescriptorPool & pool, const std::vector<VkBuffer> & constants, const std::vector<VkImageView> & shadowMaps, const int count);
+	void generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool);
 	
-	const VkDescriptorSet & descriptorSet(const int i){ return _descriptorSets[i]; }
-	const VkDescriptorSet & shadowDescriptorSet(const int i) const { return _shadowDescriptorSets[i]; }
+	const VkDescriptorSet & descriptorSet() const { return _descriptorSet; }
+	
+	const VkImageView & colorView() const { return _textureColorView; }
+	const VkImageView & normalView() const { return _textureNormalView; }
 	
 	VkBuffer _vertexBuffer;
 	VkBuffer _indexBuffer;
 	uint32_t _count;
+	uint32_t _vertexCount;
+	float _radius;
 	ObjectInfos infos;
+	// Moving objects are not cached in the shadow maps.
+	bool animated;
 	
-	static VkDescriptorSetLayout createDescriptorSetLayout(const VkDevice & device, const VkSampler & sampler, const VkSampler & shadowSampler);
+	static VkDescriptorSetLayout createDescriptorSetLayout(const VkDevice & device, const VkSampler & sampler);
 	static VkDescriptorSetLayout descriptorSetLayout;
 	
 private:
@@ -49,8 +56,7 @@ private:
 	VkDeviceMemory _indexBufferMemory;
 	VkDeviceMemory _textureColorMemory;
 	VkDeviceMemory _textureNormalMemory;
-	std::vector<VkDescriptorSet> _descriptorSets;
-	std::vector<VkDescriptorSet> _shadowDescriptorSets;
+	VkDescriptorSet _descriptorSet;
 };
 
 #endif /* Object_hpp */
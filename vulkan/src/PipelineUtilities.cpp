@@ -9,10 +9,14 @@
 #include "PipelineUtilities.hpp"
 #include "VulkanUtilities.hpp"
 
-void PipelineUtilities::createPipeline(const VkDevice & device, const std::string & moduleName, const VkRenderPass & renderPass,const VkDescriptorSetLayout & descriptorSetLayout, const uint32_t width, const uint32_t height, const bool vertexOnly, const VkCullModeFlags cullMode, const bool depthTest, const bool depthWrite, const bool depthBias, const VkCompareOp compareOp, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline){
+void PipelineUtilities::createPipeline(const VkDevice & device, const std::string & moduleName, const VkRenderPass & renderPass, const std::vector<VkDescriptorSetLayout> & descriptorSetLayouts, const uint32_t width, const uint32_t height, const bool vertexOnly, const VkCullModeFlags cullMode, const bool depthTest, const bool depthWrite, const bool depthBias, const VkCompareOp compareOp, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline){
 	// This is independent from the RTs.
 	/// Shaders.
 	VkShaderModule vertShaderModule = VulkanUtilities::createShaderModule(device, "resources/shaders/compiled/" + moduleName+ ".vert.spv");
+	if(vertShaderModule == VK_NULL_HANDLE){
+		std::cerr << "Unable to create pipeline " << moduleName << "." << std::endl;
+		return;
+	}
 	VkShaderModule fragShaderModule = {};
 	// Vertex shader module.
 	VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
@@ -26,6 +30,11 @@ void PipelineUtilities::createPipeline(const VkDevice & device, const std::strin
 		shaderStages = {vertShaderStageInfo};
 	} else {
 		fragShaderModule = VulkanUtilities::createShaderModule(device, "resources/shaders/compiled/" + moduleName + ".frag.spv");
+		if(fragShaderModule == VK_NULL_HANDLE){
+			std::cerr << "Unable to create pipeline " << moduleName << "." << std::endl;
+			vkDestroyShaderModule(device, vertShaderModule, nullptr);
+			return;
+		}
 		VkPipelineShaderStageCreateInfo fragShaderStageInfo = {};
 		fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 		fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -117,8 +126,8 @@ void PipelineUtilities::createPipeline(const VkDevice & device, const std::strin
 	VkPushConstantRange pushConstantRange = {};
 	
 	// Uniforms setup.
-	pipelineLayoutInfo.setLayoutCount = 1;
-	pipelineLayoutInfo.pSetLayouts = &descriptorSetLayout;
+	pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size());
+	pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
 	pipelineLayoutInfo.pushConstantRangeCount = 0;
 	if(pushSize > 0){
 		pipelineLayoutInfo.pushConstantRangeCount = 1;
@@ -162,3 +171,48 @@ void PipelineUtilities::createPipeline(const VkDevice & device, const std::strin
 		vkDestroyShaderModule(device, fragShaderModule, nullptr);
 	}
 }
+
+void PipelineUtilities::createComputePipeline(const VkDevice & device, const std::string & moduleName, const std::vector<VkDescriptorSetLayout> & descriptorSetLayouts, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline){
+	/// Shader.
+	VkShaderModule compShaderModule = VulkanUtilities::createShaderModule(device, "resources/shaders/compiled/" + moduleName + ".comp.spv");
+	if(compShaderModule == VK_NULL_HANDLE){
+		std::cerr << "Unable to create compute pipeline " << moduleName << "." << std::endl;
+		return;
+	}
+	VkPipelineShaderStageCreateInfo compShaderStageInfo = {};
+	compShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	compShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	compShaderStageInfo.module = compShaderModule;
+	compShaderStageInfo.pName = "main";
+	
+	// Layout.
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size());
+	pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
+	pipelineLayoutInfo.pushConstantRangeCount = 0;
+	VkPushConstantRange pushConstantRange = {};
+	if(pushSize > 0){
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = static_cast<uint32_t>(pushSize);
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+	}
+	if(vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
+		std::cerr << "Unable to create pipeline layout." << std::endl;
+		return;
+	}
+	
+	VkComputePipelineCreateInfo pipelineInfo = {};
+	pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	pipelineInfo.stage = compShaderStageInfo;
+	pipelineInfo.layout = pipelineLayout;
+	pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+	pipelineInfo.basePipelineIndex = -1;
+	if(vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
+		std::cerr << "Unable to create compute pipeline." << std::endl;
+	}
+	
+	vkDestroyShaderModule(device, compShaderModule, nullptr);
+}
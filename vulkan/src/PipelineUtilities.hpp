@@ -13,7 +13,9 @@
 
 class PipelineUtilities {
 public:
-	static void createPipeline(const VkDevice & device, const std::string & moduleName, const VkRenderPass & renderPass,const VkDescriptorSetLayout & descriptorSetLayout, const uint32_t width, const uint32_t height, const bool vertexOnly, const VkCullModeFlags cullMode, const bool depthTest, const bool depthWrite, const bool depthBias, const VkCompareOp compareOp, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline);
+	static void createPipeline(const VkDevice & device, const std::string & moduleName, const VkRenderPass & renderPass, const std::vector<VkDescriptorSetLayout> & descriptorSetLayouts, const uint32_t width, const uint32_t height, const bool vertexOnly, const VkCullModeFlags cullMode, const bool depthTest, const bool depthWrite, const bool depthBias, const VkCompareOp compareOp, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline);
+	
+	static void createComputePipeline(const VkDevice & device, const std::string & moduleName, const std::vector<VkDescriptorSetLayout> & descriptorSetLayouts, const int pushSize, VkPipelineLayout & pipelineLayout, VkPipeline & pipeline);
 };
 
 #endif /* PipelineUtilities_hpp */
@@ -2,15 +2,17 @@
 #include "VulkanUtilities.hpp"
 #include "PipelineUtilities.hpp"
 #include "resources/Resources.hpp"
+#include "input/Input.hpp"
 
 #include <array>
 
 
+bool Renderer::allowGPUDriven = true;
 
 Renderer::~Renderer(){
 }
 
-Renderer::Renderer(Swapchain & swapchain, const int width, const int height) : _skybox("cubemap"), _shadowPass(2048, 2048){
+Renderer::Renderer(Swapchain & swapchain, const int width, const int height) : _skybox("cubemap"), _shadowPass(1024, 1024){
 	
 	const auto & physicalDevice = swapchain.physicalDevice;
 	const auto & commandPool = swapchain.commandPool;
@@ -19,82 +21,206 @@ Renderer::Renderer(Swapchain & swapchain, const int width, const int height) : _
 	const uint32_t count = swapchain.count;
 	_device = swapchain.device;
 	
-	_lightProj = glm::ortho(-5.0, 5.0, -5.0, 5.0, 0.1, 5.0);
-	_lightProj[1][1] *= -1;
 	_worldLightDir = glm::normalize(glm::vec4(1.0f,1.0f,1.0f,0.0f));
-	glm::mat4 lightView = glm::lookAt(2.0f*glm::vec3(_worldLightDir), glm::vec3(0.0f), glm::vec3(0.0,1.0,0.0));
-	_lightViewproj = _lightProj * lightView;
 	
 	_objects.emplace_back("dragon", 64);
 	_objects.back().infos.model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(-0.5f,0.0f,-0.5f)), glm::vec3(1.2f));
 	_objects.emplace_back("suzanne", 8);
 	_objects.back().infos.model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.5, 0.0, 0.5)), glm::vec3(0.65f));
+	_objects.back().animated = true;
 	_objects.emplace_back("plane", 32);
 	_objects.back().infos.model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0,-0.8,0.0)), glm::vec3(2.75f));
 	_skybox.infos.model = glm::scale(glm::mat4(1.0f), glm::vec3(15.0f));
 	
 	_size = glm::vec2(width, height);
+	_camera.ratio(float(width)/float(height));
 	
 	_shadowPass.init(physicalDevice, _device, commandPool,count);
+	_shadowPass.update(_camera, glm::vec3(_worldLightDir));
 	
 	// Create sampler.
 	_textureSampler = VulkanUtilities::createSampler(_device, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_REPEAT, MAX_MIPMAP_LEVELS);
 	
-	// Objects setup.
+	// Objects setup. All textures are uploaded and their levels generated in a single submission.
+	MipmapGenerator mipmaps;
+	mipmaps.init(physicalDevice, _device, commandPool);
+	mipmaps.begin();
 	for(auto & object : _objects){
-		object.upload(physicalDevice, _device, commandPool, graphicsQueue);
+		object.upload(physicalDevice, _device, commandPool, graphicsQueue, mipmaps);
 	}
-	_skybox.upload(physicalDevice, _device, commandPool, graphicsQueue);
+	_skybox.upload(physicalDevice, _device, commandPool, graphicsQueue, mipmaps);
+	mipmaps.end(graphicsQueue);
+	mipmaps.clean();
 	
 	Skybox::createDescriptorSetLayout(_device, _textureSampler);
-	Object::createDescriptorSetLayout(_device, _textureSampler, _shadowPass.depthSampler);
+	Object::createDescriptorSetLayout(_device, _textureSampler);
+	
+	// Per-frame layout: camera, light and object infos with dynamic offsets, and the shadow map.
+	std::array<VkDescriptorSetLayoutBinding, 4> frameBindings = {};
+	frameBindings[0].binding = 0;
+	frameBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	frameBindings[0].descriptorCount = 1;
+	frameBindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	frameBindings[1].binding = 1;
+	frameBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	frameBindings[1].descriptorCount = 1;
+	frameBindings[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_VERTEX_BIT;
+	frameBindings[2].binding = 2;
+	frameBindings[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	frameBindings[2].descriptorCount = 1;
+	frameBindings[2].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_VERTEX_BIT;
+	frameBindings[3].binding = 3;
+	frameBindings[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	frameBindings[3].descriptorCount = 1;
+	frameBindings[3].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+	frameBindings[3].pImmutableSamplers = &_shadowPass.depthSampler;
+	VkDescriptorSetLayoutCreateInfo frameLayoutInfo = {};
+	frameLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	frameLayoutInfo.bindingCount = static_cast<uint32_t>(frameBindings.size());
+	frameLayoutInfo.pBindings = frameBindings.data();
+	if (vkCreateDescriptorSetLayout(_device, &frameLayoutInfo, nullptr, &_frameDescriptorSetLayout) != VK_SUCCESS) {
+		std::cerr << "Unable to create frame descriptor." << std::endl;
+	}
+	
+	/// Uniform ring.
+	// Each frame stores the camera, the light, and one infos block for each object and the skybox.
+	const uint32_t drawCount = static_cast<uint32_t>(_objects.size()) + 1;
+	// The shadow cascades and the culling views are also stored there.
+	const VkDeviceSize frameSize = VulkanUtilities::nextOffset(sizeof(CameraInfos)) + VulkanUtilities::nextOffset(sizeof(LightInfos)) + drawCount * VulkanUtilities::nextOffset(sizeof(ObjectInfos)) + SHADOW_CASCADES * VulkanUtilities::nextOffset(sizeof(CascadeInfos)) + VulkanUtilities::nextOffset(sizeof(CullInfos));
+	_uniforms.init(physicalDevice, _device, frameSize, count);
+	_objectOffsets.resize(_objects.size());
+	_cascadeOffsets.resize(SHADOW_CASCADES);
+	
+	/// Timestamps.
+	if(swapchain.timestamps){
+		VkQueryPoolCreateInfo queryInfo = {};
+		queryInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryInfo.queryCount = 2 * count;
+		if(vkCreateQueryPool(_device, &queryInfo, nullptr, &_queryPool) != VK_SUCCESS){
+			std::cerr << "Unable to create timestamp query pool." << std::endl;
+			_queryPool = VK_NULL_HANDLE;
+		}
+		_timestampPeriod = double(swapchain.timestampPeriod);
+		// Only the low bits of the timestamps are meaningful.
+		_timestampMask = swapchain.timestampValidBits >= 64 ? ~uint64_t(0) : ((uint64_t(1) << swapchain.timestampValidBits) - 1);
+	}
 	
+	/// GPU-driven path.
+	_gpuDriven = allowGPUDriven && swapchain.indirectCount && _objects.size() <= MAX_INDIRECT_MATERIALS;
+	if(_gpuDriven){
+		_indirect.init(physicalDevice, _device, commandPool, graphicsQueue, _objects, _textureSampler, _uniforms.buffer(), _shadowPass, count);
+		std::cout << "Using GPU-driven rendering." << std::endl;
+	}
 	
 	/// Pipeline.
 	createPipelines(finalRenderPass);
 	
-	/// Uniform buffers.
-	VkDeviceSize bufferSize = VulkanUtilities::nextOffset(sizeof(CameraInfos)) + sizeof(LightInfos);
-	_uniformBuffers.resize(count);
-	_uniformBuffersMemory.resize(count);
-	for (size_t i = 0; i < count; i++) {
-		VulkanUtilities::createBuffer(physicalDevice, _device, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, _uniformBuffers[i], _uniformBuffersMemory[i]);
-	}
-	
 	// Create descriptor pools.
-	// 2 pools: one for uniform, one for image+sampler.
-	const uint32_t objectsCount = static_cast<uint32_t>(_objects.size()*2)+1;
-	std::array<VkDescriptorPoolSize, 3> poolSizes = {};
-	poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-	poolSizes[0].descriptorCount = objectsCount*count*4;
-	poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-	poolSizes[1].descriptorCount = objectsCount*count*4;
-	poolSizes[2].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-	poolSizes[2].descriptorCount = objectsCount*count*4;
+	// Per-frame sets use dynamic uniforms, materials only use images+samplers.
+	const uint32_t materialsCount = static_cast<uint32_t>(_objects.size()) + 1;
+	std::array<VkDescriptorPoolSize, 2> poolSizes = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	poolSizes[0].descriptorCount = materialsCount*2 + count;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	poolSizes[1].descriptorCount = count*3 + 2;
 	VkDescriptorPoolCreateInfo descPoolInfo = {};
 	descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
 	descPoolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
 	descPoolInfo.pPoolSizes = poolSizes.data();
-	descPoolInfo.maxSets = objectsCount*count;
+	descPoolInfo.maxSets = materialsCount + count + 1;
 	
 	if (vkCreateDescriptorPool(_device, &descPoolInfo, nullptr, &_descriptorPool) != VK_SUCCESS) {
 		std::cerr << "Unable to create descriptor pool." << std::endl;
 	}
 	
-	
 	// Create descriptors sets.
 	for(auto & object : _objects){
-		object.generateDescriptorSets(_device, _shadowPass.descriptorSetLayout, _descriptorPool, _uniformBuffers, _shadowPass.depthViews, count);
+		object.generateDescriptorSets(_device, _descriptorPool);
 	}
-	_skybox.generateDescriptorSets(_device, _descriptorPool, _uniformBuffers, count);
-	//_shadowPass.generateCommandBuffer(_objects);
-	
-	
+	_skybox.generateDescriptorSets(_device, _descriptorPool);
+	_shadowPass.generateDescriptorSet(_device, _descriptorPool, _uniforms.buffer());
+	createFrameDescriptorSets(count);
 }
+
 void Renderer::createPipelines(const VkRenderPass & finalRenderPass){
-	const int pushSize = (16 + 1) * 4;
-	PipelineUtilities::createPipeline(_device, "object", finalRenderPass, Object::descriptorSetLayout, _size[0], _size[1], false, VK_CULL_MODE_BACK_BIT, true, true, false, VK_COMPARE_OP_LESS, pushSize, _objectPipelineLayout, _objectPipeline);
-	PipelineUtilities::createPipeline(_device, "skybox", finalRenderPass, Skybox::descriptorSetLayout, _size[0], _size[1], false, VK_CULL_MODE_FRONT_BIT, true, false, false, VK_COMPARE_OP_LESS_OR_EQUAL, pushSize, _skyboxPipelineLayout, _skyboxPipeline);
+	// Set 0 contains per-frame data, set 1 the material textures.
+	PipelineUtilities::createPipeline(_device, "object", finalRenderPass, {_frameDescriptorSetLayout, Object::descriptorSetLayout}, _size[0], _size[1], false, VK_CULL_MODE_BACK_BIT, true, true, false, VK_COMPARE_OP_LESS, 0, _objectPipelineLayout, _objectPipeline);
+	PipelineUtilities::createPipeline(_device, "skybox", finalRenderPass, {_frameDescriptorSetLayout, Skybox::descriptorSetLayout}, _size[0], _size[1], false, VK_CULL_MODE_FRONT_BIT, true, false, false, VK_COMPARE_OP_LESS_OR_EQUAL, 0, _skyboxPipelineLayout, _skyboxPipeline);
+	if(_gpuDriven){
+		_indirect.createPipelines(finalRenderPass, _frameDescriptorSetLayout, _size[0], _size[1]);
+	}
+}
+
+void Renderer::createFrameDescriptorSets(const uint32_t count){
+	_frameDescriptorSets.resize(count);
+	std::vector<VkDescriptorSetLayout> layouts(count, _frameDescriptorSetLayout);
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = _descriptorPool;
+	allocInfo.descriptorSetCount = count;
+	allocInfo.pSetLayouts = layouts.data();
+	if (vkAllocateDescriptorSets(_device, &allocInfo, _frameDescriptorSets.data()) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
+	}
+	
+	// All uniforms live in the ring, offsets will be provided at bind time.
+	VkDescriptorBufferInfo bufferCameraInfo = {};
+	bufferCameraInfo.buffer = _uniforms.buffer();
+	bufferCameraInfo.offset = 0;
+	bufferCameraInfo.range = sizeof(CameraInfos);
+	
+	VkDescriptorBufferInfo bufferLightInfo = {};
+	bufferLightInfo.buffer = _uniforms.buffer();
+	bufferLightInfo.offset = 0;
+	bufferLightInfo.range = sizeof(LightInfos);
+	
+	VkDescriptorBufferInfo bufferObjectInfo = {};
+	bufferObjectInfo.buffer = _uniforms.buffer();
+	bufferObjectInfo.offset = 0;
+	bufferObjectInfo.range = sizeof(ObjectInfos);
+	
+	for(size_t i = 0; i < count; ++i){
+		// The shadow map is the only resource that differs between frames.
+		VkDescriptorImageInfo imageShadowInfo = {};
+		imageShadowInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		imageShadowInfo.imageView = _shadowPass.depthViews[i];
+		
+		std::array<VkWriteDescriptorSet, 4> descriptorWrites = {};
+		descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[0].dstSet = _frameDescriptorSets[i];
+		descriptorWrites[0].dstBinding = 0;
+		descriptorWrites[0].dstArrayElement = 0;
+		descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		descriptorWrites[0].descriptorCount = 1;
+		descriptorWrites[0].pBufferInfo = &bufferCameraInfo;
+		
+		descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[1].dstSet = _frameDescriptorSets[i];
+		descriptorWrites[1].dstBinding = 1;
+		descriptorWrites[1].dstArrayElement = 0;
+		descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		descriptorWrites[1].descriptorCount = 1;
+		descriptorWrites[1].pBufferInfo = &bufferLightInfo;
+		
+		descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[2].dstSet = _frameDescriptorSets[i];
+		descriptorWrites[2].dstBinding = 2;
+		descriptorWrites[2].dstArrayElement = 0;
+		descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		descriptorWrites[2].descriptorCount = 1;
+		descriptorWrites[2].pBufferInfo = &bufferObjectInfo;
+		
+		descriptorWrites[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[3].dstSet = _frameDescriptorSets[i];
+		descriptorWrites[3].dstBinding = 3;
+		descriptorWrites[3].dstArrayElement = 0;
+		descriptorWrites[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrites[3].descriptorCount = 1;
+		descriptorWrites[3].pImageInfo = &imageShadowInfo;
+		
+		vkUpdateDescriptorSets(_device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+	}
 }
 
 void Renderer::updateUniforms(const uint32_t index){
@@ -104,15 +230,41 @@ void Renderer::updateUniforms(const uint32_t index){
 	ubo.proj[1][1] *= -1; // Flip compared to OpenGL.
 	
 	LightInfos light = {};
-	light.mvp = _lightViewproj;
+	for(int c = 0; c < SHADOW_CASCADES; ++c){
+		light.viewprojs[c] = _shadowPass.viewprojs[c];
+	}
+	light.splits = _shadowPass.splits;
 	light.viewSpaceDir = glm::vec3(glm::normalize(ubo.view * _worldLightDir));
-	// Send data.
-	void* data;
-	vkMapMemory(_device, _uniformBuffersMemory[index], 0, sizeof(ubo)+sizeof(light), 0, &data);
-	memcpy(data, &ubo, sizeof(ubo));
-	memcpy(static_cast<char*>(data) + VulkanUtilities::nextOffset(sizeof(CameraInfos)), &light, sizeof(light));
-	vkUnmapMemory(_device, _uniformBuffersMemory[index]);
 	
+	// Write everything in the persistently mapped region for this frame.
+	_uniforms.begin(index);
+	_cameraOffset = _uniforms.push(ubo);
+	_lightOffset = _uniforms.push(light);
+	for(size_t i = 0; i < _objects.size(); ++i){
+		_objectOffsets[i] = _uniforms.push(_objects[i].infos);
+	}
+	_skyboxOffset = _uniforms.push(_skybox.infos);
+	for(int c = 0; c < SHADOW_CASCADES; ++c){
+		CascadeInfos cascade = {};
+		cascade.viewproj = _shadowPass.viewprojs[c];
+		_cascadeOffsets[c] = _uniforms.push(cascade);
+	}
+	
+	if(_gpuDriven){
+		// Cull against the camera, and the static and dynamic views of each cascade.
+		CullInfos cull = {};
+		cull.viewprojs[0] = ubo.proj * ubo.view;
+		cull.masks[0] = glm::uvec4(INSTANCE_STATIC | INSTANCE_DYNAMIC);
+		for(int c = 0; c < SHADOW_CASCADES; ++c){
+			cull.viewprojs[1 + 2 * c] = _shadowPass.viewprojs[c];
+			cull.masks[1 + 2 * c] = glm::uvec4(INSTANCE_STATIC);
+			cull.viewprojs[2 + 2 * c] = _shadowPass.viewprojs[c];
+			cull.masks[2 + 2 * c] = glm::uvec4(INSTANCE_DYNAMIC);
+		}
+		cull.counts = glm::uvec4(_objects.size(), MAX_CULL_VIEWS, 0, 0);
+		_cullOffset = _uniforms.push(cull);
+		_indirect.update(index, _objects);
+	}
 }
 
 void Renderer::encode(const VkQueue & graphicsQueue, const uint32_t imageIndex, VkCommandBuffer & finalCommmandBuffer, VkRenderPassBeginInfo & finalPassInfos, const VkSemaphore & startSemaphore, const VkSemaphore & endSemaphore, const VkFence & submissionFence){
@@ -126,47 +278,35 @@ void Renderer::encode(const VkQueue & graphicsQueue, const uint32_t imageIndex,
 	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
 	
 	vkBeginCommandBuffer(finalCommmandBuffer, &beginInfo);
-	
-	VkRenderPassBeginInfo shadowInfos = {};
-	shadowInfos.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-	shadowInfos.renderPass = _shadowPass.renderPass;
-	shadowInfos.framebuffer = _shadowPass.frameBuffers[imageIndex];
-	shadowInfos.renderArea.offset = { 0, 0 };
-	shadowInfos.renderArea.extent = _shadowPass.extent;
-	std::array<VkClearValue, 1> clearValuesShadow = {};
-	clearValuesShadow[0].depthStencil = {1.0f, 0};
-	shadowInfos.clearValueCount = static_cast<uint32_t>(clearValuesShadow.size());
-	shadowInfos.pClearValues = clearValuesShadow.data();
-	
-	vkCmdBeginRenderPass(finalCommmandBuffer, &shadowInfos, VK_SUBPASS_CONTENTS_INLINE);
-	vkCmdBindPipeline(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPass.pipeline);
-	for(auto & object : _objects){
-		VkBuffer vertexBuffers[] = {object._vertexBuffer};
-		vkCmdBindVertexBuffers(finalCommmandBuffer, 0, 1, vertexBuffers, offsets);
-		vkCmdBindIndexBuffer(finalCommmandBuffer, object._indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-		vkCmdBindDescriptorSets(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPass.pipelineLayout, 0, 1, &object.shadowDescriptorSet(imageIndex), 0, nullptr);
-		vkCmdPushConstants(finalCommmandBuffer, _shadowPass.pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, (16+1)*4, &object.infos);
-		vkCmdDrawIndexed(finalCommmandBuffer, object._count, 1, 0, 0, 0);
+	if(_queryPool != VK_NULL_HANDLE){
+		vkCmdResetQueryPool(finalCommmandBuffer, _queryPool, 2 * imageIndex, 2);
+		vkCmdWriteTimestamp(finalCommmandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, _queryPool, 2 * imageIndex);
 	}
-	vkCmdEndRenderPass(finalCommmandBuffer);
-	
-	VkImageMemoryBarrier barrier = {};
-	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-	barrier.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-	barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // We don't change queue here.
-	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.image = _shadowPass.depthImages[imageIndex];
-	barrier.subresourceRange.baseMipLevel = 0;
-	barrier.subresourceRange.levelCount = 1;
-	barrier.subresourceRange.baseArrayLayer = 0;
-	barrier.subresourceRange.layerCount = 1;
-	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-	barrier.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 	
-	vkCmdPipelineBarrier(finalCommmandBuffer,  VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	if(_gpuDriven){
+		_indirect.cull(finalCommmandBuffer, imageIndex, _cullOffset);
+	}
 	
+	// ---- Shadow pass.
+	for(uint32_t c = 0; c < SHADOW_CASCADES; ++c){
+		// Static geometry is cached again once the cascade stops moving.
+		if(!_shadowPass.cached(c) && !_shadowPass.moving(c)){
+			_shadowPass.beginStatic(finalCommmandBuffer, c);
+			drawShadowCasters(finalCommmandBuffer, imageIndex, c, false);
+			_shadowPass.endStatic(finalCommmandBuffer, c);
+		}
+		// Moving objects are rendered on top of a copy of the cache, else everything is rendered directly.
+		if(_shadowPass.cached(c)){
+			_shadowPass.restore(finalCommmandBuffer, imageIndex, c);
+		}
+		_shadowPass.begin(finalCommmandBuffer, imageIndex, c);
+		if(!_shadowPass.cached(c)){
+			drawShadowCasters(finalCommmandBuffer, imageIndex, c, false);
+		}
+		drawShadowCasters(finalCommmandBuffer, imageIndex, c, true);
+		_shadowPass.end(finalCommmandBuffer);
+	}
+	_shadowPass.finish(finalCommmandBuffer, imageIndex);
 	
 	// ---- Final pass.
 	// Complete final pass infos.
@@ -179,51 +319,102 @@ void Renderer::encode(const VkQueue & graphicsQueue, const uint32_t imageIndex,
 	vkCmdBeginRenderPass(finalCommmandBuffer, &finalPassInfos, VK_SUBPASS_CONTENTS_INLINE);
 	
 	// Bind and draw.
-	vkCmdBindPipeline(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipeline);
-	for(auto & object : _objects){
-		VkBuffer vertexBuffers[] = {object._vertexBuffer};
-		vkCmdBindVertexBuffers(finalCommmandBuffer, 0, 1, vertexBuffers, offsets);
-		vkCmdBindIndexBuffer(finalCommmandBuffer, object._indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-		vkCmdBindDescriptorSets(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipelineLayout, 0, 1, &object.descriptorSet(imageIndex), 0, nullptr);
-		vkCmdPushConstants(finalCommmandBuffer, _objectPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, (16+1)*4, &object.infos);
-		vkCmdDrawIndexed(finalCommmandBuffer, object._count, 1, 0, 0, 0);
+	const VkDescriptorSet & frameSet = _frameDescriptorSets[imageIndex];
+	if(_gpuDriven){
+		const std::array<uint32_t, 3> frameOffsets = { _cameraOffset, _lightOffset, _objectOffsets[0] };
+		_indirect.draw(finalCommmandBuffer, imageIndex, frameSet, frameOffsets);
+	} else {
+		vkCmdBindPipeline(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipeline);
+		for(size_t i = 0; i < _objects.size(); ++i){
+			const auto & object = _objects[i];
+			VkBuffer vertexBuffers[] = {object._vertexBuffer};
+			vkCmdBindVertexBuffers(finalCommmandBuffer, 0, 1, vertexBuffers, offsets);
+			vkCmdBindIndexBuffer(finalCommmandBuffer, object._indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+			// Frame set with the offsets for this object, and material set.
+			const std::array<VkDescriptorSet, 2> sets = { frameSet, object.descriptorSet() };
+			const std::array<uint32_t, 3> objectOffsets = { _cameraOffset, _lightOffset, _objectOffsets[i] };
+			vkCmdBindDescriptorSets(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _objectPipelineLayout, 0, static_cast<uint32_t>(sets.size()), sets.data(), static_cast<uint32_t>(objectOffsets.size()), objectOffsets.data());
+			vkCmdDrawIndexed(finalCommmandBuffer, object._count, 1, 0, 0, 0);
+		}
 	}
 	vkCmdBindPipeline(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _skyboxPipeline);
 	VkBuffer vertexBuffers[] = {_skybox._vertexBuffer};
 	vkCmdBindVertexBuffers(finalCommmandBuffer, 0, 1, vertexBuffers, offsets);
 	vkCmdBindIndexBuffer(finalCommmandBuffer, _skybox._indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-	vkCmdBindDescriptorSets(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _skyboxPipelineLayout, 0, 1, &_skybox.descriptorSet(imageIndex), 0, nullptr);
-	vkCmdPushConstants(finalCommmandBuffer, _skyboxPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, (16+1)*4, &_skybox.infos.model);
+	const std::array<VkDescriptorSet, 2> skyboxSets = { frameSet, _skybox.descriptorSet() };
+	const std::array<uint32_t, 3> skyboxOffsets = { _cameraOffset, _lightOffset, _skyboxOffset };
+	vkCmdBindDescriptorSets(finalCommmandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _skyboxPipelineLayout, 0, static_cast<uint32_t>(skyboxSets.size()), skyboxSets.data(), static_cast<uint32_t>(skyboxOffsets.size()), skyboxOffsets.data());
 	vkCmdDrawIndexed(finalCommmandBuffer, _skybox._count, 1, 0, 0, 0);
 	
 	// Finish final pass and command buffer.
 	vkCmdEndRenderPass(finalCommmandBuffer);
+	if(_queryPool != VK_NULL_HANDLE){
+		vkCmdWriteTimestamp(finalCommmandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, _queryPool, 2 * imageIndex + 1);
+	}
 	vkEndCommandBuffer(finalCommmandBuffer);
 	// SUbmit the last command buffer.
+	// Offscreen rendering has no semaphores, only the fence.
 	VkSubmitInfo submitInfo = {};
 	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.waitSemaphoreCount = 1;
+	submitInfo.waitSemaphoreCount = startSemaphore != VK_NULL_HANDLE ? 1 : 0;
 	submitInfo.pWaitSemaphores = &startSemaphore;
 	submitInfo.pWaitDstStageMask = waitStages;
 	submitInfo.commandBufferCount = 1;
 	submitInfo.pCommandBuffers = &finalCommmandBuffer;
 	// Semaphore for when the command buffer is done, so that we can present the image.
 	VkSemaphore signalSemaphores[] = { endSemaphore };
-	submitInfo.signalSemaphoreCount = 1;
+	submitInfo.signalSemaphoreCount = endSemaphore != VK_NULL_HANDLE ? 1 : 0;
 	submitInfo.pSignalSemaphores = signalSemaphores;
 	// Add the fence so that we don't reuse the command buffer while it's in use.
 	vkResetFences(_device, 1, &submissionFence);
 	vkQueueSubmit(graphicsQueue, 1, &submitInfo, submissionFence);
 }
 
+void Renderer::drawShadowCasters(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade, const bool animated){
+	if(_gpuDriven){
+		// The object uniform is unused but still needs a valid offset.
+		const uint32_t view = 1 + 2 * cascade + (animated ? 1 : 0);
+		const std::array<uint32_t, 2> shadowOffsets = { _cascadeOffsets[cascade], _objectOffsets[0] };
+		_indirect.drawShadows(commandBuffer, index, view, _shadowPass.descriptorSet, shadowOffsets);
+		return;
+	}
+	VkDeviceSize offsets[1] = { 0 };
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPass.pipeline);
+	for(size_t i = 0; i < _objects.size(); ++i){
+		const auto & object = _objects[i];
+		if(object.animated != animated){
+			continue;
+		}
+		VkBuffer vertexBuffers[] = {object._vertexBuffer};
+		vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+		vkCmdBindIndexBuffer(commandBuffer, object._indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+		const std::array<uint32_t, 2> shadowOffsets = { _cascadeOffsets[cascade], _objectOffsets[i] };
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _shadowPass.pipelineLayout, 0, 1, &_shadowPass.descriptorSet, static_cast<uint32_t>(shadowOffsets.size()), shadowOffsets.data());
+		vkCmdDrawIndexed(commandBuffer, object._count, 1, 0, 0, 0);
+	}
+}
+
 void Renderer::update(const double deltaTime) {
 	_time += deltaTime;
-	_camera.update();
-	_camera.physics(deltaTime);
+	if(_cameraPath){
+		// Slow orbit around the scene, bobbing up and down.
+		const float angle = float(0.3 * _time);
+		const glm::vec3 eye(2.5f * cos(angle), 0.6f + 0.3f * float(sin(0.5 * _time)), 2.5f * sin(angle));
+		_camera.pose(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	} else {
+		_camera.update();
+		_camera.physics(deltaTime);
+	}
 	
-	_worldLightDir = glm::normalize(glm::vec4(1.0,0.5*sin(_time)+0.6, 1.0,0.0));
-	glm::mat4 lightView = glm::lookAt(2.0f*glm::vec3(_worldLightDir), glm::vec3(0.0f), glm::vec3(0.0,1.0,0.0));
-	_lightViewproj = _lightProj * lightView;
+	// Pausing the light keeps the static shadows cached.
+	if(Input::manager().triggered(Input::KeyL)){
+		_animateLight = !_animateLight;
+	}
+	if(_animateLight){
+		_lightTime += deltaTime;
+	}
+	_worldLightDir = glm::normalize(glm::vec4(1.0,0.5*sin(_lightTime)+0.6, 1.0,0.0));
+	_shadowPass.update(_camera, glm::vec3(_worldLightDir));
 	
 	//TODO: don't rely on arbitrary indexing.
 	_objects[1].infos.model = glm::scale(glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(0.5,0.0,0.5)), float(fmod(_time, 2*M_PI)), glm::vec3(0.0f,1.0f,0.0f)) , glm::vec3(0.65));
@@ -240,10 +431,27 @@ void Renderer::resize(VkRenderPass & finalRenderPass, const int width, const int
 	vkDestroyPipelineLayout(_device, _objectPipelineLayout, nullptr);
 	vkDestroyPipeline(_device, _skyboxPipeline, nullptr);
 	vkDestroyPipelineLayout(_device, _skyboxPipelineLayout, nullptr);
+	if(_gpuDriven){
+		_indirect.cleanPipelines();
+	}
 	
 	createPipelines(finalRenderPass);
 }
 
+double Renderer::gpuTime(const uint32_t index){
+	if(_queryPool == VK_NULL_HANDLE || _timestampMask == 0){
+		return -1.0;
+	}
+	uint64_t timestamps[2] = {0, 0};
+	const VkResult status = vkGetQueryPoolResults(_device, _queryPool, 2 * index, 2, sizeof(timestamps), timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+	if(status != VK_SUCCESS){
+		return -1.0;
+	}
+	// Masking the difference also handles a counter wrapping around between both queries.
+	const uint64_t elapsed = ((timestamps[1] & _timestampMask) - (timestamps[0] & _timestampMask)) & _timestampMask;
+	return double(elapsed) * _timestampPeriod * 1e-6;
+}
+
 void Renderer::clean(){
 	vkDestroyPipeline(_device, _objectPipeline, nullptr);
 	vkDestroyPipelineLayout(_device, _objectPipelineLayout, nullptr);
@@ -255,10 +463,14 @@ void Renderer::clean(){
 	
 	vkDestroyDescriptorSetLayout(_device, Object::descriptorSetLayout, nullptr);
 	vkDestroyDescriptorSetLayout(_device, Skybox::descriptorSetLayout, nullptr);
+	vkDestroyDescriptorSetLayout(_device, _frameDescriptorSetLayout, nullptr);
 
-	for (size_t i = 0; i < _uniformBuffers.size(); i++) {
-		vkDestroyBuffer(_device, _uniformBuffers[i], nullptr);
-		vkFreeMemory(_device, _uniformBuffersMemory[i], nullptr);
+	_uniforms.clean(_device);
+	if(_queryPool != VK_NULL_HANDLE){
+		vkDestroyQueryPool(_device, _queryPool, nullptr);
+	}
+	if(_gpuDriven){
+		_indirect.clean();
 	}
 	for(auto & object : _objects){
 		object.clean(_device);
@@ -3,6 +3,8 @@
 #include "Skybox.hpp"
 #include "ShadowPass.hpp"
 #include "Swapchain.hpp"
+#include "UniformRing.hpp"
+#include "IndirectScene.hpp"
 
 #include "VulkanUtilities.hpp"
 #include "input/ControllableCamera.hpp"
@@ -28,10 +30,21 @@ public:
 	
 	void clean();
 	
+	/// Follow a fixed camera path instead of the user inputs, for reproducible benchmarks.
+	void useCameraPath(){ _cameraPath = true; }
+	
+	/// Allow the GPU-driven path when the device supports it, else always draw objects one by one.
+	static bool allowGPUDriven;
+	
+	/// GPU duration of the last frame encoded with the given index, in milliseconds (negative if unavailable). The frame has to be complete.
+	double gpuTime(const uint32_t index);
+	
 private:
 	
 	void createPipelines(const VkRenderPass & finalRenderPass);
+	void createFrameDescriptorSets(const uint32_t count);
 	void updateUniforms(const uint32_t index);
+	void drawShadowCasters(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade, const bool animated);
 	
 	glm::vec2 _size = glm::vec2(0.0f,0.0f);
 	double _time = 0.0;
@@ -40,10 +53,11 @@ private:
 	std::vector<Object> _objects;
 	Skybox _skybox;
 	ControllableCamera _camera;
+	bool _cameraPath = false;
 	// Light
-	glm::mat4 _lightViewproj;
 	glm::vec4 _worldLightDir;
-	glm::mat4 _lightProj;
+	double _lightTime = 0.0;
+	bool _animateLight = true;
 	
 	// Vulkan
 	VkDevice _device;
@@ -52,15 +66,29 @@ private:
 	
 	// Pipelines
 	ShadowPass _shadowPass;
+	// GPU-driven path, used when indirect count draws are supported.
+	IndirectScene _indirect;
+	bool _gpuDriven = false;
 	VkPipelineLayout _objectPipelineLayout;
 	VkPipeline _objectPipeline;
 	VkPipelineLayout _skyboxPipelineLayout;
 	VkPipeline _skyboxPipeline;
 	
 	// Per frame data.
-	std::vector<VkBuffer> _uniformBuffers;
-	std::vector<VkDeviceMemory> _uniformBuffersMemory;
-	
+	UniformRing _uniforms;
+	// Two timestamps per frame, if supported.
+	VkQueryPool _queryPool = VK_NULL_HANDLE;
+	double _timestampPeriod = 0.0;
+	uint64_t _timestampMask = 0;
+	VkDescriptorSetLayout _frameDescriptorSetLayout;
+	std::vector<VkDescriptorSet> _frameDescriptorSets;
+	// Dynamic offsets in the uniform ring for the current frame.
+	uint32_t _cameraOffset = 0;
+	uint32_t _lightOffset = 0;
+	std::vector<uint32_t> _cascadeOffsets;
+	std::vector<uint32_t> _objectOffsets;
+	uint32_t _skyboxOffset = 0;
+	uint32_t _cullOffset = 0;
 	
 };
 
@@ -11,6 +11,9 @@
 #include "resources/MeshUtilities.hpp"
 #include "PipelineUtilities.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 
 VkDescriptorSetLayout ShadowPass::descriptorSetLayout = VK_NULL_HANDLE;
 
@@ -20,29 +23,80 @@ ShadowPass::ShadowPass(const int width, const int height){
 }
 
 void ShadowPass::init(const VkPhysicalDevice & physicalDevice,const VkDevice & device, const VkCommandPool & commandPool, const  uint32_t count ){
-	frameBuffers.resize(count);
 	depthImages.resize(count);
 	depthMemorys.resize(count);
 	depthViews.resize(count);
-	descriptors.resize(count);
+	_layerViews.resize(count * SHADOW_CASCADES);
+	_frameBuffers.resize(count * SHADOW_CASCADES);
+	_staticViews.resize(SHADOW_CASCADES);
+	_staticFrameBuffers.resize(SHADOW_CASCADES);
+	for(size_t c = 0; c < SHADOW_CASCADES; ++c){
+		_cached[c] = false;
+		_moving[c] = false;
+		viewprojs[c] = glm::mat4(1.0f);
+		_staticViewprojs[c] = glm::mat4(1.0f);
+		_previousViewprojs[c] = glm::mat4(1.0f);
+	}
+	splits = glm::vec4(0.0f);
 	// Create a sampler for the shadow map.
 	depthSampler = VulkanUtilities::createSampler(device, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, 1);
 	// Init shadow pass and framebuffer.
-	// For shadow mapping we only need a depth attachment
+	// For shadow mapping we only need a depth attachment, with one layer per cascade.
+	// The static cache is copied in the frame shadow map.
+	VulkanUtilities::createImageLayers(physicalDevice, device, size[0], size[1], 1, SHADOW_CASCADES, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, _staticImage, _staticMemory);
+	for(uint32_t c = 0; c < SHADOW_CASCADES; ++c){
+		_staticViews[c] = VulkanUtilities::createImageLayersView(device, _staticImage, VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_VIEW_TYPE_2D, c, 1);
+	}
 	for(size_t i = 0; i < count; ++i){
-		VulkanUtilities::createImage(physicalDevice, device, size[0], size[1], 1, VK_FORMAT_D32_SFLOAT , VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, depthImages[i], depthMemorys[i]);
-		depthViews[i] = VulkanUtilities::createImageView(device, depthImages[i], VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT, false, 1);
+		VulkanUtilities::createImageLayers(physicalDevice, device, size[0], size[1], 1, SHADOW_CASCADES, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, depthImages[i], depthMemorys[i]);
+		depthViews[i] = VulkanUtilities::createImageLayersView(device, depthImages[i], VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_VIEW_TYPE_2D_ARRAY, 0, SHADOW_CASCADES);
+		for(uint32_t c = 0; c < SHADOW_CASCADES; ++c){
+			_layerViews[i * SHADOW_CASCADES + c] = VulkanUtilities::createImageLayersView(device, depthImages[i], VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_VIEW_TYPE_2D, c, 1);
+		}
 	}
 	
+	// All passes are compatible, pipelines and framebuffers can be shared.
+	_staticRenderPass = createRenderPass(device, true, true);
+	renderPass = createRenderPass(device, false, false);
+	_directRenderPass = createRenderPass(device, false, true);
+	
+	// Create the framebuffers, one for each layer.
+	VkFramebufferCreateInfo framebufferInfo = {};
+	framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+	framebufferInfo.attachmentCount = 1;
+	framebufferInfo.width = size[0];
+	framebufferInfo.height = size[1];
+	framebufferInfo.layers = 1;
+	for(size_t c = 0; c < SHADOW_CASCADES; ++c){
+		framebufferInfo.renderPass = _staticRenderPass;
+		framebufferInfo.pAttachments = &_staticViews[c];
+		if(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &_staticFrameBuffers[c]) != VK_SUCCESS) {
+			std::cerr << "Unable to create shadow map framebuffer." << std::endl;
+		}
+	}
+	for(size_t i = 0; i < _frameBuffers.size(); ++i){
+		framebufferInfo.renderPass = renderPass;
+		framebufferInfo.pAttachments = &_layerViews[i];
+		if(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &_frameBuffers[i]) != VK_SUCCESS) {
+			std::cerr << "Unable to create shadow map framebuffer." << std::endl;
+		}
+	}
+	
+	ShadowPass::createDescriptorSetLayout(device);
+	PipelineUtilities::createPipeline(device, "shadow", renderPass, {descriptorSetLayout}, size[0], size[1], true, VK_CULL_MODE_BACK_BIT, true, true, true, VK_COMPARE_OP_LESS, 0, pipelineLayout, pipeline);
+}
+
+VkRenderPass ShadowPass::createRenderPass(const VkDevice & device, const bool cache, const bool clear){
+	// The cache is cleared and then copied, while the frame shadow map starts from the copied cache or is cleared.
 	VkAttachmentDescription attachmentDescription{};
 	attachmentDescription.format = VK_FORMAT_D32_SFLOAT;
 	attachmentDescription.samples = VK_SAMPLE_COUNT_1_BIT;
-	attachmentDescription.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+	attachmentDescription.loadOp = clear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
 	attachmentDescription.storeOp = VK_ATTACHMENT_STORE_OP_STORE; // Store the depth for the next pass.
 	attachmentDescription.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 	attachmentDescription.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-	attachmentDescription.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	attachmentDescription.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+	attachmentDescription.initialLayout = clear ? VK_IMAGE_LAYOUT_UNDEFINED : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	attachmentDescription.finalLayout = cache ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 	// Depth buffer ref.
 	VkAttachmentReference depthReference = {};
 	depthReference.attachment = 0;
@@ -52,20 +106,21 @@ void ShadowPass::init(const VkPhysicalDevice & physicalDevice,const VkDevice & d
 	subpass.colorAttachmentCount = 0; // No color attachment.
 	subpass.pDepthStencilAttachment = &depthReference;
 	// Dependencies.
+	// Wait for the copies from the cache (reading it or writing the frame map), or for the previous reads of a cleared frame map.
 	std::array<VkSubpassDependency, 2> dependencies;
 	dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
 	dependencies[0].dstSubpass = 0;
-	dependencies[0].srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-	dependencies[0].dstStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-	dependencies[0].srcAccessMask = 0;
+	dependencies[0].srcStageMask = (cache || !clear) ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+	dependencies[0].dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	dependencies[0].srcAccessMask = clear ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
 	dependencies[0].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
 	dependencies[0].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 	dependencies[1].srcSubpass = 0;
 	dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
 	dependencies[1].srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-	dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+	dependencies[1].dstStageMask = cache ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
 	dependencies[1].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-	dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	dependencies[1].dstAccessMask = cache ? VK_ACCESS_TRANSFER_READ_BIT : VK_ACCESS_SHADER_READ_BIT;
 	dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 	// Creation infos.
 	VkRenderPassCreateInfo renderPassInfo = {};
@@ -77,41 +132,208 @@ void ShadowPass::init(const VkPhysicalDevice & physicalDevice,const VkDevice & d
 	renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
 	renderPassInfo.pDependencies = dependencies.data();
 	
-	if(vkCreateRenderPass(device, &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+	VkRenderPass pass = VK_NULL_HANDLE;
+	if(vkCreateRenderPass(device, &renderPassInfo, nullptr, &pass) != VK_SUCCESS) {
 		std::cerr << "Unable to create shadow render pass." << std::endl;
 	}
+	return pass;
+}
+
+void ShadowPass::update(const Camera & camera, const glm::vec3 & lightDir){
+	const float nearPlane = camera.nearPlane();
+	const float farPlane = std::min(camera.farPlane(), _distance);
+	const float tanHalfFov = std::tan(0.5f * camera.fov());
+	const glm::mat4 invView = glm::inverse(camera.view());
+	// Light orientation only, cascades are translated in light space.
+	const glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), -lightDir, glm::vec3(0.0f, 1.0f, 0.0f));
 	
-	for(size_t i = 0; i < count; ++i){
-		// Create the framebuffer.
-		VkFramebufferCreateInfo framebufferInfo = {};
-		framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-		framebufferInfo.renderPass = renderPass;
-		framebufferInfo.attachmentCount = 1;
-		framebufferInfo.pAttachments = &depthViews[i];
-		framebufferInfo.width = size[0];
-		framebufferInfo.height = size[1];
-		framebufferInfo.layers = 1;
-		if(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &frameBuffers[i]) != VK_SUCCESS) {
-			std::cerr << "Unable to create shadow map framebuffer." << std::endl;
+	float previousSplit = nearPlane;
+	for(int c = 0; c < SHADOW_CASCADES; ++c){
+		// Blend logarithmic and uniform splits.
+		const float ratio = float(c + 1) / float(SHADOW_CASCADES);
+		const float logSplit = nearPlane * std::pow(farPlane / nearPlane, ratio);
+		const float uniSplit = nearPlane + (farPlane - nearPlane) * ratio;
+		const float split = 0.75f * logSplit + 0.25f * uniSplit;
+		
+		// Bounding sphere of the frustum slice, its radius doesn't depend on the camera orientation.
+		glm::vec3 corners[8];
+		glm::vec3 center(0.0f);
+		for(int i = 0; i < 8; ++i){
+			const float depth = (i < 4) ? previousSplit : split;
+			const float h = depth * tanHalfFov;
+			const float w = h * camera.aspectRatio();
+			const glm::vec4 corner((i & 1) ? w : -w, (i & 2) ? h : -h, -depth, 1.0f);
+			corners[i] = glm::vec3(invView * corner);
+			center += corners[i] / 8.0f;
+		}
+		float radius = 0.0f;
+		for(int i = 0; i < 8; ++i){
+			radius = std::max(radius, glm::length(corners[i] - center));
+		}
+		radius = std::ceil(radius * 16.0f) / 16.0f;
+		
+		// Snap the center to texels to avoid shimmering, and to keep the cache valid when the camera moves slightly.
+		glm::vec3 lightCenter = glm::vec3(lightView * glm::vec4(center, 1.0f));
+		const float texelSize = 2.0f * radius / size[0];
+		lightCenter = glm::floor(lightCenter / texelSize) * texelSize;
+		glm::mat4 lightProj = glm::ortho(lightCenter.x - radius, lightCenter.x + radius, lightCenter.y - radius, lightCenter.y + radius, -lightCenter.z - radius - _casterMargin, -lightCenter.z + radius);
+		lightProj[1][1] *= -1;
+		viewprojs[c] = lightProj * lightView;
+		splits[c] = split;
+		
+		if(viewprojs[c] != _staticViewprojs[c]){
+			_cached[c] = false;
 		}
+		_moving[c] = viewprojs[c] != _previousViewprojs[c];
+		_previousViewprojs[c] = viewprojs[c];
+		previousSplit = split;
 	}
+}
+
+void ShadowPass::beginStatic(VkCommandBuffer & commandBuffer, const uint32_t cascade){
+	VkRenderPassBeginInfo infos = {};
+	infos.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	infos.renderPass = _staticRenderPass;
+	infos.framebuffer = _staticFrameBuffers[cascade];
+	infos.renderArea.offset = { 0, 0 };
+	infos.renderArea.extent = extent;
+	std::array<VkClearValue, 1> clearValues = {};
+	clearValues[0].depthStencil = {1.0f, 0};
+	infos.clearValueCount = static_cast<uint32_t>(clearValues.size());
+	infos.pClearValues = clearValues.data();
+	vkCmdBeginRenderPass(commandBuffer, &infos, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void ShadowPass::endStatic(VkCommandBuffer & commandBuffer, const uint32_t cascade){
+	vkCmdEndRenderPass(commandBuffer);
+	_staticViewprojs[cascade] = viewprojs[cascade];
+	_cached[cascade] = true;
+}
+
+void ShadowPass::restore(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade){
+	// The previous content is discarded, but reads from a previous frame have to be complete.
+	VkImageMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = depthImages[index];
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+	barrier.subresourceRange.baseMipLevel = 0;
+	barrier.subresourceRange.levelCount = 1;
+	barrier.subresourceRange.baseArrayLayer = cascade;
+	barrier.subresourceRange.layerCount = 1;
+	barrier.srcAccessMask = 0;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 	
-	ShadowPass::createDescriptorSetLayout(device);
-	const int pushSize = (16 + 1) * 4;
-	PipelineUtilities::createPipeline(device, "shadow", renderPass, descriptorSetLayout, size[0], size[1], true, VK_CULL_MODE_BACK_BIT, true, true, true, VK_COMPARE_OP_LESS, pushSize, pipelineLayout, pipeline);
+	VkImageCopy region = {};
+	region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+	region.srcSubresource.mipLevel = 0;
+	region.srcSubresource.baseArrayLayer = cascade;
+	region.srcSubresource.layerCount = 1;
+	region.dstSubresource = region.srcSubresource;
+	region.srcOffset = {0, 0, 0};
+	region.dstOffset = {0, 0, 0};
+	region.extent = { extent.width, extent.height, 1 };
+	vkCmdCopyImage(commandBuffer, _staticImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, depthImages[index], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
+
+void ShadowPass::begin(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade){
+	VkRenderPassBeginInfo infos = {};
+	infos.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	infos.renderPass = _cached[cascade] ? renderPass : _directRenderPass;
+	infos.framebuffer = _frameBuffers[index * SHADOW_CASCADES + cascade];
+	infos.renderArea.offset = { 0, 0 };
+	infos.renderArea.extent = extent;
+	std::array<VkClearValue, 1> clearValues = {};
+	clearValues[0].depthStencil = {1.0f, 0};
+	infos.clearValueCount = _cached[cascade] ? 0 : static_cast<uint32_t>(clearValues.size());
+	infos.pClearValues = clearValues.data();
+	vkCmdBeginRenderPass(commandBuffer, &infos, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void ShadowPass::end(VkCommandBuffer & commandBuffer){
+	vkCmdEndRenderPass(commandBuffer);
+}
+
+void ShadowPass::finish(VkCommandBuffer & commandBuffer, const uint32_t index){
+	VkImageMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // We don't change queue here.
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = depthImages[index];
+	barrier.subresourceRange.baseMipLevel = 0;
+	barrier.subresourceRange.levelCount = 1;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount = SHADOW_CASCADES;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+	barrier.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	
+	vkCmdPipelineBarrier(commandBuffer,  VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void ShadowPass::generateDescriptorSet(const VkDevice & device, const VkDescriptorPool & pool, const VkBuffer & uniforms){
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = pool;
+	allocInfo.descriptorSetCount = 1;
+	allocInfo.pSetLayouts = &descriptorSetLayout;
+	if (vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
+	}
+	// Offsets will be provided at bind time.
+	VkDescriptorBufferInfo bufferLightInfo = {};
+	bufferLightInfo.buffer = uniforms;
+	bufferLightInfo.offset = 0;
+	bufferLightInfo.range = sizeof(CascadeInfos);
+	
+	VkDescriptorBufferInfo bufferObjectInfo = {};
+	bufferObjectInfo.buffer = uniforms;
+	bufferObjectInfo.offset = 0;
+	bufferObjectInfo.range = sizeof(ObjectInfos);
+	
+	std::array<VkWriteDescriptorSet, 2> descriptorWrites = {};
+	descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrites[0].dstSet = descriptorSet;
+	descriptorWrites[0].dstBinding = 0;
+	descriptorWrites[0].dstArrayElement = 0;
+	descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	descriptorWrites[0].descriptorCount = 1;
+	descriptorWrites[0].pBufferInfo = &bufferLightInfo;
+	
+	descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrites[1].dstSet = descriptorSet;
+	descriptorWrites[1].dstBinding = 1;
+	descriptorWrites[1].dstArrayElement = 0;
+	descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	descriptorWrites[1].descriptorCount = 1;
+	descriptorWrites[1].pBufferInfo = &bufferObjectInfo;
+	
+	vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 }
 
 VkDescriptorSetLayout ShadowPass::createDescriptorSetLayout(const VkDevice & device){
 	descriptorSetLayout = {};
-	// Uniform binding.
+	// Cascade uniform binding.
 	VkDescriptorSetLayoutBinding uboLayoutBinding = {};
 	uboLayoutBinding.binding = 0;// binding in 0.
-	uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+	uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 	uboLayoutBinding.descriptorCount = 1;
 	uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	// Object uniform binding.
+	VkDescriptorSetLayoutBinding uboLayoutObjectBinding = {};
+	uboLayoutObjectBinding.binding = 1;
+	uboLayoutObjectBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	uboLayoutObjectBinding.descriptorCount = 1;
+	uboLayoutObjectBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 	
 	// Create the layout (== defining a struct)
-	std::array<VkDescriptorSetLayoutBinding, 1> bindings = {uboLayoutBinding};
+	std::array<VkDescriptorSetLayoutBinding, 2> bindings = {uboLayoutBinding, uboLayoutObjectBinding};
 	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -128,11 +350,22 @@ void ShadowPass::clean(const VkDevice & device){
 	vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
 	vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
 	vkDestroySampler(device, depthSampler, nullptr);
-	for(size_t i = 0; i < frameBuffers.size(); ++i){
+	for(size_t i = 0; i < _frameBuffers.size(); ++i){
+		vkDestroyFramebuffer(device, _frameBuffers[i], nullptr);
+		vkDestroyImageView(device, _layerViews[i], nullptr);
+	}
+	for(size_t i = 0; i < depthImages.size(); ++i){
 		vkDestroyImageView(device, depthViews[i], nullptr);
 		vkDestroyImage(device, depthImages[i], nullptr);
 		vkFreeMemory(device, depthMemorys[i], nullptr);
-		vkDestroyFramebuffer(device, frameBuffers[i], nullptr);
 	}
+	for(size_t c = 0; c < _staticFrameBuffers.size(); ++c){
+		vkDestroyFramebuffer(device, _staticFrameBuffers[c], nullptr);
+		vkDestroyImageView(device, _staticViews[c], nullptr);
+	}
+	vkDestroyImage(device, _staticImage, nullptr);
+	vkFreeMemory(device, _staticMemory, nullptr);
+	vkDestroyRenderPass(device, _staticRenderPass, nullptr);
 	vkDestroyRenderPass(device, renderPass, nullptr);
+	vkDestroyRenderPass(device, _directRenderPass, nullptr);
 }
@@ -11,7 +11,12 @@
 
 #include "common.hpp"
 #include "Object.hpp"
+#include "input/Camera.hpp"
 
+/// Cascaded shadow maps, stored in the layers of a depth image.
+/// Each cascade covers a slice of the camera frustum. Static geometry is rendered in a cache,
+/// only updated once the cascade projection is stable; each frame the cache is copied and dynamic geometry is rendered on top.
+/// Cascades that moved during the frame are rendered directly, as refreshing the cache would cost more than it saves.
 class ShadowPass {
 	
 public:
@@ -22,6 +27,31 @@ public:
 	
 	void clean(const VkDevice & device);
 	
+	void generateDescriptorSet(const VkDevice & device, const VkDescriptorPool & pool, const VkBuffer & uniforms);
+	
+	/// Fit the cascades to the camera frustum, and invalidate the cached cascades that changed.
+	void update(const Camera & camera, const glm::vec3 & lightDir);
+	
+	/// Is the static geometry of a cascade up to date.
+	bool cached(const uint32_t cascade) const { return _cached[cascade]; }
+	
+	/// Has the cascade projection changed since the previous frame.
+	bool moving(const uint32_t cascade) const { return _moving[cascade]; }
+	
+	/// Render static geometry in the cache layer of a cascade.
+	void beginStatic(VkCommandBuffer & commandBuffer, const uint32_t cascade);
+	void endStatic(VkCommandBuffer & commandBuffer, const uint32_t cascade);
+	
+	/// Copy the cached layer of a cascade in the shadow map of the current frame.
+	void restore(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade);
+	
+	/// Render in a cascade of the current frame, on top of the cached static geometry if available, else from a cleared layer.
+	void begin(VkCommandBuffer & commandBuffer, const uint32_t index, const uint32_t cascade);
+	void end(VkCommandBuffer & commandBuffer);
+	
+	/// Transition the shadow map of the current frame for sampling.
+	void finish(VkCommandBuffer & commandBuffer, const uint32_t index);
+	
 	static VkDescriptorSetLayout createDescriptorSetLayout(const VkDevice & device);
 	static VkDescriptorSetLayout descriptorSetLayout;
 	
@@ -31,14 +61,43 @@ public:
 	VkSampler depthSampler;
 	VkPipelineLayout pipelineLayout;
 	VkPipeline pipeline;
+	// Cascade and object infos, with dynamic offsets in the uniform ring.
+	VkDescriptorSet descriptorSet;
+	
+	// Cascades light projections and view space far distances.
+	glm::mat4 viewprojs[SHADOW_CASCADES];
+	glm::vec4 splits;
 	
 	VkExtent2D extent;
 	// Per frame data.
-	std::vector<VkFramebuffer> frameBuffers;
 	std::vector<VkImage> depthImages;
 	std::vector<VkDeviceMemory> depthMemorys;
-	std::vector<VkImageView>depthViews;
-	std::vector<VkDescriptorImageInfo> descriptors;
+	std::vector<VkImageView> depthViews;
+	
+private:
+	
+	VkRenderPass createRenderPass(const VkDevice & device, const bool cache, const bool clear);
+	
+	// Per frame and per cascade.
+	std::vector<VkImageView> _layerViews;
+	std::vector<VkFramebuffer> _frameBuffers;
+	// Clears the frame layer, for cascades rendered without the cache.
+	VkRenderPass _directRenderPass;
+	
+	// Static geometry cache.
+	VkRenderPass _staticRenderPass;
+	VkImage _staticImage;
+	VkDeviceMemory _staticMemory;
+	std::vector<VkImageView> _staticViews;
+	std::vector<VkFramebuffer> _staticFrameBuffers;
+	glm::mat4 _staticViewprojs[SHADOW_CASCADES];
+	bool _cached[SHADOW_CASCADES];
+	glm::mat4 _previousViewprojs[SHADOW_CASCADES];
+	bool _moving[SHADOW_CASCADES];
+	
+	// Distance covered by the cascades, and extra depth range for casters outside of a cascade slice.
+	float _distance = 10.0f;
+	float _casterMargin = 10.0f;
 };
 
 
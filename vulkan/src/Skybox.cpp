@@ -20,7 +20,7 @@ Skybox::Skybox(const std::string &name) {
 	infos.shininess = 0;
 }
 
-void Skybox::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue) {
+void Skybox::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, MipmapGenerator & mipmaps) {
 	
 	// Mesh.
 	Mesh mesh;
@@ -47,7 +47,7 @@ void Skybox::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & de
 	for(size_t i = 0; i < 6; ++i){
 		memcpy(mergedImages + i*layerSize, images[i], layerSize);
 	}
-	VulkanUtilities::createTexture(mergedImages, texWidth, texHeight, true, MAX_MIPMAP_LEVELS, physicalDevice, device, commandPool, graphicsQueue, _textureCubeImage, _textureCubeMemory, _textureCubeView);
+	mipmaps.upload(mergedImages, texWidth, texHeight, true, MAX_MIPMAP_LEVELS, true, "resources/textures/" + _name + "_cube.mips", _textureCubeImage, _textureCubeMemory, _textureCubeView);
 	
 	// Cleaning.
 	for(size_t i = 0; i < 6; ++i){
@@ -56,48 +56,32 @@ void Skybox::upload(const VkPhysicalDevice & physicalDevice, const VkDevice & de
 	free(mergedImages);
 }
 
-void Skybox::generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool, const std::vector<VkBuffer> & constants, const int count){
+void Skybox::generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool){
 	
-	_descriptorSets.resize(count);
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = pool;
+	allocInfo.descriptorSetCount = 1;
+	allocInfo.pSetLayouts = &descriptorSetLayout;
 	
-	for (size_t i = 0; i < _descriptorSets.size(); i++) {
-		VkDescriptorSetAllocateInfo allocInfo = {};
-		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfo.descriptorPool = pool;
-		allocInfo.descriptorSetCount = 1;
-		allocInfo.pSetLayouts = &descriptorSetLayout;
-		
-		if (vkAllocateDescriptorSets(device, &allocInfo, &_descriptorSets[i]) != VK_SUCCESS) {
-			std::cerr << "Unable to create descriptor sets." << std::endl;
-		}
-		
-		VkDescriptorBufferInfo bufferCameraInfo = {};
-		bufferCameraInfo.buffer = constants[i];
-		bufferCameraInfo.offset = 0;
-		bufferCameraInfo.range = sizeof(CameraInfos);
-		VkDescriptorImageInfo imageInfo = {};
-		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageInfo.imageView = _textureCubeView;
-		
-		std::array<VkWriteDescriptorSet, 2> descriptorWrites = {};
-		descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[0].dstSet = _descriptorSets[i];
-		descriptorWrites[0].dstBinding = 0;
-		descriptorWrites[0].dstArrayElement = 0;
-		descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		descriptorWrites[0].descriptorCount = 1;
-		descriptorWrites[0].pBufferInfo = &bufferCameraInfo;
-		
-		descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[1].dstSet = _descriptorSets[i];
-		descriptorWrites[1].dstBinding = 1;
-		descriptorWrites[1].dstArrayElement = 0;
-		descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		descriptorWrites[1].descriptorCount = 1;
-		descriptorWrites[1].pImageInfo = &imageInfo;
-		
-		vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+	if (vkAllocateDescriptorSets(device, &allocInfo, &_descriptorSet) != VK_SUCCESS) {
+		std::cerr << "Unable to create descriptor sets." << std::endl;
 	}
+	
+	VkDescriptorImageInfo imageInfo = {};
+	imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	imageInfo.imageView = _textureCubeView;
+	
+	std::array<VkWriteDescriptorSet, 1> descriptorWrites = {};
+	descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrites[0].dstSet = _descriptorSet;
+	descriptorWrites[0].dstBinding = 0;
+	descriptorWrites[0].dstArrayElement = 0;
+	descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	descriptorWrites[0].descriptorCount = 1;
+	descriptorWrites[0].pImageInfo = &imageInfo;
+	
+	vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 }
 
 void Skybox::clean(VkDevice & device){
@@ -114,22 +98,16 @@ void Skybox::clean(VkDevice & device){
 
 VkDescriptorSetLayout Skybox::createDescriptorSetLayout(const VkDevice & device, const VkSampler & sampler){
 	descriptorSetLayout = {};
-	// Uniform binding.
-	VkDescriptorSetLayoutBinding uboLayoutBinding = {};
-	uboLayoutBinding.binding = 0;// binding in 0.
-	uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-	uboLayoutBinding.descriptorCount = 1;
-	uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 	// Image+sampler binding.
 	VkDescriptorSetLayoutBinding samplerLayoutBinding = {};
-	samplerLayoutBinding.binding = 1;
+	samplerLayoutBinding.binding = 0;
 	samplerLayoutBinding.descriptorCount = 1;
 	samplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 	samplerLayoutBinding.pImmutableSamplers = &sampler;
 	
 	// Create the layout (== defining a struct)
-	std::array<VkDescriptorSetLayoutBinding, 2> bindings = {uboLayoutBinding, samplerLayoutBinding};
+	std::array<VkDescriptorSetLayoutBinding, 1> bindings = {samplerLayoutBinding};
 	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -139,4 +117,3 @@ VkDescriptorSetLayout Skybox::createDescriptorSetLayout(const VkDevice & device,
 	}
 	return descriptorSetLayout;
 }
-
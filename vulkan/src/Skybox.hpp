@@ -10,6 +10,7 @@
 #define Skybox_hpp
 
 #include "common.hpp"
+#include "MipmapGenerator.hpp"
 #include "resources/MeshUtilities.hpp"
 
 class Skybox {
@@ -19,13 +20,13 @@ public:
 	
 	~Skybox();
 	
-	void upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue);
+	void upload(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, MipmapGenerator & mipmaps);
 
 	void clean(VkDevice & device);
 	
-	void generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool, const std::vector<VkBuffer> & constants, const int count);
+	void generateDescriptorSets(const VkDevice & device, const VkDescriptorPool & pool);
 	
-	const VkDescriptorSet & descriptorSet(const int i){ return _descriptorSets[i]; }
+	const VkDescriptorSet & descriptorSet() const { return _descriptorSet; }
 	
 	
 	VkBuffer _vertexBuffer;
@@ -48,7 +49,7 @@ private:
 	VkDeviceMemory _vertexBufferMemory;
 	VkDeviceMemory _indexBufferMemory;
 	VkDeviceMemory _textureCubeMemory;
-	std::vector<VkDescriptorSet> _descriptorSets;
+	VkDescriptorSet _descriptorSet;
 	
 	
 	
@@ -11,6 +11,7 @@
 
 Swapchain::Swapchain(VkInstance & instance, VkSurfaceKHR & surface, const int width, const int height) {
 	_surface = surface;
+	offscreen = surface == VK_NULL_HANDLE;
 	currentFrame = 0;
 	// Init basic Vulkan objects.
 	/// Setup physical device (GPU).
@@ -22,8 +23,27 @@ Swapchain::Swapchain(VkInstance & instance, VkSurfaceKHR & surface, const int wi
 	// Device features we want.
 	VkPhysicalDeviceFeatures deviceFeatures = {};
 	deviceFeatures.samplerAnisotropy = VK_TRUE;
+	// Optional features for GPU-driven rendering.
+	std::vector<const char*> optionalExtensions;
+	indirectCount = VulkanUtilities::checkIndirectCountSupport(physicalDevice);
+	if(indirectCount){
+		deviceFeatures.multiDrawIndirect = VK_TRUE;
+		deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+		deviceFeatures.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+		optionalExtensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+	}
+	// Timestamps for profiling.
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+	std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+	timestampValidBits = queueFamilies[queues.graphicsQueue].timestampValidBits;
+	timestamps = timestampValidBits > 0;
+	timestampPeriod = properties.limits.timestampPeriod;
 	/// Create the logical device.
-	VulkanUtilities::createDevice(physicalDevice, uniqueQueueFamilies, deviceFeatures, device);
+	VulkanUtilities::createDevice(physicalDevice, uniqueQueueFamilies, deviceFeatures, optionalExtensions, device);
 	/// Get references to the queues.
 	vkGetDeviceQueue(device, queues.graphicsQueue, 0, &graphicsQueue);
 	vkGetDeviceQueue(device, queues.presentQueue, 0, &_presentQueue);
@@ -52,6 +72,15 @@ Swapchain::Swapchain(VkInstance & instance, VkSurfaceKHR & surface, const int wi
 	fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 	
 	for(size_t i = 0; i < _inFlightFences.size(); i++) {
+		// Offscreen frames are only synchronized with fences.
+		if(offscreen){
+			_imageAvailableSemaphores[i] = VK_NULL_HANDLE;
+			_renderFinishedSemaphores[i] = VK_NULL_HANDLE;
+			if(vkCreateFence(device, &fenceInfo, nullptr, &_inFlightFences[i]) != VK_SUCCESS) {
+				std::cerr << "Unable to create fences." << std::endl;
+			}
+			continue;
+		}
 		if(vkCreateSemaphore(device, &semaphoreInfo, nullptr, &_imageAvailableSemaphores[i]) != VK_SUCCESS ||
 		   vkCreateSemaphore(device, &semaphoreInfo, nullptr, &_renderFinishedSemaphores[i]) != VK_SUCCESS ||
 		   vkCreateFence(device, &fenceInfo, nullptr, &_inFlightFences[i]) != VK_SUCCESS) {
@@ -68,8 +97,17 @@ void Swapchain::setup(const int width, const int height) {
 	
 	
 	// Setup swapchain.
-	parameters = VulkanUtilities::generateSwapchainParameters(physicalDevice, _surface, width, height);
-	VulkanUtilities::createSwapchain(parameters, _surface, device, queues, _swapchain);
+	if(offscreen){
+		// Same format as the preferred surface one, double buffered.
+		parameters.extent = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+		parameters.surface = { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+		parameters.mode = VK_PRESENT_MODE_FIFO_KHR;
+		parameters.count = 2;
+		_swapchain = VK_NULL_HANDLE;
+	} else {
+		parameters = VulkanUtilities::generateSwapchainParameters(physicalDevice, _surface, width, height);
+		VulkanUtilities::createSwapchain(parameters, _surface, device, queues, _swapchain);
+	}
 	count = parameters.count;
 	
 	/// Render pass.
@@ -82,11 +120,21 @@ void Swapchain::setup(const int width, const int height) {
 	VulkanUtilities::transitionImageLayout(device, commandPool, graphicsQueue, _depthImage, depthFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, false, 1);
 	
 	// Retrieve images in the swap chain.
-	vkGetSwapchainImagesKHR(device, _swapchain, &parameters.count, nullptr);
-	count = parameters.count;
-	_swapchainImages.resize(count);
-	std::cout << "Swapchain using " << count << " images."<< std::endl;
-	vkGetSwapchainImagesKHR(device, _swapchain, &parameters.count, _swapchainImages.data());
+	if(offscreen){
+		// Our own images, that can be copied back to the CPU.
+		_swapchainImages.resize(count);
+		_offscreenMemorys.resize(count);
+		for(size_t i = 0; i < count; i++) {
+			VulkanUtilities::createImage(physicalDevice, device, parameters.extent.width, parameters.extent.height, 1, parameters.surface.format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, _swapchainImages[i], _offscreenMemorys[i]);
+		}
+		std::cout << "Offscreen using " << count << " images."<< std::endl;
+	} else {
+		vkGetSwapchainImagesKHR(device, _swapchain, &parameters.count, nullptr);
+		count = parameters.count;
+		_swapchainImages.resize(count);
+		std::cout << "Swapchain using " << count << " images."<< std::endl;
+		vkGetSwapchainImagesKHR(device, _swapchain, &parameters.count, _swapchainImages.data());
+	}
 	// Create views for each image.
 	_swapchainImageViews.resize(count);
 	for(size_t i = 0; i < count; i++) {
@@ -149,7 +197,8 @@ void Swapchain::createMainRenderpass(){
 	colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 	colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 	colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	// Offscreen images are read back instead of presented.
+	colorAttachment.finalLayout = offscreen ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 	VkAttachmentReference colorAttachmentRef = {};
 	colorAttachmentRef.attachment = 0;
 	colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
@@ -202,11 +251,17 @@ VkResult Swapchain::begin(VkRenderPassBeginInfo & infos){
 	// Wait for the current commands buffer to be done.
 	vkWaitForFences(device, 1, &_inFlightFences[currentFrame], VK_TRUE, std::numeric_limits<uint64_t>::max());
 	
-	// Acquire image from swap chain.
-	// Use a semaphore to know when the image is available.
-	VkResult status = vkAcquireNextImageKHR(device, _swapchain, std::numeric_limits<uint64_t>::max(), _imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, &imageIndex);
-	if(status != VK_SUCCESS && status != VK_SUBOPTIMAL_KHR) {
-		return status;
+	VkResult status = VK_SUCCESS;
+	if(offscreen){
+		// Offscreen images are used in order, the fence guarantees the image is free.
+		imageIndex = currentFrame;
+	} else {
+		// Acquire image from swap chain.
+		// Use a semaphore to know when the image is available.
+		status = vkAcquireNextImageKHR(device, _swapchain, std::numeric_limits<uint64_t>::max(), _imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, &imageIndex);
+		if(status != VK_SUCCESS && status != VK_SUBOPTIMAL_KHR) {
+			return status;
+		}
 	}
 	
 	// Partially fill infos with internal data.
@@ -220,6 +275,9 @@ VkResult Swapchain::begin(VkRenderPassBeginInfo & infos){
 }
 
 VkResult Swapchain::commit(){
+	if(offscreen){
+		return VK_SUCCESS;
+	}
 	
 	VkSemaphore signalSemaphores[] = { _renderFinishedSemaphores[currentFrame] };
 	// Present on swap chain.
@@ -236,6 +294,37 @@ VkResult Swapchain::commit(){
 	return status;
 }
 
+void Swapchain::readback(std::vector<unsigned char> & pixels){
+	const uint32_t width = parameters.extent.width;
+	const uint32_t height = parameters.extent.height;
+	const VkDeviceSize size = VkDeviceSize(width) * height * 4;
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	VulkanUtilities::createBuffer(physicalDevice, device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, memory);
+	// The final render pass left the image in transfer source layout.
+	VkCommandBuffer commandBuffer = VulkanUtilities::beginOneShotCommandBuffer(device, commandPool);
+	VkBufferImageCopy region = {};
+	region.bufferOffset = 0;
+	region.bufferRowLength = 0;
+	region.bufferImageHeight = 0;
+	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	region.imageSubresource.mipLevel = 0;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount = 1;
+	region.imageOffset = {0, 0, 0};
+	region.imageExtent = { width, height, 1 };
+	vkCmdCopyImageToBuffer(commandBuffer, _swapchainImages[imageIndex], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, 1, &region);
+	VulkanUtilities::endOneShotCommandBuffer(commandBuffer, device, commandPool, graphicsQueue);
+	
+	pixels.resize(size);
+	void* data;
+	vkMapMemory(device, memory, 0, size, 0, &data);
+	memcpy(pixels.data(), data, static_cast<size_t>(size));
+	vkUnmapMemory(device, memory);
+	vkDestroyBuffer(device, buffer, nullptr);
+	vkFreeMemory(device, memory, nullptr);
+}
+
 Swapchain::~Swapchain() {
 }
 
@@ -263,5 +352,12 @@ void Swapchain::unsetup() {
 	}
 	vkDestroyImage(device, _depthImage, nullptr);
 	vkFreeMemory(device, _depthImageMemory, nullptr);
+	if(offscreen){
+		for(size_t i = 0; i < _swapchainImages.size(); i++) {
+			vkDestroyImage(device, _swapchainImages[i], nullptr);
+			vkFreeMemory(device, _offscreenMemorys[i], nullptr);
+		}
+		return;
+	}
 	vkDestroySwapchainKHR(device, _swapchain, nullptr);
 }
@@ -15,6 +15,7 @@
 class Swapchain {
 public:
 	
+	/// If the surface is null, render into offscreen images instead of presenting.
 	Swapchain(VkInstance & instance, VkSurfaceKHR & surface, const int width, const int height);
 	
 	~Swapchain();
@@ -26,6 +27,9 @@ public:
 	void resize(const int width, const int height);
 	
 	void clean();
+	
+	/// Copy the content of the current offscreen image in a tightly packed BGRA buffer. The frame has to be complete.
+	void readback(std::vector<unsigned char> & pixels);
 
 	void step(){ currentFrame = (currentFrame + 1) % count; }
 
@@ -40,6 +44,13 @@ public:
 	VkDevice device;
 	VkCommandPool commandPool;
 	VkQueue graphicsQueue;
+	// Is GPU-driven rendering (indirect count draws) available.
+	bool indirectCount;
+	// Are timestamp queries available on the graphics queue, their valid bits and their period in nanoseconds.
+	bool timestamps;
+	uint32_t timestampValidBits;
+	float timestampPeriod;
+	bool offscreen;
 	
 	uint32_t imageIndex;
 	VkRenderPass finalRenderPass;
@@ -60,6 +71,7 @@ private:
 	std::vector<VkImage> _swapchainImages;
 	std::vector<VkImageView> _swapchainImageViews;
 	std::vector<VkFramebuffer> _swapchainFramebuffers;
+	std::vector<VkDeviceMemory> _offscreenMemorys;
 	VkImage _depthImage;
 	VkDeviceMemory _depthImageMemory;
 	VkImageView _depthImageView;
@@ -0,0 +1,46 @@
+#include "UniformRing.hpp"
+#include "VulkanUtilities.hpp"
+
+UniformRing::UniformRing(){
+	_buffer = VK_NULL_HANDLE;
+	_memory = VK_NULL_HANDLE;
+	_data = nullptr;
+	_frameSize = 0;
+	_current = 0;
+	_end = 0;
+}
+
+void UniformRing::init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkDeviceSize frameSize, const uint32_t count){
+	_frameSize = frameSize;
+	const VkDeviceSize bufferSize = _frameSize * count;
+	VulkanUtilities::createBuffer(physicalDevice, device, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, _buffer, _memory);
+	// The memory is coherent, we can keep it mapped for the whole lifetime of the buffer.
+	void * data = nullptr;
+	if(vkMapMemory(device, _memory, 0, bufferSize, 0, &data) != VK_SUCCESS){
+		std::cerr << "Unable to map uniform ring." << std::endl;
+	}
+	_data = static_cast<char*>(data);
+}
+
+void UniformRing::begin(const uint32_t frame){
+	_current = frame * _frameSize;
+	_end = _current + _frameSize;
+}
+
+uint32_t UniformRing::push(const void * data, const size_t size){
+	const VkDeviceSize offset = _current;
+	if(offset + size > _end){
+		std::cerr << "Uniform ring region overflow." << std::endl;
+		return static_cast<uint32_t>(_end - _frameSize);
+	}
+	memcpy(_data + offset, data, size);
+	_current += VulkanUtilities::nextOffset(size);
+	return static_cast<uint32_t>(offset);
+}
+
+void UniformRing::clean(const VkDevice & device){
+	vkUnmapMemory(device, _memory);
+	vkDestroyBuffer(device, _buffer, nullptr);
+	vkFreeMemory(device, _memory, nullptr);
+	_data = nullptr;
+}
@@ -0,0 +1,38 @@
+#ifndef UniformRing_hpp
+#define UniformRing_hpp
+
+#include "common.hpp"
+
+/// A host-visible uniform buffer, mapped once at creation and split in one region per frame in flight.
+/// Each frame, uniform data is appended at aligned offsets in the current region, to be used as dynamic offsets.
+class UniformRing {
+public:
+
+	UniformRing();
+
+	void init(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkDeviceSize frameSize, const uint32_t count);
+
+	void clean(const VkDevice & device);
+
+	/// Start writing in the region associated to a given frame.
+	void begin(const uint32_t frame);
+
+	/// Copy data at the next aligned offset in the current region, and return this offset.
+	uint32_t push(const void * data, const size_t size);
+
+	template<typename T>
+	uint32_t push(const T & data){ return push(&data, sizeof(T)); }
+
+	const VkBuffer & buffer() const { return _buffer; }
+
+private:
+
+	VkBuffer _buffer;
+	VkDeviceMemory _memory;
+	char * _data;
+	VkDeviceSize _frameSize;
+	VkDeviceSize _current;
+	VkDeviceSize _end;
+};
+
+#endif /* UniformRing_hpp */
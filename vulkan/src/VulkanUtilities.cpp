@@ -11,11 +11,17 @@ const std::vector<const char*> deviceExtensions = {
 	VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+// Used by the GPU-driven path when available.
+const std::vector<const char*> indirectCountExtensions = {
+	VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+};
+
 const std::vector<const char*> validationLayers = {
 	"VK_LAYER_LUNARG_standard_validation"
 };
 
 bool VulkanUtilities::layersEnabled;
+bool VulkanUtilities::presentEnabled = true;
 VkDebugReportCallbackEXT VulkanUtilities::callback;
 VkDeviceSize VulkanUtilities::uniformOffset;
 
@@ -24,16 +30,23 @@ VkDeviceSize VulkanUtilities::uniformOffset;
 VkShaderModule VulkanUtilities::createShaderModule(VkDevice device, const std::string& path) {
 	size_t size = 0;
 	char * data = Resources::loadRawDataFromExternalFile(path, size);
-	
+	// A missing or truncated module would only surface later as an obscure pipeline failure.
+	if(data == NULL || size == 0 || (size % 4) != 0) {
+		delete[] data;
+		std::cerr << "Invalid SPIR-V module at path \"" << path << "\" (" << size << " bytes)." << std::endl;
+		return VK_NULL_HANDLE;
+	}
 	VkShaderModuleCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
 	createInfo.codeSize = size;
 	// We need to cast from char to uint32_t (opcodes).
 	createInfo.pCode = reinterpret_cast<const uint32_t*>(data);
 	VkShaderModule shaderModule;
-	if(vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
-		std::cerr << "Unable to create shader module." << std::endl;
-		return shaderModule;
+	const VkResult result = vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule);
+	delete[] data;
+	if(result != VK_SUCCESS) {
+		std::cerr << "Unable to create shader module from \"" << path << "\"." << std::endl;
+		return VK_NULL_HANDLE;
 	}
 	return shaderModule;
 }
@@ -46,7 +59,10 @@ bool VulkanUtilities::checkDeviceExtensionSupport(VkPhysicalDevice device) {
 	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
 	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
 	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
-	std::set<std::string> requiredExtensions(deviceExtensions.begin(), deviceExtensions.end());
+	std::set<std::string> requiredExtensions;
+	if(presentEnabled){
+		requiredExtensions.insert(deviceExtensions.begin(), deviceExtensions.end());
+	}
 	// Check if the required device extensions are available.
 	for(const auto& extension : availableExtensions) {
 		requiredExtensions.erase(extension.extensionName);
@@ -54,12 +70,31 @@ bool VulkanUtilities::checkDeviceExtensionSupport(VkPhysicalDevice device) {
 	return requiredExtensions.empty();
 }
 
-std::vector<const char*> VulkanUtilities::getRequiredInstanceExtensions(const bool enableValidationLayers){
+bool VulkanUtilities::checkIndirectCountSupport(const VkPhysicalDevice & physicalDevice) {
+	uint32_t extensionCount;
+	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
+	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, availableExtensions.data());
+	std::set<std::string> requiredExtensions(indirectCountExtensions.begin(), indirectCountExtensions.end());
+	for(const auto& extension : availableExtensions) {
+		requiredExtensions.erase(extension.extensionName);
+	}
+	// We also need to draw multiple commands starting at arbitrary instances, and index an array of textures.
+	VkPhysicalDeviceFeatures supportedFeatures;
+	vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+	return requiredExtensions.empty() && supportedFeatures.multiDrawIndirect && supportedFeatures.drawIndirectFirstInstance && supportedFeatures.shaderSampledImageArrayDynamicIndexing;
+}
+
+std::vector<const char*> VulkanUtilities::getRequiredInstanceExtensions(const bool enableValidationLayers, const bool headless){
+	std::vector<const char*> extensions;
 	// Default Vulkan has no notion of surface/window. GLFW provide an implementation of the corresponding KHR extensions.
-	uint32_t glfwExtensionCount = 0;
-	const char** glfwExtensions;
-	glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-	std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+	// Offscreen rendering doesn't need them (and GLFW is not even initialized).
+	if(!headless){
+		uint32_t glfwExtensionCount = 0;
+		const char** glfwExtensions;
+		glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+		extensions.insert(extensions.end(), glfwExtensions, glfwExtensions + glfwExtensionCount);
+	}
 
 	// If the validation layers are enabled, add associated extensions.
 	if(enableValidationLayers) {
@@ -87,10 +122,16 @@ VulkanUtilities::ActiveQueues VulkanUtilities::getGraphicsQueueFamilyIndex(VkPhy
 		}
 		// CHeck if queue support presentation.
 		VkBool32 presentSupport = false;
-		vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+		if(surface != VK_NULL_HANDLE){
+			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+		}
 		if(queueFamily.queueCount > 0 && presentSupport) {
 			queues.presentQueue = i;
 		}
+		// Offscreen, nothing will be presented.
+		if(surface == VK_NULL_HANDLE){
+			queues.presentQueue = queues.graphicsQueue;
+		}
 		if(queues.isComplete()){
 			break;
 		}
@@ -109,7 +150,9 @@ bool VulkanUtilities::isDeviceSuitable(VkPhysicalDevice adevice, VkSurfaceKHR as
 	bool swapChainAdequate = false;
 	VkPhysicalDeviceFeatures supportedFeatures;
 	vkGetPhysicalDeviceFeatures(adevice, &supportedFeatures);
-	if(extensionsSupported) {
+	if(extensionsSupported && asurface == VK_NULL_HANDLE) {
+		swapChainAdequate = true;
+	} else if(extensionsSupported) {
 		SwapchainSupportDetails swapChainSupport = VulkanUtilities::querySwapchainSupport(adevice, asurface);
 		swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
 	}
@@ -259,7 +302,7 @@ void VulkanUtilities::cleanupDebug(VkInstance & instance)
 
 /// General setup.
 
-int VulkanUtilities::createInstance(const std::string & name, const bool debugEnabled, VkInstance & instance)
+int VulkanUtilities::createInstance(const std::string & name, const bool debugEnabled, const bool headless, VkInstance & instance)
 {
 	layersEnabled = debugEnabled;
 	// Create a Vulkan instance.
@@ -275,8 +318,9 @@ int VulkanUtilities::createInstance(const std::string & name, const bool debugEn
 	createInstanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
 	createInstanceInfo.pApplicationInfo = &appInfo;
 
+	presentEnabled = !headless;
 	// We have to tell Vulkan the extensions we need.
-	const std::vector<const char*> extensions = VulkanUtilities::getRequiredInstanceExtensions(debugEnabled);
+	const std::vector<const char*> extensions = VulkanUtilities::getRequiredInstanceExtensions(debugEnabled, headless);
 	// Add them to the instance infos.
 	createInstanceInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
 	createInstanceInfo.ppEnabledExtensionNames = extensions.data();
@@ -339,7 +383,7 @@ int VulkanUtilities::createPhysicalDevice(VkInstance & instance, VkSurfaceKHR &
 }
 
 
-int VulkanUtilities::createDevice(VkPhysicalDevice & physicalDevice, std::set<int> & queuesIds, VkPhysicalDeviceFeatures & features, VkDevice & device){
+int VulkanUtilities::createDevice(VkPhysicalDevice & physicalDevice, std::set<int> & queuesIds, VkPhysicalDeviceFeatures & features, const std::vector<const char*> & optionalExtensions, VkDevice & device){
 	float queuePriority = 1.0f;
 	std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
 	for(int queueFamily : queuesIds) {
@@ -357,8 +401,13 @@ int VulkanUtilities::createDevice(VkPhysicalDevice & physicalDevice, std::set<in
 	createDeviceInfo.pQueueCreateInfos = queueCreateInfos.data();
 	createDeviceInfo.pEnabledFeatures = &features;
 	// Extensions.
-	createDeviceInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-	createDeviceInfo.ppEnabledExtensionNames = deviceExtensions.data();
+	std::vector<const char*> extensions;
+	if(presentEnabled){
+		extensions.insert(extensions.end(), deviceExtensions.begin(), deviceExtensions.end());
+	}
+	extensions.insert(extensions.end(), optionalExtensions.begin(), optionalExtensions.end());
+	createDeviceInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+	createDeviceInfo.ppEnabledExtensionNames = extensions.data();
 	// Debug layers.
 	if(layersEnabled) {
 		createDeviceInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
@@ -496,6 +545,10 @@ void VulkanUtilities::copyBuffer(const VkBuffer & srcBuffer, const VkBuffer & ds
 }
 
 int VulkanUtilities::createImage(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const uint32_t & width, const uint32_t & height, const uint32_t & mipCount, const VkFormat & format, const VkImageTiling & tiling, const VkImageUsageFlags & usage, const VkMemoryPropertyFlags & properties, const bool cube, VkImage & image, VkDeviceMemory & imageMemory){
+	return createImageLayers(physicalDevice, device, width, height, mipCount, cube ? 6 : 1, format, tiling, usage, properties, cube, image, imageMemory);
+}
+
+int VulkanUtilities::createImageLayers(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const uint32_t & width, const uint32_t & height, const uint32_t & mipCount, const uint32_t & layerCount, const VkFormat & format, const VkImageTiling & tiling, const VkImageUsageFlags & usage, const VkMemoryPropertyFlags & properties, const bool cube, VkImage & image, VkDeviceMemory & imageMemory){
 	// Create image.
 	VkImageCreateInfo imageInfo = {};
 	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -504,7 +557,7 @@ int VulkanUtilities::createImage(const VkPhysicalDevice & physicalDevice, const
 	imageInfo.extent.height = static_cast<uint32_t>(height);
 	imageInfo.extent.depth = 1;
 	imageInfo.mipLevels = mipCount;
-	imageInfo.arrayLayers = cube ? 6 : 1;
+	imageInfo.arrayLayers = layerCount;
 	imageInfo.format = format;
 	imageInfo.tiling = tiling;
 	imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -619,6 +672,25 @@ VkImageView VulkanUtilities::createImageView(const VkDevice & device, const VkIm
 	return imageView;
 }
 
+VkImageView VulkanUtilities::createImageLayersView(const VkDevice & device, const VkImage & image, const VkFormat format, const VkImageAspectFlags aspectFlags, const VkImageViewType type, const uint32_t & baseLayer, const uint32_t & layerCount) {
+	VkImageViewCreateInfo viewInfo = {};
+	viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	viewInfo.image = image;
+	viewInfo.viewType = type;
+	viewInfo.format = format;
+	viewInfo.subresourceRange.aspectMask = aspectFlags;
+	viewInfo.subresourceRange.baseMipLevel = 0;
+	viewInfo.subresourceRange.levelCount = 1;
+	viewInfo.subresourceRange.baseArrayLayer = baseLayer;
+	viewInfo.subresourceRange.layerCount = layerCount;
+	
+	VkImageView imageView;
+	if (vkCreateImageView(device, &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+		std::cerr << "Unable to create image view." << std::endl;
+	}
+	return imageView;
+}
+
 VkFormat VulkanUtilities::findSupportedFormat(const VkPhysicalDevice & physicalDevice, const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features){
 	for (VkFormat format : candidates) {
 		VkFormatProperties props;
@@ -774,7 +846,7 @@ void VulkanUtilities::setupBuffers(const VkPhysicalDevice & physicalDevice, cons
 	memcpy(data, mesh.vertices.data(), (size_t) bufferSize);
 	vkUnmapMemory(device, stagingBufferMemory);
 	// Create the destination buffer.
-	VulkanUtilities::createBuffer(physicalDevice, device, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory);
+	VulkanUtilities::createBuffer(physicalDevice, device, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory);
 	// Copy from the staging buffer to the final.
 	// TODO: use specific command pool.
 	VulkanUtilities::copyBuffer(stagingBuffer, vertexBuffer, bufferSize, device, commandPool, graphicsQueue);
@@ -789,7 +861,7 @@ void VulkanUtilities::setupBuffers(const VkPhysicalDevice & physicalDevice, cons
 	memcpy(data, mesh.indices.data(), (size_t) bufferSize);
 	vkUnmapMemory(device, stagingBufferMemory);
 	// Create and copy final buffer.
-	VulkanUtilities::createBuffer(physicalDevice, device, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferMemory);
+	VulkanUtilities::createBuffer(physicalDevice, device, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferMemory);
 	VulkanUtilities::copyBuffer(stagingBuffer, indexBuffer, bufferSize, device, commandPool, graphicsQueue);
 	vkDestroyBuffer(device, stagingBuffer, nullptr);
 	vkFreeMemory(device, stagingBufferMemory, nullptr);
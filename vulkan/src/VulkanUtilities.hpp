@@ -42,11 +42,12 @@ public:
 	static VkFormat findDepthFormat(const VkPhysicalDevice & physicalDevice);
 	static VkDeviceSize nextOffset(size_t size);
 	static bool checkValidationLayerSupport();
+	static bool checkIndirectCountSupport(const VkPhysicalDevice & physicalDevice);
 private:
 	static bool isDeviceSuitable(VkPhysicalDevice adevice, VkSurfaceKHR asurface);
 	static bool hasStencilComponent(VkFormat format);
 	static bool checkDeviceExtensionSupport(VkPhysicalDevice device);
-	static std::vector<const char*> getRequiredInstanceExtensions(const bool enableValidationLayers);
+	static std::vector<const char*> getRequiredInstanceExtensions(const bool enableValidationLayers, const bool headless);
 	
 	/// Debug.
 public:
@@ -54,9 +55,9 @@ public:
 	
 	/// General setup.
 public:
-	static int createInstance(const std::string & name, const bool debugEnabled, VkInstance & instance);
+	static int createInstance(const std::string & name, const bool debugEnabled, const bool headless, VkInstance & instance);
 	static int createPhysicalDevice(VkInstance & instance, VkSurfaceKHR & surface, VkPhysicalDevice & physicalDevice);
-	static int createDevice(VkPhysicalDevice & physicalDevice, std::set<int> & queuesIds, VkPhysicalDeviceFeatures & features, VkDevice & device);
+	static int createDevice(VkPhysicalDevice & physicalDevice, std::set<int> & queuesIds, VkPhysicalDeviceFeatures & features, const std::vector<const char*> & optionalExtensions, VkDevice & device);
 	
 	/// Swapchain
 public:
@@ -69,7 +70,7 @@ private:
 	static VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR> availablePresentModes);
 	
 	/// Commands
-private:
+public:
 	static VkCommandBuffer beginOneShotCommandBuffer( const VkDevice & device,  const VkCommandPool & commandPool);
 	static void endOneShotCommandBuffer(VkCommandBuffer & commandBuffer,  const VkDevice & device,  const VkCommandPool & commandPool,  const VkQueue & queue);
 	
@@ -88,8 +89,10 @@ public:
 	/// Textures
 public:
 	static int createImage(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const uint32_t & width, const uint32_t & height, const uint32_t & mipCount, const VkFormat & format, const VkImageTiling & tiling, const VkImageUsageFlags & usage, const VkMemoryPropertyFlags & properties, const bool cube, VkImage & image, VkDeviceMemory & imageMemory);
+	static int createImageLayers(const VkPhysicalDevice & physicalDevice, const VkDevice & device, const uint32_t & width, const uint32_t & height, const uint32_t & mipCount, const uint32_t & layerCount, const VkFormat & format, const VkImageTiling & tiling, const VkImageUsageFlags & usage, const VkMemoryPropertyFlags & properties, const bool cube, VkImage & image, VkDeviceMemory & imageMemory);
 	static void transitionImageLayout(const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & queue, VkImage & image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, const bool cube, const uint32_t & mipCount);
 	static VkImageView createImageView(const VkDevice & device, const VkImage & image, const VkFormat format, const VkImageAspectFlags aspectFlags, const bool cube, const uint32_t & mipCount);
+	static VkImageView createImageLayersView(const VkDevice & device, const VkImage & image, const VkFormat format, const VkImageAspectFlags aspectFlags, const VkImageViewType type, const uint32_t & baseLayer, const uint32_t & layerCount);
 	static VkSampler createSampler(const VkDevice & device, const VkFilter filter, const VkSamplerAddressMode mode, const uint32_t mipCount);
 	static void generateMipmaps(VkImage & image, const int32_t width, const int32_t height, const bool cube, const uint32_t mipCount, const VkFormat format, const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue);
 	static void createTexture(const void * image, const uint32_t width, const uint32_t height, const bool cube, const uint32_t mipCount,  const VkPhysicalDevice & physicalDevice, const VkDevice & device, const VkCommandPool & commandPool, const VkQueue & graphicsQueue, VkImage & textureImage, VkDeviceMemory & textureMemory, VkImageView & textureView);
@@ -100,6 +103,8 @@ private:
 private:
 	
 	static bool layersEnabled;
+	// Without a window, no surface nor swapchain support is required.
+	static bool presentEnabled;
 	static VkDebugReportCallbackEXT callback;
 	static VkDeviceSize uniformOffset;
 };
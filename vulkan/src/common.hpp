@@ -35,16 +35,51 @@ struct CameraInfos {
 	glm::mat4 proj;
 };
 
+#define SHADOW_CASCADES 3
+
 struct LightInfos {
-	glm::mat4 mvp;
+	glm::mat4 viewprojs[SHADOW_CASCADES];
+	glm::vec4 splits; // View space far distance of each cascade.
 	glm::vec3 viewSpaceDir;
 };
 
+// Light projection used when rendering one shadow cascade.
+struct CascadeInfos {
+	glm::mat4 viewproj;
+};
+
 struct ObjectInfos {
 	glm::mat4 model;
 	float shininess;
 };
 
+// GPU-driven path: per-instance infos, read by the culling and drawing shaders.
+struct InstanceInfos {
+	glm::mat4 model;
+	glm::vec4 bounds; // Object space bounding sphere center and radius.
+	uint32_t indexCount;
+	uint32_t firstIndex;
+	int32_t vertexOffset;
+	uint32_t material;
+	float shininess;
+	uint32_t flags; // Static or dynamic instance.
+	uint32_t pad0, pad1;
+};
+
+#define INSTANCE_STATIC 1
+#define INSTANCE_DYNAMIC 2
+
+// Camera, and static and dynamic views for each shadow cascade.
+#define MAX_CULL_VIEWS (1 + 2 * SHADOW_CASCADES)
+#define MAX_INDIRECT_MATERIALS 16
+
+// Views to cull instances against, each with a mask of accepted instance flags.
+struct CullInfos {
+	glm::mat4 viewprojs[MAX_CULL_VIEWS];
+	glm::uvec4 masks[MAX_CULL_VIEWS];
+	glm::uvec4 counts; // Instance count, view count.
+};
+
 #define MAX_MIPMAP_LEVELS 8
 
 #endif /* common_h */
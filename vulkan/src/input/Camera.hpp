@@ -26,7 +26,13 @@ public:
 	/// Update the FOV (in radians).
 	void fov(float fov);
 	
+	/// Place the camera explicitly.
+	void pose(const glm::vec3 & eye, const glm::vec3 & center, const glm::vec3 & up);
+	
 	float fov() const { return _fov; }
+	float aspectRatio() const { return _ratio; }
+	float nearPlane() const { return _near; }
+	float farPlane() const { return _far; }
 	
 	const glm::mat4 view() const { return _view; }
 	const glm::mat4 projection() const { return _projection; }
@@ -3,8 +3,11 @@
 #include <set>
 #include <algorithm>
 #include <fstream>
+#include <cstdlib>
 
 #include "Renderer.hpp"
+#include "MipmapGenerator.hpp"
+#include "Benchmark.hpp"
 #include "input/Input.hpp"
 
 const int WIDTH = 1280;
@@ -44,7 +47,39 @@ void window_iconify_callback(GLFWwindow* window, int iconified){
 
 /// Entry point.
 
-int main() {
+int main(int argc, char** argv) {
+
+	// Options.
+	bool headless = false;
+	Benchmark::Options benchmark;
+	for(int i = 1; i < argc; ++i){
+		const std::string arg(argv[i]);
+		const bool hasValue = i + 1 < argc;
+		if(arg == "--bake-mipmaps"){
+			// Generate mipmaps on the CPU and store them next to the textures.
+			MipmapGenerator::preferCPU = true;
+		} else if(arg == "--no-gpu-driven"){
+			// Draw objects one by one even if indirect count draws are supported.
+			Renderer::allowGPUDriven = false;
+		} else if(arg == "--headless"){
+			// Offscreen benchmark, no window.
+			headless = true;
+		} else if(arg == "--frames" && hasValue){
+			benchmark.frames = uint32_t(std::max(1, std::atoi(argv[++i])));
+		} else if(arg == "--size" && i + 2 < argc){
+			benchmark.width = uint32_t(std::max(1, std::atoi(argv[++i])));
+			benchmark.height = uint32_t(std::max(1, std::atoi(argv[++i])));
+		} else if(arg == "--dump" && hasValue){
+			benchmark.dumpDirectory = argv[++i];
+		} else if(arg == "--dump-step" && hasValue){
+			benchmark.dumpStep = uint32_t(std::max(0, std::atoi(argv[++i])));
+		}
+	}
+	
+	if(headless){
+		benchmark.debug = enableValidationLayers && VulkanUtilities::checkValidationLayerSupport();
+		return Benchmark::run(benchmark);
+	}
 
 	/// Init GLFW3.
 	if(!glfwInit()){
@@ -74,7 +109,7 @@ int main() {
 
 	/// Vulkan instance creation.
 	VkInstance instance;
-	VulkanUtilities::createInstance("Dragon Vulkan", debugEnabled, instance);
+	VulkanUtilities::createInstance("Dragon Vulkan", debugEnabled, false, instance);
 	
 	/// Surface window setup.
 	VkSurfaceKHR surface;
@@ -1,16 +1,72 @@
 
-@group(0) @binding(0) var srcLevel: texture_2d<f32>;
-@group(0) @binding(1) var dstLevel: texture_storage_2d<rgba8unorm, write>;
+// Generate four levels at once: each workgroup reduces a 16x16 tile of the source level,
+// intermediate results are kept in workgroup memory. Missing levels are bound to a dummy 1x1 texture.
+@group(0) @binding(0) var srcLevel: texture_2d_array<f32>;
+@group(0) @binding(1) var dstLevel1: texture_storage_2d_array<rgba8unorm, write>;
+@group(0) @binding(2) var dstLevel2: texture_storage_2d_array<rgba8unorm, write>;
+@group(0) @binding(3) var dstLevel3: texture_storage_2d_array<rgba8unorm, write>;
+@group(0) @binding(4) var dstLevel4: texture_storage_2d_array<rgba8unorm, write>;
+
+var<workgroup> tile: array<vec4f, 64>;
+
+fn reduceTile(id: vec2u) -> vec4f {
+	let i = 2u * id.y * 8u + 2u * id.x;
+	return 0.25 * (tile[i] + tile[i + 1u] + tile[i + 8u] + tile[i + 9u]);
+}
 
 @compute @workgroup_size(8,8)
-fn mainCompute(@builtin(global_invocation_id) id: vec3<u32>)  {
-	let shift = vec2u(0,1);
+fn mainCompute(@builtin(global_invocation_id) id: vec3<u32>, @builtin(local_invocation_id) lid: vec3<u32>, @builtin(workgroup_id) gid: vec3<u32>)  {
+	let layer = i32(id.z);
+	let srcMax = vec2i(textureDimensions(srcLevel)) - 1;
+	let base = 2 * vec2i(id.xy);
+
+	// First level, from the source texture.
 	var color = vec4f(0.0);
-	color += textureLoad(srcLevel, 2 * id.xy + shift.xx, 0);
-	color += textureLoad(srcLevel, 2 * id.xy + shift.xy, 0);
-	color += textureLoad(srcLevel, 2 * id.xy + shift.yx, 0);
-	color += textureLoad(srcLevel, 2 * id.xy + shift.yy, 0);
-	color /= 4.0;
-	textureStore(dstLevel, id.xy, color);
-}
+	color += textureLoad(srcLevel, min(base + vec2i(0,0), srcMax), layer, 0);
+	color += textureLoad(srcLevel, min(base + vec2i(1,0), srcMax), layer, 0);
+	color += textureLoad(srcLevel, min(base + vec2i(0,1), srcMax), layer, 0);
+	color += textureLoad(srcLevel, min(base + vec2i(1,1), srcMax), layer, 0);
+	color *= 0.25;
+	if(all(id.xy < textureDimensions(dstLevel1))){
+		textureStore(dstLevel1, id.xy, layer, color);
+	}
+	tile[lid.y * 8u + lid.x] = color;
+	workgroupBarrier();
+
+	// Next levels, from workgroup memory. Barriers have to be reached by all invocations.
+	let active2 = all(lid.xy < vec2u(4u));
+	if(active2){
+		color = reduceTile(lid.xy);
+		let coord = gid.xy * 4u + lid.xy;
+		if(all(coord < textureDimensions(dstLevel2))){
+			textureStore(dstLevel2, coord, layer, color);
+		}
+	}
+	workgroupBarrier();
+	if(active2){
+		tile[lid.y * 8u + lid.x] = color;
+	}
+	workgroupBarrier();
 
+	let active3 = all(lid.xy < vec2u(2u));
+	if(active3){
+		color = reduceTile(lid.xy);
+		let coord = gid.xy * 2u + lid.xy;
+		if(all(coord < textureDimensions(dstLevel3))){
+			textureStore(dstLevel3, coord, layer, color);
+		}
+	}
+	workgroupBarrier();
+	if(active3){
+		tile[lid.y * 8u + lid.x] = color;
+	}
+	workgroupBarrier();
+
+	if(all(lid.xy == vec2u(0u))){
+		color = reduceTile(lid.xy);
+		let coord = gid.xy;
+		if(all(coord < textureDimensions(dstLevel4))){
+			textureStore(dstLevel4, coord, layer, color);
+		}
+	}
+}
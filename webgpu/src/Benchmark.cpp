@@ -0,0 +1,215 @@
+#include "Benchmark.hpp"
+#include "Renderer.hpp"
+#include "GPU.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+// Offscreen target, same format as the swapchain.
+const WGPUTextureFormat kBenchmarkFormat = WGPUTextureFormat_BGRA8Unorm;
+
+/// Statistics.
+
+static void printStatistics(const std::string& name, std::vector<double> values){
+	if(values.empty()){
+		std::cout << name << ": unavailable" << std::endl;
+		return;
+	}
+	std::sort(values.begin(), values.end());
+	double total = 0.0;
+	for(const double value : values){
+		total += value;
+	}
+	const double percentile95 = values[std::min(values.size() - 1, (values.size() * 95) / 100)];
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << name << ": avg " << total / double(values.size()) << ", median " << values[values.size() / 2] << ", p95 " << percentile95 << ", min " << values.front() << ", max " << values.back() << std::endl;
+	std::cout.unsetf(std::ios::floatfield);
+}
+
+struct MapResult {
+	WGPUBufferMapAsyncStatus status = WGPUBufferMapAsyncStatus_Unknown;
+	bool complete = false;
+};
+
+static void mapCallback(WGPUBufferMapAsyncStatus status, void* userdata){
+	MapResult* dst = (MapResult*)userdata;
+	dst->status = status;
+	dst->complete = true;
+}
+
+bool Benchmark::mapBuffer(WGPUDevice device, WGPUBuffer buffer, size_t size){
+	MapResult result;
+	wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, size, mapCallback, &result);
+	// Callbacks are only triggered when the device is ticked.
+	while(!result.complete){
+		wgpuDeviceTick(device);
+	}
+	return result.status == WGPUBufferMapAsyncStatus_Success;
+}
+
+uint64_t Benchmark::hash(const unsigned char* data, size_t rowSize, size_t rowStride, size_t rowCount, uint64_t seed){
+	// FNV-1a, skipping row padding.
+	uint64_t hash = seed;
+	for(size_t y = 0; y < rowCount; ++y){
+		const unsigned char* row = data + y * rowStride;
+		for(size_t x = 0; x < rowSize; ++x){
+			hash ^= row[x];
+			hash *= 1099511628211ull;
+		}
+	}
+	return hash;
+}
+
+int Benchmark::run(WGPUDevice device, WGPUQueue queue, bool timestamps, const Options& options){
+
+	std::cout << "Benchmarking " << options.frames << " frames at " << options.width << "x" << options.height << "." << std::endl;
+	if(!timestamps){
+		std::cerr << "Timestamps not supported, GPU time will be unavailable." << std::endl;
+	}
+
+	/// Offscreen target.
+	WGPUTextureView colorView = nullptr;
+	WGPUTexture colorTexture = GPU::createTexture(device, options.width, options.height, 1, WGPUTextureViewDimension_2D, kBenchmarkFormat, WGPUTextureUsage_RenderAttachment | WGPUTextureUsage_CopySrc, colorView);
+	if(!colorTexture){
+		std::cerr << "Unable to create offscreen target." << std::endl;
+		return -1;
+	}
+	// Rows have to be aligned when copying to a buffer.
+	const size_t rowSize = options.width * 4u;
+	const size_t rowStride = ((rowSize + 255u) / 256u) * 256u;
+	const size_t readbackSize = rowStride * options.height;
+	WGPUBuffer readbackBuffer = GPU::createBuffer(device, readbackSize, WGPUBufferUsage_CopyDst | WGPUBufferUsage_MapRead);
+
+	/// Timestamps at the beginning and end of each frame.
+	WGPUQuerySet querySet = nullptr;
+	WGPUBuffer resolveBuffer = nullptr;
+	WGPUBuffer timingsBuffer = nullptr;
+	const size_t timingsSize = 2 * sizeof(uint64_t);
+	if(timestamps){
+		WGPUQuerySetDescriptor queryDesc{};
+		queryDesc.nextInChain = nullptr;
+		queryDesc.label = "Benchmark timestamps";
+		queryDesc.type = WGPUQueryType_Timestamp;
+		queryDesc.count = 2;
+		queryDesc.pipelineStatistics = nullptr;
+		queryDesc.pipelineStatisticsCount = 0;
+		querySet = wgpuDeviceCreateQuerySet(device, &queryDesc);
+		resolveBuffer = GPU::createBuffer(device, timingsSize, WGPUBufferUsage_QueryResolve | WGPUBufferUsage_CopySrc);
+		timingsBuffer = GPU::createBuffer(device, timingsSize, WGPUBufferUsage_CopyDst | WGPUBufferUsage_MapRead);
+	}
+
+	/// Create the renderer.
+	Renderer renderer;
+	renderer.useCameraPath();
+	renderer.resize(device, options.width, options.height);
+	renderer.upload(device, queue, kBenchmarkFormat);
+
+	// Fixed timestep so that each frame is identical from run to run.
+	const double frameTime = 1.0 / 60.0;
+	std::vector<double> cpuTimes;
+	std::vector<double> gpuTimes;
+	uint64_t framesHash = 14695981039346656037ull;
+	uint64_t lastHash = 0;
+
+	/// Main loop.
+	for(uint32_t frame = 0; frame < options.frames; ++frame){
+
+		// Measure the CPU side of the frame: update and encoding.
+		const auto start = std::chrono::high_resolution_clock::now();
+		renderer.update(frameTime);
+
+		WGPUCommandEncoderDescriptor encoderDesc{};
+		encoderDesc.nextInChain = nullptr;
+		encoderDesc.label = "Benchmark encoder";
+		WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, &encoderDesc);
+		if(querySet){
+			wgpuCommandEncoderWriteTimestamp(encoder, querySet, 0);
+		}
+
+		renderer.draw(queue, encoder, colorView);
+
+		if(querySet){
+			wgpuCommandEncoderWriteTimestamp(encoder, querySet, 1);
+			wgpuCommandEncoderResolveQuerySet(encoder, querySet, 0, 2, resolveBuffer, 0);
+			wgpuCommandEncoderCopyBufferToBuffer(encoder, resolveBuffer, 0, timingsBuffer, 0, timingsSize);
+		}
+
+		Profiler::resolve(encoder);
+
+		// Copy the frame for hashing.
+		WGPUImageCopyTexture srcDesc{};
+		srcDesc.nextInChain = nullptr;
+		srcDesc.texture = colorTexture;
+		srcDesc.mipLevel = 0;
+		srcDesc.origin = {0, 0, 0};
+		srcDesc.aspect = WGPUTextureAspect_All;
+		WGPUImageCopyBuffer dstDesc{};
+		dstDesc.nextInChain = nullptr;
+		dstDesc.buffer = readbackBuffer;
+		dstDesc.layout.nextInChain = nullptr;
+		dstDesc.layout.offset = 0;
+		dstDesc.layout.bytesPerRow = rowStride;
+		dstDesc.layout.rowsPerImage = options.height;
+		WGPUExtent3D copySize{ options.width, options.height, 1 };
+		wgpuCommandEncoderCopyTextureToBuffer(encoder, &srcDesc, &dstDesc, &copySize);
+
+		WGPUCommandBufferDescriptor commandBufferDesc{};
+		commandBufferDesc.nextInChain = nullptr;
+		commandBufferDesc.label = "Benchmark command buffer";
+		WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, &commandBufferDesc);
+		const auto end = std::chrono::high_resolution_clock::now();
+		cpuTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+
+		wgpuQueueSubmit(queue, 1, &commandBuffer);
+		Profiler::submitted();
+		wgpuCommandBufferRelease(commandBuffer);
+		wgpuCommandEncoderRelease(encoder);
+
+		// Read back results, this also waits for the frame to complete.
+		if(timingsBuffer && mapBuffer(device, timingsBuffer, timingsSize)){
+			const uint64_t* times = (const uint64_t*)wgpuBufferGetConstMappedRange(timingsBuffer, 0, timingsSize);
+			// Timestamps are in nanoseconds.
+			if(times && times[1] >= times[0]){
+				gpuTimes.push_back(double(times[1] - times[0]) * 1e-6);
+			}
+			wgpuBufferUnmap(timingsBuffer);
+		}
+		if(mapBuffer(device, readbackBuffer, readbackSize)){
+			const unsigned char* pixels = (const unsigned char*)wgpuBufferGetConstMappedRange(readbackBuffer, 0, readbackSize);
+			if(pixels){
+				lastHash = hash(pixels, rowSize, rowStride, options.height, 14695981039346656037ull);
+				framesHash = (framesHash ^ lastHash) * 1099511628211ull;
+			}
+			wgpuBufferUnmap(readbackBuffer);
+		} else {
+			std::cerr << "Unable to read back frame " << frame << "." << std::endl;
+		}
+	}
+
+	/// Report.
+	printStatistics("CPU encode (ms)", cpuTimes);
+	printStatistics("GPU frame (ms)", gpuTimes);
+	std::cout << std::hex << std::setfill('0');
+	std::cout << "Last frame hash: " << std::setw(16) << lastHash << std::endl;
+	std::cout << "All frames hash: " << std::setw(16) << framesHash << std::endl;
+	std::cout << std::dec << std::setfill(' ');
+
+	/// Cleanup.
+	renderer.clean();
+	if(querySet){
+		wgpuQuerySetDestroy(querySet);
+		wgpuQuerySetRelease(querySet);
+		wgpuBufferDestroy(resolveBuffer);
+		wgpuBufferRelease(resolveBuffer);
+		wgpuBufferDestroy(timingsBuffer);
+		wgpuBufferRelease(timingsBuffer);
+	}
+	wgpuBufferDestroy(readbackBuffer);
+	wgpuBufferRelease(readbackBuffer);
+	wgpuTextureViewRelease(colorView);
+	wgpuTextureDestroy(colorTexture);
+	wgpuTextureRelease(colorTexture);
+	return 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "common.hpp"
+
+/// Headless benchmark: render the scene in an offscreen texture along a fixed camera path, without any window or surface
+/// (so that it runs on fallback adapters such as SwiftShader). Reports CPU encoding time, GPU time from timestamp
+/// queries when available, and a hash of each frame read back from the GPU.
+class Benchmark {
+public:
+
+	struct Options {
+		uint32_t frames = 300;
+		uint32_t width = 1280;
+		uint32_t height = 800;
+		// Request the fallback (software) adapter.
+		bool fallback = false;
+	};
+
+	static int run(WGPUDevice device, WGPUQueue queue, bool timestamps, const Options& options);
+
+private:
+
+	/// Map a buffer for reading and wait for completion.
+	static bool mapBuffer(WGPUDevice device, WGPUBuffer buffer, size_t size);
+
+	static uint64_t hash(const unsigned char* data, size_t rowSize, size_t rowStride, size_t rowCount, uint64_t seed);
+};
@@ -1,11 +1,15 @@
 #include "GPU.hpp"
 #include "resources/MeshUtilities.hpp"
 #include "resources/Resources.hpp"
+#include "Profiler.hpp"
 
 
 WGPUComputePipeline GPU::_mipmapPipeline = nullptr;
 WGPUShaderModule GPU::_mipmapModule = nullptr;
 size_t GPU::_uboAlignment = 0;
+WGPUTexture GPU::_dummyStorage = nullptr;
+WGPUTextureView GPU::_dummyStorageView = nullptr;
+std::vector<GPU::PendingMipmap> GPU::_pendingMipmaps;
 
 void GPU::init(WGPUDevice device, size_t uboAlignment){
 	_uboAlignment = uboAlignment;
@@ -32,6 +36,9 @@ void GPU::init(WGPUDevice device, size_t uboAlignment){
 	pipeDesc.compute.constants = nullptr;
 
 	_mipmapPipeline = wgpuDeviceCreateComputePipeline(device, &pipeDesc);
+
+	// Bound in place of levels past the end of the mip chain.
+	_dummyStorage = createTexture(device, 1, 1, 1, WGPUTextureViewDimension_2DArray, WGPUTextureFormat_RGBA8Unorm, WGPUTextureUsage_StorageBinding, _dummyStorageView);
 }
 
 void GPU::clean(){
@@ -41,6 +48,11 @@ void GPU::clean(){
 	if(_mipmapModule){
 		wgpuShaderModuleRelease(_mipmapModule);
 	}
+	if(_dummyStorage){
+		wgpuTextureViewRelease(_dummyStorageView);
+		wgpuTextureDestroy(_dummyStorage);
+		wgpuTextureRelease(_dummyStorage);
+	}
 }
 
 void GPU::initBindGroupEntry(WGPUBindGroupEntry& entry){
@@ -113,6 +125,21 @@ WGPUTexture GPU::createTexture(WGPUDevice device, size_t w, size_t h, size_t m,
 	return texture;
 }
 
+size_t GPU::getTextureSize(WGPUTexture texture){
+	if(!texture){
+		return 0;
+	}
+	const size_t w = wgpuTextureGetWidth(texture);
+	const size_t h = wgpuTextureGetHeight(texture);
+	const size_t l = wgpuTextureGetDepthOrArrayLayers(texture);
+	const size_t m = wgpuTextureGetMipLevelCount(texture);
+	size_t size = 0;
+	for(size_t i = 0; i < m; ++i){
+		size += std::max(w >> i, size_t(1)) * std::max(h >> i, size_t(1)) * l * 4u;
+	}
+	return size;
+}
+
 void GPU::uploadMesh(const Mesh& mesh, WGPUDevice device, WGPUQueue queue, WGPUBuffer& vertexBuffer, WGPUBuffer& indexBuffer){
 
 	const size_t vSize = sizeof(Vertex) * mesh.vertices.size();
@@ -130,10 +157,14 @@ void GPU::uploadMesh(const Mesh& mesh, WGPUDevice device, WGPUQueue queue, WGPUB
 	wgpuQueueWriteBuffer(queue, indexBuffer, 0, mesh.indices.data(), iSize);
 }
 
+unsigned int GPU::getMipCount(unsigned int w, unsigned int h){
+	// Skip very small levels.
+	return (unsigned int)std::max(int(std::floor(std::log2(std::min(w, h)))) - 2, 1);
+}
+
 void GPU::uploadImage(const Image& image, WGPUDevice device, WGPUQueue queue, WGPUTexture& texture, WGPUTextureView& textureView){
 
-	// Compute the number of mipmaps (skip very small levels).
-	const unsigned int mipCount = std::max((unsigned int)std::floor(std::log2(std::min(image.w, image.h))) - 2, 1u);
+	const unsigned int mipCount = getMipCount(image.w, image.h);
 
 	texture = createTexture(device, image.w, image.h, mipCount, WGPUTextureViewDimension_2D, WGPUTextureFormat_RGBA8Unorm, WGPUTextureUsage_TextureBinding | WGPUTextureUsage_CopyDst | WGPUTextureUsage_StorageBinding, textureView);
 
@@ -161,24 +192,64 @@ void GPU::uploadImage(const Image& image, WGPUDevice device, WGPUQueue queue, WG
 	const size_t byteSize = image.data.size();
 	wgpuQueueWriteTexture(queue, &copyDesc, image.data.data(), byteSize, &dataLayout, &writeSize);
 
-	// Generate other levels
+	// Other levels will be generated with the rest of the batch.
+	_pendingMipmaps.push_back({ texture, mipCount, 1 });
+}
+
+void GPU::uploadCubemap(const std::array<Image, 6>& images, WGPUDevice device, WGPUQueue queue, WGPUTexture& texture, WGPUTextureView& textureView){
+
+	const unsigned int w = images[0].w;
+	const unsigned int h = images[0].h;
+	const unsigned int c = images[0].c;
+	const unsigned int mipCount = getMipCount(w, h);
 
-	// Prepare per level views
-	std::vector<WGPUTextureView> views(mipCount);
+	texture = createTexture(device, w, h, mipCount, WGPUTextureViewDimension_Cube, WGPUTextureFormat_RGBA8Unorm, WGPUTextureUsage_TextureBinding | WGPUTextureUsage_CopyDst | WGPUTextureUsage_StorageBinding, textureView);
+	if(!texture){
+		std::cerr << "Unable to create cubemap." << std::endl;
+		return;
+	}
+
+	// Upload each face to a layer.
+
+	// Common settings
+	WGPUTextureDataLayout dataLayout{};
+	dataLayout.nextInChain = nullptr;
+	dataLayout.offset = 0;
+	dataLayout.bytesPerRow = w * c;
+	dataLayout.rowsPerImage = h;
+	WGPUExtent3D writeSize{ w, h, 1 };
+	const size_t byteSize = images[0].data.size();
+
+	for(unsigned int i = 0; i < 6; ++i){
+		WGPUImageCopyTexture copyDesc{};
+		copyDesc.nextInChain = nullptr;
+		copyDesc.texture = texture;
+		copyDesc.origin = {0,0,i};
+		copyDesc.aspect = WGPUTextureAspect_All;
+		copyDesc.mipLevel = 0;
+		wgpuQueueWriteTexture(queue, &copyDesc, images[i].data.data(), byteSize, &dataLayout, &writeSize);
+	}
+
+	// Other levels will be generated with the rest of the batch, all faces at once.
+	_pendingMipmaps.push_back({ texture, mipCount, 6 });
+}
+
+void GPU::flushUploads(WGPUDevice device, WGPUQueue queue){
+	if(_pendingMipmaps.empty()){
+		return;
+	}
+
+	// Per level views, for all layers.
+	std::vector<WGPUTextureView> views;
 	WGPUTextureViewDescriptor viewDesc{};
 	viewDesc.nextInChain = nullptr;
 	viewDesc.format = WGPUTextureFormat_RGBA8Unorm;
-	viewDesc.dimension = WGPUTextureViewDimension_2D;
+	viewDesc.dimension = WGPUTextureViewDimension_2DArray;
 	viewDesc.aspect = WGPUTextureAspect_All;
 	viewDesc.baseArrayLayer = 0;
-	viewDesc.arrayLayerCount = 1;
 	viewDesc.mipLevelCount = 1; // Only one mip.
-	for(unsigned int i = 0; i < mipCount; ++i){
-		viewDesc.baseMipLevel = i;
-		views[i] = wgpuTextureCreateView(texture, &viewDesc);
-	}
 
-	// Begin pass.
+	// Begin pass, shared by all textures.
 	WGPUCommandEncoderDescriptor desc{};
 	desc.nextInChain = nullptr;
 	desc.label = "Compute mipmap";
@@ -188,87 +259,73 @@ void GPU::uploadImage(const Image& image, WGPUDevice device, WGPUQueue queue, WG
 	compDesc.nextInChain = nullptr;
 	compDesc.timestampWriteCount = 0;
 	compDesc.timestampWrites = nullptr;
+	Profiler::computePass("Mipmaps", compDesc);
 	WGPUComputePassEncoder pass = wgpuCommandEncoderBeginComputePass(encoder, &compDesc);
 
 	// Set mipmap pipeline.
 	const unsigned int groupSize = 8u;
+	const unsigned int levelsPerDispatch = 4u;
 	wgpuComputePassEncoderSetPipeline(pass, _mipmapPipeline);
 
 	// Preinit bind group entries and descriptor.
-	WGPUBindGroupEntry entries[2];
-	for(unsigned int i = 0; i < 2; ++i)
+	WGPUBindGroupEntry entries[levelsPerDispatch + 1];
+	for(unsigned int i = 0; i < levelsPerDispatch + 1; ++i){
 		GPU::initBindGroupEntry(entries[i]);
-	entries[0].binding = 0;
-	entries[1].binding = 1;
+		entries[i].binding = i;
+	}
+	WGPUBindGroupLayout groupLayout = wgpuComputePipelineGetBindGroupLayout(_mipmapPipeline, 0);
 	WGPUBindGroupDescriptor groupDesc{};
-	groupDesc.layout = wgpuComputePipelineGetBindGroupLayout(_mipmapPipeline, 0);
+	groupDesc.layout = groupLayout;
 	groupDesc.nextInChain = nullptr;
-	groupDesc.entryCount = 2;
+	groupDesc.entryCount = levelsPerDispatch + 1;
 	groupDesc.entries = &entries[0];
 
-	for(unsigned int i = 1; i < mipCount; ++i){
-		// Create binding group with input and output textures.
-		entries[0].textureView = views[i-1];
-		entries[1].textureView = views[i];
-		WGPUBindGroup group = wgpuDeviceCreateBindGroup(device, &groupDesc);
-		wgpuComputePassEncoderSetBindGroup(pass, 0, group, 0, nullptr);
-		// Size of the dispatch.
-		const unsigned int w = image.w >> i;
-		const unsigned int h = image.h >> i;
-		const unsigned int groupSizeX = (w + groupSize - 1)/groupSize;
-		const unsigned int groupSizeY = (h + groupSize - 1)/groupSize;
-		wgpuComputePassEncoderDispatchWorkgroups(pass, groupSizeX, groupSizeY, 1);
-		wgpuBindGroupRelease(group);
+	for(const PendingMipmap& pending : _pendingMipmaps){
+		viewDesc.arrayLayerCount = pending.layers;
+		const size_t firstView = views.size();
+		for(unsigned int i = 0; i < pending.mipCount; ++i){
+			viewDesc.baseMipLevel = i;
+			views.push_back(wgpuTextureCreateView(pending.texture, &viewDesc));
+		}
+		const unsigned int w = wgpuTextureGetWidth(pending.texture);
+		const unsigned int h = wgpuTextureGetHeight(pending.texture);
+
+		// Each dispatch reads a level and generates the next four ones.
+		for(unsigned int src = 0; src + 1 < pending.mipCount; src += levelsPerDispatch){
+			entries[0].textureView = views[firstView + src];
+			for(unsigned int l = 1; l <= levelsPerDispatch; ++l){
+				const unsigned int dst = src + l;
+				entries[l].textureView = dst < pending.mipCount ? views[firstView + dst] : _dummyStorageView;
+			}
+			WGPUBindGroup group = wgpuDeviceCreateBindGroup(device, &groupDesc);
+			wgpuComputePassEncoderSetBindGroup(pass, 0, group, 0, nullptr);
+			// Size of the dispatch, based on the first generated level.
+			const unsigned int levelW = std::max(w >> (src + 1), 1u);
+			const unsigned int levelH = std::max(h >> (src + 1), 1u);
+			const unsigned int groupSizeX = (levelW + groupSize - 1)/groupSize;
+			const unsigned int groupSizeY = (levelH + groupSize - 1)/groupSize;
+			wgpuComputePassEncoderDispatchWorkgroups(pass, groupSizeX, groupSizeY, pending.layers);
+			wgpuBindGroupRelease(group);
+		}
 	}
+
 	// End pass and submit
 	wgpuComputePassEncoderEnd(pass);
+	Profiler::resolve(encoder);
 	WGPUCommandBufferDescriptor commandBufferDesc{};
 	commandBufferDesc.nextInChain = nullptr;
 	commandBufferDesc.label = "Mipmap command buffer";
 	WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, &commandBufferDesc);
 	wgpuQueueSubmit(queue, 1, &commandBuffer);
+	Profiler::submitted();
 
 	// Cleanup encoders and views.
+	wgpuBindGroupLayoutRelease(groupLayout);
 	wgpuComputePassEncoderRelease(pass);
 	wgpuCommandEncoderRelease(encoder);
 	wgpuCommandBufferRelease(commandBuffer);
 	for(WGPUTextureView view : views){
 		wgpuTextureViewRelease(view);
 	}
-}
-
-void GPU::uploadCubemap(const std::array<Image, 6>& images, WGPUDevice device, WGPUQueue queue, WGPUTexture& texture, WGPUTextureView& textureView){
-
-	const unsigned int w = images[0].w;
-	const unsigned int h = images[0].h;
-	const unsigned int c = images[0].c;
-
-	texture = createTexture(device, w, h, 1, WGPUTextureViewDimension_Cube, WGPUTextureFormat_RGBA8Unorm, WGPUTextureUsage_TextureBinding | WGPUTextureUsage_CopyDst, textureView);
-	if(!texture){
-		std::cerr << "Unable to create cubemap." << std::endl;
-		return;
-	}
-
-	// Upload each face to a layer.
-
-	// Common settings
-	WGPUTextureDataLayout dataLayout{};
-	dataLayout.nextInChain = nullptr;
-	dataLayout.offset = 0;
-	dataLayout.bytesPerRow = w * c;
-	dataLayout.rowsPerImage = h;
-	WGPUExtent3D writeSize{ w, h, 1 };
-	const size_t byteSize = images[0].data.size();
-
-	for(unsigned int i = 0; i < 6; ++i){
-		WGPUImageCopyTexture copyDesc{};
-		copyDesc.nextInChain = nullptr;
-		copyDesc.texture = texture;
-		copyDesc.origin = {0,0,i};
-		copyDesc.aspect = WGPUTextureAspect_All;
-		copyDesc.mipLevel = 0;
-		wgpuQueueWriteTexture(queue, &copyDesc, images[i].data.data(), byteSize, &dataLayout, &writeSize);
-	}
-
-
+	_pendingMipmaps.clear();
 }
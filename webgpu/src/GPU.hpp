@@ -21,18 +21,35 @@ public:
 	// Upload mesh
 	static void uploadMesh(const Mesh& mesh, WGPUDevice device, WGPUQueue queue, WGPUBuffer& vertexBuffer, WGPUBuffer& indexBuffer);
 
-	// Upload texture
+	// Upload texture, mip levels are generated when flushing.
 	static void uploadImage(const Image& image, WGPUDevice device, WGPUQueue queue, WGPUTexture& texture, WGPUTextureView& textureView);
 
 	static void uploadCubemap(const std::array<Image, 6>& images, WGPUDevice device, WGPUQueue queue, WGPUTexture& texture, WGPUTextureView& textureView);
 
+	/// Generate mip levels of all textures uploaded since the last flush, in a single compute pass and submit.
+	static void flushUploads(WGPUDevice device, WGPUQueue queue);
+
 	static void clean();
 
+	/// Size in bytes of an RGBA8 texture with all its layers and levels.
+	static size_t getTextureSize(WGPUTexture texture);
+
 	static size_t getUBOAlignment(){ return _uboAlignment; }
 
 private:
 
+	struct PendingMipmap {
+		WGPUTexture texture;
+		unsigned int mipCount;
+		unsigned int layers;
+	};
+
+	static unsigned int getMipCount(unsigned int w, unsigned int h);
+
 	static WGPUComputePipeline _mipmapPipeline;
 	static WGPUShaderModule _mipmapModule;
 	static size_t _uboAlignment;
+	static WGPUTexture _dummyStorage;
+	static WGPUTextureView _dummyStorageView;
+	static std::vector<PendingMipmap> _pendingMipmaps;
 };
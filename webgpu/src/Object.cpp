@@ -3,11 +3,13 @@
 #include "resources/Resources.hpp"
 #include "resources/MeshUtilities.hpp"
 
-void Object::load(){
-	const std::string meshPath = "resources/meshes/" + name + ".obj";
-	MeshUtilities::loadObj(meshPath, geometry, MeshUtilities::Indexed);
-	MeshUtilities::centerAndUnitMesh(geometry);
-	MeshUtilities::computeTangentsAndBinormals(geometry);
+void Object::load(std::vector<std::function<void()>>& jobs){
+	jobs.push_back([this](){
+		const std::string meshPath = "resources/meshes/" + name + ".obj";
+		MeshUtilities::loadObj(meshPath, geometry, MeshUtilities::Indexed);
+		MeshUtilities::centerAndUnitMesh(geometry);
+		MeshUtilities::computeTangentsAndBinormals(geometry);
+	});
 }
 
 void Object::upload(WGPUDevice device, WGPUQueue queue){
@@ -29,12 +31,30 @@ void Object::clean(){
 	}
 }
 
-void ShadedObject::load(){
-	const std::string albedoPath = "resources/textures/" + name + "_texture_color.png";
-	const std::string normalPath = "resources/textures/" + name + "_texture_normal.png";
-	Resources::loadImage(albedoPath, albedo, true);
-	Resources::loadImage(normalPath, normal, true);
-	Object::load();
+void Object::releaseCPU(){
+	// Swap to really free the memory.
+	std::vector<Vertex>().swap(geometry.vertices);
+	std::vector<uint32_t>().swap(geometry.indices);
+}
+
+size_t Object::cpuSize() const {
+	return sizeof(Vertex) * geometry.vertices.capacity() + sizeof(uint32_t) * geometry.indices.capacity();
+}
+
+size_t Object::gpuSize() const {
+	return vertexBufferSize + indexBufferSize;
+}
+
+void ShadedObject::load(std::vector<std::function<void()>>& jobs){
+	jobs.push_back([this](){
+		const std::string albedoPath = "resources/textures/" + name + "_texture_color.png";
+		Resources::loadImage(albedoPath, albedo, true);
+	});
+	jobs.push_back([this](){
+		const std::string normalPath = "resources/textures/" + name + "_texture_normal.png";
+		Resources::loadImage(normalPath, normal, true);
+	});
+	Object::load(jobs);
 }
 void ShadedObject::upload(WGPUDevice device, WGPUQueue queue){
 	Object::upload(device, queue);
@@ -81,7 +101,21 @@ void ShadedObject::clean(){
 	Object::clean();
 }
 
-void Skybox::load(){
+void ShadedObject::releaseCPU(){
+	std::vector<unsigned char>().swap(albedo.data);
+	std::vector<unsigned char>().swap(normal.data);
+	Object::releaseCPU();
+}
+
+size_t ShadedObject::cpuSize() const {
+	return albedo.data.capacity() + normal.data.capacity() + Object::cpuSize();
+}
+
+size_t ShadedObject::gpuSize() const {
+	return GPU::getTextureSize(albedoTexture) + GPU::getTextureSize(normalTexture) + Object::gpuSize();
+}
+
+void Skybox::load(std::vector<std::function<void()>>& jobs){
 	const std::string prefixPath = "resources/textures/" + name;
 	// Same order as Vulkan, phew.
 	const std::string suffixes[] = {
@@ -89,9 +123,11 @@ void Skybox::load(){
 	};
 	for(unsigned int i = 0; i < 6; ++i){
 		const std::string facePath = prefixPath + suffixes[i] + ".png";
-		Resources::loadImage(facePath, faces[i], false);
+		jobs.push_back([this, i, facePath](){
+			Resources::loadImage(facePath, faces[i], false);
+		});
 	}
-	Object::load();
+	Object::load(jobs);
 }
 void Skybox::upload(WGPUDevice device, WGPUQueue queue){
 	GPU::uploadCubemap(faces, device, queue, cubemap, cubemapView);
@@ -130,3 +166,22 @@ void Skybox::clean(){
 	wgpuTextureRelease(cubemap);
 	Object::clean();
 }
+
+void Skybox::releaseCPU(){
+	for(Image& face : faces){
+		std::vector<unsigned char>().swap(face.data);
+	}
+	Object::releaseCPU();
+}
+
+size_t Skybox::cpuSize() const {
+	size_t size = Object::cpuSize();
+	for(const Image& face : faces){
+		size += face.data.capacity();
+	}
+	return size;
+}
+
+size_t Skybox::gpuSize() const {
+	return GPU::getTextureSize(cubemap) + Object::gpuSize();
+}
@@ -2,16 +2,27 @@
 #include "resources/Resources.hpp"
 
 #include "common.hpp"
+#include <functional>
 
 class Object {
 public:
 
-	virtual void load();
+	/// Append independent loading jobs (file reading and decoding, mesh processing) to the list, they can be run in parallel.
+	virtual void load(std::vector<std::function<void()>>& jobs);
 	virtual void upload(WGPUDevice device, WGPUQueue queue);
 	virtual void clean();
 
+	/// Free CPU copies of the data once uploaded.
+	virtual void releaseCPU();
+
+	/// Memory used by the object, in bytes.
+	virtual size_t cpuSize() const;
+	virtual size_t gpuSize() const;
+
 	// CPU data.
 	Mesh geometry;
+	// Keep CPU data after upload (for picking, physics,...)
+	bool keepCPU{false};
 	// GPU data.
 	WGPUBuffer vertexBuffer{0};
 	WGPUBuffer indexBuffer{0};
@@ -29,9 +40,12 @@ public:
 class ShadedObject : public Object {
 public:
 
-	void load() override;
+	void load(std::vector<std::function<void()>>& jobs) override;
 	void upload(WGPUDevice device, WGPUQueue queue)  override;
 	void clean()  override;
+	void releaseCPU() override;
+	size_t cpuSize() const override;
+	size_t gpuSize() const override;
 
 	// CPU data.
 	Image albedo;
@@ -48,9 +62,12 @@ public:
 class Skybox : public Object {
 public:
 
-	void load() override;
+	void load(std::vector<std::function<void()>>& jobs) override;
 	void upload(WGPUDevice device, WGPUQueue queue)  override;
 	void clean()  override;
+	void releaseCPU() override;
+	size_t cpuSize() const override;
+	size_t gpuSize() const override;
 
 	// CPU data
 	std::array<Image, 6> faces;
@@ -0,0 +1,227 @@
+#include "Profiler.hpp"
+#include "GPU.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+// Passes timed per encoder, each one uses two queries.
+#define MAX_PASSES 16
+// Encoders whose timings can be read back at the same time.
+#define READBACK_COUNT 4
+// Samples in the rolling window.
+#define WINDOW_SIZE 120
+
+bool Profiler::_enabled = false;
+WGPUDevice Profiler::_device = nullptr;
+WGPUQuerySet Profiler::_querySet = nullptr;
+WGPUBuffer Profiler::_resolveBuffer = nullptr;
+std::vector<Profiler::Readback> Profiler::_readbacks;
+std::vector<std::string> Profiler::_passes;
+std::vector<WGPURenderPassTimestampWrite> Profiler::_renderWrites;
+std::vector<WGPUComputePassTimestampWrite> Profiler::_computeWrites;
+std::map<std::string, Profiler::Timings> Profiler::_cpuTimings;
+std::map<std::string, Profiler::Timings> Profiler::_gpuTimings;
+
+Profiler::Scope::Scope(const char* name) : _name(name) {
+	if(Profiler::enabled()){
+		_start = std::chrono::high_resolution_clock::now();
+	}
+}
+
+Profiler::Scope::~Scope(){
+	if(Profiler::enabled()){
+		const auto end = std::chrono::high_resolution_clock::now();
+		Profiler::addSample(Profiler::_cpuTimings, _name, std::chrono::duration<double, std::milli>(end - _start).count());
+	}
+}
+
+void Profiler::init(WGPUDevice device, bool timestamps){
+	_enabled = true;
+	_device = device;
+	if(!timestamps){
+		std::cerr << "Timestamps not supported, only CPU timings will be profiled." << std::endl;
+		return;
+	}
+
+	WGPUQuerySetDescriptor queryDesc{};
+	queryDesc.nextInChain = nullptr;
+	queryDesc.label = "Profiler timestamps";
+	queryDesc.type = WGPUQueryType_Timestamp;
+	queryDesc.count = 2 * MAX_PASSES;
+	queryDesc.pipelineStatistics = nullptr;
+	queryDesc.pipelineStatisticsCount = 0;
+	_querySet = wgpuDeviceCreateQuerySet(device, &queryDesc);
+	if(!_querySet){
+		std::cerr << "Unable to create timestamp query set." << std::endl;
+		return;
+	}
+
+	const size_t resolveSize = 2 * MAX_PASSES * sizeof(uint64_t);
+	_resolveBuffer = GPU::createBuffer(device, resolveSize, WGPUBufferUsage_QueryResolve | WGPUBufferUsage_CopySrc);
+	_readbacks.resize(READBACK_COUNT);
+	for(Readback& readback : _readbacks){
+		readback.buffer = GPU::createBuffer(device, resolveSize, WGPUBufferUsage_CopyDst | WGPUBufferUsage_MapRead);
+	}
+
+	// Timestamp writes are referenced by pass descriptors, allocate them once.
+	_renderWrites.resize(2 * MAX_PASSES);
+	_computeWrites.resize(2 * MAX_PASSES);
+	for(uint32_t i = 0; i < 2 * MAX_PASSES; ++i){
+		const bool begin = (i % 2) == 0;
+		_renderWrites[i].querySet = _querySet;
+		_renderWrites[i].queryIndex = i;
+		_renderWrites[i].location = begin ? WGPURenderPassTimestampLocation_Beginning : WGPURenderPassTimestampLocation_End;
+		_computeWrites[i].querySet = _querySet;
+		_computeWrites[i].queryIndex = i;
+		_computeWrites[i].location = begin ? WGPUComputePassTimestampLocation_Beginning : WGPUComputePassTimestampLocation_End;
+	}
+}
+
+uint32_t Profiler::allocateQueries(const char* name){
+	if(!_querySet || _passes.size() >= MAX_PASSES){
+		return 2 * MAX_PASSES;
+	}
+	_passes.push_back(name);
+	return 2 * uint32_t(_passes.size() - 1);
+}
+
+void Profiler::renderPass(const char* name, WGPURenderPassDescriptor& desc){
+	const uint32_t first = allocateQueries(name);
+	if(first >= 2 * MAX_PASSES){
+		return;
+	}
+	desc.timestampWriteCount = 2;
+	desc.timestampWrites = &_renderWrites[first];
+}
+
+void Profiler::computePass(const char* name, WGPUComputePassDescriptor& desc){
+	const uint32_t first = allocateQueries(name);
+	if(first >= 2 * MAX_PASSES){
+		return;
+	}
+	desc.timestampWriteCount = 2;
+	desc.timestampWrites = &_computeWrites[first];
+}
+
+void Profiler::resolve(WGPUCommandEncoder encoder){
+	if(_passes.empty()){
+		return;
+	}
+	// Find a readback buffer not in use, else skip these timings.
+	auto readback = std::find_if(_readbacks.begin(), _readbacks.end(), [](const Readback& readback){
+		return !readback.resolved && !readback.mapping;
+	});
+	if(readback != _readbacks.end()){
+		const uint32_t queryCount = 2 * uint32_t(_passes.size());
+		wgpuCommandEncoderResolveQuerySet(encoder, _querySet, 0, queryCount, _resolveBuffer, 0);
+		wgpuCommandEncoderCopyBufferToBuffer(encoder, _resolveBuffer, 0, readback->buffer, 0, queryCount * sizeof(uint64_t));
+		readback->names = _passes;
+		readback->resolved = true;
+	}
+	_passes.clear();
+}
+
+void Profiler::submitted(){
+	if(!_querySet){
+		return;
+	}
+	for(Readback& readback : _readbacks){
+		if(readback.resolved && !readback.mapping){
+			readback.mapping = true;
+			wgpuBufferMapAsync(readback.buffer, WGPUMapMode_Read, 0, 2 * readback.names.size() * sizeof(uint64_t), mapCallback, &readback);
+		}
+	}
+	// Process completed mappings.
+	wgpuDeviceTick(_device);
+}
+
+void Profiler::mapCallback(WGPUBufferMapAsyncStatus status, void* userdata){
+	Readback& readback = *(Readback*)userdata;
+	if(status == WGPUBufferMapAsyncStatus_Success){
+		const size_t size = 2 * readback.names.size() * sizeof(uint64_t);
+		const uint64_t* times = (const uint64_t*)wgpuBufferGetConstMappedRange(readback.buffer, 0, size);
+		for(size_t i = 0; times && i < readback.names.size(); ++i){
+			// Timestamps are in nanoseconds, ignore invalid ranges.
+			if(times[2 * i + 1] >= times[2 * i]){
+				addSample(_gpuTimings, readback.names[i], double(times[2 * i + 1] - times[2 * i]) * 1e-6);
+			}
+		}
+		wgpuBufferUnmap(readback.buffer);
+	}
+	readback.resolved = false;
+	readback.mapping = false;
+}
+
+void Profiler::addSample(std::map<std::string, Timings>& timings, const std::string& name, double duration){
+	Timings& timing = timings[name];
+	if(timing.samples.size() < WINDOW_SIZE){
+		timing.samples.push_back(duration);
+	} else {
+		timing.samples[timing.next] = duration;
+	}
+	timing.next = (timing.next + 1) % WINDOW_SIZE;
+}
+
+void Profiler::report(std::ostream& stream, bool json){
+	const std::map<std::string, Timings>* categories[] = { &_cpuTimings, &_gpuTimings };
+	const char* categoryNames[] = { "cpu", "gpu" };
+
+	stream << std::fixed << std::setprecision(3);
+	if(json){
+		stream << "{";
+	}
+	for(unsigned int c = 0; c < 2; ++c){
+		if(json){
+			stream << (c > 0 ? ", " : "") << "\"" << categoryNames[c] << "\": {";
+		} else {
+			stream << (c == 0 ? "CPU" : "GPU") << " timings (ms):" << std::endl;
+		}
+		bool first = true;
+		for(const auto& timing : *categories[c]){
+			const std::vector<double>& samples = timing.second.samples;
+			if(samples.empty()){
+				continue;
+			}
+			double total = 0.0;
+			for(const double sample : samples){
+				total += sample;
+			}
+			const double average = total / double(samples.size());
+			const double minimum = *std::min_element(samples.begin(), samples.end());
+			const double maximum = *std::max_element(samples.begin(), samples.end());
+			if(json){
+				stream << (first ? "" : ", ") << "\"" << timing.first << "\": {\"avg\": " << average << ", \"min\": " << minimum << ", \"max\": " << maximum << ", \"samples\": " << samples.size() << "}";
+			} else {
+				stream << "\t" << timing.first << ": avg " << average << ", min " << minimum << ", max " << maximum << " (" << samples.size() << " samples)" << std::endl;
+			}
+			first = false;
+		}
+		if(json){
+			stream << "}";
+		}
+	}
+	if(json){
+		stream << "}" << std::endl;
+	}
+	stream.unsetf(std::ios::floatfield);
+}
+
+void Profiler::clean(){
+	for(Readback& readback : _readbacks){
+		wgpuBufferDestroy(readback.buffer);
+		wgpuBufferRelease(readback.buffer);
+	}
+	_readbacks.clear();
+	if(_resolveBuffer){
+		wgpuBufferDestroy(_resolveBuffer);
+		wgpuBufferRelease(_resolveBuffer);
+		_resolveBuffer = nullptr;
+	}
+	if(_querySet){
+		wgpuQuerySetDestroy(_querySet);
+		wgpuQuerySetRelease(_querySet);
+		_querySet = nullptr;
+	}
+	_passes.clear();
+	_enabled = false;
+}
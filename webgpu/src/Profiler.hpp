@@ -0,0 +1,76 @@
+#pragma once
+
+#include "common.hpp"
+
+#include <chrono>
+#include <map>
+
+/// Optional CPU and GPU timings collection.
+/// GPU passes are timed with timestamp queries written at the beginning and end of each pass, resolved at the end
+/// of each command encoder and read back asynchronously. If the timestamp-query feature is not available,
+/// only CPU scopes are measured. Timings are averaged over a rolling window.
+class Profiler {
+public:
+
+	/// Measure the CPU time spent in the enclosing scope.
+	class Scope {
+	public:
+		Scope(const char* name);
+		~Scope();
+	private:
+		const char* _name;
+		std::chrono::high_resolution_clock::time_point _start;
+	};
+
+	/// Enable the profiler, GPU timings are only collected if timestamps are supported by the device.
+	static void init(WGPUDevice device, bool timestamps);
+
+	/// Add timestamp writes to a pass descriptor. The descriptor has to be used in the current encoder.
+	static void renderPass(const char* name, WGPURenderPassDescriptor& desc);
+	static void computePass(const char* name, WGPUComputePassDescriptor& desc);
+
+	/// Resolve queries of passes recorded since the last call, at the end of an encoder.
+	static void resolve(WGPUCommandEncoder encoder);
+
+	/// Start reading back resolved queries, once the encoder has been submitted.
+	static void submitted();
+
+	/// Print average, min and max timings (in ms) on the rolling window, as text or JSON.
+	static void report(std::ostream& stream, bool json);
+
+	static void clean();
+
+	static bool enabled(){ return _enabled; }
+
+private:
+
+	struct Timings {
+		std::vector<double> samples;
+		size_t next = 0;
+	};
+
+	struct Readback {
+		WGPUBuffer buffer = nullptr;
+		std::vector<std::string> names;
+		bool resolved = false;
+		bool mapping = false;
+	};
+
+	static void addSample(std::map<std::string, Timings>& timings, const std::string& name, double duration);
+
+	static void mapCallback(WGPUBufferMapAsyncStatus status, void* userdata);
+
+	static uint32_t allocateQueries(const char* name);
+
+	static bool _enabled;
+	static WGPUDevice _device;
+	static WGPUQuerySet _querySet;
+	static WGPUBuffer _resolveBuffer;
+	static std::vector<Readback> _readbacks;
+	static std::vector<std::string> _passes;
+	static std::vector<WGPURenderPassTimestampWrite> _renderWrites;
+	static std::vector<WGPUComputePassTimestampWrite> _computeWrites;
+
+	static std::map<std::string, Timings> _cpuTimings;
+	static std::map<std::string, Timings> _gpuTimings;
+};
@@ -2,6 +2,11 @@
 #include "GPU.hpp"
 #include "resources/Resources.hpp"
 #include "resources/MeshUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Profiler.hpp"
+
+#include <deque>
+#include <mutex>
 
 #define DRAGON_ID 0
 #define MONKEY_ID 1
@@ -59,26 +64,18 @@ Renderer::Renderer() {
 	_skybox.name = "cubemap";
 	_skybox.model = glm::scale(glm::mat4(1.0f), glm::vec3(15.0f));
 
-	for(Object& object : _objects){
-		object.load();
-	}
-	_skybox.load();
 }
 
 void Renderer::upload(WGPUDevice device, WGPUQueue queue, WGPUTextureFormat swapchainFormat){
+	Profiler::Scope scope("Upload");
 
-	// Compute uniform buffers strides.
-	const size_t alignmentConstraint = GPU::getUBOAlignment();
-	const size_t objectUBOSizeRatio = (sizeof(ModelInfos) + alignmentConstraint - 1) / alignmentConstraint;
-	const size_t objectUniformSize = objectUBOSizeRatio * alignmentConstraint;
+	// Compute uniform sizes.
+	const size_t objectUniformSize = UniformArena::alignedSize(sizeof(ModelInfos));
 	const size_t frameUniformSize = sizeof(FrameInfos);
-	_objectUniformStride = objectUniformSize; // total size including stride.
 
-	// Upload objects.
-	for(Object& object : _objects){
-		object.upload(device, queue);
-	}
-	_skybox.upload(device, queue);
+	// Load and upload objects.
+	loadAndUpload(device, queue);
+	printMemoryReport();
 
 	// Create sampler.
 	{
@@ -117,11 +114,19 @@ void Renderer::upload(WGPUDevice device, WGPUQueue queue, WGPUTextureFormat swap
 		_shadowMapTexture = GPU::createTexture(device, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, 1, WGPUTextureViewDimension_2D, kDepthBufferFormat, WGPUTextureUsage_RenderAttachment | WGPUTextureUsage_TextureBinding, _shadowMapTextureView);
 	}
 
-	// Create uniform buffers.
+	// Create uniform buffer: frame infos first, then all objects.
 	{
 		const size_t objectCount = _objects.size() + 1 /* skybox */;
-		_objectsUniformBuffer = GPU::createBuffer(device, objectUniformSize * objectCount, WGPUBufferUsage_CopyDst | WGPUBufferUsage_Uniform);
-		_frameUniformBuffer = GPU::createBuffer(device, frameUniformSize, WGPUBufferUsage_CopyDst | WGPUBufferUsage_Uniform);
+		_uniforms.init(device, UniformArena::alignedSize(frameUniformSize) + objectUniformSize * objectCount);
+		_objectOffsets.resize(_objects.size());
+		// Uniforms are always pushed in the same order, so offsets are known in advance and can be baked in bundles.
+		_uniforms.reset();
+		_uniforms.push(FrameInfos());
+		for(uint32_t& offset : _objectOffsets){
+			offset = _uniforms.push(ModelInfos());
+		}
+		_skyboxOffset = _uniforms.push(ModelInfos());
+		_uniforms.reset();
 	}
 
 	// Create common bind group layouts and the corresponding bindgroups.
@@ -147,11 +152,12 @@ void Renderer::upload(WGPUDevice device, WGPUQueue queue, WGPUTextureFormat swap
 		layoutEntries[1].buffer.hasDynamicOffset = true;
 		layoutEntries[1].buffer.minBindingSize = objectUniformSize;
 
-		entries[0].buffer = _frameUniformBuffer;
+		// Both bindings point to the same buffer, objects are accessed with dynamic offsets.
+		entries[0].buffer = _uniforms.buffer();
 		entries[0].size = frameUniformSize;
 		entries[0].binding = 0;
 
-		entries[1].buffer = _objectsUniformBuffer;
+		entries[1].buffer = _uniforms.buffer();
 		entries[1].size = objectUniformSize;
 		entries[1].binding = 1;
 
@@ -257,27 +263,124 @@ void Renderer::upload(WGPUDevice device, WGPUQueue queue, WGPUTextureFormat swap
 		shadowPipeline.depthBias = true;
 		_shadowPipeline.upload(shadowPipeline, device);
 	}
+
+	// Objects and pipelines are ready.
+	recordBundles(device, swapchainFormat);
+}
+
+void Renderer::recordBundles(WGPUDevice device, WGPUTextureFormat swapchainFormat){
+	if(_shadowBundle){
+		wgpuRenderBundleRelease(_shadowBundle);
+	}
+	if(_mainBundle){
+		wgpuRenderBundleRelease(_mainBundle);
+	}
+
+	// ---- Shadow pass
+	{
+		WGPURenderBundleEncoderDescriptor bundleDesc{};
+		bundleDesc.nextInChain = nullptr;
+		bundleDesc.label = "Shadow bundle";
+		bundleDesc.colorFormatsCount = 0;
+		bundleDesc.colorFormats = nullptr;
+		bundleDesc.depthStencilFormat = kDepthBufferFormat;
+		bundleDesc.sampleCount = 1;
+		bundleDesc.depthReadOnly = false;
+		bundleDesc.stencilReadOnly = false;
+		WGPURenderBundleEncoder shadowBundle = wgpuDeviceCreateRenderBundleEncoder(device, &bundleDesc);
+
+		wgpuRenderBundleEncoderSetPipeline(shadowBundle, _shadowPipeline.pipeline());
+
+		// Render objects in shadow map.
+		unsigned int objectIndex = 0;
+		for(const ShadedObject& obj : _objects){
+			unsigned int offset = _objectOffsets[objectIndex];
+			wgpuRenderBundleEncoderSetBindGroup(shadowBundle, 0, _uniformGroup, 1, &offset); // uniforms
+			wgpuRenderBundleEncoderSetVertexBuffer(shadowBundle, 0, obj.vertexBuffer, 0,  obj.vertexBufferSize);
+			wgpuRenderBundleEncoderSetIndexBuffer(shadowBundle, obj.indexBuffer, WGPUIndexFormat_Uint32, 0, obj.indexBufferSize);
+			wgpuRenderBundleEncoderDrawIndexed(shadowBundle, obj.indexCount, 1, 0, 0, 0);
+			++objectIndex;
+		}
+
+		WGPURenderBundleDescriptor desc{};
+		desc.nextInChain = nullptr;
+		desc.label = "Shadow bundle";
+		_shadowBundle = wgpuRenderBundleEncoderFinish(shadowBundle, &desc);
+		wgpuRenderBundleEncoderRelease(shadowBundle);
+	}
+
+	// ---- Main pass
+	{
+		WGPURenderBundleEncoderDescriptor bundleDesc{};
+		bundleDesc.nextInChain = nullptr;
+		bundleDesc.label = "Main bundle";
+		bundleDesc.colorFormatsCount = 1;
+		bundleDesc.colorFormats = &swapchainFormat;
+		bundleDesc.depthStencilFormat = kDepthBufferFormat;
+		bundleDesc.sampleCount = 1;
+		bundleDesc.depthReadOnly = false;
+		bundleDesc.stencilReadOnly = false;
+		WGPURenderBundleEncoder mainBundle = wgpuDeviceCreateRenderBundleEncoder(device, &bundleDesc);
+
+		// Render objects.
+		unsigned int objectIndex = 0;
+		{
+			wgpuRenderBundleEncoderSetPipeline(mainBundle, _objectPipeline.pipeline());
+			wgpuRenderBundleEncoderSetBindGroup(mainBundle, 2, _staticGroup, 0, nullptr);
+
+			for(const ShadedObject& obj : _objects){
+
+				unsigned int offset = _objectOffsets[objectIndex];
+				wgpuRenderBundleEncoderSetBindGroup(mainBundle, 0, _uniformGroup, 1, &offset); // uniforms
+				wgpuRenderBundleEncoderSetBindGroup(mainBundle, 1, obj.textureGroup, 0, nullptr); // textures
+				wgpuRenderBundleEncoderSetVertexBuffer(mainBundle, 0, obj.vertexBuffer, 0,  obj.vertexBufferSize);
+				wgpuRenderBundleEncoderSetIndexBuffer(mainBundle, obj.indexBuffer, WGPUIndexFormat_Uint32, 0, obj.indexBufferSize);
+				wgpuRenderBundleEncoderDrawIndexed(mainBundle, obj.indexCount, 1, 0, 0, 0);
+				++objectIndex;
+			}
+		}
+		// And the skybox.
+		{
+			wgpuRenderBundleEncoderSetPipeline(mainBundle, _skyboxPipeline.pipeline());
+			wgpuRenderBundleEncoderSetBindGroup(mainBundle, 2, _staticGroup, 0, nullptr);
+
+			unsigned int offset = _skyboxOffset;
+			wgpuRenderBundleEncoderSetBindGroup(mainBundle, 0, _uniformGroup, 1, &offset); // uniforms
+			wgpuRenderBundleEncoderSetBindGroup(mainBundle, 1, _skybox.textureGroup, 0, nullptr); // textures (per object)
+			wgpuRenderBundleEncoderSetVertexBuffer(mainBundle, 0, _skybox.vertexBuffer, 0,  _skybox.vertexBufferSize);
+			wgpuRenderBundleEncoderSetIndexBuffer(mainBundle, _skybox.indexBuffer, WGPUIndexFormat_Uint32, 0, _skybox.indexBufferSize);
+			wgpuRenderBundleEncoderDrawIndexed(mainBundle, _skybox.indexCount, 1, 0, 0, 0);
+		}
+
+		WGPURenderBundleDescriptor desc{};
+		desc.nextInChain = nullptr;
+		desc.label = "Main bundle";
+		_mainBundle = wgpuRenderBundleEncoderFinish(mainBundle, &desc);
+		wgpuRenderBundleEncoderRelease(mainBundle);
+	}
 }
 
 void Renderer::draw(WGPUQueue queue, WGPUCommandEncoder encoder, WGPUTextureView backbuffer){
+	Profiler::Scope scope("Draw");
 
-	// Update all uniforms
+	// Update all uniforms, packed in the arena and uploaded in one write.
 	{
+		_uniforms.reset();
 		FrameInfos frameInfos;
 		frameInfos.proj = _camera.projection();
 		frameInfos.lightVP = _lightViewproj;
 		frameInfos.lightDirViewspace = glm::vec3(_camera.view() * _worldLightDir);
-		wgpuQueueWriteBuffer(queue, _frameUniformBuffer, 0, &frameInfos, sizeof(FrameInfos));
+		// Bound at offset 0.
+		_uniforms.push(frameInfos);
 
-		unsigned int objectIndex = 0;
+		// Same order as the offsets baked in the bundles.
 		for(const ShadedObject& object : _objects){
 			ModelInfos modelInfos;
 			modelInfos.M = object.model;
 			modelInfos.MV = _camera.view() * object.model;
 			modelInfos.MVinverse = glm::transpose(glm::inverse(modelInfos.MV));
 			modelInfos.shininess = object.shininess;
-			wgpuQueueWriteBuffer(queue, _objectsUniformBuffer, _objectUniformStride * objectIndex, &modelInfos, sizeof(ModelInfos));
-			++objectIndex;
+			_uniforms.push(modelInfos);
 		}
 		// Append skybox.
 		{
@@ -286,8 +389,9 @@ void Renderer::draw(WGPUQueue queue, WGPUCommandEncoder encoder, WGPUTextureView
 			modelInfos.MV = _camera.view() * _skybox.model;
 			modelInfos.MVinverse = glm::transpose(glm::inverse(modelInfos.MV));
 			modelInfos.shininess = 0.f;
-			wgpuQueueWriteBuffer(queue, _objectsUniformBuffer, _objectUniformStride * objectIndex, &modelInfos, sizeof(ModelInfos));
+			_uniforms.push(modelInfos);
 		}
+		_uniforms.upload(queue);
 	}
 
 	// ---- Shadow pass
@@ -302,28 +406,18 @@ void Renderer::draw(WGPUQueue queue, WGPUCommandEncoder encoder, WGPUTextureView
 		depthAttachment.stencilLoadOp = WGPULoadOp_Undefined;
 		depthAttachment.stencilStoreOp = WGPUStoreOp_Undefined;
 		depthAttachment.stencilClearValue = 0;
-		depthAttachment.stencilReadOnly = true;
+		depthAttachment.stencilReadOnly = false; // Must match the bundles.
 
 		WGPURenderPassDescriptor passDesc{};
 		passDesc.nextInChain = nullptr;
 		passDesc.colorAttachmentCount = 0;
 		passDesc.colorAttachments = nullptr;
 		passDesc.depthStencilAttachment = &depthAttachment;
+		Profiler::renderPass("Shadow pass", passDesc);
 		WGPURenderPassEncoder shadowPass = wgpuCommandEncoderBeginRenderPass(encoder, &passDesc);
 
 		wgpuRenderPassEncoderSetViewport(shadowPass, 0.f, 0.f, float(SHADOW_MAP_SIZE), float(SHADOW_MAP_SIZE), 0.0f, 1.0f);
-		wgpuRenderPassEncoderSetPipeline(shadowPass, _shadowPipeline.pipeline());
-
-		// Render objects in shadow map.
-		unsigned int objectIndex = 0;
-		for(const ShadedObject& obj : _objects){
-			unsigned int offset = objectIndex * _objectUniformStride;
-			wgpuRenderPassEncoderSetBindGroup(shadowPass, 0, _uniformGroup, 1, &offset); // uniforms
-			wgpuRenderPassEncoderSetVertexBuffer(shadowPass, 0, obj.vertexBuffer, 0,  obj.vertexBufferSize);
-			wgpuRenderPassEncoderSetIndexBuffer(shadowPass, obj.indexBuffer, WGPUIndexFormat_Uint32, 0, obj.indexBufferSize);
-			wgpuRenderPassEncoderDrawIndexed(shadowPass, obj.indexCount, 1, 0, 0, 0);
-			++objectIndex;
-		}
+		wgpuRenderPassEncoderExecuteBundles(shadowPass, 1, &_shadowBundle);
 		wgpuRenderPassEncoderEnd(shadowPass);
 	}
 	
@@ -347,55 +441,35 @@ void Renderer::draw(WGPUQueue queue, WGPUCommandEncoder encoder, WGPUTextureView
 		depthAttachment.stencilLoadOp = WGPULoadOp_Undefined;
 		depthAttachment.stencilStoreOp = WGPUStoreOp_Undefined;
 		depthAttachment.stencilClearValue = 0;
-		depthAttachment.stencilReadOnly = true;
+		depthAttachment.stencilReadOnly = false; // Must match the bundles.
 
 		WGPURenderPassDescriptor finalPassDesc{};
 		finalPassDesc.nextInChain = nullptr;
 		finalPassDesc.colorAttachmentCount = 1;
 		finalPassDesc.colorAttachments = &colorAttachment;
 		finalPassDesc.depthStencilAttachment = &depthAttachment;
+		Profiler::renderPass("Main pass", finalPassDesc);
 		WGPURenderPassEncoder finalPass = wgpuCommandEncoderBeginRenderPass(encoder, &finalPassDesc);
 		wgpuRenderPassEncoderSetViewport(finalPass, 0.f, 0.f, _size[0], _size[1], 0.0f, 1.0f);
-
-		// Render objects.
-		unsigned int objectIndex = 0;
-		{
-			wgpuRenderPassEncoderSetPipeline(finalPass, _objectPipeline.pipeline());
-			wgpuRenderPassEncoderSetBindGroup(finalPass, 2, _staticGroup, 0, nullptr);
-
-			for(const ShadedObject& obj : _objects){
-
-				unsigned int offset = objectIndex * _objectUniformStride;
-				wgpuRenderPassEncoderSetBindGroup(finalPass, 0, _uniformGroup, 1, &offset); // uniforms
-				wgpuRenderPassEncoderSetBindGroup(finalPass, 1, obj.textureGroup, 0, nullptr); // textures
-				wgpuRenderPassEncoderSetVertexBuffer(finalPass, 0, obj.vertexBuffer, 0,  obj.vertexBufferSize);
-				wgpuRenderPassEncoderSetIndexBuffer(finalPass, obj.indexBuffer, WGPUIndexFormat_Uint32, 0, obj.indexBufferSize);
-				wgpuRenderPassEncoderDrawIndexed(finalPass, obj.indexCount, 1, 0, 0, 0);
-				++objectIndex;
-			}
-		}
-		// And the skybox.
-		{
-			wgpuRenderPassEncoderSetPipeline(finalPass, _skyboxPipeline.pipeline());
-			wgpuRenderPassEncoderSetBindGroup(finalPass, 2, _staticGroup, 0, nullptr);
-
-			unsigned int offset = objectIndex * _objectUniformStride;
-			wgpuRenderPassEncoderSetBindGroup(finalPass, 0, _uniformGroup, 1, &offset); // uniforms
-			wgpuRenderPassEncoderSetBindGroup(finalPass, 1, _skybox.textureGroup, 0, nullptr); // textures (per object)
-			wgpuRenderPassEncoderSetVertexBuffer(finalPass, 0, _skybox.vertexBuffer, 0,  _skybox.vertexBufferSize);
-			wgpuRenderPassEncoderSetIndexBuffer(finalPass, _skybox.indexBuffer, WGPUIndexFormat_Uint32, 0, _skybox.indexBufferSize);
-			wgpuRenderPassEncoderDrawIndexed(finalPass, _skybox.indexCount, 1, 0, 0, 0);
-		}
-
+		// Objects and skybox.
+		wgpuRenderPassEncoderExecuteBundles(finalPass, 1, &_mainBundle);
 		wgpuRenderPassEncoderEnd(finalPass);
 
 	}
 }
 
 void Renderer::update(double deltaTime) {
+	Profiler::Scope scope("Update");
 	_time += deltaTime;
-	_camera.update();
-	_camera.physics(deltaTime);
+	if(_cameraPath){
+		// Slow orbit around the scene, bobbing up and down.
+		const float angle = float(0.3 * _time);
+		const glm::vec3 eye(2.5f * cos(angle), 0.6f + 0.3f * float(sin(0.5 * _time)), 2.5f * sin(angle));
+		_camera.pose(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	} else {
+		_camera.update();
+		_camera.physics(deltaTime);
+	}
 	
 	_worldLightDir = glm::normalize(glm::vec4(1.0,0.5*sin(_time)+0.6, 1.0,0.0));
 	glm::mat4 lightView = glm::lookAt(2.0f*glm::vec3(_worldLightDir), glm::vec3(0.0f), glm::vec3(0.0,1.0,0.0));
@@ -424,6 +498,81 @@ void Renderer::resize(WGPUDevice device, int width, int height){
 
 }
 
+void Renderer::loadAndUpload(WGPUDevice device, WGPUQueue queue){
+	std::vector<Object*> objects;
+	for(Object& object : _objects){
+		objects.push_back(&object);
+	}
+	objects.push_back(&_skybox);
+
+	// Remaining jobs for each object, and objects ready to be uploaded.
+	std::vector<unsigned int> remainingJobs(objects.size(), 0);
+	std::deque<size_t> readyObjects;
+	std::mutex mutex;
+	std::condition_variable condition;
+
+	ThreadPool pool;
+	std::vector<std::function<void()>> jobs;
+	for(size_t i = 0; i < objects.size(); ++i){
+		jobs.clear();
+		objects[i]->load(jobs);
+		if(jobs.empty()){
+			std::lock_guard<std::mutex> lock(mutex);
+			readyObjects.push_back(i);
+			condition.notify_one();
+			continue;
+		}
+		remainingJobs[i] = jobs.size();
+		for(const std::function<void()>& job : jobs){
+			pool.push([i, job, &remainingJobs, &readyObjects, &mutex, &condition](){
+				job();
+				std::lock_guard<std::mutex> lock(mutex);
+				// The last job of an object marks it as ready.
+				if(--remainingJobs[i] == 0){
+					readyObjects.push_back(i);
+					condition.notify_one();
+				}
+			});
+		}
+	}
+
+	// Upload objects as soon as they are loaded, on the main thread, and drop CPU data that is not needed anymore.
+	for(size_t uploaded = 0; uploaded < objects.size(); ++uploaded){
+		size_t index = 0;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&readyObjects]{ return !readyObjects.empty(); });
+			index = readyObjects.front();
+			readyObjects.pop_front();
+		}
+		Object& object = *objects[index];
+		object.upload(device, queue);
+		if(!object.keepCPU){
+			object.releaseCPU();
+		}
+	}
+	// Generate mipmaps of all textures at once.
+	GPU::flushUploads(device, queue);
+}
+
+void Renderer::printMemoryReport() const {
+	size_t totalCPU = 0;
+	size_t totalGPU = 0;
+	auto printObject = [&totalCPU, &totalGPU](const Object& object){
+		const size_t cpu = object.cpuSize();
+		const size_t gpu = object.gpuSize();
+		std::cout << "\t" << object.name << ": CPU " << (cpu / 1024) << " kB, GPU " << (gpu / 1024) << " kB" << std::endl;
+		totalCPU += cpu;
+		totalGPU += gpu;
+	};
+	std::cout << "Memory usage:" << std::endl;
+	for(const Object& object : _objects){
+		printObject(object);
+	}
+	printObject(_skybox);
+	std::cout << "\tTotal: CPU " << (totalCPU / 1024) << " kB, GPU " << (totalGPU / 1024) << " kB" << std::endl;
+}
+
 void Renderer::clean(){
 	for(Object& object : _objects){
 		object.clean();
@@ -439,10 +588,10 @@ void Renderer::clean(){
 	wgpuBindGroupLayoutRelease(_uniformGroupLayout);
 	wgpuBindGroupLayoutRelease(_staticGroupLayout);
 
-	wgpuBufferDestroy(_objectsUniformBuffer);
-	wgpuBufferRelease(_objectsUniformBuffer);
-	wgpuBufferDestroy(_frameUniformBuffer);
-	wgpuBufferRelease(_frameUniformBuffer);
+	wgpuRenderBundleRelease(_shadowBundle);
+	wgpuRenderBundleRelease(_mainBundle);
+
+	_uniforms.clean();
 	wgpuSamplerRelease(_linearSampler);
 	wgpuSamplerRelease(_shadowSampler);
 
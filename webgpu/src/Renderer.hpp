@@ -3,6 +3,7 @@
 #include "resources/Resources.hpp"
 #include "Object.hpp"
 #include "Pipeline.hpp"
+#include "UniformArena.hpp"
 
 #include "common.hpp"
 #include <chrono>
@@ -24,11 +25,23 @@ public:
 	void resize(WGPUDevice device, int width, int height);
 	
 	void clean();
+
+	/// Follow a fixed camera path instead of user input, for benchmarking.
+	void useCameraPath(){ _cameraPath = true; }
 	
 private:
 
+	/// Record draws of the shadow and main passes, to re-run when objects or pipelines change.
+	void recordBundles(WGPUDevice device, WGPUTextureFormat swapchainFormat);
+
+	/// Load all objects in parallel, and upload each one as soon as it is ready.
+	void loadAndUpload(WGPUDevice device, WGPUQueue queue);
+
+	void printMemoryReport() const;
+
 	glm::vec2 _size = glm::vec2(0.0f,0.0f);
 	double _time = 0.0;
+	bool _cameraPath = false;
 	
 	// Scene.
 	ControllableCamera _camera;
@@ -40,8 +53,10 @@ private:
 	Pipeline _skyboxPipeline;
 	Pipeline _shadowPipeline;
 
-	WGPUBuffer _objectsUniformBuffer{0};
-	WGPUBuffer _frameUniformBuffer{0};
+	// Frame and objects uniforms, uploaded at once.
+	UniformArena _uniforms;
+	std::vector<uint32_t> _objectOffsets;
+	uint32_t _skyboxOffset = 0;
 
 	WGPUBindGroupLayout _uniformGroupLayout{0};
 	WGPUBindGroupLayout _staticGroupLayout{0};
@@ -53,11 +68,12 @@ private:
 	WGPUTexture _shadowMapTexture{0};
 	WGPUTextureView _shadowMapTextureView{0};
 
+	WGPURenderBundle _shadowBundle{0};
+	WGPURenderBundle _mainBundle{0};
+
 	WGPUSampler _linearSampler{0};
 	WGPUSampler _shadowSampler{0};
 
-	size_t _objectUniformStride = 0;
-
 	// Light
 	glm::mat4 _lightViewproj;
 	glm::vec4 _worldLightDir;
@@ -0,0 +1,48 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int count){
+	if(count == 0){
+		count = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+	for(unsigned int i = 0; i < count; ++i){
+		_threads.emplace_back(&ThreadPool::work, this);
+	}
+}
+
+ThreadPool::~ThreadPool(){
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_condition.notify_all();
+	for(std::thread& thread : _threads){
+		thread.join();
+	}
+}
+
+void ThreadPool::push(const std::function<void()>& job){
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_jobs.push_back(job);
+	}
+	_condition.notify_one();
+}
+
+void ThreadPool::work(){
+	while(true){
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this]{ return _stop || !_jobs.empty(); });
+			// Finish remaining jobs before stopping.
+			if(_jobs.empty()){
+				return;
+			}
+			job = std::move(_jobs.front());
+			_jobs.pop_front();
+		}
+		job();
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "common.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// Fixed set of worker threads executing jobs in submission order.
+class ThreadPool {
+public:
+
+	/// Use as many threads as hardware cores if count is 0.
+	ThreadPool(unsigned int count = 0);
+
+	/// Waits for all submitted jobs to complete.
+	~ThreadPool();
+
+	void push(const std::function<void()>& job);
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+private:
+
+	void work();
+
+	std::vector<std::thread> _threads;
+	std::deque<std::function<void()>> _jobs;
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	bool _stop{false};
+};
@@ -0,0 +1,49 @@
+#include "UniformArena.hpp"
+#include "GPU.hpp"
+
+#include <cstring>
+
+size_t UniformArena::alignedSize(size_t size){
+	const size_t alignment = GPU::getUBOAlignment();
+	return ((size + alignment - 1) / alignment) * alignment;
+}
+
+void UniformArena::init(WGPUDevice device, size_t capacity){
+	_data.resize(capacity);
+	_used = 0;
+	_buffer = GPU::createBuffer(device, capacity, WGPUBufferUsage_CopyDst | WGPUBufferUsage_Uniform);
+	if(!_buffer){
+		std::cerr << "Unable to create uniform buffer." << std::endl;
+	}
+}
+
+void UniformArena::reset(){
+	_used = 0;
+}
+
+uint32_t UniformArena::push(const void* data, size_t size){
+	const size_t offset = _used;
+	const size_t stride = alignedSize(size);
+	if(offset + stride > _data.size()){
+		std::cerr << "Uniform arena overflow." << std::endl;
+		return 0;
+	}
+	std::memcpy(_data.data() + offset, data, size);
+	_used += stride;
+	return uint32_t(offset);
+}
+
+void UniformArena::upload(WGPUQueue queue){
+	if(_used == 0){
+		return;
+	}
+	wgpuQueueWriteBuffer(queue, _buffer, 0, _data.data(), _used);
+}
+
+void UniformArena::clean(){
+	if(_buffer){
+		wgpuBufferDestroy(_buffer);
+		wgpuBufferRelease(_buffer);
+		_buffer = nullptr;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "common.hpp"
+
+/// CPU-side storage for all the uniforms of a frame, packed contiguously at the required UBO alignment.
+/// Everything is uploaded to the GPU buffer in a single queue write, whatever the number of objects.
+class UniformArena {
+public:
+
+	void init(WGPUDevice device, size_t capacity);
+
+	/// Start packing a new frame.
+	void reset();
+
+	/// Copy data at the next aligned offset, and return this offset.
+	uint32_t push(const void* data, size_t size);
+
+	template<typename T>
+	uint32_t push(const T& data){ return push(&data, sizeof(T)); }
+
+	/// Upload all data pushed since the last reset.
+	void upload(WGPUQueue queue);
+
+	void clean();
+
+	WGPUBuffer buffer() const { return _buffer; }
+
+	/// Size of an element once aligned.
+	static size_t alignedSize(size_t size);
+
+private:
+
+	std::vector<unsigned char> _data;
+	size_t _used = 0;
+	WGPUBuffer _buffer = nullptr;
+};
@@ -46,6 +46,14 @@ void Camera::fov(float fov){
 	updateProjection();
 }
 
+void Camera::pose(const glm::vec3 & eye, const glm::vec3 & center, const glm::vec3 & up){
+	_eye = eye;
+	_center = center;
+	_right = glm::normalize(glm::cross(glm::normalize(_center - _eye), up));
+	_up = glm::normalize(glm::cross(_right, glm::normalize(_center - _eye)));
+	updateView();
+}
+
 void Camera::updateProjection(){
 	// Perspective projection.
 	_projection = glm::perspective(_fov, _ratio, _near, _far);
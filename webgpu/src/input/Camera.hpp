@@ -26,6 +26,9 @@ public:
 	/// Update the FOV (in radians).
 	void fov(float fov);
 	
+	/// Place the camera explicitly.
+	void pose(const glm::vec3 & eye, const glm::vec3 & center, const glm::vec3 & up);
+	
 	float fov() const { return _fov; }
 	
 	const glm::mat4 view() const { return _view; }
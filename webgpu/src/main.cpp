@@ -2,9 +2,14 @@
 
 #include "Renderer.hpp"
 #include "GPU.hpp"
+#include "Benchmark.hpp"
+#include "Profiler.hpp"
 #include "input/Input.hpp"
 
 #include <glfw3webgpu.h>
+#include <algorithm>
+#include <cstdlib>
+#include <climits>
 
 /// GLFW callbacks.
 static void resize_callback(GLFWwindow* window, int width, int height) {
@@ -31,6 +36,18 @@ void window_iconify_callback(GLFWwindow* window, int iconified){
 	Input::manager().pauseEvent(iconified);
 }
 
+/// Command line helpers.
+static bool parseInteger(const char* str, long minValue, uint32_t& value){
+	char* end = nullptr;
+	const long parsed = std::strtol(str, &end, 10);
+	if(end == str || *end != '\0' || parsed < minValue || parsed > INT_MAX){
+		std::cerr << "Invalid value: " << str << " (expected an integer >= " << minValue << ")" << std::endl;
+		return false;
+	}
+	value = uint32_t(parsed);
+	return true;
+}
+
 // WebGPU callbacks
 
 template<typename T>
@@ -57,13 +74,13 @@ void populateRequestLimits(const WGPULimits& referenceLimits, WGPULimits& target
 	targetLimits.maxTextureArrayLayers = 6;					// Cubemap
 	targetLimits.maxBindGroups = 3;							// Uniforms, textures, static
 	targetLimits.maxBindGroupsPlusVertexBuffers = 4;		// + 1 interlaced vertex buffer
-	targetLimits.maxBindingsPerBindGroup = 3;				// 2 UBOs, up to 2 textures, 2 samplers + 1 shadowmap
+	targetLimits.maxBindingsPerBindGroup = 5;				// 2 UBOs, up to 2 textures, 2 samplers + 1 shadowmap, 1 + 4 mip levels
 	targetLimits.maxDynamicUniformBuffersPerPipelineLayout = 1; // 1 dynamic UBO (per object data)
 	targetLimits.maxDynamicStorageBuffersPerPipelineLayout = 0; // No storage buffer.
 	targetLimits.maxSampledTexturesPerShaderStage = 3;		// 2 textures + shadowmap
 	targetLimits.maxSamplersPerShaderStage = 2;				// Linear and shadow samplers
 	targetLimits.maxStorageBuffersPerShaderStage = 0; 		// No storage buffers
-	targetLimits.maxStorageTexturesPerShaderStage = 1; 		// One storage texture (in mipmap.wgsl)
+	targetLimits.maxStorageTexturesPerShaderStage = 4; 		// Four levels generated at once (in mipmap.wgsl)
 	targetLimits.maxUniformBuffersPerShaderStage = 2; 		// 2 uniform buffers (frame and objects)
 	targetLimits.maxUniformBufferBindingSize = 2048; 		// Above 5 objects * ubo min alignment
 	targetLimits.maxStorageBufferBindingSize = 0; 			// No storage buffer
@@ -77,12 +94,12 @@ void populateRequestLimits(const WGPULimits& referenceLimits, WGPULimits& target
 	targetLimits.maxInterStageShaderVariables = 7; 			// Idem
 	targetLimits.maxColorAttachments = 1; 					// No MRT
 	targetLimits.maxColorAttachmentBytesPerSample = 4; 		// Draw to rgba8 swapchain.
-	targetLimits.maxComputeWorkgroupStorageSize = 0; 		// No local storage
+	targetLimits.maxComputeWorkgroupStorageSize = 1024; 	// 8x8 vec4f tile in mipmap.wgsl
 	targetLimits.maxComputeInvocationsPerWorkgroup = 64; 	// 8x8 in mipmap generation
 	targetLimits.maxComputeWorkgroupSizeX = 8; 				// See mipmap.wgsl
 	targetLimits.maxComputeWorkgroupSizeY = 8; 				// Idem
 	targetLimits.maxComputeWorkgroupSizeZ = 1; 				// Workload is 2D
-	targetLimits.maxComputeWorkgroupsPerDimension = 256; 	// 8x8 compute on a 2048 image to mipmap.
+	targetLimits.maxComputeWorkgroupsPerDimension = 256; 	// 8x8 compute on a 2048 image to mipmap, 6 cubemap layers.
 }
 
 void requestDeviceCallback(WGPURequestDeviceStatus status, WGPUDevice device, char const* message, void* userdata){
@@ -128,25 +145,62 @@ WGPUSwapChain createSwapchain(WGPUDevice device, WGPUSurface surface, unsigned i
 }
 
 int main(int argc, char** argv){
-	// Init glfw.
-	if(!glfwInit()){
-		std::cerr << "Could not init GLFW" << std::endl;
-		return -2;
-	}
-	// Don't create an OpenGL context.
-	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-	glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
-	// Create window
-	GLFWwindow* window = glfwCreateWindow(720, 480, "Dragon WebGPU", nullptr, nullptr);
-	if(!window){
-		std::cerr << "Could not create GLFW window" << std::endl;
-		glfwTerminate();
-		return -3;
+	// Command line options.
+	bool headless = false;
+	bool profile = false;
+	bool profileJSON = false;
+	Benchmark::Options benchmark;
+	for(int i = 1; i < argc; ++i){
+		const std::string arg(argv[i]);
+		if(arg == "--headless"){
+			headless = true;
+		} else if(arg == "--profile"){
+			profile = true;
+		} else if(arg == "--profile-json"){
+			profile = true;
+			profileJSON = true;
+		} else if(arg == "--fallback"){
+			benchmark.fallback = true;
+		} else if(arg == "--frames" && i + 1 < argc){
+			if(!parseInteger(argv[++i], 1, benchmark.frames)){
+				return -1;
+			}
+		} else if(arg == "--size" && i + 2 < argc){
+			if(!parseInteger(argv[++i], 4, benchmark.width) || !parseInteger(argv[++i], 4, benchmark.height)){
+				return -1;
+			}
+		} else if(arg == "--frames" || arg == "--size"){
+			std::cerr << "Missing value for " << arg << std::endl;
+			return -1;
+		} else {
+			std::cerr << "Unknown argument: " << arg << std::endl;
+			return -1;
+		}
 	}
 
-	//Get window effective size.
-	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
+	GLFWwindow* window = nullptr;
+	int width = benchmark.width;
+	int height = benchmark.height;
+	if(!headless){
+		// Init glfw.
+		if(!glfwInit()){
+			std::cerr << "Could not init GLFW" << std::endl;
+			return -2;
+		}
+		// Don't create an OpenGL context.
+		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
+		// Create window
+		window = glfwCreateWindow(720, 480, "Dragon WebGPU", nullptr, nullptr);
+		if(!window){
+			std::cerr << "Could not create GLFW window" << std::endl;
+			glfwTerminate();
+			return -3;
+		}
+
+		//Get window effective size.
+		glfwGetFramebufferSize(window, &width, &height);
+	}
 
 	// Create the instance.
 	WGPUInstanceDescriptor instanceDesc {};
@@ -158,12 +212,14 @@ int main(int argc, char** argv){
 	}
 
 	// Query the surface from the GLFW window via helper.
-	WGPUSurface surface = glfwGetWGPUSurface(instance, window);
+	WGPUSurface surface = headless ? nullptr : glfwGetWGPUSurface(instance, window);
 
 	/// Adapter
 	WGPURequestAdapterOptions adapOptions{};
 	adapOptions.nextInChain = nullptr;
+	// Without surface, any adapter is valid, including a software one.
 	adapOptions.compatibleSurface = surface;
+	adapOptions.forceFallbackAdapter = headless && benchmark.fallback;
 	AsyncResult<WGPUAdapter> adapterResult;
 	wgpuInstanceRequestAdapter(instance, &adapOptions, requestAdapterCallback, &adapterResult);
 	assert(adapterResult.complete);
@@ -181,13 +237,34 @@ int main(int argc, char** argv){
 	WGPURequiredLimits requestedLimits{nullptr};
 	requestedLimits.nextInChain = nullptr;
 	populateRequestLimits(supportedLimits.limits, requestedLimits.limits);
+	if(headless){
+		// The offscreen target and its readback buffer have to fit in the adapter limits.
+		if(uint32_t(width) > requestedLimits.limits.maxTextureDimension2D || uint32_t(height) > requestedLimits.limits.maxTextureDimension2D){
+			std::cerr << "Offscreen size " << width << "x" << height << " exceeds the maximum texture size of " << requestedLimits.limits.maxTextureDimension2D << std::endl;
+			return -1;
+		}
+		// Offscreen frames are read back in a buffer, with rows aligned to 256 bytes.
+		const uint64_t readbackSize = uint64_t((width * 4 + 255) / 256) * 256 * height;
+		if(readbackSize > supportedLimits.limits.maxBufferSize){
+			std::cerr << "Offscreen readback of " << readbackSize << " bytes exceeds the adapter maximum buffer size of " << supportedLimits.limits.maxBufferSize << " bytes" << std::endl;
+			return -1;
+		}
+		requestedLimits.limits.maxBufferSize = std::max(requestedLimits.limits.maxBufferSize, readbackSize);
+	}
+
+	// Optional features.
+	std::vector<WGPUFeatureName> features;
+	const bool timestamps = wgpuAdapterHasFeature(adapter, WGPUFeatureName_TimestampQuery);
+	if(timestamps){
+		features.push_back(WGPUFeatureName_TimestampQuery);
+	}
 
 	/// Device
 	WGPUDeviceDescriptor deviceDesc{};
 	deviceDesc.nextInChain = nullptr;
 	deviceDesc.label = "Dragon device";
-	deviceDesc.requiredFeaturesCount = 0;
-	deviceDesc.requiredFeatures = nullptr;
+	deviceDesc.requiredFeaturesCount = features.size();
+	deviceDesc.requiredFeatures = features.data();
 
 	deviceDesc.requiredLimits = &requestedLimits;
 	deviceDesc.defaultQueue = {};
@@ -210,6 +287,25 @@ int main(int argc, char** argv){
 		return -1;
 	}
 
+	if(profile){
+		Profiler::init(device, timestamps);
+	}
+
+	/// Headless benchmark, no swapchain needed.
+	if(headless){
+		GPU::init(device, uboAlignment);
+		const int result = Benchmark::run(device, queue, timestamps, benchmark);
+		if(profile){
+			Profiler::report(std::cout, profileJSON);
+			Profiler::clean();
+		}
+		GPU::clean();
+		wgpuDeviceRelease(device);
+		wgpuAdapterRelease(adapter);
+		wgpuInstanceRelease(instance);
+		return result;
+	}
+
 	/// Create the swapchain.
 	WGPUTextureFormat selectedFormat;
 	WGPUSwapChain swapchain = createSwapchain(device, surface, width, height, selectedFormat);
@@ -230,6 +326,7 @@ int main(int argc, char** argv){
 	glfwSetWindowIconifyCallback(window, window_iconify_callback);
 
 	double timer = glfwGetTime();
+	double reportTimer = timer;
 
 	/// Create the renderer.
 	Renderer renderer;
@@ -281,6 +378,7 @@ int main(int argc, char** argv){
 		WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, &encoderDesc);
 
 		renderer.draw(queue, encoder, backbuffer);
+		Profiler::resolve(encoder);
 
 		// Generate filled command buffer and submit it to the queue.
 		WGPUCommandBufferDescriptor commandBufferDesc{};
@@ -288,6 +386,7 @@ int main(int argc, char** argv){
 		commandBufferDesc.label = "Main command buffer";
 		WGPUCommandBuffer commandBuffer = wgpuCommandEncoderFinish(encoder, &commandBufferDesc);
 		wgpuQueueSubmit(queue, 1, &commandBuffer);
+		Profiler::submitted();
 
 		// Done with the backbuffer, return it to the swapchain for presentation.
 		wgpuTextureViewRelease(backbuffer);
@@ -296,10 +395,17 @@ int main(int argc, char** argv){
 		wgpuCommandBufferRelease(commandBuffer);
 		wgpuCommandEncoderRelease(encoder);
 
+		// Periodic timings report.
+		if(profile && (currentTime - reportTimer) > 2.0){
+			Profiler::report(std::cout, profileJSON);
+			reportTimer = currentTime;
+		}
+
 	}
 
 	// Cleanup everything.
 	renderer.clean();
+	Profiler::clean();
 
 	GPU::clean();
 	wgpuSwapChainRelease(swapchain);
@@ -55,7 +55,7 @@ void Resources::loadImage(const std::string & path, Image& image, bool flip){
 		return;
 	}
 	
-	stbi_set_flip_vertically_on_load(flip);
+	// Don't use the stb_image flip option, it is a global state shared by loading threads.
 	// Force 4 channels.
 	int localChannels = 4;
 	int localWidth = 0;
@@ -73,6 +73,13 @@ void Resources::loadImage(const std::string & path, Image& image, bool flip){
 	image.c = (unsigned int)localChannels;
 	image.data = std::vector<unsigned char>(data, data + image.w * image.h * image.c);
 	STBI_FREE(data);
+
+	if(flip){
+		const size_t rowSize = image.w * image.c;
+		for(unsigned int y = 0; y < image.h / 2; ++y){
+			std::swap_ranges(image.data.begin() + y * rowSize, image.data.begin() + (y + 1) * rowSize, image.data.begin() + (image.h - 1 - y) * rowSize);
+		}
+	}
 }
 
 